@@ -0,0 +1,196 @@
+ // Display list of text draw commands, see DISPLAY_LIST in User_Setup.h
+ // This is part of the GxFont_GFX_TFT_eSPI class and is included at the end of GxFont_GFX_TFT_eSPI.cpp
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Paged displays run the same drawing code once per page. While recording, the text
+// functions do all layout work once and store each glyph and background fill with its
+// position and bounding box. replay() then only decodes the glyphs that touch the page.
+////////////////////////////////////////////////////////////////////////////////////////
+
+/***************************************************************************************
+** Function name:           startRecording
+** Description:             start capturing text draw commands instead of drawing them
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::startRecording(DisplayCommand* commands, uint16_t capacity)
+{
+  flushSpans();
+  displayList          = commands;
+  displayListCapacity  = commands ? capacity : 0;
+  displayListSize      = 0;
+  displayListOverflow  = false;
+  displayListRecording = true;
+}
+
+
+/***************************************************************************************
+** Function name:           stopRecording
+** Description:             end capturing, returns false if the list was too small
+***************************************************************************************/
+bool GxFont_GFX_TFT_eSPI::stopRecording(void)
+{
+  displayListRecording = false;
+  return !displayListOverflow;
+}
+
+
+/***************************************************************************************
+** Function name:           displayListCount
+** Description:             return the number of recorded commands
+***************************************************************************************/
+uint16_t GxFont_GFX_TFT_eSPI::displayListCount(void) const
+{
+  return displayListSize;
+}
+
+
+/***************************************************************************************
+** Function name:           recordCommand
+** Description:             store a command if recording, returns true if it was captured
+***************************************************************************************/
+bool GxFont_GFX_TFT_eSPI::recordCommand(uint8_t kind, uint16_t code, int32_t x, int32_t y, uint32_t color, uint32_t bg,
+                                        uint8_t size, int32_t bx, int32_t by, int32_t bw, int32_t bh)
+{
+  if (!displayListRecording) return false;
+
+  // Nothing to draw, e.g. a free font space
+  if ((bw <= 0) || (bh <= 0)) return true;
+
+  if (displayListSize >= displayListCapacity)
+  {
+    displayListOverflow = true;
+    return true;
+  }
+
+  DisplayCommand *cmd = &displayList[displayListSize++];
+#if defined (LOAD_GFXFF) && defined (GFX_SPANS)
+  if ((kind == 1) && gfxFont && gfxSpans) kind = DL_SPANS;
+#endif
+#if defined (LOAD_GFXFF) && defined (GFX_PACKED)
+  if ((kind == 1) && gfxFont && gfxPacked) kind = DL_PACKED;
+#endif
+#ifdef LOAD_GFXFF
+  cmd->gfx   = ((kind == 1) || (kind == DL_SPANS) || (kind == DL_PACKED)) ? gfxFont : NULL;
+#endif
+  cmd->x     = x;
+  cmd->y     = y;
+  cmd->bx    = bx;
+  cmd->by    = by;
+  cmd->bw    = bw;
+  cmd->bh    = bh;
+  cmd->color = color;
+  cmd->bg    = bg;
+  cmd->code  = code;
+  cmd->kind  = kind;
+  cmd->size  = size;
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           replay
+** Description:             draw the recorded commands that intersect an area
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::replay(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if (displayListRecording) return;
+
+  // The commands carry their own font and colours, restore the settings afterwards
+  uint32_t color = textcolor, bg = textbgcolor;
+  uint8_t  size = textsize;
+  int32_t  cx = cursor_x, cy = cursor_y;
+#ifdef LOAD_GFXFF
+  GFXfont *gfx = gfxFont;
+#endif
+#if defined (LOAD_GFXFF) && defined (GFX_SPANS)
+  bool     spans = gfxSpans;
+#endif
+#if defined (LOAD_GFXFF) && defined (GFX_PACKED)
+  bool     packed = gfxPacked;
+#endif
+
+  // Trim glyphs crossing the edge of the area as well
+  int16_t  clip[4] = { clipX0, clipY0, clipX1, clipY1 };
+  setClipRect(x, y, w, h);
+  if (clipX0 < clip[0]) clipX0 = clip[0];
+  if (clipY0 < clip[1]) clipY0 = clip[1];
+  if (clipX1 > clip[2]) clipX1 = clip[2];
+  if (clipY1 > clip[3]) clipY1 = clip[3];
+
+  for (uint16_t i = 0; i < displayListSize; i++)
+  {
+    const DisplayCommand *cmd = &displayList[i];
+
+    // Skip commands that do not touch the area
+    if ((cmd->bx >= x + w) || (cmd->bx + cmd->bw <= x) ||
+        (cmd->by >= y + h) || (cmd->by + cmd->bh <= y)) continue;
+
+    switch (cmd->kind)
+    {
+      case DL_FILL:
+        sinkRect(cmd->bx, cmd->by, cmd->bw, cmd->bh, cmd->color);
+        break;
+      case 1:
+#ifdef LOAD_GFXFF
+        gfxFont = (GFXfont *)cmd->gfx;
+#endif
+#if defined (LOAD_GFXFF) && defined (GFX_SPANS)
+        gfxSpans = false;
+#endif
+#if defined (LOAD_GFXFF) && defined (GFX_PACKED)
+        gfxPacked = false;
+#endif
+        drawChar(cmd->x, cmd->y, cmd->code, cmd->color, cmd->bg, cmd->size);
+        break;
+#if defined (LOAD_GFXFF) && defined (GFX_SPANS)
+      case DL_SPANS:
+        gfxFont  = (GFXfont *)cmd->gfx;
+        gfxSpans = true;
+        drawChar(cmd->x, cmd->y, cmd->code, cmd->color, cmd->bg, cmd->size);
+        break;
+#endif
+#if defined (LOAD_GFXFF) && defined (GFX_PACKED)
+      case DL_PACKED:
+        gfxFont   = (GFXfont *)cmd->gfx;
+        gfxPacked = true;
+        drawChar(cmd->x, cmd->y, cmd->code, cmd->color, cmd->bg, cmd->size);
+        break;
+#endif
+#ifdef SMOOTH_FONT
+      case DL_SMOOTH:
+        if (!fontLoaded) break;
+        textcolor   = cmd->color;
+        textbgcolor = cmd->bg;
+        cursor_x    = cmd->x;
+        cursor_y    = cmd->y;
+        drawGlyph(cmd->code);
+        break;
+#endif
+      default:
+        textcolor   = cmd->color;
+        textbgcolor = cmd->bg;
+        textsize    = cmd->size;
+        drawChar(cmd->code, cmd->x, cmd->y, cmd->kind);
+        break;
+    }
+  }
+
+  flushSpans();
+  clipX0      = clip[0];
+  clipY0      = clip[1];
+  clipX1      = clip[2];
+  clipY1      = clip[3];
+  textcolor   = color;
+  textbgcolor = bg;
+  textsize    = size;
+  cursor_x    = cx;
+  cursor_y    = cy;
+#ifdef LOAD_GFXFF
+  gfxFont     = gfx;
+#endif
+#if defined (LOAD_GFXFF) && defined (GFX_SPANS)
+  gfxSpans    = spans;
+#endif
+#if defined (LOAD_GFXFF) && defined (GFX_PACKED)
+  gfxPacked   = packed;
+#endif
+}
@@ -0,0 +1,44 @@
+ // Display list of text draw commands, see DISPLAY_LIST in User_Setup.h
+ // This is part of the GxFont_GFX_TFT_eSPI class and is included inside the class definition
+
+ // Command kinds besides the font numbers 1 to 8
+#define DL_FILL    0 // Background or padding fill
+#define DL_SMOOTH  9 // Glyph of the loaded smooth font
+#define DL_SPANS  10 // Font 1 glyph of a GFXfontSpans
+#define DL_PACKED 11 // Font 1 glyph of a GFXfontPacked
+
+ public:
+
+  // One recorded glyph or background fill, with the box it can draw into
+  typedef struct {
+#ifdef LOAD_GFXFF
+    const GFXfont *gfx; // Free font of a font 1, DL_SPANS or DL_PACKED glyph, NULL for the GLCD font
+#endif
+    int16_t  x, y;      // Position passed to drawChar(), or the cursor for smooth fonts
+    int16_t  bx, by;    // Bounding box of the pixels the command can draw
+    int16_t  bw, bh;
+    uint16_t color, bg;
+    uint16_t code;      // Character code, 0 for a fill
+    uint8_t  kind;      // Font number 1 to 8, DL_SMOOTH, DL_SPANS, DL_PACKED or DL_FILL
+    uint8_t  size;      // Text size multiplier
+  } DisplayCommand;
+
+  // Capture the commands of the following drawString(), drawChar(), print() etc. calls in
+  // commands[] instead of drawing them. The list stays valid until the next startRecording().
+  void     startRecording(DisplayCommand* commands, uint16_t capacity);
+  // Ends recording, returns false if commands were dropped because the list was full
+  bool     stopRecording(void);
+  // Draw the recorded commands whose box intersects the given area, e.g. the current page
+  void     replay(int32_t x, int32_t y, int32_t w, int32_t h);
+  uint16_t displayListCount(void) const;
+
+ protected:
+
+  DisplayCommand *displayList; // Storage of the list, NULL if none
+  uint16_t displayListCapacity;
+  uint16_t displayListSize;
+  bool     displayListRecording;
+  bool     displayListOverflow;
+
+  bool     recordCommand(uint8_t kind, uint16_t code, int32_t x, int32_t y, uint32_t color, uint32_t bg,
+                         uint8_t size, int32_t bx, int32_t by, int32_t bw, int32_t bh);
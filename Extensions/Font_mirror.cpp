@@ -0,0 +1,108 @@
+ // RAM copies of the RLE fonts, see FONT_MIRROR in User_Setup.h
+ // This is part of the GxFont_GFX_TFT_eSPI class and is included at the end of GxFont_GFX_TFT_eSPI.cpp
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Each glyph is decoded once into rows of bits. Characters sharing glyph data in the
+// font (the blank glyph of fonts 6, 7 and 8) share one copy. mirrorKernel() in
+// GxFontRenderer.h draws from these rows.
+////////////////////////////////////////////////////////////////////////////////////////
+
+#define MIRROR_ROW_BYTES(width) ((((width) + 31) / 32) * 4)
+
+
+/***************************************************************************************
+** Function name:           preloadFont
+** Description:             decode an RLE font into RAM
+***************************************************************************************/
+uint32_t GxFont_GFX_TFT_eSPI::preloadFont(uint8_t font)
+{
+#ifdef LOAD_RLE
+  if ((font < 3) || (font > 8)) return 0;
+  if (fontMirror[font]) return fontMirrorSize[font];
+
+  const uint8_t* const* chrtbl = (const uint8_t* const*)pgm_read_dword(&fontdata[font].chartbl);
+  const uint8_t* widthtbl = (const uint8_t*)pgm_read_dword(&fontdata[font].widthtbl);
+  uint8_t height = pgm_read_byte(&fontdata[font].height);
+  if (!height) return 0; // Font not loaded
+
+  // Size the block, glyph data used by several characters is counted once
+  uint32_t bytes = 96 * sizeof(uint16_t);
+  for (uint8_t c = 0; c < 96; c++)
+  {
+    uintptr_t data = pgm_read_dword(&chrtbl[c]);
+    uint8_t prev = 0;
+    while ((prev < c) && (pgm_read_dword(&chrtbl[prev]) != data)) prev++;
+    if (prev == c) bytes += MIRROR_ROW_BYTES(pgm_read_byte(widthtbl + c)) * height;
+  }
+  if (bytes > 0xFFFF) return 0; // Offsets are 16 bit
+
+  uint8_t* block = (uint8_t*)malloc(bytes);
+  if (!block) return 0;
+  memset(block, 0, bytes);
+
+  uint16_t* offsets = (uint16_t*)block;
+  uint32_t next = 96 * sizeof(uint16_t);
+  for (uint8_t c = 0; c < 96; c++)
+  {
+    uintptr_t data = pgm_read_dword(&chrtbl[c]);
+    uint8_t prev = 0;
+    while ((prev < c) && (pgm_read_dword(&chrtbl[prev]) != data)) prev++;
+    if (prev < c)
+    {
+      offsets[c] = offsets[prev];
+      continue;
+    }
+    offsets[c] = next;
+
+    // Decode the runs, setting the bits of the foreground runs
+    int width = pgm_read_byte(widthtbl + c);
+    int rowBytes = MIRROR_ROW_BYTES(width);
+    uint8_t* rows = block + next;
+    int pc = 0, total = width * height;
+    while (pc < total)
+    {
+      uint8_t line = pgm_read_byte((uint8_t*)data++);
+      int run = (line & 0x7F) + 1;
+      if (line & 0x80)
+      {
+        for (int i = pc; (i < pc + run) && (i < total); i++)
+        {
+          int px = i % width;
+          rows[(i / width) * rowBytes + (px >> 3)] |= 0x80 >> (px & 7);
+        }
+      }
+      pc += run;
+    }
+    next += rowBytes * height;
+  }
+
+  fontMirror[font] = block;
+  fontMirrorSize[font] = bytes;
+  return bytes;
+#else
+  return 0;
+#endif
+}
+
+
+/***************************************************************************************
+** Function name:           releaseFont
+** Description:             free the RAM copy of a font
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::releaseFont(uint8_t font)
+{
+  if ((font > 8) || !fontMirror[font]) return;
+  free(fontMirror[font]);
+  fontMirror[font] = NULL;
+  fontMirrorSize[font] = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           fontMirrorBytes
+** Description:             return the RAM used by the copy of a font
+***************************************************************************************/
+uint32_t GxFont_GFX_TFT_eSPI::fontMirrorBytes(uint8_t font) const
+{
+  return (font > 8) ? 0 : fontMirrorSize[font];
+}
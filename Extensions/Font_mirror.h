@@ -0,0 +1,22 @@
+ // RAM copies of the RLE fonts, see FONT_MIRROR in User_Setup.h
+ // This is part of the GxFont_GFX_TFT_eSPI class and is included inside the class definition
+
+ public:
+
+  // Decode RLE font 4, 6, 7 or 8 into RAM as 1 bit per pixel rows, the font is then drawn
+  // from RAM. Returns the bytes allocated, or 0 if the font is not loaded or RAM is short.
+  uint32_t preloadFont(uint8_t font);
+  // Free the RAM copy, the font is then drawn from FLASH again
+  void     releaseFont(uint8_t font);
+  // Bytes used by the RAM copy of a font, 0 if it is not preloaded
+  uint32_t fontMirrorBytes(uint8_t font) const;
+
+ protected:
+
+  // Per font number: a table of 96 glyph offsets into the block, then the glyph rows,
+  // each row MSB left and padded to a multiple of 4 bytes so it can be scanned a word at a time
+  uint8_t *fontMirror[9];
+  uint32_t fontMirrorSize[9];
+
+  template <class Sink, bool Scaled, bool Opaque>
+  void     mirrorKernel(Sink& sink, int32_t x, int32_t y, const uint8_t* rows, int width, int height);
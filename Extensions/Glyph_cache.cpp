@@ -0,0 +1,332 @@
+ // Cache of decoded glyph runs, see GLYPH_CACHE in User_Setup.h
+ // This is part of the GxFont_GFX_TFT_eSPI class and is included at the end of GxFont_GFX_TFT_eSPI.cpp
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Glyphs are decoded once into a list of foreground runs in glyph coordinates. Runs
+// are stored unscaled so the same entry serves every text size and colour.
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Collects the runs of a glyph, runs that touch on the same row are merged.
+// With a NULL run array the runs are only counted.
+struct GlyphRunWriter
+{
+  GxFont_GFX_TFT_eSPI::GlyphRun *runs;
+  GxFont_GFX_TFT_eSPI::GlyphRun  last;
+  uint16_t count;
+
+  void add(uint8_t x, uint8_t y, uint8_t w)
+  {
+    if (count && (last.y == y) && (last.x + last.w == x)) last.w += w;
+    else
+    {
+      if (count && runs) runs[count - 1] = last;
+      last.x = x;
+      last.y = y;
+      last.w = w;
+      count++;
+    }
+  }
+
+  uint16_t finish(void)
+  {
+    if (count && runs) runs[count - 1] = last;
+    return count;
+  }
+};
+
+
+/***************************************************************************************
+** Function name:           setGlyphCacheAllocator
+** Description:             set the functions used to allocate and free run storage
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::setGlyphCacheAllocator(void* (*allocFn)(size_t), void (*freeFn)(void*))
+{
+  clearGlyphCache();
+  glyphCacheAlloc = allocFn;
+  glyphCacheFree  = freeFn;
+}
+
+
+/***************************************************************************************
+** Function name:           clearGlyphCache
+** Description:             drop all cached glyphs and free their storage
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::clearGlyphCache(void)
+{
+  for (uint16_t i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+  {
+    if (glyphCache[i].runs) glyphCacheFree(glyphCache[i].runs);
+    glyphCache[i].runs = NULL;
+    glyphCache[i].font = NULL;
+  }
+  glyphCacheStats.bytes   = 0;
+  glyphCacheStats.entries = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           getGlyphCacheStats
+** Description:             return hit/miss counts and memory use of the glyph cache
+***************************************************************************************/
+const GxFont_GFX_TFT_eSPI::GlyphCacheStats& GxFont_GFX_TFT_eSPI::getGlyphCacheStats(void) const
+{
+  return glyphCacheStats;
+}
+
+
+/***************************************************************************************
+** Function name:           resetGlyphCacheStats
+** Description:             clear the hit, miss and eviction counts
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::resetGlyphCacheStats(void)
+{
+  glyphCacheStats.hits      = 0;
+  glyphCacheStats.misses    = 0;
+  glyphCacheStats.evictions = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           drawCachedGlyph
+** Description:             draw a glyph from the cache, decoding it on a miss
+***************************************************************************************/
+// fontNum is 1 for GLCD or the current free font, code is the index of the glyph in
+// the font. Returns false if the glyph cannot be cached, the caller then decodes it.
+bool GxFont_GFX_TFT_eSPI::drawCachedGlyph(uint8_t fontNum, uint16_t code, int32_t x, int32_t y, uint8_t size,
+                                          uint32_t fg, uint32_t bg, bool opaque)
+{
+  const void *key = &fontdata[fontNum];
+#ifdef LOAD_GFXFF
+  if ((fontNum == 1) && gfxFont) key = gfxFont;
+#endif
+
+  GlyphCacheEntry *e = NULL;
+  for (uint16_t i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+  {
+    if ((glyphCache[i].font == key) && (glyphCache[i].code == code))
+    {
+      e = &glyphCache[i];
+      break;
+    }
+  }
+
+  if (e) glyphCacheStats.hits++;
+  else
+  {
+    uint8_t  w, h;
+    uint16_t count = decodeGlyphRuns(fontNum, code, NULL, &w, &h);
+    uint32_t bytes = count * sizeof(GlyphRun);
+    if (bytes > GLYPH_CACHE_BYTES) return false;
+
+    // Drop least recently used glyphs until there is a free entry and the runs fit
+    while (true)
+    {
+      GlyphCacheEntry *lru = NULL;
+      e = NULL;
+      for (uint16_t i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+      {
+        if (!glyphCache[i].font) e = &glyphCache[i];
+        else if (!lru || (glyphCache[i].used < lru->used)) lru = &glyphCache[i];
+      }
+      if (e && (glyphCacheStats.bytes + bytes <= GLYPH_CACHE_BYTES)) break;
+
+      if (lru->runs) glyphCacheFree(lru->runs);
+      glyphCacheStats.bytes -= lru->count * sizeof(GlyphRun);
+      glyphCacheStats.entries--;
+      glyphCacheStats.evictions++;
+      lru->runs = NULL;
+      lru->font = NULL;
+    }
+
+    e->runs = NULL;
+    if (count)
+    {
+      e->runs = (GlyphRun*)glyphCacheAlloc(bytes);
+      if (!e->runs) return false;
+      decodeGlyphRuns(fontNum, code, e->runs, &w, &h);
+    }
+    e->font  = key;
+    e->code  = code;
+    e->count = count;
+    e->w     = w;
+    e->h     = h;
+    glyphCacheStats.bytes += bytes;
+    glyphCacheStats.entries++;
+    glyphCacheStats.misses++;
+  }
+
+  e->used = ++glyphCacheTick;
+  drawGlyphRuns(e->runs, e->count, e->w, e->h, x, y, size, fg, bg, opaque);
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           decodeGlyphRuns
+** Description:             decode the foreground runs of a glyph in any font format
+***************************************************************************************/
+// Returns the number of runs, with runs == NULL they are only counted
+uint16_t GxFont_GFX_TFT_eSPI::decodeGlyphRuns(uint8_t fontNum, uint16_t code, GlyphRun* runs, uint8_t* w, uint8_t* h)
+{
+  GlyphRunWriter out = { runs, { 0, 0, 0 }, 0 };
+  uint8_t run = 0;
+  *w = *h = 0;
+
+#ifdef LOAD_GFXFF
+  if ((fontNum == 1) && gfxFont)
+  {
+    GFXglyph *glyph  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[code]);
+    uint8_t  *bitmap = (uint8_t *)pgm_read_dword(&gfxFont->bitmap);
+    uint16_t  bo     = pgm_read_word(&glyph->bitmapOffset);
+    uint8_t   bits   = 0, bit = 0;
+
+    *w = pgm_read_byte(&glyph->width);
+    *h = pgm_read_byte(&glyph->height);
+    for (uint8_t yy = 0; yy < *h; yy++)
+    {
+      for (uint8_t xx = 0; xx < *w; xx++)
+      {
+        if (bit == 0) {
+          bits = pgm_read_byte(&bitmap[bo++]);
+          bit  = 0x80;
+        }
+        if (bits & bit) run++;
+        else if (run) {
+          out.add(xx - run, yy, run);
+          run = 0;
+        }
+        bit >>= 1;
+      }
+      if (run) out.add(*w - run, yy, run);
+      run = 0;
+    }
+    return out.finish();
+  }
+#endif
+
+#ifdef LOAD_GLCD
+  if (fontNum == 1)
+  {
+    uint8_t column[5];
+    for (uint8_t i = 0; i < 5; i++) column[i] = pgm_read_byte(font + (code * 5) + i);
+
+    *w = 6;
+    *h = 8;
+    for (uint8_t j = 0; j < 8; j++)
+    {
+      for (uint8_t i = 0; i < 5; i++)
+      {
+        if (column[i] & (1 << j)) run++;
+        else if (run) {
+          out.add(i - run, j, run);
+          run = 0;
+        }
+      }
+      if (run) out.add(5 - run, j, run);
+      run = 0;
+    }
+    return out.finish();
+  }
+#endif
+
+#ifdef LOAD_FONT2
+  if (fontNum == 2)
+  {
+    uint8_t *data  = (uint8_t *)pgm_read_dword(&chrtbl_f16[code]);
+    uint8_t  bytes = (pgm_read_byte(widtbl_f16 + code) + 6) / 8;
+
+    *w = pgm_read_byte(widtbl_f16 + code);
+    *h = chr_hgt_f16;
+    for (uint8_t i = 0; i < *h; i++)
+    {
+      for (uint8_t k = 0; k < bytes; k++)
+      {
+        uint8_t line = pgm_read_byte(data++);
+        for (uint8_t b = 0; b < 8; b++)
+        {
+          if (line & (0x80 >> b)) run++;
+          else if (run) {
+            out.add(k * 8 + b - run, i, run);
+            run = 0;
+          }
+        }
+      }
+      if (run) out.add(bytes * 8 - run, i, run);
+      run = 0;
+    }
+    return out.finish();
+  }
+#endif
+
+#ifdef LOAD_RLE
+  if ((fontNum > 2) && (fontNum < 9))
+  {
+    uint8_t *data = (uint8_t *)pgm_read_dword( pgm_read_dword( &(fontdata[fontNum].chartbl ) ) + code * sizeof(void *) );
+
+    *w = pgm_read_byte( (uint8_t *)pgm_read_dword( &(fontdata[fontNum].widthtbl ) ) + code );
+    *h = pgm_read_byte( &fontdata[fontNum].height );
+    if (*w == 0) return 0;
+
+    uint16_t pc = 0, total = *w * *h;
+    uint8_t  px = 0, py = 0;
+    while (pc < total)
+    {
+      uint8_t line = pgm_read_byte(data++);
+      uint8_t len  = (line & 0x7F) + 1;
+      pc += len;
+      // Split the run where it wraps onto the next row
+      while (len)
+      {
+        uint8_t seg = *w - px;
+        if (seg > len) seg = len;
+        if (line & 0x80) out.add(px, py, seg);
+        len -= seg;
+        px  += seg;
+        if (px == *w) {
+          px = 0;
+          py++;
+        }
+      }
+    }
+    return out.finish();
+  }
+#endif
+
+  return out.finish();
+}
+
+
+/***************************************************************************************
+** Function name:           drawGlyphRuns
+** Description:             draw decoded runs, opaque text also fills the gaps in the cell
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::drawGlyphRuns(const GlyphRun* runs, uint16_t count, uint8_t w, uint8_t h,
+                                        int32_t x, int32_t y, uint8_t size, uint32_t fg, uint32_t bg, bool opaque)
+{
+  if (!opaque)
+  {
+    while (count--)
+    {
+      addSpan(0, x + runs->x * size, y + runs->y * size, runs->w * size, size, fg);
+      runs++;
+    }
+  }
+  else
+  {
+    const GlyphRun* end = runs + count;
+    for (uint8_t row = 0; row < h; row++)
+    {
+      int32_t py = y + row * size;
+      uint8_t gx = 0; // First column not yet drawn
+      while ((runs < end) && (runs->y == row))
+      {
+        if (runs->x > gx) addSpan(1, x + gx * size, py, (runs->x - gx) * size, size, bg);
+        addSpan(0, x + runs->x * size, py, runs->w * size, size, fg);
+        gx = runs->x + runs->w;
+        runs++;
+      }
+      if (gx < w) addSpan(1, x + gx * size, py, (w - gx) * size, size, bg);
+    }
+  }
+  flushSpans();
+}
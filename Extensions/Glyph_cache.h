@@ -0,0 +1,46 @@
+ // Cache of decoded glyph runs, see GLYPH_CACHE in User_Setup.h
+ // This is part of the GxFont_GFX_TFT_eSPI class and is included inside the class definition
+
+ public:
+
+  // A horizontal run of foreground pixels in glyph coordinates, before scaling
+  typedef struct {
+    uint8_t x, y, w;
+  } GlyphRun;
+
+  typedef struct {
+    uint32_t hits;      // Glyphs drawn from the cache
+    uint32_t misses;    // Glyphs decoded and added to the cache
+    uint32_t evictions; // Least recently used glyphs dropped to make room
+    uint32_t bytes;     // Run storage in use
+    uint16_t entries;   // Glyphs in the cache
+  } GlyphCacheStats;
+
+  // Replace malloc()/free() for the run storage, e.g. to place it in PSRAM, clears the cache
+  void     setGlyphCacheAllocator(void* (*allocFn)(size_t), void (*freeFn)(void*));
+  void     clearGlyphCache(void);
+  const GlyphCacheStats& getGlyphCacheStats(void) const;
+  void     resetGlyphCacheStats(void);
+
+ protected:
+
+  typedef struct {
+    const void *font;   // Font table (fontdata entry or GFXfont) the glyph belongs to, NULL if unused
+    GlyphRun   *runs;   // Foreground runs in row order
+    uint32_t    used;   // Value of glyphCacheTick when last drawn
+    uint16_t    code;   // Glyph index within the font
+    uint16_t    count;  // Number of runs
+    uint8_t     w, h;   // Glyph cell size, opaque text fills the gaps of this box
+  } GlyphCacheEntry;
+
+  GlyphCacheEntry glyphCache[GLYPH_CACHE_ENTRIES];
+  GlyphCacheStats glyphCacheStats;
+  uint32_t glyphCacheTick;
+  void*    (*glyphCacheAlloc)(size_t);
+  void     (*glyphCacheFree)(void*);
+
+  bool     drawCachedGlyph(uint8_t fontNum, uint16_t code, int32_t x, int32_t y, uint8_t size,
+                           uint32_t fg, uint32_t bg, bool opaque);
+  uint16_t decodeGlyphRuns(uint8_t fontNum, uint16_t code, GlyphRun* runs, uint8_t* w, uint8_t* h);
+  void     drawGlyphRuns(const GlyphRun* runs, uint16_t count, uint8_t w, uint8_t h, int32_t x, int32_t y,
+                         uint8_t size, uint32_t fg, uint32_t bg, bool opaque);
@@ -0,0 +1,204 @@
+ // Number display that only redraws changed characters, see NUMERIC_FIELD in User_Setup.h
+ // This is included at the end of GxFont_GFX_TFT_eSPI.cpp
+
+/***************************************************************************************
+** Function name:           GxNumericField
+** Description:             Constructor, white text on black, size 1
+***************************************************************************************/
+GxNumericField::GxNumericField(GxFont_GFX_TFT_eSPI& gfx, int16_t x, int16_t y, uint8_t font, uint8_t datum)
+  : gfx(gfx), x(x), y(y), font(font), datum(datum), size(1), fgcolor(0xFFFF), bgcolor(0x0000)
+{
+  drawn  = false;
+  count  = 0;
+  top    = 0;
+  height = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           setPosition, setTextSize, setTextColor
+** Description:             change where and how the field is drawn
+***************************************************************************************/
+void GxNumericField::setPosition(int16_t x, int16_t y, uint8_t datum)
+{
+  this->x     = x;
+  this->y     = y;
+  this->datum = datum;
+  drawn = false;
+}
+
+void GxNumericField::setTextSize(uint8_t size)
+{
+  this->size = (size > 0) ? size : 1;
+  drawn = false;
+}
+
+void GxNumericField::setTextColor(uint16_t fgcolor, uint16_t bgcolor)
+{
+  this->fgcolor = fgcolor;
+  this->bgcolor = bgcolor;
+  drawn = false;
+}
+
+
+/***************************************************************************************
+** Function name:           invalidate
+** Description:             draw every character on the next update
+***************************************************************************************/
+void GxNumericField::invalidate(void)
+{
+  drawn = false;
+}
+
+
+/***************************************************************************************
+** Function name:           update
+** Description:             draw a number, only the characters that changed are drawn
+***************************************************************************************/
+GxNumericField::Rect GxNumericField::update(long number)
+{
+  char str[12];
+  ltoa(number, str, 10);
+  return update(str);
+}
+
+GxNumericField::Rect GxNumericField::update(float number, uint8_t decimals)
+{
+  char str[14];
+  gfx.formatFloat(number, decimals, str);
+  return update(str);
+}
+
+GxNumericField::Rect GxNumericField::update(const char *string)
+{
+  Rect dirty = { 0, 0, 0, 0 };
+
+  char text[NUMERIC_FIELD_CHARS + 1];
+  strncpy(text, string, NUMERIC_FIELD_CHARS);
+  text[NUMERIC_FIELD_CHARS] = 0;
+
+  // Draw with the field settings, the caller's settings are put back at the end
+  uint8_t  oldSize = gfx.getTextSize();
+  uint32_t oldFg = gfx.textcolor, oldBg = gfx.textbgcolor;
+  gfx.setTextSize(size);
+  gfx.setTextColor(fgcolor, bgcolor);
+
+  GxFont_GFX_TFT_eSPI::TextRun runs[NUMERIC_FIELD_CHARS];
+  GxFont_GFX_TFT_eSPI::TextLayout layout = {};
+  layout.runs     = runs;
+  layout.capacity = NUMERIC_FIELD_CHARS;
+  gfx.layoutString(text, layout, font);
+
+  // Position of the string from the datum, as drawString() places it
+  int16_t w = layout.advance;
+  int16_t h = gfx.fontHeight(font);
+  int16_t baseline = (font == 1) ? 0 : pgm_read_byte(&fontdata[font].baseline) * size;
+  int16_t px = x, py = y;
+  switch (datum)
+  {
+    case TC_DATUM: case MC_DATUM: case BC_DATUM: case C_BASELINE: px -= w / 2; break;
+    case TR_DATUM: case MR_DATUM: case BR_DATUM: case R_BASELINE: px -= w;     break;
+  }
+  switch (datum)
+  {
+    case ML_DATUM: case MC_DATUM: case MR_DATUM:       py -= h / 2;    break;
+    case BL_DATUM: case BC_DATUM: case BR_DATUM:       py -= h;        break;
+    case L_BASELINE: case C_BASELINE: case R_BASELINE: py -= baseline; break;
+  }
+  if (datum != TL_DATUM) // Kept on the screen like drawString() does
+  {
+    if (px < 0) px = 0;
+    if (px + w > gfx.width()) px = gfx.width() - w;
+    if (py < 0) py = 0;
+    if (py + h - baseline > gfx.height()) py = gfx.height() - h;
+  }
+
+  // Cells of the old string are only kept if the rows are unchanged
+  if (drawn && ((py != top) || (h != height)))
+  {
+    Rect erased = clear();
+    addRect(dirty, erased.x, erased.y, erased.w, erased.h);
+  }
+
+  // Draw the characters whose cell or character changed, opaque text fills the whole cell
+  for (uint8_t i = 0; i < layout.count; i++)
+  {
+    int16_t x0 = px + runs[i].x;
+    int16_t x1 = (i + 1 < layout.count) ? px + runs[i + 1].x : px + w;
+    if (drawn && (i < count) && (chars[i] == text[i]) && (cellX[i] == x0) && (cellX[i + 1] == x1)) continue;
+    gfx.drawChar(runs[i].code, x0, py, font);
+    addRect(dirty, x0, py, x1 - x0, h);
+  }
+
+  // Erase what the old string covered outside the new one
+  if (drawn && count)
+  {
+    int16_t oldL = cellX[0], oldR = cellX[count];
+    int16_t newL = px, newR = px + w;
+    if (!layout.count) newL = newR = oldR;
+    if (oldL < newL) fill(dirty, oldL, (oldR < newL) ? oldR : newL);
+    if (oldR > newR) fill(dirty, (oldL > newR) ? oldL : newR, oldR);
+  }
+
+  count = layout.count;
+  for (uint8_t i = 0; i < count; i++)
+  {
+    chars[i] = text[i];
+    cellX[i] = px + runs[i].x;
+  }
+  cellX[count] = px + w;
+  top    = py;
+  height = h;
+  drawn  = true;
+
+  gfx.setTextSize(oldSize);
+  gfx.textcolor   = oldFg;
+  gfx.textbgcolor = oldBg;
+  return dirty;
+}
+
+
+/***************************************************************************************
+** Function name:           clear
+** Description:             erase the characters of the field
+***************************************************************************************/
+GxNumericField::Rect GxNumericField::clear(void)
+{
+  Rect dirty = { 0, 0, 0, 0 };
+  if (drawn && count) fill(dirty, cellX[0], cellX[count]);
+  count = 0;
+  drawn = false;
+  return dirty;
+}
+
+
+/***************************************************************************************
+** Function name:           fill, addRect
+** Description:             erase columns x0 to x1 of the field, grow the dirty rectangle
+***************************************************************************************/
+void GxNumericField::fill(Rect& dirty, int16_t x0, int16_t x1)
+{
+  if (x1 <= x0) return;
+  gfx.fillRect(x0, top, x1 - x0, height, bgcolor);
+  addRect(dirty, x0, top, x1 - x0, height);
+}
+
+void GxNumericField::addRect(Rect& dirty, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if ((w <= 0) || (h <= 0)) return;
+  if (!dirty.w)
+  {
+    dirty.x = x;
+    dirty.y = y;
+    dirty.w = w;
+    dirty.h = h;
+    return;
+  }
+  int16_t x1 = dirty.x + dirty.w, y1 = dirty.y + dirty.h;
+  if (x < dirty.x) dirty.x = x;
+  if (y < dirty.y) dirty.y = y;
+  if (x + w > x1) x1 = x + w;
+  if (y + h > y1) y1 = y + h;
+  dirty.w = x1 - dirty.x;
+  dirty.h = y1 - dirty.y;
+}
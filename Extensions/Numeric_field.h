@@ -0,0 +1,58 @@
+ // Number display that only redraws changed characters, see NUMERIC_FIELD in User_Setup.h
+ // This is included after the GxFont_GFX_TFT_eSPI class definition
+
+#ifndef _Numeric_field_H_
+#define _Numeric_field_H_
+
+// Maximum number of characters a field shows, longer strings are cut
+#ifndef NUMERIC_FIELD_CHARS
+#define NUMERIC_FIELD_CHARS 16
+#endif
+
+// Remembers the string, font, size, colours, datum and position last drawn. An update
+// draws only the character cells that changed and erases cells no longer used, and returns
+// the area it touched, e.g. for the partial refresh window of an e-paper display.
+// Works with the built-in fonts 1 to 8, whose character cells do not overlap.
+class GxNumericField
+{
+  public:
+
+    // Area changed by an update, w and h are 0 if nothing was drawn
+    typedef struct {
+      int16_t x, y, w, h;
+    } Rect;
+
+    GxNumericField(GxFont_GFX_TFT_eSPI& gfx, int16_t x, int16_t y, uint8_t font, uint8_t datum = TL_DATUM);
+
+    // Changing the position, size or colours redraws the whole field on the next update
+    void setPosition(int16_t x, int16_t y, uint8_t datum);
+    void setTextSize(uint8_t size);
+    void setTextColor(uint16_t fgcolor, uint16_t bgcolor);
+
+    Rect update(const char *string);
+    Rect update(long number);
+    Rect update(float number, uint8_t decimals);
+
+    // Erase the field, the next update draws every character
+    Rect clear(void);
+    // Draw every character on the next update, e.g. after the screen was cleared
+    void invalidate(void);
+
+  private:
+
+    GxFont_GFX_TFT_eSPI& gfx;
+    int16_t  x, y;
+    uint8_t  font, datum, size;
+    uint16_t fgcolor, bgcolor;
+
+    bool     drawn;                           // False until the first update or after invalidate()
+    uint8_t  count;                           // Characters shown
+    char     chars[NUMERIC_FIELD_CHARS];      // Characters shown
+    int16_t  cellX[NUMERIC_FIELD_CHARS + 1];  // Left edge of each cell and right edge of the last
+    int16_t  top, height;                     // Rows covered by the cells
+
+    void     fill(Rect& dirty, int16_t x0, int16_t x1);
+    static void addRect(Rect& dirty, int16_t x, int16_t y, int16_t w, int16_t h);
+};
+
+#endif
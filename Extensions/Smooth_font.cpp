@@ -10,7 +10,7 @@
 ** Function name:           loadFont
 ** Description:             loads parameters from a new font vlw file stored in SPIFFS
 *************************************************************************************x*/
-void TFT_eSPI::loadFont(String fontName)
+void GxFont_GFX_TFT_eSPI::loadFont(String fontName)
 {
   /*
     The vlw font format does not appear to be documented anywhere, so some reverse
@@ -111,7 +111,7 @@ void TFT_eSPI::loadFont(String fontName)
 ** Description:             Get the metrics for each glyph and store in RAM
 *************************************************************************************x*/
 //#define SHOW_ASCENT_DESCENT
-void TFT_eSPI::loadMetrics(uint16_t gCount)
+void GxFont_GFX_TFT_eSPI::loadMetrics(uint16_t gCount)
 {
   uint32_t headerPtr = 24;
   uint32_t bitmapPtr = 24 + gCount * 28;
@@ -187,7 +187,7 @@ void TFT_eSPI::loadMetrics(uint16_t gCount)
 ** Function name:           deleteMetrics
 ** Description:             Delete the old glyph metrics and free up the memory
 *************************************************************************************x*/
-void TFT_eSPI::unloadFont( void )
+void GxFont_GFX_TFT_eSPI::unloadFont( void )
 {
   if (gUnicode)
   {
@@ -235,93 +235,11 @@ void TFT_eSPI::unloadFont( void )
 }
 
 
-/***************************************************************************************
-** Function name:           decodeUTF8
-** Description:             Line buffer UTF-8 decoder with fall-back to extended ASCII
-*************************************************************************************x*/
-#define DECODE_UTF8
-uint16_t TFT_eSPI::decodeUTF8(uint8_t *buf, uint16_t *index, uint16_t remaining)
-{
-  byte c = buf[(*index)++];
-  //Serial.print("Byte from string = 0x"); Serial.println(c, HEX);
-
-#ifdef DECODE_UTF8
-  // 7 bit Unicode
-  if ((c & 0x80) == 0x00) return c;
-
-  // 11 bit Unicode
-  if (((c & 0xE0) == 0xC0) && (remaining > 1))
-    return ((c & 0x1F)<<6) | (buf[(*index)++]&0x3F);
-
-  // 16 bit Unicode
-  if (((c & 0xF0) == 0xE0) && (remaining > 2))
-    return ((c & 0x0F)<<12) | ((buf[(*index)++]&0x3F)<<6) | ((buf[(*index)++]&0x3F));
-
-  // 21 bit Unicode not supported so fall-back to extended ASCII
-  // if ((c & 0xF8) == 0xF0) return c;
-#endif
-
-  return c; // fall-back to extended ASCII
-}
-
-/***************************************************************************************
-** Function name:           decodeUTF8
-** Description:             Serial UTF-8 decoder with fall-back to extended ASCII
-*************************************************************************************x*/
-uint16_t TFT_eSPI::decodeUTF8(uint8_t c)
-{
-
-#ifdef DECODE_UTF8
-  if (decoderState == 0)
-  {
-    // 7 bit Unicode
-    if ((c & 0x80) == 0x00) return (uint16_t)c;
-
-    // 11 bit Unicode
-    if ((c & 0xE0) == 0xC0)
-    {
-      decoderBuffer = ((c & 0x1F)<<6);
-      decoderState = 1;
-      return 0;
-    }
-
-    // 16 bit Unicode
-    if ((c & 0xF0) == 0xE0)
-    {
-      decoderBuffer = ((c & 0x0F)<<12);
-      decoderState = 2;
-      return 0;
-    }
-    // 21 bit Unicode not supported so fall-back to extended ASCII
-    if ((c & 0xF8) == 0xF0) return (uint16_t)c;
-  }
-  else
-  {
-    if (decoderState == 2)
-    {
-      decoderBuffer |= ((c & 0x3F)<<6);
-      decoderState--;
-      return 0;
-    }
-    else
-    {
-      decoderBuffer |= (c & 0x3F);
-      decoderState = 0;
-      return decoderBuffer;
-    }
-  }
-#endif
-
-  return (uint16_t)c; // fall-back to extended ASCII
-}
-
-
-
 /***************************************************************************************
 ** Function name:           alphaBlend
 ** Description:             Blend foreground and background and return new colour
 *************************************************************************************x*/
-uint16_t TFT_eSPI::alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc)
+uint16_t GxFont_GFX_TFT_eSPI::alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc)
 {
   // For speed use fixed point maths and rounding to permit a power of 2 division
   uint16_t fgR = ((fgc >> 10) & 0x3E) + 1;
@@ -348,7 +266,7 @@ uint16_t TFT_eSPI::alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc)
 ** Function name:           readInt32
 ** Description:             Get a 32 bit integer from the font file
 *************************************************************************************x*/
-uint32_t TFT_eSPI::readInt32(void)
+uint32_t GxFont_GFX_TFT_eSPI::readInt32(void)
 {
   uint32_t val = 0;
   val |= fontFile.read() << 24;
@@ -363,7 +281,7 @@ uint32_t TFT_eSPI::readInt32(void)
 ** Function name:           getUnicodeIndex
 ** Description:             Get the font file index of a Unicode character
 *************************************************************************************x*/
-bool TFT_eSPI::getUnicodeIndex(uint16_t unicode, uint16_t *index)
+bool GxFont_GFX_TFT_eSPI::getUnicodeIndex(uint16_t unicode, uint16_t *index)
 {
   for (uint16_t i = 0; i < gFont.gCount; i++)
   {
@@ -382,7 +300,7 @@ bool TFT_eSPI::getUnicodeIndex(uint16_t unicode, uint16_t *index)
 ** Description:             Write a character to the TFT cursor position
 *************************************************************************************x*/
 // Expects file to be open
-void TFT_eSPI::drawGlyph(uint16_t code)
+void GxFont_GFX_TFT_eSPI::drawGlyph(uint16_t code)
 {
   if (code < 0x21)
   {
@@ -407,6 +325,9 @@ void TFT_eSPI::drawGlyph(uint16_t code)
 
   if (found)
   {
+#ifdef DISPLAY_LIST
+    int32_t x0 = cursor_x, y0 = cursor_y; // Replay starts from the cursor before wrapping
+#endif
 
     if (textwrapX && (cursor_x + gWidth[gNum] + gdX[gNum] > _width))
     {
@@ -416,6 +337,20 @@ void TFT_eSPI::drawGlyph(uint16_t code)
     if (textwrapY && ((cursor_y + gFont.yAdvance) >= _height)) cursor_y = 0;
     if (cursor_x == 0) cursor_x -= gdX[gNum];
 
+#ifdef DISPLAY_LIST
+    if (recordCommand(DL_SMOOTH, code, x0, y0, fg, bg, 1, cursor_x + gdX[gNum], cursor_y + gFont.maxAscent - gdY[gNum], gWidth[gNum], gHeight[gNum]))
+    {
+      cursor_x += gxAdvance[gNum];
+      return;
+    }
+#endif
+    if (!clipVisible(cursor_x + gdX[gNum], cursor_y + gFont.maxAscent - gdY[gNum], gWidth[gNum], gHeight[gNum]))
+    {
+      cursor_x += gxAdvance[gNum];
+      return;
+    }
+    STATS(renderStats.glyphs++;)
+
     fontFile.seek(gBitmap[gNum], fs::SeekSet); // This is taking >30ms for a significant position shift
 
     uint8_t pbuffer[gWidth[gNum]];
@@ -436,12 +371,8 @@ void TFT_eSPI::drawGlyph(uint16_t code)
         {
           if (pixel != 0xFF)
           {
-            if (dl) {
-              if (dl==1) drawPixel(xs, y + cy, fg);
-              else drawFastHLine( xs, y + cy, dl, fg);
-              dl = 0;
-            }
-            drawPixel(x + cx, y + cy, alphaBlend(pixel, fg, bg));
+            if (dl) { addSpan(0, xs, y + cy, dl, 1, fg); dl = 0; }
+            sinkPixel(x + cx, y + cy, alphaBlend(pixel, fg, bg));
           }
           else
           {
@@ -451,18 +382,30 @@ void TFT_eSPI::drawGlyph(uint16_t code)
         }
         else
         {
-          if (dl) { drawFastHLine( xs, y + cy, dl, fg); dl = 0; }
+          if (dl) { addSpan(0, xs, y + cy, dl, 1, fg); dl = 0; }
         }
       }
-      if (dl) { drawFastHLine( xs, y + cy, dl, fg); dl = 0; }
+      if (dl) { addSpan(0, xs, y + cy, dl, 1, fg); dl = 0; }
     }
+    flushSpans(); // Pass the solid runs of this glyph to the sink in one batch
 
     cursor_x += gxAdvance[gNum];
   }
   else
   {
     // Not a Unicode in font so draw a rectangle and move on cursor
-    drawRect(cursor_x, cursor_y + gFont.maxAscent - gFont.ascent, gFont.spaceWidth, gFont.ascent, fg);
+    int32_t ry = cursor_y + gFont.maxAscent - gFont.ascent;
+#ifdef DISPLAY_LIST
+    if (recordCommand(DL_SMOOTH, code, cursor_x, cursor_y, fg, bg, 1, cursor_x, ry, gFont.spaceWidth, gFont.ascent))
+    {
+      cursor_x += gFont.spaceWidth + 1;
+      return;
+    }
+#endif
+    sinkRect(cursor_x, ry, gFont.spaceWidth, 1, fg);
+    sinkRect(cursor_x, ry + gFont.ascent - 1, gFont.spaceWidth, 1, fg);
+    sinkRect(cursor_x, ry, 1, gFont.ascent, fg);
+    sinkRect(cursor_x + gFont.spaceWidth - 1, ry, 1, gFont.ascent, fg);
     cursor_x += gFont.spaceWidth + 1;
   }
   
@@ -472,7 +415,7 @@ void TFT_eSPI::drawGlyph(uint16_t code)
 ** Function name:           showFont
 ** Description:             Page through all characters in font, td ms between screens
 *************************************************************************************x*/
-void TFT_eSPI::showFont(uint32_t td)
+void GxFont_GFX_TFT_eSPI::showFont(uint32_t td)
 {
   if(!fontLoaded) return;
 //  fontFile = SPIFFS.open( _gFontFilename, "r" );
@@ -487,7 +430,7 @@ void TFT_eSPI::showFont(uint32_t td)
   int16_t cursorY = height();// for the first character
   uint32_t timeDelay = 0;    // No delay before first page
 
-  fillScreen(textbgcolor);
+  fillRect(0, 0, _width, _height, textbgcolor);
   
   for (uint16_t i = 0; i < gFont.gCount; i++)
   {
@@ -501,7 +444,7 @@ void TFT_eSPI::showFont(uint32_t td)
         cursorY = 0;
         delay(timeDelay);
         timeDelay = td;
-        fillScreen(textbgcolor);
+        fillRect(0, 0, _width, _height, textbgcolor);
       }
     }
 
@@ -513,7 +456,7 @@ void TFT_eSPI::showFont(uint32_t td)
   }
 
   delay(timeDelay);
-  fillScreen(textbgcolor);
+  fillRect(0, 0, _width, _height, textbgcolor);
   //fontFile.close();
 
 }
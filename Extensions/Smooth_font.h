@@ -8,9 +8,6 @@
   void     unloadFont( void );
   bool     getUnicodeIndex(uint16_t unicode, uint16_t *index);
 
-  uint16_t decodeUTF8(uint8_t *buf, uint16_t *index, uint16_t remaining);
-  uint16_t decodeUTF8(uint8_t c);
-
   uint16_t alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc);
 
   void     drawGlyph(uint16_t code);
@@ -43,9 +40,6 @@ fontMetrics gFont = { 0, 0, 0, 0, 0, 0, 0 };
 
   String   _gFontFilename;
 
-  uint8_t  decoderState = 0;   // UTF8 decoder state
-  uint16_t decoderBuffer;      // Unicode code-point buffer
-
   bool     fontLoaded = false; // Flags when a anti-aliased font is loaded
 
  private:
@@ -0,0 +1,255 @@
+// Orbitron_Light_24 as run lengths, generated by Tools/GFX_pack from Orbitron_Light_24.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t Orbitron_Light_24PackedRuns[] PROGMEM = {
+  0x10, 0x0F, 0x96, 0x40, 0x02, 0x24, 0x24, 0x22, 0x72, 0x62, 0x72, 0x62,
+  0x82, 0x62, 0x82, 0x62, 0x3F, 0x21, 0xF2, 0x52, 0x62, 0x72, 0x62, 0x82,
+  0x62, 0x82, 0x62, 0x72, 0x62, 0x5F, 0x21, 0xF2, 0x32, 0x71, 0x82, 0x62,
+  0x82, 0x62, 0x81, 0x72, 0x60, 0x82, 0xF1, 0x2F, 0x12, 0x9F, 0x11, 0xF5,
+  0x62, 0x64, 0x62, 0x82, 0x62, 0x82, 0x62, 0x82, 0x62, 0x8F, 0x22, 0xF2,
+  0x82, 0x62, 0x82, 0x62, 0x82, 0x62, 0x82, 0x64, 0x62, 0x64, 0x62, 0x6F,
+  0x51, 0xF1, 0x92, 0xF1, 0x2F, 0x12, 0x80, 0xF7, 0x6C, 0x11, 0x8A, 0x21,
+  0x24, 0x29, 0x31, 0x24, 0x27, 0x42, 0x24, 0x26, 0x43, 0x24, 0x25, 0x35,
+  0x84, 0x37, 0x63, 0x4F, 0x14, 0xF1, 0x42, 0x68, 0x33, 0x86, 0x34, 0x25,
+  0x14, 0x45, 0x25, 0x13, 0x46, 0x25, 0x13, 0x37, 0x25, 0x13, 0x19, 0x8E,
+  0x61, 0x2E, 0x6F, 0x15, 0x2C, 0x25, 0x2C, 0x25, 0x2F, 0x42, 0xF4, 0x3F,
+  0x44, 0xF0, 0x22, 0x3E, 0x24, 0x36, 0x24, 0x26, 0x34, 0x24, 0x28, 0x32,
+  0x24, 0x2A, 0x54, 0x2C, 0x43, 0x2D, 0x51, 0xF2, 0x13, 0x1F, 0x04, 0x10,
+  0x06, 0x19, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x24, 0x13, 0x03, 0x14, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x29, 0x10, 0x52, 0xA2, 0xA2, 0x63,
+  0x12, 0x13, 0x2A, 0x54, 0x84, 0x72, 0x22, 0x53, 0x23, 0x51, 0x41, 0x30,
+  0x42, 0x72, 0x72, 0x3F, 0x34, 0x27, 0x27, 0x27, 0x23, 0x09, 0x30, 0x0F,
+  0x30, 0x04, 0xF8, 0x1A, 0x2A, 0x29, 0x29, 0x29, 0x29, 0x39, 0x29, 0x29,
+  0x29, 0x29, 0x2A, 0x29, 0x29, 0x2A, 0x1F, 0x80, 0x1F, 0x01, 0xF4, 0xC5,
+  0xB6, 0xA7, 0x93, 0x14, 0x73, 0x34, 0x63, 0x44, 0x53, 0x54, 0x43, 0x64,
+  0x33, 0x74, 0x13, 0x97, 0xA6, 0xB5, 0xCF, 0x41, 0xF0, 0x10, 0x53, 0x44,
+  0x35, 0x23, 0x12, 0x13, 0x22, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x1F, 0x01, 0xF4, 0xD4, 0xD2, 0xF0, 0x2F,
+  0x02, 0xF0, 0x2F, 0x02, 0x1F, 0xF2, 0x12, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+  0x02, 0xF0, 0xFF, 0x40, 0x1F, 0x01, 0xF4, 0xD2, 0xF0, 0x2F, 0x02, 0xF0,
+  0x2F, 0x02, 0x3E, 0x3E, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x4D,
+  0xF4, 0x1F, 0x01, 0xB3, 0xD4, 0xC5, 0xB6, 0xA3, 0x22, 0x93, 0x32, 0x83,
+  0x42, 0x73, 0x52, 0x54, 0x62, 0x43, 0x82, 0x33, 0x92, 0x3F, 0xF4, 0xC2,
+  0xF0, 0x2F, 0x02, 0xF0, 0x23, 0x0F, 0xF6, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+  0x02, 0xF0, 0xF1, 0x1F, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x4D, 0x4D,
+  0xF4, 0x1F, 0x01, 0x1D, 0x3E, 0x32, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+  0xF0, 0xF1, 0x1F, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0xF4, 0x1F, 0x01,
+  0x0E, 0x1F, 0x0D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x20, 0x1F, 0x01, 0xF4, 0xD4, 0xD4, 0xD4,
+  0xD4, 0xDF, 0xF8, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xDF, 0x41, 0xF0, 0x10,
+  0x1F, 0x01, 0xF4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xDF, 0x41, 0xF1, 0xF0,
+  0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0xF4, 0x1F, 0x01, 0x04, 0xF5, 0x40,
+  0x04, 0xF5, 0x93, 0x91, 0x73, 0x54, 0x54, 0x44, 0x44, 0x63, 0x73, 0x84,
+  0x83, 0x84, 0x84, 0x82, 0x91, 0x0F, 0x9F, 0xF6, 0xF9, 0x01, 0x92, 0x84,
+  0x84, 0x74, 0x84, 0x83, 0x73, 0x54, 0x44, 0x44, 0x54, 0x62, 0xF3, 0x0E,
+  0x1F, 0x0D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x24, 0xB3, 0xB4, 0x2D, 0x2F,
+  0xFF, 0xD2, 0xD2, 0xA0, 0x1F, 0x01, 0xF4, 0xD4, 0xD4, 0x45, 0x44, 0x37,
+  0x34, 0x22, 0x52, 0x24, 0x22, 0x52, 0x24, 0x22, 0x52, 0x24, 0x22, 0x52,
+  0x24, 0x22, 0x52, 0x24, 0x2F, 0x03, 0xEF, 0x02, 0xF0, 0xF2, 0x1F, 0x10,
+  0x1F, 0x01, 0xF4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xDF, 0xF8, 0xD4,
+  0xD4, 0xD4, 0xD4, 0xD4, 0xD2, 0x0F, 0x11, 0xF4, 0xD4, 0xD4, 0xD4, 0xD4,
+  0xDF, 0xF8, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xDF, 0xF5, 0x10, 0x1F, 0xF5,
+  0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+  0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0xF2, 0x1F, 0x10, 0x0F, 0x11,
+  0xF4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+  0xD4, 0xDF, 0xF5, 0x10, 0x0F, 0xF4, 0xE2, 0xE2, 0xE2, 0xE2, 0xED, 0x3D,
+  0x32, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xEF, 0xF2, 0x0F, 0xF4, 0xE2, 0xE2,
+  0xE2, 0xE2, 0xED, 0x3D, 0x32, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+  0xE0, 0x1F, 0x01, 0xF4, 0xD4, 0xD4, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+  0x98, 0x98, 0xD4, 0xD4, 0xD4, 0xD4, 0xDF, 0x41, 0xF0, 0x10, 0x02, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xEF, 0xFA, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE2, 0x0F, 0xF4, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0,
+  0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0,
+  0x4D, 0x4D, 0xF4, 0x1F, 0x01, 0x02, 0xC2, 0x12, 0xB2, 0x22, 0xA2, 0x32,
+  0x92, 0x42, 0x82, 0x52, 0x73, 0x52, 0x63, 0x6A, 0x7A, 0x72, 0x62, 0x72,
+  0x72, 0x62, 0x82, 0x52, 0x83, 0x42, 0x93, 0x32, 0xA2, 0x32, 0xB2, 0x22,
+  0xC2, 0x10, 0x02, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12,
+  0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12,
+  0xF1, 0xFF, 0x60, 0x03, 0xE7, 0xC9, 0xA7, 0x13, 0x83, 0x14, 0x23, 0x63,
+  0x24, 0x32, 0x53, 0x34, 0x42, 0x42, 0x44, 0x52, 0x22, 0x54, 0x56, 0x54,
+  0x64, 0x64, 0x72, 0x74, 0xF1, 0x4F, 0x14, 0xF1, 0x4F, 0x14, 0xF1, 0x4F,
+  0x12, 0x03, 0xC6, 0xB7, 0xA4, 0x13, 0x94, 0x22, 0x94, 0x32, 0x84, 0x42,
+  0x74, 0x43, 0x64, 0x53, 0x54, 0x63, 0x44, 0x72, 0x44, 0x82, 0x34, 0x92,
+  0x24, 0x93, 0x14, 0xA7, 0xB6, 0xC3, 0x1F, 0x01, 0xF4, 0xD4, 0xD4, 0xD4,
+  0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xDF, 0x41, 0xF0,
+  0x10, 0x0F, 0x11, 0xF4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xDF, 0xF5,
+  0x12, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x00, 0x1F, 0x04,
+  0xF2, 0x32, 0xD2, 0x32, 0xD2, 0x32, 0xD2, 0x32, 0xD2, 0x32, 0xD2, 0x32,
+  0xD2, 0x32, 0xD2, 0x32, 0xD2, 0x32, 0xD2, 0x32, 0xD2, 0x32, 0xD2, 0x32,
+  0xD2, 0x32, 0xD2, 0x3F, 0x51, 0xF4, 0x0F, 0x11, 0xF4, 0xD4, 0xD4, 0xD4,
+  0xD4, 0xD4, 0xD4, 0xDF, 0xF5, 0x12, 0x82, 0x52, 0x83, 0x42, 0x93, 0x32,
+  0xA3, 0x22, 0xB3, 0x12, 0xC2, 0x10, 0x1F, 0x01, 0xF4, 0xD4, 0xF0, 0x2F,
+  0x02, 0xF0, 0x2F, 0x0F, 0x12, 0xF1, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x04,
+  0xD4, 0xDF, 0x41, 0xF0, 0x10, 0x0F, 0xF4, 0x82, 0xF0, 0x2F, 0x02, 0xF0,
+  0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0,
+  0x2F, 0x02, 0xF0, 0x2F, 0x02, 0x70, 0x02, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+  0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xDF, 0x41, 0xF0,
+  0x10, 0x12, 0xF2, 0x33, 0x2F, 0x12, 0x43, 0xE3, 0x52, 0xE2, 0x63, 0xC2,
+  0x82, 0xC2, 0x92, 0xA2, 0xA3, 0x83, 0xB2, 0x82, 0xC3, 0x63, 0xD2, 0x62,
+  0xF0, 0x24, 0x2F, 0x12, 0x33, 0xF2, 0x22, 0x2F, 0x36, 0xF4, 0x4F, 0x62,
+  0xB0, 0x12, 0xA3, 0x92, 0x22, 0x94, 0x92, 0x32, 0x84, 0x83, 0x32, 0x82,
+  0x12, 0x72, 0x52, 0x62, 0x22, 0x72, 0x52, 0x62, 0x22, 0x63, 0x52, 0x62,
+  0x32, 0x52, 0x72, 0x42, 0x42, 0x52, 0x72, 0x42, 0x43, 0x32, 0x82, 0x33,
+  0x52, 0x32, 0x92, 0x22, 0x62, 0x32, 0x92, 0x22, 0x72, 0x12, 0xA6, 0x72,
+  0x12, 0xB4, 0x85, 0xB4, 0x93, 0xD2, 0xA3, 0xD2, 0xA2, 0x70, 0x12, 0xB3,
+  0x23, 0x93, 0x43, 0x73, 0x63, 0x62, 0x82, 0x52, 0xA2, 0x32, 0xC2, 0x13,
+  0xD4, 0xE3, 0xE5, 0xD2, 0x13, 0xB2, 0x32, 0xA2, 0x52, 0x83, 0x62, 0x63,
+  0x73, 0x43, 0x93, 0x32, 0xB3, 0x10, 0x03, 0xC3, 0x12, 0xB3, 0x32, 0xA2,
+  0x52, 0x82, 0x63, 0x63, 0x73, 0x43, 0x93, 0x23, 0xB2, 0x22, 0xC6, 0xD4,
+  0xF0, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x28, 0x0F,
+  0xF4, 0xE3, 0xD3, 0xD3, 0xD3, 0xC3, 0xD3, 0xD3, 0xD3, 0xD3, 0xC3, 0xD3,
+  0xD3, 0xD3, 0xEF, 0xF4, 0x0A, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0xC1, 0xB2, 0xA2, 0xB2, 0xB2, 0xB2,
+  0xB2, 0xA2, 0xB2, 0xB2, 0xB2, 0xB2, 0xA2, 0xB2, 0xB2, 0xB1, 0xC0, 0x08,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x2A, 0x10, 0x0F, 0xF4, 0x12, 0x22, 0x22, 0x10, 0x0D, 0x1E, 0xC2, 0xC2,
+  0xC2, 0xCF, 0xF2, 0xA4, 0xA4, 0xA4, 0xAF, 0x11, 0xD0, 0x02, 0xC2, 0xC2,
+  0xC2, 0xC2, 0xCD, 0x1F, 0x1A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A,
+  0x4A, 0x4A, 0xFE, 0x10, 0x1F, 0xEC, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+  0x2C, 0x2C, 0x2C, 0xE1, 0xD0, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x1F, 0xEA,
+  0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0xF1, 0x1D, 0x1C,
+  0x1F, 0x1A, 0x4A, 0x4A, 0x4A, 0xFF, 0x2C, 0x2C, 0x2C, 0x2C, 0xE1, 0xD0,
+  0x1F, 0x26, 0x26, 0x26, 0xF3, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x60, 0x1C, 0x1F, 0x1A, 0x4A, 0x4A, 0x4A, 0x4A,
+  0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0xF1, 0x1D, 0xC2, 0xC2, 0xC2, 0xC2, 0x3B,
+  0x3A, 0x10, 0x02, 0xC2, 0xC2, 0xC2, 0xC2, 0xCD, 0x1F, 0x1A, 0x4A, 0x4A,
+  0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x20, 0x04, 0x6F,
+  0xD0, 0x72, 0x72, 0xFF, 0x42, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+  0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x7F, 0x41, 0x02,
+  0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x92, 0x12, 0x83, 0x12, 0x73, 0x22, 0x63,
+  0x32, 0x53, 0x42, 0x43, 0x58, 0x68, 0x62, 0x43, 0x52, 0x53, 0x42, 0x63,
+  0x32, 0x73, 0x22, 0x83, 0x12, 0x92, 0x10, 0x02, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x46, 0x15, 0x0F, 0x61, 0xF9, 0x82, 0x84, 0x82, 0x84, 0x82, 0x84, 0x82,
+  0x84, 0x82, 0x84, 0x82, 0x84, 0x82, 0x84, 0x82, 0x84, 0x82, 0x84, 0x82,
+  0x84, 0x82, 0x84, 0x82, 0x82, 0x0D, 0x1F, 0x1A, 0x4A, 0x4A, 0x4A, 0x4A,
+  0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x20, 0x1C, 0x1F, 0x1A, 0x4A,
+  0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0xF1, 0x1C, 0x10, 0x0D,
+  0x1F, 0x1A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0xFE,
+  0x12, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC0, 0x1F, 0xEA, 0x4A, 0x4A, 0x4A,
+  0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0xF1, 0x1D, 0xC2, 0xC2, 0xC2, 0xC2,
+  0xC2, 0xC2, 0x1F, 0x89, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x1C, 0x1F, 0x1A, 0x4C, 0x2C, 0x2C, 0xD2, 0xDC, 0x2C,
+  0x2C, 0x4A, 0xF1, 0x1C, 0x10, 0x02, 0x62, 0x62, 0x62, 0x62, 0x6F, 0x36,
+  0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x81, 0x70, 0x02,
+  0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xAF,
+  0x11, 0xC1, 0x12, 0xD2, 0x23, 0xB2, 0x42, 0xA3, 0x43, 0x92, 0x62, 0x83,
+  0x72, 0x72, 0x82, 0x63, 0x92, 0x52, 0xA2, 0x43, 0xB2, 0x32, 0xC2, 0x22,
+  0xE2, 0x12, 0xE4, 0xF1, 0x38, 0x12, 0x83, 0x92, 0x23, 0x74, 0x73, 0x32,
+  0x74, 0x72, 0x42, 0x66, 0x62, 0x52, 0x52, 0x22, 0x52, 0x62, 0x43, 0x23,
+  0x42, 0x63, 0x32, 0x42, 0x33, 0x72, 0x23, 0x43, 0x22, 0x82, 0x22, 0x62,
+  0x22, 0x92, 0x12, 0x66, 0x95, 0x74, 0xA4, 0x84, 0xB3, 0x83, 0xC2, 0xA2,
+  0x60, 0x12, 0x83, 0x23, 0x63, 0x43, 0x52, 0x63, 0x32, 0x83, 0x13, 0x95,
+  0xB3, 0xB4, 0xB5, 0x92, 0x23, 0x73, 0x32, 0x63, 0x52, 0x43, 0x72, 0x32,
+  0x83, 0x10, 0x02, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xAF, 0x11, 0xDC, 0x2C, 0x2C, 0x2C, 0x23, 0xB3, 0xA1, 0x0F,
+  0xDB, 0x3A, 0x3A, 0x39, 0x3A, 0x3A, 0x3A, 0x39, 0x3A, 0x3A, 0x3B, 0xFD,
+  0x23, 0x14, 0x12, 0x32, 0x32, 0x32, 0x32, 0x22, 0x31, 0x42, 0x42, 0x32,
+  0x32, 0x32, 0x32, 0x34, 0x23, 0x0F, 0xFF, 0x10, 0x03, 0x24, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x42, 0x41, 0x32, 0x22, 0x32, 0x32, 0x32, 0x32, 0x14,
+  0x13, 0x20 };
+
+const GFXglyph Orbitron_Light_24PackedGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   2,  17,   6,    1,  -17 },   // 0x21 '!'
+  {     4,   6,   3,  10,    1,  -17 },   // 0x22 '"'
+  {     8,  18,  17,  21,    1,  -17 },   // 0x23 '#'
+  {    41,  18,  23,  21,    1,  -20 },   // 0x24 '$'
+  {    79,  21,  18,  24,    1,  -18 },   // 0x25 '%'
+  {   121,  21,  17,  23,    1,  -17 },   // 0x26 '&'
+  {   156,   2,   3,   6,    1,  -17 },   // 0x27 '''
+  {   157,   4,  17,   7,    1,  -17 },   // 0x28 '('
+  {   172,   4,  17,   8,    1,  -17 },   // 0x29 ')'
+  {   188,  12,  10,  13,    0,  -17 },   // 0x2A '*'
+  {   204,   9,   9,  12,    1,  -11 },   // 0x2B '+'
+  {   213,   2,   6,   5,    1,   -2 },   // 0x2C ','
+  {   215,   9,   2,  13,    1,   -8 },   // 0x2D '-'
+  {   217,   2,   2,   6,    1,   -2 },   // 0x2E '.'
+  {   218,  12,  18,  15,    1,  -18 },   // 0x2F '/'
+  {   236,  17,  17,  20,    1,  -17 },   // 0x30 '0'
+  {   262,   8,  17,  10,   -1,  -17 },   // 0x31 '1'
+  {   281,  17,  17,  20,    1,  -17 },   // 0x32 '2'
+  {   304,  17,  17,  20,    1,  -17 },   // 0x33 '3'
+  {   327,  17,  17,  20,    1,  -17 },   // 0x34 '4'
+  {   353,  17,  17,  20,    1,  -17 },   // 0x35 '5'
+  {   375,  17,  17,  20,    1,  -17 },   // 0x36 '6'
+  {   396,  15,  17,  17,    0,  -17 },   // 0x37 '7'
+  {   414,  17,  17,  20,    1,  -17 },   // 0x38 '8'
+  {   432,  17,  17,  20,    1,  -17 },   // 0x39 '9'
+  {   453,   2,  14,   6,    1,  -14 },   // 0x3A ':'
+  {   456,   2,  18,   5,    1,  -14 },   // 0x3B ';'
+  {   459,  10,  14,  13,    1,  -14 },   // 0x3C '<'
+  {   473,  12,   7,  15,    1,  -11 },   // 0x3D '='
+  {   477,  10,  14,  12,    1,  -14 },   // 0x3E '>'
+  {   491,  15,  17,  18,    1,  -17 },   // 0x3F '?'
+  {   508,  17,  17,  20,    1,  -17 },   // 0x40 '@'
+  {   540,  17,  17,  20,    1,  -17 },   // 0x41 'A'
+  {   557,  17,  17,  20,    1,  -17 },   // 0x42 'B'
+  {   574,  17,  17,  20,    1,  -17 },   // 0x43 'C'
+  {   598,  17,  17,  20,    1,  -17 },   // 0x44 'D'
+  {   616,  16,  17,  19,    1,  -17 },   // 0x45 'E'
+  {   632,  16,  17,  19,    1,  -17 },   // 0x46 'F'
+  {   649,  17,  17,  20,    1,  -17 },   // 0x47 'G'
+  {   670,  18,  17,  21,    1,  -17 },   // 0x48 'H'
+  {   687,   2,  17,   6,    1,  -17 },   // 0x49 'I'
+  {   689,  17,  17,  20,    1,  -17 },   // 0x4A 'J'
+  {   713,  17,  17,  20,    1,  -17 },   // 0x4B 'K'
+  {   746,  18,  17,  20,    1,  -17 },   // 0x4C 'L'
+  {   771,  20,  17,  23,    1,  -17 },   // 0x4D 'M'
+  {   805,  17,  17,  20,    1,  -17 },   // 0x4E 'N'
+  {   834,  17,  17,  20,    1,  -17 },   // 0x4F 'O'
+  {   853,  17,  17,  20,    1,  -17 },   // 0x50 'P'
+  {   874,  20,  17,  22,    1,  -17 },   // 0x51 'Q'
+  {   906,  17,  17,  20,    1,  -17 },   // 0x52 'R'
+  {   930,  17,  17,  20,    1,  -17 },   // 0x53 'S'
+  {   953,  17,  17,  20,    1,  -17 },   // 0x54 'T'
+  {   978,  17,  17,  20,    1,  -17 },   // 0x55 'U'
+  {   997,  24,  17,  25,    0,  -17 },   // 0x56 'V'
+  {  1033,  28,  17,  29,    0,  -17 },   // 0x57 'W'
+  {  1090,  18,  17,  20,    1,  -17 },   // 0x58 'X'
+  {  1122,  18,  17,  20,    0,  -17 },   // 0x59 'Y'
+  {  1151,  17,  17,  20,    1,  -17 },   // 0x5A 'Z'
+  {  1168,   4,  17,   7,    1,  -17 },   // 0x5B '['
+  {  1182,  12,  18,  15,    1,  -18 },   // 0x5C '\'
+  {  1199,   4,  17,   8,    1,  -17 },   // 0x5D ']'
+  {  1213,   1,   1,   1,    0,    0 },   // 0x5E '^'
+  {  1214,  17,   2,  20,    1,    0 },   // 0x5F '_'
+  {  1216,   4,   3,   6,    0,  -24 },   // 0x60 '`'
+  {  1220,  14,  14,  17,    1,  -14 },   // 0x61 'a'
+  {  1233,  14,  19,  17,    1,  -19 },   // 0x62 'b'
+  {  1252,  14,  14,  17,    1,  -14 },   // 0x63 'c'
+  {  1265,  14,  19,  17,    1,  -19 },   // 0x64 'd'
+  {  1283,  14,  14,  17,    1,  -14 },   // 0x65 'e'
+  {  1296,   8,  19,  11,    1,  -19 },   // 0x66 'f'
+  {  1313,  14,  20,  17,    1,  -14 },   // 0x67 'g'
+  {  1334,  14,  19,  17,    1,  -19 },   // 0x68 'h'
+  {  1354,   2,  19,   6,    1,  -19 },   // 0x69 'i'
+  {  1357,   9,  25,   7,   -4,  -19 },   // 0x6A 'j'
+  {  1379,  14,  19,  16,    1,  -19 },   // 0x6B 'k'
+  {  1411,   6,  19,   8,    1,  -19 },   // 0x6C 'l'
+  {  1430,  22,  14,  25,    1,  -14 },   // 0x6D 'm'
+  {  1457,  14,  14,  17,    1,  -14 },   // 0x6E 'n'
+  {  1472,  14,  14,  17,    1,  -14 },   // 0x6F 'o'
+  {  1487,  14,  20,  17,    1,  -14 },   // 0x70 'p'
+  {  1507,  14,  20,  17,    1,  -14 },   // 0x71 'q'
+  {  1526,  11,  14,  13,    1,  -14 },   // 0x72 'r'
+  {  1539,  14,  14,  17,    1,  -14 },   // 0x73 's'
+  {  1553,   8,  19,  11,    1,  -19 },   // 0x74 't'
+  {  1571,  14,  14,  17,    1,  -14 },   // 0x75 'u'
+  {  1586,  19,  14,  20,    0,  -14 },   // 0x76 'v'
+  {  1613,  26,  14,  27,    0,  -14 },   // 0x77 'w'
+  {  1657,  15,  14,  18,    1,  -14 },   // 0x78 'x'
+  {  1682,  14,  20,  17,    1,  -14 },   // 0x79 'y'
+  {  1703,  14,  14,  17,    1,  -14 },   // 0x7A 'z'
+  {  1716,   5,  17,   8,    1,  -17 },   // 0x7B '{'
+  {  1733,   2,  23,   6,    1,  -20 },   // 0x7C '|'
+  {  1736,   5,  17,   8,    1,  -17 } }; // 0x7D '}'
+
+const GFXfontPacked Orbitron_Light_24Packed PROGMEM = {
+  { (uint8_t  *)Orbitron_Light_24PackedRuns,
+    (GFXglyph *)Orbitron_Light_24PackedGlyphs,
+    0x20, 0x7D, 24 } };
+
+// Approx. 2419 bytes
@@ -0,0 +1,342 @@
+// Orbitron_Light_32 as run lengths, generated by Tools/GFX_pack from Orbitron_Light_32.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t Orbitron_Light_32PackedRuns[] PROGMEM = {
+  0x10, 0x0F, 0xFF, 0x6F, 0x06, 0x03, 0x26, 0x26, 0x26, 0x23, 0x93, 0x83,
+  0xA2, 0x92, 0xA3, 0x83, 0xA3, 0x83, 0xA2, 0x92, 0xA3, 0x83, 0x4F, 0x81,
+  0xF8, 0x63, 0x83, 0xA3, 0x83, 0xA2, 0x92, 0xA3, 0x83, 0xA3, 0x83, 0xA2,
+  0x93, 0xA2, 0x92, 0xA3, 0x83, 0x6F, 0x81, 0xF8, 0x43, 0x83, 0xA2, 0x93,
+  0x93, 0x92, 0xA3, 0x83, 0xA3, 0x83, 0xA2, 0x92, 0x90, 0xA3, 0xF5, 0x3F,
+  0x53, 0xCF, 0x43, 0xF6, 0x13, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73,
+  0xA3, 0x73, 0xA3, 0x73, 0xA3, 0x73, 0xA3, 0x73, 0xA3, 0x73, 0xBF, 0x54,
+  0xF5, 0xB3, 0x73, 0xA3, 0x73, 0xA3, 0x73, 0xA3, 0x73, 0xA3, 0x73, 0xA3,
+  0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x73, 0x1F, 0x63, 0xF4, 0xC3, 0xF5,
+  0x3F, 0x53, 0xF5, 0x3A, 0xFF, 0x07, 0xF1, 0x13, 0x9E, 0x22, 0x27, 0x2C,
+  0x32, 0x27, 0x2B, 0x42, 0x27, 0x2A, 0x43, 0x27, 0x29, 0x44, 0x27, 0x27,
+  0x46, 0x27, 0x26, 0x47, 0x27, 0x25, 0x49, 0x95, 0x4B, 0x75, 0x4F, 0x84,
+  0xF8, 0x4F, 0x84, 0x47, 0xB5, 0x49, 0x94, 0x52, 0x72, 0x74, 0x62, 0x72,
+  0x64, 0x72, 0x72, 0x54, 0x82, 0x72, 0x44, 0x92, 0x72, 0x34, 0xA2, 0x72,
+  0x33, 0xB2, 0x72, 0x32, 0xD9, 0xF5, 0x72, 0x3F, 0x2A, 0xF4, 0x83, 0xF0,
+  0x37, 0x3F, 0x03, 0x73, 0xF0, 0x37, 0x3F, 0xA3, 0xFA, 0x3F, 0xA3, 0xFB,
+  0x4F, 0xA4, 0xF7, 0x31, 0x4F, 0x43, 0x35, 0xF2, 0x35, 0x57, 0x35, 0x37,
+  0x46, 0x35, 0x39, 0x44, 0x35, 0x3A, 0x52, 0x35, 0x3C, 0x41, 0x35, 0x3E,
+  0x65, 0x3F, 0x15, 0x43, 0xF2, 0x53, 0x3F, 0x27, 0x2F, 0x63, 0x32, 0xF4,
+  0x61, 0x0C, 0x23, 0x17, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x34,
+  0x23, 0x03, 0x24, 0x33, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x27, 0x13,
+  0x20, 0x63, 0xC3, 0xC3, 0xC3, 0x41, 0x23, 0x23, 0x23, 0x2D, 0x3B, 0x75,
+  0x97, 0x83, 0x13, 0x74, 0x23, 0x54, 0x34, 0x52, 0x52, 0xF3, 0x53, 0x93,
+  0x93, 0x93, 0x93, 0x93, 0x4F, 0x95, 0x39, 0x39, 0x39, 0x39, 0x34, 0x0F,
+  0x21, 0x12, 0x0F, 0x90, 0x06, 0xFF, 0x11, 0xE2, 0xE2, 0xD2, 0xD3, 0xC3,
+  0xC3, 0xD2, 0xD3, 0xC3, 0xC3, 0xC3, 0xD2, 0xD3, 0xC3, 0xC3, 0xC3, 0xD2,
+  0xD3, 0xC3, 0xD2, 0xE1, 0xFF, 0x10, 0x2F, 0x43, 0xF6, 0x13, 0xF1, 0x7F,
+  0x08, 0xE9, 0xDA, 0xC4, 0x16, 0xB4, 0x26, 0xA4, 0x36, 0x94, 0x46, 0x84,
+  0x56, 0x74, 0x66, 0x64, 0x76, 0x54, 0x86, 0x44, 0x96, 0x34, 0xA6, 0x24,
+  0xB6, 0x14, 0xCA, 0xD9, 0xE8, 0xF0, 0x7F, 0x13, 0x1F, 0x63, 0xF4, 0x20,
+  0x64, 0x55, 0x46, 0x37, 0x24, 0x13, 0x23, 0x23, 0x13, 0x33, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x2F, 0x43, 0xF6, 0x13, 0xF2, 0x6F, 0x26, 0xF2, 0x3F,
+  0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0x2F, 0x52,
+  0xF5, 0x23, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5,
+  0x3F, 0x5F, 0xFF, 0x10, 0x2F, 0x34, 0xF5, 0x23, 0xF1, 0x31, 0x3F, 0x13,
+  0x13, 0xF1, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x36,
+  0xF2, 0x6F, 0x2F, 0x63, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F,
+  0x56, 0xF2, 0x6F, 0x23, 0x1F, 0x63, 0xF4, 0x20, 0xF0, 0x4F, 0x25, 0xF1,
+  0x6F, 0x07, 0xE8, 0xD5, 0x13, 0xC5, 0x23, 0xB5, 0x33, 0xA5, 0x43, 0x95,
+  0x53, 0x84, 0x73, 0x74, 0x83, 0x64, 0x93, 0x54, 0xA3, 0x44, 0xB3, 0x34,
+  0xC3, 0x3F, 0xFE, 0xF1, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43,
+  0x30, 0x0F, 0xFF, 0x4F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5,
+  0x3F, 0x53, 0xF5, 0x3F, 0x5F, 0x62, 0xF7, 0xF6, 0x3F, 0x53, 0xF5, 0x3F,
+  0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x6F, 0x26, 0xF2, 0x31, 0xF6, 0x3F, 0x42,
+  0x2F, 0x25, 0xF3, 0x43, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F,
+  0x53, 0xF5, 0x3F, 0x53, 0xF5, 0xF6, 0x2F, 0x71, 0x3F, 0x26, 0xF2, 0x6F,
+  0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x23, 0x1F, 0x63,
+  0xF4, 0x20, 0x0F, 0x32, 0xF4, 0xF3, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2,
+  0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2,
+  0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2,
+  0x3F, 0x23, 0x2F, 0x43, 0xF6, 0x13, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x31, 0xF6, 0x2F, 0x61, 0x3F,
+  0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F,
+  0x23, 0x1F, 0x63, 0xF4, 0x20, 0x2F, 0x43, 0xF6, 0x13, 0xF2, 0x6F, 0x26,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x23,
+  0x1F, 0x72, 0xF6, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53,
+  0xF5, 0x3F, 0x53, 0x1F, 0x63, 0xF4, 0x20, 0x06, 0xFF, 0xF0, 0x60, 0x06,
+  0xFF, 0xCF, 0x21, 0x12, 0xC1, 0xB2, 0x94, 0x76, 0x56, 0x65, 0x65, 0x66,
+  0x74, 0x93, 0xA5, 0x95, 0xA5, 0x96, 0x96, 0x95, 0xA3, 0xB2, 0xD0, 0x0F,
+  0xF4, 0xFF, 0xFF, 0xFA, 0xFF, 0x40, 0x01, 0xC2, 0xB4, 0x96, 0x95, 0xA5,
+  0x96, 0x96, 0x94, 0xA3, 0x85, 0x75, 0x65, 0x66, 0x65, 0x65, 0x84, 0x92,
+  0xF9, 0x0F, 0x42, 0xF5, 0xF4, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F,
+  0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0x6E, 0x6E, 0x63, 0xF3, 0x3F,
+  0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0xF3, 0x3E, 0x2F, 0x43, 0xF6, 0x13,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x65, 0x75, 0x64, 0x94, 0x63,
+  0x27, 0x23, 0x63, 0x27, 0x23, 0x63, 0x27, 0x23, 0x63, 0x27, 0x23, 0x63,
+  0x27, 0x23, 0x63, 0x27, 0x23, 0x63, 0x27, 0x23, 0x64, 0xF4, 0x5F, 0x3F,
+  0x53, 0xF5, 0x3F, 0x53, 0xF6, 0xF7, 0x2F, 0x60, 0x2F, 0x43, 0xF6, 0x13,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26,
+  0xF2, 0x6F, 0x26, 0xF2, 0xFF, 0xF7, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x30, 0x0F, 0x53, 0xF6, 0x23,
+  0xF1, 0x31, 0x3F, 0x13, 0x13, 0xF1, 0x31, 0x3F, 0x13, 0x13, 0xF1, 0x31,
+  0x3F, 0x13, 0x13, 0xF1, 0x31, 0x3F, 0x13, 0x13, 0xF1, 0x31, 0xF7, 0x1F,
+  0x71, 0x3F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26,
+  0xF2, 0x6F, 0x2F, 0xA1, 0xF6, 0x20, 0x2F, 0x61, 0xFA, 0xF5, 0x3F, 0x53,
+  0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53,
+  0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53,
+  0xF5, 0x3F, 0x6F, 0x72, 0xF6, 0x0F, 0x62, 0xF7, 0x13, 0xF2, 0x6F, 0x26,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26,
+  0xF2, 0x6F, 0x2F, 0xA1, 0xF6, 0x20, 0x0F, 0xFF, 0x0F, 0x33, 0xF3, 0x3F,
+  0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x3F, 0x33, 0xF3,
+  0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F,
+  0x33, 0xF3, 0xFF, 0xC0, 0x0F, 0xFF, 0x0F, 0x33, 0xF3, 0x3F, 0x33, 0xF3,
+  0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x3F, 0x33, 0xF3, 0x33, 0xF3,
+  0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3,
+  0x3F, 0x33, 0xF3, 0x2F, 0x43, 0xF6, 0x13, 0xF2, 0x6F, 0x26, 0xF2, 0x6F,
+  0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xCB, 0xCB,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x23,
+  0x1F, 0x63, 0xF4, 0x20, 0x03, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3,
+  0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0xFF, 0xF9, 0xF3,
+  0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3,
+  0x6F, 0x36, 0xF3, 0x30, 0x0F, 0xFF, 0xFC, 0xF5, 0x3F, 0x53, 0xF5, 0x3F,
+  0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F,
+  0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x6F,
+  0x26, 0xF2, 0x6F, 0x23, 0x1F, 0x63, 0xF4, 0x20, 0x03, 0xF1, 0x31, 0x3F,
+  0x03, 0x23, 0xE3, 0x33, 0xD4, 0x33, 0xC4, 0x43, 0xC3, 0x53, 0xB3, 0x63,
+  0xA3, 0x73, 0x94, 0x73, 0x93, 0x83, 0x83, 0x9D, 0xAD, 0xA3, 0x83, 0x93,
+  0x93, 0x83, 0x93, 0x83, 0xA3, 0x73, 0xB3, 0x63, 0xC3, 0x53, 0xC4, 0x43,
+  0xD4, 0x33, 0xE3, 0x33, 0xF0, 0x32, 0x3F, 0x13, 0x10, 0x03, 0xF5, 0x3F,
+  0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F,
+  0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F,
+  0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x5F, 0xFF, 0x10, 0x04, 0xF3, 0x9F,
+  0x1B, 0xED, 0xCA, 0x13, 0xC3, 0x16, 0x23, 0xA3, 0x26, 0x33, 0x83, 0x36,
+  0x34, 0x64, 0x36, 0x43, 0x63, 0x46, 0x53, 0x43, 0x56, 0x63, 0x23, 0x66,
+  0x68, 0x66, 0x76, 0x76, 0x84, 0x86, 0x92, 0x96, 0x91, 0xA6, 0xF5, 0x6F,
+  0x56, 0xF5, 0x6F, 0x56, 0xF5, 0x6F, 0x56, 0xF5, 0x6F, 0x53, 0x04, 0xF1,
+  0x8F, 0x09, 0xEA, 0xD6, 0x13, 0xD6, 0x23, 0xC6, 0x33, 0xB6, 0x34, 0xA6,
+  0x43, 0xA6, 0x53, 0x96, 0x63, 0x86, 0x64, 0x76, 0x74, 0x66, 0x83, 0x66,
+  0x93, 0x56, 0xA3, 0x46, 0xA4, 0x36, 0xB3, 0x36, 0xC3, 0x26, 0xD3, 0x16,
+  0xDA, 0xE9, 0xF0, 0x8F, 0x14, 0x2F, 0x43, 0xF6, 0x13, 0xF2, 0x6F, 0x26,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26,
+  0xF2, 0x6F, 0x23, 0x1F, 0x63, 0xF4, 0x20, 0x0F, 0x62, 0xF7, 0x13, 0xF2,
+  0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2,
+  0x6F, 0x26, 0xF2, 0xFA, 0x1F, 0x62, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5,
+  0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x50, 0x2F, 0x46, 0xF6, 0x43,
+  0xF2, 0x33, 0x3F, 0x23, 0x33, 0xF2, 0x33, 0x3F, 0x23, 0x33, 0xF2, 0x33,
+  0x3F, 0x23, 0x33, 0xF2, 0x33, 0x3F, 0x23, 0x33, 0xF2, 0x33, 0x3F, 0x23,
+  0x33, 0xF2, 0x33, 0x3F, 0x23, 0x33, 0xF2, 0x33, 0x3F, 0x23, 0x33, 0xF2,
+  0x33, 0x3F, 0x23, 0x33, 0xF2, 0x33, 0x3F, 0x23, 0x33, 0xF2, 0x33, 0x3F,
+  0x23, 0x4F, 0xA2, 0xF9, 0x0F, 0x62, 0xF7, 0x13, 0xF2, 0x6F, 0x26, 0xF2,
+  0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2,
+  0xFA, 0x1F, 0x62, 0x3A, 0x37, 0x3A, 0x46, 0x3B, 0x45, 0x3C, 0x35, 0x3D,
+  0x34, 0x3D, 0x43, 0x3E, 0x42, 0x3F, 0x04, 0x13, 0xF1, 0x31, 0x2F, 0x43,
+  0xF6, 0x13, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x53, 0xF5, 0x3F, 0x53, 0xF5,
+  0x3F, 0x53, 0xF6, 0xF5, 0x4F, 0x5F, 0x63, 0xF5, 0x3F, 0x53, 0xF5, 0x3F,
+  0x53, 0xF5, 0x6F, 0x26, 0xF2, 0x6F, 0x23, 0x1F, 0x63, 0xF4, 0x20, 0x0F,
+  0xFF, 0x1A, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F,
+  0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F,
+  0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xA0, 0x03,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x23, 0x1F, 0x63, 0xF4,
+  0x20, 0x03, 0xF8, 0x41, 0x3F, 0x73, 0x33, 0xF5, 0x34, 0x3F, 0x53, 0x53,
+  0xF3, 0x36, 0x3F, 0x33, 0x73, 0xF1, 0x38, 0x3F, 0x13, 0x93, 0xE3, 0xA3,
+  0xD4, 0xB3, 0xC3, 0xD3, 0xA3, 0xE3, 0xA3, 0xF0, 0x38, 0x3F, 0x13, 0x83,
+  0xF2, 0x36, 0x3F, 0x33, 0x63, 0xF4, 0x34, 0x3F, 0x53, 0x43, 0xF6, 0x32,
+  0x3F, 0x82, 0x13, 0xF9, 0x6F, 0xA4, 0xFB, 0x4D, 0x03, 0xD4, 0xD3, 0x12,
+  0xD4, 0xC3, 0x23, 0xB5, 0xC3, 0x23, 0xB6, 0xB3, 0x32, 0xB6, 0xA3, 0x43,
+  0x93, 0x22, 0xA3, 0x43, 0x93, 0x23, 0x92, 0x62, 0x93, 0x23, 0x83, 0x63,
+  0x73, 0x42, 0x83, 0x63, 0x73, 0x43, 0x72, 0x83, 0x62, 0x53, 0x63, 0x83,
+  0x53, 0x63, 0x53, 0x83, 0x53, 0x63, 0x52, 0xA3, 0x42, 0x73, 0x43, 0xA3,
+  0x33, 0x83, 0x33, 0xB2, 0x33, 0x83, 0x32, 0xC3, 0x22, 0x93, 0x23, 0xC3,
+  0x13, 0xA3, 0x13, 0xD2, 0x13, 0xA6, 0xE5, 0xC5, 0xE5, 0xC5, 0xF0, 0x4C,
+  0x4F, 0x13, 0xE3, 0xF1, 0x3E, 0x38, 0x13, 0xF0, 0x43, 0x3E, 0x34, 0x4C,
+  0x36, 0x4A, 0x38, 0x39, 0x49, 0x37, 0x4B, 0x36, 0x3D, 0x34, 0x3E, 0x42,
+  0x3F, 0x13, 0x14, 0xF2, 0x6F, 0x44, 0xF5, 0x4F, 0x46, 0xF2, 0x8F, 0x04,
+  0x23, 0xF0, 0x34, 0x3D, 0x36, 0x3B, 0x37, 0x49, 0x39, 0x47, 0x4A, 0x36,
+  0x4C, 0x35, 0x3E, 0x33, 0x3F, 0x04, 0x10, 0x13, 0xF2, 0x32, 0x4F, 0x04,
+  0x33, 0xF0, 0x35, 0x3D, 0x37, 0x3B, 0x38, 0x49, 0x49, 0x39, 0x3B, 0x37,
+  0x3C, 0x45, 0x4D, 0x43, 0x4F, 0x04, 0x14, 0xF2, 0x31, 0x3F, 0x37, 0xF4,
+  0x5F, 0x63, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7,
+  0x3F, 0x73, 0xF7, 0x3B, 0x0F, 0xFF, 0x1F, 0x53, 0xF3, 0x5F, 0x25, 0xF2,
+  0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3,
+  0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF2, 0x5F, 0x25, 0xF3,
+  0x3F, 0x5F, 0xFF, 0x10, 0x0D, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x2A, 0xF1, 0x1F, 0x02, 0xE3, 0xE2, 0xE3, 0xE3, 0xE3, 0xE3, 0xE2, 0xE3,
+  0xE3, 0xE3, 0xE2, 0xF0, 0x2E, 0x3E, 0x3E, 0x3E, 0x2E, 0x3E, 0x3E, 0x2F,
+  0x01, 0xF1, 0x0A, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2D, 0x10,
+  0x0F, 0xFF, 0x10, 0x03, 0x13, 0x22, 0x23, 0x0F, 0x22, 0xF3, 0xF2, 0x3F,
+  0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x1F, 0xFE, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD3, 0x1F, 0x32, 0xF2, 0x03, 0xF1, 0x3F, 0x13, 0xF1, 0x3F,
+  0x13, 0xF1, 0x3F, 0x1F, 0x22, 0xF3, 0x13, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xDF, 0x61, 0xF2,
+  0x20, 0x2F, 0x21, 0xF6, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F,
+  0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F,
+  0x13, 0xF2, 0xF3, 0x2F, 0x20, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1,
+  0x3F, 0x13, 0x2F, 0x21, 0xF6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD3, 0x1F, 0x32, 0xF2, 0x2F,
+  0x03, 0xF2, 0x13, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xDF, 0xFE, 0xF1, 0x3F,
+  0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF2, 0xF3, 0x2F, 0x20, 0x29,
+  0x1D, 0x83, 0x83, 0x83, 0x8F, 0xA8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2F, 0x03,
+  0xF2, 0x13, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xD6, 0xD3, 0x1F, 0x32, 0xF2, 0xF1, 0x3F, 0x13, 0xF1,
+  0x3F, 0x13, 0xF1, 0x3F, 0x13, 0x4E, 0x5D, 0x20, 0x03, 0xF1, 0x3F, 0x13,
+  0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x1F, 0x22, 0xF3, 0x13, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD3, 0x06, 0xCF, 0xFF, 0xC0, 0x93, 0x93, 0xFF, 0xFC, 0x39, 0x39,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0xE1, 0xA2,
+  0x03, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xC3, 0x13,
+  0xB3, 0x23, 0xA4, 0x23, 0x94, 0x33, 0x84, 0x43, 0x74, 0x53, 0x64, 0x63,
+  0x63, 0x7B, 0x8B, 0x83, 0x63, 0x73, 0x64, 0x63, 0x73, 0x63, 0x83, 0x53,
+  0x93, 0x43, 0xA3, 0x33, 0xA4, 0x23, 0xB4, 0x13, 0xC3, 0x10, 0x03, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x56, 0x25, 0x0F,
+  0xC2, 0xFD, 0x13, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3,
+  0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3,
+  0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3, 0xA6, 0xA3,
+  0xA3, 0x0F, 0x22, 0xF3, 0x13, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD3, 0x2F, 0x03,
+  0xF2, 0x13, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xD6, 0xD3, 0x1F, 0x23, 0xF0, 0x20, 0x0F, 0x22, 0xF3,
+  0x13, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xDF, 0x61, 0xF2, 0x23, 0xF1, 0x3F, 0x13, 0xF1, 0x3F,
+  0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x10, 0x2F, 0x21, 0xF6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD3, 0x1F, 0x32, 0xF2, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F,
+  0x13, 0xF1, 0x3F, 0x13, 0x2D, 0x1F, 0x2C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x2F,
+  0x03, 0xF2, 0x13, 0xD6, 0xD6, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x2F, 0x14,
+  0xF1, 0xF2, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x6D, 0x6D, 0x31, 0xF2,
+  0x3F, 0x02, 0x03, 0x83, 0x83, 0x83, 0x83, 0x83, 0x8F, 0xA8, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39,
+  0xA2, 0x90, 0x03, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD3, 0x1F, 0x23, 0xF0, 0x20,
+  0x13, 0xF2, 0x32, 0x4F, 0x03, 0x43, 0xF0, 0x35, 0x3D, 0x36, 0x3D, 0x37,
+  0x3B, 0x38, 0x3B, 0x39, 0x39, 0x3A, 0x39, 0x3B, 0x37, 0x3C, 0x37, 0x3D,
+  0x35, 0x3E, 0x34, 0x3F, 0x13, 0x33, 0xF1, 0x32, 0x3F, 0x33, 0x13, 0xF4,
+  0x5F, 0x55, 0xF6, 0x3B, 0x03, 0xB4, 0xB3, 0x23, 0xA5, 0xA3, 0x23, 0x96,
+  0xA3, 0x23, 0x97, 0x83, 0x43, 0x83, 0x13, 0x83, 0x43, 0x73, 0x23, 0x82,
+  0x63, 0x63, 0x33, 0x63, 0x63, 0x54, 0x33, 0x63, 0x63, 0x53, 0x53, 0x43,
+  0x83, 0x43, 0x53, 0x43, 0x83, 0x33, 0x64, 0x33, 0x93, 0x23, 0x73, 0x23,
+  0xA3, 0x13, 0x84, 0x13, 0xA3, 0x13, 0x93, 0x13, 0xB6, 0x96, 0xC5, 0xB5,
+  0xC5, 0xB4, 0xE3, 0xD3, 0xE3, 0xD3, 0x70, 0x13, 0xC3, 0x33, 0xA3, 0x53,
+  0x83, 0x64, 0x64, 0x74, 0x44, 0x94, 0x24, 0xB3, 0x23, 0xD6, 0xF0, 0x4F,
+  0x14, 0xF0, 0x6D, 0x7D, 0x32, 0x3B, 0x34, 0x39, 0x44, 0x47, 0x46, 0x45,
+  0x48, 0x35, 0x3A, 0x33, 0x3C, 0x31, 0x03, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD3,
+  0x1F, 0x32, 0xF2, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13,
+  0x4E, 0x5D, 0x20, 0x0F, 0xF8, 0xF1, 0x3E, 0x5D, 0x4E, 0x4E, 0x4E, 0x4E,
+  0x4D, 0x5D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x5E, 0x3F, 0x1F, 0xF8, 0x43,
+  0x34, 0x23, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x24, 0x33, 0x43,
+  0x44, 0x53, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x54, 0x43, 0x0F,
+  0xFF, 0xFF, 0xF3, 0x03, 0x34, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x43, 0x42, 0x42, 0x33, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x14, 0x23, 0x30 };
+
+const GFXglyph Orbitron_Light_32PackedGlyphs[] PROGMEM = {
+  {     0,   1,   1,  10,    0,    0 },   // 0x20 ' '
+  {     1,   3,  24,   9,    2,  -24 },   // 0x21 '!'
+  {     5,   8,   4,  13,    2,  -24 },   // 0x22 '"'
+  {    10,  24,  24,  27,    1,  -24 },   // 0x23 '#'
+  {    57,  23,  31,  26,    1,  -27 },   // 0x24 '$'
+  {   112,  28,  25,  32,    2,  -25 },   // 0x25 '%'
+  {   175,  28,  24,  31,    2,  -24 },   // 0x26 '&'
+  {   229,   3,   4,   9,    2,  -24 },   // 0x27 '''
+  {   230,   5,  24,  10,    2,  -24 },   // 0x28 '('
+  {   253,   5,  24,  10,    2,  -24 },   // 0x29 ')'
+  {   277,  15,  14,  17,    0,  -24 },   // 0x2A '*'
+  {   298,  12,  13,  15,    1,  -16 },   // 0x2B '+'
+  {   311,   3,   7,   8,    2,   -3 },   // 0x2C ','
+  {   314,  12,   2,  17,    2,  -10 },   // 0x2D '-'
+  {   316,   3,   2,   8,    2,   -2 },   // 0x2E '.'
+  {   317,  16,  24,  19,    1,  -24 },   // 0x2F '/'
+  {   342,  23,  24,  28,    2,  -24 },   // 0x30 '0'
+  {   384,  10,  24,  14,    0,  -24 },   // 0x31 '1'
+  {   411,  23,  24,  27,    2,  -24 },   // 0x32 '2'
+  {   448,  23,  24,  27,    2,  -24 },   // 0x33 '3'
+  {   488,  22,  24,  25,    1,  -24 },   // 0x34 '4'
+  {   529,  23,  24,  27,    2,  -24 },   // 0x35 '5'
+  {   564,  23,  24,  27,    2,  -24 },   // 0x36 '6'
+  {   602,  20,  24,  23,    0,  -24 },   // 0x37 '7'
+  {   638,  23,  24,  28,    2,  -24 },   // 0x38 '8'
+  {   677,  23,  24,  28,    2,  -24 },   // 0x39 '9'
+  {   715,   3,  19,   8,    2,  -19 },   // 0x3A ':'
+  {   719,   3,  23,   8,    2,  -19 },   // 0x3B ';'
+  {   724,  13,  19,  17,    1,  -19 },   // 0x3C '<'
+  {   743,  17,   9,  22,    2,  -14 },   // 0x3D '='
+  {   750,  13,  19,  17,    2,  -19 },   // 0x3E '>'
+  {   769,  21,  24,  24,    1,  -24 },   // 0x3F '?'
+  {   800,  23,  24,  28,    2,  -24 },   // 0x40 '@'
+  {   848,  23,  24,  28,    2,  -24 },   // 0x41 'A'
+  {   884,  23,  24,  28,    2,  -24 },   // 0x42 'B'
+  {   930,  23,  24,  28,    2,  -24 },   // 0x43 'C'
+  {   965,  23,  24,  28,    2,  -24 },   // 0x44 'D'
+  {  1002,  21,  24,  26,    2,  -24 },   // 0x45 'E'
+  {  1036,  21,  24,  25,    2,  -24 },   // 0x46 'F'
+  {  1071,  23,  24,  28,    2,  -24 },   // 0x47 'G'
+  {  1108,  24,  24,  29,    2,  -24 },   // 0x48 'H'
+  {  1144,   3,  24,   9,    2,  -24 },   // 0x49 'I'
+  {  1147,  23,  24,  27,    1,  -24 },   // 0x4A 'J'
+  {  1184,  23,  24,  27,    2,  -24 },   // 0x4B 'K'
+  {  1233,  23,  24,  27,    2,  -24 },   // 0x4C 'L'
+  {  1269,  26,  24,  31,    2,  -24 },   // 0x4D 'M'
+  {  1318,  23,  24,  28,    2,  -24 },   // 0x4E 'N'
+  {  1361,  23,  24,  28,    2,  -24 },   // 0x4F 'O'
+  {  1399,  23,  24,  27,    2,  -24 },   // 0x50 'P'
+  {  1436,  26,  24,  30,    2,  -24 },   // 0x51 'Q'
+  {  1492,  23,  24,  28,    2,  -24 },   // 0x52 'R'
+  {  1534,  23,  24,  28,    2,  -24 },   // 0x53 'S'
+  {  1571,  23,  24,  26,    1,  -24 },   // 0x54 'T'
+  {  1607,  23,  24,  28,    2,  -24 },   // 0x55 'U'
+  {  1645,  30,  24,  33,    1,  -24 },   // 0x56 'V'
+  {  1700,  36,  24,  39,    1,  -24 },   // 0x57 'W'
+  {  1782,  24,  24,  27,    1,  -24 },   // 0x58 'X'
+  {  1831,  25,  24,  27,    0,  -24 },   // 0x59 'Y'
+  {  1876,  23,  24,  28,    2,  -24 },   // 0x5A 'Z'
+  {  1912,   5,  24,  10,    2,  -24 },   // 0x5B '['
+  {  1933,  16,  24,  19,    1,  -24 },   // 0x5C '\'
+  {  1958,   5,  24,  10,    2,  -24 },   // 0x5D ']'
+  {  1979,   1,   1,   1,    0,    0 },   // 0x5E '^'
+  {  1980,  23,   2,  27,    2,    1 },   // 0x5F '_'
+  {  1983,   4,   4,   8,    1,  -33 },   // 0x60 '`'
+  {  1987,  19,  19,  24,    2,  -19 },   // 0x61 'a'
+  {  2010,  19,  25,  23,    2,  -25 },   // 0x62 'b'
+  {  2041,  19,  19,  24,    2,  -19 },   // 0x63 'c'
+  {  2069,  19,  25,  23,    1,  -25 },   // 0x64 'd'
+  {  2099,  19,  19,  24,    2,  -19 },   // 0x65 'e'
+  {  2123,  11,  25,  14,    2,  -25 },   // 0x66 'f'
+  {  2146,  19,  27,  23,    1,  -19 },   // 0x67 'g'
+  {  2180,  19,  25,  23,    2,  -25 },   // 0x68 'h'
+  {  2210,   3,  25,   8,    2,  -25 },   // 0x69 'i'
+  {  2214,  12,  33,   9,   -6,  -25 },   // 0x6A 'j'
+  {  2244,  19,  25,  22,    2,  -25 },   // 0x6B 'k'
+  {  2290,   7,  25,  11,    2,  -25 },   // 0x6C 'l'
+  {  2315,  29,  19,  33,    2,  -19 },   // 0x6D 'm'
+  {  2353,  19,  19,  24,    2,  -19 },   // 0x6E 'n'
+  {  2374,  19,  19,  24,    2,  -19 },   // 0x6F 'o'
+  {  2397,  19,  27,  23,    2,  -19 },   // 0x70 'p'
+  {  2431,  19,  27,  23,    1,  -19 },   // 0x71 'q'
+  {  2464,  15,  19,  18,    2,  -19 },   // 0x72 'r'
+  {  2483,  19,  19,  24,    2,  -19 },   // 0x73 's'
+  {  2510,  11,  25,  14,    2,  -25 },   // 0x74 't'
+  {  2534,  19,  19,  24,    2,  -19 },   // 0x75 'u'
+  {  2556,  25,  19,  26,    0,  -19 },   // 0x76 'v'
+  {  2596,  33,  19,  35,    1,  -19 },   // 0x77 'w'
+  {  2659,  20,  19,  23,    1,  -19 },   // 0x78 'x'
+  {  2694,  19,  27,  23,    1,  -19 },   // 0x79 'y'
+  {  2727,  19,  19,  24,    2,  -19 },   // 0x7A 'z'
+  {  2747,   7,  24,  10,    0,  -24 },   // 0x7B '{'
+  {  2771,   3,  31,   8,    2,  -27 },   // 0x7C '|'
+  {  2775,   6,  24,  10,    2,  -24 } }; // 0x7D '}'
+
+const GFXfontPacked Orbitron_Light_32Packed PROGMEM = {
+  { (uint8_t  *)Orbitron_Light_32PackedRuns,
+    (GFXglyph *)Orbitron_Light_32PackedGlyphs,
+    0x20, 0x7D, 32 } };
+
+// Approx. 3465 bytes
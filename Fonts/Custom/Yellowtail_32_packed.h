@@ -0,0 +1,380 @@
+// Yellowtail_32 as run lengths, generated by Tools/GFX_pack from Yellowtail_32.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t Yellowtail_32PackedRuns[] PROGMEM = {
+  0x10, 0xF0, 0x2F, 0x03, 0xE3, 0xE3, 0xF0, 0x3E, 0x3E, 0x3F, 0x03, 0xE3,
+  0xE3, 0xF0, 0x3E, 0x3E, 0x4E, 0x3E, 0x3F, 0x03, 0xE3, 0xF0, 0x3F, 0xFF,
+  0xF6, 0x3E, 0x4E, 0x3F, 0x00, 0x32, 0x22, 0x33, 0x22, 0x32, 0x23, 0x23,
+  0x22, 0x32, 0x23, 0x32, 0x22, 0x32, 0x23, 0x31, 0x32, 0x40, 0xA1, 0xF2,
+  0x13, 0x2B, 0x23, 0x2B, 0x22, 0x3A, 0x22, 0x37, 0xD4, 0xE7, 0x22, 0x3A,
+  0x32, 0x2B, 0x22, 0x3A, 0x32, 0x55, 0xE3, 0xAA, 0x32, 0x3A, 0x23, 0x2A,
+  0x33, 0x2A, 0x25, 0x1B, 0x1F, 0x00, 0xB2, 0xB3, 0xB2, 0xB3, 0xB2, 0xB5,
+  0x78, 0x49, 0x46, 0x12, 0x43, 0x13, 0x62, 0x23, 0x73, 0x12, 0x88, 0x78,
+  0x78, 0x62, 0x33, 0x44, 0x24, 0x3A, 0x49, 0x65, 0x93, 0xB2, 0xB3, 0xB2,
+  0xC0, 0x63, 0x81, 0x55, 0x61, 0x53, 0x12, 0x52, 0x43, 0x22, 0x42, 0x43,
+  0x22, 0x42, 0x43, 0x32, 0x33, 0x42, 0x33, 0x23, 0x43, 0x32, 0x23, 0x52,
+  0x32, 0x23, 0x23, 0x12, 0x23, 0x13, 0x2B, 0x13, 0x23, 0x12, 0x13, 0x23,
+  0x23, 0x22, 0x53, 0x23, 0x23, 0x43, 0x23, 0x32, 0x53, 0x22, 0x33, 0x43,
+  0x23, 0x32, 0x43, 0x32, 0x33, 0x33, 0x42, 0x23, 0x42, 0x56, 0x52, 0x63,
+  0x60, 0xC2, 0xC3, 0xC2, 0xC3, 0xC2, 0x98, 0x5A, 0x4A, 0x44, 0x15, 0x52,
+  0x33, 0x78, 0x87, 0x76, 0x83, 0x12, 0x42, 0x23, 0x13, 0x24, 0x23, 0x12,
+  0x15, 0x3B, 0x49, 0x76, 0xA3, 0xC2, 0xC3, 0xC2, 0xC0, 0x42, 0x33, 0x23,
+  0x33, 0x23, 0x33, 0x23, 0x32, 0x40, 0xF1, 0x3E, 0x5D, 0x5C, 0x5D, 0x4E,
+  0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x03, 0xF0, 0x3F, 0x04, 0xF0, 0x3F, 0x04,
+  0xF0, 0x3F, 0x13, 0xF0, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF0, 0x3F, 0x13,
+  0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF2, 0x2F, 0x32,
+  0xF2, 0x2F, 0x00, 0xFF, 0x42, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1,
+  0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF0, 0x3F, 0x02, 0xF1, 0x2F, 0x03, 0xF0,
+  0x3F, 0x02, 0xF0, 0x3F, 0x02, 0xF0, 0x3F, 0x02, 0xF0, 0x3F, 0x02, 0xF0,
+  0x3E, 0x3E, 0x4D, 0x4D, 0x4D, 0x4D, 0x4B, 0x6B, 0x6D, 0x3E, 0x62, 0x42,
+  0x22, 0x45, 0x21, 0x37, 0x27, 0x17, 0x32, 0x15, 0x42, 0x22, 0x42, 0x22,
+  0x20, 0x72, 0xA2, 0x93, 0x92, 0x92, 0x6F, 0x75, 0x2A, 0x29, 0x2B, 0x1F,
+  0x40, 0x84, 0x24, 0x24, 0x14, 0x22, 0x30, 0x17, 0x18, 0x16, 0xC0, 0x1A,
+  0x10, 0xFF, 0xF1, 0x2F, 0x63, 0xF5, 0x4F, 0x53, 0xF5, 0x3F, 0x53, 0xF5,
+  0x3F, 0x53, 0xF5, 0x3F, 0x54, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4,
+  0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x53, 0xF5, 0x3F, 0x54, 0xF4,
+  0x4F, 0x44, 0xF5, 0x3F, 0x53, 0xF6, 0x3F, 0x62, 0xF7, 0x1F, 0x80, 0xC3,
+  0xB6, 0x93, 0x22, 0x83, 0x32, 0x73, 0x33, 0x63, 0x42, 0x63, 0x43, 0x53,
+  0x44, 0x53, 0x25, 0x53, 0x35, 0x43, 0x62, 0x53, 0x53, 0x43, 0x62, 0x53,
+  0x52, 0x53, 0x53, 0x53, 0x43, 0x63, 0x24, 0x78, 0x86, 0xB4, 0xB0, 0xB1,
+  0xA4, 0x84, 0x85, 0x75, 0x94, 0x93, 0xA2, 0xA3, 0x93, 0xA2, 0xA3, 0x93,
+  0xA3, 0x93, 0xA3, 0x93, 0xA2, 0xA3, 0xB1, 0xB0, 0xB4, 0xA7, 0x84, 0x22,
+  0x74, 0x23, 0x63, 0x42, 0x63, 0x43, 0x63, 0x33, 0x63, 0x33, 0xC3, 0xC3,
+  0xC3, 0xC4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x23, 0x6B, 0x5B, 0x57, 0x90,
+  0xA4, 0x97, 0x74, 0x22, 0x54, 0x33, 0x44, 0x33, 0x52, 0x43, 0x53, 0x33,
+  0x71, 0x24, 0xA3, 0xB6, 0x97, 0xC3, 0xD2, 0xC3, 0xB3, 0x42, 0x35, 0x59,
+  0x68, 0x84, 0xA0, 0xD2, 0xC5, 0xA5, 0x96, 0x93, 0x13, 0x83, 0x13, 0x83,
+  0x22, 0x83, 0x23, 0x64, 0x23, 0x64, 0x33, 0x63, 0x37, 0x2D, 0x3C, 0x57,
+  0xD3, 0xC3, 0xD3, 0xC3, 0xD3, 0xC3, 0xD2, 0xC0, 0xFB, 0x88, 0x98, 0x79,
+  0x2E, 0x3E, 0x2E, 0x3E, 0x6A, 0x89, 0x8F, 0x02, 0xF0, 0x2F, 0x01, 0xF0,
+  0x27, 0x16, 0x27, 0x24, 0x47, 0x89, 0x7B, 0x4C, 0xFF, 0x04, 0xB6, 0x96,
+  0xA5, 0xB4, 0xC4, 0xC4, 0xC4, 0xD3, 0x13, 0x99, 0x75, 0x32, 0x73, 0x52,
+  0x63, 0x52, 0x72, 0x62, 0x72, 0x52, 0x72, 0x53, 0x72, 0x43, 0x82, 0x24,
+  0x97, 0xB4, 0xC0, 0x69, 0x5A, 0x4B, 0xB3, 0xB3, 0xC3, 0xB3, 0xB3, 0xB3,
+  0xB3, 0xC3, 0xB3, 0xB3, 0xC3, 0xB3, 0xB3, 0xC3, 0xB3, 0xC2, 0xD2, 0xC0,
+  0xA4, 0xF0, 0x62, 0x38, 0x71, 0x38, 0x33, 0x58, 0x34, 0x49, 0x24, 0x3B,
+  0x23, 0x3C, 0x21, 0x4D, 0x6E, 0x4F, 0x06, 0xD3, 0x14, 0xB3, 0x33, 0xA2,
+  0x62, 0x93, 0x62, 0x92, 0x62, 0xA2, 0x44, 0xA9, 0xB8, 0xD5, 0xD0, 0xC4,
+  0xB7, 0x93, 0x32, 0x83, 0x42, 0x72, 0x62, 0x62, 0x62, 0x62, 0x63, 0x62,
+  0x62, 0x62, 0x54, 0x62, 0x35, 0x79, 0x89, 0x93, 0x13, 0xD3, 0xD3, 0xD3,
+  0xD3, 0xC4, 0xB5, 0xB5, 0xD2, 0xE0, 0x53, 0x44, 0x43, 0xFF, 0xF5, 0x34,
+  0x44, 0x35, 0x83, 0x74, 0x73, 0xFF, 0xFE, 0x28, 0x47, 0x47, 0x37, 0x3F,
+  0x30, 0xF1, 0x26, 0x34, 0x44, 0x43, 0x44, 0x36, 0x28, 0x18, 0x27, 0x27,
+  0x27, 0x28, 0x18, 0x16, 0x4A, 0x4B, 0x43, 0xFC, 0x85, 0xB4, 0x86, 0xF0,
+  0x17, 0x27, 0x27, 0x37, 0x27, 0x27, 0x36, 0x34, 0x53, 0x43, 0x44, 0x45,
+  0x27, 0x18, 0x87, 0x9A, 0x6D, 0x46, 0x54, 0x34, 0x83, 0x24, 0x93, 0x23,
+  0xA3, 0x24, 0x83, 0xE4, 0xC5, 0xC5, 0xB5, 0xC5, 0xB5, 0xC4, 0xE3, 0xE3,
+  0xF1, 0x2F, 0xFF, 0xF8, 0x2F, 0x03, 0xF0, 0x2F, 0x00, 0xF1, 0x5F, 0x19,
+  0xDC, 0xA6, 0x54, 0x85, 0x83, 0x65, 0xA3, 0x55, 0xB3, 0x45, 0x33, 0x12,
+  0x33, 0x35, 0x28, 0x23, 0x44, 0x24, 0x13, 0x33, 0x34, 0x24, 0x23, 0x33,
+  0x33, 0x24, 0x23, 0x33, 0x34, 0x23, 0x24, 0x24, 0x33, 0x23, 0x24, 0x33,
+  0x34, 0x22, 0x34, 0x23, 0x43, 0x32, 0x25, 0x14, 0x43, 0x36, 0x16, 0x53,
+  0x43, 0x43, 0x73, 0xF6, 0x3B, 0x1A, 0x39, 0x2A, 0x45, 0x5B, 0xBF, 0x07,
+  0xD0, 0xF4, 0x4F, 0x46, 0xF2, 0x6F, 0x14, 0x13, 0xF0, 0x41, 0x3F, 0x04,
+  0x23, 0xE4, 0x23, 0xE4, 0x33, 0xE3, 0x34, 0xD3, 0x43, 0xD3, 0x53, 0xC3,
+  0x53, 0xC4, 0x53, 0xB4, 0x53, 0x7F, 0x27, 0xF1, 0xB3, 0x73, 0xA3, 0x73,
+  0xA3, 0x83, 0x94, 0x74, 0x93, 0x83, 0x93, 0x84, 0x93, 0x83, 0xA2, 0x83,
+  0xB0, 0xB8, 0xCD, 0x8F, 0x16, 0x77, 0x44, 0x52, 0x36, 0x33, 0x43, 0x37,
+  0x33, 0x33, 0x46, 0x43, 0x33, 0x36, 0x49, 0x35, 0x59, 0x44, 0x5A, 0x32,
+  0x6B, 0xAD, 0xBB, 0xE8, 0x47, 0x57, 0x3A, 0x36, 0x3B, 0x35, 0x4A, 0x45,
+  0x67, 0x45, 0x75, 0x56, 0xF1, 0x73, 0x1A, 0x92, 0x37, 0xA0, 0xF0, 0x5D,
+  0x9A, 0x53, 0x39, 0x45, 0x38, 0x45, 0x38, 0x36, 0x47, 0x36, 0x47, 0x36,
+  0x47, 0x35, 0x57, 0x36, 0x38, 0x3F, 0x33, 0xF2, 0x3F, 0x32, 0xF4, 0x2C,
+  0x15, 0x3B, 0x25, 0x2B, 0x26, 0x29, 0x46, 0x28, 0x47, 0x26, 0x59, 0x23,
+  0x6A, 0x9E, 0x5D, 0x99, 0xCE, 0x86, 0x75, 0x54, 0x43, 0x54, 0x34, 0x43,
+  0x73, 0x34, 0x34, 0x83, 0x22, 0x53, 0x93, 0x83, 0xA3, 0x74, 0xA3, 0x73,
+  0xB3, 0x63, 0xB3, 0x64, 0xA4, 0x63, 0xB4, 0x53, 0xB4, 0x54, 0xA4, 0x63,
+  0xA4, 0x64, 0x85, 0x73, 0x85, 0x73, 0x76, 0x83, 0x48, 0x9D, 0xBB, 0xD7,
+  0xF1, 0xC7, 0xAA, 0x8C, 0x66, 0x34, 0x65, 0xF0, 0x3F, 0x13, 0xF2, 0x3F,
+  0x2C, 0x9B, 0xAA, 0xA5, 0xE5, 0xE4, 0x92, 0x44, 0xA2, 0x34, 0xA3, 0x33,
+  0xA3, 0x34, 0x93, 0x43, 0x84, 0x53, 0x74, 0x63, 0x46, 0x8A, 0xC5, 0xC0,
+  0x22, 0xF0, 0x41, 0x2E, 0x61, 0xF6, 0x4F, 0x0F, 0x34, 0xF3, 0x4F, 0x43,
+  0xF4, 0x3F, 0x43, 0xF5, 0x3F, 0x43, 0xDD, 0x9E, 0x9D, 0xF0, 0x3F, 0x44,
+  0xF4, 0x3F, 0x43, 0xF4, 0x4F, 0x43, 0xF4, 0x3F, 0x44, 0xF4, 0x3F, 0x40,
+  0xF3, 0x6F, 0x1A, 0xD6, 0x42, 0xB5, 0x72, 0xA4, 0x82, 0x95, 0x73, 0x94,
+  0x41, 0x24, 0x94, 0x47, 0x94, 0x65, 0x94, 0xA3, 0x74, 0x94, 0x83, 0x94,
+  0x83, 0x94, 0x83, 0x94, 0x92, 0x86, 0x92, 0x76, 0x92, 0x76, 0xA2, 0x54,
+  0x12, 0x12, 0x82, 0x35, 0x12, 0x12, 0x98, 0x25, 0xB6, 0x25, 0xD2, 0x45,
+  0xF4, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54,
+  0xF6, 0x3F, 0x70, 0xE2, 0x93, 0xD4, 0x93, 0x61, 0x46, 0x83, 0x6B, 0x84,
+  0x6A, 0x93, 0x84, 0x23, 0x84, 0xD3, 0x93, 0xD3, 0x93, 0xD4, 0x84, 0xD3,
+  0x93, 0xD3, 0x94, 0x8F, 0x59, 0xF4, 0xAF, 0x4D, 0x39, 0x3D, 0x39, 0x4C,
+  0x49, 0x3D, 0x39, 0x3D, 0x39, 0x4C, 0x49, 0x3D, 0x39, 0x4C, 0x49, 0x3D,
+  0x39, 0x3F, 0xFD, 0xE3, 0xE4, 0xE3, 0xE3, 0xE4, 0xD4, 0xE3, 0xE4, 0xD4,
+  0xE3, 0xE4, 0xD4, 0xE4, 0xD4, 0xD4, 0xE4, 0xD4, 0xD4, 0xE4, 0xD4, 0xE4,
+  0xD4, 0xE3, 0xF0, 0xF7, 0x6F, 0x3A, 0xF0, 0xDD, 0x83, 0x3D, 0x65, 0x3C,
+  0x57, 0x3C, 0x58, 0x3A, 0x59, 0x3A, 0x59, 0x3A, 0x4A, 0x3B, 0x3B, 0x3A,
+  0x3B, 0x3A, 0x4A, 0x3B, 0x3B, 0x2C, 0x3A, 0x3C, 0x43, 0x14, 0x3E, 0x74,
+  0x2F, 0x15, 0x46, 0xF6, 0x6F, 0x75, 0xF6, 0x6F, 0x56, 0xF5, 0x6F, 0x63,
+  0x13, 0xF4, 0x41, 0x3F, 0x43, 0x23, 0xF4, 0x32, 0x4F, 0x33, 0x24, 0xF3,
+  0x32, 0x4F, 0x42, 0x24, 0xF5, 0x7F, 0x66, 0xF8, 0x4F, 0x80, 0xE2, 0xA2,
+  0xD5, 0x75, 0x81, 0x25, 0x75, 0x89, 0x56, 0x98, 0x55, 0xB3, 0x13, 0x46,
+  0xF1, 0x33, 0x5F, 0x23, 0x26, 0xF2, 0x31, 0x6F, 0x39, 0xF5, 0x7F, 0x48,
+  0xF5, 0x7F, 0x97, 0xF6, 0x31, 0x5F, 0x44, 0x35, 0xF2, 0x35, 0x5F, 0x04,
+  0x66, 0xC4, 0x95, 0xB3, 0xB6, 0x84, 0xC7, 0x54, 0xF0, 0x55, 0x3F, 0x23,
+  0x60, 0xFA, 0x4F, 0x97, 0xF7, 0x8F, 0x64, 0x23, 0xF5, 0x42, 0x3F, 0x54,
+  0x24, 0xF4, 0x42, 0x4F, 0x44, 0x15, 0xF5, 0x32, 0x3F, 0x64, 0xFA, 0x4F,
+  0xB3, 0xFB, 0x4F, 0xA4, 0xFB, 0x3F, 0xB4, 0xFA, 0x4F, 0xB3, 0xF3, 0xBF,
+  0x3E, 0xF0, 0x34, 0xDA, 0xFC, 0x3A, 0x4C, 0x56, 0xB7, 0x50, 0xF4, 0x47,
+  0x5F, 0x26, 0x65, 0xF2, 0x66, 0x6F, 0x26, 0x56, 0xF2, 0x65, 0x6F, 0x27,
+  0x46, 0xF2, 0x74, 0x31, 0x3F, 0x17, 0x47, 0xF1, 0x41, 0x33, 0x7F, 0x23,
+  0x13, 0x34, 0x13, 0xF1, 0x32, 0x32, 0x41, 0x3F, 0x14, 0x13, 0x24, 0x13,
+  0xF1, 0x42, 0x31, 0x42, 0x3F, 0x13, 0x23, 0x14, 0x23, 0xF1, 0x33, 0x31,
+  0x32, 0x3F, 0x14, 0x23, 0x13, 0x33, 0xF1, 0x33, 0x63, 0x33, 0x1C, 0x33,
+  0x63, 0x33, 0x2B, 0x43, 0x54, 0x32, 0x3A, 0x43, 0x54, 0x32, 0x3B, 0x34,
+  0x45, 0x7B, 0x44, 0x36, 0x6C, 0x35, 0x27, 0x5C, 0x4E, 0x3D, 0x4F, 0xF1,
+  0x3F, 0xF3, 0x2F, 0xF2, 0xFF, 0xD4, 0x74, 0xD5, 0x74, 0xD5, 0x64, 0xD5,
+  0x74, 0xC6, 0x64, 0xC7, 0x63, 0xD3, 0x13, 0x54, 0xC3, 0x23, 0x44, 0xC4,
+  0x13, 0x53, 0xD3, 0x23, 0x44, 0xC3, 0x33, 0x34, 0xC4, 0x33, 0x24, 0xD3,
+  0x43, 0x24, 0xC4, 0x33, 0x24, 0xD3, 0x43, 0x14, 0xD3, 0x57, 0xD4, 0x57,
+  0xD3, 0x66, 0xD4, 0x56, 0xE3, 0x65, 0xE3, 0x75, 0xE3, 0x74, 0xE4, 0x73,
+  0xF0, 0x3F, 0xB0, 0xF0, 0x5F, 0x08, 0xE8, 0x11, 0xB6, 0x26, 0x85, 0x28,
+  0x75, 0x29, 0x64, 0x34, 0x24, 0x54, 0x43, 0x33, 0x54, 0x52, 0x34, 0x44,
+  0x71, 0x33, 0x53, 0xB4, 0x44, 0xA4, 0x44, 0xB4, 0x43, 0xB4, 0x53, 0xA4,
+  0x53, 0xA4, 0x63, 0x94, 0x73, 0x75, 0x83, 0x65, 0x94, 0x36, 0xBB, 0xC9,
+  0xF1, 0x5F, 0x00, 0xB8, 0xCF, 0x07, 0x71, 0x23, 0x54, 0x63, 0x25, 0x52,
+  0x54, 0x36, 0x41, 0x54, 0x37, 0x41, 0x44, 0x47, 0x41, 0x53, 0x37, 0x43,
+  0x33, 0x37, 0x58, 0x46, 0x59, 0x36, 0x59, 0x44, 0x6A, 0xDA, 0xCB, 0x51,
+  0x5D, 0x4F, 0x44, 0xF4, 0x5F, 0x44, 0xF4, 0x5F, 0x44, 0xF4, 0x4F, 0x54,
+  0xFF, 0xE0, 0xF2, 0x6F, 0x1A, 0xD5, 0x53, 0xB4, 0x73, 0x94, 0x93, 0x84,
+  0x94, 0x74, 0xA4, 0x64, 0xB3, 0x64, 0xB4, 0x54, 0xB5, 0x53, 0xC4, 0x53,
+  0xC5, 0x43, 0xC5, 0x53, 0xC4, 0x53, 0xC5, 0x53, 0xB5, 0x53, 0x62, 0x35,
+  0x63, 0x53, 0x25, 0x73, 0x44, 0x15, 0x83, 0x25, 0x15, 0x9E, 0xCC, 0xE9,
+  0xF6, 0x5F, 0x65, 0xF6, 0x6F, 0x57, 0xF5, 0x3A, 0xA9, 0xBE, 0x67, 0x12,
+  0x44, 0x36, 0x33, 0x63, 0x15, 0x53, 0x63, 0x13, 0x63, 0x69, 0x44, 0x55,
+  0x13, 0x53, 0x55, 0x93, 0x55, 0x93, 0x46, 0x94, 0x17, 0xBA, 0xC8, 0xE7,
+  0xF1, 0x31, 0x4E, 0x42, 0x4C, 0x44, 0x4B, 0x36, 0x49, 0x46, 0x49, 0x38,
+  0x47, 0x49, 0x46, 0x3B, 0x6F, 0x34, 0xFC, 0xF1, 0x7F, 0x0B, 0xBE, 0xA7,
+  0x26, 0x86, 0xF3, 0x5F, 0x44, 0xF5, 0x4F, 0x63, 0xF7, 0x3F, 0x75, 0xF6,
+  0x8F, 0x39, 0xF3, 0x9F, 0x56, 0xF7, 0x4F, 0x73, 0xF7, 0x3F, 0x55, 0x71,
+  0xB5, 0x82, 0x77, 0x9E, 0xBC, 0xE8, 0xF0, 0xF3, 0x4F, 0x35, 0x32, 0xA8,
+  0x3F, 0x35, 0xF0, 0x98, 0x23, 0xF4, 0x3F, 0x44, 0xF4, 0x3F, 0x43, 0xF4,
+  0x3F, 0x53, 0xF4, 0x3F, 0x44, 0xF4, 0x3F, 0x43, 0xF4, 0x4F, 0x43, 0xF2,
+  0x11, 0x3F, 0x26, 0xF2, 0x5F, 0x25, 0xF3, 0x4F, 0x43, 0xF5, 0xC2, 0xF8,
+  0x57, 0x4A, 0x57, 0x56, 0x11, 0x67, 0x56, 0x88, 0x47, 0x78, 0x58, 0x67,
+  0x5B, 0x37, 0x5B, 0x37, 0x6A, 0x46, 0x6B, 0x36, 0x6B, 0x36, 0x6B, 0x36,
+  0x31, 0x3B, 0x35, 0x7B, 0x35, 0x74, 0x17, 0x34, 0x41, 0x33, 0x26, 0x34,
+  0x41, 0x33, 0x36, 0x33, 0x41, 0x42, 0x45, 0x33, 0x42, 0x32, 0x46, 0x31,
+  0x52, 0x97, 0x83, 0x79, 0x65, 0x6B, 0x37, 0x4C, 0xC3, 0x65, 0xB4, 0x74,
+  0x96, 0x74, 0x86, 0x74, 0x51, 0x26, 0x75, 0x58, 0x84, 0x68, 0x74, 0x73,
+  0x13, 0x75, 0xA3, 0x75, 0xA4, 0x74, 0xA4, 0x74, 0xA4, 0x74, 0xB4, 0x65,
+  0xA4, 0x65, 0xA4, 0x65, 0xB4, 0x55, 0xB4, 0x54, 0xD4, 0x44, 0xD4, 0x35,
+  0xE4, 0x25, 0xF0, 0x9F, 0x28, 0xF4, 0x4F, 0x60, 0xC3, 0xE4, 0xB5, 0xF0,
+  0x48, 0x75, 0x46, 0x46, 0x85, 0x46, 0x47, 0x31, 0x36, 0x46, 0x47, 0x21,
+  0x45, 0x46, 0x4A, 0x45, 0x46, 0x59, 0x45, 0x47, 0x49, 0x45, 0x56, 0x49,
+  0x54, 0x56, 0x59, 0x44, 0x65, 0x59, 0x44, 0x65, 0x59, 0x53, 0x74, 0x5A,
+  0x43, 0x75, 0x4A, 0x43, 0x84, 0x4B, 0x42, 0x41, 0x34, 0x4B, 0x42, 0x41,
+  0x43, 0x4C, 0x41, 0x42, 0x33, 0x4C, 0x41, 0x42, 0x41, 0x5D, 0x83, 0x9E,
+  0x74, 0x7F, 0x16, 0x56, 0xF3, 0x38, 0x3F, 0x40, 0xF0, 0x2F, 0xB5, 0x84,
+  0xB7, 0x65, 0xB8, 0x54, 0xC4, 0x23, 0x35, 0xD3, 0x32, 0x35, 0xE2, 0x33,
+  0x24, 0xF1, 0x14, 0x8F, 0x77, 0xF7, 0x6F, 0x95, 0xF9, 0x5F, 0x95, 0xF9,
+  0x5F, 0x87, 0xF7, 0x41, 0x35, 0x1F, 0x04, 0x13, 0x43, 0xD5, 0x23, 0x34,
+  0xC5, 0x33, 0x24, 0xC5, 0x43, 0x15, 0xB5, 0x57, 0xD3, 0x76, 0xE2, 0x93,
+  0xF0, 0xFF, 0x73, 0x91, 0xB5, 0x74, 0x95, 0x74, 0x61, 0x17, 0x65, 0x68,
+  0x74, 0x73, 0x13, 0x75, 0xA4, 0x65, 0xA4, 0x65, 0xB4, 0x56, 0xA4, 0x56,
+  0xA4, 0x57, 0xA4, 0x43, 0x13, 0xA4, 0x43, 0x13, 0xA4, 0x43, 0x14, 0xA4,
+  0x33, 0x23, 0xA4, 0x33, 0x24, 0xA4, 0x23, 0x24, 0xA4, 0x23, 0x33, 0xB8,
+  0x34, 0xB7, 0x43, 0xC5, 0x54, 0xD3, 0x54, 0xF7, 0x3F, 0x74, 0xF7, 0x3F,
+  0x74, 0xF6, 0x4F, 0x73, 0x11, 0xF5, 0x5F, 0x64, 0xF7, 0x4F, 0x82, 0xF3,
+  0x82, 0xD3, 0x73, 0xC4, 0x7F, 0x38, 0xF2, 0xA8, 0x25, 0xF5, 0x4F, 0x64,
+  0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55,
+  0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x64, 0x3A, 0x8F, 0x47,
+  0xF4, 0x87, 0xA1, 0x60, 0xD7, 0xE7, 0xD8, 0xD3, 0xF3, 0x2F, 0x33, 0xF3,
+  0x3F, 0x23, 0xF3, 0x3F, 0x23, 0xF3, 0x3F, 0x23, 0xF3, 0x3F, 0x23, 0xF3,
+  0x3F, 0x23, 0xF3, 0x3F, 0x24, 0xF2, 0x3F, 0x24, 0xF2, 0x3F, 0x24, 0xF2,
+  0x3F, 0x24, 0xF2, 0x3F, 0x24, 0xF2, 0x3F, 0x24, 0xF2, 0x3F, 0x38, 0xD7,
+  0xF0, 0x4F, 0x10, 0x62, 0x32, 0x33, 0x23, 0x32, 0x32, 0x33, 0x23, 0x23,
+  0x23, 0x23, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x41, 0x10, 0xD7, 0xD8, 0xE7,
+  0xF4, 0x3F, 0x23, 0xF3, 0x3F, 0x23, 0xF3, 0x3F, 0x23, 0xF3, 0x3F, 0x33,
+  0xF2, 0x3F, 0x33, 0xF2, 0x3F, 0x33, 0xF2, 0x3F, 0x33, 0xF2, 0x3F, 0x33,
+  0xF2, 0x3F, 0x33, 0xF2, 0x4F, 0x23, 0xF2, 0x4F, 0x23, 0xF3, 0x3F, 0x23,
+  0xF3, 0x3F, 0x23, 0xD8, 0xC8, 0xD8, 0xD0, 0x91, 0x93, 0x65, 0x56, 0x44,
+  0x12, 0x34, 0x22, 0x15, 0x27, 0x46, 0x53, 0x11, 0x63, 0x2C, 0x2D, 0x22,
+  0xC0, 0x53, 0x23, 0x33, 0x32, 0x32, 0x42, 0x77, 0x79, 0x64, 0x23, 0x63,
+  0x34, 0x53, 0x34, 0x53, 0x44, 0x52, 0x44, 0x53, 0x35, 0x52, 0x35, 0x41,
+  0x12, 0x17, 0x32, 0x17, 0x12, 0x23, 0x16, 0x26, 0x33, 0x53, 0x40, 0xB3,
+  0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3, 0xB7, 0x69, 0x45,
+  0x23, 0x42, 0x53, 0x33, 0x53, 0x32, 0x53, 0x33, 0x53, 0x32, 0x53, 0x42,
+  0x43, 0x42, 0x44, 0x42, 0x34, 0x52, 0x24, 0x66, 0x93, 0xA0, 0x74, 0x77,
+  0x54, 0x22, 0x43, 0x33, 0x33, 0x42, 0x33, 0xA2, 0xA3, 0xA2, 0xB2, 0x94,
+  0x82, 0x13, 0x45, 0x29, 0x55, 0x60, 0xF4, 0x2F, 0x33, 0xF2, 0x3F, 0x23,
+  0xF3, 0x3F, 0x23, 0xF2, 0x4F, 0x23, 0xF2, 0x3F, 0x24, 0xD3, 0x13, 0xC9,
+  0xB9, 0xB3, 0x34, 0xA3, 0x34, 0xA3, 0x34, 0xA3, 0x35, 0xA2, 0x35, 0xA3,
+  0x26, 0x31, 0x62, 0x27, 0x22, 0x62, 0x14, 0x12, 0x32, 0x66, 0x22, 0x13,
+  0x83, 0x45, 0xF2, 0x39, 0x74, 0x66, 0x53, 0x12, 0x53, 0x82, 0xA6, 0x65,
+  0x74, 0x73, 0x61, 0x13, 0x62, 0x12, 0x63, 0x12, 0x44, 0x29, 0x55, 0x50,
+  0xF3, 0x2F, 0x33, 0xF3, 0x2F, 0x33, 0xF2, 0x3F, 0x32, 0xF3, 0x3F, 0x23,
+  0xF3, 0x2F, 0x33, 0xF3, 0x2F, 0x33, 0xF2, 0x3F, 0x32, 0xF3, 0x3F, 0x32,
+  0x23, 0xBB, 0x98, 0xD4, 0x23, 0xD3, 0x32, 0xC3, 0x42, 0xC3, 0x42, 0xB3,
+  0x42, 0xC2, 0x42, 0xC3, 0x42, 0xC2, 0x42, 0xC3, 0x32, 0xD2, 0x32, 0xD3,
+  0x23, 0xD2, 0x23, 0xE5, 0xF1, 0x4F, 0x23, 0xF2, 0x93, 0x12, 0x88, 0x65,
+  0x13, 0x64, 0x24, 0x53, 0x34, 0x53, 0x34, 0x53, 0x44, 0x52, 0x44, 0x53,
+  0x25, 0x41, 0x12, 0x26, 0x26, 0x16, 0x24, 0x15, 0x27, 0x33, 0x26, 0x96,
+  0xA4, 0xB4, 0xB4, 0xB4, 0xB5, 0xA5, 0xB4, 0xC3, 0xD3, 0xD0, 0xD2, 0xE3,
+  0xD3, 0xE3, 0xD3, 0xE2, 0xE3, 0xD3, 0xE2, 0xE3, 0xE2, 0x33, 0x83, 0x15,
+  0x82, 0x16, 0x72, 0x13, 0x12, 0x76, 0x13, 0x72, 0x12, 0x13, 0x75, 0x23,
+  0x74, 0x23, 0x75, 0x23, 0x74, 0x24, 0x31, 0x24, 0x33, 0x32, 0x23, 0x43,
+  0x23, 0x22, 0x57, 0x32, 0x64, 0x40, 0x92, 0x83, 0x82, 0xFD, 0x28, 0x37,
+  0x47, 0x47, 0x38, 0x37, 0x38, 0x37, 0x38, 0x33, 0x13, 0x33, 0x23, 0x32,
+  0x33, 0x75, 0x46, 0xFF, 0x73, 0xF1, 0x3F, 0x22, 0xFF, 0x62, 0xF1, 0x4F,
+  0x05, 0xF0, 0x4F, 0x22, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0x32, 0xC2,
+  0x33, 0xB3, 0x14, 0xC2, 0x13, 0xD6, 0xE4, 0xF0, 0x4F, 0x04, 0xF0, 0x4F,
+  0x04, 0xF0, 0x4F, 0x05, 0xE5, 0xF0, 0x4F, 0x13, 0xF2, 0xC2, 0xC3, 0xC2,
+  0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0x32, 0x73, 0x32, 0x63,
+  0x33, 0x63, 0x23, 0x63, 0x23, 0x72, 0x24, 0x67, 0x86, 0x86, 0x96, 0x61,
+  0x13, 0x23, 0x42, 0x13, 0x23, 0x32, 0x13, 0x46, 0x32, 0x54, 0x30, 0xB2,
+  0xA5, 0x83, 0x12, 0x73, 0x22, 0x72, 0x22, 0x73, 0x13, 0x63, 0x22, 0x72,
+  0x22, 0x72, 0x23, 0x63, 0x13, 0x72, 0x22, 0x72, 0x22, 0x82, 0x13, 0x85,
+  0x82, 0x12, 0x94, 0xA3, 0xA4, 0xA3, 0xB2, 0x61, 0x52, 0x52, 0x52, 0x34,
+  0x58, 0x75, 0x80, 0x72, 0x32, 0x53, 0x73, 0x15, 0x25, 0x72, 0x16, 0x16,
+  0x66, 0x12, 0x13, 0x12, 0x65, 0x26, 0x13, 0x64, 0x35, 0x22, 0x64, 0x35,
+  0x22, 0x74, 0x34, 0x22, 0x74, 0x34, 0x32, 0x41, 0x23, 0x43, 0x32, 0x42,
+  0x13, 0x43, 0x42, 0x24, 0x13, 0x33, 0x57, 0x22, 0x43, 0x56, 0xF3, 0x43,
+  0x82, 0x33, 0x83, 0x15, 0x73, 0x16, 0x79, 0x76, 0x13, 0x74, 0x23, 0x74,
+  0x32, 0x75, 0x23, 0x74, 0x32, 0x74, 0x33, 0x32, 0x23, 0x42, 0x33, 0x13,
+  0x52, 0x23, 0x22, 0x66, 0xC3, 0x40, 0x73, 0x87, 0x54, 0x14, 0x34, 0x32,
+  0x33, 0x52, 0x23, 0x53, 0x23, 0x43, 0x32, 0x52, 0x32, 0x52, 0x42, 0x43,
+  0x42, 0x24, 0x56, 0x84, 0x80, 0xF0, 0x2F, 0x23, 0xF1, 0x3F, 0x22, 0xF2,
+  0x3F, 0x22, 0x15, 0xB2, 0x16, 0xA6, 0x13, 0xA5, 0x22, 0xA5, 0x32, 0x95,
+  0x32, 0xA4, 0x33, 0x94, 0x33, 0x94, 0x33, 0xA3, 0x33, 0xA9, 0xB2, 0x14,
+  0xC3, 0xF1, 0x3F, 0x22, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0x2F,
+  0x32, 0xF3, 0x93, 0x12, 0x88, 0x74, 0x23, 0x54, 0x33, 0x54, 0x34, 0x44,
+  0x43, 0x53, 0x44, 0x43, 0x44, 0x53, 0x34, 0x53, 0x35, 0x53, 0x16, 0x6A,
+  0x66, 0x12, 0x83, 0x23, 0xD2, 0xD3, 0xD2, 0x11, 0xB6, 0xA5, 0xA5, 0xB4,
+  0xC3, 0xD2, 0xB0, 0x82, 0x23, 0x83, 0x14, 0x79, 0x75, 0x13, 0x65, 0x22,
+  0x65, 0x31, 0x74, 0xB4, 0xC3, 0xC3, 0xD3, 0xC3, 0xD2, 0xD0, 0x84, 0x68,
+  0x48, 0x35, 0x23, 0x33, 0x92, 0xB3, 0xA7, 0x78, 0x94, 0xA3, 0x32, 0x34,
+  0x48, 0x65, 0x70, 0xA2, 0xB3, 0xA3, 0xB4, 0x4C, 0x1C, 0x63, 0xB3, 0xA3,
+  0xB2, 0xB3, 0xA3, 0xB3, 0xA3, 0xB2, 0xC2, 0xB2, 0x51, 0x62, 0x42, 0x62,
+  0x24, 0x66, 0x94, 0x90, 0x61, 0x53, 0x63, 0x42, 0x63, 0x43, 0x63, 0x42,
+  0x63, 0x43, 0x63, 0x33, 0x63, 0x34, 0x63, 0x24, 0x63, 0x25, 0x63, 0x15,
+  0x41, 0x22, 0x13, 0x12, 0x32, 0x25, 0x22, 0x23, 0x24, 0x36, 0x33, 0x53,
+  0x40, 0xF2, 0x24, 0x33, 0x34, 0x32, 0x44, 0x31, 0x44, 0x32, 0x44, 0x33,
+  0x33, 0x34, 0x24, 0x33, 0x33, 0x34, 0x23, 0x34, 0x32, 0x35, 0x22, 0x36,
+  0x21, 0x37, 0x59, 0x2A, 0xF9, 0x39, 0x24, 0x43, 0x24, 0x23, 0x43, 0x33,
+  0x32, 0x52, 0x34, 0x24, 0x33, 0x33, 0x34, 0x32, 0x43, 0x24, 0x32, 0x43,
+  0x34, 0x31, 0x52, 0x35, 0x21, 0x52, 0x35, 0x61, 0x21, 0x36, 0x52, 0x57,
+  0x52, 0x48, 0x43, 0x39, 0x2F, 0x10, 0xD2, 0x72, 0x34, 0x63, 0x24, 0x64,
+  0x14, 0x78, 0xA5, 0xB4, 0xC3, 0xB4, 0xB5, 0xA6, 0x41, 0x44, 0x12, 0x32,
+  0x43, 0x22, 0x23, 0x33, 0x36, 0x42, 0x53, 0x60, 0x52, 0x52, 0x62, 0x43,
+  0x53, 0x42, 0x62, 0x43, 0x53, 0x33, 0x53, 0x34, 0x53, 0x24, 0x53, 0x25,
+  0x31, 0x13, 0x15, 0x35, 0x15, 0x39, 0x12, 0x23, 0x15, 0x12, 0x22, 0x43,
+  0x13, 0x12, 0x95, 0x95, 0x95, 0x95, 0x95, 0xA4, 0xA5, 0xA4, 0xC2, 0xC0,
+  0x3A, 0x3B, 0x94, 0x94, 0x84, 0x94, 0x94, 0x94, 0xA3, 0x62, 0x23, 0x36,
+  0x1D, 0x1A, 0x45, 0x90, 0xE5, 0xE8, 0xC9, 0xC3, 0x51, 0xC3, 0xF3, 0x3F,
+  0x33, 0xF3, 0x3F, 0x32, 0xF3, 0x3F, 0x24, 0xF1, 0x4F, 0x14, 0xC8, 0xD6,
+  0xF2, 0x5F, 0x33, 0xF3, 0x3F, 0x24, 0xF2, 0x3F, 0x23, 0xF3, 0x3F, 0x23,
+  0xF2, 0x3F, 0x33, 0xF2, 0x3F, 0x33, 0xF2, 0x3F, 0x33, 0xF3, 0x8D, 0x7F,
+  0x04, 0xF1, 0xF1, 0x2F, 0x03, 0xF0, 0x2F, 0x03, 0xE3, 0xF0, 0x2F, 0x03,
+  0xF0, 0x2F, 0x03, 0xF0, 0x2F, 0x03, 0xF0, 0x2F, 0x03, 0xE3, 0xF0, 0x3E,
+  0x3F, 0x03, 0xE3, 0xF0, 0x3E, 0x3F, 0x03, 0xE3, 0xF0, 0x2F, 0x03, 0xF0,
+  0x2F, 0x03, 0xF0, 0x2F, 0x03, 0xF0, 0x2F, 0x03, 0xF0, 0x2F, 0x10, 0xF0,
+  0x5E, 0x8D, 0x8F, 0x33, 0xF3, 0x3F, 0x23, 0xF3, 0x3F, 0x23, 0xF2, 0x3F,
+  0x23, 0xF3, 0x3F, 0x23, 0xF3, 0x3F, 0x34, 0xF3, 0x5F, 0x07, 0xD7, 0xD4,
+  0xF1, 0x4F, 0x23, 0xF2, 0x3F, 0x32, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x23,
+  0xF3, 0x3F, 0x33, 0xF3, 0x3C, 0x23, 0x3D, 0x8D, 0x6E };
+
+const GFXglyph Yellowtail_32PackedGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,  18,  24,  12,    2,  -23 },   // 0x21 '!'
+  {    29,  10,   8,  12,    7,  -22 },   // 0x22 '"'
+  {    46,  18,  18,  18,    2,  -19 },   // 0x23 '#'
+  {    78,  14,  24,  14,    2,  -22 },   // 0x24 '$'
+  {   109,  18,  20,  23,    4,  -20 },   // 0x25 '%'
+  {   169,  15,  23,  15,    3,  -23 },   // 0x26 '&'
+  {   201,   6,   8,   7,    7,  -22 },   // 0x27 '''
+  {   210,  19,  32,  13,    3,  -26 },   // 0x28 '('
+  {   255,  18,  32,  12,   -3,  -26 },   // 0x29 ')'
+  {   298,  10,   9,  13,    7,  -22 },   // 0x2A '*'
+  {   313,  12,  12,  14,    3,  -16 },   // 0x2B '+'
+  {   325,   6,   6,   9,    0,   -3 },   // 0x2C ','
+  {   331,   9,   4,  11,    2,   -9 },   // 0x2D '-'
+  {   335,   4,   3,   9,    2,   -2 },   // 0x2E '.'
+  {   337,  24,  30,  14,   -2,  -26 },   // 0x2F '/'
+  {   383,  16,  20,  14,    1,  -20 },   // 0x30 '0'
+  {   419,  13,  20,   9,    0,  -20 },   // 0x31 '1'
+  {   440,  16,  20,  14,    1,  -20 },   // 0x32 '2'
+  {   468,  15,  19,  14,    1,  -19 },   // 0x33 '3'
+  {   495,  16,  21,  15,    2,  -20 },   // 0x34 '4'
+  {   524,  17,  20,  14,    1,  -19 },   // 0x35 '5'
+  {   548,  17,  21,  14,    1,  -20 },   // 0x36 '6'
+  {   579,  15,  20,  12,    2,  -19 },   // 0x37 '7'
+  {   600,  20,  20,  14,    0,  -19 },   // 0x38 '8'
+  {   635,  17,  21,  15,    1,  -20 },   // 0x39 '9'
+  {   666,   8,  12,  12,    3,  -11 },   // 0x3A ':'
+  {   674,  11,  14,  13,    1,  -11 },   // 0x3B ';'
+  {   685,   9,  15,  12,    5,  -17 },   // 0x3C '<'
+  {   700,  15,   7,  15,    2,  -13 },   // 0x3D '='
+  {   707,   9,  15,  13,    2,  -18 },   // 0x3E '>'
+  {   722,  18,  24,  18,    4,  -23 },   // 0x3F '?'
+  {   753,  24,  24,  24,    3,  -23 },   // 0x40 '@'
+  {   817,  24,  24,  20,    1,  -23 },   // 0x41 'A'
+  {   865,  23,  23,  23,    3,  -23 },   // 0x42 'B'
+  {   910,  21,  23,  20,    3,  -23 },   // 0x43 'C'
+  {   951,  24,  23,  26,    4,  -23 },   // 0x44 'D'
+  {   997,  20,  23,  20,    3,  -23 },   // 0x45 'E'
+  {  1032,  23,  23,  20,    5,  -23 },   // 0x46 'F'
+  {  1068,  25,  31,  22,    2,  -23 },   // 0x47 'G'
+  {  1131,  29,  24,  25,    3,  -23 },   // 0x48 'H'
+  {  1179,  18,  23,  10,    0,  -23 },   // 0x49 'I'
+  {  1203,  28,  33,  22,    0,  -23 },   // 0x4A 'J'
+  {  1270,  29,  23,  25,    1,  -23 },   // 0x4B 'K'
+  {  1321,  30,  24,  24,   -2,  -23 },   // 0x4C 'L'
+  {  1366,  35,  27,  26,   -3,  -23 },   // 0x4D 'M'
+  {  1456,  29,  25,  23,    0,  -24 },   // 0x4E 'N'
+  {  1515,  23,  23,  22,    3,  -23 },   // 0x4F 'O'
+  {  1563,  24,  24,  24,    5,  -23 },   // 0x50 'P'
+  {  1610,  25,  28,  24,    2,  -23 },   // 0x51 'Q'
+  {  1664,  23,  24,  25,    5,  -23 },   // 0x52 'R'
+  {  1711,  25,  24,  23,    2,  -23 },   // 0x53 'S'
+  {  1747,  23,  24,  19,    5,  -23 },   // 0x54 'T'
+  {  1786,  27,  23,  25,    3,  -23 },   // 0x55 'U'
+  {  1844,  26,  23,  22,    3,  -23 },   // 0x56 'V'
+  {  1892,  34,  23,  30,    2,  -23 },   // 0x57 'W'
+  {  1964,  30,  23,  21,   -1,  -23 },   // 0x58 'X'
+  {  2017,  26,  33,  23,    3,  -23 },   // 0x59 'Y'
+  {  2088,  26,  24,  20,    0,  -23 },   // 0x5A 'Z'
+  {  2128,  21,  32,  13,    0,  -27 },   // 0x5B '['
+  {  2175,   5,  30,  13,    6,  -26 },   // 0x5C '\'
+  {  2205,  21,  32,  14,   -2,  -27 },   // 0x5D ']'
+  {  2251,  11,  10,  17,    7,  -23 },   // 0x5E '^'
+  {  2265,  15,   3,  13,   -3,    2 },   // 0x5F '_'
+  {  2269,   5,   7,  14,    8,  -21 },   // 0x60 '`'
+  {  2275,  16,  13,  15,    1,  -12 },   // 0x61 'a'
+  {  2303,  14,  24,  14,    1,  -23 },   // 0x62 'b'
+  {  2338,  13,  14,  13,    1,  -13 },   // 0x63 'c'
+  {  2358,  21,  24,  15,    1,  -23 },   // 0x64 'd'
+  {  2404,  12,  14,  12,    1,  -13 },   // 0x65 'e'
+  {  2424,  21,  33,  12,   -5,  -23 },   // 0x66 'f'
+  {  2480,  16,  23,  14,    0,  -13 },   // 0x67 'g'
+  {  2518,  17,  24,  14,   -1,  -23 },   // 0x68 'h'
+  {  2562,  11,  19,   8,    1,  -18 },   // 0x69 'i'
+  {  2583,  20,  28,   8,   -8,  -18 },   // 0x6A 'j'
+  {  2625,  15,  24,  13,   -1,  -23 },   // 0x6B 'k'
+  {  2663,  14,  24,  10,    2,  -23 },   // 0x6C 'l'
+  {  2703,  23,  14,  21,   -1,  -13 },   // 0x6D 'm'
+  {  2748,  17,  14,  14,   -2,  -13 },   // 0x6E 'n'
+  {  2778,  13,  13,  13,    1,  -13 },   // 0x6F 'o'
+  {  2801,  20,  26,  14,   -6,  -16 },   // 0x70 'p'
+  {  2846,  16,  23,  14,    0,  -13 },   // 0x71 'q'
+  {  2883,  16,  13,  12,   -2,  -13 },   // 0x72 'r'
+  {  2902,  13,  14,  13,    1,  -13 },   // 0x73 's'
+  {  2919,  14,  21,   8,    1,  -20 },   // 0x74 't'
+  {  2944,  16,  14,  15,    0,  -13 },   // 0x75 'u'
+  {  2977,  13,  15,  13,    1,  -14 },   // 0x76 'v'
+  {  3004,  19,  15,  18,    0,  -14 },   // 0x77 'w'
+  {  3042,  16,  15,  13,   -1,  -14 },   // 0x78 'x'
+  {  3068,  15,  22,  14,    0,  -12 },   // 0x79 'y'
+  {  3108,  14,  13,  13,    0,  -13 },   // 0x7A 'z'
+  {  3124,  21,  32,  15,    3,  -27 },   // 0x7B '{'
+  {  3170,  18,  31,  13,    1,  -27 },   // 0x7C '|'
+  {  3215,  21,  32,  16,   -3,  -27 } }; // 0x7D '}'
+
+const GFXfontPacked Yellowtail_32Packed PROGMEM = {
+  { (uint8_t  *)Yellowtail_32PackedRuns,
+    (GFXglyph *)Yellowtail_32PackedGlyphs,
+    0x20, 0x7D, 45 } };
+
+// Approx. 3926 bytes
@@ -8,3 +8,9 @@
 
 extern const unsigned char widtbl_f32[96];
 extern const unsigned char* const chrtbl_f32[96];
+
+#ifdef RLE_ROW_INDEX
+#include <Fonts/Font32rle_rows.c>
+
+extern const unsigned char rowtbl_f32[];
+#endif
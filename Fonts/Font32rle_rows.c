@@ -0,0 +1,121 @@
+// Font 4 row index, generated by Tools/RLE_row_index from Font32rle.c
+//
+// One glyph slot per character, then for every slot and every 8 rows the offset
+// of the run holding the first pixel of the row and the run pixels before it
+
+#include <pgmspace.h>
+
+#define rowstep_f32 8
+
+PROGMEM const unsigned char rowtbl_f32[] =
+{
+        0, 1, 2, 3, 4, 5, 6, 7,     // char 32 - 39
+        8, 9, 10, 11, 12, 13, 14, 15,     // char 40 - 47
+        16, 17, 18, 19, 20, 21, 22, 23,     // char 48 - 55
+        24, 25, 26, 27, 28, 29, 30, 31,     // char 56 - 63
+        32, 33, 34, 35, 36, 37, 38, 39,     // char 64 - 71
+        40, 41, 42, 43, 44, 45, 46, 47,     // char 72 - 79
+        48, 49, 50, 51, 52, 53, 54, 55,     // char 80 - 87
+        56, 57, 58, 59, 60, 61, 62, 63,     // char 88 - 95
+        64, 65, 66, 67, 68, 69, 70, 71,     // char 96 - 103
+        72, 73, 74, 75, 76, 77, 78, 79,     // char 104 - 111
+        80, 81, 82, 83, 84, 85, 86, 87,     // char 112 - 119
+        88, 89, 90, 91, 92, 93, 94, 95,     // char 120 - 127
+        0x00, 0x00, 0x28, 0x00, 0x00, 0x50, 0x00, 0x00, 0x78,     // slot 0
+        0x0E, 0x00, 0x03, 0x1A, 0x00, 0x13, 0x20, 0x00, 0x2B,     // slot 1
+        0x1C, 0x00, 0x02, 0x1C, 0x00, 0x42, 0x1D, 0x00, 0x02,     // slot 2
+        0x18, 0x00, 0x06, 0x34, 0x00, 0x08, 0x40, 0x00, 0x68,     // slot 3
+        0x12, 0x00, 0x0B, 0x22, 0x00, 0x0A, 0x2C, 0x00, 0x48,     // slot 4
+        0x20, 0x00, 0x07, 0x4C, 0x00, 0x00, 0x5C, 0x00, 0x63,     // slot 5
+        0x18, 0x00, 0x06, 0x38, 0x00, 0x04, 0x44, 0x00, 0x55,     // slot 6
+        0x0C, 0x00, 0x09, 0x0C, 0x00, 0x39, 0x0C, 0x00, 0x69,     // slot 7
+        0x0E, 0x00, 0x02, 0x1E, 0x00, 0x03, 0x2E, 0x00, 0x01,     // slot 8
+        0x0E, 0x00, 0x04, 0x1E, 0x00, 0x03, 0x2F, 0x00, 0x00,     // slot 9
+        0x12, 0x00, 0x04, 0x1E, 0x00, 0x3F, 0x1F, 0x00, 0x1F,     // slot 10
+        0x00, 0x00, 0x50, 0x10, 0x00, 0x04, 0x10, 0x00, 0x54,     // slot 11
+        0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x0A,     // slot 12
+        0x00, 0x00, 0x40, 0x04, 0x00, 0x19, 0x04, 0x00, 0x59,     // slot 13
+        0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x06, 0x00, 0x25,     // slot 14
+        0x0E, 0x00, 0x02, 0x1E, 0x00, 0x05, 0x28, 0x00, 0x1E,     // slot 15
+        0x14, 0x00, 0x01, 0x34, 0x00, 0x02, 0x3C, 0x00, 0x4B,     // slot 16
+        0x0C, 0x00, 0x05, 0x1C, 0x00, 0x05, 0x22, 0x00, 0x4B,     // slot 17
+        0x14, 0x00, 0x01, 0x24, 0x00, 0x0A, 0x2A, 0x00, 0x47,     // slot 18
+        0x12, 0x00, 0x02, 0x28, 0x00, 0x01, 0x30, 0x00, 0x4A,     // slot 19
+        0x10, 0x00, 0x03, 0x2A, 0x00, 0x03, 0x30, 0x00, 0x49,     // slot 20
+        0x0E, 0x00, 0x04, 0x26, 0x00, 0x01, 0x2E, 0x00, 0x4A,     // slot 21
+        0x12, 0x00, 0x0B, 0x30, 0x00, 0x01, 0x38, 0x00, 0x4A,     // slot 22
+        0x0C, 0x00, 0x04, 0x1C, 0x00, 0x07, 0x22, 0x00, 0x4E,     // slot 23
+        0x14, 0x00, 0x02, 0x30, 0x00, 0x01, 0x38, 0x00, 0x4A,     // slot 24
+        0x14, 0x00, 0x01, 0x30, 0x00, 0x02, 0x38, 0x00, 0x4A,     // slot 25
+        0x04, 0x00, 0x02, 0x06, 0x00, 0x33, 0x0C, 0x00, 0x25,     // slot 26
+        0x04, 0x00, 0x02, 0x06, 0x00, 0x33, 0x14, 0x00, 0x0A,     // slot 27
+        0x02, 0x00, 0x01, 0x12, 0x00, 0x01, 0x12, 0x00, 0x71,     // slot 28
+        0x00, 0x00, 0x48, 0x08, 0x00, 0x0A, 0x08, 0x00, 0x52,     // slot 29
+        0x02, 0x00, 0x0A, 0x12, 0x00, 0x0A, 0x12, 0x00, 0x7A,     // slot 30
+        0x16, 0x00, 0x01, 0x22, 0x00, 0x1F, 0x28, 0x00, 0x46,     // slot 31
+        0x22, 0x00, 0x01, 0x62, 0x00, 0x04, 0x76, 0x00, 0x3B,     // slot 32
+        0x16, 0x00, 0x04, 0x32, 0x00, 0x02, 0x3E, 0x00, 0x50,     // slot 33
+        0x18, 0x00, 0x02, 0x34, 0x00, 0x01, 0x3C, 0x00, 0x59,     // slot 34
+        0x16, 0x00, 0x0F, 0x2E, 0x00, 0x02, 0x36, 0x00, 0x5F,     // slot 35
+        0x18, 0x00, 0x01, 0x38, 0x00, 0x02, 0x40, 0x00, 0x60,     // slot 36
+        0x0E, 0x00, 0x0C, 0x1E, 0x00, 0x0C, 0x24, 0x00, 0x51,     // slot 37
+        0x0E, 0x00, 0x0B, 0x1E, 0x00, 0x0B, 0x24, 0x00, 0x56,     // slot 38
+        0x14, 0x00, 0x10, 0x32, 0x00, 0x02, 0x3E, 0x00, 0x61,     // slot 39
+        0x1C, 0x00, 0x02, 0x38, 0x00, 0x02, 0x44, 0x00, 0x5C,     // slot 40
+        0x0E, 0x00, 0x02, 0x1E, 0x00, 0x02, 0x24, 0x00, 0x20,     // slot 41
+        0x0E, 0x00, 0x02, 0x25, 0x00, 0x00, 0x2C, 0x00, 0x45,     // slot 42
+        0x1C, 0x00, 0x07, 0x3A, 0x00, 0x03, 0x46, 0x00, 0x55,     // slot 43
+        0x0E, 0x00, 0x09, 0x1E, 0x00, 0x09, 0x24, 0x00, 0x41,     // slot 44
+        0x28, 0x00, 0x02, 0x68, 0x00, 0x02, 0x7A, 0x00, 0x6B,     // slot 45
+        0x22, 0x00, 0x02, 0x50, 0x00, 0x02, 0x5C, 0x00, 0x5C,     // slot 46
+        0x18, 0x00, 0x01, 0x38, 0x00, 0x02, 0x40, 0x00, 0x65,     // slot 47
+        0x18, 0x00, 0x01, 0x2A, 0x00, 0x0C, 0x30, 0x00, 0x5C,     // slot 48
+        0x18, 0x00, 0x01, 0x3C, 0x00, 0x02, 0x48, 0x00, 0x4E,     // slot 49
+        0x18, 0x00, 0x01, 0x34, 0x00, 0x01, 0x40, 0x00, 0x56,     // slot 50
+        0x16, 0x00, 0x0B, 0x2C, 0x00, 0x01, 0x34, 0x00, 0x54,     // slot 51
+        0x0C, 0x00, 0x06, 0x1C, 0x00, 0x06, 0x22, 0x00, 0x4C,     // slot 52
+        0x1C, 0x00, 0x02, 0x3C, 0x00, 0x02, 0x44, 0x00, 0x5F,     // slot 53
+        0x1C, 0x00, 0x02, 0x3C, 0x00, 0x05, 0x42, 0x00, 0x51,     // slot 54
+        0x32, 0x00, 0x02, 0x72, 0x00, 0x04, 0x7E, 0x00, 0x78,     // slot 55
+        0x1C, 0x00, 0x05, 0x36, 0x00, 0x02, 0x42, 0x00, 0x4B,     // slot 56
+        0x1C, 0x00, 0x04, 0x2E, 0x00, 0x07, 0x34, 0x00, 0x57,     // slot 57
+        0x0E, 0x00, 0x05, 0x1E, 0x00, 0x0B, 0x24, 0x00, 0x51,     // slot 58
+        0x0E, 0x00, 0x04, 0x1E, 0x00, 0x04, 0x2E, 0x00, 0x01,     // slot 59
+        0x10, 0x00, 0x08, 0x20, 0x00, 0x05, 0x30, 0x00, 0x02,     // slot 60
+        0x0E, 0x00, 0x03, 0x1E, 0x00, 0x03, 0x2E, 0x00, 0x03,     // slot 61
+        0x12, 0x00, 0x18, 0x12, 0x00, 0x78, 0x13, 0x00, 0x58,     // slot 62
+        0x00, 0x00, 0x68, 0x01, 0x00, 0x50, 0x04, 0x00, 0x0D,     // slot 63
+        0x16, 0x00, 0x01, 0x18, 0x00, 0x41, 0x19, 0x00, 0x09,     // slot 64
+        0x04, 0x00, 0x03, 0x1E, 0x00, 0x02, 0x2A, 0x00, 0x46,     // slot 65
+        0x12, 0x00, 0x03, 0x32, 0x00, 0x02, 0x3E, 0x00, 0x50,     // slot 66
+        0x04, 0x00, 0x02, 0x1C, 0x00, 0x01, 0x24, 0x00, 0x45,     // slot 67
+        0x12, 0x00, 0x02, 0x32, 0x00, 0x02, 0x3E, 0x00, 0x4D,     // slot 68
+        0x04, 0x00, 0x03, 0x1C, 0x00, 0x01, 0x24, 0x00, 0x4B,     // slot 69
+        0x0E, 0x00, 0x01, 0x1E, 0x00, 0x04, 0x24, 0x00, 0x2C,     // slot 70
+        0x08, 0x00, 0x02, 0x28, 0x00, 0x02, 0x44, 0x00, 0x03,     // slot 71
+        0x12, 0x00, 0x03, 0x32, 0x00, 0x02, 0x3E, 0x00, 0x4D,     // slot 72
+        0x0A, 0x00, 0x02, 0x1A, 0x00, 0x02, 0x20, 0x00, 0x20,     // slot 73
+        0x0A, 0x00, 0x02, 0x1A, 0x00, 0x02, 0x2B, 0x00, 0x00,     // slot 74
+        0x10, 0x00, 0x01, 0x2C, 0x00, 0x02, 0x38, 0x00, 0x3C,     // slot 75
+        0x0E, 0x00, 0x02, 0x1E, 0x00, 0x02, 0x24, 0x00, 0x20,     // slot 76
+        0x0D, 0x00, 0x03, 0x3D, 0x00, 0x02, 0x4F, 0x00, 0x70,     // slot 77
+        0x08, 0x00, 0x03, 0x28, 0x00, 0x02, 0x34, 0x00, 0x4D,     // slot 78
+        0x04, 0x00, 0x03, 0x24, 0x00, 0x02, 0x2C, 0x00, 0x50,     // slot 79
+        0x08, 0x00, 0x03, 0x28, 0x00, 0x02, 0x3E, 0x00, 0x0B,     // slot 80
+        0x08, 0x00, 0x02, 0x28, 0x00, 0x02, 0x3E, 0x00, 0x02,     // slot 81
+        0x06, 0x00, 0x00, 0x16, 0x00, 0x04, 0x1C, 0x00, 0x2C,     // slot 82
+        0x04, 0x00, 0x02, 0x1A, 0x00, 0x01, 0x22, 0x00, 0x3F,     // slot 83
+        0x0C, 0x00, 0x01, 0x1C, 0x00, 0x03, 0x22, 0x00, 0x24,     // slot 84
+        0x08, 0x00, 0x01, 0x28, 0x00, 0x01, 0x34, 0x00, 0x47,     // slot 85
+        0x08, 0x00, 0x01, 0x28, 0x00, 0x04, 0x2E, 0x00, 0x41,     // slot 86
+        0x0D, 0x00, 0x00, 0x4C, 0x00, 0x03, 0x58, 0x00, 0x5E,     // slot 87
+        0x08, 0x00, 0x01, 0x22, 0x00, 0x03, 0x2E, 0x00, 0x42,     // slot 88
+        0x08, 0x00, 0x01, 0x28, 0x00, 0x04, 0x3C, 0x00, 0x07,     // slot 89
+        0x04, 0x00, 0x01, 0x14, 0x00, 0x07, 0x1A, 0x00, 0x3D,     // slot 90
+        0x10, 0x00, 0x05, 0x20, 0x00, 0x05, 0x30, 0x00, 0x04,     // slot 91
+        0x10, 0x00, 0x06, 0x20, 0x00, 0x06, 0x30, 0x00, 0x06,     // slot 92
+        0x10, 0x00, 0x06, 0x20, 0x00, 0x06, 0x30, 0x00, 0x06,     // slot 93
+        0x16, 0x00, 0x1F, 0x17, 0x00, 0x17, 0x18, 0x00, 0x0F,     // slot 94
+        0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18,     // slot 95
+        0
+};
@@ -8,3 +8,9 @@
 
 extern const unsigned char widtbl_f64[96];
 extern const unsigned char* const chrtbl_f64[96];
+
+#ifdef RLE_ROW_INDEX
+#include <Fonts/Font64rle_rows.c>
+
+extern const unsigned char rowtbl_f64[];
+#endif
@@ -0,0 +1,42 @@
+// Font 6 row index, generated by Tools/RLE_row_index from Font64rle.c
+//
+// One glyph slot per character, then for every slot and every 8 rows the offset
+// of the run holding the first pixel of the row and the run pixels before it
+
+#include <pgmspace.h>
+
+#define rowstep_f64 8
+
+PROGMEM const unsigned char rowtbl_f64[] =
+{
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 32 - 39
+        0, 0, 0, 0, 0, 1, 2, 0,     // char 40 - 47
+        3, 4, 5, 6, 7, 8, 9, 10,     // char 48 - 55
+        11, 12, 13, 0, 0, 0, 0, 0,     // char 56 - 63
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 64 - 71
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 72 - 79
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 80 - 87
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 88 - 95
+        0, 14, 0, 0, 0, 0, 0, 0,     // char 96 - 103
+        0, 0, 0, 0, 0, 15, 0, 0,     // char 104 - 111
+        16, 0, 0, 0, 0, 0, 0, 0,     // char 112 - 119
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 120 - 127
+        0x00, 0x00, 0x60, 0x01, 0x00, 0x40, 0x02, 0x00, 0x20, 0x03, 0x00, 0x00, 0x03, 0x00, 0x60,     // slot 0
+        0x01, 0x00, 0x08, 0x02, 0x00, 0x10, 0x0A, 0x00, 0x14, 0x0B, 0x00, 0x1C, 0x0C, 0x00, 0x24,     // slot 1
+        0x00, 0x00, 0x78, 0x01, 0x00, 0x70, 0x02, 0x00, 0x68, 0x05, 0x00, 0x05, 0x0D, 0x00, 0x41,     // slot 2
+        0x14, 0x00, 0x04, 0x34, 0x00, 0x02, 0x54, 0x00, 0x02, 0x74, 0x00, 0x04, 0x80, 0x00, 0x5B,     // slot 3
+        0x0E, 0x00, 0x09, 0x22, 0x00, 0x09, 0x32, 0x00, 0x09, 0x42, 0x00, 0x09, 0x4A, 0x00, 0x75,     // slot 4
+        0x14, 0x00, 0x03, 0x2E, 0x00, 0x02, 0x3E, 0x00, 0x0A, 0x4E, 0x00, 0x14, 0x56, 0x00, 0x6E,     // slot 5
+        0x14, 0x00, 0x03, 0x2C, 0x00, 0x04, 0x3C, 0x00, 0x02, 0x5C, 0x00, 0x04, 0x64, 0x00, 0x76,     // slot 6
+        0x0C, 0x00, 0x07, 0x2C, 0x00, 0x07, 0x4A, 0x00, 0x02, 0x5A, 0x00, 0x07, 0x62, 0x00, 0x73,     // slot 7
+        0x0C, 0x00, 0x13, 0x20, 0x00, 0x06, 0x36, 0x00, 0x02, 0x50, 0x00, 0x03, 0x5C, 0x00, 0x5B,     // slot 8
+        0x14, 0x00, 0x03, 0x2E, 0x00, 0x07, 0x4C, 0x00, 0x02, 0x6C, 0x00, 0x03, 0x78, 0x00, 0x5A,     // slot 9
+        0x0C, 0x00, 0x03, 0x1C, 0x00, 0x09, 0x2C, 0x00, 0x0D, 0x3C, 0x00, 0x0F, 0x44, 0x00, 0x7C,     // slot 10
+        0x14, 0x00, 0x03, 0x34, 0x00, 0x05, 0x4C, 0x00, 0x02, 0x6C, 0x00, 0x03, 0x78, 0x00, 0x5A,     // slot 11
+        0x14, 0x00, 0x03, 0x34, 0x00, 0x02, 0x52, 0x00, 0x02, 0x6C, 0x00, 0x04, 0x78, 0x00, 0x5C,     // slot 12
+        0x00, 0x00, 0x78, 0x0B, 0x00, 0x14, 0x0C, 0x00, 0x0C, 0x16, 0x00, 0x05, 0x16, 0x00, 0x7D,     // slot 13
+        0x01, 0x00, 0x58, 0x15, 0x00, 0x03, 0x2B, 0x00, 0x03, 0x4B, 0x00, 0x03, 0x5D, 0x00, 0x5E,     // slot 14
+        0x02, 0x00, 0x50, 0x2B, 0x00, 0x03, 0x5B, 0x00, 0x03, 0x8B, 0x00, 0x03, 0xA4, 0x00, 0x2B,     // slot 15
+        0x01, 0x00, 0x68, 0x1C, 0x00, 0x03, 0x3C, 0x00, 0x02, 0x5C, 0x00, 0x04, 0x76, 0x00, 0x16,     // slot 16
+        0
+};
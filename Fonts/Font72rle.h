@@ -8,3 +8,9 @@
 
 extern const unsigned char widtbl_f72[96];
 extern const unsigned char* const chrtbl_f72[96];
+
+#ifdef RLE_ROW_INDEX
+#include <Fonts/Font72rle_rows.c>
+
+extern const unsigned char rowtbl_f72[];
+#endif
@@ -0,0 +1,39 @@
+// Font 8, narrow digits row index, generated by Tools/RLE_row_index from Font72x53rle.c
+//
+// One glyph slot per character, then for every slot and every 8 rows the offset
+// of the run holding the first pixel of the row and the run pixels before it
+
+#include <pgmspace.h>
+
+#define rowstep_f72 8
+
+PROGMEM const unsigned char rowtbl_f72[] =
+{
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 32 - 39
+        0, 0, 0, 0, 0, 1, 2, 0,     // char 40 - 47
+        3, 4, 5, 6, 7, 8, 9, 10,     // char 48 - 55
+        11, 12, 13, 0, 0, 0, 0, 0,     // char 56 - 63
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 64 - 71
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 72 - 79
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 80 - 87
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 88 - 95
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 96 - 103
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 104 - 111
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 112 - 119
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 120 - 127
+        0x01, 0x00, 0x68, 0x03, 0x00, 0x50, 0x05, 0x00, 0x38, 0x07, 0x00, 0x20, 0x09, 0x00, 0x08, 0x0A, 0x00, 0x70, 0x0C, 0x00, 0x58, 0x0E, 0x00, 0x40, 0x10, 0x00, 0x28,     // slot 0
+        0x01, 0x00, 0x68, 0x03, 0x00, 0x50, 0x05, 0x00, 0x38, 0x07, 0x00, 0x20, 0x0E, 0x00, 0x05, 0x16, 0x00, 0x79, 0x18, 0x00, 0x61, 0x1A, 0x00, 0x49, 0x1C, 0x00, 0x31,     // slot 1
+        0x01, 0x00, 0x68, 0x03, 0x00, 0x50, 0x05, 0x00, 0x38, 0x07, 0x00, 0x20, 0x09, 0x00, 0x08, 0x0A, 0x00, 0x70, 0x0C, 0x00, 0x58, 0x0E, 0x00, 0x40, 0x1E, 0x00, 0x0B,     // slot 2
+        0x09, 0x00, 0x0E, 0x21, 0x00, 0x08, 0x41, 0x00, 0x05, 0x61, 0x00, 0x04, 0x81, 0x00, 0x04, 0xA1, 0x00, 0x04, 0xC1, 0x00, 0x06, 0xE1, 0x00, 0x08, 0xF5, 0x00, 0x10,     // slot 3
+        0x09, 0x00, 0x12, 0x19, 0x00, 0x12, 0x31, 0x00, 0x12, 0x4B, 0x00, 0x12, 0x5B, 0x00, 0x12, 0x6B, 0x00, 0x12, 0x7B, 0x00, 0x12, 0x8B, 0x00, 0x12, 0x9B, 0x00, 0x12,     // slot 4
+        0x09, 0x00, 0x0E, 0x21, 0x00, 0x07, 0x41, 0x00, 0x06, 0x51, 0x00, 0x08, 0x61, 0x00, 0x0D, 0x71, 0x00, 0x15, 0x81, 0x00, 0x1E, 0x91, 0x00, 0x26, 0xA1, 0x00, 0x05,     // slot 5
+        0x09, 0x00, 0x10, 0x21, 0x00, 0x09, 0x3F, 0x00, 0x08, 0x4F, 0x00, 0x0C, 0x61, 0x00, 0x09, 0x71, 0x00, 0x04, 0x85, 0x00, 0x04, 0xA5, 0x00, 0x07, 0xB9, 0x00, 0x10,     // slot 6
+        0x08, 0x00, 0x0C, 0x18, 0x00, 0x0C, 0x2A, 0x00, 0x0C, 0x4A, 0x00, 0x0C, 0x6A, 0x00, 0x0C, 0x8A, 0x00, 0x0C, 0x9A, 0x00, 0x04, 0xAA, 0x00, 0x0C, 0xBA, 0x00, 0x0C,     // slot 7
+        0x08, 0x00, 0x08, 0x18, 0x00, 0x22, 0x28, 0x00, 0x24, 0x40, 0x00, 0x0C, 0x5A, 0x00, 0x06, 0x6C, 0x00, 0x04, 0x80, 0x00, 0x05, 0xA0, 0x00, 0x08, 0xB4, 0x00, 0x10,     // slot 8
+        0x09, 0x00, 0x0D, 0x21, 0x00, 0x07, 0x3F, 0x00, 0x27, 0x57, 0x00, 0x0D, 0x77, 0x00, 0x06, 0x97, 0x00, 0x04, 0xB7, 0x00, 0x04, 0xD7, 0x00, 0x07, 0xEB, 0x00, 0x0F,     // slot 9
+        0x08, 0x00, 0x04, 0x18, 0x00, 0x07, 0x28, 0x00, 0x0C, 0x38, 0x00, 0x11, 0x48, 0x00, 0x15, 0x58, 0x00, 0x18, 0x68, 0x00, 0x1A, 0x78, 0x00, 0x1C, 0x88, 0x00, 0x1D,     // slot 10
+        0x09, 0x00, 0x0E, 0x21, 0x00, 0x08, 0x41, 0x00, 0x07, 0x5F, 0x00, 0x0C, 0x71, 0x00, 0x0A, 0x91, 0x00, 0x06, 0xB1, 0x00, 0x05, 0xD1, 0x00, 0x08, 0xE5, 0x00, 0x10,     // slot 11
+        0x09, 0x00, 0x0F, 0x21, 0x00, 0x08, 0x41, 0x00, 0x05, 0x61, 0x00, 0x04, 0x81, 0x00, 0x04, 0xA1, 0x00, 0x05, 0xB7, 0x00, 0x06, 0xD7, 0x00, 0x09, 0xEB, 0x00, 0x12,     // slot 12
+        0x01, 0x00, 0x68, 0x03, 0x00, 0x50, 0x07, 0x00, 0x0B, 0x17, 0x00, 0x0B, 0x18, 0x00, 0x73, 0x1A, 0x00, 0x5B, 0x1C, 0x00, 0x43, 0x1E, 0x00, 0x2B, 0x2E, 0x00, 0x0B,     // slot 13
+        0
+};
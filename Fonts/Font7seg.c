@@ -0,0 +1,30 @@
+// Font 7 as segments, used instead of the RLE glyphs when FONT7_SEGMENTS is defined
+//
+// Rectangles in the 48 pixel high Font 7 cell, so the glyph metrics of Font7srle.c are kept.
+// Each character is drawn as at most seven filled rectangles, at any text size.
+
+#include <pgmspace.h>
+
+// Segment rectangles: x, y, w, h
+PROGMEM const unsigned char segrect_f7s[10][4] =
+{
+        {  8,  1, 15,  5 },     // a, top
+        { 23,  6,  6, 15 },     // b, top right
+        { 23, 26,  6, 15 },     // c, bottom right
+        {  8, 42, 15,  5 },     // d, bottom
+        {  2, 26,  6, 15 },     // e, bottom left
+        {  2,  6,  6, 15 },     // f, top left
+        {  8, 21, 15,  5 },     // g, middle
+        {  3, 13,  5,  5 },     // upper colon dot
+        {  3, 30,  5,  5 },     // lower colon dot
+        {  3, 42,  5,  5 }      // decimal point
+};
+
+// Segments of the characters 32 - 63, bit n set draws rectangle n
+PROGMEM const unsigned short segtbl_f7s[32] =
+{
+        0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,     // char 32 - 39
+        0x000, 0x000, 0x000, 0x000, 0x000, 0x040, 0x200, 0x000,     // char 40 - 47
+        0x03F, 0x006, 0x05B, 0x04F, 0x066, 0x06D, 0x07D, 0x007,     // char 48 - 55
+        0x07F, 0x06F, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000      // char 56 - 63
+};
@@ -8,3 +8,9 @@
 
 extern const unsigned char widtbl_f7s[96];
 extern const unsigned char* const chrtbl_f7s[96];
+
+#ifdef RLE_ROW_INDEX
+#include <Fonts/Font7srle_rows.c>
+
+extern const unsigned char rowtbl_f7s[];
+#endif
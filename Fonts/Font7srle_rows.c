@@ -0,0 +1,39 @@
+// Font 7 row index, generated by Tools/RLE_row_index from Font7srle.c
+//
+// One glyph slot per character, then for every slot and every 8 rows the offset
+// of the run holding the first pixel of the row and the run pixels before it
+
+#include <pgmspace.h>
+
+#define rowstep_f7s 8
+
+PROGMEM const unsigned char rowtbl_f7s[] =
+{
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 32 - 39
+        0, 0, 0, 0, 0, 1, 2, 0,     // char 40 - 47
+        3, 4, 5, 6, 7, 8, 9, 10,     // char 48 - 55
+        11, 12, 13, 0, 0, 0, 0, 0,     // char 56 - 63
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 64 - 71
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 72 - 79
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 80 - 87
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 88 - 95
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 96 - 103
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 104 - 111
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 112 - 119
+        0, 0, 0, 0, 0, 0, 0, 0,     // char 120 - 127
+        0x00, 0x00, 0x60, 0x01, 0x00, 0x40, 0x02, 0x00, 0x20, 0x03, 0x00, 0x00, 0x03, 0x00, 0x60,     // slot 0
+        0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0x00, 0x05, 0x10, 0x00, 0x48, 0x12, 0x00, 0x48,     // slot 1
+        0x00, 0x00, 0x60, 0x01, 0x00, 0x40, 0x02, 0x00, 0x20, 0x03, 0x00, 0x00, 0x03, 0x00, 0x60,     // slot 2
+        0x18, 0x00, 0x03, 0x38, 0x00, 0x03, 0x54, 0x00, 0x23, 0x72, 0x00, 0x03, 0x92, 0x00, 0x03,     // slot 3
+        0x09, 0x00, 0x03, 0x19, 0x00, 0x03, 0x27, 0x00, 0x23, 0x35, 0x00, 0x03, 0x45, 0x00, 0x03,     // slot 4
+        0x12, 0x00, 0x03, 0x22, 0x00, 0x03, 0x36, 0x00, 0x05, 0x4A, 0x00, 0x18, 0x5A, 0x00, 0x18,     // slot 5
+        0x12, 0x00, 0x03, 0x22, 0x00, 0x03, 0x36, 0x00, 0x05, 0x48, 0x00, 0x03, 0x58, 0x00, 0x03,     // slot 6
+        0x0F, 0x00, 0x03, 0x2F, 0x00, 0x03, 0x51, 0x00, 0x05, 0x63, 0x00, 0x03, 0x73, 0x00, 0x03,     // slot 7
+        0x10, 0x00, 0x18, 0x20, 0x00, 0x18, 0x34, 0x00, 0x05, 0x46, 0x00, 0x03, 0x56, 0x00, 0x03,     // slot 8
+        0x10, 0x00, 0x18, 0x20, 0x00, 0x18, 0x34, 0x00, 0x05, 0x56, 0x00, 0x03, 0x76, 0x00, 0x03,     // slot 9
+        0x12, 0x00, 0x03, 0x22, 0x00, 0x03, 0x30, 0x00, 0x23, 0x3E, 0x00, 0x03, 0x4E, 0x00, 0x03,     // slot 10
+        0x18, 0x00, 0x03, 0x38, 0x00, 0x03, 0x5A, 0x00, 0x05, 0x7C, 0x00, 0x03, 0x9C, 0x00, 0x03,     // slot 11
+        0x18, 0x00, 0x03, 0x38, 0x00, 0x03, 0x5A, 0x00, 0x05, 0x6C, 0x00, 0x03, 0x7C, 0x00, 0x03,     // slot 12
+        0x00, 0x00, 0x60, 0x07, 0x00, 0x04, 0x0B, 0x00, 0x4D, 0x10, 0x00, 0x04, 0x16, 0x00, 0x41,     // slot 13
+        0
+};
@@ -0,0 +1,438 @@
+// FreeMono24pt7b as run lengths, generated by Tools/GFX_pack from FreeMono24pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeMono24pt7bPackedRuns[] PROGMEM = {
+  0x13, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x31, 0x41, 0x41, 0x41, 0x41, 0x41, 0xFF, 0x33, 0x1F, 0x01, 0x31,
+  0x07, 0x27, 0x15, 0x45, 0x25, 0x45, 0x25, 0x45, 0x25, 0x45, 0x25, 0x45,
+  0x25, 0x45, 0x25, 0x45, 0x34, 0x45, 0x33, 0x63, 0x43, 0x63, 0x43, 0x63,
+  0x43, 0x63, 0x43, 0x63, 0x20, 0x72, 0x42, 0xB2, 0x42, 0xB2, 0x42, 0xB2,
+  0x42, 0xB2, 0x42, 0xB2, 0x42, 0xB2, 0x42, 0xB2, 0x33, 0xB2, 0x32, 0xB2,
+  0x42, 0xB2, 0x42, 0x6F, 0x31, 0xF3, 0x62, 0x42, 0xB2, 0x42, 0xB2, 0x42,
+  0xB2, 0x42, 0xB2, 0x42, 0xB2, 0x42, 0x5F, 0x31, 0xF3, 0x72, 0x42, 0xB2,
+  0x33, 0xA3, 0x32, 0xB2, 0x42, 0xB2, 0x42, 0xB2, 0x42, 0xB2, 0x42, 0xB2,
+  0x42, 0xB2, 0x42, 0xB2, 0x42, 0xB2, 0x42, 0x60, 0x82, 0xF1, 0x2F, 0x12,
+  0xE6, 0xAA, 0x12, 0x43, 0x65, 0x33, 0x93, 0x23, 0xB2, 0x22, 0xC2, 0x22,
+  0xF1, 0x2F, 0x13, 0xF1, 0x3F, 0x15, 0xF0, 0x8D, 0x7F, 0x05, 0xF1, 0x2F,
+  0x13, 0xF1, 0x3F, 0x04, 0xE4, 0xD6, 0xB3, 0x16, 0x64, 0x22, 0x1C, 0x88,
+  0xD2, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x28, 0x54, 0xE8, 0xB3,
+  0x43, 0xA2, 0x62, 0x92, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x92,
+  0x62, 0xA3, 0x43, 0xB8, 0x72, 0x54, 0x65, 0xB6, 0xB6, 0xB6, 0xB6, 0xC5,
+  0xF0, 0x29, 0x4E, 0x8B, 0x34, 0x3A, 0x26, 0x29, 0x28, 0x28, 0x28, 0x28,
+  0x28, 0x28, 0x28, 0x29, 0x26, 0x39, 0x34, 0x3B, 0x8E, 0x45, 0x65, 0x12,
+  0x99, 0x83, 0x41, 0x93, 0xF0, 0x2F, 0x12, 0xF1, 0x2F, 0x22, 0xF1, 0x2F,
+  0x22, 0xF1, 0x2E, 0x5C, 0x31, 0x35, 0x41, 0x24, 0x25, 0x75, 0x24, 0x22,
+  0x26, 0x32, 0x23, 0x27, 0x22, 0x23, 0x28, 0x21, 0x23, 0x28, 0x44, 0x29,
+  0x35, 0x28, 0x35, 0x36, 0x46, 0x34, 0x31, 0x53, 0x82, 0x55, 0x49, 0x07,
+  0x15, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x34, 0x33, 0x43, 0x43, 0x43,
+  0x43, 0x20, 0x52, 0x43, 0x42, 0x43, 0x42, 0x43, 0x43, 0x42, 0x43, 0x43,
+  0x43, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x52,
+  0x53, 0x43, 0x43, 0x52, 0x53, 0x43, 0x52, 0x53, 0x52, 0x52, 0x62, 0x61,
+  0x02, 0x53, 0x52, 0x53, 0x52, 0x53, 0x43, 0x52, 0x53, 0x43, 0x43, 0x43,
+  0x53, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x42, 0x43, 0x43,
+  0x43, 0x42, 0x52, 0x43, 0x42, 0x43, 0x42, 0x43, 0x42, 0x51, 0x60, 0x82,
+  0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0x91, 0x62, 0x67, 0x32, 0x35, 0x2E,
+  0x78, 0xC4, 0xE5, 0xC2, 0x22, 0xB2, 0x42, 0x93, 0x43, 0x82, 0x62, 0x72,
+  0x82, 0x30, 0x92, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32,
+  0xF3, 0x2F, 0x32, 0xF3, 0x29, 0xFF, 0xA9, 0x2F, 0x32, 0xF3, 0x2F, 0x32,
+  0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0x90, 0x36, 0x35,
+  0x45, 0x35, 0x45, 0x44, 0x45, 0x44, 0x54, 0x53, 0x54, 0x53, 0x63, 0x62,
+  0x70, 0x1F, 0x61, 0xF6, 0x15, 0x1F, 0xD1, 0x51, 0xF1, 0x2F, 0x03, 0xF0,
+  0x2F, 0x12, 0xF0, 0x2F, 0x12, 0xF0, 0x2F, 0x12, 0xF0, 0x2F, 0x12, 0xF0,
+  0x2F, 0x12, 0xF0, 0x2F, 0x12, 0xF0, 0x2F, 0x12, 0xF0, 0x2F, 0x12, 0xF0,
+  0x2F, 0x12, 0xF0, 0x3F, 0x02, 0xF0, 0x3F, 0x02, 0xF0, 0x3F, 0x02, 0xF0,
+  0x3F, 0x02, 0xF0, 0x3F, 0x02, 0xF0, 0x3F, 0x02, 0xF1, 0x2F, 0x02, 0xF1,
+  0x2F, 0x10, 0x66, 0xAA, 0x74, 0x44, 0x53, 0x82, 0x52, 0xA2, 0x33, 0xA3,
+  0x22, 0xC2, 0x22, 0xC2, 0x13, 0xC5, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE5, 0xC3, 0x12, 0xC2, 0x22, 0xC2, 0x23,
+  0xA3, 0x32, 0xA2, 0x43, 0x82, 0x64, 0x44, 0x7A, 0xA6, 0x60, 0x63, 0xC4,
+  0xB5, 0xA3, 0x12, 0x93, 0x22, 0x83, 0x32, 0x73, 0x42, 0x72, 0x52, 0xE2,
+  0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+  0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x7F, 0xF2, 0x66, 0xAA, 0x73, 0x63,
+  0x52, 0x93, 0x32, 0xB3, 0x13, 0xC2, 0x12, 0xE4, 0xE2, 0xF1, 0x2F, 0x12,
+  0xF0, 0x2F, 0x12, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+  0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2C, 0x21,
+  0x1E, 0x3F, 0x0F, 0xF8, 0x67, 0xAB, 0x73, 0x64, 0x52, 0xA3, 0x32, 0xC2,
+  0xF3, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x12, 0xF1, 0x3F, 0x03,
+  0xB7, 0xC6, 0xF2, 0x4F, 0x23, 0xF2, 0x3F, 0x22, 0xF3, 0x2F, 0x22, 0xF2,
+  0x2F, 0x22, 0xF2, 0x2F, 0x12, 0x12, 0xD3, 0x13, 0xB3, 0x35, 0x64, 0x6C,
+  0xA6, 0x70, 0xA4, 0xB5, 0xB2, 0x12, 0xA2, 0x22, 0xA1, 0x32, 0x92, 0x32,
+  0x82, 0x42, 0x82, 0x42, 0x72, 0x52, 0x71, 0x62, 0x62, 0x62, 0x61, 0x72,
+  0x51, 0x82, 0x42, 0x82, 0x41, 0x92, 0x32, 0x92, 0x31, 0xA2, 0x21, 0xB2,
+  0x2F, 0xF2, 0xC2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xA8, 0x88, 0x2E, 0x5E,
+  0x52, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F,
+  0x22, 0x36, 0x8D, 0x63, 0x83, 0xF3, 0x2F, 0x32, 0xF2, 0x2F, 0x32, 0xF2,
+  0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x12, 0xF2, 0x21, 0x2D, 0x31,
+  0x3B, 0x33, 0x56, 0x46, 0xCA, 0x67, 0xA7, 0x9A, 0x65, 0xC4, 0xD3, 0xE3,
+  0xE3, 0xF0, 0x2F, 0x03, 0xF0, 0x2F, 0x12, 0xF0, 0x3F, 0x02, 0x56, 0x52,
+  0x39, 0x42, 0x24, 0x44, 0x22, 0x13, 0x82, 0x22, 0x12, 0xA2, 0x14, 0xB2,
+  0x13, 0xD5, 0xD4, 0xE2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x22, 0xB2,
+  0x33, 0xA2, 0x43, 0x82, 0x63, 0x53, 0x89, 0xB5, 0x60, 0x0F, 0xF8, 0xE4,
+  0xE4, 0xD3, 0xF0, 0x2F, 0x12, 0xF0, 0x3F, 0x02, 0xF1, 0x2F, 0x12, 0xF0,
+  0x2F, 0x12, 0xF1, 0x2F, 0x02, 0xF1, 0x2F, 0x12, 0xF0, 0x2F, 0x12, 0xF1,
+  0x2F, 0x02, 0xF1, 0x2F, 0x12, 0xF0, 0x2F, 0x12, 0xF1, 0x2F, 0x02, 0xF1,
+  0x28, 0x66, 0xAA, 0x64, 0x64, 0x33, 0xA3, 0x22, 0xC2, 0x13, 0xC5, 0xE4,
+  0xE4, 0xE4, 0xE2, 0x12, 0xC2, 0x32, 0xA2, 0x53, 0x63, 0x7A, 0x8A, 0x73,
+  0x63, 0x52, 0xA2, 0x32, 0xC2, 0x22, 0xC2, 0x12, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE2, 0x12, 0xC2, 0x22, 0xB3, 0x32, 0x93, 0x53, 0x63, 0x7A, 0xA6, 0x60,
+  0x56, 0xB9, 0x83, 0x53, 0x62, 0x83, 0x42, 0xA3, 0x32, 0xB2, 0x22, 0xD2,
+  0x12, 0xD2, 0x12, 0xD2, 0x12, 0xE4, 0xD5, 0xD3, 0x12, 0xB4, 0x12, 0xA2,
+  0x12, 0x22, 0x82, 0x22, 0x24, 0x44, 0x22, 0x49, 0x32, 0x56, 0x52, 0xF0,
+  0x3F, 0x02, 0xF1, 0x2F, 0x03, 0xF0, 0x2F, 0x03, 0xE3, 0xE3, 0xD4, 0xC5,
+  0x6A, 0x97, 0xA0, 0x15, 0x1F, 0xD1, 0x5F, 0xFF, 0xF5, 0x51, 0xFD, 0x15,
+  0x10, 0x45, 0x47, 0x37, 0x37, 0x37, 0x45, 0xFF, 0xFF, 0xE7, 0x36, 0x45,
+  0x46, 0x45, 0x55, 0x54, 0x55, 0x54, 0x64, 0x63, 0x64, 0x63, 0x81, 0x80,
+  0xF4, 0x2F, 0x34, 0xF1, 0x4F, 0x23, 0xF2, 0x4F, 0x14, 0xF1, 0x4F, 0x14,
+  0xF2, 0x3F, 0x24, 0xF1, 0x4F, 0x44, 0xF4, 0x4F, 0x54, 0xF5, 0x4F, 0x54,
+  0xF5, 0x4F, 0x44, 0xF5, 0x4F, 0x54, 0xF5, 0x3F, 0x61, 0x10, 0x1F, 0x81,
+  0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x81, 0xF8, 0x02, 0xF4, 0x4F, 0x44,
+  0xF4, 0x4F, 0x43, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x3F, 0x44,
+  0xF2, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x14, 0xF0, 0x4F, 0x04,
+  0xF0, 0x4F, 0x13, 0xF3, 0x2F, 0x40, 0x57, 0x7C, 0x35, 0x64, 0x22, 0xB3,
+  0x12, 0xC2, 0x12, 0xD4, 0xD2, 0xF0, 0x2F, 0x02, 0xE3, 0xE2, 0xD3, 0xC4,
+  0xB5, 0xB3, 0xE2, 0xF0, 0x2F, 0x02, 0xFF, 0xFF, 0xFF, 0x94, 0xC6, 0xB6,
+  0xB6, 0xC4, 0x70, 0x66, 0xAA, 0x74, 0x53, 0x53, 0x83, 0x42, 0xA2, 0x33,
+  0xB2, 0x22, 0xC2, 0x22, 0xC2, 0x12, 0xD2, 0x12, 0x96, 0x12, 0x78, 0x12,
+  0x64, 0x32, 0x12, 0x53, 0x52, 0x12, 0x43, 0x62, 0x12, 0x42, 0x72, 0x12,
+  0x42, 0x72, 0x12, 0x42, 0x72, 0x12, 0x42, 0x72, 0x12, 0x52, 0x62, 0x12,
+  0x54, 0x42, 0x12, 0x6C, 0x8A, 0xF1, 0x2F, 0x22, 0xF1, 0x2F, 0x13, 0xF1,
+  0x2F, 0x13, 0xF1, 0x47, 0x26, 0xC8, 0x75, 0x5B, 0xF2, 0xBF, 0x82, 0x12,
+  0xF8, 0x22, 0x2F, 0x71, 0x32, 0xF6, 0x24, 0x2F, 0x52, 0x42, 0xF4, 0x25,
+  0x2F, 0x42, 0x62, 0xF3, 0x26, 0x2F, 0x22, 0x82, 0xF1, 0x28, 0x2F, 0x11,
+  0x92, 0xF0, 0x2A, 0x2E, 0x2A, 0x2D, 0xF0, 0xDF, 0x1C, 0x1D, 0x2B, 0x2E,
+  0x2A, 0x2E, 0x29, 0x2F, 0x02, 0x92, 0xF1, 0x28, 0x2F, 0x12, 0x72, 0xF3,
+  0x24, 0x98, 0xA1, 0x98, 0xA0, 0x0F, 0x16, 0xF3, 0x72, 0xB3, 0x62, 0xC3,
+  0x52, 0xD3, 0x42, 0xE2, 0x42, 0xE2, 0x42, 0xE2, 0x42, 0xD3, 0x42, 0xC3,
+  0x52, 0xA4, 0x6E, 0x8F, 0x07, 0x2B, 0x45, 0x2D, 0x34, 0x2E, 0x24, 0x2E,
+  0x33, 0x2F, 0x02, 0x32, 0xF0, 0x23, 0x2F, 0x02, 0x32, 0xF0, 0x23, 0x2E,
+  0x24, 0x2D, 0x34, 0x2C, 0x32, 0xF4, 0x3F, 0x25, 0x86, 0xEB, 0x22, 0x54,
+  0x64, 0x12, 0x43, 0xA5, 0x33, 0xD3, 0x32, 0xE3, 0x23, 0xF0, 0x22, 0x2F,
+  0x12, 0x22, 0xF4, 0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF5,
+  0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF6, 0x2F, 0x52, 0xF5, 0x3F, 0x53, 0xF0,
+  0x23, 0x3D, 0x25, 0x3A, 0x37, 0x46, 0x49, 0xCD, 0x67, 0x0F, 0x07, 0xF2,
+  0x72, 0xA4, 0x62, 0xC3, 0x52, 0xD3, 0x42, 0xE2, 0x42, 0xE3, 0x32, 0xF0,
+  0x23, 0x2F, 0x03, 0x22, 0xF1, 0x22, 0x2F, 0x12, 0x22, 0xF1, 0x22, 0x2F,
+  0x12, 0x22, 0xF1, 0x22, 0x2F, 0x12, 0x22, 0xF1, 0x22, 0x2F, 0x12, 0x22,
+  0xF1, 0x22, 0x2F, 0x02, 0x32, 0xF0, 0x23, 0x2E, 0x24, 0x2D, 0x34, 0x2C,
+  0x35, 0x2A, 0x44, 0xF2, 0x5F, 0x07, 0x0F, 0x61, 0xF6, 0x42, 0xE2, 0x42,
+  0xE2, 0x42, 0xE2, 0x42, 0xE2, 0x42, 0xE2, 0x42, 0xF5, 0x27, 0x2B, 0x27,
+  0x2B, 0x27, 0x2B, 0xBB, 0xBB, 0x27, 0x2B, 0x27, 0x2B, 0x27, 0x2B, 0x2F,
+  0x52, 0xF5, 0x2F, 0x02, 0x32, 0xF0, 0x23, 0x2F, 0x02, 0x32, 0xF0, 0x23,
+  0x2F, 0x02, 0x32, 0xF0, 0xFF, 0xF1, 0x0F, 0xFE, 0x32, 0xF0, 0x23, 0x2F,
+  0x02, 0x32, 0xF0, 0x23, 0x2F, 0x02, 0x32, 0xF0, 0x23, 0x2F, 0x52, 0x72,
+  0xB2, 0x72, 0xB2, 0x72, 0xBB, 0xBB, 0xB2, 0x72, 0xB2, 0x72, 0xB2, 0x72,
+  0xB2, 0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF5, 0x2F,
+  0x2C, 0xAC, 0xA0, 0x88, 0xDC, 0x22, 0x64, 0x76, 0x53, 0xB4, 0x42, 0xE3,
+  0x32, 0xF1, 0x22, 0x3F, 0x12, 0x22, 0xF6, 0x2F, 0x53, 0xF5, 0x2F, 0x62,
+  0xF6, 0x2F, 0x62, 0xF6, 0x2F, 0x62, 0xBC, 0xBC, 0xF3, 0x21, 0x2F, 0x32,
+  0x13, 0xF2, 0x22, 0x2F, 0x22, 0x22, 0xF2, 0x23, 0x2F, 0x12, 0x33, 0xF0,
+  0x24, 0x4D, 0x26, 0x48, 0x57, 0xEC, 0x86, 0x17, 0x77, 0x27, 0x77, 0x42,
+  0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62,
+  0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x6F, 0x26, 0xF2, 0x62, 0xD2, 0x62, 0xD2,
+  0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2,
+  0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x38, 0x7F, 0x17, 0x80, 0x0F, 0xF2,
+  0x72, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+  0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x7F, 0xF2,
+  0x8F, 0x08, 0xF0, 0xF1, 0x2F, 0x62, 0xF6, 0x2F, 0x62, 0xF6, 0x2F, 0x62,
+  0xF6, 0x2F, 0x62, 0xF6, 0x2F, 0x62, 0xF6, 0x2F, 0x62, 0xF6, 0x25, 0x2E,
+  0x25, 0x2E, 0x25, 0x2E, 0x25, 0x2E, 0x25, 0x2E, 0x25, 0x2E, 0x25, 0x2D,
+  0x26, 0x3C, 0x27, 0x3A, 0x29, 0x46, 0x3B, 0xBF, 0x06, 0xB0, 0x09, 0x68,
+  0x19, 0x68, 0x42, 0xD2, 0x72, 0xB3, 0x82, 0xA3, 0x92, 0x93, 0xA2, 0x83,
+  0xB2, 0x73, 0xC2, 0x62, 0xE2, 0x43, 0xF0, 0x23, 0x3F, 0x12, 0x24, 0xF1,
+  0x21, 0x7E, 0x53, 0x3D, 0x37, 0x2C, 0x29, 0x2B, 0x29, 0x3A, 0x2A, 0x2A,
+  0x2B, 0x29, 0x2B, 0x29, 0x2C, 0x28, 0x2C, 0x28, 0x2C, 0x37, 0x2D, 0x24,
+  0x99, 0xF0, 0xA5, 0x0C, 0x9C, 0xE2, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42,
+  0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42,
+  0xF4, 0x2F, 0x42, 0xC2, 0x52, 0xC2, 0x52, 0xC2, 0x52, 0xC2, 0x52, 0xC2,
+  0x52, 0xC2, 0x52, 0xC2, 0x52, 0xCF, 0xFE, 0x06, 0xEC, 0xE6, 0x22, 0x12,
+  0xC2, 0x12, 0x42, 0x12, 0xC2, 0x12, 0x42, 0x22, 0xA2, 0x22, 0x42, 0x22,
+  0xA2, 0x22, 0x42, 0x23, 0x83, 0x22, 0x42, 0x32, 0x82, 0x32, 0x42, 0x33,
+  0x63, 0x32, 0x42, 0x42, 0x62, 0x42, 0x42, 0x42, 0x62, 0x42, 0x42, 0x52,
+  0x42, 0x52, 0x42, 0x52, 0x42, 0x52, 0x42, 0x62, 0x22, 0x62, 0x42, 0x62,
+  0x22, 0x62, 0x42, 0x74, 0x72, 0x42, 0x74, 0x72, 0x42, 0x82, 0x82, 0x42,
+  0xF3, 0x24, 0x2F, 0x32, 0x42, 0xF3, 0x24, 0x2F, 0x32, 0x42, 0xF3, 0x24,
+  0x2F, 0x32, 0x28, 0xAF, 0x1A, 0x80, 0x06, 0xAE, 0xA8, 0x34, 0xD2, 0x55,
+  0xC2, 0x52, 0x12, 0xC2, 0x52, 0x22, 0xB2, 0x52, 0x23, 0xA2, 0x52, 0x32,
+  0xA2, 0x52, 0x42, 0x92, 0x52, 0x42, 0x92, 0x52, 0x52, 0x82, 0x52, 0x53,
+  0x72, 0x52, 0x62, 0x72, 0x52, 0x72, 0x62, 0x52, 0x73, 0x52, 0x52, 0x82,
+  0x52, 0x52, 0x92, 0x42, 0x52, 0x92, 0x42, 0x52, 0xA2, 0x32, 0x52, 0xA3,
+  0x22, 0x52, 0xB2, 0x22, 0x52, 0xC2, 0x12, 0x52, 0xC5, 0x52, 0xD4, 0x38,
+  0xA3, 0x38, 0xA3, 0x20, 0x96, 0xF1, 0xBB, 0x46, 0x49, 0x3A, 0x37, 0x3C,
+  0x35, 0x3E, 0x34, 0x2F, 0x12, 0x33, 0xF1, 0x32, 0x2F, 0x32, 0x22, 0xF3,
+  0x21, 0x2F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54,
+  0xF5, 0x21, 0x2F, 0x32, 0x22, 0xF3, 0x22, 0x3F, 0x13, 0x32, 0xF1, 0x24,
+  0x3E, 0x35, 0x3C, 0x37, 0x3A, 0x39, 0x46, 0x4B, 0xCF, 0x06, 0x90, 0x0F,
+  0x15, 0xF3, 0x62, 0xA4, 0x52, 0xC3, 0x42, 0xD2, 0x42, 0xE2, 0x32, 0xE2,
+  0x32, 0xE2, 0x32, 0xE2, 0x32, 0xD3, 0x32, 0xD2, 0x42, 0xC2, 0x52, 0xA4,
+  0x5E, 0x7C, 0x92, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42,
+  0xF4, 0x2F, 0x42, 0xF1, 0xC9, 0xC9, 0x96, 0xF1, 0xAC, 0x46, 0x49, 0x3A,
+  0x37, 0x3C, 0x35, 0x3E, 0x34, 0x2F, 0x12, 0x33, 0xF1, 0x32, 0x2F, 0x32,
+  0x22, 0xF3, 0x21, 0x2F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5,
+  0x4F, 0x54, 0xF5, 0x21, 0x2F, 0x32, 0x22, 0xF3, 0x22, 0x3F, 0x13, 0x32,
+  0xF1, 0x25, 0x2E, 0x36, 0x2C, 0x38, 0x2A, 0x3A, 0x36, 0x4D, 0xAF, 0x06,
+  0xF2, 0x3F, 0x4B, 0x43, 0x5F, 0x36, 0x38, 0x53, 0x0F, 0x09, 0xF2, 0xA2,
+  0x94, 0x92, 0xB3, 0x82, 0xC2, 0x82, 0xD2, 0x72, 0xD2, 0x72, 0xD2, 0x72,
+  0xD2, 0x72, 0xC3, 0x72, 0xC2, 0x82, 0xA3, 0x92, 0x84, 0xAD, 0xBB, 0xD2,
+  0x73, 0xC2, 0x83, 0xB2, 0x93, 0xA2, 0xA3, 0x92, 0xB3, 0x82, 0xC2, 0x82,
+  0xD2, 0x72, 0xD2, 0x72, 0xE2, 0x39, 0xAE, 0xB4, 0x67, 0xBB, 0x22, 0x44,
+  0x66, 0x33, 0xA4, 0x32, 0xC3, 0x22, 0xE2, 0x22, 0xE2, 0x22, 0xE2, 0x22,
+  0xF3, 0x3F, 0x32, 0xF4, 0x3F, 0x36, 0xF1, 0x8F, 0x17, 0xF3, 0x3F, 0x33,
+  0xF3, 0x3F, 0x32, 0xF3, 0x4F, 0x14, 0xF1, 0x5E, 0x6E, 0x21, 0x5A, 0x41,
+  0x21, 0x46, 0x52, 0x22, 0xCA, 0x86, 0x0F, 0xFF, 0x18, 0x28, 0x48, 0x28,
+  0x48, 0x28, 0x48, 0x28, 0x48, 0x28, 0x2A, 0x2F, 0x52, 0xF5, 0x2F, 0x52,
+  0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x52,
+  0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF5, 0x2E, 0xE8, 0xE4, 0x08, 0x7F,
+  0x17, 0x82, 0x2F, 0x02, 0x42, 0xF0, 0x24, 0x2F, 0x02, 0x42, 0xF0, 0x24,
+  0x2F, 0x02, 0x42, 0xF0, 0x24, 0x2F, 0x02, 0x42, 0xF0, 0x24, 0x2F, 0x02,
+  0x42, 0xF0, 0x24, 0x2F, 0x02, 0x42, 0xF0, 0x24, 0x2F, 0x02, 0x42, 0xF0,
+  0x24, 0x2F, 0x02, 0x42, 0xF0, 0x24, 0x2F, 0x02, 0x42, 0xF0, 0x24, 0x3D,
+  0x35, 0x2D, 0x26, 0x3B, 0x37, 0x39, 0x39, 0x45, 0x4B, 0xBE, 0x78, 0x19,
+  0x8A, 0x19, 0x8A, 0x32, 0xF3, 0x27, 0x2F, 0x12, 0x82, 0xF1, 0x29, 0x2F,
+  0x02, 0x92, 0xE2, 0xA2, 0xE2, 0xB2, 0xC2, 0xC2, 0xC2, 0xC3, 0xB2, 0xD2,
+  0xA2, 0xE2, 0xA2, 0xF0, 0x28, 0x2F, 0x12, 0x82, 0xF1, 0x37, 0x2F, 0x22,
+  0x62, 0xF3, 0x26, 0x2F, 0x42, 0x42, 0xF5, 0x24, 0x2F, 0x52, 0x41, 0xF7,
+  0x22, 0x2F, 0x72, 0x22, 0xF8, 0x4F, 0x94, 0xF9, 0x3D, 0x09, 0x8F, 0x38,
+  0x92, 0x2F, 0x32, 0x42, 0xF3, 0x24, 0x2F, 0x32, 0x42, 0x83, 0x72, 0x42,
+  0x74, 0x72, 0x52, 0x64, 0x72, 0x52, 0x65, 0x61, 0x62, 0x61, 0x22, 0x61,
+  0x62, 0x52, 0x22, 0x52, 0x62, 0x52, 0x22, 0x52, 0x62, 0x52, 0x32, 0x42,
+  0x62, 0x42, 0x42, 0x42, 0x62, 0x42, 0x42, 0x42, 0x63, 0x32, 0x43, 0x32,
+  0x72, 0x31, 0x62, 0x32, 0x72, 0x22, 0x62, 0x31, 0x82, 0x22, 0x62, 0x22,
+  0x82, 0x22, 0x72, 0x12, 0x82, 0x12, 0x82, 0x12, 0x82, 0x12, 0x82, 0x12,
+  0x82, 0x12, 0x82, 0x12, 0x82, 0x11, 0xA4, 0x93, 0xA4, 0x93, 0xA3, 0x50,
+  0x17, 0x88, 0x17, 0x88, 0x32, 0xE2, 0x72, 0xC3, 0x73, 0xA3, 0x93, 0x92,
+  0xB2, 0x82, 0xD2, 0x62, 0xE3, 0x43, 0xF0, 0x32, 0x3F, 0x23, 0x12, 0xF4,
+  0x4F, 0x62, 0xF6, 0x4F, 0x46, 0xF3, 0x22, 0x2F, 0x22, 0x42, 0xF0, 0x26,
+  0x2D, 0x36, 0x3B, 0x38, 0x3A, 0x2A, 0x29, 0x2C, 0x27, 0x2E, 0x25, 0x3E,
+  0x32, 0x88, 0xF1, 0x88, 0x08, 0x8F, 0x18, 0x83, 0x2E, 0x27, 0x2C, 0x28,
+  0x3A, 0x39, 0x2A, 0x2B, 0x28, 0x2C, 0x36, 0x3D, 0x26, 0x2F, 0x02, 0x42,
+  0xF1, 0x32, 0x3F, 0x22, 0x22, 0xF4, 0x4F, 0x54, 0xF6, 0x2F, 0x72, 0xF7,
+  0x2F, 0x72, 0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0x72, 0xF1,
+  0xEA, 0xE5, 0x1F, 0x12, 0xF1, 0x22, 0xC2, 0x22, 0xB2, 0x32, 0xA3, 0x32,
+  0x93, 0x42, 0x92, 0x52, 0x83, 0xE3, 0xF0, 0x2F, 0x03, 0xE3, 0xF0, 0x2F,
+  0x02, 0xF0, 0x3E, 0x3F, 0x02, 0xF0, 0x39, 0x23, 0x3A, 0x23, 0x2B, 0x22,
+  0x2C, 0x21, 0x3C, 0x5D, 0x4E, 0xFF, 0x80, 0x0F, 0x15, 0x25, 0x25, 0x25,
+  0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+  0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+  0x25, 0x25, 0xE0, 0x02, 0xF1, 0x2F, 0x22, 0xF1, 0x2F, 0x22, 0xF1, 0x2F,
+  0x22, 0xF1, 0x2F, 0x22, 0xF1, 0x2F, 0x22, 0xF1, 0x2F, 0x22, 0xF1, 0x2F,
+  0x22, 0xF1, 0x2F, 0x22, 0xF1, 0x2F, 0x22, 0xF1, 0x2F, 0x22, 0xF1, 0x2F,
+  0x13, 0xF1, 0x2F, 0x13, 0xF1, 0x2F, 0x13, 0xF1, 0x2F, 0x13, 0xF1, 0x2F,
+  0x12, 0xF2, 0x2F, 0x12, 0xF2, 0x2F, 0x12, 0x0E, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x5F, 0x10, 0x91, 0xF1, 0x2F, 0x04, 0xD3, 0x12, 0xB3, 0x23, 0xA2,
+  0x43, 0x82, 0x62, 0x72, 0x82, 0x53, 0x92, 0x33, 0xA3, 0x22, 0xC5, 0xE2,
+  0x0F, 0xFF, 0xB0, 0x02, 0x63, 0x63, 0x64, 0x63, 0x63, 0x62, 0x77, 0xBD,
+  0x93, 0x84, 0xF5, 0x2F, 0x62, 0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x52, 0x99,
+  0x22, 0x6F, 0x15, 0x59, 0x34, 0x3D, 0x23, 0x3E, 0x23, 0x2F, 0x02, 0x32,
+  0xF0, 0x23, 0x2E, 0x33, 0x2D, 0x44, 0x2A, 0x31, 0x24, 0x46, 0x42, 0x52,
+  0xB4, 0x54, 0x7B, 0x05, 0xF3, 0x5F, 0x62, 0xF6, 0x2F, 0x62, 0xF6, 0x2F,
+  0x62, 0xF6, 0x25, 0x6A, 0x23, 0xA8, 0x22, 0x36, 0x37, 0x21, 0x38, 0x36,
+  0x4C, 0x25, 0x4C, 0x34, 0x3E, 0x24, 0x3E, 0x33, 0x2F, 0x12, 0x32, 0xF1,
+  0x23, 0x2F, 0x12, 0x32, 0xF1, 0x23, 0x2F, 0x12, 0x32, 0xF1, 0x23, 0x3E,
+  0x24, 0x3E, 0x24, 0x4C, 0x34, 0x5A, 0x35, 0x21, 0x38, 0x33, 0x52, 0x36,
+  0x34, 0x53, 0xAF, 0x06, 0x70, 0x77, 0xCB, 0x22, 0x54, 0x66, 0x43, 0xA4,
+  0x32, 0xD3, 0x23, 0xE2, 0x22, 0xF0, 0x21, 0x3F, 0x02, 0x12, 0xF4, 0x2F,
+  0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x43, 0xF4, 0x2F, 0x43, 0xF4, 0x2F,
+  0x02, 0x33, 0xB4, 0x44, 0x74, 0x7D, 0xA8, 0x60, 0xF1, 0x5F, 0x45, 0xF7,
+  0x2F, 0x72, 0xF7, 0x2F, 0x72, 0xF7, 0x2A, 0x66, 0x28, 0xA4, 0x27, 0x45,
+  0x42, 0x26, 0x39, 0x31, 0x25, 0x3B, 0x54, 0x3D, 0x44, 0x2F, 0x03, 0x33,
+  0xF0, 0x33, 0x2F, 0x22, 0x32, 0xF2, 0x23, 0x2F, 0x22, 0x32, 0xF2, 0x23,
+  0x2F, 0x22, 0x32, 0xF2, 0x24, 0x2F, 0x03, 0x42, 0xF0, 0x34, 0x3D, 0x45,
+  0x3B, 0x21, 0x26, 0x39, 0x31, 0x27, 0x45, 0x42, 0x55, 0xA4, 0x57, 0x6B,
+  0x77, 0xCB, 0x84, 0x74, 0x53, 0xB3, 0x42, 0xD3, 0x22, 0xF0, 0x22, 0x2F,
+  0x14, 0xF2, 0x4F, 0x2F, 0xFF, 0x1F, 0x42, 0xF4, 0x2F, 0x52, 0xF4, 0x2F,
+  0x52, 0xF4, 0x3E, 0x23, 0x3C, 0x34, 0x47, 0x57, 0xCB, 0x76, 0x99, 0x8C,
+  0x63, 0xF0, 0x3F, 0x12, 0xF2, 0x2F, 0x22, 0xF2, 0x2C, 0xF2, 0x2F, 0x27,
+  0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2,
+  0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xCF,
+  0x13, 0xF1, 0x30, 0x76, 0xF0, 0xA3, 0x54, 0x36, 0x32, 0x53, 0x39, 0x21,
+  0x25, 0x2C, 0x44, 0x3C, 0x44, 0x2E, 0x33, 0x3E, 0x33, 0x2F, 0x12, 0x32,
+  0xF1, 0x23, 0x2F, 0x12, 0x32, 0xF1, 0x23, 0x2F, 0x12, 0x32, 0xF1, 0x24,
+  0x2E, 0x34, 0x2E, 0x35, 0x2C, 0x45, 0x3A, 0x21, 0x26, 0x46, 0x32, 0x28,
+  0xA3, 0x2A, 0x65, 0x2F, 0x62, 0xF6, 0x2F, 0x62, 0xF6, 0x2F, 0x52, 0xF5,
+  0x3F, 0x43, 0xBB, 0xC9, 0x80, 0x05, 0xF3, 0x5F, 0x62, 0xF6, 0x2F, 0x62,
+  0xF6, 0x2F, 0x62, 0xF6, 0x24, 0x6B, 0x23, 0x99, 0x21, 0x36, 0x38, 0x58,
+  0x37, 0x4A, 0x36, 0x3C, 0x26, 0x2D, 0x26, 0x2D, 0x26, 0x2D, 0x26, 0x2D,
+  0x26, 0x2D, 0x26, 0x2D, 0x26, 0x2D, 0x26, 0x2D, 0x26, 0x2D, 0x26, 0x2D,
+  0x26, 0x2D, 0x26, 0x2D, 0x26, 0x2D, 0x23, 0x87, 0xF1, 0x78, 0x73, 0xF0,
+  0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xFF, 0xFF, 0xF7, 0x8A, 0x8F, 0x12, 0xF1,
+  0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1,
+  0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x28, 0xFF, 0x60,
+  0x93, 0xB3, 0xB3, 0xB3, 0xB3, 0xFF, 0xFD, 0xFD, 0xC2, 0xC2, 0xC2, 0xC2,
+  0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+  0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xB3, 0xA3, 0xA3, 0x2B, 0x3A, 0x40,
+  0x05, 0xF2, 0x5F, 0x52, 0xF5, 0x2F, 0x52, 0xF5, 0x2F, 0x52, 0xF5, 0x2F,
+  0x52, 0x68, 0x62, 0x68, 0x62, 0x82, 0xA2, 0x63, 0xB2, 0x53, 0xC2, 0x43,
+  0xD2, 0x33, 0xE2, 0x23, 0xF0, 0x21, 0x3F, 0x17, 0xF0, 0x32, 0x3E, 0x24,
+  0x3D, 0x25, 0x3C, 0x26, 0x3B, 0x27, 0x3A, 0x28, 0x39, 0x29, 0x38, 0x2A,
+  0x34, 0x58, 0xE8, 0x90, 0x28, 0xA8, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12,
+  0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12,
+  0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12,
+  0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0x8F, 0xF6, 0x84, 0x64, 0x65, 0x26,
+  0x46, 0x55, 0x12, 0x33, 0x22, 0x33, 0x74, 0x52, 0x12, 0x53, 0x63, 0x73,
+  0x72, 0x62, 0x82, 0x82, 0x62, 0x82, 0x82, 0x62, 0x82, 0x82, 0x62, 0x82,
+  0x82, 0x62, 0x82, 0x82, 0x62, 0x82, 0x82, 0x62, 0x82, 0x82, 0x62, 0x82,
+  0x82, 0x62, 0x82, 0x82, 0x62, 0x82, 0x82, 0x62, 0x82, 0x82, 0x62, 0x82,
+  0x82, 0x62, 0x82, 0x82, 0x62, 0x82, 0x82, 0x37, 0x65, 0x5C, 0x65, 0x55,
+  0xB5, 0x85, 0x39, 0x65, 0x23, 0x53, 0x82, 0x12, 0x83, 0x74, 0xA3, 0x63,
+  0xC2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62,
+  0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62,
+  0xD2, 0x62, 0xD2, 0x29, 0x8F, 0x08, 0x60, 0x86, 0xDC, 0x94, 0x64, 0x73,
+  0xA3, 0x53, 0xC3, 0x33, 0xE3, 0x22, 0xF1, 0x22, 0x2F, 0x12, 0x12, 0xF3,
+  0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x32, 0x12, 0xF1, 0x22, 0x2F,
+  0x12, 0x23, 0xE3, 0x33, 0xC3, 0x53, 0xA3, 0x74, 0x64, 0x9C, 0xD6, 0x80,
+  0xA6, 0x75, 0x3A, 0x55, 0x23, 0x63, 0x72, 0x12, 0xA2, 0x64, 0xC2, 0x54,
+  0xC3, 0x43, 0xE2, 0x43, 0xE3, 0x32, 0xF1, 0x23, 0x2F, 0x12, 0x32, 0xF1,
+  0x23, 0x2F, 0x12, 0x32, 0xF1, 0x23, 0x2F, 0x12, 0x33, 0xE2, 0x43, 0xE2,
+  0x44, 0xC2, 0x52, 0x12, 0xA3, 0x52, 0x23, 0x64, 0x62, 0x3A, 0x82, 0x56,
+  0xA2, 0xF6, 0x2F, 0x62, 0xF6, 0x2F, 0x62, 0xF6, 0x2F, 0x62, 0xF3, 0xAD,
+  0xAD, 0x76, 0xF1, 0xB3, 0x54, 0x45, 0x42, 0x53, 0x39, 0x31, 0x25, 0x3C,
+  0x44, 0x3D, 0x44, 0x2F, 0x03, 0x33, 0xF0, 0x33, 0x2F, 0x22, 0x32, 0xF2,
+  0x23, 0x2F, 0x22, 0x32, 0xF2, 0x23, 0x2F, 0x22, 0x32, 0xF2, 0x24, 0x2F,
+  0x03, 0x43, 0xD4, 0x52, 0xD4, 0x63, 0x93, 0x12, 0x74, 0x54, 0x22, 0x8B,
+  0x32, 0xA7, 0x52, 0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0x72,
+  0xF7, 0x2F, 0x2A, 0xEA, 0x16, 0x74, 0x46, 0x58, 0x62, 0x34, 0x43, 0x52,
+  0x23, 0xE6, 0xF0, 0x4F, 0x23, 0xF3, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xF4,
+  0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2E, 0xF1, 0x5F,
+  0x15, 0x57, 0x9B, 0x12, 0x34, 0x65, 0x23, 0xA3, 0x22, 0xC2, 0x22, 0xC2,
+  0x22, 0xC2, 0x23, 0xF1, 0x3F, 0x15, 0xF0, 0x9F, 0x05, 0xF1, 0x3F, 0x13,
+  0xF1, 0x4E, 0x4E, 0x5C, 0x7A, 0x31, 0x66, 0x42, 0x21, 0xC9, 0x75, 0x42,
+  0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x0F, 0x24, 0xF2, 0x82,
+  0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42,
+  0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xF5, 0x2B, 0x35,
+  0x37, 0x57, 0xDA, 0x76, 0x05, 0x96, 0x35, 0x96, 0x62, 0xD2, 0x62, 0xD2,
+  0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2,
+  0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xD2, 0x62, 0xC3,
+  0x62, 0xB4, 0x72, 0x92, 0x12, 0x73, 0x54, 0x25, 0x5A, 0x35, 0x75, 0xB0,
+  0x19, 0x6A, 0x19, 0x6A, 0x42, 0xE2, 0x82, 0xE2, 0x92, 0xC3, 0x92, 0xC2,
+  0xB2, 0xB2, 0xB2, 0xA2, 0xC3, 0x92, 0xD2, 0x82, 0xE2, 0x82, 0xF0, 0x26,
+  0x2F, 0x12, 0x62, 0xF2, 0x25, 0x2F, 0x22, 0x42, 0xF4, 0x23, 0x2F, 0x42,
+  0x22, 0xF5, 0x31, 0x2F, 0x64, 0xF7, 0x4B, 0x17, 0xA8, 0x17, 0xA8, 0x32,
+  0xF2, 0x16, 0x2F, 0x12, 0x62, 0xF1, 0x26, 0x27, 0x27, 0x27, 0x16, 0x46,
+  0x27, 0x25, 0x46, 0x18, 0x25, 0x45, 0x28, 0x24, 0x22, 0x24, 0x28, 0x24,
+  0x22, 0x24, 0x29, 0x14, 0x22, 0x24, 0x29, 0x22, 0x24, 0x22, 0x2A, 0x22,
+  0x24, 0x22, 0x2A, 0x22, 0x24, 0x22, 0x2B, 0x11, 0x26, 0x21, 0x2B, 0x46,
+  0x21, 0x1C, 0x47, 0x3C, 0x38, 0x3C, 0x38, 0x36, 0x27, 0x68, 0x37, 0x68,
+  0x52, 0xC3, 0x82, 0xA3, 0xA2, 0x83, 0xC2, 0x63, 0xE2, 0x43, 0xF1, 0x22,
+  0x3F, 0x34, 0xF6, 0x2F, 0x64, 0xF4, 0x22, 0x3F, 0x12, 0x43, 0xE2, 0x63,
+  0xC2, 0x83, 0xA2, 0xA3, 0x82, 0xC3, 0x62, 0xE3, 0x38, 0x69, 0x18, 0x69,
+  0x17, 0x88, 0x17, 0x88, 0x32, 0xF0, 0x25, 0x2E, 0x27, 0x2D, 0x27, 0x2C,
+  0x29, 0x2B, 0x29, 0x2A, 0x2B, 0x29, 0x2B, 0x28, 0x2D, 0x27, 0x2D, 0x26,
+  0x2F, 0x02, 0x52, 0xF0, 0x24, 0x2F, 0x22, 0x32, 0xF2, 0x22, 0x2F, 0x42,
+  0x12, 0xF4, 0x21, 0x1F, 0x54, 0xF6, 0x2F, 0x72, 0xF7, 0x2F, 0x62, 0xF7,
+  0x2F, 0x62, 0xF7, 0x2F, 0x62, 0xF0, 0xDB, 0xDA, 0x0F, 0x11, 0xF1, 0x12,
+  0xB2, 0x22, 0xA3, 0x22, 0x93, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE3, 0xE2,
+  0xE2, 0xE2, 0xE2, 0xE2, 0xB2, 0x13, 0xB2, 0x12, 0xCF, 0xF6, 0x83, 0x65,
+  0x62, 0x82, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+  0x82, 0x83, 0x54, 0x74, 0xA3, 0x92, 0xA2, 0x92, 0x92, 0x92, 0x92, 0x92,
+  0x92, 0x92, 0x92, 0x92, 0x92, 0xA2, 0x95, 0x83, 0x0F, 0xFF, 0xF8, 0x03,
+  0x85, 0x92, 0xA2, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+  0x92, 0xA2, 0x93, 0xA4, 0x74, 0x53, 0x82, 0x82, 0x92, 0x92, 0x92, 0x92,
+  0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x82, 0x65, 0x63, 0x80, 0x44, 0xE8,
+  0x82, 0x13, 0x43, 0x63, 0x12, 0x64, 0x33, 0x12, 0x97, 0xE4, 0x40 };
+
+const GFXglyph FreeMono24pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,  28,    0,    1 },   // 0x20 ' '
+  {     0,   5,  30,  28,   11,  -28 },   // 0x21 '!'
+  {    24,  16,  14,  28,    6,  -28 },   // 0x22 '"'
+  {    53,  19,  32,  28,    4,  -29 },   // 0x23 '#'
+  {   116,  18,  33,  28,    5,  -29 },   // 0x24 '$'
+  {   165,  20,  29,  28,    4,  -27 },   // 0x25 '%'
+  {   214,  18,  25,  28,    5,  -23 },   // 0x26 '&'
+  {   263,   7,  14,  28,   11,  -28 },   // 0x27 '''
+  {   278,   7,  34,  28,   14,  -27 },   // 0x28 '('
+  {   312,   7,  34,  28,    8,  -27 },   // 0x29 ')'
+  {   347,  18,  16,  28,    5,  -27 },   // 0x2A '*'
+  {   374,  20,  22,  28,    4,  -23 },   // 0x2B '+'
+  {   406,   9,  14,  28,    6,   -6 },   // 0x2C ','
+  {   421,  22,   2,  28,    3,  -13 },   // 0x2D '-'
+  {   424,   7,   6,  28,   11,   -4 },   // 0x2E '.'
+  {   428,  18,  35,  28,    5,  -30 },   // 0x2F '/'
+  {   482,  18,  30,  28,    5,  -28 },   // 0x30 '0'
+  {   526,  16,  29,  28,    6,  -28 },   // 0x31 '1'
+  {   560,  18,  29,  28,    5,  -28 },   // 0x32 '2'
+  {   604,  19,  30,  28,    5,  -28 },   // 0x33 '3'
+  {   650,  16,  28,  28,    6,  -27 },   // 0x34 '4'
+  {   694,  19,  29,  28,    5,  -27 },   // 0x35 '5'
+  {   738,  18,  30,  28,    6,  -28 },   // 0x36 '6'
+  {   789,  18,  28,  28,    5,  -27 },   // 0x37 '7'
+  {   829,  18,  30,  28,    5,  -28 },   // 0x38 '8'
+  {   876,  18,  30,  28,    6,  -28 },   // 0x39 '9'
+  {   927,   7,  21,  28,   11,  -19 },   // 0x3A ':'
+  {   937,  10,  27,  28,    7,  -19 },   // 0x3B ';'
+  {   960,  22,  22,  28,    3,  -23 },   // 0x3C '<'
+  {   994,  24,   9,  28,    2,  -17 },   // 0x3D '='
+  {  1004,  21,  22,  28,    4,  -23 },   // 0x3E '>'
+  {  1038,  17,  28,  28,    6,  -26 },   // 0x3F '?'
+  {  1071,  18,  32,  28,    5,  -28 },   // 0x40 '@'
+  {  1135,  28,  26,  28,    0,  -25 },   // 0x41 'A'
+  {  1193,  22,  26,  28,    3,  -25 },   // 0x42 'B'
+  {  1244,  22,  28,  28,    3,  -26 },   // 0x43 'C'
+  {  1293,  22,  26,  28,    3,  -25 },   // 0x44 'D'
+  {  1350,  22,  26,  28,    3,  -25 },   // 0x45 'E'
+  {  1398,  22,  26,  28,    3,  -25 },   // 0x46 'F'
+  {  1443,  23,  28,  28,    3,  -26 },   // 0x47 'G'
+  {  1495,  23,  26,  28,    3,  -25 },   // 0x48 'H'
+  {  1546,  16,  26,  28,    6,  -25 },   // 0x49 'I'
+  {  1572,  23,  27,  28,    4,  -25 },   // 0x4A 'J'
+  {  1618,  24,  26,  28,    3,  -25 },   // 0x4B 'K'
+  {  1671,  21,  26,  28,    4,  -25 },   // 0x4C 'L'
+  {  1711,  26,  26,  28,    1,  -25 },   // 0x4D 'M'
+  {  1794,  24,  26,  28,    2,  -25 },   // 0x4E 'N'
+  {  1864,  24,  28,  28,    2,  -26 },   // 0x4F 'O'
+  {  1919,  21,  26,  28,    3,  -25 },   // 0x50 'P'
+  {  1962,  24,  32,  28,    2,  -26 },   // 0x51 'Q'
+  {  2024,  24,  26,  28,    3,  -25 },   // 0x52 'R'
+  {  2072,  20,  28,  28,    4,  -26 },   // 0x53 'S'
+  {  2118,  22,  26,  28,    3,  -25 },   // 0x54 'T'
+  {  2158,  23,  27,  28,    3,  -25 },   // 0x55 'U'
+  {  2219,  28,  26,  28,    0,  -25 },   // 0x56 'V'
+  {  2277,  26,  26,  28,    1,  -25 },   // 0x57 'W'
+  {  2364,  24,  26,  28,    2,  -25 },   // 0x58 'X'
+  {  2416,  24,  26,  28,    2,  -25 },   // 0x59 'Y'
+  {  2462,  18,  26,  28,    5,  -25 },   // 0x5A 'Z'
+  {  2503,   7,  34,  28,   13,  -27 },   // 0x5B '['
+  {  2535,  18,  35,  28,    5,  -30 },   // 0x5C '\'
+  {  2587,   7,  34,  28,    8,  -27 },   // 0x5D ']'
+  {  2619,  18,  12,  28,    5,  -28 },   // 0x5E '^'
+  {  2640,  28,   2,  28,    0,    5 },   // 0x5F '_'
+  {  2643,   8,   7,  28,    7,  -29 },   // 0x60 '`'
+  {  2650,  22,  22,  28,    3,  -20 },   // 0x61 'a'
+  {  2691,  23,  29,  28,    2,  -27 },   // 0x62 'b'
+  {  2753,  21,  22,  28,    4,  -20 },   // 0x63 'c'
+  {  2792,  24,  29,  28,    3,  -27 },   // 0x64 'd'
+  {  2856,  21,  22,  28,    3,  -20 },   // 0x65 'e'
+  {  2890,  19,  28,  28,    6,  -27 },   // 0x66 'f'
+  {  2931,  23,  30,  28,    3,  -20 },   // 0x67 'g'
+  {  2993,  23,  28,  28,    3,  -27 },   // 0x68 'h'
+  {  3046,  18,  29,  28,    5,  -28 },   // 0x69 'i'
+  {  3084,  14,  38,  28,    6,  -28 },   // 0x6A 'j'
+  {  3120,  22,  28,  28,    4,  -27 },   // 0x6B 'k'
+  {  3172,  18,  28,  28,    5,  -27 },   // 0x6C 'l'
+  {  3212,  28,  21,  28,    0,  -20 },   // 0x6D 'm'
+  {  3276,  23,  21,  28,    2,  -20 },   // 0x6E 'n'
+  {  3319,  22,  22,  28,    3,  -20 },   // 0x6F 'o'
+  {  3360,  23,  30,  28,    2,  -20 },   // 0x70 'p'
+  {  3421,  24,  30,  28,    3,  -20 },   // 0x71 'q'
+  {  3484,  21,  20,  28,    5,  -19 },   // 0x72 'r'
+  {  3517,  18,  22,  28,    5,  -20 },   // 0x73 's'
+  {  3551,  21,  27,  28,    3,  -25 },   // 0x74 't'
+  {  3592,  23,  21,  28,    3,  -19 },   // 0x75 'u'
+  {  3636,  26,  20,  28,    1,  -19 },   // 0x76 'v'
+  {  3679,  26,  20,  28,    1,  -19 },   // 0x77 'w'
+  {  3740,  24,  20,  28,    2,  -19 },   // 0x78 'x'
+  {  3780,  24,  29,  28,    2,  -19 },   // 0x79 'y'
+  {  3836,  17,  20,  28,    6,  -19 },   // 0x7A 'z'
+  {  3862,  11,  34,  28,    8,  -27 },   // 0x7B '{'
+  {  3896,   2,  34,  28,   13,  -27 },   // 0x7C '|'
+  {  3899,  11,  34,  28,    9,  -27 },   // 0x7D '}'
+  {  3934,  20,   6,  28,    4,  -15 } }; // 0x7E '~'
+
+const GFXfontPacked FreeMono24pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeMono24pt7bPackedRuns,
+    (GFXglyph *)FreeMono24pt7bPackedGlyphs,
+    0x20, 0x7E, 47 } };
+
+// Approx. 4619 bytes
@@ -0,0 +1,249 @@
+// FreeMonoBold12pt7b as run lengths, generated by Tools/GFX_pack from FreeMonoBold12pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeMonoBold12pt7bPackedRuns[] PROGMEM = {
+  0x0F, 0xD1, 0x22, 0x22, 0x22, 0x26, 0x21, 0x41, 0x21, 0x03, 0x26, 0x23,
+  0x12, 0x31, 0x21, 0x41, 0x21, 0x41, 0x21, 0x41, 0x21, 0x41, 0x10, 0x31,
+  0x32, 0x43, 0x22, 0x42, 0x32, 0x42, 0x32, 0x42, 0x22, 0x3F, 0x72, 0x22,
+  0x25, 0x22, 0x25, 0x22, 0x25, 0x22, 0x23, 0xA1, 0xA3, 0x22, 0x25, 0x22,
+  0x24, 0x32, 0x24, 0x23, 0x25, 0x13, 0x14, 0x42, 0x82, 0x82, 0x67, 0x28,
+  0x23, 0x32, 0x22, 0x51, 0x22, 0x84, 0x77, 0x67, 0x65, 0x55, 0x4C, 0x18,
+  0x62, 0x82, 0x82, 0x82, 0x40, 0x23, 0x65, 0x42, 0x31, 0x41, 0x41, 0x42,
+  0x31, 0x55, 0x63, 0x23, 0x44, 0x37, 0x22, 0x25, 0x51, 0x32, 0x41, 0x41,
+  0x41, 0x32, 0x45, 0x63, 0x20, 0x25, 0x47, 0x32, 0x22, 0x42, 0x83, 0x82,
+  0x74, 0x55, 0x13, 0x12, 0x16, 0x12, 0x24, 0x22, 0x33, 0x29, 0x28, 0x10,
+  0x06, 0x11, 0x21, 0x21, 0x21, 0x21, 0x10, 0x23, 0x23, 0x13, 0x23, 0x22,
+  0x23, 0x22, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x42, 0x32, 0x33, 0x32,
+  0x33, 0x31, 0x10, 0x03, 0x23, 0x33, 0x23, 0x32, 0x33, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x22, 0x32, 0x23, 0x22, 0x23, 0x31, 0x30, 0x42,
+  0x82, 0x82, 0x43, 0x12, 0x1D, 0x18, 0x44, 0x56, 0x42, 0x22, 0x42, 0x22,
+  0x20, 0x52, 0xA2, 0xA2, 0xA2, 0xA2, 0x5F, 0x95, 0x2A, 0x2A, 0x2A, 0x2A,
+  0x2A, 0x25, 0x23, 0x13, 0x23, 0x22, 0x23, 0x22, 0x31, 0x40, 0x0F, 0x90,
+  0x09, 0x91, 0x82, 0x73, 0x73, 0x63, 0x73, 0x72, 0x73, 0x72, 0x73, 0x72,
+  0x73, 0x72, 0x73, 0x72, 0x73, 0x72, 0x73, 0x73, 0x81, 0x80, 0x34, 0x56,
+  0x32, 0x42, 0x13, 0x45, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x43,
+  0x12, 0x42, 0x36, 0x54, 0x30, 0x33, 0x64, 0x46, 0x43, 0x12, 0x82, 0x82,
+  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x4F, 0x50, 0x35, 0x38, 0x13,
+  0x46, 0x54, 0x62, 0x73, 0x63, 0x64, 0x54, 0x54, 0x54, 0x54, 0x36, 0x4F,
+  0x70, 0x26, 0x48, 0x32, 0x43, 0x92, 0x92, 0x83, 0x55, 0x65, 0x93, 0xA2,
+  0x92, 0x94, 0x6D, 0x27, 0x30, 0x53, 0x54, 0x54, 0x45, 0x42, 0x12, 0x33,
+  0x12, 0x32, 0x22, 0x22, 0x32, 0x13, 0x32, 0x1F, 0x36, 0x24, 0x63, 0x60,
+  0x18, 0x28, 0x22, 0x82, 0x82, 0x86, 0x48, 0x22, 0x42, 0x92, 0x82, 0x82,
+  0x84, 0x52, 0x19, 0x26, 0x30, 0x55, 0x37, 0x24, 0x53, 0x72, 0x73, 0x73,
+  0x14, 0x29, 0x14, 0x36, 0x55, 0x55, 0x52, 0x13, 0x33, 0x27, 0x45, 0x20,
+  0x0F, 0x75, 0x55, 0x37, 0x28, 0x27, 0x37, 0x28, 0x27, 0x37, 0x28, 0x27,
+  0x37, 0x28, 0x24, 0x34, 0x48, 0x13, 0x45, 0x64, 0x64, 0x62, 0x12, 0x42,
+  0x28, 0x28, 0x13, 0x45, 0x64, 0x65, 0x43, 0x18, 0x36, 0x20, 0x25, 0x47,
+  0x23, 0x33, 0x12, 0x55, 0x55, 0x56, 0x34, 0x19, 0x24, 0x13, 0x73, 0x72,
+  0x73, 0x54, 0x27, 0x35, 0x50, 0x09, 0xF0, 0x90, 0x13, 0x13, 0x13, 0xF6,
+  0x31, 0x22, 0x21, 0x22, 0x22, 0x13, 0x13, 0xA2, 0x84, 0x65, 0x55, 0x55,
+  0x55, 0x95, 0x95, 0x95, 0x94, 0xA1, 0x10, 0x0F, 0x9F, 0xF6, 0xF9, 0x12,
+  0x95, 0x95, 0x95, 0x95, 0x85, 0x55, 0x55, 0x55, 0x64, 0x91, 0xA0, 0x15,
+  0x38, 0x12, 0x45, 0x52, 0x72, 0x63, 0x44, 0x44, 0x52, 0x71, 0xF1, 0x36,
+  0x36, 0x34, 0x34, 0x67, 0x33, 0x33, 0x22, 0x52, 0x12, 0x62, 0x12, 0x44,
+  0x12, 0x26, 0x12, 0x13, 0x22, 0x12, 0x12, 0x32, 0x12, 0x12, 0x32, 0x12,
+  0x13, 0x22, 0x12, 0x29, 0x38, 0x92, 0xA2, 0x93, 0x33, 0x38, 0x45, 0x30,
+  0x27, 0x88, 0xA5, 0x93, 0x12, 0x93, 0x13, 0x82, 0x32, 0x73, 0x32, 0x73,
+  0x33, 0x69, 0x5B, 0x42, 0x72, 0x42, 0x72, 0x26, 0x3C, 0x36, 0x0A, 0x3B,
+  0x42, 0x53, 0x32, 0x62, 0x32, 0x62, 0x32, 0x53, 0x39, 0x4A, 0x32, 0x63,
+  0x22, 0x72, 0x22, 0x72, 0x22, 0x6F, 0x01, 0xB2, 0x48, 0x2A, 0x13, 0x53,
+  0x12, 0x74, 0x84, 0xA2, 0xA2, 0xA2, 0xA2, 0xB2, 0x72, 0x13, 0x53, 0x2A,
+  0x46, 0x20, 0x08, 0x4A, 0x32, 0x53, 0x22, 0x62, 0x22, 0x72, 0x12, 0x72,
+  0x12, 0x72, 0x12, 0x72, 0x12, 0x72, 0x12, 0x72, 0x12, 0x63, 0x12, 0x53,
+  0x1A, 0x29, 0x30, 0x0C, 0x1C, 0x32, 0x62, 0x32, 0x62, 0x32, 0x32, 0x12,
+  0x32, 0x32, 0x67, 0x67, 0x62, 0x32, 0x62, 0x32, 0x22, 0x22, 0x72, 0x22,
+  0x7F, 0xD0, 0x0F, 0xB2, 0x27, 0x22, 0x27, 0x22, 0x23, 0x22, 0x22, 0x23,
+  0x26, 0x76, 0x76, 0x23, 0x26, 0x23, 0x26, 0x2B, 0x29, 0x85, 0x85, 0x48,
+  0x3A, 0x23, 0x53, 0x22, 0x72, 0x12, 0x82, 0x12, 0xB2, 0xB2, 0x49, 0x49,
+  0x82, 0x13, 0x72, 0x23, 0x53, 0x3A, 0x56, 0x30, 0x15, 0x25, 0x25, 0x25,
+  0x32, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x4A, 0x4A, 0x42, 0x62,
+  0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x26, 0x2C, 0x26, 0x0F, 0x54, 0x28,
+  0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x24, 0xF5, 0x49, 0x49,
+  0x82, 0xB2, 0xB2, 0xB2, 0xB2, 0x32, 0x62, 0x32, 0x62, 0x32, 0x62, 0x32,
+  0x62, 0x33, 0x42, 0x49, 0x65, 0x60, 0x06, 0x25, 0x16, 0x25, 0x32, 0x43,
+  0x52, 0x33, 0x62, 0x23, 0x76, 0x86, 0x87, 0x73, 0x23, 0x62, 0x42, 0x62,
+  0x43, 0x52, 0x52, 0x36, 0x3B, 0x44, 0x08, 0x48, 0x72, 0xA2, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xA2, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x5F, 0xB0, 0x04,
+  0x68, 0x64, 0x14, 0x44, 0x24, 0x44, 0x25, 0x25, 0x22, 0x12, 0x25, 0x22,
+  0x16, 0x12, 0x22, 0x25, 0x12, 0x22, 0x24, 0x22, 0x22, 0x33, 0x22, 0x22,
+  0x32, 0x32, 0x22, 0x82, 0x16, 0x2C, 0x26, 0x04, 0x3B, 0x26, 0x24, 0x42,
+  0x34, 0x42, 0x35, 0x32, 0x32, 0x12, 0x32, 0x32, 0x13, 0x22, 0x32, 0x23,
+  0x12, 0x32, 0x32, 0x12, 0x32, 0x35, 0x32, 0x44, 0x32, 0x44, 0x26, 0x23,
+  0x26, 0x32, 0x10, 0x44, 0x68, 0x33, 0x43, 0x22, 0x62, 0x13, 0x65, 0x84,
+  0x84, 0x84, 0x85, 0x63, 0x12, 0x62, 0x23, 0x43, 0x38, 0x64, 0x40, 0x09,
+  0x3B, 0x32, 0x53, 0x22, 0x62, 0x22, 0x62, 0x22, 0x62, 0x22, 0x53, 0x29,
+  0x37, 0x52, 0xA2, 0xA2, 0x88, 0x48, 0x40, 0x44, 0x68, 0x33, 0x43, 0x22,
+  0x62, 0x13, 0x65, 0x84, 0x84, 0x84, 0x85, 0x63, 0x12, 0x62, 0x23, 0x43,
+  0x38, 0x55, 0x72, 0x52, 0x2A, 0x29, 0x10, 0x09, 0x5B, 0x52, 0x53, 0x42,
+  0x62, 0x42, 0x62, 0x42, 0x53, 0x49, 0x58, 0x62, 0x34, 0x52, 0x43, 0x52,
+  0x53, 0x42, 0x62, 0x27, 0x3B, 0x43, 0x28, 0x1C, 0x45, 0x64, 0x65, 0x86,
+  0x66, 0x85, 0x64, 0x65, 0x4C, 0x18, 0x20, 0x0F, 0xB3, 0x23, 0x43, 0x23,
+  0x43, 0x23, 0x43, 0x23, 0x25, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x27, 0x84,
+  0x82, 0x0F, 0x91, 0x26, 0x22, 0x26, 0x22, 0x26, 0x22, 0x26, 0x22, 0x26,
+  0x22, 0x26, 0x22, 0x26, 0x22, 0x26, 0x22, 0x26, 0x23, 0x32, 0x35, 0x76,
+  0x44, 0x06, 0x4C, 0x46, 0x22, 0x82, 0x43, 0x63, 0x52, 0x62, 0x63, 0x43,
+  0x63, 0x43, 0x73, 0x23, 0x83, 0x23, 0x84, 0x12, 0xA6, 0xA6, 0xB4, 0xC4,
+  0x60, 0x06, 0x2C, 0x26, 0x12, 0x83, 0x13, 0x22, 0x32, 0x23, 0x14, 0x22,
+  0x23, 0x14, 0x22, 0x23, 0x14, 0x22, 0x32, 0x18, 0x3B, 0x34, 0x25, 0x34,
+  0x25, 0x34, 0x24, 0x43, 0x43, 0x43, 0x43, 0x20, 0x05, 0x35, 0x15, 0x35,
+  0x33, 0x42, 0x54, 0x23, 0x67, 0x85, 0xA3, 0xA5, 0x95, 0x83, 0x13, 0x63,
+  0x33, 0x44, 0x43, 0x26, 0x2C, 0x26, 0x05, 0x2A, 0x25, 0x22, 0x42, 0x43,
+  0x23, 0x52, 0x22, 0x66, 0x74, 0x92, 0xA2, 0xA2, 0xA2, 0xA2, 0x78, 0x48,
+  0x20, 0x09, 0x19, 0x12, 0x43, 0x12, 0x42, 0x22, 0x32, 0x32, 0x23, 0x72,
+  0x72, 0x73, 0x32, 0x22, 0x42, 0x12, 0x54, 0x6F, 0x70, 0x0C, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x3A, 0x11, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83,
+  0x82, 0x83, 0x82, 0x83, 0x73, 0x83, 0x73, 0x82, 0x91, 0x0A, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x3C, 0x51, 0x82, 0x74, 0x56, 0x34, 0x13, 0x23, 0x36, 0x45, 0x62, 0x0F,
+  0xD0, 0x02, 0x23, 0x23, 0x22, 0x26, 0x58, 0xB2, 0xA2, 0x57, 0x39, 0x32,
+  0x52, 0x22, 0x62, 0x22, 0x53, 0x2C, 0x2A, 0x04, 0x94, 0xB2, 0xB2, 0xB2,
+  0x15, 0x5A, 0x34, 0x33, 0x33, 0x53, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72,
+  0x22, 0x63, 0x24, 0x33, 0x1C, 0x14, 0x15, 0x30, 0x36, 0x12, 0x2A, 0x13,
+  0x47, 0x65, 0x84, 0xA2, 0xA2, 0xB3, 0x53, 0x1B, 0x37, 0x20, 0x74, 0x94,
+  0xB2, 0xB2, 0x55, 0x12, 0x3A, 0x33, 0x34, 0x23, 0x53, 0x22, 0x72, 0x22,
+  0x72, 0x22, 0x72, 0x22, 0x63, 0x33, 0x34, 0x3C, 0x35, 0x14, 0x36, 0x58,
+  0x33, 0x43, 0x13, 0x6F, 0xF0, 0x93, 0xA3, 0x53, 0x2A, 0x37, 0x20, 0x55,
+  0x48, 0x32, 0x92, 0x6A, 0x1A, 0x42, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+  0x6A, 0x1A, 0x10, 0x35, 0x14, 0x2B, 0x13, 0x34, 0x22, 0x63, 0x22, 0x72,
+  0x22, 0x72, 0x22, 0x72, 0x23, 0x53, 0x33, 0x34, 0x49, 0x55, 0x12, 0xB2,
+  0xB2, 0xA3, 0x57, 0x66, 0x40, 0x04, 0xA4, 0xC2, 0xC2, 0xC2, 0x15, 0x69,
+  0x54, 0x33, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62,
+  0x42, 0x62, 0x26, 0x2C, 0x26, 0x52, 0x92, 0xF1, 0x65, 0x69, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x24, 0xF7, 0x52, 0x62, 0x9F, 0x16, 0x26, 0x26,
+  0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0xA1, 0x62, 0x04,
+  0x94, 0xB2, 0xB2, 0xB2, 0x26, 0x32, 0x26, 0x32, 0x14, 0x66, 0x75, 0x85,
+  0x86, 0x72, 0x14, 0x62, 0x33, 0x34, 0x3A, 0x36, 0x16, 0x56, 0x92, 0x92,
+  0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x4F, 0x70, 0x07,
+  0x14, 0x3D, 0x33, 0x23, 0x22, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x25,
+  0x14, 0x19, 0x14, 0x14, 0x13, 0x15, 0x5A, 0x54, 0x33, 0x42, 0x62, 0x42,
+  0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x26, 0x3B, 0x35,
+  0x36, 0x58, 0x33, 0x43, 0x13, 0x65, 0x84, 0x84, 0x85, 0x63, 0x13, 0x43,
+  0x38, 0x56, 0x30, 0x04, 0x16, 0x3C, 0x44, 0x43, 0x33, 0x63, 0x22, 0x82,
+  0x22, 0x82, 0x22, 0x82, 0x23, 0x63, 0x24, 0x43, 0x3A, 0x42, 0x16, 0x52,
+  0xC2, 0xC2, 0xA7, 0x77, 0x70, 0x36, 0x14, 0x2C, 0x13, 0x44, 0x23, 0x63,
+  0x22, 0x82, 0x22, 0x82, 0x22, 0x82, 0x23, 0x63, 0x33, 0x44, 0x4A, 0x56,
+  0x12, 0xC2, 0xC2, 0xC2, 0x97, 0x77, 0x14, 0x24, 0x2B, 0x35, 0x22, 0x33,
+  0x92, 0xA2, 0xA2, 0xA2, 0xA2, 0x7A, 0x2A, 0x20, 0x27, 0x2C, 0x46, 0x51,
+  0x17, 0x48, 0x58, 0x65, 0x5F, 0x52, 0x22, 0x92, 0x92, 0x7A, 0x1A, 0x32,
+  0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x43, 0x38, 0x45, 0x20, 0x04, 0x35,
+  0x14, 0x35, 0x32, 0x62, 0x32, 0x62, 0x32, 0x62, 0x32, 0x62, 0x32, 0x62,
+  0x32, 0x62, 0x33, 0x34, 0x4A, 0x45, 0x13, 0x06, 0x2C, 0x26, 0x23, 0x43,
+  0x43, 0x43, 0x53, 0x32, 0x63, 0x23, 0x73, 0x12, 0x86, 0x94, 0xA4, 0xA4,
+  0x50, 0x05, 0x4A, 0x45, 0x13, 0x23, 0x22, 0x32, 0x23, 0x22, 0x32, 0x14,
+  0x12, 0x4A, 0x4A, 0x54, 0x14, 0x53, 0x24, 0x53, 0x23, 0x62, 0x42, 0x30,
+  0x15, 0x25, 0x25, 0x25, 0x34, 0x24, 0x58, 0x76, 0x94, 0x96, 0x73, 0x23,
+  0x53, 0x43, 0x26, 0x2C, 0x26, 0x05, 0x2A, 0x25, 0x13, 0x43, 0x32, 0x42,
+  0x43, 0x23, 0x52, 0x22, 0x62, 0x22, 0x66, 0x74, 0x84, 0x92, 0xA2, 0x93,
+  0x92, 0x68, 0x48, 0x40, 0x19, 0x29, 0x22, 0x33, 0x32, 0x23, 0x83, 0x73,
+  0x73, 0x73, 0x32, 0x23, 0x4F, 0xA0, 0x43, 0x34, 0x32, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x43, 0x24, 0x34, 0x62, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54,
+  0x43, 0x0F, 0xF6, 0x20, 0x03, 0x43, 0x62, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x64, 0x34, 0x22, 0x52, 0x52, 0x52, 0x52, 0x52, 0x34, 0x33, 0x40,
+  0x24, 0x42, 0x16, 0x23, 0x12, 0x26, 0x22, 0x43, 0x20 };
+
+const GFXglyph FreeMonoBold12pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,  14,    0,    1 },   // 0x20 ' '
+  {     0,   4,  15,  14,    5,  -14 },   // 0x21 '!'
+  {     9,   8,   7,  14,    3,  -13 },   // 0x22 '"'
+  {    23,  11,  18,  14,    2,  -15 },   // 0x23 '#'
+  {    55,  10,  20,  14,    2,  -16 },   // 0x24 '$'
+  {    77,  10,  15,  14,    2,  -14 },   // 0x25 '%'
+  {   101,  10,  13,  14,    2,  -12 },   // 0x26 '&'
+  {   120,   3,   7,  14,    5,  -13 },   // 0x27 '''
+  {   127,   5,  19,  14,    6,  -14 },   // 0x28 '('
+  {   147,   5,  19,  14,    3,  -14 },   // 0x29 ')'
+  {   167,  10,  10,  14,    2,  -14 },   // 0x2A '*'
+  {   181,  12,  13,  14,    1,  -12 },   // 0x2B '+'
+  {   194,   5,   7,  14,    4,   -2 },   // 0x2C ','
+  {   202,  12,   2,  14,    1,   -7 },   // 0x2D '-'
+  {   204,   3,   3,  14,    5,   -2 },   // 0x2E '.'
+  {   205,  10,  20,  14,    2,  -16 },   // 0x2F '/'
+  {   226,  10,  15,  14,    2,  -14 },   // 0x30 '0'
+  {   245,  10,  15,  14,    2,  -14 },   // 0x31 '1'
+  {   261,  10,  15,  14,    2,  -14 },   // 0x32 '2'
+  {   277,  11,  15,  14,    1,  -14 },   // 0x33 '3'
+  {   293,   9,  14,  14,    2,  -13 },   // 0x34 '4'
+  {   312,  10,  15,  14,    2,  -14 },   // 0x35 '5'
+  {   329,  10,  15,  14,    2,  -14 },   // 0x36 '6'
+  {   348,  10,  15,  14,    2,  -14 },   // 0x37 '7'
+  {   363,  10,  15,  14,    2,  -14 },   // 0x38 '8'
+  {   382,  10,  15,  14,    3,  -14 },   // 0x39 '9'
+  {   401,   3,  11,  14,    5,  -10 },   // 0x3A ':'
+  {   404,   4,  15,  14,    4,  -10 },   // 0x3B ';'
+  {   415,  12,  11,  14,    1,  -11 },   // 0x3C '<'
+  {   427,  12,   7,  14,    1,   -9 },   // 0x3D '='
+  {   431,  12,  11,  14,    1,  -11 },   // 0x3E '>'
+  {   443,   9,  14,  14,    3,  -13 },   // 0x3F '?'
+  {   458,  11,  19,  14,    2,  -14 },   // 0x40 '@'
+  {   492,  15,  14,  14,   -1,  -13 },   // 0x41 'A'
+  {   514,  13,  14,  14,    0,  -13 },   // 0x42 'B'
+  {   536,  12,  14,  14,    1,  -13 },   // 0x43 'C'
+  {   554,  12,  14,  14,    1,  -13 },   // 0x44 'D'
+  {   579,  13,  14,  14,    0,  -13 },   // 0x45 'E'
+  {   602,  13,  14,  14,    0,  -13 },   // 0x46 'F'
+  {   623,  13,  14,  14,    1,  -13 },   // 0x47 'G'
+  {   644,  14,  14,  14,    0,  -13 },   // 0x48 'H'
+  {   669,  10,  14,  14,    2,  -13 },   // 0x49 'I'
+  {   682,  13,  14,  14,    1,  -13 },   // 0x4A 'J'
+  {   702,  14,  14,  14,    0,  -13 },   // 0x4B 'K'
+  {   726,  12,  14,  14,    1,  -13 },   // 0x4C 'L'
+  {   743,  14,  14,  14,    0,  -13 },   // 0x4D 'M'
+  {   775,  13,  14,  14,    0,  -13 },   // 0x4E 'N'
+  {   807,  12,  14,  14,    1,  -13 },   // 0x4F 'O'
+  {   827,  12,  14,  14,    0,  -13 },   // 0x50 'P'
+  {   847,  12,  17,  14,    1,  -13 },   // 0x51 'Q'
+  {   871,  14,  14,  14,    0,  -13 },   // 0x52 'R'
+  {   894,  10,  14,  14,    2,  -13 },   // 0x53 'S'
+  {   907,  12,  14,  14,    1,  -13 },   // 0x54 'T'
+  {   925,  12,  14,  14,    1,  -13 },   // 0x55 'U'
+  {   949,  16,  14,  14,   -1,  -13 },   // 0x56 'V'
+  {   973,  14,  14,  14,    0,  -13 },   // 0x57 'W'
+  {  1004,  14,  14,  14,    0,  -13 },   // 0x58 'X'
+  {  1026,  12,  14,  14,    1,  -13 },   // 0x59 'Y'
+  {  1045,  10,  14,  14,    2,  -13 },   // 0x5A 'Z'
+  {  1065,   5,  19,  14,    6,  -14 },   // 0x5B '['
+  {  1081,  10,  20,  14,    2,  -16 },   // 0x5C '\'
+  {  1101,   5,  19,  14,    3,  -14 },   // 0x5D ']'
+  {  1117,  10,   8,  14,    2,  -15 },   // 0x5E '^'
+  {  1127,  14,   2,  14,    0,    4 },   // 0x5F '_'
+  {  1129,   4,   4,  14,    4,  -15 },   // 0x60 '`'
+  {  1133,  12,  11,  14,    1,  -10 },   // 0x61 'a'
+  {  1147,  13,  15,  14,    0,  -14 },   // 0x62 'b'
+  {  1172,  12,  11,  14,    1,  -10 },   // 0x63 'c'
+  {  1186,  13,  15,  14,    1,  -14 },   // 0x64 'd'
+  {  1210,  12,  11,  14,    1,  -10 },   // 0x65 'e'
+  {  1223,  11,  15,  14,    2,  -14 },   // 0x66 'f'
+  {  1239,  13,  16,  14,    1,  -10 },   // 0x67 'g'
+  {  1265,  14,  15,  14,    0,  -14 },   // 0x68 'h'
+  {  1289,  11,  14,  14,    1,  -13 },   // 0x69 'i'
+  {  1302,   8,  19,  15,    3,  -13 },   // 0x6A 'j'
+  {  1319,  13,  15,  14,    1,  -14 },   // 0x6B 'k'
+  {  1340,  11,  15,  14,    1,  -14 },   // 0x6C 'l'
+  {  1355,  15,  11,  14,    0,  -10 },   // 0x6D 'm'
+  {  1384,  14,  11,  14,    0,  -10 },   // 0x6E 'n'
+  {  1404,  12,  11,  14,    1,  -10 },   // 0x6F 'o'
+  {  1419,  14,  16,  14,    0,  -10 },   // 0x70 'p'
+  {  1445,  14,  16,  14,    0,  -10 },   // 0x71 'q'
+  {  1470,  12,  11,  14,    1,  -10 },   // 0x72 'r'
+  {  1484,  10,  11,  14,    2,  -10 },   // 0x73 's'
+  {  1494,  11,  14,  14,    1,  -13 },   // 0x74 't'
+  {  1510,  13,  11,  14,    0,  -10 },   // 0x75 'u'
+  {  1531,  14,  11,  14,    0,  -10 },   // 0x76 'v'
+  {  1549,  14,  11,  14,    0,  -10 },   // 0x77 'w'
+  {  1572,  14,  11,  14,    0,  -10 },   // 0x78 'x'
+  {  1589,  12,  16,  14,    1,  -10 },   // 0x79 'y'
+  {  1612,  11,  11,  14,    1,  -10 },   // 0x7A 'z'
+  {  1626,   7,  19,  14,    3,  -14 },   // 0x7B '{'
+  {  1645,   2,  19,  14,    6,  -14 },   // 0x7C '|'
+  {  1648,   7,  19,  14,    4,  -14 },   // 0x7D '}'
+  {  1668,  12,   4,  14,    1,   -7 } }; // 0x7E '~'
+
+const GFXfontPacked FreeMonoBold12pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeMonoBold12pt7bPackedRuns,
+    (GFXglyph *)FreeMonoBold12pt7bPackedGlyphs,
+    0x20, 0x7E, 24 } };
+
+// Approx. 2349 bytes
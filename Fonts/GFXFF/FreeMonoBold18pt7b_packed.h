@@ -0,0 +1,324 @@
+// FreeMonoBold18pt7b as run lengths, generated by Tools/GFX_pack from FreeMonoBold18pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeMonoBold18pt7bPackedRuns[] PROGMEM = {
+  0x13, 0x1F, 0xFA, 0x13, 0x23, 0x23, 0x23, 0x23, 0x23, 0x31, 0x83, 0x1F,
+  0x01, 0x31, 0x04, 0x38, 0x38, 0x38, 0x38, 0x34, 0x12, 0x52, 0x22, 0x52,
+  0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x10, 0x43, 0x43, 0x64, 0x24, 0x55,
+  0x24, 0x54, 0x34, 0x54, 0x34, 0x54, 0x24, 0x64, 0x24, 0x3F, 0x01, 0xFF,
+  0xF2, 0x44, 0x24, 0x64, 0x24, 0x64, 0x24, 0x4E, 0x2E, 0x2E, 0x2E, 0x34,
+  0x34, 0x54, 0x34, 0x54, 0x34, 0x54, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64,
+  0x24, 0x40, 0x62, 0xB4, 0xA4, 0xA4, 0x89, 0x3C, 0x2C, 0x15, 0x44, 0x14,
+  0x63, 0x14, 0x62, 0x27, 0x7B, 0x4B, 0x5A, 0x89, 0x87, 0x77, 0x79, 0x4F,
+  0x31, 0xC2, 0x21, 0x88, 0x4A, 0x4A, 0x4A, 0x4A, 0x4B, 0x26, 0x34, 0x98,
+  0x63, 0x42, 0x62, 0x62, 0x52, 0x62, 0x52, 0x62, 0x53, 0x43, 0x68, 0x41,
+  0x44, 0x35, 0x77, 0x57, 0x57, 0x75, 0x34, 0x32, 0x47, 0x73, 0x33, 0x62,
+  0x52, 0x62, 0x52, 0x62, 0x52, 0x63, 0x33, 0x77, 0xA4, 0x30, 0x64, 0x11,
+  0x79, 0x5A, 0x4B, 0x45, 0x22, 0x64, 0xB4, 0xC4, 0xB5, 0xA5, 0x97, 0x79,
+  0x19, 0x14, 0x18, 0x3C, 0x46, 0x15, 0x35, 0x2F, 0x01, 0xE2, 0xD4, 0x61,
+  0x40, 0x0F, 0x51, 0x22, 0x22, 0x22, 0x22, 0x21, 0x53, 0x44, 0x35, 0x34,
+  0x35, 0x34, 0x34, 0x44, 0x44, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x54, 0x44, 0x44, 0x54, 0x44, 0x54, 0x45, 0x44, 0x53, 0x03,
+  0x54, 0x45, 0x44, 0x45, 0x44, 0x45, 0x44, 0x44, 0x44, 0x54, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x43, 0x44, 0x44, 0x44, 0x34, 0x44, 0x34, 0x35,
+  0x34, 0x43, 0x50, 0x72, 0xD4, 0xC4, 0xC4, 0xC4, 0x6F, 0xF2, 0x1E, 0x4A,
+  0x86, 0x98, 0x7A, 0x64, 0x24, 0x63, 0x43, 0x62, 0x62, 0x30, 0x73, 0xC4,
+  0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x6F, 0xFF, 0xF4, 0x64, 0xC4, 0xC4, 0xC4,
+  0xC4, 0xC4, 0xC4, 0xD2, 0x70, 0x25, 0x24, 0x34, 0x24, 0x34, 0x33, 0x43,
+  0x33, 0x43, 0x42, 0x50, 0x1F, 0x21, 0xF3, 0x2F, 0x22, 0xF2, 0x10, 0x13,
+  0x1F, 0x01, 0x31, 0xC3, 0xB4, 0xB4, 0xA4, 0xB4, 0xB3, 0xB4, 0xB3, 0xB4,
+  0xB3, 0xB4, 0xB4, 0xA4, 0xB4, 0xA4, 0xB4, 0xA4, 0xB4, 0xA4, 0xB4, 0xA4,
+  0xB4, 0xA4, 0xB4, 0xB3, 0xB4, 0xB3, 0xD2, 0xC0, 0x56, 0x8A, 0x5C, 0x4C,
+  0x35, 0x45, 0x24, 0x64, 0x15, 0x69, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x89, 0x65, 0x14, 0x64, 0x25, 0x45, 0x3C, 0x4C, 0x5A, 0x86,
+  0x50, 0x55, 0x96, 0x78, 0x69, 0x55, 0x14, 0x62, 0x34, 0xB4, 0xB4, 0xB4,
+  0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x6E, 0x1E, 0x1E,
+  0x2C, 0x10, 0x46, 0x7A, 0x4C, 0x3D, 0x15, 0x45, 0x14, 0x68, 0x84, 0xB4,
+  0xB4, 0xA5, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x95, 0x6F,
+  0xFF, 0xF4, 0x46, 0x7B, 0x4D, 0x3E, 0x33, 0x65, 0xC4, 0xC4, 0xC4, 0xB4,
+  0x88, 0x86, 0xA6, 0xA8, 0xC5, 0xC5, 0xC4, 0xC4, 0xC7, 0x7F, 0x61, 0xE3,
+  0xC6, 0x85, 0x85, 0x96, 0x96, 0x87, 0x73, 0x14, 0x73, 0x14, 0x63, 0x24,
+  0x54, 0x24, 0x53, 0x34, 0x43, 0x44, 0x34, 0x44, 0x33, 0x54, 0x2F, 0xFF,
+  0xEA, 0x48, 0x96, 0x96, 0x97, 0x71, 0x2C, 0x5C, 0x5C, 0x5C, 0x54, 0xD4,
+  0xD4, 0xD4, 0x15, 0x7C, 0x5D, 0x4E, 0x43, 0x55, 0xD5, 0xD4, 0xD4, 0xD4,
+  0xC5, 0x13, 0x75, 0x1F, 0x12, 0xE4, 0xC7, 0x85, 0x86, 0x79, 0x4B, 0x3C,
+  0x36, 0x85, 0x95, 0xA4, 0xA4, 0xB4, 0x25, 0x44, 0x17, 0x33, 0x19, 0x2E,
+  0x16, 0x3A, 0x77, 0x88, 0x78, 0x74, 0x14, 0x55, 0x1D, 0x3C, 0x4A, 0x76,
+  0x40, 0x0F, 0xFF, 0xF3, 0x84, 0xB3, 0xB4, 0xB4, 0xB3, 0xB4, 0xB4, 0xA4,
+  0xB4, 0xB4, 0xA4, 0xB4, 0xB4, 0xA4, 0xB4, 0xB4, 0xB3, 0xC3, 0x60, 0x55,
+  0x89, 0x5B, 0x3D, 0x15, 0x59, 0x78, 0x78, 0x78, 0x74, 0x14, 0x54, 0x3B,
+  0x59, 0x69, 0x4D, 0x24, 0x54, 0x14, 0x78, 0x78, 0x79, 0x55, 0x1D, 0x2D,
+  0x3B, 0x67, 0x40, 0x46, 0x89, 0x5B, 0x3D, 0x16, 0x44, 0x15, 0x63, 0x14,
+  0x78, 0x78, 0x79, 0x64, 0x15, 0x36, 0x1E, 0x29, 0x13, 0x37, 0x14, 0x45,
+  0x24, 0xA4, 0xA5, 0x95, 0x96, 0x2C, 0x3B, 0x49, 0x76, 0x80, 0x13, 0x1F,
+  0x01, 0x3F, 0xF2, 0x31, 0xF0, 0x13, 0x10, 0x33, 0x35, 0x25, 0x25, 0x33,
+  0xFF, 0xF1, 0x42, 0x43, 0x43, 0x33, 0x43, 0x34, 0x34, 0x24, 0x34, 0x2C,
+  0xF1, 0x1F, 0x04, 0xC6, 0xA7, 0x97, 0x97, 0x97, 0x97, 0xA7, 0xD7, 0xD7,
+  0xD7, 0xD7, 0xD7, 0xD5, 0xF0, 0x30, 0x1F, 0x21, 0xF3, 0x2F, 0x22, 0xF2,
+  0xFF, 0xAF, 0x21, 0xF3, 0x2F, 0x22, 0xF2, 0x10, 0xF3, 0x4E, 0x6D, 0x7D,
+  0x7D, 0x7D, 0x7D, 0x7C, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7B, 0x5D, 0x3F,
+  0x00, 0x37, 0x6B, 0x3E, 0x1E, 0x14, 0x5A, 0x74, 0x13, 0x74, 0xB4, 0x95,
+  0x87, 0x67, 0x94, 0xB2, 0xD2, 0xFF, 0xC3, 0xB5, 0xA5, 0xA5, 0xB3, 0x70,
+  0x56, 0x88, 0x6A, 0x44, 0x43, 0x34, 0x54, 0x23, 0x73, 0x14, 0x73, 0x13,
+  0x83, 0x13, 0x65, 0x13, 0x47, 0x13, 0x38, 0x13, 0x24, 0x23, 0x13, 0x23,
+  0x33, 0x13, 0x23, 0x33, 0x13, 0x23, 0x33, 0x13, 0x24, 0x23, 0x13, 0x3C,
+  0x4B, 0x5A, 0xD3, 0xC3, 0xC4, 0x71, 0x44, 0x44, 0x3C, 0x59, 0x76, 0x40,
+  0x49, 0xCB, 0xBB, 0xCA, 0xF0, 0x8E, 0x8E, 0x32, 0x4C, 0x42, 0x4C, 0x42,
+  0x4B, 0x44, 0x4A, 0x44, 0x49, 0x46, 0x48, 0xE8, 0xE7, 0xF1, 0x6F, 0x15,
+  0x4A, 0x42, 0x85, 0x81, 0x94, 0xF3, 0x49, 0x17, 0x67, 0x10, 0x1D, 0x6F,
+  0x14, 0xF2, 0x3F, 0x25, 0x47, 0x54, 0x48, 0x44, 0x48, 0x44, 0x47, 0x54,
+  0xF0, 0x5E, 0x6F, 0x05, 0xF2, 0x34, 0x85, 0x34, 0x95, 0x24, 0xA4, 0x24,
+  0xA4, 0x24, 0x9F, 0x91, 0xF4, 0x1F, 0x33, 0xF0, 0x40, 0x76, 0x32, 0x5F,
+  0x03, 0xF1, 0x2F, 0x21, 0x66, 0x61, 0x58, 0xAA, 0x8B, 0x31, 0x4F, 0x04,
+  0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x5F, 0x05, 0xA3, 0x17, 0x65,
+  0x2F, 0x23, 0xF0, 0x6C, 0x98, 0x40, 0x0C, 0x6E, 0x4F, 0x03, 0xF1, 0x34,
+  0x66, 0x24, 0x75, 0x24, 0x84, 0x24, 0x94, 0x14, 0x94, 0x14, 0x94, 0x14,
+  0x94, 0x14, 0x94, 0x14, 0x94, 0x14, 0x94, 0x14, 0x85, 0x14, 0x84, 0x24,
+  0x66, 0x1F, 0x12, 0xF1, 0x2E, 0x5B, 0x60, 0x1F, 0x21, 0xF3, 0x1F, 0x31,
+  0xF3, 0x34, 0x84, 0x34, 0x84, 0x34, 0x33, 0x24, 0x34, 0x34, 0x22, 0x4B,
+  0x8B, 0x8B, 0x8B, 0x84, 0x34, 0x84, 0x34, 0x32, 0x34, 0x42, 0x34, 0x24,
+  0x94, 0x24, 0x9F, 0xFF, 0xF1, 0x1F, 0x30, 0x1F, 0xFF, 0xFF, 0x02, 0x49,
+  0x42, 0x44, 0x23, 0x42, 0x43, 0x42, 0x42, 0x43, 0x43, 0x23, 0xB8, 0xB8,
+  0xB8, 0xB8, 0x43, 0x48, 0x43, 0x39, 0x4F, 0x04, 0xF0, 0x4D, 0xB8, 0xB8,
+  0xB9, 0x99, 0x77, 0x23, 0x6E, 0x4F, 0x13, 0xF2, 0x27, 0x65, 0x25, 0x94,
+  0x15, 0xB3, 0x14, 0xF1, 0x4F, 0x14, 0xF1, 0x4F, 0x14, 0x69, 0x14, 0x6E,
+  0x6F, 0x05, 0xA1, 0x4A, 0x42, 0x68, 0x43, 0xF2, 0x4F, 0x15, 0xDA, 0x85,
+  0x17, 0x47, 0x38, 0x38, 0x28, 0x38, 0x37, 0x37, 0x54, 0x74, 0x64, 0x74,
+  0x64, 0x74, 0x64, 0x74, 0x64, 0x74, 0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0,
+  0x64, 0x74, 0x64, 0x74, 0x64, 0x74, 0x64, 0x74, 0x48, 0x38, 0x19, 0x3F,
+  0x33, 0x91, 0x75, 0x71, 0x0F, 0xFF, 0xB5, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A,
+  0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x45, 0xFF, 0xC1, 0xC1, 0x7C,
+  0x7C, 0x7C, 0x7C, 0xC4, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F,
+  0x04, 0x43, 0x84, 0x34, 0x84, 0x34, 0x84, 0x34, 0x84, 0x34, 0x75, 0x35,
+  0x56, 0x3F, 0x04, 0xE7, 0xBB, 0x68, 0x08, 0x46, 0x29, 0x28, 0x19, 0x28,
+  0x19, 0x36, 0x44, 0x55, 0x64, 0x45, 0x74, 0x35, 0x84, 0x25, 0x94, 0x15,
+  0xA9, 0xBB, 0x9B, 0x95, 0x25, 0x84, 0x45, 0x74, 0x54, 0x74, 0x64, 0x64,
+  0x64, 0x49, 0x46, 0x19, 0x4F, 0x14, 0x71, 0x76, 0x51, 0x0A, 0x8A, 0x8A,
+  0x8A, 0xB4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x82, 0x44,
+  0x74, 0x34, 0x74, 0x34, 0x74, 0x34, 0x7F, 0xFF, 0xD1, 0xF2, 0x25, 0x95,
+  0x36, 0x96, 0x27, 0x77, 0x27, 0x77, 0x37, 0x57, 0x47, 0x57, 0x48, 0x38,
+  0x48, 0x38, 0x44, 0x14, 0x23, 0x14, 0x44, 0x14, 0x14, 0x14, 0x44, 0x14,
+  0x14, 0x14, 0x44, 0x27, 0x24, 0x44, 0x27, 0x24, 0x44, 0x35, 0x34, 0x44,
+  0x35, 0x34, 0x44, 0x44, 0x34, 0x44, 0xB4, 0x29, 0x5F, 0x35, 0xF3, 0x59,
+  0x17, 0x77, 0x10, 0x06, 0x58, 0x17, 0x4F, 0x14, 0xF2, 0x39, 0x27, 0x54,
+  0x47, 0x54, 0x48, 0x44, 0x48, 0x44, 0x44, 0x14, 0x34, 0x44, 0x14, 0x34,
+  0x44, 0x24, 0x24, 0x44, 0x34, 0x14, 0x44, 0x34, 0x14, 0x44, 0x48, 0x44,
+  0x48, 0x44, 0x57, 0x44, 0x57, 0x29, 0x36, 0x29, 0x45, 0x29, 0x45, 0x37,
+  0x64, 0x20, 0x76, 0xCA, 0x9D, 0x6F, 0x04, 0x64, 0x63, 0x58, 0x52, 0x4A,
+  0x41, 0x5A, 0x9C, 0x8C, 0x8C, 0x8C, 0x8C, 0x9A, 0x51, 0x4A, 0x42, 0x58,
+  0x53, 0x64, 0x65, 0xE6, 0xD9, 0xAC, 0x67, 0x1C, 0x5F, 0x03, 0xF1, 0x2F,
+  0x23, 0x46, 0x62, 0x48, 0x42, 0x48, 0x42, 0x48, 0x42, 0x48, 0x42, 0x46,
+  0x62, 0xF0, 0x3E, 0x4D, 0x5B, 0x74, 0xE4, 0xE4, 0xCB, 0x7B, 0x7B, 0x89,
+  0x80, 0x76, 0xCA, 0x9C, 0x7E, 0x56, 0x46, 0x35, 0x85, 0x24, 0xA4, 0x15,
+  0xA9, 0xC8, 0xC8, 0xC8, 0xC8, 0xC9, 0xA5, 0x14, 0xA4, 0x25, 0x85, 0x36,
+  0x46, 0x5E, 0x7C, 0x9A, 0xB7, 0xD7, 0x33, 0x6F, 0x04, 0xF1, 0x4F, 0x06,
+  0x26, 0x43, 0x1C, 0x8F, 0x06, 0xF2, 0x5F, 0x17, 0x46, 0x56, 0x47, 0x46,
+  0x47, 0x46, 0x47, 0x46, 0x45, 0x66, 0xE7, 0xD8, 0xBA, 0xC9, 0x44, 0x58,
+  0x45, 0x48, 0x46, 0x47, 0x46, 0x54, 0x94, 0x61, 0xA5, 0xF1, 0x56, 0x18,
+  0x74, 0x10, 0x56, 0x23, 0x5C, 0x3E, 0x3E, 0x25, 0x55, 0x24, 0x74, 0x24,
+  0x74, 0x25, 0xC8, 0xAB, 0x7C, 0x6C, 0x99, 0x12, 0x99, 0x98, 0x9A, 0x5F,
+  0x71, 0xF0, 0x32, 0x1A, 0x96, 0x50, 0x0F, 0xFF, 0xFF, 0x54, 0x43, 0x84,
+  0x43, 0x84, 0x43, 0x84, 0x43, 0x41, 0x25, 0x44, 0x29, 0x4F, 0x04, 0xF0,
+  0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xBC, 0x7C, 0x7C, 0x8A,
+  0x40, 0x08, 0x48, 0x19, 0x3F, 0x33, 0x91, 0x83, 0x92, 0x49, 0x44, 0x49,
+  0x44, 0x49, 0x44, 0x49, 0x44, 0x49, 0x44, 0x49, 0x44, 0x49, 0x44, 0x49,
+  0x44, 0x49, 0x44, 0x49, 0x44, 0x49, 0x44, 0x57, 0x55, 0x55, 0x56, 0xF0,
+  0x7D, 0x9B, 0xC7, 0x70, 0x08, 0x68, 0x19, 0x5F, 0x35, 0x91, 0x76, 0x84,
+  0x3B, 0x36, 0x49, 0x46, 0x49, 0x47, 0x47, 0x48, 0x47, 0x49, 0x46, 0x3A,
+  0x45, 0x4A, 0x54, 0x4B, 0x43, 0x4C, 0x43, 0x4D, 0x41, 0x4E, 0x41, 0x4E,
+  0x9F, 0x07, 0xF1, 0x7F, 0x25, 0xF3, 0x59, 0x08, 0x48, 0x19, 0x3F, 0x33,
+  0xF2, 0x58, 0x14, 0xB4, 0x24, 0x43, 0x44, 0x33, 0x35, 0x33, 0x43, 0x35,
+  0x33, 0x43, 0x35, 0x33, 0x44, 0x17, 0x23, 0x44, 0x17, 0x14, 0x44, 0x13,
+  0x13, 0x14, 0x48, 0x18, 0x57, 0x18, 0x56, 0x36, 0x66, 0x36, 0x66, 0x36,
+  0x66, 0x45, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x30, 0x16, 0x56, 0x18,
+  0x3F, 0x13, 0x81, 0x65, 0x64, 0x45, 0x55, 0x53, 0x57, 0x51, 0x59, 0x41,
+  0x4B, 0x7D, 0x5F, 0x04, 0xE5, 0xD7, 0xB4, 0x14, 0x94, 0x34, 0x75, 0x44,
+  0x55, 0x55, 0x37, 0x3F, 0x13, 0xF1, 0x38, 0x16, 0x56, 0x10, 0x16, 0x66,
+  0x18, 0x4F, 0x14, 0x81, 0x66, 0x64, 0x46, 0x46, 0x54, 0x57, 0x44, 0x49,
+  0x42, 0x4A, 0xAB, 0x8D, 0x6F, 0x04, 0xF1, 0x4F, 0x14, 0xF1, 0x4F, 0x14,
+  0xF1, 0x4C, 0xB9, 0xC8, 0xC9, 0xA5, 0x0E, 0x2E, 0x2E, 0x2E, 0x24, 0x64,
+  0x24, 0x54, 0x34, 0x44, 0x53, 0x43, 0xC4, 0xB4, 0xC3, 0xC3, 0xC4, 0xB4,
+  0x53, 0x43, 0x64, 0x23, 0x74, 0x14, 0x74, 0x1F, 0x01, 0xF0, 0x1F, 0x01,
+  0xF0, 0x07, 0x1F, 0x81, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x71,
+  0xF8, 0x10, 0x03, 0xC4, 0xB4, 0xC4, 0xB4, 0xC3, 0xC4, 0xC3, 0xC4, 0xC3,
+  0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4,
+  0xC4, 0xB4, 0xC3, 0xC4, 0xC3, 0xC3, 0x1F, 0xF1, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x1F, 0xF1, 0x71, 0xD3, 0xB5, 0x97, 0x87, 0x74, 0x14,
+  0x54, 0x34, 0x35, 0x35, 0x15, 0x59, 0x77, 0x93, 0x0F, 0xFF, 0xFF, 0x90,
+  0x02, 0x43, 0x43, 0x43, 0x43, 0x42, 0x77, 0x9B, 0x8C, 0x7D, 0xF0, 0x47,
+  0xC5, 0xE4, 0xF0, 0x3F, 0x12, 0x67, 0x42, 0x49, 0x42, 0x47, 0x62, 0xF4,
+  0x1F, 0x32, 0xF2, 0x47, 0x25, 0x10, 0x15, 0xD6, 0xD6, 0xD6, 0xF0, 0x4F,
+  0x04, 0xF0, 0x42, 0x67, 0xE5, 0xF0, 0x4F, 0x04, 0x65, 0x53, 0x57, 0x52,
+  0x49, 0x42, 0x49, 0x42, 0x49, 0x42, 0x49, 0x42, 0x57, 0x52, 0x65, 0x51,
+  0xF3, 0x1F, 0x22, 0xF1, 0x45, 0x26, 0x50, 0x66, 0x23, 0x4D, 0x2F, 0x01,
+  0xF1, 0x16, 0x5A, 0x88, 0xA7, 0xD4, 0xD4, 0xD5, 0xA1, 0x25, 0x74, 0x1F,
+  0x12, 0xE4, 0xC7, 0x84, 0xC6, 0xE6, 0xE6, 0xE6, 0xF1, 0x4F, 0x14, 0x86,
+  0x24, 0x69, 0x14, 0x5F, 0x04, 0xF1, 0x36, 0x56, 0x34, 0x85, 0x24, 0xA4,
+  0x24, 0xA4, 0x24, 0xA4, 0x24, 0xA4, 0x25, 0x85, 0x36, 0x56, 0x3F, 0x42,
+  0xF3, 0x4F, 0x16, 0x62, 0x51, 0x66, 0xAA, 0x7C, 0x5E, 0x36, 0x55, 0x24,
+  0x84, 0x14, 0xAF, 0xFF, 0xFF, 0x11, 0x4E, 0xF2, 0x2F, 0x13, 0xE7, 0x84,
+  0x68, 0x7B, 0x4C, 0x3D, 0x34, 0xC4, 0x9D, 0x3E, 0x2E, 0x2D, 0x64, 0xC4,
+  0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x9D, 0x3D, 0x3D, 0x3D, 0x30, 0x56,
+  0x25, 0x4F, 0x12, 0xF2, 0x1F, 0x31, 0x55, 0x62, 0x57, 0x52, 0x49, 0x42,
+  0x49, 0x42, 0x49, 0x42, 0x49, 0x42, 0x57, 0x53, 0x55, 0x63, 0xF1, 0x4F,
+  0x05, 0x91, 0x47, 0x62, 0x4F, 0x04, 0xF0, 0x4E, 0x57, 0xB8, 0xB8, 0xAA,
+  0x76, 0x25, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x24, 0xF2, 0x4F, 0x24, 0x35,
+  0x94, 0x18, 0x8E, 0x7F, 0x06, 0x64, 0x56, 0x56, 0x46, 0x47, 0x46, 0x47,
+  0x46, 0x47, 0x46, 0x47, 0x46, 0x47, 0x46, 0x47, 0x44, 0x75, 0x71, 0x85,
+  0xF1, 0x58, 0x16, 0x76, 0x10, 0x64, 0xC4, 0xC4, 0xC4, 0xFF, 0xA8, 0x88,
+  0x88, 0x88, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x6F, 0x01,
+  0xFF, 0x21, 0xE1, 0x64, 0x84, 0x84, 0x84, 0xFC, 0xFF, 0x51, 0xB8, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x47, 0xF1, 0x1B, 0x1A, 0x37, 0x40, 0x15, 0xC6, 0xC6, 0xC6, 0xE4, 0xE4,
+  0xE4, 0x37, 0x44, 0x28, 0x44, 0x28, 0x44, 0x27, 0x54, 0x15, 0x89, 0x98,
+  0xA7, 0xB8, 0xA4, 0x14, 0x94, 0x24, 0x84, 0x35, 0x46, 0x47, 0x16, 0x3F,
+  0x03, 0x91, 0x54, 0x71, 0x28, 0x88, 0x88, 0x88, 0xC4, 0xC4, 0xC4, 0xC4,
+  0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x6F, 0x01,
+  0xFF, 0x21, 0xE1, 0x24, 0x14, 0x34, 0x5F, 0x43, 0xF4, 0x3F, 0x53, 0x53,
+  0x43, 0x43, 0x44, 0x43, 0x43, 0x44, 0x43, 0x43, 0x44, 0x43, 0x43, 0x44,
+  0x43, 0x43, 0x44, 0x43, 0x43, 0x44, 0x43, 0x43, 0x44, 0x43, 0x41, 0x73,
+  0x52, 0xC3, 0x52, 0xC3, 0x52, 0x51, 0x54, 0x43, 0x41, 0x34, 0x25, 0x85,
+  0x18, 0x6F, 0x05, 0xF1, 0x56, 0x45, 0x54, 0x74, 0x54, 0x74, 0x54, 0x74,
+  0x54, 0x74, 0x54, 0x74, 0x54, 0x74, 0x54, 0x74, 0x37, 0x4F, 0x14, 0xF1,
+  0x48, 0x16, 0x66, 0x10, 0x67, 0xAB, 0x7D, 0x5F, 0x03, 0x65, 0x61, 0x59,
+  0x9B, 0x8B, 0x8B, 0x8B, 0x99, 0x51, 0x65, 0x63, 0xF0, 0x5D, 0x7B, 0xA7,
+  0x60, 0x25, 0x26, 0x76, 0x19, 0x5F, 0x24, 0xF3, 0x56, 0x56, 0x45, 0x85,
+  0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA4, 0x35, 0x85, 0x36, 0x56,
+  0x4F, 0x15, 0xF0, 0x64, 0x19, 0x74, 0x26, 0x94, 0xF2, 0x4F, 0x24, 0xF0,
+  0x9B, 0xAB, 0xAC, 0x8C, 0x66, 0x25, 0x69, 0x16, 0x4F, 0x23, 0xF3, 0x26,
+  0x56, 0x35, 0x85, 0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA4, 0x35,
+  0x85, 0x46, 0x56, 0x5F, 0x15, 0xF1, 0x79, 0x14, 0x96, 0x24, 0xF2, 0x4F,
+  0x24, 0xF2, 0x4E, 0x9C, 0xAB, 0xAC, 0x81, 0x16, 0x44, 0x27, 0x2F, 0x01,
+  0xFB, 0x38, 0x96, 0xB5, 0xC4, 0xD4, 0xD4, 0xD4, 0xD4, 0xAD, 0x4D, 0x4D,
+  0x4C, 0x50, 0x56, 0x22, 0x4C, 0x2E, 0x2E, 0x24, 0x64, 0x24, 0x73, 0x2A,
+  0x7C, 0x89, 0x22, 0x88, 0x99, 0x6F, 0xF6, 0x2D, 0x76, 0x50, 0x42, 0xE4,
+  0xD4, 0xD4, 0xD4, 0xAF, 0x02, 0xF0, 0x2F, 0x02, 0xE6, 0x4D, 0x4D, 0x4D,
+  0x4D, 0x4D, 0x4D, 0x4D, 0x46, 0x43, 0xE4, 0xC5, 0xB8, 0x74, 0x06, 0x56,
+  0x16, 0x47, 0x16, 0x47, 0x16, 0x47, 0x34, 0x74, 0x34, 0x74, 0x34, 0x74,
+  0x34, 0x74, 0x34, 0x74, 0x34, 0x74, 0x34, 0x74, 0x35, 0x46, 0x3F, 0x13,
+  0xF0, 0x48, 0x15, 0x65, 0x24, 0x10, 0x17, 0x57, 0x19, 0x3F, 0x33, 0x91,
+  0x75, 0x74, 0x47, 0x46, 0x47, 0x47, 0x45, 0x48, 0x45, 0x49, 0x43, 0x4A,
+  0x52, 0x4B, 0x41, 0x4C, 0x9D, 0x7E, 0x7F, 0x05, 0xF1, 0x58, 0x16, 0x76,
+  0x18, 0x5F, 0x15, 0x81, 0x67, 0x72, 0x43, 0x34, 0x43, 0x42, 0x52, 0x45,
+  0x32, 0x52, 0x45, 0x32, 0x51, 0x55, 0xF0, 0x6F, 0x07, 0x61, 0x77, 0x61,
+  0x77, 0x62, 0x58, 0x53, 0x59, 0x43, 0x59, 0x35, 0x35, 0x16, 0x56, 0x18,
+  0x3F, 0x13, 0x81, 0x65, 0x64, 0x53, 0x57, 0xB9, 0x9B, 0x7B, 0x8A, 0xB7,
+  0x61, 0x65, 0x63, 0x63, 0x65, 0x61, 0x83, 0xF1, 0x3F, 0x05, 0x70, 0x16,
+  0x56, 0x18, 0x3F, 0x13, 0x81, 0x65, 0x63, 0x47, 0x45, 0x46, 0x36, 0x45,
+  0x47, 0x44, 0x38, 0x43, 0x49, 0x33, 0x3A, 0x41, 0x4B, 0x31, 0x3C, 0x7D,
+  0x5E, 0x5F, 0x03, 0xF0, 0x4F, 0x03, 0xF0, 0x4A, 0xA8, 0xC7, 0xC8, 0xA8,
+  0x0F, 0xFF, 0xF0, 0x45, 0x23, 0x35, 0x85, 0x85, 0x85, 0x84, 0x94, 0x94,
+  0x6F, 0xFF, 0xE0, 0x63, 0x65, 0x46, 0x36, 0x45, 0x54, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x55, 0x36, 0x45, 0x55, 0x56, 0x65, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x65, 0x56, 0x56, 0x46, 0x63, 0x10, 0x12, 0x1F, 0xFF, 0xFF, 0xFE,
+  0x13, 0x65, 0x56, 0x56, 0x55, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65,
+  0x66, 0x55, 0x55, 0x46, 0x35, 0x54, 0x64, 0x64, 0x64, 0x64, 0x55, 0x46,
+  0x36, 0x46, 0x53, 0x60, 0x34, 0xC7, 0x99, 0x42, 0x1B, 0x28, 0x2B, 0x12,
+  0x49, 0x97, 0xC4, 0x30 };
+
+const GFXglyph FreeMonoBold18pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,  21,    0,    1 },   // 0x20 ' '
+  {     0,   5,  22,  21,    8,  -21 },   // 0x21 '!'
+  {    14,  11,  10,  21,    5,  -20 },   // 0x22 '"'
+  {    31,  16,  25,  21,    3,  -22 },   // 0x23 '#'
+  {    74,  14,  28,  21,    4,  -23 },   // 0x24 '$'
+  {   106,  15,  21,  21,    3,  -20 },   // 0x25 '%'
+  {   142,  15,  20,  21,    3,  -19 },   // 0x26 '&'
+  {   169,   4,  10,  21,    8,  -20 },   // 0x27 '''
+  {   176,   8,  27,  21,    9,  -21 },   // 0x28 '('
+  {   203,   8,  27,  21,    4,  -21 },   // 0x29 ')'
+  {   231,  16,  15,  21,    3,  -21 },   // 0x2A '*'
+  {   250,  16,  19,  21,    3,  -18 },   // 0x2B '+'
+  {   269,   7,  10,  21,    5,   -3 },   // 0x2C ','
+  {   280,  19,   4,  21,    1,  -11 },   // 0x2D '-'
+  {   287,   5,   5,  21,    8,   -4 },   // 0x2E '.'
+  {   291,  15,  28,  21,    3,  -23 },   // 0x2F '/'
+  {   320,  16,  23,  21,    3,  -22 },   // 0x30 '0'
+  {   349,  15,  22,  21,    3,  -21 },   // 0x31 '1'
+  {   374,  15,  23,  21,    3,  -22 },   // 0x32 '2'
+  {   398,  16,  23,  21,    3,  -22 },   // 0x33 '3'
+  {   422,  15,  21,  21,    3,  -20 },   // 0x34 '4'
+  {   450,  17,  22,  21,    2,  -21 },   // 0x35 '5'
+  {   476,  15,  23,  21,    4,  -22 },   // 0x36 '6'
+  {   505,  15,  22,  21,    3,  -21 },   // 0x37 '7'
+  {   527,  15,  23,  21,    3,  -22 },   // 0x38 '8'
+  {   555,  15,  23,  21,    4,  -22 },   // 0x39 '9'
+  {   586,   5,  16,  21,    8,  -15 },   // 0x3A ':'
+  {   595,   7,  22,  21,    5,  -15 },   // 0x3B ';'
+  {   612,  18,  16,  21,    1,  -17 },   // 0x3C '<'
+  {   630,  19,  10,  21,    1,  -14 },   // 0x3D '='
+  {   644,  18,  16,  21,    2,  -17 },   // 0x3E '>'
+  {   661,  15,  21,  21,    4,  -20 },   // 0x3F '?'
+  {   684,  15,  27,  21,    3,  -21 },   // 0x40 '@'
+  {   732,  22,  21,  21,   -1,  -20 },   // 0x41 'A'
+  {   766,  20,  21,  21,    1,  -20 },   // 0x42 'B'
+  {   801,  19,  21,  21,    1,  -20 },   // 0x43 'C'
+  {   834,  18,  21,  21,    2,  -20 },   // 0x44 'D'
+  {   871,  19,  21,  21,    1,  -20 },   // 0x45 'E'
+  {   907,  19,  21,  21,    1,  -20 },   // 0x46 'F'
+  {   938,  20,  21,  21,    1,  -20 },   // 0x47 'G'
+  {   972,  21,  21,  21,    0,  -20 },   // 0x48 'H'
+  {  1012,  14,  21,  21,    4,  -20 },   // 0x49 'I'
+  {  1031,  19,  21,  21,    2,  -20 },   // 0x4A 'J'
+  {  1062,  20,  21,  21,    1,  -20 },   // 0x4B 'K'
+  {  1101,  18,  21,  21,    2,  -20 },   // 0x4C 'L'
+  {  1126,  23,  21,  21,   -1,  -20 },   // 0x4D 'M'
+  {  1179,  20,  21,  21,    1,  -20 },   // 0x4E 'N'
+  {  1226,  20,  21,  21,    1,  -20 },   // 0x4F 'O'
+  {  1255,  18,  21,  21,    1,  -20 },   // 0x50 'P'
+  {  1285,  20,  26,  21,    1,  -20 },   // 0x51 'Q'
+  {  1322,  21,  21,  21,    0,  -20 },   // 0x52 'R'
+  {  1358,  17,  21,  21,    2,  -20 },   // 0x53 'S'
+  {  1386,  19,  21,  21,    1,  -20 },   // 0x54 'T'
+  {  1417,  21,  21,  21,    0,  -20 },   // 0x55 'U'
+  {  1456,  23,  21,  21,   -1,  -20 },   // 0x56 'V'
+  {  1495,  21,  21,  21,    0,  -20 },   // 0x57 'W'
+  {  1545,  19,  21,  21,    1,  -20 },   // 0x58 'X'
+  {  1582,  20,  21,  21,    1,  -20 },   // 0x59 'Y'
+  {  1614,  16,  21,  21,    3,  -20 },   // 0x5A 'Z'
+  {  1645,   8,  27,  21,    9,  -21 },   // 0x5B '['
+  {  1670,  15,  28,  21,    3,  -23 },   // 0x5C '\'
+  {  1698,   8,  27,  21,    4,  -21 },   // 0x5D ']'
+  {  1721,  15,  11,  21,    3,  -21 },   // 0x5E '^'
+  {  1736,  21,   4,  21,    0,    4 },   // 0x5F '_'
+  {  1740,   6,   6,  21,    6,  -22 },   // 0x60 '`'
+  {  1746,  19,  16,  21,    1,  -15 },   // 0x61 'a'
+  {  1770,  19,  22,  21,    1,  -21 },   // 0x62 'b'
+  {  1807,  17,  16,  21,    2,  -15 },   // 0x63 'c'
+  {  1828,  20,  22,  21,    1,  -21 },   // 0x64 'd'
+  {  1865,  18,  16,  21,    1,  -15 },   // 0x65 'e'
+  {  1884,  16,  22,  21,    4,  -21 },   // 0x66 'f'
+  {  1907,  19,  23,  21,    1,  -15 },   // 0x67 'g'
+  {  1945,  21,  22,  21,    0,  -21 },   // 0x68 'h'
+  {  1985,  16,  22,  21,    3,  -21 },   // 0x69 'i'
+  {  2007,  12,  29,  21,    5,  -21 },   // 0x6A 'j'
+  {  2034,  18,  22,  21,    2,  -21 },   // 0x6B 'k'
+  {  2068,  16,  22,  21,    3,  -21 },   // 0x6C 'l'
+  {  2091,  22,  16,  21,   -1,  -15 },   // 0x6D 'm'
+  {  2133,  20,  16,  21,    0,  -15 },   // 0x6E 'n'
+  {  2164,  19,  16,  21,    1,  -15 },   // 0x6F 'o'
+  {  2185,  21,  23,  21,    0,  -15 },   // 0x70 'p'
+  {  2224,  21,  23,  22,    1,  -15 },   // 0x71 'q'
+  {  2263,  17,  16,  21,    3,  -15 },   // 0x72 'r'
+  {  2282,  16,  16,  21,    3,  -15 },   // 0x73 's'
+  {  2302,  17,  21,  21,    1,  -20 },   // 0x74 't'
+  {  2326,  18,  16,  21,    1,  -15 },   // 0x75 'u'
+  {  2358,  21,  16,  21,    0,  -15 },   // 0x76 'v'
+  {  2386,  21,  16,  21,    0,  -15 },   // 0x77 'w'
+  {  2421,  19,  16,  21,    1,  -15 },   // 0x78 'x'
+  {  2447,  19,  23,  21,    1,  -15 },   // 0x79 'y'
+  {  2484,  14,  16,  21,    3,  -15 },   // 0x7A 'z'
+  {  2499,  10,  27,  21,    6,  -21 },   // 0x7B '{'
+  {  2527,   4,  27,  21,    9,  -21 },   // 0x7C '|'
+  {  2532,  10,  27,  21,    6,  -21 },   // 0x7D '}'
+  {  2560,  17,   8,  21,    2,  -13 } }; // 0x7E '~'
+
+const GFXfontPacked FreeMonoBold18pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeMonoBold18pt7bPackedRuns,
+    (GFXglyph *)FreeMonoBold18pt7bPackedGlyphs,
+    0x20, 0x7E, 35 } };
+
+// Approx. 3244 bytes
@@ -0,0 +1,261 @@
+// FreeMonoBoldOblique12pt7b as run lengths, generated by Tools/GFX_pack from FreeMonoBoldOblique12pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeMonoBoldOblique12pt7bPackedRuns[] PROGMEM = {
+  0x33, 0x24, 0x24, 0x23, 0x33, 0x33, 0x23, 0x33, 0x32, 0x42, 0x42, 0xA2,
+  0x33, 0x32, 0x40, 0x03, 0x26, 0x26, 0x22, 0x12, 0x32, 0x12, 0x32, 0x12,
+  0x31, 0x21, 0x41, 0x20, 0x62, 0x22, 0x72, 0x22, 0x63, 0x13, 0x62, 0x23,
+  0x62, 0x22, 0x4B, 0x2B, 0x42, 0x22, 0x72, 0x22, 0x63, 0x13, 0x62, 0x23,
+  0x4A, 0x2B, 0x43, 0x13, 0x62, 0x22, 0x72, 0x22, 0x63, 0x13, 0x62, 0x22,
+  0x60, 0x71, 0x93, 0x82, 0x77, 0x38, 0x23, 0x33, 0x22, 0x51, 0x32, 0x96,
+  0x66, 0x84, 0x21, 0x62, 0x13, 0x52, 0x13, 0x42, 0x29, 0x28, 0x63, 0x82,
+  0x92, 0x92, 0x60, 0x43, 0x75, 0x52, 0x31, 0x51, 0x41, 0x51, 0x32, 0x55,
+  0x73, 0x14, 0x45, 0x37, 0x32, 0x25, 0x52, 0x31, 0x51, 0x41, 0x51, 0x32,
+  0x55, 0x73, 0x40, 0x55, 0x56, 0x42, 0x31, 0x52, 0x92, 0x93, 0x74, 0x66,
+  0x13, 0x12, 0x16, 0x12, 0x34, 0x22, 0x34, 0x2A, 0x28, 0x20, 0x08, 0x12,
+  0x12, 0x11, 0x21, 0x20, 0x52, 0x43, 0x33, 0x42, 0x42, 0x52, 0x42, 0x52,
+  0x42, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x52, 0x52, 0x51, 0x50,
+  0x42, 0x52, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x42, 0x52,
+  0x43, 0x42, 0x43, 0x33, 0x42, 0x43, 0x41, 0x60, 0x52, 0x92, 0x92, 0x56,
+  0x1E, 0x18, 0x54, 0x66, 0x43, 0x13, 0x42, 0x32, 0x30, 0x62, 0x93, 0x93,
+  0x92, 0xA2, 0x5F, 0x94, 0x39, 0x2A, 0x2A, 0x29, 0x39, 0x27, 0x33, 0x23,
+  0x32, 0x33, 0x32, 0x32, 0x41, 0x50, 0x1F, 0xA0, 0x17, 0x10, 0xC1, 0xC3,
+  0xB2, 0xB3, 0xA3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3,
+  0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xC1, 0xD0, 0x54, 0x57, 0x33, 0x33, 0x22,
+  0x52, 0x13, 0x52, 0x12, 0x62, 0x12, 0x62, 0x12, 0x65, 0x55, 0x62, 0x12,
+  0x62, 0x12, 0x53, 0x13, 0x33, 0x37, 0x54, 0x50, 0x64, 0x55, 0x56, 0x52,
+  0x22, 0x83, 0x83, 0x82, 0x92, 0x83, 0x83, 0x82, 0x92, 0x92, 0x4F, 0x61,
+  0x65, 0x77, 0x53, 0x33, 0x33, 0x52, 0x32, 0x62, 0xA2, 0xA3, 0x93, 0x93,
+  0x83, 0x93, 0x93, 0x41, 0x34, 0x43, 0x2A, 0x2B, 0x20, 0x55, 0x59, 0x32,
+  0x43, 0xA2, 0xA2, 0x92, 0x65, 0x75, 0xA3, 0xA2, 0xA2, 0xA2, 0x12, 0x53,
+  0x29, 0x46, 0x50, 0x74, 0x74, 0x64, 0x62, 0x12, 0x52, 0x22, 0x43, 0x13,
+  0x33, 0x22, 0x33, 0x32, 0x32, 0x42, 0x2A, 0x1A, 0x72, 0x66, 0x56, 0x20,
+  0x48, 0x38, 0x42, 0xA2, 0xA2, 0x97, 0x58, 0x43, 0x33, 0xA2, 0xA2, 0xA2,
+  0x92, 0x22, 0x53, 0x29, 0x46, 0x50, 0x65, 0x47, 0x33, 0x73, 0x82, 0x82,
+  0x92, 0x14, 0x39, 0x24, 0x23, 0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x23,
+  0x32, 0x46, 0x64, 0x50, 0x0F, 0x61, 0x25, 0x31, 0x25, 0x28, 0x38, 0x28,
+  0x38, 0x28, 0x38, 0x28, 0x37, 0x38, 0x38, 0x29, 0x18, 0x54, 0x57, 0x33,
+  0x33, 0x12, 0x62, 0x12, 0x62, 0x12, 0x62, 0x13, 0x42, 0x37, 0x47, 0x32,
+  0x43, 0x12, 0x62, 0x12, 0x62, 0x12, 0x43, 0x28, 0x45, 0x50, 0x54, 0x66,
+  0x42, 0x33, 0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x23, 0x24, 0x29, 0x34,
+  0x12, 0x92, 0x82, 0x83, 0x73, 0x37, 0x45, 0x60, 0x32, 0x23, 0x22, 0xFC,
+  0x22, 0x32, 0x23, 0x52, 0x43, 0x42, 0xFF, 0x83, 0x43, 0x33, 0x42, 0x43,
+  0x42, 0x51, 0x60, 0xB2, 0x94, 0x75, 0x55, 0x65, 0x75, 0xA5, 0x95, 0xA5,
+  0xA4, 0xB1, 0x20, 0x1C, 0x1C, 0xFF, 0x9C, 0x1C, 0x10, 0x22, 0xB4, 0xA5,
+  0xA4, 0xA5, 0xA5, 0x55, 0x65, 0x65, 0x74, 0x91, 0xC0, 0x25, 0x28, 0x12,
+  0x45, 0x52, 0x72, 0x63, 0x53, 0x44, 0x43, 0x62, 0xF1, 0x26, 0x36, 0x26,
+  0x64, 0x76, 0x52, 0x33, 0x32, 0x52, 0x22, 0x62, 0x22, 0x44, 0x22, 0x25,
+  0x22, 0x23, 0x12, 0x22, 0x12, 0x32, 0x22, 0x12, 0x32, 0x22, 0x12, 0x32,
+  0x12, 0x26, 0x22, 0x36, 0x12, 0xA2, 0xA2, 0xA3, 0x32, 0x57, 0x64, 0x60,
+  0x57, 0x78, 0xA5, 0x96, 0x93, 0x12, 0x83, 0x23, 0x72, 0x33, 0x63, 0x33,
+  0x5A, 0x5A, 0x43, 0x63, 0x32, 0x73, 0x16, 0x3C, 0x36, 0x2A, 0x3B, 0x42,
+  0x52, 0x33, 0x52, 0x33, 0x52, 0x32, 0x52, 0x49, 0x49, 0x33, 0x53, 0x23,
+  0x62, 0x22, 0x72, 0x22, 0x62, 0x1C, 0x1A, 0x30, 0x65, 0x12, 0x4A, 0x33,
+  0x43, 0x32, 0x72, 0x22, 0x82, 0x22, 0xB2, 0xC2, 0xC2, 0xC2, 0xC2, 0x82,
+  0x24, 0x53, 0x3A, 0x66, 0x50, 0x29, 0x4A, 0x43, 0x42, 0x42, 0x62, 0x32,
+  0x62, 0x32, 0x62, 0x23, 0x62, 0x23, 0x62, 0x22, 0x62, 0x32, 0x62, 0x32,
+  0x62, 0x23, 0x43, 0x2A, 0x38, 0x50, 0x3C, 0x3C, 0x43, 0x53, 0x43, 0x53,
+  0x42, 0x22, 0x22, 0x52, 0x22, 0x96, 0x87, 0x83, 0x12, 0x92, 0x31, 0x32,
+  0x42, 0x63, 0x42, 0x63, 0x2C, 0x2D, 0x20, 0x3D, 0x3C, 0x53, 0x62, 0x52,
+  0x63, 0x52, 0x22, 0x31, 0x62, 0x22, 0x97, 0x97, 0x92, 0x23, 0x92, 0x22,
+  0xA2, 0xD3, 0xB8, 0x88, 0x80, 0x56, 0x12, 0x3B, 0x23, 0x53, 0x23, 0x72,
+  0x22, 0x82, 0x22, 0xB2, 0xC2, 0x47, 0x12, 0x47, 0x12, 0x73, 0x22, 0x73,
+  0x24, 0x43, 0x4A, 0x66, 0x50, 0x45, 0x16, 0x36, 0x15, 0x53, 0x52, 0x62,
+  0x62, 0x62, 0x53, 0x62, 0x53, 0x5A, 0x6A, 0x62, 0x62, 0x62, 0x53, 0x62,
+  0x53, 0x53, 0x52, 0x55, 0x26, 0x26, 0x25, 0x30, 0x2A, 0x2A, 0x62, 0x93,
+  0x93, 0x92, 0xA2, 0xA2, 0x93, 0x93, 0x93, 0x92, 0x6A, 0x2A, 0x20, 0x6A,
+  0x6A, 0xA3, 0xD2, 0xE2, 0xE2, 0xD3, 0x61, 0x63, 0x52, 0x62, 0x62, 0x62,
+  0x62, 0x53, 0x53, 0x43, 0x69, 0x96, 0x80, 0x36, 0x25, 0x36, 0x24, 0x53,
+  0x33, 0x72, 0x33, 0x82, 0x23, 0x96, 0x97, 0x98, 0x83, 0x23, 0x82, 0x42,
+  0x82, 0x43, 0x63, 0x43, 0x47, 0x34, 0x26, 0x44, 0x20, 0x28, 0x58, 0x82,
+  0xA3, 0xA3, 0xA2, 0xB2, 0xB2, 0xA3, 0x52, 0x33, 0x52, 0x32, 0x62, 0x32,
+  0x5F, 0xD1, 0x34, 0x64, 0x44, 0x64, 0x54, 0x44, 0x55, 0x35, 0x55, 0x35,
+  0x52, 0x12, 0x25, 0x62, 0x16, 0x12, 0x53, 0x15, 0x22, 0x53, 0x15, 0x13,
+  0x52, 0x33, 0x23, 0x52, 0x33, 0x22, 0x62, 0x82, 0x46, 0x36, 0x36, 0x36,
+  0x30, 0x24, 0x46, 0x25, 0x36, 0x34, 0x52, 0x55, 0x33, 0x55, 0x33, 0x52,
+  0x13, 0x22, 0x53, 0x13, 0x22, 0x53, 0x13, 0x22, 0x52, 0x36, 0x52, 0x36,
+  0x52, 0x44, 0x53, 0x44, 0x46, 0x33, 0x45, 0x43, 0x40, 0x65, 0x79, 0x43,
+  0x43, 0x32, 0x73, 0x12, 0x92, 0x12, 0x94, 0xA4, 0xA4, 0x92, 0x12, 0x92,
+  0x13, 0x72, 0x33, 0x43, 0x49, 0x75, 0x60, 0x29, 0x4A, 0x52, 0x43, 0x33,
+  0x52, 0x33, 0x52, 0x32, 0x62, 0x32, 0x52, 0x48, 0x48, 0x53, 0xA2, 0xB2,
+  0x98, 0x58, 0x50, 0x65, 0x79, 0x43, 0x43, 0x32, 0x73, 0x12, 0x92, 0x12,
+  0x94, 0xA4, 0xA4, 0x92, 0x12, 0x92, 0x13, 0x72, 0x33, 0x43, 0x49, 0x66,
+  0x82, 0x61, 0x4B, 0x2B, 0x30, 0x39, 0x6A, 0x63, 0x43, 0x52, 0x62, 0x52,
+  0x62, 0x52, 0x43, 0x59, 0x68, 0x72, 0x34, 0x62, 0x43, 0x62, 0x52, 0x53,
+  0x53, 0x27, 0x4B, 0x44, 0x45, 0x12, 0x39, 0x22, 0x43, 0x22, 0x62, 0x22,
+  0x62, 0x24, 0x87, 0x77, 0x93, 0x31, 0x62, 0x22, 0x62, 0x23, 0x42, 0x39,
+  0x31, 0x15, 0x50, 0x1C, 0x1C, 0x12, 0x23, 0x26, 0x23, 0x25, 0x32, 0x32,
+  0x12, 0x32, 0x32, 0x62, 0xA3, 0xA3, 0xA2, 0xB2, 0xB2, 0x79, 0x49, 0x40,
+  0x16, 0x1C, 0x26, 0x22, 0x62, 0x33, 0x62, 0x32, 0x72, 0x32, 0x63, 0x32,
+  0x62, 0x33, 0x62, 0x33, 0x62, 0x32, 0x63, 0x32, 0x62, 0x42, 0x53, 0x58,
+  0x75, 0x70, 0x06, 0x3C, 0x36, 0x13, 0x72, 0x42, 0x63, 0x43, 0x43, 0x53,
+  0x42, 0x63, 0x33, 0x72, 0x32, 0x82, 0x23, 0x86, 0x95, 0xA5, 0xB3, 0xC2,
+  0x90, 0x16, 0x26, 0x16, 0x26, 0x13, 0x73, 0x23, 0x23, 0x23, 0x23, 0x14,
+  0x22, 0x33, 0x14, 0x13, 0x32, 0x15, 0x13, 0x32, 0x12, 0x12, 0x12, 0x45,
+  0x15, 0x44, 0x25, 0x44, 0x24, 0x53, 0x34, 0x53, 0x34, 0x43, 0x43, 0x50,
+  0x35, 0x35, 0x35, 0x35, 0x43, 0x43, 0x73, 0x23, 0x83, 0x13, 0xA5, 0xB4,
+  0xC4, 0xB6, 0x93, 0x13, 0x83, 0x33, 0x63, 0x43, 0x46, 0x26, 0x26, 0x26,
+  0x20, 0x05, 0x3A, 0x35, 0x22, 0x43, 0x43, 0x23, 0x53, 0x23, 0x66, 0x75,
+  0x93, 0xA2, 0xB2, 0xB2, 0xA3, 0x79, 0x48, 0x50, 0x49, 0x4A, 0x43, 0x34,
+  0x42, 0x43, 0x52, 0x33, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0x42, 0x43, 0x52,
+  0x33, 0x53, 0x3B, 0x2B, 0x30, 0x45, 0x45, 0x42, 0x63, 0x63, 0x62, 0x72,
+  0x72, 0x63, 0x63, 0x62, 0x72, 0x72, 0x63, 0x63, 0x62, 0x72, 0x75, 0x36,
+  0x30, 0x11, 0x53, 0x43, 0x52, 0x53, 0x43, 0x43, 0x52, 0x53, 0x43, 0x43,
+  0x52, 0x53, 0x43, 0x52, 0x52, 0x53, 0x43, 0x52, 0x51, 0x10, 0x35, 0x45,
+  0x72, 0x63, 0x63, 0x62, 0x72, 0x72, 0x63, 0x63, 0x62, 0x72, 0x72, 0x63,
+  0x63, 0x62, 0x72, 0x45, 0x45, 0x40, 0x61, 0x82, 0x74, 0x56, 0x33, 0x13,
+  0x23, 0x36, 0x45, 0x62, 0x0F, 0xF0, 0x02, 0x23, 0x23, 0x22, 0x37, 0x49,
+  0xA2, 0xA2, 0x57, 0x39, 0x23, 0x42, 0x22, 0x62, 0x22, 0x44, 0x2C, 0x1B,
+  0x34, 0xB4, 0xC3, 0xC3, 0xC2, 0x16, 0x6A, 0x54, 0x43, 0x34, 0x62, 0x33,
+  0x72, 0x33, 0x72, 0x33, 0x72, 0x33, 0x62, 0x35, 0x42, 0x2C, 0x34, 0x16,
+  0x40, 0x48, 0x2A, 0x22, 0x53, 0x12, 0x66, 0x62, 0x12, 0xA2, 0xA2, 0xA3,
+  0x62, 0x2A, 0x37, 0x30, 0xA4, 0xA4, 0xB3, 0xB2, 0x65, 0x12, 0x4A, 0x32,
+  0x45, 0x22, 0x64, 0x22, 0x63, 0x22, 0x73, 0x22, 0x73, 0x22, 0x64, 0x23,
+  0x45, 0x3C, 0x36, 0x14, 0x10, 0x46, 0x58, 0x24, 0x43, 0x12, 0x7F, 0xDA,
+  0x2A, 0x35, 0x32, 0xA4, 0x63, 0x86, 0x78, 0x72, 0xC3, 0xA9, 0x5A, 0x82,
+  0xC3, 0xC3, 0xC2, 0xD2, 0xD2, 0xC3, 0x9A, 0x5A, 0x50, 0x45, 0x14, 0x3B,
+  0x22, 0x44, 0x32, 0x63, 0x22, 0x73, 0x22, 0x72, 0x32, 0x63, 0x32, 0x63,
+  0x33, 0x35, 0x4A, 0x55, 0x12, 0xC2, 0xB3, 0xB2, 0x67, 0x76, 0x70, 0x34,
+  0x85, 0xA2, 0xB2, 0xB2, 0x14, 0x59, 0x44, 0x32, 0x43, 0x42, 0x42, 0x52,
+  0x42, 0x52, 0x33, 0x43, 0x33, 0x43, 0x32, 0x52, 0x26, 0x1B, 0x26, 0x63,
+  0x83, 0xF1, 0x65, 0x59, 0x29, 0x28, 0x38, 0x38, 0x29, 0x29, 0x24, 0xF7,
+  0x93, 0x93, 0xF1, 0x83, 0x99, 0x39, 0x39, 0x2A, 0x2A, 0x29, 0x39, 0x39,
+  0x2A, 0x2A, 0x29, 0x38, 0x34, 0x74, 0x75, 0x34, 0xA4, 0xB3, 0xB3, 0xB2,
+  0x26, 0x42, 0x25, 0x52, 0x14, 0x66, 0x85, 0x95, 0x96, 0x82, 0x14, 0x63,
+  0x23, 0x45, 0x26, 0x14, 0x36, 0x10, 0x45, 0x65, 0x92, 0x83, 0x83, 0x82,
+  0x92, 0x92, 0x83, 0x83, 0x82, 0x92, 0x92, 0x4F, 0x70, 0x27, 0x14, 0x3D,
+  0x24, 0x23, 0x22, 0x32, 0x32, 0x32, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x22, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x15, 0x14, 0x19,
+  0x14, 0x14, 0x24, 0x14, 0x4A, 0x35, 0x32, 0x43, 0x42, 0x42, 0x52, 0x42,
+  0x52, 0x33, 0x43, 0x33, 0x43, 0x32, 0x52, 0x26, 0x1B, 0x26, 0x55, 0x58,
+  0x33, 0x43, 0x12, 0x74, 0x84, 0x84, 0x84, 0x72, 0x13, 0x43, 0x38, 0x55,
+  0x50, 0x34, 0x16, 0x5C, 0x55, 0x43, 0x44, 0x62, 0x43, 0x72, 0x43, 0x72,
+  0x43, 0x63, 0x43, 0x62, 0x45, 0x42, 0x5A, 0x62, 0x25, 0x72, 0xE2, 0xD3,
+  0xB7, 0x97, 0x90, 0x46, 0x14, 0x3C, 0x22, 0x45, 0x32, 0x63, 0x41, 0x73,
+  0x32, 0x73, 0x32, 0x73, 0x32, 0x64, 0x33, 0x44, 0x5A, 0x65, 0x22, 0xD2,
+  0xC3, 0xC3, 0x97, 0x87, 0x30, 0x34, 0x24, 0x4B, 0x55, 0x22, 0x44, 0xA3,
+  0xB2, 0xC2, 0xC2, 0xB3, 0x8A, 0x4A, 0x40, 0x57, 0x39, 0x22, 0x53, 0x23,
+  0x42, 0x37, 0x68, 0x75, 0x22, 0x62, 0x13, 0x53, 0x1A, 0x28, 0x40, 0x42,
+  0x73, 0x72, 0x5F, 0x52, 0x37, 0x28, 0x28, 0x27, 0x37, 0x37, 0x25, 0x21,
+  0x92, 0x62, 0x04, 0x48, 0x35, 0x12, 0x63, 0x12, 0x63, 0x12, 0x63, 0x12,
+  0x62, 0x22, 0x62, 0x22, 0x53, 0x22, 0x44, 0x2B, 0x25, 0x14, 0x16, 0x26,
+  0x16, 0x26, 0x23, 0x52, 0x62, 0x43, 0x62, 0x42, 0x73, 0x22, 0x83, 0x13,
+  0x92, 0x12, 0xA5, 0xA4, 0xB3, 0x80, 0x05, 0x4A, 0x35, 0x22, 0x22, 0x32,
+  0x32, 0x14, 0x13, 0x32, 0x14, 0x12, 0x4A, 0x49, 0x54, 0x14, 0x53, 0x23,
+  0x63, 0x23, 0x62, 0x33, 0x50, 0x25, 0x25, 0x25, 0x25, 0x34, 0x23, 0x67,
+  0x85, 0x95, 0x77, 0x64, 0x23, 0x44, 0x35, 0x16, 0x16, 0x15, 0x26, 0x10,
+  0x35, 0x35, 0x25, 0x45, 0x33, 0x53, 0x62, 0x52, 0x73, 0x33, 0x73, 0x23,
+  0x92, 0x22, 0xA6, 0xA5, 0xB5, 0xC3, 0xC3, 0xD3, 0xC3, 0x98, 0x88, 0x80,
+  0x39, 0x39, 0x23, 0x33, 0x32, 0x33, 0x83, 0x83, 0x83, 0x83, 0x32, 0x33,
+  0x42, 0x2A, 0x2A, 0x10, 0x73, 0x64, 0x53, 0x72, 0x82, 0x73, 0x73, 0x72,
+  0x73, 0x45, 0x54, 0x92, 0x82, 0x82, 0x73, 0x72, 0x82, 0x84, 0x73, 0x40,
+  0x42, 0x33, 0x33, 0x33, 0x32, 0x42, 0x33, 0x33, 0x32, 0x42, 0x42, 0x33,
+  0x33, 0x32, 0x42, 0x33, 0x33, 0x32, 0x51, 0x40, 0x43, 0x64, 0x72, 0x72,
+  0x63, 0x62, 0x72, 0x72, 0x72, 0x83, 0x54, 0x43, 0x62, 0x63, 0x63, 0x62,
+  0x63, 0x44, 0x53, 0x60, 0x24, 0x41, 0x26, 0x22, 0x13, 0x16, 0x22, 0x43,
+  0x30 };
+
+const GFXglyph FreeMonoBoldOblique12pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,  14,    0,    1 },   // 0x20 ' '
+  {     0,   6,  15,  14,    6,  -14 },   // 0x21 '!'
+  {    15,   8,   7,  14,    6,  -13 },   // 0x22 '"'
+  {    28,  13,  18,  14,    2,  -15 },   // 0x23 '#'
+  {    61,  11,  20,  14,    3,  -16 },   // 0x24 '$'
+  {    87,  11,  15,  14,    3,  -14 },   // 0x25 '%'
+  {   111,  11,  13,  14,    2,  -12 },   // 0x26 '&'
+  {   130,   3,   7,  14,    8,  -13 },   // 0x27 '''
+  {   136,   7,  19,  14,    7,  -14 },   // 0x28 '('
+  {   156,   7,  19,  14,    2,  -14 },   // 0x29 ')'
+  {   176,  11,  10,  14,    4,  -14 },   // 0x2A '*'
+  {   189,  12,  13,  14,    3,  -12 },   // 0x2B '+'
+  {   202,   6,   7,  14,    3,   -2 },   // 0x2C ','
+  {   210,  13,   2,  14,    2,   -7 },   // 0x2D '-'
+  {   212,   3,   3,  14,    6,   -2 },   // 0x2E '.'
+  {   214,  14,  20,  14,    2,  -16 },   // 0x2F '/'
+  {   235,  11,  15,  14,    3,  -14 },   // 0x30 '0'
+  {   260,  11,  15,  14,    2,  -14 },   // 0x31 '1'
+  {   276,  13,  15,  14,    1,  -14 },   // 0x32 '2'
+  {   297,  12,  15,  14,    2,  -14 },   // 0x33 '3'
+  {   315,  11,  14,  14,    3,  -13 },   // 0x34 '4'
+  {   336,  12,  15,  14,    2,  -14 },   // 0x35 '5'
+  {   354,  11,  15,  14,    4,  -14 },   // 0x36 '6'
+  {   376,  11,  15,  14,    4,  -14 },   // 0x37 '7'
+  {   393,  11,  15,  14,    3,  -14 },   // 0x38 '8'
+  {   418,  11,  15,  14,    3,  -14 },   // 0x39 '9'
+  {   440,   5,  11,  14,    5,  -10 },   // 0x3A ':'
+  {   447,   7,  15,  14,    3,  -10 },   // 0x3B ';'
+  {   459,  13,  11,  14,    2,  -11 },   // 0x3C '<'
+  {   471,  13,   7,  14,    2,   -9 },   // 0x3D '='
+  {   477,  13,  11,  14,    2,  -11 },   // 0x3E '>'
+  {   489,   9,  14,  14,    5,  -13 },   // 0x3F '?'
+  {   504,  12,  19,  14,    2,  -14 },   // 0x40 '@'
+  {   540,  15,  14,  14,    0,  -13 },   // 0x41 'A'
+  {   561,  13,  14,  14,    1,  -13 },   // 0x42 'B'
+  {   584,  14,  14,  14,    2,  -13 },   // 0x43 'C'
+  {   605,  13,  14,  14,    1,  -13 },   // 0x44 'D'
+  {   630,  15,  14,  14,    0,  -13 },   // 0x45 'E'
+  {   655,  16,  14,  14,    0,  -13 },   // 0x46 'F'
+  {   677,  14,  14,  14,    1,  -13 },   // 0x47 'G'
+  {   701,  16,  14,  14,    0,  -13 },   // 0x48 'H'
+  {   728,  12,  14,  14,    2,  -13 },   // 0x49 'I'
+  {   743,  16,  14,  14,    0,  -13 },   // 0x4A 'J'
+  {   763,  16,  14,  14,    0,  -13 },   // 0x4B 'K'
+  {   789,  13,  14,  14,    1,  -13 },   // 0x4C 'L'
+  {   806,  18,  14,  14,    0,  -13 },   // 0x4D 'M'
+  {   841,  16,  14,  14,    1,  -13 },   // 0x4E 'N'
+  {   873,  14,  14,  14,    1,  -13 },   // 0x4F 'O'
+  {   895,  13,  14,  14,    1,  -13 },   // 0x50 'P'
+  {   915,  14,  17,  14,    1,  -13 },   // 0x51 'Q'
+  {   941,  15,  14,  14,    0,  -13 },   // 0x52 'R'
+  {   964,  12,  14,  14,    3,  -13 },   // 0x53 'S'
+  {   987,  13,  14,  14,    2,  -13 },   // 0x54 'T'
+  {  1008,  14,  14,  14,    2,  -13 },   // 0x55 'U'
+  {  1034,  15,  14,  14,    1,  -13 },   // 0x56 'V'
+  {  1057,  15,  14,  14,    1,  -13 },   // 0x57 'W'
+  {  1092,  16,  14,  14,    0,  -13 },   // 0x58 'X'
+  {  1117,  13,  14,  14,    2,  -13 },   // 0x59 'Y'
+  {  1136,  14,  14,  14,    1,  -13 },   // 0x5A 'Z'
+  {  1157,   9,  19,  14,    5,  -14 },   // 0x5B '['
+  {  1177,   7,  20,  14,    5,  -16 },   // 0x5C '\'
+  {  1198,   9,  19,  14,    3,  -14 },   // 0x5D ']'
+  {  1218,  10,   8,  14,    4,  -15 },   // 0x5E '^'
+  {  1228,  15,   2,  14,   -1,    4 },   // 0x5F '_'
+  {  1230,   4,   4,  14,    7,  -15 },   // 0x60 '`'
+  {  1234,  12,  11,  14,    2,  -10 },   // 0x61 'a'
+  {  1248,  15,  15,  14,   -1,  -14 },   // 0x62 'b'
+  {  1273,  12,  11,  14,    2,  -10 },   // 0x63 'c'
+  {  1288,  14,  15,  14,    2,  -14 },   // 0x64 'd'
+  {  1313,  12,  11,  14,    2,  -10 },   // 0x65 'e'
+  {  1325,  15,  15,  14,    2,  -14 },   // 0x66 'f'
+  {  1341,  14,  16,  14,    2,  -10 },   // 0x67 'g'
+  {  1367,  13,  15,  14,    1,  -14 },   // 0x68 'h'
+  {  1391,  11,  14,  14,    2,  -13 },   // 0x69 'i'
+  {  1404,  12,  19,  14,    1,  -13 },   // 0x6A 'j'
+  {  1423,  14,  15,  14,    1,  -14 },   // 0x6B 'k'
+  {  1446,  11,  15,  14,    2,  -14 },   // 0x6C 'l'
+  {  1461,  15,  11,  14,    0,  -10 },   // 0x6D 'm'
+  {  1490,  13,  11,  14,    1,  -10 },   // 0x6E 'n'
+  {  1510,  12,  11,  14,    2,  -10 },   // 0x6F 'o'
+  {  1525,  16,  16,  14,   -1,  -10 },   // 0x70 'p'
+  {  1551,  15,  16,  14,    1,  -10 },   // 0x71 'q'
+  {  1577,  14,  11,  14,    1,  -10 },   // 0x72 'r'
+  {  1591,  12,  11,  14,    2,  -10 },   // 0x73 's'
+  {  1607,  10,  14,  14,    2,  -13 },   // 0x74 't'
+  {  1622,  12,  11,  14,    2,  -10 },   // 0x75 'u'
+  {  1642,  15,  11,  14,    1,  -10 },   // 0x76 'v'
+  {  1662,  14,  11,  14,    2,  -10 },   // 0x77 'w'
+  {  1685,  14,  11,  14,    1,  -10 },   // 0x78 'x'
+  {  1704,  16,  16,  14,    0,  -10 },   // 0x79 'y'
+  {  1728,  12,  11,  14,    2,  -10 },   // 0x7A 'z'
+  {  1744,  10,  19,  14,    4,  -14 },   // 0x7B '{'
+  {  1764,   6,  19,  14,    5,  -14 },   // 0x7C '|'
+  {  1784,   9,  19,  14,    3,  -14 },   // 0x7D '}'
+  {  1804,  12,   4,  14,    3,   -7 } }; // 0x7E '~'
+
+const GFXfontPacked FreeMonoBoldOblique12pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeMonoBoldOblique12pt7bPackedRuns,
+    (GFXglyph *)FreeMonoBoldOblique12pt7bPackedGlyphs,
+    0x20, 0x7E, 24 } };
+
+// Approx. 2485 bytes
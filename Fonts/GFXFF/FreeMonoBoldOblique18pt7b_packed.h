@@ -0,0 +1,339 @@
+// FreeMonoBoldOblique18pt7b as run lengths, generated by Tools/GFX_pack from FreeMonoBoldOblique18pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeMonoBoldOblique18pt7bPackedRuns[] PROGMEM = {
+  0x44, 0x55, 0x36, 0x36, 0x35, 0x45, 0x36, 0x35, 0x45, 0x45, 0x44, 0x54,
+  0x45, 0x44, 0x54, 0x62, 0xF0, 0x35, 0x54, 0x54, 0x55, 0x35, 0x05, 0x38,
+  0x43, 0x14, 0x34, 0x14, 0x34, 0x13, 0x43, 0x23, 0x43, 0x22, 0x53, 0x22,
+  0x52, 0x32, 0x52, 0x31, 0x62, 0x30, 0x83, 0x33, 0x84, 0x24, 0x83, 0x33,
+  0x93, 0x33, 0x84, 0x24, 0x84, 0x24, 0x83, 0x33, 0x6F, 0x02, 0xF1, 0x2F,
+  0x12, 0xF0, 0x54, 0x24, 0x84, 0x24, 0x83, 0x33, 0x5F, 0x03, 0xF1, 0x2F,
+  0x12, 0xF0, 0x54, 0x24, 0x84, 0x24, 0x83, 0x33, 0x84, 0x24, 0x84, 0x24,
+  0x83, 0x33, 0x93, 0x33, 0x80, 0xA3, 0xF0, 0x3E, 0x4D, 0x6A, 0xB6, 0xD4,
+  0xD5, 0x45, 0x44, 0x46, 0x44, 0x4E, 0x5D, 0x9A, 0xA9, 0xAC, 0x7E, 0x43,
+  0x38, 0x42, 0x48, 0x42, 0x55, 0x53, 0xF0, 0x3E, 0x4D, 0x52, 0x27, 0xC3,
+  0xF0, 0x3E, 0x4E, 0x4F, 0x02, 0xB0, 0x64, 0xA7, 0x83, 0x33, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x53, 0x63, 0x33, 0x87, 0x42, 0x44, 0x35, 0x77, 0x67,
+  0x67, 0x85, 0x34, 0x41, 0x57, 0x83, 0x33, 0x63, 0x52, 0x62, 0x62, 0x62,
+  0x53, 0x63, 0x33, 0x87, 0xA4, 0x60, 0x94, 0x11, 0x89, 0x6A, 0x5A, 0x55,
+  0x23, 0x64, 0xC4, 0xC4, 0xD4, 0xA6, 0x98, 0x79, 0x24, 0x14, 0x2D, 0x38,
+  0x14, 0x37, 0x24, 0x45, 0x3F, 0x01, 0xF0, 0x2E, 0x46, 0x14, 0x20, 0x14,
+  0x18, 0x14, 0x14, 0x13, 0x23, 0x23, 0x22, 0x32, 0x30, 0x73, 0x64, 0x64,
+  0x54, 0x54, 0x64, 0x54, 0x63, 0x64, 0x64, 0x54, 0x64, 0x64, 0x54, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x64, 0x64, 0x65, 0x55, 0x63,
+  0x50, 0x53, 0x64, 0x65, 0x55, 0x64, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x54, 0x64, 0x64, 0x63, 0x64, 0x64, 0x54, 0x64, 0x54,
+  0x54, 0x64, 0x54, 0x63, 0x70, 0x82, 0xC4, 0xB3, 0xC3, 0x71, 0x34, 0x6F,
+  0xE1, 0xD4, 0x97, 0x68, 0x86, 0x41, 0x45, 0x43, 0x44, 0x43, 0x45, 0x16,
+  0x15, 0x93, 0xE4, 0xE4, 0xE4, 0xE3, 0xF0, 0x3E, 0x47, 0xF2, 0x1F, 0xFF,
+  0x87, 0x4E, 0x4E, 0x3F, 0x03, 0xF0, 0x3E, 0x4E, 0x3F, 0x03, 0xA0, 0x45,
+  0x44, 0x44, 0x53, 0x54, 0x53, 0x53, 0x62, 0x63, 0x62, 0x70, 0x0F, 0x21,
+  0xFF, 0xF8, 0x10, 0x13, 0x1F, 0x01, 0x31, 0xF3, 0x3F, 0x24, 0xF2, 0x3F,
+  0x24, 0xF1, 0x4F, 0x14, 0xF2, 0x4F, 0x14, 0xF1, 0x4F, 0x24, 0xF1, 0x4F,
+  0x14, 0xF2, 0x4F, 0x14, 0xF1, 0x4F, 0x23, 0xF2, 0x4F, 0x14, 0xF2, 0x3F,
+  0x24, 0xF1, 0x4F, 0x14, 0xF2, 0x4F, 0x14, 0xF1, 0x4F, 0x24, 0xF1, 0x4F,
+  0x32, 0xF3, 0x86, 0x99, 0x7B, 0x5C, 0x45, 0x36, 0x24, 0x65, 0x24, 0x74,
+  0x14, 0x84, 0x14, 0x84, 0x13, 0x93, 0x23, 0x84, 0x14, 0x83, 0x24, 0x83,
+  0x23, 0x93, 0x24, 0x74, 0x24, 0x74, 0x24, 0x73, 0x34, 0x64, 0x35, 0x44,
+  0x5C, 0x5B, 0x79, 0x96, 0x80, 0x95, 0x87, 0x77, 0x69, 0x64, 0x14, 0x62,
+  0x34, 0xB3, 0xC3, 0xB4, 0xB4, 0xB4, 0xB3, 0xC3, 0xB4, 0xB4, 0xB4, 0xB3,
+  0xC3, 0x6F, 0xFE, 0x1E, 0xB5, 0xD9, 0xAB, 0x8D, 0x64, 0x55, 0x54, 0x74,
+  0x54, 0x74, 0x53, 0x84, 0xF0, 0x4F, 0x05, 0xE5, 0xE5, 0xD6, 0xD6, 0xC7,
+  0xC7, 0xC6, 0xC6, 0xD6, 0x63, 0x4F, 0x14, 0xF1, 0x4F, 0x13, 0xF1, 0x40,
+  0x87, 0x9A, 0x7C, 0x5E, 0x43, 0x65, 0xE4, 0xE4, 0xD5, 0xD4, 0xA7, 0xA7,
+  0xB6, 0xC8, 0xE5, 0xE4, 0xE4, 0xE4, 0xD4, 0xC6, 0x3E, 0x3E, 0x4D, 0x79,
+  0x70, 0xB5, 0xA6, 0x97, 0x87, 0x97, 0x84, 0x13, 0x74, 0x14, 0x64, 0x24,
+  0x54, 0x33, 0x54, 0x43, 0x44, 0x44, 0x34, 0x54, 0x2F, 0x01, 0xF0, 0x1F,
+  0x01, 0xEB, 0x3A, 0x87, 0x97, 0x97, 0x83, 0x5D, 0x5D, 0x5D, 0x4D, 0x54,
+  0xE4, 0xE3, 0xF0, 0x31, 0x58, 0xC6, 0xD5, 0xE4, 0x45, 0x5E, 0x4E, 0x4E,
+  0x4E, 0x4D, 0x43, 0x27, 0x62, 0xF0, 0x3E, 0x5C, 0x87, 0x80, 0xC6, 0xAA,
+  0x8B, 0x6C, 0x67, 0xB6, 0xC5, 0xD5, 0xE4, 0xE5, 0x25, 0x74, 0x18, 0x6E,
+  0x4F, 0x13, 0x74, 0x53, 0x57, 0x43, 0x48, 0x43, 0x48, 0x43, 0x47, 0x44,
+  0x55, 0x54, 0xE6, 0xC8, 0xAA, 0x79, 0x1F, 0x01, 0xFF, 0xF6, 0x83, 0xC4,
+  0xC3, 0xC4, 0xB4, 0xC3, 0xC4, 0xC3, 0xC4, 0xC3, 0xC4, 0xB4, 0xC4, 0xB4,
+  0xC3, 0xC4, 0xC3, 0xD3, 0xA0, 0x96, 0xBA, 0x8C, 0x6E, 0x45, 0x55, 0x35,
+  0x74, 0x34, 0x84, 0x34, 0x84, 0x34, 0x74, 0x45, 0x54, 0x6C, 0x8A, 0x8B,
+  0x6E, 0x46, 0x55, 0x34, 0x84, 0x24, 0x94, 0x24, 0x85, 0x25, 0x65, 0x3F,
+  0x14, 0xE6, 0xBA, 0x78, 0x96, 0xA9, 0x8B, 0x6C, 0x55, 0x45, 0x44, 0x64,
+  0x34, 0x74, 0x34, 0x74, 0x34, 0x74, 0x34, 0x65, 0x35, 0x37, 0x3E, 0x5D,
+  0x67, 0x14, 0x75, 0x14, 0xD5, 0xC5, 0xC5, 0xB6, 0x6B, 0x6B, 0x79, 0xA6,
+  0xB0, 0x33, 0x35, 0x25, 0x25, 0x33, 0xFF, 0xE3, 0x35, 0x25, 0x25, 0x33,
+  0x30, 0x73, 0x75, 0x65, 0x65, 0x64, 0xFF, 0xFF, 0xC4, 0x64, 0x74, 0x64,
+  0x73, 0x73, 0x83, 0x73, 0x82, 0x83, 0xF4, 0xFF, 0x33, 0xC6, 0xA7, 0x97,
+  0x97, 0x88, 0x88, 0x97, 0xD7, 0xD7, 0xC7, 0xD7, 0xD7, 0xD5, 0xE3, 0x30,
+  0x2F, 0x21, 0xF3, 0x1F, 0x32, 0xF1, 0xFF, 0xAF, 0x21, 0xF3, 0x1F, 0x31,
+  0xF2, 0x20, 0xF7, 0x3F, 0x06, 0xE7, 0xE7, 0xD7, 0xE7, 0xE7, 0xD7, 0xA7,
+  0xA7, 0x98, 0x97, 0xA7, 0xC5, 0xE3, 0xF1, 0x56, 0x5A, 0x3C, 0x1F, 0x35,
+  0x87, 0x77, 0x4A, 0x49, 0x47, 0x74, 0x85, 0x85, 0x68, 0x4A, 0x3F, 0xA3,
+  0xA5, 0x95, 0x95, 0xA3, 0xA0, 0xA5, 0xB9, 0x8A, 0x74, 0x44, 0x53, 0x73,
+  0x43, 0x83, 0x34, 0x83, 0x33, 0x83, 0x42, 0x75, 0x33, 0x48, 0x33, 0x38,
+  0x43, 0x24, 0x23, 0x42, 0x24, 0x33, 0x33, 0x23, 0x43, 0x33, 0x23, 0x43,
+  0x33, 0x24, 0x32, 0x43, 0x29, 0x33, 0x49, 0x23, 0x58, 0x23, 0xF0, 0x3F,
+  0x03, 0xF0, 0x4F, 0x04, 0x52, 0x7B, 0x89, 0xA6, 0x90, 0x7A, 0xCA, 0xCA,
+  0xCA, 0xF0, 0x8E, 0x8D, 0x41, 0x4D, 0x32, 0x4C, 0x42, 0x4B, 0x44, 0x4A,
+  0x44, 0x49, 0x45, 0x48, 0xE8, 0xE7, 0xF1, 0x5F, 0x25, 0x49, 0x43, 0x84,
+  0xF3, 0x4F, 0x34, 0xF2, 0x58, 0x10, 0x4E, 0x7F, 0x14, 0xF2, 0x5F, 0x26,
+  0x37, 0x56, 0x38, 0x45, 0x48, 0x45, 0x46, 0x56, 0xE7, 0xD7, 0xF0, 0x6F,
+  0x15, 0x38, 0x64, 0x3A, 0x44, 0x3A, 0x43, 0x4A, 0x43, 0x49, 0x42, 0xF4,
+  0x1F, 0x42, 0xF3, 0x3F, 0x15, 0x97, 0x22, 0x8E, 0x5F, 0x14, 0xF2, 0x36,
+  0x56, 0x35, 0x94, 0x34, 0xA4, 0x25, 0xA3, 0x34, 0xF2, 0x4F, 0x14, 0xF2,
+  0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x5A, 0x34, 0x66, 0x54, 0xF1, 0x6E,
+  0x8C, 0xB8, 0x80, 0x4D, 0x8E, 0x6F, 0x16, 0xF1, 0x64, 0x65, 0x63, 0x85,
+  0x53, 0x94, 0x44, 0x94, 0x44, 0x94, 0x43, 0xA4, 0x43, 0xA4, 0x43, 0xA4,
+  0x34, 0x94, 0x44, 0x94, 0x43, 0x95, 0x43, 0x85, 0x44, 0x75, 0x4F, 0x14,
+  0xF1, 0x5F, 0x06, 0xD8, 0x5F, 0x24, 0xF3, 0x4F, 0x34, 0xF3, 0x64, 0x84,
+  0x64, 0x83, 0x74, 0x33, 0x23, 0x73, 0x34, 0x22, 0x8A, 0xBB, 0xBA, 0xCA,
+  0xC3, 0x34, 0xB4, 0x33, 0xC4, 0x93, 0x64, 0x93, 0x63, 0x94, 0x3F, 0x43,
+  0xF3, 0x3F, 0x44, 0xF3, 0x30, 0x5F, 0x34, 0xF4, 0x4F, 0x35, 0xF3, 0x74,
+  0x93, 0x73, 0x94, 0x73, 0x42, 0x33, 0x74, 0x33, 0x33, 0x7A, 0xDA, 0xDA,
+  0xDA, 0xC4, 0x33, 0xD4, 0x33, 0xD3, 0xF5, 0x3F, 0x44, 0xF2, 0xBB, 0xCB,
+  0xCB, 0xBC, 0xA6, 0x32, 0x7E, 0x6F, 0x05, 0xF1, 0x46, 0x64, 0x45, 0x93,
+  0x35, 0xA2, 0x44, 0xF1, 0x4F, 0x24, 0xF2, 0x4F, 0x23, 0x6A, 0x14, 0x5B,
+  0x14, 0x5B, 0x14, 0x69, 0x24, 0xB3, 0x36, 0x84, 0x4F, 0x24, 0xF1, 0x7C,
+  0xB8, 0x80, 0x67, 0x37, 0x58, 0x28, 0x58, 0x28, 0x57, 0x37, 0x74, 0x74,
+  0x83, 0x83, 0x93, 0x83, 0x84, 0x74, 0x84, 0x74, 0x8E, 0x9E, 0x9E, 0x8F,
+  0x08, 0x47, 0x48, 0x38, 0x39, 0x38, 0x38, 0x47, 0x46, 0x83, 0x84, 0x82,
+  0x93, 0x92, 0x94, 0x73, 0x84, 0x5E, 0x4F, 0x04, 0xF0, 0x4E, 0xA4, 0xF0,
+  0x3F, 0x13, 0xF1, 0x3F, 0x04, 0xF0, 0x4F, 0x03, 0xF1, 0x3F, 0x04, 0xF0,
+  0x4F, 0x04, 0xF0, 0x3F, 0x13, 0xAE, 0x4F, 0x04, 0xF0, 0x5E, 0x40, 0xAD,
+  0x9E, 0x9E, 0x9D, 0xF1, 0x3F, 0x53, 0xF5, 0x3F, 0x44, 0xF4, 0x4F, 0x43,
+  0xF5, 0x39, 0x1A, 0x38, 0x38, 0x47, 0x48, 0x47, 0x48, 0x38, 0x38, 0x48,
+  0x37, 0x57, 0xF0, 0x8E, 0xAC, 0xE6, 0xD0, 0x58, 0x36, 0x5A, 0x18, 0x49,
+  0x27, 0x59, 0x27, 0x74, 0x54, 0xA3, 0x45, 0xB3, 0x35, 0xB4, 0x24, 0xD9,
+  0xE8, 0xF0, 0x9E, 0xAC, 0x52, 0x5B, 0x44, 0x4B, 0x35, 0x5A, 0x36, 0x49,
+  0x46, 0x47, 0x93, 0x73, 0xA4, 0x63, 0xA4, 0x63, 0x95, 0x54, 0x4B, 0x9C,
+  0x7C, 0x9B, 0xC4, 0xF1, 0x4F, 0x13, 0xF2, 0x3F, 0x14, 0xF1, 0x4F, 0x13,
+  0xF2, 0x3F, 0x14, 0x82, 0x64, 0x74, 0x54, 0x74, 0x53, 0x83, 0x63, 0x83,
+  0x2F, 0x31, 0xF4, 0x1F, 0x41, 0xF3, 0x20, 0x46, 0x96, 0x46, 0x96, 0x38,
+  0x77, 0x47, 0x67, 0x66, 0x66, 0x76, 0x57, 0x68, 0x38, 0x68, 0x37, 0x73,
+  0x14, 0x24, 0x13, 0x73, 0x14, 0x14, 0x14, 0x73, 0x28, 0x14, 0x64, 0x27,
+  0x24, 0x64, 0x26, 0x33, 0x73, 0x36, 0x33, 0x73, 0x44, 0x34, 0x73, 0x43,
+  0x44, 0x64, 0xB3, 0x68, 0x58, 0x39, 0x49, 0x39, 0x49, 0x38, 0x58, 0x40,
+  0x46, 0x58, 0x47, 0x59, 0x37, 0x49, 0x48, 0x48, 0x66, 0x73, 0x87, 0x54,
+  0x87, 0x54, 0x79, 0x43, 0x84, 0x14, 0x43, 0x83, 0x24, 0x34, 0x83, 0x25,
+  0x24, 0x74, 0x34, 0x24, 0x74, 0x35, 0x13, 0x84, 0x44, 0x13, 0x83, 0x58,
+  0x83, 0x67, 0x74, 0x67, 0x68, 0x45, 0x69, 0x45, 0x69, 0x45, 0x68, 0x64,
+  0x60, 0x96, 0xCA, 0x8D, 0x6F, 0x04, 0x64, 0x63, 0x58, 0x52, 0x49, 0x51,
+  0x5A, 0x41, 0x4B, 0x8C, 0x8C, 0x8C, 0x8B, 0x41, 0x4A, 0x51, 0x59, 0x42,
+  0x58, 0x53, 0x55, 0x64, 0xF0, 0x6D, 0x8A, 0xC6, 0x90, 0x4D, 0x8F, 0x05,
+  0xF2, 0x5F, 0x26, 0x37, 0x56, 0x38, 0x45, 0x48, 0x45, 0x48, 0x45, 0x38,
+  0x46, 0x37, 0x55, 0xF0, 0x6E, 0x7D, 0x8B, 0xA3, 0xF2, 0x4F, 0x24, 0xF0,
+  0xB9, 0xC9, 0xC9, 0xBA, 0x96, 0xCA, 0x8D, 0x6F, 0x04, 0x64, 0x63, 0x58,
+  0x52, 0x49, 0x51, 0x5A, 0x41, 0x4B, 0x8C, 0x8C, 0x8C, 0x8B, 0x41, 0x4A,
+  0x51, 0x59, 0x42, 0x58, 0x53, 0x55, 0x64, 0xF0, 0x6D, 0x8A, 0xC6, 0xC8,
+  0x32, 0x6F, 0x04, 0xF0, 0x5F, 0x05, 0x45, 0x46, 0x5C, 0x9F, 0x07, 0xF1,
+  0x6F, 0x27, 0x46, 0x57, 0x38, 0x47, 0x38, 0x46, 0x47, 0x56, 0x45, 0x67,
+  0xE8, 0xD9, 0xBA, 0xD9, 0x44, 0x59, 0x36, 0x58, 0x37, 0x47, 0x47, 0x54,
+  0x95, 0xF2, 0x5F, 0x26, 0xF0, 0x75, 0x10, 0x95, 0x23, 0x6D, 0x5E, 0x4E,
+  0x55, 0x45, 0x44, 0x74, 0x44, 0x73, 0x54, 0xF0, 0x5E, 0x9B, 0xB9, 0xBC,
+  0x84, 0x19, 0x52, 0x49, 0x42, 0x49, 0x42, 0x65, 0x53, 0xF1, 0x3F, 0x04,
+  0xEA, 0x68, 0x1F, 0x31, 0xF3, 0x1F, 0x31, 0xF7, 0x43, 0x48, 0x43, 0x43,
+  0x14, 0x34, 0x43, 0x13, 0x44, 0x34, 0x13, 0x43, 0x52, 0x93, 0xF0, 0x4F,
+  0x04, 0xF0, 0x4F, 0x03, 0xF1, 0x3F, 0x04, 0xF0, 0x4B, 0xB7, 0xD6, 0xD6,
+  0xC7, 0x18, 0x38, 0x29, 0x29, 0x19, 0x19, 0x28, 0x38, 0x34, 0x84, 0x53,
+  0x94, 0x53, 0x94, 0x44, 0x93, 0x54, 0x93, 0x54, 0x84, 0x53, 0x94, 0x53,
+  0x93, 0x54, 0x93, 0x54, 0x93, 0x54, 0x84, 0x55, 0x73, 0x66, 0x45, 0x7D,
+  0x8C, 0xAA, 0xD6, 0xB0, 0x18, 0x68, 0x19, 0x4F, 0x44, 0x91, 0x85, 0x84,
+  0x3A, 0x46, 0x49, 0x37, 0x48, 0x47, 0x47, 0x48, 0x47, 0x3A, 0x45, 0x4A,
+  0x44, 0x4B, 0x44, 0x3C, 0x43, 0x4C, 0x42, 0x4E, 0x41, 0x4E, 0x8F, 0x07,
+  0xF1, 0x7F, 0x25, 0xF3, 0x4F, 0x44, 0xD0, 0x18, 0x4F, 0x43, 0xF3, 0x4F,
+  0x34, 0x82, 0x4B, 0x43, 0x43, 0x44, 0x34, 0x43, 0x44, 0x34, 0x42, 0x53,
+  0x44, 0x42, 0x62, 0x35, 0x41, 0x71, 0x45, 0x41, 0x71, 0x45, 0x31, 0x81,
+  0x36, 0x31, 0x31, 0x86, 0x71, 0x86, 0x63, 0x66, 0x73, 0x66, 0x64, 0x66,
+  0x64, 0x57, 0x55, 0x57, 0x55, 0x57, 0x46, 0x48, 0x56, 0x66, 0x58, 0x48,
+  0x48, 0x47, 0x57, 0x57, 0x74, 0x65, 0xA4, 0x44, 0xC5, 0x24, 0xE4, 0x14,
+  0xF1, 0x7F, 0x26, 0xF3, 0x5F, 0x37, 0xF1, 0x9E, 0x51, 0x4D, 0x52, 0x5B,
+  0x54, 0x59, 0x56, 0x47, 0x75, 0x74, 0x93, 0x84, 0x84, 0x84, 0x84, 0x75,
+  0x16, 0x57, 0x18, 0x4F, 0x14, 0x71, 0x75, 0x73, 0x46, 0x47, 0x44, 0x48,
+  0x43, 0x59, 0x41, 0x5A, 0x9C, 0x7D, 0x6F, 0x04, 0xF1, 0x3F, 0x14, 0xF1,
+  0x4F, 0x14, 0xF1, 0x3D, 0xB8, 0xD7, 0xC8, 0xC8, 0x5E, 0x5E, 0x4F, 0x04,
+  0xF0, 0x44, 0x55, 0x53, 0x55, 0x63, 0x45, 0x72, 0x45, 0xD5, 0xD5, 0xD5,
+  0xD5, 0xD5, 0xD5, 0x53, 0x55, 0x63, 0x45, 0x64, 0x35, 0x74, 0x2F, 0x22,
+  0xF1, 0x3F, 0x13, 0xF1, 0x30, 0x58, 0x58, 0x58, 0x57, 0x63, 0x94, 0x94,
+  0x93, 0xA3, 0x94, 0x94, 0x94, 0x93, 0xA3, 0x94, 0x94, 0x93, 0xA3, 0xA3,
+  0x94, 0x94, 0x93, 0xA3, 0x98, 0x58, 0x58, 0x57, 0x60, 0x03, 0x73, 0x74,
+  0x64, 0x64, 0x73, 0x74, 0x64, 0x64, 0x73, 0x74, 0x64, 0x64, 0x73, 0x74,
+  0x64, 0x64, 0x73, 0x74, 0x64, 0x64, 0x74, 0x64, 0x64, 0x73, 0x74, 0x64,
+  0x72, 0x10, 0x58, 0x58, 0x57, 0x67, 0x94, 0x94, 0x94, 0x93, 0xA3, 0x94,
+  0x94, 0x93, 0xA3, 0x94, 0x94, 0x94, 0x93, 0xA3, 0x94, 0x94, 0x93, 0xA3,
+  0xA3, 0x67, 0x58, 0x57, 0x67, 0x60, 0x91, 0xD2, 0xC4, 0x97, 0x78, 0x6A,
+  0x45, 0x25, 0x25, 0x44, 0x15, 0x59, 0x76, 0xA2, 0x10, 0x0F, 0xFF, 0xFF,
+  0x90, 0x02, 0x44, 0x33, 0x43, 0x34, 0x42, 0x87, 0xAB, 0x7D, 0x6D, 0xF0,
+  0x47, 0xC5, 0xE4, 0xE4, 0xF0, 0x35, 0x74, 0x25, 0x84, 0x24, 0x66, 0x3F,
+  0xF8, 0x1F, 0x33, 0x72, 0x61, 0x56, 0xF0, 0x7F, 0x06, 0xF1, 0x6F, 0x43,
+  0xF3, 0x4F, 0x34, 0x26, 0xA3, 0x1A, 0x8F, 0x06, 0xF1, 0x66, 0x56, 0x54,
+  0x85, 0x53, 0xA4, 0x53, 0xA4, 0x43, 0xB4, 0x43, 0xA4, 0x54, 0x85, 0x55,
+  0x65, 0x3F, 0x42, 0xF4, 0x3F, 0x26, 0x53, 0x67, 0x87, 0x22, 0x5E, 0x4F,
+  0x03, 0xF1, 0x26, 0x64, 0x25, 0x93, 0x24, 0xA2, 0x24, 0xF0, 0x4F, 0x04,
+  0xF0, 0x4F, 0x06, 0x83, 0x3F, 0x13, 0xF0, 0x5D, 0x88, 0x70, 0xF0, 0x6E,
+  0x6F, 0x06, 0xF0, 0x6F, 0x24, 0xF2, 0x39, 0x63, 0x37, 0xA1, 0x36, 0xF0,
+  0x5F, 0x14, 0x65, 0x54, 0x58, 0x44, 0x4A, 0x33, 0x4B, 0x33, 0x4A, 0x43,
+  0x4A, 0x34, 0x49, 0x44, 0x65, 0x65, 0xF3, 0x3F, 0x34, 0xF2, 0x66, 0x35,
+  0x30, 0x86, 0x9B, 0x6D, 0x4E, 0x35, 0x56, 0x23, 0x94, 0x13, 0xA4, 0x1F,
+  0xFF, 0xFF, 0x18, 0x41, 0xF2, 0x2F, 0x13, 0xE6, 0xA4, 0xC8, 0xBB, 0x9C,
+  0x8C, 0x94, 0xF1, 0x4E, 0xE6, 0xF0, 0x6F, 0x06, 0xEA, 0x4F, 0x24, 0xF2,
+  0x3F, 0x33, 0xF2, 0x4F, 0x24, 0xF2, 0x3F, 0x33, 0xEE, 0x6F, 0x06, 0xF0,
+  0x6E, 0x70, 0x76, 0x26, 0x5F, 0x14, 0xF2, 0x2F, 0x33, 0x55, 0x64, 0x57,
+  0x54, 0x49, 0x34, 0x4A, 0x34, 0x4A, 0x34, 0x49, 0x44, 0x57, 0x54, 0x64,
+  0x66, 0xF0, 0x6F, 0x07, 0xE9, 0x62, 0x4F, 0x23, 0xF2, 0x4F, 0x15, 0x8C,
+  0x8C, 0x9B, 0xB8, 0xB0, 0x46, 0xE6, 0xE6, 0xE6, 0xF1, 0x4F, 0x13, 0xF2,
+  0x32, 0x59, 0xD7, 0xD7, 0xE6, 0x54, 0x56, 0x37, 0x45, 0x47, 0x36, 0x47,
+  0x36, 0x37, 0x46, 0x37, 0x45, 0x47, 0x36, 0x47, 0x34, 0x74, 0xF2, 0x3F,
+  0x23, 0x81, 0x74, 0x71, 0x94, 0xC4, 0xC4, 0xC4, 0xFF, 0x98, 0x88, 0x79,
+  0x88, 0xC4, 0xC3, 0xD3, 0xC4, 0xC4, 0xC4, 0xC3, 0xD3, 0x6F, 0xFF, 0xF3,
+  0x10, 0xD4, 0xE4, 0xD5, 0xD4, 0xFF, 0xDD, 0x4D, 0x5D, 0x6C, 0xE4, 0xE4,
+  0xE3, 0xF0, 0x3E, 0x4E, 0x4E, 0x3F, 0x03, 0xF0, 0x3E, 0x4E, 0x4E, 0x3F,
+  0x03, 0xE4, 0xD5, 0x5C, 0x5C, 0x6B, 0x88, 0x90, 0x56, 0xD7, 0xD7, 0xE5,
+  0xF2, 0x3F, 0x14, 0xF1, 0x42, 0x86, 0x42, 0x86, 0x32, 0x96, 0x33, 0x76,
+  0x41, 0x69, 0x9B, 0x8C, 0x7D, 0x8B, 0xAA, 0x41, 0x69, 0x33, 0x65, 0x64,
+  0x82, 0x64, 0x81, 0x73, 0x92, 0x64, 0x72, 0x68, 0x79, 0x78, 0x88, 0xC4,
+  0xC4, 0xC4, 0xC3, 0xD3, 0xC4, 0xC4, 0xC3, 0xD3, 0xC4, 0xC4, 0xC4, 0xC3,
+  0xD3, 0x6F, 0xFF, 0xF3, 0x10, 0x35, 0x15, 0x34, 0x4F, 0x53, 0xF6, 0x2F,
+  0x64, 0x43, 0x53, 0x44, 0x34, 0x35, 0x43, 0x44, 0x35, 0x43, 0x44, 0x35,
+  0x34, 0x34, 0x45, 0x34, 0x34, 0x44, 0x44, 0x34, 0x35, 0x43, 0x44, 0x35,
+  0x33, 0x63, 0x44, 0xC2, 0x63, 0xC2, 0x62, 0xD2, 0x53, 0x51, 0x45, 0x35,
+  0x76, 0x19, 0x5F, 0x15, 0xF2, 0x66, 0x45, 0x55, 0x74, 0x54, 0x83, 0x64,
+  0x83, 0x63, 0x84, 0x63, 0x84, 0x54, 0x83, 0x64, 0x83, 0x47, 0x66, 0x19,
+  0x4F, 0x24, 0x81, 0x75, 0x71, 0x77, 0x9A, 0x7D, 0x4E, 0x35, 0x56, 0x15,
+  0x75, 0x14, 0x98, 0xA8, 0xA8, 0x94, 0x15, 0x75, 0x16, 0x55, 0x3F, 0x03,
+  0xD6, 0xB9, 0x77, 0x55, 0x36, 0x86, 0x1A, 0x6F, 0x35, 0xF3, 0x76, 0x56,
+  0x64, 0x94, 0x63, 0xA4, 0x63, 0xA4, 0x53, 0xB4, 0x54, 0x94, 0x64, 0x85,
+  0x65, 0x65, 0x6F, 0x26, 0xF1, 0x74, 0x19, 0x93, 0x36, 0xB3, 0xF4, 0x4F,
+  0x44, 0xF2, 0x9D, 0xBC, 0xAD, 0xAD, 0x76, 0x35, 0x6F, 0x23, 0xF4, 0x2F,
+  0x43, 0x56, 0x55, 0x58, 0x45, 0x4A, 0x34, 0x4B, 0x34, 0x4A, 0x35, 0x4A,
+  0x35, 0x58, 0x45, 0x65, 0x66, 0xF1, 0x6F, 0x08, 0xA1, 0x3A, 0x62, 0x4F,
+  0x34, 0xF3, 0x4F, 0x33, 0xF0, 0x9C, 0xBB, 0xBB, 0xA5, 0x46, 0x44, 0x57,
+  0x28, 0x3F, 0x23, 0xF1, 0x78, 0xC6, 0xE4, 0xF0, 0x4F, 0x14, 0xF1, 0x3F,
+  0x23, 0xF1, 0x4C, 0xE6, 0xF0, 0x5E, 0x6E, 0x60, 0x66, 0x22, 0x4C, 0x2E,
+  0x2E, 0x15, 0x63, 0x24, 0xCA, 0x7C, 0x5D, 0xA6, 0x13, 0x89, 0x6F, 0x51,
+  0xE2, 0xD7, 0x75, 0x52, 0xD4, 0xC4, 0xC3, 0xD3, 0xAE, 0x1F, 0x01, 0xF0,
+  0x1E, 0x53, 0xC4, 0xC4, 0xC3, 0xD3, 0xD3, 0xC4, 0xC5, 0x63, 0x2F, 0x01,
+  0xE3, 0xC6, 0x75, 0x15, 0x6C, 0x5C, 0x6C, 0x66, 0x24, 0x93, 0x24, 0x93,
+  0x24, 0x84, 0x24, 0x84, 0x24, 0x83, 0x34, 0x83, 0x34, 0x74, 0x34, 0x56,
+  0x3F, 0x12, 0xF1, 0x3F, 0x05, 0x52, 0x52, 0x18, 0x4F, 0x23, 0xF3, 0x3F,
+  0x33, 0x84, 0x47, 0x46, 0x46, 0x47, 0x45, 0x49, 0x44, 0x3A, 0x43, 0x4A,
+  0x42, 0x4B, 0x42, 0x3D, 0x8D, 0x7E, 0x6F, 0x15, 0xF1, 0x4B, 0x16, 0x76,
+  0x17, 0x6F, 0x06, 0x71, 0x67, 0x72, 0x43, 0x34, 0x34, 0x42, 0x52, 0x44,
+  0x42, 0x52, 0x35, 0x41, 0x61, 0x45, 0x41, 0x61, 0x36, 0xF0, 0x67, 0x16,
+  0x76, 0x26, 0x76, 0x26, 0x75, 0x35, 0x85, 0x35, 0x84, 0x53, 0x80, 0x47,
+  0x37, 0x38, 0x37, 0x38, 0x28, 0x46, 0x47, 0x56, 0x25, 0x9B, 0xB9, 0xD6,
+  0xF0, 0x6D, 0x9B, 0x51, 0x59, 0x53, 0x56, 0x65, 0x53, 0x92, 0x91, 0x92,
+  0x91, 0x83, 0x82, 0x57, 0x57, 0x48, 0x48, 0x48, 0x48, 0x56, 0x57, 0x74,
+  0x74, 0x94, 0x74, 0x94, 0x64, 0xB4, 0x44, 0xC4, 0x43, 0xD4, 0x34, 0xE4,
+  0x14, 0xF0, 0x8F, 0x17, 0xF3, 0x6F, 0x35, 0xF4, 0x4F, 0x53, 0xF5, 0x3F,
+  0x54, 0xEB, 0xCD, 0xBC, 0xDB, 0xC0, 0x3F, 0x03, 0xF0, 0x3E, 0x3F, 0x03,
+  0x45, 0x54, 0x34, 0x5C, 0x5C, 0x5B, 0x5C, 0x5C, 0x5C, 0x55, 0x42, 0xF1,
+  0x2F, 0x12, 0xF0, 0x3F, 0x03, 0x84, 0x75, 0x66, 0x56, 0x64, 0x83, 0x84,
+  0x84, 0x83, 0x93, 0x84, 0x83, 0x66, 0x65, 0x75, 0x76, 0x84, 0x84, 0x83,
+  0x93, 0x84, 0x84, 0x84, 0x86, 0x66, 0x75, 0x83, 0x60, 0x61, 0x63, 0x53,
+  0x44, 0x44, 0x43, 0x53, 0x53, 0x44, 0x44, 0x43, 0x53, 0x53, 0x44, 0x44,
+  0x43, 0x53, 0x53, 0x44, 0x44, 0x43, 0x53, 0x53, 0x44, 0x44, 0x43, 0x53,
+  0x50, 0x73, 0x95, 0x86, 0x76, 0x94, 0x94, 0x94, 0x93, 0xA3, 0x94, 0x94,
+  0x94, 0x96, 0x85, 0x85, 0x76, 0x64, 0x93, 0xA3, 0x94, 0x94, 0x93, 0x94,
+  0x67, 0x66, 0x66, 0x84, 0x80, 0x44, 0xB7, 0x99, 0x4E, 0x28, 0x2E, 0x49,
+  0x97, 0xB4, 0x40 };
+
+const GFXglyph FreeMonoBoldOblique18pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,  21,    0,    1 },   // 0x20 ' '
+  {     0,   9,  22,  21,    9,  -21 },   // 0x21 '!'
+  {    22,  12,  10,  21,    9,  -20 },   // 0x22 '"'
+  {    42,  18,  25,  21,    4,  -22 },   // 0x23 '#'
+  {    89,  18,  28,  21,    4,  -23 },   // 0x24 '$'
+  {   126,  16,  21,  21,    5,  -20 },   // 0x25 '%'
+  {   162,  16,  20,  21,    4,  -19 },   // 0x26 '&'
+  {   191,   5,  10,  21,   12,  -20 },   // 0x27 '''
+  {   201,  10,  27,  21,   11,  -21 },   // 0x28 '('
+  {   229,  10,  27,  21,    4,  -21 },   // 0x29 ')'
+  {   257,  15,  15,  21,    6,  -21 },   // 0x2A '*'
+  {   277,  18,  19,  21,    4,  -18 },   // 0x2B '+'
+  {   299,   9,  10,  21,    4,   -3 },   // 0x2C ','
+  {   310,  18,   4,  21,    4,  -11 },   // 0x2D '-'
+  {   315,   5,   5,  21,    8,   -4 },   // 0x2E '.'
+  {   319,  21,  28,  21,    2,  -23 },   // 0x2F '/'
+  {   362,  17,  23,  21,    5,  -22 },   // 0x30 '0'
+  {   401,  15,  22,  21,    3,  -21 },   // 0x31 '1'
+  {   424,  20,  23,  21,    2,  -22 },   // 0x32 '2'
+  {   456,  18,  23,  21,    3,  -22 },   // 0x33 '3'
+  {   481,  16,  21,  21,    4,  -20 },   // 0x34 '4'
+  {   511,  18,  22,  21,    4,  -21 },   // 0x35 '5'
+  {   538,  19,  23,  21,    5,  -22 },   // 0x36 '6'
+  {   570,  16,  22,  21,    6,  -21 },   // 0x37 '7'
+  {   593,  19,  23,  21,    3,  -22 },   // 0x38 '8'
+  {   628,  18,  23,  21,    4,  -22 },   // 0x39 '9'
+  {   661,   7,  16,  21,    9,  -15 },   // 0x3A ':'
+  {   673,  11,  22,  21,    4,  -15 },   // 0x3B ';'
+  {   691,  18,  16,  21,    4,  -17 },   // 0x3C '<'
+  {   708,  19,  10,  21,    3,  -14 },   // 0x3D '='
+  {   722,  19,  16,  21,    3,  -17 },   // 0x3E '>'
+  {   739,  14,  21,  21,    8,  -20 },   // 0x3F '?'
+  {   761,  18,  27,  21,    3,  -21 },   // 0x40 '@'
+  {   813,  22,  21,  21,    0,  -20 },   // 0x41 'A'
+  {   846,  21,  21,  21,    1,  -20 },   // 0x42 'B'
+  {   881,  21,  21,  21,    2,  -20 },   // 0x43 'C'
+  {   915,  21,  21,  21,    1,  -20 },   // 0x44 'D'
+  {   952,  22,  21,  21,    0,  -20 },   // 0x45 'E'
+  {   989,  23,  21,  21,    0,  -20 },   // 0x46 'F'
+  {  1022,  21,  21,  21,    2,  -20 },   // 0x47 'G'
+  {  1058,  23,  21,  21,    0,  -20 },   // 0x48 'H'
+  {  1097,  19,  21,  21,    2,  -20 },   // 0x49 'I'
+  {  1127,  23,  21,  21,    0,  -20 },   // 0x4A 'J'
+  {  1159,  23,  21,  21,    0,  -20 },   // 0x4B 'K'
+  {  1198,  20,  21,  21,    1,  -20 },   // 0x4C 'L'
+  {  1231,  25,  21,  21,    0,  -20 },   // 0x4D 'M'
+  {  1284,  24,  21,  21,    1,  -20 },   // 0x4E 'N'
+  {  1333,  20,  21,  21,    2,  -20 },   // 0x4F 'O'
+  {  1365,  21,  21,  21,    1,  -20 },   // 0x50 'P'
+  {  1396,  20,  26,  21,    2,  -20 },   // 0x51 'Q'
+  {  1436,  22,  21,  21,    0,  -20 },   // 0x52 'R'
+  {  1471,  19,  21,  21,    3,  -20 },   // 0x53 'S'
+  {  1502,  19,  21,  21,    3,  -20 },   // 0x54 'T'
+  {  1537,  21,  21,  21,    3,  -20 },   // 0x55 'U'
+  {  1576,  23,  21,  21,    1,  -20 },   // 0x56 'V'
+  {  1615,  22,  21,  21,    2,  -20 },   // 0x57 'W'
+  {  1664,  24,  21,  21,    0,  -20 },   // 0x58 'X'
+  {  1704,  20,  21,  21,    3,  -20 },   // 0x59 'Y'
+  {  1736,  19,  21,  21,    2,  -20 },   // 0x5A 'Z'
+  {  1769,  13,  27,  21,    8,  -21 },   // 0x5B '['
+  {  1797,  10,  28,  21,    8,  -23 },   // 0x5C '\'
+  {  1826,  13,  27,  21,    4,  -21 },   // 0x5D ']'
+  {  1854,  15,  11,  21,    6,  -21 },   // 0x5E '^'
+  {  1869,  21,   4,  21,   -1,    4 },   // 0x5F '_'
+  {  1873,   6,   6,  21,   10,  -22 },   // 0x60 '`'
+  {  1879,  19,  16,  21,    2,  -15 },   // 0x61 'a'
+  {  1901,  22,  22,  21,    0,  -21 },   // 0x62 'b'
+  {  1940,  19,  16,  21,    3,  -15 },   // 0x63 'c'
+  {  1966,  21,  22,  21,    3,  -21 },   // 0x64 'd'
+  {  2005,  18,  16,  21,    3,  -15 },   // 0x65 'e'
+  {  2025,  21,  22,  21,    3,  -21 },   // 0x66 'f'
+  {  2054,  21,  23,  21,    2,  -15 },   // 0x67 'g'
+  {  2092,  20,  22,  21,    1,  -21 },   // 0x68 'h'
+  {  2128,  16,  22,  21,    3,  -21 },   // 0x69 'i'
+  {  2149,  18,  29,  21,    2,  -21 },   // 0x6A 'j'
+  {  2180,  20,  22,  21,    1,  -21 },   // 0x6B 'k'
+  {  2215,  16,  22,  21,    3,  -21 },   // 0x6C 'l'
+  {  2237,  23,  16,  21,    0,  -15 },   // 0x6D 'm'
+  {  2278,  21,  16,  21,    1,  -15 },   // 0x6E 'n'
+  {  2309,  18,  16,  21,    3,  -15 },   // 0x6F 'o'
+  {  2331,  23,  23,  21,   -1,  -15 },   // 0x70 'p'
+  {  2370,  22,  23,  21,    2,  -15 },   // 0x71 'q'
+  {  2409,  20,  16,  21,    2,  -15 },   // 0x72 'r'
+  {  2432,  16,  16,  21,    4,  -15 },   // 0x73 's'
+  {  2451,  16,  21,  21,    4,  -20 },   // 0x74 't'
+  {  2475,  18,  16,  21,    3,  -15 },   // 0x75 'u'
+  {  2503,  21,  16,  21,    2,  -15 },   // 0x76 'v'
+  {  2530,  21,  16,  21,    3,  -15 },   // 0x77 'w'
+  {  2567,  21,  16,  21,    1,  -15 },   // 0x78 'x'
+  {  2595,  24,  23,  21,   -1,  -15 },   // 0x79 'y'
+  {  2634,  18,  16,  21,    3,  -15 },   // 0x7A 'z'
+  {  2657,  12,  27,  21,    8,  -21 },   // 0x7B '{'
+  {  2685,   8,  27,  21,    8,  -21 },   // 0x7C '|'
+  {  2713,  13,  27,  21,    4,  -21 },   // 0x7D '}'
+  {  2741,  17,   8,  21,    4,  -13 } }; // 0x7E '~'
+
+const GFXfontPacked FreeMonoBoldOblique18pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeMonoBoldOblique18pt7bPackedRuns,
+    (GFXglyph *)FreeMonoBoldOblique18pt7bPackedGlyphs,
+    0x20, 0x7E, 35 } };
+
+// Approx. 3423 bytes
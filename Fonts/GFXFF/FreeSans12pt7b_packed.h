@@ -0,0 +1,268 @@
+// FreeSans12pt7b as run lengths, generated by Tools/GFX_pack from FreeSans12pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeSans12pt7bPackedRuns[] PROGMEM = {
+  0x0F, 0xD4, 0x40, 0x02, 0x24, 0x24, 0x24, 0x23, 0x31, 0x11, 0x31, 0x10,
+  0x52, 0x32, 0x62, 0x31, 0x62, 0x32, 0x62, 0x32, 0x3C, 0x1C, 0x42, 0x31,
+  0x62, 0x32, 0x62, 0x32, 0x3C, 0x1C, 0x42, 0x31, 0x71, 0x32, 0x62, 0x32,
+  0x62, 0x32, 0x62, 0x32, 0x40, 0x51, 0x85, 0x49, 0x13, 0x21, 0x22, 0x12,
+  0x31, 0x34, 0x31, 0x34, 0x31, 0x53, 0x21, 0x66, 0x76, 0x71, 0x13, 0x61,
+  0x34, 0x31, 0x34, 0x31, 0x34, 0x31, 0x32, 0x12, 0x21, 0x22, 0x29, 0x45,
+  0x81, 0xA1, 0x50, 0xD2, 0x74, 0x71, 0x76, 0x52, 0x63, 0x23, 0x41, 0x72,
+  0x42, 0x32, 0x72, 0x42, 0x31, 0x83, 0x23, 0x22, 0x96, 0x22, 0xB4, 0x31,
+  0xF3, 0x23, 0x5A, 0x13, 0x78, 0x22, 0x33, 0x37, 0x13, 0x25, 0x26, 0x23,
+  0x25, 0x26, 0x14, 0x33, 0x35, 0x16, 0x76, 0x17, 0x52, 0x44, 0x96, 0x73,
+  0x23, 0x62, 0x42, 0x62, 0x42, 0x63, 0x23, 0x76, 0x93, 0x95, 0x83, 0x22,
+  0x32, 0x13, 0x42, 0x22, 0x12, 0x55, 0x22, 0x64, 0x22, 0x64, 0x23, 0x46,
+  0x28, 0x22, 0x44, 0x43, 0x09, 0x11, 0x10, 0x41, 0x31, 0x32, 0x32, 0x22,
+  0x32, 0x32, 0x22, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x41, 0x42,
+  0x32, 0x41, 0x42, 0x41, 0x42, 0x41, 0x01, 0x51, 0x42, 0x32, 0x42, 0x32,
+  0x32, 0x42, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32,
+  0x31, 0x32, 0x31, 0x32, 0x31, 0x40, 0x31, 0x61, 0x32, 0x11, 0x12, 0x15,
+  0x33, 0x32, 0x12, 0x21, 0x31, 0x10, 0x42, 0x82, 0x82, 0x82, 0x4F, 0x54,
+  0x28, 0x28, 0x28, 0x28, 0x24, 0x04, 0x11, 0x11, 0x12, 0x10, 0x0C, 0x04,
+  0x61, 0x52, 0x51, 0x61, 0x52, 0x51, 0x61, 0x52, 0x51, 0x61, 0x52, 0x51,
+  0x61, 0x52, 0x51, 0x61, 0x52, 0x51, 0x60, 0x35, 0x57, 0x33, 0x33, 0x22,
+  0x52, 0x13, 0x55, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x63, 0x12,
+  0x52, 0x23, 0x33, 0x37, 0x55, 0x30, 0x41, 0x32, 0x2D, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x35, 0x49, 0x22,
+  0x43, 0x12, 0x65, 0x72, 0x92, 0x92, 0x83, 0x73, 0x64, 0x54, 0x63, 0x72,
+  0x91, 0x92, 0x9F, 0x70, 0x26, 0x48, 0x23, 0x43, 0x12, 0x62, 0x12, 0x62,
+  0x92, 0x83, 0x55, 0x65, 0xA2, 0xA2, 0x94, 0x74, 0x72, 0x12, 0x43, 0x28,
+  0x55, 0x30, 0x72, 0x83, 0x83, 0x74, 0x62, 0x12, 0x62, 0x12, 0x52, 0x22,
+  0x42, 0x32, 0x41, 0x42, 0x32, 0x42, 0x22, 0x52, 0x2F, 0x77, 0x29, 0x29,
+  0x29, 0x22, 0x28, 0x29, 0x22, 0x92, 0x92, 0x92, 0x14, 0x48, 0x23, 0x43,
+  0x93, 0x92, 0x92, 0x92, 0x94, 0x66, 0x43, 0x28, 0x55, 0x30, 0x44, 0x58,
+  0x23, 0x42, 0x22, 0x53, 0x11, 0x92, 0x92, 0x24, 0x3A, 0x14, 0x42, 0x13,
+  0x55, 0x74, 0x74, 0x72, 0x12, 0x53, 0x13, 0x33, 0x37, 0x55, 0x30, 0x0F,
+  0x79, 0x19, 0x28, 0x29, 0x19, 0x28, 0x29, 0x28, 0x29, 0x29, 0x19, 0x29,
+  0x29, 0x28, 0x29, 0x27, 0x35, 0x57, 0x33, 0x33, 0x22, 0x52, 0x22, 0x52,
+  0x22, 0x52, 0x32, 0x32, 0x47, 0x47, 0x33, 0x33, 0x12, 0x74, 0x74, 0x74,
+  0x72, 0x12, 0x52, 0x37, 0x55, 0x30, 0x35, 0x57, 0x33, 0x33, 0x13, 0x52,
+  0x12, 0x74, 0x74, 0x74, 0x63, 0x12, 0x44, 0x1A, 0x34, 0x22, 0x92, 0x91,
+  0x12, 0x62, 0x22, 0x43, 0x28, 0x54, 0x40, 0x04, 0xF3, 0x40, 0x04, 0xF1,
+  0x41, 0x11, 0x11, 0x21, 0xF6, 0x37, 0x45, 0x55, 0x46, 0x48, 0x3A, 0x5A,
+  0x4A, 0x4A, 0x4B, 0x10, 0x0F, 0x9F, 0x9F, 0x90, 0xC3, 0xA4, 0xA5, 0x95,
+  0xA4, 0x93, 0x74, 0x54, 0x64, 0x64, 0x81, 0xB0, 0x35, 0x38, 0x13, 0x42,
+  0x12, 0x64, 0x62, 0x82, 0x82, 0x72, 0x73, 0x63, 0x63, 0x72, 0x82, 0x82,
+  0xFD, 0x28, 0x24, 0x87, 0xDB, 0x94, 0x65, 0x63, 0xA4, 0x43, 0xD2, 0x42,
+  0x54, 0x62, 0x22, 0x56, 0x12, 0x23, 0x12, 0x42, 0x43, 0x44, 0x42, 0x53,
+  0x44, 0x33, 0x53, 0x44, 0x32, 0x62, 0x54, 0x32, 0x62, 0x54, 0x32, 0x62,
+  0x42, 0x12, 0x32, 0x53, 0x33, 0x13, 0x23, 0x34, 0x23, 0x32, 0x36, 0x16,
+  0x43, 0x34, 0x25, 0x63, 0xF5, 0x4F, 0x5B, 0xD7, 0x80, 0x64, 0xC4, 0xC4,
+  0xB6, 0xA2, 0x22, 0xA2, 0x22, 0x93, 0x23, 0x82, 0x42, 0x82, 0x42, 0x73,
+  0x43, 0x62, 0x62, 0x6A, 0x5C, 0x42, 0x73, 0x42, 0x82, 0x33, 0x83, 0x22,
+  0xA2, 0x22, 0xA2, 0x10, 0x0A, 0x3B, 0x22, 0x72, 0x22, 0x82, 0x12, 0x82,
+  0x12, 0x82, 0x12, 0x82, 0x12, 0x72, 0x2A, 0x3B, 0x22, 0x82, 0x12, 0x94,
+  0x94, 0x94, 0x94, 0x82, 0x1C, 0x1A, 0x30, 0x56, 0x7A, 0x43, 0x63, 0x23,
+  0x82, 0x22, 0xA2, 0x12, 0xC2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xE2, 0xA2,
+  0x12, 0xA2, 0x13, 0x82, 0x34, 0x53, 0x4A, 0x76, 0x40, 0x09, 0x5B, 0x32,
+  0x73, 0x22, 0x83, 0x12, 0x92, 0x12, 0x95, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+  0xA4, 0x95, 0x92, 0x12, 0x83, 0x12, 0x73, 0x2B, 0x3A, 0x40, 0x0F, 0xBA,
+  0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xB1, 0xB1, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+  0x2A, 0xF9, 0x0F, 0x99, 0x29, 0x29, 0x29, 0x29, 0x29, 0xA1, 0xA1, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x57, 0x7B, 0x44, 0x54, 0x23,
+  0x92, 0x22, 0xB5, 0xD2, 0xE2, 0xE2, 0x79, 0x79, 0xC4, 0xC2, 0x12, 0xB2,
+  0x12, 0xA3, 0x22, 0x84, 0x24, 0x55, 0x3A, 0x12, 0x56, 0x41, 0x02, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x9F, 0xF0, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x92, 0x0F, 0xF6, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+  0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x54, 0x54, 0x55, 0x33, 0x17, 0x35,
+  0x20, 0x02, 0x83, 0x12, 0x73, 0x22, 0x63, 0x32, 0x53, 0x42, 0x43, 0x52,
+  0x33, 0x62, 0x23, 0x72, 0x23, 0x72, 0x14, 0x74, 0x13, 0x63, 0x33, 0x52,
+  0x52, 0x52, 0x53, 0x42, 0x63, 0x32, 0x72, 0x32, 0x73, 0x22, 0x83, 0x12,
+  0x92, 0x10, 0x02, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8F, 0x50, 0x03, 0xA6, 0xA7, 0x88,
+  0x86, 0x11, 0x86, 0x12, 0x62, 0x14, 0x12, 0x62, 0x14, 0x12, 0x62, 0x14,
+  0x22, 0x42, 0x24, 0x22, 0x42, 0x24, 0x22, 0x42, 0x24, 0x32, 0x22, 0x34,
+  0x32, 0x22, 0x34, 0x32, 0x22, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x52, 0x52, 0x03, 0x85, 0x86, 0x76, 0x74, 0x12, 0x64, 0x13, 0x54, 0x22,
+  0x54, 0x23, 0x44, 0x32, 0x44, 0x42, 0x34, 0x43, 0x24, 0x52, 0x24, 0x53,
+  0x14, 0x62, 0x14, 0x76, 0x76, 0x85, 0x83, 0x65, 0x9A, 0x64, 0x54, 0x42,
+  0x92, 0x32, 0xB2, 0x22, 0xB2, 0x12, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD2,
+  0x12, 0xB2, 0x22, 0xB2, 0x32, 0x92, 0x44, 0x54, 0x5B, 0x87, 0x50, 0x09,
+  0x3B, 0x12, 0x72, 0x12, 0x84, 0x84, 0x84, 0x84, 0x7E, 0x1A, 0x22, 0xA2,
+  0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA0, 0x65, 0x9A, 0x64, 0x54, 0x42,
+  0x92, 0x32, 0xB2, 0x22, 0xB2, 0x12, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD2,
+  0x12, 0xB2, 0x22, 0x72, 0x22, 0x32, 0x66, 0x34, 0x54, 0x5D, 0x67, 0x22,
+  0xF1, 0x11, 0x0A, 0x4C, 0x22, 0x83, 0x12, 0x92, 0x12, 0x92, 0x12, 0x92,
+  0x12, 0x92, 0x12, 0x82, 0x2B, 0x3C, 0x22, 0x83, 0x12, 0x92, 0x12, 0x92,
+  0x12, 0x92, 0x12, 0x92, 0x12, 0x92, 0x12, 0x92, 0x12, 0x93, 0x47, 0x69,
+  0x43, 0x53, 0x23, 0x73, 0x12, 0x92, 0x12, 0xC2, 0xC4, 0xB7, 0x98, 0xA5,
+  0xC5, 0xA4, 0xA5, 0x92, 0x14, 0x53, 0x3A, 0x67, 0x30, 0x0F, 0x95, 0x2A,
+  0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+  0x2A, 0x2A, 0x25, 0x02, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x73, 0x13, 0x53, 0x39, 0x65, 0x40,
+  0x12, 0xA2, 0x12, 0x93, 0x13, 0x82, 0x32, 0x82, 0x32, 0x73, 0x33, 0x62,
+  0x52, 0x62, 0x52, 0x53, 0x53, 0x42, 0x72, 0x42, 0x72, 0x33, 0x73, 0x22,
+  0x92, 0x22, 0x92, 0x13, 0x95, 0xB4, 0xB4, 0xB3, 0x60, 0x03, 0x72, 0x73,
+  0x12, 0x73, 0x63, 0x12, 0x64, 0x63, 0x12, 0x64, 0x62, 0x23, 0x55, 0x52,
+  0x32, 0x52, 0x12, 0x43, 0x32, 0x42, 0x22, 0x43, 0x32, 0x42, 0x22, 0x42,
+  0x43, 0x32, 0x32, 0x32, 0x52, 0x23, 0x32, 0x32, 0x52, 0x22, 0x42, 0x23,
+  0x52, 0x22, 0x43, 0x12, 0x63, 0x12, 0x52, 0x12, 0x74, 0x62, 0x12, 0x74,
+  0x65, 0x74, 0x73, 0x84, 0x73, 0x92, 0x83, 0x40, 0x13, 0x83, 0x22, 0x73,
+  0x33, 0x62, 0x53, 0x43, 0x62, 0x42, 0x73, 0x22, 0x96, 0xA4, 0xB3, 0xC4,
+  0xA5, 0xA2, 0x22, 0x83, 0x23, 0x63, 0x42, 0x62, 0x53, 0x43, 0x63, 0x23,
+  0x82, 0x22, 0x93, 0x12, 0xA2, 0x23, 0x83, 0x32, 0x73, 0x43, 0x62, 0x63,
+  0x43, 0x72, 0x42, 0x83, 0x23, 0x92, 0x22, 0xB4, 0xC4, 0xD2, 0xE2, 0xE2,
+  0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x70, 0x0F, 0xBA, 0x39, 0x39, 0x3A, 0x2A,
+  0x39, 0x39, 0x3A, 0x2A, 0x39, 0x39, 0x3A, 0x2A, 0x39, 0x3A, 0xFB, 0x0A,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0x01, 0x62, 0x61, 0x61, 0x62,
+  0x61, 0x61, 0x62, 0x61, 0x61, 0x62, 0x61, 0x61, 0x62, 0x61, 0x61, 0x62,
+  0x61, 0x08, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0x42, 0x63, 0x61,
+  0x12, 0x42, 0x12, 0x42, 0x21, 0x41, 0x32, 0x22, 0x32, 0x21, 0x54, 0x52,
+  0x0F, 0x00, 0x03, 0x33, 0x32, 0x42, 0x26, 0x58, 0x33, 0x43, 0x22, 0x62,
+  0xA2, 0x93, 0x48, 0x25, 0x32, 0x22, 0x62, 0x22, 0x62, 0x23, 0x34, 0x36,
+  0x14, 0x24, 0x33, 0x02, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x25, 0x32, 0x17,
+  0x24, 0x43, 0x13, 0x65, 0x84, 0x84, 0x84, 0x84, 0x85, 0x62, 0x14, 0x43,
+  0x12, 0x17, 0x22, 0x25, 0x30, 0x35, 0x47, 0x23, 0x32, 0x13, 0x54, 0x82,
+  0x82, 0x82, 0x82, 0x83, 0x52, 0x13, 0x33, 0x27, 0x45, 0x20, 0x92, 0x92,
+  0x92, 0x92, 0x92, 0x34, 0x22, 0x29, 0x13, 0x37, 0x55, 0x74, 0x74, 0x74,
+  0x74, 0x75, 0x53, 0x13, 0x34, 0x26, 0x12, 0x34, 0x22, 0x35, 0x57, 0x33,
+  0x33, 0x13, 0x64, 0x7F, 0xB9, 0x29, 0x36, 0x21, 0x34, 0x23, 0x84, 0x53,
+  0x23, 0x14, 0x12, 0x32, 0x32, 0x2A, 0x12, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x20, 0x34, 0x22, 0x29, 0x13, 0x37, 0x55,
+  0x74, 0x74, 0x74, 0x74, 0x75, 0x53, 0x13, 0x34, 0x26, 0x12, 0x34, 0x22,
+  0x92, 0x85, 0x53, 0x29, 0x36, 0x30, 0x02, 0x82, 0x82, 0x82, 0x82, 0x82,
+  0x24, 0x22, 0x16, 0x14, 0x36, 0x54, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x62, 0x04, 0x6F, 0xB0, 0x22, 0x22, 0xE2, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x29,
+  0x10, 0x02, 0x92, 0x92, 0x92, 0x92, 0x92, 0x52, 0x22, 0x42, 0x32, 0x32,
+  0x42, 0x22, 0x52, 0x13, 0x56, 0x53, 0x13, 0x42, 0x32, 0x42, 0x33, 0x32,
+  0x43, 0x22, 0x52, 0x22, 0x53, 0x12, 0x62, 0x10, 0x0F, 0xF6, 0x02, 0x24,
+  0x35, 0x12, 0x16, 0x1B, 0x34, 0x36, 0x52, 0x54, 0x62, 0x54, 0x62, 0x54,
+  0x62, 0x54, 0x62, 0x54, 0x62, 0x54, 0x62, 0x54, 0x62, 0x54, 0x62, 0x54,
+  0x62, 0x52, 0x02, 0x24, 0x22, 0x16, 0x14, 0x36, 0x54, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x35, 0x57, 0x33, 0x33, 0x13, 0x55,
+  0x74, 0x74, 0x74, 0x74, 0x75, 0x53, 0x13, 0x33, 0x37, 0x55, 0x30, 0x02,
+  0x25, 0x32, 0x17, 0x24, 0x43, 0x13, 0x62, 0x12, 0x84, 0x84, 0x84, 0x84,
+  0x85, 0x67, 0x43, 0x1A, 0x22, 0x25, 0x32, 0xA2, 0xA2, 0xA2, 0xA0, 0x34,
+  0x22, 0x29, 0x13, 0x37, 0x55, 0x74, 0x74, 0x74, 0x74, 0x75, 0x53, 0x13,
+  0x34, 0x29, 0x34, 0x22, 0x92, 0x92, 0x92, 0x92, 0x02, 0x24, 0x17, 0x23,
+  0x32, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x40, 0x25, 0x48,
+  0x13, 0x42, 0x12, 0x82, 0x84, 0x77, 0x65, 0x85, 0x65, 0x43, 0x18, 0x35,
+  0x30, 0x12, 0x32, 0x32, 0x2A, 0x12, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x34, 0x23, 0x02, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x56, 0x34, 0x16, 0x12, 0x24, 0x22, 0x03, 0x62, 0x22, 0x62,
+  0x22, 0x62, 0x23, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x22, 0x62, 0x22,
+  0x62, 0x22, 0x65, 0x84, 0x83, 0x93, 0x50, 0x02, 0x53, 0x52, 0x12, 0x43,
+  0x43, 0x12, 0x43, 0x42, 0x22, 0x41, 0x12, 0x32, 0x22, 0x32, 0x12, 0x32,
+  0x32, 0x22, 0x12, 0x32, 0x32, 0x22, 0x12, 0x22, 0x42, 0x21, 0x32, 0x12,
+  0x51, 0x12, 0x32, 0x12, 0x54, 0x32, 0x11, 0x64, 0x34, 0x63, 0x53, 0x72,
+  0x53, 0x30, 0x12, 0x53, 0x13, 0x42, 0x32, 0x32, 0x52, 0x22, 0x55, 0x73,
+  0x92, 0x84, 0x62, 0x12, 0x62, 0x22, 0x42, 0x33, 0x22, 0x52, 0x22, 0x62,
+  0x03, 0x62, 0x12, 0x62, 0x12, 0x52, 0x23, 0x42, 0x32, 0x42, 0x32, 0x32,
+  0x43, 0x22, 0x52, 0x22, 0x52, 0x12, 0x62, 0x12, 0x74, 0x73, 0x83, 0x82,
+  0x92, 0x83, 0x64, 0x73, 0x70, 0x0F, 0x57, 0x27, 0x27, 0x36, 0x36, 0x37,
+  0x27, 0x27, 0x27, 0x37, 0xF5, 0x32, 0x23, 0x22, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x22, 0x22, 0x42, 0x42, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x33, 0x32, 0x0F, 0xFF, 0x10, 0x02, 0x33, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x42, 0x42, 0x22, 0x22, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x23, 0x22, 0x30, 0x13, 0x65, 0x51, 0x24, 0x21,
+  0x55, 0x63, 0x10 };
+
+const GFXglyph FreeSans12pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    1 },   // 0x20 ' '
+  {     0,   2,  18,   8,    3,  -17 },   // 0x21 '!'
+  {     3,   6,   6,   8,    1,  -16 },   // 0x22 '"'
+  {    12,  13,  16,  13,    0,  -15 },   // 0x23 '#'
+  {    41,  11,  20,  13,    1,  -17 },   // 0x24 '$'
+  {    75,  20,  17,  21,    1,  -16 },   // 0x25 '%'
+  {   117,  14,  17,  16,    1,  -16 },   // 0x26 '&'
+  {   148,   2,   6,   5,    1,  -16 },   // 0x27 '''
+  {   151,   5,  23,   8,    2,  -17 },   // 0x28 '('
+  {   174,   5,  23,   8,    1,  -17 },   // 0x29 ')'
+  {   198,   7,   7,   9,    1,  -17 },   // 0x2A '*'
+  {   210,  10,  11,  14,    2,  -10 },   // 0x2B '+'
+  {   221,   2,   6,   7,    2,   -1 },   // 0x2C ','
+  {   226,   6,   2,   8,    1,   -7 },   // 0x2D '-'
+  {   227,   2,   2,   6,    2,   -1 },   // 0x2E '.'
+  {   228,   7,  18,   7,    0,  -17 },   // 0x2F '/'
+  {   247,  11,  17,  13,    1,  -16 },   // 0x30 '0'
+  {   270,   5,  17,  13,    3,  -16 },   // 0x31 '1'
+  {   285,  11,  17,  13,    1,  -16 },   // 0x32 '2'
+  {   304,  11,  17,  13,    1,  -16 },   // 0x33 '3'
+  {   326,  11,  17,  13,    1,  -16 },   // 0x34 '4'
+  {   350,  11,  17,  13,    1,  -16 },   // 0x35 '5'
+  {   370,  11,  17,  13,    1,  -16 },   // 0x36 '6'
+  {   395,  11,  17,  13,    1,  -16 },   // 0x37 '7'
+  {   412,  11,  17,  13,    1,  -16 },   // 0x38 '8'
+  {   438,  11,  17,  13,    1,  -16 },   // 0x39 '9'
+  {   463,   2,  13,   6,    2,  -12 },   // 0x3A ':'
+  {   466,   2,  16,   6,    2,  -11 },   // 0x3B ';'
+  {   472,  12,  12,  14,    1,  -11 },   // 0x3C '<'
+  {   484,  12,   6,  14,    1,   -8 },   // 0x3D '='
+  {   488,  12,  12,  14,    1,  -11 },   // 0x3E '>'
+  {   500,  10,  18,  13,    2,  -17 },   // 0x3F '?'
+  {   519,  22,  21,  24,    1,  -17 },   // 0x40 '@'
+  {   573,  16,  18,  16,    0,  -17 },   // 0x41 'A'
+  {   604,  13,  18,  16,    2,  -17 },   // 0x42 'B'
+  {   631,  15,  18,  17,    1,  -17 },   // 0x43 'C'
+  {   657,  14,  18,  17,    2,  -17 },   // 0x44 'D'
+  {   682,  12,  18,  15,    2,  -17 },   // 0x45 'E'
+  {   698,  11,  18,  14,    2,  -17 },   // 0x46 'F'
+  {   715,  16,  18,  18,    1,  -17 },   // 0x47 'G'
+  {   742,  13,  18,  17,    2,  -17 },   // 0x48 'H'
+  {   760,   2,  18,   7,    2,  -17 },   // 0x49 'I'
+  {   762,   9,  18,  13,    1,  -17 },   // 0x4A 'J'
+  {   781,  14,  18,  16,    2,  -17 },   // 0x4B 'K'
+  {   818,  10,  18,  14,    2,  -17 },   // 0x4C 'L'
+  {   836,  16,  18,  20,    2,  -17 },   // 0x4D 'M'
+  {   878,  13,  18,  18,    2,  -17 },   // 0x4E 'N'
+  {   907,  17,  18,  19,    1,  -17 },   // 0x4F 'O'
+  {   935,  12,  18,  16,    2,  -17 },   // 0x50 'P'
+  {   955,  17,  19,  19,    1,  -17 },   // 0x51 'Q'
+  {   986,  14,  18,  17,    2,  -17 },   // 0x52 'R'
+  {  1018,  14,  18,  16,    1,  -17 },   // 0x53 'S'
+  {  1041,  12,  18,  15,    1,  -17 },   // 0x54 'T'
+  {  1059,  13,  18,  17,    2,  -17 },   // 0x55 'U'
+  {  1080,  15,  18,  15,    0,  -17 },   // 0x56 'V'
+  {  1113,  22,  18,  22,    0,  -17 },   // 0x57 'W'
+  {  1172,  15,  18,  16,    0,  -17 },   // 0x58 'X'
+  {  1203,  16,  18,  16,    0,  -17 },   // 0x59 'Y'
+  {  1230,  13,  18,  15,    1,  -17 },   // 0x5A 'Z'
+  {  1247,   4,  23,   7,    2,  -17 },   // 0x5B '['
+  {  1267,   7,  18,   7,    0,  -17 },   // 0x5C '\'
+  {  1285,   4,  23,   7,    1,  -17 },   // 0x5D ']'
+  {  1305,   9,   9,  11,    1,  -16 },   // 0x5E '^'
+  {  1320,  15,   1,  13,   -1,    4 },   // 0x5F '_'
+  {  1322,   5,   4,   6,    1,  -17 },   // 0x60 '`'
+  {  1326,  12,  13,  13,    1,  -12 },   // 0x61 'a'
+  {  1347,  12,  18,  13,    1,  -17 },   // 0x62 'b'
+  {  1373,  10,  13,  12,    1,  -12 },   // 0x63 'c'
+  {  1390,  11,  18,  13,    1,  -17 },   // 0x64 'd'
+  {  1413,  11,  13,  13,    1,  -12 },   // 0x65 'e'
+  {  1428,   5,  18,   7,    1,  -17 },   // 0x66 'f'
+  {  1446,  11,  18,  13,    1,  -12 },   // 0x67 'g'
+  {  1470,  10,  18,  13,    1,  -17 },   // 0x68 'h'
+  {  1491,   2,  18,   5,    2,  -17 },   // 0x69 'i'
+  {  1494,   4,  23,   6,    0,  -17 },   // 0x6A 'j'
+  {  1513,  11,  18,  12,    1,  -17 },   // 0x6B 'k'
+  {  1544,   2,  18,   5,    1,  -17 },   // 0x6C 'l'
+  {  1546,  17,  13,  19,    1,  -12 },   // 0x6D 'm'
+  {  1574,  10,  13,  13,    1,  -12 },   // 0x6E 'n'
+  {  1590,  11,  13,  13,    1,  -12 },   // 0x6F 'o'
+  {  1607,  12,  17,  13,    1,  -12 },   // 0x70 'p'
+  {  1631,  11,  17,  13,    1,  -12 },   // 0x71 'q'
+  {  1652,   6,  13,   8,    1,  -12 },   // 0x72 'r'
+  {  1666,  10,  13,  12,    1,  -12 },   // 0x73 's'
+  {  1681,   5,  16,   7,    1,  -15 },   // 0x74 't'
+  {  1696,  10,  13,  13,    1,  -12 },   // 0x75 'u'
+  {  1712,  12,  13,  12,    0,  -12 },   // 0x76 'v'
+  {  1735,  17,  13,  17,    0,  -12 },   // 0x77 'w'
+  {  1778,  11,  13,  11,    0,  -12 },   // 0x78 'x'
+  {  1800,  11,  18,  11,    0,  -12 },   // 0x79 'y'
+  {  1829,  10,  13,  12,    1,  -12 },   // 0x7A 'z'
+  {  1841,   5,  23,   8,    1,  -17 },   // 0x7B '{'
+  {  1864,   2,  23,   6,    2,  -17 },   // 0x7C '|'
+  {  1867,   5,  23,   8,    2,  -17 },   // 0x7D '}'
+  {  1891,  10,   5,  12,    1,  -10 } }; // 0x7E '~'
+
+const GFXfontPacked FreeSans12pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeSans12pt7bPackedRuns,
+    (GFXglyph *)FreeSans12pt7bPackedGlyphs,
+    0x20, 0x7E, 29 } };
+
+// Approx. 2571 bytes
@@ -0,0 +1,824 @@
+// FreeSans18pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSans18pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSans18pt7bSpanData[] PROGMEM = {
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x00, 0x03, 0x06, 0x03,
+  0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x00,
+  0x03, 0x06, 0x03, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x00, 0x03, 0x06,
+  0x03, 0x02, 0x01, 0x01, 0x07, 0x01, 0x02, 0x01, 0x01, 0x07, 0x01, 0x02,
+  0x07, 0x03, 0x0E, 0x03, 0x02, 0x07, 0x03, 0x0E, 0x03, 0x02, 0x07, 0x02,
+  0x0E, 0x03, 0x02, 0x07, 0x02, 0x0E, 0x02, 0x02, 0x06, 0x03, 0x0D, 0x03,
+  0x02, 0x06, 0x03, 0x0D, 0x03, 0x01, 0x02, 0x11, 0x01, 0x02, 0x11, 0x01,
+  0x02, 0x11, 0x02, 0x05, 0x03, 0x0C, 0x03, 0x02, 0x05, 0x03, 0x0C, 0x03,
+  0x02, 0x05, 0x03, 0x0C, 0x03, 0x02, 0x05, 0x03, 0x0C, 0x03, 0x02, 0x05,
+  0x02, 0x0C, 0x02, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12,
+  0x02, 0x04, 0x03, 0x0B, 0x03, 0x02, 0x04, 0x02, 0x0B, 0x02, 0x02, 0x04,
+  0x02, 0x0B, 0x02, 0x02, 0x03, 0x03, 0x0A, 0x03, 0x02, 0x03, 0x03, 0x0A,
+  0x03, 0x02, 0x03, 0x03, 0x0A, 0x03, 0x02, 0x03, 0x02, 0x0A, 0x02, 0x01,
+  0x06, 0x02, 0x01, 0x04, 0x06, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x0B, 0x03,
+  0x01, 0x04, 0x06, 0x02, 0x0A, 0x04, 0x03, 0x00, 0x04, 0x06, 0x02, 0x0B,
+  0x03, 0x03, 0x00, 0x03, 0x06, 0x02, 0x0C, 0x03, 0x03, 0x00, 0x03, 0x06,
+  0x02, 0x0C, 0x03, 0x03, 0x00, 0x03, 0x06, 0x02, 0x0C, 0x03, 0x02, 0x00,
+  0x03, 0x06, 0x02, 0x02, 0x00, 0x03, 0x06, 0x02, 0x02, 0x00, 0x04, 0x06,
+  0x02, 0x02, 0x01, 0x04, 0x06, 0x02, 0x01, 0x01, 0x08, 0x01, 0x03, 0x09,
+  0x01, 0x05, 0x09, 0x02, 0x06, 0x02, 0x09, 0x06, 0x02, 0x06, 0x02, 0x0C,
+  0x04, 0x02, 0x06, 0x02, 0x0D, 0x03, 0x03, 0x00, 0x03, 0x06, 0x02, 0x0D,
+  0x03, 0x03, 0x00, 0x03, 0x06, 0x02, 0x0D, 0x03, 0x03, 0x00, 0x03, 0x06,
+  0x02, 0x0D, 0x03, 0x03, 0x00, 0x03, 0x06, 0x02, 0x0C, 0x04, 0x03, 0x01,
+  0x03, 0x06, 0x02, 0x0A, 0x05, 0x01, 0x01, 0x0D, 0x01, 0x02, 0x0B, 0x01,
+  0x04, 0x07, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01,
+  0x14, 0x02, 0x02, 0x04, 0x04, 0x13, 0x03, 0x02, 0x02, 0x08, 0x13, 0x02,
+  0x02, 0x01, 0x0A, 0x12, 0x03, 0x03, 0x01, 0x03, 0x08, 0x03, 0x11, 0x03,
+  0x03, 0x00, 0x03, 0x09, 0x03, 0x11, 0x03, 0x03, 0x00, 0x02, 0x0A, 0x02,
+  0x10, 0x03, 0x03, 0x00, 0x02, 0x0A, 0x02, 0x10, 0x03, 0x03, 0x00, 0x03,
+  0x09, 0x03, 0x0F, 0x03, 0x03, 0x01, 0x03, 0x08, 0x04, 0x0F, 0x02, 0x02,
+  0x01, 0x0A, 0x0E, 0x03, 0x02, 0x02, 0x08, 0x0E, 0x02, 0x02, 0x03, 0x06,
+  0x0D, 0x03, 0x02, 0x0D, 0x02, 0x15, 0x04, 0x02, 0x0C, 0x03, 0x13, 0x08,
+  0x02, 0x0C, 0x02, 0x12, 0x0A, 0x03, 0x0B, 0x03, 0x12, 0x03, 0x19, 0x03,
+  0x03, 0x0B, 0x02, 0x11, 0x03, 0x1A, 0x03, 0x03, 0x0A, 0x03, 0x11, 0x02,
+  0x1B, 0x02, 0x03, 0x09, 0x03, 0x11, 0x02, 0x1B, 0x02, 0x03, 0x09, 0x03,
+  0x11, 0x03, 0x1A, 0x03, 0x03, 0x08, 0x03, 0x12, 0x03, 0x19, 0x03, 0x02,
+  0x08, 0x03, 0x12, 0x0A, 0x02, 0x07, 0x03, 0x13, 0x08, 0x02, 0x07, 0x02,
+  0x15, 0x04, 0x01, 0x07, 0x05, 0x01, 0x05, 0x08, 0x01, 0x04, 0x0A, 0x02,
+  0x03, 0x04, 0x0B, 0x04, 0x02, 0x03, 0x03, 0x0C, 0x03, 0x02, 0x03, 0x03,
+  0x0C, 0x03, 0x02, 0x03, 0x03, 0x0C, 0x03, 0x02, 0x03, 0x04, 0x0B, 0x04,
+  0x02, 0x04, 0x03, 0x0A, 0x04, 0x02, 0x05, 0x03, 0x09, 0x04, 0x01, 0x05,
+  0x07, 0x01, 0x05, 0x05, 0x01, 0x04, 0x07, 0x03, 0x02, 0x04, 0x08, 0x04,
+  0x0F, 0x03, 0x03, 0x01, 0x04, 0x09, 0x04, 0x0F, 0x03, 0x03, 0x01, 0x03,
+  0x0A, 0x04, 0x0F, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x06, 0x02, 0x00, 0x03,
+  0x0C, 0x05, 0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x00, 0x03, 0x0D, 0x03,
+  0x02, 0x00, 0x04, 0x0C, 0x05, 0x02, 0x01, 0x05, 0x0A, 0x08, 0x02, 0x01,
+  0x0D, 0x0F, 0x03, 0x02, 0x02, 0x0A, 0x10, 0x03, 0x02, 0x04, 0x06, 0x10,
+  0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x02,
+  0x03, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04,
+  0x02, 0x01, 0x05, 0x02, 0x01, 0x06, 0x02, 0x01, 0x00, 0x02, 0x01, 0x01,
+  0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x03, 0x01, 0x03,
+  0x02, 0x01, 0x03, 0x03, 0x01, 0x04, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x05, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x02, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x01, 0x04,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x03, 0x00, 0x03, 0x04, 0x02,
+  0x07, 0x03, 0x01, 0x00, 0x0A, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x02,
+  0x02, 0x03, 0x06, 0x02, 0x02, 0x01, 0x03, 0x06, 0x03, 0x02, 0x02, 0x01,
+  0x07, 0x01, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01,
+  0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x00, 0x10, 0x01,
+  0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01,
+  0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01,
+  0x07, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01,
+  0x00, 0x08, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x07, 0x02, 0x01,
+  0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01,
+  0x06, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01,
+  0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x05, 0x06, 0x01,
+  0x04, 0x09, 0x01, 0x03, 0x0B, 0x02, 0x02, 0x04, 0x0A, 0x04, 0x02, 0x01,
+  0x04, 0x0B, 0x04, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x02, 0x01, 0x03, 0x0C,
+  0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02,
+  0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03,
+  0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03,
+  0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00,
+  0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x01, 0x03, 0x0C,
+  0x03, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x02,
+  0x02, 0x04, 0x0A, 0x04, 0x01, 0x03, 0x0A, 0x01, 0x03, 0x09, 0x01, 0x05,
+  0x06, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x04,
+  0x04, 0x01, 0x02, 0x06, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x06, 0x01, 0x03, 0x0A, 0x01, 0x02,
+  0x0C, 0x02, 0x01, 0x05, 0x0A, 0x05, 0x02, 0x01, 0x03, 0x0C, 0x04, 0x02,
+  0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03,
+  0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0C, 0x04, 0x01,
+  0x0B, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x08, 0x05, 0x01, 0x06, 0x06, 0x01,
+  0x05, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x10, 0x01,
+  0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x05, 0x07, 0x01, 0x04, 0x0A, 0x01,
+  0x03, 0x0C, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02, 0x02, 0x03, 0x0C, 0x04,
+  0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x01,
+  0x03, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0B, 0x04, 0x01, 0x07, 0x07,
+  0x01, 0x07, 0x06, 0x01, 0x07, 0x08, 0x01, 0x0C, 0x04, 0x01, 0x0D, 0x04,
+  0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02,
+  0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x04, 0x0E, 0x03, 0x02, 0x01, 0x03,
+  0x0D, 0x03, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x0D, 0x01, 0x03,
+  0x0B, 0x01, 0x05, 0x07, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x09,
+  0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x06, 0x02, 0x06,
+  0x03, 0x0A, 0x03, 0x02, 0x06, 0x02, 0x0A, 0x03, 0x02, 0x05, 0x03, 0x0A,
+  0x03, 0x02, 0x04, 0x03, 0x0A, 0x03, 0x02, 0x03, 0x03, 0x0A, 0x03, 0x02,
+  0x03, 0x02, 0x0A, 0x03, 0x02, 0x02, 0x03, 0x0A, 0x03, 0x02, 0x01, 0x03,
+  0x0A, 0x03, 0x02, 0x01, 0x02, 0x0A, 0x03, 0x02, 0x00, 0x03, 0x0A, 0x03,
+  0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x0A, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x03, 0x0D, 0x01, 0x03, 0x0D, 0x01, 0x02, 0x0E,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x02, 0x02, 0x03, 0x07, 0x05, 0x01, 0x01, 0x0D, 0x01,
+  0x01, 0x0E, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x03, 0x0C, 0x04,
+  0x01, 0x0D, 0x04, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03,
+  0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02,
+  0x00, 0x04, 0x0D, 0x03, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x01, 0x02, 0x0D,
+  0x01, 0x03, 0x0B, 0x01, 0x05, 0x06, 0x01, 0x06, 0x05, 0x01, 0x04, 0x09,
+  0x01, 0x03, 0x0B, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02, 0x02, 0x03, 0x0C,
+  0x03, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02,
+  0x01, 0x00, 0x03, 0x02, 0x00, 0x03, 0x06, 0x05, 0x02, 0x00, 0x03, 0x04,
+  0x09, 0x01, 0x00, 0x0E, 0x02, 0x00, 0x06, 0x0A, 0x05, 0x02, 0x00, 0x04,
+  0x0C, 0x03, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x03, 0x0D, 0x03,
+  0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x01,
+  0x02, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x0C, 0x04, 0x02, 0x01, 0x03, 0x0C,
+  0x03, 0x02, 0x02, 0x04, 0x0A, 0x05, 0x01, 0x02, 0x0C, 0x01, 0x03, 0x0A,
+  0x01, 0x05, 0x06, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10,
+  0x01, 0x0D, 0x02, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x02,
+  0x01, 0x0A, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x02, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x02, 0x01, 0x07, 0x03, 0x01, 0x07, 0x02, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x05, 0x07, 0x01, 0x03, 0x0B,
+  0x01, 0x02, 0x0D, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x04, 0x0C,
+  0x04, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02,
+  0x01, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x04,
+  0x0B, 0x04, 0x01, 0x03, 0x0B, 0x01, 0x04, 0x09, 0x01, 0x02, 0x0D, 0x02,
+  0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03,
+  0x0D, 0x04, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03,
+  0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x04, 0x02, 0x01,
+  0x03, 0x0D, 0x03, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x0D, 0x01,
+  0x03, 0x0B, 0x01, 0x05, 0x07, 0x01, 0x05, 0x06, 0x01, 0x03, 0x0A, 0x01,
+  0x02, 0x0C, 0x02, 0x01, 0x05, 0x0A, 0x04, 0x02, 0x01, 0x03, 0x0C, 0x03,
+  0x02, 0x00, 0x04, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x02, 0x02, 0x00,
+  0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D,
+  0x03, 0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x01, 0x03, 0x0C, 0x04, 0x02,
+  0x01, 0x04, 0x0A, 0x06, 0x01, 0x02, 0x0E, 0x02, 0x03, 0x09, 0x0D, 0x03,
+  0x02, 0x05, 0x05, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x02, 0x01,
+  0x0C, 0x03, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x02, 0x01, 0x03, 0x0B, 0x03,
+  0x02, 0x01, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x0B, 0x01, 0x03, 0x09, 0x01,
+  0x05, 0x05, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x02, 0x01, 0x10, 0x01, 0x01, 0x0D, 0x04, 0x01, 0x0B, 0x06,
+  0x01, 0x09, 0x06, 0x01, 0x06, 0x07, 0x01, 0x04, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x07,
+  0x01, 0x04, 0x06, 0x01, 0x06, 0x07, 0x01, 0x08, 0x07, 0x01, 0x0B, 0x06,
+  0x01, 0x0D, 0x04, 0x01, 0x0F, 0x02, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11,
+  0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11,
+  0x01, 0x00, 0x11, 0x01, 0x00, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x05,
+  0x01, 0x01, 0x07, 0x01, 0x04, 0x06, 0x01, 0x06, 0x07, 0x01, 0x08, 0x07,
+  0x01, 0x0B, 0x06, 0x01, 0x0D, 0x04, 0x01, 0x0B, 0x06, 0x01, 0x09, 0x06,
+  0x01, 0x06, 0x07, 0x01, 0x04, 0x06, 0x01, 0x02, 0x06, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x01, 0x04, 0x06, 0x01, 0x02, 0x0A,
+  0x01, 0x01, 0x0C, 0x02, 0x01, 0x04, 0x09, 0x05, 0x02, 0x00, 0x04, 0x0B,
+  0x04, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02,
+  0x00, 0x03, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0A,
+  0x04, 0x01, 0x08, 0x05, 0x01, 0x07, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x0D, 0x08, 0x01, 0x0A, 0x0E, 0x01, 0x08,
+  0x12, 0x02, 0x07, 0x06, 0x14, 0x07, 0x02, 0x06, 0x05, 0x17, 0x05, 0x02,
+  0x05, 0x04, 0x18, 0x05, 0x02, 0x04, 0x04, 0x1A, 0x04, 0x02, 0x03, 0x04,
+  0x1B, 0x04, 0x03, 0x02, 0x04, 0x0E, 0x05, 0x1B, 0x04, 0x04, 0x02, 0x03,
+  0x0C, 0x08, 0x16, 0x03, 0x1C, 0x03, 0x04, 0x01, 0x04, 0x0B, 0x04, 0x12,
+  0x06, 0x1C, 0x04, 0x04, 0x01, 0x03, 0x0A, 0x03, 0x13, 0x05, 0x1D, 0x03,
+  0x04, 0x01, 0x03, 0x09, 0x04, 0x14, 0x04, 0x1D, 0x03, 0x04, 0x00, 0x03,
+  0x09, 0x03, 0x14, 0x03, 0x1D, 0x03, 0x04, 0x00, 0x03, 0x09, 0x03, 0x14,
+  0x03, 0x1D, 0x03, 0x04, 0x00, 0x03, 0x08, 0x03, 0x14, 0x03, 0x1D, 0x03,
+  0x04, 0x00, 0x03, 0x08, 0x03, 0x13, 0x03, 0x1D, 0x03, 0x04, 0x00, 0x03,
+  0x08, 0x03, 0x13, 0x03, 0x1C, 0x03, 0x04, 0x00, 0x03, 0x08, 0x03, 0x13,
+  0x03, 0x1C, 0x03, 0x04, 0x00, 0x03, 0x08, 0x03, 0x12, 0x03, 0x1B, 0x03,
+  0x04, 0x00, 0x04, 0x09, 0x03, 0x11, 0x04, 0x1A, 0x04, 0x04, 0x01, 0x03,
+  0x09, 0x04, 0x10, 0x06, 0x19, 0x04, 0x03, 0x01, 0x04, 0x0A, 0x08, 0x13,
+  0x09, 0x03, 0x02, 0x03, 0x0B, 0x05, 0x14, 0x06, 0x01, 0x02, 0x04, 0x01,
+  0x03, 0x05, 0x01, 0x04, 0x05, 0x02, 0x05, 0x07, 0x14, 0x03, 0x01, 0x07,
+  0x10, 0x01, 0x09, 0x0E, 0x01, 0x0B, 0x09, 0x01, 0x08, 0x05, 0x01, 0x08,
+  0x05, 0x01, 0x08, 0x06, 0x01, 0x07, 0x07, 0x02, 0x07, 0x03, 0x0B, 0x03,
+  0x02, 0x07, 0x03, 0x0B, 0x04, 0x02, 0x06, 0x04, 0x0C, 0x03, 0x02, 0x06,
+  0x03, 0x0C, 0x03, 0x02, 0x06, 0x03, 0x0C, 0x04, 0x02, 0x05, 0x04, 0x0D,
+  0x03, 0x02, 0x05, 0x03, 0x0D, 0x03, 0x02, 0x05, 0x03, 0x0D, 0x04, 0x02,
+  0x04, 0x03, 0x0E, 0x03, 0x02, 0x04, 0x03, 0x0E, 0x03, 0x02, 0x04, 0x03,
+  0x0E, 0x04, 0x01, 0x03, 0x0F, 0x01, 0x03, 0x10, 0x01, 0x02, 0x11, 0x02,
+  0x02, 0x04, 0x10, 0x03, 0x02, 0x02, 0x03, 0x10, 0x04, 0x02, 0x01, 0x04,
+  0x10, 0x04, 0x02, 0x01, 0x04, 0x11, 0x03, 0x02, 0x01, 0x03, 0x11, 0x04,
+  0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x12, 0x03, 0x02, 0x00,
+  0x03, 0x12, 0x04, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x10, 0x01, 0x00, 0x11,
+  0x02, 0x00, 0x03, 0x0D, 0x04, 0x02, 0x00, 0x03, 0x0E, 0x04, 0x02, 0x00,
+  0x03, 0x0F, 0x03, 0x02, 0x00, 0x03, 0x0F, 0x03, 0x02, 0x00, 0x03, 0x0F,
+  0x03, 0x02, 0x00, 0x03, 0x0F, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02,
+  0x00, 0x03, 0x0D, 0x04, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00,
+  0x11, 0x02, 0x00, 0x03, 0x0E, 0x04, 0x02, 0x00, 0x03, 0x0F, 0x03, 0x02,
+  0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03,
+  0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03,
+  0x02, 0x00, 0x03, 0x0F, 0x04, 0x02, 0x00, 0x03, 0x0E, 0x04, 0x01, 0x00,
+  0x11, 0x01, 0x00, 0x10, 0x01, 0x00, 0x0E, 0x01, 0x08, 0x08, 0x01, 0x06,
+  0x0C, 0x01, 0x04, 0x0F, 0x02, 0x03, 0x06, 0x0F, 0x05, 0x02, 0x02, 0x05,
+  0x11, 0x04, 0x02, 0x02, 0x04, 0x12, 0x03, 0x02, 0x01, 0x04, 0x12, 0x04,
+  0x02, 0x01, 0x03, 0x13, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x03, 0x13, 0x03, 0x02, 0x01,
+  0x03, 0x13, 0x03, 0x02, 0x01, 0x03, 0x12, 0x04, 0x02, 0x01, 0x04, 0x12,
+  0x03, 0x02, 0x02, 0x04, 0x11, 0x04, 0x02, 0x02, 0x05, 0x10, 0x04, 0x02,
+  0x03, 0x06, 0x0F, 0x05, 0x01, 0x04, 0x0F, 0x01, 0x06, 0x0C, 0x01, 0x08,
+  0x07, 0x01, 0x00, 0x0D, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x10, 0x02, 0x00,
+  0x03, 0x0C, 0x05, 0x02, 0x00, 0x03, 0x0E, 0x04, 0x02, 0x00, 0x03, 0x0F,
+  0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02,
+  0x00, 0x03, 0x10, 0x04, 0x02, 0x00, 0x03, 0x11, 0x03, 0x02, 0x00, 0x03,
+  0x11, 0x03, 0x02, 0x00, 0x03, 0x11, 0x03, 0x02, 0x00, 0x03, 0x11, 0x03,
+  0x02, 0x00, 0x03, 0x11, 0x03, 0x02, 0x00, 0x03, 0x11, 0x03, 0x02, 0x00,
+  0x03, 0x11, 0x03, 0x02, 0x00, 0x03, 0x11, 0x03, 0x02, 0x00, 0x03, 0x10,
+  0x04, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02,
+  0x00, 0x03, 0x0F, 0x04, 0x02, 0x00, 0x03, 0x0E, 0x04, 0x02, 0x00, 0x03,
+  0x0C, 0x05, 0x01, 0x00, 0x10, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0D, 0x01,
+  0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x11, 0x01,
+  0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x12, 0x01,
+  0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01,
+  0x00, 0x11, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x09, 0x08, 0x01, 0x06, 0x0D, 0x01, 0x05, 0x10, 0x02, 0x04, 0x05, 0x10,
+  0x06, 0x02, 0x03, 0x04, 0x12, 0x05, 0x02, 0x02, 0x04, 0x14, 0x03, 0x02,
+  0x01, 0x04, 0x14, 0x04, 0x02, 0x01, 0x03, 0x15, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x03,
+  0x0E, 0x0A, 0x02, 0x00, 0x03, 0x0E, 0x0A, 0x02, 0x00, 0x03, 0x0E, 0x0A,
+  0x02, 0x00, 0x03, 0x15, 0x03, 0x02, 0x00, 0x04, 0x15, 0x03, 0x02, 0x01,
+  0x03, 0x15, 0x03, 0x02, 0x01, 0x03, 0x14, 0x04, 0x02, 0x01, 0x04, 0x14,
+  0x04, 0x02, 0x02, 0x04, 0x13, 0x05, 0x02, 0x03, 0x04, 0x12, 0x06, 0x03,
+  0x04, 0x06, 0x10, 0x04, 0x15, 0x03, 0x02, 0x05, 0x0E, 0x15, 0x03, 0x02,
+  0x06, 0x0C, 0x16, 0x02, 0x02, 0x08, 0x08, 0x16, 0x02, 0x02, 0x00, 0x03,
+  0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03,
+  0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00,
+  0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10,
+  0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02,
+  0x00, 0x03, 0x10, 0x03, 0x01, 0x00, 0x13, 0x01, 0x00, 0x13, 0x01, 0x00,
+  0x13, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02,
+  0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03,
+  0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03,
+  0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00,
+  0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B,
+  0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B,
+  0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B,
+  0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B,
+  0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x02, 0x00,
+  0x03, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0B,
+  0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x02,
+  0x01, 0x04, 0x09, 0x04, 0x01, 0x01, 0x0C, 0x01, 0x02, 0x0A, 0x01, 0x04,
+  0x06, 0x02, 0x00, 0x03, 0x0F, 0x04, 0x02, 0x00, 0x03, 0x0E, 0x04, 0x02,
+  0x00, 0x03, 0x0D, 0x04, 0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x00, 0x03,
+  0x0B, 0x04, 0x02, 0x00, 0x03, 0x0A, 0x05, 0x02, 0x00, 0x03, 0x09, 0x05,
+  0x02, 0x00, 0x03, 0x08, 0x05, 0x02, 0x00, 0x03, 0x07, 0x05, 0x02, 0x00,
+  0x03, 0x07, 0x04, 0x02, 0x00, 0x03, 0x06, 0x04, 0x02, 0x00, 0x03, 0x05,
+  0x05, 0x02, 0x00, 0x03, 0x04, 0x07, 0x02, 0x00, 0x06, 0x08, 0x03, 0x02,
+  0x00, 0x05, 0x08, 0x04, 0x02, 0x00, 0x04, 0x09, 0x04, 0x02, 0x00, 0x03,
+  0x0A, 0x04, 0x02, 0x00, 0x03, 0x0A, 0x04, 0x02, 0x00, 0x03, 0x0B, 0x04,
+  0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x00,
+  0x03, 0x0D, 0x04, 0x02, 0x00, 0x03, 0x0E, 0x04, 0x02, 0x00, 0x03, 0x0E,
+  0x04, 0x02, 0x00, 0x03, 0x0F, 0x04, 0x02, 0x00, 0x03, 0x10, 0x04, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x0F, 0x01,
+  0x00, 0x0F, 0x01, 0x00, 0x0F, 0x02, 0x00, 0x05, 0x13, 0x05, 0x02, 0x00,
+  0x05, 0x13, 0x05, 0x02, 0x00, 0x05, 0x13, 0x05, 0x02, 0x00, 0x06, 0x12,
+  0x06, 0x02, 0x00, 0x06, 0x12, 0x06, 0x02, 0x00, 0x06, 0x12, 0x06, 0x04,
+  0x00, 0x03, 0x04, 0x03, 0x11, 0x03, 0x15, 0x03, 0x04, 0x00, 0x03, 0x04,
+  0x03, 0x11, 0x03, 0x15, 0x03, 0x04, 0x00, 0x03, 0x04, 0x03, 0x11, 0x03,
+  0x15, 0x03, 0x04, 0x00, 0x03, 0x05, 0x03, 0x10, 0x03, 0x15, 0x03, 0x04,
+  0x00, 0x03, 0x05, 0x03, 0x10, 0x03, 0x15, 0x03, 0x04, 0x00, 0x03, 0x05,
+  0x03, 0x10, 0x03, 0x15, 0x03, 0x04, 0x00, 0x03, 0x06, 0x03, 0x0F, 0x03,
+  0x15, 0x03, 0x04, 0x00, 0x03, 0x06, 0x03, 0x0F, 0x03, 0x15, 0x03, 0x04,
+  0x00, 0x03, 0x06, 0x03, 0x0F, 0x03, 0x15, 0x03, 0x04, 0x00, 0x03, 0x07,
+  0x03, 0x0E, 0x03, 0x15, 0x03, 0x04, 0x00, 0x03, 0x07, 0x03, 0x0E, 0x03,
+  0x15, 0x03, 0x04, 0x00, 0x03, 0x07, 0x03, 0x0E, 0x03, 0x15, 0x03, 0x04,
+  0x00, 0x03, 0x08, 0x03, 0x0D, 0x03, 0x15, 0x03, 0x04, 0x00, 0x03, 0x08,
+  0x03, 0x0D, 0x03, 0x15, 0x03, 0x04, 0x00, 0x03, 0x08, 0x03, 0x0D, 0x03,
+  0x15, 0x03, 0x03, 0x00, 0x03, 0x09, 0x06, 0x15, 0x03, 0x03, 0x00, 0x03,
+  0x09, 0x06, 0x15, 0x03, 0x03, 0x00, 0x03, 0x09, 0x06, 0x15, 0x03, 0x03,
+  0x00, 0x03, 0x0A, 0x04, 0x15, 0x03, 0x03, 0x00, 0x03, 0x0A, 0x04, 0x15,
+  0x03, 0x02, 0x00, 0x04, 0x11, 0x03, 0x02, 0x00, 0x04, 0x11, 0x03, 0x02,
+  0x00, 0x05, 0x11, 0x03, 0x02, 0x00, 0x06, 0x11, 0x03, 0x02, 0x00, 0x06,
+  0x11, 0x03, 0x02, 0x00, 0x07, 0x11, 0x03, 0x03, 0x00, 0x03, 0x04, 0x04,
+  0x11, 0x03, 0x03, 0x00, 0x03, 0x05, 0x03, 0x11, 0x03, 0x03, 0x00, 0x03,
+  0x05, 0x04, 0x11, 0x03, 0x03, 0x00, 0x03, 0x06, 0x04, 0x11, 0x03, 0x03,
+  0x00, 0x03, 0x07, 0x03, 0x11, 0x03, 0x03, 0x00, 0x03, 0x07, 0x04, 0x11,
+  0x03, 0x03, 0x00, 0x03, 0x08, 0x03, 0x11, 0x03, 0x03, 0x00, 0x03, 0x08,
+  0x04, 0x11, 0x03, 0x03, 0x00, 0x03, 0x09, 0x04, 0x11, 0x03, 0x03, 0x00,
+  0x03, 0x0A, 0x03, 0x11, 0x03, 0x03, 0x00, 0x03, 0x0A, 0x04, 0x11, 0x03,
+  0x03, 0x00, 0x03, 0x0B, 0x04, 0x11, 0x03, 0x03, 0x00, 0x03, 0x0C, 0x03,
+  0x11, 0x03, 0x03, 0x00, 0x03, 0x0C, 0x04, 0x11, 0x03, 0x02, 0x00, 0x03,
+  0x0D, 0x07, 0x02, 0x00, 0x03, 0x0E, 0x06, 0x02, 0x00, 0x03, 0x0E, 0x06,
+  0x02, 0x00, 0x03, 0x0F, 0x05, 0x02, 0x00, 0x03, 0x0F, 0x05, 0x02, 0x00,
+  0x03, 0x10, 0x04, 0x01, 0x09, 0x07, 0x01, 0x06, 0x0D, 0x01, 0x05, 0x0F,
+  0x02, 0x04, 0x05, 0x10, 0x05, 0x02, 0x03, 0x04, 0x12, 0x04, 0x02, 0x02,
+  0x04, 0x13, 0x04, 0x02, 0x01, 0x04, 0x14, 0x04, 0x02, 0x01, 0x03, 0x15,
+  0x03, 0x02, 0x01, 0x03, 0x15, 0x03, 0x02, 0x00, 0x03, 0x15, 0x04, 0x02,
+  0x00, 0x03, 0x16, 0x03, 0x02, 0x00, 0x03, 0x16, 0x03, 0x02, 0x00, 0x03,
+  0x16, 0x03, 0x02, 0x00, 0x03, 0x16, 0x03, 0x02, 0x00, 0x03, 0x16, 0x03,
+  0x02, 0x00, 0x03, 0x16, 0x03, 0x02, 0x00, 0x03, 0x16, 0x03, 0x02, 0x01,
+  0x03, 0x15, 0x03, 0x02, 0x01, 0x03, 0x15, 0x03, 0x02, 0x01, 0x04, 0x14,
+  0x04, 0x02, 0x02, 0x04, 0x13, 0x04, 0x02, 0x03, 0x04, 0x12, 0x04, 0x02,
+  0x04, 0x05, 0x10, 0x05, 0x01, 0x05, 0x0F, 0x01, 0x06, 0x0D, 0x01, 0x09,
+  0x07, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x10, 0x02, 0x00,
+  0x03, 0x0C, 0x05, 0x02, 0x00, 0x03, 0x0E, 0x04, 0x02, 0x00, 0x03, 0x0F,
+  0x03, 0x02, 0x00, 0x03, 0x0F, 0x03, 0x02, 0x00, 0x03, 0x0F, 0x03, 0x02,
+  0x00, 0x03, 0x0F, 0x03, 0x02, 0x00, 0x03, 0x0F, 0x03, 0x02, 0x00, 0x03,
+  0x0E, 0x04, 0x02, 0x00, 0x03, 0x0D, 0x04, 0x01, 0x00, 0x10, 0x01, 0x00,
+  0x0F, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x09, 0x07, 0x01, 0x06, 0x0D, 0x01, 0x05, 0x0F, 0x02, 0x04,
+  0x05, 0x10, 0x05, 0x02, 0x03, 0x04, 0x12, 0x04, 0x02, 0x02, 0x04, 0x13,
+  0x04, 0x02, 0x01, 0x04, 0x14, 0x04, 0x02, 0x01, 0x03, 0x15, 0x03, 0x02,
+  0x01, 0x03, 0x15, 0x03, 0x02, 0x00, 0x03, 0x16, 0x03, 0x02, 0x00, 0x03,
+  0x16, 0x03, 0x02, 0x00, 0x03, 0x16, 0x03, 0x02, 0x00, 0x03, 0x16, 0x03,
+  0x02, 0x00, 0x03, 0x16, 0x03, 0x02, 0x00, 0x03, 0x16, 0x03, 0x02, 0x00,
+  0x03, 0x16, 0x03, 0x02, 0x00, 0x03, 0x15, 0x04, 0x02, 0x01, 0x03, 0x15,
+  0x03, 0x02, 0x01, 0x03, 0x15, 0x03, 0x03, 0x01, 0x04, 0x0F, 0x03, 0x14,
+  0x04, 0x02, 0x02, 0x04, 0x0F, 0x08, 0x02, 0x03, 0x04, 0x10, 0x06, 0x02,
+  0x04, 0x05, 0x10, 0x06, 0x01, 0x05, 0x12, 0x02, 0x06, 0x0D, 0x14, 0x03,
+  0x02, 0x09, 0x07, 0x15, 0x03, 0x01, 0x16, 0x02, 0x01, 0x17, 0x01, 0x01,
+  0x00, 0x0F, 0x01, 0x00, 0x11, 0x01, 0x00, 0x12, 0x02, 0x00, 0x03, 0x0E,
+  0x04, 0x02, 0x00, 0x03, 0x0F, 0x04, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02,
+  0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03,
+  0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x0F, 0x03,
+  0x02, 0x00, 0x03, 0x0E, 0x04, 0x01, 0x00, 0x11, 0x01, 0x00, 0x10, 0x01,
+  0x00, 0x11, 0x02, 0x00, 0x03, 0x0E, 0x04, 0x02, 0x00, 0x03, 0x0F, 0x04,
+  0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00,
+  0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10,
+  0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02,
+  0x00, 0x03, 0x10, 0x04, 0x02, 0x00, 0x03, 0x10, 0x04, 0x01, 0x06, 0x08,
+  0x01, 0x04, 0x0C, 0x01, 0x03, 0x0E, 0x02, 0x02, 0x05, 0x0D, 0x05, 0x02,
+  0x02, 0x03, 0x0F, 0x04, 0x02, 0x01, 0x03, 0x10, 0x03, 0x02, 0x01, 0x03,
+  0x10, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x01,
+  0x02, 0x05, 0x01, 0x03, 0x08, 0x01, 0x04, 0x0B, 0x01, 0x06, 0x0B, 0x01,
+  0x0A, 0x09, 0x01, 0x0E, 0x05, 0x01, 0x10, 0x04, 0x01, 0x11, 0x03, 0x02,
+  0x00, 0x03, 0x11, 0x03, 0x02, 0x00, 0x03, 0x11, 0x03, 0x02, 0x00, 0x04,
+  0x11, 0x03, 0x02, 0x01, 0x04, 0x10, 0x03, 0x02, 0x01, 0x05, 0x0E, 0x05,
+  0x01, 0x02, 0x10, 0x01, 0x03, 0x0E, 0x01, 0x06, 0x08, 0x01, 0x00, 0x13,
+  0x01, 0x00, 0x13, 0x01, 0x00, 0x13, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10,
+  0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02,
+  0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03,
+  0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03,
+  0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00,
+  0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10,
+  0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02,
+  0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03,
+  0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x04, 0x0F, 0x04,
+  0x02, 0x01, 0x04, 0x0E, 0x04, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x01, 0x02,
+  0x0F, 0x01, 0x03, 0x0C, 0x01, 0x06, 0x07, 0x02, 0x00, 0x03, 0x11, 0x04,
+  0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x11, 0x03, 0x02, 0x01,
+  0x03, 0x10, 0x04, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x01, 0x04, 0x10,
+  0x03, 0x02, 0x02, 0x03, 0x0F, 0x04, 0x02, 0x02, 0x04, 0x0F, 0x04, 0x02,
+  0x03, 0x03, 0x0F, 0x03, 0x02, 0x03, 0x03, 0x0F, 0x03, 0x02, 0x03, 0x04,
+  0x0E, 0x03, 0x02, 0x04, 0x03, 0x0E, 0x03, 0x02, 0x04, 0x03, 0x0E, 0x03,
+  0x02, 0x04, 0x04, 0x0D, 0x03, 0x02, 0x05, 0x03, 0x0D, 0x03, 0x02, 0x05,
+  0x03, 0x0D, 0x03, 0x02, 0x05, 0x04, 0x0C, 0x03, 0x02, 0x06, 0x03, 0x0C,
+  0x03, 0x02, 0x06, 0x03, 0x0C, 0x03, 0x02, 0x06, 0x04, 0x0B, 0x03, 0x02,
+  0x07, 0x03, 0x0B, 0x03, 0x02, 0x07, 0x03, 0x0B, 0x03, 0x01, 0x07, 0x06,
+  0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x09, 0x03, 0x03, 0x01, 0x03,
+  0x0E, 0x04, 0x1C, 0x04, 0x03, 0x01, 0x03, 0x0E, 0x04, 0x1C, 0x04, 0x03,
+  0x01, 0x04, 0x0E, 0x05, 0x1C, 0x04, 0x03, 0x01, 0x04, 0x0E, 0x05, 0x1C,
+  0x03, 0x03, 0x02, 0x03, 0x0D, 0x06, 0x1C, 0x03, 0x03, 0x02, 0x03, 0x0D,
+  0x07, 0x1B, 0x04, 0x04, 0x02, 0x04, 0x0D, 0x03, 0x11, 0x03, 0x1B, 0x04,
+  0x04, 0x02, 0x04, 0x0D, 0x03, 0x11, 0x03, 0x1B, 0x03, 0x04, 0x03, 0x03,
+  0x0C, 0x03, 0x11, 0x03, 0x1B, 0x03, 0x04, 0x03, 0x03, 0x0C, 0x03, 0x12,
+  0x03, 0x1A, 0x04, 0x04, 0x03, 0x03, 0x0C, 0x03, 0x12, 0x03, 0x1A, 0x04,
+  0x04, 0x03, 0x04, 0x0B, 0x04, 0x12, 0x03, 0x1A, 0x03, 0x04, 0x04, 0x03,
+  0x0B, 0x03, 0x12, 0x03, 0x1A, 0x03, 0x04, 0x04, 0x03, 0x0B, 0x03, 0x13,
+  0x03, 0x1A, 0x03, 0x04, 0x04, 0x03, 0x0B, 0x03, 0x13, 0x03, 0x19, 0x04,
+  0x04, 0x04, 0x04, 0x0A, 0x04, 0x13, 0x03, 0x19, 0x03, 0x04, 0x05, 0x03,
+  0x0A, 0x03, 0x14, 0x03, 0x19, 0x03, 0x04, 0x05, 0x03, 0x0A, 0x03, 0x14,
+  0x03, 0x19, 0x03, 0x04, 0x05, 0x03, 0x0A, 0x03, 0x14, 0x03, 0x19, 0x03,
+  0x04, 0x05, 0x03, 0x09, 0x03, 0x14, 0x03, 0x18, 0x03, 0x02, 0x06, 0x06,
+  0x15, 0x06, 0x02, 0x06, 0x06, 0x15, 0x06, 0x02, 0x06, 0x06, 0x15, 0x06,
+  0x02, 0x06, 0x05, 0x16, 0x04, 0x02, 0x07, 0x04, 0x16, 0x04, 0x02, 0x07,
+  0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x10,
+  0x04, 0x02, 0x02, 0x04, 0x10, 0x03, 0x02, 0x02, 0x04, 0x0F, 0x04, 0x02,
+  0x03, 0x04, 0x0E, 0x04, 0x02, 0x04, 0x04, 0x0E, 0x03, 0x02, 0x04, 0x04,
+  0x0D, 0x04, 0x02, 0x05, 0x04, 0x0C, 0x04, 0x02, 0x06, 0x03, 0x0C, 0x03,
+  0x02, 0x06, 0x04, 0x0B, 0x04, 0x01, 0x07, 0x07, 0x01, 0x08, 0x05, 0x01,
+  0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x07, 0x02, 0x07, 0x03, 0x0B,
+  0x03, 0x02, 0x06, 0x04, 0x0B, 0x04, 0x02, 0x05, 0x04, 0x0C, 0x04, 0x02,
+  0x05, 0x03, 0x0D, 0x03, 0x02, 0x04, 0x04, 0x0D, 0x04, 0x02, 0x03, 0x04,
+  0x0E, 0x04, 0x02, 0x03, 0x03, 0x0F, 0x03, 0x02, 0x02, 0x04, 0x0F, 0x04,
+  0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x01, 0x03, 0x10, 0x04, 0x02, 0x00,
+  0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x01, 0x04, 0x12,
+  0x04, 0x02, 0x02, 0x04, 0x11, 0x04, 0x02, 0x02, 0x04, 0x11, 0x03, 0x02,
+  0x03, 0x04, 0x10, 0x04, 0x02, 0x04, 0x03, 0x10, 0x03, 0x02, 0x04, 0x04,
+  0x0F, 0x04, 0x02, 0x05, 0x04, 0x0E, 0x04, 0x02, 0x05, 0x04, 0x0E, 0x03,
+  0x02, 0x06, 0x04, 0x0D, 0x04, 0x02, 0x07, 0x03, 0x0D, 0x03, 0x02, 0x07,
+  0x04, 0x0C, 0x04, 0x02, 0x08, 0x03, 0x0C, 0x03, 0x01, 0x09, 0x05, 0x01,
+  0x09, 0x05, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01,
+  0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01,
+  0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01,
+  0x01, 0x12, 0x01, 0x01, 0x12, 0x01, 0x01, 0x12, 0x01, 0x0F, 0x04, 0x01,
+  0x0E, 0x04, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x04, 0x01, 0x0C, 0x04, 0x01,
+  0x0B, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x05, 0x01, 0x03, 0x04, 0x01,
+  0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x13, 0x01,
+  0x00, 0x13, 0x01, 0x00, 0x13, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x04, 0x01, 0x01, 0x04, 0x02, 0x01,
+  0x04, 0x02, 0x01, 0x05, 0x01, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01,
+  0x05, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01,
+  0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x08, 0x02, 0x01,
+  0x08, 0x02, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x00, 0x06, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x03, 0x06, 0x02, 0x03, 0x03, 0x07, 0x02, 0x02, 0x03,
+  0x02, 0x07, 0x03, 0x02, 0x02, 0x03, 0x08, 0x02, 0x02, 0x02, 0x02, 0x08,
+  0x03, 0x02, 0x01, 0x03, 0x08, 0x03, 0x02, 0x01, 0x03, 0x09, 0x02, 0x02,
+  0x01, 0x02, 0x09, 0x03, 0x02, 0x00, 0x03, 0x0A, 0x02, 0x02, 0x00, 0x02,
+  0x0A, 0x03, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15, 0x01, 0x00, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x02, 0x03, 0x01, 0x03, 0x03, 0x01, 0x04, 0x03, 0x01,
+  0x05, 0x07, 0x01, 0x03, 0x0A, 0x01, 0x02, 0x0C, 0x02, 0x01, 0x04, 0x0B,
+  0x04, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03,
+  0x01, 0x0C, 0x03, 0x01, 0x08, 0x07, 0x01, 0x03, 0x0C, 0x02, 0x01, 0x09,
+  0x0C, 0x03, 0x02, 0x00, 0x05, 0x0C, 0x03, 0x02, 0x00, 0x04, 0x0C, 0x03,
+  0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x04, 0x02, 0x00,
+  0x04, 0x09, 0x06, 0x02, 0x01, 0x0A, 0x0C, 0x05, 0x02, 0x02, 0x08, 0x0D,
+  0x04, 0x02, 0x03, 0x06, 0x0D, 0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x02, 0x00, 0x03, 0x06, 0x05, 0x02, 0x00, 0x03, 0x04,
+  0x09, 0x01, 0x00, 0x0E, 0x02, 0x00, 0x06, 0x0A, 0x05, 0x02, 0x00, 0x05,
+  0x0B, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x04,
+  0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00,
+  0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D,
+  0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x04, 0x0C, 0x03, 0x02,
+  0x00, 0x05, 0x0B, 0x04, 0x02, 0x00, 0x06, 0x0A, 0x04, 0x02, 0x00, 0x03,
+  0x04, 0x0A, 0x02, 0x00, 0x03, 0x04, 0x09, 0x02, 0x00, 0x03, 0x06, 0x05,
+  0x01, 0x05, 0x07, 0x01, 0x03, 0x0A, 0x01, 0x02, 0x0C, 0x02, 0x02, 0x04,
+  0x0B, 0x04, 0x02, 0x01, 0x04, 0x0C, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02,
+  0x01, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x04, 0x0C, 0x03, 0x02, 0x01, 0x05,
+  0x0B, 0x04, 0x01, 0x02, 0x0C, 0x01, 0x03, 0x0A, 0x01, 0x05, 0x06, 0x01,
+  0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01,
+  0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x02, 0x05, 0x06, 0x0E,
+  0x03, 0x02, 0x03, 0x0A, 0x0E, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x05,
+  0x0B, 0x06, 0x02, 0x01, 0x04, 0x0C, 0x05, 0x02, 0x01, 0x03, 0x0D, 0x04,
+  0x02, 0x00, 0x04, 0x0D, 0x04, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00,
+  0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E,
+  0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02,
+  0x01, 0x03, 0x0D, 0x04, 0x02, 0x01, 0x04, 0x0C, 0x05, 0x02, 0x01, 0x05,
+  0x0B, 0x06, 0x02, 0x02, 0x0C, 0x0F, 0x02, 0x02, 0x03, 0x0A, 0x0F, 0x02,
+  0x02, 0x05, 0x06, 0x0F, 0x02, 0x01, 0x05, 0x06, 0x01, 0x03, 0x0A, 0x01,
+  0x02, 0x0C, 0x02, 0x01, 0x05, 0x0B, 0x04, 0x02, 0x01, 0x03, 0x0C, 0x03,
+  0x02, 0x01, 0x02, 0x0D, 0x02, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x01, 0x00,
+  0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x04,
+  0x0C, 0x03, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x01, 0x02, 0x0C, 0x01, 0x03,
+  0x0A, 0x01, 0x05, 0x06, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x02,
+  0x05, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x02, 0x05,
+  0x05, 0x0D, 0x03, 0x02, 0x03, 0x09, 0x0D, 0x03, 0x01, 0x02, 0x0E, 0x02,
+  0x02, 0x04, 0x0A, 0x06, 0x02, 0x01, 0x04, 0x0C, 0x04, 0x02, 0x01, 0x03,
+  0x0C, 0x04, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03,
+  0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00,
+  0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D,
+  0x03, 0x02, 0x01, 0x03, 0x0C, 0x04, 0x02, 0x01, 0x04, 0x0C, 0x04, 0x02,
+  0x01, 0x05, 0x0A, 0x06, 0x02, 0x02, 0x0A, 0x0D, 0x03, 0x02, 0x03, 0x08,
+  0x0D, 0x03, 0x02, 0x05, 0x05, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0D,
+  0x03, 0x01, 0x0C, 0x03, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x02, 0x01, 0x04,
+  0x0B, 0x04, 0x01, 0x02, 0x0C, 0x01, 0x03, 0x0A, 0x01, 0x05, 0x06, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x03, 0x06,
+  0x06, 0x02, 0x00, 0x03, 0x05, 0x09, 0x02, 0x00, 0x03, 0x04, 0x0A, 0x02,
+  0x00, 0x06, 0x0A, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x04, 0x02, 0x00, 0x04,
+  0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03,
+  0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00,
+  0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C,
+  0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02,
+  0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03,
+  0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x00,
+  0x06, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x03, 0x0A, 0x04, 0x02, 0x00, 0x03,
+  0x09, 0x04, 0x02, 0x00, 0x03, 0x08, 0x04, 0x02, 0x00, 0x03, 0x07, 0x04,
+  0x02, 0x00, 0x03, 0x06, 0x04, 0x02, 0x00, 0x03, 0x05, 0x04, 0x02, 0x00,
+  0x03, 0x04, 0x04, 0x02, 0x00, 0x03, 0x04, 0x05, 0x01, 0x00, 0x09, 0x02,
+  0x00, 0x05, 0x06, 0x04, 0x02, 0x00, 0x04, 0x07, 0x04, 0x02, 0x00, 0x03,
+  0x08, 0x03, 0x02, 0x00, 0x03, 0x08, 0x04, 0x02, 0x00, 0x03, 0x09, 0x03,
+  0x02, 0x00, 0x03, 0x09, 0x04, 0x02, 0x00, 0x03, 0x0A, 0x04, 0x02, 0x00,
+  0x03, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x04, 0x02, 0x00, 0x03, 0x0C,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x03, 0x00, 0x03, 0x06, 0x05,
+  0x10, 0x05, 0x03, 0x00, 0x03, 0x05, 0x07, 0x0F, 0x08, 0x03, 0x00, 0x03,
+  0x04, 0x09, 0x0E, 0x09, 0x03, 0x00, 0x05, 0x09, 0x07, 0x14, 0x04, 0x03,
+  0x00, 0x04, 0x0A, 0x05, 0x15, 0x03, 0x03, 0x00, 0x04, 0x0B, 0x03, 0x15,
+  0x03, 0x03, 0x00, 0x03, 0x0B, 0x03, 0x15, 0x03, 0x03, 0x00, 0x03, 0x0B,
+  0x03, 0x15, 0x03, 0x03, 0x00, 0x03, 0x0B, 0x03, 0x15, 0x03, 0x03, 0x00,
+  0x03, 0x0B, 0x03, 0x15, 0x03, 0x03, 0x00, 0x03, 0x0B, 0x03, 0x15, 0x03,
+  0x03, 0x00, 0x03, 0x0B, 0x03, 0x15, 0x03, 0x03, 0x00, 0x03, 0x0B, 0x03,
+  0x15, 0x03, 0x03, 0x00, 0x03, 0x0B, 0x03, 0x15, 0x03, 0x03, 0x00, 0x03,
+  0x0B, 0x03, 0x15, 0x03, 0x03, 0x00, 0x03, 0x0B, 0x03, 0x15, 0x03, 0x03,
+  0x00, 0x03, 0x0B, 0x03, 0x15, 0x03, 0x03, 0x00, 0x03, 0x0B, 0x03, 0x15,
+  0x03, 0x03, 0x00, 0x03, 0x0B, 0x03, 0x15, 0x03, 0x02, 0x00, 0x03, 0x06,
+  0x06, 0x02, 0x00, 0x03, 0x05, 0x09, 0x02, 0x00, 0x03, 0x04, 0x0A, 0x02,
+  0x00, 0x06, 0x0A, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x04, 0x02, 0x00, 0x04,
+  0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03,
+  0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00,
+  0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C,
+  0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02,
+  0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03,
+  0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x01, 0x05, 0x07, 0x01, 0x03,
+  0x0B, 0x01, 0x02, 0x0D, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x04,
+  0x0C, 0x04, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x04,
+  0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00,
+  0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E,
+  0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02,
+  0x01, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x01, 0x02, 0x0D,
+  0x01, 0x03, 0x0B, 0x01, 0x05, 0x07, 0x02, 0x00, 0x03, 0x06, 0x05, 0x02,
+  0x00, 0x03, 0x05, 0x08, 0x02, 0x00, 0x03, 0x04, 0x0A, 0x02, 0x00, 0x06,
+  0x0A, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x03,
+  0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00,
+  0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D,
+  0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02,
+  0x00, 0x04, 0x0C, 0x03, 0x02, 0x00, 0x05, 0x0B, 0x04, 0x02, 0x00, 0x06,
+  0x0A, 0x05, 0x01, 0x00, 0x0E, 0x02, 0x00, 0x03, 0x04, 0x09, 0x02, 0x00,
+  0x03, 0x06, 0x05, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x02, 0x05, 0x06,
+  0x0F, 0x02, 0x02, 0x03, 0x0A, 0x0F, 0x02, 0x02, 0x02, 0x0C, 0x0F, 0x02,
+  0x02, 0x02, 0x04, 0x0B, 0x06, 0x02, 0x01, 0x04, 0x0C, 0x05, 0x02, 0x01,
+  0x03, 0x0D, 0x04, 0x02, 0x00, 0x04, 0x0D, 0x04, 0x02, 0x00, 0x03, 0x0E,
+  0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02,
+  0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03,
+  0x0E, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x04, 0x02, 0x01, 0x04, 0x0C, 0x05,
+  0x02, 0x01, 0x05, 0x0B, 0x06, 0x01, 0x02, 0x0F, 0x02, 0x03, 0x0A, 0x0E,
+  0x03, 0x02, 0x05, 0x06, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03,
+  0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03,
+  0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x00, 0x03, 0x04, 0x05, 0x02, 0x00,
+  0x03, 0x04, 0x05, 0x01, 0x00, 0x06, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x04, 0x06, 0x01, 0x02, 0x09, 0x01, 0x01, 0x0B,
+  0x02, 0x00, 0x04, 0x09, 0x04, 0x02, 0x00, 0x03, 0x0A, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x07, 0x01, 0x02,
+  0x09, 0x01, 0x04, 0x09, 0x01, 0x07, 0x07, 0x01, 0x0A, 0x04, 0x02, 0x00,
+  0x03, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x04, 0x09,
+  0x05, 0x01, 0x01, 0x0C, 0x01, 0x02, 0x0A, 0x01, 0x03, 0x07, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x05, 0x01, 0x02, 0x05, 0x01, 0x03, 0x04, 0x02, 0x00, 0x03, 0x0C, 0x03,
+  0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00,
+  0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C,
+  0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02,
+  0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03,
+  0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03,
+  0x02, 0x00, 0x03, 0x0B, 0x04, 0x02, 0x00, 0x04, 0x0A, 0x05, 0x02, 0x00,
+  0x05, 0x09, 0x06, 0x02, 0x01, 0x0A, 0x0C, 0x03, 0x02, 0x01, 0x09, 0x0C,
+  0x03, 0x02, 0x03, 0x06, 0x0C, 0x03, 0x02, 0x01, 0x03, 0x0E, 0x03, 0x02,
+  0x01, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x02, 0x03,
+  0x0D, 0x03, 0x02, 0x02, 0x03, 0x0C, 0x03, 0x02, 0x02, 0x03, 0x0C, 0x03,
+  0x02, 0x03, 0x03, 0x0C, 0x03, 0x02, 0x03, 0x03, 0x0B, 0x03, 0x02, 0x03,
+  0x03, 0x0B, 0x03, 0x02, 0x04, 0x03, 0x0B, 0x03, 0x02, 0x04, 0x03, 0x0A,
+  0x03, 0x02, 0x04, 0x03, 0x0A, 0x03, 0x02, 0x05, 0x03, 0x09, 0x03, 0x02,
+  0x05, 0x03, 0x09, 0x03, 0x02, 0x05, 0x03, 0x09, 0x03, 0x01, 0x06, 0x05,
+  0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x07, 0x03, 0x03, 0x00, 0x04,
+  0x0B, 0x03, 0x16, 0x03, 0x03, 0x01, 0x03, 0x0A, 0x05, 0x15, 0x04, 0x03,
+  0x01, 0x03, 0x0A, 0x05, 0x15, 0x03, 0x03, 0x01, 0x03, 0x0A, 0x05, 0x15,
+  0x03, 0x03, 0x01, 0x04, 0x0A, 0x05, 0x15, 0x03, 0x04, 0x02, 0x03, 0x09,
+  0x03, 0x0D, 0x03, 0x14, 0x03, 0x04, 0x02, 0x03, 0x09, 0x03, 0x0D, 0x03,
+  0x14, 0x03, 0x04, 0x02, 0x03, 0x09, 0x03, 0x0D, 0x03, 0x14, 0x03, 0x04,
+  0x03, 0x03, 0x09, 0x02, 0x0E, 0x02, 0x14, 0x03, 0x04, 0x03, 0x03, 0x08,
+  0x03, 0x0E, 0x03, 0x13, 0x03, 0x04, 0x03, 0x03, 0x08, 0x03, 0x0E, 0x03,
+  0x13, 0x03, 0x04, 0x03, 0x03, 0x08, 0x03, 0x0E, 0x03, 0x13, 0x03, 0x04,
+  0x04, 0x03, 0x08, 0x02, 0x0F, 0x02, 0x13, 0x02, 0x02, 0x04, 0x06, 0x0F,
+  0x06, 0x02, 0x04, 0x06, 0x0F, 0x06, 0x02, 0x05, 0x05, 0x0F, 0x06, 0x02,
+  0x05, 0x04, 0x10, 0x04, 0x02, 0x05, 0x04, 0x10, 0x04, 0x02, 0x05, 0x04,
+  0x10, 0x04, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x02, 0x03, 0x0C, 0x03,
+  0x02, 0x02, 0x04, 0x0B, 0x03, 0x02, 0x03, 0x03, 0x0B, 0x03, 0x02, 0x04,
+  0x03, 0x0A, 0x03, 0x02, 0x04, 0x04, 0x09, 0x03, 0x02, 0x05, 0x03, 0x09,
+  0x03, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x07, 0x03, 0x01, 0x06,
+  0x05, 0x01, 0x05, 0x06, 0x02, 0x05, 0x03, 0x09, 0x03, 0x02, 0x04, 0x03,
+  0x09, 0x04, 0x02, 0x03, 0x04, 0x0A, 0x03, 0x02, 0x03, 0x03, 0x0B, 0x03,
+  0x02, 0x02, 0x03, 0x0B, 0x04, 0x02, 0x01, 0x04, 0x0C, 0x03, 0x02, 0x01,
+  0x03, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x0D,
+  0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x02, 0x03, 0x0C, 0x03, 0x02,
+  0x02, 0x03, 0x0C, 0x03, 0x02, 0x02, 0x03, 0x0C, 0x03, 0x02, 0x03, 0x03,
+  0x0B, 0x03, 0x02, 0x03, 0x03, 0x0B, 0x03, 0x02, 0x03, 0x03, 0x0A, 0x04,
+  0x02, 0x04, 0x03, 0x0A, 0x03, 0x02, 0x04, 0x03, 0x0A, 0x03, 0x02, 0x04,
+  0x03, 0x09, 0x03, 0x02, 0x05, 0x03, 0x09, 0x03, 0x02, 0x05, 0x03, 0x09,
+  0x03, 0x01, 0x05, 0x06, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x04, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x02, 0x06, 0x01, 0x02,
+  0x05, 0x01, 0x02, 0x04, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x0D, 0x01, 0x01,
+  0x0D, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00,
+  0x0F, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x05, 0x01, 0x04,
+  0x04, 0x01, 0x05, 0x03, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x05, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x05, 0x01, 0x05, 0x03, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x01, 0x06, 0x02, 0x00, 0x08, 0x0D, 0x02, 0x03, 0x00, 0x03,
+  0x05, 0x05, 0x0D, 0x02, 0x02, 0x00, 0x02, 0x07, 0x08, 0x01, 0x08, 0x06,
+  0x01, 0x09, 0x04 };
+
+const GFXglyph FreeSans18pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,   9,    0,    1 },   // 0x20 ' '
+  {     0,   3,  26,  12,    4,  -25 },   // 0x21 '!'
+  {    74,   9,   9,  12,    1,  -24 },   // 0x22 '"'
+  {   119,  19,  24,  19,    0,  -23 },   // 0x23 '#'
+  {   227,  16,  30,  19,    2,  -26 },   // 0x24 '$'
+  {   371,  29,  25,  31,    1,  -24 },   // 0x25 '%'
+  {   518,  20,  25,  23,    2,  -24 },   // 0x26 '&'
+  {   637,   3,   9,   7,    2,  -24 },   // 0x27 '''
+  {   664,   8,  33,  12,    3,  -25 },   // 0x28 '('
+  {   763,   8,  33,  12,    1,  -25 },   // 0x29 ')'
+  {   862,  10,  10,  14,    2,  -25 },   // 0x2A '*'
+  {   902,  16,  16,  20,    2,  -15 },   // 0x2B '+'
+  {   950,   3,   9,  10,    3,   -3 },   // 0x2C ','
+  {   977,   8,   3,  12,    2,  -10 },   // 0x2D '-'
+  {   986,   3,   4,   9,    3,   -3 },   // 0x2E '.'
+  {   998,  10,  26,  10,    0,  -25 },   // 0x2F '/'
+  {  1076,  16,  25,  19,    2,  -24 },   // 0x30 '0'
+  {  1189,   8,  25,  19,    4,  -24 },   // 0x31 '1'
+  {  1264,  16,  25,  19,    2,  -24 },   // 0x32 '2'
+  {  1349,  17,  25,  19,    1,  -24 },   // 0x33 '3'
+  {  1444,  16,  25,  19,    1,  -24 },   // 0x34 '4'
+  {  1539,  17,  25,  19,    1,  -24 },   // 0x35 '5'
+  {  1626,  16,  25,  19,    2,  -24 },   // 0x36 '6'
+  {  1731,  16,  25,  19,    2,  -24 },   // 0x37 '7'
+  {  1806,  17,  25,  19,    1,  -24 },   // 0x38 '8'
+  {  1913,  16,  25,  19,    1,  -24 },   // 0x39 '9'
+  {  2018,   3,  19,   9,    3,  -18 },   // 0x3A ':'
+  {  2053,   3,  24,   9,    3,  -18 },   // 0x3B ';'
+  {  2103,  17,  17,  20,    2,  -16 },   // 0x3C '<'
+  {  2154,  17,   9,  20,    2,  -12 },   // 0x3D '='
+  {  2175,  17,  17,  20,    2,  -16 },   // 0x3E '>'
+  {  2226,  15,  26,  19,    3,  -25 },   // 0x3F '?'
+  {  2308,  32,  31,  36,    1,  -25 },   // 0x40 '@'
+  {  2503,  22,  26,  23,    1,  -25 },   // 0x41 'A'
+  {  2619,  19,  26,  23,    3,  -25 },   // 0x42 'B'
+  {  2731,  22,  26,  25,    1,  -25 },   // 0x43 'C'
+  {  2833,  20,  26,  24,    3,  -25 },   // 0x44 'D'
+  {  2951,  18,  26,  22,    3,  -25 },   // 0x45 'E'
+  {  3029,  17,  26,  21,    3,  -25 },   // 0x46 'F'
+  {  3107,  24,  26,  27,    1,  -25 },   // 0x47 'G'
+  {  3225,  19,  26,  25,    3,  -25 },   // 0x48 'H'
+  {  3349,   3,  26,  10,    4,  -25 },   // 0x49 'I'
+  {  3427,  14,  26,  18,    1,  -25 },   // 0x4A 'J'
+  {  3517,  20,  26,  24,    3,  -25 },   // 0x4B 'K'
+  {  3647,  15,  26,  20,    3,  -25 },   // 0x4C 'L'
+  {  3725,  24,  26,  30,    3,  -25 },   // 0x4D 'M'
+  {  3925,  20,  26,  26,    3,  -25 },   // 0x4E 'N'
+  {  4083,  25,  26,  27,    1,  -25 },   // 0x4F 'O'
+  {  4201,  18,  26,  23,    3,  -25 },   // 0x50 'P'
+  {  4297,  25,  28,  27,    1,  -25 },   // 0x51 'Q'
+  {  4427,  20,  26,  25,    3,  -25 },   // 0x52 'R'
+  {  4545,  20,  26,  23,    1,  -25 },   // 0x53 'S'
+  {  4641,  19,  26,  22,    1,  -25 },   // 0x54 'T'
+  {  4719,  19,  26,  25,    3,  -25 },   // 0x55 'U'
+  {  4843,  21,  26,  23,    1,  -25 },   // 0x56 'V'
+  {  4965,  32,  26,  33,    0,  -25 },   // 0x57 'W'
+  {  5163,  21,  26,  23,    1,  -25 },   // 0x58 'X'
+  {  5283,  23,  26,  24,    0,  -25 },   // 0x59 'Y'
+  {  5387,  19,  26,  22,    1,  -25 },   // 0x5A 'Z'
+  {  5465,   6,  33,  10,    2,  -25 },   // 0x5B '['
+  {  5564,  10,  26,  10,    0,  -25 },   // 0x5C '\'
+  {  5642,   6,  33,  10,    1,  -25 },   // 0x5D ']'
+  {  5741,  13,  13,  16,    2,  -24 },   // 0x5E '^'
+  {  5798,  21,   2,  19,   -1,    5 },   // 0x5F '_'
+  {  5804,   7,   5,   9,    1,  -25 },   // 0x60 '`'
+  {  5819,  17,  19,  19,    1,  -18 },   // 0x61 'a'
+  {  5898,  16,  26,  20,    2,  -25 },   // 0x62 'b'
+  {  6012,  16,  19,  18,    1,  -18 },   // 0x63 'c'
+  {  6083,  17,  26,  20,    1,  -25 },   // 0x64 'd'
+  {  6197,  16,  19,  19,    1,  -18 },   // 0x65 'e'
+  {  6268,   7,  26,  10,    1,  -25 },   // 0x66 'f'
+  {  6346,  16,  27,  19,    1,  -18 },   // 0x67 'g'
+  {  6467,  15,  26,  19,    2,  -25 },   // 0x68 'h'
+  {  6583,   3,  26,   8,    2,  -25 },   // 0x69 'i'
+  {  6655,   6,  34,   9,    0,  -25 },   // 0x6A 'j'
+  {  6751,  16,  26,  18,    2,  -25 },   // 0x6B 'k'
+  {  6865,   3,  26,   7,    2,  -25 },   // 0x6C 'l'
+  {  6943,  24,  19,  28,    2,  -18 },   // 0x6D 'm'
+  {  7076,  15,  19,  19,    2,  -18 },   // 0x6E 'n'
+  {  7171,  17,  19,  19,    1,  -18 },   // 0x6F 'o'
+  {  7254,  16,  25,  20,    2,  -18 },   // 0x70 'p'
+  {  7365,  17,  25,  20,    1,  -18 },   // 0x71 'q'
+  {  7476,   9,  19,  12,    2,  -18 },   // 0x72 'r'
+  {  7539,  14,  19,  17,    2,  -18 },   // 0x73 's'
+  {  7606,   7,  23,  10,    1,  -22 },   // 0x74 't'
+  {  7675,  15,  19,  19,    2,  -18 },   // 0x75 'u'
+  {  7770,  17,  19,  17,    0,  -18 },   // 0x76 'v'
+  {  7857,  25,  19,  25,    0,  -18 },   // 0x77 'w'
+  {  7994,  16,  19,  17,    0,  -18 },   // 0x78 'x'
+  {  8079,  17,  27,  17,    0,  -18 },   // 0x79 'y'
+  {  8188,  15,  19,  17,    1,  -18 },   // 0x7A 'z'
+  {  8245,   8,  33,  12,    1,  -25 },   // 0x7B '{'
+  {  8344,   2,  33,   9,    3,  -25 },   // 0x7C '|'
+  {  8443,   8,  33,  12,    3,  -25 },   // 0x7D '}'
+  {  8542,  15,   7,  18,    1,  -15 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSans18pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSans18pt7bSpanData,
+    (GFXglyph *)FreeSans18pt7bSpanGlyphs,
+    0x20, 0x7E, 42 } };
+
+// Approx. 9355 bytes
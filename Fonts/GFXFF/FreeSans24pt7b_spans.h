@@ -0,0 +1,1067 @@
+// FreeSans24pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSans24pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSans24pt7bSpanData[] PROGMEM = {
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x02, 0x00, 0x04, 0x07, 0x04, 0x02, 0x00, 0x04, 0x07, 0x04, 0x02, 0x00,
+  0x04, 0x07, 0x04, 0x02, 0x00, 0x04, 0x07, 0x04, 0x02, 0x00, 0x04, 0x07,
+  0x04, 0x02, 0x00, 0x04, 0x07, 0x04, 0x02, 0x00, 0x04, 0x07, 0x04, 0x02,
+  0x00, 0x04, 0x07, 0x04, 0x02, 0x00, 0x04, 0x07, 0x04, 0x02, 0x01, 0x02,
+  0x08, 0x02, 0x02, 0x01, 0x02, 0x08, 0x02, 0x02, 0x01, 0x02, 0x08, 0x02,
+  0x02, 0x09, 0x03, 0x12, 0x04, 0x02, 0x09, 0x03, 0x12, 0x04, 0x02, 0x08,
+  0x04, 0x12, 0x03, 0x02, 0x08, 0x04, 0x12, 0x03, 0x02, 0x08, 0x04, 0x11,
+  0x04, 0x02, 0x08, 0x03, 0x11, 0x04, 0x02, 0x08, 0x03, 0x11, 0x04, 0x02,
+  0x07, 0x04, 0x11, 0x03, 0x02, 0x07, 0x04, 0x11, 0x03, 0x01, 0x01, 0x17,
+  0x01, 0x01, 0x17, 0x01, 0x01, 0x17, 0x02, 0x06, 0x04, 0x10, 0x03, 0x02,
+  0x06, 0x04, 0x10, 0x03, 0x02, 0x06, 0x04, 0x10, 0x03, 0x02, 0x06, 0x03,
+  0x0F, 0x04, 0x02, 0x06, 0x03, 0x0F, 0x04, 0x02, 0x06, 0x03, 0x0F, 0x04,
+  0x02, 0x05, 0x04, 0x0F, 0x03, 0x02, 0x05, 0x04, 0x0F, 0x03, 0x01, 0x00,
+  0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x02, 0x04, 0x04, 0x0E, 0x03,
+  0x02, 0x04, 0x04, 0x0E, 0x03, 0x02, 0x04, 0x04, 0x0D, 0x04, 0x02, 0x04,
+  0x03, 0x0D, 0x04, 0x02, 0x04, 0x03, 0x0D, 0x04, 0x02, 0x03, 0x04, 0x0D,
+  0x03, 0x02, 0x03, 0x04, 0x0D, 0x03, 0x02, 0x03, 0x04, 0x0D, 0x03, 0x02,
+  0x03, 0x03, 0x0C, 0x04, 0x02, 0x03, 0x03, 0x0C, 0x04, 0x01, 0x0A, 0x03,
+  0x01, 0x08, 0x07, 0x01, 0x05, 0x0C, 0x01, 0x04, 0x0E, 0x01, 0x03, 0x10,
+  0x03, 0x02, 0x06, 0x0A, 0x03, 0x0F, 0x05, 0x03, 0x02, 0x05, 0x0A, 0x03,
+  0x10, 0x04, 0x03, 0x01, 0x05, 0x0A, 0x03, 0x11, 0x04, 0x03, 0x01, 0x04,
+  0x0A, 0x03, 0x12, 0x03, 0x03, 0x01, 0x04, 0x0A, 0x03, 0x12, 0x03, 0x03,
+  0x01, 0x04, 0x0A, 0x03, 0x12, 0x03, 0x02, 0x01, 0x04, 0x0A, 0x03, 0x02,
+  0x01, 0x04, 0x0A, 0x03, 0x02, 0x01, 0x05, 0x0A, 0x03, 0x02, 0x02, 0x05,
+  0x0A, 0x03, 0x02, 0x02, 0x07, 0x0A, 0x03, 0x01, 0x03, 0x0A, 0x01, 0x04,
+  0x0D, 0x01, 0x06, 0x0D, 0x01, 0x08, 0x0C, 0x01, 0x0A, 0x0B, 0x02, 0x0A,
+  0x03, 0x10, 0x06, 0x02, 0x0A, 0x03, 0x11, 0x05, 0x02, 0x0A, 0x03, 0x12,
+  0x05, 0x02, 0x0A, 0x03, 0x13, 0x04, 0x03, 0x00, 0x03, 0x0A, 0x03, 0x13,
+  0x04, 0x03, 0x00, 0x03, 0x0A, 0x03, 0x13, 0x04, 0x03, 0x00, 0x04, 0x0A,
+  0x03, 0x13, 0x04, 0x03, 0x00, 0x04, 0x0A, 0x03, 0x13, 0x04, 0x03, 0x01,
+  0x04, 0x0A, 0x03, 0x12, 0x04, 0x03, 0x01, 0x05, 0x0A, 0x03, 0x12, 0x04,
+  0x03, 0x01, 0x05, 0x0A, 0x03, 0x11, 0x05, 0x03, 0x02, 0x06, 0x0A, 0x03,
+  0x0F, 0x06, 0x01, 0x03, 0x11, 0x01, 0x04, 0x0E, 0x01, 0x07, 0x09, 0x01,
+  0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01,
+  0x0A, 0x03, 0x01, 0x1B, 0x03, 0x02, 0x05, 0x06, 0x1A, 0x04, 0x02, 0x04,
+  0x09, 0x1A, 0x03, 0x02, 0x02, 0x0C, 0x19, 0x03, 0x02, 0x02, 0x0D, 0x19,
+  0x03, 0x03, 0x01, 0x05, 0x0A, 0x05, 0x18, 0x03, 0x03, 0x00, 0x04, 0x0C,
+  0x04, 0x18, 0x03, 0x03, 0x00, 0x03, 0x0D, 0x03, 0x17, 0x03, 0x03, 0x00,
+  0x03, 0x0D, 0x03, 0x16, 0x04, 0x03, 0x00, 0x03, 0x0D, 0x03, 0x16, 0x03,
+  0x03, 0x00, 0x03, 0x0D, 0x03, 0x15, 0x04, 0x03, 0x00, 0x04, 0x0C, 0x04,
+  0x15, 0x03, 0x03, 0x01, 0x05, 0x0A, 0x05, 0x14, 0x04, 0x02, 0x02, 0x0D,
+  0x14, 0x03, 0x02, 0x02, 0x0C, 0x13, 0x04, 0x02, 0x03, 0x0A, 0x13, 0x03,
+  0x02, 0x05, 0x06, 0x12, 0x03, 0x01, 0x12, 0x03, 0x02, 0x11, 0x03, 0x1C,
+  0x06, 0x02, 0x11, 0x03, 0x1B, 0x09, 0x02, 0x10, 0x03, 0x19, 0x0C, 0x02,
+  0x0F, 0x04, 0x19, 0x0D, 0x03, 0x0F, 0x03, 0x18, 0x05, 0x21, 0x05, 0x03,
+  0x0E, 0x04, 0x17, 0x04, 0x23, 0x04, 0x03, 0x0E, 0x03, 0x17, 0x03, 0x24,
+  0x03, 0x03, 0x0D, 0x04, 0x17, 0x03, 0x24, 0x03, 0x03, 0x0D, 0x03, 0x17,
+  0x03, 0x24, 0x03, 0x03, 0x0C, 0x04, 0x17, 0x03, 0x24, 0x03, 0x03, 0x0C,
+  0x03, 0x17, 0x04, 0x23, 0x04, 0x03, 0x0B, 0x03, 0x18, 0x05, 0x21, 0x05,
+  0x02, 0x0B, 0x03, 0x19, 0x0D, 0x02, 0x0A, 0x03, 0x19, 0x0C, 0x02, 0x0A,
+  0x03, 0x1B, 0x09, 0x02, 0x09, 0x03, 0x1C, 0x06, 0x01, 0x09, 0x06, 0x01,
+  0x07, 0x09, 0x01, 0x06, 0x0B, 0x01, 0x05, 0x0D, 0x02, 0x05, 0x05, 0x0E,
+  0x04, 0x02, 0x04, 0x05, 0x0F, 0x04, 0x02, 0x04, 0x04, 0x10, 0x03, 0x02,
+  0x04, 0x04, 0x10, 0x03, 0x02, 0x04, 0x04, 0x10, 0x03, 0x02, 0x04, 0x04,
+  0x10, 0x03, 0x02, 0x05, 0x04, 0x0F, 0x04, 0x02, 0x05, 0x05, 0x0E, 0x04,
+  0x02, 0x06, 0x05, 0x0C, 0x05, 0x01, 0x07, 0x09, 0x01, 0x07, 0x08, 0x01,
+  0x07, 0x06, 0x01, 0x06, 0x08, 0x01, 0x04, 0x0B, 0x03, 0x03, 0x05, 0x0B,
+  0x04, 0x15, 0x04, 0x03, 0x02, 0x05, 0x0C, 0x04, 0x15, 0x04, 0x03, 0x01,
+  0x05, 0x0C, 0x05, 0x14, 0x05, 0x03, 0x01, 0x04, 0x0D, 0x05, 0x14, 0x04,
+  0x02, 0x00, 0x04, 0x0E, 0x0A, 0x02, 0x00, 0x04, 0x0F, 0x08, 0x02, 0x00,
+  0x04, 0x10, 0x07, 0x02, 0x00, 0x04, 0x10, 0x06, 0x02, 0x00, 0x04, 0x11,
+  0x06, 0x02, 0x00, 0x05, 0x10, 0x08, 0x02, 0x01, 0x05, 0x0F, 0x09, 0x03,
+  0x01, 0x07, 0x0D, 0x05, 0x13, 0x06, 0x02, 0x02, 0x0F, 0x14, 0x06, 0x02,
+  0x03, 0x0D, 0x15, 0x06, 0x02, 0x04, 0x0B, 0x16, 0x05, 0x01, 0x06, 0x07,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02,
+  0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x03, 0x03,
+  0x01, 0x03, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x03, 0x01, 0x06, 0x03, 0x01, 0x07, 0x02, 0x01, 0x07, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x04,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x04, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03,
+  0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02,
+  0x03, 0x01, 0x02, 0x06, 0x02, 0x0B, 0x02, 0x01, 0x00, 0x0E, 0x01, 0x00,
+  0x0E, 0x01, 0x04, 0x06, 0x01, 0x05, 0x04, 0x01, 0x04, 0x06, 0x02, 0x03,
+  0x03, 0x08, 0x03, 0x02, 0x03, 0x03, 0x08, 0x04, 0x02, 0x02, 0x03, 0x09,
+  0x03, 0x02, 0x04, 0x01, 0x09, 0x01, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x00, 0x17,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x0A, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x02,
+  0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x02,
+  0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x02, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x07, 0x02, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02,
+  0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x08, 0x06, 0x01, 0x06, 0x0A, 0x01, 0x04, 0x0E, 0x01, 0x03, 0x10,
+  0x02, 0x03, 0x06, 0x0D, 0x06, 0x02, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x02,
+  0x04, 0x10, 0x04, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x01, 0x04, 0x11,
+  0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02,
+  0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04,
+  0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04,
+  0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00,
+  0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12,
+  0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02,
+  0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04,
+  0x11, 0x04, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x02, 0x04, 0x10, 0x04,
+  0x02, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x03, 0x05, 0x0D, 0x06, 0x01, 0x03,
+  0x10, 0x01, 0x04, 0x0E, 0x01, 0x06, 0x0A, 0x01, 0x08, 0x06, 0x01, 0x09,
+  0x02, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x04, 0x01, 0x06,
+  0x05, 0x01, 0x03, 0x08, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00,
+  0x0B, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x08, 0x01, 0x05, 0x0C, 0x01, 0x03, 0x10, 0x01, 0x02,
+  0x12, 0x02, 0x02, 0x06, 0x0E, 0x07, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02,
+  0x01, 0x04, 0x11, 0x05, 0x02, 0x00, 0x05, 0x11, 0x05, 0x02, 0x00, 0x04,
+  0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04,
+  0x01, 0x12, 0x04, 0x01, 0x11, 0x05, 0x01, 0x11, 0x05, 0x01, 0x10, 0x05,
+  0x01, 0x0F, 0x05, 0x01, 0x0D, 0x07, 0x01, 0x0B, 0x08, 0x01, 0x09, 0x08,
+  0x01, 0x08, 0x08, 0x01, 0x06, 0x08, 0x01, 0x05, 0x07, 0x01, 0x04, 0x06,
+  0x01, 0x03, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16,
+  0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x08, 0x07, 0x01, 0x05, 0x0D,
+  0x01, 0x04, 0x0F, 0x01, 0x03, 0x11, 0x02, 0x02, 0x06, 0x0F, 0x06, 0x02,
+  0x02, 0x05, 0x10, 0x05, 0x02, 0x01, 0x05, 0x11, 0x05, 0x02, 0x01, 0x04,
+  0x12, 0x04, 0x02, 0x01, 0x04, 0x12, 0x04, 0x02, 0x01, 0x04, 0x12, 0x04,
+  0x01, 0x12, 0x04, 0x01, 0x12, 0x04, 0x01, 0x11, 0x04, 0x01, 0x0E, 0x07,
+  0x01, 0x09, 0x0B, 0x01, 0x09, 0x09, 0x01, 0x09, 0x0A, 0x01, 0x09, 0x0C,
+  0x01, 0x0F, 0x07, 0x01, 0x11, 0x05, 0x01, 0x12, 0x05, 0x01, 0x13, 0x04,
+  0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02,
+  0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x05, 0x12, 0x05, 0x02, 0x01, 0x04,
+  0x12, 0x04, 0x02, 0x01, 0x05, 0x11, 0x05, 0x02, 0x02, 0x06, 0x0F, 0x06,
+  0x01, 0x02, 0x13, 0x01, 0x03, 0x11, 0x01, 0x05, 0x0D, 0x01, 0x07, 0x08,
+  0x01, 0x0F, 0x03, 0x01, 0x0E, 0x04, 0x01, 0x0D, 0x05, 0x01, 0x0C, 0x06,
+  0x01, 0x0C, 0x06, 0x01, 0x0B, 0x07, 0x01, 0x0A, 0x08, 0x01, 0x09, 0x09,
+  0x02, 0x09, 0x04, 0x0E, 0x04, 0x02, 0x08, 0x04, 0x0E, 0x04, 0x02, 0x07,
+  0x04, 0x0E, 0x04, 0x02, 0x07, 0x04, 0x0E, 0x04, 0x02, 0x06, 0x04, 0x0E,
+  0x04, 0x02, 0x05, 0x04, 0x0E, 0x04, 0x02, 0x04, 0x04, 0x0E, 0x04, 0x02,
+  0x04, 0x04, 0x0E, 0x04, 0x02, 0x03, 0x04, 0x0E, 0x04, 0x02, 0x02, 0x04,
+  0x0E, 0x04, 0x02, 0x01, 0x04, 0x0E, 0x04, 0x02, 0x01, 0x04, 0x0E, 0x04,
+  0x02, 0x00, 0x04, 0x0E, 0x04, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01,
+  0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x0E, 0x04, 0x01, 0x0E, 0x04, 0x01,
+  0x0E, 0x04, 0x01, 0x0E, 0x04, 0x01, 0x0E, 0x04, 0x01, 0x0E, 0x04, 0x01,
+  0x0E, 0x04, 0x01, 0x0E, 0x04, 0x01, 0x03, 0x11, 0x01, 0x03, 0x11, 0x01,
+  0x03, 0x11, 0x01, 0x03, 0x11, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x04, 0x02, 0x01, 0x05, 0x08, 0x07, 0x02, 0x01, 0x04, 0x06, 0x0B,
+  0x01, 0x01, 0x11, 0x01, 0x01, 0x12, 0x02, 0x01, 0x06, 0x0E, 0x06, 0x02,
+  0x01, 0x04, 0x0F, 0x06, 0x01, 0x10, 0x05, 0x01, 0x11, 0x05, 0x01, 0x12,
+  0x04, 0x01, 0x12, 0x04, 0x01, 0x12, 0x04, 0x01, 0x12, 0x04, 0x01, 0x12,
+  0x04, 0x01, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x05,
+  0x11, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x05, 0x10, 0x04,
+  0x02, 0x01, 0x07, 0x0E, 0x06, 0x01, 0x02, 0x11, 0x01, 0x03, 0x0F, 0x01,
+  0x04, 0x0D, 0x01, 0x07, 0x07, 0x01, 0x08, 0x07, 0x01, 0x06, 0x0B, 0x01,
+  0x05, 0x0D, 0x01, 0x04, 0x0F, 0x02, 0x03, 0x06, 0x0E, 0x06, 0x02, 0x02,
+  0x05, 0x0F, 0x05, 0x02, 0x02, 0x04, 0x10, 0x05, 0x02, 0x02, 0x04, 0x11,
+  0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03,
+  0x01, 0x00, 0x04, 0x02, 0x00, 0x04, 0x08, 0x07, 0x02, 0x00, 0x04, 0x06,
+  0x0B, 0x02, 0x00, 0x04, 0x05, 0x0E, 0x01, 0x00, 0x14, 0x02, 0x00, 0x08,
+  0x0E, 0x06, 0x02, 0x00, 0x06, 0x10, 0x05, 0x02, 0x00, 0x05, 0x11, 0x04,
+  0x02, 0x00, 0x05, 0x11, 0x05, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00,
+  0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12,
+  0x04, 0x02, 0x01, 0x03, 0x12, 0x04, 0x02, 0x01, 0x03, 0x12, 0x04, 0x02,
+  0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x02, 0x05,
+  0x10, 0x05, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x01, 0x03, 0x10, 0x01, 0x04,
+  0x0E, 0x01, 0x05, 0x0C, 0x01, 0x07, 0x08, 0x01, 0x00, 0x15, 0x01, 0x00,
+  0x15, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15, 0x01, 0x11, 0x03, 0x01, 0x10,
+  0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x03, 0x01, 0x0E, 0x04, 0x01, 0x0D,
+  0x04, 0x01, 0x0D, 0x03, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x03, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x03, 0x01, 0x09,
+  0x04, 0x01, 0x09, 0x03, 0x01, 0x08, 0x04, 0x01, 0x08, 0x03, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x01, 0x06,
+  0x04, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x07,
+  0x08, 0x01, 0x05, 0x0C, 0x01, 0x04, 0x0E, 0x01, 0x03, 0x10, 0x02, 0x02,
+  0x06, 0x0E, 0x06, 0x02, 0x01, 0x05, 0x10, 0x04, 0x02, 0x01, 0x05, 0x10,
+  0x05, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02,
+  0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x10, 0x05, 0x02, 0x02, 0x04,
+  0x10, 0x04, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x01, 0x03, 0x10, 0x01, 0x05,
+  0x0C, 0x01, 0x04, 0x0E, 0x01, 0x03, 0x10, 0x02, 0x02, 0x06, 0x0E, 0x06,
+  0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x00,
+  0x05, 0x11, 0x05, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12,
+  0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02,
+  0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x05, 0x11, 0x05, 0x02, 0x01, 0x04,
+  0x11, 0x04, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x02, 0x06, 0x0E, 0x06,
+  0x01, 0x02, 0x12, 0x01, 0x03, 0x10, 0x01, 0x05, 0x0C, 0x01, 0x07, 0x08,
+  0x01, 0x07, 0x07, 0x01, 0x05, 0x0B, 0x01, 0x04, 0x0D, 0x01, 0x03, 0x0F,
+  0x02, 0x02, 0x06, 0x0D, 0x06, 0x02, 0x01, 0x05, 0x0F, 0x04, 0x02, 0x01,
+  0x04, 0x0F, 0x05, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x11,
+  0x03, 0x02, 0x00, 0x04, 0x11, 0x03, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02,
+  0x00, 0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x00, 0x04,
+  0x11, 0x04, 0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x01, 0x04, 0x10, 0x05,
+  0x02, 0x01, 0x05, 0x0F, 0x06, 0x02, 0x02, 0x06, 0x0D, 0x08, 0x01, 0x02,
+  0x13, 0x02, 0x03, 0x0D, 0x11, 0x04, 0x02, 0x04, 0x0B, 0x11, 0x04, 0x02,
+  0x07, 0x06, 0x11, 0x04, 0x01, 0x11, 0x04, 0x01, 0x11, 0x03, 0x01, 0x10,
+  0x04, 0x01, 0x10, 0x04, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x01, 0x04,
+  0x0F, 0x04, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x05, 0x0D, 0x05,
+  0x01, 0x02, 0x0F, 0x01, 0x03, 0x0D, 0x01, 0x04, 0x0B, 0x01, 0x06, 0x07,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02,
+  0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x02, 0x00, 0x01, 0x14, 0x03, 0x01, 0x12, 0x05, 0x01, 0x10,
+  0x07, 0x01, 0x0D, 0x09, 0x01, 0x0B, 0x08, 0x01, 0x08, 0x09, 0x01, 0x06,
+  0x09, 0x01, 0x04, 0x08, 0x01, 0x01, 0x09, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x07, 0x01, 0x01, 0x08, 0x01, 0x03, 0x09, 0x01, 0x05,
+  0x09, 0x01, 0x08, 0x08, 0x01, 0x0A, 0x09, 0x01, 0x0C, 0x09, 0x01, 0x0F,
+  0x08, 0x01, 0x11, 0x06, 0x01, 0x14, 0x03, 0x01, 0x16, 0x01, 0x01, 0x00,
+  0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01,
+  0x00, 0x17, 0x01, 0x00, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x06, 0x01,
+  0x00, 0x08, 0x01, 0x02, 0x08, 0x01, 0x04, 0x09, 0x01, 0x06, 0x09, 0x01,
+  0x09, 0x08, 0x01, 0x0B, 0x09, 0x01, 0x0E, 0x08, 0x01, 0x10, 0x07, 0x01,
+  0x12, 0x05, 0x01, 0x11, 0x06, 0x01, 0x0F, 0x08, 0x01, 0x0C, 0x08, 0x01,
+  0x0A, 0x08, 0x01, 0x07, 0x09, 0x01, 0x05, 0x08, 0x01, 0x02, 0x09, 0x01,
+  0x00, 0x09, 0x01, 0x00, 0x06, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x01,
+  0x06, 0x07, 0x01, 0x04, 0x0C, 0x01, 0x03, 0x0E, 0x01, 0x02, 0x10, 0x02,
+  0x01, 0x06, 0x0C, 0x07, 0x02, 0x01, 0x04, 0x0E, 0x05, 0x02, 0x01, 0x04,
+  0x0F, 0x05, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04,
+  0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x01, 0x0F,
+  0x05, 0x01, 0x0F, 0x04, 0x01, 0x0E, 0x05, 0x01, 0x0D, 0x05, 0x01, 0x0C,
+  0x05, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x06, 0x01, 0x09, 0x05, 0x01, 0x08,
+  0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01,
+  0x07, 0x04, 0x01, 0x12, 0x09, 0x01, 0x0E, 0x11, 0x01, 0x0C, 0x15, 0x01,
+  0x0B, 0x18, 0x02, 0x09, 0x09, 0x1A, 0x0A, 0x02, 0x08, 0x07, 0x1D, 0x08,
+  0x02, 0x07, 0x06, 0x1F, 0x07, 0x02, 0x06, 0x05, 0x21, 0x06, 0x02, 0x05,
+  0x05, 0x22, 0x06, 0x02, 0x04, 0x05, 0x23, 0x06, 0x03, 0x04, 0x04, 0x13,
+  0x06, 0x24, 0x05, 0x04, 0x03, 0x04, 0x11, 0x09, 0x1D, 0x04, 0x25, 0x05,
+  0x04, 0x02, 0x05, 0x0F, 0x0C, 0x1D, 0x04, 0x26, 0x04, 0x04, 0x02, 0x04,
+  0x0E, 0x06, 0x18, 0x09, 0x26, 0x05, 0x04, 0x01, 0x05, 0x0D, 0x05, 0x19,
+  0x07, 0x26, 0x05, 0x04, 0x01, 0x04, 0x0C, 0x05, 0x1A, 0x06, 0x27, 0x04,
+  0x04, 0x01, 0x04, 0x0C, 0x04, 0x1A, 0x06, 0x27, 0x04, 0x04, 0x01, 0x04,
+  0x0B, 0x04, 0x1A, 0x05, 0x27, 0x04, 0x04, 0x00, 0x04, 0x0B, 0x04, 0x1A,
+  0x05, 0x27, 0x04, 0x04, 0x00, 0x04, 0x0B, 0x04, 0x1A, 0x05, 0x27, 0x04,
+  0x04, 0x00, 0x04, 0x0A, 0x04, 0x1A, 0x04, 0x27, 0x04, 0x04, 0x00, 0x04,
+  0x0A, 0x04, 0x1A, 0x04, 0x26, 0x05, 0x04, 0x00, 0x04, 0x0A, 0x04, 0x19,
+  0x05, 0x26, 0x04, 0x04, 0x00, 0x04, 0x0A, 0x04, 0x19, 0x04, 0x26, 0x04,
+  0x04, 0x00, 0x04, 0x0A, 0x04, 0x19, 0x04, 0x25, 0x04, 0x04, 0x00, 0x04,
+  0x0A, 0x04, 0x18, 0x05, 0x24, 0x05, 0x04, 0x00, 0x05, 0x0A, 0x05, 0x17,
+  0x05, 0x24, 0x04, 0x04, 0x01, 0x04, 0x0B, 0x05, 0x16, 0x06, 0x23, 0x05,
+  0x04, 0x01, 0x04, 0x0B, 0x06, 0x15, 0x08, 0x21, 0x06, 0x03, 0x01, 0x05,
+  0x0C, 0x0C, 0x19, 0x0D, 0x03, 0x02, 0x04, 0x0D, 0x09, 0x19, 0x0B, 0x03,
+  0x02, 0x05, 0x0F, 0x05, 0x1B, 0x07, 0x01, 0x03, 0x05, 0x01, 0x03, 0x06,
+  0x01, 0x04, 0x06, 0x01, 0x05, 0x07, 0x01, 0x06, 0x07, 0x02, 0x07, 0x09,
+  0x1A, 0x05, 0x01, 0x09, 0x16, 0x01, 0x0A, 0x16, 0x01, 0x0C, 0x12, 0x01,
+  0x10, 0x0A, 0x01, 0x0C, 0x06, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07, 0x01,
+  0x0B, 0x08, 0x01, 0x0A, 0x09, 0x02, 0x0A, 0x04, 0x0F, 0x05, 0x02, 0x0A,
+  0x04, 0x0F, 0x05, 0x02, 0x09, 0x05, 0x10, 0x04, 0x02, 0x09, 0x04, 0x10,
+  0x05, 0x02, 0x09, 0x04, 0x10, 0x05, 0x02, 0x08, 0x05, 0x11, 0x04, 0x02,
+  0x08, 0x04, 0x11, 0x05, 0x02, 0x07, 0x05, 0x11, 0x05, 0x02, 0x07, 0x04,
+  0x12, 0x04, 0x02, 0x07, 0x04, 0x12, 0x05, 0x02, 0x06, 0x05, 0x12, 0x05,
+  0x02, 0x06, 0x04, 0x13, 0x04, 0x02, 0x06, 0x04, 0x13, 0x05, 0x02, 0x05,
+  0x05, 0x13, 0x05, 0x02, 0x05, 0x04, 0x14, 0x04, 0x01, 0x05, 0x14, 0x01,
+  0x04, 0x15, 0x01, 0x04, 0x16, 0x01, 0x03, 0x17, 0x02, 0x03, 0x05, 0x15,
+  0x05, 0x02, 0x03, 0x04, 0x16, 0x05, 0x02, 0x02, 0x05, 0x16, 0x05, 0x02,
+  0x02, 0x05, 0x16, 0x05, 0x02, 0x02, 0x04, 0x17, 0x05, 0x02, 0x01, 0x05,
+  0x17, 0x05, 0x02, 0x01, 0x05, 0x17, 0x05, 0x02, 0x01, 0x04, 0x18, 0x05,
+  0x02, 0x00, 0x05, 0x18, 0x05, 0x02, 0x00, 0x05, 0x19, 0x04, 0x01, 0x00,
+  0x11, 0x01, 0x00, 0x13, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15, 0x02, 0x00,
+  0x04, 0x10, 0x06, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12,
+  0x05, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02,
+  0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04,
+  0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x10, 0x05,
+  0x01, 0x00, 0x14, 0x01, 0x00, 0x13, 0x01, 0x00, 0x15, 0x01, 0x00, 0x16,
+  0x02, 0x00, 0x04, 0x12, 0x05, 0x02, 0x00, 0x04, 0x13, 0x05, 0x02, 0x00,
+  0x04, 0x14, 0x04, 0x02, 0x00, 0x04, 0x15, 0x04, 0x02, 0x00, 0x04, 0x15,
+  0x04, 0x02, 0x00, 0x04, 0x15, 0x04, 0x02, 0x00, 0x04, 0x15, 0x04, 0x02,
+  0x00, 0x04, 0x15, 0x04, 0x02, 0x00, 0x04, 0x15, 0x04, 0x02, 0x00, 0x04,
+  0x14, 0x05, 0x02, 0x00, 0x04, 0x13, 0x05, 0x02, 0x00, 0x04, 0x12, 0x06,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x16, 0x01, 0x00, 0x15, 0x01, 0x00, 0x13,
+  0x01, 0x0B, 0x08, 0x01, 0x08, 0x0E, 0x01, 0x07, 0x11, 0x01, 0x05, 0x14,
+  0x02, 0x04, 0x07, 0x13, 0x06, 0x02, 0x04, 0x05, 0x15, 0x05, 0x02, 0x03,
+  0x05, 0x16, 0x05, 0x02, 0x02, 0x05, 0x17, 0x04, 0x02, 0x02, 0x04, 0x17,
+  0x04, 0x02, 0x01, 0x05, 0x18, 0x04, 0x02, 0x01, 0x04, 0x18, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x02,
+  0x01, 0x04, 0x19, 0x04, 0x02, 0x01, 0x04, 0x19, 0x04, 0x02, 0x01, 0x04,
+  0x18, 0x05, 0x02, 0x01, 0x05, 0x18, 0x04, 0x02, 0x02, 0x04, 0x18, 0x04,
+  0x02, 0x02, 0x05, 0x17, 0x05, 0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x04,
+  0x05, 0x15, 0x06, 0x02, 0x04, 0x08, 0x13, 0x07, 0x01, 0x05, 0x14, 0x01,
+  0x07, 0x11, 0x01, 0x08, 0x0E, 0x01, 0x0B, 0x08, 0x01, 0x00, 0x11, 0x01,
+  0x00, 0x14, 0x01, 0x00, 0x15, 0x01, 0x00, 0x16, 0x02, 0x00, 0x04, 0x10,
+  0x07, 0x02, 0x00, 0x04, 0x12, 0x06, 0x02, 0x00, 0x04, 0x13, 0x06, 0x02,
+  0x00, 0x04, 0x14, 0x05, 0x02, 0x00, 0x04, 0x15, 0x05, 0x02, 0x00, 0x04,
+  0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04,
+  0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x00,
+  0x04, 0x17, 0x04, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x00, 0x04, 0x17,
+  0x04, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02,
+  0x00, 0x04, 0x17, 0x04, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x00, 0x04,
+  0x17, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04,
+  0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x15, 0x05, 0x02, 0x00,
+  0x04, 0x14, 0x05, 0x02, 0x00, 0x04, 0x13, 0x06, 0x02, 0x00, 0x04, 0x12,
+  0x06, 0x02, 0x00, 0x04, 0x10, 0x07, 0x01, 0x00, 0x16, 0x01, 0x00, 0x15,
+  0x01, 0x00, 0x14, 0x01, 0x00, 0x11, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18,
+  0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x14,
+  0x01, 0x00, 0x14, 0x01, 0x00, 0x14, 0x01, 0x00, 0x14, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x0C, 0x09, 0x01, 0x09, 0x0F,
+  0x01, 0x07, 0x13, 0x01, 0x06, 0x15, 0x02, 0x05, 0x08, 0x15, 0x07, 0x02,
+  0x04, 0x06, 0x17, 0x06, 0x02, 0x03, 0x06, 0x19, 0x05, 0x02, 0x03, 0x05,
+  0x1A, 0x04, 0x02, 0x02, 0x05, 0x1A, 0x05, 0x02, 0x02, 0x04, 0x1B, 0x04,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x02, 0x00, 0x04,
+  0x11, 0x0E, 0x02, 0x00, 0x04, 0x11, 0x0E, 0x02, 0x00, 0x04, 0x11, 0x0E,
+  0x02, 0x00, 0x04, 0x11, 0x0E, 0x02, 0x00, 0x04, 0x1B, 0x04, 0x02, 0x00,
+  0x05, 0x1B, 0x04, 0x02, 0x01, 0x04, 0x1B, 0x04, 0x02, 0x01, 0x04, 0x1B,
+  0x04, 0x02, 0x01, 0x05, 0x1A, 0x05, 0x02, 0x01, 0x05, 0x1A, 0x05, 0x02,
+  0x02, 0x05, 0x19, 0x06, 0x02, 0x02, 0x06, 0x19, 0x06, 0x02, 0x03, 0x06,
+  0x18, 0x07, 0x02, 0x04, 0x06, 0x16, 0x09, 0x03, 0x05, 0x08, 0x14, 0x06,
+  0x1B, 0x04, 0x02, 0x06, 0x13, 0x1B, 0x04, 0x02, 0x07, 0x11, 0x1C, 0x03,
+  0x02, 0x09, 0x0D, 0x1C, 0x03, 0x01, 0x0C, 0x08, 0x02, 0x00, 0x04, 0x16,
+  0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02,
+  0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04,
+  0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04,
+  0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00,
+  0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16,
+  0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x01,
+  0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x02,
+  0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04,
+  0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04,
+  0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00,
+  0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16,
+  0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02,
+  0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04,
+  0x16, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x0F, 0x04, 0x01,
+  0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01,
+  0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01,
+  0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01,
+  0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01,
+  0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01,
+  0x0F, 0x04, 0x01, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00,
+  0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F,
+  0x04, 0x02, 0x00, 0x04, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02,
+  0x01, 0x04, 0x0D, 0x05, 0x02, 0x01, 0x06, 0x0C, 0x06, 0x01, 0x02, 0x0F,
+  0x01, 0x02, 0x0E, 0x01, 0x04, 0x0B, 0x01, 0x06, 0x07, 0x02, 0x00, 0x04,
+  0x15, 0x05, 0x02, 0x00, 0x04, 0x14, 0x05, 0x02, 0x00, 0x04, 0x13, 0x05,
+  0x02, 0x00, 0x04, 0x12, 0x05, 0x02, 0x00, 0x04, 0x11, 0x05, 0x02, 0x00,
+  0x04, 0x10, 0x05, 0x02, 0x00, 0x04, 0x0F, 0x05, 0x02, 0x00, 0x04, 0x0E,
+  0x05, 0x02, 0x00, 0x04, 0x0D, 0x05, 0x02, 0x00, 0x04, 0x0C, 0x05, 0x02,
+  0x00, 0x04, 0x0B, 0x05, 0x02, 0x00, 0x04, 0x0A, 0x05, 0x02, 0x00, 0x04,
+  0x09, 0x05, 0x02, 0x00, 0x04, 0x08, 0x05, 0x02, 0x00, 0x04, 0x07, 0x06,
+  0x02, 0x00, 0x04, 0x06, 0x08, 0x02, 0x00, 0x04, 0x05, 0x0A, 0x02, 0x00,
+  0x09, 0x0A, 0x05, 0x02, 0x00, 0x08, 0x0B, 0x05, 0x02, 0x00, 0x07, 0x0C,
+  0x05, 0x02, 0x00, 0x06, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02,
+  0x00, 0x04, 0x0E, 0x05, 0x02, 0x00, 0x04, 0x0E, 0x06, 0x02, 0x00, 0x04,
+  0x0F, 0x05, 0x02, 0x00, 0x04, 0x10, 0x05, 0x02, 0x00, 0x04, 0x10, 0x06,
+  0x02, 0x00, 0x04, 0x11, 0x05, 0x02, 0x00, 0x04, 0x12, 0x05, 0x02, 0x00,
+  0x04, 0x13, 0x05, 0x02, 0x00, 0x04, 0x13, 0x05, 0x02, 0x00, 0x04, 0x14,
+  0x05, 0x02, 0x00, 0x04, 0x15, 0x05, 0x02, 0x00, 0x04, 0x15, 0x06, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15, 0x01,
+  0x00, 0x15, 0x01, 0x00, 0x15, 0x02, 0x00, 0x06, 0x1A, 0x06, 0x02, 0x00,
+  0x06, 0x1A, 0x06, 0x02, 0x00, 0x07, 0x19, 0x07, 0x02, 0x00, 0x07, 0x19,
+  0x07, 0x02, 0x00, 0x07, 0x19, 0x07, 0x02, 0x00, 0x08, 0x18, 0x08, 0x02,
+  0x00, 0x08, 0x18, 0x08, 0x04, 0x00, 0x04, 0x05, 0x03, 0x18, 0x03, 0x1C,
+  0x04, 0x04, 0x00, 0x04, 0x05, 0x04, 0x17, 0x04, 0x1C, 0x04, 0x04, 0x00,
+  0x04, 0x05, 0x04, 0x17, 0x04, 0x1C, 0x04, 0x04, 0x00, 0x04, 0x06, 0x04,
+  0x17, 0x03, 0x1C, 0x04, 0x04, 0x00, 0x04, 0x06, 0x04, 0x16, 0x04, 0x1C,
+  0x04, 0x04, 0x00, 0x04, 0x06, 0x04, 0x16, 0x04, 0x1C, 0x04, 0x04, 0x00,
+  0x04, 0x07, 0x04, 0x16, 0x03, 0x1C, 0x04, 0x04, 0x00, 0x04, 0x07, 0x04,
+  0x15, 0x04, 0x1C, 0x04, 0x04, 0x00, 0x04, 0x07, 0x04, 0x15, 0x04, 0x1C,
+  0x04, 0x04, 0x00, 0x04, 0x08, 0x04, 0x14, 0x04, 0x1C, 0x04, 0x04, 0x00,
+  0x04, 0x08, 0x04, 0x14, 0x04, 0x1C, 0x04, 0x04, 0x00, 0x04, 0x08, 0x04,
+  0x14, 0x04, 0x1C, 0x04, 0x04, 0x00, 0x04, 0x09, 0x04, 0x13, 0x04, 0x1C,
+  0x04, 0x04, 0x00, 0x04, 0x09, 0x04, 0x13, 0x04, 0x1C, 0x04, 0x04, 0x00,
+  0x04, 0x09, 0x04, 0x13, 0x04, 0x1C, 0x04, 0x04, 0x00, 0x04, 0x0A, 0x04,
+  0x12, 0x04, 0x1C, 0x04, 0x04, 0x00, 0x04, 0x0A, 0x04, 0x12, 0x04, 0x1C,
+  0x04, 0x04, 0x00, 0x04, 0x0A, 0x04, 0x12, 0x04, 0x1C, 0x04, 0x04, 0x00,
+  0x04, 0x0B, 0x04, 0x11, 0x04, 0x1C, 0x04, 0x04, 0x00, 0x04, 0x0B, 0x04,
+  0x11, 0x04, 0x1C, 0x04, 0x04, 0x00, 0x04, 0x0C, 0x03, 0x11, 0x04, 0x1C,
+  0x04, 0x03, 0x00, 0x04, 0x0C, 0x08, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0C,
+  0x08, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0D, 0x07, 0x1C, 0x04, 0x03, 0x00,
+  0x04, 0x0D, 0x06, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0D, 0x06, 0x1C, 0x04,
+  0x03, 0x00, 0x04, 0x0E, 0x05, 0x1C, 0x04, 0x02, 0x00, 0x05, 0x16, 0x04,
+  0x02, 0x00, 0x06, 0x16, 0x04, 0x02, 0x00, 0x06, 0x16, 0x04, 0x02, 0x00,
+  0x07, 0x16, 0x04, 0x02, 0x00, 0x07, 0x16, 0x04, 0x02, 0x00, 0x08, 0x16,
+  0x04, 0x02, 0x00, 0x09, 0x16, 0x04, 0x03, 0x00, 0x04, 0x05, 0x04, 0x16,
+  0x04, 0x03, 0x00, 0x04, 0x05, 0x05, 0x16, 0x04, 0x03, 0x00, 0x04, 0x06,
+  0x05, 0x16, 0x04, 0x03, 0x00, 0x04, 0x07, 0x04, 0x16, 0x04, 0x03, 0x00,
+  0x04, 0x07, 0x05, 0x16, 0x04, 0x03, 0x00, 0x04, 0x08, 0x04, 0x16, 0x04,
+  0x03, 0x00, 0x04, 0x08, 0x05, 0x16, 0x04, 0x03, 0x00, 0x04, 0x09, 0x05,
+  0x16, 0x04, 0x03, 0x00, 0x04, 0x0A, 0x04, 0x16, 0x04, 0x03, 0x00, 0x04,
+  0x0A, 0x05, 0x16, 0x04, 0x03, 0x00, 0x04, 0x0B, 0x05, 0x16, 0x04, 0x03,
+  0x00, 0x04, 0x0C, 0x04, 0x16, 0x04, 0x03, 0x00, 0x04, 0x0C, 0x05, 0x16,
+  0x04, 0x03, 0x00, 0x04, 0x0D, 0x04, 0x16, 0x04, 0x03, 0x00, 0x04, 0x0D,
+  0x05, 0x16, 0x04, 0x03, 0x00, 0x04, 0x0E, 0x05, 0x16, 0x04, 0x03, 0x00,
+  0x04, 0x0F, 0x04, 0x16, 0x04, 0x03, 0x00, 0x04, 0x0F, 0x05, 0x16, 0x04,
+  0x03, 0x00, 0x04, 0x10, 0x05, 0x16, 0x04, 0x03, 0x00, 0x04, 0x11, 0x04,
+  0x16, 0x04, 0x02, 0x00, 0x04, 0x11, 0x09, 0x02, 0x00, 0x04, 0x12, 0x08,
+  0x02, 0x00, 0x04, 0x12, 0x08, 0x02, 0x00, 0x04, 0x13, 0x07, 0x02, 0x00,
+  0x04, 0x14, 0x06, 0x02, 0x00, 0x04, 0x14, 0x06, 0x02, 0x00, 0x04, 0x15,
+  0x05, 0x01, 0x0C, 0x09, 0x01, 0x09, 0x0F, 0x01, 0x07, 0x13, 0x01, 0x06,
+  0x15, 0x02, 0x05, 0x08, 0x14, 0x08, 0x02, 0x04, 0x06, 0x17, 0x06, 0x02,
+  0x03, 0x06, 0x18, 0x06, 0x02, 0x03, 0x05, 0x19, 0x05, 0x02, 0x02, 0x05,
+  0x1A, 0x05, 0x02, 0x02, 0x04, 0x1B, 0x04, 0x02, 0x01, 0x05, 0x1B, 0x05,
+  0x02, 0x01, 0x04, 0x1C, 0x04, 0x02, 0x01, 0x04, 0x1C, 0x04, 0x02, 0x00,
+  0x05, 0x1C, 0x05, 0x02, 0x00, 0x04, 0x1D, 0x04, 0x02, 0x00, 0x04, 0x1D,
+  0x04, 0x02, 0x00, 0x04, 0x1D, 0x04, 0x02, 0x00, 0x04, 0x1D, 0x04, 0x02,
+  0x00, 0x04, 0x1D, 0x04, 0x02, 0x00, 0x04, 0x1D, 0x04, 0x02, 0x00, 0x04,
+  0x1D, 0x04, 0x02, 0x00, 0x04, 0x1D, 0x04, 0x02, 0x00, 0x04, 0x1C, 0x05,
+  0x02, 0x01, 0x04, 0x1C, 0x04, 0x02, 0x01, 0x04, 0x1C, 0x04, 0x02, 0x01,
+  0x05, 0x1B, 0x05, 0x02, 0x02, 0x04, 0x1B, 0x04, 0x02, 0x02, 0x05, 0x1A,
+  0x05, 0x02, 0x03, 0x05, 0x19, 0x05, 0x02, 0x03, 0x06, 0x18, 0x06, 0x02,
+  0x04, 0x06, 0x17, 0x06, 0x02, 0x05, 0x08, 0x14, 0x08, 0x01, 0x06, 0x15,
+  0x01, 0x07, 0x13, 0x01, 0x09, 0x0F, 0x01, 0x0C, 0x09, 0x01, 0x00, 0x11,
+  0x01, 0x00, 0x14, 0x01, 0x00, 0x15, 0x01, 0x00, 0x16, 0x02, 0x00, 0x04,
+  0x10, 0x07, 0x02, 0x00, 0x04, 0x12, 0x05, 0x02, 0x00, 0x04, 0x13, 0x05,
+  0x02, 0x00, 0x04, 0x14, 0x04, 0x02, 0x00, 0x04, 0x14, 0x04, 0x02, 0x00,
+  0x04, 0x14, 0x04, 0x02, 0x00, 0x04, 0x14, 0x04, 0x02, 0x00, 0x04, 0x14,
+  0x04, 0x02, 0x00, 0x04, 0x14, 0x04, 0x02, 0x00, 0x04, 0x13, 0x05, 0x02,
+  0x00, 0x04, 0x12, 0x05, 0x02, 0x00, 0x04, 0x10, 0x07, 0x01, 0x00, 0x16,
+  0x01, 0x00, 0x15, 0x01, 0x00, 0x14, 0x01, 0x00, 0x12, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x0C, 0x09, 0x01, 0x09, 0x0F, 0x01, 0x07, 0x12,
+  0x01, 0x06, 0x15, 0x02, 0x05, 0x08, 0x14, 0x08, 0x02, 0x04, 0x06, 0x17,
+  0x06, 0x02, 0x03, 0x06, 0x18, 0x06, 0x02, 0x03, 0x05, 0x19, 0x05, 0x02,
+  0x02, 0x05, 0x1A, 0x05, 0x02, 0x02, 0x04, 0x1B, 0x04, 0x02, 0x01, 0x05,
+  0x1B, 0x05, 0x02, 0x01, 0x04, 0x1C, 0x04, 0x02, 0x01, 0x04, 0x1C, 0x04,
+  0x02, 0x00, 0x05, 0x1C, 0x05, 0x02, 0x00, 0x04, 0x1D, 0x04, 0x02, 0x00,
+  0x04, 0x1D, 0x04, 0x02, 0x00, 0x04, 0x1D, 0x04, 0x02, 0x00, 0x04, 0x1D,
+  0x04, 0x02, 0x00, 0x04, 0x1D, 0x04, 0x02, 0x00, 0x04, 0x1D, 0x04, 0x02,
+  0x00, 0x04, 0x1D, 0x04, 0x02, 0x00, 0x04, 0x1D, 0x04, 0x02, 0x00, 0x04,
+  0x1C, 0x05, 0x02, 0x01, 0x04, 0x1C, 0x04, 0x02, 0x01, 0x04, 0x1C, 0x04,
+  0x02, 0x01, 0x05, 0x1B, 0x05, 0x03, 0x02, 0x04, 0x14, 0x03, 0x1B, 0x04,
+  0x03, 0x02, 0x05, 0x13, 0x05, 0x1A, 0x05, 0x02, 0x03, 0x05, 0x14, 0x0A,
+  0x02, 0x03, 0x06, 0x15, 0x09, 0x02, 0x04, 0x06, 0x16, 0x07, 0x02, 0x05,
+  0x08, 0x14, 0x09, 0x01, 0x06, 0x18, 0x01, 0x07, 0x18, 0x02, 0x09, 0x0F,
+  0x1B, 0x05, 0x02, 0x0C, 0x09, 0x1C, 0x04, 0x01, 0x1D, 0x03, 0x01, 0x1E,
+  0x01, 0x01, 0x00, 0x13, 0x01, 0x00, 0x15, 0x01, 0x00, 0x16, 0x01, 0x00,
+  0x17, 0x02, 0x00, 0x04, 0x12, 0x06, 0x02, 0x00, 0x04, 0x13, 0x05, 0x02,
+  0x00, 0x04, 0x14, 0x05, 0x02, 0x00, 0x04, 0x15, 0x04, 0x02, 0x00, 0x04,
+  0x15, 0x04, 0x02, 0x00, 0x04, 0x15, 0x04, 0x02, 0x00, 0x04, 0x15, 0x04,
+  0x02, 0x00, 0x04, 0x15, 0x04, 0x02, 0x00, 0x04, 0x15, 0x04, 0x02, 0x00,
+  0x04, 0x14, 0x04, 0x02, 0x00, 0x04, 0x13, 0x05, 0x02, 0x00, 0x04, 0x12,
+  0x05, 0x01, 0x00, 0x16, 0x01, 0x00, 0x15, 0x01, 0x00, 0x16, 0x01, 0x00,
+  0x17, 0x02, 0x00, 0x04, 0x12, 0x06, 0x02, 0x00, 0x04, 0x14, 0x04, 0x02,
+  0x00, 0x04, 0x14, 0x05, 0x02, 0x00, 0x04, 0x15, 0x04, 0x02, 0x00, 0x04,
+  0x15, 0x04, 0x02, 0x00, 0x04, 0x15, 0x04, 0x02, 0x00, 0x04, 0x15, 0x04,
+  0x02, 0x00, 0x04, 0x15, 0x04, 0x02, 0x00, 0x04, 0x15, 0x04, 0x02, 0x00,
+  0x04, 0x15, 0x04, 0x02, 0x00, 0x04, 0x15, 0x04, 0x02, 0x00, 0x04, 0x15,
+  0x04, 0x02, 0x00, 0x04, 0x15, 0x05, 0x02, 0x00, 0x04, 0x15, 0x05, 0x01,
+  0x09, 0x09, 0x01, 0x06, 0x0F, 0x01, 0x05, 0x11, 0x01, 0x03, 0x15, 0x02,
+  0x03, 0x06, 0x11, 0x07, 0x02, 0x02, 0x05, 0x14, 0x05, 0x02, 0x02, 0x04,
+  0x15, 0x04, 0x02, 0x01, 0x05, 0x15, 0x05, 0x02, 0x01, 0x04, 0x16, 0x04,
+  0x02, 0x01, 0x04, 0x16, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x05, 0x01, 0x02, 0x06, 0x01, 0x02, 0x08, 0x01, 0x03, 0x0B, 0x01,
+  0x04, 0x0E, 0x01, 0x06, 0x0F, 0x01, 0x09, 0x0E, 0x01, 0x0D, 0x0B, 0x01,
+  0x11, 0x08, 0x01, 0x13, 0x07, 0x01, 0x15, 0x05, 0x01, 0x16, 0x05, 0x01,
+  0x17, 0x04, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x00, 0x04, 0x17, 0x04,
+  0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x01, 0x04, 0x16, 0x05, 0x02, 0x01,
+  0x05, 0x16, 0x04, 0x02, 0x01, 0x06, 0x15, 0x05, 0x02, 0x02, 0x08, 0x12,
+  0x07, 0x01, 0x03, 0x15, 0x01, 0x04, 0x13, 0x01, 0x06, 0x0F, 0x01, 0x09,
+  0x09, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00,
+  0x1A, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04,
+  0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00,
+  0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16,
+  0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02,
+  0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04,
+  0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04,
+  0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00,
+  0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16,
+  0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02,
+  0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04,
+  0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04,
+  0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x15, 0x05, 0x02, 0x01,
+  0x04, 0x15, 0x04, 0x02, 0x01, 0x05, 0x14, 0x05, 0x02, 0x01, 0x06, 0x13,
+  0x06, 0x02, 0x02, 0x07, 0x11, 0x07, 0x01, 0x03, 0x14, 0x01, 0x04, 0x12,
+  0x01, 0x06, 0x0E, 0x01, 0x08, 0x09, 0x02, 0x00, 0x05, 0x18, 0x04, 0x02,
+  0x00, 0x05, 0x17, 0x05, 0x02, 0x01, 0x04, 0x17, 0x05, 0x02, 0x01, 0x05,
+  0x17, 0x04, 0x02, 0x01, 0x05, 0x16, 0x05, 0x02, 0x02, 0x04, 0x16, 0x05,
+  0x02, 0x02, 0x05, 0x16, 0x04, 0x02, 0x02, 0x05, 0x15, 0x05, 0x02, 0x03,
+  0x04, 0x15, 0x05, 0x02, 0x03, 0x05, 0x15, 0x04, 0x02, 0x03, 0x05, 0x14,
+  0x05, 0x02, 0x04, 0x04, 0x14, 0x05, 0x02, 0x04, 0x05, 0x14, 0x04, 0x02,
+  0x05, 0x04, 0x13, 0x05, 0x02, 0x05, 0x04, 0x13, 0x05, 0x02, 0x05, 0x05,
+  0x13, 0x04, 0x02, 0x06, 0x04, 0x13, 0x04, 0x02, 0x06, 0x05, 0x12, 0x05,
+  0x02, 0x06, 0x05, 0x12, 0x04, 0x02, 0x07, 0x04, 0x12, 0x04, 0x02, 0x07,
+  0x05, 0x11, 0x04, 0x02, 0x07, 0x05, 0x11, 0x04, 0x02, 0x08, 0x04, 0x11,
+  0x04, 0x02, 0x08, 0x05, 0x10, 0x04, 0x02, 0x09, 0x04, 0x10, 0x04, 0x02,
+  0x09, 0x04, 0x10, 0x04, 0x02, 0x09, 0x05, 0x0F, 0x04, 0x02, 0x0A, 0x04,
+  0x0F, 0x04, 0x02, 0x0A, 0x04, 0x0F, 0x04, 0x01, 0x0A, 0x08, 0x01, 0x0B,
+  0x07, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x06, 0x01, 0x0C, 0x05, 0x03, 0x00,
+  0x05, 0x12, 0x06, 0x25, 0x05, 0x03, 0x00, 0x05, 0x12, 0x06, 0x25, 0x05,
+  0x03, 0x00, 0x05, 0x12, 0x06, 0x25, 0x05, 0x03, 0x01, 0x04, 0x12, 0x06,
+  0x25, 0x04, 0x03, 0x01, 0x05, 0x11, 0x08, 0x24, 0x05, 0x03, 0x01, 0x05,
+  0x11, 0x08, 0x24, 0x05, 0x03, 0x01, 0x05, 0x11, 0x08, 0x24, 0x05, 0x03,
+  0x02, 0x04, 0x11, 0x09, 0x24, 0x04, 0x04, 0x02, 0x05, 0x10, 0x04, 0x16,
+  0x04, 0x23, 0x05, 0x04, 0x02, 0x05, 0x10, 0x04, 0x16, 0x04, 0x23, 0x05,
+  0x04, 0x02, 0x05, 0x10, 0x04, 0x16, 0x04, 0x23, 0x05, 0x04, 0x03, 0x04,
+  0x0F, 0x05, 0x17, 0x04, 0x23, 0x04, 0x04, 0x03, 0x05, 0x0F, 0x04, 0x17,
+  0x04, 0x23, 0x04, 0x04, 0x03, 0x05, 0x0F, 0x04, 0x17, 0x04, 0x22, 0x05,
+  0x04, 0x04, 0x04, 0x0F, 0x04, 0x17, 0x04, 0x22, 0x05, 0x04, 0x04, 0x04,
+  0x0E, 0x05, 0x18, 0x04, 0x22, 0x04, 0x04, 0x04, 0x05, 0x0E, 0x04, 0x18,
+  0x04, 0x22, 0x04, 0x04, 0x04, 0x05, 0x0E, 0x04, 0x18, 0x04, 0x21, 0x05,
+  0x04, 0x05, 0x04, 0x0E, 0x04, 0x18, 0x05, 0x21, 0x05, 0x04, 0x05, 0x04,
+  0x0D, 0x04, 0x19, 0x04, 0x21, 0x04, 0x04, 0x05, 0x04, 0x0D, 0x04, 0x19,
+  0x04, 0x21, 0x04, 0x04, 0x05, 0x05, 0x0D, 0x04, 0x19, 0x04, 0x21, 0x04,
+  0x04, 0x06, 0x04, 0x0C, 0x05, 0x1A, 0x04, 0x20, 0x05, 0x04, 0x06, 0x04,
+  0x0C, 0x04, 0x1A, 0x04, 0x20, 0x04, 0x04, 0x06, 0x04, 0x0C, 0x04, 0x1A,
+  0x04, 0x20, 0x04, 0x04, 0x06, 0x05, 0x0C, 0x04, 0x1A, 0x05, 0x20, 0x04,
+  0x02, 0x07, 0x09, 0x1B, 0x09, 0x02, 0x07, 0x08, 0x1B, 0x08, 0x02, 0x07,
+  0x08, 0x1B, 0x08, 0x02, 0x07, 0x08, 0x1C, 0x07, 0x02, 0x08, 0x06, 0x1C,
+  0x07, 0x02, 0x08, 0x06, 0x1C, 0x06, 0x02, 0x08, 0x06, 0x1C, 0x06, 0x02,
+  0x08, 0x06, 0x1D, 0x05, 0x02, 0x01, 0x05, 0x17, 0x05, 0x02, 0x01, 0x06,
+  0x16, 0x06, 0x02, 0x02, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x15, 0x05,
+  0x02, 0x04, 0x05, 0x14, 0x05, 0x02, 0x04, 0x05, 0x14, 0x05, 0x02, 0x05,
+  0x05, 0x13, 0x05, 0x02, 0x06, 0x05, 0x12, 0x05, 0x02, 0x06, 0x05, 0x12,
+  0x05, 0x02, 0x07, 0x05, 0x11, 0x05, 0x02, 0x08, 0x05, 0x10, 0x05, 0x02,
+  0x08, 0x05, 0x10, 0x05, 0x02, 0x09, 0x05, 0x0F, 0x05, 0x01, 0x0A, 0x09,
+  0x01, 0x0A, 0x09, 0x01, 0x0B, 0x07, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x07,
+  0x01, 0x0A, 0x08, 0x01, 0x0A, 0x09, 0x02, 0x09, 0x05, 0x0F, 0x05, 0x02,
+  0x08, 0x05, 0x10, 0x04, 0x02, 0x08, 0x05, 0x10, 0x05, 0x02, 0x07, 0x05,
+  0x11, 0x05, 0x02, 0x06, 0x05, 0x12, 0x05, 0x02, 0x06, 0x05, 0x12, 0x05,
+  0x02, 0x05, 0x05, 0x13, 0x05, 0x02, 0x04, 0x05, 0x13, 0x06, 0x02, 0x04,
+  0x05, 0x14, 0x05, 0x02, 0x03, 0x05, 0x15, 0x05, 0x02, 0x02, 0x05, 0x15,
+  0x06, 0x02, 0x01, 0x06, 0x16, 0x05, 0x02, 0x01, 0x05, 0x17, 0x05, 0x02,
+  0x00, 0x05, 0x17, 0x06, 0x02, 0x00, 0x06, 0x18, 0x06, 0x02, 0x01, 0x05,
+  0x18, 0x05, 0x02, 0x01, 0x06, 0x17, 0x05, 0x02, 0x02, 0x05, 0x17, 0x05,
+  0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x15, 0x05, 0x02, 0x04,
+  0x05, 0x15, 0x05, 0x02, 0x05, 0x05, 0x14, 0x05, 0x02, 0x05, 0x05, 0x14,
+  0x05, 0x02, 0x06, 0x05, 0x13, 0x05, 0x02, 0x07, 0x04, 0x13, 0x04, 0x02,
+  0x07, 0x05, 0x12, 0x05, 0x02, 0x08, 0x05, 0x11, 0x05, 0x02, 0x08, 0x05,
+  0x11, 0x04, 0x02, 0x09, 0x05, 0x10, 0x05, 0x02, 0x0A, 0x04, 0x10, 0x04,
+  0x01, 0x0A, 0x0A, 0x01, 0x0B, 0x08, 0x01, 0x0C, 0x06, 0x01, 0x0C, 0x06,
+  0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04,
+  0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04,
+  0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04,
+  0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x02, 0x18, 0x01, 0x02, 0x18,
+  0x01, 0x02, 0x18, 0x01, 0x02, 0x18, 0x01, 0x15, 0x05, 0x01, 0x14, 0x05,
+  0x01, 0x13, 0x06, 0x01, 0x12, 0x06, 0x01, 0x11, 0x06, 0x01, 0x11, 0x05,
+  0x01, 0x10, 0x05, 0x01, 0x0F, 0x06, 0x01, 0x0E, 0x06, 0x01, 0x0D, 0x06,
+  0x01, 0x0D, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x06, 0x01, 0x0A, 0x06,
+  0x01, 0x09, 0x06, 0x01, 0x09, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x06,
+  0x01, 0x06, 0x06, 0x01, 0x06, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x03, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x00, 0x1B, 0x01, 0x00, 0x1B, 0x01, 0x00, 0x1B, 0x01, 0x00, 0x1B,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03,
+  0x01, 0x04, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x05, 0x02,
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x03, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x07, 0x02, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x09, 0x02, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03,
+  0x01, 0x0A, 0x02, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x05, 0x08,
+  0x02, 0x05, 0x03, 0x0A, 0x03, 0x02, 0x05, 0x03, 0x0A, 0x03, 0x02, 0x04,
+  0x04, 0x0B, 0x03, 0x02, 0x04, 0x03, 0x0B, 0x03, 0x02, 0x03, 0x04, 0x0B,
+  0x04, 0x02, 0x03, 0x03, 0x0C, 0x03, 0x02, 0x03, 0x03, 0x0C, 0x03, 0x02,
+  0x02, 0x03, 0x0D, 0x03, 0x02, 0x02, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x04,
+  0x0D, 0x04, 0x02, 0x01, 0x03, 0x0E, 0x03, 0x02, 0x01, 0x03, 0x0E, 0x03,
+  0x02, 0x00, 0x03, 0x0F, 0x03, 0x01, 0x00, 0x1C, 0x01, 0x00, 0x1C, 0x01,
+  0x00, 0x06, 0x01, 0x02, 0x04, 0x01, 0x03, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x05, 0x03, 0x01, 0x06, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x09, 0x01,
+  0x04, 0x0E, 0x01, 0x03, 0x10, 0x01, 0x02, 0x12, 0x02, 0x01, 0x06, 0x0E,
+  0x07, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x01, 0x04, 0x11, 0x04, 0x01,
+  0x11, 0x04, 0x01, 0x11, 0x04, 0x01, 0x11, 0x04, 0x01, 0x10, 0x05, 0x01,
+  0x0E, 0x07, 0x01, 0x08, 0x0D, 0x01, 0x04, 0x11, 0x02, 0x02, 0x0D, 0x11,
+  0x04, 0x02, 0x01, 0x08, 0x11, 0x04, 0x02, 0x00, 0x06, 0x11, 0x04, 0x02,
+  0x00, 0x05, 0x11, 0x04, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x00, 0x04,
+  0x10, 0x05, 0x02, 0x00, 0x04, 0x10, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x07,
+  0x02, 0x01, 0x06, 0x0C, 0x09, 0x02, 0x01, 0x0F, 0x11, 0x07, 0x02, 0x02,
+  0x0D, 0x12, 0x06, 0x02, 0x03, 0x0B, 0x12, 0x06, 0x02, 0x05, 0x06, 0x13,
+  0x05, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x02, 0x00, 0x04, 0x09, 0x06, 0x02, 0x00, 0x04, 0x07, 0x0A, 0x02,
+  0x00, 0x04, 0x05, 0x0D, 0x02, 0x00, 0x04, 0x05, 0x0E, 0x02, 0x00, 0x08,
+  0x0D, 0x07, 0x02, 0x00, 0x07, 0x0F, 0x05, 0x02, 0x00, 0x06, 0x10, 0x05,
+  0x02, 0x00, 0x05, 0x11, 0x04, 0x02, 0x00, 0x05, 0x11, 0x04, 0x02, 0x00,
+  0x05, 0x11, 0x05, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12,
+  0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02,
+  0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04,
+  0x12, 0x04, 0x02, 0x00, 0x04, 0x11, 0x05, 0x02, 0x00, 0x05, 0x11, 0x04,
+  0x02, 0x00, 0x05, 0x11, 0x04, 0x02, 0x00, 0x06, 0x10, 0x05, 0x02, 0x00,
+  0x07, 0x0F, 0x05, 0x02, 0x00, 0x08, 0x0D, 0x07, 0x02, 0x00, 0x03, 0x04,
+  0x0F, 0x02, 0x00, 0x03, 0x05, 0x0D, 0x02, 0x00, 0x03, 0x06, 0x0B, 0x01,
+  0x08, 0x07, 0x01, 0x08, 0x07, 0x01, 0x05, 0x0C, 0x01, 0x04, 0x0E, 0x01,
+  0x03, 0x10, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x02, 0x02, 0x05, 0x0F, 0x05,
+  0x02, 0x01, 0x05, 0x10, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04,
+  0x11, 0x04, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x02, 0x05, 0x0F, 0x05,
+  0x02, 0x02, 0x06, 0x0E, 0x06, 0x01, 0x03, 0x10, 0x01, 0x04, 0x0E, 0x01,
+  0x05, 0x0C, 0x01, 0x07, 0x07, 0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x01,
+  0x13, 0x04, 0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x01,
+  0x13, 0x04, 0x01, 0x13, 0x04, 0x02, 0x07, 0x07, 0x13, 0x04, 0x02, 0x05,
+  0x0B, 0x13, 0x04, 0x02, 0x04, 0x0E, 0x13, 0x04, 0x01, 0x03, 0x14, 0x02,
+  0x02, 0x07, 0x0E, 0x09, 0x02, 0x02, 0x05, 0x10, 0x07, 0x02, 0x01, 0x05,
+  0x11, 0x06, 0x02, 0x01, 0x05, 0x12, 0x05, 0x02, 0x01, 0x04, 0x12, 0x05,
+  0x02, 0x00, 0x05, 0x12, 0x05, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00,
+  0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13,
+  0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02,
+  0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x05, 0x12, 0x05, 0x02, 0x01, 0x04,
+  0x12, 0x05, 0x02, 0x01, 0x04, 0x12, 0x05, 0x02, 0x01, 0x05, 0x11, 0x06,
+  0x02, 0x02, 0x05, 0x10, 0x07, 0x02, 0x02, 0x07, 0x0E, 0x09, 0x02, 0x03,
+  0x10, 0x14, 0x03, 0x02, 0x04, 0x0E, 0x14, 0x03, 0x02, 0x05, 0x0C, 0x14,
+  0x03, 0x01, 0x07, 0x08, 0x01, 0x08, 0x07, 0x01, 0x06, 0x0B, 0x01, 0x04,
+  0x0E, 0x01, 0x03, 0x10, 0x02, 0x03, 0x06, 0x0E, 0x06, 0x02, 0x02, 0x05,
+  0x0F, 0x05, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x01, 0x04, 0x11, 0x04,
+  0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00,
+  0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x01, 0x00, 0x16, 0x01,
+  0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x01, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01,
+  0x05, 0x11, 0x04, 0x02, 0x02, 0x05, 0x10, 0x05, 0x02, 0x02, 0x06, 0x0E,
+  0x06, 0x01, 0x03, 0x10, 0x01, 0x04, 0x0F, 0x01, 0x05, 0x0C, 0x01, 0x08,
+  0x07, 0x01, 0x06, 0x04, 0x01, 0x04, 0x06, 0x01, 0x04, 0x06, 0x01, 0x03,
+  0x07, 0x01, 0x03, 0x05, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00,
+  0x0A, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x08, 0x06, 0x02, 0x05,
+  0x0A, 0x12, 0x04, 0x02, 0x04, 0x0D, 0x12, 0x04, 0x01, 0x03, 0x13, 0x02,
+  0x02, 0x07, 0x0E, 0x08, 0x02, 0x02, 0x05, 0x0F, 0x07, 0x02, 0x01, 0x05,
+  0x10, 0x06, 0x02, 0x01, 0x04, 0x11, 0x05, 0x02, 0x01, 0x04, 0x11, 0x05,
+  0x02, 0x00, 0x05, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00,
+  0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12,
+  0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02,
+  0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x01, 0x04,
+  0x11, 0x05, 0x02, 0x01, 0x04, 0x11, 0x05, 0x02, 0x01, 0x05, 0x10, 0x06,
+  0x02, 0x02, 0x05, 0x0F, 0x07, 0x02, 0x02, 0x07, 0x0E, 0x08, 0x02, 0x03,
+  0x0E, 0x12, 0x04, 0x02, 0x04, 0x0C, 0x12, 0x04, 0x02, 0x05, 0x0A, 0x12,
+  0x04, 0x02, 0x07, 0x06, 0x12, 0x04, 0x01, 0x12, 0x04, 0x01, 0x11, 0x04,
+  0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x02,
+  0x05, 0x0E, 0x06, 0x01, 0x02, 0x12, 0x01, 0x03, 0x10, 0x01, 0x04, 0x0E,
+  0x01, 0x07, 0x08, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x02, 0x00, 0x04, 0x08, 0x07, 0x02, 0x00, 0x04, 0x07,
+  0x09, 0x02, 0x00, 0x04, 0x06, 0x0C, 0x02, 0x00, 0x04, 0x05, 0x0D, 0x02,
+  0x00, 0x08, 0x0C, 0x07, 0x02, 0x00, 0x06, 0x0E, 0x05, 0x02, 0x00, 0x06,
+  0x0F, 0x04, 0x02, 0x00, 0x05, 0x0F, 0x04, 0x02, 0x00, 0x05, 0x0F, 0x04,
+  0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00,
+  0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F,
+  0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02,
+  0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04,
+  0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04,
+  0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00,
+  0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x03, 0x05, 0x01, 0x00, 0x08, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x02, 0x00, 0x04, 0x0E, 0x05, 0x02,
+  0x00, 0x04, 0x0D, 0x05, 0x02, 0x00, 0x04, 0x0C, 0x05, 0x02, 0x00, 0x04,
+  0x0B, 0x05, 0x02, 0x00, 0x04, 0x0A, 0x05, 0x02, 0x00, 0x04, 0x09, 0x05,
+  0x02, 0x00, 0x04, 0x08, 0x05, 0x02, 0x00, 0x04, 0x07, 0x05, 0x02, 0x00,
+  0x04, 0x06, 0x05, 0x02, 0x00, 0x04, 0x05, 0x06, 0x01, 0x00, 0x0C, 0x01,
+  0x00, 0x0D, 0x02, 0x00, 0x07, 0x08, 0x05, 0x02, 0x00, 0x06, 0x09, 0x05,
+  0x02, 0x00, 0x05, 0x0A, 0x05, 0x02, 0x00, 0x04, 0x0A, 0x05, 0x02, 0x00,
+  0x04, 0x0B, 0x05, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C,
+  0x05, 0x02, 0x00, 0x04, 0x0D, 0x05, 0x02, 0x00, 0x04, 0x0D, 0x05, 0x02,
+  0x00, 0x04, 0x0E, 0x05, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04,
+  0x0F, 0x05, 0x02, 0x00, 0x04, 0x10, 0x05, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x02, 0x08, 0x06, 0x16, 0x06, 0x03, 0x00, 0x03, 0x06, 0x09, 0x14,
+  0x0A, 0x03, 0x00, 0x03, 0x05, 0x0B, 0x13, 0x0C, 0x03, 0x00, 0x03, 0x04,
+  0x0D, 0x12, 0x0D, 0x03, 0x00, 0x07, 0x0C, 0x09, 0x1A, 0x06, 0x03, 0x00,
+  0x06, 0x0D, 0x07, 0x1B, 0x05, 0x03, 0x00, 0x05, 0x0E, 0x05, 0x1C, 0x04,
+  0x03, 0x00, 0x05, 0x0E, 0x05, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0E, 0x04,
+  0x1C, 0x04, 0x03, 0x00, 0x04, 0x0E, 0x04, 0x1C, 0x04, 0x03, 0x00, 0x04,
+  0x0E, 0x04, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0E, 0x04, 0x1C, 0x04, 0x03,
+  0x00, 0x04, 0x0E, 0x04, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0E, 0x04, 0x1C,
+  0x04, 0x03, 0x00, 0x04, 0x0E, 0x04, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0E,
+  0x04, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0E, 0x04, 0x1C, 0x04, 0x03, 0x00,
+  0x04, 0x0E, 0x04, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0E, 0x04, 0x1C, 0x04,
+  0x03, 0x00, 0x04, 0x0E, 0x04, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0E, 0x04,
+  0x1C, 0x04, 0x03, 0x00, 0x04, 0x0E, 0x04, 0x1C, 0x04, 0x03, 0x00, 0x04,
+  0x0E, 0x04, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0E, 0x04, 0x1C, 0x04, 0x03,
+  0x00, 0x04, 0x0E, 0x04, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0E, 0x04, 0x1C,
+  0x04, 0x01, 0x09, 0x06, 0x02, 0x00, 0x03, 0x07, 0x0A, 0x02, 0x00, 0x03,
+  0x05, 0x0D, 0x02, 0x00, 0x03, 0x04, 0x0F, 0x03, 0x00, 0x03, 0x04, 0x04,
+  0x0D, 0x07, 0x02, 0x00, 0x07, 0x0F, 0x05, 0x02, 0x00, 0x06, 0x0F, 0x05,
+  0x02, 0x00, 0x05, 0x10, 0x04, 0x02, 0x00, 0x05, 0x10, 0x04, 0x02, 0x00,
+  0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10,
+  0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02,
+  0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04,
+  0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04,
+  0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00,
+  0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10,
+  0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x01,
+  0x08, 0x07, 0x01, 0x06, 0x0B, 0x01, 0x04, 0x0F, 0x01, 0x03, 0x11, 0x02,
+  0x02, 0x07, 0x0E, 0x07, 0x02, 0x02, 0x05, 0x10, 0x05, 0x02, 0x01, 0x05,
+  0x11, 0x05, 0x02, 0x01, 0x04, 0x12, 0x04, 0x02, 0x01, 0x04, 0x12, 0x04,
+  0x02, 0x00, 0x05, 0x12, 0x05, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00,
+  0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13,
+  0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02,
+  0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x05, 0x12, 0x05, 0x02, 0x01, 0x04,
+  0x12, 0x04, 0x02, 0x01, 0x04, 0x12, 0x04, 0x02, 0x01, 0x05, 0x11, 0x05,
+  0x02, 0x02, 0x05, 0x10, 0x05, 0x02, 0x02, 0x07, 0x0E, 0x07, 0x01, 0x03,
+  0x11, 0x01, 0x04, 0x0F, 0x01, 0x05, 0x0D, 0x01, 0x08, 0x07, 0x01, 0x08,
+  0x07, 0x02, 0x00, 0x03, 0x06, 0x0B, 0x02, 0x00, 0x03, 0x05, 0x0D, 0x02,
+  0x00, 0x03, 0x04, 0x0F, 0x02, 0x00, 0x09, 0x0D, 0x07, 0x02, 0x00, 0x07,
+  0x0F, 0x05, 0x02, 0x00, 0x06, 0x10, 0x05, 0x02, 0x00, 0x05, 0x11, 0x04,
+  0x02, 0x00, 0x05, 0x11, 0x04, 0x02, 0x00, 0x05, 0x11, 0x05, 0x02, 0x00,
+  0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12,
+  0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02,
+  0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04,
+  0x11, 0x05, 0x02, 0x00, 0x05, 0x11, 0x04, 0x02, 0x00, 0x05, 0x11, 0x04,
+  0x02, 0x00, 0x06, 0x10, 0x05, 0x02, 0x00, 0x07, 0x0F, 0x05, 0x02, 0x00,
+  0x08, 0x0D, 0x07, 0x01, 0x00, 0x13, 0x02, 0x00, 0x04, 0x05, 0x0D, 0x02,
+  0x00, 0x04, 0x07, 0x0A, 0x02, 0x00, 0x04, 0x09, 0x06, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x08, 0x07,
+  0x02, 0x06, 0x0B, 0x14, 0x03, 0x02, 0x04, 0x0E, 0x14, 0x03, 0x02, 0x03,
+  0x10, 0x14, 0x03, 0x02, 0x02, 0x07, 0x0E, 0x09, 0x02, 0x02, 0x05, 0x10,
+  0x07, 0x02, 0x01, 0x05, 0x11, 0x06, 0x02, 0x01, 0x05, 0x12, 0x05, 0x02,
+  0x01, 0x04, 0x12, 0x05, 0x02, 0x00, 0x05, 0x12, 0x05, 0x02, 0x00, 0x04,
+  0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04,
+  0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00,
+  0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x05, 0x12,
+  0x05, 0x02, 0x01, 0x04, 0x12, 0x05, 0x02, 0x01, 0x04, 0x12, 0x05, 0x02,
+  0x01, 0x05, 0x11, 0x06, 0x02, 0x02, 0x05, 0x10, 0x07, 0x02, 0x02, 0x07,
+  0x0E, 0x09, 0x02, 0x03, 0x0F, 0x13, 0x04, 0x02, 0x04, 0x0E, 0x13, 0x04,
+  0x02, 0x05, 0x0B, 0x13, 0x04, 0x02, 0x07, 0x07, 0x13, 0x04, 0x01, 0x13,
+  0x04, 0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x01, 0x13,
+  0x04, 0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x01, 0x08,
+  0x04, 0x02, 0x00, 0x03, 0x07, 0x05, 0x02, 0x00, 0x03, 0x05, 0x07, 0x02,
+  0x00, 0x03, 0x04, 0x08, 0x01, 0x00, 0x09, 0x01, 0x00, 0x06, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x07,
+  0x07, 0x01, 0x04, 0x0C, 0x01, 0x03, 0x0E, 0x01, 0x02, 0x10, 0x02, 0x02,
+  0x05, 0x0D, 0x06, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x02, 0x01, 0x04, 0x0F,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x06, 0x01, 0x02, 0x08, 0x01, 0x03, 0x0B, 0x01, 0x04, 0x0D, 0x01, 0x06,
+  0x0C, 0x01, 0x0A, 0x09, 0x01, 0x0E, 0x06, 0x01, 0x0F, 0x05, 0x01, 0x10,
+  0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02,
+  0x00, 0x05, 0x0F, 0x05, 0x02, 0x01, 0x06, 0x0D, 0x06, 0x01, 0x01, 0x12,
+  0x01, 0x02, 0x10, 0x01, 0x03, 0x0D, 0x01, 0x06, 0x08, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x07,
+  0x01, 0x03, 0x07, 0x01, 0x04, 0x06, 0x01, 0x05, 0x05, 0x02, 0x00, 0x04,
+  0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04,
+  0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00,
+  0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10,
+  0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02,
+  0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04,
+  0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04,
+  0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00,
+  0x04, 0x0F, 0x05, 0x02, 0x00, 0x04, 0x0F, 0x05, 0x02, 0x00, 0x04, 0x0E,
+  0x06, 0x02, 0x00, 0x05, 0x0D, 0x07, 0x02, 0x00, 0x07, 0x0C, 0x08, 0x02,
+  0x01, 0x0F, 0x11, 0x03, 0x02, 0x01, 0x0E, 0x11, 0x03, 0x02, 0x03, 0x0B,
+  0x11, 0x03, 0x01, 0x05, 0x06, 0x02, 0x01, 0x04, 0x12, 0x05, 0x02, 0x01,
+  0x04, 0x12, 0x04, 0x02, 0x01, 0x05, 0x12, 0x04, 0x02, 0x02, 0x04, 0x11,
+  0x05, 0x02, 0x02, 0x04, 0x11, 0x04, 0x02, 0x02, 0x05, 0x11, 0x04, 0x02,
+  0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x05,
+  0x0F, 0x05, 0x02, 0x04, 0x04, 0x0F, 0x04, 0x02, 0x04, 0x04, 0x0F, 0x04,
+  0x02, 0x04, 0x05, 0x0E, 0x05, 0x02, 0x05, 0x04, 0x0E, 0x04, 0x02, 0x05,
+  0x04, 0x0E, 0x04, 0x02, 0x05, 0x05, 0x0D, 0x04, 0x02, 0x06, 0x04, 0x0D,
+  0x04, 0x02, 0x06, 0x04, 0x0D, 0x04, 0x02, 0x07, 0x04, 0x0C, 0x04, 0x02,
+  0x07, 0x04, 0x0C, 0x04, 0x02, 0x07, 0x04, 0x0C, 0x03, 0x01, 0x08, 0x07,
+  0x01, 0x08, 0x07, 0x01, 0x08, 0x06, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05,
+  0x03, 0x00, 0x05, 0x0E, 0x05, 0x1D, 0x04, 0x03, 0x01, 0x04, 0x0E, 0x06,
+  0x1D, 0x04, 0x03, 0x01, 0x04, 0x0E, 0x06, 0x1D, 0x04, 0x03, 0x01, 0x05,
+  0x0E, 0x06, 0x1C, 0x05, 0x03, 0x02, 0x04, 0x0D, 0x07, 0x1C, 0x04, 0x03,
+  0x02, 0x04, 0x0D, 0x08, 0x1C, 0x04, 0x03, 0x02, 0x04, 0x0D, 0x08, 0x1C,
+  0x04, 0x04, 0x03, 0x04, 0x0D, 0x03, 0x11, 0x04, 0x1B, 0x04, 0x04, 0x03,
+  0x04, 0x0C, 0x04, 0x12, 0x03, 0x1B, 0x04, 0x04, 0x03, 0x04, 0x0C, 0x04,
+  0x12, 0x04, 0x1B, 0x04, 0x04, 0x03, 0x04, 0x0C, 0x04, 0x12, 0x04, 0x1B,
+  0x04, 0x04, 0x04, 0x04, 0x0C, 0x03, 0x12, 0x04, 0x1A, 0x04, 0x04, 0x04,
+  0x04, 0x0B, 0x04, 0x13, 0x03, 0x1A, 0x04, 0x04, 0x04, 0x04, 0x0B, 0x04,
+  0x13, 0x04, 0x1A, 0x04, 0x04, 0x05, 0x03, 0x0B, 0x04, 0x13, 0x04, 0x1A,
+  0x03, 0x04, 0x05, 0x04, 0x0B, 0x03, 0x13, 0x04, 0x19, 0x04, 0x04, 0x05,
+  0x04, 0x0A, 0x04, 0x14, 0x03, 0x19, 0x04, 0x04, 0x05, 0x04, 0x0A, 0x04,
+  0x14, 0x04, 0x19, 0x04, 0x04, 0x06, 0x03, 0x0A, 0x04, 0x14, 0x04, 0x19,
+  0x03, 0x02, 0x06, 0x07, 0x14, 0x08, 0x02, 0x06, 0x07, 0x15, 0x07, 0x02,
+  0x07, 0x06, 0x15, 0x06, 0x02, 0x07, 0x06, 0x15, 0x06, 0x02, 0x07, 0x05,
+  0x15, 0x06, 0x02, 0x07, 0x05, 0x16, 0x04, 0x02, 0x01, 0x05, 0x11, 0x04,
+  0x02, 0x02, 0x04, 0x10, 0x05, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03,
+  0x05, 0x0F, 0x04, 0x02, 0x04, 0x04, 0x0E, 0x05, 0x02, 0x05, 0x04, 0x0E,
+  0x04, 0x02, 0x05, 0x05, 0x0D, 0x04, 0x02, 0x06, 0x04, 0x0C, 0x05, 0x02,
+  0x07, 0x04, 0x0C, 0x04, 0x01, 0x07, 0x08, 0x01, 0x08, 0x06, 0x01, 0x09,
+  0x05, 0x01, 0x09, 0x05, 0x01, 0x08, 0x06, 0x01, 0x08, 0x07, 0x01, 0x07,
+  0x09, 0x02, 0x06, 0x04, 0x0C, 0x04, 0x02, 0x06, 0x04, 0x0D, 0x04, 0x02,
+  0x05, 0x04, 0x0D, 0x05, 0x02, 0x04, 0x05, 0x0E, 0x04, 0x02, 0x04, 0x04,
+  0x0E, 0x05, 0x02, 0x03, 0x04, 0x0F, 0x05, 0x02, 0x02, 0x05, 0x10, 0x04,
+  0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x01, 0x04, 0x11, 0x05, 0x02, 0x01,
+  0x04, 0x12, 0x04, 0x02, 0x01, 0x04, 0x11, 0x05, 0x02, 0x01, 0x04, 0x11,
+  0x04, 0x02, 0x02, 0x04, 0x11, 0x04, 0x02, 0x02, 0x04, 0x10, 0x04, 0x02,
+  0x02, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04,
+  0x0F, 0x04, 0x02, 0x03, 0x04, 0x0F, 0x04, 0x02, 0x04, 0x04, 0x0F, 0x04,
+  0x02, 0x04, 0x04, 0x0E, 0x04, 0x02, 0x04, 0x04, 0x0E, 0x04, 0x02, 0x05,
+  0x04, 0x0D, 0x05, 0x02, 0x05, 0x04, 0x0D, 0x04, 0x02, 0x05, 0x04, 0x0D,
+  0x04, 0x02, 0x06, 0x04, 0x0C, 0x04, 0x02, 0x06, 0x04, 0x0C, 0x04, 0x02,
+  0x06, 0x04, 0x0C, 0x04, 0x01, 0x07, 0x08, 0x01, 0x07, 0x08, 0x01, 0x07,
+  0x08, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x05, 0x01, 0x09,
+  0x04, 0x01, 0x09, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07,
+  0x05, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x02, 0x08, 0x01, 0x02,
+  0x08, 0x01, 0x02, 0x07, 0x01, 0x03, 0x04, 0x01, 0x01, 0x13, 0x01, 0x01,
+  0x13, 0x01, 0x01, 0x13, 0x01, 0x01, 0x13, 0x01, 0x0F, 0x04, 0x01, 0x0E,
+  0x05, 0x01, 0x0D, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0A,
+  0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x07,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x00,
+  0x14, 0x01, 0x00, 0x14, 0x01, 0x00, 0x14, 0x01, 0x00, 0x14, 0x01, 0x07,
+  0x04, 0x01, 0x05, 0x06, 0x01, 0x05, 0x06, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x05, 0x01, 0x02,
+  0x04, 0x01, 0x03, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x04, 0x01, 0x05, 0x06, 0x01, 0x05, 0x06, 0x01, 0x07, 0x04, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x03, 0x04, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x04, 0x01, 0x06,
+  0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03,
+  0x04, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x04, 0x01, 0x02,
+  0x05, 0x02, 0x01, 0x08, 0x11, 0x02, 0x02, 0x01, 0x09, 0x11, 0x02, 0x03,
+  0x00, 0x03, 0x07, 0x05, 0x10, 0x03, 0x02, 0x00, 0x02, 0x08, 0x0A, 0x02,
+  0x00, 0x02, 0x0A, 0x08, 0x01, 0x0C, 0x05 };
+
+const GFXglyph FreeSans24pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,  12,    0,    1 },   // 0x20 ' '
+  {     0,   4,  34,  16,    6,  -33 },   // 0x21 '!'
+  {    96,  11,  12,  16,    2,  -32 },   // 0x22 '"'
+  {   156,  24,  33,  26,    1,  -31 },   // 0x23 '#'
+  {   309,  23,  41,  26,    1,  -34 },   // 0x24 '$'
+  {   506,  39,  34,  42,    1,  -32 },   // 0x25 '%'
+  {   704,  28,  34,  31,    2,  -32 },   // 0x26 '&'
+  {   864,   4,  12,   9,    2,  -32 },   // 0x27 '''
+  {   900,  10,  44,  16,    3,  -33 },   // 0x28 '('
+  {  1032,  10,  44,  16,    2,  -33 },   // 0x29 ')'
+  {  1164,  14,  14,  18,    2,  -33 },   // 0x2A '*'
+  {  1218,  23,  22,  27,    2,  -21 },   // 0x2B '+'
+  {  1284,   4,  12,  13,    4,   -4 },   // 0x2C ','
+  {  1320,  11,   4,  16,    2,  -14 },   // 0x2D '-'
+  {  1332,   4,   5,  12,    4,   -4 },   // 0x2E '.'
+  {  1347,  13,  35,  13,    0,  -33 },   // 0x2F '/'
+  {  1452,  22,  34,  26,    2,  -32 },   // 0x30 '0'
+  {  1606,  11,  33,  26,    5,  -32 },   // 0x31 '1'
+  {  1705,  22,  33,  26,    2,  -32 },   // 0x32 '2'
+  {  1818,  23,  34,  26,    1,  -32 },   // 0x33 '3'
+  {  1944,  23,  33,  26,    1,  -32 },   // 0x34 '4'
+  {  2069,  22,  34,  26,    2,  -32 },   // 0x35 '5'
+  {  2189,  22,  34,  26,    2,  -32 },   // 0x36 '6'
+  {  2335,  21,  33,  26,    2,  -32 },   // 0x37 '7'
+  {  2434,  22,  34,  26,    2,  -32 },   // 0x38 '8'
+  {  2580,  21,  34,  26,    2,  -32 },   // 0x39 '9'
+  {  2724,   4,  25,  12,    4,  -24 },   // 0x3A ':'
+  {  2769,   4,  32,  12,    4,  -24 },   // 0x3B ';'
+  {  2835,  23,  23,  27,    2,  -22 },   // 0x3C '<'
+  {  2902,  23,  12,  27,    2,  -16 },   // 0x3D '='
+  {  2930,  23,  23,  27,    2,  -22 },   // 0x3E '>'
+  {  2999,  20,  35,  26,    4,  -34 },   // 0x3F '?'
+  {  3110,  43,  42,  48,    2,  -34 },   // 0x40 '@'
+  {  3374,  30,  34,  31,    1,  -33 },   // 0x41 'A'
+  {  3526,  25,  34,  31,    4,  -33 },   // 0x42 'B'
+  {  3672,  29,  36,  33,    2,  -34 },   // 0x43 'C'
+  {  3812,  27,  34,  33,    4,  -33 },   // 0x44 'D'
+  {  3966,  24,  34,  30,    4,  -33 },   // 0x45 'E'
+  {  4068,  22,  34,  28,    4,  -33 },   // 0x46 'F'
+  {  4170,  31,  36,  36,    2,  -34 },   // 0x47 'G'
+  {  4328,  26,  34,  34,    4,  -33 },   // 0x48 'H'
+  {  4490,   4,  34,  13,    5,  -33 },   // 0x49 'I'
+  {  4592,  19,  35,  25,    2,  -33 },   // 0x4A 'J'
+  {  4713,  27,  34,  32,    4,  -33 },   // 0x4B 'K'
+  {  4883,  21,  34,  26,    4,  -33 },   // 0x4C 'L'
+  {  4985,  32,  34,  40,    4,  -33 },   // 0x4D 'M'
+  {  5251,  26,  34,  34,    4,  -33 },   // 0x4E 'N'
+  {  5461,  33,  36,  37,    2,  -34 },   // 0x4F 'O'
+  {  5625,  24,  34,  31,    4,  -33 },   // 0x50 'P'
+  {  5751,  33,  38,  37,    2,  -34 },   // 0x51 'Q'
+  {  5929,  26,  34,  33,    4,  -33 },   // 0x52 'R'
+  {  6083,  27,  36,  31,    2,  -34 },   // 0x53 'S'
+  {  6217,  26,  34,  30,    2,  -33 },   // 0x54 'T'
+  {  6319,  26,  35,  34,    4,  -33 },   // 0x55 'U'
+  {  6486,  29,  34,  30,    1,  -33 },   // 0x56 'V'
+  {  6646,  42,  34,  44,    1,  -33 },   // 0x57 'W'
+  {  6904,  29,  34,  31,    1,  -33 },   // 0x58 'X'
+  {  7060,  30,  34,  32,    1,  -33 },   // 0x59 'Y'
+  {  7194,  27,  34,  29,    1,  -33 },   // 0x5A 'Z'
+  {  7296,   8,  44,  13,    3,  -33 },   // 0x5B '['
+  {  7428,  13,  35,  13,    0,  -33 },   // 0x5C '\'
+  {  7533,   8,  44,  13,    1,  -33 },   // 0x5D ']'
+  {  7665,  18,  18,  22,    2,  -32 },   // 0x5E '^'
+  {  7745,  28,   2,  26,   -1,    7 },   // 0x5F '_'
+  {  7751,  10,   7,  12,    1,  -34 },   // 0x60 '`'
+  {  7772,  24,  27,  26,    1,  -25 },   // 0x61 'a'
+  {  7885,  22,  35,  26,    3,  -33 },   // 0x62 'b'
+  {  8042,  21,  27,  24,    1,  -25 },   // 0x63 'c'
+  {  8141,  23,  35,  26,    1,  -33 },   // 0x64 'd'
+  {  8296,  22,  27,  25,    1,  -25 },   // 0x65 'e'
+  {  8401,  10,  34,  13,    1,  -33 },   // 0x66 'f'
+  {  8503,  22,  36,  26,    1,  -25 },   // 0x67 'g'
+  {  8667,  19,  34,  25,    3,  -33 },   // 0x68 'h'
+  {  8821,   4,  34,  10,    3,  -33 },   // 0x69 'i'
+  {  8915,   8,  44,  11,    0,  -33 },   // 0x6A 'j'
+  {  9039,  21,  34,  24,    3,  -33 },   // 0x6B 'k'
+  {  9187,   4,  34,  10,    3,  -33 },   // 0x6C 'l'
+  {  9289,  32,  26,  38,    3,  -25 },   // 0x6D 'm'
+  {  9469,  20,  26,  25,    3,  -25 },   // 0x6E 'n'
+  {  9599,  23,  27,  25,    1,  -25 },   // 0x6F 'o'
+  {  9718,  22,  35,  26,    3,  -25 },   // 0x70 'p'
+  {  9873,  23,  35,  26,    1,  -25 },   // 0x71 'q'
+  { 10030,  12,  26,  16,    3,  -25 },   // 0x72 'r'
+  { 10114,  20,  27,  23,    1,  -25 },   // 0x73 's'
+  { 10209,  10,  32,  13,    1,  -30 },   // 0x74 't'
+  { 10305,  20,  26,  25,    3,  -24 },   // 0x75 'u'
+  { 10433,  23,  25,  23,    0,  -24 },   // 0x76 'v'
+  { 10548,  34,  25,  34,    0,  -24 },   // 0x77 'w'
+  { 10735,  22,  25,  22,    0,  -24 },   // 0x78 'x'
+  { 10846,  22,  35,  22,    0,  -24 },   // 0x79 'y'
+  { 10987,  20,  25,  23,    1,  -24 },   // 0x7A 'z'
+  { 11062,  11,  44,  16,    2,  -33 },   // 0x7B '{'
+  { 11194,   3,  44,  12,    4,  -33 },   // 0x7C '|'
+  { 11326,  11,  44,  16,    2,  -33 },   // 0x7D '}'
+  { 11458,  19,   7,  24,    2,  -19 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSans24pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSans24pt7bSpanData,
+    (GFXglyph *)FreeSans24pt7bSpanGlyphs,
+    0x20, 0x7E, 56 } };
+
+// Approx. 12275 bytes
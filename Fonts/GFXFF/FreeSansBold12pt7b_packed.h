@@ -0,0 +1,260 @@
+// FreeSansBold12pt7b as run lengths, generated by Tools/GFX_pack from FreeSansBold12pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeSansBold12pt7bPackedRuns[] PROGMEM = {
+  0x0F, 0xF2, 0x13, 0x12, 0x22, 0x22, 0x22, 0x5C, 0x04, 0x28, 0x28, 0x28,
+  0x24, 0x12, 0x42, 0x22, 0x42, 0x10, 0x43, 0x23, 0x53, 0x23, 0x52, 0x32,
+  0x3C, 0x1C, 0x1C, 0x33, 0x23, 0x52, 0x32, 0x62, 0x32, 0x3C, 0x1C, 0x1C,
+  0x32, 0x32, 0x53, 0x23, 0x53, 0x23, 0x53, 0x23, 0x40, 0x61, 0xA6, 0x59,
+  0x4A, 0x24, 0x11, 0x15, 0x13, 0x21, 0x24, 0x13, 0x21, 0x74, 0x11, 0x86,
+  0x88, 0x86, 0x71, 0x19, 0x21, 0x28, 0x21, 0x29, 0x11, 0x15, 0x1B, 0x39,
+  0x65, 0xA1, 0xC1, 0x60, 0x24, 0x72, 0x56, 0x52, 0x67, 0x42, 0x53, 0x23,
+  0x32, 0x62, 0x42, 0x32, 0x63, 0x23, 0x22, 0x87, 0x22, 0x86, 0x22, 0xA4,
+  0x32, 0x24, 0xA2, 0x26, 0x91, 0x28, 0x72, 0x23, 0x23, 0x71, 0x32, 0x42,
+  0x62, 0x33, 0x23, 0x52, 0x48, 0x52, 0x56, 0x52, 0x74, 0x20, 0x54, 0xA7,
+  0x89, 0x74, 0x23, 0x74, 0x23, 0x75, 0x13, 0x96, 0xB3, 0xA7, 0x32, 0x39,
+  0x22, 0x24, 0x37, 0x24, 0x45, 0x34, 0x54, 0x35, 0x35, 0x4D, 0x48, 0x14,
+  0x46, 0x33, 0x10, 0x0F, 0x11, 0x22, 0x21, 0x42, 0x33, 0x23, 0x33, 0x23,
+  0x33, 0x33, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x43, 0x33,
+  0x33, 0x43, 0x33, 0x42, 0x43, 0x02, 0x43, 0x43, 0x33, 0x43, 0x33, 0x33,
+  0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x33, 0x33, 0x23,
+  0x33, 0x32, 0x33, 0x30, 0x31, 0x61, 0x32, 0x11, 0x19, 0x23, 0x43, 0x32,
+  0x12, 0x31, 0x11, 0x20, 0x43, 0x83, 0x83, 0x83, 0x4F, 0xF3, 0x43, 0x83,
+  0x83, 0x83, 0x40, 0x0C, 0x22, 0x22, 0x12, 0x12, 0x20, 0x0F, 0x30, 0x0C,
+  0x42, 0x42, 0x41, 0x42, 0x42, 0x42, 0x41, 0x42, 0x42, 0x42, 0x41, 0x42,
+  0x42, 0x42, 0x41, 0x42, 0x42, 0x40, 0x36, 0x58, 0x3A, 0x24, 0x24, 0x14,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x14, 0x24, 0x2A,
+  0x38, 0x64, 0x40, 0x52, 0x43, 0x3F, 0x33, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x40, 0x36, 0x58, 0x3A, 0x15, 0x29,
+  0x48, 0x44, 0x84, 0x84, 0x74, 0x74, 0x65, 0x64, 0x74, 0x83, 0x8B, 0x1B,
+  0x1B, 0x35, 0x59, 0x2B, 0x14, 0x34, 0x14, 0x34, 0x84, 0x74, 0x74, 0x85,
+  0x94, 0x94, 0x88, 0x48, 0x35, 0x1A, 0x29, 0x56, 0x30, 0x64, 0x65, 0x65,
+  0x56, 0x42, 0x14, 0x41, 0x24, 0x32, 0x24, 0x22, 0x34, 0x22, 0x34, 0x12,
+  0x44, 0x1F, 0xF3, 0x64, 0x74, 0x74, 0x74, 0x10, 0x29, 0x2A, 0x2A, 0x23,
+  0x92, 0xA2, 0x15, 0x49, 0x2B, 0x14, 0x35, 0x84, 0x84, 0x84, 0x87, 0x44,
+  0x1B, 0x29, 0x46, 0x40, 0x45, 0x58, 0x3A, 0x24, 0x29, 0x84, 0x14, 0x3A,
+  0x2B, 0x15, 0x29, 0x48, 0x48, 0x48, 0x44, 0x14, 0x25, 0x1A, 0x38, 0x65,
+  0x30, 0x0F, 0xF3, 0x73, 0x83, 0x73, 0x74, 0x73, 0x74, 0x73, 0x74, 0x74,
+  0x74, 0x73, 0x74, 0x74, 0x74, 0x50, 0x44, 0x68, 0x39, 0x34, 0x24, 0x23,
+  0x43, 0x23, 0x43, 0x33, 0x23, 0x56, 0x58, 0x34, 0x24, 0x14, 0x48, 0x48,
+  0x49, 0x25, 0x1A, 0x38, 0x56, 0x30, 0x35, 0x68, 0x3A, 0x15, 0x24, 0x14,
+  0x43, 0x14, 0x48, 0x48, 0x49, 0x25, 0x1B, 0x2A, 0x34, 0x14, 0x83, 0x14,
+  0x34, 0x2A, 0x29, 0x55, 0x40, 0x0C, 0xF9, 0xC0, 0x0C, 0xF9, 0xC3, 0x13,
+  0x11, 0x21, 0x22, 0xB1, 0x93, 0x66, 0x37, 0x36, 0x55, 0x73, 0x96, 0x87,
+  0x87, 0x84, 0xA2, 0x0F, 0xF6, 0xFF, 0x6F, 0xF6, 0xC3, 0x96, 0x77, 0x87,
+  0x85, 0x84, 0x57, 0x36, 0x37, 0x54, 0x81, 0xB0, 0x35, 0x59, 0x3A, 0x15,
+  0x29, 0x48, 0x44, 0x84, 0x84, 0x74, 0x74, 0x74, 0x74, 0x83, 0x93, 0xF6,
+  0x48, 0x48, 0x44, 0x87, 0xCB, 0x84, 0x64, 0x63, 0xA3, 0x43, 0xC3, 0x32,
+  0x54, 0x12, 0x22, 0x22, 0x46, 0x12, 0x32, 0x12, 0x33, 0x33, 0x44, 0x42,
+  0x52, 0x44, 0x42, 0x52, 0x44, 0x32, 0x62, 0x44, 0x32, 0x52, 0x45, 0x32,
+  0x52, 0x42, 0x12, 0x33, 0x33, 0x33, 0x13, 0x36, 0x16, 0x32, 0x44, 0x24,
+  0x53, 0xF4, 0x3F, 0x44, 0x71, 0xAC, 0xC7, 0x70, 0x65, 0xB5, 0xB5, 0xA7,
+  0x97, 0x93, 0x13, 0x84, 0x14, 0x73, 0x24, 0x73, 0x33, 0x64, 0x34, 0x53,
+  0x44, 0x4C, 0x4D, 0x3D, 0x24, 0x73, 0x24, 0x74, 0x13, 0x88, 0x93, 0x0A,
+  0x4C, 0x2C, 0x24, 0x45, 0x14, 0x54, 0x14, 0x54, 0x14, 0x45, 0x1C, 0x2B,
+  0x3C, 0x24, 0x54, 0x14, 0x68, 0x68, 0x68, 0x5F, 0x31, 0xD1, 0xB3, 0x56,
+  0x8A, 0x5C, 0x35, 0x45, 0x24, 0x6A, 0x78, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+  0xC5, 0x74, 0x14, 0x65, 0x15, 0x45, 0x3D, 0x4B, 0x77, 0x40, 0x0B, 0x4C,
+  0x3D, 0x24, 0x55, 0x14, 0x64, 0x14, 0x69, 0x78, 0x78, 0x78, 0x78, 0x78,
+  0x78, 0x69, 0x64, 0x14, 0x55, 0x1D, 0x2C, 0x3A, 0x50, 0x0C, 0x1C, 0x1C,
+  0x14, 0x94, 0x94, 0x94, 0x9B, 0x2B, 0x2B, 0x24, 0x94, 0x94, 0x94, 0x94,
+  0x9F, 0xF9, 0x0F, 0xFA, 0x84, 0x84, 0x84, 0x8B, 0x1B, 0x1B, 0x14, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x80, 0x66, 0x8A, 0x4D, 0x35, 0x45,
+  0x14, 0x83, 0x14, 0xB4, 0xC4, 0xC4, 0x5B, 0x5B, 0x5B, 0x93, 0x14, 0x83,
+  0x15, 0x64, 0x25, 0x45, 0x2B, 0x12, 0x49, 0x12, 0x65, 0x32, 0x04, 0x68,
+  0x68, 0x68, 0x68, 0x68, 0x68, 0x6F, 0xFF, 0x56, 0x86, 0x86, 0x86, 0x86,
+  0x86, 0x86, 0x86, 0x40, 0x0F, 0xFF, 0xFC, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x78, 0x38, 0x38, 0x38, 0x34, 0x19, 0x29,
+  0x45, 0x30, 0x04, 0x65, 0x14, 0x64, 0x24, 0x54, 0x34, 0x44, 0x44, 0x34,
+  0x54, 0x24, 0x64, 0x14, 0x78, 0x89, 0x79, 0x75, 0x14, 0x64, 0x34, 0x54,
+  0x44, 0x44, 0x44, 0x44, 0x54, 0x34, 0x64, 0x24, 0x65, 0x14, 0x74, 0x10,
+  0x04, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x7F, 0xF3, 0x05, 0x6C, 0x5C, 0x4D, 0x4D, 0x4D, 0x4E,
+  0x2F, 0x02, 0x31, 0xB2, 0x31, 0x81, 0x22, 0x31, 0x81, 0x31, 0x31, 0x81,
+  0x62, 0x81, 0x62, 0x82, 0x52, 0x82, 0x52, 0x82, 0x43, 0x82, 0x43, 0x83,
+  0x33, 0x40, 0x04, 0x79, 0x6A, 0x5A, 0x5B, 0x4B, 0x48, 0x13, 0x38, 0x13,
+  0x38, 0x23, 0x28, 0x23, 0x28, 0x33, 0x18, 0x3C, 0x4B, 0x4B, 0x5A, 0x69,
+  0x69, 0x74, 0x65, 0x9A, 0x6D, 0x45, 0x35, 0x34, 0x74, 0x24, 0x74, 0x14,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x94, 0x14, 0x74, 0x24, 0x74, 0x34, 0x45,
+  0x4D, 0x5B, 0x87, 0x50, 0x0B, 0x3D, 0x1D, 0x14, 0x59, 0x68, 0x68, 0x68,
+  0x5F, 0x31, 0xC2, 0xB3, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x65,
+  0x9A, 0x6D, 0x45, 0x35, 0x34, 0x74, 0x24, 0x74, 0x14, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x61, 0x24, 0x14, 0x47, 0x24, 0x47, 0x34, 0x45, 0x4D, 0x5E,
+  0x56, 0x32, 0xF3, 0x0D, 0x3E, 0x2E, 0x24, 0x65, 0x14, 0x74, 0x14, 0x74,
+  0x14, 0x74, 0x14, 0x64, 0x2D, 0x3C, 0x4D, 0x34, 0x64, 0x24, 0x64, 0x24,
+  0x64, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64, 0x24, 0x75, 0x46, 0x7A, 0x4C,
+  0x25, 0x45, 0x14, 0x64, 0x14, 0xB4, 0xB7, 0x9B, 0x6B, 0x79, 0xA5, 0xB8,
+  0x74, 0x14, 0x55, 0x1D, 0x3B, 0x67, 0x40, 0x0F, 0xF6, 0x44, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x40, 0x04, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0x64, 0x14, 0x44, 0x2C, 0x3A, 0x66, 0x40, 0x13, 0x83,
+  0x14, 0x64, 0x14, 0x64, 0x23, 0x63, 0x33, 0x63, 0x34, 0x44, 0x43, 0x43,
+  0x53, 0x43, 0x54, 0x24, 0x63, 0x23, 0x73, 0x23, 0x73, 0x23, 0x86, 0x96,
+  0x96, 0xA4, 0xB4, 0xB4, 0x50, 0x13, 0x63, 0x63, 0x23, 0x54, 0x54, 0x24,
+  0x45, 0x44, 0x24, 0x45, 0x44, 0x33, 0x45, 0x43, 0x43, 0x45, 0x43, 0x43,
+  0x33, 0x13, 0x24, 0x44, 0x23, 0x13, 0x23, 0x63, 0x23, 0x13, 0x23, 0x63,
+  0x23, 0x22, 0x23, 0x63, 0x23, 0x22, 0x23, 0x72, 0x13, 0x36, 0x86, 0x36,
+  0x86, 0x36, 0x86, 0x45, 0x95, 0x44, 0xA4, 0x54, 0xA4, 0x54, 0x50, 0x04,
+  0x64, 0x24, 0x45, 0x24, 0x44, 0x44, 0x24, 0x54, 0x24, 0x68, 0x86, 0x96,
+  0xA4, 0xB4, 0xA6, 0x88, 0x78, 0x64, 0x24, 0x54, 0x34, 0x34, 0x44, 0x25,
+  0x54, 0x14, 0x64, 0x10, 0x04, 0x74, 0x24, 0x64, 0x24, 0x54, 0x44, 0x44,
+  0x44, 0x34, 0x64, 0x24, 0x73, 0x23, 0x88, 0x96, 0xA6, 0xB4, 0xC4, 0xC4,
+  0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x60, 0x0F, 0xF9, 0x85, 0x84, 0x84, 0x84,
+  0x85, 0x84, 0x84, 0x84, 0x85, 0x84, 0x84, 0x84, 0x9F, 0xF9, 0x0F, 0x72,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0xF3, 0x02, 0x52, 0x61, 0x62, 0x52, 0x61, 0x62,
+  0x52, 0x61, 0x62, 0x52, 0x61, 0x62, 0x52, 0x61, 0x62, 0x52, 0x0F, 0x32,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0xF7, 0x44, 0x84, 0x84, 0x76, 0x62, 0x13, 0x53,
+  0x23, 0x43, 0x23, 0x42, 0x42, 0x33, 0x43, 0x23, 0x43, 0x13, 0x63, 0x0F,
+  0xF0, 0x03, 0x22, 0x32, 0x36, 0x5A, 0x3B, 0x14, 0x44, 0x94, 0x67, 0x2B,
+  0x15, 0x34, 0x14, 0x44, 0x14, 0x35, 0x1C, 0x2B, 0x34, 0x25, 0x04, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x14, 0x4B, 0x2C, 0x15, 0x34, 0x14, 0x58, 0x58,
+  0x58, 0x58, 0x59, 0x34, 0x1C, 0x1B, 0x24, 0x15, 0x30, 0x45, 0x59, 0x2B,
+  0x14, 0x38, 0x57, 0x84, 0x84, 0x84, 0x53, 0x14, 0x34, 0x1B, 0x29, 0x55,
+  0x30, 0x94, 0x94, 0x94, 0x94, 0x94, 0x35, 0x14, 0x2B, 0x1C, 0x14, 0x39,
+  0x58, 0x58, 0x58, 0x58, 0x54, 0x14, 0x35, 0x1C, 0x2B, 0x35, 0x14, 0x36,
+  0x68, 0x4A, 0x25, 0x33, 0x24, 0x53, 0x1C, 0x1C, 0x14, 0x94, 0xA4, 0x43,
+  0x2B, 0x39, 0x65, 0x40, 0x25, 0x16, 0x16, 0x14, 0x34, 0x26, 0x16, 0x24,
+  0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x20, 0x34,
+  0x24, 0x26, 0x14, 0x1C, 0x14, 0x39, 0x58, 0x58, 0x58, 0x58, 0x59, 0x35,
+  0x1C, 0x2B, 0x35, 0x14, 0x94, 0x99, 0x34, 0x2B, 0x47, 0x30, 0x04, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x15, 0x2B, 0x1F, 0x22, 0x94, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x40, 0x0C, 0x8F, 0xFF, 0x70, 0x24, 0x24,
+  0x24, 0xE4, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+  0x24, 0x24, 0x24, 0x2F, 0x61, 0x04, 0x84, 0x84, 0x84, 0x84, 0x84, 0x48,
+  0x34, 0x14, 0x24, 0x24, 0x14, 0x38, 0x48, 0x49, 0x39, 0x34, 0x24, 0x24,
+  0x33, 0x24, 0x34, 0x14, 0x43, 0x14, 0x44, 0x0F, 0xFF, 0xFC, 0x04, 0x14,
+  0x35, 0x2A, 0x17, 0x1F, 0x92, 0x53, 0x83, 0x44, 0x83, 0x44, 0x83, 0x44,
+  0x83, 0x44, 0x83, 0x44, 0x83, 0x44, 0x83, 0x44, 0x83, 0x44, 0x83, 0x44,
+  0x40, 0x04, 0x15, 0x2B, 0x1F, 0x22, 0x94, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x40, 0x45, 0x69, 0x3B, 0x24, 0x34, 0x14, 0x58, 0x58,
+  0x58, 0x58, 0x54, 0x14, 0x34, 0x2B, 0x39, 0x65, 0x40, 0x04, 0x15, 0x3B,
+  0x2C, 0x15, 0x34, 0x14, 0x58, 0x58, 0x58, 0x58, 0x59, 0x34, 0x1C, 0x1B,
+  0x24, 0x14, 0x44, 0x94, 0x94, 0x94, 0x94, 0x90, 0x44, 0x14, 0x2B, 0x1C,
+  0x14, 0x39, 0x58, 0x58, 0x58, 0x58, 0x54, 0x14, 0x35, 0x1C, 0x2B, 0x35,
+  0x14, 0x94, 0x94, 0x94, 0x94, 0x94, 0x04, 0x26, 0x1F, 0x13, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x36, 0x49, 0x2B, 0x14, 0x49,
+  0x78, 0x5A, 0x58, 0x79, 0x4F, 0x02, 0xA4, 0x63, 0x14, 0x24, 0x24, 0x1C,
+  0x14, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x15, 0x24, 0x04, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x3F, 0x21, 0xB2, 0x51,
+  0x40, 0x04, 0x54, 0x13, 0x53, 0x24, 0x43, 0x24, 0x34, 0x33, 0x33, 0x43,
+  0x33, 0x53, 0x14, 0x53, 0x13, 0x63, 0x13, 0x76, 0x75, 0x85, 0x93, 0x50,
+  0x04, 0x43, 0x43, 0x13, 0x34, 0x43, 0x13, 0x35, 0x24, 0x14, 0x25, 0x24,
+  0x14, 0x22, 0x12, 0x23, 0x33, 0x22, 0x12, 0x23, 0x33, 0x13, 0x12, 0x23,
+  0x33, 0x13, 0x16, 0x55, 0x26, 0x55, 0x35, 0x55, 0x35, 0x55, 0x34, 0x73,
+  0x44, 0x30, 0x14, 0x34, 0x24, 0x34, 0x34, 0x14, 0x53, 0x13, 0x67, 0x75,
+  0x94, 0x85, 0x77, 0x63, 0x14, 0x44, 0x14, 0x34, 0x34, 0x24, 0x43, 0x10,
+  0x04, 0x54, 0x13, 0x53, 0x24, 0x43, 0x33, 0x34, 0x33, 0x33, 0x44, 0x23,
+  0x53, 0x23, 0x53, 0x13, 0x67, 0x76, 0x75, 0x94, 0x93, 0xA3, 0x94, 0x75,
+  0x85, 0x84, 0x70, 0x0F, 0xF0, 0x64, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x6F, 0xF0, 0x33, 0x24, 0x24, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x14, 0x24, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x24,
+  0x33, 0x0F, 0xFE, 0x03, 0x33, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x44, 0x24, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x24,
+  0x24, 0x23, 0x30, 0x14, 0x77, 0x52, 0x24, 0x22, 0x57, 0x74, 0x10 };
+
+const GFXglyph FreeSansBold12pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,   7,    0,    1 },   // 0x20 ' '
+  {     0,   4,  17,   8,    3,  -16 },   // 0x21 '!'
+  {     8,  10,   6,  11,    1,  -17 },   // 0x22 '"'
+  {    18,  13,  16,  13,    0,  -15 },   // 0x23 '#'
+  {    45,  13,  20,  13,    0,  -17 },   // 0x24 '$'
+  {    76,  19,  17,  21,    1,  -16 },   // 0x25 '%'
+  {   118,  16,  17,  17,    1,  -16 },   // 0x26 '&'
+  {   147,   4,   6,   6,    1,  -17 },   // 0x27 '''
+  {   151,   6,  22,   8,    1,  -17 },   // 0x28 '('
+  {   173,   6,  22,   8,    1,  -17 },   // 0x29 ')'
+  {   196,   7,   8,   9,    1,  -17 },   // 0x2A '*'
+  {   208,  11,  11,  14,    2,  -10 },   // 0x2B '+'
+  {   219,   4,   7,   6,    1,   -2 },   // 0x2C ','
+  {   225,   6,   3,   8,    1,   -7 },   // 0x2D '-'
+  {   227,   4,   3,   6,    1,   -2 },   // 0x2E '.'
+  {   228,   6,  17,   7,    0,  -16 },   // 0x2F '/'
+  {   246,  12,  17,  13,    1,  -16 },   // 0x30 '0'
+  {   267,   7,  17,  14,    3,  -16 },   // 0x31 '1'
+  {   283,  12,  17,  13,    1,  -16 },   // 0x32 '2'
+  {   301,  12,  17,  13,    1,  -16 },   // 0x33 '3'
+  {   321,  11,  17,  13,    1,  -16 },   // 0x34 '4'
+  {   344,  12,  17,  13,    1,  -16 },   // 0x35 '5'
+  {   364,  12,  17,  13,    1,  -16 },   // 0x36 '6'
+  {   385,  11,  17,  13,    1,  -16 },   // 0x37 '7'
+  {   402,  12,  17,  13,    1,  -16 },   // 0x38 '8'
+  {   426,  12,  17,  13,    1,  -16 },   // 0x39 '9'
+  {   449,   4,  12,   6,    1,  -11 },   // 0x3A ':'
+  {   452,   4,  16,   6,    1,  -11 },   // 0x3B ';'
+  {   459,  12,  12,  14,    1,  -11 },   // 0x3C '<'
+  {   471,  12,   9,  14,    1,   -9 },   // 0x3D '='
+  {   476,  12,  12,  14,    1,  -11 },   // 0x3E '>'
+  {   488,  12,  18,  15,    2,  -17 },   // 0x3F '?'
+  {   507,  21,  21,  23,    1,  -17 },   // 0x40 '@'
+  {   560,  16,  18,  17,    0,  -17 },   // 0x41 'A'
+  {   587,  14,  18,  17,    2,  -17 },   // 0x42 'B'
+  {   611,  16,  18,  17,    1,  -17 },   // 0x43 'C'
+  {   634,  15,  18,  17,    2,  -17 },   // 0x44 'D'
+  {   657,  13,  18,  16,    2,  -17 },   // 0x45 'E'
+  {   674,  12,  18,  15,    2,  -17 },   // 0x46 'F'
+  {   691,  16,  18,  18,    1,  -17 },   // 0x47 'G'
+  {   718,  14,  18,  18,    2,  -17 },   // 0x48 'H'
+  {   736,   4,  18,   7,    2,  -17 },   // 0x49 'I'
+  {   739,  11,  18,  14,    1,  -17 },   // 0x4A 'J'
+  {   758,  16,  18,  17,    2,  -17 },   // 0x4B 'K'
+  {   792,  11,  18,  15,    2,  -17 },   // 0x4C 'L'
+  {   809,  17,  18,  21,    2,  -17 },   // 0x4D 'M'
+  {   842,  15,  18,  18,    2,  -17 },   // 0x4E 'N'
+  {   866,  17,  18,  19,    1,  -17 },   // 0x4F 'O'
+  {   892,  14,  18,  16,    2,  -17 },   // 0x50 'P'
+  {   911,  17,  19,  19,    1,  -17 },   // 0x51 'Q'
+  {   939,  16,  18,  17,    2,  -17 },   // 0x52 'R'
+  {   969,  15,  18,  16,    1,  -17 },   // 0x53 'S'
+  {   991,  12,  18,  15,    2,  -17 },   // 0x54 'T'
+  {  1009,  14,  18,  18,    2,  -17 },   // 0x55 'U'
+  {  1030,  15,  18,  16,    0,  -17 },   // 0x56 'V'
+  {  1061,  23,  18,  23,    0,  -17 },   // 0x57 'W'
+  {  1115,  15,  18,  16,    1,  -17 },   // 0x58 'X'
+  {  1144,  16,  18,  15,    0,  -17 },   // 0x59 'Y'
+  {  1170,  13,  18,  15,    1,  -17 },   // 0x5A 'Z'
+  {  1186,   6,  23,   8,    2,  -17 },   // 0x5B '['
+  {  1205,   7,  17,   7,    0,  -16 },   // 0x5C '\'
+  {  1222,   6,  23,   8,    0,  -17 },   // 0x5D ']'
+  {  1241,  12,  11,  14,    1,  -16 },   // 0x5E '^'
+  {  1259,  15,   2,  13,   -1,    4 },   // 0x5F '_'
+  {  1261,   4,   3,   6,    0,  -17 },   // 0x60 '`'
+  {  1264,  13,  13,  14,    1,  -12 },   // 0x61 'a'
+  {  1282,  13,  18,  15,    2,  -17 },   // 0x62 'b'
+  {  1305,  12,  13,  13,    1,  -12 },   // 0x63 'c'
+  {  1321,  13,  18,  15,    1,  -17 },   // 0x64 'd'
+  {  1343,  13,  13,  14,    1,  -12 },   // 0x65 'e'
+  {  1360,   7,  18,   8,    1,  -17 },   // 0x66 'f'
+  {  1379,  13,  18,  15,    1,  -12 },   // 0x67 'g'
+  {  1402,  12,  18,  14,    2,  -17 },   // 0x68 'h'
+  {  1422,   4,  18,   7,    2,  -17 },   // 0x69 'i'
+  {  1426,   6,  23,   7,    0,  -17 },   // 0x6A 'j'
+  {  1445,  12,  18,  14,    2,  -17 },   // 0x6B 'k'
+  {  1471,   4,  18,   6,    2,  -17 },   // 0x6C 'l'
+  {  1474,  19,  13,  21,    2,  -12 },   // 0x6D 'm'
+  {  1501,  12,  13,  15,    2,  -12 },   // 0x6E 'n'
+  {  1516,  13,  13,  15,    1,  -12 },   // 0x6F 'o'
+  {  1533,  13,  18,  15,    2,  -12 },   // 0x70 'p'
+  {  1556,  13,  18,  15,    1,  -12 },   // 0x71 'q'
+  {  1578,   8,  13,   9,    2,  -12 },   // 0x72 'r'
+  {  1591,  12,  13,  13,    1,  -12 },   // 0x73 's'
+  {  1604,   6,  15,   8,    1,  -14 },   // 0x74 't'
+  {  1618,  12,  13,  15,    2,  -12 },   // 0x75 'u'
+  {  1633,  13,  13,  13,    0,  -12 },   // 0x76 'v'
+  {  1656,  18,  13,  19,    0,  -12 },   // 0x77 'w'
+  {  1694,  13,  13,  13,    0,  -12 },   // 0x78 'x'
+  {  1716,  13,  18,  13,    0,  -12 },   // 0x79 'y'
+  {  1743,  10,  13,  12,    1,  -12 },   // 0x7A 'z'
+  {  1754,   6,  23,   9,    1,  -17 },   // 0x7B '{'
+  {  1777,   2,  22,   7,    2,  -17 },   // 0x7C '|'
+  {  1779,   6,  23,   9,    3,  -17 },   // 0x7D '}'
+  {  1803,  12,   5,  12,    0,   -7 } }; // 0x7E '~'
+
+const GFXfontPacked FreeSansBold12pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeSansBold12pt7bPackedRuns,
+    (GFXglyph *)FreeSansBold12pt7bPackedGlyphs,
+    0x20, 0x7E, 29 } };
+
+// Approx. 2483 bytes
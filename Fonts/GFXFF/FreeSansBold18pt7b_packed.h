@@ -0,0 +1,343 @@
+// FreeSansBold18pt7b as run lengths, generated by Tools/GFX_pack from FreeSansBold18pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeSansBold18pt7bPackedRuns[] PROGMEM = {
+  0x0F, 0xFF, 0xA1, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3B, 0xFA, 0x05,
+  0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x35, 0x13, 0x53, 0x23, 0x53, 0x23, 0x53,
+  0x10, 0x64, 0x43, 0x94, 0x34, 0x94, 0x34, 0x93, 0x44, 0x84, 0x43, 0x5F,
+  0x41, 0xF4, 0x1F, 0x41, 0xF4, 0x44, 0x43, 0x94, 0x43, 0x94, 0x34, 0x94,
+  0x34, 0x93, 0x44, 0x5F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x53, 0x44, 0x84,
+  0x43, 0x94, 0x34, 0x94, 0x34, 0x93, 0x44, 0x93, 0x44, 0x70, 0x92, 0xE8,
+  0x9C, 0x6E, 0x4F, 0x12, 0x62, 0x21, 0x62, 0x53, 0x22, 0x61, 0x44, 0x23,
+  0x51, 0x44, 0x23, 0x51, 0x53, 0x29, 0x71, 0x2A, 0x9B, 0xB9, 0xCA, 0xAB,
+  0x9A, 0x22, 0x69, 0x23, 0xA4, 0x23, 0xA4, 0x23, 0xB3, 0x23, 0x51, 0x62,
+  0x21, 0x62, 0xF2, 0x3F, 0x06, 0xC9, 0x8E, 0x2F, 0x22, 0xF2, 0x28, 0x44,
+  0xB3, 0x98, 0x93, 0x8A, 0x73, 0x9A, 0x73, 0x84, 0x44, 0x53, 0x93, 0x63,
+  0x53, 0x93, 0x63, 0x43, 0xA3, 0x63, 0x34, 0xA4, 0x44, 0x33, 0xCA, 0x33,
+  0xDA, 0x33, 0xE8, 0x33, 0xF2, 0x45, 0x34, 0x5F, 0x13, 0x39, 0xE3, 0x2B,
+  0xC3, 0x3B, 0xC3, 0x24, 0x54, 0xA3, 0x33, 0x73, 0xA2, 0x43, 0x73, 0x93,
+  0x43, 0x73, 0x92, 0x54, 0x54, 0x83, 0x6B, 0x83, 0x7B, 0x83, 0x89, 0x83,
+  0xB5, 0x40, 0x75, 0xF0, 0x8D, 0xAC, 0xBA, 0x53, 0x4A, 0x53, 0x4A, 0x53,
+  0x4A, 0x62, 0x4B, 0x51, 0x4D, 0x8F, 0x06, 0xF0, 0x6E, 0x94, 0x44, 0xB3,
+  0x43, 0x62, 0x52, 0x42, 0x64, 0x93, 0x55, 0x93, 0x56, 0x83, 0x57, 0x64,
+  0x66, 0x65, 0x63, 0x94, 0xF3, 0x5F, 0x35, 0xA2, 0x66, 0x74, 0x60, 0x0F,
+  0xF0, 0x13, 0x23, 0x23, 0x10, 0x54, 0x44, 0x54, 0x44, 0x54, 0x44, 0x54,
+  0x54, 0x44, 0x54, 0x54, 0x44, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x63, 0x64, 0x54, 0x54, 0x64, 0x54, 0x63, 0x64, 0x63, 0x64,
+  0x63, 0x64, 0x04, 0x63, 0x64, 0x64, 0x54, 0x64, 0x54, 0x54, 0x64, 0x54,
+  0x54, 0x64, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x44,
+  0x54, 0x54, 0x54, 0x44, 0x54, 0x44, 0x54, 0x53, 0x54, 0x53, 0x54, 0x50,
+  0x52, 0xA2, 0xA2, 0x63, 0x12, 0x13, 0x2A, 0x38, 0x64, 0x76, 0x66, 0x53,
+  0x23, 0x51, 0x41, 0x30, 0x64, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x6F, 0xFF,
+  0xF4, 0x64, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x60, 0x0F, 0xA3, 0x23, 0x23,
+  0x22, 0x21, 0x41, 0x23, 0x0F, 0xF6, 0x0F, 0xA0, 0x72, 0x63, 0x62, 0x72,
+  0x63, 0x63, 0x62, 0x72, 0x63, 0x62, 0x72, 0x72, 0x63, 0x62, 0x72, 0x72,
+  0x63, 0x62, 0x72, 0x63, 0x63, 0x62, 0x72, 0x63, 0x62, 0x70, 0x57, 0x8B,
+  0x5D, 0x4D, 0x36, 0x36, 0x25, 0x55, 0x25, 0x55, 0x15, 0x7A, 0x7A, 0x7A,
+  0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x75, 0x15, 0x55, 0x25, 0x55,
+  0x26, 0x36, 0x3D, 0x4D, 0x5B, 0x87, 0x50, 0x73, 0x64, 0x64, 0x55, 0x3F,
+  0xF7, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x8B, 0x5D, 0x3F, 0x02, 0x63,
+  0x61, 0x65, 0xB7, 0xA7, 0xA7, 0x5C, 0x5B, 0x6B, 0x5B, 0x6A, 0x69, 0x79,
+  0x79, 0x6A, 0x6A, 0x5B, 0x5C, 0x5B, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x10,
+  0x56, 0x9A, 0x6C, 0x4E, 0x26, 0x46, 0x15, 0x65, 0x15, 0x65, 0x15, 0x65,
+  0xC5, 0xB5, 0xC5, 0x97, 0xA7, 0xA8, 0xC6, 0xC6, 0xCA, 0x7A, 0x7B, 0x56,
+  0x15, 0x46, 0x2F, 0x03, 0xD5, 0xB8, 0x75, 0x86, 0xA6, 0x97, 0x97, 0x88,
+  0x73, 0x15, 0x73, 0x15, 0x63, 0x25, 0x63, 0x25, 0x53, 0x35, 0x52, 0x45,
+  0x43, 0x45, 0x33, 0x55, 0x32, 0x65, 0x23, 0x65, 0x2F, 0xFF, 0xF4, 0x95,
+  0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x20, 0x3D, 0x4D, 0x3E, 0x3E, 0x34, 0xD4,
+  0xD3, 0xE3, 0xD4, 0x25, 0x6D, 0x4E, 0x3F, 0x02, 0x54, 0x6C, 0x6C, 0x5C,
+  0x5C, 0x5C, 0xA7, 0xA6, 0xC4, 0x62, 0xE3, 0xE5, 0xA9, 0x66, 0x67, 0x9B,
+  0x6D, 0x4F, 0x03, 0x54, 0x62, 0x56, 0x52, 0x5C, 0x5D, 0x53, 0x55, 0x51,
+  0x93, 0xF1, 0x2F, 0x21, 0x74, 0x61, 0x66, 0xB8, 0xA8, 0xA8, 0xA8, 0x51,
+  0x48, 0x51, 0x56, 0x52, 0x64, 0x63, 0xE5, 0xD6, 0xAA, 0x66, 0x0F, 0xFF,
+  0xF8, 0xC4, 0xC5, 0xB5, 0xC4, 0xC5, 0xC4, 0xC5, 0xC4, 0xC5, 0xC4, 0xC5,
+  0xC5, 0xC4, 0xC5, 0xC5, 0xC5, 0xC4, 0xC5, 0xC5, 0xC5, 0xC5, 0x80, 0x56,
+  0xA9, 0x6C, 0x5D, 0x35, 0x46, 0x24, 0x65, 0x24, 0x74, 0x24, 0x74, 0x24,
+  0x65, 0x34, 0x45, 0x5B, 0x79, 0x6D, 0x36, 0x36, 0x25, 0x55, 0x15, 0x7A,
+  0x7A, 0x7A, 0x7B, 0x56, 0x15, 0x46, 0x2F, 0x03, 0xD5, 0xB8, 0x75, 0x56,
+  0x9A, 0x6C, 0x4E, 0x36, 0x36, 0x16, 0x55, 0x15, 0x74, 0x15, 0x7A, 0x7A,
+  0x7A, 0x7B, 0x56, 0x16, 0x37, 0x1F, 0x12, 0xF0, 0x38, 0x15, 0x55, 0x25,
+  0xC4, 0xD4, 0x15, 0x65, 0x25, 0x45, 0x3E, 0x4C, 0x6A, 0x96, 0x60, 0x0F,
+  0xAF, 0xFA, 0xFA, 0x0F, 0xAF, 0xFA, 0xFA, 0x32, 0x32, 0x23, 0x22, 0x14,
+  0x12, 0x30, 0xF1, 0x2E, 0x4B, 0x78, 0xA6, 0xA5, 0xA5, 0xA8, 0x7B, 0x4E,
+  0x7B, 0xAB, 0xAA, 0xBA, 0xAB, 0x7D, 0x5F, 0x12, 0x0F, 0xFF, 0xF8, 0xFF,
+  0xFF, 0x8F, 0xFF, 0xF8, 0x02, 0xF1, 0x4E, 0x7B, 0xAA, 0xAB, 0xAB, 0xAB,
+  0x7E, 0x4B, 0x78, 0xA5, 0xA5, 0xB5, 0xA8, 0x7B, 0x4E, 0x2F, 0x10, 0x57,
+  0x9B, 0x6E, 0x3F, 0x03, 0x63, 0x71, 0x66, 0xB8, 0xA8, 0xA8, 0x5C, 0x6B,
+  0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x5C, 0x5D, 0x4E, 0x4F, 0xFF, 0x55, 0xD5,
+  0xD5, 0xD5, 0xD5, 0x70, 0xD9, 0xF5, 0xEF, 0x1F, 0x3D, 0x68, 0x7A, 0x5C,
+  0x68, 0x4F, 0x15, 0x64, 0xF3, 0x45, 0x47, 0x53, 0x32, 0x43, 0x46, 0x81,
+  0x43, 0x33, 0x36, 0xD4, 0x32, 0x45, 0x54, 0x55, 0x31, 0x36, 0x37, 0x45,
+  0x31, 0x35, 0x47, 0x45, 0x66, 0x38, 0x36, 0x66, 0x38, 0x36, 0x65, 0x39,
+  0x36, 0x65, 0x38, 0x45, 0x75, 0x38, 0x36, 0x31, 0x35, 0x37, 0x45, 0x41,
+  0x35, 0x46, 0x44, 0x42, 0x44, 0x44, 0x63, 0x53, 0x35, 0xF5, 0x44, 0x58,
+  0x28, 0x64, 0x55, 0x55, 0x85, 0xFD, 0x5F, 0xD6, 0xD1, 0xD7, 0x84, 0xEF,
+  0x3F, 0x1F, 0x1F, 0x4A, 0xB0, 0x96, 0xF3, 0x7F, 0x27, 0xF1, 0x8F, 0x19,
+  0xEA, 0xEA, 0xE5, 0x15, 0xC5, 0x25, 0xC5, 0x25, 0xC5, 0x35, 0xA5, 0x45,
+  0xA5, 0x45, 0xA5, 0x55, 0x85, 0x65, 0x85, 0x65, 0x8F, 0x26, 0xF3, 0x6F,
+  0x45, 0xF4, 0x45, 0xA5, 0x45, 0xA6, 0x35, 0xB5, 0x25, 0xC5, 0x25, 0xC6,
+  0x15, 0xD5, 0x0E, 0x6F, 0x14, 0xF2, 0x3F, 0x32, 0x58, 0x61, 0x59, 0x51,
+  0x59, 0x51, 0x59, 0x51, 0x59, 0x51, 0x59, 0x51, 0x58, 0x52, 0xF2, 0x3F,
+  0x14, 0xF2, 0x3F, 0x32, 0x58, 0x61, 0x5A, 0x41, 0x5A, 0xAA, 0xAA, 0xAA,
+  0xA9, 0x51, 0xF4, 0x1F, 0x32, 0xF2, 0x3F, 0x05, 0x88, 0xDC, 0x9F, 0x16,
+  0xF3, 0x47, 0x66, 0x46, 0x86, 0x26, 0xA5, 0x25, 0xC5, 0x15, 0xCA, 0xF3,
+  0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x45, 0xC5,
+  0x15, 0xC5, 0x16, 0xA6, 0x26, 0x86, 0x37, 0x67, 0x4F, 0x36, 0xF1, 0x9C,
+  0xD8, 0x70, 0x0E, 0x7F, 0x15, 0xF2, 0x4F, 0x33, 0x57, 0x72, 0x59, 0x52,
+  0x5A, 0x51, 0x5A, 0x51, 0x5A, 0x51, 0x5B, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+  0xAB, 0xAB, 0xAA, 0xBA, 0x51, 0x5A, 0x51, 0x59, 0x52, 0x57, 0x72, 0xF3,
+  0x3F, 0x24, 0xF1, 0x5E, 0x70, 0x0F, 0x31, 0xF3, 0x1F, 0x31, 0xF3, 0x15,
+  0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xEF, 0x22, 0xF2, 0x2F, 0x22, 0xF2,
+  0x25, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xEF, 0xFF, 0xFF, 0x10, 0x0F,
+  0xFF, 0xFD, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xCF, 0x11, 0xF1, 0x1F,
+  0x11, 0xF1, 0x15, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+  0xC5, 0xC0, 0x98, 0xDD, 0xAF, 0x17, 0xF3, 0x57, 0x67, 0x36, 0x96, 0x26,
+  0xB6, 0x15, 0xD5, 0x15, 0xF3, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0x9F, 0x09,
+  0xF0, 0x9F, 0x09, 0xF1, 0xE4, 0x15, 0xD5, 0x15, 0xD5, 0x16, 0xB6, 0x26,
+  0x97, 0x37, 0x59, 0x4F, 0x55, 0xE2, 0x36, 0xC3, 0x38, 0x85, 0x30, 0x05,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF,
+  0xF0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xA5, 0x0F, 0xFF, 0xFF, 0xFF, 0xFA, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+  0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xBA, 0x6A, 0x6A,
+  0x6A, 0x6A, 0x6B, 0x46, 0x1E, 0x3C, 0x5A, 0x86, 0x50, 0x05, 0xA6, 0x15,
+  0x96, 0x25, 0x86, 0x35, 0x76, 0x45, 0x66, 0x55, 0x56, 0x65, 0x46, 0x75,
+  0x36, 0x85, 0x35, 0x95, 0x26, 0x95, 0x16, 0xAB, 0xBC, 0xAD, 0x9D, 0x97,
+  0x16, 0x86, 0x36, 0x75, 0x56, 0x65, 0x66, 0x55, 0x66, 0x55, 0x76, 0x45,
+  0x86, 0x35, 0x87, 0x25, 0x96, 0x25, 0xA6, 0x15, 0xB6, 0x05, 0xC5, 0xC5,
+  0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+  0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xCF, 0xFF, 0xF8, 0x08, 0x8F,
+  0x18, 0xF1, 0x8F, 0x17, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xE1, 0x44,
+  0x41, 0xA1, 0x44, 0x41, 0xA1, 0x44, 0x41, 0xA1, 0x44, 0x41, 0xA2, 0x33,
+  0x51, 0xA2, 0x42, 0x42, 0xA2, 0x42, 0x42, 0xA2, 0x42, 0x42, 0xA2, 0x42,
+  0x42, 0xA3, 0x83, 0xA3, 0x83, 0xA3, 0x83, 0xA3, 0x83, 0xA4, 0x73, 0xA4,
+  0x64, 0xA4, 0x64, 0xA4, 0x64, 0xA5, 0x54, 0x50, 0x05, 0xAB, 0x9C, 0x8C,
+  0x8D, 0x7D, 0x7E, 0x6E, 0x6F, 0x05, 0xA1, 0x45, 0xA1, 0x54, 0xA2, 0x53,
+  0xA2, 0x53, 0xA3, 0x52, 0xA4, 0x42, 0xA4, 0x51, 0xA5, 0x41, 0xA5, 0xF0,
+  0x6E, 0x6E, 0x7D, 0x7D, 0x8C, 0x9B, 0x9B, 0xA5, 0x97, 0xF0, 0xDB, 0xF0,
+  0x8F, 0x37, 0x75, 0x75, 0x69, 0x63, 0x6B, 0x62, 0x5D, 0x52, 0x5D, 0x51,
+  0x5F, 0x0A, 0xF0, 0xAF, 0x0A, 0xF0, 0xAF, 0x0A, 0xF0, 0xAF, 0x0A, 0xF0,
+  0x51, 0x5D, 0x52, 0x5D, 0x52, 0x6B, 0x63, 0x69, 0x65, 0x75, 0x76, 0xF3,
+  0x9F, 0x0B, 0xDF, 0x07, 0x90, 0x0E, 0x5F, 0x13, 0xF2, 0x2F, 0x31, 0x57,
+  0xC8, 0xB9, 0xA9, 0xA9, 0xA9, 0xA8, 0xB7, 0x61, 0xF3, 0x1F, 0x22, 0xF1,
+  0x3E, 0x55, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE0,
+  0x97, 0xF0, 0xDB, 0xF0, 0x8F, 0x37, 0x75, 0x75, 0x69, 0x63, 0x6B, 0x62,
+  0x5D, 0x52, 0x5D, 0x51, 0x5F, 0x0A, 0xF0, 0xAF, 0x0A, 0xF0, 0xAF, 0x0A,
+  0xF0, 0xAF, 0x0A, 0xA1, 0x45, 0x15, 0x83, 0x25, 0x25, 0x7B, 0x26, 0x7A,
+  0x36, 0x78, 0x57, 0x58, 0x5F, 0x57, 0xF4, 0x7D, 0x15, 0x98, 0x43, 0xF8,
+  0x12, 0x0F, 0x15, 0xF3, 0x3F, 0x42, 0xF4, 0x25, 0x96, 0x15, 0xA5, 0x15,
+  0xA5, 0x15, 0xA5, 0x15, 0xA5, 0x15, 0xA4, 0x25, 0x95, 0x2F, 0x33, 0xF2,
+  0x4F, 0x24, 0xF3, 0x35, 0x86, 0x25, 0x95, 0x25, 0x95, 0x25, 0x95, 0x25,
+  0x95, 0x25, 0x95, 0x25, 0x95, 0x25, 0x95, 0x25, 0x95, 0x25, 0x96, 0x15,
+  0xA6, 0x58, 0xAD, 0x6F, 0x04, 0xF2, 0x36, 0x56, 0x26, 0x76, 0x15, 0x95,
+  0x15, 0x95, 0x15, 0xF0, 0x6E, 0x8D, 0xD8, 0xF0, 0x6F, 0x08, 0xDC, 0x9E,
+  0x6F, 0x0A, 0xAA, 0xAB, 0x8D, 0x66, 0x2F, 0x33, 0xF1, 0x5D, 0xA8, 0x60,
+  0x0F, 0xFF, 0xFF, 0x17, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+  0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+  0x5E, 0x57, 0x05, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x15,
+  0x85, 0x26, 0x66, 0x3F, 0x14, 0xF1, 0x6C, 0xA8, 0x60, 0x05, 0xB5, 0x15,
+  0xB5, 0x25, 0x96, 0x25, 0x95, 0x35, 0x95, 0x45, 0x85, 0x45, 0x75, 0x55,
+  0x75, 0x64, 0x75, 0x65, 0x55, 0x75, 0x55, 0x84, 0x55, 0x85, 0x44, 0x95,
+  0x35, 0x95, 0x35, 0xA4, 0x34, 0xB5, 0x24, 0xB5, 0x15, 0xC4, 0x14, 0xD9,
+  0xD9, 0xE7, 0xF0, 0x7F, 0x07, 0xF1, 0x5F, 0x25, 0x90, 0x05, 0x85, 0x8B,
+  0x86, 0x75, 0x16, 0x76, 0x75, 0x25, 0x67, 0x75, 0x25, 0x67, 0x66, 0x25,
+  0x67, 0x65, 0x35, 0x68, 0x55, 0x45, 0x58, 0x55, 0x45, 0x44, 0x14, 0x54,
+  0x55, 0x44, 0x23, 0x45, 0x64, 0x44, 0x23, 0x45, 0x64, 0x44, 0x24, 0x35,
+  0x65, 0x34, 0x24, 0x34, 0x75, 0x24, 0x34, 0x34, 0x84, 0x24, 0x43, 0x25,
+  0x84, 0x24, 0x44, 0x15, 0x84, 0x24, 0x44, 0x14, 0x95, 0x14, 0x44, 0x14,
+  0xA8, 0x54, 0x14, 0xA8, 0x68, 0xA8, 0x67, 0xC7, 0x67, 0xC7, 0x67, 0xC6,
+  0x85, 0xD6, 0x85, 0xE5, 0x85, 0x70, 0x07, 0x86, 0x26, 0x86, 0x36, 0x66,
+  0x46, 0x65, 0x66, 0x46, 0x66, 0x36, 0x86, 0x26, 0x95, 0x16, 0xAB, 0xCA,
+  0xC9, 0xE7, 0xF1, 0x6F, 0x07, 0xF0, 0x8D, 0x9D, 0xAB, 0x51, 0x69, 0x62,
+  0x59, 0x53, 0x67, 0x64, 0x57, 0x55, 0x65, 0x66, 0x63, 0x67, 0x63, 0x68,
+  0x61, 0x69, 0x70, 0x06, 0x9C, 0x95, 0x25, 0x86, 0x26, 0x75, 0x45, 0x66,
+  0x46, 0x55, 0x65, 0x55, 0x66, 0x35, 0x85, 0x35, 0x86, 0x15, 0xA5, 0x15,
+  0xAA, 0xC9, 0xD7, 0xE7, 0xF0, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F,
+  0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x58, 0x0F, 0xFF, 0xFF,
+  0x1D, 0x6C, 0x6C, 0x6D, 0x6C, 0x6C, 0x6C, 0x7C, 0x6C, 0x6C, 0x6C, 0x7C,
+  0x6C, 0x6C, 0x6D, 0x6C, 0x6C, 0x6C, 0x7C, 0xFF, 0xFF, 0xF1, 0x0F, 0xF7,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x3F, 0xF2, 0x03, 0x73, 0x82, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82, 0x82,
+  0x83, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82,
+  0x82, 0x83, 0x73, 0x0F, 0xF2, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x3F, 0xF7, 0x65, 0xA6, 0xA6, 0x98, 0x88,
+  0x84, 0x14, 0x64, 0x24, 0x64, 0x24, 0x54, 0x44, 0x44, 0x44, 0x44, 0x54,
+  0x24, 0x64, 0x24, 0x64, 0x23, 0x88, 0x84, 0x0F, 0xFF, 0xF3, 0x05, 0x34,
+  0x44, 0x43, 0x53, 0x58, 0x8C, 0x5E, 0x3F, 0x12, 0x55, 0x61, 0x57, 0x5D,
+  0x5A, 0x85, 0xD3, 0xF0, 0x28, 0x35, 0x16, 0x65, 0x15, 0x75, 0x15, 0x66,
+  0x16, 0x47, 0x1F, 0x22, 0xF1, 0x39, 0x16, 0x36, 0x36, 0x05, 0xD5, 0xD5,
+  0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x26, 0x55, 0x18, 0x4F, 0x12, 0xF1, 0x27,
+  0x46, 0x16, 0x65, 0x16, 0x6B, 0x8A, 0x8A, 0x8A, 0x8A, 0x8B, 0x6C, 0x65,
+  0x17, 0x46, 0x1F, 0x12, 0xF1, 0x25, 0x18, 0x45, 0x26, 0x50, 0x66, 0x9A,
+  0x5D, 0x4E, 0x26, 0x46, 0x15, 0x6A, 0x7A, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+  0x75, 0x15, 0x65, 0x16, 0x46, 0x2E, 0x3D, 0x5B, 0x96, 0x50, 0xE5, 0xE5,
+  0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0x65, 0x35, 0x49, 0x15, 0x3F, 0x12, 0xF2,
+  0x17, 0x38, 0x15, 0x7C, 0x7B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x76, 0x15,
+  0x76, 0x16, 0x48, 0x2F, 0x23, 0xF1, 0x49, 0x15, 0x56, 0x35, 0x56, 0xAA,
+  0x7D, 0x5D, 0x46, 0x45, 0x35, 0x64, 0x25, 0x75, 0x15, 0x84, 0x1F, 0x21,
+  0xF2, 0x1F, 0x21, 0x5D, 0x5D, 0x66, 0x52, 0x64, 0x62, 0xF0, 0x4D, 0x6B,
+  0x97, 0x60, 0x46, 0x37, 0x28, 0x28, 0x25, 0x55, 0x55, 0x39, 0x19, 0x19,
+  0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x30, 0x55, 0x35, 0x48, 0x15, 0x2F, 0x12, 0xF1,
+  0x16, 0x47, 0x15, 0x6C, 0x6B, 0x8A, 0x8A, 0x8A, 0x8A, 0x8B, 0x66, 0x15,
+  0x66, 0x16, 0x47, 0x1F, 0x22, 0xF1, 0x39, 0x15, 0x55, 0x35, 0xD5, 0xDB,
+  0x66, 0x16, 0x46, 0x2F, 0x04, 0xD8, 0x85, 0x05, 0xC5, 0xC5, 0xC5, 0xC5,
+  0xC5, 0xC5, 0xC5, 0x35, 0x45, 0x19, 0x2F, 0x11, 0xF1, 0x17, 0x4C, 0x6A,
+  0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+  0x75, 0x0F, 0x5F, 0x0F, 0xFF, 0xFF, 0xF5, 0x25, 0x25, 0x25, 0x25, 0xF8,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0xFA, 0x15, 0x20,
+  0x05, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0x65, 0x15, 0x55, 0x25,
+  0x46, 0x25, 0x36, 0x35, 0x26, 0x45, 0x25, 0x55, 0x15, 0x6B, 0x6B, 0x6C,
+  0x5C, 0x56, 0x16, 0x45, 0x35, 0x45, 0x45, 0x35, 0x46, 0x25, 0x55, 0x25,
+  0x56, 0x15, 0x65, 0x15, 0x66, 0x0F, 0xFF, 0xFF, 0xFF, 0xFA, 0x05, 0x35,
+  0x56, 0x35, 0x18, 0x29, 0x2F, 0xB1, 0xFF, 0x34, 0x74, 0xC5, 0x65, 0xA6,
+  0x56, 0xA6, 0x56, 0xA6, 0x56, 0xA6, 0x56, 0xA6, 0x56, 0xA6, 0x56, 0xA6,
+  0x56, 0xA6, 0x56, 0xA6, 0x56, 0xA6, 0x56, 0xA6, 0x56, 0xA6, 0x56, 0xA6,
+  0x56, 0x50, 0x05, 0x35, 0x45, 0x19, 0x2F, 0x11, 0xF1, 0x17, 0x4C, 0x6A,
+  0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+  0x75, 0x67, 0xAB, 0x7D, 0x5F, 0x03, 0x74, 0x62, 0x57, 0x51, 0x67, 0xB9,
+  0xA9, 0xA9, 0xA9, 0xA9, 0xB7, 0x61, 0x57, 0x52, 0x64, 0x73, 0xF0, 0x5D,
+  0x7B, 0xA7, 0x60, 0x05, 0x35, 0x55, 0x19, 0x3F, 0x12, 0xF1, 0x27, 0x46,
+  0x16, 0x65, 0x16, 0x6B, 0x8A, 0x8A, 0x8A, 0x8A, 0x8B, 0x6C, 0x65, 0x17,
+  0x46, 0x1F, 0x12, 0xF1, 0x25, 0x18, 0x45, 0x35, 0x55, 0xD5, 0xD5, 0xD5,
+  0xD5, 0xD5, 0xD5, 0xD0, 0x56, 0x35, 0x49, 0x15, 0x3F, 0x12, 0xF2, 0x17,
+  0x38, 0x15, 0x7C, 0x7B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x76, 0x15, 0x76,
+  0x16, 0x57, 0x2F, 0x22, 0xF2, 0x49, 0x15, 0x56, 0x35, 0xE5, 0xE5, 0xE5,
+  0xE5, 0xE5, 0xE5, 0xE5, 0x05, 0x38, 0x1F, 0xF4, 0x46, 0x55, 0x65, 0x65,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x60, 0x57,
+  0x8B, 0x5D, 0x4E, 0x26, 0x45, 0x25, 0x64, 0x26, 0xB9, 0x9C, 0x5E, 0x5C,
+  0x8A, 0xBB, 0x75, 0x15, 0x56, 0x1F, 0x03, 0xE4, 0xC7, 0x84, 0x25, 0x45,
+  0x45, 0x45, 0x45, 0x2F, 0xC2, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x72, 0x73, 0x64, 0x50, 0x05, 0x7A, 0x7A, 0x7A,
+  0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x6C, 0x4F,
+  0x91, 0xF1, 0x29, 0x15, 0x36, 0x35, 0x15, 0x75, 0x25, 0x75, 0x25, 0x75,
+  0x35, 0x55, 0x45, 0x55, 0x45, 0x55, 0x54, 0x54, 0x65, 0x35, 0x65, 0x35,
+  0x74, 0x34, 0x85, 0x24, 0x85, 0x15, 0x94, 0x14, 0xA9, 0xA9, 0xB7, 0xC7,
+  0xC7, 0xD5, 0x70, 0x06, 0x55, 0x65, 0x15, 0x55, 0x65, 0x15, 0x56, 0x45,
+  0x25, 0x56, 0x45, 0x34, 0x47, 0x45, 0x35, 0x37, 0x44, 0x45, 0x38, 0x25,
+  0x45, 0x33, 0x14, 0x25, 0x54, 0x24, 0x14, 0x25, 0x55, 0x14, 0x23, 0x24,
+  0x65, 0x14, 0x23, 0x24, 0x74, 0x13, 0x39, 0x74, 0x13, 0x38, 0x88, 0x38,
+  0x88, 0x47, 0x96, 0x57, 0x96, 0x56, 0xA6, 0x56, 0xB5, 0x56, 0x50, 0x06,
+  0x56, 0x25, 0x56, 0x26, 0x36, 0x45, 0x35, 0x65, 0x16, 0x65, 0x15, 0x89,
+  0xA8, 0xA7, 0xC5, 0xC7, 0xA9, 0x99, 0x85, 0x15, 0x66, 0x16, 0x55, 0x35,
+  0x46, 0x36, 0x35, 0x56, 0x16, 0x65, 0x10, 0x15, 0x85, 0x15, 0x75, 0x26,
+  0x65, 0x35, 0x65, 0x35, 0x55, 0x45, 0x55, 0x55, 0x45, 0x55, 0x44, 0x74,
+  0x35, 0x75, 0x24, 0x85, 0x24, 0x94, 0x15, 0x99, 0xA9, 0xB8, 0xB7, 0xD6,
+  0xD6, 0xD5, 0xE5, 0xE4, 0xE5, 0xB8, 0xB7, 0xC6, 0xD5, 0xB0, 0x1E, 0x2E,
+  0x2E, 0x2E, 0xA6, 0x96, 0x96, 0x96, 0xA6, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x97, 0x9F, 0xFF, 0xF4, 0x54, 0x45, 0x36, 0x36, 0x34, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x45, 0x26, 0x34, 0x56, 0x55, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x56, 0x36, 0x45,
+  0x54, 0x0F, 0xFF, 0xFF, 0xF9, 0x04, 0x55, 0x45, 0x46, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x56, 0x54, 0x36,
+  0x25, 0x44, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x36, 0x35,
+  0x45, 0x44, 0x50, 0x24, 0xA7, 0x5B, 0x44, 0x4B, 0x66, 0xA4, 0x20 };
+
+const GFXglyph FreeSansBold18pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,  10,    0,    1 },   // 0x20 ' '
+  {     0,   5,  25,  12,    4,  -24 },   // 0x21 '!'
+  {    11,  13,   9,  17,    2,  -25 },   // 0x22 '"'
+  {    25,  20,  24,  19,    0,  -23 },   // 0x23 '#'
+  {    70,  19,  29,  19,    0,  -25 },   // 0x24 '$'
+  {   119,  29,  25,  31,    1,  -24 },   // 0x25 '%'
+  {   182,  22,  25,  25,    2,  -24 },   // 0x26 '&'
+  {   227,   5,   9,   9,    2,  -25 },   // 0x27 '''
+  {   233,   9,  33,  12,    1,  -25 },   // 0x28 '('
+  {   266,   9,  33,  12,    1,  -25 },   // 0x29 ')'
+  {   300,  12,  11,  14,    0,  -25 },   // 0x2A '*'
+  {   316,  16,  16,  20,    2,  -15 },   // 0x2B '+'
+  {   332,   5,  11,   9,    2,   -4 },   // 0x2C ','
+  {   340,   9,   4,  12,    1,  -10 },   // 0x2D '-'
+  {   342,   5,   5,   9,    2,   -4 },   // 0x2E '.'
+  {   344,   9,  25,  10,    0,  -24 },   // 0x2F '/'
+  {   370,  17,  25,  19,    1,  -24 },   // 0x30 '0'
+  {   403,  10,  25,  19,    3,  -24 },   // 0x31 '1'
+  {   426,  17,  25,  19,    1,  -24 },   // 0x32 '2'
+  {   456,  17,  25,  19,    1,  -24 },   // 0x33 '3'
+  {   487,  16,  25,  19,    2,  -24 },   // 0x34 '4'
+  {   522,  17,  25,  19,    1,  -24 },   // 0x35 '5'
+  {   550,  18,  25,  19,    1,  -24 },   // 0x36 '6'
+  {   586,  17,  25,  19,    1,  -24 },   // 0x37 '7'
+  {   611,  17,  25,  19,    1,  -24 },   // 0x38 '8'
+  {   647,  17,  25,  19,    1,  -24 },   // 0x39 '9'
+  {   683,   5,  18,   9,    2,  -17 },   // 0x3A ':'
+  {   687,   5,  24,   9,    2,  -17 },   // 0x3B ';'
+  {   698,  18,  17,  20,    1,  -16 },   // 0x3C '<'
+  {   716,  17,  12,  20,    2,  -13 },   // 0x3D '='
+  {   724,  18,  17,  20,    1,  -16 },   // 0x3E '>'
+  {   743,  18,  26,  21,    2,  -25 },   // 0x3F '?'
+  {   772,  32,  31,  34,    1,  -25 },   // 0x40 '@'
+  {   857,  24,  26,  24,    0,  -25 },   // 0x41 'A'
+  {   902,  20,  26,  25,    3,  -25 },   // 0x42 'B'
+  {   944,  23,  26,  25,    1,  -25 },   // 0x43 'C'
+  {   986,  21,  26,  25,    3,  -25 },   // 0x44 'D'
+  {  1025,  19,  26,  23,    3,  -25 },   // 0x45 'E'
+  {  1055,  17,  26,  22,    3,  -25 },   // 0x46 'F'
+  {  1082,  24,  26,  27,    1,  -25 },   // 0x47 'G'
+  {  1127,  20,  26,  26,    3,  -25 },   // 0x48 'H'
+  {  1153,   5,  26,  11,    3,  -25 },   // 0x49 'I'
+  {  1158,  16,  26,  20,    1,  -25 },   // 0x4A 'J'
+  {  1185,  22,  26,  25,    3,  -25 },   // 0x4B 'K'
+  {  1233,  17,  26,  22,    3,  -25 },   // 0x4C 'L'
+  {  1258,  24,  26,  30,    3,  -25 },   // 0x4D 'M'
+  {  1316,  20,  26,  26,    3,  -25 },   // 0x4E 'N'
+  {  1352,  25,  26,  27,    1,  -25 },   // 0x4F 'O'
+  {  1397,  19,  26,  24,    3,  -25 },   // 0x50 'P'
+  {  1428,  25,  27,  27,    1,  -25 },   // 0x51 'Q'
+  {  1477,  21,  26,  25,    3,  -25 },   // 0x52 'R'
+  {  1525,  20,  26,  24,    2,  -25 },   // 0x53 'S'
+  {  1560,  19,  26,  23,    2,  -25 },   // 0x54 'T'
+  {  1586,  20,  26,  26,    3,  -25 },   // 0x55 'U'
+  {  1617,  22,  26,  23,    1,  -25 },   // 0x56 'V'
+  {  1665,  32,  26,  34,    1,  -25 },   // 0x57 'W'
+  {  1746,  22,  26,  24,    1,  -25 },   // 0x58 'X'
+  {  1791,  21,  26,  22,    1,  -25 },   // 0x59 'Y'
+  {  1833,  19,  26,  21,    1,  -25 },   // 0x5A 'Z'
+  {  1858,   8,  33,  12,    2,  -25 },   // 0x5B '['
+  {  1886,  10,  25,  10,    0,  -24 },   // 0x5C '\'
+  {  1911,   8,  33,  12,    1,  -25 },   // 0x5D ']'
+  {  1939,  16,  15,  20,    2,  -23 },   // 0x5E '^'
+  {  1963,  21,   3,  19,   -1,    5 },   // 0x5F '_'
+  {  1966,   7,   5,   9,    1,  -25 },   // 0x60 '`'
+  {  1971,  18,  19,  20,    1,  -18 },   // 0x61 'a'
+  {  2001,  18,  26,  22,    2,  -25 },   // 0x62 'b'
+  {  2038,  17,  19,  20,    1,  -18 },   // 0x63 'c'
+  {  2062,  19,  26,  22,    1,  -25 },   // 0x64 'd'
+  {  2098,  18,  19,  20,    1,  -18 },   // 0x65 'e'
+  {  2126,  10,  26,  12,    1,  -25 },   // 0x66 'f'
+  {  2153,  18,  26,  21,    1,  -18 },   // 0x67 'g'
+  {  2191,  17,  26,  21,    2,  -25 },   // 0x68 'h'
+  {  2221,   5,  26,  10,    2,  -25 },   // 0x69 'i'
+  {  2227,   7,  33,  10,    0,  -25 },   // 0x6A 'j'
+  {  2256,  17,  26,  20,    2,  -25 },   // 0x6B 'k'
+  {  2297,   5,  26,   9,    2,  -25 },   // 0x6C 'l'
+  {  2302,  27,  19,  31,    2,  -18 },   // 0x6D 'm'
+  {  2342,  17,  19,  21,    2,  -18 },   // 0x6E 'n'
+  {  2365,  19,  19,  21,    1,  -18 },   // 0x6F 'o'
+  {  2391,  18,  26,  22,    2,  -18 },   // 0x70 'p'
+  {  2428,  19,  26,  22,    1,  -18 },   // 0x71 'q'
+  {  2464,  11,  19,  14,    2,  -18 },   // 0x72 'r'
+  {  2483,  17,  19,  19,    1,  -18 },   // 0x73 's'
+  {  2506,   9,  23,  12,    1,  -22 },   // 0x74 't'
+  {  2528,  17,  19,  21,    2,  -18 },   // 0x75 'u'
+  {  2550,  19,  19,  19,    0,  -18 },   // 0x76 'v'
+  {  2583,  27,  19,  27,    0,  -18 },   // 0x77 'w'
+  {  2639,  18,  19,  19,    1,  -18 },   // 0x78 'x'
+  {  2671,  19,  26,  19,    0,  -18 },   // 0x79 'y'
+  {  2710,  16,  19,  18,    1,  -18 },   // 0x7A 'z'
+  {  2728,   9,  33,  14,    1,  -25 },   // 0x7B '{'
+  {  2761,   3,  33,  10,    4,  -25 },   // 0x7C '|'
+  {  2765,   9,  33,  14,    3,  -25 },   // 0x7D '}'
+  {  2799,  15,   6,  18,    1,  -10 } }; // 0x7E '~'
+
+const GFXfontPacked FreeSansBold18pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeSansBold18pt7bPackedRuns,
+    (GFXglyph *)FreeSansBold18pt7bPackedGlyphs,
+    0x20, 0x7E, 42 } };
+
+// Approx. 3479 bytes
@@ -0,0 +1,805 @@
+// FreeSansBold18pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSansBold18pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSansBold18pt7bSpanData[] PROGMEM = {
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x02,
+  0x00, 0x05, 0x08, 0x05, 0x02, 0x00, 0x05, 0x08, 0x05, 0x02, 0x00, 0x05,
+  0x08, 0x05, 0x02, 0x00, 0x05, 0x08, 0x05, 0x02, 0x00, 0x05, 0x08, 0x05,
+  0x02, 0x00, 0x05, 0x08, 0x05, 0x02, 0x01, 0x03, 0x09, 0x03, 0x02, 0x01,
+  0x03, 0x09, 0x03, 0x02, 0x01, 0x03, 0x09, 0x03, 0x02, 0x06, 0x04, 0x0E,
+  0x03, 0x02, 0x06, 0x04, 0x0D, 0x04, 0x02, 0x06, 0x04, 0x0D, 0x04, 0x02,
+  0x06, 0x03, 0x0D, 0x04, 0x02, 0x05, 0x04, 0x0D, 0x03, 0x01, 0x01, 0x13,
+  0x01, 0x01, 0x13, 0x01, 0x01, 0x13, 0x01, 0x01, 0x13, 0x02, 0x04, 0x04,
+  0x0C, 0x03, 0x02, 0x04, 0x04, 0x0C, 0x03, 0x02, 0x04, 0x04, 0x0B, 0x04,
+  0x02, 0x04, 0x04, 0x0B, 0x04, 0x02, 0x04, 0x03, 0x0B, 0x04, 0x01, 0x00,
+  0x12, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x02, 0x03,
+  0x03, 0x0A, 0x04, 0x02, 0x02, 0x04, 0x0A, 0x03, 0x02, 0x02, 0x04, 0x09,
+  0x04, 0x02, 0x02, 0x04, 0x09, 0x04, 0x02, 0x02, 0x03, 0x09, 0x04, 0x02,
+  0x02, 0x03, 0x09, 0x04, 0x01, 0x09, 0x02, 0x01, 0x06, 0x08, 0x01, 0x04,
+  0x0C, 0x01, 0x03, 0x0E, 0x01, 0x02, 0x10, 0x03, 0x01, 0x06, 0x09, 0x02,
+  0x0C, 0x06, 0x03, 0x01, 0x05, 0x09, 0x02, 0x0D, 0x06, 0x03, 0x01, 0x04,
+  0x09, 0x02, 0x0E, 0x05, 0x03, 0x01, 0x04, 0x09, 0x02, 0x0E, 0x05, 0x02,
+  0x01, 0x05, 0x09, 0x02, 0x02, 0x01, 0x07, 0x09, 0x02, 0x01, 0x02, 0x09,
+  0x01, 0x03, 0x0B, 0x01, 0x04, 0x0C, 0x01, 0x07, 0x0A, 0x01, 0x09, 0x09,
+  0x02, 0x09, 0x02, 0x0D, 0x06, 0x02, 0x09, 0x02, 0x0E, 0x05, 0x03, 0x00,
+  0x05, 0x09, 0x02, 0x0E, 0x05, 0x03, 0x00, 0x05, 0x09, 0x02, 0x0E, 0x05,
+  0x03, 0x00, 0x06, 0x09, 0x02, 0x0E, 0x05, 0x03, 0x01, 0x06, 0x09, 0x02,
+  0x0C, 0x06, 0x01, 0x01, 0x11, 0x01, 0x02, 0x0F, 0x01, 0x04, 0x0C, 0x01,
+  0x06, 0x08, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02, 0x02,
+  0x04, 0x04, 0x13, 0x03, 0x02, 0x02, 0x08, 0x13, 0x03, 0x02, 0x01, 0x0A,
+  0x12, 0x03, 0x02, 0x01, 0x0A, 0x12, 0x03, 0x03, 0x00, 0x04, 0x08, 0x04,
+  0x11, 0x03, 0x03, 0x00, 0x03, 0x09, 0x03, 0x11, 0x03, 0x03, 0x00, 0x03,
+  0x09, 0x03, 0x10, 0x03, 0x03, 0x00, 0x03, 0x09, 0x03, 0x0F, 0x04, 0x03,
+  0x00, 0x04, 0x08, 0x04, 0x0F, 0x03, 0x02, 0x01, 0x0A, 0x0E, 0x03, 0x02,
+  0x01, 0x0A, 0x0E, 0x03, 0x02, 0x02, 0x08, 0x0D, 0x03, 0x03, 0x04, 0x04,
+  0x0D, 0x03, 0x14, 0x05, 0x02, 0x0C, 0x03, 0x12, 0x09, 0x02, 0x0C, 0x03,
+  0x11, 0x0B, 0x02, 0x0B, 0x03, 0x11, 0x0B, 0x03, 0x0B, 0x03, 0x10, 0x04,
+  0x19, 0x04, 0x03, 0x0A, 0x03, 0x10, 0x03, 0x1A, 0x03, 0x03, 0x0A, 0x02,
+  0x10, 0x03, 0x1A, 0x03, 0x03, 0x09, 0x03, 0x10, 0x03, 0x1A, 0x03, 0x03,
+  0x09, 0x02, 0x10, 0x04, 0x19, 0x04, 0x02, 0x08, 0x03, 0x11, 0x0B, 0x02,
+  0x07, 0x03, 0x11, 0x0B, 0x02, 0x07, 0x03, 0x12, 0x09, 0x02, 0x06, 0x03,
+  0x14, 0x05, 0x01, 0x07, 0x05, 0x01, 0x05, 0x08, 0x01, 0x04, 0x0A, 0x01,
+  0x04, 0x0B, 0x02, 0x03, 0x05, 0x0B, 0x04, 0x02, 0x03, 0x05, 0x0B, 0x04,
+  0x02, 0x03, 0x05, 0x0B, 0x04, 0x02, 0x03, 0x06, 0x0B, 0x04, 0x02, 0x04,
+  0x05, 0x0A, 0x04, 0x01, 0x05, 0x08, 0x01, 0x06, 0x06, 0x01, 0x05, 0x06,
+  0x02, 0x03, 0x09, 0x10, 0x04, 0x02, 0x02, 0x0B, 0x10, 0x04, 0x03, 0x01,
+  0x06, 0x09, 0x05, 0x10, 0x04, 0x02, 0x00, 0x06, 0x0A, 0x09, 0x02, 0x00,
+  0x05, 0x0A, 0x09, 0x02, 0x00, 0x05, 0x0B, 0x08, 0x02, 0x00, 0x05, 0x0C,
+  0x06, 0x02, 0x00, 0x06, 0x0C, 0x06, 0x02, 0x01, 0x06, 0x0A, 0x09, 0x01,
+  0x01, 0x12, 0x01, 0x02, 0x12, 0x02, 0x03, 0x0A, 0x0F, 0x06, 0x02, 0x05,
+  0x07, 0x10, 0x06, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x04, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x03, 0x01, 0x03,
+  0x05, 0x02, 0x08, 0x03, 0x01, 0x01, 0x0A, 0x01, 0x02, 0x08, 0x01, 0x04,
+  0x04, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x02, 0x02, 0x03, 0x07, 0x03,
+  0x02, 0x03, 0x01, 0x08, 0x01, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x01,
+  0x00, 0x09, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x07, 0x02, 0x01, 0x06, 0x03, 0x01,
+  0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01,
+  0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02, 0x01,
+  0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x02, 0x01, 0x05, 0x07, 0x01,
+  0x03, 0x0B, 0x01, 0x02, 0x0D, 0x01, 0x02, 0x0D, 0x02, 0x01, 0x06, 0x0A,
+  0x06, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02,
+  0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05,
+  0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05,
+  0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00,
+  0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C,
+  0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02,
+  0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x06, 0x0A, 0x06, 0x01, 0x02, 0x0D,
+  0x01, 0x02, 0x0D, 0x01, 0x03, 0x0B, 0x01, 0x05, 0x07, 0x01, 0x07, 0x03,
+  0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x03, 0x07,
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x05, 0x05,
+  0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05,
+  0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05,
+  0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05,
+  0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05,
+  0x01, 0x05, 0x07, 0x01, 0x03, 0x0B, 0x01, 0x02, 0x0D, 0x01, 0x01, 0x0F,
+  0x02, 0x01, 0x06, 0x0A, 0x06, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x02, 0x00,
+  0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C,
+  0x05, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x06, 0x01, 0x0B, 0x05, 0x01, 0x0A,
+  0x06, 0x01, 0x09, 0x06, 0x01, 0x07, 0x07, 0x01, 0x06, 0x07, 0x01, 0x05,
+  0x06, 0x01, 0x04, 0x06, 0x01, 0x03, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02,
+  0x05, 0x01, 0x01, 0x10, 0x01, 0x01, 0x10, 0x01, 0x01, 0x10, 0x01, 0x01,
+  0x10, 0x01, 0x05, 0x06, 0x01, 0x03, 0x0A, 0x01, 0x02, 0x0C, 0x01, 0x01,
+  0x0E, 0x02, 0x00, 0x06, 0x0A, 0x06, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x02,
+  0x00, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x01, 0x0B, 0x05,
+  0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07,
+  0x01, 0x07, 0x08, 0x01, 0x0A, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x0C, 0x05,
+  0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00,
+  0x06, 0x0B, 0x06, 0x02, 0x01, 0x05, 0x0A, 0x06, 0x01, 0x01, 0x0F, 0x01,
+  0x02, 0x0D, 0x01, 0x03, 0x0B, 0x01, 0x05, 0x07, 0x01, 0x08, 0x06, 0x01,
+  0x08, 0x06, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x06, 0x08, 0x02,
+  0x05, 0x03, 0x09, 0x05, 0x02, 0x05, 0x03, 0x09, 0x05, 0x02, 0x04, 0x03,
+  0x09, 0x05, 0x02, 0x04, 0x03, 0x09, 0x05, 0x02, 0x03, 0x03, 0x09, 0x05,
+  0x02, 0x03, 0x02, 0x09, 0x05, 0x02, 0x02, 0x03, 0x09, 0x05, 0x02, 0x01,
+  0x03, 0x09, 0x05, 0x02, 0x01, 0x02, 0x09, 0x05, 0x02, 0x00, 0x03, 0x09,
+  0x05, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00,
+  0x10, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09,
+  0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x03, 0x0D, 0x01, 0x03,
+  0x0D, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x02, 0x01, 0x04, 0x07, 0x05,
+  0x01, 0x01, 0x0D, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x0F, 0x02, 0x01, 0x05,
+  0x0A, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01,
+  0x0C, 0x05, 0x01, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00,
+  0x05, 0x0B, 0x06, 0x02, 0x00, 0x06, 0x0A, 0x06, 0x01, 0x01, 0x0E, 0x01,
+  0x01, 0x0E, 0x01, 0x03, 0x0A, 0x01, 0x05, 0x06, 0x01, 0x06, 0x07, 0x01,
+  0x04, 0x0B, 0x01, 0x03, 0x0D, 0x01, 0x02, 0x0F, 0x02, 0x02, 0x05, 0x0B,
+  0x06, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x01, 0x01, 0x05, 0x01, 0x00, 0x05,
+  0x02, 0x00, 0x05, 0x08, 0x05, 0x02, 0x00, 0x05, 0x06, 0x09, 0x01, 0x00,
+  0x10, 0x01, 0x00, 0x11, 0x02, 0x00, 0x07, 0x0B, 0x06, 0x02, 0x00, 0x06,
+  0x0C, 0x06, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05,
+  0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x01,
+  0x04, 0x0D, 0x05, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x01, 0x06, 0x0B,
+  0x06, 0x01, 0x02, 0x0E, 0x01, 0x03, 0x0D, 0x01, 0x04, 0x0A, 0x01, 0x06,
+  0x06, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00,
+  0x11, 0x01, 0x0C, 0x04, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A,
+  0x04, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08,
+  0x04, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x05, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04,
+  0x05, 0x01, 0x04, 0x05, 0x01, 0x05, 0x06, 0x01, 0x04, 0x09, 0x01, 0x02,
+  0x0C, 0x01, 0x02, 0x0D, 0x02, 0x01, 0x05, 0x0A, 0x06, 0x02, 0x01, 0x04,
+  0x0B, 0x05, 0x02, 0x01, 0x04, 0x0C, 0x04, 0x02, 0x01, 0x04, 0x0C, 0x04,
+  0x02, 0x01, 0x04, 0x0B, 0x05, 0x02, 0x02, 0x04, 0x0A, 0x05, 0x01, 0x03,
+  0x0B, 0x01, 0x04, 0x09, 0x01, 0x02, 0x0D, 0x02, 0x01, 0x06, 0x0A, 0x06,
+  0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00,
+  0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C,
+  0x05, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x02, 0x01, 0x05, 0x0A, 0x06, 0x01,
+  0x01, 0x0F, 0x01, 0x02, 0x0D, 0x01, 0x03, 0x0B, 0x01, 0x05, 0x07, 0x01,
+  0x05, 0x06, 0x01, 0x03, 0x0A, 0x01, 0x02, 0x0C, 0x01, 0x01, 0x0E, 0x02,
+  0x01, 0x06, 0x0A, 0x06, 0x02, 0x00, 0x06, 0x0B, 0x05, 0x02, 0x00, 0x05,
+  0x0C, 0x04, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05,
+  0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00,
+  0x06, 0x0B, 0x06, 0x02, 0x01, 0x06, 0x0A, 0x07, 0x01, 0x01, 0x10, 0x01,
+  0x02, 0x0F, 0x02, 0x03, 0x08, 0x0C, 0x05, 0x02, 0x05, 0x05, 0x0C, 0x05,
+  0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x02,
+  0x01, 0x05, 0x0A, 0x05, 0x01, 0x01, 0x0E, 0x01, 0x02, 0x0C, 0x01, 0x03,
+  0x0A, 0x01, 0x05, 0x06, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x02, 0x01, 0x10, 0x02, 0x01, 0x0E, 0x04, 0x01, 0x0B, 0x07, 0x01,
+  0x08, 0x0A, 0x01, 0x06, 0x0A, 0x01, 0x03, 0x0A, 0x01, 0x00, 0x0A, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x04, 0x01, 0x00, 0x07, 0x01, 0x00, 0x0A, 0x01,
+  0x03, 0x0A, 0x01, 0x05, 0x0B, 0x01, 0x08, 0x0A, 0x01, 0x0B, 0x07, 0x01,
+  0x0D, 0x05, 0x01, 0x10, 0x02, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01,
+  0x00, 0x11, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11,
+  0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x02,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x07, 0x01, 0x00, 0x0A, 0x01, 0x02, 0x0A,
+  0x01, 0x05, 0x0A, 0x01, 0x08, 0x0A, 0x01, 0x0B, 0x07, 0x01, 0x0E, 0x04,
+  0x01, 0x0B, 0x07, 0x01, 0x08, 0x0A, 0x01, 0x05, 0x0A, 0x01, 0x02, 0x0B,
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x07, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02,
+  0x01, 0x05, 0x07, 0x01, 0x03, 0x0B, 0x01, 0x02, 0x0E, 0x01, 0x01, 0x0F,
+  0x02, 0x01, 0x06, 0x0A, 0x07, 0x02, 0x00, 0x06, 0x0C, 0x06, 0x02, 0x00,
+  0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D,
+  0x05, 0x01, 0x0C, 0x06, 0x01, 0x0B, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x09,
+  0x07, 0x01, 0x08, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x00, 0x00, 0x01, 0x06, 0x05,
+  0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05,
+  0x01, 0x0D, 0x09, 0x01, 0x0A, 0x0E, 0x01, 0x08, 0x12, 0x02, 0x07, 0x06,
+  0x15, 0x07, 0x02, 0x06, 0x05, 0x17, 0x06, 0x02, 0x05, 0x04, 0x19, 0x05,
+  0x02, 0x04, 0x04, 0x1A, 0x04, 0x04, 0x03, 0x04, 0x0E, 0x05, 0x16, 0x03,
+  0x1B, 0x04, 0x04, 0x02, 0x04, 0x0C, 0x08, 0x15, 0x04, 0x1C, 0x03, 0x03,
+  0x02, 0x03, 0x0B, 0x0D, 0x1C, 0x03, 0x04, 0x01, 0x04, 0x0A, 0x05, 0x13,
+  0x05, 0x1D, 0x03, 0x04, 0x01, 0x03, 0x0A, 0x03, 0x14, 0x04, 0x1D, 0x03,
+  0x04, 0x01, 0x03, 0x09, 0x04, 0x14, 0x04, 0x1D, 0x03, 0x04, 0x00, 0x03,
+  0x09, 0x03, 0x14, 0x03, 0x1D, 0x03, 0x04, 0x00, 0x03, 0x09, 0x03, 0x14,
+  0x03, 0x1D, 0x03, 0x04, 0x00, 0x03, 0x08, 0x03, 0x14, 0x03, 0x1D, 0x03,
+  0x04, 0x00, 0x03, 0x08, 0x03, 0x13, 0x04, 0x1C, 0x04, 0x04, 0x00, 0x03,
+  0x08, 0x03, 0x13, 0x03, 0x1C, 0x03, 0x04, 0x00, 0x03, 0x08, 0x03, 0x12,
+  0x04, 0x1B, 0x04, 0x04, 0x00, 0x03, 0x08, 0x04, 0x12, 0x04, 0x1A, 0x04,
+  0x04, 0x00, 0x04, 0x08, 0x04, 0x10, 0x06, 0x19, 0x05, 0x02, 0x01, 0x03,
+  0x09, 0x14, 0x03, 0x01, 0x04, 0x0A, 0x08, 0x14, 0x08, 0x03, 0x02, 0x04,
+  0x0B, 0x05, 0x15, 0x05, 0x01, 0x02, 0x05, 0x01, 0x03, 0x05, 0x02, 0x04,
+  0x06, 0x17, 0x01, 0x02, 0x05, 0x07, 0x14, 0x04, 0x01, 0x06, 0x12, 0x01,
+  0x08, 0x10, 0x01, 0x0B, 0x0A, 0x01, 0x09, 0x06, 0x01, 0x09, 0x07, 0x01,
+  0x09, 0x07, 0x01, 0x08, 0x08, 0x01, 0x08, 0x09, 0x01, 0x07, 0x0A, 0x01,
+  0x07, 0x0A, 0x02, 0x07, 0x05, 0x0D, 0x05, 0x02, 0x06, 0x05, 0x0D, 0x05,
+  0x02, 0x06, 0x05, 0x0D, 0x05, 0x02, 0x06, 0x05, 0x0E, 0x05, 0x02, 0x05,
+  0x05, 0x0E, 0x05, 0x02, 0x05, 0x05, 0x0E, 0x05, 0x02, 0x05, 0x05, 0x0F,
+  0x05, 0x02, 0x04, 0x05, 0x0F, 0x05, 0x02, 0x04, 0x05, 0x0F, 0x05, 0x01,
+  0x04, 0x11, 0x01, 0x03, 0x12, 0x01, 0x03, 0x13, 0x01, 0x03, 0x13, 0x02,
+  0x02, 0x05, 0x11, 0x05, 0x02, 0x02, 0x05, 0x11, 0x06, 0x02, 0x02, 0x05,
+  0x12, 0x05, 0x02, 0x01, 0x05, 0x12, 0x05, 0x02, 0x01, 0x05, 0x12, 0x06,
+  0x02, 0x01, 0x05, 0x13, 0x05, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x10, 0x01,
+  0x00, 0x11, 0x01, 0x00, 0x12, 0x02, 0x00, 0x05, 0x0D, 0x06, 0x02, 0x00,
+  0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E,
+  0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02,
+  0x00, 0x05, 0x0D, 0x05, 0x01, 0x00, 0x11, 0x01, 0x00, 0x10, 0x01, 0x00,
+  0x11, 0x01, 0x00, 0x12, 0x02, 0x00, 0x05, 0x0D, 0x06, 0x02, 0x00, 0x05,
+  0x0F, 0x04, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05,
+  0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00,
+  0x05, 0x0E, 0x05, 0x01, 0x00, 0x13, 0x01, 0x00, 0x12, 0x01, 0x00, 0x11,
+  0x01, 0x00, 0x0F, 0x01, 0x08, 0x08, 0x01, 0x06, 0x0C, 0x01, 0x04, 0x10,
+  0x01, 0x03, 0x12, 0x02, 0x02, 0x07, 0x0F, 0x06, 0x02, 0x02, 0x06, 0x10,
+  0x06, 0x02, 0x01, 0x06, 0x11, 0x05, 0x02, 0x01, 0x05, 0x12, 0x05, 0x02,
+  0x01, 0x05, 0x12, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x02, 0x01, 0x05, 0x12, 0x05, 0x02, 0x01, 0x05,
+  0x12, 0x05, 0x02, 0x01, 0x06, 0x11, 0x06, 0x02, 0x02, 0x06, 0x10, 0x06,
+  0x02, 0x02, 0x07, 0x0F, 0x07, 0x01, 0x03, 0x12, 0x01, 0x04, 0x10, 0x01,
+  0x06, 0x0C, 0x01, 0x08, 0x08, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x10, 0x01,
+  0x00, 0x11, 0x01, 0x00, 0x12, 0x02, 0x00, 0x05, 0x0C, 0x07, 0x02, 0x00,
+  0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F,
+  0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x10, 0x05, 0x02,
+  0x00, 0x05, 0x10, 0x05, 0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00, 0x05,
+  0x10, 0x05, 0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00, 0x05, 0x10, 0x05,
+  0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00,
+  0x05, 0x0F, 0x06, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F,
+  0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x07, 0x01,
+  0x00, 0x12, 0x01, 0x00, 0x11, 0x01, 0x00, 0x10, 0x01, 0x00, 0x0E, 0x01,
+  0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x01,
+  0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x13, 0x01, 0x00, 0x13, 0x01,
+  0x00, 0x13, 0x01, 0x00, 0x13, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01,
+  0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01,
+  0x00, 0x10, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x09, 0x08, 0x01, 0x06, 0x0D, 0x01, 0x05, 0x10, 0x01, 0x04, 0x12, 0x02,
+  0x03, 0x07, 0x10, 0x07, 0x02, 0x02, 0x06, 0x11, 0x06, 0x02, 0x01, 0x06,
+  0x12, 0x06, 0x02, 0x01, 0x05, 0x13, 0x05, 0x01, 0x01, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x0A,
+  0x02, 0x00, 0x05, 0x0E, 0x0A, 0x02, 0x00, 0x05, 0x0E, 0x0A, 0x02, 0x00,
+  0x05, 0x0E, 0x0A, 0x02, 0x00, 0x06, 0x14, 0x04, 0x02, 0x01, 0x05, 0x13,
+  0x05, 0x02, 0x01, 0x05, 0x13, 0x05, 0x02, 0x01, 0x06, 0x12, 0x06, 0x02,
+  0x02, 0x06, 0x11, 0x07, 0x02, 0x03, 0x07, 0x0F, 0x09, 0x01, 0x04, 0x14,
+  0x02, 0x05, 0x0E, 0x15, 0x03, 0x02, 0x06, 0x0C, 0x15, 0x03, 0x02, 0x08,
+  0x08, 0x15, 0x03, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F,
+  0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02,
+  0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05,
+  0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05,
+  0x02, 0x00, 0x05, 0x0F, 0x05, 0x01, 0x00, 0x14, 0x01, 0x00, 0x14, 0x01,
+  0x00, 0x14, 0x01, 0x00, 0x14, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00,
+  0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F,
+  0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02,
+  0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05,
+  0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05,
+  0x02, 0x00, 0x05, 0x0F, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x02,
+  0x00, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x05,
+  0x0B, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x05,
+  0x02, 0x00, 0x06, 0x0A, 0x06, 0x01, 0x01, 0x0E, 0x01, 0x02, 0x0C, 0x01,
+  0x03, 0x0A, 0x01, 0x05, 0x06, 0x02, 0x00, 0x05, 0x0F, 0x06, 0x02, 0x00,
+  0x05, 0x0E, 0x06, 0x02, 0x00, 0x05, 0x0D, 0x06, 0x02, 0x00, 0x05, 0x0C,
+  0x06, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x02, 0x00, 0x05, 0x0A, 0x06, 0x02,
+  0x00, 0x05, 0x09, 0x06, 0x02, 0x00, 0x05, 0x08, 0x06, 0x02, 0x00, 0x05,
+  0x08, 0x05, 0x02, 0x00, 0x05, 0x07, 0x06, 0x02, 0x00, 0x05, 0x06, 0x06,
+  0x01, 0x00, 0x0B, 0x01, 0x00, 0x0C, 0x01, 0x00, 0x0D, 0x01, 0x00, 0x0D,
+  0x02, 0x00, 0x07, 0x08, 0x06, 0x02, 0x00, 0x06, 0x09, 0x06, 0x02, 0x00,
+  0x05, 0x0A, 0x06, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x02, 0x00, 0x05, 0x0B,
+  0x06, 0x02, 0x00, 0x05, 0x0C, 0x06, 0x02, 0x00, 0x05, 0x0D, 0x06, 0x02,
+  0x00, 0x05, 0x0D, 0x07, 0x02, 0x00, 0x05, 0x0E, 0x06, 0x02, 0x00, 0x05,
+  0x0F, 0x06, 0x02, 0x00, 0x05, 0x10, 0x06, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00,
+  0x11, 0x02, 0x00, 0x08, 0x10, 0x08, 0x02, 0x00, 0x08, 0x10, 0x08, 0x02,
+  0x00, 0x08, 0x10, 0x08, 0x02, 0x00, 0x08, 0x0F, 0x09, 0x02, 0x00, 0x09,
+  0x0F, 0x09, 0x02, 0x00, 0x09, 0x0F, 0x09, 0x02, 0x00, 0x09, 0x0F, 0x09,
+  0x02, 0x00, 0x09, 0x0F, 0x09, 0x04, 0x00, 0x05, 0x06, 0x04, 0x0E, 0x04,
+  0x13, 0x05, 0x04, 0x00, 0x05, 0x06, 0x04, 0x0E, 0x04, 0x13, 0x05, 0x04,
+  0x00, 0x05, 0x06, 0x04, 0x0E, 0x04, 0x13, 0x05, 0x04, 0x00, 0x05, 0x06,
+  0x04, 0x0E, 0x04, 0x13, 0x05, 0x04, 0x00, 0x05, 0x07, 0x03, 0x0D, 0x05,
+  0x13, 0x05, 0x04, 0x00, 0x05, 0x07, 0x04, 0x0D, 0x04, 0x13, 0x05, 0x04,
+  0x00, 0x05, 0x07, 0x04, 0x0D, 0x04, 0x13, 0x05, 0x04, 0x00, 0x05, 0x07,
+  0x04, 0x0D, 0x04, 0x13, 0x05, 0x04, 0x00, 0x05, 0x07, 0x04, 0x0D, 0x04,
+  0x13, 0x05, 0x03, 0x00, 0x05, 0x08, 0x08, 0x13, 0x05, 0x03, 0x00, 0x05,
+  0x08, 0x08, 0x13, 0x05, 0x03, 0x00, 0x05, 0x08, 0x08, 0x13, 0x05, 0x03,
+  0x00, 0x05, 0x08, 0x08, 0x13, 0x05, 0x03, 0x00, 0x05, 0x09, 0x07, 0x13,
+  0x05, 0x03, 0x00, 0x05, 0x09, 0x06, 0x13, 0x05, 0x03, 0x00, 0x05, 0x09,
+  0x06, 0x13, 0x05, 0x03, 0x00, 0x05, 0x09, 0x06, 0x13, 0x05, 0x03, 0x00,
+  0x05, 0x0A, 0x05, 0x13, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00,
+  0x06, 0x0F, 0x05, 0x02, 0x00, 0x07, 0x0F, 0x05, 0x02, 0x00, 0x07, 0x0F,
+  0x05, 0x02, 0x00, 0x08, 0x0F, 0x05, 0x02, 0x00, 0x08, 0x0F, 0x05, 0x02,
+  0x00, 0x09, 0x0F, 0x05, 0x02, 0x00, 0x09, 0x0F, 0x05, 0x02, 0x00, 0x0A,
+  0x0F, 0x05, 0x03, 0x00, 0x05, 0x06, 0x04, 0x0F, 0x05, 0x03, 0x00, 0x05,
+  0x06, 0x05, 0x0F, 0x05, 0x03, 0x00, 0x05, 0x07, 0x05, 0x0F, 0x05, 0x03,
+  0x00, 0x05, 0x07, 0x05, 0x0F, 0x05, 0x03, 0x00, 0x05, 0x08, 0x05, 0x0F,
+  0x05, 0x03, 0x00, 0x05, 0x09, 0x04, 0x0F, 0x05, 0x03, 0x00, 0x05, 0x09,
+  0x05, 0x0F, 0x05, 0x03, 0x00, 0x05, 0x0A, 0x04, 0x0F, 0x05, 0x02, 0x00,
+  0x05, 0x0A, 0x0A, 0x02, 0x00, 0x05, 0x0B, 0x09, 0x02, 0x00, 0x05, 0x0B,
+  0x09, 0x02, 0x00, 0x05, 0x0C, 0x08, 0x02, 0x00, 0x05, 0x0C, 0x08, 0x02,
+  0x00, 0x05, 0x0D, 0x07, 0x02, 0x00, 0x05, 0x0E, 0x06, 0x02, 0x00, 0x05,
+  0x0E, 0x06, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x01, 0x09, 0x07, 0x01, 0x06,
+  0x0D, 0x01, 0x05, 0x0F, 0x01, 0x03, 0x12, 0x02, 0x03, 0x07, 0x0F, 0x07,
+  0x02, 0x02, 0x06, 0x11, 0x06, 0x02, 0x01, 0x06, 0x12, 0x06, 0x02, 0x01,
+  0x05, 0x13, 0x05, 0x02, 0x01, 0x05, 0x13, 0x05, 0x02, 0x00, 0x05, 0x14,
+  0x05, 0x02, 0x00, 0x05, 0x14, 0x05, 0x02, 0x00, 0x05, 0x14, 0x05, 0x02,
+  0x00, 0x05, 0x14, 0x05, 0x02, 0x00, 0x05, 0x14, 0x05, 0x02, 0x00, 0x05,
+  0x14, 0x05, 0x02, 0x00, 0x05, 0x14, 0x05, 0x02, 0x00, 0x05, 0x14, 0x05,
+  0x02, 0x01, 0x05, 0x13, 0x05, 0x02, 0x01, 0x05, 0x13, 0x05, 0x02, 0x01,
+  0x06, 0x12, 0x06, 0x02, 0x02, 0x06, 0x11, 0x06, 0x02, 0x03, 0x07, 0x0F,
+  0x07, 0x01, 0x03, 0x12, 0x01, 0x05, 0x0F, 0x01, 0x06, 0x0D, 0x01, 0x09,
+  0x07, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x10, 0x01, 0x00, 0x11, 0x01, 0x00,
+  0x12, 0x02, 0x00, 0x05, 0x0C, 0x07, 0x02, 0x00, 0x05, 0x0D, 0x06, 0x02,
+  0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05,
+  0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x06,
+  0x02, 0x00, 0x05, 0x0C, 0x06, 0x01, 0x00, 0x12, 0x01, 0x00, 0x11, 0x01,
+  0x00, 0x10, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x09, 0x07, 0x01, 0x06, 0x0D, 0x01, 0x05, 0x0F, 0x01, 0x03, 0x12, 0x02,
+  0x03, 0x07, 0x0F, 0x07, 0x02, 0x02, 0x06, 0x11, 0x06, 0x02, 0x01, 0x06,
+  0x12, 0x06, 0x02, 0x01, 0x05, 0x13, 0x05, 0x02, 0x01, 0x05, 0x13, 0x05,
+  0x02, 0x00, 0x05, 0x14, 0x05, 0x02, 0x00, 0x05, 0x14, 0x05, 0x02, 0x00,
+  0x05, 0x14, 0x05, 0x02, 0x00, 0x05, 0x14, 0x05, 0x02, 0x00, 0x05, 0x14,
+  0x05, 0x02, 0x00, 0x05, 0x14, 0x05, 0x02, 0x00, 0x05, 0x14, 0x05, 0x03,
+  0x00, 0x05, 0x0F, 0x01, 0x14, 0x05, 0x03, 0x01, 0x05, 0x0E, 0x03, 0x13,
+  0x05, 0x02, 0x01, 0x05, 0x0D, 0x0B, 0x02, 0x01, 0x06, 0x0E, 0x0A, 0x02,
+  0x02, 0x06, 0x0F, 0x08, 0x02, 0x03, 0x07, 0x0F, 0x08, 0x01, 0x03, 0x14,
+  0x01, 0x05, 0x13, 0x02, 0x06, 0x0D, 0x14, 0x05, 0x02, 0x09, 0x08, 0x15,
+  0x03, 0x01, 0x16, 0x01, 0x01, 0x00, 0x10, 0x01, 0x00, 0x12, 0x01, 0x00,
+  0x13, 0x01, 0x00, 0x13, 0x02, 0x00, 0x05, 0x0E, 0x06, 0x02, 0x00, 0x05,
+  0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05,
+  0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x04, 0x02, 0x00,
+  0x05, 0x0E, 0x05, 0x01, 0x00, 0x12, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11,
+  0x01, 0x00, 0x12, 0x02, 0x00, 0x05, 0x0D, 0x06, 0x02, 0x00, 0x05, 0x0E,
+  0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02,
+  0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05,
+  0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05,
+  0x02, 0x00, 0x05, 0x0E, 0x06, 0x02, 0x00, 0x05, 0x0F, 0x06, 0x01, 0x05,
+  0x08, 0x01, 0x03, 0x0D, 0x01, 0x02, 0x0F, 0x01, 0x01, 0x11, 0x02, 0x01,
+  0x06, 0x0C, 0x06, 0x02, 0x00, 0x06, 0x0D, 0x06, 0x02, 0x00, 0x05, 0x0E,
+  0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x08, 0x01, 0x01, 0x0D, 0x01, 0x02, 0x0F, 0x01, 0x03, 0x0F,
+  0x01, 0x06, 0x0D, 0x01, 0x0B, 0x09, 0x01, 0x0E, 0x06, 0x01, 0x0F, 0x05,
+  0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00,
+  0x06, 0x0E, 0x06, 0x02, 0x00, 0x07, 0x0D, 0x06, 0x01, 0x01, 0x12, 0x01,
+  0x02, 0x10, 0x01, 0x03, 0x0D, 0x01, 0x06, 0x08, 0x01, 0x00, 0x13, 0x01,
+  0x00, 0x13, 0x01, 0x00, 0x13, 0x01, 0x00, 0x13, 0x01, 0x07, 0x05, 0x01,
+  0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01,
+  0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01,
+  0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01,
+  0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01,
+  0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01,
+  0x07, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05,
+  0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00,
+  0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F,
+  0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02,
+  0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05,
+  0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05,
+  0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00,
+  0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F,
+  0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x02,
+  0x01, 0x06, 0x0D, 0x06, 0x01, 0x02, 0x10, 0x01, 0x02, 0x10, 0x01, 0x04,
+  0x0C, 0x01, 0x06, 0x08, 0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00, 0x05,
+  0x10, 0x05, 0x02, 0x01, 0x05, 0x0F, 0x06, 0x02, 0x01, 0x05, 0x0F, 0x05,
+  0x02, 0x01, 0x05, 0x0F, 0x05, 0x02, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x02,
+  0x05, 0x0E, 0x05, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x03, 0x04, 0x0E,
+  0x05, 0x02, 0x03, 0x05, 0x0D, 0x05, 0x02, 0x03, 0x05, 0x0D, 0x05, 0x02,
+  0x04, 0x04, 0x0D, 0x05, 0x02, 0x04, 0x05, 0x0D, 0x04, 0x02, 0x04, 0x05,
+  0x0C, 0x05, 0x02, 0x04, 0x05, 0x0C, 0x05, 0x02, 0x05, 0x04, 0x0C, 0x04,
+  0x02, 0x05, 0x05, 0x0C, 0x04, 0x02, 0x05, 0x05, 0x0B, 0x05, 0x02, 0x06,
+  0x04, 0x0B, 0x04, 0x01, 0x06, 0x09, 0x01, 0x06, 0x09, 0x01, 0x07, 0x07,
+  0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05,
+  0x03, 0x00, 0x05, 0x0D, 0x05, 0x1A, 0x06, 0x03, 0x00, 0x05, 0x0D, 0x06,
+  0x1A, 0x05, 0x03, 0x00, 0x06, 0x0D, 0x06, 0x1A, 0x05, 0x03, 0x01, 0x05,
+  0x0C, 0x07, 0x1A, 0x05, 0x03, 0x01, 0x05, 0x0C, 0x07, 0x19, 0x06, 0x03,
+  0x01, 0x05, 0x0C, 0x07, 0x19, 0x05, 0x03, 0x01, 0x05, 0x0C, 0x08, 0x19,
+  0x05, 0x03, 0x02, 0x05, 0x0C, 0x08, 0x19, 0x05, 0x04, 0x02, 0x05, 0x0B,
+  0x04, 0x10, 0x04, 0x19, 0x04, 0x04, 0x02, 0x05, 0x0B, 0x04, 0x11, 0x03,
+  0x18, 0x05, 0x04, 0x03, 0x04, 0x0B, 0x04, 0x11, 0x03, 0x18, 0x05, 0x04,
+  0x03, 0x04, 0x0B, 0x04, 0x11, 0x04, 0x18, 0x05, 0x04, 0x03, 0x05, 0x0B,
+  0x04, 0x11, 0x04, 0x18, 0x04, 0x04, 0x03, 0x05, 0x0A, 0x04, 0x11, 0x04,
+  0x18, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x12, 0x03, 0x17, 0x05, 0x04,
+  0x04, 0x04, 0x0A, 0x04, 0x12, 0x04, 0x17, 0x05, 0x04, 0x04, 0x04, 0x0A,
+  0x04, 0x12, 0x04, 0x17, 0x04, 0x04, 0x04, 0x05, 0x0A, 0x04, 0x12, 0x04,
+  0x17, 0x04, 0x03, 0x05, 0x08, 0x12, 0x04, 0x17, 0x04, 0x02, 0x05, 0x08,
+  0x13, 0x08, 0x02, 0x05, 0x08, 0x13, 0x07, 0x02, 0x06, 0x07, 0x13, 0x07,
+  0x02, 0x06, 0x07, 0x13, 0x07, 0x02, 0x06, 0x06, 0x14, 0x05, 0x02, 0x06,
+  0x06, 0x14, 0x05, 0x02, 0x07, 0x05, 0x14, 0x05, 0x02, 0x00, 0x07, 0x0F,
+  0x06, 0x02, 0x01, 0x06, 0x0F, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x02,
+  0x02, 0x06, 0x0E, 0x05, 0x02, 0x03, 0x06, 0x0D, 0x06, 0x02, 0x03, 0x06,
+  0x0C, 0x06, 0x02, 0x04, 0x06, 0x0C, 0x06, 0x02, 0x05, 0x05, 0x0B, 0x06,
+  0x01, 0x05, 0x0B, 0x01, 0x06, 0x0A, 0x01, 0x06, 0x09, 0x01, 0x07, 0x07,
+  0x01, 0x08, 0x06, 0x01, 0x07, 0x07, 0x01, 0x07, 0x08, 0x01, 0x06, 0x09,
+  0x01, 0x06, 0x0A, 0x02, 0x05, 0x05, 0x0B, 0x06, 0x02, 0x04, 0x06, 0x0C,
+  0x05, 0x02, 0x04, 0x05, 0x0C, 0x06, 0x02, 0x03, 0x06, 0x0D, 0x05, 0x02,
+  0x03, 0x05, 0x0D, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x02, 0x01, 0x06,
+  0x0E, 0x06, 0x02, 0x01, 0x06, 0x0F, 0x06, 0x02, 0x00, 0x06, 0x0F, 0x07,
+  0x02, 0x00, 0x06, 0x0F, 0x06, 0x02, 0x00, 0x06, 0x0F, 0x05, 0x02, 0x01,
+  0x05, 0x0E, 0x06, 0x02, 0x01, 0x06, 0x0E, 0x05, 0x02, 0x02, 0x05, 0x0D,
+  0x06, 0x02, 0x02, 0x06, 0x0D, 0x05, 0x02, 0x03, 0x05, 0x0D, 0x05, 0x02,
+  0x03, 0x06, 0x0C, 0x05, 0x02, 0x04, 0x05, 0x0C, 0x05, 0x02, 0x04, 0x06,
+  0x0B, 0x05, 0x02, 0x05, 0x05, 0x0B, 0x05, 0x01, 0x05, 0x0A, 0x01, 0x06,
+  0x09, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x08, 0x05, 0x01, 0x08,
+  0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08,
+  0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08,
+  0x05, 0x01, 0x08, 0x05, 0x01, 0x00, 0x13, 0x01, 0x00, 0x13, 0x01, 0x00,
+  0x13, 0x01, 0x00, 0x13, 0x01, 0x0D, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x0B,
+  0x06, 0x01, 0x0B, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x06, 0x01, 0x08,
+  0x07, 0x01, 0x08, 0x06, 0x01, 0x07, 0x06, 0x01, 0x06, 0x06, 0x01, 0x05,
+  0x07, 0x01, 0x05, 0x06, 0x01, 0x04, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03,
+  0x06, 0x01, 0x02, 0x06, 0x01, 0x01, 0x06, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x13, 0x01, 0x00, 0x13, 0x01, 0x00, 0x13, 0x01, 0x00, 0x13, 0x01, 0x00,
+  0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00,
+  0x08, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
+  0x03, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x03, 0x01, 0x04,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x03, 0x01, 0x05,
+  0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x03, 0x01, 0x06, 0x02, 0x01, 0x06,
+  0x02, 0x01, 0x06, 0x03, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07,
+  0x03, 0x01, 0x07, 0x03, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00,
+  0x08, 0x01, 0x00, 0x08, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x00, 0x08, 0x01, 0x00,
+  0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x06, 0x05, 0x01, 0x05,
+  0x06, 0x01, 0x05, 0x06, 0x01, 0x04, 0x08, 0x01, 0x04, 0x08, 0x02, 0x04,
+  0x04, 0x09, 0x04, 0x02, 0x03, 0x04, 0x09, 0x04, 0x02, 0x03, 0x04, 0x09,
+  0x04, 0x02, 0x02, 0x04, 0x0A, 0x04, 0x02, 0x02, 0x04, 0x0A, 0x04, 0x02,
+  0x02, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x04,
+  0x0B, 0x04, 0x02, 0x01, 0x03, 0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x04,
+  0x01, 0x00, 0x15, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15, 0x01, 0x00, 0x05,
+  0x01, 0x01, 0x04, 0x01, 0x02, 0x04, 0x01, 0x03, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x05, 0x08, 0x01, 0x03, 0x0C, 0x01, 0x02, 0x0E, 0x01, 0x01, 0x10,
+  0x02, 0x01, 0x05, 0x0B, 0x06, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x01, 0x0C,
+  0x05, 0x01, 0x09, 0x08, 0x01, 0x04, 0x0D, 0x01, 0x02, 0x0F, 0x02, 0x01,
+  0x08, 0x0C, 0x05, 0x02, 0x00, 0x06, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C,
+  0x05, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x02, 0x00, 0x06, 0x0A, 0x07, 0x01,
+  0x00, 0x11, 0x01, 0x01, 0x10, 0x02, 0x02, 0x09, 0x0C, 0x06, 0x02, 0x03,
+  0x06, 0x0C, 0x06, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x02, 0x00, 0x05, 0x07, 0x06, 0x02, 0x00, 0x05, 0x06, 0x08, 0x01, 0x00,
+  0x10, 0x01, 0x00, 0x10, 0x02, 0x00, 0x07, 0x0B, 0x06, 0x02, 0x00, 0x06,
+  0x0C, 0x05, 0x02, 0x00, 0x06, 0x0C, 0x06, 0x02, 0x00, 0x05, 0x0D, 0x05,
+  0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00,
+  0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x06, 0x0C,
+  0x06, 0x02, 0x00, 0x06, 0x0C, 0x05, 0x02, 0x00, 0x07, 0x0B, 0x06, 0x01,
+  0x00, 0x10, 0x01, 0x00, 0x10, 0x02, 0x00, 0x05, 0x06, 0x08, 0x02, 0x00,
+  0x05, 0x07, 0x06, 0x01, 0x06, 0x06, 0x01, 0x04, 0x0A, 0x01, 0x02, 0x0D,
+  0x01, 0x02, 0x0E, 0x02, 0x01, 0x06, 0x0B, 0x06, 0x02, 0x01, 0x05, 0x0C,
+  0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x02, 0x00, 0x05,
+  0x0C, 0x05, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x01, 0x06, 0x0B, 0x06,
+  0x01, 0x02, 0x0E, 0x01, 0x02, 0x0D, 0x01, 0x03, 0x0B, 0x01, 0x06, 0x06,
+  0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05,
+  0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x02, 0x06, 0x05,
+  0x0E, 0x05, 0x02, 0x04, 0x09, 0x0E, 0x05, 0x01, 0x03, 0x10, 0x01, 0x02,
+  0x11, 0x02, 0x01, 0x07, 0x0B, 0x08, 0x02, 0x01, 0x05, 0x0D, 0x06, 0x02,
+  0x00, 0x06, 0x0D, 0x06, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05,
+  0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05,
+  0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x06, 0x0D, 0x06, 0x02, 0x01,
+  0x05, 0x0D, 0x06, 0x02, 0x01, 0x06, 0x0B, 0x08, 0x01, 0x02, 0x11, 0x01,
+  0x03, 0x10, 0x02, 0x04, 0x09, 0x0E, 0x05, 0x02, 0x05, 0x06, 0x0E, 0x05,
+  0x01, 0x05, 0x06, 0x01, 0x03, 0x0A, 0x01, 0x02, 0x0D, 0x01, 0x02, 0x0D,
+  0x02, 0x01, 0x06, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0C, 0x04, 0x02, 0x00,
+  0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x04, 0x01, 0x00, 0x11, 0x01,
+  0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x02,
+  0x00, 0x06, 0x0C, 0x05, 0x02, 0x01, 0x06, 0x0B, 0x06, 0x01, 0x01, 0x0F,
+  0x01, 0x02, 0x0D, 0x01, 0x03, 0x0B, 0x01, 0x05, 0x07, 0x01, 0x04, 0x06,
+  0x01, 0x03, 0x07, 0x01, 0x02, 0x08, 0x01, 0x02, 0x08, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09,
+  0x01, 0x00, 0x09, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x05, 0x02, 0x05, 0x05, 0x0D, 0x05, 0x02, 0x04, 0x08, 0x0D,
+  0x05, 0x01, 0x02, 0x10, 0x01, 0x02, 0x10, 0x02, 0x01, 0x06, 0x0B, 0x07,
+  0x02, 0x01, 0x05, 0x0C, 0x06, 0x02, 0x00, 0x06, 0x0C, 0x06, 0x02, 0x00,
+  0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D,
+  0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02,
+  0x00, 0x06, 0x0C, 0x06, 0x02, 0x01, 0x05, 0x0C, 0x06, 0x02, 0x01, 0x06,
+  0x0B, 0x07, 0x01, 0x01, 0x11, 0x01, 0x02, 0x10, 0x02, 0x03, 0x09, 0x0D,
+  0x05, 0x02, 0x05, 0x05, 0x0D, 0x05, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x05,
+  0x02, 0x00, 0x06, 0x0C, 0x06, 0x02, 0x01, 0x06, 0x0B, 0x06, 0x01, 0x01,
+  0x0F, 0x01, 0x02, 0x0D, 0x01, 0x05, 0x08, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x02, 0x00, 0x05, 0x08, 0x05, 0x02, 0x00, 0x05,
+  0x06, 0x09, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x02, 0x00, 0x07, 0x0B,
+  0x06, 0x02, 0x00, 0x06, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02,
+  0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05,
+  0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05,
+  0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00,
+  0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C,
+  0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x00,
+  0x00, 0x00, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x06, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x02, 0x00,
+  0x05, 0x0A, 0x05, 0x02, 0x00, 0x05, 0x09, 0x06, 0x02, 0x00, 0x05, 0x08,
+  0x06, 0x02, 0x00, 0x05, 0x07, 0x06, 0x02, 0x00, 0x05, 0x07, 0x05, 0x02,
+  0x00, 0x05, 0x06, 0x05, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00,
+  0x0C, 0x01, 0x00, 0x0C, 0x02, 0x00, 0x06, 0x07, 0x06, 0x02, 0x00, 0x05,
+  0x08, 0x05, 0x02, 0x00, 0x05, 0x09, 0x05, 0x02, 0x00, 0x05, 0x09, 0x06,
+  0x02, 0x00, 0x05, 0x0A, 0x05, 0x02, 0x00, 0x05, 0x0A, 0x06, 0x02, 0x00,
+  0x05, 0x0B, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x03, 0x00, 0x05, 0x08, 0x05, 0x12, 0x06, 0x03, 0x00, 0x05,
+  0x06, 0x08, 0x10, 0x09, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1B, 0x03, 0x00,
+  0x06, 0x0A, 0x07, 0x15, 0x06, 0x03, 0x00, 0x06, 0x0B, 0x06, 0x16, 0x05,
+  0x03, 0x00, 0x05, 0x0B, 0x05, 0x16, 0x05, 0x03, 0x00, 0x05, 0x0B, 0x05,
+  0x16, 0x05, 0x03, 0x00, 0x05, 0x0B, 0x05, 0x16, 0x05, 0x03, 0x00, 0x05,
+  0x0B, 0x05, 0x16, 0x05, 0x03, 0x00, 0x05, 0x0B, 0x05, 0x16, 0x05, 0x03,
+  0x00, 0x05, 0x0B, 0x05, 0x16, 0x05, 0x03, 0x00, 0x05, 0x0B, 0x05, 0x16,
+  0x05, 0x03, 0x00, 0x05, 0x0B, 0x05, 0x16, 0x05, 0x03, 0x00, 0x05, 0x0B,
+  0x05, 0x16, 0x05, 0x03, 0x00, 0x05, 0x0B, 0x05, 0x16, 0x05, 0x03, 0x00,
+  0x05, 0x0B, 0x05, 0x16, 0x05, 0x03, 0x00, 0x05, 0x0B, 0x05, 0x16, 0x05,
+  0x03, 0x00, 0x05, 0x0B, 0x05, 0x16, 0x05, 0x02, 0x00, 0x05, 0x08, 0x05,
+  0x02, 0x00, 0x05, 0x06, 0x09, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x02,
+  0x00, 0x07, 0x0B, 0x06, 0x02, 0x00, 0x06, 0x0C, 0x05, 0x02, 0x00, 0x05,
+  0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05,
+  0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00,
+  0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C,
+  0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02,
+  0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05,
+  0x0C, 0x05, 0x01, 0x06, 0x07, 0x01, 0x04, 0x0B, 0x01, 0x03, 0x0D, 0x01,
+  0x02, 0x0F, 0x02, 0x01, 0x07, 0x0C, 0x06, 0x02, 0x01, 0x05, 0x0D, 0x05,
+  0x02, 0x00, 0x06, 0x0D, 0x06, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00,
+  0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E,
+  0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x06, 0x0D, 0x06, 0x02,
+  0x01, 0x05, 0x0D, 0x05, 0x02, 0x01, 0x06, 0x0B, 0x07, 0x01, 0x02, 0x0F,
+  0x01, 0x03, 0x0D, 0x01, 0x04, 0x0B, 0x01, 0x06, 0x07, 0x02, 0x00, 0x05,
+  0x08, 0x05, 0x02, 0x00, 0x05, 0x06, 0x09, 0x01, 0x00, 0x10, 0x01, 0x00,
+  0x10, 0x02, 0x00, 0x07, 0x0B, 0x06, 0x02, 0x00, 0x06, 0x0C, 0x05, 0x02,
+  0x00, 0x06, 0x0C, 0x06, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05,
+  0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05,
+  0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x06, 0x0C, 0x06, 0x02, 0x00,
+  0x06, 0x0C, 0x05, 0x02, 0x00, 0x07, 0x0B, 0x06, 0x01, 0x00, 0x10, 0x01,
+  0x00, 0x10, 0x02, 0x00, 0x05, 0x06, 0x08, 0x02, 0x00, 0x05, 0x08, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x02, 0x05, 0x06,
+  0x0E, 0x05, 0x02, 0x04, 0x09, 0x0E, 0x05, 0x01, 0x03, 0x10, 0x01, 0x02,
+  0x11, 0x02, 0x01, 0x07, 0x0B, 0x08, 0x02, 0x01, 0x05, 0x0D, 0x06, 0x02,
+  0x00, 0x06, 0x0D, 0x06, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05,
+  0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05,
+  0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x06, 0x0D, 0x06, 0x02, 0x01,
+  0x05, 0x0D, 0x06, 0x02, 0x01, 0x06, 0x0C, 0x07, 0x01, 0x02, 0x11, 0x01,
+  0x02, 0x11, 0x02, 0x04, 0x09, 0x0E, 0x05, 0x02, 0x05, 0x06, 0x0E, 0x05,
+  0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05,
+  0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x02, 0x00, 0x05,
+  0x08, 0x03, 0x02, 0x00, 0x05, 0x06, 0x05, 0x01, 0x00, 0x0B, 0x01, 0x00,
+  0x0B, 0x01, 0x00, 0x07, 0x01, 0x00, 0x06, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x05,
+  0x07, 0x01, 0x03, 0x0B, 0x01, 0x02, 0x0D, 0x01, 0x02, 0x0E, 0x02, 0x01,
+  0x06, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0C, 0x04, 0x01, 0x01, 0x06, 0x01,
+  0x01, 0x09, 0x01, 0x02, 0x0C, 0x01, 0x02, 0x0E, 0x01, 0x04, 0x0C, 0x01,
+  0x07, 0x0A, 0x01, 0x0B, 0x06, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x01,
+  0x05, 0x0B, 0x06, 0x01, 0x01, 0x0F, 0x01, 0x02, 0x0E, 0x01, 0x03, 0x0C,
+  0x01, 0x05, 0x08, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09,
+  0x01, 0x00, 0x09, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x03, 0x06, 0x01, 0x04, 0x05,
+  0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00,
+  0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C,
+  0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02,
+  0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05,
+  0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05,
+  0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x02, 0x00,
+  0x06, 0x0A, 0x07, 0x01, 0x00, 0x11, 0x01, 0x01, 0x10, 0x02, 0x02, 0x09,
+  0x0C, 0x05, 0x02, 0x03, 0x06, 0x0C, 0x05, 0x02, 0x01, 0x05, 0x0D, 0x05,
+  0x02, 0x01, 0x05, 0x0D, 0x05, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x02, 0x02,
+  0x05, 0x0C, 0x05, 0x02, 0x02, 0x05, 0x0C, 0x05, 0x02, 0x02, 0x05, 0x0C,
+  0x05, 0x02, 0x03, 0x04, 0x0C, 0x04, 0x02, 0x03, 0x05, 0x0B, 0x05, 0x02,
+  0x03, 0x05, 0x0B, 0x05, 0x02, 0x04, 0x04, 0x0B, 0x04, 0x02, 0x04, 0x05,
+  0x0B, 0x04, 0x02, 0x04, 0x05, 0x0A, 0x05, 0x02, 0x05, 0x04, 0x0A, 0x04,
+  0x01, 0x05, 0x09, 0x01, 0x05, 0x09, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07,
+  0x01, 0x06, 0x07, 0x01, 0x07, 0x05, 0x03, 0x00, 0x06, 0x0B, 0x05, 0x16,
+  0x05, 0x03, 0x01, 0x05, 0x0B, 0x05, 0x16, 0x05, 0x03, 0x01, 0x05, 0x0B,
+  0x06, 0x15, 0x05, 0x03, 0x01, 0x05, 0x0B, 0x06, 0x15, 0x05, 0x03, 0x02,
+  0x04, 0x0A, 0x07, 0x15, 0x05, 0x03, 0x02, 0x05, 0x0A, 0x07, 0x15, 0x04,
+  0x03, 0x02, 0x05, 0x0A, 0x08, 0x14, 0x05, 0x04, 0x02, 0x05, 0x0A, 0x03,
+  0x0E, 0x04, 0x14, 0x05, 0x04, 0x03, 0x04, 0x09, 0x04, 0x0E, 0x04, 0x14,
+  0x05, 0x04, 0x03, 0x05, 0x09, 0x04, 0x0F, 0x03, 0x14, 0x04, 0x04, 0x03,
+  0x05, 0x09, 0x04, 0x0F, 0x03, 0x14, 0x04, 0x03, 0x04, 0x04, 0x09, 0x03,
+  0x0F, 0x09, 0x03, 0x04, 0x04, 0x09, 0x03, 0x0F, 0x08, 0x02, 0x04, 0x08,
+  0x0F, 0x08, 0x02, 0x04, 0x08, 0x10, 0x07, 0x02, 0x05, 0x06, 0x10, 0x07,
+  0x02, 0x05, 0x06, 0x10, 0x06, 0x02, 0x05, 0x06, 0x10, 0x06, 0x02, 0x06,
+  0x05, 0x10, 0x06, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x02, 0x01, 0x05, 0x0B,
+  0x06, 0x02, 0x01, 0x06, 0x0A, 0x06, 0x02, 0x02, 0x05, 0x0A, 0x05, 0x02,
+  0x03, 0x05, 0x09, 0x06, 0x02, 0x03, 0x05, 0x09, 0x05, 0x01, 0x04, 0x09,
+  0x01, 0x05, 0x08, 0x01, 0x05, 0x07, 0x01, 0x06, 0x05, 0x01, 0x05, 0x07,
+  0x01, 0x04, 0x09, 0x01, 0x04, 0x09, 0x02, 0x03, 0x05, 0x09, 0x05, 0x02,
+  0x02, 0x06, 0x09, 0x06, 0x02, 0x02, 0x05, 0x0A, 0x05, 0x02, 0x01, 0x06,
+  0x0A, 0x06, 0x02, 0x01, 0x05, 0x0B, 0x06, 0x02, 0x00, 0x06, 0x0C, 0x05,
+  0x02, 0x01, 0x05, 0x0E, 0x05, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x02, 0x01,
+  0x06, 0x0D, 0x05, 0x02, 0x02, 0x05, 0x0D, 0x05, 0x02, 0x02, 0x05, 0x0C,
+  0x05, 0x02, 0x02, 0x05, 0x0C, 0x05, 0x02, 0x03, 0x05, 0x0C, 0x05, 0x02,
+  0x03, 0x05, 0x0C, 0x04, 0x02, 0x04, 0x04, 0x0B, 0x05, 0x02, 0x04, 0x05,
+  0x0B, 0x04, 0x02, 0x04, 0x05, 0x0B, 0x04, 0x02, 0x05, 0x04, 0x0A, 0x05,
+  0x01, 0x05, 0x09, 0x01, 0x05, 0x09, 0x01, 0x06, 0x08, 0x01, 0x06, 0x07,
+  0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05,
+  0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x03, 0x08, 0x01, 0x03, 0x07,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x0E,
+  0x01, 0x01, 0x0E, 0x01, 0x01, 0x0E, 0x01, 0x09, 0x06, 0x01, 0x08, 0x06,
+  0x01, 0x07, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x05, 0x06,
+  0x01, 0x04, 0x06, 0x01, 0x03, 0x06, 0x01, 0x02, 0x06, 0x01, 0x01, 0x06,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10,
+  0x01, 0x00, 0x10, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x05,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x04, 0x01, 0x00, 0x06, 0x01, 0x02, 0x05,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x06, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x05, 0x01, 0x03, 0x06,
+  0x01, 0x05, 0x04, 0x01, 0x03, 0x06, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04,
+  0x01, 0x02, 0x04, 0x02, 0x01, 0x07, 0x0D, 0x02, 0x02, 0x00, 0x09, 0x0D,
+  0x02, 0x02, 0x00, 0x02, 0x06, 0x09, 0x02, 0x00, 0x02, 0x08, 0x06, 0x01,
+  0x09, 0x04 };
+
+const GFXglyph FreeSansBold18pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,  10,    0,    1 },   // 0x20 ' '
+  {     0,   5,  25,  12,    4,  -24 },   // 0x21 '!'
+  {    71,  13,   9,  17,    2,  -25 },   // 0x22 '"'
+  {   116,  20,  24,  19,    0,  -23 },   // 0x23 '#'
+  {   220,  19,  29,  19,    0,  -25 },   // 0x24 '$'
+  {   347,  29,  25,  31,    1,  -24 },   // 0x25 '%'
+  {   494,  22,  25,  25,    2,  -24 },   // 0x26 '&'
+  {   603,   5,   9,   9,    2,  -25 },   // 0x27 '''
+  {   630,   9,  33,  12,    1,  -25 },   // 0x28 '('
+  {   729,   9,  33,  12,    1,  -25 },   // 0x29 ')'
+  {   828,  12,  11,  14,    0,  -25 },   // 0x2A '*'
+  {   869,  16,  16,  20,    2,  -15 },   // 0x2B '+'
+  {   917,   5,  11,   9,    2,   -4 },   // 0x2C ','
+  {   950,   9,   4,  12,    1,  -10 },   // 0x2D '-'
+  {   962,   5,   5,   9,    2,   -4 },   // 0x2E '.'
+  {   977,   9,  25,  10,    0,  -24 },   // 0x2F '/'
+  {  1052,  17,  25,  19,    1,  -24 },   // 0x30 '0'
+  {  1161,  10,  25,  19,    3,  -24 },   // 0x31 '1'
+  {  1236,  17,  25,  19,    1,  -24 },   // 0x32 '2'
+  {  1321,  17,  25,  19,    1,  -24 },   // 0x33 '3'
+  {  1412,  16,  25,  19,    2,  -24 },   // 0x34 '4'
+  {  1507,  17,  25,  19,    1,  -24 },   // 0x35 '5'
+  {  1592,  18,  25,  19,    1,  -24 },   // 0x36 '6'
+  {  1693,  17,  25,  19,    1,  -24 },   // 0x37 '7'
+  {  1768,  17,  25,  19,    1,  -24 },   // 0x38 '8'
+  {  1871,  17,  25,  19,    1,  -24 },   // 0x39 '9'
+  {  1972,   5,  18,   9,    2,  -17 },   // 0x3A ':'
+  {  2010,   5,  24,   9,    2,  -17 },   // 0x3B ';'
+  {  2066,  18,  17,  20,    1,  -16 },   // 0x3C '<'
+  {  2117,  17,  12,  20,    2,  -13 },   // 0x3D '='
+  {  2145,  18,  17,  20,    1,  -16 },   // 0x3E '>'
+  {  2196,  18,  26,  21,    2,  -25 },   // 0x3F '?'
+  {  2280,  32,  31,  34,    1,  -25 },   // 0x40 '@'
+  {  2477,  24,  26,  24,    0,  -25 },   // 0x41 'A'
+  {  2585,  20,  26,  25,    3,  -25 },   // 0x42 'B'
+  {  2691,  23,  26,  25,    1,  -25 },   // 0x43 'C'
+  {  2789,  21,  26,  25,    3,  -25 },   // 0x44 'D'
+  {  2903,  19,  26,  23,    3,  -25 },   // 0x45 'E'
+  {  2981,  17,  26,  22,    3,  -25 },   // 0x46 'F'
+  {  3059,  24,  26,  27,    1,  -25 },   // 0x47 'G'
+  {  3171,  20,  26,  26,    3,  -25 },   // 0x48 'H'
+  {  3293,   5,  26,  11,    3,  -25 },   // 0x49 'I'
+  {  3371,  16,  26,  20,    1,  -25 },   // 0x4A 'J'
+  {  3461,  22,  26,  25,    3,  -25 },   // 0x4B 'K'
+  {  3583,  17,  26,  22,    3,  -25 },   // 0x4C 'L'
+  {  3661,  24,  26,  30,    3,  -25 },   // 0x4D 'M'
+  {  3845,  20,  26,  26,    3,  -25 },   // 0x4E 'N'
+  {  3991,  25,  26,  27,    1,  -25 },   // 0x4F 'O'
+  {  4105,  19,  26,  24,    3,  -25 },   // 0x50 'P'
+  {  4199,  25,  27,  27,    1,  -25 },   // 0x51 'Q'
+  {  4324,  21,  26,  25,    3,  -25 },   // 0x52 'R'
+  {  4438,  20,  26,  24,    2,  -25 },   // 0x53 'S'
+  {  4532,  19,  26,  23,    2,  -25 },   // 0x54 'T'
+  {  4610,  20,  26,  26,    3,  -25 },   // 0x55 'U'
+  {  4732,  22,  26,  23,    1,  -25 },   // 0x56 'V'
+  {  4848,  32,  26,  34,    1,  -25 },   // 0x57 'W'
+  {  5036,  22,  26,  24,    1,  -25 },   // 0x58 'X'
+  {  5148,  21,  26,  22,    1,  -25 },   // 0x59 'Y'
+  {  5248,  19,  26,  21,    1,  -25 },   // 0x5A 'Z'
+  {  5326,   8,  33,  12,    2,  -25 },   // 0x5B '['
+  {  5425,  10,  25,  10,    0,  -24 },   // 0x5C '\'
+  {  5500,   8,  33,  12,    1,  -25 },   // 0x5D ']'
+  {  5599,  16,  15,  20,    2,  -23 },   // 0x5E '^'
+  {  5664,  21,   3,  19,   -1,    5 },   // 0x5F '_'
+  {  5673,   7,   5,   9,    1,  -25 },   // 0x60 '`'
+  {  5688,  18,  19,  20,    1,  -18 },   // 0x61 'a'
+  {  5763,  18,  26,  22,    2,  -25 },   // 0x62 'b'
+  {  5871,  17,  19,  20,    1,  -18 },   // 0x63 'c'
+  {  5940,  19,  26,  22,    1,  -25 },   // 0x64 'd'
+  {  6048,  18,  19,  20,    1,  -18 },   // 0x65 'e'
+  {  6117,  10,  26,  12,    1,  -25 },   // 0x66 'f'
+  {  6195,  18,  26,  21,    1,  -18 },   // 0x67 'g'
+  {  6307,  17,  26,  21,    2,  -25 },   // 0x68 'h'
+  {  6419,   5,  26,  10,    2,  -25 },   // 0x69 'i'
+  {  6491,   7,  33,  10,    0,  -25 },   // 0x6A 'j'
+  {  6584,  17,  26,  20,    2,  -25 },   // 0x6B 'k'
+  {  6692,   5,  26,   9,    2,  -25 },   // 0x6C 'l'
+  {  6770,  27,  19,  31,    2,  -18 },   // 0x6D 'm'
+  {  6895,  17,  19,  21,    2,  -18 },   // 0x6E 'n'
+  {  6986,  19,  19,  21,    1,  -18 },   // 0x6F 'o'
+  {  7065,  18,  26,  22,    2,  -18 },   // 0x70 'p'
+  {  7173,  19,  26,  22,    1,  -18 },   // 0x71 'q'
+  {  7281,  11,  19,  14,    2,  -18 },   // 0x72 'r'
+  {  7342,  17,  19,  19,    1,  -18 },   // 0x73 's'
+  {  7407,   9,  23,  12,    1,  -22 },   // 0x74 't'
+  {  7476,  17,  19,  21,    2,  -18 },   // 0x75 'u'
+  {  7567,  19,  19,  19,    0,  -18 },   // 0x76 'v'
+  {  7650,  27,  19,  27,    0,  -18 },   // 0x77 'w'
+  {  7779,  18,  19,  19,    1,  -18 },   // 0x78 'x'
+  {  7860,  19,  26,  19,    0,  -18 },   // 0x79 'y'
+  {  7962,  16,  19,  18,    1,  -18 },   // 0x7A 'z'
+  {  8019,   9,  33,  14,    1,  -25 },   // 0x7B '{'
+  {  8118,   3,  33,  10,    4,  -25 },   // 0x7C '|'
+  {  8217,   9,  33,  14,    3,  -25 },   // 0x7D '}'
+  {  8316,  15,   6,  18,    1,  -10 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSansBold18pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSansBold18pt7bSpanData,
+    (GFXglyph *)FreeSansBold18pt7bSpanGlyphs,
+    0x20, 0x7E, 42 } };
+
+// Approx. 9126 bytes
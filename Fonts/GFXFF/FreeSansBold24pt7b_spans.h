@@ -0,0 +1,1040 @@
+// FreeSansBold24pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSansBold24pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSansBold24pt7bSpanData[] PROGMEM = {
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x02, 0x00, 0x07, 0x0B, 0x07, 0x02, 0x00, 0x07, 0x0B, 0x07, 0x02, 0x00,
+  0x07, 0x0B, 0x07, 0x02, 0x00, 0x07, 0x0B, 0x07, 0x02, 0x00, 0x07, 0x0B,
+  0x07, 0x02, 0x00, 0x07, 0x0B, 0x07, 0x02, 0x00, 0x07, 0x0B, 0x07, 0x02,
+  0x01, 0x05, 0x0C, 0x05, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x01, 0x05,
+  0x0C, 0x05, 0x02, 0x02, 0x03, 0x0D, 0x03, 0x02, 0x02, 0x03, 0x0D, 0x03,
+  0x02, 0x08, 0x05, 0x12, 0x05, 0x02, 0x08, 0x05, 0x12, 0x05, 0x02, 0x08,
+  0x05, 0x12, 0x05, 0x02, 0x08, 0x05, 0x12, 0x05, 0x02, 0x08, 0x05, 0x11,
+  0x05, 0x02, 0x07, 0x05, 0x11, 0x05, 0x02, 0x07, 0x05, 0x11, 0x05, 0x01,
+  0x01, 0x19, 0x01, 0x01, 0x19, 0x01, 0x01, 0x19, 0x01, 0x01, 0x19, 0x01,
+  0x01, 0x19, 0x02, 0x06, 0x05, 0x10, 0x05, 0x02, 0x06, 0x05, 0x10, 0x05,
+  0x02, 0x06, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x05, 0x0F, 0x05, 0x02, 0x05,
+  0x05, 0x0F, 0x05, 0x02, 0x05, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x05, 0x0F,
+  0x05, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00,
+  0x18, 0x01, 0x00, 0x18, 0x02, 0x04, 0x05, 0x0D, 0x05, 0x02, 0x03, 0x05,
+  0x0D, 0x05, 0x02, 0x03, 0x05, 0x0D, 0x05, 0x02, 0x03, 0x05, 0x0D, 0x05,
+  0x02, 0x03, 0x05, 0x0D, 0x05, 0x02, 0x03, 0x05, 0x0C, 0x05, 0x02, 0x02,
+  0x05, 0x0C, 0x05, 0x02, 0x02, 0x05, 0x0C, 0x05, 0x02, 0x02, 0x05, 0x0C,
+  0x05, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x07, 0x0A, 0x01, 0x05,
+  0x0E, 0x01, 0x04, 0x11, 0x01, 0x03, 0x13, 0x01, 0x02, 0x15, 0x03, 0x02,
+  0x07, 0x0A, 0x03, 0x0F, 0x09, 0x03, 0x01, 0x07, 0x0A, 0x03, 0x10, 0x08,
+  0x03, 0x01, 0x06, 0x0A, 0x03, 0x11, 0x08, 0x03, 0x01, 0x06, 0x0A, 0x03,
+  0x12, 0x07, 0x03, 0x01, 0x06, 0x0A, 0x03, 0x12, 0x07, 0x02, 0x01, 0x06,
+  0x0A, 0x03, 0x02, 0x01, 0x07, 0x0A, 0x03, 0x02, 0x01, 0x08, 0x0A, 0x03,
+  0x01, 0x02, 0x0B, 0x01, 0x02, 0x0C, 0x01, 0x03, 0x0E, 0x01, 0x04, 0x10,
+  0x01, 0x06, 0x10, 0x01, 0x08, 0x0F, 0x01, 0x0A, 0x0E, 0x02, 0x0A, 0x03,
+  0x0F, 0x09, 0x02, 0x0A, 0x03, 0x10, 0x09, 0x02, 0x0A, 0x03, 0x11, 0x08,
+  0x03, 0x00, 0x07, 0x0A, 0x03, 0x12, 0x07, 0x03, 0x00, 0x07, 0x0A, 0x03,
+  0x12, 0x07, 0x03, 0x00, 0x07, 0x0A, 0x03, 0x12, 0x07, 0x03, 0x00, 0x07,
+  0x0A, 0x03, 0x11, 0x08, 0x03, 0x01, 0x07, 0x0A, 0x03, 0x11, 0x07, 0x03,
+  0x01, 0x08, 0x0A, 0x03, 0x0F, 0x09, 0x01, 0x02, 0x15, 0x01, 0x02, 0x14,
+  0x01, 0x03, 0x12, 0x01, 0x05, 0x0E, 0x01, 0x07, 0x09, 0x01, 0x0A, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x02, 0x06, 0x05,
+  0x1A, 0x04, 0x02, 0x04, 0x09, 0x1A, 0x04, 0x02, 0x03, 0x0C, 0x19, 0x04,
+  0x02, 0x02, 0x0D, 0x19, 0x04, 0x02, 0x01, 0x0F, 0x18, 0x04, 0x03, 0x01,
+  0x05, 0x0B, 0x05, 0x18, 0x04, 0x03, 0x00, 0x05, 0x0C, 0x05, 0x17, 0x04,
+  0x03, 0x00, 0x04, 0x0D, 0x04, 0x17, 0x04, 0x03, 0x00, 0x04, 0x0D, 0x04,
+  0x16, 0x04, 0x03, 0x00, 0x04, 0x0D, 0x04, 0x16, 0x04, 0x03, 0x00, 0x05,
+  0x0C, 0x05, 0x15, 0x04, 0x03, 0x01, 0x05, 0x0B, 0x05, 0x15, 0x04, 0x02,
+  0x01, 0x0F, 0x14, 0x04, 0x02, 0x02, 0x0D, 0x14, 0x04, 0x02, 0x03, 0x0B,
+  0x13, 0x04, 0x02, 0x04, 0x09, 0x12, 0x05, 0x02, 0x06, 0x05, 0x12, 0x04,
+  0x02, 0x11, 0x04, 0x1C, 0x05, 0x02, 0x11, 0x04, 0x1A, 0x09, 0x02, 0x10,
+  0x04, 0x18, 0x0D, 0x02, 0x10, 0x04, 0x18, 0x0D, 0x02, 0x0F, 0x04, 0x17,
+  0x0F, 0x03, 0x0F, 0x04, 0x16, 0x06, 0x21, 0x05, 0x03, 0x0E, 0x04, 0x16,
+  0x05, 0x22, 0x05, 0x03, 0x0E, 0x04, 0x16, 0x04, 0x23, 0x04, 0x03, 0x0D,
+  0x04, 0x16, 0x04, 0x23, 0x04, 0x03, 0x0D, 0x04, 0x16, 0x04, 0x23, 0x04,
+  0x03, 0x0C, 0x04, 0x16, 0x05, 0x22, 0x05, 0x03, 0x0C, 0x04, 0x17, 0x05,
+  0x21, 0x05, 0x02, 0x0B, 0x04, 0x17, 0x0F, 0x02, 0x0B, 0x04, 0x18, 0x0D,
+  0x02, 0x0A, 0x04, 0x18, 0x0C, 0x02, 0x09, 0x05, 0x1A, 0x09, 0x02, 0x09,
+  0x04, 0x1C, 0x05, 0x01, 0x0A, 0x06, 0x01, 0x08, 0x09, 0x01, 0x07, 0x0B,
+  0x01, 0x06, 0x0D, 0x01, 0x05, 0x0F, 0x02, 0x04, 0x08, 0x0E, 0x06, 0x02,
+  0x04, 0x07, 0x0F, 0x05, 0x02, 0x04, 0x07, 0x0F, 0x05, 0x02, 0x04, 0x07,
+  0x0F, 0x05, 0x02, 0x04, 0x08, 0x0F, 0x05, 0x02, 0x05, 0x07, 0x0E, 0x05,
+  0x01, 0x05, 0x0E, 0x01, 0x06, 0x0C, 0x01, 0x07, 0x0A, 0x01, 0x08, 0x08,
+  0x01, 0x07, 0x08, 0x02, 0x05, 0x0B, 0x16, 0x05, 0x02, 0x04, 0x0D, 0x16,
+  0x05, 0x02, 0x02, 0x0F, 0x16, 0x05, 0x03, 0x01, 0x09, 0x0C, 0x06, 0x15,
+  0x06, 0x03, 0x01, 0x07, 0x0D, 0x06, 0x15, 0x06, 0x02, 0x00, 0x08, 0x0D,
+  0x0D, 0x02, 0x00, 0x07, 0x0E, 0x0C, 0x02, 0x00, 0x07, 0x0F, 0x0B, 0x02,
+  0x00, 0x07, 0x0F, 0x0A, 0x02, 0x00, 0x07, 0x10, 0x09, 0x02, 0x00, 0x08,
+  0x10, 0x08, 0x02, 0x00, 0x09, 0x0F, 0x0A, 0x02, 0x01, 0x09, 0x0E, 0x0C,
+  0x01, 0x01, 0x19, 0x01, 0x02, 0x19, 0x02, 0x03, 0x10, 0x14, 0x08, 0x02,
+  0x04, 0x0E, 0x15, 0x08, 0x02, 0x05, 0x0C, 0x16, 0x07, 0x01, 0x08, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x08, 0x04, 0x01, 0x07, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05,
+  0x01, 0x05, 0x05, 0x01, 0x04, 0x06, 0x01, 0x04, 0x05, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x03, 0x05, 0x01, 0x03, 0x06,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x06, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05,
+  0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x07, 0x05, 0x01, 0x08, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x06, 0x01, 0x05, 0x05, 0x01, 0x05, 0x06, 0x01, 0x05, 0x06,
+  0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06,
+  0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06,
+  0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06,
+  0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x05,
+  0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06, 0x05,
+  0x01, 0x05, 0x06, 0x01, 0x05, 0x06, 0x01, 0x05, 0x05, 0x01, 0x04, 0x06,
+  0x01, 0x04, 0x05, 0x01, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x02, 0x06,
+  0x01, 0x02, 0x05, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x03, 0x01, 0x02, 0x06, 0x03, 0x0C, 0x02, 0x01, 0x00, 0x0F, 0x01, 0x00,
+  0x0F, 0x01, 0x02, 0x0C, 0x01, 0x05, 0x05, 0x01, 0x04, 0x07, 0x01, 0x04,
+  0x07, 0x02, 0x03, 0x04, 0x08, 0x04, 0x02, 0x02, 0x04, 0x09, 0x04, 0x02,
+  0x02, 0x04, 0x09, 0x04, 0x02, 0x04, 0x01, 0x0A, 0x01, 0x01, 0x09, 0x05,
+  0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05,
+  0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x00, 0x17,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17,
+  0x01, 0x00, 0x17, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05,
+  0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05,
+  0x01, 0x09, 0x05, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x03, 0x01, 0x00, 0x06, 0x01, 0x00, 0x05, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x0D, 0x01, 0x00, 0x0D, 0x01, 0x00, 0x0D, 0x01, 0x00, 0x0D,
+  0x01, 0x00, 0x0D, 0x01, 0x00, 0x0D, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x04, 0x01, 0x09, 0x03,
+  0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x03,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x08, 0x08,
+  0x01, 0x06, 0x0C, 0x01, 0x04, 0x10, 0x01, 0x03, 0x12, 0x01, 0x03, 0x12,
+  0x01, 0x02, 0x14, 0x02, 0x02, 0x08, 0x0E, 0x08, 0x02, 0x01, 0x08, 0x0F,
+  0x08, 0x02, 0x01, 0x07, 0x10, 0x07, 0x02, 0x01, 0x07, 0x10, 0x07, 0x02,
+  0x01, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07,
+  0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07,
+  0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00,
+  0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11,
+  0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02,
+  0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x01, 0x07,
+  0x10, 0x07, 0x02, 0x01, 0x07, 0x10, 0x07, 0x02, 0x01, 0x07, 0x10, 0x07,
+  0x02, 0x01, 0x08, 0x0F, 0x08, 0x02, 0x02, 0x08, 0x0E, 0x08, 0x01, 0x02,
+  0x14, 0x01, 0x03, 0x12, 0x01, 0x03, 0x12, 0x01, 0x04, 0x10, 0x01, 0x06,
+  0x0C, 0x01, 0x08, 0x08, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x05, 0x01, 0x09,
+  0x05, 0x01, 0x08, 0x06, 0x01, 0x07, 0x07, 0x01, 0x04, 0x0A, 0x01, 0x00,
+  0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E, 0x01, 0x07,
+  0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07,
+  0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07,
+  0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07,
+  0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07,
+  0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07,
+  0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x08, 0x01, 0x05,
+  0x0D, 0x01, 0x04, 0x0F, 0x01, 0x03, 0x11, 0x01, 0x02, 0x13, 0x01, 0x01,
+  0x15, 0x02, 0x01, 0x08, 0x0E, 0x08, 0x02, 0x00, 0x08, 0x0F, 0x08, 0x02,
+  0x00, 0x07, 0x0F, 0x08, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07,
+  0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x01, 0x10, 0x07, 0x01, 0x10,
+  0x07, 0x01, 0x0F, 0x08, 0x01, 0x0F, 0x07, 0x01, 0x0E, 0x08, 0x01, 0x0D,
+  0x08, 0x01, 0x0B, 0x09, 0x01, 0x0A, 0x09, 0x01, 0x09, 0x08, 0x01, 0x07,
+  0x09, 0x01, 0x06, 0x08, 0x01, 0x05, 0x08, 0x01, 0x04, 0x08, 0x01, 0x03,
+  0x08, 0x01, 0x03, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x15, 0x01, 0x02,
+  0x15, 0x01, 0x01, 0x16, 0x01, 0x01, 0x16, 0x01, 0x01, 0x16, 0x01, 0x01,
+  0x16, 0x01, 0x07, 0x08, 0x01, 0x05, 0x0D, 0x01, 0x03, 0x10, 0x01, 0x02,
+  0x12, 0x01, 0x01, 0x14, 0x01, 0x01, 0x14, 0x02, 0x01, 0x08, 0x0D, 0x09,
+  0x02, 0x00, 0x08, 0x0E, 0x08, 0x02, 0x00, 0x07, 0x0F, 0x07, 0x02, 0x00,
+  0x07, 0x0F, 0x07, 0x02, 0x00, 0x07, 0x0F, 0x07, 0x01, 0x0F, 0x07, 0x01,
+  0x0F, 0x06, 0x01, 0x0E, 0x07, 0x01, 0x0D, 0x07, 0x01, 0x0A, 0x09, 0x01,
+  0x0A, 0x08, 0x01, 0x0A, 0x09, 0x01, 0x0A, 0x0B, 0x01, 0x0D, 0x09, 0x01,
+  0x0F, 0x07, 0x01, 0x0F, 0x08, 0x01, 0x10, 0x07, 0x01, 0x10, 0x07, 0x01,
+  0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x0F, 0x08,
+  0x02, 0x00, 0x08, 0x0F, 0x08, 0x02, 0x01, 0x08, 0x0E, 0x08, 0x01, 0x01,
+  0x15, 0x01, 0x01, 0x14, 0x01, 0x02, 0x12, 0x01, 0x03, 0x10, 0x01, 0x05,
+  0x0D, 0x01, 0x07, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0A,
+  0x09, 0x01, 0x0A, 0x09, 0x01, 0x09, 0x0A, 0x01, 0x08, 0x0B, 0x01, 0x08,
+  0x0B, 0x02, 0x07, 0x04, 0x0C, 0x07, 0x02, 0x07, 0x04, 0x0C, 0x07, 0x02,
+  0x06, 0x04, 0x0C, 0x07, 0x02, 0x05, 0x04, 0x0C, 0x07, 0x02, 0x05, 0x04,
+  0x0C, 0x07, 0x02, 0x04, 0x04, 0x0C, 0x07, 0x02, 0x04, 0x03, 0x0C, 0x07,
+  0x02, 0x03, 0x04, 0x0C, 0x07, 0x02, 0x03, 0x03, 0x0C, 0x07, 0x02, 0x02,
+  0x04, 0x0C, 0x07, 0x02, 0x01, 0x04, 0x0C, 0x07, 0x02, 0x01, 0x03, 0x0C,
+  0x07, 0x02, 0x00, 0x04, 0x0C, 0x07, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16,
+  0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16,
+  0x01, 0x0C, 0x07, 0x01, 0x0C, 0x07, 0x01, 0x0C, 0x07, 0x01, 0x0C, 0x07,
+  0x01, 0x0C, 0x07, 0x01, 0x0C, 0x07, 0x01, 0x0C, 0x07, 0x01, 0x03, 0x13,
+  0x01, 0x03, 0x13, 0x01, 0x03, 0x13, 0x01, 0x03, 0x13, 0x01, 0x02, 0x14,
+  0x01, 0x02, 0x14, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x04, 0x02, 0x01, 0x05, 0x09, 0x06, 0x02, 0x01, 0x05, 0x07,
+  0x0B, 0x01, 0x01, 0x12, 0x01, 0x01, 0x13, 0x01, 0x01, 0x14, 0x01, 0x00,
+  0x15, 0x02, 0x00, 0x07, 0x0D, 0x09, 0x01, 0x0E, 0x08, 0x01, 0x0F, 0x08,
+  0x01, 0x10, 0x07, 0x01, 0x10, 0x07, 0x01, 0x10, 0x07, 0x01, 0x10, 0x07,
+  0x01, 0x10, 0x07, 0x01, 0x10, 0x07, 0x02, 0x00, 0x06, 0x0F, 0x08, 0x02,
+  0x00, 0x07, 0x0E, 0x08, 0x02, 0x00, 0x08, 0x0D, 0x09, 0x01, 0x00, 0x15,
+  0x01, 0x01, 0x14, 0x01, 0x02, 0x12, 0x01, 0x03, 0x0F, 0x01, 0x04, 0x0D,
+  0x01, 0x07, 0x07, 0x01, 0x08, 0x08, 0x01, 0x06, 0x0C, 0x01, 0x05, 0x0F,
+  0x01, 0x04, 0x10, 0x01, 0x03, 0x12, 0x01, 0x02, 0x14, 0x02, 0x02, 0x08,
+  0x0E, 0x08, 0x02, 0x01, 0x08, 0x0F, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01,
+  0x07, 0x01, 0x01, 0x07, 0x01, 0x00, 0x07, 0x02, 0x00, 0x07, 0x0A, 0x06,
+  0x02, 0x00, 0x07, 0x08, 0x0A, 0x01, 0x00, 0x14, 0x01, 0x00, 0x15, 0x01,
+  0x00, 0x15, 0x02, 0x00, 0x0A, 0x0E, 0x08, 0x02, 0x00, 0x08, 0x0F, 0x07,
+  0x02, 0x00, 0x08, 0x0F, 0x08, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00,
+  0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10,
+  0x07, 0x02, 0x01, 0x06, 0x10, 0x07, 0x02, 0x01, 0x06, 0x10, 0x07, 0x02,
+  0x01, 0x07, 0x0F, 0x08, 0x02, 0x01, 0x07, 0x0F, 0x07, 0x02, 0x02, 0x08,
+  0x0D, 0x09, 0x01, 0x02, 0x13, 0x01, 0x03, 0x12, 0x01, 0x03, 0x11, 0x01,
+  0x04, 0x0F, 0x01, 0x06, 0x0C, 0x01, 0x08, 0x07, 0x01, 0x00, 0x17, 0x01,
+  0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01,
+  0x00, 0x17, 0x01, 0x10, 0x06, 0x01, 0x0F, 0x06, 0x01, 0x0E, 0x07, 0x01,
+  0x0E, 0x06, 0x01, 0x0D, 0x06, 0x01, 0x0C, 0x07, 0x01, 0x0C, 0x06, 0x01,
+  0x0B, 0x07, 0x01, 0x0B, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x07, 0x01,
+  0x09, 0x07, 0x01, 0x09, 0x06, 0x01, 0x08, 0x07, 0x01, 0x08, 0x06, 0x01,
+  0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01,
+  0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x06, 0x01,
+  0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01,
+  0x08, 0x07, 0x01, 0x06, 0x0C, 0x01, 0x04, 0x0F, 0x01, 0x03, 0x11, 0x01,
+  0x02, 0x13, 0x01, 0x02, 0x13, 0x02, 0x01, 0x08, 0x0E, 0x08, 0x02, 0x01,
+  0x07, 0x10, 0x06, 0x02, 0x01, 0x06, 0x10, 0x06, 0x02, 0x01, 0x06, 0x11,
+  0x05, 0x02, 0x01, 0x06, 0x11, 0x05, 0x02, 0x01, 0x06, 0x10, 0x06, 0x02,
+  0x02, 0x06, 0x10, 0x05, 0x02, 0x02, 0x07, 0x0E, 0x07, 0x01, 0x04, 0x10,
+  0x01, 0x05, 0x0D, 0x01, 0x04, 0x10, 0x01, 0x03, 0x12, 0x02, 0x02, 0x08,
+  0x0E, 0x08, 0x02, 0x01, 0x07, 0x10, 0x07, 0x02, 0x01, 0x07, 0x10, 0x07,
+  0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00,
+  0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11,
+  0x07, 0x02, 0x00, 0x08, 0x10, 0x08, 0x02, 0x00, 0x08, 0x10, 0x07, 0x02,
+  0x01, 0x08, 0x0E, 0x09, 0x01, 0x01, 0x16, 0x01, 0x02, 0x14, 0x01, 0x03,
+  0x12, 0x01, 0x04, 0x10, 0x01, 0x05, 0x0D, 0x01, 0x08, 0x08, 0x01, 0x08,
+  0x08, 0x01, 0x06, 0x0C, 0x01, 0x04, 0x0F, 0x01, 0x03, 0x11, 0x01, 0x02,
+  0x13, 0x01, 0x02, 0x14, 0x02, 0x01, 0x09, 0x0E, 0x08, 0x02, 0x01, 0x07,
+  0x0F, 0x08, 0x02, 0x00, 0x08, 0x10, 0x07, 0x02, 0x00, 0x07, 0x11, 0x06,
+  0x02, 0x00, 0x07, 0x11, 0x06, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00,
+  0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11,
+  0x07, 0x02, 0x00, 0x08, 0x10, 0x08, 0x02, 0x01, 0x07, 0x0F, 0x09, 0x02,
+  0x01, 0x09, 0x0E, 0x0A, 0x01, 0x01, 0x17, 0x01, 0x02, 0x16, 0x01, 0x03,
+  0x15, 0x02, 0x04, 0x0C, 0x11, 0x07, 0x02, 0x05, 0x0A, 0x11, 0x07, 0x02,
+  0x07, 0x07, 0x11, 0x06, 0x01, 0x11, 0x06, 0x01, 0x10, 0x07, 0x01, 0x10,
+  0x07, 0x02, 0x01, 0x07, 0x0F, 0x07, 0x02, 0x01, 0x08, 0x0E, 0x08, 0x01,
+  0x01, 0x14, 0x01, 0x02, 0x13, 0x01, 0x02, 0x12, 0x01, 0x03, 0x10, 0x01,
+  0x05, 0x0C, 0x01, 0x07, 0x08, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01, 0x00, 0x06, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x03, 0x01, 0x16, 0x01, 0x01, 0x13, 0x04, 0x01, 0x11, 0x06,
+  0x01, 0x0E, 0x09, 0x01, 0x0B, 0x0C, 0x01, 0x09, 0x0E, 0x01, 0x06, 0x0E,
+  0x01, 0x03, 0x0E, 0x01, 0x01, 0x0D, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x07, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0D,
+  0x01, 0x03, 0x0D, 0x01, 0x05, 0x0E, 0x01, 0x08, 0x0E, 0x01, 0x0B, 0x0C,
+  0x01, 0x0D, 0x0A, 0x01, 0x10, 0x07, 0x01, 0x13, 0x04, 0x01, 0x16, 0x01,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x01, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x09, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0E,
+  0x01, 0x03, 0x0E, 0x01, 0x06, 0x0D, 0x01, 0x09, 0x0D, 0x01, 0x0C, 0x0B,
+  0x01, 0x0F, 0x08, 0x01, 0x11, 0x06, 0x01, 0x0F, 0x08, 0x01, 0x0C, 0x0B,
+  0x01, 0x0A, 0x0D, 0x01, 0x07, 0x0D, 0x01, 0x04, 0x0D, 0x01, 0x01, 0x0E,
+  0x01, 0x00, 0x0C, 0x01, 0x00, 0x09, 0x01, 0x00, 0x07, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x01, 0x01, 0x07, 0x08, 0x01, 0x05, 0x0D, 0x01, 0x03, 0x11,
+  0x01, 0x02, 0x13, 0x01, 0x02, 0x14, 0x01, 0x01, 0x15, 0x02, 0x01, 0x08,
+  0x0E, 0x09, 0x02, 0x01, 0x07, 0x0F, 0x08, 0x02, 0x00, 0x08, 0x10, 0x08,
+  0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00,
+  0x07, 0x11, 0x07, 0x01, 0x11, 0x07, 0x01, 0x10, 0x08, 0x01, 0x0F, 0x08,
+  0x01, 0x0E, 0x09, 0x01, 0x0D, 0x09, 0x01, 0x0C, 0x09, 0x01, 0x0A, 0x0A,
+  0x01, 0x0A, 0x09, 0x01, 0x09, 0x08, 0x01, 0x09, 0x07, 0x01, 0x08, 0x07,
+  0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x00, 0x00, 0x00, 0x01, 0x08, 0x07,
+  0x01, 0x08, 0x07, 0x01, 0x08, 0x07, 0x01, 0x08, 0x07, 0x01, 0x08, 0x07,
+  0x01, 0x08, 0x07, 0x01, 0x08, 0x07, 0x01, 0x13, 0x09, 0x01, 0x0F, 0x11,
+  0x01, 0x0D, 0x15, 0x01, 0x0B, 0x19, 0x02, 0x0A, 0x09, 0x1B, 0x0A, 0x02,
+  0x08, 0x08, 0x1E, 0x08, 0x02, 0x07, 0x08, 0x20, 0x07, 0x02, 0x06, 0x07,
+  0x21, 0x07, 0x02, 0x05, 0x07, 0x23, 0x05, 0x02, 0x05, 0x06, 0x24, 0x05,
+  0x02, 0x04, 0x06, 0x24, 0x05, 0x04, 0x03, 0x06, 0x14, 0x06, 0x1D, 0x04,
+  0x25, 0x05, 0x04, 0x03, 0x05, 0x12, 0x09, 0x1C, 0x05, 0x26, 0x04, 0x03,
+  0x02, 0x06, 0x10, 0x11, 0x26, 0x04, 0x04, 0x02, 0x05, 0x0F, 0x06, 0x19,
+  0x07, 0x27, 0x04, 0x04, 0x01, 0x06, 0x0E, 0x06, 0x1A, 0x06, 0x27, 0x04,
+  0x04, 0x01, 0x05, 0x0E, 0x05, 0x1B, 0x05, 0x27, 0x04, 0x04, 0x01, 0x05,
+  0x0D, 0x05, 0x1B, 0x04, 0x27, 0x04, 0x04, 0x00, 0x06, 0x0D, 0x04, 0x1B,
+  0x04, 0x27, 0x04, 0x04, 0x00, 0x05, 0x0C, 0x05, 0x1B, 0x04, 0x27, 0x04,
+  0x04, 0x00, 0x05, 0x0C, 0x04, 0x1B, 0x04, 0x27, 0x04, 0x04, 0x00, 0x05,
+  0x0C, 0x04, 0x1B, 0x03, 0x26, 0x05, 0x04, 0x00, 0x05, 0x0B, 0x05, 0x1A,
+  0x04, 0x26, 0x05, 0x04, 0x00, 0x05, 0x0B, 0x05, 0x1A, 0x04, 0x26, 0x04,
+  0x04, 0x00, 0x05, 0x0B, 0x05, 0x1A, 0x03, 0x25, 0x05, 0x04, 0x00, 0x05,
+  0x0B, 0x05, 0x19, 0x04, 0x25, 0x04, 0x04, 0x00, 0x06, 0x0B, 0x05, 0x18,
+  0x05, 0x24, 0x05, 0x04, 0x01, 0x05, 0x0B, 0x06, 0x17, 0x06, 0x23, 0x05,
+  0x04, 0x01, 0x05, 0x0C, 0x06, 0x16, 0x08, 0x21, 0x07, 0x02, 0x01, 0x06,
+  0x0C, 0x1B, 0x03, 0x02, 0x06, 0x0D, 0x0C, 0x1A, 0x0C, 0x03, 0x02, 0x07,
+  0x0E, 0x0A, 0x1B, 0x09, 0x03, 0x03, 0x07, 0x10, 0x06, 0x1D, 0x05, 0x01,
+  0x04, 0x07, 0x01, 0x05, 0x07, 0x01, 0x06, 0x08, 0x02, 0x07, 0x0A, 0x1D,
+  0x02, 0x01, 0x08, 0x18, 0x01, 0x0A, 0x16, 0x01, 0x0C, 0x13, 0x01, 0x10,
+  0x0B, 0x01, 0x0C, 0x09, 0x01, 0x0C, 0x09, 0x01, 0x0C, 0x09, 0x01, 0x0B,
+  0x0B, 0x01, 0x0B, 0x0B, 0x01, 0x0B, 0x0B, 0x01, 0x0A, 0x0D, 0x01, 0x0A,
+  0x0D, 0x02, 0x0A, 0x06, 0x11, 0x06, 0x02, 0x09, 0x07, 0x11, 0x07, 0x02,
+  0x09, 0x07, 0x11, 0x07, 0x02, 0x09, 0x06, 0x12, 0x06, 0x02, 0x08, 0x07,
+  0x12, 0x07, 0x02, 0x08, 0x07, 0x12, 0x07, 0x02, 0x07, 0x07, 0x13, 0x06,
+  0x02, 0x07, 0x07, 0x13, 0x07, 0x02, 0x07, 0x06, 0x13, 0x07, 0x02, 0x06,
+  0x07, 0x14, 0x07, 0x02, 0x06, 0x07, 0x14, 0x07, 0x02, 0x06, 0x06, 0x14,
+  0x07, 0x02, 0x05, 0x07, 0x15, 0x07, 0x01, 0x05, 0x17, 0x01, 0x05, 0x17,
+  0x01, 0x04, 0x19, 0x01, 0x04, 0x19, 0x01, 0x03, 0x1A, 0x01, 0x03, 0x1B,
+  0x02, 0x03, 0x07, 0x17, 0x07, 0x02, 0x02, 0x07, 0x17, 0x07, 0x02, 0x02,
+  0x07, 0x18, 0x07, 0x02, 0x02, 0x07, 0x18, 0x07, 0x02, 0x01, 0x07, 0x18,
+  0x07, 0x02, 0x01, 0x07, 0x19, 0x07, 0x02, 0x01, 0x07, 0x19, 0x07, 0x01,
+  0x00, 0x13, 0x01, 0x00, 0x16, 0x01, 0x00, 0x17, 0x01, 0x00, 0x18, 0x01,
+  0x00, 0x19, 0x01, 0x00, 0x19, 0x02, 0x00, 0x07, 0x11, 0x09, 0x02, 0x00,
+  0x07, 0x12, 0x08, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x13,
+  0x07, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02,
+  0x00, 0x07, 0x11, 0x08, 0x01, 0x00, 0x18, 0x01, 0x00, 0x17, 0x01, 0x00,
+  0x15, 0x01, 0x00, 0x17, 0x01, 0x00, 0x18, 0x01, 0x00, 0x19, 0x02, 0x00,
+  0x07, 0x12, 0x08, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x14,
+  0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02,
+  0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07,
+  0x13, 0x08, 0x02, 0x00, 0x07, 0x12, 0x08, 0x01, 0x00, 0x1A, 0x01, 0x00,
+  0x19, 0x01, 0x00, 0x19, 0x01, 0x00, 0x18, 0x01, 0x00, 0x16, 0x01, 0x00,
+  0x13, 0x01, 0x0B, 0x09, 0x01, 0x08, 0x0F, 0x01, 0x07, 0x12, 0x01, 0x05,
+  0x15, 0x01, 0x04, 0x17, 0x01, 0x04, 0x18, 0x02, 0x03, 0x0A, 0x13, 0x09,
+  0x02, 0x02, 0x09, 0x15, 0x08, 0x02, 0x02, 0x08, 0x15, 0x08, 0x02, 0x01,
+  0x08, 0x16, 0x07, 0x02, 0x01, 0x08, 0x17, 0x07, 0x02, 0x01, 0x07, 0x17,
+  0x07, 0x01, 0x01, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x01,
+  0x07, 0x02, 0x01, 0x07, 0x17, 0x07, 0x02, 0x01, 0x07, 0x17, 0x07, 0x02,
+  0x01, 0x08, 0x16, 0x08, 0x02, 0x02, 0x08, 0x16, 0x07, 0x02, 0x02, 0x09,
+  0x15, 0x08, 0x02, 0x03, 0x0A, 0x13, 0x09, 0x01, 0x04, 0x18, 0x01, 0x04,
+  0x17, 0x01, 0x05, 0x15, 0x01, 0x07, 0x12, 0x01, 0x08, 0x0F, 0x01, 0x0B,
+  0x09, 0x01, 0x00, 0x12, 0x01, 0x00, 0x15, 0x01, 0x00, 0x16, 0x01, 0x00,
+  0x17, 0x01, 0x00, 0x18, 0x01, 0x00, 0x19, 0x02, 0x00, 0x07, 0x10, 0x0A,
+  0x02, 0x00, 0x07, 0x12, 0x08, 0x02, 0x00, 0x07, 0x13, 0x08, 0x02, 0x00,
+  0x07, 0x13, 0x08, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14,
+  0x07, 0x02, 0x00, 0x07, 0x15, 0x07, 0x02, 0x00, 0x07, 0x15, 0x07, 0x02,
+  0x00, 0x07, 0x15, 0x07, 0x02, 0x00, 0x07, 0x15, 0x07, 0x02, 0x00, 0x07,
+  0x15, 0x07, 0x02, 0x00, 0x07, 0x15, 0x07, 0x02, 0x00, 0x07, 0x15, 0x07,
+  0x02, 0x00, 0x07, 0x15, 0x07, 0x02, 0x00, 0x07, 0x15, 0x07, 0x02, 0x00,
+  0x07, 0x15, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14,
+  0x07, 0x02, 0x00, 0x07, 0x13, 0x08, 0x02, 0x00, 0x07, 0x13, 0x08, 0x02,
+  0x00, 0x07, 0x12, 0x08, 0x02, 0x00, 0x07, 0x10, 0x0A, 0x01, 0x00, 0x19,
+  0x01, 0x00, 0x18, 0x01, 0x00, 0x17, 0x01, 0x00, 0x16, 0x01, 0x00, 0x15,
+  0x01, 0x00, 0x12, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18,
+  0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x19, 0x01, 0x00, 0x19, 0x01, 0x00, 0x19,
+  0x01, 0x00, 0x19, 0x01, 0x00, 0x19, 0x01, 0x00, 0x19, 0x01, 0x00, 0x18,
+  0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18,
+  0x01, 0x00, 0x18, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16,
+  0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x0C, 0x09, 0x01, 0x09, 0x0F, 0x01, 0x07, 0x13,
+  0x01, 0x06, 0x15, 0x01, 0x05, 0x17, 0x01, 0x04, 0x19, 0x02, 0x03, 0x0A,
+  0x14, 0x0A, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x02, 0x08, 0x17, 0x07,
+  0x02, 0x02, 0x07, 0x18, 0x07, 0x02, 0x01, 0x08, 0x18, 0x07, 0x01, 0x01,
+  0x07, 0x01, 0x01, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x02, 0x00, 0x07, 0x12, 0x0D, 0x02, 0x00, 0x07, 0x12, 0x0D, 0x02,
+  0x00, 0x07, 0x12, 0x0D, 0x02, 0x00, 0x07, 0x12, 0x0D, 0x02, 0x00, 0x07,
+  0x12, 0x0D, 0x02, 0x00, 0x07, 0x12, 0x0D, 0x02, 0x00, 0x08, 0x19, 0x06,
+  0x02, 0x01, 0x07, 0x19, 0x06, 0x02, 0x01, 0x07, 0x19, 0x06, 0x02, 0x01,
+  0x08, 0x18, 0x07, 0x02, 0x02, 0x08, 0x18, 0x07, 0x02, 0x02, 0x09, 0x17,
+  0x08, 0x02, 0x03, 0x09, 0x16, 0x09, 0x02, 0x03, 0x0B, 0x13, 0x0C, 0x01,
+  0x04, 0x1B, 0x02, 0x05, 0x14, 0x1A, 0x05, 0x02, 0x06, 0x13, 0x1B, 0x04,
+  0x02, 0x07, 0x11, 0x1B, 0x04, 0x02, 0x09, 0x0D, 0x1B, 0x04, 0x01, 0x0C,
+  0x08, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02,
+  0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07,
+  0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07,
+  0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00,
+  0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14,
+  0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x01, 0x00, 0x1B, 0x01, 0x00, 0x1B,
+  0x01, 0x00, 0x1B, 0x01, 0x00, 0x1B, 0x01, 0x00, 0x1B, 0x01, 0x00, 0x1B,
+  0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00,
+  0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14,
+  0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02,
+  0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07,
+  0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07,
+  0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00,
+  0x07, 0x14, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x0F, 0x07,
+  0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07,
+  0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07,
+  0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07,
+  0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07,
+  0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07,
+  0x01, 0x0F, 0x07, 0x02, 0x00, 0x07, 0x0F, 0x07, 0x02, 0x00, 0x07, 0x0F,
+  0x07, 0x02, 0x00, 0x07, 0x0F, 0x07, 0x02, 0x00, 0x07, 0x0F, 0x07, 0x02,
+  0x00, 0x07, 0x0F, 0x07, 0x02, 0x00, 0x08, 0x0E, 0x08, 0x02, 0x00, 0x09,
+  0x0D, 0x09, 0x01, 0x01, 0x14, 0x01, 0x01, 0x14, 0x01, 0x02, 0x12, 0x01,
+  0x03, 0x10, 0x01, 0x04, 0x0E, 0x01, 0x07, 0x08, 0x02, 0x00, 0x07, 0x14,
+  0x08, 0x02, 0x00, 0x07, 0x13, 0x08, 0x02, 0x00, 0x07, 0x12, 0x08, 0x02,
+  0x00, 0x07, 0x11, 0x08, 0x02, 0x00, 0x07, 0x10, 0x09, 0x02, 0x00, 0x07,
+  0x0F, 0x09, 0x02, 0x00, 0x07, 0x0F, 0x08, 0x02, 0x00, 0x07, 0x0E, 0x08,
+  0x02, 0x00, 0x07, 0x0D, 0x08, 0x02, 0x00, 0x07, 0x0C, 0x08, 0x02, 0x00,
+  0x07, 0x0B, 0x08, 0x02, 0x00, 0x07, 0x0A, 0x08, 0x02, 0x00, 0x07, 0x09,
+  0x08, 0x02, 0x00, 0x07, 0x08, 0x08, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x10,
+  0x01, 0x00, 0x10, 0x01, 0x00, 0x11, 0x01, 0x00, 0x12, 0x02, 0x00, 0x0A,
+  0x0B, 0x08, 0x02, 0x00, 0x09, 0x0C, 0x08, 0x02, 0x00, 0x08, 0x0C, 0x08,
+  0x02, 0x00, 0x07, 0x0D, 0x08, 0x02, 0x00, 0x07, 0x0E, 0x08, 0x02, 0x00,
+  0x07, 0x0F, 0x08, 0x02, 0x00, 0x07, 0x0F, 0x09, 0x02, 0x00, 0x07, 0x10,
+  0x08, 0x02, 0x00, 0x07, 0x11, 0x08, 0x02, 0x00, 0x07, 0x12, 0x08, 0x02,
+  0x00, 0x07, 0x12, 0x09, 0x02, 0x00, 0x07, 0x13, 0x08, 0x02, 0x00, 0x07,
+  0x14, 0x08, 0x02, 0x00, 0x07, 0x15, 0x08, 0x02, 0x00, 0x07, 0x15, 0x09,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x02, 0x00, 0x0B, 0x16, 0x0B, 0x02,
+  0x00, 0x0B, 0x16, 0x0B, 0x02, 0x00, 0x0B, 0x16, 0x0B, 0x02, 0x00, 0x0B,
+  0x16, 0x0B, 0x02, 0x00, 0x0B, 0x15, 0x0C, 0x02, 0x00, 0x0C, 0x15, 0x0C,
+  0x02, 0x00, 0x0C, 0x15, 0x0C, 0x02, 0x00, 0x0C, 0x15, 0x0C, 0x02, 0x00,
+  0x0C, 0x15, 0x0C, 0x02, 0x00, 0x0D, 0x14, 0x0D, 0x04, 0x00, 0x07, 0x08,
+  0x05, 0x14, 0x05, 0x1A, 0x07, 0x04, 0x00, 0x07, 0x08, 0x05, 0x14, 0x05,
+  0x1A, 0x07, 0x04, 0x00, 0x07, 0x08, 0x05, 0x14, 0x05, 0x1A, 0x07, 0x04,
+  0x00, 0x07, 0x08, 0x05, 0x13, 0x06, 0x1A, 0x07, 0x04, 0x00, 0x07, 0x08,
+  0x06, 0x13, 0x05, 0x1A, 0x07, 0x04, 0x00, 0x07, 0x09, 0x05, 0x13, 0x05,
+  0x1A, 0x07, 0x04, 0x00, 0x07, 0x09, 0x05, 0x13, 0x05, 0x1A, 0x07, 0x04,
+  0x00, 0x07, 0x09, 0x05, 0x13, 0x05, 0x1A, 0x07, 0x04, 0x00, 0x07, 0x09,
+  0x06, 0x12, 0x05, 0x1A, 0x07, 0x04, 0x00, 0x07, 0x0A, 0x05, 0x12, 0x05,
+  0x1A, 0x07, 0x04, 0x00, 0x07, 0x0A, 0x05, 0x12, 0x05, 0x1A, 0x07, 0x04,
+  0x00, 0x07, 0x0A, 0x05, 0x12, 0x05, 0x1A, 0x07, 0x04, 0x00, 0x07, 0x0A,
+  0x06, 0x12, 0x05, 0x1A, 0x07, 0x04, 0x00, 0x07, 0x0B, 0x05, 0x11, 0x05,
+  0x1A, 0x07, 0x04, 0x00, 0x07, 0x0B, 0x05, 0x11, 0x05, 0x1A, 0x07, 0x04,
+  0x00, 0x07, 0x0B, 0x05, 0x11, 0x05, 0x1A, 0x07, 0x04, 0x00, 0x07, 0x0B,
+  0x05, 0x11, 0x05, 0x1A, 0x07, 0x03, 0x00, 0x07, 0x0B, 0x0A, 0x1A, 0x07,
+  0x03, 0x00, 0x07, 0x0C, 0x09, 0x1A, 0x07, 0x03, 0x00, 0x07, 0x0C, 0x09,
+  0x1A, 0x07, 0x03, 0x00, 0x07, 0x0C, 0x09, 0x1A, 0x07, 0x03, 0x00, 0x07,
+  0x0C, 0x09, 0x1A, 0x07, 0x03, 0x00, 0x07, 0x0D, 0x07, 0x1A, 0x07, 0x03,
+  0x00, 0x07, 0x0D, 0x07, 0x1A, 0x07, 0x02, 0x00, 0x07, 0x15, 0x07, 0x02,
+  0x00, 0x08, 0x15, 0x07, 0x02, 0x00, 0x09, 0x15, 0x07, 0x02, 0x00, 0x09,
+  0x15, 0x07, 0x02, 0x00, 0x0A, 0x15, 0x07, 0x02, 0x00, 0x0A, 0x15, 0x07,
+  0x02, 0x00, 0x0B, 0x15, 0x07, 0x02, 0x00, 0x0C, 0x15, 0x07, 0x02, 0x00,
+  0x0C, 0x15, 0x07, 0x02, 0x00, 0x0D, 0x15, 0x07, 0x02, 0x00, 0x0D, 0x15,
+  0x07, 0x03, 0x00, 0x07, 0x08, 0x06, 0x15, 0x07, 0x03, 0x00, 0x07, 0x08,
+  0x07, 0x15, 0x07, 0x03, 0x00, 0x07, 0x09, 0x06, 0x15, 0x07, 0x03, 0x00,
+  0x07, 0x09, 0x07, 0x15, 0x07, 0x03, 0x00, 0x07, 0x0A, 0x06, 0x15, 0x07,
+  0x03, 0x00, 0x07, 0x0B, 0x06, 0x15, 0x07, 0x03, 0x00, 0x07, 0x0B, 0x07,
+  0x15, 0x07, 0x03, 0x00, 0x07, 0x0C, 0x06, 0x15, 0x07, 0x03, 0x00, 0x07,
+  0x0C, 0x07, 0x15, 0x07, 0x03, 0x00, 0x07, 0x0D, 0x06, 0x15, 0x07, 0x03,
+  0x00, 0x07, 0x0E, 0x06, 0x15, 0x07, 0x02, 0x00, 0x07, 0x0E, 0x0E, 0x02,
+  0x00, 0x07, 0x0F, 0x0D, 0x02, 0x00, 0x07, 0x0F, 0x0D, 0x02, 0x00, 0x07,
+  0x10, 0x0C, 0x02, 0x00, 0x07, 0x11, 0x0B, 0x02, 0x00, 0x07, 0x11, 0x0B,
+  0x02, 0x00, 0x07, 0x12, 0x0A, 0x02, 0x00, 0x07, 0x12, 0x0A, 0x02, 0x00,
+  0x07, 0x13, 0x09, 0x02, 0x00, 0x07, 0x14, 0x08, 0x02, 0x00, 0x07, 0x14,
+  0x08, 0x02, 0x00, 0x07, 0x15, 0x07, 0x01, 0x0C, 0x09, 0x01, 0x09, 0x0F,
+  0x01, 0x07, 0x12, 0x01, 0x06, 0x15, 0x01, 0x05, 0x17, 0x01, 0x04, 0x19,
+  0x02, 0x03, 0x0A, 0x14, 0x0A, 0x02, 0x03, 0x08, 0x15, 0x09, 0x02, 0x02,
+  0x08, 0x17, 0x08, 0x02, 0x02, 0x07, 0x18, 0x07, 0x02, 0x01, 0x08, 0x18,
+  0x08, 0x02, 0x01, 0x07, 0x19, 0x07, 0x02, 0x01, 0x07, 0x19, 0x07, 0x02,
+  0x00, 0x08, 0x19, 0x08, 0x02, 0x00, 0x07, 0x1A, 0x07, 0x02, 0x00, 0x07,
+  0x1A, 0x07, 0x02, 0x00, 0x07, 0x1A, 0x07, 0x02, 0x00, 0x07, 0x1A, 0x07,
+  0x02, 0x00, 0x07, 0x1A, 0x07, 0x02, 0x00, 0x07, 0x1A, 0x07, 0x02, 0x00,
+  0x07, 0x1A, 0x07, 0x02, 0x00, 0x07, 0x1A, 0x07, 0x02, 0x00, 0x08, 0x19,
+  0x08, 0x02, 0x01, 0x07, 0x19, 0x07, 0x02, 0x01, 0x07, 0x19, 0x07, 0x02,
+  0x01, 0x08, 0x18, 0x08, 0x02, 0x02, 0x07, 0x18, 0x07, 0x02, 0x02, 0x08,
+  0x17, 0x08, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x03, 0x0A, 0x14, 0x0A,
+  0x01, 0x04, 0x19, 0x01, 0x05, 0x17, 0x01, 0x06, 0x15, 0x01, 0x07, 0x13,
+  0x01, 0x09, 0x0F, 0x01, 0x0C, 0x09, 0x01, 0x00, 0x13, 0x01, 0x00, 0x16,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x18, 0x01, 0x00, 0x19, 0x01, 0x00, 0x19,
+  0x02, 0x00, 0x07, 0x10, 0x09, 0x02, 0x00, 0x07, 0x12, 0x08, 0x02, 0x00,
+  0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x13,
+  0x07, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02,
+  0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x12, 0x08, 0x02, 0x00, 0x07,
+  0x10, 0x09, 0x01, 0x00, 0x19, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01,
+  0x00, 0x17, 0x01, 0x00, 0x15, 0x01, 0x00, 0x13, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x0C, 0x09, 0x01,
+  0x09, 0x0F, 0x01, 0x07, 0x12, 0x01, 0x06, 0x15, 0x01, 0x05, 0x17, 0x01,
+  0x04, 0x19, 0x02, 0x03, 0x0A, 0x14, 0x0A, 0x02, 0x03, 0x08, 0x16, 0x08,
+  0x02, 0x02, 0x08, 0x17, 0x08, 0x02, 0x02, 0x07, 0x18, 0x07, 0x02, 0x01,
+  0x08, 0x18, 0x08, 0x02, 0x01, 0x07, 0x19, 0x07, 0x02, 0x01, 0x07, 0x19,
+  0x07, 0x02, 0x00, 0x08, 0x19, 0x08, 0x02, 0x00, 0x07, 0x1A, 0x07, 0x02,
+  0x00, 0x07, 0x1A, 0x07, 0x02, 0x00, 0x07, 0x1A, 0x07, 0x02, 0x00, 0x07,
+  0x1A, 0x07, 0x02, 0x00, 0x07, 0x1A, 0x07, 0x02, 0x00, 0x07, 0x1A, 0x07,
+  0x02, 0x00, 0x07, 0x1A, 0x07, 0x02, 0x00, 0x07, 0x1A, 0x07, 0x03, 0x00,
+  0x08, 0x14, 0x01, 0x19, 0x08, 0x03, 0x01, 0x07, 0x13, 0x03, 0x19, 0x07,
+  0x03, 0x01, 0x07, 0x12, 0x05, 0x19, 0x07, 0x02, 0x01, 0x08, 0x11, 0x0F,
+  0x02, 0x02, 0x07, 0x12, 0x0D, 0x02, 0x02, 0x08, 0x13, 0x0C, 0x02, 0x03,
+  0x08, 0x14, 0x0A, 0x02, 0x03, 0x0A, 0x14, 0x0A, 0x01, 0x04, 0x1A, 0x01,
+  0x05, 0x1A, 0x01, 0x06, 0x1A, 0x01, 0x07, 0x1A, 0x02, 0x09, 0x0F, 0x1A,
+  0x06, 0x02, 0x0C, 0x09, 0x1B, 0x04, 0x01, 0x1C, 0x02, 0x01, 0x00, 0x15,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x19, 0x01, 0x00, 0x19, 0x01, 0x00, 0x1A,
+  0x01, 0x00, 0x1A, 0x02, 0x00, 0x07, 0x12, 0x09, 0x02, 0x00, 0x07, 0x13,
+  0x08, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02,
+  0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07,
+  0x14, 0x07, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x12, 0x08,
+  0x01, 0x00, 0x19, 0x01, 0x00, 0x18, 0x01, 0x00, 0x16, 0x01, 0x00, 0x17,
+  0x01, 0x00, 0x18, 0x01, 0x00, 0x19, 0x02, 0x00, 0x07, 0x11, 0x08, 0x02,
+  0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07,
+  0x13, 0x07, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x13, 0x07,
+  0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x00,
+  0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x13,
+  0x07, 0x02, 0x00, 0x07, 0x13, 0x08, 0x02, 0x00, 0x07, 0x14, 0x08, 0x01,
+  0x08, 0x0A, 0x01, 0x06, 0x0F, 0x01, 0x04, 0x13, 0x01, 0x03, 0x15, 0x01,
+  0x02, 0x17, 0x01, 0x01, 0x19, 0x02, 0x01, 0x09, 0x10, 0x0A, 0x02, 0x00,
+  0x08, 0x12, 0x09, 0x02, 0x00, 0x07, 0x13, 0x08, 0x02, 0x00, 0x07, 0x14,
+  0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x0A, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x12, 0x01, 0x02, 0x14,
+  0x01, 0x03, 0x15, 0x01, 0x05, 0x15, 0x01, 0x08, 0x13, 0x01, 0x0D, 0x0E,
+  0x01, 0x12, 0x0A, 0x01, 0x14, 0x08, 0x01, 0x14, 0x08, 0x01, 0x15, 0x07,
+  0x02, 0x00, 0x07, 0x15, 0x07, 0x02, 0x00, 0x07, 0x15, 0x07, 0x02, 0x00,
+  0x07, 0x14, 0x08, 0x02, 0x00, 0x08, 0x14, 0x07, 0x02, 0x01, 0x09, 0x12,
+  0x09, 0x01, 0x01, 0x1A, 0x01, 0x02, 0x18, 0x01, 0x03, 0x16, 0x01, 0x04,
+  0x14, 0x01, 0x06, 0x10, 0x01, 0x09, 0x0A, 0x01, 0x00, 0x1B, 0x01, 0x00,
+  0x1B, 0x01, 0x00, 0x1B, 0x01, 0x00, 0x1B, 0x01, 0x00, 0x1B, 0x01, 0x00,
+  0x1B, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A,
+  0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A,
+  0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A,
+  0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A,
+  0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A,
+  0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A,
+  0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A,
+  0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02,
+  0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07,
+  0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07,
+  0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00,
+  0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14,
+  0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02,
+  0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07,
+  0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07,
+  0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00,
+  0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14,
+  0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02,
+  0x00, 0x08, 0x13, 0x08, 0x02, 0x01, 0x08, 0x12, 0x08, 0x02, 0x01, 0x09,
+  0x11, 0x09, 0x01, 0x02, 0x17, 0x01, 0x02, 0x17, 0x01, 0x03, 0x15, 0x01,
+  0x04, 0x13, 0x01, 0x06, 0x0F, 0x01, 0x09, 0x09, 0x02, 0x00, 0x07, 0x16,
+  0x07, 0x02, 0x00, 0x07, 0x16, 0x07, 0x02, 0x01, 0x07, 0x15, 0x07, 0x02,
+  0x01, 0x07, 0x15, 0x07, 0x02, 0x01, 0x07, 0x15, 0x07, 0x02, 0x02, 0x07,
+  0x15, 0x06, 0x02, 0x02, 0x07, 0x14, 0x07, 0x02, 0x02, 0x07, 0x14, 0x07,
+  0x02, 0x03, 0x07, 0x14, 0x06, 0x02, 0x03, 0x07, 0x13, 0x07, 0x02, 0x04,
+  0x06, 0x13, 0x07, 0x02, 0x04, 0x06, 0x13, 0x06, 0x02, 0x04, 0x07, 0x12,
+  0x07, 0x02, 0x05, 0x06, 0x12, 0x07, 0x02, 0x05, 0x06, 0x12, 0x06, 0x02,
+  0x05, 0x07, 0x12, 0x06, 0x02, 0x06, 0x06, 0x11, 0x07, 0x02, 0x06, 0x06,
+  0x11, 0x06, 0x02, 0x06, 0x07, 0x11, 0x06, 0x02, 0x07, 0x06, 0x10, 0x06,
+  0x02, 0x07, 0x06, 0x10, 0x06, 0x02, 0x07, 0x06, 0x10, 0x06, 0x02, 0x08,
+  0x06, 0x10, 0x05, 0x02, 0x08, 0x06, 0x0F, 0x06, 0x02, 0x08, 0x06, 0x0F,
+  0x06, 0x01, 0x09, 0x0B, 0x01, 0x09, 0x0B, 0x01, 0x09, 0x0B, 0x01, 0x0A,
+  0x09, 0x01, 0x0A, 0x09, 0x01, 0x0A, 0x09, 0x01, 0x0B, 0x07, 0x01, 0x0B,
+  0x07, 0x01, 0x0B, 0x07, 0x03, 0x00, 0x08, 0x12, 0x07, 0x23, 0x08, 0x03,
+  0x00, 0x08, 0x12, 0x07, 0x23, 0x08, 0x03, 0x01, 0x07, 0x11, 0x08, 0x23,
+  0x07, 0x03, 0x01, 0x07, 0x11, 0x09, 0x23, 0x07, 0x03, 0x01, 0x07, 0x11,
+  0x09, 0x23, 0x07, 0x03, 0x02, 0x07, 0x11, 0x09, 0x22, 0x08, 0x03, 0x02,
+  0x07, 0x11, 0x09, 0x22, 0x07, 0x03, 0x02, 0x07, 0x10, 0x0B, 0x22, 0x07,
+  0x04, 0x02, 0x07, 0x10, 0x05, 0x16, 0x05, 0x22, 0x07, 0x04, 0x03, 0x06,
+  0x10, 0x05, 0x16, 0x05, 0x22, 0x06, 0x04, 0x03, 0x07, 0x10, 0x05, 0x16,
+  0x05, 0x21, 0x07, 0x04, 0x03, 0x07, 0x10, 0x05, 0x16, 0x05, 0x21, 0x07,
+  0x04, 0x04, 0x06, 0x0F, 0x06, 0x17, 0x05, 0x21, 0x07, 0x04, 0x04, 0x06,
+  0x0F, 0x05, 0x17, 0x05, 0x21, 0x06, 0x04, 0x04, 0x06, 0x0F, 0x05, 0x17,
+  0x05, 0x21, 0x06, 0x04, 0x04, 0x07, 0x0F, 0x05, 0x17, 0x05, 0x20, 0x07,
+  0x04, 0x05, 0x06, 0x0F, 0x05, 0x18, 0x05, 0x20, 0x06, 0x04, 0x05, 0x06,
+  0x0E, 0x06, 0x18, 0x05, 0x20, 0x06, 0x04, 0x05, 0x06, 0x0E, 0x05, 0x18,
+  0x05, 0x20, 0x06, 0x04, 0x06, 0x06, 0x0E, 0x05, 0x18, 0x05, 0x20, 0x06,
+  0x04, 0x06, 0x06, 0x0E, 0x05, 0x18, 0x05, 0x1F, 0x06, 0x04, 0x06, 0x06,
+  0x0E, 0x05, 0x19, 0x05, 0x1F, 0x06, 0x04, 0x06, 0x06, 0x0D, 0x05, 0x19,
+  0x05, 0x1F, 0x06, 0x04, 0x07, 0x05, 0x0D, 0x05, 0x19, 0x05, 0x1F, 0x06,
+  0x03, 0x07, 0x0B, 0x19, 0x05, 0x1F, 0x05, 0x02, 0x07, 0x0B, 0x19, 0x0B,
+  0x02, 0x08, 0x0A, 0x1A, 0x0A, 0x02, 0x08, 0x09, 0x1A, 0x09, 0x02, 0x08,
+  0x09, 0x1A, 0x09, 0x02, 0x08, 0x09, 0x1A, 0x09, 0x02, 0x09, 0x08, 0x1B,
+  0x08, 0x02, 0x09, 0x08, 0x1B, 0x07, 0x02, 0x09, 0x07, 0x1B, 0x07, 0x02,
+  0x0A, 0x06, 0x1B, 0x07, 0x02, 0x01, 0x08, 0x15, 0x08, 0x02, 0x01, 0x09,
+  0x14, 0x08, 0x02, 0x02, 0x08, 0x14, 0x08, 0x02, 0x03, 0x08, 0x13, 0x08,
+  0x02, 0x03, 0x08, 0x13, 0x07, 0x02, 0x04, 0x08, 0x12, 0x08, 0x02, 0x04,
+  0x08, 0x11, 0x08, 0x02, 0x05, 0x08, 0x11, 0x08, 0x02, 0x06, 0x07, 0x10,
+  0x08, 0x02, 0x06, 0x08, 0x10, 0x07, 0x02, 0x07, 0x07, 0x0F, 0x08, 0x01,
+  0x08, 0x0E, 0x01, 0x08, 0x0D, 0x01, 0x09, 0x0C, 0x01, 0x09, 0x0B, 0x01,
+  0x0A, 0x09, 0x01, 0x0B, 0x08, 0x01, 0x0A, 0x09, 0x01, 0x0A, 0x0A, 0x01,
+  0x09, 0x0B, 0x01, 0x09, 0x0C, 0x01, 0x08, 0x0E, 0x01, 0x07, 0x0F, 0x02,
+  0x07, 0x07, 0x0F, 0x08, 0x02, 0x06, 0x07, 0x10, 0x08, 0x02, 0x05, 0x08,
+  0x11, 0x07, 0x02, 0x05, 0x07, 0x11, 0x08, 0x02, 0x04, 0x08, 0x12, 0x08,
+  0x02, 0x03, 0x08, 0x12, 0x08, 0x02, 0x03, 0x08, 0x13, 0x08, 0x02, 0x02,
+  0x08, 0x13, 0x08, 0x02, 0x02, 0x08, 0x14, 0x08, 0x02, 0x01, 0x08, 0x14,
+  0x09, 0x02, 0x00, 0x09, 0x15, 0x08, 0x02, 0x00, 0x08, 0x15, 0x08, 0x02,
+  0x00, 0x08, 0x14, 0x08, 0x02, 0x01, 0x08, 0x14, 0x08, 0x02, 0x01, 0x08,
+  0x13, 0x08, 0x02, 0x02, 0x08, 0x13, 0x08, 0x02, 0x03, 0x07, 0x13, 0x07,
+  0x02, 0x03, 0x07, 0x12, 0x08, 0x02, 0x04, 0x07, 0x12, 0x07, 0x02, 0x04,
+  0x07, 0x11, 0x08, 0x02, 0x05, 0x07, 0x11, 0x07, 0x02, 0x05, 0x07, 0x10,
+  0x08, 0x02, 0x06, 0x07, 0x10, 0x07, 0x02, 0x06, 0x07, 0x10, 0x07, 0x02,
+  0x07, 0x07, 0x0F, 0x07, 0x02, 0x07, 0x07, 0x0F, 0x07, 0x01, 0x08, 0x0D,
+  0x01, 0x08, 0x0D, 0x01, 0x09, 0x0B, 0x01, 0x09, 0x0A, 0x01, 0x0A, 0x09,
+  0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07,
+  0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07,
+  0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07,
+  0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A,
+  0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A,
+  0x01, 0x12, 0x08, 0x01, 0x11, 0x08, 0x01, 0x10, 0x08, 0x01, 0x0F, 0x08,
+  0x01, 0x0E, 0x09, 0x01, 0x0E, 0x08, 0x01, 0x0D, 0x08, 0x01, 0x0C, 0x08,
+  0x01, 0x0B, 0x08, 0x01, 0x0A, 0x09, 0x01, 0x0A, 0x08, 0x01, 0x09, 0x08,
+  0x01, 0x08, 0x08, 0x01, 0x07, 0x08, 0x01, 0x06, 0x09, 0x01, 0x06, 0x08,
+  0x01, 0x05, 0x08, 0x01, 0x04, 0x08, 0x01, 0x03, 0x08, 0x01, 0x02, 0x09,
+  0x01, 0x02, 0x08, 0x01, 0x01, 0x08, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A,
+  0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A,
+  0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B,
+  0x01, 0x00, 0x0B, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B,
+  0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x04, 0x01, 0x03, 0x03,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x04, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x04, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03,
+  0x01, 0x09, 0x04, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x04,
+  0x01, 0x0B, 0x03, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B,
+  0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07,
+  0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07,
+  0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07,
+  0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07,
+  0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07,
+  0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07,
+  0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07,
+  0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07,
+  0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x00, 0x0B,
+  0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B,
+  0x01, 0x08, 0x06, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x06, 0x09,
+  0x01, 0x06, 0x09, 0x01, 0x06, 0x0A, 0x02, 0x05, 0x05, 0x0B, 0x05, 0x02,
+  0x05, 0x05, 0x0B, 0x05, 0x02, 0x04, 0x06, 0x0B, 0x06, 0x02, 0x04, 0x05,
+  0x0C, 0x05, 0x02, 0x04, 0x05, 0x0C, 0x06, 0x02, 0x03, 0x06, 0x0D, 0x05,
+  0x02, 0x03, 0x05, 0x0D, 0x05, 0x02, 0x02, 0x06, 0x0D, 0x06, 0x02, 0x02,
+  0x05, 0x0E, 0x05, 0x02, 0x02, 0x05, 0x0E, 0x06, 0x02, 0x01, 0x06, 0x0F,
+  0x05, 0x02, 0x01, 0x05, 0x0F, 0x05, 0x02, 0x01, 0x05, 0x0F, 0x06, 0x02,
+  0x00, 0x05, 0x10, 0x05, 0x01, 0x00, 0x1C, 0x01, 0x00, 0x1C, 0x01, 0x00,
+  0x1C, 0x01, 0x00, 0x1C, 0x01, 0x00, 0x06, 0x01, 0x01, 0x05, 0x01, 0x02,
+  0x05, 0x01, 0x03, 0x04, 0x01, 0x04, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x04, 0x01, 0x07, 0x09, 0x01, 0x04, 0x0E, 0x01, 0x03, 0x11, 0x01, 0x02,
+  0x13, 0x01, 0x01, 0x14, 0x01, 0x01, 0x15, 0x02, 0x01, 0x07, 0x0E, 0x08,
+  0x02, 0x01, 0x06, 0x0F, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0E, 0x08, 0x01,
+  0x0C, 0x0A, 0x01, 0x06, 0x10, 0x01, 0x03, 0x13, 0x01, 0x02, 0x14, 0x02,
+  0x01, 0x09, 0x0F, 0x07, 0x02, 0x00, 0x08, 0x0F, 0x07, 0x02, 0x00, 0x07,
+  0x0F, 0x07, 0x02, 0x00, 0x07, 0x0E, 0x08, 0x02, 0x00, 0x07, 0x0E, 0x08,
+  0x02, 0x00, 0x08, 0x0D, 0x09, 0x01, 0x00, 0x16, 0x01, 0x01, 0x15, 0x01,
+  0x01, 0x15, 0x02, 0x02, 0x0C, 0x0F, 0x08, 0x02, 0x03, 0x09, 0x10, 0x08,
+  0x01, 0x05, 0x06, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x02, 0x00, 0x07, 0x0B, 0x06, 0x02,
+  0x00, 0x07, 0x09, 0x0A, 0x02, 0x00, 0x07, 0x08, 0x0D, 0x01, 0x00, 0x16,
+  0x01, 0x00, 0x16, 0x01, 0x00, 0x17, 0x02, 0x00, 0x0A, 0x0F, 0x09, 0x02,
+  0x00, 0x09, 0x10, 0x08, 0x02, 0x00, 0x08, 0x11, 0x07, 0x02, 0x00, 0x08,
+  0x11, 0x08, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07,
+  0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00,
+  0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x08, 0x11,
+  0x08, 0x02, 0x00, 0x08, 0x11, 0x07, 0x02, 0x00, 0x09, 0x10, 0x08, 0x02,
+  0x00, 0x0A, 0x0F, 0x09, 0x01, 0x00, 0x17, 0x01, 0x00, 0x16, 0x01, 0x00,
+  0x16, 0x02, 0x00, 0x07, 0x08, 0x0D, 0x02, 0x00, 0x07, 0x09, 0x0A, 0x01,
+  0x0B, 0x06, 0x01, 0x08, 0x08, 0x01, 0x06, 0x0D, 0x01, 0x04, 0x10, 0x01,
+  0x03, 0x12, 0x01, 0x02, 0x14, 0x01, 0x02, 0x14, 0x02, 0x01, 0x09, 0x0F,
+  0x08, 0x02, 0x01, 0x08, 0x10, 0x07, 0x02, 0x01, 0x07, 0x11, 0x06, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x02,
+  0x01, 0x07, 0x11, 0x06, 0x02, 0x01, 0x08, 0x10, 0x07, 0x02, 0x01, 0x09,
+  0x0F, 0x08, 0x01, 0x02, 0x14, 0x01, 0x02, 0x14, 0x01, 0x03, 0x12, 0x01,
+  0x04, 0x10, 0x01, 0x06, 0x0D, 0x01, 0x08, 0x08, 0x01, 0x12, 0x07, 0x01,
+  0x12, 0x07, 0x01, 0x12, 0x07, 0x01, 0x12, 0x07, 0x01, 0x12, 0x07, 0x01,
+  0x12, 0x07, 0x01, 0x12, 0x07, 0x01, 0x12, 0x07, 0x01, 0x12, 0x07, 0x02,
+  0x08, 0x06, 0x12, 0x07, 0x02, 0x06, 0x0A, 0x12, 0x07, 0x02, 0x04, 0x0D,
+  0x12, 0x07, 0x01, 0x03, 0x16, 0x01, 0x03, 0x16, 0x01, 0x02, 0x17, 0x02,
+  0x01, 0x09, 0x0F, 0x0A, 0x02, 0x01, 0x08, 0x10, 0x09, 0x02, 0x01, 0x07,
+  0x11, 0x08, 0x02, 0x00, 0x08, 0x11, 0x08, 0x02, 0x00, 0x07, 0x12, 0x07,
+  0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00,
+  0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12,
+  0x07, 0x02, 0x00, 0x08, 0x11, 0x08, 0x02, 0x01, 0x07, 0x11, 0x08, 0x02,
+  0x01, 0x08, 0x10, 0x09, 0x02, 0x01, 0x09, 0x0F, 0x0A, 0x01, 0x02, 0x17,
+  0x01, 0x02, 0x17, 0x01, 0x03, 0x16, 0x02, 0x04, 0x0D, 0x12, 0x07, 0x02,
+  0x06, 0x0A, 0x12, 0x07, 0x01, 0x08, 0x06, 0x01, 0x08, 0x07, 0x01, 0x06,
+  0x0B, 0x01, 0x04, 0x0F, 0x01, 0x03, 0x11, 0x01, 0x02, 0x13, 0x02, 0x02,
+  0x08, 0x0E, 0x07, 0x02, 0x01, 0x08, 0x10, 0x06, 0x02, 0x01, 0x07, 0x10,
+  0x06, 0x02, 0x01, 0x07, 0x11, 0x05, 0x02, 0x00, 0x07, 0x11, 0x06, 0x02,
+  0x00, 0x07, 0x11, 0x06, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00,
+  0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x02, 0x01, 0x07, 0x11, 0x07, 0x02, 0x01, 0x07, 0x10, 0x07, 0x02,
+  0x02, 0x08, 0x0F, 0x08, 0x01, 0x02, 0x14, 0x01, 0x03, 0x12, 0x01, 0x04,
+  0x10, 0x01, 0x06, 0x0C, 0x01, 0x08, 0x08, 0x01, 0x07, 0x07, 0x01, 0x05,
+  0x09, 0x01, 0x04, 0x0A, 0x01, 0x04, 0x0A, 0x01, 0x03, 0x0B, 0x01, 0x03,
+  0x08, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03,
+  0x07, 0x01, 0x00, 0x0D, 0x01, 0x00, 0x0D, 0x01, 0x00, 0x0D, 0x01, 0x00,
+  0x0D, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03,
+  0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03,
+  0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03,
+  0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03,
+  0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03,
+  0x07, 0x02, 0x08, 0x05, 0x11, 0x07, 0x02, 0x05, 0x0A, 0x11, 0x07, 0x02,
+  0x04, 0x0C, 0x11, 0x07, 0x02, 0x03, 0x0D, 0x11, 0x07, 0x01, 0x02, 0x16,
+  0x01, 0x02, 0x16, 0x02, 0x01, 0x09, 0x0E, 0x0A, 0x02, 0x01, 0x08, 0x0F,
+  0x09, 0x02, 0x01, 0x07, 0x10, 0x08, 0x02, 0x00, 0x08, 0x10, 0x08, 0x02,
+  0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07,
+  0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07,
+  0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x10, 0x08, 0x02, 0x00,
+  0x08, 0x10, 0x08, 0x02, 0x01, 0x08, 0x0F, 0x09, 0x02, 0x01, 0x09, 0x0E,
+  0x0A, 0x01, 0x02, 0x16, 0x01, 0x02, 0x16, 0x01, 0x03, 0x15, 0x02, 0x04,
+  0x0C, 0x11, 0x07, 0x02, 0x05, 0x0A, 0x11, 0x07, 0x02, 0x07, 0x06, 0x11,
+  0x07, 0x01, 0x11, 0x07, 0x01, 0x11, 0x07, 0x01, 0x11, 0x07, 0x02, 0x01,
+  0x07, 0x10, 0x08, 0x02, 0x01, 0x07, 0x0F, 0x08, 0x02, 0x01, 0x09, 0x0E,
+  0x09, 0x01, 0x02, 0x14, 0x01, 0x03, 0x12, 0x01, 0x04, 0x0F, 0x01, 0x07,
+  0x09, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x07, 0x02, 0x00, 0x07, 0x0B, 0x07, 0x02, 0x00, 0x07,
+  0x0A, 0x0A, 0x02, 0x00, 0x07, 0x08, 0x0D, 0x02, 0x00, 0x07, 0x08, 0x0E,
+  0x01, 0x00, 0x16, 0x01, 0x00, 0x17, 0x02, 0x00, 0x0A, 0x0E, 0x09, 0x02,
+  0x00, 0x08, 0x0F, 0x08, 0x02, 0x00, 0x08, 0x10, 0x07, 0x02, 0x00, 0x07,
+  0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07,
+  0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00,
+  0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10,
+  0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02,
+  0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07,
+  0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07,
+  0x02, 0x00, 0x07, 0x10, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x00,
+  0x00, 0x00, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x00, 0x0A, 0x01,
+  0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x02, 0x00, 0x07, 0x0F, 0x07, 0x02, 0x00,
+  0x07, 0x0E, 0x07, 0x02, 0x00, 0x07, 0x0D, 0x08, 0x02, 0x00, 0x07, 0x0C,
+  0x08, 0x02, 0x00, 0x07, 0x0B, 0x08, 0x02, 0x00, 0x07, 0x0B, 0x07, 0x02,
+  0x00, 0x07, 0x0A, 0x07, 0x02, 0x00, 0x07, 0x09, 0x07, 0x02, 0x00, 0x07,
+  0x08, 0x07, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01,
+  0x00, 0x10, 0x01, 0x00, 0x11, 0x02, 0x00, 0x09, 0x0A, 0x07, 0x02, 0x00,
+  0x08, 0x0A, 0x08, 0x02, 0x00, 0x07, 0x0B, 0x07, 0x02, 0x00, 0x07, 0x0C,
+  0x07, 0x02, 0x00, 0x07, 0x0C, 0x08, 0x02, 0x00, 0x07, 0x0D, 0x07, 0x02,
+  0x00, 0x07, 0x0D, 0x08, 0x02, 0x00, 0x07, 0x0E, 0x07, 0x02, 0x00, 0x07,
+  0x0E, 0x08, 0x02, 0x00, 0x07, 0x0F, 0x07, 0x02, 0x00, 0x07, 0x0F, 0x08,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x03, 0x00, 0x07, 0x0B, 0x06, 0x19,
+  0x06, 0x03, 0x00, 0x07, 0x09, 0x0A, 0x17, 0x0A, 0x03, 0x00, 0x07, 0x08,
+  0x0C, 0x16, 0x0C, 0x01, 0x00, 0x23, 0x01, 0x00, 0x23, 0x01, 0x00, 0x24,
+  0x03, 0x00, 0x09, 0x0E, 0x0A, 0x1C, 0x08, 0x03, 0x00, 0x08, 0x0F, 0x08,
+  0x1D, 0x07, 0x03, 0x00, 0x07, 0x0F, 0x07, 0x1D, 0x07, 0x03, 0x00, 0x07,
+  0x0F, 0x07, 0x1D, 0x07, 0x03, 0x00, 0x07, 0x0F, 0x07, 0x1D, 0x07, 0x03,
+  0x00, 0x07, 0x0F, 0x07, 0x1D, 0x07, 0x03, 0x00, 0x07, 0x0F, 0x07, 0x1D,
+  0x07, 0x03, 0x00, 0x07, 0x0F, 0x07, 0x1D, 0x07, 0x03, 0x00, 0x07, 0x0F,
+  0x07, 0x1D, 0x07, 0x03, 0x00, 0x07, 0x0F, 0x07, 0x1D, 0x07, 0x03, 0x00,
+  0x07, 0x0F, 0x07, 0x1D, 0x07, 0x03, 0x00, 0x07, 0x0F, 0x07, 0x1D, 0x07,
+  0x03, 0x00, 0x07, 0x0F, 0x07, 0x1D, 0x07, 0x03, 0x00, 0x07, 0x0F, 0x07,
+  0x1D, 0x07, 0x03, 0x00, 0x07, 0x0F, 0x07, 0x1D, 0x07, 0x03, 0x00, 0x07,
+  0x0F, 0x07, 0x1D, 0x07, 0x03, 0x00, 0x07, 0x0F, 0x07, 0x1D, 0x07, 0x03,
+  0x00, 0x07, 0x0F, 0x07, 0x1D, 0x07, 0x03, 0x00, 0x07, 0x0F, 0x07, 0x1D,
+  0x07, 0x02, 0x00, 0x07, 0x0B, 0x07, 0x02, 0x00, 0x07, 0x09, 0x0B, 0x02,
+  0x00, 0x07, 0x08, 0x0D, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00,
+  0x17, 0x02, 0x00, 0x0A, 0x0E, 0x09, 0x02, 0x00, 0x08, 0x0F, 0x08, 0x02,
+  0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07,
+  0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07,
+  0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00,
+  0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10,
+  0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02,
+  0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07,
+  0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07,
+  0x01, 0x09, 0x08, 0x01, 0x06, 0x0D, 0x01, 0x05, 0x10, 0x01, 0x04, 0x12,
+  0x01, 0x03, 0x14, 0x01, 0x02, 0x15, 0x02, 0x01, 0x09, 0x0F, 0x09, 0x02,
+  0x01, 0x08, 0x10, 0x08, 0x02, 0x01, 0x07, 0x11, 0x07, 0x02, 0x00, 0x08,
+  0x11, 0x08, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07,
+  0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00,
+  0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x08, 0x11,
+  0x08, 0x02, 0x01, 0x07, 0x11, 0x07, 0x02, 0x01, 0x08, 0x10, 0x08, 0x02,
+  0x01, 0x09, 0x0F, 0x09, 0x01, 0x02, 0x15, 0x01, 0x03, 0x14, 0x01, 0x04,
+  0x12, 0x01, 0x05, 0x10, 0x01, 0x06, 0x0D, 0x01, 0x09, 0x08, 0x02, 0x00,
+  0x07, 0x0B, 0x06, 0x02, 0x00, 0x07, 0x09, 0x0A, 0x02, 0x00, 0x07, 0x08,
+  0x0D, 0x02, 0x00, 0x07, 0x08, 0x0E, 0x01, 0x00, 0x16, 0x01, 0x00, 0x17,
+  0x02, 0x00, 0x0A, 0x0F, 0x09, 0x02, 0x00, 0x09, 0x10, 0x08, 0x02, 0x00,
+  0x08, 0x11, 0x07, 0x02, 0x00, 0x08, 0x11, 0x08, 0x02, 0x00, 0x07, 0x12,
+  0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02,
+  0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07,
+  0x12, 0x07, 0x02, 0x00, 0x08, 0x11, 0x08, 0x02, 0x00, 0x08, 0x11, 0x07,
+  0x02, 0x00, 0x09, 0x10, 0x08, 0x02, 0x00, 0x0A, 0x0F, 0x08, 0x01, 0x00,
+  0x17, 0x01, 0x00, 0x16, 0x02, 0x00, 0x07, 0x08, 0x0D, 0x02, 0x00, 0x07,
+  0x08, 0x0D, 0x02, 0x00, 0x07, 0x09, 0x0A, 0x02, 0x00, 0x07, 0x0B, 0x06,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x02, 0x08, 0x06, 0x12, 0x07, 0x02,
+  0x06, 0x0A, 0x12, 0x07, 0x02, 0x04, 0x0D, 0x12, 0x07, 0x02, 0x04, 0x0D,
+  0x12, 0x07, 0x01, 0x03, 0x16, 0x01, 0x02, 0x17, 0x02, 0x01, 0x09, 0x0F,
+  0x0A, 0x02, 0x01, 0x08, 0x10, 0x09, 0x02, 0x01, 0x07, 0x11, 0x08, 0x02,
+  0x00, 0x08, 0x11, 0x08, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07,
+  0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07,
+  0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00,
+  0x08, 0x11, 0x08, 0x02, 0x01, 0x07, 0x11, 0x08, 0x02, 0x01, 0x08, 0x10,
+  0x09, 0x02, 0x01, 0x09, 0x0F, 0x0A, 0x01, 0x02, 0x17, 0x01, 0x03, 0x16,
+  0x02, 0x03, 0x0E, 0x12, 0x07, 0x02, 0x04, 0x0D, 0x12, 0x07, 0x02, 0x06,
+  0x0A, 0x12, 0x07, 0x02, 0x08, 0x06, 0x12, 0x07, 0x01, 0x12, 0x07, 0x01,
+  0x12, 0x07, 0x01, 0x12, 0x07, 0x01, 0x12, 0x07, 0x01, 0x12, 0x07, 0x01,
+  0x12, 0x07, 0x01, 0x12, 0x07, 0x01, 0x12, 0x07, 0x01, 0x12, 0x07, 0x01,
+  0x12, 0x07, 0x02, 0x00, 0x07, 0x0B, 0x04, 0x02, 0x00, 0x07, 0x0A, 0x05,
+  0x02, 0x00, 0x07, 0x08, 0x07, 0x02, 0x00, 0x07, 0x08, 0x07, 0x01, 0x00,
+  0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x08, 0x01, 0x00,
+  0x08, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x08, 0x08, 0x01, 0x05, 0x0E, 0x01, 0x04, 0x11, 0x01, 0x03,
+  0x13, 0x01, 0x02, 0x14, 0x02, 0x01, 0x08, 0x0F, 0x08, 0x02, 0x01, 0x07,
+  0x10, 0x07, 0x02, 0x01, 0x07, 0x10, 0x07, 0x01, 0x01, 0x09, 0x01, 0x01,
+  0x0D, 0x01, 0x01, 0x10, 0x01, 0x02, 0x12, 0x01, 0x03, 0x13, 0x01, 0x05,
+  0x12, 0x01, 0x09, 0x0E, 0x01, 0x0C, 0x0C, 0x01, 0x0F, 0x09, 0x01, 0x11,
+  0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x01, 0x07, 0x11, 0x07, 0x02,
+  0x01, 0x08, 0x0F, 0x08, 0x01, 0x01, 0x16, 0x01, 0x02, 0x14, 0x01, 0x03,
+  0x12, 0x01, 0x04, 0x10, 0x01, 0x07, 0x0A, 0x01, 0x02, 0x07, 0x01, 0x02,
+  0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02,
+  0x07, 0x01, 0x02, 0x07, 0x01, 0x00, 0x0C, 0x01, 0x00, 0x0C, 0x01, 0x00,
+  0x0C, 0x01, 0x00, 0x0C, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02,
+  0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02,
+  0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02,
+  0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02,
+  0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x0A, 0x01, 0x03,
+  0x09, 0x01, 0x04, 0x08, 0x01, 0x05, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07,
+  0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00,
+  0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10,
+  0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02,
+  0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07,
+  0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07,
+  0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00,
+  0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x0F,
+  0x08, 0x02, 0x00, 0x08, 0x0F, 0x08, 0x02, 0x00, 0x09, 0x0D, 0x0A, 0x01,
+  0x00, 0x17, 0x01, 0x01, 0x16, 0x02, 0x01, 0x0E, 0x10, 0x07, 0x02, 0x02,
+  0x0D, 0x10, 0x07, 0x02, 0x03, 0x0B, 0x10, 0x07, 0x01, 0x05, 0x07, 0x02,
+  0x01, 0x07, 0x12, 0x07, 0x02, 0x01, 0x07, 0x12, 0x06, 0x02, 0x01, 0x07,
+  0x11, 0x07, 0x02, 0x02, 0x06, 0x11, 0x07, 0x02, 0x02, 0x07, 0x11, 0x06,
+  0x02, 0x02, 0x07, 0x10, 0x07, 0x02, 0x03, 0x06, 0x10, 0x07, 0x02, 0x03,
+  0x07, 0x10, 0x06, 0x02, 0x03, 0x07, 0x10, 0x06, 0x02, 0x04, 0x06, 0x0F,
+  0x07, 0x02, 0x04, 0x07, 0x0F, 0x06, 0x02, 0x05, 0x06, 0x0F, 0x06, 0x02,
+  0x05, 0x06, 0x0F, 0x06, 0x02, 0x05, 0x06, 0x0E, 0x06, 0x02, 0x06, 0x06,
+  0x0E, 0x06, 0x02, 0x06, 0x06, 0x0E, 0x06, 0x02, 0x06, 0x06, 0x0D, 0x06,
+  0x01, 0x07, 0x0C, 0x01, 0x07, 0x0C, 0x01, 0x07, 0x0B, 0x01, 0x08, 0x0A,
+  0x01, 0x08, 0x0A, 0x01, 0x08, 0x09, 0x01, 0x09, 0x08, 0x01, 0x09, 0x07,
+  0x03, 0x00, 0x06, 0x0E, 0x07, 0x1C, 0x07, 0x03, 0x00, 0x07, 0x0E, 0x07,
+  0x1C, 0x07, 0x03, 0x00, 0x07, 0x0E, 0x07, 0x1C, 0x06, 0x03, 0x01, 0x06,
+  0x0D, 0x09, 0x1C, 0x06, 0x03, 0x01, 0x06, 0x0D, 0x09, 0x1B, 0x07, 0x03,
+  0x01, 0x07, 0x0D, 0x09, 0x1B, 0x07, 0x03, 0x01, 0x07, 0x0D, 0x09, 0x1B,
+  0x06, 0x04, 0x02, 0x06, 0x0D, 0x04, 0x12, 0x04, 0x1B, 0x06, 0x04, 0x02,
+  0x06, 0x0C, 0x05, 0x12, 0x05, 0x1A, 0x07, 0x04, 0x02, 0x07, 0x0C, 0x05,
+  0x12, 0x05, 0x1A, 0x06, 0x04, 0x03, 0x06, 0x0C, 0x05, 0x12, 0x05, 0x1A,
+  0x06, 0x04, 0x03, 0x06, 0x0C, 0x05, 0x12, 0x05, 0x1A, 0x06, 0x04, 0x03,
+  0x06, 0x0B, 0x05, 0x13, 0x04, 0x1A, 0x06, 0x04, 0x03, 0x06, 0x0B, 0x05,
+  0x13, 0x05, 0x19, 0x06, 0x04, 0x04, 0x06, 0x0B, 0x05, 0x13, 0x05, 0x19,
+  0x06, 0x04, 0x04, 0x06, 0x0B, 0x05, 0x13, 0x05, 0x19, 0x06, 0x04, 0x04,
+  0x06, 0x0B, 0x04, 0x13, 0x05, 0x19, 0x05, 0x02, 0x05, 0x0A, 0x14, 0x0A,
+  0x02, 0x05, 0x0A, 0x14, 0x0A, 0x02, 0x05, 0x0A, 0x14, 0x0A, 0x02, 0x05,
+  0x09, 0x14, 0x09, 0x02, 0x06, 0x08, 0x14, 0x09, 0x02, 0x06, 0x08, 0x15,
+  0x08, 0x02, 0x06, 0x08, 0x15, 0x07, 0x02, 0x07, 0x07, 0x15, 0x07, 0x02,
+  0x00, 0x08, 0x10, 0x08, 0x02, 0x01, 0x08, 0x0F, 0x08, 0x02, 0x02, 0x07,
+  0x0F, 0x07, 0x02, 0x02, 0x08, 0x0E, 0x08, 0x02, 0x03, 0x07, 0x0E, 0x07,
+  0x02, 0x04, 0x07, 0x0D, 0x07, 0x02, 0x04, 0x07, 0x0C, 0x08, 0x01, 0x05,
+  0x0E, 0x01, 0x06, 0x0C, 0x01, 0x06, 0x0C, 0x01, 0x07, 0x0A, 0x01, 0x08,
+  0x08, 0x01, 0x08, 0x08, 0x01, 0x07, 0x09, 0x01, 0x07, 0x0A, 0x01, 0x06,
+  0x0C, 0x01, 0x05, 0x0D, 0x01, 0x05, 0x0E, 0x02, 0x04, 0x07, 0x0D, 0x07,
+  0x02, 0x03, 0x08, 0x0D, 0x07, 0x02, 0x03, 0x07, 0x0E, 0x07, 0x02, 0x02,
+  0x08, 0x0E, 0x08, 0x02, 0x01, 0x08, 0x0F, 0x07, 0x02, 0x01, 0x07, 0x0F,
+  0x08, 0x02, 0x00, 0x08, 0x10, 0x08, 0x02, 0x01, 0x07, 0x12, 0x07, 0x02,
+  0x01, 0x07, 0x12, 0x07, 0x02, 0x01, 0x07, 0x12, 0x06, 0x02, 0x02, 0x07,
+  0x12, 0x06, 0x02, 0x02, 0x07, 0x11, 0x07, 0x02, 0x02, 0x07, 0x11, 0x06,
+  0x02, 0x03, 0x07, 0x11, 0x06, 0x02, 0x03, 0x07, 0x10, 0x07, 0x02, 0x04,
+  0x06, 0x10, 0x06, 0x02, 0x04, 0x07, 0x10, 0x06, 0x02, 0x04, 0x07, 0x10,
+  0x06, 0x02, 0x05, 0x06, 0x0F, 0x06, 0x02, 0x05, 0x06, 0x0F, 0x06, 0x02,
+  0x05, 0x07, 0x0F, 0x06, 0x02, 0x06, 0x06, 0x0E, 0x06, 0x02, 0x06, 0x06,
+  0x0E, 0x06, 0x02, 0x06, 0x07, 0x0E, 0x06, 0x02, 0x07, 0x06, 0x0E, 0x05,
+  0x01, 0x07, 0x0C, 0x01, 0x07, 0x0C, 0x01, 0x08, 0x0A, 0x01, 0x08, 0x0A,
+  0x01, 0x08, 0x0A, 0x01, 0x09, 0x08, 0x01, 0x09, 0x08, 0x01, 0x0A, 0x07,
+  0x01, 0x0A, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x06,
+  0x01, 0x08, 0x07, 0x01, 0x04, 0x0A, 0x01, 0x04, 0x0A, 0x01, 0x04, 0x09,
+  0x01, 0x04, 0x08, 0x01, 0x04, 0x06, 0x01, 0x01, 0x14, 0x01, 0x01, 0x14,
+  0x01, 0x01, 0x14, 0x01, 0x01, 0x14, 0x01, 0x01, 0x14, 0x01, 0x01, 0x14,
+  0x01, 0x0C, 0x09, 0x01, 0x0B, 0x09, 0x01, 0x0B, 0x08, 0x01, 0x0A, 0x08,
+  0x01, 0x09, 0x08, 0x01, 0x08, 0x08, 0x01, 0x07, 0x08, 0x01, 0x06, 0x08,
+  0x01, 0x05, 0x08, 0x01, 0x04, 0x08, 0x01, 0x03, 0x08, 0x01, 0x02, 0x08,
+  0x01, 0x01, 0x08, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15,
+  0x01, 0x00, 0x15, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15, 0x01, 0x07, 0x06,
+  0x01, 0x06, 0x07, 0x01, 0x05, 0x08, 0x01, 0x05, 0x08, 0x01, 0x04, 0x09,
+  0x01, 0x04, 0x06, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x06, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x08, 0x01, 0x03, 0x06,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x06, 0x01, 0x04, 0x09, 0x01, 0x05, 0x08, 0x01, 0x05, 0x08,
+  0x01, 0x06, 0x07, 0x01, 0x07, 0x06, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x06, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x09, 0x01, 0x03, 0x06,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x06, 0x01, 0x05, 0x08, 0x01, 0x06, 0x07,
+  0x01, 0x06, 0x07, 0x01, 0x05, 0x08, 0x01, 0x04, 0x06, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x06,
+  0x01, 0x00, 0x09, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x06, 0x01, 0x03, 0x05, 0x01, 0x01, 0x09, 0x02, 0x01, 0x0A,
+  0x12, 0x03, 0x02, 0x00, 0x0D, 0x11, 0x04, 0x02, 0x00, 0x04, 0x08, 0x0D,
+  0x02, 0x00, 0x03, 0x0A, 0x0A, 0x01, 0x0B, 0x08, 0x01, 0x0D, 0x05 };
+
+const GFXglyph FreeSansBold24pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,  13,    0,    1 },   // 0x20 ' '
+  {     0,   7,  34,  16,    5,  -33 },   // 0x21 '!'
+  {    96,  18,  12,  22,    2,  -33 },   // 0x22 '"'
+  {   156,  26,  33,  26,    0,  -31 },   // 0x23 '#'
+  {   301,  25,  40,  26,    1,  -34 },   // 0x24 '$'
+  {   477,  39,  34,  42,    1,  -32 },   // 0x25 '%'
+  {   675,  30,  35,  34,    3,  -33 },   // 0x26 '&'
+  {   828,   7,  12,  12,    3,  -33 },   // 0x27 '''
+  {   864,  13,  44,  16,    2,  -33 },   // 0x28 '('
+  {   996,  13,  44,  16,    1,  -33 },   // 0x29 ')'
+  {  1128,  15,  15,  18,    1,  -33 },   // 0x2A '*'
+  {  1185,  23,  22,  27,    2,  -21 },   // 0x2B '+'
+  {  1251,   7,  15,  12,    2,   -6 },   // 0x2C ','
+  {  1296,  13,   6,  16,    1,  -15 },   // 0x2D '-'
+  {  1314,   7,   7,  12,    2,   -6 },   // 0x2E '.'
+  {  1335,  13,  34,  13,    0,  -32 },   // 0x2F '/'
+  {  1437,  24,  35,  26,    1,  -33 },   // 0x30 '0'
+  {  1588,  14,  33,  26,    4,  -32 },   // 0x31 '1'
+  {  1687,  23,  34,  26,    2,  -33 },   // 0x32 '2'
+  {  1801,  23,  35,  26,    2,  -33 },   // 0x33 '3'
+  {  1924,  22,  33,  26,    2,  -32 },   // 0x34 '4'
+  {  2049,  23,  34,  26,    2,  -32 },   // 0x35 '5'
+  {  2163,  23,  35,  26,    2,  -33 },   // 0x36 '6'
+  {  2300,  23,  33,  26,    1,  -32 },   // 0x37 '7'
+  {  2399,  24,  35,  26,    1,  -33 },   // 0x38 '8'
+  {  2542,  24,  35,  26,    1,  -33 },   // 0x39 '9'
+  {  2681,   7,  25,  12,    2,  -24 },   // 0x3A ':'
+  {  2734,   7,  33,  12,    2,  -24 },   // 0x3B ';'
+  {  2811,  23,  23,  27,    2,  -22 },   // 0x3C '<'
+  {  2880,  23,  18,  27,    2,  -19 },   // 0x3D '='
+  {  2922,  23,  23,  27,    2,  -22 },   // 0x3E '>'
+  {  2991,  24,  35,  29,    3,  -34 },   // 0x3F '?'
+  {  3102,  43,  41,  46,    1,  -34 },   // 0x40 '@'
+  {  3361,  32,  34,  33,    0,  -33 },   // 0x41 'A'
+  {  3503,  27,  34,  33,    4,  -33 },   // 0x42 'B'
+  {  3637,  30,  36,  34,    2,  -34 },   // 0x43 'C'
+  {  3769,  28,  34,  34,    4,  -33 },   // 0x44 'D'
+  {  3915,  25,  34,  31,    4,  -33 },   // 0x45 'E'
+  {  4017,  24,  34,  30,    4,  -33 },   // 0x46 'F'
+  {  4119,  31,  36,  36,    2,  -34 },   // 0x47 'G'
+  {  4273,  27,  34,  35,    4,  -33 },   // 0x48 'H'
+  {  4431,   7,  34,  15,    4,  -33 },   // 0x49 'I'
+  {  4533,  22,  35,  27,    1,  -33 },   // 0x4A 'J'
+  {  4652,  30,  34,  34,    4,  -33 },   // 0x4B 'K'
+  {  4812,  23,  34,  29,    4,  -33 },   // 0x4C 'L'
+  {  4914,  33,  34,  41,    4,  -33 },   // 0x4D 'M'
+  {  5166,  28,  34,  35,    4,  -33 },   // 0x4E 'N'
+  {  5358,  33,  36,  37,    2,  -34 },   // 0x4F 'O'
+  {  5514,  26,  34,  32,    4,  -33 },   // 0x50 'P'
+  {  5636,  33,  37,  37,    2,  -34 },   // 0x51 'Q'
+  {  5805,  28,  34,  34,    4,  -33 },   // 0x52 'R'
+  {  5951,  28,  36,  32,    2,  -34 },   // 0x53 'S'
+  {  6079,  27,  34,  30,    2,  -33 },   // 0x54 'T'
+  {  6181,  27,  35,  35,    4,  -33 },   // 0x55 'U'
+  {  6344,  29,  34,  31,    1,  -33 },   // 0x56 'V'
+  {  6496,  43,  34,  45,    1,  -33 },   // 0x57 'W'
+  {  6748,  30,  34,  32,    1,  -33 },   // 0x58 'X'
+  {  6894,  29,  34,  30,    1,  -33 },   // 0x59 'Y'
+  {  7026,  26,  34,  29,    1,  -33 },   // 0x5A 'Z'
+  {  7128,  11,  43,  16,    3,  -33 },   // 0x5B '['
+  {  7257,  14,  34,  13,   -1,  -32 },   // 0x5C '\'
+  {  7359,  11,  43,  16,    1,  -33 },   // 0x5D ']'
+  {  7488,  22,  20,  27,    3,  -32 },   // 0x5E '^'
+  {  7576,  28,   4,  26,   -1,    6 },   // 0x5F '_'
+  {  7588,   9,   7,  12,    1,  -35 },   // 0x60 '`'
+  {  7609,  24,  26,  27,    2,  -24 },   // 0x61 'a'
+  {  7707,  25,  35,  29,    3,  -33 },   // 0x62 'b'
+  {  7850,  23,  26,  26,    2,  -24 },   // 0x63 'c'
+  {  7940,  25,  35,  29,    2,  -33 },   // 0x64 'd'
+  {  8083,  24,  26,  27,    2,  -24 },   // 0x65 'e'
+  {  8179,  14,  34,  16,    1,  -33 },   // 0x66 'f'
+  {  8281,  24,  36,  29,    2,  -24 },   // 0x67 'g'
+  {  8437,  23,  34,  28,    3,  -33 },   // 0x68 'h'
+  {  8585,   7,  34,  13,    3,  -33 },   // 0x69 'i'
+  {  8681,  10,  45,  13,    0,  -33 },   // 0x6A 'j'
+  {  8810,  23,  34,  27,    3,  -33 },   // 0x6B 'k'
+  {  8952,   7,  34,  13,    3,  -33 },   // 0x6C 'l'
+  {  9054,  36,  25,  42,    3,  -24 },   // 0x6D 'm'
+  {  9217,  23,  25,  29,    3,  -24 },   // 0x6E 'n'
+  {  9336,  25,  26,  29,    2,  -24 },   // 0x6F 'o'
+  {  9442,  25,  36,  29,    3,  -24 },   // 0x70 'p'
+  {  9594,  25,  36,  29,    2,  -24 },   // 0x71 'q'
+  {  9746,  15,  25,  18,    3,  -24 },   // 0x72 'r'
+  {  9829,  24,  26,  26,    1,  -24 },   // 0x73 's'
+  {  9919,  12,  32,  16,    2,  -30 },   // 0x74 't'
+  { 10015,  23,  26,  29,    3,  -24 },   // 0x75 'u'
+  { 10139,  25,  25,  25,    0,  -24 },   // 0x76 'v'
+  { 10248,  35,  25,  37,    1,  -24 },   // 0x77 'w'
+  { 10427,  24,  25,  26,    1,  -24 },   // 0x78 'x'
+  { 10530,  25,  36,  26,    0,  -24 },   // 0x79 'y'
+  { 10674,  21,  25,  24,    1,  -24 },   // 0x7A 'z'
+  { 10749,  13,  43,  18,    2,  -33 },   // 0x7B '{'
+  { 10878,   4,  44,  13,    5,  -33 },   // 0x7C '|'
+  { 11010,  13,  43,  18,    3,  -33 },   // 0x7D '}'
+  { 11139,  21,   8,  23,    1,  -14 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSansBold24pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSansBold24pt7bSpanData,
+    (GFXglyph *)FreeSansBold24pt7bSpanGlyphs,
+    0x20, 0x7E, 56 } };
+
+// Approx. 11955 bytes
@@ -0,0 +1,289 @@
+// FreeSansBoldOblique12pt7b as run lengths, generated by Tools/GFX_pack from FreeSansBoldOblique12pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeSansBoldOblique12pt7bPackedRuns[] PROGMEM = {
+  0x33, 0x44, 0x34, 0x33, 0x43, 0x43, 0x34, 0x33, 0x43, 0x43, 0x42, 0x52,
+  0x52, 0xB3, 0x34, 0x34, 0x30, 0x13, 0x37, 0x27, 0x33, 0x13, 0x33, 0x12,
+  0x42, 0x22, 0x42, 0x20, 0x72, 0x32, 0x73, 0x23, 0x72, 0x32, 0x4D, 0x2D,
+  0x2C, 0x53, 0x23, 0x63, 0x23, 0x73, 0x23, 0x4D, 0x2C, 0x3C, 0x52, 0x32,
+  0x73, 0x23, 0x72, 0x32, 0x73, 0x23, 0x70, 0x91, 0xB7, 0x6A, 0x4C, 0x24,
+  0x21, 0x24, 0x24, 0x12, 0x24, 0x24, 0x12, 0x87, 0x88, 0x89, 0x88, 0x82,
+  0x15, 0x72, 0x24, 0x14, 0x21, 0x34, 0x14, 0x21, 0x34, 0x17, 0x15, 0x3B,
+  0x58, 0xA2, 0xD1, 0xD2, 0x90, 0xF0, 0x24, 0x47, 0x24, 0x65, 0x24, 0x84,
+  0x14, 0x34, 0x23, 0x24, 0x25, 0x22, 0x25, 0x24, 0x31, 0x26, 0x82, 0x18,
+  0x62, 0x29, 0x42, 0x2F, 0x02, 0x43, 0x82, 0x36, 0x72, 0x37, 0x52, 0x33,
+  0x32, 0x42, 0x42, 0x33, 0x32, 0x57, 0x42, 0x66, 0x32, 0x74, 0x30, 0x74,
+  0xA7, 0x78, 0x64, 0x23, 0x64, 0x23, 0x64, 0x13, 0x86, 0xA4, 0x87, 0x32,
+  0x24, 0x14, 0x13, 0x14, 0x36, 0x14, 0x46, 0x14, 0x54, 0x25, 0x35, 0x2E,
+  0x28, 0x14, 0x36, 0x33, 0x10, 0x1A, 0x13, 0x12, 0x22, 0x20, 0x63, 0x53,
+  0x62, 0x63, 0x53, 0x63, 0x53, 0x63, 0x53, 0x63, 0x54, 0x53, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x72, 0x73, 0x63, 0x72, 0x50, 0x52, 0x73, 0x63,
+  0x72, 0x73, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x63, 0x63, 0x53,
+  0x63, 0x53, 0x63, 0x53, 0x62, 0x63, 0x53, 0x60, 0x42, 0x62, 0x31, 0x2C,
+  0x33, 0x44, 0x32, 0x12, 0x31, 0x31, 0x20, 0x63, 0x93, 0x83, 0x93, 0x5F,
+  0xF5, 0x43, 0x93, 0x93, 0x92, 0x60, 0x14, 0x14, 0x13, 0x41, 0x32, 0x22,
+  0x22, 0x30, 0x1F, 0x41, 0x1A, 0x10, 0x82, 0x82, 0x72, 0x81, 0x82, 0x81,
+  0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x80,
+  0x64, 0x78, 0x49, 0x34, 0x34, 0x24, 0x34, 0x14, 0x44, 0x14, 0x44, 0x14,
+  0x48, 0x58, 0x44, 0x14, 0x44, 0x14, 0x44, 0x14, 0x34, 0x24, 0x34, 0x2A,
+  0x48, 0x65, 0x60, 0x63, 0x53, 0x54, 0x27, 0x18, 0x54, 0x53, 0x63, 0x63,
+  0x54, 0x53, 0x63, 0x63, 0x54, 0x54, 0x53, 0x63, 0x40, 0x66, 0x89, 0x4C,
+  0x34, 0x35, 0x24, 0x54, 0x24, 0x54, 0xB4, 0xA4, 0xA4, 0x95, 0x94, 0x95,
+  0x94, 0xA3, 0xBB, 0x4B, 0x3C, 0x30, 0x56, 0x59, 0x3B, 0x15, 0x34, 0x14,
+  0x44, 0x84, 0x75, 0x76, 0x76, 0x95, 0x94, 0x94, 0x14, 0x44, 0x14, 0x34,
+  0x2B, 0x39, 0x56, 0x50, 0x94, 0x85, 0x76, 0x76, 0x62, 0x13, 0x62, 0x23,
+  0x52, 0x33, 0x43, 0x24, 0x33, 0x34, 0x32, 0x43, 0x3C, 0x1C, 0x1C, 0x74,
+  0x93, 0xA3, 0x94, 0x30, 0x59, 0x59, 0x4A, 0x42, 0xB3, 0xB8, 0x69, 0x4B,
+  0x33, 0x35, 0xA4, 0xA4, 0xA4, 0x14, 0x44, 0x24, 0x35, 0x2B, 0x49, 0x66,
+  0x60, 0x65, 0x68, 0x4A, 0x24, 0x34, 0x24, 0x84, 0x14, 0x4A, 0x3B, 0x15,
+  0x34, 0x15, 0x34, 0x14, 0x44, 0x14, 0x44, 0x14, 0x34, 0x25, 0x24, 0x2A,
+  0x48, 0x75, 0x50, 0x1C, 0x1C, 0x1C, 0x93, 0x93, 0x93, 0x93, 0x93, 0x94,
+  0x93, 0x93, 0x94, 0x93, 0x94, 0x93, 0xA3, 0x94, 0x90, 0x66, 0x78, 0x5A,
+  0x34, 0x34, 0x33, 0x44, 0x33, 0x34, 0x58, 0x67, 0x5A, 0x35, 0x34, 0x24,
+  0x44, 0x14, 0x54, 0x14, 0x54, 0x15, 0x34, 0x2C, 0x3A, 0x66, 0x50, 0x65,
+  0x79, 0x4A, 0x35, 0x25, 0x24, 0x44, 0x14, 0x54, 0x14, 0x54, 0x14, 0x45,
+  0x14, 0x36, 0x1C, 0x3B, 0x45, 0x14, 0x94, 0x24, 0x34, 0x3B, 0x49, 0x66,
+  0x60, 0x33, 0x24, 0x23, 0xFF, 0x83, 0x24, 0x23, 0x30, 0x43, 0x34, 0x33,
+  0xFF, 0xE4, 0x34, 0x33, 0x61, 0x52, 0x42, 0x42, 0x50, 0xF8, 0x37, 0x64,
+  0x82, 0x84, 0x67, 0x58, 0x87, 0x87, 0x79, 0x4B, 0x22, 0x2C, 0x2C, 0x2B,
+  0xFF, 0xEC, 0x2B, 0x3B, 0x20, 0x22, 0xB4, 0x97, 0x78, 0x78, 0x85, 0x76,
+  0x48, 0x28, 0x46, 0x73, 0xF8, 0x46, 0x5A, 0x3A, 0x24, 0x39, 0x57, 0x64,
+  0x94, 0x84, 0x84, 0x75, 0x75, 0x83, 0x93, 0xA3, 0xF7, 0x49, 0x49, 0x38,
+  0xA7, 0xDB, 0x94, 0x64, 0x73, 0xA3, 0x53, 0xC3, 0x33, 0x44, 0x13, 0x13,
+  0x23, 0x48, 0x32, 0x22, 0x42, 0x34, 0x32, 0x12, 0x42, 0x43, 0x42, 0x12,
+  0x32, 0x53, 0x44, 0x42, 0x52, 0x42, 0x12, 0x32, 0x62, 0x42, 0x12, 0x32,
+  0x52, 0x43, 0x12, 0x32, 0x43, 0x33, 0x22, 0x32, 0x34, 0x23, 0x32, 0x36,
+  0x16, 0x43, 0x34, 0x24, 0x73, 0xF5, 0x46, 0x2B, 0xBD, 0x7A, 0xA5, 0xB6,
+  0xB6, 0xA7, 0xA7, 0x98, 0x93, 0x15, 0x73, 0x34, 0x73, 0x34, 0x63, 0x44,
+  0x54, 0x44, 0x5C, 0x4D, 0x4E, 0x24, 0x74, 0x23, 0x84, 0x14, 0x84, 0x13,
+  0x94, 0x4B, 0x5D, 0x4E, 0x34, 0x64, 0x33, 0x74, 0x33, 0x74, 0x24, 0x64,
+  0x3D, 0x4C, 0x5D, 0x43, 0x65, 0x24, 0x74, 0x24, 0x74, 0x23, 0x84, 0x23,
+  0x74, 0x2E, 0x3E, 0x3C, 0x50, 0x76, 0x9A, 0x6C, 0x45, 0x45, 0x24, 0x74,
+  0x24, 0x74, 0x14, 0xD4, 0xC4, 0xD4, 0xD4, 0xD4, 0xD4, 0x83, 0x24, 0x74,
+  0x25, 0x54, 0x4D, 0x5A, 0x96, 0x70, 0x3B, 0x6D, 0x4D, 0x43, 0x65, 0x33,
+  0x74, 0x24, 0x74, 0x24, 0x74, 0x24, 0x74, 0x23, 0x84, 0x23, 0x84, 0x14,
+  0x74, 0x24, 0x74, 0x24, 0x65, 0x23, 0x74, 0x33, 0x55, 0x3D, 0x4C, 0x5A,
+  0x70, 0x4C, 0x3D, 0x3D, 0x33, 0xD3, 0xC4, 0xC4, 0xCC, 0x4C, 0x4C, 0x34,
+  0xC4, 0xC4, 0xC3, 0xD3, 0xCD, 0x3D, 0x3D, 0x30, 0x3D, 0x3C, 0x4C, 0x43,
+  0xD3, 0xC4, 0xC4, 0xCB, 0x5B, 0x5B, 0x44, 0xC4, 0xC4, 0xC3, 0xC4, 0xC4,
+  0xC4, 0xC3, 0xD0, 0x77, 0x8A, 0x6C, 0x45, 0x54, 0x24, 0x83, 0x23, 0xD4,
+  0xD4, 0xC4, 0x57, 0x14, 0x57, 0x14, 0x57, 0x14, 0x83, 0x24, 0x83, 0x25,
+  0x64, 0x35, 0x45, 0x3E, 0x49, 0x12, 0x76, 0x22, 0x30, 0x34, 0x73, 0x34,
+  0x73, 0x33, 0x74, 0x33, 0x74, 0x24, 0x74, 0x24, 0x73, 0x34, 0x73, 0x3E,
+  0x3E, 0x2F, 0x02, 0x47, 0x33, 0x47, 0x33, 0x37, 0x43, 0x37, 0x42, 0x47,
+  0x33, 0x47, 0x33, 0x46, 0x43, 0x37, 0x43, 0x34, 0x34, 0x34, 0x33, 0x43,
+  0x34, 0x34, 0x34, 0x33, 0x43, 0x34, 0x34, 0x34, 0x33, 0x43, 0x34, 0x34,
+  0x34, 0x30, 0xB3, 0xA4, 0xA4, 0xA4, 0xA3, 0xB3, 0xA4, 0xA4, 0xA4, 0xA3,
+  0xB3, 0x24, 0x44, 0x24, 0x44, 0x24, 0x43, 0x34, 0x34, 0x3B, 0x49, 0x66,
+  0x60, 0x34, 0x65, 0x34, 0x55, 0x44, 0x44, 0x63, 0x44, 0x73, 0x34, 0x74,
+  0x24, 0x84, 0x14, 0x98, 0xA8, 0xA8, 0x95, 0x14, 0x84, 0x25, 0x74, 0x34,
+  0x73, 0x45, 0x54, 0x54, 0x54, 0x64, 0x44, 0x64, 0x43, 0x84, 0x30, 0x43,
+  0x94, 0x94, 0x94, 0x93, 0xA3, 0x94, 0x94, 0x93, 0xA3, 0x94, 0x94, 0x94,
+  0x93, 0xA3, 0x9C, 0x1C, 0x1C, 0x10, 0x35, 0x66, 0x35, 0x66, 0x35, 0x57,
+  0x35, 0x57, 0x26, 0x47, 0x36, 0x43, 0x13, 0x33, 0x12, 0x34, 0x13, 0x33,
+  0x12, 0x33, 0x14, 0x33, 0x12, 0x33, 0x14, 0x24, 0x12, 0x23, 0x23, 0x34,
+  0x12, 0x23, 0x23, 0x33, 0x22, 0x14, 0x23, 0x33, 0x22, 0x13, 0x24, 0x24,
+  0x26, 0x24, 0x24, 0x25, 0x33, 0x34, 0x25, 0x33, 0x33, 0x34, 0x43, 0x33,
+  0x34, 0x34, 0x30, 0x34, 0x73, 0x45, 0x63, 0x45, 0x63, 0x45, 0x54, 0x46,
+  0x44, 0x37, 0x43, 0x43, 0x13, 0x43, 0x43, 0x14, 0x33, 0x43, 0x23, 0x24,
+  0x34, 0x23, 0x24, 0x34, 0x33, 0x13, 0x43, 0x43, 0x13, 0x43, 0x43, 0x13,
+  0x43, 0x56, 0x34, 0x56, 0x34, 0x55, 0x43, 0x74, 0x43, 0x74, 0x40, 0x76,
+  0x9A, 0x6C, 0x45, 0x35, 0x34, 0x65, 0x24, 0x74, 0x14, 0x84, 0x14, 0x88,
+  0x98, 0x98, 0x84, 0x14, 0x84, 0x14, 0x84, 0x15, 0x64, 0x35, 0x44, 0x4C,
+  0x6A, 0x96, 0x70, 0x3B, 0x5C, 0x4D, 0x33, 0x55, 0x33, 0x64, 0x24, 0x64,
+  0x24, 0x64, 0x24, 0x54, 0x3C, 0x4C, 0x3B, 0x54, 0xC4, 0xC3, 0xD3, 0xC4,
+  0xC4, 0xC4, 0xC0, 0x76, 0x9A, 0x6C, 0x45, 0x35, 0x34, 0x65, 0x23, 0x84,
+  0x14, 0x84, 0x14, 0x88, 0x98, 0x98, 0x84, 0x14, 0x51, 0x24, 0x14, 0x43,
+  0x13, 0x25, 0x37, 0x35, 0x35, 0x4D, 0x5D, 0x66, 0x22, 0xF0, 0x14, 0x4B,
+  0x5D, 0x4E, 0x33, 0x65, 0x33, 0x74, 0x33, 0x74, 0x24, 0x73, 0x34, 0x64,
+  0x3C, 0x5B, 0x5E, 0x34, 0x64, 0x34, 0x64, 0x33, 0x74, 0x33, 0x64, 0x34,
+  0x64, 0x34, 0x64, 0x34, 0x65, 0x20, 0x67, 0x7B, 0x4D, 0x34, 0x45, 0x24,
+  0x64, 0x24, 0x64, 0x24, 0xC6, 0xB9, 0x8A, 0x98, 0xB5, 0x14, 0x74, 0x14,
+  0x74, 0x15, 0x54, 0x3C, 0x4B, 0x77, 0x60, 0x1E, 0x1E, 0x1E, 0x63, 0xB4,
+  0xB4, 0xB4, 0xB3, 0xC3, 0xB4, 0xB4, 0xB4, 0xB3, 0xC3, 0xB4, 0xB4, 0xB4,
+  0xB3, 0x90, 0x34, 0x63, 0x33, 0x64, 0x24, 0x64, 0x24, 0x64, 0x24, 0x63,
+  0x33, 0x73, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64, 0x24, 0x63, 0x33, 0x73,
+  0x24, 0x64, 0x24, 0x64, 0x24, 0x63, 0x35, 0x44, 0x3C, 0x5A, 0x86, 0x70,
+  0x04, 0x78, 0x73, 0x23, 0x64, 0x23, 0x63, 0x33, 0x54, 0x33, 0x53, 0x43,
+  0x44, 0x44, 0x33, 0x54, 0x24, 0x54, 0x23, 0x73, 0x14, 0x73, 0x13, 0x83,
+  0x13, 0x86, 0x95, 0xA5, 0xA4, 0xB4, 0x90, 0x04, 0x53, 0x58, 0x44, 0x58,
+  0x44, 0x44, 0x14, 0x44, 0x44, 0x14, 0x35, 0x43, 0x24, 0x32, 0x12, 0x34,
+  0x24, 0x32, 0x12, 0x33, 0x43, 0x23, 0x12, 0x24, 0x43, 0x22, 0x22, 0x23,
+  0x53, 0x13, 0x22, 0x23, 0x53, 0x13, 0x22, 0x13, 0x63, 0x12, 0x32, 0x13,
+  0x66, 0x35, 0x75, 0x45, 0x75, 0x44, 0x85, 0x44, 0x84, 0x53, 0x94, 0x53,
+  0x80, 0x44, 0x64, 0x44, 0x54, 0x55, 0x34, 0x74, 0x24, 0x84, 0x24, 0x98,
+  0xA7, 0xB6, 0xD4, 0xD5, 0xD6, 0xB7, 0xA8, 0x94, 0x24, 0x74, 0x34, 0x74,
+  0x44, 0x54, 0x54, 0x44, 0x65, 0x30, 0x14, 0x64, 0x14, 0x54, 0x24, 0x54,
+  0x24, 0x44, 0x44, 0x24, 0x54, 0x24, 0x54, 0x14, 0x77, 0x86, 0x96, 0xA4,
+  0xB3, 0xC3, 0xB4, 0xB4, 0xB4, 0xB3, 0xC3, 0x90, 0x3D, 0x4D, 0x4D, 0xC4,
+  0xC5, 0xB5, 0xB5, 0xB5, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xCD,
+  0x4D, 0x4D, 0x40, 0x46, 0x46, 0x46, 0x43, 0x64, 0x63, 0x73, 0x73, 0x73,
+  0x64, 0x63, 0x73, 0x73, 0x73, 0x63, 0x73, 0x73, 0x73, 0x64, 0x63, 0x76,
+  0x46, 0x46, 0x40, 0x41, 0x31, 0x31, 0x32, 0x31, 0x31, 0x31, 0x32, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x31, 0x31, 0x31, 0x32, 0x22, 0x22, 0x22,
+  0x22, 0x46, 0x46, 0x46, 0x73, 0x64, 0x63, 0x73, 0x73, 0x73, 0x63, 0x73,
+  0x73, 0x73, 0x64, 0x63, 0x73, 0x73, 0x73, 0x64, 0x63, 0x46, 0x46, 0x46,
+  0x40, 0x63, 0x74, 0x74, 0x66, 0x43, 0x13, 0x43, 0x13, 0x33, 0x23, 0x32,
+  0x42, 0x23, 0x46, 0x56, 0x53, 0x1E, 0x1E, 0x03, 0x22, 0x32, 0x56, 0x59,
+  0x3B, 0x23, 0x43, 0xA3, 0x67, 0x3A, 0x25, 0x24, 0x14, 0x44, 0x14, 0x34,
+  0x2B, 0x3A, 0x44, 0x15, 0x10, 0x43, 0xC3, 0xC3, 0xB4, 0xB4, 0xB3, 0x25,
+  0x5B, 0x4C, 0x25, 0x35, 0x24, 0x54, 0x24, 0x54, 0x23, 0x64, 0x23, 0x64,
+  0x14, 0x54, 0x25, 0x35, 0x2C, 0x3B, 0x43, 0x15, 0x50, 0x55, 0x69, 0x3B,
+  0x15, 0x34, 0x14, 0x44, 0x13, 0x94, 0x94, 0x94, 0x44, 0x14, 0x34, 0x3A,
+  0x39, 0x65, 0x50, 0xB4, 0xB3, 0xC3, 0xC3, 0xB4, 0x64, 0x14, 0x4A, 0x4B,
+  0x35, 0x34, 0x34, 0x53, 0x24, 0x63, 0x24, 0x62, 0x34, 0x53, 0x34, 0x53,
+  0x35, 0x34, 0x3C, 0x4A, 0x65, 0x13, 0x40, 0x55, 0x69, 0x3B, 0x14, 0x44,
+  0x14, 0x4F, 0xF4, 0x94, 0x95, 0x34, 0x2A, 0x39, 0x65, 0x50, 0x54, 0x45,
+  0x36, 0x34, 0x53, 0x47, 0x27, 0x34, 0x54, 0x53, 0x63, 0x63, 0x54, 0x53,
+  0x63, 0x63, 0x54, 0x54, 0x50, 0x64, 0x14, 0x4A, 0x4B, 0x35, 0x34, 0x34,
+  0x53, 0x24, 0x63, 0x24, 0x62, 0x34, 0x62, 0x34, 0x53, 0x35, 0x34, 0x3B,
+  0x5A, 0x65, 0x13, 0xC3, 0x34, 0x44, 0x34, 0x34, 0x59, 0x76, 0x70, 0x34,
+  0xA3, 0xB3, 0xB3, 0xA4, 0xA4, 0x15, 0x43, 0x17, 0x3C, 0x24, 0x44, 0x14,
+  0x53, 0x24, 0x53, 0x23, 0x63, 0x23, 0x54, 0x23, 0x54, 0x14, 0x53, 0x24,
+  0x53, 0x23, 0x63, 0x23, 0x54, 0x20, 0x43, 0x34, 0x33, 0xF3, 0x33, 0x43,
+  0x43, 0x34, 0x33, 0x43, 0x43, 0x34, 0x34, 0x33, 0x43, 0x43, 0x34, 0x64,
+  0x63, 0x73, 0xFB, 0x46, 0x37, 0x37, 0x36, 0x46, 0x46, 0x37, 0x37, 0x36,
+  0x46, 0x37, 0x37, 0x36, 0x46, 0x44, 0x55, 0x55, 0x46, 0x43, 0xC3, 0xC3,
+  0xB4, 0xB4, 0xB3, 0x44, 0x43, 0x34, 0x53, 0x24, 0x54, 0x14, 0x68, 0x77,
+  0x88, 0x78, 0x64, 0x23, 0x64, 0x24, 0x53, 0x34, 0x53, 0x44, 0x43, 0x44,
+  0x30, 0x43, 0x34, 0x34, 0x33, 0x43, 0x43, 0x34, 0x34, 0x33, 0x43, 0x34,
+  0x34, 0x33, 0x43, 0x43, 0x34, 0x34, 0x33, 0x40, 0x33, 0x24, 0x34, 0x53,
+  0x16, 0x16, 0x4F, 0x32, 0x53, 0x43, 0x42, 0x44, 0x34, 0x42, 0x35, 0x34,
+  0x33, 0x34, 0x44, 0x33, 0x34, 0x35, 0x32, 0x44, 0x34, 0x42, 0x44, 0x34,
+  0x42, 0x34, 0x44, 0x33, 0x34, 0x44, 0x33, 0x34, 0x35, 0x32, 0x24, 0x15,
+  0x43, 0x17, 0x3C, 0x24, 0x44, 0x14, 0x53, 0x23, 0x63, 0x23, 0x63, 0x23,
+  0x54, 0x14, 0x54, 0x14, 0x53, 0x23, 0x63, 0x23, 0x63, 0x23, 0x54, 0x20,
+  0x56, 0x6A, 0x3B, 0x25, 0x35, 0x14, 0x58, 0x68, 0x68, 0x59, 0x54, 0x15,
+  0x35, 0x2B, 0x3A, 0x66, 0x50, 0x43, 0x25, 0x6B, 0x5C, 0x35, 0x35, 0x34,
+  0x54, 0x34, 0x54, 0x33, 0x64, 0x33, 0x64, 0x24, 0x54, 0x35, 0x35, 0x3C,
+  0x4B, 0x44, 0x15, 0x64, 0xC3, 0xD3, 0xD3, 0xC4, 0xC0, 0x54, 0x14, 0x3B,
+  0x2B, 0x25, 0x34, 0x24, 0x53, 0x14, 0x63, 0x14, 0x62, 0x24, 0x62, 0x24,
+  0x53, 0x25, 0x34, 0x2C, 0x3A, 0x54, 0x23, 0xB3, 0xA4, 0xA4, 0xA3, 0xB3,
+  0x40, 0x24, 0x13, 0x23, 0x13, 0x37, 0x34, 0x54, 0x64, 0x63, 0x73, 0x64,
+  0x64, 0x63, 0x73, 0x73, 0x70, 0x37, 0x49, 0x2F, 0x04, 0x88, 0x76, 0x95,
+  0x87, 0x51, 0x34, 0x41, 0xA3, 0x94, 0x64, 0x34, 0x44, 0x43, 0x3F, 0x02,
+  0x44, 0x35, 0x35, 0x34, 0x44, 0x44, 0x35, 0x52, 0x54, 0x43, 0x23, 0x54,
+  0x23, 0x53, 0x33, 0x53, 0x24, 0x53, 0x23, 0x54, 0x23, 0x54, 0x23, 0x53,
+  0x24, 0x53, 0x24, 0x44, 0x25, 0x25, 0x2C, 0x3A, 0x54, 0x23, 0x30, 0x04,
+  0x53, 0x14, 0x44, 0x14, 0x43, 0x33, 0x34, 0x33, 0x33, 0x43, 0x24, 0x43,
+  0x23, 0x53, 0x13, 0x63, 0x13, 0x66, 0x85, 0x84, 0x94, 0x70, 0x04, 0x33,
+  0x47, 0x33, 0x38, 0x24, 0x33, 0x14, 0x24, 0x24, 0x14, 0x24, 0x23, 0x24,
+  0x12, 0x12, 0x23, 0x24, 0x12, 0x12, 0x13, 0x43, 0x12, 0x12, 0x13, 0x45,
+  0x25, 0x55, 0x25, 0x55, 0x24, 0x64, 0x34, 0x64, 0x33, 0x60, 0x44, 0x34,
+  0x54, 0x24, 0x64, 0x23, 0x83, 0x13, 0x97, 0xA5, 0xB4, 0xB5, 0xA7, 0x84,
+  0x13, 0x74, 0x24, 0x64, 0x24, 0x54, 0x44, 0x30, 0x24, 0x53, 0x34, 0x44,
+  0x34, 0x43, 0x44, 0x34, 0x53, 0x33, 0x63, 0x24, 0x63, 0x23, 0x73, 0x13,
+  0x83, 0x13, 0x86, 0x96, 0xA4, 0xB4, 0xB3, 0xB3, 0x96, 0x95, 0xA4, 0xB0,
+  0x3A, 0x2B, 0x2A, 0x94, 0x75, 0x74, 0x84, 0x84, 0x84, 0x84, 0x8B, 0x2B,
+  0x2A, 0x30, 0x54, 0x45, 0x45, 0x34, 0x53, 0x63, 0x63, 0x63, 0x54, 0x53,
+  0x63, 0x44, 0x54, 0x63, 0x63, 0x63, 0x63, 0x54, 0x53, 0x63, 0x65, 0x45,
+  0x53, 0x50, 0x42, 0x42, 0x41, 0x42, 0x42, 0x42, 0x42, 0x32, 0x42, 0x42,
+  0x42, 0x42, 0x32, 0x42, 0x42, 0x42, 0x42, 0x32, 0x42, 0x42, 0x42, 0x41,
+  0xB0, 0x53, 0x55, 0x45, 0x63, 0x63, 0x54, 0x53, 0x63, 0x63, 0x63, 0x64,
+  0x54, 0x43, 0x63, 0x54, 0x53, 0x63, 0x63, 0x63, 0x54, 0x35, 0x45, 0x44,
+  0x50, 0x24, 0x76, 0x52, 0x33, 0x22, 0x56, 0x83, 0x20 };
+
+const GFXglyph FreeSansBoldOblique12pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,   7,    0,    1 },   // 0x20 ' '
+  {     0,   7,  17,   8,    3,  -16 },   // 0x21 '!'
+  {    17,  10,   6,  11,    4,  -17 },   // 0x22 '"'
+  {    28,  15,  16,  13,    1,  -15 },   // 0x23 '#'
+  {    55,  15,  21,  13,    1,  -17 },   // 0x24 '$'
+  {    89,  18,  18,  21,    3,  -17 },   // 0x25 '%'
+  {   131,  15,  17,  17,    2,  -16 },   // 0x26 '&'
+  {   161,   4,   6,   6,    4,  -17 },   // 0x27 '''
+  {   166,   9,  22,   8,    2,  -17 },   // 0x28 '('
+  {   189,   9,  22,   8,   -1,  -16 },   // 0x29 ')'
+  {   212,   8,   8,   9,    3,  -17 },   // 0x2A '*'
+  {   223,  12,  11,  14,    2,  -10 },   // 0x2B '+'
+  {   234,   5,   7,   7,    1,   -2 },   // 0x2C ','
+  {   242,   7,   3,   8,    2,   -7 },   // 0x2D '-'
+  {   244,   4,   3,   7,    2,   -2 },   // 0x2E '.'
+  {   246,  10,  17,   7,    0,  -16 },   // 0x2F '/'
+  {   264,  13,  17,  13,    2,  -16 },   // 0x30 '0'
+  {   291,   9,  17,  13,    4,  -16 },   // 0x31 '1'
+  {   309,  15,  17,  13,    1,  -16 },   // 0x32 '2'
+  {   330,  13,  17,  13,    2,  -16 },   // 0x33 '3'
+  {   352,  13,  17,  13,    1,  -16 },   // 0x34 '4'
+  {   376,  14,  17,  13,    1,  -16 },   // 0x35 '5'
+  {   397,  13,  17,  13,    2,  -16 },   // 0x36 '6'
+  {   423,  13,  17,  13,    3,  -16 },   // 0x37 '7'
+  {   441,  14,  17,  13,    1,  -16 },   // 0x38 '8'
+  {   467,  14,  17,  13,    2,  -16 },   // 0x39 '9'
+  {   493,   6,  12,   8,    3,  -11 },   // 0x3A ':'
+  {   501,   7,  16,   8,    2,  -11 },   // 0x3B ';'
+  {   513,  13,  12,  14,    2,  -11 },   // 0x3C '<'
+  {   525,  14,   9,  14,    1,   -9 },   // 0x3D '='
+  {   533,  13,  12,  14,    1,  -10 },   // 0x3E '>'
+  {   545,  13,  18,  15,    4,  -17 },   // 0x3F '?'
+  {   564,  22,  21,  23,    2,  -17 },   // 0x40 '@'
+  {   622,  17,  18,  17,    0,  -17 },   // 0x41 'A'
+  {   649,  17,  18,  17,    2,  -17 },   // 0x42 'B'
+  {   677,  17,  18,  17,    3,  -17 },   // 0x43 'C'
+  {   702,  17,  18,  17,    2,  -17 },   // 0x44 'D'
+  {   733,  16,  18,  16,    2,  -17 },   // 0x45 'E'
+  {   752,  16,  18,  15,    2,  -17 },   // 0x46 'F'
+  {   771,  17,  18,  19,    3,  -17 },   // 0x47 'G'
+  {   801,  17,  18,  17,    2,  -17 },   // 0x48 'H'
+  {   835,   7,  18,   7,    2,  -17 },   // 0x49 'I'
+  {   854,  14,  18,  13,    1,  -17 },   // 0x4A 'J'
+  {   877,  18,  18,  17,    2,  -17 },   // 0x4B 'K'
+  {   911,  13,  18,  15,    2,  -17 },   // 0x4C 'L'
+  {   930,  20,  18,  20,    2,  -17 },   // 0x4D 'M'
+  {   987,  18,  18,  17,    2,  -17 },   // 0x4E 'N'
+  {  1031,  17,  18,  19,    3,  -17 },   // 0x4F 'O'
+  {  1059,  16,  18,  16,    2,  -17 },   // 0x50 'P'
+  {  1083,  17,  19,  19,    3,  -17 },   // 0x51 'Q'
+  {  1115,  17,  18,  17,    2,  -17 },   // 0x52 'R'
+  {  1146,  16,  18,  16,    2,  -17 },   // 0x53 'S'
+  {  1171,  15,  18,  15,    3,  -17 },   // 0x54 'T'
+  {  1190,  16,  18,  17,    3,  -17 },   // 0x55 'U'
+  {  1224,  15,  18,  16,    4,  -17 },   // 0x56 'V'
+  {  1255,  21,  18,  23,    4,  -17 },   // 0x57 'W'
+  {  1309,  18,  18,  16,    1,  -17 },   // 0x58 'X'
+  {  1338,  15,  18,  16,    4,  -17 },   // 0x59 'Y'
+  {  1364,  17,  18,  15,    1,  -17 },   // 0x5A 'Z'
+  {  1383,  10,  23,   8,    1,  -17 },   // 0x5B '['
+  {  1407,   4,  23,   7,    3,  -22 },   // 0x5C '\'
+  {  1429,  10,  23,   8,    0,  -17 },   // 0x5D ']'
+  {  1453,  11,  11,  14,    3,  -16 },   // 0x5E '^'
+  {  1469,  15,   2,  13,   -2,    4 },   // 0x5F '_'
+  {  1471,   4,   3,   8,    4,  -17 },   // 0x60 '`'
+  {  1474,  13,  13,  13,    1,  -12 },   // 0x61 'a'
+  {  1493,  15,  18,  15,    1,  -17 },   // 0x62 'b'
+  {  1521,  13,  13,  13,    2,  -12 },   // 0x63 'c'
+  {  1539,  15,  18,  15,    2,  -17 },   // 0x64 'd'
+  {  1567,  13,  13,  13,    2,  -12 },   // 0x65 'e'
+  {  1582,   9,  18,   8,    2,  -17 },   // 0x66 'f'
+  {  1601,  15,  18,  15,    1,  -12 },   // 0x67 'g'
+  {  1631,  14,  18,  15,    2,  -17 },   // 0x68 'h'
+  {  1662,   7,  18,   7,    2,  -17 },   // 0x69 'i'
+  {  1679,  10,  23,   7,   -1,  -17 },   // 0x6A 'j'
+  {  1701,  15,  18,  13,    1,  -17 },   // 0x6B 'k'
+  {  1729,   7,  18,   7,    2,  -17 },   // 0x6C 'l'
+  {  1748,  21,  13,  21,    1,  -12 },   // 0x6D 'm'
+  {  1786,  14,  13,  15,    2,  -12 },   // 0x6E 'n'
+  {  1812,  14,  13,  15,    2,  -12 },   // 0x6F 'o'
+  {  1829,  16,  18,  15,    0,  -12 },   // 0x70 'p'
+  {  1857,  14,  18,  15,    2,  -12 },   // 0x71 'q'
+  {  1885,  10,  13,   9,    2,  -12 },   // 0x72 'r'
+  {  1901,  12,  13,  13,    3,  -12 },   // 0x73 's'
+  {  1915,   8,  15,   8,    2,  -14 },   // 0x74 't'
+  {  1930,  14,  13,  15,    2,  -12 },   // 0x75 'u'
+  {  1955,  13,  13,  13,    3,  -12 },   // 0x76 'v'
+  {  1978,  17,  13,  19,    3,  -12 },   // 0x77 'w'
+  {  2014,  16,  13,  13,    0,  -12 },   // 0x78 'x'
+  {  2036,  15,  18,  13,    1,  -12 },   // 0x79 'y'
+  {  2064,  13,  13,  12,    1,  -12 },   // 0x7A 'z'
+  {  2078,   9,  23,   9,    3,  -17 },   // 0x7B '{'
+  {  2102,   6,  23,   7,    1,  -17 },   // 0x7C '|'
+  {  2125,   9,  23,   9,    0,  -17 },   // 0x7D '}'
+  {  2149,  12,   5,  14,    2,   -7 } }; // 0x7E '~'
+
+const GFXfontPacked FreeSansBoldOblique12pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeSansBoldOblique12pt7bPackedRuns,
+    (GFXglyph *)FreeSansBoldOblique12pt7bPackedGlyphs,
+    0x20, 0x7E, 29 } };
+
+// Approx. 2829 bytes
@@ -0,0 +1,807 @@
+// FreeSansBoldOblique18pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSansBoldOblique18pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSansBoldOblique18pt7bSpanData[] PROGMEM = {
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05,
+  0x01, 0x04, 0x06, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x05, 0x02, 0x01, 0x04, 0x09, 0x04, 0x02, 0x01, 0x04, 0x09,
+  0x04, 0x02, 0x00, 0x05, 0x08, 0x05, 0x02, 0x00, 0x04, 0x08, 0x04, 0x02,
+  0x00, 0x04, 0x08, 0x04, 0x02, 0x00, 0x04, 0x08, 0x04, 0x02, 0x00, 0x03,
+  0x08, 0x03, 0x02, 0x00, 0x03, 0x08, 0x03, 0x02, 0x00, 0x02, 0x08, 0x02,
+  0x02, 0x0A, 0x04, 0x12, 0x03, 0x02, 0x0A, 0x04, 0x11, 0x04, 0x02, 0x09,
+  0x04, 0x11, 0x03, 0x02, 0x09, 0x04, 0x10, 0x04, 0x02, 0x08, 0x04, 0x10,
+  0x03, 0x01, 0x04, 0x12, 0x01, 0x04, 0x12, 0x01, 0x03, 0x13, 0x01, 0x03,
+  0x12, 0x02, 0x06, 0x04, 0x0E, 0x03, 0x02, 0x06, 0x04, 0x0D, 0x04, 0x02,
+  0x06, 0x03, 0x0D, 0x04, 0x02, 0x05, 0x04, 0x0C, 0x04, 0x02, 0x05, 0x03,
+  0x0C, 0x04, 0x01, 0x01, 0x12, 0x01, 0x01, 0x12, 0x01, 0x01, 0x12, 0x01,
+  0x00, 0x12, 0x02, 0x03, 0x04, 0x0A, 0x04, 0x02, 0x02, 0x04, 0x0A, 0x03,
+  0x02, 0x02, 0x04, 0x09, 0x04, 0x02, 0x01, 0x04, 0x09, 0x03, 0x02, 0x01,
+  0x04, 0x08, 0x04, 0x02, 0x00, 0x04, 0x08, 0x03, 0x01, 0x0C, 0x02, 0x01,
+  0x0C, 0x02, 0x01, 0x0A, 0x06, 0x01, 0x07, 0x0A, 0x01, 0x06, 0x0C, 0x01,
+  0x05, 0x0E, 0x03, 0x04, 0x05, 0x0B, 0x02, 0x0F, 0x04, 0x03, 0x04, 0x04,
+  0x0B, 0x02, 0x0F, 0x04, 0x03, 0x03, 0x04, 0x0A, 0x03, 0x0F, 0x04, 0x03,
+  0x03, 0x04, 0x0A, 0x03, 0x0F, 0x04, 0x02, 0x03, 0x04, 0x0A, 0x02, 0x02,
+  0x03, 0x05, 0x0A, 0x02, 0x01, 0x03, 0x09, 0x01, 0x04, 0x0A, 0x01, 0x05,
+  0x0A, 0x01, 0x06, 0x0A, 0x01, 0x09, 0x08, 0x01, 0x09, 0x08, 0x02, 0x08,
+  0x03, 0x0C, 0x05, 0x02, 0x08, 0x02, 0x0C, 0x05, 0x03, 0x00, 0x05, 0x08,
+  0x02, 0x0C, 0x05, 0x03, 0x00, 0x05, 0x08, 0x02, 0x0C, 0x05, 0x03, 0x00,
+  0x05, 0x07, 0x03, 0x0B, 0x05, 0x02, 0x00, 0x06, 0x07, 0x09, 0x01, 0x01,
+  0x0E, 0x01, 0x01, 0x0D, 0x01, 0x02, 0x0B, 0x01, 0x05, 0x05, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x15, 0x03, 0x02, 0x05,
+  0x04, 0x14, 0x03, 0x02, 0x03, 0x08, 0x14, 0x02, 0x02, 0x02, 0x09, 0x13,
+  0x03, 0x02, 0x01, 0x0B, 0x12, 0x03, 0x03, 0x01, 0x04, 0x08, 0x04, 0x11,
+  0x03, 0x03, 0x00, 0x04, 0x09, 0x03, 0x11, 0x02, 0x03, 0x00, 0x03, 0x09,
+  0x03, 0x10, 0x03, 0x03, 0x00, 0x03, 0x08, 0x04, 0x0F, 0x03, 0x03, 0x00,
+  0x04, 0x07, 0x04, 0x0E, 0x03, 0x02, 0x00, 0x0B, 0x0E, 0x02, 0x02, 0x01,
+  0x09, 0x0D, 0x03, 0x02, 0x01, 0x08, 0x0C, 0x03, 0x02, 0x03, 0x04, 0x0C,
+  0x02, 0x02, 0x0B, 0x02, 0x12, 0x05, 0x02, 0x0A, 0x03, 0x10, 0x09, 0x02,
+  0x09, 0x03, 0x0F, 0x0A, 0x02, 0x09, 0x02, 0x0E, 0x0C, 0x03, 0x08, 0x02,
+  0x0E, 0x04, 0x16, 0x04, 0x03, 0x07, 0x03, 0x0D, 0x03, 0x17, 0x03, 0x03,
+  0x06, 0x03, 0x0D, 0x03, 0x17, 0x03, 0x03, 0x06, 0x02, 0x0D, 0x04, 0x15,
+  0x04, 0x02, 0x05, 0x02, 0x0D, 0x0C, 0x02, 0x04, 0x03, 0x0E, 0x0A, 0x02,
+  0x03, 0x03, 0x0E, 0x09, 0x02, 0x03, 0x02, 0x10, 0x05, 0x01, 0x0B, 0x05,
+  0x01, 0x09, 0x08, 0x01, 0x08, 0x0A, 0x01, 0x07, 0x0B, 0x02, 0x06, 0x06,
+  0x0E, 0x04, 0x02, 0x06, 0x05, 0x0E, 0x04, 0x02, 0x06, 0x05, 0x0E, 0x04,
+  0x02, 0x06, 0x05, 0x0D, 0x04, 0x01, 0x06, 0x0B, 0x01, 0x07, 0x09, 0x01,
+  0x08, 0x06, 0x01, 0x07, 0x06, 0x02, 0x05, 0x09, 0x11, 0x04, 0x02, 0x03,
+  0x0B, 0x11, 0x04, 0x03, 0x02, 0x06, 0x0A, 0x05, 0x10, 0x04, 0x02, 0x01,
+  0x05, 0x0B, 0x09, 0x02, 0x00, 0x05, 0x0B, 0x08, 0x02, 0x00, 0x05, 0x0C,
+  0x06, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02,
+  0x00, 0x07, 0x0A, 0x08, 0x01, 0x00, 0x12, 0x01, 0x01, 0x12, 0x02, 0x02,
+  0x0A, 0x0E, 0x05, 0x02, 0x04, 0x07, 0x0F, 0x05, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x02, 0x01,
+  0x09, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03, 0x01,
+  0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x04, 0x01,
+  0x03, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x04, 0x01, 0x08, 0x03, 0x01,
+  0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x09, 0x03, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x06, 0x02, 0x01, 0x05, 0x03, 0x01,
+  0x05, 0x03, 0x03, 0x01, 0x01, 0x05, 0x02, 0x0A, 0x02, 0x01, 0x00, 0x0C,
+  0x01, 0x01, 0x0B, 0x01, 0x03, 0x06, 0x01, 0x02, 0x06, 0x02, 0x02, 0x03,
+  0x06, 0x03, 0x02, 0x01, 0x03, 0x06, 0x03, 0x02, 0x02, 0x01, 0x07, 0x01,
+  0x01, 0x09, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04,
+  0x01, 0x08, 0x04, 0x01, 0x07, 0x05, 0x01, 0x01, 0x11, 0x01, 0x01, 0x11,
+  0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x05, 0x04,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x04, 0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02,
+  0x01, 0x02, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x09,
+  0x01, 0x01, 0x09, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x0C, 0x03, 0x01, 0x0C, 0x02, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x02,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x03, 0x01, 0x09, 0x02,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x02, 0x01, 0x07, 0x03, 0x01, 0x07, 0x02,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02,
+  0x01, 0x00, 0x03, 0x01, 0x08, 0x06, 0x01, 0x07, 0x09, 0x01, 0x05, 0x0C,
+  0x01, 0x04, 0x0D, 0x02, 0x04, 0x05, 0x0C, 0x06, 0x02, 0x03, 0x05, 0x0D,
+  0x05, 0x02, 0x03, 0x04, 0x0D, 0x05, 0x02, 0x02, 0x05, 0x0D, 0x05, 0x02,
+  0x02, 0x05, 0x0D, 0x05, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x02, 0x01, 0x05,
+  0x0D, 0x05, 0x02, 0x01, 0x05, 0x0C, 0x06, 0x02, 0x01, 0x05, 0x0C, 0x05,
+  0x02, 0x00, 0x06, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00,
+  0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x05, 0x0B,
+  0x05, 0x02, 0x00, 0x05, 0x0B, 0x04, 0x02, 0x00, 0x05, 0x0A, 0x05, 0x02,
+  0x00, 0x06, 0x09, 0x05, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x0C, 0x01, 0x02,
+  0x0A, 0x01, 0x04, 0x05, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08,
+  0x04, 0x01, 0x07, 0x05, 0x01, 0x04, 0x08, 0x01, 0x01, 0x0A, 0x01, 0x00,
+  0x0B, 0x01, 0x00, 0x0B, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x05,
+  0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x05, 0x01, 0x0B, 0x06, 0x01, 0x08,
+  0x0B, 0x01, 0x07, 0x0D, 0x01, 0x06, 0x0E, 0x02, 0x05, 0x06, 0x0F, 0x06,
+  0x02, 0x05, 0x05, 0x10, 0x05, 0x02, 0x05, 0x05, 0x10, 0x05, 0x02, 0x04,
+  0x05, 0x10, 0x05, 0x02, 0x04, 0x05, 0x10, 0x05, 0x01, 0x0F, 0x05, 0x01,
+  0x0F, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0D, 0x05, 0x01, 0x0C, 0x06, 0x01,
+  0x0A, 0x06, 0x01, 0x09, 0x06, 0x01, 0x07, 0x06, 0x01, 0x05, 0x07, 0x01,
+  0x04, 0x07, 0x01, 0x03, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x10, 0x01,
+  0x01, 0x11, 0x01, 0x01, 0x10, 0x01, 0x01, 0x10, 0x01, 0x09, 0x07, 0x01,
+  0x07, 0x0B, 0x01, 0x06, 0x0D, 0x01, 0x05, 0x0F, 0x02, 0x04, 0x05, 0x0E,
+  0x06, 0x02, 0x04, 0x04, 0x0F, 0x05, 0x02, 0x03, 0x05, 0x0F, 0x05, 0x02,
+  0x03, 0x04, 0x0F, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0C, 0x06, 0x01, 0x08,
+  0x09, 0x01, 0x08, 0x08, 0x01, 0x08, 0x09, 0x01, 0x08, 0x0A, 0x01, 0x0C,
+  0x06, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05,
+  0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00,
+  0x06, 0x0A, 0x07, 0x01, 0x00, 0x10, 0x01, 0x01, 0x0E, 0x01, 0x02, 0x0C,
+  0x01, 0x04, 0x07, 0x01, 0x0D, 0x06, 0x01, 0x0C, 0x07, 0x01, 0x0B, 0x07,
+  0x01, 0x0A, 0x08, 0x01, 0x0A, 0x08, 0x02, 0x09, 0x03, 0x0D, 0x05, 0x02,
+  0x08, 0x04, 0x0D, 0x05, 0x02, 0x07, 0x04, 0x0C, 0x05, 0x02, 0x06, 0x04,
+  0x0C, 0x05, 0x02, 0x05, 0x04, 0x0C, 0x05, 0x02, 0x05, 0x03, 0x0C, 0x05,
+  0x02, 0x04, 0x03, 0x0C, 0x05, 0x02, 0x03, 0x04, 0x0B, 0x05, 0x02, 0x02,
+  0x04, 0x0B, 0x05, 0x02, 0x01, 0x04, 0x0B, 0x05, 0x01, 0x01, 0x11, 0x01,
+  0x01, 0x11, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x0A, 0x05, 0x01,
+  0x0A, 0x05, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01,
+  0x09, 0x05, 0x01, 0x07, 0x0D, 0x01, 0x06, 0x0E, 0x01, 0x06, 0x0E, 0x01,
+  0x06, 0x0E, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x02,
+  0x04, 0x04, 0x09, 0x06, 0x01, 0x04, 0x0C, 0x01, 0x03, 0x0E, 0x01, 0x03,
+  0x0E, 0x02, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x02, 0x05, 0x0D, 0x05, 0x01,
+  0x0D, 0x05, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x04, 0x02,
+  0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x02, 0x00, 0x06,
+  0x0A, 0x06, 0x01, 0x00, 0x0F, 0x01, 0x01, 0x0D, 0x01, 0x02, 0x0B, 0x01,
+  0x04, 0x07, 0x01, 0x09, 0x06, 0x01, 0x07, 0x0A, 0x01, 0x06, 0x0C, 0x01,
+  0x05, 0x0D, 0x02, 0x04, 0x05, 0x0D, 0x06, 0x02, 0x03, 0x05, 0x0E, 0x05,
+  0x01, 0x03, 0x04, 0x01, 0x02, 0x05, 0x02, 0x02, 0x04, 0x08, 0x06, 0x01,
+  0x02, 0x0D, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x10, 0x02, 0x01, 0x06, 0x0B,
+  0x06, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02,
+  0x00, 0x04, 0x0C, 0x05, 0x02, 0x00, 0x04, 0x0C, 0x05, 0x02, 0x00, 0x04,
+  0x0C, 0x04, 0x02, 0x00, 0x04, 0x0B, 0x05, 0x02, 0x00, 0x04, 0x0A, 0x05,
+  0x02, 0x00, 0x05, 0x09, 0x06, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x0C, 0x01,
+  0x02, 0x0A, 0x01, 0x04, 0x06, 0x01, 0x01, 0x12, 0x01, 0x01, 0x11, 0x01,
+  0x01, 0x11, 0x01, 0x00, 0x12, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x05, 0x01,
+  0x0A, 0x05, 0x01, 0x09, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x05, 0x01,
+  0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x09, 0x07, 0x01, 0x07, 0x0B, 0x01,
+  0x05, 0x0E, 0x01, 0x04, 0x10, 0x02, 0x04, 0x05, 0x0F, 0x05, 0x02, 0x03,
+  0x05, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x0F,
+  0x04, 0x02, 0x03, 0x05, 0x0D, 0x06, 0x01, 0x04, 0x0E, 0x01, 0x05, 0x0B,
+  0x01, 0x04, 0x0D, 0x01, 0x03, 0x0E, 0x02, 0x02, 0x06, 0x0C, 0x06, 0x02,
+  0x01, 0x05, 0x0D, 0x05, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05,
+  0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05,
+  0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x06, 0x0A, 0x06, 0x01, 0x00,
+  0x10, 0x01, 0x01, 0x0E, 0x01, 0x02, 0x0B, 0x01, 0x04, 0x07, 0x01, 0x09,
+  0x06, 0x01, 0x07, 0x0A, 0x01, 0x06, 0x0C, 0x01, 0x05, 0x0D, 0x02, 0x04,
+  0x06, 0x0E, 0x05, 0x02, 0x03, 0x06, 0x0F, 0x04, 0x02, 0x03, 0x05, 0x0F,
+  0x04, 0x02, 0x02, 0x05, 0x0F, 0x04, 0x02, 0x02, 0x05, 0x0F, 0x04, 0x02,
+  0x02, 0x05, 0x0F, 0x04, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x05,
+  0x0D, 0x05, 0x02, 0x02, 0x06, 0x0C, 0x06, 0x01, 0x02, 0x10, 0x01, 0x03,
+  0x0F, 0x01, 0x04, 0x0E, 0x02, 0x05, 0x06, 0x0D, 0x04, 0x01, 0x0C, 0x05,
+  0x01, 0x0C, 0x04, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x06, 0x0A,
+  0x05, 0x01, 0x00, 0x0E, 0x01, 0x01, 0x0C, 0x01, 0x02, 0x0A, 0x01, 0x04,
+  0x06, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x04, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x04,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x04, 0x02, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x01,
+  0x12, 0x01, 0x01, 0x0F, 0x04, 0x01, 0x0C, 0x07, 0x01, 0x09, 0x09, 0x01,
+  0x06, 0x0C, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x0B, 0x01, 0x00, 0x09, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x09, 0x01, 0x00, 0x0B, 0x01, 0x02, 0x0C, 0x01,
+  0x04, 0x0C, 0x01, 0x07, 0x09, 0x01, 0x09, 0x07, 0x01, 0x0C, 0x04, 0x01,
+  0x0E, 0x02, 0x01, 0x03, 0x11, 0x01, 0x02, 0x11, 0x01, 0x02, 0x11, 0x01,
+  0x02, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x01, 0x01, 0x11,
+  0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x03, 0x02, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x07, 0x01, 0x03, 0x09, 0x01, 0x03, 0x0C, 0x01, 0x05, 0x0C,
+  0x01, 0x08, 0x0B, 0x01, 0x0A, 0x09, 0x01, 0x0D, 0x06, 0x01, 0x0A, 0x09,
+  0x01, 0x07, 0x0B, 0x01, 0x04, 0x0C, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x09,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01, 0x06, 0x07,
+  0x01, 0x04, 0x0C, 0x01, 0x03, 0x0E, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x06,
+  0x0B, 0x07, 0x02, 0x01, 0x05, 0x0C, 0x06, 0x02, 0x00, 0x05, 0x0D, 0x05,
+  0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x0C,
+  0x05, 0x01, 0x0B, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x08, 0x07, 0x01, 0x07,
+  0x07, 0x01, 0x06, 0x07, 0x01, 0x05, 0x06, 0x01, 0x05, 0x04, 0x01, 0x04,
+  0x05, 0x01, 0x04, 0x04, 0x00, 0x00, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x11, 0x08,
+  0x01, 0x0E, 0x0E, 0x01, 0x0C, 0x11, 0x02, 0x0A, 0x07, 0x18, 0x07, 0x02,
+  0x08, 0x06, 0x1A, 0x05, 0x02, 0x07, 0x05, 0x1B, 0x05, 0x02, 0x06, 0x04,
+  0x1C, 0x04, 0x04, 0x05, 0x04, 0x10, 0x05, 0x18, 0x03, 0x1D, 0x04, 0x04,
+  0x04, 0x04, 0x0E, 0x08, 0x17, 0x03, 0x1D, 0x04, 0x03, 0x03, 0x04, 0x0D,
+  0x0D, 0x1E, 0x03, 0x04, 0x03, 0x03, 0x0C, 0x05, 0x14, 0x05, 0x1E, 0x03,
+  0x04, 0x02, 0x03, 0x0B, 0x04, 0x15, 0x04, 0x1E, 0x03, 0x04, 0x02, 0x03,
+  0x0A, 0x04, 0x15, 0x04, 0x1E, 0x03, 0x04, 0x01, 0x03, 0x0A, 0x04, 0x15,
+  0x03, 0x1E, 0x03, 0x04, 0x01, 0x03, 0x09, 0x04, 0x15, 0x03, 0x1D, 0x03,
+  0x04, 0x01, 0x02, 0x09, 0x04, 0x14, 0x03, 0x1D, 0x03, 0x04, 0x00, 0x03,
+  0x09, 0x03, 0x14, 0x03, 0x1C, 0x04, 0x04, 0x00, 0x03, 0x08, 0x04, 0x13,
+  0x03, 0x1C, 0x03, 0x04, 0x00, 0x03, 0x08, 0x04, 0x12, 0x04, 0x1B, 0x03,
+  0x04, 0x00, 0x03, 0x08, 0x04, 0x11, 0x05, 0x1A, 0x04, 0x04, 0x00, 0x03,
+  0x08, 0x05, 0x10, 0x06, 0x18, 0x05, 0x02, 0x00, 0x03, 0x08, 0x14, 0x03,
+  0x00, 0x04, 0x09, 0x08, 0x13, 0x07, 0x03, 0x01, 0x03, 0x0B, 0x04, 0x14,
+  0x05, 0x01, 0x01, 0x04, 0x01, 0x02, 0x04, 0x02, 0x02, 0x06, 0x15, 0x01,
+  0x02, 0x03, 0x07, 0x12, 0x04, 0x01, 0x04, 0x12, 0x01, 0x06, 0x10, 0x01,
+  0x09, 0x09, 0x01, 0x0E, 0x06, 0x01, 0x0D, 0x07, 0x01, 0x0D, 0x08, 0x01,
+  0x0C, 0x09, 0x01, 0x0C, 0x09, 0x01, 0x0B, 0x0A, 0x01, 0x0B, 0x0A, 0x02,
+  0x0A, 0x05, 0x10, 0x05, 0x02, 0x09, 0x06, 0x10, 0x05, 0x02, 0x09, 0x05,
+  0x10, 0x05, 0x02, 0x08, 0x06, 0x10, 0x05, 0x02, 0x08, 0x05, 0x11, 0x05,
+  0x02, 0x07, 0x06, 0x11, 0x05, 0x02, 0x07, 0x05, 0x11, 0x05, 0x02, 0x06,
+  0x05, 0x11, 0x05, 0x02, 0x06, 0x05, 0x11, 0x05, 0x01, 0x05, 0x11, 0x01,
+  0x04, 0x12, 0x01, 0x04, 0x12, 0x01, 0x03, 0x14, 0x02, 0x03, 0x05, 0x12,
+  0x05, 0x02, 0x02, 0x05, 0x12, 0x05, 0x02, 0x02, 0x05, 0x12, 0x05, 0x02,
+  0x01, 0x05, 0x12, 0x05, 0x02, 0x01, 0x05, 0x12, 0x05, 0x02, 0x00, 0x05,
+  0x12, 0x05, 0x01, 0x05, 0x0F, 0x01, 0x05, 0x11, 0x01, 0x05, 0x12, 0x01,
+  0x04, 0x14, 0x02, 0x04, 0x06, 0x12, 0x06, 0x02, 0x04, 0x05, 0x13, 0x05,
+  0x02, 0x04, 0x05, 0x13, 0x05, 0x02, 0x04, 0x05, 0x13, 0x05, 0x02, 0x03,
+  0x06, 0x13, 0x04, 0x02, 0x03, 0x06, 0x12, 0x05, 0x02, 0x03, 0x05, 0x11,
+  0x05, 0x01, 0x03, 0x12, 0x01, 0x03, 0x11, 0x01, 0x02, 0x13, 0x01, 0x02,
+  0x13, 0x02, 0x02, 0x05, 0x10, 0x06, 0x02, 0x02, 0x05, 0x11, 0x05, 0x02,
+  0x02, 0x05, 0x11, 0x05, 0x02, 0x01, 0x06, 0x11, 0x05, 0x02, 0x01, 0x05,
+  0x11, 0x05, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x01, 0x05, 0x0F, 0x06,
+  0x01, 0x01, 0x13, 0x01, 0x00, 0x13, 0x01, 0x00, 0x12, 0x01, 0x00, 0x0F,
+  0x01, 0x0B, 0x08, 0x01, 0x09, 0x0C, 0x01, 0x07, 0x0F, 0x01, 0x06, 0x11,
+  0x02, 0x05, 0x06, 0x11, 0x07, 0x02, 0x04, 0x06, 0x12, 0x06, 0x02, 0x03,
+  0x06, 0x13, 0x05, 0x02, 0x02, 0x06, 0x13, 0x05, 0x02, 0x02, 0x05, 0x13,
+  0x05, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x02, 0x00, 0x05, 0x11, 0x05, 0x02, 0x00, 0x05, 0x11, 0x05, 0x02,
+  0x00, 0x06, 0x10, 0x05, 0x02, 0x00, 0x06, 0x0F, 0x06, 0x02, 0x01, 0x07,
+  0x0D, 0x07, 0x01, 0x01, 0x12, 0x01, 0x02, 0x10, 0x01, 0x04, 0x0C, 0x01,
+  0x06, 0x08, 0x01, 0x05, 0x0E, 0x01, 0x05, 0x10, 0x01, 0x05, 0x11, 0x01,
+  0x04, 0x13, 0x02, 0x04, 0x05, 0x11, 0x06, 0x02, 0x04, 0x05, 0x12, 0x06,
+  0x02, 0x04, 0x05, 0x13, 0x05, 0x02, 0x03, 0x06, 0x13, 0x05, 0x02, 0x03,
+  0x06, 0x13, 0x05, 0x02, 0x03, 0x05, 0x13, 0x05, 0x02, 0x03, 0x05, 0x13,
+  0x05, 0x02, 0x03, 0x05, 0x13, 0x05, 0x02, 0x02, 0x06, 0x13, 0x05, 0x02,
+  0x02, 0x05, 0x12, 0x05, 0x02, 0x02, 0x05, 0x12, 0x05, 0x02, 0x02, 0x05,
+  0x12, 0x05, 0x02, 0x02, 0x05, 0x12, 0x05, 0x02, 0x01, 0x06, 0x11, 0x05,
+  0x02, 0x01, 0x05, 0x11, 0x05, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x01,
+  0x05, 0x0F, 0x06, 0x02, 0x01, 0x05, 0x0D, 0x07, 0x01, 0x00, 0x13, 0x01,
+  0x00, 0x12, 0x01, 0x00, 0x10, 0x01, 0x00, 0x0D, 0x01, 0x05, 0x13, 0x01,
+  0x05, 0x12, 0x01, 0x05, 0x12, 0x01, 0x04, 0x13, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x06, 0x01,
+  0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x11, 0x01, 0x03, 0x11, 0x01,
+  0x02, 0x12, 0x01, 0x02, 0x12, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x00, 0x14, 0x01, 0x00, 0x13, 0x01, 0x00, 0x13, 0x01,
+  0x00, 0x13, 0x01, 0x05, 0x12, 0x01, 0x05, 0x12, 0x01, 0x04, 0x12, 0x01,
+  0x04, 0x12, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01,
+  0x03, 0x10, 0x01, 0x02, 0x11, 0x01, 0x02, 0x11, 0x01, 0x02, 0x10, 0x01,
+  0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x00, 0x06, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x0B, 0x08, 0x01,
+  0x09, 0x0C, 0x01, 0x07, 0x0F, 0x01, 0x06, 0x11, 0x02, 0x05, 0x06, 0x11,
+  0x06, 0x02, 0x04, 0x05, 0x12, 0x06, 0x02, 0x03, 0x05, 0x13, 0x05, 0x02,
+  0x02, 0x05, 0x13, 0x05, 0x01, 0x02, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x0A, 0x02, 0x00, 0x05,
+  0x0D, 0x0B, 0x02, 0x00, 0x05, 0x0D, 0x0A, 0x02, 0x00, 0x05, 0x0D, 0x0A,
+  0x02, 0x00, 0x05, 0x12, 0x05, 0x02, 0x00, 0x05, 0x12, 0x05, 0x02, 0x00,
+  0x06, 0x11, 0x06, 0x02, 0x00, 0x06, 0x11, 0x05, 0x02, 0x01, 0x06, 0x10,
+  0x06, 0x02, 0x01, 0x08, 0x0E, 0x08, 0x01, 0x02, 0x14, 0x02, 0x03, 0x0E,
+  0x12, 0x04, 0x02, 0x04, 0x0C, 0x12, 0x03, 0x02, 0x06, 0x08, 0x12, 0x03,
+  0x02, 0x06, 0x05, 0x15, 0x05, 0x02, 0x06, 0x05, 0x15, 0x05, 0x02, 0x05,
+  0x06, 0x15, 0x05, 0x02, 0x05, 0x05, 0x14, 0x06, 0x02, 0x05, 0x05, 0x14,
+  0x05, 0x02, 0x05, 0x05, 0x14, 0x05, 0x02, 0x04, 0x06, 0x14, 0x05, 0x02,
+  0x04, 0x05, 0x14, 0x05, 0x02, 0x04, 0x05, 0x13, 0x06, 0x02, 0x04, 0x05,
+  0x13, 0x05, 0x01, 0x04, 0x14, 0x01, 0x03, 0x15, 0x01, 0x03, 0x15, 0x01,
+  0x03, 0x15, 0x02, 0x03, 0x05, 0x12, 0x05, 0x02, 0x03, 0x05, 0x12, 0x05,
+  0x02, 0x02, 0x06, 0x12, 0x05, 0x02, 0x02, 0x05, 0x12, 0x05, 0x02, 0x02,
+  0x05, 0x11, 0x06, 0x02, 0x02, 0x05, 0x11, 0x05, 0x02, 0x02, 0x05, 0x11,
+  0x05, 0x02, 0x01, 0x06, 0x11, 0x05, 0x02, 0x01, 0x05, 0x10, 0x06, 0x02,
+  0x01, 0x05, 0x10, 0x06, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x00, 0x06,
+  0x10, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x06, 0x01, 0x04, 0x06, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01,
+  0x03, 0x05, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x01, 0x06, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x05, 0x01, 0x0F, 0x05, 0x01,
+  0x0F, 0x05, 0x01, 0x0F, 0x05, 0x01, 0x0E, 0x06, 0x01, 0x0E, 0x05, 0x01,
+  0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0D, 0x06, 0x01,
+  0x0D, 0x05, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x05, 0x01, 0x0C, 0x06, 0x01,
+  0x0C, 0x06, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x02, 0x01, 0x05, 0x0C,
+  0x05, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x02,
+  0x00, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x06,
+  0x0A, 0x06, 0x01, 0x00, 0x0F, 0x01, 0x01, 0x0D, 0x01, 0x02, 0x0B, 0x01,
+  0x03, 0x07, 0x02, 0x05, 0x05, 0x14, 0x06, 0x02, 0x05, 0x05, 0x13, 0x06,
+  0x02, 0x05, 0x05, 0x12, 0x06, 0x02, 0x04, 0x06, 0x10, 0x07, 0x02, 0x04,
+  0x05, 0x0F, 0x06, 0x02, 0x04, 0x05, 0x0E, 0x06, 0x02, 0x04, 0x05, 0x0D,
+  0x06, 0x02, 0x03, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x05, 0x0B, 0x06, 0x02,
+  0x03, 0x05, 0x0A, 0x06, 0x02, 0x03, 0x05, 0x09, 0x06, 0x01, 0x03, 0x0B,
+  0x01, 0x02, 0x0C, 0x01, 0x02, 0x0D, 0x01, 0x02, 0x0E, 0x02, 0x02, 0x07,
+  0x0A, 0x06, 0x02, 0x02, 0x06, 0x0B, 0x06, 0x02, 0x01, 0x06, 0x0B, 0x06,
+  0x02, 0x01, 0x05, 0x0C, 0x06, 0x02, 0x01, 0x05, 0x0C, 0x06, 0x02, 0x01,
+  0x05, 0x0D, 0x06, 0x02, 0x01, 0x05, 0x0D, 0x07, 0x02, 0x00, 0x06, 0x0E,
+  0x06, 0x02, 0x00, 0x05, 0x0E, 0x07, 0x02, 0x00, 0x05, 0x0F, 0x06, 0x02,
+  0x00, 0x05, 0x10, 0x06, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x06, 0x01, 0x04, 0x05, 0x01, 0x04,
+  0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x06, 0x01, 0x02,
+  0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x01,
+  0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x11, 0x01, 0x00, 0x12, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x02, 0x06,
+  0x07, 0x17, 0x07, 0x02, 0x06, 0x07, 0x16, 0x08, 0x02, 0x05, 0x08, 0x16,
+  0x08, 0x02, 0x05, 0x08, 0x15, 0x09, 0x02, 0x05, 0x08, 0x15, 0x09, 0x02,
+  0x05, 0x08, 0x14, 0x09, 0x02, 0x05, 0x08, 0x14, 0x09, 0x04, 0x04, 0x05,
+  0x0A, 0x03, 0x14, 0x03, 0x18, 0x05, 0x04, 0x04, 0x05, 0x0A, 0x03, 0x13,
+  0x04, 0x18, 0x05, 0x04, 0x04, 0x05, 0x0A, 0x03, 0x13, 0x04, 0x18, 0x05,
+  0x04, 0x04, 0x05, 0x0A, 0x04, 0x12, 0x04, 0x17, 0x05, 0x04, 0x03, 0x05,
+  0x0A, 0x04, 0x12, 0x04, 0x17, 0x05, 0x04, 0x03, 0x05, 0x0A, 0x04, 0x11,
+  0x04, 0x17, 0x05, 0x04, 0x03, 0x05, 0x0A, 0x04, 0x11, 0x04, 0x17, 0x05,
+  0x04, 0x03, 0x05, 0x0A, 0x04, 0x10, 0x04, 0x17, 0x05, 0x04, 0x03, 0x05,
+  0x0A, 0x04, 0x10, 0x04, 0x16, 0x05, 0x04, 0x02, 0x05, 0x0A, 0x04, 0x10,
+  0x03, 0x16, 0x05, 0x04, 0x02, 0x05, 0x0A, 0x04, 0x0F, 0x04, 0x16, 0x05,
+  0x04, 0x02, 0x05, 0x0A, 0x04, 0x0F, 0x04, 0x16, 0x05, 0x03, 0x02, 0x05,
+  0x0A, 0x08, 0x16, 0x04, 0x03, 0x01, 0x06, 0x0A, 0x08, 0x15, 0x05, 0x03,
+  0x01, 0x05, 0x0A, 0x07, 0x15, 0x05, 0x03, 0x01, 0x05, 0x0A, 0x07, 0x15,
+  0x05, 0x03, 0x01, 0x05, 0x0A, 0x06, 0x15, 0x05, 0x03, 0x01, 0x05, 0x0A,
+  0x06, 0x14, 0x05, 0x03, 0x00, 0x05, 0x0A, 0x06, 0x14, 0x05, 0x02, 0x06,
+  0x05, 0x15, 0x05, 0x02, 0x06, 0x06, 0x15, 0x05, 0x02, 0x05, 0x07, 0x15,
+  0x05, 0x02, 0x05, 0x07, 0x15, 0x05, 0x02, 0x05, 0x08, 0x15, 0x05, 0x02,
+  0x05, 0x08, 0x14, 0x05, 0x02, 0x05, 0x09, 0x14, 0x05, 0x02, 0x04, 0x0A,
+  0x14, 0x05, 0x03, 0x04, 0x05, 0x0A, 0x04, 0x14, 0x05, 0x03, 0x04, 0x05,
+  0x0A, 0x05, 0x14, 0x05, 0x03, 0x04, 0x05, 0x0A, 0x05, 0x13, 0x05, 0x03,
+  0x03, 0x05, 0x0B, 0x04, 0x13, 0x05, 0x03, 0x03, 0x05, 0x0B, 0x05, 0x13,
+  0x05, 0x03, 0x03, 0x05, 0x0B, 0x05, 0x13, 0x05, 0x03, 0x03, 0x05, 0x0C,
+  0x04, 0x13, 0x05, 0x03, 0x03, 0x05, 0x0C, 0x05, 0x12, 0x05, 0x03, 0x02,
+  0x05, 0x0C, 0x05, 0x12, 0x05, 0x03, 0x02, 0x05, 0x0D, 0x04, 0x12, 0x05,
+  0x02, 0x02, 0x05, 0x0D, 0x0A, 0x02, 0x02, 0x05, 0x0E, 0x08, 0x02, 0x02,
+  0x04, 0x0E, 0x08, 0x02, 0x01, 0x05, 0x0E, 0x08, 0x02, 0x01, 0x05, 0x0F,
+  0x07, 0x02, 0x01, 0x05, 0x0F, 0x07, 0x02, 0x01, 0x05, 0x0F, 0x06, 0x02,
+  0x00, 0x05, 0x10, 0x05, 0x01, 0x0B, 0x08, 0x01, 0x09, 0x0C, 0x01, 0x07,
+  0x0F, 0x01, 0x06, 0x11, 0x02, 0x05, 0x06, 0x11, 0x07, 0x02, 0x04, 0x06,
+  0x12, 0x06, 0x02, 0x03, 0x05, 0x13, 0x06, 0x02, 0x03, 0x05, 0x14, 0x05,
+  0x02, 0x02, 0x05, 0x14, 0x05, 0x02, 0x02, 0x04, 0x14, 0x05, 0x02, 0x01,
+  0x05, 0x14, 0x05, 0x02, 0x01, 0x05, 0x14, 0x05, 0x02, 0x00, 0x05, 0x14,
+  0x05, 0x02, 0x00, 0x05, 0x14, 0x05, 0x02, 0x00, 0x05, 0x13, 0x05, 0x02,
+  0x00, 0x05, 0x13, 0x05, 0x02, 0x00, 0x05, 0x13, 0x05, 0x02, 0x00, 0x05,
+  0x12, 0x05, 0x02, 0x00, 0x05, 0x11, 0x06, 0x02, 0x00, 0x06, 0x11, 0x05,
+  0x02, 0x01, 0x06, 0x10, 0x05, 0x02, 0x01, 0x07, 0x0E, 0x06, 0x01, 0x02,
+  0x11, 0x01, 0x03, 0x0F, 0x01, 0x04, 0x0C, 0x01, 0x06, 0x08, 0x01, 0x05,
+  0x0E, 0x01, 0x05, 0x10, 0x01, 0x04, 0x12, 0x01, 0x04, 0x13, 0x02, 0x04,
+  0x05, 0x11, 0x06, 0x02, 0x04, 0x05, 0x12, 0x05, 0x02, 0x04, 0x05, 0x12,
+  0x05, 0x02, 0x03, 0x06, 0x12, 0x05, 0x02, 0x03, 0x05, 0x12, 0x05, 0x02,
+  0x03, 0x05, 0x11, 0x05, 0x02, 0x03, 0x05, 0x11, 0x05, 0x02, 0x03, 0x05,
+  0x10, 0x05, 0x01, 0x02, 0x13, 0x01, 0x02, 0x12, 0x01, 0x02, 0x11, 0x01,
+  0x02, 0x0E, 0x01, 0x02, 0x05, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x00, 0x06, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x0B, 0x07, 0x01,
+  0x09, 0x0C, 0x01, 0x07, 0x0F, 0x01, 0x06, 0x11, 0x02, 0x05, 0x07, 0x11,
+  0x07, 0x02, 0x04, 0x06, 0x12, 0x06, 0x02, 0x03, 0x06, 0x13, 0x06, 0x02,
+  0x03, 0x05, 0x14, 0x05, 0x02, 0x02, 0x05, 0x14, 0x05, 0x02, 0x02, 0x04,
+  0x14, 0x05, 0x02, 0x01, 0x05, 0x14, 0x05, 0x02, 0x01, 0x05, 0x14, 0x05,
+  0x02, 0x01, 0x04, 0x14, 0x05, 0x02, 0x00, 0x05, 0x14, 0x05, 0x02, 0x00,
+  0x05, 0x13, 0x05, 0x02, 0x00, 0x05, 0x13, 0x05, 0x03, 0x00, 0x05, 0x0E,
+  0x01, 0x13, 0x05, 0x03, 0x00, 0x05, 0x0D, 0x03, 0x12, 0x05, 0x02, 0x00,
+  0x05, 0x0C, 0x0B, 0x02, 0x00, 0x06, 0x0C, 0x0A, 0x02, 0x01, 0x06, 0x0D,
+  0x08, 0x02, 0x01, 0x07, 0x0D, 0x08, 0x01, 0x02, 0x13, 0x01, 0x03, 0x12,
+  0x01, 0x04, 0x12, 0x02, 0x06, 0x08, 0x12, 0x03, 0x01, 0x12, 0x02, 0x01,
+  0x05, 0x10, 0x01, 0x05, 0x12, 0x01, 0x05, 0x12, 0x01, 0x04, 0x14, 0x02,
+  0x04, 0x05, 0x12, 0x06, 0x02, 0x04, 0x05, 0x13, 0x05, 0x02, 0x04, 0x05,
+  0x13, 0x05, 0x02, 0x04, 0x05, 0x13, 0x05, 0x02, 0x03, 0x06, 0x13, 0x04,
+  0x02, 0x03, 0x05, 0x12, 0x05, 0x02, 0x03, 0x05, 0x11, 0x05, 0x01, 0x03,
+  0x12, 0x01, 0x03, 0x10, 0x01, 0x02, 0x12, 0x01, 0x02, 0x13, 0x02, 0x02,
+  0x05, 0x0F, 0x06, 0x02, 0x02, 0x05, 0x10, 0x05, 0x02, 0x02, 0x05, 0x10,
+  0x05, 0x02, 0x01, 0x06, 0x10, 0x05, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02,
+  0x01, 0x05, 0x0F, 0x05, 0x02, 0x01, 0x05, 0x0F, 0x05, 0x02, 0x01, 0x05,
+  0x0F, 0x05, 0x02, 0x00, 0x06, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05,
+  0x02, 0x00, 0x05, 0x0F, 0x05, 0x01, 0x0A, 0x08, 0x01, 0x07, 0x0D, 0x01,
+  0x06, 0x0F, 0x01, 0x05, 0x11, 0x02, 0x04, 0x06, 0x10, 0x06, 0x02, 0x04,
+  0x05, 0x11, 0x05, 0x02, 0x03, 0x05, 0x11, 0x05, 0x02, 0x03, 0x05, 0x11,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x06, 0x01, 0x03, 0x07, 0x01, 0x03,
+  0x0C, 0x01, 0x04, 0x0E, 0x01, 0x05, 0x0F, 0x01, 0x07, 0x0E, 0x01, 0x0C,
+  0x09, 0x01, 0x0F, 0x06, 0x01, 0x10, 0x05, 0x02, 0x00, 0x05, 0x10, 0x05,
+  0x02, 0x00, 0x05, 0x10, 0x04, 0x02, 0x00, 0x06, 0x0F, 0x05, 0x02, 0x00,
+  0x07, 0x0D, 0x06, 0x01, 0x01, 0x12, 0x01, 0x02, 0x10, 0x01, 0x03, 0x0D,
+  0x01, 0x05, 0x09, 0x01, 0x01, 0x14, 0x01, 0x01, 0x14, 0x01, 0x00, 0x15,
+  0x01, 0x00, 0x15, 0x01, 0x08, 0x05, 0x01, 0x07, 0x06, 0x01, 0x07, 0x05,
+  0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x06, 0x06,
+  0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05,
+  0x01, 0x05, 0x06, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05,
+  0x01, 0x05, 0x05, 0x01, 0x04, 0x06, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x06, 0x02, 0x04, 0x05,
+  0x13, 0x05, 0x02, 0x03, 0x06, 0x13, 0x05, 0x02, 0x03, 0x05, 0x13, 0x05,
+  0x02, 0x03, 0x05, 0x12, 0x06, 0x02, 0x03, 0x05, 0x12, 0x05, 0x02, 0x03,
+  0x05, 0x12, 0x05, 0x02, 0x02, 0x05, 0x12, 0x05, 0x02, 0x02, 0x05, 0x11,
+  0x06, 0x02, 0x02, 0x05, 0x11, 0x05, 0x02, 0x02, 0x05, 0x11, 0x05, 0x02,
+  0x02, 0x05, 0x11, 0x05, 0x02, 0x01, 0x05, 0x11, 0x05, 0x02, 0x01, 0x05,
+  0x10, 0x06, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x01, 0x05, 0x10, 0x05,
+  0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00,
+  0x05, 0x0F, 0x06, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F,
+  0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x07, 0x0C, 0x07, 0x01,
+  0x01, 0x11, 0x01, 0x01, 0x10, 0x01, 0x03, 0x0C, 0x01, 0x05, 0x08, 0x02,
+  0x00, 0x06, 0x11, 0x05, 0x02, 0x00, 0x06, 0x10, 0x05, 0x02, 0x01, 0x05,
+  0x10, 0x05, 0x02, 0x01, 0x05, 0x0F, 0x05, 0x02, 0x01, 0x05, 0x0F, 0x05,
+  0x02, 0x01, 0x05, 0x0E, 0x05, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x02, 0x01,
+  0x05, 0x0D, 0x05, 0x02, 0x01, 0x05, 0x0D, 0x04, 0x02, 0x01, 0x05, 0x0C,
+  0x05, 0x02, 0x02, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x04, 0x0B, 0x05, 0x02,
+  0x02, 0x05, 0x0B, 0x04, 0x02, 0x02, 0x05, 0x0A, 0x05, 0x02, 0x02, 0x05,
+  0x0A, 0x04, 0x02, 0x02, 0x05, 0x09, 0x05, 0x02, 0x02, 0x05, 0x09, 0x04,
+  0x02, 0x02, 0x05, 0x08, 0x05, 0x02, 0x03, 0x04, 0x08, 0x04, 0x01, 0x03,
+  0x09, 0x01, 0x03, 0x08, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03,
+  0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x05, 0x03, 0x00, 0x05, 0x0D, 0x06,
+  0x1B, 0x05, 0x03, 0x00, 0x05, 0x0D, 0x06, 0x1A, 0x06, 0x03, 0x00, 0x05,
+  0x0C, 0x07, 0x1A, 0x05, 0x03, 0x00, 0x05, 0x0C, 0x07, 0x19, 0x06, 0x03,
+  0x00, 0x05, 0x0B, 0x08, 0x19, 0x05, 0x03, 0x00, 0x05, 0x0B, 0x08, 0x19,
+  0x05, 0x03, 0x00, 0x05, 0x0A, 0x09, 0x18, 0x05, 0x04, 0x00, 0x05, 0x0A,
+  0x04, 0x0F, 0x04, 0x18, 0x05, 0x04, 0x01, 0x04, 0x0A, 0x04, 0x0F, 0x04,
+  0x17, 0x05, 0x04, 0x01, 0x04, 0x09, 0x04, 0x0F, 0x04, 0x17, 0x05, 0x04,
+  0x01, 0x04, 0x09, 0x04, 0x0F, 0x04, 0x17, 0x04, 0x04, 0x01, 0x04, 0x08,
+  0x05, 0x0F, 0x04, 0x16, 0x05, 0x04, 0x01, 0x04, 0x08, 0x04, 0x0F, 0x04,
+  0x16, 0x04, 0x04, 0x01, 0x04, 0x07, 0x05, 0x0F, 0x04, 0x15, 0x05, 0x04,
+  0x01, 0x04, 0x07, 0x04, 0x0F, 0x04, 0x15, 0x04, 0x04, 0x01, 0x04, 0x07,
+  0x04, 0x0F, 0x04, 0x15, 0x04, 0x04, 0x01, 0x04, 0x06, 0x04, 0x0F, 0x04,
+  0x14, 0x05, 0x04, 0x01, 0x04, 0x06, 0x04, 0x0F, 0x04, 0x14, 0x04, 0x02,
+  0x01, 0x08, 0x0F, 0x09, 0x02, 0x01, 0x08, 0x0F, 0x08, 0x02, 0x01, 0x07,
+  0x0F, 0x08, 0x02, 0x01, 0x07, 0x0F, 0x07, 0x02, 0x01, 0x07, 0x0F, 0x07,
+  0x02, 0x01, 0x06, 0x0F, 0x06, 0x02, 0x02, 0x05, 0x0F, 0x06, 0x02, 0x02,
+  0x04, 0x0F, 0x05, 0x02, 0x06, 0x06, 0x15, 0x06, 0x02, 0x06, 0x06, 0x14,
+  0x06, 0x02, 0x07, 0x06, 0x13, 0x06, 0x02, 0x07, 0x06, 0x12, 0x06, 0x02,
+  0x07, 0x06, 0x12, 0x05, 0x02, 0x08, 0x06, 0x11, 0x05, 0x02, 0x08, 0x06,
+  0x10, 0x06, 0x02, 0x09, 0x05, 0x0F, 0x06, 0x01, 0x09, 0x0B, 0x01, 0x09,
+  0x0A, 0x01, 0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01, 0x0A, 0x07, 0x01, 0x0A,
+  0x07, 0x01, 0x09, 0x08, 0x01, 0x08, 0x0A, 0x01, 0x08, 0x0A, 0x02, 0x07,
+  0x05, 0x0D, 0x05, 0x02, 0x06, 0x06, 0x0D, 0x06, 0x02, 0x05, 0x06, 0x0D,
+  0x06, 0x02, 0x04, 0x06, 0x0E, 0x06, 0x02, 0x03, 0x06, 0x0E, 0x06, 0x02,
+  0x03, 0x06, 0x0E, 0x06, 0x02, 0x02, 0x06, 0x0F, 0x06, 0x02, 0x01, 0x06,
+  0x0F, 0x06, 0x02, 0x00, 0x06, 0x0F, 0x07, 0x02, 0x01, 0x05, 0x10, 0x06,
+  0x02, 0x01, 0x06, 0x0F, 0x06, 0x02, 0x01, 0x06, 0x0F, 0x05, 0x02, 0x01,
+  0x06, 0x0E, 0x06, 0x02, 0x02, 0x05, 0x0D, 0x06, 0x02, 0x02, 0x06, 0x0D,
+  0x05, 0x02, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x05, 0x0B, 0x06, 0x02,
+  0x03, 0x05, 0x0B, 0x05, 0x02, 0x03, 0x06, 0x0A, 0x06, 0x02, 0x04, 0x05,
+  0x0A, 0x05, 0x01, 0x04, 0x0A, 0x01, 0x04, 0x09, 0x01, 0x05, 0x08, 0x01,
+  0x05, 0x07, 0x01, 0x05, 0x06, 0x01, 0x05, 0x06, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x06, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x05, 0x14, 0x01, 0x05, 0x13, 0x01, 0x05, 0x13, 0x01, 0x05, 0x13, 0x01,
+  0x11, 0x06, 0x01, 0x10, 0x06, 0x01, 0x0F, 0x06, 0x01, 0x0E, 0x07, 0x01,
+  0x0D, 0x07, 0x01, 0x0C, 0x07, 0x01, 0x0C, 0x06, 0x01, 0x0B, 0x06, 0x01,
+  0x0A, 0x06, 0x01, 0x09, 0x06, 0x01, 0x08, 0x06, 0x01, 0x07, 0x06, 0x01,
+  0x06, 0x06, 0x01, 0x05, 0x06, 0x01, 0x04, 0x06, 0x01, 0x03, 0x06, 0x01,
+  0x02, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x13, 0x01, 0x01, 0x13, 0x01,
+  0x00, 0x14, 0x01, 0x00, 0x13, 0x01, 0x07, 0x08, 0x01, 0x07, 0x08, 0x01,
+  0x07, 0x08, 0x01, 0x06, 0x09, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x04, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x08, 0x01,
+  0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x03, 0x01,
+  0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
+  0x07, 0x08, 0x01, 0x07, 0x08, 0x01, 0x07, 0x08, 0x01, 0x06, 0x08, 0x01,
+  0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x05, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01,
+  0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x04, 0x01, 0x00, 0x09, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01,
+  0x00, 0x08, 0x01, 0x09, 0x05, 0x01, 0x08, 0x06, 0x01, 0x07, 0x07, 0x01,
+  0x07, 0x07, 0x01, 0x06, 0x08, 0x02, 0x06, 0x03, 0x0B, 0x04, 0x02, 0x05,
+  0x04, 0x0B, 0x04, 0x02, 0x04, 0x04, 0x0B, 0x04, 0x02, 0x04, 0x04, 0x0B,
+  0x04, 0x02, 0x03, 0x04, 0x0B, 0x04, 0x02, 0x03, 0x03, 0x0C, 0x04, 0x02,
+  0x02, 0x04, 0x0C, 0x04, 0x02, 0x01, 0x04, 0x0C, 0x04, 0x02, 0x01, 0x04,
+  0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x01, 0x00, 0x15, 0x01, 0x00,
+  0x15, 0x01, 0x00, 0x15, 0x01, 0x00, 0x04, 0x01, 0x01, 0x03, 0x01, 0x02,
+  0x02, 0x01, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x07, 0x08, 0x01, 0x05,
+  0x0C, 0x01, 0x04, 0x0D, 0x01, 0x03, 0x0F, 0x02, 0x03, 0x05, 0x0C, 0x06,
+  0x02, 0x03, 0x04, 0x0D, 0x05, 0x01, 0x0D, 0x05, 0x01, 0x0A, 0x07, 0x01,
+  0x05, 0x0C, 0x01, 0x03, 0x0E, 0x02, 0x02, 0x09, 0x0C, 0x05, 0x02, 0x01,
+  0x05, 0x0B, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x05, 0x0A,
+  0x06, 0x02, 0x00, 0x05, 0x09, 0x07, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x02, 0x01, 0x08, 0x0A, 0x05, 0x02, 0x03, 0x04, 0x0A, 0x06, 0x01, 0x05,
+  0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x02, 0x04, 0x05, 0x0B, 0x06,
+  0x01, 0x04, 0x0E, 0x01, 0x03, 0x10, 0x01, 0x03, 0x10, 0x02, 0x03, 0x07,
+  0x0E, 0x06, 0x02, 0x03, 0x06, 0x0E, 0x06, 0x02, 0x03, 0x05, 0x0F, 0x05,
+  0x02, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x02,
+  0x04, 0x0F, 0x05, 0x02, 0x02, 0x04, 0x0F, 0x05, 0x02, 0x02, 0x04, 0x0E,
+  0x05, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x02, 0x01, 0x06, 0x0D, 0x05, 0x02,
+  0x01, 0x07, 0x0B, 0x07, 0x01, 0x01, 0x10, 0x01, 0x01, 0x0F, 0x02, 0x00,
+  0x05, 0x06, 0x09, 0x02, 0x00, 0x05, 0x07, 0x06, 0x01, 0x08, 0x06, 0x01,
+  0x05, 0x0B, 0x01, 0x04, 0x0D, 0x01, 0x03, 0x0F, 0x02, 0x02, 0x06, 0x0C,
+  0x06, 0x02, 0x02, 0x05, 0x0D, 0x05, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x05,
+  0x02, 0x00, 0x06, 0x0A, 0x06, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x0D, 0x01,
+  0x02, 0x0B, 0x01, 0x04, 0x07, 0x01, 0x10, 0x05, 0x01, 0x10, 0x05, 0x01,
+  0x10, 0x05, 0x01, 0x10, 0x05, 0x01, 0x10, 0x05, 0x01, 0x0F, 0x05, 0x01,
+  0x0F, 0x05, 0x02, 0x07, 0x06, 0x0F, 0x05, 0x02, 0x05, 0x09, 0x0F, 0x05,
+  0x01, 0x04, 0x10, 0x01, 0x03, 0x10, 0x02, 0x02, 0x07, 0x0C, 0x07, 0x02,
+  0x02, 0x05, 0x0D, 0x06, 0x02, 0x01, 0x05, 0x0D, 0x06, 0x02, 0x01, 0x05,
+  0x0E, 0x04, 0x02, 0x00, 0x05, 0x0E, 0x04, 0x02, 0x00, 0x05, 0x0D, 0x05,
+  0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00,
+  0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x02, 0x00, 0x06, 0x0A,
+  0x07, 0x01, 0x01, 0x10, 0x01, 0x01, 0x10, 0x01, 0x02, 0x0E, 0x02, 0x03,
+  0x06, 0x0B, 0x05, 0x01, 0x08, 0x07, 0x01, 0x06, 0x0A, 0x01, 0x04, 0x0D,
+  0x01, 0x03, 0x0F, 0x02, 0x02, 0x06, 0x0D, 0x06, 0x02, 0x02, 0x05, 0x0E,
+  0x05, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x01,
+  0x01, 0x12, 0x01, 0x00, 0x13, 0x01, 0x00, 0x13, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x06, 0x0B, 0x06,
+  0x01, 0x01, 0x0F, 0x01, 0x01, 0x0E, 0x01, 0x03, 0x0A, 0x01, 0x04, 0x07,
+  0x01, 0x08, 0x05, 0x01, 0x06, 0x07, 0x01, 0x05, 0x08, 0x01, 0x05, 0x08,
+  0x01, 0x05, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x01, 0x0B,
+  0x01, 0x01, 0x0B, 0x01, 0x01, 0x0A, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x02, 0x09, 0x05, 0x11, 0x05, 0x02,
+  0x07, 0x09, 0x11, 0x05, 0x02, 0x06, 0x0A, 0x11, 0x04, 0x01, 0x05, 0x10,
+  0x02, 0x04, 0x07, 0x0E, 0x07, 0x02, 0x04, 0x05, 0x0F, 0x06, 0x02, 0x03,
+  0x06, 0x10, 0x05, 0x02, 0x03, 0x05, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10,
+  0x04, 0x02, 0x02, 0x05, 0x10, 0x04, 0x02, 0x02, 0x05, 0x0F, 0x05, 0x02,
+  0x02, 0x05, 0x0F, 0x04, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x05,
+  0x0D, 0x06, 0x02, 0x02, 0x06, 0x0C, 0x07, 0x01, 0x03, 0x10, 0x01, 0x03,
+  0x0F, 0x02, 0x04, 0x09, 0x0E, 0x04, 0x02, 0x06, 0x05, 0x0D, 0x05, 0x01,
+  0x0D, 0x05, 0x01, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00,
+  0x05, 0x0C, 0x05, 0x02, 0x00, 0x06, 0x0A, 0x06, 0x01, 0x01, 0x0E, 0x01,
+  0x02, 0x0C, 0x01, 0x04, 0x07, 0x01, 0x06, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x04, 0x05, 0x02, 0x04, 0x05, 0x0C, 0x05, 0x02, 0x04, 0x05, 0x0A, 0x09,
+  0x01, 0x04, 0x10, 0x01, 0x04, 0x10, 0x02, 0x03, 0x07, 0x0E, 0x06, 0x02,
+  0x03, 0x06, 0x0F, 0x05, 0x02, 0x03, 0x05, 0x0F, 0x05, 0x02, 0x03, 0x05,
+  0x0F, 0x05, 0x02, 0x03, 0x04, 0x0F, 0x05, 0x02, 0x02, 0x05, 0x0E, 0x05,
+  0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x02,
+  0x05, 0x0E, 0x05, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x02, 0x01, 0x05, 0x0D,
+  0x05, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x02,
+  0x01, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x04, 0x01, 0x05, 0x05,
+  0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x05, 0x00, 0x00, 0x00,
+  0x01, 0x04, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x0A, 0x05,
+  0x01, 0x0A, 0x04, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x00, 0x00, 0x00,
+  0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05,
+  0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05,
+  0x01, 0x07, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05,
+  0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05,
+  0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x06, 0x01, 0x01, 0x07,
+  0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x01, 0x00, 0x05, 0x01, 0x05, 0x05,
+  0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x04,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x02, 0x04, 0x05, 0x0F, 0x05, 0x02,
+  0x04, 0x05, 0x0E, 0x05, 0x02, 0x03, 0x05, 0x0D, 0x05, 0x02, 0x03, 0x05,
+  0x0B, 0x06, 0x02, 0x03, 0x05, 0x0A, 0x06, 0x02, 0x03, 0x05, 0x09, 0x06,
+  0x01, 0x03, 0x0B, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0C,
+  0x01, 0x02, 0x0C, 0x02, 0x02, 0x06, 0x09, 0x05, 0x02, 0x01, 0x06, 0x09,
+  0x06, 0x02, 0x01, 0x05, 0x0A, 0x05, 0x02, 0x01, 0x05, 0x0A, 0x05, 0x02,
+  0x01, 0x05, 0x0A, 0x06, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x05,
+  0x0B, 0x06, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04,
+  0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02,
+  0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x03, 0x04, 0x05, 0x0C, 0x05, 0x16, 0x06, 0x03, 0x04, 0x05, 0x0A,
+  0x08, 0x14, 0x09, 0x02, 0x04, 0x04, 0x09, 0x15, 0x01, 0x03, 0x1B, 0x03,
+  0x03, 0x07, 0x0D, 0x08, 0x19, 0x05, 0x03, 0x03, 0x05, 0x0E, 0x05, 0x19,
+  0x05, 0x03, 0x03, 0x05, 0x0E, 0x05, 0x19, 0x05, 0x03, 0x02, 0x05, 0x0D,
+  0x05, 0x18, 0x05, 0x03, 0x02, 0x05, 0x0D, 0x05, 0x18, 0x05, 0x03, 0x02,
+  0x05, 0x0D, 0x05, 0x18, 0x05, 0x03, 0x02, 0x05, 0x0D, 0x05, 0x18, 0x05,
+  0x03, 0x02, 0x05, 0x0D, 0x05, 0x18, 0x05, 0x03, 0x01, 0x05, 0x0C, 0x05,
+  0x17, 0x05, 0x03, 0x01, 0x05, 0x0C, 0x05, 0x17, 0x05, 0x03, 0x01, 0x05,
+  0x0C, 0x05, 0x17, 0x05, 0x03, 0x01, 0x05, 0x0C, 0x05, 0x17, 0x05, 0x03,
+  0x01, 0x05, 0x0C, 0x05, 0x17, 0x04, 0x03, 0x00, 0x05, 0x0B, 0x05, 0x16,
+  0x05, 0x03, 0x00, 0x05, 0x0B, 0x05, 0x16, 0x05, 0x02, 0x04, 0x05, 0x0C,
+  0x05, 0x02, 0x04, 0x05, 0x0A, 0x09, 0x01, 0x04, 0x10, 0x01, 0x03, 0x11,
+  0x02, 0x03, 0x07, 0x0E, 0x06, 0x02, 0x03, 0x06, 0x0F, 0x05, 0x02, 0x03,
+  0x05, 0x0F, 0x05, 0x02, 0x03, 0x05, 0x0F, 0x05, 0x02, 0x02, 0x05, 0x0F,
+  0x05, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x02,
+  0x02, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x04, 0x0E, 0x05, 0x02, 0x01, 0x05,
+  0x0E, 0x05, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x02, 0x01, 0x05, 0x0D, 0x05,
+  0x02, 0x01, 0x05, 0x0D, 0x05, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x02, 0x00,
+  0x05, 0x0D, 0x04, 0x01, 0x08, 0x07, 0x01, 0x06, 0x0B, 0x01, 0x04, 0x0E,
+  0x01, 0x03, 0x0F, 0x02, 0x02, 0x07, 0x0C, 0x07, 0x02, 0x02, 0x05, 0x0D,
+  0x06, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x02,
+  0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05,
+  0x0D, 0x06, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05,
+  0x02, 0x00, 0x06, 0x0C, 0x05, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x01, 0x01,
+  0x0F, 0x01, 0x01, 0x0E, 0x01, 0x02, 0x0B, 0x01, 0x04, 0x07, 0x02, 0x06,
+  0x05, 0x0D, 0x06, 0x02, 0x06, 0x05, 0x0C, 0x08, 0x02, 0x05, 0x05, 0x0B,
+  0x0A, 0x01, 0x05, 0x10, 0x02, 0x05, 0x07, 0x10, 0x06, 0x02, 0x05, 0x06,
+  0x11, 0x05, 0x02, 0x05, 0x05, 0x11, 0x05, 0x02, 0x04, 0x05, 0x11, 0x05,
+  0x02, 0x04, 0x05, 0x11, 0x05, 0x02, 0x04, 0x05, 0x11, 0x05, 0x02, 0x04,
+  0x04, 0x11, 0x05, 0x02, 0x04, 0x04, 0x10, 0x05, 0x02, 0x03, 0x05, 0x10,
+  0x05, 0x02, 0x03, 0x06, 0x0F, 0x05, 0x02, 0x03, 0x07, 0x0D, 0x07, 0x01,
+  0x03, 0x10, 0x01, 0x03, 0x0F, 0x02, 0x02, 0x05, 0x08, 0x09, 0x02, 0x02,
+  0x05, 0x09, 0x06, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x00, 0x05, 0x02, 0x07, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x09, 0x0F,
+  0x05, 0x02, 0x04, 0x0A, 0x0F, 0x05, 0x01, 0x03, 0x10, 0x02, 0x02, 0x07,
+  0x0C, 0x07, 0x02, 0x02, 0x05, 0x0D, 0x06, 0x02, 0x01, 0x05, 0x0E, 0x05,
+  0x02, 0x01, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x04, 0x02, 0x00,
+  0x05, 0x0E, 0x04, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D,
+  0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x02,
+  0x00, 0x06, 0x0A, 0x07, 0x01, 0x01, 0x10, 0x01, 0x01, 0x10, 0x01, 0x02,
+  0x0E, 0x02, 0x03, 0x06, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05,
+  0x01, 0x0B, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05,
+  0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x02, 0x04, 0x05, 0x0C, 0x03, 0x02,
+  0x04, 0x05, 0x0A, 0x05, 0x01, 0x04, 0x0A, 0x01, 0x03, 0x0B, 0x01, 0x03,
+  0x07, 0x01, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02,
+  0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x07, 0x07, 0x01, 0x05,
+  0x0B, 0x01, 0x04, 0x0D, 0x01, 0x03, 0x0F, 0x02, 0x02, 0x06, 0x0C, 0x06,
+  0x02, 0x02, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x06, 0x01, 0x02, 0x09, 0x01,
+  0x02, 0x0C, 0x01, 0x03, 0x0D, 0x01, 0x05, 0x0C, 0x01, 0x08, 0x09, 0x01,
+  0x0B, 0x06, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x06, 0x0B, 0x06,
+  0x01, 0x00, 0x10, 0x01, 0x01, 0x0E, 0x01, 0x02, 0x0C, 0x01, 0x04, 0x07,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x05, 0x01, 0x01, 0x09, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x01, 0x06, 0x02, 0x03, 0x05,
+  0x0F, 0x05, 0x02, 0x03, 0x05, 0x0F, 0x05, 0x02, 0x02, 0x05, 0x0E, 0x05,
+  0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x02,
+  0x05, 0x0E, 0x05, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x01, 0x05, 0x0D,
+  0x05, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x02,
+  0x01, 0x05, 0x0D, 0x05, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05,
+  0x0C, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x02, 0x00, 0x05, 0x0A, 0x07,
+  0x01, 0x00, 0x11, 0x01, 0x00, 0x10, 0x02, 0x01, 0x09, 0x0B, 0x05, 0x02,
+  0x02, 0x06, 0x0B, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x06, 0x02, 0x00, 0x05,
+  0x0C, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x05,
+  0x02, 0x00, 0x05, 0x0A, 0x05, 0x02, 0x00, 0x05, 0x0A, 0x05, 0x02, 0x00,
+  0x05, 0x09, 0x05, 0x02, 0x01, 0x04, 0x09, 0x05, 0x02, 0x01, 0x04, 0x08,
+  0x05, 0x02, 0x01, 0x04, 0x08, 0x05, 0x02, 0x01, 0x04, 0x07, 0x05, 0x02,
+  0x01, 0x05, 0x07, 0x04, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x09, 0x01, 0x02,
+  0x08, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x06, 0x01, 0x02,
+  0x06, 0x03, 0x00, 0x05, 0x0B, 0x05, 0x15, 0x06, 0x03, 0x00, 0x05, 0x0B,
+  0x05, 0x15, 0x05, 0x03, 0x00, 0x05, 0x0A, 0x06, 0x15, 0x05, 0x03, 0x00,
+  0x05, 0x0A, 0x06, 0x14, 0x05, 0x03, 0x00, 0x05, 0x09, 0x07, 0x14, 0x05,
+  0x03, 0x00, 0x05, 0x09, 0x07, 0x13, 0x05, 0x04, 0x00, 0x05, 0x08, 0x04,
+  0x0D, 0x03, 0x13, 0x05, 0x04, 0x01, 0x04, 0x08, 0x04, 0x0D, 0x03, 0x12,
+  0x05, 0x04, 0x01, 0x04, 0x07, 0x04, 0x0D, 0x03, 0x12, 0x05, 0x04, 0x01,
+  0x04, 0x07, 0x04, 0x0D, 0x03, 0x12, 0x04, 0x04, 0x01, 0x04, 0x06, 0x04,
+  0x0D, 0x03, 0x11, 0x05, 0x04, 0x01, 0x04, 0x06, 0x04, 0x0D, 0x03, 0x11,
+  0x04, 0x03, 0x01, 0x04, 0x06, 0x04, 0x0D, 0x08, 0x02, 0x01, 0x08, 0x0D,
+  0x07, 0x02, 0x01, 0x08, 0x0D, 0x07, 0x02, 0x01, 0x07, 0x0D, 0x06, 0x02,
+  0x01, 0x07, 0x0D, 0x06, 0x02, 0x01, 0x06, 0x0D, 0x05, 0x02, 0x01, 0x06,
+  0x0D, 0x05, 0x02, 0x04, 0x06, 0x0F, 0x06, 0x02, 0x04, 0x06, 0x0F, 0x05,
+  0x02, 0x05, 0x05, 0x0E, 0x05, 0x02, 0x05, 0x06, 0x0D, 0x06, 0x02, 0x06,
+  0x05, 0x0C, 0x06, 0x02, 0x06, 0x05, 0x0C, 0x05, 0x01, 0x07, 0x09, 0x01,
+  0x07, 0x08, 0x01, 0x07, 0x07, 0x01, 0x08, 0x05, 0x01, 0x07, 0x07, 0x01,
+  0x06, 0x08, 0x01, 0x05, 0x0A, 0x02, 0x04, 0x05, 0x0A, 0x05, 0x02, 0x03,
+  0x06, 0x0A, 0x06, 0x02, 0x03, 0x05, 0x0B, 0x05, 0x02, 0x02, 0x05, 0x0B,
+  0x06, 0x02, 0x01, 0x06, 0x0B, 0x06, 0x02, 0x00, 0x06, 0x0C, 0x05, 0x02,
+  0x03, 0x06, 0x11, 0x05, 0x02, 0x04, 0x05, 0x10, 0x05, 0x02, 0x04, 0x05,
+  0x10, 0x04, 0x02, 0x04, 0x05, 0x0F, 0x05, 0x02, 0x04, 0x05, 0x0F, 0x04,
+  0x02, 0x04, 0x05, 0x0E, 0x05, 0x02, 0x04, 0x05, 0x0E, 0x04, 0x02, 0x04,
+  0x05, 0x0D, 0x05, 0x02, 0x05, 0x04, 0x0D, 0x04, 0x02, 0x05, 0x05, 0x0C,
+  0x05, 0x02, 0x05, 0x05, 0x0C, 0x04, 0x02, 0x05, 0x05, 0x0B, 0x05, 0x02,
+  0x05, 0x05, 0x0B, 0x04, 0x01, 0x05, 0x09, 0x01, 0x05, 0x09, 0x01, 0x05,
+  0x08, 0x01, 0x06, 0x07, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x05, 0x01, 0x01,
+  0x08, 0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x01, 0x00, 0x05, 0x01, 0x04,
+  0x0F, 0x01, 0x04, 0x0F, 0x01, 0x04, 0x0F, 0x01, 0x04, 0x0E, 0x01, 0x0C,
+  0x06, 0x01, 0x0B, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x06, 0x01, 0x07,
+  0x07, 0x01, 0x06, 0x06, 0x01, 0x05, 0x06, 0x01, 0x04, 0x06, 0x01, 0x03,
+  0x06, 0x01, 0x02, 0x06, 0x01, 0x01, 0x06, 0x01, 0x00, 0x10, 0x01, 0x00,
+  0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x09, 0x05, 0x01, 0x08,
+  0x06, 0x01, 0x07, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04,
+  0x04, 0x01, 0x03, 0x05, 0x01, 0x01, 0x06, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x06, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x07, 0x01, 0x01, 0x06, 0x01, 0x02, 0x05, 0x01, 0x03, 0x04, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x01,
+  0x07, 0x04, 0x01, 0x07, 0x05, 0x01, 0x07, 0x06, 0x01, 0x06, 0x07, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x04, 0x01,
+  0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x06, 0x01,
+  0x0A, 0x03, 0x01, 0x07, 0x06, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x03, 0x05, 0x01, 0x01, 0x06, 0x01, 0x00, 0x07, 0x01, 0x00, 0x06, 0x01,
+  0x00, 0x05, 0x01, 0x04, 0x04, 0x02, 0x02, 0x07, 0x0E, 0x03, 0x02, 0x01,
+  0x09, 0x0E, 0x03, 0x02, 0x01, 0x03, 0x07, 0x09, 0x02, 0x01, 0x02, 0x09,
+  0x07, 0x01, 0x0A, 0x04 };
+
+const GFXglyph FreeSansBoldOblique18pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,  10,    0,    1 },   // 0x20 ' '
+  {     0,  10,  25,  12,    4,  -24 },   // 0x21 '!'
+  {    75,  13,   9,  17,    6,  -25 },   // 0x22 '"'
+  {   120,  22,  24,  19,    1,  -23 },   // 0x23 '#'
+  {   224,  19,  31,  19,    2,  -26 },   // 0x24 '$'
+  {   355,  26,  26,  31,    5,  -25 },   // 0x25 '%'
+  {   501,  21,  25,  25,    3,  -24 },   // 0x26 '&'
+  {   608,   5,   9,   8,    6,  -25 },   // 0x27 '''
+  {   635,  13,  33,  12,    3,  -25 },   // 0x28 '('
+  {   734,  13,  33,  12,   -1,  -25 },   // 0x29 ')'
+  {   833,  12,  11,  14,    5,  -25 },   // 0x2A '*'
+  {   876,  18,  16,  20,    3,  -15 },   // 0x2B '+'
+  {   924,   7,  11,  10,    1,   -4 },   // 0x2C ','
+  {   957,  10,   4,  12,    2,  -10 },   // 0x2D '-'
+  {   969,   6,   5,  10,    2,   -4 },   // 0x2E '.'
+  {   984,  15,  25,  10,    0,  -24 },   // 0x2F '/'
+  {  1059,  18,  25,  19,    3,  -24 },   // 0x30 '0'
+  {  1168,  13,  25,  19,    6,  -24 },   // 0x31 '1'
+  {  1243,  21,  25,  19,    1,  -24 },   // 0x32 '2'
+  {  1328,  20,  25,  19,    2,  -24 },   // 0x33 '3'
+  {  1419,  19,  25,  19,    2,  -24 },   // 0x34 '4'
+  {  1514,  20,  24,  19,    2,  -23 },   // 0x35 '5'
+  {  1598,  19,  25,  19,    3,  -24 },   // 0x36 '6'
+  {  1697,  19,  24,  19,    5,  -23 },   // 0x37 '7'
+  {  1769,  20,  25,  19,    2,  -24 },   // 0x38 '8'
+  {  1870,  19,  25,  19,    2,  -24 },   // 0x39 '9'
+  {  1969,   9,  18,  12,    4,  -17 },   // 0x3A ':'
+  {  2007,  10,  24,  12,    3,  -17 },   // 0x3B ';'
+  {  2063,  19,  17,  20,    3,  -16 },   // 0x3C '<'
+  {  2114,  20,  12,  20,    2,  -13 },   // 0x3D '='
+  {  2142,  19,  17,  20,    1,  -15 },   // 0x3E '>'
+  {  2193,  18,  26,  21,    6,  -25 },   // 0x3F '?'
+  {  2277,  33,  31,  34,    3,  -25 },   // 0x40 '@'
+  {  2474,  23,  26,  25,    1,  -25 },   // 0x41 'A'
+  {  2582,  24,  26,  25,    3,  -25 },   // 0x42 'B'
+  {  2688,  24,  26,  25,    4,  -25 },   // 0x43 'C'
+  {  2786,  24,  26,  25,    3,  -25 },   // 0x44 'D'
+  {  2900,  24,  26,  23,    3,  -25 },   // 0x45 'E'
+  {  2978,  23,  26,  21,    3,  -25 },   // 0x46 'F'
+  {  3056,  24,  26,  27,    4,  -25 },   // 0x47 'G'
+  {  3168,  26,  26,  25,    2,  -25 },   // 0x48 'H'
+  {  3290,  10,  26,  10,    2,  -25 },   // 0x49 'I'
+  {  3368,  20,  26,  19,    2,  -25 },   // 0x4A 'J'
+  {  3458,  26,  26,  25,    3,  -25 },   // 0x4B 'K'
+  {  3580,  18,  26,  21,    3,  -25 },   // 0x4C 'L'
+  {  3658,  31,  26,  29,    2,  -25 },   // 0x4D 'M'
+  {  3850,  27,  26,  25,    2,  -25 },   // 0x4E 'N'
+  {  4000,  25,  26,  27,    4,  -25 },   // 0x4F 'O'
+  {  4114,  23,  26,  23,    3,  -25 },   // 0x50 'P'
+  {  4208,  25,  27,  27,    4,  -25 },   // 0x51 'Q'
+  {  4331,  24,  26,  25,    3,  -25 },   // 0x52 'R'
+  {  4445,  22,  26,  23,    3,  -25 },   // 0x53 'S'
+  {  4539,  21,  26,  21,    5,  -25 },   // 0x54 'T'
+  {  4617,  24,  26,  25,    4,  -25 },   // 0x55 'U'
+  {  4739,  22,  26,  23,    6,  -25 },   // 0x56 'V'
+  {  4855,  32,  26,  33,    6,  -25 },   // 0x57 'W'
+  {  5043,  27,  26,  23,    1,  -25 },   // 0x58 'X'
+  {  5155,  22,  26,  23,    6,  -25 },   // 0x59 'Y'
+  {  5255,  25,  26,  21,    1,  -25 },   // 0x5A 'Z'
+  {  5333,  15,  33,  12,    1,  -25 },   // 0x5B '['
+  {  5432,   5,  25,  10,    5,  -24 },   // 0x5C '\'
+  {  5507,  15,  33,  12,   -1,  -25 },   // 0x5D ']'
+  {  5606,  16,  15,  20,    4,  -23 },   // 0x5E '^'
+  {  5671,  21,   3,  19,   -2,    5 },   // 0x5F '_'
+  {  5680,   5,   5,  12,    6,  -25 },   // 0x60 '`'
+  {  5695,  18,  19,  19,    2,  -18 },   // 0x61 'a'
+  {  5770,  20,  26,  21,    2,  -25 },   // 0x62 'b'
+  {  5876,  18,  19,  19,    3,  -18 },   // 0x63 'c'
+  {  5945,  22,  26,  21,    3,  -25 },   // 0x64 'd'
+  {  6051,  19,  19,  19,    2,  -18 },   // 0x65 'e'
+  {  6120,  13,  26,  12,    3,  -25 },   // 0x66 'f'
+  {  6198,  22,  27,  21,    1,  -18 },   // 0x67 'g'
+  {  6317,  20,  26,  21,    2,  -25 },   // 0x68 'h'
+  {  6429,  10,  26,  10,    2,  -25 },   // 0x69 'i'
+  {  6501,  15,  34,  10,   -2,  -25 },   // 0x6A 'j'
+  {  6597,  21,  26,  19,    2,  -25 },   // 0x6B 'k'
+  {  6703,  10,  26,  10,    2,  -25 },   // 0x6C 'l'
+  {  6781,  30,  19,  31,    2,  -18 },   // 0x6D 'm'
+  {  6908,  20,  19,  21,    2,  -18 },   // 0x6E 'n'
+  {  6999,  19,  19,  21,    3,  -18 },   // 0x6F 'o'
+  {  7078,  22,  27,  21,    0,  -18 },   // 0x70 'p'
+  {  7191,  20,  27,  21,    3,  -18 },   // 0x71 'q'
+  {  7302,  15,  19,  14,    2,  -18 },   // 0x72 'r'
+  {  7363,  18,  19,  19,    2,  -18 },   // 0x73 's'
+  {  7428,  11,  23,  12,    4,  -22 },   // 0x74 't'
+  {  7497,  20,  19,  21,    3,  -18 },   // 0x75 'u'
+  {  7588,  18,  19,  19,    5,  -18 },   // 0x76 'v'
+  {  7669,  27,  19,  27,    4,  -18 },   // 0x77 'w'
+  {  7802,  22,  19,  19,    1,  -18 },   // 0x78 'x'
+  {  7883,  22,  27,  19,    1,  -18 },   // 0x79 'y'
+  {  7990,  19,  19,  17,    1,  -18 },   // 0x7A 'z'
+  {  8047,  14,  33,  14,    2,  -25 },   // 0x7B '{'
+  {  8146,   9,  33,  10,    2,  -25 },   // 0x7C '|'
+  {  8243,  14,  33,  14,    2,  -25 },   // 0x7D '}'
+  {  8342,  17,   6,  20,    3,  -10 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSansBoldOblique18pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSansBoldOblique18pt7bSpanData,
+    (GFXglyph *)FreeSansBoldOblique18pt7bSpanGlyphs,
+    0x20, 0x7E, 42 } };
+
+// Approx. 9152 bytes
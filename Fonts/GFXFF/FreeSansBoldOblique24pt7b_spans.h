@@ -0,0 +1,1042 @@
+// FreeSansBoldOblique24pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSansBoldOblique24pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSansBoldOblique24pt7bSpanData[] PROGMEM = {
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x06, 0x08,
+  0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07,
+  0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07,
+  0x01, 0x05, 0x06, 0x01, 0x05, 0x06, 0x01, 0x05, 0x06, 0x01, 0x05, 0x05,
+  0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x03, 0x00, 0x00, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01,
+  0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x02, 0x01, 0x06, 0x0C, 0x06, 0x02, 0x01, 0x06, 0x0C, 0x06,
+  0x02, 0x01, 0x06, 0x0C, 0x06, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x02, 0x00,
+  0x06, 0x0B, 0x06, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x02, 0x00, 0x06, 0x0B,
+  0x06, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x02,
+  0x00, 0x04, 0x0B, 0x04, 0x02, 0x00, 0x04, 0x0B, 0x04, 0x02, 0x00, 0x03,
+  0x0B, 0x03, 0x02, 0x0D, 0x05, 0x17, 0x05, 0x02, 0x0D, 0x05, 0x17, 0x05,
+  0x02, 0x0C, 0x05, 0x16, 0x05, 0x02, 0x0C, 0x05, 0x16, 0x05, 0x02, 0x0B,
+  0x05, 0x15, 0x05, 0x02, 0x0B, 0x05, 0x15, 0x05, 0x02, 0x0A, 0x05, 0x14,
+  0x05, 0x01, 0x05, 0x18, 0x01, 0x04, 0x19, 0x01, 0x04, 0x19, 0x01, 0x04,
+  0x18, 0x01, 0x04, 0x18, 0x02, 0x08, 0x05, 0x12, 0x05, 0x02, 0x08, 0x05,
+  0x11, 0x05, 0x02, 0x07, 0x05, 0x11, 0x05, 0x02, 0x07, 0x05, 0x11, 0x05,
+  0x02, 0x06, 0x05, 0x10, 0x05, 0x02, 0x06, 0x05, 0x10, 0x05, 0x02, 0x06,
+  0x05, 0x0F, 0x05, 0x01, 0x01, 0x18, 0x01, 0x00, 0x19, 0x01, 0x00, 0x18,
+  0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x02, 0x03, 0x05, 0x0D, 0x05, 0x02,
+  0x03, 0x05, 0x0D, 0x05, 0x02, 0x02, 0x05, 0x0C, 0x05, 0x02, 0x02, 0x05,
+  0x0C, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05,
+  0x02, 0x01, 0x05, 0x0A, 0x05, 0x02, 0x00, 0x05, 0x0A, 0x05, 0x02, 0x00,
+  0x05, 0x0A, 0x04, 0x01, 0x10, 0x03, 0x01, 0x10, 0x03, 0x01, 0x10, 0x03,
+  0x01, 0x0C, 0x0A, 0x01, 0x09, 0x0F, 0x01, 0x08, 0x11, 0x01, 0x07, 0x12,
+  0x01, 0x06, 0x14, 0x03, 0x05, 0x07, 0x0E, 0x03, 0x13, 0x07, 0x03, 0x05,
+  0x06, 0x0E, 0x03, 0x14, 0x06, 0x03, 0x05, 0x05, 0x0E, 0x03, 0x14, 0x06,
+  0x03, 0x04, 0x06, 0x0E, 0x03, 0x14, 0x06, 0x03, 0x04, 0x06, 0x0D, 0x04,
+  0x14, 0x06, 0x02, 0x04, 0x06, 0x0D, 0x03, 0x02, 0x04, 0x07, 0x0D, 0x03,
+  0x02, 0x04, 0x08, 0x0D, 0x03, 0x01, 0x04, 0x0C, 0x01, 0x05, 0x0C, 0x01,
+  0x06, 0x0D, 0x01, 0x06, 0x0F, 0x01, 0x08, 0x0E, 0x01, 0x0A, 0x0C, 0x01,
+  0x0B, 0x0C, 0x02, 0x0B, 0x03, 0x0F, 0x08, 0x02, 0x0B, 0x03, 0x10, 0x07,
+  0x02, 0x0B, 0x03, 0x10, 0x07, 0x03, 0x00, 0x07, 0x0A, 0x04, 0x10, 0x07,
+  0x03, 0x00, 0x07, 0x0A, 0x03, 0x10, 0x07, 0x03, 0x00, 0x07, 0x0A, 0x03,
+  0x10, 0x06, 0x03, 0x00, 0x07, 0x0A, 0x03, 0x0F, 0x07, 0x03, 0x00, 0x08,
+  0x0A, 0x03, 0x0F, 0x07, 0x02, 0x00, 0x08, 0x09, 0x0C, 0x01, 0x01, 0x13,
+  0x01, 0x01, 0x13, 0x01, 0x02, 0x10, 0x01, 0x03, 0x0E, 0x01, 0x06, 0x08,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x03, 0x02, 0x07, 0x06, 0x1D, 0x04, 0x02, 0x05, 0x0A, 0x1C,
+  0x04, 0x02, 0x04, 0x0C, 0x1B, 0x04, 0x02, 0x03, 0x0D, 0x1B, 0x03, 0x02,
+  0x02, 0x0F, 0x1A, 0x04, 0x03, 0x01, 0x06, 0x0B, 0x06, 0x19, 0x04, 0x03,
+  0x01, 0x04, 0x0D, 0x04, 0x18, 0x04, 0x03, 0x00, 0x05, 0x0D, 0x04, 0x18,
+  0x03, 0x03, 0x00, 0x04, 0x0D, 0x04, 0x17, 0x03, 0x03, 0x00, 0x04, 0x0C,
+  0x05, 0x16, 0x04, 0x03, 0x00, 0x04, 0x0C, 0x04, 0x15, 0x04, 0x03, 0x00,
+  0x06, 0x0A, 0x06, 0x14, 0x04, 0x02, 0x00, 0x0F, 0x14, 0x03, 0x02, 0x01,
+  0x0D, 0x13, 0x04, 0x02, 0x01, 0x0C, 0x12, 0x04, 0x02, 0x02, 0x0A, 0x11,
+  0x04, 0x02, 0x04, 0x06, 0x11, 0x03, 0x02, 0x10, 0x03, 0x1A, 0x06, 0x02,
+  0x0F, 0x04, 0x18, 0x0A, 0x02, 0x0E, 0x04, 0x17, 0x0C, 0x02, 0x0E, 0x03,
+  0x16, 0x0D, 0x02, 0x0D, 0x03, 0x15, 0x0F, 0x03, 0x0C, 0x04, 0x14, 0x06,
+  0x1E, 0x06, 0x03, 0x0B, 0x04, 0x14, 0x04, 0x20, 0x04, 0x03, 0x0A, 0x04,
+  0x13, 0x05, 0x20, 0x04, 0x03, 0x0A, 0x03, 0x13, 0x04, 0x20, 0x04, 0x03,
+  0x09, 0x04, 0x13, 0x04, 0x1F, 0x05, 0x03, 0x08, 0x04, 0x13, 0x04, 0x1F,
+  0x04, 0x03, 0x07, 0x04, 0x13, 0x06, 0x1D, 0x06, 0x02, 0x07, 0x03, 0x13,
+  0x0F, 0x02, 0x06, 0x03, 0x14, 0x0D, 0x02, 0x05, 0x04, 0x14, 0x0C, 0x02,
+  0x04, 0x04, 0x15, 0x0A, 0x02, 0x03, 0x04, 0x17, 0x06, 0x01, 0x0F, 0x06,
+  0x01, 0x0D, 0x0A, 0x01, 0x0B, 0x0D, 0x01, 0x0A, 0x0F, 0x01, 0x0A, 0x0F,
+  0x02, 0x09, 0x07, 0x12, 0x07, 0x02, 0x08, 0x07, 0x13, 0x06, 0x02, 0x08,
+  0x07, 0x13, 0x06, 0x02, 0x08, 0x07, 0x13, 0x05, 0x02, 0x08, 0x07, 0x12,
+  0x06, 0x02, 0x08, 0x08, 0x12, 0x06, 0x02, 0x08, 0x08, 0x11, 0x06, 0x01,
+  0x09, 0x0D, 0x01, 0x09, 0x0C, 0x01, 0x0A, 0x0A, 0x01, 0x0A, 0x08, 0x01,
+  0x08, 0x0A, 0x02, 0x06, 0x0D, 0x18, 0x05, 0x02, 0x05, 0x0E, 0x18, 0x05,
+  0x02, 0x03, 0x11, 0x17, 0x05, 0x03, 0x02, 0x09, 0x0E, 0x06, 0x17, 0x05,
+  0x03, 0x02, 0x07, 0x0E, 0x07, 0x16, 0x05, 0x02, 0x01, 0x07, 0x0F, 0x0C,
+  0x02, 0x01, 0x06, 0x0F, 0x0B, 0x02, 0x00, 0x07, 0x10, 0x0A, 0x02, 0x00,
+  0x07, 0x10, 0x09, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11,
+  0x07, 0x02, 0x00, 0x08, 0x0F, 0x0A, 0x02, 0x00, 0x09, 0x0E, 0x0B, 0x01,
+  0x01, 0x19, 0x01, 0x01, 0x1A, 0x02, 0x02, 0x10, 0x14, 0x07, 0x02, 0x04,
+  0x0C, 0x14, 0x08, 0x01, 0x06, 0x08, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06,
+  0x01, 0x01, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x05,
+  0x01, 0x0A, 0x05, 0x01, 0x09, 0x06, 0x01, 0x09, 0x05, 0x01, 0x08, 0x05,
+  0x01, 0x07, 0x06, 0x01, 0x07, 0x05, 0x01, 0x06, 0x05, 0x01, 0x05, 0x06,
+  0x01, 0x05, 0x05, 0x01, 0x04, 0x06, 0x01, 0x04, 0x05, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x05, 0x01, 0x02, 0x06, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x05, 0x01, 0x09, 0x05, 0x01, 0x0A, 0x04,
+  0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0B, 0x04,
+  0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0C, 0x04,
+  0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05,
+  0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05,
+  0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x05,
+  0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x06,
+  0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x09, 0x06, 0x01, 0x09, 0x05,
+  0x01, 0x08, 0x06, 0x01, 0x08, 0x05, 0x01, 0x07, 0x06, 0x01, 0x07, 0x05,
+  0x01, 0x06, 0x06, 0x01, 0x06, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x06,
+  0x01, 0x04, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x06, 0x01, 0x02, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x00, 0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x03, 0x01, 0x03, 0x06, 0x04, 0x0D,
+  0x02, 0x01, 0x01, 0x0E, 0x01, 0x00, 0x0F, 0x01, 0x01, 0x0D, 0x01, 0x04,
+  0x07, 0x01, 0x04, 0x07, 0x01, 0x03, 0x08, 0x02, 0x02, 0x04, 0x07, 0x05,
+  0x02, 0x01, 0x04, 0x08, 0x04, 0x02, 0x01, 0x03, 0x08, 0x04, 0x02, 0x02,
+  0x01, 0x09, 0x01, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x06, 0x01, 0x0B, 0x06,
+  0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x06, 0x01, 0x0A, 0x06,
+  0x01, 0x0A, 0x06, 0x01, 0x01, 0x17, 0x01, 0x01, 0x17, 0x01, 0x01, 0x17,
+  0x01, 0x01, 0x16, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x08, 0x06,
+  0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05,
+  0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x03, 0x07,
+  0x01, 0x03, 0x07, 0x01, 0x03, 0x06, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07,
+  0x01, 0x02, 0x07, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x02, 0x04, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x0D,
+  0x01, 0x01, 0x0C, 0x01, 0x01, 0x0C, 0x01, 0x00, 0x0D, 0x01, 0x00, 0x0D,
+  0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x06,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x11, 0x03,
+  0x01, 0x10, 0x03, 0x01, 0x10, 0x03, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x03,
+  0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03,
+  0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x0C, 0x07, 0x01, 0x0A, 0x0B, 0x01, 0x08, 0x0F,
+  0x01, 0x07, 0x10, 0x01, 0x06, 0x12, 0x02, 0x06, 0x07, 0x10, 0x08, 0x02,
+  0x05, 0x07, 0x11, 0x08, 0x02, 0x04, 0x07, 0x12, 0x07, 0x02, 0x04, 0x06,
+  0x12, 0x07, 0x02, 0x03, 0x07, 0x12, 0x07, 0x02, 0x03, 0x07, 0x12, 0x07,
+  0x02, 0x03, 0x06, 0x12, 0x07, 0x02, 0x02, 0x07, 0x12, 0x07, 0x02, 0x02,
+  0x07, 0x12, 0x07, 0x02, 0x02, 0x06, 0x11, 0x08, 0x02, 0x01, 0x07, 0x11,
+  0x07, 0x02, 0x01, 0x07, 0x11, 0x07, 0x02, 0x01, 0x07, 0x11, 0x07, 0x02,
+  0x01, 0x07, 0x11, 0x07, 0x02, 0x01, 0x07, 0x10, 0x08, 0x02, 0x00, 0x07,
+  0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07,
+  0x02, 0x00, 0x07, 0x0F, 0x07, 0x02, 0x00, 0x07, 0x0F, 0x07, 0x02, 0x00,
+  0x07, 0x0F, 0x07, 0x02, 0x00, 0x07, 0x0E, 0x07, 0x02, 0x00, 0x08, 0x0E,
+  0x07, 0x02, 0x00, 0x09, 0x0C, 0x08, 0x01, 0x01, 0x12, 0x01, 0x01, 0x12,
+  0x01, 0x02, 0x10, 0x01, 0x03, 0x0D, 0x01, 0x04, 0x0B, 0x01, 0x06, 0x07,
+  0x01, 0x0C, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x06,
+  0x01, 0x08, 0x08, 0x01, 0x05, 0x0B, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x0E,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x08, 0x07, 0x01, 0x08, 0x06,
+  0x01, 0x08, 0x06, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07,
+  0x01, 0x07, 0x06, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07,
+  0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07,
+  0x01, 0x05, 0x07, 0x01, 0x05, 0x06, 0x01, 0x05, 0x06, 0x01, 0x04, 0x07,
+  0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x06, 0x01, 0x03, 0x07,
+  0x01, 0x03, 0x07, 0x01, 0x0F, 0x08, 0x01, 0x0C, 0x0D, 0x01, 0x0A, 0x11,
+  0x01, 0x09, 0x13, 0x01, 0x08, 0x14, 0x02, 0x07, 0x08, 0x14, 0x09, 0x02,
+  0x07, 0x07, 0x15, 0x08, 0x02, 0x06, 0x07, 0x16, 0x07, 0x02, 0x06, 0x06,
+  0x16, 0x07, 0x02, 0x06, 0x06, 0x16, 0x07, 0x02, 0x05, 0x06, 0x16, 0x07,
+  0x02, 0x05, 0x06, 0x15, 0x07, 0x01, 0x15, 0x07, 0x01, 0x14, 0x07, 0x01,
+  0x14, 0x07, 0x01, 0x12, 0x08, 0x01, 0x11, 0x08, 0x01, 0x10, 0x08, 0x01,
+  0x0E, 0x09, 0x01, 0x0C, 0x0A, 0x01, 0x0B, 0x09, 0x01, 0x09, 0x09, 0x01,
+  0x07, 0x0A, 0x01, 0x06, 0x09, 0x01, 0x05, 0x09, 0x01, 0x04, 0x08, 0x01,
+  0x03, 0x08, 0x01, 0x02, 0x08, 0x01, 0x02, 0x16, 0x01, 0x01, 0x17, 0x01,
+  0x01, 0x17, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x17, 0x01,
+  0x0C, 0x09, 0x01, 0x0A, 0x0D, 0x01, 0x08, 0x10, 0x01, 0x07, 0x12, 0x01,
+  0x06, 0x14, 0x02, 0x06, 0x07, 0x11, 0x09, 0x02, 0x05, 0x07, 0x13, 0x07,
+  0x02, 0x05, 0x06, 0x13, 0x07, 0x02, 0x05, 0x06, 0x13, 0x07, 0x02, 0x04,
+  0x06, 0x13, 0x07, 0x02, 0x04, 0x06, 0x13, 0x06, 0x01, 0x12, 0x07, 0x01,
+  0x11, 0x07, 0x01, 0x0F, 0x08, 0x01, 0x0B, 0x0B, 0x01, 0x0B, 0x0A, 0x01,
+  0x0B, 0x0B, 0x01, 0x0B, 0x0C, 0x01, 0x0B, 0x0C, 0x01, 0x0F, 0x09, 0x01,
+  0x10, 0x08, 0x01, 0x11, 0x07, 0x01, 0x11, 0x07, 0x01, 0x11, 0x07, 0x01,
+  0x11, 0x07, 0x02, 0x00, 0x07, 0x10, 0x08, 0x02, 0x00, 0x07, 0x10, 0x07,
+  0x02, 0x00, 0x07, 0x0F, 0x08, 0x02, 0x00, 0x09, 0x0E, 0x08, 0x01, 0x00,
+  0x16, 0x01, 0x01, 0x14, 0x01, 0x01, 0x13, 0x01, 0x02, 0x11, 0x01, 0x04,
+  0x0D, 0x01, 0x06, 0x08, 0x01, 0x11, 0x08, 0x01, 0x10, 0x09, 0x01, 0x0F,
+  0x0A, 0x01, 0x0E, 0x0A, 0x01, 0x0E, 0x0A, 0x01, 0x0D, 0x0B, 0x02, 0x0C,
+  0x04, 0x11, 0x07, 0x02, 0x0B, 0x04, 0x11, 0x07, 0x02, 0x0A, 0x05, 0x11,
+  0x06, 0x02, 0x09, 0x05, 0x10, 0x07, 0x02, 0x09, 0x04, 0x10, 0x07, 0x02,
+  0x08, 0x04, 0x10, 0x07, 0x02, 0x07, 0x04, 0x10, 0x06, 0x02, 0x06, 0x05,
+  0x10, 0x06, 0x02, 0x05, 0x05, 0x0F, 0x07, 0x02, 0x04, 0x05, 0x0F, 0x07,
+  0x02, 0x03, 0x05, 0x0F, 0x07, 0x02, 0x03, 0x05, 0x0F, 0x06, 0x02, 0x02,
+  0x05, 0x0E, 0x07, 0x02, 0x01, 0x05, 0x0E, 0x07, 0x01, 0x01, 0x17, 0x01,
+  0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01,
+  0x0D, 0x07, 0x01, 0x0D, 0x06, 0x01, 0x0C, 0x07, 0x01, 0x0C, 0x07, 0x01,
+  0x0C, 0x07, 0x01, 0x0C, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x09, 0x12, 0x01,
+  0x09, 0x12, 0x01, 0x09, 0x12, 0x01, 0x08, 0x13, 0x01, 0x08, 0x12, 0x01,
+  0x07, 0x13, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x06, 0x05, 0x01,
+  0x06, 0x05, 0x01, 0x06, 0x05, 0x02, 0x05, 0x05, 0x0D, 0x06, 0x01, 0x05,
+  0x10, 0x01, 0x04, 0x12, 0x01, 0x04, 0x13, 0x01, 0x04, 0x13, 0x02, 0x03,
+  0x08, 0x0F, 0x09, 0x02, 0x03, 0x06, 0x10, 0x08, 0x01, 0x11, 0x07, 0x01,
+  0x11, 0x07, 0x01, 0x11, 0x07, 0x01, 0x11, 0x07, 0x01, 0x11, 0x07, 0x01,
+  0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x0F, 0x07,
+  0x02, 0x00, 0x07, 0x0F, 0x07, 0x02, 0x00, 0x08, 0x0D, 0x08, 0x01, 0x00,
+  0x15, 0x01, 0x01, 0x13, 0x01, 0x01, 0x12, 0x01, 0x02, 0x10, 0x01, 0x04,
+  0x0C, 0x01, 0x06, 0x08, 0x01, 0x0D, 0x07, 0x01, 0x0A, 0x0C, 0x01, 0x09,
+  0x0E, 0x01, 0x08, 0x10, 0x01, 0x07, 0x12, 0x02, 0x06, 0x07, 0x11, 0x08,
+  0x02, 0x05, 0x06, 0x12, 0x07, 0x02, 0x05, 0x06, 0x13, 0x06, 0x01, 0x04,
+  0x06, 0x01, 0x04, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x02, 0x02,
+  0x07, 0x0C, 0x06, 0x02, 0x02, 0x06, 0x0A, 0x0A, 0x01, 0x02, 0x13, 0x01,
+  0x01, 0x15, 0x01, 0x01, 0x15, 0x02, 0x01, 0x09, 0x0E, 0x09, 0x02, 0x01,
+  0x08, 0x0F, 0x08, 0x02, 0x01, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10,
+  0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x06, 0x10, 0x07, 0x02,
+  0x00, 0x06, 0x10, 0x06, 0x02, 0x00, 0x06, 0x0F, 0x07, 0x02, 0x00, 0x06,
+  0x0F, 0x07, 0x02, 0x00, 0x06, 0x0E, 0x07, 0x02, 0x00, 0x07, 0x0D, 0x08,
+  0x02, 0x00, 0x08, 0x0C, 0x08, 0x01, 0x01, 0x13, 0x01, 0x01, 0x12, 0x01,
+  0x02, 0x10, 0x01, 0x03, 0x0E, 0x01, 0x04, 0x0B, 0x01, 0x06, 0x07, 0x01,
+  0x02, 0x18, 0x01, 0x02, 0x18, 0x01, 0x02, 0x17, 0x01, 0x02, 0x17, 0x01,
+  0x01, 0x18, 0x01, 0x01, 0x18, 0x01, 0x11, 0x07, 0x01, 0x10, 0x07, 0x01,
+  0x0F, 0x07, 0x01, 0x0E, 0x07, 0x01, 0x0D, 0x07, 0x01, 0x0C, 0x07, 0x01,
+  0x0B, 0x07, 0x01, 0x0B, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x06, 0x01,
+  0x08, 0x07, 0x01, 0x08, 0x06, 0x01, 0x07, 0x06, 0x01, 0x06, 0x07, 0x01,
+  0x06, 0x06, 0x01, 0x05, 0x07, 0x01, 0x05, 0x06, 0x01, 0x04, 0x07, 0x01,
+  0x04, 0x06, 0x01, 0x03, 0x07, 0x01, 0x03, 0x06, 0x01, 0x02, 0x07, 0x01,
+  0x02, 0x06, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x01,
+  0x00, 0x07, 0x01, 0x0D, 0x07, 0x01, 0x0A, 0x0D, 0x01, 0x09, 0x0F, 0x01,
+  0x08, 0x11, 0x01, 0x07, 0x13, 0x02, 0x06, 0x07, 0x12, 0x08, 0x02, 0x06,
+  0x05, 0x13, 0x07, 0x02, 0x05, 0x06, 0x14, 0x06, 0x02, 0x05, 0x05, 0x14,
+  0x06, 0x02, 0x05, 0x05, 0x14, 0x06, 0x02, 0x05, 0x05, 0x13, 0x06, 0x02,
+  0x05, 0x05, 0x12, 0x06, 0x02, 0x06, 0x06, 0x11, 0x07, 0x01, 0x06, 0x10,
+  0x01, 0x07, 0x0E, 0x01, 0x07, 0x0E, 0x01, 0x05, 0x11, 0x01, 0x04, 0x13,
+  0x02, 0x03, 0x08, 0x0F, 0x08, 0x02, 0x02, 0x07, 0x10, 0x08, 0x02, 0x02,
+  0x06, 0x11, 0x07, 0x02, 0x01, 0x07, 0x11, 0x07, 0x02, 0x01, 0x06, 0x11,
+  0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02,
+  0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x08,
+  0x0F, 0x07, 0x02, 0x00, 0x09, 0x0D, 0x09, 0x01, 0x00, 0x15, 0x01, 0x01,
+  0x13, 0x01, 0x02, 0x12, 0x01, 0x02, 0x10, 0x01, 0x04, 0x0D, 0x01, 0x06,
+  0x08, 0x01, 0x0C, 0x07, 0x01, 0x0A, 0x0B, 0x01, 0x08, 0x0E, 0x01, 0x07,
+  0x10, 0x01, 0x06, 0x12, 0x02, 0x05, 0x08, 0x11, 0x07, 0x02, 0x04, 0x08,
+  0x12, 0x07, 0x02, 0x04, 0x07, 0x13, 0x06, 0x02, 0x03, 0x07, 0x13, 0x06,
+  0x02, 0x03, 0x07, 0x13, 0x06, 0x02, 0x03, 0x06, 0x13, 0x06, 0x02, 0x02,
+  0x07, 0x13, 0x06, 0x02, 0x02, 0x07, 0x13, 0x06, 0x02, 0x02, 0x07, 0x12,
+  0x07, 0x02, 0x02, 0x07, 0x12, 0x07, 0x02, 0x02, 0x07, 0x11, 0x07, 0x02,
+  0x02, 0x08, 0x10, 0x08, 0x02, 0x02, 0x09, 0x0F, 0x09, 0x01, 0x03, 0x15,
+  0x01, 0x03, 0x15, 0x01, 0x04, 0x13, 0x02, 0x05, 0x0A, 0x11, 0x06, 0x02,
+  0x07, 0x06, 0x10, 0x07, 0x01, 0x10, 0x06, 0x01, 0x10, 0x06, 0x01, 0x0F,
+  0x06, 0x01, 0x0F, 0x06, 0x02, 0x00, 0x07, 0x0E, 0x06, 0x02, 0x00, 0x08,
+  0x0C, 0x08, 0x01, 0x00, 0x13, 0x01, 0x01, 0x11, 0x01, 0x01, 0x10, 0x01,
+  0x02, 0x0E, 0x01, 0x03, 0x0C, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01,
+  0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x06, 0x01, 0x04, 0x07, 0x01,
+  0x04, 0x07, 0x01, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01,
+  0x07, 0x01, 0x01, 0x06, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07,
+  0x06, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07,
+  0x01, 0x03, 0x07, 0x01, 0x03, 0x06, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07,
+  0x01, 0x02, 0x07, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x02, 0x04, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x19, 0x01, 0x01, 0x16, 0x03,
+  0x01, 0x13, 0x06, 0x01, 0x10, 0x09, 0x01, 0x0D, 0x0C, 0x01, 0x0A, 0x0F,
+  0x01, 0x07, 0x11, 0x01, 0x05, 0x10, 0x01, 0x02, 0x10, 0x01, 0x01, 0x0E,
+  0x01, 0x00, 0x0C, 0x01, 0x00, 0x09, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0D,
+  0x01, 0x00, 0x10, 0x01, 0x02, 0x11, 0x01, 0x05, 0x10, 0x01, 0x07, 0x0F,
+  0x01, 0x0A, 0x0C, 0x01, 0x0C, 0x0A, 0x01, 0x0F, 0x06, 0x01, 0x11, 0x04,
+  0x01, 0x14, 0x01, 0x01, 0x03, 0x17, 0x01, 0x03, 0x17, 0x01, 0x03, 0x17,
+  0x01, 0x03, 0x17, 0x01, 0x03, 0x16, 0x01, 0x02, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x17, 0x01, 0x01, 0x17, 0x01, 0x01, 0x16,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x06, 0x01, 0x04, 0x0A, 0x01, 0x04, 0x0C,
+  0x01, 0x04, 0x0F, 0x01, 0x05, 0x10, 0x01, 0x07, 0x11, 0x01, 0x0A, 0x10,
+  0x01, 0x0D, 0x0D, 0x01, 0x0F, 0x0B, 0x01, 0x11, 0x09, 0x01, 0x0E, 0x0C,
+  0x01, 0x0B, 0x0E, 0x01, 0x08, 0x10, 0x01, 0x05, 0x10, 0x01, 0x02, 0x11,
+  0x01, 0x01, 0x0F, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x09, 0x01, 0x01, 0x06,
+  0x01, 0x01, 0x03, 0x01, 0x00, 0x01, 0x01, 0x0A, 0x07, 0x01, 0x07, 0x0D,
+  0x01, 0x05, 0x10, 0x01, 0x04, 0x12, 0x01, 0x03, 0x14, 0x01, 0x03, 0x14,
+  0x02, 0x02, 0x08, 0x0F, 0x09, 0x02, 0x02, 0x07, 0x10, 0x08, 0x02, 0x01,
+  0x07, 0x11, 0x07, 0x02, 0x01, 0x06, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11,
+  0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x01, 0x10, 0x07, 0x01, 0x10, 0x07,
+  0x01, 0x0F, 0x07, 0x01, 0x0D, 0x09, 0x01, 0x0C, 0x09, 0x01, 0x0B, 0x09,
+  0x01, 0x0A, 0x08, 0x01, 0x09, 0x08, 0x01, 0x08, 0x07, 0x01, 0x07, 0x06,
+  0x01, 0x07, 0x05, 0x01, 0x06, 0x06, 0x01, 0x06, 0x05, 0x00, 0x00, 0x00,
+  0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07,
+  0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x18, 0x0A,
+  0x01, 0x14, 0x11, 0x01, 0x12, 0x15, 0x01, 0x10, 0x18, 0x02, 0x0E, 0x09,
+  0x1F, 0x0A, 0x02, 0x0C, 0x08, 0x22, 0x08, 0x02, 0x0B, 0x07, 0x24, 0x07,
+  0x02, 0x0A, 0x06, 0x25, 0x07, 0x02, 0x08, 0x07, 0x26, 0x06, 0x02, 0x07,
+  0x06, 0x27, 0x05, 0x02, 0x06, 0x06, 0x28, 0x05, 0x04, 0x06, 0x05, 0x17,
+  0x06, 0x20, 0x05, 0x28, 0x05, 0x04, 0x05, 0x05, 0x14, 0x0A, 0x20, 0x04,
+  0x29, 0x04, 0x03, 0x04, 0x06, 0x12, 0x12, 0x29, 0x04, 0x04, 0x03, 0x06,
+  0x11, 0x06, 0x1B, 0x08, 0x29, 0x04, 0x04, 0x03, 0x05, 0x10, 0x05, 0x1C,
+  0x06, 0x29, 0x04, 0x04, 0x02, 0x05, 0x0F, 0x05, 0x1C, 0x06, 0x29, 0x04,
+  0x04, 0x02, 0x05, 0x0E, 0x05, 0x1C, 0x05, 0x29, 0x04, 0x04, 0x01, 0x05,
+  0x0E, 0x04, 0x1C, 0x05, 0x29, 0x03, 0x04, 0x01, 0x05, 0x0D, 0x05, 0x1C,
+  0x04, 0x28, 0x04, 0x04, 0x01, 0x05, 0x0D, 0x04, 0x1C, 0x04, 0x28, 0x04,
+  0x04, 0x01, 0x04, 0x0C, 0x05, 0x1B, 0x04, 0x27, 0x04, 0x04, 0x00, 0x05,
+  0x0C, 0x04, 0x1B, 0x04, 0x27, 0x04, 0x04, 0x00, 0x05, 0x0B, 0x05, 0x1A,
+  0x04, 0x26, 0x04, 0x04, 0x00, 0x05, 0x0B, 0x05, 0x19, 0x05, 0x25, 0x05,
+  0x04, 0x00, 0x05, 0x0B, 0x05, 0x18, 0x05, 0x24, 0x05, 0x04, 0x00, 0x05,
+  0x0B, 0x05, 0x17, 0x06, 0x23, 0x05, 0x04, 0x00, 0x05, 0x0B, 0x06, 0x16,
+  0x08, 0x21, 0x06, 0x02, 0x00, 0x05, 0x0B, 0x1B, 0x03, 0x00, 0x06, 0x0C,
+  0x0C, 0x19, 0x0C, 0x03, 0x01, 0x05, 0x0D, 0x0A, 0x1A, 0x09, 0x03, 0x01,
+  0x06, 0x0E, 0x06, 0x1B, 0x06, 0x01, 0x01, 0x07, 0x01, 0x02, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x03, 0x09, 0x02, 0x04, 0x0B, 0x1A, 0x03, 0x01, 0x06,
+  0x18, 0x01, 0x07, 0x17, 0x01, 0x09, 0x13, 0x01, 0x0D, 0x0B, 0x01, 0x13,
+  0x09, 0x01, 0x12, 0x0A, 0x01, 0x12, 0x0A, 0x01, 0x11, 0x0B, 0x01, 0x11,
+  0x0B, 0x01, 0x10, 0x0C, 0x01, 0x10, 0x0C, 0x01, 0x0F, 0x0D, 0x01, 0x0E,
+  0x0F, 0x02, 0x0E, 0x07, 0x16, 0x07, 0x02, 0x0D, 0x07, 0x16, 0x07, 0x02,
+  0x0D, 0x06, 0x16, 0x07, 0x02, 0x0C, 0x07, 0x16, 0x07, 0x02, 0x0C, 0x06,
+  0x16, 0x07, 0x02, 0x0B, 0x07, 0x16, 0x07, 0x02, 0x0B, 0x06, 0x16, 0x07,
+  0x02, 0x0A, 0x07, 0x17, 0x07, 0x02, 0x09, 0x07, 0x17, 0x07, 0x02, 0x09,
+  0x07, 0x17, 0x07, 0x02, 0x08, 0x07, 0x17, 0x07, 0x02, 0x08, 0x06, 0x17,
+  0x07, 0x01, 0x07, 0x17, 0x01, 0x07, 0x17, 0x01, 0x06, 0x19, 0x01, 0x05,
+  0x1A, 0x01, 0x05, 0x1A, 0x01, 0x04, 0x1B, 0x02, 0x04, 0x07, 0x18, 0x07,
+  0x02, 0x03, 0x07, 0x18, 0x07, 0x02, 0x03, 0x07, 0x18, 0x07, 0x02, 0x02,
+  0x07, 0x18, 0x07, 0x02, 0x02, 0x07, 0x19, 0x07, 0x02, 0x01, 0x07, 0x19,
+  0x07, 0x02, 0x00, 0x08, 0x19, 0x07, 0x01, 0x07, 0x13, 0x01, 0x07, 0x16,
+  0x01, 0x07, 0x17, 0x01, 0x06, 0x19, 0x01, 0x06, 0x19, 0x01, 0x06, 0x1A,
+  0x02, 0x06, 0x07, 0x18, 0x08, 0x02, 0x06, 0x07, 0x19, 0x07, 0x02, 0x05,
+  0x07, 0x19, 0x07, 0x02, 0x05, 0x07, 0x19, 0x07, 0x02, 0x05, 0x07, 0x19,
+  0x06, 0x02, 0x05, 0x07, 0x18, 0x07, 0x02, 0x04, 0x08, 0x16, 0x08, 0x01,
+  0x04, 0x19, 0x01, 0x04, 0x18, 0x01, 0x04, 0x17, 0x01, 0x04, 0x18, 0x01,
+  0x03, 0x1A, 0x01, 0x03, 0x1A, 0x02, 0x03, 0x07, 0x15, 0x09, 0x02, 0x03,
+  0x07, 0x17, 0x07, 0x02, 0x03, 0x07, 0x17, 0x07, 0x02, 0x02, 0x07, 0x17,
+  0x07, 0x02, 0x02, 0x07, 0x17, 0x07, 0x02, 0x02, 0x07, 0x17, 0x07, 0x02,
+  0x02, 0x07, 0x16, 0x07, 0x02, 0x01, 0x07, 0x15, 0x08, 0x02, 0x01, 0x07,
+  0x14, 0x08, 0x01, 0x01, 0x1B, 0x01, 0x01, 0x1A, 0x01, 0x01, 0x19, 0x01,
+  0x00, 0x19, 0x01, 0x00, 0x17, 0x01, 0x00, 0x14, 0x01, 0x10, 0x08, 0x01,
+  0x0D, 0x0E, 0x01, 0x0B, 0x11, 0x01, 0x09, 0x14, 0x01, 0x08, 0x16, 0x01,
+  0x07, 0x18, 0x02, 0x06, 0x0A, 0x16, 0x09, 0x02, 0x05, 0x09, 0x17, 0x09,
+  0x02, 0x04, 0x08, 0x18, 0x08, 0x02, 0x04, 0x07, 0x19, 0x07, 0x02, 0x03,
+  0x08, 0x19, 0x07, 0x02, 0x03, 0x07, 0x19, 0x07, 0x01, 0x02, 0x07, 0x01,
+  0x02, 0x07, 0x01, 0x01, 0x08, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01,
+  0x01, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x02, 0x00, 0x07, 0x17,
+  0x06, 0x02, 0x00, 0x07, 0x16, 0x07, 0x02, 0x00, 0x08, 0x15, 0x08, 0x02,
+  0x00, 0x08, 0x15, 0x07, 0x02, 0x01, 0x08, 0x13, 0x09, 0x02, 0x01, 0x0A,
+  0x11, 0x0A, 0x01, 0x02, 0x18, 0x01, 0x02, 0x17, 0x01, 0x03, 0x15, 0x01,
+  0x04, 0x13, 0x01, 0x06, 0x0F, 0x01, 0x09, 0x09, 0x01, 0x07, 0x12, 0x01,
+  0x07, 0x14, 0x01, 0x06, 0x17, 0x01, 0x06, 0x18, 0x01, 0x06, 0x18, 0x01,
+  0x06, 0x19, 0x02, 0x06, 0x07, 0x16, 0x09, 0x02, 0x05, 0x07, 0x17, 0x09,
+  0x02, 0x05, 0x07, 0x18, 0x08, 0x02, 0x05, 0x07, 0x19, 0x07, 0x02, 0x05,
+  0x07, 0x19, 0x07, 0x02, 0x04, 0x08, 0x19, 0x07, 0x02, 0x04, 0x07, 0x19,
+  0x07, 0x02, 0x04, 0x07, 0x19, 0x07, 0x02, 0x04, 0x07, 0x19, 0x07, 0x02,
+  0x04, 0x07, 0x19, 0x07, 0x02, 0x03, 0x07, 0x19, 0x07, 0x02, 0x03, 0x07,
+  0x18, 0x07, 0x02, 0x03, 0x07, 0x18, 0x07, 0x02, 0x03, 0x07, 0x18, 0x07,
+  0x02, 0x03, 0x07, 0x17, 0x08, 0x02, 0x02, 0x07, 0x17, 0x07, 0x02, 0x02,
+  0x07, 0x17, 0x07, 0x02, 0x02, 0x07, 0x16, 0x07, 0x02, 0x02, 0x07, 0x15,
+  0x08, 0x02, 0x01, 0x07, 0x14, 0x08, 0x02, 0x01, 0x07, 0x13, 0x09, 0x02,
+  0x01, 0x07, 0x11, 0x0A, 0x01, 0x01, 0x19, 0x01, 0x01, 0x18, 0x01, 0x00,
+  0x18, 0x01, 0x00, 0x17, 0x01, 0x00, 0x15, 0x01, 0x00, 0x11, 0x01, 0x07,
+  0x19, 0x01, 0x07, 0x19, 0x01, 0x06, 0x19, 0x01, 0x06, 0x19, 0x01, 0x06,
+  0x19, 0x01, 0x06, 0x19, 0x01, 0x06, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05,
+  0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x04,
+  0x07, 0x01, 0x04, 0x18, 0x01, 0x04, 0x17, 0x01, 0x04, 0x17, 0x01, 0x03,
+  0x18, 0x01, 0x03, 0x18, 0x01, 0x03, 0x18, 0x01, 0x03, 0x07, 0x01, 0x03,
+  0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02,
+  0x07, 0x01, 0x02, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01,
+  0x19, 0x01, 0x01, 0x19, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00,
+  0x1A, 0x01, 0x00, 0x19, 0x01, 0x08, 0x18, 0x01, 0x07, 0x19, 0x01, 0x07,
+  0x18, 0x01, 0x07, 0x18, 0x01, 0x07, 0x18, 0x01, 0x07, 0x18, 0x01, 0x06,
+  0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06,
+  0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x16, 0x01, 0x05,
+  0x16, 0x01, 0x04, 0x17, 0x01, 0x04, 0x16, 0x01, 0x04, 0x16, 0x01, 0x04,
+  0x16, 0x01, 0x04, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03,
+  0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02,
+  0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01,
+  0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x10,
+  0x09, 0x01, 0x0D, 0x0F, 0x01, 0x0B, 0x12, 0x01, 0x09, 0x15, 0x01, 0x08,
+  0x17, 0x01, 0x07, 0x19, 0x02, 0x06, 0x0A, 0x17, 0x09, 0x02, 0x05, 0x09,
+  0x19, 0x08, 0x02, 0x04, 0x08, 0x1A, 0x07, 0x02, 0x04, 0x07, 0x1A, 0x07,
+  0x02, 0x03, 0x07, 0x1A, 0x07, 0x01, 0x03, 0x07, 0x01, 0x02, 0x07, 0x01,
+  0x02, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x02, 0x01, 0x07, 0x12,
+  0x0E, 0x02, 0x01, 0x06, 0x12, 0x0E, 0x02, 0x00, 0x07, 0x12, 0x0D, 0x02,
+  0x00, 0x07, 0x12, 0x0D, 0x02, 0x00, 0x07, 0x12, 0x0D, 0x02, 0x00, 0x07,
+  0x11, 0x0E, 0x02, 0x00, 0x07, 0x19, 0x06, 0x02, 0x00, 0x07, 0x18, 0x06,
+  0x02, 0x00, 0x08, 0x18, 0x06, 0x02, 0x00, 0x08, 0x17, 0x07, 0x02, 0x00,
+  0x08, 0x16, 0x08, 0x02, 0x01, 0x08, 0x15, 0x09, 0x02, 0x01, 0x09, 0x14,
+  0x09, 0x02, 0x02, 0x0A, 0x12, 0x0B, 0x01, 0x02, 0x1B, 0x01, 0x03, 0x1A,
+  0x02, 0x04, 0x13, 0x18, 0x05, 0x02, 0x05, 0x10, 0x18, 0x04, 0x02, 0x07,
+  0x0D, 0x18, 0x04, 0x01, 0x09, 0x08, 0x02, 0x07, 0x07, 0x1C, 0x07, 0x02,
+  0x07, 0x07, 0x1C, 0x07, 0x02, 0x07, 0x07, 0x1C, 0x07, 0x02, 0x07, 0x07,
+  0x1B, 0x07, 0x02, 0x07, 0x07, 0x1B, 0x07, 0x02, 0x06, 0x07, 0x1B, 0x07,
+  0x02, 0x06, 0x07, 0x1B, 0x07, 0x02, 0x06, 0x07, 0x1B, 0x07, 0x02, 0x06,
+  0x07, 0x1A, 0x07, 0x02, 0x05, 0x08, 0x1A, 0x07, 0x02, 0x05, 0x07, 0x1A,
+  0x07, 0x02, 0x05, 0x07, 0x1A, 0x07, 0x02, 0x05, 0x07, 0x19, 0x07, 0x01,
+  0x05, 0x1B, 0x01, 0x04, 0x1C, 0x01, 0x04, 0x1C, 0x01, 0x04, 0x1C, 0x01,
+  0x04, 0x1B, 0x01, 0x04, 0x1B, 0x02, 0x03, 0x07, 0x18, 0x07, 0x02, 0x03,
+  0x07, 0x18, 0x07, 0x02, 0x03, 0x07, 0x18, 0x07, 0x02, 0x03, 0x07, 0x17,
+  0x07, 0x02, 0x02, 0x07, 0x17, 0x07, 0x02, 0x02, 0x07, 0x17, 0x07, 0x02,
+  0x02, 0x07, 0x17, 0x07, 0x02, 0x02, 0x07, 0x16, 0x07, 0x02, 0x02, 0x07,
+  0x16, 0x07, 0x02, 0x01, 0x07, 0x16, 0x07, 0x02, 0x01, 0x07, 0x16, 0x07,
+  0x02, 0x01, 0x07, 0x16, 0x07, 0x02, 0x01, 0x07, 0x15, 0x07, 0x02, 0x01,
+  0x07, 0x15, 0x07, 0x02, 0x00, 0x07, 0x15, 0x07, 0x01, 0x07, 0x07, 0x01,
+  0x07, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01,
+  0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01,
+  0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x04, 0x07, 0x01,
+  0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01,
+  0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01,
+  0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x14, 0x07, 0x01, 0x14, 0x07, 0x01, 0x14, 0x07, 0x01,
+  0x13, 0x07, 0x01, 0x13, 0x07, 0x01, 0x13, 0x07, 0x01, 0x13, 0x07, 0x01,
+  0x12, 0x08, 0x01, 0x12, 0x07, 0x01, 0x12, 0x07, 0x01, 0x12, 0x07, 0x01,
+  0x12, 0x07, 0x01, 0x11, 0x07, 0x01, 0x11, 0x07, 0x01, 0x11, 0x07, 0x01,
+  0x11, 0x07, 0x01, 0x11, 0x07, 0x01, 0x10, 0x07, 0x01, 0x10, 0x07, 0x01,
+  0x10, 0x07, 0x01, 0x10, 0x07, 0x02, 0x01, 0x07, 0x0F, 0x08, 0x02, 0x01,
+  0x07, 0x0F, 0x07, 0x02, 0x01, 0x07, 0x0F, 0x07, 0x02, 0x00, 0x07, 0x0F,
+  0x07, 0x02, 0x00, 0x07, 0x0F, 0x07, 0x02, 0x00, 0x07, 0x0E, 0x07, 0x02,
+  0x00, 0x07, 0x0E, 0x07, 0x02, 0x00, 0x08, 0x0C, 0x09, 0x01, 0x00, 0x14,
+  0x01, 0x00, 0x13, 0x01, 0x01, 0x12, 0x01, 0x02, 0x0F, 0x01, 0x03, 0x0D,
+  0x01, 0x05, 0x08, 0x02, 0x08, 0x07, 0x1C, 0x08, 0x02, 0x07, 0x08, 0x1B,
+  0x08, 0x02, 0x07, 0x07, 0x19, 0x09, 0x02, 0x07, 0x07, 0x18, 0x09, 0x02,
+  0x07, 0x07, 0x17, 0x08, 0x02, 0x07, 0x07, 0x16, 0x08, 0x02, 0x06, 0x07,
+  0x15, 0x08, 0x02, 0x06, 0x07, 0x14, 0x08, 0x02, 0x06, 0x07, 0x13, 0x08,
+  0x02, 0x06, 0x07, 0x12, 0x08, 0x02, 0x06, 0x07, 0x11, 0x08, 0x02, 0x05,
+  0x07, 0x0F, 0x09, 0x02, 0x05, 0x07, 0x0E, 0x08, 0x02, 0x05, 0x07, 0x0D,
+  0x08, 0x01, 0x05, 0x0F, 0x01, 0x04, 0x10, 0x01, 0x04, 0x11, 0x01, 0x04,
+  0x11, 0x01, 0x04, 0x12, 0x01, 0x04, 0x12, 0x02, 0x03, 0x0A, 0x0F, 0x08,
+  0x02, 0x03, 0x09, 0x0F, 0x08, 0x02, 0x03, 0x08, 0x10, 0x08, 0x02, 0x03,
+  0x07, 0x10, 0x09, 0x02, 0x03, 0x07, 0x11, 0x08, 0x02, 0x02, 0x07, 0x12,
+  0x08, 0x02, 0x02, 0x07, 0x12, 0x08, 0x02, 0x02, 0x07, 0x13, 0x08, 0x02,
+  0x02, 0x07, 0x13, 0x09, 0x02, 0x01, 0x07, 0x14, 0x08, 0x02, 0x01, 0x07,
+  0x14, 0x09, 0x02, 0x01, 0x07, 0x15, 0x08, 0x02, 0x01, 0x07, 0x15, 0x09,
+  0x02, 0x01, 0x07, 0x16, 0x08, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01,
+  0x07, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01,
+  0x06, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01,
+  0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01,
+  0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x02, 0x07, 0x01,
+  0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01,
+  0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x17, 0x01, 0x01, 0x17, 0x01,
+  0x01, 0x17, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x17, 0x02,
+  0x07, 0x0A, 0x1E, 0x0B, 0x02, 0x07, 0x0A, 0x1E, 0x0A, 0x02, 0x07, 0x0A,
+  0x1D, 0x0B, 0x02, 0x07, 0x0A, 0x1D, 0x0B, 0x02, 0x06, 0x0B, 0x1C, 0x0C,
+  0x02, 0x06, 0x0B, 0x1C, 0x0C, 0x03, 0x06, 0x0B, 0x1B, 0x05, 0x21, 0x06,
+  0x04, 0x06, 0x06, 0x0D, 0x04, 0x1B, 0x05, 0x21, 0x06, 0x03, 0x06, 0x06,
+  0x0D, 0x04, 0x1A, 0x0D, 0x04, 0x05, 0x07, 0x0D, 0x04, 0x1A, 0x05, 0x20,
+  0x07, 0x04, 0x05, 0x07, 0x0D, 0x04, 0x19, 0x06, 0x20, 0x06, 0x04, 0x05,
+  0x07, 0x0D, 0x04, 0x19, 0x05, 0x20, 0x06, 0x04, 0x05, 0x06, 0x0D, 0x04,
+  0x18, 0x06, 0x1F, 0x07, 0x04, 0x04, 0x07, 0x0D, 0x05, 0x18, 0x05, 0x1F,
+  0x07, 0x04, 0x04, 0x07, 0x0D, 0x05, 0x17, 0x06, 0x1F, 0x07, 0x04, 0x04,
+  0x07, 0x0D, 0x05, 0x17, 0x05, 0x1F, 0x06, 0x04, 0x04, 0x07, 0x0D, 0x05,
+  0x16, 0x06, 0x1F, 0x06, 0x04, 0x04, 0x06, 0x0D, 0x05, 0x16, 0x06, 0x1E,
+  0x07, 0x04, 0x03, 0x07, 0x0D, 0x05, 0x16, 0x05, 0x1E, 0x07, 0x04, 0x03,
+  0x07, 0x0D, 0x05, 0x15, 0x06, 0x1E, 0x07, 0x04, 0x03, 0x07, 0x0D, 0x05,
+  0x15, 0x05, 0x1E, 0x06, 0x04, 0x03, 0x06, 0x0D, 0x05, 0x14, 0x06, 0x1E,
+  0x06, 0x04, 0x03, 0x06, 0x0D, 0x05, 0x14, 0x05, 0x1D, 0x07, 0x04, 0x02,
+  0x07, 0x0D, 0x05, 0x13, 0x06, 0x1D, 0x07, 0x04, 0x02, 0x07, 0x0D, 0x05,
+  0x13, 0x05, 0x1D, 0x06, 0x03, 0x02, 0x07, 0x0D, 0x0B, 0x1D, 0x06, 0x03,
+  0x02, 0x06, 0x0D, 0x0B, 0x1C, 0x07, 0x03, 0x01, 0x07, 0x0D, 0x0A, 0x1C,
+  0x07, 0x03, 0x01, 0x07, 0x0D, 0x0A, 0x1C, 0x07, 0x03, 0x01, 0x07, 0x0D,
+  0x09, 0x1C, 0x06, 0x03, 0x01, 0x07, 0x0D, 0x09, 0x1C, 0x06, 0x03, 0x01,
+  0x06, 0x0D, 0x08, 0x1B, 0x07, 0x03, 0x00, 0x07, 0x0D, 0x08, 0x1B, 0x07,
+  0x03, 0x00, 0x07, 0x0D, 0x07, 0x1B, 0x06, 0x02, 0x07, 0x08, 0x1D, 0x06,
+  0x02, 0x07, 0x08, 0x1C, 0x07, 0x02, 0x07, 0x09, 0x1C, 0x07, 0x02, 0x07,
+  0x09, 0x1C, 0x07, 0x02, 0x07, 0x09, 0x1C, 0x06, 0x02, 0x06, 0x0B, 0x1B,
+  0x07, 0x02, 0x06, 0x0B, 0x1B, 0x07, 0x02, 0x06, 0x0B, 0x1B, 0x07, 0x02,
+  0x06, 0x0C, 0x1B, 0x06, 0x02, 0x05, 0x0D, 0x1B, 0x06, 0x02, 0x05, 0x0E,
+  0x1A, 0x07, 0x03, 0x05, 0x07, 0x0D, 0x06, 0x1A, 0x07, 0x03, 0x05, 0x06,
+  0x0D, 0x06, 0x1A, 0x07, 0x03, 0x05, 0x06, 0x0E, 0x06, 0x1A, 0x06, 0x03,
+  0x04, 0x07, 0x0E, 0x06, 0x1A, 0x06, 0x03, 0x04, 0x07, 0x0E, 0x06, 0x19,
+  0x07, 0x03, 0x04, 0x07, 0x0F, 0x06, 0x19, 0x07, 0x03, 0x04, 0x06, 0x0F,
+  0x06, 0x19, 0x07, 0x03, 0x04, 0x06, 0x0F, 0x07, 0x19, 0x06, 0x03, 0x03,
+  0x07, 0x10, 0x06, 0x19, 0x06, 0x03, 0x03, 0x07, 0x10, 0x06, 0x18, 0x07,
+  0x03, 0x03, 0x06, 0x11, 0x06, 0x18, 0x07, 0x03, 0x03, 0x06, 0x11, 0x06,
+  0x18, 0x07, 0x03, 0x02, 0x07, 0x11, 0x06, 0x18, 0x06, 0x02, 0x02, 0x07,
+  0x12, 0x0C, 0x02, 0x02, 0x07, 0x12, 0x0C, 0x02, 0x02, 0x06, 0x12, 0x0C,
+  0x02, 0x02, 0x06, 0x13, 0x0A, 0x02, 0x01, 0x07, 0x13, 0x0A, 0x02, 0x01,
+  0x07, 0x13, 0x0A, 0x02, 0x01, 0x07, 0x14, 0x09, 0x02, 0x01, 0x06, 0x14,
+  0x09, 0x02, 0x01, 0x06, 0x15, 0x07, 0x02, 0x00, 0x07, 0x15, 0x07, 0x01,
+  0x10, 0x09, 0x01, 0x0D, 0x0E, 0x01, 0x0B, 0x12, 0x01, 0x09, 0x15, 0x01,
+  0x08, 0x17, 0x01, 0x07, 0x19, 0x02, 0x06, 0x0A, 0x16, 0x0B, 0x02, 0x05,
+  0x09, 0x18, 0x09, 0x02, 0x05, 0x07, 0x19, 0x08, 0x02, 0x04, 0x07, 0x1A,
+  0x08, 0x02, 0x03, 0x08, 0x1A, 0x08, 0x02, 0x03, 0x07, 0x1B, 0x07, 0x02,
+  0x02, 0x07, 0x1B, 0x07, 0x02, 0x02, 0x07, 0x1B, 0x07, 0x02, 0x01, 0x07,
+  0x1B, 0x07, 0x02, 0x01, 0x07, 0x1B, 0x07, 0x02, 0x01, 0x07, 0x1B, 0x07,
+  0x02, 0x01, 0x07, 0x1B, 0x07, 0x02, 0x00, 0x07, 0x1A, 0x07, 0x02, 0x00,
+  0x07, 0x1A, 0x07, 0x02, 0x00, 0x07, 0x1A, 0x07, 0x02, 0x00, 0x07, 0x1A,
+  0x07, 0x02, 0x00, 0x07, 0x19, 0x07, 0x02, 0x00, 0x07, 0x19, 0x07, 0x02,
+  0x00, 0x07, 0x18, 0x07, 0x02, 0x00, 0x08, 0x17, 0x08, 0x02, 0x00, 0x08,
+  0x17, 0x07, 0x02, 0x01, 0x08, 0x16, 0x07, 0x02, 0x01, 0x09, 0x14, 0x09,
+  0x02, 0x01, 0x0B, 0x12, 0x0A, 0x01, 0x02, 0x19, 0x01, 0x03, 0x17, 0x01,
+  0x04, 0x15, 0x01, 0x05, 0x12, 0x01, 0x07, 0x0E, 0x01, 0x09, 0x09, 0x01,
+  0x07, 0x12, 0x01, 0x07, 0x15, 0x01, 0x06, 0x17, 0x01, 0x06, 0x18, 0x01,
+  0x06, 0x18, 0x01, 0x06, 0x19, 0x02, 0x05, 0x08, 0x16, 0x09, 0x02, 0x05,
+  0x07, 0x17, 0x08, 0x02, 0x05, 0x07, 0x18, 0x07, 0x02, 0x05, 0x07, 0x18,
+  0x07, 0x02, 0x05, 0x07, 0x18, 0x07, 0x02, 0x04, 0x07, 0x18, 0x07, 0x02,
+  0x04, 0x07, 0x17, 0x07, 0x02, 0x04, 0x07, 0x17, 0x07, 0x02, 0x04, 0x07,
+  0x16, 0x07, 0x02, 0x04, 0x07, 0x14, 0x09, 0x01, 0x03, 0x19, 0x01, 0x03,
+  0x19, 0x01, 0x03, 0x18, 0x01, 0x03, 0x17, 0x01, 0x02, 0x16, 0x01, 0x02,
+  0x14, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x01,
+  0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x10, 0x09, 0x01, 0x0D, 0x0E, 0x01, 0x0B, 0x12, 0x01, 0x09,
+  0x15, 0x01, 0x08, 0x17, 0x01, 0x07, 0x19, 0x02, 0x06, 0x0A, 0x16, 0x0A,
+  0x02, 0x05, 0x09, 0x18, 0x09, 0x02, 0x05, 0x08, 0x19, 0x08, 0x02, 0x04,
+  0x08, 0x1A, 0x08, 0x02, 0x03, 0x08, 0x1A, 0x08, 0x02, 0x03, 0x07, 0x1B,
+  0x07, 0x02, 0x02, 0x07, 0x1B, 0x07, 0x02, 0x02, 0x07, 0x1B, 0x07, 0x02,
+  0x02, 0x06, 0x1B, 0x07, 0x02, 0x01, 0x07, 0x1B, 0x07, 0x02, 0x01, 0x07,
+  0x1B, 0x07, 0x02, 0x01, 0x06, 0x1B, 0x07, 0x02, 0x00, 0x07, 0x1A, 0x07,
+  0x02, 0x00, 0x07, 0x1A, 0x07, 0x02, 0x00, 0x07, 0x1A, 0x07, 0x02, 0x00,
+  0x07, 0x1A, 0x07, 0x03, 0x00, 0x07, 0x13, 0x02, 0x19, 0x07, 0x03, 0x00,
+  0x07, 0x12, 0x04, 0x19, 0x07, 0x03, 0x00, 0x07, 0x11, 0x05, 0x18, 0x07,
+  0x02, 0x00, 0x08, 0x10, 0x0F, 0x02, 0x00, 0x08, 0x11, 0x0D, 0x02, 0x01,
+  0x08, 0x11, 0x0C, 0x02, 0x01, 0x09, 0x12, 0x0B, 0x02, 0x01, 0x0B, 0x12,
+  0x0A, 0x01, 0x02, 0x1A, 0x01, 0x03, 0x19, 0x01, 0x04, 0x19, 0x01, 0x05,
+  0x19, 0x02, 0x07, 0x0E, 0x17, 0x06, 0x02, 0x09, 0x09, 0x18, 0x04, 0x01,
+  0x19, 0x02, 0x01, 0x07, 0x15, 0x01, 0x07, 0x17, 0x01, 0x07, 0x18, 0x01,
+  0x06, 0x1A, 0x01, 0x06, 0x1A, 0x01, 0x06, 0x1B, 0x02, 0x06, 0x07, 0x18,
+  0x09, 0x02, 0x05, 0x08, 0x19, 0x08, 0x02, 0x05, 0x07, 0x1A, 0x07, 0x02,
+  0x05, 0x07, 0x1A, 0x07, 0x02, 0x05, 0x07, 0x1A, 0x06, 0x02, 0x05, 0x07,
+  0x1A, 0x06, 0x02, 0x04, 0x07, 0x19, 0x07, 0x02, 0x04, 0x07, 0x18, 0x07,
+  0x02, 0x04, 0x07, 0x16, 0x08, 0x01, 0x04, 0x19, 0x01, 0x04, 0x18, 0x01,
+  0x03, 0x17, 0x01, 0x03, 0x17, 0x01, 0x03, 0x18, 0x01, 0x03, 0x19, 0x02,
+  0x02, 0x07, 0x14, 0x08, 0x02, 0x02, 0x07, 0x15, 0x07, 0x02, 0x02, 0x07,
+  0x15, 0x07, 0x02, 0x02, 0x07, 0x15, 0x07, 0x02, 0x02, 0x07, 0x15, 0x07,
+  0x02, 0x01, 0x07, 0x15, 0x07, 0x02, 0x01, 0x07, 0x14, 0x07, 0x02, 0x01,
+  0x07, 0x14, 0x07, 0x02, 0x01, 0x07, 0x14, 0x07, 0x02, 0x01, 0x07, 0x14,
+  0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02,
+  0x00, 0x07, 0x14, 0x07, 0x01, 0x0E, 0x09, 0x01, 0x0B, 0x0F, 0x01, 0x09,
+  0x12, 0x01, 0x08, 0x14, 0x01, 0x07, 0x16, 0x01, 0x06, 0x18, 0x02, 0x06,
+  0x08, 0x15, 0x09, 0x02, 0x05, 0x08, 0x16, 0x08, 0x02, 0x05, 0x07, 0x17,
+  0x07, 0x02, 0x04, 0x07, 0x17, 0x07, 0x02, 0x04, 0x07, 0x17, 0x07, 0x01,
+  0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x08, 0x01, 0x04, 0x0B, 0x01,
+  0x04, 0x10, 0x01, 0x05, 0x13, 0x01, 0x06, 0x13, 0x01, 0x07, 0x14, 0x01,
+  0x0A, 0x11, 0x01, 0x0E, 0x0E, 0x01, 0x12, 0x0A, 0x01, 0x14, 0x08, 0x01,
+  0x15, 0x07, 0x01, 0x15, 0x07, 0x02, 0x00, 0x07, 0x15, 0x07, 0x02, 0x00,
+  0x07, 0x15, 0x06, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x08, 0x13,
+  0x08, 0x02, 0x00, 0x0A, 0x11, 0x09, 0x01, 0x01, 0x18, 0x01, 0x01, 0x18,
+  0x01, 0x02, 0x16, 0x01, 0x03, 0x13, 0x01, 0x05, 0x10, 0x01, 0x08, 0x0A,
+  0x01, 0x01, 0x1B, 0x01, 0x01, 0x1B, 0x01, 0x00, 0x1C, 0x01, 0x00, 0x1C,
+  0x01, 0x00, 0x1B, 0x01, 0x00, 0x1B, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07,
+  0x01, 0x0A, 0x07, 0x01, 0x09, 0x07, 0x01, 0x09, 0x07, 0x01, 0x09, 0x07,
+  0x01, 0x09, 0x07, 0x01, 0x08, 0x08, 0x01, 0x08, 0x07, 0x01, 0x08, 0x07,
+  0x01, 0x08, 0x07, 0x01, 0x08, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07,
+  0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x06, 0x07,
+  0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x05, 0x07,
+  0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07,
+  0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x02, 0x05, 0x07, 0x19, 0x07, 0x02,
+  0x05, 0x07, 0x19, 0x07, 0x02, 0x05, 0x07, 0x18, 0x07, 0x02, 0x04, 0x07,
+  0x18, 0x07, 0x02, 0x04, 0x07, 0x18, 0x07, 0x02, 0x04, 0x07, 0x18, 0x07,
+  0x02, 0x04, 0x07, 0x18, 0x07, 0x02, 0x04, 0x07, 0x17, 0x07, 0x02, 0x03,
+  0x07, 0x17, 0x07, 0x02, 0x03, 0x07, 0x17, 0x07, 0x02, 0x03, 0x07, 0x17,
+  0x07, 0x02, 0x03, 0x07, 0x17, 0x07, 0x02, 0x02, 0x07, 0x16, 0x07, 0x02,
+  0x02, 0x07, 0x16, 0x07, 0x02, 0x02, 0x07, 0x16, 0x07, 0x02, 0x02, 0x07,
+  0x16, 0x07, 0x02, 0x02, 0x07, 0x15, 0x07, 0x02, 0x01, 0x07, 0x15, 0x07,
+  0x02, 0x01, 0x07, 0x15, 0x07, 0x02, 0x01, 0x07, 0x15, 0x07, 0x02, 0x01,
+  0x07, 0x15, 0x07, 0x02, 0x01, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14,
+  0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02,
+  0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x00, 0x08,
+  0x12, 0x07, 0x02, 0x00, 0x0A, 0x10, 0x09, 0x01, 0x01, 0x17, 0x01, 0x01,
+  0x16, 0x01, 0x02, 0x14, 0x01, 0x03, 0x12, 0x01, 0x04, 0x0F, 0x01, 0x07,
+  0x09, 0x02, 0x00, 0x08, 0x16, 0x07, 0x02, 0x01, 0x07, 0x16, 0x07, 0x02,
+  0x01, 0x07, 0x15, 0x07, 0x02, 0x01, 0x07, 0x15, 0x07, 0x02, 0x01, 0x07,
+  0x14, 0x07, 0x02, 0x01, 0x07, 0x14, 0x07, 0x02, 0x01, 0x07, 0x13, 0x07,
+  0x02, 0x01, 0x07, 0x13, 0x07, 0x02, 0x02, 0x06, 0x12, 0x07, 0x02, 0x02,
+  0x06, 0x12, 0x06, 0x02, 0x02, 0x06, 0x11, 0x07, 0x02, 0x02, 0x06, 0x11,
+  0x06, 0x02, 0x02, 0x07, 0x10, 0x07, 0x02, 0x02, 0x07, 0x10, 0x06, 0x02,
+  0x02, 0x07, 0x0F, 0x07, 0x02, 0x02, 0x07, 0x0F, 0x06, 0x02, 0x03, 0x06,
+  0x0E, 0x07, 0x02, 0x03, 0x06, 0x0E, 0x06, 0x02, 0x03, 0x06, 0x0D, 0x06,
+  0x02, 0x03, 0x06, 0x0D, 0x06, 0x02, 0x03, 0x06, 0x0C, 0x06, 0x02, 0x03,
+  0x06, 0x0C, 0x06, 0x02, 0x03, 0x06, 0x0B, 0x06, 0x02, 0x03, 0x06, 0x0B,
+  0x06, 0x01, 0x04, 0x0C, 0x01, 0x04, 0x0C, 0x01, 0x04, 0x0B, 0x01, 0x04,
+  0x0A, 0x01, 0x04, 0x0A, 0x01, 0x04, 0x09, 0x01, 0x04, 0x09, 0x01, 0x05,
+  0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x06, 0x03, 0x00, 0x07, 0x11, 0x08,
+  0x23, 0x08, 0x03, 0x00, 0x07, 0x11, 0x08, 0x23, 0x07, 0x03, 0x00, 0x07,
+  0x11, 0x08, 0x23, 0x07, 0x03, 0x00, 0x07, 0x10, 0x09, 0x22, 0x07, 0x03,
+  0x00, 0x07, 0x10, 0x09, 0x22, 0x07, 0x03, 0x00, 0x07, 0x0F, 0x0A, 0x21,
+  0x07, 0x03, 0x00, 0x07, 0x0F, 0x0A, 0x21, 0x07, 0x03, 0x00, 0x07, 0x0E,
+  0x0B, 0x20, 0x07, 0x03, 0x01, 0x06, 0x0E, 0x0B, 0x20, 0x07, 0x04, 0x01,
+  0x06, 0x0E, 0x05, 0x14, 0x05, 0x20, 0x06, 0x04, 0x01, 0x06, 0x0D, 0x06,
+  0x14, 0x05, 0x1F, 0x07, 0x04, 0x01, 0x06, 0x0D, 0x05, 0x14, 0x05, 0x1F,
+  0x06, 0x04, 0x01, 0x06, 0x0C, 0x06, 0x14, 0x05, 0x1E, 0x07, 0x04, 0x01,
+  0x06, 0x0C, 0x05, 0x14, 0x05, 0x1E, 0x06, 0x04, 0x01, 0x06, 0x0C, 0x05,
+  0x14, 0x05, 0x1E, 0x06, 0x04, 0x01, 0x06, 0x0B, 0x06, 0x14, 0x05, 0x1D,
+  0x06, 0x04, 0x01, 0x06, 0x0B, 0x05, 0x14, 0x05, 0x1D, 0x06, 0x04, 0x01,
+  0x06, 0x0A, 0x06, 0x14, 0x05, 0x1C, 0x06, 0x04, 0x01, 0x06, 0x0A, 0x05,
+  0x14, 0x05, 0x1C, 0x06, 0x04, 0x01, 0x06, 0x09, 0x06, 0x14, 0x05, 0x1B,
+  0x06, 0x04, 0x01, 0x06, 0x09, 0x05, 0x14, 0x05, 0x1B, 0x06, 0x04, 0x01,
+  0x06, 0x09, 0x05, 0x14, 0x05, 0x1B, 0x05, 0x04, 0x01, 0x06, 0x08, 0x05,
+  0x14, 0x05, 0x1A, 0x06, 0x04, 0x02, 0x05, 0x08, 0x05, 0x14, 0x05, 0x1A,
+  0x05, 0x02, 0x02, 0x0B, 0x14, 0x0B, 0x02, 0x02, 0x0A, 0x14, 0x0A, 0x02,
+  0x02, 0x0A, 0x14, 0x0A, 0x02, 0x02, 0x09, 0x14, 0x09, 0x02, 0x02, 0x09,
+  0x14, 0x09, 0x02, 0x02, 0x08, 0x14, 0x08, 0x02, 0x02, 0x08, 0x14, 0x08,
+  0x02, 0x02, 0x07, 0x14, 0x08, 0x02, 0x02, 0x07, 0x14, 0x07, 0x02, 0x02,
+  0x07, 0x14, 0x07, 0x02, 0x08, 0x08, 0x1C, 0x08, 0x02, 0x08, 0x09, 0x1B,
+  0x08, 0x02, 0x09, 0x08, 0x1B, 0x08, 0x02, 0x09, 0x08, 0x1A, 0x08, 0x02,
+  0x0A, 0x08, 0x19, 0x08, 0x02, 0x0A, 0x08, 0x18, 0x08, 0x02, 0x0A, 0x08,
+  0x17, 0x08, 0x02, 0x0B, 0x08, 0x17, 0x07, 0x02, 0x0B, 0x08, 0x16, 0x07,
+  0x02, 0x0C, 0x07, 0x15, 0x08, 0x01, 0x0C, 0x10, 0x01, 0x0C, 0x0F, 0x01,
+  0x0D, 0x0D, 0x01, 0x0D, 0x0C, 0x01, 0x0E, 0x0A, 0x01, 0x0E, 0x09, 0x01,
+  0x0E, 0x09, 0x01, 0x0E, 0x09, 0x01, 0x0D, 0x0A, 0x01, 0x0C, 0x0C, 0x01,
+  0x0C, 0x0C, 0x01, 0x0B, 0x0E, 0x01, 0x0A, 0x0F, 0x02, 0x09, 0x07, 0x12,
+  0x07, 0x02, 0x08, 0x08, 0x12, 0x08, 0x02, 0x07, 0x08, 0x12, 0x08, 0x02,
+  0x06, 0x08, 0x13, 0x08, 0x02, 0x06, 0x07, 0x13, 0x08, 0x02, 0x05, 0x07,
+  0x13, 0x08, 0x02, 0x04, 0x08, 0x14, 0x08, 0x02, 0x03, 0x08, 0x14, 0x08,
+  0x02, 0x02, 0x08, 0x14, 0x09, 0x02, 0x01, 0x08, 0x15, 0x08, 0x02, 0x00,
+  0x09, 0x15, 0x09, 0x02, 0x00, 0x08, 0x15, 0x07, 0x02, 0x00, 0x08, 0x14,
+  0x08, 0x02, 0x00, 0x08, 0x13, 0x08, 0x02, 0x01, 0x07, 0x13, 0x07, 0x02,
+  0x01, 0x08, 0x12, 0x08, 0x02, 0x01, 0x08, 0x11, 0x08, 0x02, 0x02, 0x07,
+  0x11, 0x07, 0x02, 0x02, 0x07, 0x10, 0x07, 0x02, 0x02, 0x08, 0x0F, 0x08,
+  0x02, 0x03, 0x07, 0x0F, 0x07, 0x02, 0x03, 0x07, 0x0E, 0x07, 0x02, 0x03,
+  0x07, 0x0D, 0x07, 0x02, 0x04, 0x07, 0x0D, 0x07, 0x02, 0x04, 0x07, 0x0C,
+  0x07, 0x01, 0x04, 0x0E, 0x01, 0x04, 0x0E, 0x01, 0x05, 0x0C, 0x01, 0x05,
+  0x0B, 0x01, 0x05, 0x0A, 0x01, 0x06, 0x09, 0x01, 0x06, 0x08, 0x01, 0x06,
+  0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x05,
+  0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05,
+  0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04,
+  0x07, 0x01, 0x08, 0x19, 0x01, 0x07, 0x1A, 0x01, 0x07, 0x1A, 0x01, 0x07,
+  0x1A, 0x01, 0x07, 0x1A, 0x01, 0x07, 0x19, 0x01, 0x17, 0x09, 0x01, 0x16,
+  0x09, 0x01, 0x15, 0x09, 0x01, 0x14, 0x09, 0x01, 0x13, 0x09, 0x01, 0x12,
+  0x09, 0x01, 0x11, 0x09, 0x01, 0x10, 0x09, 0x01, 0x0F, 0x09, 0x01, 0x0E,
+  0x09, 0x01, 0x0D, 0x09, 0x01, 0x0C, 0x09, 0x01, 0x0B, 0x09, 0x01, 0x0A,
+  0x09, 0x01, 0x09, 0x09, 0x01, 0x08, 0x09, 0x01, 0x07, 0x08, 0x01, 0x06,
+  0x08, 0x01, 0x05, 0x08, 0x01, 0x04, 0x08, 0x01, 0x03, 0x08, 0x01, 0x02,
+  0x08, 0x01, 0x02, 0x19, 0x01, 0x01, 0x1A, 0x01, 0x01, 0x1A, 0x01, 0x01,
+  0x1A, 0x01, 0x01, 0x19, 0x01, 0x01, 0x19, 0x01, 0x09, 0x0C, 0x01, 0x09,
+  0x0B, 0x01, 0x09, 0x0B, 0x01, 0x09, 0x0B, 0x01, 0x08, 0x0C, 0x01, 0x08,
+  0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x07, 0x07, 0x01, 0x07,
+  0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x06,
+  0x07, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06,
+  0x06, 0x01, 0x05, 0x07, 0x01, 0x05, 0x06, 0x01, 0x05, 0x06, 0x01, 0x05,
+  0x06, 0x01, 0x04, 0x07, 0x01, 0x04, 0x06, 0x01, 0x04, 0x06, 0x01, 0x04,
+  0x06, 0x01, 0x04, 0x06, 0x01, 0x03, 0x07, 0x01, 0x03, 0x06, 0x01, 0x03,
+  0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02,
+  0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x01, 0x01,
+  0x06, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x0B, 0x01, 0x00,
+  0x0C, 0x01, 0x00, 0x0C, 0x01, 0x00, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x09, 0x0C, 0x01, 0x09, 0x0C, 0x01, 0x09,
+  0x0B, 0x01, 0x09, 0x0B, 0x01, 0x09, 0x0B, 0x01, 0x0E, 0x06, 0x01, 0x0D,
+  0x07, 0x01, 0x0D, 0x06, 0x01, 0x0D, 0x06, 0x01, 0x0D, 0x06, 0x01, 0x0D,
+  0x06, 0x01, 0x0C, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x0C,
+  0x06, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x0B,
+  0x06, 0x01, 0x0B, 0x06, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x06, 0x01, 0x0A,
+  0x06, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x07, 0x01, 0x09, 0x06, 0x01, 0x09,
+  0x06, 0x01, 0x09, 0x06, 0x01, 0x09, 0x06, 0x01, 0x08, 0x07, 0x01, 0x08,
+  0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x07,
+  0x07, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x01,
+  0x0C, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x0B, 0x01, 0x00,
+  0x0C, 0x01, 0x0B, 0x06, 0x01, 0x0B, 0x07, 0x01, 0x0A, 0x08, 0x01, 0x0A,
+  0x08, 0x01, 0x09, 0x09, 0x01, 0x08, 0x0A, 0x01, 0x08, 0x0B, 0x02, 0x07,
+  0x05, 0x0D, 0x06, 0x02, 0x07, 0x05, 0x0E, 0x05, 0x02, 0x06, 0x05, 0x0E,
+  0x05, 0x02, 0x05, 0x06, 0x0E, 0x05, 0x02, 0x05, 0x05, 0x0E, 0x06, 0x02,
+  0x04, 0x06, 0x0E, 0x06, 0x02, 0x04, 0x05, 0x0F, 0x05, 0x02, 0x03, 0x05,
+  0x0F, 0x05, 0x02, 0x02, 0x06, 0x0F, 0x05, 0x02, 0x02, 0x05, 0x0F, 0x06,
+  0x02, 0x01, 0x06, 0x0F, 0x06, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x00,
+  0x05, 0x10, 0x05, 0x01, 0x01, 0x1C, 0x01, 0x00, 0x1D, 0x01, 0x00, 0x1C,
+  0x01, 0x00, 0x1C, 0x01, 0x00, 0x05, 0x01, 0x01, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x04, 0x01, 0x04, 0x03,
+  0x01, 0x0B, 0x09, 0x01, 0x08, 0x0F, 0x01, 0x06, 0x12, 0x01, 0x05, 0x14,
+  0x01, 0x05, 0x14, 0x02, 0x04, 0x07, 0x11, 0x08, 0x02, 0x04, 0x06, 0x12,
+  0x07, 0x02, 0x04, 0x06, 0x12, 0x06, 0x01, 0x11, 0x07, 0x01, 0x0F, 0x09,
+  0x01, 0x09, 0x0F, 0x01, 0x06, 0x11, 0x01, 0x04, 0x13, 0x02, 0x03, 0x0C,
+  0x10, 0x07, 0x02, 0x02, 0x09, 0x10, 0x07, 0x02, 0x01, 0x08, 0x10, 0x06,
+  0x02, 0x01, 0x07, 0x10, 0x06, 0x02, 0x00, 0x07, 0x0F, 0x07, 0x02, 0x00,
+  0x07, 0x0F, 0x07, 0x02, 0x00, 0x07, 0x0E, 0x08, 0x02, 0x00, 0x08, 0x0C,
+  0x09, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15, 0x02, 0x01, 0x0C, 0x0E, 0x08,
+  0x02, 0x02, 0x0A, 0x0E, 0x08, 0x01, 0x04, 0x06, 0x01, 0x07, 0x07, 0x01,
+  0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01,
+  0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x02,
+  0x05, 0x07, 0x0F, 0x07, 0x02, 0x05, 0x06, 0x0D, 0x0B, 0x02, 0x05, 0x06,
+  0x0C, 0x0D, 0x01, 0x04, 0x15, 0x01, 0x04, 0x16, 0x02, 0x04, 0x0A, 0x12,
+  0x08, 0x02, 0x04, 0x08, 0x13, 0x08, 0x02, 0x04, 0x07, 0x13, 0x08, 0x02,
+  0x03, 0x07, 0x14, 0x07, 0x02, 0x03, 0x07, 0x14, 0x07, 0x02, 0x03, 0x06,
+  0x14, 0x07, 0x02, 0x03, 0x06, 0x14, 0x07, 0x02, 0x02, 0x07, 0x14, 0x07,
+  0x02, 0x02, 0x06, 0x14, 0x07, 0x02, 0x02, 0x06, 0x13, 0x07, 0x02, 0x02,
+  0x06, 0x13, 0x07, 0x02, 0x02, 0x06, 0x13, 0x07, 0x02, 0x01, 0x07, 0x12,
+  0x07, 0x02, 0x01, 0x08, 0x11, 0x08, 0x02, 0x01, 0x08, 0x10, 0x08, 0x02,
+  0x01, 0x09, 0x0F, 0x08, 0x01, 0x01, 0x15, 0x01, 0x00, 0x15, 0x01, 0x00,
+  0x14, 0x02, 0x00, 0x06, 0x08, 0x0B, 0x01, 0x0A, 0x06, 0x01, 0x0B, 0x08,
+  0x01, 0x09, 0x0C, 0x01, 0x07, 0x10, 0x01, 0x06, 0x12, 0x01, 0x05, 0x13,
+  0x02, 0x04, 0x08, 0x11, 0x08, 0x02, 0x03, 0x07, 0x12, 0x07, 0x02, 0x03,
+  0x06, 0x12, 0x07, 0x02, 0x02, 0x07, 0x12, 0x07, 0x01, 0x02, 0x06, 0x01,
+  0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x02, 0x00, 0x07, 0x10,
+  0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x08, 0x0F, 0x07, 0x02,
+  0x01, 0x08, 0x0E, 0x07, 0x01, 0x01, 0x14, 0x01, 0x02, 0x12, 0x01, 0x03,
+  0x10, 0x01, 0x04, 0x0D, 0x01, 0x06, 0x08, 0x01, 0x16, 0x07, 0x01, 0x16,
+  0x07, 0x01, 0x16, 0x06, 0x01, 0x16, 0x06, 0x01, 0x15, 0x07, 0x01, 0x15,
+  0x07, 0x01, 0x15, 0x07, 0x01, 0x15, 0x06, 0x01, 0x14, 0x07, 0x02, 0x0A,
+  0x07, 0x14, 0x07, 0x02, 0x08, 0x0A, 0x14, 0x07, 0x02, 0x07, 0x0C, 0x14,
+  0x06, 0x01, 0x05, 0x15, 0x01, 0x04, 0x16, 0x02, 0x04, 0x08, 0x10, 0x0A,
+  0x02, 0x03, 0x08, 0x11, 0x09, 0x02, 0x02, 0x08, 0x12, 0x07, 0x02, 0x02,
+  0x07, 0x12, 0x07, 0x02, 0x01, 0x07, 0x13, 0x06, 0x02, 0x01, 0x07, 0x13,
+  0x06, 0x02, 0x01, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x06, 0x02,
+  0x00, 0x07, 0x12, 0x06, 0x02, 0x00, 0x07, 0x12, 0x06, 0x02, 0x00, 0x07,
+  0x12, 0x06, 0x02, 0x00, 0x07, 0x11, 0x06, 0x02, 0x00, 0x07, 0x10, 0x07,
+  0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x08, 0x0F, 0x08, 0x02, 0x01,
+  0x08, 0x0D, 0x0A, 0x01, 0x01, 0x15, 0x01, 0x01, 0x15, 0x01, 0x02, 0x14,
+  0x02, 0x03, 0x0A, 0x0F, 0x07, 0x01, 0x05, 0x06, 0x01, 0x0B, 0x07, 0x01,
+  0x08, 0x0D, 0x01, 0x07, 0x0F, 0x01, 0x05, 0x12, 0x01, 0x04, 0x14, 0x02,
+  0x04, 0x08, 0x10, 0x08, 0x02, 0x03, 0x07, 0x11, 0x08, 0x02, 0x02, 0x07,
+  0x12, 0x07, 0x02, 0x02, 0x07, 0x12, 0x07, 0x02, 0x01, 0x07, 0x12, 0x07,
+  0x02, 0x01, 0x07, 0x12, 0x07, 0x01, 0x01, 0x18, 0x01, 0x01, 0x18, 0x01,
+  0x00, 0x19, 0x01, 0x00, 0x18, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x00, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x08, 0x0F, 0x07,
+  0x02, 0x01, 0x08, 0x0E, 0x08, 0x01, 0x01, 0x14, 0x01, 0x02, 0x12, 0x01,
+  0x03, 0x0F, 0x01, 0x04, 0x0D, 0x01, 0x07, 0x07, 0x01, 0x0B, 0x07, 0x01,
+  0x09, 0x09, 0x01, 0x08, 0x09, 0x01, 0x07, 0x0A, 0x01, 0x07, 0x0A, 0x01,
+  0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01,
+  0x05, 0x07, 0x01, 0x02, 0x0E, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x0E, 0x01,
+  0x01, 0x0E, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01,
+  0x04, 0x06, 0x01, 0x04, 0x06, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01,
+  0x02, 0x07, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x01,
+  0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01,
+  0x00, 0x07, 0x02, 0x0D, 0x05, 0x16, 0x07, 0x02, 0x0A, 0x0A, 0x16, 0x06,
+  0x02, 0x09, 0x0C, 0x16, 0x06, 0x01, 0x08, 0x14, 0x01, 0x07, 0x15, 0x02,
+  0x06, 0x08, 0x12, 0x0A, 0x02, 0x05, 0x08, 0x14, 0x07, 0x02, 0x05, 0x07,
+  0x14, 0x07, 0x02, 0x04, 0x07, 0x14, 0x07, 0x02, 0x04, 0x07, 0x15, 0x06,
+  0x02, 0x03, 0x07, 0x15, 0x06, 0x02, 0x03, 0x07, 0x15, 0x05, 0x02, 0x03,
+  0x06, 0x15, 0x05, 0x02, 0x02, 0x07, 0x14, 0x06, 0x02, 0x02, 0x07, 0x14,
+  0x06, 0x02, 0x02, 0x07, 0x14, 0x05, 0x02, 0x02, 0x07, 0x13, 0x06, 0x02,
+  0x02, 0x07, 0x13, 0x06, 0x02, 0x02, 0x07, 0x12, 0x07, 0x02, 0x02, 0x08,
+  0x11, 0x08, 0x02, 0x02, 0x09, 0x0F, 0x09, 0x01, 0x03, 0x15, 0x01, 0x03,
+  0x15, 0x02, 0x04, 0x0D, 0x12, 0x06, 0x02, 0x05, 0x0A, 0x11, 0x07, 0x02,
+  0x07, 0x06, 0x11, 0x06, 0x01, 0x11, 0x06, 0x01, 0x10, 0x07, 0x02, 0x00,
+  0x07, 0x10, 0x06, 0x02, 0x00, 0x07, 0x0F, 0x07, 0x02, 0x00, 0x08, 0x0D,
+  0x08, 0x01, 0x00, 0x14, 0x01, 0x01, 0x12, 0x01, 0x02, 0x0F, 0x01, 0x05,
+  0x09, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x06, 0x01, 0x07,
+  0x06, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06,
+  0x06, 0x01, 0x06, 0x06, 0x02, 0x05, 0x07, 0x11, 0x06, 0x02, 0x05, 0x07,
+  0x0E, 0x0B, 0x02, 0x05, 0x07, 0x0D, 0x0D, 0x01, 0x05, 0x16, 0x01, 0x05,
+  0x16, 0x02, 0x04, 0x0A, 0x13, 0x08, 0x02, 0x04, 0x08, 0x14, 0x07, 0x02,
+  0x04, 0x07, 0x14, 0x07, 0x02, 0x04, 0x07, 0x14, 0x07, 0x02, 0x03, 0x07,
+  0x14, 0x06, 0x02, 0x03, 0x07, 0x14, 0x06, 0x02, 0x03, 0x07, 0x13, 0x07,
+  0x02, 0x03, 0x06, 0x13, 0x07, 0x02, 0x03, 0x06, 0x13, 0x07, 0x02, 0x02,
+  0x07, 0x13, 0x06, 0x02, 0x02, 0x07, 0x13, 0x06, 0x02, 0x02, 0x07, 0x12,
+  0x07, 0x02, 0x02, 0x06, 0x12, 0x07, 0x02, 0x02, 0x06, 0x12, 0x07, 0x02,
+  0x01, 0x07, 0x12, 0x06, 0x02, 0x01, 0x07, 0x12, 0x06, 0x02, 0x01, 0x07,
+  0x11, 0x07, 0x02, 0x01, 0x06, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07,
+  0x02, 0x00, 0x07, 0x11, 0x06, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01,
+  0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x00,
+  0x00, 0x00, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01,
+  0x05, 0x06, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01,
+  0x04, 0x06, 0x01, 0x04, 0x06, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x03, 0x06, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01,
+  0x02, 0x07, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x01,
+  0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x0C, 0x07, 0x01, 0x0C, 0x07, 0x01,
+  0x0C, 0x07, 0x01, 0x0C, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x0B, 0x07, 0x00,
+  0x00, 0x00, 0x01, 0x0B, 0x06, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01,
+  0x0A, 0x07, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x07, 0x01, 0x09, 0x07, 0x01,
+  0x09, 0x07, 0x01, 0x09, 0x06, 0x01, 0x09, 0x06, 0x01, 0x08, 0x07, 0x01,
+  0x08, 0x07, 0x01, 0x08, 0x07, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01,
+  0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x06, 0x01,
+  0x07, 0x06, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x06, 0x01,
+  0x06, 0x06, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01,
+  0x05, 0x06, 0x01, 0x05, 0x06, 0x01, 0x04, 0x07, 0x01, 0x01, 0x0A, 0x01,
+  0x01, 0x09, 0x01, 0x01, 0x09, 0x01, 0x00, 0x09, 0x01, 0x00, 0x06, 0x01,
+  0x07, 0x07, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x06, 0x07, 0x01,
+  0x06, 0x07, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x05, 0x07, 0x01,
+  0x05, 0x07, 0x02, 0x05, 0x07, 0x14, 0x07, 0x02, 0x05, 0x06, 0x12, 0x08,
+  0x02, 0x05, 0x06, 0x11, 0x08, 0x02, 0x04, 0x07, 0x10, 0x08, 0x02, 0x04,
+  0x07, 0x0F, 0x07, 0x02, 0x04, 0x07, 0x0E, 0x07, 0x02, 0x04, 0x06, 0x0D,
+  0x07, 0x02, 0x04, 0x06, 0x0C, 0x07, 0x02, 0x03, 0x07, 0x0B, 0x07, 0x01,
+  0x03, 0x0E, 0x01, 0x03, 0x0E, 0x01, 0x03, 0x0E, 0x01, 0x02, 0x10, 0x01,
+  0x02, 0x10, 0x02, 0x02, 0x09, 0x0C, 0x07, 0x02, 0x02, 0x08, 0x0C, 0x07,
+  0x02, 0x02, 0x06, 0x0C, 0x07, 0x02, 0x01, 0x07, 0x0D, 0x07, 0x02, 0x01,
+  0x07, 0x0D, 0x07, 0x02, 0x01, 0x07, 0x0D, 0x08, 0x02, 0x01, 0x06, 0x0E,
+  0x07, 0x02, 0x01, 0x06, 0x0E, 0x07, 0x02, 0x00, 0x07, 0x0E, 0x08, 0x02,
+  0x00, 0x07, 0x0F, 0x07, 0x02, 0x00, 0x06, 0x0F, 0x08, 0x01, 0x07, 0x07,
+  0x01, 0x07, 0x07, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x06, 0x07,
+  0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06,
+  0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x06,
+  0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x06,
+  0x01, 0x04, 0x06, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07,
+  0x01, 0x03, 0x06, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07,
+  0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x03, 0x05, 0x07, 0x10, 0x06, 0x1E, 0x06, 0x03, 0x05,
+  0x06, 0x0E, 0x0A, 0x1C, 0x0A, 0x03, 0x05, 0x06, 0x0C, 0x0C, 0x1A, 0x0D,
+  0x01, 0x04, 0x24, 0x01, 0x04, 0x24, 0x03, 0x04, 0x09, 0x11, 0x0B, 0x20,
+  0x08, 0x03, 0x04, 0x07, 0x12, 0x08, 0x21, 0x07, 0x03, 0x04, 0x07, 0x12,
+  0x07, 0x21, 0x07, 0x03, 0x03, 0x07, 0x12, 0x07, 0x21, 0x06, 0x03, 0x03,
+  0x07, 0x12, 0x06, 0x21, 0x06, 0x03, 0x03, 0x07, 0x12, 0x06, 0x20, 0x07,
+  0x03, 0x03, 0x06, 0x11, 0x07, 0x20, 0x07, 0x03, 0x02, 0x07, 0x11, 0x07,
+  0x20, 0x06, 0x03, 0x02, 0x07, 0x11, 0x07, 0x20, 0x06, 0x03, 0x02, 0x07,
+  0x11, 0x06, 0x1F, 0x07, 0x03, 0x02, 0x06, 0x11, 0x06, 0x1F, 0x07, 0x03,
+  0x02, 0x06, 0x10, 0x07, 0x1F, 0x07, 0x03, 0x01, 0x07, 0x10, 0x07, 0x1F,
+  0x06, 0x03, 0x01, 0x07, 0x10, 0x07, 0x1F, 0x06, 0x03, 0x01, 0x07, 0x10,
+  0x06, 0x1E, 0x07, 0x03, 0x01, 0x06, 0x0F, 0x07, 0x1E, 0x07, 0x03, 0x01,
+  0x06, 0x0F, 0x07, 0x1E, 0x07, 0x03, 0x00, 0x07, 0x0F, 0x07, 0x1E, 0x06,
+  0x03, 0x00, 0x07, 0x0F, 0x06, 0x1E, 0x06, 0x03, 0x00, 0x07, 0x0F, 0x06,
+  0x1D, 0x07, 0x02, 0x05, 0x07, 0x10, 0x07, 0x02, 0x05, 0x07, 0x0E, 0x0B,
+  0x02, 0x05, 0x06, 0x0D, 0x0D, 0x01, 0x05, 0x16, 0x01, 0x04, 0x17, 0x02,
+  0x04, 0x0A, 0x13, 0x08, 0x02, 0x04, 0x08, 0x14, 0x07, 0x02, 0x04, 0x07,
+  0x14, 0x07, 0x02, 0x04, 0x07, 0x14, 0x07, 0x02, 0x03, 0x07, 0x14, 0x06,
+  0x02, 0x03, 0x07, 0x14, 0x06, 0x02, 0x03, 0x06, 0x13, 0x07, 0x02, 0x03,
+  0x06, 0x13, 0x07, 0x02, 0x02, 0x07, 0x13, 0x07, 0x02, 0x02, 0x07, 0x13,
+  0x06, 0x02, 0x02, 0x07, 0x13, 0x06, 0x02, 0x02, 0x06, 0x12, 0x07, 0x02,
+  0x02, 0x06, 0x12, 0x07, 0x02, 0x01, 0x07, 0x12, 0x07, 0x02, 0x01, 0x07,
+  0x12, 0x06, 0x02, 0x01, 0x07, 0x12, 0x06, 0x02, 0x01, 0x06, 0x11, 0x07,
+  0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00,
+  0x07, 0x11, 0x06, 0x01, 0x0B, 0x08, 0x01, 0x09, 0x0D, 0x01, 0x07, 0x10,
+  0x01, 0x06, 0x12, 0x01, 0x05, 0x14, 0x02, 0x04, 0x08, 0x11, 0x08, 0x02,
+  0x03, 0x08, 0x12, 0x08, 0x02, 0x02, 0x08, 0x12, 0x08, 0x02, 0x02, 0x07,
+  0x13, 0x07, 0x02, 0x01, 0x07, 0x13, 0x07, 0x02, 0x01, 0x07, 0x13, 0x07,
+  0x02, 0x01, 0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x00,
+  0x07, 0x13, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12,
+  0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02,
+  0x00, 0x08, 0x10, 0x08, 0x02, 0x00, 0x08, 0x0F, 0x08, 0x02, 0x01, 0x08,
+  0x0E, 0x08, 0x01, 0x01, 0x14, 0x01, 0x02, 0x12, 0x01, 0x03, 0x10, 0x01,
+  0x04, 0x0D, 0x01, 0x07, 0x07, 0x02, 0x07, 0x07, 0x12, 0x06, 0x02, 0x07,
+  0x06, 0x0F, 0x0B, 0x02, 0x07, 0x06, 0x0E, 0x0D, 0x01, 0x06, 0x15, 0x01,
+  0x06, 0x16, 0x02, 0x06, 0x0A, 0x14, 0x08, 0x02, 0x06, 0x08, 0x15, 0x08,
+  0x02, 0x05, 0x08, 0x15, 0x08, 0x02, 0x05, 0x07, 0x16, 0x07, 0x02, 0x05,
+  0x07, 0x16, 0x07, 0x02, 0x05, 0x06, 0x16, 0x07, 0x02, 0x05, 0x06, 0x16,
+  0x07, 0x02, 0x04, 0x07, 0x16, 0x07, 0x02, 0x04, 0x07, 0x16, 0x07, 0x02,
+  0x04, 0x06, 0x15, 0x07, 0x02, 0x04, 0x06, 0x15, 0x07, 0x02, 0x03, 0x07,
+  0x15, 0x07, 0x02, 0x03, 0x07, 0x14, 0x07, 0x02, 0x03, 0x08, 0x13, 0x08,
+  0x02, 0x03, 0x08, 0x12, 0x08, 0x02, 0x03, 0x0A, 0x11, 0x08, 0x01, 0x02,
+  0x17, 0x01, 0x02, 0x16, 0x02, 0x02, 0x07, 0x0A, 0x0D, 0x02, 0x02, 0x06,
+  0x0B, 0x0A, 0x02, 0x02, 0x06, 0x0C, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01,
+  0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x02, 0x0B,
+  0x06, 0x15, 0x07, 0x02, 0x08, 0x0B, 0x15, 0x07, 0x02, 0x07, 0x0D, 0x15,
+  0x06, 0x02, 0x06, 0x0E, 0x15, 0x06, 0x01, 0x05, 0x16, 0x02, 0x04, 0x08,
+  0x11, 0x0A, 0x02, 0x03, 0x08, 0x12, 0x09, 0x02, 0x02, 0x08, 0x12, 0x08,
+  0x02, 0x02, 0x07, 0x13, 0x07, 0x02, 0x01, 0x07, 0x13, 0x07, 0x02, 0x01,
+  0x07, 0x13, 0x07, 0x02, 0x01, 0x07, 0x13, 0x06, 0x02, 0x00, 0x07, 0x13,
+  0x06, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x12, 0x07, 0x02,
+  0x00, 0x07, 0x12, 0x07, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07,
+  0x11, 0x07, 0x02, 0x00, 0x07, 0x10, 0x08, 0x02, 0x00, 0x08, 0x0F, 0x09,
+  0x02, 0x01, 0x08, 0x0D, 0x0B, 0x01, 0x01, 0x16, 0x02, 0x02, 0x0E, 0x11,
+  0x06, 0x02, 0x02, 0x0D, 0x10, 0x07, 0x02, 0x03, 0x0B, 0x10, 0x07, 0x02,
+  0x05, 0x07, 0x10, 0x06, 0x01, 0x10, 0x06, 0x01, 0x0F, 0x07, 0x01, 0x0F,
+  0x07, 0x01, 0x0F, 0x07, 0x01, 0x0F, 0x06, 0x01, 0x0F, 0x06, 0x01, 0x0E,
+  0x07, 0x01, 0x0E, 0x07, 0x01, 0x0E, 0x07, 0x02, 0x05, 0x07, 0x10, 0x04,
+  0x02, 0x05, 0x07, 0x0E, 0x06, 0x02, 0x05, 0x06, 0x0D, 0x06, 0x02, 0x05,
+  0x06, 0x0C, 0x07, 0x01, 0x04, 0x0F, 0x01, 0x04, 0x0F, 0x01, 0x04, 0x0A,
+  0x01, 0x04, 0x08, 0x01, 0x04, 0x07, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x02, 0x07, 0x01, 0x02, 0x07,
+  0x01, 0x02, 0x07, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07,
+  0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x0B, 0x08, 0x01, 0x08, 0x0D,
+  0x01, 0x06, 0x10, 0x01, 0x05, 0x12, 0x01, 0x04, 0x14, 0x02, 0x04, 0x07,
+  0x10, 0x08, 0x02, 0x03, 0x07, 0x11, 0x07, 0x02, 0x03, 0x07, 0x11, 0x07,
+  0x01, 0x03, 0x08, 0x01, 0x03, 0x0B, 0x01, 0x03, 0x0F, 0x01, 0x04, 0x10,
+  0x01, 0x05, 0x10, 0x01, 0x06, 0x10, 0x01, 0x09, 0x0E, 0x01, 0x0C, 0x0B,
+  0x01, 0x0E, 0x09, 0x01, 0x10, 0x07, 0x02, 0x00, 0x06, 0x10, 0x07, 0x02,
+  0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x08, 0x0E, 0x08, 0x01, 0x01, 0x14,
+  0x01, 0x01, 0x14, 0x01, 0x02, 0x11, 0x01, 0x03, 0x0F, 0x01, 0x06, 0x09,
+  0x01, 0x06, 0x06, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07,
+  0x01, 0x05, 0x06, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x01, 0x0D,
+  0x01, 0x01, 0x0D, 0x01, 0x01, 0x0D, 0x01, 0x00, 0x0E, 0x01, 0x03, 0x07,
+  0x01, 0x03, 0x07, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x02, 0x07,
+  0x01, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x0A,
+  0x01, 0x00, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x09, 0x01, 0x02, 0x07,
+  0x02, 0x04, 0x06, 0x14, 0x07, 0x02, 0x04, 0x06, 0x14, 0x07, 0x02, 0x03,
+  0x07, 0x14, 0x06, 0x02, 0x03, 0x07, 0x13, 0x07, 0x02, 0x03, 0x07, 0x13,
+  0x07, 0x02, 0x03, 0x06, 0x13, 0x07, 0x02, 0x03, 0x06, 0x13, 0x06, 0x02,
+  0x02, 0x07, 0x13, 0x06, 0x02, 0x02, 0x07, 0x12, 0x07, 0x02, 0x02, 0x07,
+  0x12, 0x07, 0x02, 0x02, 0x06, 0x12, 0x07, 0x02, 0x02, 0x06, 0x12, 0x06,
+  0x02, 0x01, 0x07, 0x12, 0x06, 0x02, 0x01, 0x07, 0x11, 0x07, 0x02, 0x01,
+  0x06, 0x11, 0x07, 0x02, 0x01, 0x06, 0x11, 0x06, 0x02, 0x00, 0x07, 0x11,
+  0x06, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x00, 0x07, 0x0F, 0x08, 0x02,
+  0x00, 0x07, 0x0E, 0x09, 0x02, 0x00, 0x08, 0x0D, 0x09, 0x01, 0x00, 0x16,
+  0x01, 0x00, 0x16, 0x02, 0x01, 0x0D, 0x0F, 0x07, 0x02, 0x02, 0x0B, 0x0F,
+  0x07, 0x01, 0x04, 0x06, 0x02, 0x00, 0x07, 0x11, 0x07, 0x02, 0x00, 0x07,
+  0x11, 0x07, 0x02, 0x00, 0x07, 0x10, 0x07, 0x02, 0x01, 0x06, 0x10, 0x07,
+  0x02, 0x01, 0x06, 0x0F, 0x07, 0x02, 0x01, 0x06, 0x0F, 0x06, 0x02, 0x01,
+  0x07, 0x0E, 0x07, 0x02, 0x01, 0x07, 0x0E, 0x06, 0x02, 0x01, 0x07, 0x0D,
+  0x07, 0x02, 0x01, 0x07, 0x0D, 0x06, 0x02, 0x02, 0x06, 0x0C, 0x07, 0x02,
+  0x02, 0x06, 0x0C, 0x06, 0x02, 0x02, 0x06, 0x0B, 0x07, 0x02, 0x02, 0x06,
+  0x0B, 0x06, 0x02, 0x02, 0x06, 0x0A, 0x06, 0x02, 0x02, 0x06, 0x0A, 0x06,
+  0x02, 0x02, 0x06, 0x09, 0x06, 0x02, 0x03, 0x05, 0x09, 0x06, 0x01, 0x03,
+  0x0B, 0x01, 0x03, 0x0B, 0x01, 0x03, 0x0A, 0x01, 0x03, 0x09, 0x01, 0x03,
+  0x09, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x03, 0x00, 0x07, 0x0E, 0x07,
+  0x1C, 0x07, 0x03, 0x00, 0x07, 0x0E, 0x07, 0x1C, 0x07, 0x03, 0x00, 0x07,
+  0x0D, 0x08, 0x1C, 0x06, 0x03, 0x00, 0x07, 0x0D, 0x08, 0x1B, 0x07, 0x03,
+  0x00, 0x07, 0x0C, 0x09, 0x1B, 0x06, 0x03, 0x00, 0x07, 0x0C, 0x09, 0x1A,
+  0x07, 0x03, 0x00, 0x07, 0x0C, 0x09, 0x1A, 0x06, 0x03, 0x01, 0x06, 0x0B,
+  0x0A, 0x19, 0x07, 0x04, 0x01, 0x06, 0x0B, 0x04, 0x10, 0x05, 0x19, 0x06,
+  0x04, 0x01, 0x06, 0x0A, 0x05, 0x10, 0x05, 0x18, 0x07, 0x04, 0x01, 0x06,
+  0x0A, 0x05, 0x10, 0x05, 0x18, 0x06, 0x04, 0x01, 0x06, 0x0A, 0x04, 0x10,
+  0x05, 0x18, 0x06, 0x04, 0x01, 0x06, 0x09, 0x05, 0x10, 0x05, 0x17, 0x06,
+  0x04, 0x01, 0x06, 0x09, 0x04, 0x10, 0x05, 0x17, 0x06, 0x04, 0x01, 0x06,
+  0x08, 0x05, 0x10, 0x05, 0x16, 0x06, 0x04, 0x01, 0x06, 0x08, 0x04, 0x10,
+  0x05, 0x16, 0x06, 0x03, 0x01, 0x06, 0x08, 0x04, 0x10, 0x0B, 0x02, 0x01,
+  0x0B, 0x10, 0x0B, 0x02, 0x01, 0x0A, 0x10, 0x0A, 0x02, 0x01, 0x0A, 0x10,
+  0x0A, 0x02, 0x01, 0x09, 0x10, 0x09, 0x02, 0x02, 0x08, 0x10, 0x09, 0x02,
+  0x02, 0x08, 0x10, 0x08, 0x02, 0x02, 0x07, 0x10, 0x08, 0x02, 0x02, 0x07,
+  0x10, 0x07, 0x02, 0x06, 0x08, 0x15, 0x08, 0x02, 0x06, 0x08, 0x14, 0x08,
+  0x02, 0x07, 0x07, 0x14, 0x07, 0x02, 0x07, 0x07, 0x13, 0x07, 0x02, 0x07,
+  0x08, 0x12, 0x07, 0x02, 0x08, 0x07, 0x11, 0x07, 0x02, 0x08, 0x07, 0x11,
+  0x07, 0x01, 0x09, 0x0E, 0x01, 0x09, 0x0D, 0x01, 0x0A, 0x0B, 0x01, 0x0A,
+  0x0A, 0x01, 0x0A, 0x09, 0x01, 0x0B, 0x07, 0x01, 0x0A, 0x09, 0x01, 0x09,
+  0x0A, 0x01, 0x08, 0x0C, 0x01, 0x07, 0x0D, 0x02, 0x06, 0x07, 0x0E, 0x07,
+  0x02, 0x05, 0x07, 0x0E, 0x07, 0x02, 0x04, 0x08, 0x0E, 0x08, 0x02, 0x04,
+  0x07, 0x0F, 0x07, 0x02, 0x03, 0x07, 0x0F, 0x07, 0x02, 0x02, 0x08, 0x0F,
+  0x08, 0x02, 0x01, 0x08, 0x10, 0x07, 0x02, 0x00, 0x08, 0x10, 0x08, 0x02,
+  0x04, 0x07, 0x16, 0x06, 0x02, 0x04, 0x07, 0x15, 0x07, 0x02, 0x04, 0x07,
+  0x15, 0x06, 0x02, 0x04, 0x07, 0x14, 0x07, 0x02, 0x04, 0x07, 0x14, 0x06,
+  0x02, 0x05, 0x07, 0x13, 0x07, 0x02, 0x05, 0x07, 0x13, 0x06, 0x02, 0x05,
+  0x07, 0x12, 0x06, 0x02, 0x05, 0x07, 0x12, 0x06, 0x02, 0x05, 0x07, 0x11,
+  0x06, 0x02, 0x05, 0x07, 0x11, 0x06, 0x02, 0x05, 0x07, 0x10, 0x06, 0x02,
+  0x06, 0x06, 0x10, 0x06, 0x02, 0x06, 0x06, 0x0F, 0x06, 0x02, 0x06, 0x06,
+  0x0F, 0x05, 0x02, 0x06, 0x07, 0x0E, 0x06, 0x02, 0x06, 0x07, 0x0E, 0x05,
+  0x01, 0x06, 0x0D, 0x01, 0x06, 0x0C, 0x01, 0x07, 0x0B, 0x01, 0x07, 0x0A,
+  0x01, 0x07, 0x09, 0x01, 0x07, 0x09, 0x01, 0x07, 0x08, 0x01, 0x07, 0x08,
+  0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x06, 0x01, 0x06, 0x06,
+  0x01, 0x05, 0x07, 0x01, 0x01, 0x0A, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0A,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x06, 0x01, 0x06, 0x14, 0x01, 0x06, 0x14,
+  0x01, 0x06, 0x13, 0x01, 0x05, 0x14, 0x01, 0x05, 0x14, 0x01, 0x10, 0x08,
+  0x01, 0x0F, 0x08, 0x01, 0x0E, 0x08, 0x01, 0x0D, 0x08, 0x01, 0x0C, 0x08,
+  0x01, 0x0B, 0x08, 0x01, 0x0A, 0x08, 0x01, 0x09, 0x08, 0x01, 0x08, 0x08,
+  0x01, 0x07, 0x08, 0x01, 0x06, 0x08, 0x01, 0x05, 0x08, 0x01, 0x04, 0x08,
+  0x01, 0x03, 0x08, 0x01, 0x02, 0x08, 0x01, 0x01, 0x15, 0x01, 0x01, 0x15,
+  0x01, 0x01, 0x15, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15, 0x01, 0x0C, 0x06,
+  0x01, 0x0A, 0x08, 0x01, 0x09, 0x09, 0x01, 0x09, 0x08, 0x01, 0x08, 0x09,
+  0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x06, 0x01, 0x07, 0x05,
+  0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x06, 0x05,
+  0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x05, 0x06,
+  0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x06, 0x01, 0x01, 0x08,
+  0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x00, 0x08, 0x01, 0x02, 0x06,
+  0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x01, 0x01, 0x08,
+  0x01, 0x02, 0x07, 0x01, 0x03, 0x06, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04,
+  0x01, 0x09, 0x03, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04,
+  0x01, 0x08, 0x04, 0x01, 0x08, 0x03, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x09, 0x06, 0x01, 0x09, 0x07, 0x01, 0x09, 0x07,
+  0x01, 0x09, 0x08, 0x01, 0x09, 0x08, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05,
+  0x01, 0x0C, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05,
+  0x01, 0x0B, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05,
+  0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x06,
+  0x01, 0x0A, 0x08, 0x01, 0x0B, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x09, 0x08,
+  0x01, 0x08, 0x06, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x05,
+  0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05,
+  0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05,
+  0x01, 0x05, 0x06, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x01, 0x09,
+  0x01, 0x01, 0x08, 0x01, 0x00, 0x09, 0x01, 0x00, 0x08, 0x01, 0x00, 0x06,
+  0x01, 0x04, 0x05, 0x01, 0x02, 0x09, 0x02, 0x01, 0x0B, 0x12, 0x04, 0x02,
+  0x01, 0x0C, 0x12, 0x04, 0x02, 0x00, 0x04, 0x09, 0x0C, 0x02, 0x00, 0x03,
+  0x0A, 0x0B, 0x01, 0x0B, 0x09, 0x01, 0x0C, 0x06 };
+
+const GFXglyph FreeSansBoldOblique24pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,  13,    0,    1 },   // 0x20 ' '
+  {     0,  14,  34,  16,    5,  -33 },   // 0x21 '!'
+  {    98,  18,  12,  22,    8,  -33 },   // 0x22 '"'
+  {   158,  29,  33,  26,    2,  -31 },   // 0x23 '#'
+  {   303,  26,  42,  26,    3,  -35 },   // 0x24 '$'
+  {   483,  36,  34,  42,    6,  -32 },   // 0x25 '%'
+  {   681,  29,  35,  34,    4,  -33 },   // 0x26 '&'
+  {   834,   7,  12,  11,    8,  -33 },   // 0x27 '''
+  {   870,  17,  44,  16,    4,  -33 },   // 0x28 '('
+  {  1002,  17,  44,  16,    0,  -34 },   // 0x29 ')'
+  {  1134,  15,  15,  18,    7,  -33 },   // 0x2A '*'
+  {  1191,  24,  22,  27,    4,  -21 },   // 0x2B '+'
+  {  1257,  10,  15,  13,    1,   -6 },   // 0x2C ','
+  {  1302,  14,   6,  16,    3,  -15 },   // 0x2D '-'
+  {  1320,   8,   7,  13,    3,   -6 },   // 0x2E '.'
+  {  1341,  20,  34,  13,    0,  -32 },   // 0x2F '/'
+  {  1443,  25,  35,  26,    4,  -33 },   // 0x30 '0'
+  {  1596,  17,  33,  26,    8,  -32 },   // 0x31 '1'
+  {  1695,  29,  34,  26,    1,  -33 },   // 0x32 '2'
+  {  1811,  26,  35,  26,    3,  -33 },   // 0x33 '3'
+  {  1936,  25,  32,  26,    3,  -31 },   // 0x34 '4'
+  {  2060,  27,  34,  26,    3,  -32 },   // 0x35 '5'
+  {  2176,  25,  35,  26,    4,  -33 },   // 0x36 '6'
+  {  2315,  26,  33,  26,    6,  -32 },   // 0x37 '7'
+  {  2414,  26,  35,  26,    3,  -33 },   // 0x38 '8'
+  {  2557,  25,  35,  26,    4,  -33 },   // 0x39 '9'
+  {  2696,  12,  25,  16,    5,  -24 },   // 0x3A ':'
+  {  2749,  14,  33,  16,    3,  -24 },   // 0x3B ';'
+  {  2826,  26,  23,  27,    4,  -22 },   // 0x3C '<'
+  {  2895,  26,  18,  27,    3,  -19 },   // 0x3D '='
+  {  2937,  26,  23,  27,    1,  -21 },   // 0x3E '>'
+  {  3006,  24,  35,  29,    8,  -34 },   // 0x3F '?'
+  {  3117,  45,  41,  46,    3,  -34 },   // 0x40 '@'
+  {  3370,  32,  34,  34,    1,  -33 },   // 0x41 'A'
+  {  3510,  32,  34,  34,    4,  -33 },   // 0x42 'B'
+  {  3644,  32,  36,  34,    5,  -34 },   // 0x43 'C'
+  {  3776,  32,  34,  34,    4,  -33 },   // 0x44 'D'
+  {  3922,  32,  34,  31,    4,  -33 },   // 0x45 'E'
+  {  4024,  32,  34,  29,    3,  -33 },   // 0x46 'F'
+  {  4126,  33,  36,  37,    5,  -34 },   // 0x47 'G'
+  {  4278,  35,  34,  34,    3,  -33 },   // 0x48 'H'
+  {  4436,  14,  34,  13,    3,  -33 },   // 0x49 'I'
+  {  4538,  27,  35,  26,    3,  -33 },   // 0x4A 'J'
+  {  4659,  37,  34,  34,    3,  -33 },   // 0x4B 'K'
+  {  4817,  24,  34,  29,    4,  -33 },   // 0x4C 'L'
+  {  4919,  41,  34,  39,    3,  -33 },   // 0x4D 'M'
+  {  5179,  35,  34,  34,    3,  -33 },   // 0x4E 'N'
+  {  5375,  34,  36,  37,    5,  -34 },   // 0x4F 'O'
+  {  5531,  31,  34,  31,    4,  -33 },   // 0x50 'P'
+  {  5653,  34,  37,  37,    5,  -34 },   // 0x51 'Q'
+  {  5822,  33,  34,  34,    4,  -33 },   // 0x52 'R'
+  {  5968,  30,  36,  31,    4,  -34 },   // 0x53 'S'
+  {  6096,  28,  34,  29,    7,  -33 },   // 0x54 'T'
+  {  6198,  32,  35,  34,    6,  -33 },   // 0x55 'U'
+  {  6361,  30,  34,  31,    8,  -33 },   // 0x56 'V'
+  {  6511,  43,  34,  44,    8,  -33 },   // 0x57 'W'
+  {  6759,  37,  34,  31,    1,  -33 },   // 0x58 'X'
+  {  6903,  29,  34,  31,    9,  -33 },   // 0x59 'Y'
+  {  7033,  33,  34,  29,    1,  -33 },   // 0x5A 'Z'
+  {  7135,  21,  43,  16,    1,  -33 },   // 0x5B '['
+  {  7264,   7,  36,  13,    6,  -34 },   // 0x5C '\'
+  {  7372,  21,  43,  16,   -1,  -33 },   // 0x5D ']'
+  {  7501,  21,  20,  27,    6,  -32 },   // 0x5E '^'
+  {  7587,  29,   4,  26,   -3,    6 },   // 0x5F '_'
+  {  7599,   7,   7,  16,    8,  -35 },   // 0x60 '`'
+  {  7620,  25,  26,  26,    2,  -24 },   // 0x61 'a'
+  {  7724,  27,  35,  29,    3,  -33 },   // 0x62 'b'
+  {  7869,  25,  26,  26,    4,  -24 },   // 0x63 'c'
+  {  7963,  29,  35,  29,    4,  -33 },   // 0x64 'd'
+  {  8108,  25,  26,  26,    3,  -24 },   // 0x65 'e'
+  {  8204,  18,  34,  16,    4,  -33 },   // 0x66 'f'
+  {  8306,  29,  35,  29,    2,  -24 },   // 0x67 'g'
+  {  8461,  27,  34,  29,    3,  -33 },   // 0x68 'h'
+  {  8609,  14,  34,  13,    3,  -33 },   // 0x69 'i'
+  {  8705,  19,  44,  13,   -2,  -33 },   // 0x6A 'j'
+  {  8831,  28,  34,  26,    3,  -33 },   // 0x6B 'k'
+  {  8973,  14,  34,  13,    3,  -33 },   // 0x6C 'l'
+  {  9075,  40,  25,  42,    3,  -24 },   // 0x6D 'm'
+  {  9242,  27,  25,  29,    3,  -24 },   // 0x6E 'n'
+  {  9363,  26,  26,  29,    4,  -24 },   // 0x6F 'o'
+  {  9473,  29,  35,  29,    1,  -24 },   // 0x70 'p'
+  {  9622,  28,  35,  29,    3,  -24 },   // 0x71 'q'
+  {  9775,  20,  25,  18,    3,  -24 },   // 0x72 'r'
+  {  9858,  24,  26,  26,    3,  -24 },   // 0x73 's'
+  {  9948,  14,  32,  16,    5,  -30 },   // 0x74 't'
+  { 10044,  27,  26,  29,    4,  -24 },   // 0x75 'u'
+  { 10168,  25,  25,  26,    6,  -24 },   // 0x76 'v'
+  { 10279,  35,  25,  37,    6,  -24 },   // 0x77 'w'
+  { 10454,  29,  25,  26,    1,  -24 },   // 0x78 'x'
+  { 10559,  29,  35,  26,    2,  -24 },   // 0x79 'y'
+  { 10698,  26,  25,  23,    1,  -24 },   // 0x7A 'z'
+  { 10773,  18,  43,  18,    4,  -33 },   // 0x7B '{'
+  { 10902,  13,  43,  13,    3,  -33 },   // 0x7C '|'
+  { 11031,  18,  43,  18,    2,  -33 },   // 0x7D '}'
+  { 11160,  22,   8,  27,    5,  -14 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSansBoldOblique24pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSansBoldOblique24pt7bSpanData,
+    (GFXglyph *)FreeSansBoldOblique24pt7bSpanGlyphs,
+    0x20, 0x7E, 56 } };
+
+// Approx. 11976 bytes
@@ -0,0 +1,296 @@
+// FreeSansOblique12pt7b as run lengths, generated by Tools/GFX_pack from FreeSansOblique12pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeSansOblique12pt7bPackedRuns[] PROGMEM = {
+  0x42, 0x32, 0x42, 0x42, 0x42, 0x42, 0x32, 0x42, 0x42, 0x42, 0x41, 0x42,
+  0x42, 0x41, 0xF1, 0x24, 0x24, 0x02, 0x24, 0x24, 0x23, 0x31, 0x11, 0x31,
+  0x11, 0x31, 0x10, 0x72, 0x32, 0x82, 0x32, 0x82, 0x22, 0x82, 0x32, 0x82,
+  0x32, 0x5B, 0x4B, 0x62, 0x32, 0x72, 0x32, 0x82, 0x32, 0x81, 0x32, 0x6B,
+  0x3C, 0x61, 0x32, 0x82, 0x32, 0x82, 0x31, 0x82, 0x32, 0x82, 0x32, 0x70,
+  0x81, 0x96, 0x68, 0x42, 0x21, 0x23, 0x23, 0x21, 0x32, 0x22, 0x22, 0x32,
+  0x22, 0x22, 0x72, 0x22, 0x75, 0xA6, 0x87, 0x62, 0x23, 0x12, 0x31, 0x42,
+  0x12, 0x31, 0x42, 0x12, 0x31, 0x32, 0x23, 0x12, 0x23, 0x39, 0x56, 0x91,
+  0xC1, 0xB2, 0x80, 0xF0, 0x25, 0x47, 0x25, 0x65, 0x25, 0x24, 0x24, 0x15,
+  0x25, 0x23, 0x25, 0x25, 0x22, 0x26, 0x33, 0x22, 0x28, 0x63, 0x1A, 0x43,
+  0x1F, 0x22, 0x34, 0x92, 0x36, 0x72, 0x32, 0x42, 0x61, 0x32, 0x52, 0x52,
+  0x32, 0x52, 0x42, 0x43, 0x32, 0x42, 0x66, 0x51, 0x84, 0x30, 0x74, 0x77,
+  0x62, 0x32, 0x52, 0x42, 0x52, 0x42, 0x52, 0x32, 0x75, 0x83, 0x85, 0x73,
+  0x13, 0x22, 0x12, 0x42, 0x12, 0x12, 0x64, 0x12, 0x63, 0x22, 0x63, 0x23,
+  0x45, 0x27, 0x22, 0x35, 0x33, 0x07, 0x11, 0x11, 0x10, 0x62, 0x52, 0x61,
+  0x62, 0x52, 0x62, 0x52, 0x62, 0x52, 0x62, 0x62, 0x52, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x71, 0x72, 0x62, 0x71, 0x50, 0x51, 0x72, 0x62,
+  0x71, 0x72, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x52, 0x62, 0x62,
+  0x52, 0x62, 0x52, 0x62, 0x52, 0x61, 0x62, 0x52, 0x60, 0x42, 0x62, 0x31,
+  0x21, 0x21, 0x17, 0x24, 0x44, 0x32, 0x12, 0xA0, 0x62, 0xA2, 0xA2, 0xA2,
+  0x4F, 0x95, 0x2A, 0x2A, 0x29, 0x2A, 0x26, 0x13, 0x13, 0x21, 0x31, 0x22,
+  0x12, 0x20, 0x0C, 0x06, 0x91, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82,
+  0x81, 0x81, 0x91, 0x81, 0x91, 0x81, 0x91, 0x81, 0x82, 0x81, 0x90, 0x55,
+  0x67, 0x43, 0x33, 0x23, 0x52, 0x22, 0x62, 0x12, 0x72, 0x12, 0x72, 0x12,
+  0x74, 0x75, 0x75, 0x72, 0x12, 0x72, 0x12, 0x63, 0x12, 0x62, 0x23, 0x33,
+  0x47, 0x65, 0x50, 0x61, 0x52, 0x33, 0x16, 0x16, 0x52, 0x52, 0x42, 0x52,
+  0x52, 0x52, 0x43, 0x42, 0x52, 0x52, 0x52, 0x42, 0x40, 0x66, 0x78, 0x53,
+  0x43, 0x33, 0x62, 0x32, 0x72, 0xC2, 0xB2, 0xB3, 0xA3, 0x94, 0x84, 0x84,
+  0x93, 0xA3, 0xB2, 0xCB, 0x2B, 0x30, 0x55, 0x67, 0x43, 0x33, 0x22, 0x62,
+  0x22, 0x62, 0xA2, 0x83, 0x65, 0x75, 0xA3, 0xA2, 0xA2, 0x12, 0x72, 0x12,
+  0x62, 0x23, 0x43, 0x38, 0x55, 0x50, 0x92, 0xA2, 0x93, 0x84, 0x75, 0x62,
+  0x12, 0x62, 0x22, 0x52, 0x32, 0x42, 0x42, 0x32, 0x43, 0x22, 0x52, 0x3F,
+  0x88, 0x29, 0x2A, 0x2A, 0x24, 0x49, 0x49, 0x32, 0xB2, 0xB1, 0xB2, 0x14,
+  0x68, 0x52, 0x43, 0x32, 0x62, 0xB2, 0xB2, 0xB2, 0xA2, 0x32, 0x62, 0x33,
+  0x42, 0x57, 0x75, 0x60, 0x64, 0x67, 0x43, 0x33, 0x23, 0x52, 0x22, 0x92,
+  0xA2, 0x24, 0x49, 0x24, 0x43, 0x13, 0x62, 0x12, 0x72, 0x12, 0x72, 0x12,
+  0x71, 0x22, 0x62, 0x23, 0x42, 0x48, 0x55, 0x50, 0x2B, 0x1C, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xB2, 0xA2, 0xA2, 0xA3, 0xA2, 0xA2, 0xA3, 0xA2, 0xA3, 0xA2,
+  0xA3, 0xA0, 0x55, 0x67, 0x43, 0x33, 0x22, 0x62, 0x22, 0x62, 0x22, 0x62,
+  0x23, 0x42, 0x47, 0x48, 0x33, 0x43, 0x22, 0x62, 0x12, 0x72, 0x12, 0x72,
+  0x12, 0x62, 0x23, 0x43, 0x38, 0x55, 0x50, 0x55, 0x58, 0x33, 0x43, 0x22,
+  0x62, 0x12, 0x72, 0x12, 0x72, 0x12, 0x72, 0x12, 0x63, 0x13, 0x44, 0x29,
+  0x44, 0x22, 0x93, 0x92, 0x22, 0x53, 0x23, 0x33, 0x47, 0x64, 0x60, 0x23,
+  0x23, 0xFF, 0xA3, 0x23, 0x20, 0x33, 0x33, 0xFF, 0xF4, 0x33, 0x34, 0x15,
+  0x14, 0x23, 0x24, 0xF8, 0x38, 0x46, 0x56, 0x46, 0x58, 0x3B, 0x4B, 0x5A,
+  0x5B, 0x3C, 0x12, 0x1C, 0x1B, 0xFC, 0xC1, 0xB2, 0x21, 0xC3, 0xB5, 0xA5,
+  0xB4, 0xB3, 0x85, 0x64, 0x65, 0x64, 0x83, 0xF8, 0x45, 0x48, 0x23, 0x43,
+  0x12, 0x64, 0x72, 0x92, 0x82, 0x82, 0x82, 0x73, 0x82, 0x82, 0x92, 0xFF,
+  0xB2, 0x92, 0x70, 0xA7, 0xEC, 0x94, 0x74, 0x73, 0xB3, 0x53, 0xD2, 0x43,
+  0x44, 0x63, 0x23, 0x46, 0x12, 0x32, 0x22, 0x43, 0x33, 0x42, 0x12, 0x42,
+  0x53, 0x42, 0x12, 0x32, 0x62, 0x54, 0x42, 0x62, 0x45, 0x32, 0x62, 0x52,
+  0x12, 0x32, 0x62, 0x43, 0x12, 0x32, 0x52, 0x43, 0x22, 0x33, 0x33, 0x33,
+  0x32, 0x45, 0x17, 0x52, 0x34, 0x25, 0x73, 0xF6, 0x4F, 0x5B, 0xE7, 0xB0,
+  0xA3, 0xC4, 0xC5, 0xA6, 0xA2, 0x13, 0x93, 0x22, 0x92, 0x32, 0x83, 0x32,
+  0x82, 0x42, 0x72, 0x52, 0x63, 0x53, 0x5B, 0x4C, 0x42, 0x82, 0x33, 0x82,
+  0x32, 0x92, 0x23, 0x92, 0x22, 0xA3, 0x49, 0x6A, 0x42, 0x73, 0x32, 0x82,
+  0x32, 0x82, 0x32, 0x82, 0x23, 0x72, 0x32, 0x72, 0x4A, 0x5B, 0x42, 0x73,
+  0x22, 0x92, 0x22, 0x92, 0x22, 0x92, 0x22, 0x82, 0x23, 0x73, 0x2C, 0x3A,
+  0x50, 0x76, 0x8A, 0x53, 0x53, 0x43, 0x82, 0x23, 0x92, 0x22, 0xD2, 0xE2,
+  0xD2, 0xE2, 0xE2, 0xE2, 0xE2, 0xB2, 0x12, 0xA2, 0x23, 0x83, 0x33, 0x54,
+  0x5A, 0x76, 0x70, 0x49, 0x6B, 0x52, 0x73, 0x42, 0x83, 0x32, 0x92, 0x32,
+  0x92, 0x23, 0x92, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x13, 0x92, 0x23,
+  0x92, 0x22, 0x92, 0x32, 0x92, 0x32, 0x82, 0x33, 0x64, 0x3B, 0x59, 0x70,
+  0x4C, 0x3C, 0x42, 0xE2, 0xE2, 0xE2, 0xD3, 0xD2, 0xEC, 0x4B, 0x43, 0xD3,
+  0xD2, 0xE2, 0xE2, 0xD3, 0xDD, 0x3D, 0x30, 0x4B, 0x3C, 0x32, 0xD2, 0xD2,
+  0xD2, 0xC3, 0xC2, 0xDA, 0x5A, 0x43, 0xC3, 0xC2, 0xD2, 0xD2, 0xC3, 0xC2,
+  0xD2, 0xD0, 0x76, 0x8A, 0x53, 0x54, 0x32, 0x92, 0x22, 0xA2, 0x13, 0xD2,
+  0xE2, 0xD2, 0x79, 0x76, 0x12, 0xC1, 0x12, 0xB2, 0x12, 0xB2, 0x13, 0x93,
+  0x22, 0x84, 0x24, 0x54, 0x49, 0x21, 0x65, 0x41, 0x20, 0x42, 0x92, 0x33,
+  0x92, 0x32, 0x93, 0x32, 0x92, 0x42, 0x92, 0x42, 0x92, 0x33, 0x92, 0x32,
+  0x93, 0x3D, 0x4D, 0x33, 0x92, 0x33, 0x83, 0x32, 0x93, 0x32, 0x92, 0x42,
+  0x92, 0x33, 0x92, 0x32, 0x93, 0x32, 0x92, 0x40, 0x42, 0x33, 0x32, 0x42,
+  0x42, 0x42, 0x33, 0x32, 0x42, 0x42, 0x42, 0x33, 0x32, 0x42, 0x42, 0x42,
+  0x33, 0x32, 0x40, 0xB2, 0xA2, 0xB2, 0xB2, 0xB2, 0xA3, 0xA2, 0xB2, 0xB2,
+  0xB2, 0xA3, 0xA2, 0x32, 0x62, 0x32, 0x62, 0x32, 0x53, 0x33, 0x33, 0x57,
+  0x75, 0x60, 0x42, 0x83, 0x43, 0x73, 0x52, 0x73, 0x62, 0x62, 0x82, 0x43,
+  0x92, 0x33, 0x93, 0x23, 0xA2, 0x23, 0xB2, 0x14, 0xB4, 0x13, 0x94, 0x32,
+  0x93, 0x43, 0x82, 0x62, 0x82, 0x63, 0x72, 0x72, 0x63, 0x73, 0x52, 0x92,
+  0x52, 0x93, 0x40, 0x42, 0x83, 0x82, 0x92, 0x92, 0x92, 0x83, 0x82, 0x92,
+  0x92, 0x83, 0x83, 0x82, 0x92, 0x92, 0x83, 0x8F, 0x70, 0x43, 0xA3, 0x34,
+  0x94, 0x34, 0x94, 0x34, 0x84, 0x44, 0x84, 0x44, 0x72, 0x12, 0x33, 0x12,
+  0x62, 0x12, 0x32, 0x22, 0x52, 0x13, 0x32, 0x22, 0x43, 0x12, 0x42, 0x22,
+  0x42, 0x22, 0x42, 0x22, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x22, 0x33, 0x32, 0x32, 0x22, 0x32, 0x42, 0x44, 0x42, 0x33, 0x44, 0x42,
+  0x32, 0x53, 0x52, 0x32, 0x53, 0x43, 0x30, 0x42, 0x92, 0x34, 0x82, 0x34,
+  0x82, 0x35, 0x63, 0x35, 0x62, 0x42, 0x12, 0x62, 0x33, 0x13, 0x52, 0x32,
+  0x32, 0x52, 0x32, 0x33, 0x33, 0x32, 0x33, 0x32, 0x42, 0x42, 0x32, 0x32,
+  0x53, 0x22, 0x32, 0x62, 0x22, 0x32, 0x66, 0x32, 0x74, 0x33, 0x74, 0x32,
+  0x84, 0x32, 0x93, 0x30, 0x76, 0x9A, 0x63, 0x54, 0x43, 0x82, 0x32, 0xA3,
+  0x13, 0xB2, 0x12, 0xC2, 0x12, 0xC4, 0xD4, 0xD4, 0xC5, 0xC2, 0x12, 0xC2,
+  0x12, 0xB2, 0x32, 0x92, 0x44, 0x54, 0x5A, 0x96, 0x70, 0x49, 0x5B, 0x42,
+  0x73, 0x32, 0x82, 0x32, 0x82, 0x32, 0x82, 0x23, 0x72, 0x32, 0x73, 0x3B,
+  0x4A, 0x43, 0xC3, 0xC2, 0xD2, 0xD2, 0xC3, 0xC2, 0xD2, 0xD0, 0x86, 0x9B,
+  0x64, 0x54, 0x43, 0x92, 0x33, 0xA3, 0x22, 0xC2, 0x12, 0xD2, 0x12, 0xD4,
+  0xE4, 0xE4, 0xD2, 0x12, 0xD2, 0x12, 0xC2, 0x23, 0x63, 0x13, 0x32, 0x75,
+  0x44, 0x54, 0x6D, 0x76, 0x33, 0xF1, 0x13, 0x4A, 0x5C, 0x42, 0x83, 0x32,
+  0x92, 0x32, 0x92, 0x32, 0x92, 0x23, 0x82, 0x32, 0x82, 0x4B, 0x5B, 0x43,
+  0x73, 0x33, 0x82, 0x32, 0x92, 0x32, 0x92, 0x32, 0x82, 0x33, 0x82, 0x32,
+  0x92, 0x32, 0x93, 0x20, 0x67, 0x6A, 0x43, 0x63, 0x32, 0x82, 0x22, 0x92,
+  0x22, 0xD2, 0xD4, 0xC7, 0xA8, 0xB5, 0xC3, 0x12, 0xA2, 0x12, 0xA2, 0x12,
+  0x92, 0x23, 0x63, 0x4A, 0x76, 0x60, 0x0F, 0xD5, 0x3B, 0x3B, 0x2C, 0x2C,
+  0x2B, 0x3B, 0x2C, 0x2C, 0x2C, 0x2B, 0x3B, 0x2C, 0x2C, 0x2C, 0x2B, 0x39,
+  0x32, 0x92, 0x23, 0x92, 0x22, 0x93, 0x22, 0x92, 0x32, 0x92, 0x23, 0x92,
+  0x23, 0x83, 0x22, 0x92, 0x32, 0x92, 0x32, 0x92, 0x23, 0x92, 0x22, 0x93,
+  0x22, 0x92, 0x32, 0x92, 0x32, 0x83, 0x33, 0x63, 0x5A, 0x86, 0x70, 0x02,
+  0xA6, 0x92, 0x13, 0x83, 0x22, 0x82, 0x32, 0x72, 0x42, 0x72, 0x42, 0x62,
+  0x52, 0x53, 0x52, 0x52, 0x63, 0x33, 0x63, 0x32, 0x82, 0x23, 0x82, 0x22,
+  0x92, 0x13, 0x92, 0x12, 0xA4, 0xB4, 0xB3, 0xA0, 0x02, 0x73, 0x75, 0x73,
+  0x72, 0x12, 0x64, 0x63, 0x12, 0x64, 0x62, 0x22, 0x55, 0x53, 0x22, 0x52,
+  0x12, 0x52, 0x32, 0x43, 0x12, 0x52, 0x32, 0x42, 0x32, 0x32, 0x42, 0x33,
+  0x32, 0x32, 0x42, 0x32, 0x42, 0x23, 0x42, 0x23, 0x42, 0x22, 0x52, 0x22,
+  0x52, 0x13, 0x52, 0x13, 0x52, 0x12, 0x62, 0x12, 0x62, 0x12, 0x74, 0x64,
+  0x83, 0x74, 0x83, 0x73, 0x92, 0x83, 0x80, 0x53, 0x83, 0x53, 0x73, 0x72,
+  0x63, 0x83, 0x43, 0xA2, 0x33, 0xB3, 0x22, 0xD2, 0x12, 0xE4, 0xF0, 0x4F,
+  0x04, 0xE5, 0xD3, 0x13, 0xB3, 0x23, 0xA3, 0x42, 0xA2, 0x53, 0x82, 0x72,
+  0x73, 0x73, 0x53, 0x92, 0x40, 0x03, 0xA2, 0x22, 0x92, 0x33, 0x73, 0x33,
+  0x63, 0x52, 0x53, 0x63, 0x42, 0x82, 0x32, 0x93, 0x13, 0x96, 0xB4, 0xC3,
+  0xD3, 0xD3, 0xD2, 0xE2, 0xE2, 0xD3, 0xD2, 0xB0, 0x4D, 0x4C, 0xE3, 0xD3,
+  0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xE2, 0xE2,
+  0xED, 0x4D, 0x40, 0x55, 0x54, 0x62, 0x82, 0x72, 0x82, 0x82, 0x82, 0x73,
+  0x72, 0x82, 0x82, 0x82, 0x73, 0x72, 0x82, 0x82, 0x82, 0x72, 0x82, 0x82,
+  0x84, 0x64, 0x50, 0x01, 0x21, 0x22, 0x12, 0x12, 0x21, 0x21, 0x21, 0x21,
+  0x21, 0x21, 0x21, 0x21, 0x22, 0x12, 0x12, 0x21, 0x21, 0x54, 0x64, 0x82,
+  0x82, 0x82, 0x72, 0x82, 0x82, 0x82, 0x73, 0x72, 0x82, 0x82, 0x82, 0x73,
+  0x72, 0x82, 0x82, 0x82, 0x72, 0x82, 0x64, 0x55, 0x50, 0x62, 0x73, 0x62,
+  0x12, 0x52, 0x12, 0x42, 0x22, 0x41, 0x32, 0x32, 0x32, 0x22, 0x52, 0x12,
+  0x52, 0x0E, 0x03, 0x22, 0x31, 0x32, 0x55, 0x48, 0x23, 0x33, 0x22, 0x52,
+  0x92, 0x82, 0x47, 0x24, 0x32, 0x12, 0x62, 0x12, 0x53, 0x12, 0x43, 0x27,
+  0x13, 0x15, 0x22, 0x10, 0x42, 0xB2, 0xB2, 0xA2, 0xB2, 0xB2, 0x24, 0x59,
+  0x43, 0x43, 0x23, 0x62, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x21, 0x73,
+  0x12, 0x72, 0x23, 0x53, 0x23, 0x43, 0x39, 0x42, 0x15, 0x40, 0x45, 0x57,
+  0x33, 0x33, 0x13, 0x52, 0x12, 0x65, 0x82, 0x92, 0x92, 0x92, 0x62, 0x13,
+  0x42, 0x38, 0x45, 0x40, 0xC2, 0xB2, 0xC2, 0xC2, 0xC2, 0x55, 0x22, 0x49,
+  0x43, 0x34, 0x33, 0x53, 0x32, 0x72, 0x23, 0x63, 0x22, 0x72, 0x32, 0x72,
+  0x32, 0x72, 0x32, 0x63, 0x33, 0x44, 0x49, 0x65, 0x12, 0x40, 0x55, 0x58,
+  0x33, 0x43, 0x13, 0x62, 0x12, 0x72, 0x1F, 0xAA, 0x2A, 0x27, 0x21, 0x34,
+  0x33, 0x85, 0x55, 0x53, 0x44, 0x33, 0x52, 0x62, 0x46, 0x26, 0x32, 0x62,
+  0x62, 0x62, 0x52, 0x62, 0x62, 0x62, 0x62, 0x52, 0x62, 0x60, 0x64, 0x22,
+  0x47, 0x11, 0x43, 0x34, 0x33, 0x53, 0x32, 0x63, 0x32, 0x62, 0x32, 0x72,
+  0x32, 0x72, 0x32, 0x63, 0x32, 0x63, 0x33, 0x43, 0x59, 0x64, 0x22, 0xB3,
+  0xB2, 0x42, 0x53, 0x58, 0x75, 0x70, 0x42, 0xA2, 0xA2, 0x92, 0xA2, 0xA2,
+  0x24, 0x49, 0x33, 0x33, 0x23, 0x52, 0x22, 0x62, 0x22, 0x62, 0x22, 0x53,
+  0x22, 0x52, 0x22, 0x62, 0x22, 0x62, 0x22, 0x62, 0x22, 0x52, 0x32, 0x52,
+  0x20, 0x32, 0x32, 0xF2, 0x23, 0x23, 0x23, 0x22, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x22, 0x23, 0x23, 0x23, 0x72, 0x72, 0xFF, 0x32, 0x63, 0x62, 0x72,
+  0x72, 0x72, 0x62, 0x72, 0x72, 0x72, 0x72, 0x62, 0x72, 0x72, 0x72, 0x63,
+  0x44, 0x53, 0x60, 0x42, 0xB2, 0xB2, 0xA2, 0xB2, 0xB2, 0x52, 0x42, 0x42,
+  0x52, 0x23, 0x52, 0x23, 0x62, 0x13, 0x76, 0x73, 0x13, 0x62, 0x32, 0x52,
+  0x42, 0x52, 0x43, 0x42, 0x52, 0x42, 0x53, 0x32, 0x62, 0x20, 0x32, 0x32,
+  0x32, 0x22, 0x32, 0x32, 0x32, 0x32, 0x32, 0x22, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x22, 0x32, 0x32, 0x30, 0x32, 0x15, 0x34, 0x48, 0x17, 0x24, 0x34,
+  0x42, 0x23, 0x52, 0x52, 0x22, 0x62, 0x52, 0x22, 0x52, 0x62, 0x22, 0x52,
+  0x53, 0x13, 0x52, 0x52, 0x22, 0x62, 0x52, 0x22, 0x62, 0x52, 0x22, 0x52,
+  0x62, 0x22, 0x52, 0x53, 0x22, 0x52, 0x52, 0x20, 0x32, 0x15, 0x49, 0x24,
+  0x33, 0x23, 0x52, 0x22, 0x62, 0x22, 0x62, 0x22, 0x53, 0x13, 0x52, 0x22,
+  0x62, 0x22, 0x62, 0x22, 0x62, 0x22, 0x52, 0x32, 0x52, 0x20, 0x55, 0x58,
+  0x33, 0x43, 0x13, 0x62, 0x12, 0x75, 0x74, 0x84, 0x72, 0x12, 0x72, 0x12,
+  0x63, 0x13, 0x43, 0x38, 0x55, 0x50, 0x42, 0x24, 0x69, 0x53, 0x43, 0x33,
+  0x62, 0x33, 0x62, 0x32, 0x72, 0x32, 0x72, 0x23, 0x63, 0x23, 0x62, 0x33,
+  0x53, 0x34, 0x33, 0x49, 0x43, 0x15, 0x52, 0xC2, 0xC2, 0xC2, 0xB3, 0xB0,
+  0x45, 0x22, 0x3A, 0x23, 0x34, 0x23, 0x53, 0x22, 0x72, 0x13, 0x72, 0x12,
+  0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x63, 0x23, 0x44, 0x39, 0x54, 0x22,
+  0xB2, 0xA3, 0xA3, 0xA2, 0xB2, 0x40, 0x32, 0x13, 0x36, 0x24, 0x53, 0x62,
+  0x72, 0x72, 0x63, 0x62, 0x72, 0x72, 0x72, 0x72, 0x60, 0x46, 0x59, 0x22,
+  0x53, 0x12, 0x72, 0x12, 0xA4, 0x97, 0x86, 0xA2, 0x12, 0x72, 0x13, 0x52,
+  0x29, 0x55, 0x50, 0x32, 0x52, 0x52, 0x26, 0x16, 0x32, 0x52, 0x42, 0x52,
+  0x52, 0x52, 0x52, 0x42, 0x52, 0x54, 0x43, 0x30, 0x22, 0x62, 0x22, 0x62,
+  0x22, 0x62, 0x13, 0x52, 0x22, 0x62, 0x22, 0x62, 0x22, 0x62, 0x22, 0x62,
+  0x12, 0x63, 0x12, 0x62, 0x22, 0x44, 0x2A, 0x35, 0x22, 0x20, 0x02, 0x74,
+  0x62, 0x12, 0x62, 0x12, 0x52, 0x32, 0x42, 0x32, 0x32, 0x42, 0x23, 0x42,
+  0x22, 0x52, 0x12, 0x62, 0x12, 0x64, 0x74, 0x82, 0x70, 0x02, 0x53, 0x45,
+  0x44, 0x42, 0x12, 0x44, 0x42, 0x12, 0x44, 0x32, 0x22, 0x32, 0x12, 0x32,
+  0x22, 0x32, 0x12, 0x22, 0x32, 0x22, 0x22, 0x22, 0x41, 0x22, 0x22, 0x12,
+  0x51, 0x12, 0x32, 0x12, 0x51, 0x12, 0x34, 0x63, 0x44, 0x63, 0x43, 0x72,
+  0x53, 0x60, 0x42, 0x53, 0x42, 0x43, 0x53, 0x32, 0x72, 0x22, 0x85, 0xA3,
+  0xB2, 0xB4, 0x95, 0x83, 0x22, 0x72, 0x32, 0x62, 0x43, 0x42, 0x62, 0x30,
+  0x32, 0x72, 0x32, 0x62, 0x42, 0x53, 0x42, 0x52, 0x53, 0x32, 0x72, 0x32,
+  0x72, 0x22, 0x82, 0x22, 0x82, 0x12, 0x92, 0x12, 0x94, 0xA3, 0xC2, 0xB2,
+  0xC2, 0xB2, 0x94, 0xA3, 0xB0, 0x39, 0x39, 0x93, 0x82, 0x92, 0x92, 0x92,
+  0x92, 0x92, 0x92, 0x92, 0x9A, 0x2A, 0x20, 0x53, 0x43, 0x42, 0x62, 0x62,
+  0x62, 0x52, 0x62, 0x62, 0x62, 0x52, 0x53, 0x53, 0x62, 0x62, 0x62, 0x52,
+  0x62, 0x62, 0x62, 0x62, 0x64, 0x52, 0x50, 0x42, 0x42, 0x41, 0x51, 0x51,
+  0x42, 0x42, 0x41, 0x51, 0x51, 0x42, 0x42, 0x41, 0x51, 0x42, 0x42, 0x41,
+  0x51, 0x51, 0x42, 0x42, 0x41, 0xB0, 0x52, 0x64, 0x72, 0x72, 0x72, 0x72,
+  0x72, 0x62, 0x72, 0x72, 0x73, 0x63, 0x62, 0x62, 0x72, 0x72, 0x72, 0x62,
+  0x72, 0x72, 0x72, 0x53, 0x53, 0x60, 0x23, 0x75, 0x51, 0x33, 0x31, 0x55,
+  0x73, 0x20 };
+
+const GFXglyph FreeSansOblique12pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,   7,    0,    1 },   // 0x20 ' '
+  {     0,   6,  18,   7,    3,  -17 },   // 0x21 '!'
+  {    17,   6,   6,   9,    4,  -16 },   // 0x22 '"'
+  {    27,  15,  18,  13,    1,  -17 },   // 0x23 '#'
+  {    60,  13,  21,  13,    2,  -17 },   // 0x24 '$'
+  {    99,  19,  17,  21,    3,  -16 },   // 0x25 '%'
+  {   142,  13,  17,  16,    2,  -16 },   // 0x26 '&'
+  {   173,   2,   6,   5,    4,  -16 },   // 0x27 '''
+  {   177,   8,  23,   8,    3,  -17 },   // 0x28 '('
+  {   201,   8,  23,   8,    0,  -16 },   // 0x29 ')'
+  {   225,   8,   8,   9,    4,  -17 },   // 0x2A '*'
+  {   236,  12,  11,  14,    2,  -10 },   // 0x2B '+'
+  {   247,   4,   6,   7,    1,   -1 },   // 0x2C ','
+  {   254,   6,   2,   8,    2,   -7 },   // 0x2D '-'
+  {   255,   3,   2,   7,    2,   -1 },   // 0x2E '.'
+  {   256,  10,  18,   7,    0,  -17 },   // 0x2F '/'
+  {   275,  12,  17,  13,    2,  -16 },   // 0x30 '0'
+  {   303,   7,  17,  13,    5,  -16 },   // 0x31 '1'
+  {   321,  14,  17,  13,    1,  -16 },   // 0x32 '2'
+  {   342,  12,  17,  13,    2,  -16 },   // 0x33 '3'
+  {   366,  12,  17,  13,    2,  -16 },   // 0x34 '4'
+  {   389,  13,  17,  13,    2,  -16 },   // 0x35 '5'
+  {   412,  12,  17,  13,    2,  -16 },   // 0x36 '6'
+  {   440,  13,  17,  13,    3,  -16 },   // 0x37 '7'
+  {   458,  12,  17,  13,    2,  -16 },   // 0x38 '8'
+  {   487,  12,  17,  13,    2,  -16 },   // 0x39 '9'
+  {   515,   5,  12,   7,    3,  -11 },   // 0x3A ':'
+  {   521,   6,  16,   7,    2,  -11 },   // 0x3B ';'
+  {   531,  13,  12,  14,    2,  -11 },   // 0x3C '<'
+  {   543,  13,   6,  14,    2,   -8 },   // 0x3D '='
+  {   548,  13,  12,  14,    1,  -10 },   // 0x3E '>'
+  {   560,  11,  18,  13,    4,  -17 },   // 0x3F '?'
+  {   579,  23,  21,  24,    2,  -17 },   // 0x40 '@'
+  {   636,  16,  18,  16,    0,  -17 },   // 0x41 'A'
+  {   666,  15,  18,  16,    2,  -17 },   // 0x42 'B'
+  {   697,  16,  18,  17,    2,  -17 },   // 0x43 'C'
+  {   723,  16,  18,  17,    2,  -17 },   // 0x44 'D'
+  {   756,  16,  18,  16,    2,  -17 },   // 0x45 'E'
+  {   775,  15,  18,  14,    2,  -17 },   // 0x46 'F'
+  {   794,  16,  18,  19,    3,  -17 },   // 0x47 'G'
+  {   825,  17,  18,  17,    2,  -17 },   // 0x48 'H'
+  {   860,   6,  18,   7,    2,  -17 },   // 0x49 'I'
+  {   879,  13,  18,  12,    1,  -17 },   // 0x4A 'J'
+  {   902,  18,  18,  16,    2,  -17 },   // 0x4B 'K'
+  {   939,  11,  18,  13,    2,  -17 },   // 0x4C 'L'
+  {   957,  20,  18,  20,    2,  -17 },   // 0x4D 'M'
+  {  1015,  17,  18,  18,    2,  -17 },   // 0x4E 'N'
+  {  1060,  17,  18,  18,    2,  -17 },   // 0x4F 'O'
+  {  1089,  15,  18,  15,    2,  -17 },   // 0x50 'P'
+  {  1114,  18,  19,  19,    2,  -17 },   // 0x51 'Q'
+  {  1147,  16,  18,  17,    2,  -17 },   // 0x52 'R'
+  {  1180,  15,  18,  16,    2,  -17 },   // 0x53 'S'
+  {  1206,  14,  18,  15,    4,  -17 },   // 0x54 'T'
+  {  1224,  16,  18,  17,    3,  -17 },   // 0x55 'U'
+  {  1259,  15,  18,  15,    4,  -17 },   // 0x56 'V'
+  {  1292,  22,  18,  22,    4,  -17 },   // 0x57 'W'
+  {  1351,  19,  18,  16,    0,  -17 },   // 0x58 'X'
+  {  1385,  16,  18,  16,    4,  -17 },   // 0x59 'Y'
+  {  1412,  17,  18,  15,    1,  -17 },   // 0x5A 'Z'
+  {  1431,  10,  23,   7,    0,  -17 },   // 0x5B '['
+  {  1455,   3,  18,   7,    4,  -17 },   // 0x5C '\'
+  {  1473,  10,  23,   7,   -1,  -16 },   // 0x5D ']'
+  {  1497,  10,   9,  11,    2,  -16 },   // 0x5E '^'
+  {  1513,  14,   1,  13,   -1,    4 },   // 0x5F '_'
+  {  1514,   4,   4,   8,    4,  -17 },   // 0x60 '`'
+  {  1518,  11,  13,  13,    2,  -12 },   // 0x61 'a'
+  {  1540,  13,  18,  13,    1,  -17 },   // 0x62 'b'
+  {  1570,  11,  13,  12,    2,  -12 },   // 0x63 'c'
+  {  1588,  14,  18,  13,    2,  -17 },   // 0x64 'd'
+  {  1618,  12,  13,  13,    2,  -12 },   // 0x65 'e'
+  {  1635,   8,  18,   6,    2,  -17 },   // 0x66 'f'
+  {  1654,  14,  18,  13,    1,  -12 },   // 0x67 'g'
+  {  1686,  12,  18,  13,    1,  -17 },   // 0x68 'h'
+  {  1717,   5,  18,   5,    2,  -17 },   // 0x69 'i'
+  {  1733,   9,  23,   6,   -1,  -17 },   // 0x6A 'j'
+  {  1755,  13,  18,  12,    1,  -17 },   // 0x6B 'k'
+  {  1786,   5,  18,   5,    2,  -17 },   // 0x6C 'l'
+  {  1805,  19,  13,  20,    1,  -12 },   // 0x6D 'm'
+  {  1844,  12,  13,  13,    1,  -12 },   // 0x6E 'n'
+  {  1870,  12,  13,  13,    2,  -12 },   // 0x6F 'o'
+  {  1890,  14,  18,  14,    0,  -12 },   // 0x70 'p'
+  {  1920,  13,  18,  13,    2,  -12 },   // 0x71 'q'
+  {  1950,   9,  13,   8,    1,  -12 },   // 0x72 'r'
+  {  1965,  12,  13,  12,    1,  -12 },   // 0x73 's'
+  {  1983,   7,  16,   6,    2,  -15 },   // 0x74 't'
+  {  2000,  12,  13,  13,    2,  -12 },   // 0x75 'u'
+  {  2026,  11,  13,  12,    3,  -12 },   // 0x76 'v'
+  {  2049,  17,  13,  17,    3,  -12 },   // 0x77 'w'
+  {  2090,  14,  13,  12,    0,  -12 },   // 0x78 'x'
+  {  2112,  14,  18,  11,    0,  -12 },   // 0x79 'y'
+  {  2141,  12,  13,  12,    1,  -12 },   // 0x7A 'z'
+  {  2155,   8,  23,   8,    3,  -17 },   // 0x7B '{'
+  {  2179,   6,  23,   6,    1,  -17 },   // 0x7C '|'
+  {  2202,   9,  23,   8,   -1,  -16 },   // 0x7D '}'
+  {  2226,  11,   5,  14,    3,  -10 } }; // 0x7E '~'
+
+const GFXfontPacked FreeSansOblique12pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeSansOblique12pt7bPackedRuns,
+    (GFXglyph *)FreeSansOblique12pt7bPackedGlyphs,
+    0x20, 0x7E, 29 } };
+
+// Approx. 2906 bytes
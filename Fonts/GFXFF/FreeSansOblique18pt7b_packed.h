@@ -0,0 +1,399 @@
+// FreeSansOblique18pt7b as run lengths, generated by Tools/GFX_pack from FreeSansOblique18pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeSansOblique18pt7bPackedRuns[] PROGMEM = {
+  0x63, 0x53, 0x63, 0x63, 0x63, 0x54, 0x53, 0x63, 0x63, 0x63, 0x54, 0x53,
+  0x63, 0x63, 0x62, 0x72, 0x62, 0x72, 0x72, 0x71, 0xFA, 0x36, 0x36, 0x35,
+  0x45, 0x13, 0x33, 0x13, 0x37, 0x27, 0x33, 0x13, 0x33, 0x13, 0x33, 0x12,
+  0x42, 0x22, 0x42, 0x22, 0x42, 0x20, 0xA3, 0x43, 0xB3, 0x43, 0xB2, 0x52,
+  0xB3, 0x43, 0xB2, 0x52, 0xB3, 0x43, 0xB3, 0x43, 0x6F, 0x33, 0xF2, 0x4F,
+  0x28, 0x25, 0x2B, 0x34, 0x3B, 0x25, 0x2B, 0x34, 0x3B, 0x25, 0x27, 0xF3,
+  0x3F, 0x33, 0xF2, 0x73, 0x43, 0xB2, 0x53, 0xA3, 0x43, 0xB3, 0x43, 0xB2,
+  0x52, 0xB3, 0x43, 0xB2, 0x52, 0xB0, 0xC2, 0xF0, 0x8A, 0xB8, 0xD6, 0x42,
+  0x22, 0x54, 0x43, 0x24, 0x34, 0x34, 0x24, 0x33, 0x35, 0x24, 0x33, 0x34,
+  0x3A, 0x34, 0x2B, 0x34, 0x2B, 0x43, 0x2C, 0x51, 0x2C, 0x9D, 0xAC, 0x9C,
+  0x21, 0x6B, 0x23, 0x4A, 0x25, 0x32, 0x35, 0x25, 0x32, 0x35, 0x25, 0x32,
+  0x35, 0x24, 0x33, 0x43, 0x34, 0x33, 0x52, 0x23, 0x45, 0xE7, 0xCA, 0x8E,
+  0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xC0, 0xF6, 0x36, 0x5B, 0x36, 0x7A, 0x26,
+  0x89, 0x26, 0x34, 0x37, 0x35, 0x36, 0x26, 0x36, 0x27, 0x25, 0x37, 0x27,
+  0x25, 0x28, 0x26, 0x34, 0x29, 0x34, 0x34, 0x39, 0x94, 0x3B, 0x75, 0x2D,
+  0x55, 0x2F, 0x82, 0x64, 0xD3, 0x48, 0xB2, 0x49, 0xA2, 0x44, 0x43, 0x82,
+  0x52, 0x72, 0x73, 0x42, 0x82, 0x63, 0x52, 0x82, 0x62, 0x62, 0x72, 0x62,
+  0x73, 0x44, 0x52, 0x99, 0x53, 0x98, 0x62, 0xB5, 0x50, 0xB5, 0xD8, 0xBA,
+  0x94, 0x34, 0x84, 0x53, 0x83, 0x63, 0x83, 0x63, 0x83, 0x53, 0x94, 0x33,
+  0xB3, 0x14, 0xC7, 0xD5, 0xD7, 0xB5, 0x14, 0x43, 0x24, 0x44, 0x23, 0x24,
+  0x63, 0x23, 0x23, 0x77, 0x23, 0x96, 0x23, 0xA4, 0x33, 0xA4, 0x34, 0x76,
+  0x35, 0x49, 0x3C, 0x23, 0x49, 0x44, 0x46, 0x73, 0x10, 0x13, 0x1A, 0x13,
+  0x13, 0x12, 0x22, 0x22, 0x20, 0xA2, 0x92, 0x92, 0x92, 0x93, 0x92, 0x92,
+  0x93, 0x92, 0x93, 0x92, 0x93, 0x93, 0x83, 0x93, 0x93, 0x93, 0x83, 0x93,
+  0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xA2, 0xA3, 0x93, 0xA2,
+  0xA2, 0xB2, 0x70, 0x72, 0xB2, 0xA2, 0xA3, 0x93, 0xA2, 0xA3, 0x93, 0x93,
+  0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x83, 0x93, 0x93, 0x93, 0x83,
+  0x93, 0x83, 0x93, 0x92, 0x93, 0x92, 0x92, 0x93, 0x92, 0x92, 0x92, 0x92,
+  0xA0, 0x52, 0x82, 0x41, 0x31, 0x37, 0x1D, 0x26, 0x54, 0x52, 0x12, 0x42,
+  0x23, 0x32, 0x32, 0x20, 0x93, 0xF0, 0x3E, 0x4E, 0x3F, 0x03, 0xF0, 0x37,
+  0xFF, 0xF9, 0x73, 0xF0, 0x3F, 0x03, 0xF0, 0x3E, 0x3F, 0x03, 0xF0, 0x39,
+  0x23, 0x14, 0x13, 0x41, 0x41, 0x32, 0x31, 0x22, 0x30, 0x0F, 0xC0, 0x1E,
+  0x10, 0xD2, 0xC2, 0xD2, 0xC2, 0xD2, 0xC2, 0xD2, 0xC2, 0xD2, 0xC2, 0xD2,
+  0xC2, 0xD2, 0xC2, 0xD2, 0xC2, 0xD2, 0xC2, 0xD1, 0xD2, 0xC2, 0xD2, 0xC2,
+  0xD2, 0xC2, 0xD2, 0xD0, 0x95, 0xB9, 0x7C, 0x55, 0x44, 0x54, 0x64, 0x34,
+  0x83, 0x33, 0x93, 0x23, 0xA3, 0x23, 0xA3, 0x14, 0xA3, 0x13, 0xB3, 0x13,
+  0xA4, 0x13, 0xA8, 0xA3, 0x13, 0xB3, 0x13, 0xB3, 0x13, 0xA4, 0x13, 0xA3,
+  0x23, 0x94, 0x23, 0x93, 0x34, 0x74, 0x44, 0x45, 0x5C, 0x7A, 0xA5, 0x90,
+  0x82, 0x73, 0x64, 0x45, 0x19, 0x19, 0x19, 0x64, 0x63, 0x73, 0x73, 0x73,
+  0x64, 0x63, 0x73, 0x73, 0x73, 0x64, 0x63, 0x73, 0x73, 0x73, 0x73, 0x63,
+  0x73, 0x50, 0xA6, 0xCA, 0x8D, 0x65, 0x54, 0x64, 0x74, 0x44, 0x93, 0x43,
+  0xA3, 0x43, 0xA3, 0xF2, 0x3F, 0x13, 0xF1, 0x4F, 0x04, 0xE5, 0xD6, 0xC6,
+  0xD5, 0xD5, 0xE4, 0xF0, 0x4F, 0x03, 0xF1, 0x3F, 0x23, 0xF1, 0xF2, 0x3F,
+  0x14, 0xF1, 0x40, 0x96, 0xBA, 0x8C, 0x64, 0x55, 0x53, 0x83, 0x43, 0x93,
+  0x43, 0x93, 0x33, 0xA3, 0xF0, 0x3E, 0x4A, 0x8B, 0x7C, 0x8F, 0x05, 0xF1,
+  0x3F, 0x13, 0xF1, 0x32, 0x3B, 0x32, 0x3A, 0x42, 0x3A, 0x33, 0x48, 0x43,
+  0x55, 0x55, 0xD7, 0xBA, 0x69, 0xF0, 0x3E, 0x3E, 0x4D, 0x5C, 0x6B, 0x7A,
+  0x7A, 0x41, 0x39, 0x42, 0x39, 0x33, 0x38, 0x33, 0x47, 0x34, 0x37, 0x35,
+  0x36, 0x36, 0x35, 0x37, 0x34, 0x37, 0x35, 0xFF, 0xF8, 0xB3, 0xE3, 0xF0,
+  0x3F, 0x03, 0xF0, 0x3F, 0x03, 0x50, 0x7D, 0x6E, 0x6D, 0x64, 0xF1, 0x3F,
+  0x23, 0xF1, 0x3F, 0x23, 0xF2, 0x31, 0x69, 0xD7, 0xE5, 0x56, 0x45, 0x48,
+  0x4F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x22, 0xF2, 0x33, 0x3A, 0x43,
+  0x39, 0x44, 0x56, 0x46, 0xD8, 0xBB, 0x79, 0x96, 0xBA, 0x8C, 0x65, 0x45,
+  0x44, 0x83, 0x43, 0x93, 0x33, 0xF0, 0x4F, 0x03, 0xF1, 0x33, 0x57, 0x32,
+  0x95, 0x31, 0xB4, 0x65, 0x53, 0x48, 0x42, 0x4A, 0x32, 0x4A, 0x32, 0x3B,
+  0x32, 0x3B, 0x32, 0x3A, 0x33, 0x3A, 0x33, 0x48, 0x35, 0x45, 0x46, 0xD7,
+  0xAB, 0x69, 0x2F, 0x12, 0xF1, 0x1F, 0x2E, 0x3E, 0x3E, 0x3F, 0x02, 0xF0,
+  0x3E, 0x3E, 0x3E, 0x3F, 0x03, 0xE3, 0xE3, 0xE4, 0xE3, 0xE3, 0xF0, 0x3E,
+  0x3E, 0x4E, 0x3E, 0x4E, 0x3E, 0x4E, 0x3F, 0x00, 0x96, 0xBA, 0x7D, 0x55,
+  0x55, 0x43, 0x93, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0x93, 0x43, 0x93, 0x44,
+  0x64, 0x6C, 0x89, 0x8D, 0x55, 0x54, 0x44, 0x84, 0x33, 0xA3, 0x23, 0xB3,
+  0x23, 0xB3, 0x23, 0xB3, 0x23, 0xA3, 0x34, 0x84, 0x35, 0x55, 0x5D, 0x7B,
+  0xA6, 0x90, 0x96, 0xBA, 0x7D, 0x55, 0x54, 0x53, 0x84, 0x33, 0xA3, 0x33,
+  0xA3, 0x23, 0xB3, 0x23, 0xB3, 0x23, 0xA4, 0x23, 0xA4, 0x24, 0x84, 0x35,
+  0x56, 0x4B, 0x13, 0x59, 0x14, 0x66, 0x33, 0xF1, 0x3F, 0x04, 0xF0, 0x33,
+  0x39, 0x43, 0x38, 0x44, 0x45, 0x56, 0xC8, 0xAB, 0x69, 0x43, 0x34, 0x34,
+  0x33, 0xFF, 0xFF, 0xF4, 0x33, 0x43, 0x43, 0x34, 0x53, 0x44, 0x44, 0x43,
+  0xFF, 0xFF, 0xFF, 0x93, 0x44, 0x43, 0x71, 0x71, 0x62, 0x61, 0x52, 0x60,
+  0xF3, 0x1F, 0x13, 0xD6, 0xA7, 0xA6, 0xA7, 0xA6, 0xB6, 0xC4, 0xF0, 0x6F,
+  0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x4F, 0x31, 0x30, 0x1F,
+  0x21, 0xF2, 0x1F, 0x2F, 0xFF, 0x9F, 0x21, 0xF2, 0x1F, 0x21, 0x31, 0xF3,
+  0x4F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x04, 0xC6,
+  0xB6, 0xA7, 0xA6, 0xA7, 0xA6, 0xD3, 0xF1, 0x1F, 0x30, 0x67, 0x7A, 0x5C,
+  0x34, 0x55, 0x14, 0x83, 0x13, 0x96, 0xA6, 0xA3, 0xC3, 0xC4, 0xB4, 0xB4,
+  0xB4, 0xB3, 0xC3, 0xC3, 0xC4, 0xC3, 0xD3, 0xFF, 0xFF, 0x03, 0xD3, 0xD3,
+  0xC4, 0xA0, 0xF1, 0x9F, 0x6E, 0xF2, 0xF3, 0xD7, 0x77, 0xB5, 0xD5, 0x94,
+  0xF1, 0x57, 0x4F, 0x34, 0x64, 0x75, 0x84, 0x44, 0x68, 0x13, 0x34, 0x34,
+  0x69, 0x13, 0x43, 0x33, 0x64, 0x42, 0x12, 0x53, 0x23, 0x64, 0x64, 0x53,
+  0x14, 0x54, 0x73, 0x63, 0x13, 0x54, 0x74, 0x63, 0x13, 0x53, 0x83, 0x67,
+  0x54, 0x83, 0x63, 0x13, 0x53, 0x83, 0x64, 0x13, 0x53, 0x83, 0x63, 0x23,
+  0x53, 0x73, 0x64, 0x23, 0x53, 0x64, 0x54, 0x33, 0x54, 0x45, 0x35, 0x43,
+  0x68, 0x1A, 0x54, 0x57, 0x29, 0x73, 0x65, 0x46, 0x94, 0xFF, 0x04, 0xFF,
+  0x04, 0xFF, 0x06, 0x83, 0xF2, 0xF1, 0xF3, 0xF0, 0xF6, 0x8F, 0x10, 0xF0,
+  0x4F, 0x35, 0xF3, 0x6F, 0x17, 0xF0, 0x8F, 0x03, 0x14, 0xE4, 0x23, 0xE3,
+  0x33, 0xD4, 0x33, 0xD3, 0x44, 0xB3, 0x54, 0xA4, 0x54, 0xA3, 0x64, 0x93,
+  0x83, 0x93, 0x83, 0x8F, 0x08, 0xF1, 0x6F, 0x26, 0x3A, 0x45, 0x3B, 0x44,
+  0x4C, 0x34, 0x3D, 0x33, 0x4D, 0x33, 0x3E, 0x32, 0x4E, 0x41, 0x3F, 0x04,
+  0x5D, 0x8F, 0x06, 0xF0, 0x63, 0x94, 0x44, 0xA3, 0x43, 0xB3, 0x43, 0xB3,
+  0x43, 0xB3, 0x43, 0xA3, 0x44, 0xA3, 0x43, 0x94, 0x5F, 0x06, 0xE7, 0xF1,
+  0x43, 0xB4, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC3, 0x24, 0xC3, 0x23, 0xD3,
+  0x23, 0xC3, 0x33, 0xB4, 0x33, 0xA4, 0x3F, 0x24, 0xF1, 0x5E, 0x70, 0xB6,
+  0xDB, 0xAD, 0x76, 0x55, 0x64, 0x93, 0x53, 0xB4, 0x33, 0xD3, 0x24, 0xD3,
+  0x23, 0xF3, 0x4F, 0x33, 0xF4, 0x3F, 0x43, 0xF3, 0x3F, 0x43, 0xF4, 0x3F,
+  0x43, 0xE4, 0x13, 0xE3, 0x23, 0xD4, 0x24, 0xC3, 0x43, 0xB4, 0x44, 0x94,
+  0x55, 0x65, 0x7E, 0x9B, 0xD7, 0xA0, 0x5D, 0xAF, 0x08, 0xF1, 0x73, 0x95,
+  0x54, 0xA4, 0x53, 0xC3, 0x53, 0xD3, 0x43, 0xD3, 0x34, 0xD3, 0x34, 0xD3,
+  0x33, 0xE3, 0x33, 0xE3, 0x33, 0xE3, 0x24, 0xD3, 0x34, 0xD3, 0x33, 0xE3,
+  0x33, 0xD4, 0x33, 0xD3, 0x34, 0xC4, 0x33, 0xD3, 0x43, 0xC3, 0x53, 0xB4,
+  0x53, 0x95, 0x5F, 0x26, 0xF0, 0x8D, 0xA0, 0x5F, 0x35, 0xF3, 0x5F, 0x26,
+  0x3F, 0x44, 0xF4, 0x3F, 0x53, 0xF5, 0x3F, 0x44, 0xF4, 0x4F, 0x43, 0xF5,
+  0xF2, 0x6F, 0x25, 0xF3, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x44, 0xF4,
+  0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF4, 0xF4, 0x4F, 0x35, 0xF3, 0x50, 0x5F,
+  0x25, 0xF2, 0x5F, 0x25, 0x3F, 0x34, 0xF3, 0x3F, 0x43, 0xF4, 0x3F, 0x34,
+  0xF3, 0x4F, 0x33, 0xF4, 0xF0, 0x7F, 0x06, 0xF1, 0x63, 0xF4, 0x3F, 0x43,
+  0xF4, 0x3F, 0x34, 0xF3, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF3, 0x4F, 0x33,
+  0xF4, 0x3F, 0x40, 0xC7, 0xEC, 0xAF, 0x08, 0x57, 0x56, 0x4B, 0x35, 0x4C,
+  0x43, 0x4E, 0x33, 0x3F, 0x03, 0x23, 0xF6, 0x3F, 0x53, 0xF6, 0x3F, 0x54,
+  0x9A, 0x13, 0xAA, 0x13, 0xAA, 0x13, 0xF2, 0x31, 0x3F, 0x23, 0x13, 0xF2,
+  0x31, 0x3F, 0x13, 0x24, 0xE4, 0x33, 0xD5, 0x34, 0xB6, 0x45, 0x74, 0x13,
+  0x5E, 0x22, 0x7B, 0x42, 0x97, 0x62, 0x30, 0x53, 0xD4, 0x53, 0xD4, 0x53,
+  0xD3, 0x63, 0xD3, 0x54, 0xD3, 0x53, 0xD4, 0x53, 0xD4, 0x53, 0xD3, 0x54,
+  0xD3, 0x54, 0xD3, 0x53, 0xD4, 0x5F, 0x46, 0xF4, 0x5F, 0x55, 0x3E, 0x35,
+  0x3D, 0x45, 0x3D, 0x36, 0x3D, 0x35, 0x4D, 0x35, 0x3D, 0x45, 0x3D, 0x45,
+  0x3D, 0x36, 0x3D, 0x35, 0x4D, 0x35, 0x3D, 0x45, 0x3D, 0x45, 0x53, 0x44,
+  0x44, 0x43, 0x53, 0x53, 0x53, 0x44, 0x43, 0x53, 0x53, 0x53, 0x44, 0x44,
+  0x43, 0x53, 0x53, 0x53, 0x44, 0x43, 0x53, 0x53, 0x53, 0x44, 0x44, 0x43,
+  0x50, 0xF0, 0x3F, 0x03, 0xE4, 0xE3, 0xF0, 0x3F, 0x03, 0xF0, 0x3E, 0x4E,
+  0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xE3, 0xF0, 0x3F, 0x03, 0xF0, 0x3E, 0x44,
+  0x37, 0x34, 0x38, 0x34, 0x38, 0x34, 0x37, 0x44, 0x37, 0x35, 0x44, 0x56,
+  0xB7, 0xAA, 0x69, 0x53, 0xD4, 0x53, 0xC4, 0x63, 0xA4, 0x83, 0x94, 0x84,
+  0x84, 0x93, 0x84, 0xA3, 0x74, 0xB3, 0x55, 0xB4, 0x44, 0xD4, 0x34, 0xE3,
+  0x34, 0xF0, 0x32, 0x5F, 0x03, 0x17, 0xD7, 0x23, 0xD6, 0x34, 0xC5, 0x53,
+  0xC4, 0x64, 0xB3, 0x74, 0xA4, 0x84, 0x93, 0x94, 0x93, 0xA3, 0x93, 0xA4,
+  0x83, 0xB3, 0x74, 0xB4, 0x63, 0xD3, 0x63, 0xD4, 0x50, 0x53, 0xD3, 0xD3,
+  0xD3, 0xC4, 0xC3, 0xD3, 0xD3, 0xC4, 0xC4, 0xC3, 0xD3, 0xD3, 0xC4, 0xC3,
+  0xD3, 0xD3, 0xD3, 0xC4, 0xC3, 0xD3, 0xD3, 0xD3, 0xCF, 0xFF, 0x30, 0x55,
+  0xE5, 0x55, 0xE5, 0x55, 0xD6, 0x55, 0xD6, 0x46, 0xC6, 0x53, 0x13, 0xB6,
+  0x53, 0x13, 0xA3, 0x13, 0x53, 0x13, 0xA3, 0x13, 0x53, 0x13, 0x93, 0x13,
+  0x53, 0x23, 0x93, 0x13, 0x53, 0x23, 0x83, 0x23, 0x53, 0x23, 0x82, 0x33,
+  0x53, 0x23, 0x73, 0x24, 0x44, 0x33, 0x53, 0x33, 0x53, 0x43, 0x53, 0x33,
+  0x53, 0x43, 0x43, 0x43, 0x53, 0x43, 0x43, 0x43, 0x53, 0x43, 0x33, 0x44,
+  0x44, 0x43, 0x33, 0x43, 0x53, 0x53, 0x23, 0x53, 0x53, 0x53, 0x23, 0x53,
+  0x53, 0x66, 0x63, 0x53, 0x65, 0x64, 0x43, 0x75, 0x63, 0x53, 0x74, 0x73,
+  0x53, 0x74, 0x73, 0x50, 0x54, 0xD3, 0x55, 0xC3, 0x55, 0xC3, 0x55, 0xB3,
+  0x57, 0xA3, 0x57, 0xA3, 0x53, 0x14, 0x93, 0x53, 0x14, 0x84, 0x53, 0x23,
+  0x83, 0x53, 0x34, 0x73, 0x53, 0x43, 0x73, 0x53, 0x44, 0x63, 0x53, 0x44,
+  0x54, 0x44, 0x53, 0x53, 0x53, 0x64, 0x43, 0x53, 0x73, 0x43, 0x53, 0x74,
+  0x33, 0x53, 0x74, 0x24, 0x44, 0x83, 0x23, 0x53, 0x94, 0x13, 0x53, 0xA3,
+  0x13, 0x53, 0xA7, 0x53, 0xB5, 0x53, 0xC5, 0x53, 0xC5, 0x53, 0xD4, 0x50,
+  0xB7, 0xEC, 0xBE, 0x95, 0x65, 0x74, 0xA4, 0x54, 0xC3, 0x43, 0xE4, 0x24,
+  0xF0, 0x32, 0x3F, 0x13, 0x13, 0xF2, 0x31, 0x3F, 0x23, 0x13, 0xF2, 0x6F,
+  0x36, 0xF2, 0x7F, 0x23, 0x13, 0xF2, 0x31, 0x3F, 0x23, 0x13, 0xF1, 0x32,
+  0x3F, 0x13, 0x24, 0xE3, 0x43, 0xD4, 0x44, 0xB4, 0x65, 0x66, 0x8F, 0x0A,
+  0xCE, 0x7B, 0x5E, 0x8F, 0x07, 0xF1, 0x63, 0x95, 0x44, 0xA4, 0x43, 0xC3,
+  0x43, 0xC3, 0x43, 0xC3, 0x34, 0xC3, 0x34, 0xB3, 0x43, 0xB4, 0x43, 0xA4,
+  0x5F, 0x15, 0xF1, 0x6E, 0x83, 0xF4, 0x3F, 0x43, 0xF3, 0x4F, 0x33, 0xF4,
+  0x3F, 0x43, 0xF4, 0x3F, 0x34, 0xF3, 0x3F, 0x43, 0xF4, 0xB8, 0xF0, 0xCB,
+  0xF0, 0x95, 0x75, 0x74, 0xB4, 0x54, 0xD3, 0x44, 0xE4, 0x24, 0xF1, 0x32,
+  0x3F, 0x23, 0x14, 0xF2, 0x31, 0x3F, 0x33, 0x13, 0xF3, 0x6F, 0x46, 0xF4,
+  0x6F, 0x33, 0x13, 0xF3, 0x31, 0x3F, 0x24, 0x13, 0xF2, 0x32, 0x3B, 0x14,
+  0x42, 0x49, 0x32, 0x44, 0x39, 0x85, 0x49, 0x67, 0x56, 0x69, 0xF2, 0x9C,
+  0x14, 0xA8, 0x44, 0xF7, 0x3F, 0x71, 0x50, 0x5F, 0x08, 0xF2, 0x6F, 0x26,
+  0x3B, 0x44, 0x4C, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x33, 0x4D, 0x33,
+  0x4C, 0x34, 0x3C, 0x44, 0x3B, 0x45, 0xF1, 0x6F, 0x17, 0xF2, 0x63, 0xB4,
+  0x53, 0xC3, 0x53, 0xC3, 0x44, 0xC3, 0x43, 0xD3, 0x43, 0xD2, 0x53, 0xC3,
+  0x53, 0xC3, 0x44, 0xC3, 0x43, 0xD3, 0x43, 0xD4, 0x30, 0xA8, 0xBD, 0x8F,
+  0x06, 0x57, 0x45, 0x4A, 0x44, 0x3C, 0x33, 0x3D, 0x33, 0x3D, 0x33, 0x3F,
+  0x44, 0xF3, 0x6F, 0x28, 0xF0, 0xAE, 0xBE, 0x9F, 0x26, 0xF3, 0x42, 0x3E,
+  0x32, 0x3E, 0x32, 0x3E, 0x23, 0x3D, 0x33, 0x4B, 0x35, 0x48, 0x55, 0xF1,
+  0x7D, 0xB8, 0xA0, 0x0F, 0xFF, 0xF0, 0x83, 0xF2, 0x3F, 0x14, 0xF1, 0x4F,
+  0x13, 0xF2, 0x3F, 0x23, 0xF1, 0x4F, 0x13, 0xF2, 0x3F, 0x23, 0xF2, 0x3F,
+  0x14, 0xF1, 0x3F, 0x23, 0xF2, 0x3F, 0x14, 0xF1, 0x4F, 0x13, 0xF2, 0x3F,
+  0x23, 0xF1, 0x4F, 0x14, 0xD0, 0x43, 0xD4, 0x43, 0xD4, 0x43, 0xD3, 0x53,
+  0xD3, 0x44, 0xD3, 0x43, 0xD4, 0x43, 0xD3, 0x53, 0xD3, 0x44, 0xD3, 0x44,
+  0xD3, 0x43, 0xD4, 0x43, 0xD3, 0x53, 0xD3, 0x44, 0xD3, 0x43, 0xD4, 0x43,
+  0xD4, 0x43, 0xD3, 0x44, 0xD3, 0x44, 0xD3, 0x43, 0xD4, 0x43, 0xD3, 0x54,
+  0xA5, 0x64, 0x76, 0x7F, 0x1A, 0xCE, 0x7C, 0x03, 0xF0, 0x7D, 0x8D, 0x31,
+  0x4C, 0x42, 0x3C, 0x33, 0x3B, 0x34, 0x3B, 0x34, 0x3A, 0x35, 0x39, 0x45,
+  0x48, 0x36, 0x47, 0x46, 0x47, 0x38, 0x36, 0x48, 0x36, 0x39, 0x35, 0x49,
+  0x35, 0x3A, 0x43, 0x3B, 0x43, 0x3B, 0x42, 0x3D, 0x32, 0x3D, 0x31, 0x3E,
+  0x31, 0x3E, 0x6F, 0x06, 0xF0, 0x5F, 0x14, 0xE0, 0x03, 0xB3, 0xB3, 0x13,
+  0xA4, 0xA4, 0x13, 0xA5, 0x94, 0x13, 0x96, 0x93, 0x23, 0x96, 0x84, 0x23,
+  0x87, 0x83, 0x33, 0x83, 0x13, 0x74, 0x33, 0x74, 0x13, 0x73, 0x43, 0x73,
+  0x23, 0x64, 0x43, 0x64, 0x23, 0x63, 0x53, 0x63, 0x33, 0x63, 0x53, 0x54,
+  0x33, 0x53, 0x63, 0x53, 0x43, 0x53, 0x63, 0x44, 0x43, 0x44, 0x72, 0x43,
+  0x53, 0x43, 0x82, 0x34, 0x53, 0x34, 0x82, 0x33, 0x73, 0x23, 0x92, 0x24,
+  0x73, 0x14, 0x92, 0x23, 0x83, 0x13, 0xA7, 0x83, 0x13, 0xA6, 0x96, 0xB6,
+  0x96, 0xB5, 0xA5, 0xC5, 0xA5, 0xC4, 0xB5, 0xC4, 0xB4, 0xC0, 0x64, 0xC4,
+  0x74, 0xB4, 0x94, 0xA3, 0xA4, 0x94, 0xB4, 0x74, 0xC4, 0x64, 0xE3, 0x54,
+  0xF0, 0x43, 0x4F, 0x23, 0x24, 0xF3, 0x41, 0x3F, 0x56, 0xF6, 0x5F, 0x75,
+  0xF7, 0x5F, 0x66, 0xF5, 0x8F, 0x34, 0x23, 0xF2, 0x43, 0x4F, 0x04, 0x44,
+  0xE4, 0x64, 0xD3, 0x74, 0xC4, 0x84, 0xA4, 0x94, 0x94, 0xB4, 0x74, 0xC4,
+  0x64, 0xD4, 0x60, 0x04, 0xE4, 0x23, 0xE3, 0x34, 0xC4, 0x34, 0xB4, 0x54,
+  0x94, 0x64, 0x84, 0x83, 0x83, 0x94, 0x64, 0x94, 0x54, 0xB3, 0x44, 0xC4,
+  0x24, 0xE3, 0x23, 0xF0, 0x8F, 0x07, 0xF2, 0x5F, 0x34, 0xF4, 0x4F, 0x43,
+  0xF5, 0x3F, 0x53, 0xF4, 0x4F, 0x44, 0xF4, 0x3F, 0x53, 0xF5, 0x3F, 0x44,
+  0xF0, 0x6F, 0x46, 0xF4, 0x6F, 0x3F, 0x64, 0xF5, 0x4F, 0x54, 0xF5, 0x4F,
+  0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F,
+  0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F,
+  0x6F, 0x45, 0xF5, 0x5F, 0x55, 0x76, 0x67, 0x67, 0x63, 0xA3, 0x94, 0x93,
+  0xA3, 0xA3, 0xA3, 0x94, 0x93, 0xA3, 0xA3, 0xA3, 0x93, 0xA3, 0xA3, 0xA3,
+  0xA3, 0x93, 0xA3, 0xA3, 0xA3, 0x94, 0x93, 0xA3, 0xA3, 0xA3, 0x93, 0xA7,
+  0x67, 0x67, 0x60, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x31, 0x32, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x31, 0x32,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x67, 0x67, 0x67, 0xA3, 0x93, 0xA3, 0xA3,
+  0xA3, 0x94, 0x93, 0xA3, 0xA3, 0xA3, 0x93, 0xA3, 0xA3, 0xA3, 0xA3, 0x93,
+  0xA3, 0xA3, 0xA3, 0x94, 0x93, 0xA3, 0xA3, 0xA3, 0x94, 0x93, 0xA3, 0x67,
+  0x67, 0x66, 0x70, 0x84, 0xA4, 0x95, 0x95, 0x83, 0x13, 0x63, 0x23, 0x62,
+  0x33, 0x53, 0x33, 0x43, 0x43, 0x42, 0x63, 0x23, 0x63, 0x22, 0x73, 0x13,
+  0x76, 0x83, 0x0F, 0xFC, 0x04, 0x33, 0x43, 0x42, 0x52, 0x87, 0x8C, 0x5E,
+  0x44, 0x64, 0x33, 0x93, 0xF0, 0x3F, 0x03, 0xE3, 0xC6, 0x5D, 0x39, 0x33,
+  0x25, 0x74, 0x14, 0x93, 0x23, 0xA3, 0x23, 0x94, 0x24, 0x66, 0x2C, 0x14,
+  0x29, 0x34, 0x45, 0x63, 0x10, 0x53, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x04,
+  0xF0, 0x3F, 0x13, 0xF1, 0x33, 0x58, 0x31, 0x95, 0xF0, 0x47, 0x44, 0x45,
+  0x74, 0x34, 0x93, 0x33, 0xA3, 0x24, 0xA3, 0x24, 0xA3, 0x23, 0xB3, 0x23,
+  0xA3, 0x33, 0xA3, 0x24, 0xA3, 0x24, 0x93, 0x35, 0x74, 0x36, 0x45, 0x4E,
+  0x43, 0x29, 0x53, 0x36, 0x70, 0x76, 0x89, 0x6B, 0x44, 0x54, 0x24, 0x73,
+  0x14, 0x83, 0x13, 0x93, 0x13, 0xC4, 0xC3, 0xD3, 0xD3, 0xD3, 0x93, 0x13,
+  0x83, 0x24, 0x64, 0x34, 0x44, 0x4B, 0x69, 0x95, 0x70, 0xF2, 0x3F, 0x14,
+  0xF1, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF1, 0x48, 0x53, 0x37, 0x91, 0x36,
+  0xA1, 0x35, 0x45, 0x64, 0x47, 0x54, 0x38, 0x44, 0x3A, 0x34, 0x3A, 0x33,
+  0x4A, 0x33, 0x3A, 0x43, 0x3A, 0x34, 0x3A, 0x34, 0x39, 0x44, 0x39, 0x44,
+  0x47, 0x55, 0x44, 0x66, 0xE7, 0x91, 0x38, 0x63, 0x35, 0x76, 0x9A, 0x6C,
+  0x44, 0x55, 0x24, 0x74, 0x23, 0x93, 0x13, 0xA3, 0x1F, 0x11, 0xFF, 0x6E,
+  0x3E, 0x3E, 0x39, 0x32, 0x47, 0x43, 0x45, 0x44, 0xC6, 0xA9, 0x67, 0x74,
+  0x65, 0x56, 0x53, 0x83, 0x73, 0x83, 0x58, 0x38, 0x38, 0x53, 0x83, 0x83,
+  0x83, 0x74, 0x73, 0x83, 0x83, 0x83, 0x73, 0x83, 0x83, 0x83, 0x83, 0x73,
+  0x83, 0x80, 0x86, 0x32, 0x69, 0x22, 0x5E, 0x45, 0x46, 0x34, 0x75, 0x33,
+  0x93, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x23, 0xA4, 0x23, 0xA3, 0x33,
+  0xA3, 0x33, 0x94, 0x33, 0x94, 0x34, 0x74, 0x54, 0x46, 0x5E, 0x69, 0x13,
+  0x85, 0x33, 0xF1, 0x2F, 0x13, 0xF1, 0x25, 0x38, 0x35, 0x45, 0x47, 0xC7,
+  0xAB, 0x6A, 0x53, 0xF0, 0x3F, 0x03, 0xF0, 0x3E, 0x4E, 0x3F, 0x03, 0xF0,
+  0x33, 0x66, 0x31, 0x94, 0xF0, 0x36, 0x54, 0x35, 0x73, 0x34, 0x83, 0x33,
+  0x93, 0x24, 0x93, 0x23, 0x94, 0x23, 0x93, 0x33, 0x93, 0x33, 0x93, 0x24,
+  0x93, 0x23, 0x94, 0x23, 0x93, 0x33, 0x93, 0x33, 0x93, 0x23, 0xA3, 0x23,
+  0x93, 0x30, 0x53, 0x53, 0x44, 0x43, 0xFD, 0x44, 0x35, 0x35, 0x35, 0x35,
+  0x34, 0x35, 0x35, 0x35, 0x35, 0x34, 0x44, 0x35, 0x35, 0x35, 0x34, 0x44,
+  0x35, 0x35, 0xA4, 0xA3, 0xB3, 0xB3, 0xFF, 0xF7, 0x3B, 0x3B, 0x3A, 0x3B,
+  0x3B, 0x3B, 0x3A, 0x4A, 0x3B, 0x3B, 0x3B, 0x3A, 0x3B, 0x3B, 0x3B, 0x3B,
+  0x3A, 0x3B, 0x3B, 0x3B, 0x3A, 0x4A, 0x3B, 0x38, 0x68, 0x58, 0x59, 0x53,
+  0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x04, 0xF0, 0x3F, 0x13, 0xF1, 0x37, 0x45,
+  0x36, 0x45, 0x45, 0x46, 0x35, 0x38, 0x34, 0x39, 0x32, 0x4A, 0x31, 0x4A,
+  0x9A, 0xA9, 0x52, 0x39, 0x43, 0x39, 0x35, 0x37, 0x36, 0x37, 0x36, 0x46,
+  0x37, 0x36, 0x37, 0x36, 0x37, 0x44, 0x39, 0x34, 0x39, 0x43, 0x53, 0x53,
+  0x44, 0x43, 0x53, 0x53, 0x53, 0x44, 0x43, 0x53, 0x53, 0x53, 0x53, 0x43,
+  0x53, 0x53, 0x53, 0x53, 0x44, 0x43, 0x53, 0x53, 0x53, 0x44, 0x43, 0x53,
+  0x50, 0x34, 0x25, 0x65, 0x53, 0x19, 0x28, 0x4D, 0x1A, 0x36, 0x46, 0x44,
+  0x34, 0x74, 0x63, 0x33, 0x83, 0x73, 0x24, 0x74, 0x73, 0x23, 0x83, 0x83,
+  0x23, 0x83, 0x83, 0x23, 0x83, 0x83, 0x23, 0x83, 0x73, 0x24, 0x73, 0x83,
+  0x23, 0x83, 0x83, 0x23, 0x83, 0x83, 0x23, 0x83, 0x74, 0x23, 0x83, 0x73,
+  0x33, 0x73, 0x83, 0x23, 0x83, 0x83, 0x23, 0x83, 0x83, 0x20, 0x34, 0x35,
+  0x63, 0x1A, 0x4E, 0x46, 0x54, 0x35, 0x73, 0x34, 0x83, 0x24, 0x93, 0x23,
+  0xA3, 0x23, 0x94, 0x23, 0x93, 0x33, 0x93, 0x24, 0x93, 0x23, 0xA3, 0x23,
+  0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x93, 0x23, 0xA3, 0x23, 0x93, 0x30,
+  0x76, 0x9A, 0x6C, 0x45, 0x44, 0x34, 0x74, 0x23, 0x93, 0x13, 0xA3, 0x13,
+  0xA3, 0x13, 0xA6, 0xB6, 0xA3, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0x93, 0x24,
+  0x74, 0x34, 0x45, 0x4C, 0x6A, 0x96, 0x70, 0x63, 0x35, 0xA3, 0x19, 0x7F,
+  0x06, 0x65, 0x46, 0x57, 0x45, 0x49, 0x35, 0x3A, 0x34, 0x4A, 0x34, 0x3B,
+  0x34, 0x3B, 0x34, 0x3A, 0x44, 0x3A, 0x34, 0x4A, 0x34, 0x49, 0x35, 0x48,
+  0x45, 0x64, 0x55, 0xF0, 0x63, 0x1A, 0x73, 0x36, 0x93, 0xF3, 0x3F, 0x24,
+  0xF2, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF2, 0x85, 0x34, 0x5A, 0x13, 0x5F,
+  0x04, 0x54, 0x73, 0x47, 0x63, 0x39, 0x52, 0x3A, 0x43, 0x3A, 0x43, 0x3A,
+  0x42, 0x3B, 0x42, 0x3A, 0x43, 0x3A, 0x43, 0x3A, 0x43, 0x39, 0x53, 0x47,
+  0x64, 0x44, 0x75, 0xB1, 0x36, 0x92, 0x38, 0x53, 0x4F, 0x14, 0xF1, 0x3F,
+  0x23, 0xF2, 0x3F, 0x14, 0xF1, 0x3F, 0x23, 0xF4, 0x16, 0x34, 0x24, 0x33,
+  0x25, 0x33, 0x15, 0x46, 0x75, 0x84, 0x84, 0x93, 0xA3, 0xA3, 0xA3, 0x94,
+  0x93, 0xA3, 0xA3, 0xA3, 0xA3, 0x93, 0xA3, 0xA0, 0x76, 0x8A, 0x5C, 0x34,
+  0x54, 0x24, 0x73, 0x23, 0x83, 0x23, 0xD4, 0xC7, 0xAA, 0x89, 0xB6, 0xD3,
+  0x13, 0x93, 0x13, 0x84, 0x14, 0x64, 0x3C, 0x4B, 0x77, 0x60, 0x43, 0x73,
+  0x73, 0x73, 0x49, 0x18, 0x19, 0x43, 0x73, 0x63, 0x73, 0x73, 0x73, 0x64,
+  0x63, 0x73, 0x73, 0x73, 0x64, 0x63, 0x76, 0x46, 0x54, 0x50, 0x33, 0x84,
+  0x33, 0x83, 0x43, 0x83, 0x34, 0x83, 0x33, 0x93, 0x33, 0x93, 0x33, 0x83,
+  0x43, 0x83, 0x34, 0x83, 0x33, 0x93, 0x33, 0x93, 0x33, 0x84, 0x33, 0x83,
+  0x33, 0x84, 0x33, 0x75, 0x33, 0x66, 0x3F, 0x04, 0xD6, 0x63, 0x34, 0x03,
+  0xA6, 0x97, 0x93, 0x13, 0x83, 0x33, 0x73, 0x33, 0x63, 0x43, 0x63, 0x43,
+  0x53, 0x53, 0x44, 0x53, 0x43, 0x63, 0x33, 0x73, 0x33, 0x82, 0x23, 0x93,
+  0x13, 0x96, 0xA6, 0xA5, 0xB4, 0xC4, 0xA0, 0x03, 0x83, 0x76, 0x74, 0x63,
+  0x13, 0x74, 0x63, 0x13, 0x65, 0x53, 0x23, 0x65, 0x53, 0x23, 0x53, 0x12,
+  0x43, 0x33, 0x53, 0x12, 0x43, 0x42, 0x43, 0x22, 0x33, 0x52, 0x43, 0x22,
+  0x33, 0x52, 0x33, 0x32, 0x23, 0x63, 0x23, 0x32, 0x23, 0x63, 0x13, 0x42,
+  0x22, 0x73, 0x13, 0x42, 0x13, 0x76, 0x52, 0x12, 0x86, 0x55, 0x85, 0x65,
+  0x85, 0x64, 0x94, 0x74, 0x94, 0x73, 0x90, 0x43, 0x93, 0x44, 0x73, 0x63,
+  0x63, 0x74, 0x43, 0x93, 0x33, 0xA4, 0x14, 0xB3, 0x13, 0xC6, 0xE4, 0xF0,
+  0x3F, 0x05, 0xD6, 0xC3, 0x14, 0xA4, 0x23, 0x94, 0x34, 0x83, 0x53, 0x73,
+  0x63, 0x63, 0x83, 0x43, 0x93, 0x40, 0x43, 0xA3, 0x44, 0x84, 0x53, 0x83,
+  0x63, 0x73, 0x73, 0x73, 0x73, 0x63, 0x83, 0x63, 0x83, 0x53, 0x93, 0x53,
+  0x93, 0x43, 0xB3, 0x24, 0xB3, 0x23, 0xC3, 0x13, 0xD3, 0x13, 0xD6, 0xE6,
+  0xE5, 0xF1, 0x4F, 0x13, 0xF1, 0x3F, 0x23, 0xF1, 0x3F, 0x23, 0xF1, 0x3D,
+  0x7D, 0x6E, 0x4F, 0x10, 0x5D, 0x6D, 0x5E, 0xF0, 0x3F, 0x03, 0xF0, 0x3F,
+  0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xF0, 0xE4, 0xF0, 0x4F, 0x04, 0x93, 0x75, 0x75, 0x64, 0x83, 0x93, 0x83,
+  0x93, 0x93, 0x93, 0x93, 0x83, 0x93, 0x84, 0x74, 0x65, 0x73, 0x94, 0x94,
+  0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x83, 0x93, 0x93, 0x93, 0x83, 0x95,
+  0x75, 0x84, 0x70, 0x72, 0x72, 0x62, 0x72, 0x72, 0x72, 0x72, 0x62, 0x72,
+  0x72, 0x72, 0x63, 0x62, 0x72, 0x72, 0x72, 0x62, 0x72, 0x72, 0x72, 0x72,
+  0x62, 0x72, 0x72, 0x72, 0x63, 0x62, 0x72, 0x72, 0x72, 0x62, 0x72, 0x72,
+  0x70, 0x74, 0x85, 0x75, 0x93, 0x83, 0x93, 0x93, 0x93, 0x83, 0x93, 0x93,
+  0x93, 0x93, 0x93, 0x94, 0x94, 0x93, 0x75, 0x64, 0x74, 0x83, 0x93, 0x83,
+  0x93, 0x93, 0x93, 0x93, 0x83, 0x93, 0x84, 0x65, 0x75, 0x73, 0x90, 0x33,
+  0xC6, 0x98, 0x52, 0x12, 0x34, 0x35, 0x58, 0x96, 0xB4, 0x30 };
+
+const GFXglyph FreeSansOblique18pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,  10,    0,    1 },   // 0x20 ' '
+  {     0,   9,  26,  10,    4,  -25 },   // 0x21 '!'
+  {    25,  10,   9,  12,    6,  -24 },   // 0x22 '"'
+  {    42,  21,  25,  19,    2,  -24 },   // 0x23 '#'
+  {    90,  20,  31,  19,    2,  -26 },   // 0x24 '$'
+  {   150,  26,  25,  31,    5,  -24 },   // 0x25 '%'
+  {   213,  20,  25,  23,    3,  -24 },   // 0x26 '&'
+  {   261,   4,   9,   7,    6,  -24 },   // 0x27 '''
+  {   269,  12,  33,  12,    4,  -25 },   // 0x28 '('
+  {   303,  12,  33,  12,   -1,  -24 },   // 0x29 ')'
+  {   337,  10,  10,  14,    6,  -25 },   // 0x2A '*'
+  {   352,  18,  16,  20,    3,  -15 },   // 0x2B '+'
+  {   372,   5,   8,  10,    2,   -2 },   // 0x2C ','
+  {   381,   9,   3,  12,    3,  -10 },   // 0x2D '-'
+  {   383,   4,   4,  10,    3,   -3 },   // 0x2E '.'
+  {   385,  15,  26,  10,    0,  -25 },   // 0x2F '/'
+  {   412,  18,  25,  19,    3,  -24 },   // 0x30 '0'
+  {   456,  10,  25,  19,    7,  -24 },   // 0x31 '1'
+  {   482,  20,  25,  19,    2,  -24 },   // 0x32 '2'
+  {   519,  19,  25,  19,    2,  -24 },   // 0x33 '3'
+  {   557,  18,  25,  19,    2,  -24 },   // 0x34 '4'
+  {   594,  20,  25,  19,    2,  -24 },   // 0x35 '5'
+  {   631,  19,  25,  19,    3,  -24 },   // 0x36 '6'
+  {   674,  18,  25,  19,    5,  -24 },   // 0x37 '7'
+  {   704,  19,  25,  19,    3,  -24 },   // 0x38 '8'
+  {   746,  19,  25,  19,    2,  -24 },   // 0x39 '9'
+  {   789,   7,  19,  10,    4,  -18 },   // 0x3A ':'
+  {   800,   8,  24,  10,    3,  -18 },   // 0x3B ';'
+  {   816,  19,  17,  20,    3,  -16 },   // 0x3C '<'
+  {   839,  18,   9,  20,    3,  -12 },   // 0x3D '='
+  {   850,  19,  17,  20,    2,  -15 },   // 0x3E '>'
+  {   873,  16,  26,  19,    6,  -25 },   // 0x3F '?'
+  {   902,  33,  31,  36,    3,  -25 },   // 0x40 '@'
+  {   995,  23,  26,  23,    0,  -25 },   // 0x41 'A'
+  {  1044,  21,  26,  23,    3,  -25 },   // 0x42 'B'
+  {  1091,  22,  26,  25,    4,  -25 },   // 0x43 'C'
+  {  1134,  23,  26,  25,    3,  -25 },   // 0x44 'D'
+  {  1183,  23,  26,  23,    3,  -25 },   // 0x45 'E'
+  {  1223,  22,  26,  21,    3,  -25 },   // 0x46 'F'
+  {  1263,  24,  26,  27,    4,  -25 },   // 0x47 'G'
+  {  1315,  25,  26,  25,    3,  -25 },   // 0x48 'H'
+  {  1366,   8,  26,  10,    4,  -25 },   // 0x49 'I'
+  {  1393,  18,  26,  18,    2,  -25 },   // 0x4A 'J'
+  {  1431,  25,  26,  23,    3,  -25 },   // 0x4B 'K'
+  {  1485,  16,  26,  19,    3,  -25 },   // 0x4C 'L'
+  {  1511,  29,  26,  30,    3,  -25 },   // 0x4D 'M'
+  {  1600,  25,  26,  26,    3,  -25 },   // 0x4E 'N'
+  {  1668,  24,  26,  27,    4,  -25 },   // 0x4F 'O'
+  {  1718,  22,  26,  23,    3,  -25 },   // 0x50 'P'
+  {  1761,  25,  28,  27,    4,  -25 },   // 0x51 'Q'
+  {  1819,  23,  26,  25,    3,  -25 },   // 0x52 'R'
+  {  1869,  22,  26,  23,    3,  -25 },   // 0x53 'S'
+  {  1911,  20,  26,  21,    6,  -25 },   // 0x54 'T'
+  {  1949,  24,  26,  25,    4,  -25 },   // 0x55 'U'
+  {  1999,  21,  26,  23,    6,  -25 },   // 0x56 'V'
+  {  2048,  32,  26,  33,    6,  -25 },   // 0x57 'W'
+  {  2134,  27,  26,  23,    1,  -25 },   // 0x58 'X'
+  {  2187,  23,  26,  24,    6,  -25 },   // 0x59 'Y'
+  {  2233,  25,  26,  21,    1,  -25 },   // 0x5A 'Z'
+  {  2273,  13,  33,  10,    1,  -25 },   // 0x5B '['
+  {  2307,   4,  26,  10,    5,  -25 },   // 0x5C '\'
+  {  2333,  13,  33,  10,   -1,  -24 },   // 0x5D ']'
+  {  2367,  14,  14,  16,    3,  -24 },   // 0x5E '^'
+  {  2390,  21,   2,  19,   -2,    5 },   // 0x5F '_'
+  {  2392,   6,   5,  12,    6,  -25 },   // 0x60 '`'
+  {  2397,  18,  19,  19,    2,  -18 },   // 0x61 'a'
+  {  2429,  19,  26,  20,    2,  -25 },   // 0x62 'b'
+  {  2477,  16,  19,  18,    3,  -18 },   // 0x63 'c'
+  {  2505,  20,  26,  20,    3,  -25 },   // 0x64 'd'
+  {  2553,  17,  19,  19,    3,  -18 },   // 0x65 'e'
+  {  2579,  11,  26,   9,    2,  -25 },   // 0x66 'f'
+  {  2606,  19,  27,  19,    2,  -18 },   // 0x67 'g'
+  {  2654,  18,  26,  19,    2,  -25 },   // 0x68 'h'
+  {  2702,   8,  26,   8,    2,  -25 },   // 0x69 'i'
+  {  2726,  14,  34,   8,   -2,  -25 },   // 0x6A 'j'
+  {  2759,  19,  26,  18,    2,  -25 },   // 0x6B 'k'
+  {  2806,   8,  26,   8,    2,  -25 },   // 0x6C 'l'
+  {  2833,  27,  19,  29,    2,  -18 },   // 0x6D 'm'
+  {  2890,  18,  19,  19,    2,  -18 },   // 0x6E 'n'
+  {  2928,  17,  19,  19,    3,  -18 },   // 0x6F 'o'
+  {  2959,  21,  26,  20,    0,  -18 },   // 0x70 'p'
+  {  3007,  20,  27,  19,    2,  -18 },   // 0x71 'q'
+  {  3057,  13,  19,  11,    2,  -18 },   // 0x72 'r'
+  {  3080,  16,  19,  18,    2,  -18 },   // 0x73 's'
+  {  3106,  10,  23,   9,    3,  -22 },   // 0x74 't'
+  {  3130,  18,  19,  19,    3,  -18 },   // 0x75 'u'
+  {  3167,  16,  19,  17,    4,  -18 },   // 0x76 'v'
+  {  3199,  24,  19,  25,    4,  -18 },   // 0x77 'w'
+  {  3259,  19,  19,  17,    1,  -18 },   // 0x78 'x'
+  {  3294,  20,  27,  17,    0,  -18 },   // 0x79 'y'
+  {  3340,  19,  19,  17,    1,  -18 },   // 0x7A 'z'
+  {  3365,  12,  33,  12,    3,  -25 },   // 0x7B '{'
+  {  3399,   9,  33,   9,    2,  -25 },   // 0x7C '|'
+  {  3433,  12,  33,  12,    0,  -24 },   // 0x7D '}'
+  {  3467,  16,   7,  20,    5,  -15 } }; // 0x7E '~'
+
+const GFXfontPacked FreeSansOblique18pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeSansOblique18pt7bPackedRuns,
+    (GFXglyph *)FreeSansOblique18pt7bPackedGlyphs,
+    0x20, 0x7E, 42 } };
+
+// Approx. 4150 bytes
@@ -0,0 +1,825 @@
+// FreeSansOblique18pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSansOblique18pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSansOblique18pt7bSpanData[] PROGMEM = {
+  0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x03, 0x03,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02,
+  0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x00, 0x04, 0x02, 0x01, 0x03, 0x07, 0x03, 0x02, 0x01, 0x03, 0x07, 0x03,
+  0x02, 0x00, 0x04, 0x06, 0x04, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x00,
+  0x03, 0x06, 0x03, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x00, 0x02, 0x06,
+  0x02, 0x02, 0x00, 0x02, 0x06, 0x02, 0x02, 0x00, 0x02, 0x06, 0x02, 0x02,
+  0x0A, 0x03, 0x11, 0x03, 0x02, 0x0A, 0x03, 0x11, 0x03, 0x02, 0x0A, 0x02,
+  0x11, 0x02, 0x02, 0x09, 0x03, 0x10, 0x03, 0x02, 0x09, 0x02, 0x10, 0x02,
+  0x02, 0x08, 0x03, 0x0F, 0x03, 0x02, 0x08, 0x03, 0x0F, 0x03, 0x01, 0x03,
+  0x12, 0x01, 0x03, 0x11, 0x01, 0x03, 0x11, 0x02, 0x07, 0x02, 0x0E, 0x02,
+  0x02, 0x06, 0x03, 0x0D, 0x03, 0x02, 0x06, 0x02, 0x0D, 0x02, 0x02, 0x05,
+  0x03, 0x0C, 0x03, 0x02, 0x05, 0x02, 0x0C, 0x02, 0x01, 0x00, 0x12, 0x01,
+  0x00, 0x12, 0x01, 0x00, 0x11, 0x02, 0x03, 0x03, 0x0A, 0x03, 0x02, 0x03,
+  0x02, 0x0A, 0x03, 0x02, 0x02, 0x03, 0x09, 0x03, 0x02, 0x02, 0x03, 0x09,
+  0x03, 0x02, 0x02, 0x02, 0x09, 0x02, 0x02, 0x01, 0x03, 0x08, 0x03, 0x02,
+  0x01, 0x02, 0x08, 0x02, 0x01, 0x0C, 0x02, 0x01, 0x09, 0x08, 0x01, 0x07,
+  0x0B, 0x01, 0x06, 0x0D, 0x03, 0x05, 0x04, 0x0B, 0x02, 0x0F, 0x05, 0x03,
+  0x04, 0x04, 0x0B, 0x02, 0x11, 0x03, 0x03, 0x04, 0x03, 0x0B, 0x02, 0x11,
+  0x03, 0x03, 0x03, 0x03, 0x0B, 0x02, 0x11, 0x03, 0x02, 0x03, 0x03, 0x0A,
+  0x03, 0x02, 0x03, 0x03, 0x0A, 0x02, 0x02, 0x03, 0x03, 0x0A, 0x02, 0x02,
+  0x03, 0x04, 0x0A, 0x02, 0x02, 0x04, 0x05, 0x0A, 0x02, 0x01, 0x04, 0x09,
+  0x01, 0x06, 0x0A, 0x01, 0x08, 0x09, 0x02, 0x09, 0x02, 0x0C, 0x06, 0x02,
+  0x09, 0x02, 0x0E, 0x04, 0x02, 0x08, 0x02, 0x0F, 0x03, 0x03, 0x00, 0x03,
+  0x08, 0x02, 0x0F, 0x03, 0x03, 0x00, 0x03, 0x08, 0x02, 0x0F, 0x03, 0x03,
+  0x00, 0x03, 0x08, 0x02, 0x0E, 0x03, 0x03, 0x00, 0x04, 0x07, 0x03, 0x0E,
+  0x03, 0x03, 0x00, 0x05, 0x07, 0x02, 0x0C, 0x04, 0x01, 0x01, 0x0E, 0x01,
+  0x02, 0x0C, 0x01, 0x04, 0x08, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01,
+  0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x15, 0x03, 0x02, 0x04, 0x05, 0x14,
+  0x03, 0x02, 0x03, 0x07, 0x14, 0x02, 0x02, 0x02, 0x08, 0x13, 0x02, 0x03,
+  0x01, 0x03, 0x08, 0x03, 0x12, 0x03, 0x03, 0x00, 0x03, 0x09, 0x02, 0x11,
+  0x03, 0x03, 0x00, 0x02, 0x09, 0x02, 0x10, 0x03, 0x03, 0x00, 0x02, 0x09,
+  0x02, 0x10, 0x02, 0x03, 0x00, 0x02, 0x08, 0x03, 0x0F, 0x02, 0x03, 0x00,
+  0x03, 0x07, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x09, 0x0D, 0x03, 0x02, 0x01,
+  0x07, 0x0D, 0x02, 0x02, 0x02, 0x05, 0x0C, 0x02, 0x02, 0x0B, 0x02, 0x13,
+  0x04, 0x02, 0x0A, 0x03, 0x11, 0x08, 0x02, 0x0A, 0x02, 0x10, 0x09, 0x03,
+  0x09, 0x02, 0x0F, 0x04, 0x17, 0x03, 0x03, 0x08, 0x02, 0x0F, 0x02, 0x18,
+  0x02, 0x03, 0x07, 0x03, 0x0E, 0x02, 0x18, 0x02, 0x03, 0x06, 0x03, 0x0E,
+  0x02, 0x18, 0x02, 0x03, 0x06, 0x02, 0x0E, 0x02, 0x17, 0x02, 0x03, 0x05,
+  0x02, 0x0E, 0x03, 0x15, 0x04, 0x02, 0x04, 0x02, 0x0F, 0x09, 0x02, 0x03,
+  0x03, 0x0F, 0x08, 0x02, 0x03, 0x02, 0x10, 0x05, 0x01, 0x0B, 0x05, 0x01,
+  0x09, 0x08, 0x01, 0x08, 0x0A, 0x02, 0x07, 0x04, 0x0E, 0x04, 0x02, 0x06,
+  0x04, 0x0F, 0x03, 0x02, 0x06, 0x03, 0x0F, 0x03, 0x02, 0x06, 0x03, 0x0F,
+  0x03, 0x02, 0x06, 0x03, 0x0E, 0x03, 0x02, 0x06, 0x04, 0x0D, 0x03, 0x02,
+  0x07, 0x03, 0x0B, 0x04, 0x01, 0x07, 0x07, 0x01, 0x07, 0x05, 0x01, 0x05,
+  0x07, 0x03, 0x03, 0x05, 0x09, 0x04, 0x11, 0x03, 0x03, 0x02, 0x04, 0x0A,
+  0x04, 0x10, 0x03, 0x03, 0x01, 0x04, 0x0B, 0x03, 0x10, 0x03, 0x02, 0x01,
+  0x03, 0x0B, 0x07, 0x02, 0x00, 0x03, 0x0C, 0x06, 0x02, 0x00, 0x03, 0x0D,
+  0x04, 0x02, 0x00, 0x03, 0x0D, 0x04, 0x02, 0x00, 0x04, 0x0B, 0x06, 0x02,
+  0x00, 0x05, 0x09, 0x09, 0x02, 0x01, 0x0C, 0x0F, 0x03, 0x02, 0x02, 0x09,
+  0x0F, 0x04, 0x02, 0x03, 0x06, 0x10, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x0A,
+  0x02, 0x01, 0x09, 0x02, 0x01, 0x08, 0x02, 0x01, 0x07, 0x02, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03,
+  0x02, 0x01, 0x07, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08,
+  0x03, 0x01, 0x08, 0x03, 0x01, 0x09, 0x02, 0x01, 0x09, 0x03, 0x01, 0x09,
+  0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09,
+  0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09,
+  0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x04,
+  0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x03, 0x01,
+  0x01, 0x05, 0x01, 0x09, 0x01, 0x02, 0x00, 0x06, 0x07, 0x03, 0x01, 0x00,
+  0x0A, 0x01, 0x02, 0x06, 0x01, 0x03, 0x04, 0x02, 0x02, 0x02, 0x05, 0x02,
+  0x02, 0x01, 0x02, 0x05, 0x03, 0x02, 0x01, 0x02, 0x06, 0x02, 0x01, 0x09,
+  0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x04, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x08, 0x03, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00,
+  0x12, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x01, 0x01, 0x03, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x0D, 0x02, 0x01, 0x0C,
+  0x02, 0x01, 0x0C, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x0A,
+  0x02, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02, 0x01, 0x08,
+  0x02, 0x01, 0x08, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x06,
+  0x02, 0x01, 0x06, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04,
+  0x02, 0x01, 0x04, 0x01, 0x01, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x09, 0x05, 0x01, 0x07, 0x09, 0x01, 0x05, 0x0C, 0x02, 0x04,
+  0x05, 0x0D, 0x04, 0x02, 0x04, 0x04, 0x0E, 0x04, 0x02, 0x03, 0x04, 0x0F,
+  0x03, 0x02, 0x03, 0x03, 0x0F, 0x03, 0x02, 0x02, 0x03, 0x0F, 0x03, 0x02,
+  0x02, 0x03, 0x0F, 0x03, 0x02, 0x01, 0x04, 0x0F, 0x03, 0x02, 0x01, 0x03,
+  0x0F, 0x03, 0x02, 0x01, 0x03, 0x0E, 0x04, 0x02, 0x01, 0x03, 0x0E, 0x04,
+  0x02, 0x00, 0x04, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00,
+  0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x04, 0x02, 0x00, 0x03, 0x0D,
+  0x03, 0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02,
+  0x00, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x04, 0x09, 0x05, 0x01, 0x01, 0x0C,
+  0x01, 0x02, 0x0A, 0x01, 0x04, 0x05, 0x01, 0x08, 0x02, 0x01, 0x07, 0x03,
+  0x01, 0x06, 0x04, 0x01, 0x04, 0x05, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09,
+  0x01, 0x00, 0x09, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03,
+  0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x0A, 0x06,
+  0x01, 0x08, 0x0A, 0x01, 0x06, 0x0D, 0x02, 0x05, 0x05, 0x0F, 0x04, 0x02,
+  0x05, 0x04, 0x10, 0x04, 0x02, 0x04, 0x04, 0x11, 0x03, 0x02, 0x04, 0x03,
+  0x11, 0x03, 0x02, 0x04, 0x03, 0x11, 0x03, 0x01, 0x11, 0x03, 0x01, 0x10,
+  0x03, 0x01, 0x0F, 0x04, 0x01, 0x0E, 0x04, 0x01, 0x0C, 0x05, 0x01, 0x0A,
+  0x06, 0x01, 0x08, 0x06, 0x01, 0x07, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x00, 0x11, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x09,
+  0x06, 0x01, 0x07, 0x0A, 0x01, 0x06, 0x0C, 0x02, 0x05, 0x04, 0x0E, 0x05,
+  0x02, 0x05, 0x03, 0x10, 0x03, 0x02, 0x04, 0x03, 0x10, 0x03, 0x02, 0x04,
+  0x03, 0x10, 0x03, 0x02, 0x03, 0x03, 0x10, 0x03, 0x01, 0x0F, 0x03, 0x01,
+  0x0D, 0x04, 0x01, 0x08, 0x08, 0x01, 0x08, 0x07, 0x01, 0x08, 0x08, 0x01,
+  0x0C, 0x05, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x02,
+  0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x04, 0x02, 0x00, 0x03,
+  0x0D, 0x03, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x05, 0x0A, 0x05,
+  0x01, 0x01, 0x0D, 0x01, 0x02, 0x0B, 0x01, 0x04, 0x06, 0x01, 0x0F, 0x03,
+  0x01, 0x0E, 0x03, 0x01, 0x0D, 0x04, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x06,
+  0x01, 0x0A, 0x07, 0x01, 0x09, 0x07, 0x02, 0x08, 0x04, 0x0D, 0x03, 0x02,
+  0x07, 0x04, 0x0D, 0x03, 0x02, 0x07, 0x03, 0x0D, 0x03, 0x02, 0x06, 0x03,
+  0x0C, 0x04, 0x02, 0x05, 0x03, 0x0C, 0x03, 0x02, 0x04, 0x03, 0x0C, 0x03,
+  0x02, 0x03, 0x03, 0x0C, 0x03, 0x02, 0x02, 0x03, 0x0C, 0x03, 0x02, 0x01,
+  0x03, 0x0B, 0x03, 0x01, 0x01, 0x11, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12,
+  0x01, 0x0B, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x07, 0x0D, 0x01, 0x06, 0x0E,
+  0x01, 0x06, 0x0D, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x02, 0x04, 0x03, 0x08, 0x06, 0x01,
+  0x03, 0x0D, 0x01, 0x03, 0x0E, 0x02, 0x02, 0x05, 0x0D, 0x04, 0x02, 0x02,
+  0x04, 0x0E, 0x04, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x03,
+  0x01, 0x0F, 0x03, 0x01, 0x0F, 0x02, 0x01, 0x0E, 0x03, 0x02, 0x00, 0x03,
+  0x0D, 0x04, 0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x00, 0x05, 0x0B, 0x04,
+  0x01, 0x01, 0x0D, 0x01, 0x02, 0x0B, 0x01, 0x04, 0x07, 0x01, 0x09, 0x06,
+  0x01, 0x07, 0x0A, 0x01, 0x06, 0x0C, 0x02, 0x05, 0x05, 0x0E, 0x05, 0x02,
+  0x04, 0x04, 0x10, 0x03, 0x02, 0x04, 0x03, 0x10, 0x03, 0x01, 0x03, 0x03,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x02, 0x02, 0x03, 0x08, 0x05, 0x02,
+  0x01, 0x03, 0x06, 0x09, 0x02, 0x01, 0x03, 0x05, 0x0B, 0x02, 0x01, 0x06,
+  0x0C, 0x05, 0x02, 0x01, 0x04, 0x0D, 0x04, 0x02, 0x00, 0x04, 0x0E, 0x03,
+  0x02, 0x00, 0x04, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00,
+  0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D,
+  0x03, 0x02, 0x00, 0x04, 0x0C, 0x03, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x01,
+  0x01, 0x0D, 0x01, 0x02, 0x0A, 0x01, 0x04, 0x06, 0x01, 0x02, 0x10, 0x01,
+  0x02, 0x10, 0x01, 0x01, 0x11, 0x01, 0x0E, 0x03, 0x01, 0x0D, 0x03, 0x01,
+  0x0C, 0x03, 0x01, 0x0C, 0x02, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x03, 0x01,
+  0x09, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03, 0x01,
+  0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01,
+  0x04, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01,
+  0x09, 0x06, 0x01, 0x07, 0x0A, 0x01, 0x05, 0x0D, 0x02, 0x04, 0x05, 0x0E,
+  0x05, 0x02, 0x04, 0x03, 0x10, 0x03, 0x02, 0x03, 0x03, 0x10, 0x03, 0x02,
+  0x03, 0x03, 0x10, 0x03, 0x02, 0x03, 0x03, 0x0F, 0x03, 0x02, 0x03, 0x03,
+  0x0F, 0x03, 0x02, 0x03, 0x04, 0x0D, 0x04, 0x01, 0x04, 0x0C, 0x01, 0x05,
+  0x09, 0x01, 0x03, 0x0D, 0x02, 0x02, 0x05, 0x0C, 0x04, 0x02, 0x01, 0x04,
+  0x0D, 0x04, 0x02, 0x01, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03,
+  0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00,
+  0x03, 0x0D, 0x03, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x05, 0x0A,
+  0x05, 0x01, 0x01, 0x0D, 0x01, 0x02, 0x0B, 0x01, 0x04, 0x06, 0x01, 0x09,
+  0x06, 0x01, 0x07, 0x0A, 0x01, 0x05, 0x0D, 0x02, 0x04, 0x05, 0x0E, 0x04,
+  0x02, 0x04, 0x03, 0x0F, 0x04, 0x02, 0x03, 0x03, 0x10, 0x03, 0x02, 0x03,
+  0x03, 0x10, 0x03, 0x02, 0x02, 0x03, 0x10, 0x03, 0x02, 0x02, 0x03, 0x10,
+  0x03, 0x02, 0x02, 0x03, 0x0F, 0x04, 0x02, 0x02, 0x03, 0x0F, 0x04, 0x02,
+  0x02, 0x04, 0x0E, 0x04, 0x02, 0x02, 0x05, 0x0C, 0x06, 0x02, 0x03, 0x0B,
+  0x0F, 0x03, 0x02, 0x04, 0x09, 0x0E, 0x04, 0x02, 0x05, 0x06, 0x0E, 0x03,
+  0x01, 0x0E, 0x03, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x03, 0x02, 0x00, 0x03,
+  0x0C, 0x04, 0x02, 0x00, 0x03, 0x0B, 0x04, 0x02, 0x00, 0x04, 0x09, 0x05,
+  0x01, 0x01, 0x0C, 0x01, 0x02, 0x0A, 0x01, 0x04, 0x06, 0x01, 0x04, 0x03,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x05, 0x03, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x02, 0x01, 0x12, 0x01, 0x01,
+  0x10, 0x03, 0x01, 0x0D, 0x06, 0x01, 0x0A, 0x07, 0x01, 0x08, 0x06, 0x01,
+  0x05, 0x07, 0x01, 0x03, 0x06, 0x01, 0x01, 0x06, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x06, 0x01, 0x02, 0x06, 0x01, 0x04, 0x06, 0x01, 0x06, 0x06, 0x01,
+  0x08, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x0C, 0x04, 0x01, 0x0F, 0x01, 0x01,
+  0x01, 0x11, 0x01, 0x01, 0x11, 0x01, 0x01, 0x11, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x06, 0x01, 0x05, 0x06, 0x01, 0x07, 0x06, 0x01,
+  0x09, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x0D, 0x06, 0x01, 0x0F, 0x04, 0x01,
+  0x0C, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x07, 0x07, 0x01, 0x05, 0x06, 0x01,
+  0x02, 0x07, 0x01, 0x00, 0x06, 0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x01,
+  0x06, 0x07, 0x01, 0x04, 0x0A, 0x01, 0x03, 0x0C, 0x02, 0x02, 0x04, 0x0B,
+  0x05, 0x02, 0x01, 0x04, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02,
+  0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x01, 0x0C, 0x03,
+  0x01, 0x0B, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08, 0x04,
+  0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x10, 0x09,
+  0x01, 0x0D, 0x0E, 0x01, 0x0B, 0x12, 0x02, 0x09, 0x07, 0x17, 0x07, 0x02,
+  0x08, 0x05, 0x1A, 0x05, 0x02, 0x07, 0x04, 0x1B, 0x05, 0x02, 0x06, 0x04,
+  0x1C, 0x04, 0x03, 0x05, 0x04, 0x10, 0x05, 0x1D, 0x04, 0x04, 0x04, 0x04,
+  0x0E, 0x08, 0x17, 0x03, 0x1D, 0x04, 0x04, 0x03, 0x04, 0x0D, 0x09, 0x17,
+  0x03, 0x1E, 0x03, 0x05, 0x03, 0x03, 0x0C, 0x04, 0x14, 0x02, 0x17, 0x02,
+  0x1E, 0x03, 0x04, 0x02, 0x03, 0x0B, 0x04, 0x15, 0x04, 0x1E, 0x03, 0x04,
+  0x01, 0x04, 0x0A, 0x04, 0x15, 0x03, 0x1E, 0x03, 0x04, 0x01, 0x03, 0x09,
+  0x04, 0x14, 0x04, 0x1E, 0x03, 0x04, 0x01, 0x03, 0x09, 0x03, 0x14, 0x03,
+  0x1D, 0x04, 0x04, 0x00, 0x03, 0x08, 0x04, 0x14, 0x03, 0x1D, 0x03, 0x04,
+  0x00, 0x03, 0x08, 0x03, 0x13, 0x03, 0x1C, 0x04, 0x04, 0x00, 0x03, 0x08,
+  0x03, 0x13, 0x03, 0x1C, 0x03, 0x04, 0x00, 0x03, 0x08, 0x03, 0x12, 0x03,
+  0x1B, 0x04, 0x04, 0x00, 0x03, 0x08, 0x03, 0x11, 0x04, 0x1A, 0x04, 0x04,
+  0x00, 0x03, 0x08, 0x04, 0x10, 0x05, 0x18, 0x05, 0x03, 0x00, 0x03, 0x09,
+  0x08, 0x12, 0x0A, 0x03, 0x00, 0x04, 0x09, 0x07, 0x12, 0x09, 0x03, 0x01,
+  0x03, 0x0A, 0x05, 0x13, 0x06, 0x01, 0x01, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x03, 0x04, 0x02, 0x04, 0x06, 0x12, 0x03, 0x01, 0x05, 0x10, 0x01, 0x06,
+  0x0F, 0x01, 0x09, 0x08, 0x01, 0x0F, 0x04, 0x01, 0x0E, 0x05, 0x01, 0x0E,
+  0x06, 0x01, 0x0D, 0x07, 0x01, 0x0C, 0x08, 0x02, 0x0C, 0x03, 0x10, 0x04,
+  0x02, 0x0B, 0x04, 0x11, 0x03, 0x02, 0x0B, 0x03, 0x11, 0x03, 0x02, 0x0A,
+  0x04, 0x11, 0x03, 0x02, 0x0A, 0x03, 0x11, 0x04, 0x02, 0x09, 0x03, 0x11,
+  0x04, 0x02, 0x08, 0x04, 0x11, 0x04, 0x02, 0x08, 0x03, 0x11, 0x04, 0x02,
+  0x07, 0x03, 0x12, 0x03, 0x02, 0x07, 0x03, 0x12, 0x03, 0x01, 0x06, 0x0F,
+  0x01, 0x06, 0x10, 0x01, 0x05, 0x11, 0x02, 0x05, 0x03, 0x12, 0x04, 0x02,
+  0x04, 0x03, 0x12, 0x04, 0x02, 0x03, 0x04, 0x13, 0x03, 0x02, 0x03, 0x03,
+  0x13, 0x03, 0x02, 0x02, 0x04, 0x13, 0x03, 0x02, 0x02, 0x03, 0x13, 0x03,
+  0x02, 0x01, 0x04, 0x13, 0x04, 0x02, 0x01, 0x03, 0x13, 0x04, 0x01, 0x05,
+  0x0D, 0x01, 0x05, 0x0F, 0x01, 0x05, 0x0F, 0x02, 0x05, 0x03, 0x11, 0x04,
+  0x02, 0x04, 0x04, 0x12, 0x03, 0x02, 0x04, 0x03, 0x12, 0x03, 0x02, 0x04,
+  0x03, 0x12, 0x03, 0x02, 0x04, 0x03, 0x12, 0x03, 0x02, 0x04, 0x03, 0x11,
+  0x03, 0x02, 0x03, 0x04, 0x11, 0x03, 0x02, 0x03, 0x03, 0x0F, 0x04, 0x01,
+  0x03, 0x0F, 0x01, 0x03, 0x0E, 0x01, 0x03, 0x10, 0x02, 0x02, 0x03, 0x10,
+  0x04, 0x02, 0x02, 0x03, 0x11, 0x03, 0x02, 0x02, 0x03, 0x11, 0x03, 0x02,
+  0x02, 0x03, 0x11, 0x03, 0x02, 0x01, 0x04, 0x11, 0x03, 0x02, 0x01, 0x03,
+  0x11, 0x03, 0x02, 0x01, 0x03, 0x10, 0x03, 0x02, 0x01, 0x03, 0x0F, 0x04,
+  0x02, 0x01, 0x03, 0x0E, 0x04, 0x01, 0x00, 0x11, 0x01, 0x00, 0x10, 0x01,
+  0x00, 0x0E, 0x01, 0x0B, 0x06, 0x01, 0x08, 0x0B, 0x01, 0x07, 0x0D, 0x02,
+  0x05, 0x06, 0x10, 0x05, 0x02, 0x05, 0x04, 0x12, 0x03, 0x02, 0x04, 0x03,
+  0x12, 0x04, 0x02, 0x03, 0x03, 0x13, 0x03, 0x02, 0x02, 0x04, 0x13, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x02, 0x00, 0x03, 0x11, 0x04, 0x02, 0x00, 0x03, 0x11, 0x03, 0x02, 0x00,
+  0x03, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x03, 0x02, 0x01, 0x03, 0x0F,
+  0x04, 0x02, 0x01, 0x04, 0x0E, 0x04, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x01,
+  0x02, 0x0E, 0x01, 0x03, 0x0B, 0x01, 0x05, 0x07, 0x01, 0x05, 0x0D, 0x01,
+  0x05, 0x0F, 0x01, 0x05, 0x10, 0x02, 0x05, 0x03, 0x11, 0x05, 0x02, 0x04,
+  0x04, 0x12, 0x04, 0x02, 0x04, 0x03, 0x13, 0x03, 0x02, 0x04, 0x03, 0x14,
+  0x03, 0x02, 0x04, 0x03, 0x14, 0x03, 0x02, 0x03, 0x04, 0x14, 0x03, 0x02,
+  0x03, 0x04, 0x14, 0x03, 0x02, 0x03, 0x03, 0x14, 0x03, 0x02, 0x03, 0x03,
+  0x14, 0x03, 0x02, 0x03, 0x03, 0x14, 0x03, 0x02, 0x02, 0x04, 0x13, 0x03,
+  0x02, 0x02, 0x04, 0x13, 0x03, 0x02, 0x02, 0x03, 0x13, 0x03, 0x02, 0x02,
+  0x03, 0x12, 0x04, 0x02, 0x02, 0x03, 0x12, 0x03, 0x02, 0x01, 0x04, 0x11,
+  0x04, 0x02, 0x01, 0x03, 0x11, 0x03, 0x02, 0x01, 0x03, 0x10, 0x03, 0x02,
+  0x01, 0x03, 0x0F, 0x04, 0x02, 0x01, 0x03, 0x0D, 0x05, 0x01, 0x00, 0x11,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0D, 0x01, 0x05, 0x12, 0x01, 0x05, 0x12,
+  0x01, 0x05, 0x11, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x11, 0x01, 0x03, 0x11, 0x01, 0x02, 0x12,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x00, 0x13, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12,
+  0x01, 0x05, 0x11, 0x01, 0x05, 0x11, 0x01, 0x05, 0x11, 0x01, 0x05, 0x03,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x0F,
+  0x01, 0x03, 0x0F, 0x01, 0x02, 0x10, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0C, 0x07, 0x01, 0x09, 0x0C,
+  0x01, 0x07, 0x0F, 0x02, 0x06, 0x05, 0x12, 0x05, 0x02, 0x05, 0x04, 0x14,
+  0x03, 0x02, 0x04, 0x04, 0x14, 0x04, 0x02, 0x03, 0x04, 0x15, 0x03, 0x02,
+  0x03, 0x03, 0x15, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x02, 0x00, 0x04, 0x0D, 0x0A, 0x02, 0x00, 0x03,
+  0x0D, 0x0A, 0x02, 0x00, 0x03, 0x0D, 0x0A, 0x02, 0x00, 0x03, 0x14, 0x03,
+  0x02, 0x00, 0x03, 0x14, 0x03, 0x02, 0x00, 0x03, 0x14, 0x03, 0x02, 0x00,
+  0x03, 0x13, 0x03, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x01, 0x03, 0x11,
+  0x05, 0x02, 0x01, 0x04, 0x10, 0x06, 0x03, 0x02, 0x05, 0x0E, 0x04, 0x13,
+  0x03, 0x02, 0x03, 0x0E, 0x13, 0x02, 0x02, 0x04, 0x0B, 0x13, 0x02, 0x02,
+  0x06, 0x07, 0x13, 0x02, 0x02, 0x05, 0x03, 0x15, 0x04, 0x02, 0x05, 0x03,
+  0x15, 0x04, 0x02, 0x05, 0x03, 0x15, 0x03, 0x02, 0x05, 0x03, 0x15, 0x03,
+  0x02, 0x04, 0x04, 0x15, 0x03, 0x02, 0x04, 0x03, 0x14, 0x04, 0x02, 0x04,
+  0x03, 0x14, 0x04, 0x02, 0x04, 0x03, 0x14, 0x03, 0x02, 0x03, 0x04, 0x14,
+  0x03, 0x02, 0x03, 0x04, 0x14, 0x03, 0x02, 0x03, 0x03, 0x13, 0x04, 0x01,
+  0x03, 0x13, 0x01, 0x03, 0x13, 0x01, 0x02, 0x14, 0x02, 0x02, 0x03, 0x13,
+  0x03, 0x02, 0x02, 0x03, 0x12, 0x04, 0x02, 0x02, 0x03, 0x12, 0x03, 0x02,
+  0x02, 0x03, 0x12, 0x03, 0x02, 0x01, 0x04, 0x12, 0x03, 0x02, 0x01, 0x03,
+  0x11, 0x04, 0x02, 0x01, 0x03, 0x11, 0x04, 0x02, 0x01, 0x03, 0x11, 0x03,
+  0x02, 0x01, 0x03, 0x11, 0x03, 0x02, 0x00, 0x04, 0x11, 0x03, 0x02, 0x00,
+  0x03, 0x10, 0x04, 0x02, 0x00, 0x03, 0x10, 0x04, 0x01, 0x05, 0x03, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+  0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
+  0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x03, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x03, 0x01, 0x0E, 0x04, 0x01,
+  0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01,
+  0x0D, 0x04, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01,
+  0x0D, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01,
+  0x0C, 0x03, 0x01, 0x0B, 0x04, 0x02, 0x01, 0x03, 0x0B, 0x03, 0x02, 0x00,
+  0x03, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0A,
+  0x04, 0x02, 0x00, 0x03, 0x0A, 0x03, 0x02, 0x00, 0x04, 0x08, 0x05, 0x01,
+  0x01, 0x0B, 0x01, 0x01, 0x0A, 0x01, 0x03, 0x06, 0x02, 0x05, 0x03, 0x15,
+  0x04, 0x02, 0x05, 0x03, 0x14, 0x04, 0x02, 0x05, 0x03, 0x12, 0x04, 0x02,
+  0x05, 0x03, 0x11, 0x04, 0x02, 0x04, 0x04, 0x10, 0x04, 0x02, 0x04, 0x03,
+  0x0F, 0x04, 0x02, 0x04, 0x03, 0x0E, 0x04, 0x02, 0x04, 0x03, 0x0C, 0x05,
+  0x02, 0x03, 0x04, 0x0B, 0x04, 0x02, 0x03, 0x04, 0x0A, 0x04, 0x02, 0x03,
+  0x03, 0x09, 0x04, 0x02, 0x03, 0x03, 0x08, 0x05, 0x02, 0x03, 0x03, 0x07,
+  0x07, 0x02, 0x02, 0x07, 0x0B, 0x03, 0x02, 0x02, 0x06, 0x0B, 0x04, 0x02,
+  0x02, 0x05, 0x0C, 0x03, 0x02, 0x02, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x03,
+  0x0C, 0x04, 0x02, 0x01, 0x04, 0x0D, 0x04, 0x02, 0x01, 0x03, 0x0D, 0x04,
+  0x02, 0x01, 0x03, 0x0E, 0x03, 0x02, 0x01, 0x03, 0x0E, 0x04, 0x02, 0x01,
+  0x03, 0x0F, 0x03, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x03, 0x10,
+  0x03, 0x02, 0x00, 0x03, 0x10, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10,
+  0x02, 0x05, 0x05, 0x18, 0x05, 0x02, 0x05, 0x05, 0x18, 0x05, 0x02, 0x05,
+  0x05, 0x17, 0x06, 0x02, 0x05, 0x05, 0x17, 0x06, 0x02, 0x04, 0x06, 0x16,
+  0x06, 0x03, 0x04, 0x03, 0x08, 0x03, 0x16, 0x06, 0x04, 0x04, 0x03, 0x08,
+  0x03, 0x15, 0x03, 0x19, 0x03, 0x04, 0x04, 0x03, 0x08, 0x03, 0x15, 0x03,
+  0x19, 0x03, 0x04, 0x04, 0x03, 0x08, 0x03, 0x14, 0x03, 0x18, 0x03, 0x04,
+  0x03, 0x03, 0x08, 0x03, 0x14, 0x03, 0x18, 0x03, 0x04, 0x03, 0x03, 0x08,
+  0x03, 0x13, 0x03, 0x18, 0x03, 0x04, 0x03, 0x03, 0x08, 0x03, 0x13, 0x02,
+  0x18, 0x03, 0x04, 0x03, 0x03, 0x08, 0x03, 0x12, 0x03, 0x17, 0x04, 0x04,
+  0x02, 0x04, 0x09, 0x03, 0x11, 0x03, 0x17, 0x03, 0x04, 0x02, 0x03, 0x09,
+  0x03, 0x11, 0x03, 0x17, 0x03, 0x04, 0x02, 0x03, 0x09, 0x03, 0x10, 0x03,
+  0x17, 0x03, 0x04, 0x02, 0x03, 0x09, 0x03, 0x10, 0x03, 0x17, 0x03, 0x04,
+  0x02, 0x03, 0x09, 0x03, 0x0F, 0x03, 0x16, 0x04, 0x04, 0x01, 0x04, 0x09,
+  0x03, 0x0F, 0x03, 0x16, 0x03, 0x04, 0x01, 0x03, 0x09, 0x03, 0x0E, 0x03,
+  0x16, 0x03, 0x04, 0x01, 0x03, 0x09, 0x03, 0x0E, 0x03, 0x16, 0x03, 0x03,
+  0x01, 0x03, 0x0A, 0x06, 0x16, 0x03, 0x03, 0x01, 0x03, 0x0A, 0x05, 0x15,
+  0x04, 0x03, 0x00, 0x03, 0x0A, 0x05, 0x15, 0x03, 0x03, 0x00, 0x03, 0x0A,
+  0x04, 0x15, 0x03, 0x03, 0x00, 0x03, 0x0A, 0x04, 0x15, 0x03, 0x02, 0x05,
+  0x04, 0x16, 0x03, 0x02, 0x05, 0x05, 0x16, 0x03, 0x02, 0x05, 0x05, 0x16,
+  0x03, 0x02, 0x05, 0x05, 0x15, 0x03, 0x02, 0x04, 0x07, 0x15, 0x03, 0x02,
+  0x04, 0x07, 0x15, 0x03, 0x03, 0x04, 0x03, 0x08, 0x04, 0x15, 0x03, 0x03,
+  0x04, 0x03, 0x08, 0x04, 0x14, 0x04, 0x03, 0x04, 0x03, 0x09, 0x03, 0x14,
+  0x03, 0x03, 0x03, 0x03, 0x09, 0x04, 0x14, 0x03, 0x03, 0x03, 0x03, 0x0A,
+  0x03, 0x14, 0x03, 0x03, 0x03, 0x03, 0x0A, 0x04, 0x14, 0x03, 0x03, 0x03,
+  0x03, 0x0A, 0x04, 0x13, 0x04, 0x03, 0x02, 0x04, 0x0B, 0x03, 0x13, 0x03,
+  0x03, 0x02, 0x03, 0x0B, 0x04, 0x13, 0x03, 0x03, 0x02, 0x03, 0x0C, 0x03,
+  0x13, 0x03, 0x03, 0x02, 0x03, 0x0C, 0x04, 0x13, 0x03, 0x03, 0x02, 0x03,
+  0x0C, 0x04, 0x12, 0x04, 0x03, 0x01, 0x04, 0x0D, 0x03, 0x12, 0x03, 0x03,
+  0x01, 0x03, 0x0D, 0x04, 0x12, 0x03, 0x03, 0x01, 0x03, 0x0E, 0x03, 0x12,
+  0x03, 0x02, 0x01, 0x03, 0x0E, 0x07, 0x02, 0x01, 0x03, 0x0F, 0x05, 0x02,
+  0x00, 0x03, 0x0F, 0x05, 0x02, 0x00, 0x03, 0x0F, 0x05, 0x02, 0x00, 0x03,
+  0x10, 0x04, 0x01, 0x0B, 0x07, 0x01, 0x08, 0x0C, 0x01, 0x07, 0x0E, 0x02,
+  0x06, 0x05, 0x11, 0x05, 0x02, 0x05, 0x04, 0x13, 0x04, 0x02, 0x04, 0x04,
+  0x14, 0x03, 0x02, 0x03, 0x03, 0x14, 0x04, 0x02, 0x02, 0x04, 0x15, 0x03,
+  0x02, 0x02, 0x03, 0x15, 0x03, 0x02, 0x01, 0x03, 0x15, 0x03, 0x02, 0x01,
+  0x03, 0x15, 0x03, 0x02, 0x01, 0x03, 0x15, 0x03, 0x02, 0x00, 0x03, 0x15,
+  0x03, 0x02, 0x00, 0x03, 0x14, 0x04, 0x02, 0x00, 0x03, 0x14, 0x03, 0x02,
+  0x00, 0x03, 0x14, 0x03, 0x02, 0x00, 0x03, 0x14, 0x03, 0x02, 0x00, 0x03,
+  0x13, 0x03, 0x02, 0x00, 0x03, 0x13, 0x03, 0x02, 0x00, 0x04, 0x12, 0x03,
+  0x02, 0x01, 0x03, 0x11, 0x04, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x02,
+  0x05, 0x0D, 0x06, 0x01, 0x03, 0x0F, 0x01, 0x04, 0x0C, 0x01, 0x06, 0x07,
+  0x01, 0x05, 0x0E, 0x01, 0x05, 0x0F, 0x01, 0x05, 0x10, 0x02, 0x05, 0x03,
+  0x11, 0x05, 0x02, 0x04, 0x04, 0x12, 0x04, 0x02, 0x04, 0x03, 0x13, 0x03,
+  0x02, 0x04, 0x03, 0x13, 0x03, 0x02, 0x04, 0x03, 0x13, 0x03, 0x02, 0x03,
+  0x04, 0x13, 0x03, 0x02, 0x03, 0x04, 0x12, 0x03, 0x02, 0x03, 0x03, 0x11,
+  0x04, 0x02, 0x03, 0x03, 0x10, 0x04, 0x01, 0x03, 0x10, 0x01, 0x02, 0x10,
+  0x01, 0x02, 0x0E, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x0B, 0x08, 0x01, 0x09, 0x0C, 0x01, 0x07, 0x0F, 0x02, 0x06, 0x05,
+  0x12, 0x05, 0x02, 0x05, 0x04, 0x14, 0x04, 0x02, 0x04, 0x04, 0x15, 0x03,
+  0x02, 0x03, 0x04, 0x15, 0x04, 0x02, 0x02, 0x04, 0x16, 0x03, 0x02, 0x02,
+  0x03, 0x16, 0x03, 0x02, 0x01, 0x04, 0x16, 0x03, 0x02, 0x01, 0x03, 0x16,
+  0x03, 0x02, 0x01, 0x03, 0x16, 0x03, 0x02, 0x00, 0x03, 0x16, 0x03, 0x02,
+  0x00, 0x03, 0x16, 0x03, 0x02, 0x00, 0x03, 0x15, 0x03, 0x02, 0x00, 0x03,
+  0x15, 0x03, 0x02, 0x00, 0x03, 0x14, 0x04, 0x02, 0x00, 0x03, 0x14, 0x03,
+  0x03, 0x00, 0x03, 0x0E, 0x01, 0x13, 0x04, 0x03, 0x00, 0x04, 0x0D, 0x03,
+  0x12, 0x04, 0x02, 0x01, 0x03, 0x0D, 0x08, 0x02, 0x01, 0x04, 0x0E, 0x06,
+  0x02, 0x02, 0x05, 0x0D, 0x06, 0x01, 0x03, 0x11, 0x02, 0x04, 0x0C, 0x11,
+  0x04, 0x02, 0x06, 0x08, 0x12, 0x04, 0x01, 0x13, 0x03, 0x01, 0x13, 0x01,
+  0x01, 0x05, 0x0F, 0x01, 0x05, 0x11, 0x01, 0x05, 0x11, 0x02, 0x05, 0x03,
+  0x13, 0x04, 0x02, 0x04, 0x04, 0x14, 0x03, 0x02, 0x04, 0x03, 0x14, 0x03,
+  0x02, 0x04, 0x03, 0x14, 0x03, 0x02, 0x04, 0x03, 0x14, 0x03, 0x02, 0x03,
+  0x04, 0x14, 0x03, 0x02, 0x03, 0x04, 0x13, 0x03, 0x02, 0x03, 0x03, 0x12,
+  0x04, 0x02, 0x03, 0x03, 0x11, 0x04, 0x01, 0x03, 0x10, 0x01, 0x02, 0x10,
+  0x01, 0x02, 0x11, 0x02, 0x02, 0x03, 0x10, 0x04, 0x02, 0x02, 0x03, 0x11,
+  0x03, 0x02, 0x02, 0x03, 0x11, 0x03, 0x02, 0x01, 0x04, 0x11, 0x03, 0x02,
+  0x01, 0x03, 0x11, 0x03, 0x02, 0x01, 0x03, 0x11, 0x02, 0x02, 0x01, 0x03,
+  0x10, 0x03, 0x02, 0x01, 0x03, 0x10, 0x03, 0x02, 0x00, 0x04, 0x10, 0x03,
+  0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03, 0x10, 0x04, 0x01, 0x0A,
+  0x08, 0x01, 0x07, 0x0D, 0x01, 0x06, 0x0F, 0x02, 0x05, 0x05, 0x11, 0x04,
+  0x02, 0x04, 0x04, 0x12, 0x04, 0x02, 0x04, 0x03, 0x13, 0x03, 0x02, 0x03,
+  0x03, 0x13, 0x03, 0x02, 0x03, 0x03, 0x13, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x06, 0x01, 0x04, 0x08, 0x01, 0x05, 0x0A, 0x01,
+  0x07, 0x0B, 0x01, 0x0A, 0x09, 0x01, 0x0E, 0x06, 0x01, 0x10, 0x04, 0x02,
+  0x00, 0x03, 0x11, 0x03, 0x02, 0x00, 0x03, 0x11, 0x03, 0x02, 0x00, 0x03,
+  0x11, 0x02, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x04, 0x0F, 0x03,
+  0x02, 0x01, 0x04, 0x0D, 0x05, 0x01, 0x01, 0x10, 0x01, 0x02, 0x0D, 0x01,
+  0x04, 0x08, 0x01, 0x00, 0x14, 0x01, 0x00, 0x14, 0x01, 0x00, 0x14, 0x01,
+  0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01,
+  0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+  0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x02, 0x04, 0x03, 0x14,
+  0x04, 0x02, 0x04, 0x03, 0x14, 0x04, 0x02, 0x04, 0x03, 0x14, 0x03, 0x02,
+  0x04, 0x03, 0x14, 0x03, 0x02, 0x03, 0x04, 0x14, 0x03, 0x02, 0x03, 0x03,
+  0x13, 0x04, 0x02, 0x03, 0x03, 0x13, 0x03, 0x02, 0x03, 0x03, 0x13, 0x03,
+  0x02, 0x02, 0x04, 0x13, 0x03, 0x02, 0x02, 0x04, 0x13, 0x03, 0x02, 0x02,
+  0x03, 0x12, 0x04, 0x02, 0x02, 0x03, 0x12, 0x03, 0x02, 0x02, 0x03, 0x12,
+  0x03, 0x02, 0x01, 0x04, 0x12, 0x03, 0x02, 0x01, 0x03, 0x11, 0x04, 0x02,
+  0x01, 0x03, 0x11, 0x04, 0x02, 0x01, 0x03, 0x11, 0x03, 0x02, 0x00, 0x04,
+  0x11, 0x03, 0x02, 0x00, 0x04, 0x11, 0x03, 0x02, 0x00, 0x03, 0x10, 0x04,
+  0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x04, 0x0E, 0x05, 0x02, 0x01,
+  0x04, 0x0C, 0x06, 0x01, 0x01, 0x10, 0x01, 0x03, 0x0C, 0x01, 0x05, 0x07,
+  0x02, 0x00, 0x03, 0x12, 0x03, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x00,
+  0x04, 0x11, 0x03, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x01, 0x03, 0x10,
+  0x03, 0x02, 0x01, 0x03, 0x0F, 0x03, 0x02, 0x01, 0x03, 0x0F, 0x03, 0x02,
+  0x01, 0x03, 0x0E, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x04, 0x02, 0x01, 0x04,
+  0x0D, 0x03, 0x02, 0x01, 0x04, 0x0C, 0x04, 0x02, 0x01, 0x04, 0x0C, 0x03,
+  0x02, 0x02, 0x03, 0x0B, 0x04, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02,
+  0x03, 0x0A, 0x04, 0x02, 0x02, 0x03, 0x0A, 0x03, 0x02, 0x02, 0x04, 0x09,
+  0x03, 0x02, 0x02, 0x04, 0x09, 0x03, 0x02, 0x02, 0x04, 0x08, 0x03, 0x02,
+  0x03, 0x03, 0x08, 0x03, 0x02, 0x03, 0x03, 0x07, 0x03, 0x02, 0x03, 0x03,
+  0x07, 0x03, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01,
+  0x03, 0x04, 0x03, 0x00, 0x03, 0x0E, 0x03, 0x1C, 0x03, 0x03, 0x00, 0x03,
+  0x0D, 0x04, 0x1B, 0x04, 0x03, 0x00, 0x03, 0x0D, 0x05, 0x1B, 0x04, 0x03,
+  0x00, 0x03, 0x0C, 0x06, 0x1B, 0x03, 0x03, 0x00, 0x03, 0x0C, 0x06, 0x1A,
+  0x04, 0x03, 0x00, 0x03, 0x0B, 0x07, 0x1A, 0x03, 0x04, 0x00, 0x03, 0x0B,
+  0x03, 0x0F, 0x03, 0x19, 0x04, 0x04, 0x00, 0x03, 0x0A, 0x04, 0x0F, 0x03,
+  0x19, 0x03, 0x04, 0x00, 0x03, 0x0A, 0x03, 0x0F, 0x03, 0x18, 0x04, 0x04,
+  0x00, 0x03, 0x09, 0x04, 0x0F, 0x03, 0x18, 0x03, 0x04, 0x00, 0x03, 0x09,
+  0x03, 0x0F, 0x03, 0x18, 0x03, 0x04, 0x00, 0x03, 0x08, 0x04, 0x0F, 0x03,
+  0x17, 0x03, 0x04, 0x00, 0x03, 0x08, 0x03, 0x0F, 0x03, 0x17, 0x03, 0x04,
+  0x00, 0x03, 0x07, 0x04, 0x0F, 0x03, 0x16, 0x04, 0x04, 0x01, 0x02, 0x07,
+  0x03, 0x0F, 0x03, 0x16, 0x03, 0x04, 0x01, 0x02, 0x06, 0x04, 0x0F, 0x03,
+  0x15, 0x04, 0x04, 0x01, 0x02, 0x06, 0x03, 0x10, 0x03, 0x15, 0x03, 0x04,
+  0x01, 0x02, 0x05, 0x04, 0x10, 0x03, 0x14, 0x04, 0x04, 0x01, 0x02, 0x05,
+  0x03, 0x10, 0x03, 0x14, 0x03, 0x03, 0x01, 0x07, 0x10, 0x03, 0x14, 0x03,
+  0x02, 0x01, 0x06, 0x10, 0x06, 0x02, 0x01, 0x06, 0x10, 0x06, 0x02, 0x01,
+  0x05, 0x10, 0x05, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x01, 0x04, 0x10,
+  0x05, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x06, 0x04, 0x16, 0x04, 0x02,
+  0x06, 0x04, 0x15, 0x04, 0x02, 0x07, 0x04, 0x15, 0x03, 0x02, 0x07, 0x04,
+  0x14, 0x04, 0x02, 0x08, 0x04, 0x13, 0x04, 0x02, 0x08, 0x04, 0x12, 0x04,
+  0x02, 0x09, 0x03, 0x11, 0x04, 0x02, 0x09, 0x04, 0x10, 0x04, 0x02, 0x0A,
+  0x03, 0x0F, 0x04, 0x02, 0x0A, 0x04, 0x0F, 0x03, 0x01, 0x0B, 0x06, 0x01,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x06, 0x01,
+  0x09, 0x08, 0x02, 0x08, 0x04, 0x0E, 0x03, 0x02, 0x07, 0x04, 0x0E, 0x04,
+  0x02, 0x06, 0x04, 0x0E, 0x04, 0x02, 0x05, 0x04, 0x0F, 0x04, 0x02, 0x05,
+  0x03, 0x0F, 0x04, 0x02, 0x04, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10,
+  0x04, 0x02, 0x02, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02,
+  0x00, 0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x01, 0x03,
+  0x12, 0x03, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x10, 0x04,
+  0x02, 0x02, 0x04, 0x0F, 0x04, 0x02, 0x02, 0x04, 0x0E, 0x04, 0x02, 0x03,
+  0x03, 0x0E, 0x03, 0x02, 0x03, 0x04, 0x0D, 0x04, 0x02, 0x03, 0x04, 0x0C,
+  0x04, 0x02, 0x04, 0x03, 0x0B, 0x04, 0x02, 0x04, 0x04, 0x0A, 0x04, 0x02,
+  0x05, 0x03, 0x0A, 0x03, 0x01, 0x05, 0x08, 0x01, 0x05, 0x07, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x06,
+  0x13, 0x01, 0x06, 0x13, 0x01, 0x06, 0x12, 0x01, 0x14, 0x04, 0x01, 0x13,
+  0x04, 0x01, 0x12, 0x04, 0x01, 0x11, 0x04, 0x01, 0x10, 0x04, 0x01, 0x0F,
+  0x04, 0x01, 0x0E, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07,
+  0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x13, 0x01, 0x00,
+  0x14, 0x01, 0x00, 0x14, 0x01, 0x07, 0x06, 0x01, 0x06, 0x07, 0x01, 0x06,
+  0x07, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
+  0x02, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x0A,
+  0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09,
+  0x03, 0x01, 0x08, 0x04, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07,
+  0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x06, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07,
+  0x05, 0x01, 0x07, 0x05, 0x02, 0x06, 0x03, 0x0A, 0x03, 0x02, 0x05, 0x03,
+  0x0A, 0x03, 0x02, 0x05, 0x02, 0x0A, 0x03, 0x02, 0x04, 0x03, 0x0A, 0x03,
+  0x02, 0x03, 0x03, 0x0A, 0x03, 0x02, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x02,
+  0x03, 0x0B, 0x03, 0x02, 0x02, 0x02, 0x0B, 0x03, 0x02, 0x01, 0x03, 0x0B,
+  0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15,
+  0x01, 0x00, 0x04, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x03, 0x02,
+  0x01, 0x04, 0x02, 0x01, 0x08, 0x07, 0x01, 0x05, 0x0C, 0x01, 0x04, 0x0E,
+  0x02, 0x04, 0x04, 0x0E, 0x04, 0x02, 0x03, 0x03, 0x0F, 0x03, 0x01, 0x0F,
+  0x03, 0x01, 0x0F, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0B, 0x06, 0x01, 0x04,
+  0x0D, 0x02, 0x02, 0x09, 0x0E, 0x03, 0x02, 0x01, 0x05, 0x0D, 0x04, 0x02,
+  0x00, 0x04, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03,
+  0x0C, 0x04, 0x02, 0x00, 0x04, 0x0A, 0x06, 0x02, 0x00, 0x0C, 0x0D, 0x04,
+  0x02, 0x01, 0x09, 0x0D, 0x04, 0x02, 0x03, 0x05, 0x0E, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x02, 0x04, 0x03, 0x0A, 0x05,
+  0x02, 0x04, 0x03, 0x08, 0x09, 0x01, 0x03, 0x0F, 0x02, 0x03, 0x07, 0x0E,
+  0x04, 0x02, 0x03, 0x05, 0x0F, 0x04, 0x02, 0x03, 0x04, 0x10, 0x03, 0x02,
+  0x03, 0x03, 0x10, 0x03, 0x02, 0x02, 0x04, 0x10, 0x03, 0x02, 0x02, 0x04,
+  0x10, 0x03, 0x02, 0x02, 0x03, 0x10, 0x03, 0x02, 0x02, 0x03, 0x0F, 0x03,
+  0x02, 0x02, 0x03, 0x0F, 0x03, 0x02, 0x01, 0x04, 0x0F, 0x03, 0x02, 0x01,
+  0x04, 0x0E, 0x03, 0x02, 0x01, 0x05, 0x0D, 0x04, 0x02, 0x01, 0x06, 0x0B,
+  0x05, 0x01, 0x01, 0x0E, 0x02, 0x00, 0x03, 0x05, 0x09, 0x02, 0x00, 0x03,
+  0x06, 0x06, 0x01, 0x07, 0x06, 0x01, 0x05, 0x09, 0x01, 0x04, 0x0B, 0x02,
+  0x03, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x04, 0x0D, 0x03, 0x02, 0x01, 0x04,
+  0x0D, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00,
+  0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x04, 0x0A,
+  0x04, 0x02, 0x01, 0x04, 0x09, 0x04, 0x01, 0x01, 0x0B, 0x01, 0x02, 0x09,
+  0x01, 0x04, 0x05, 0x01, 0x11, 0x03, 0x01, 0x10, 0x04, 0x01, 0x10, 0x03,
+  0x01, 0x10, 0x03, 0x01, 0x10, 0x03, 0x01, 0x10, 0x03, 0x01, 0x0F, 0x04,
+  0x02, 0x07, 0x05, 0x0F, 0x03, 0x02, 0x05, 0x09, 0x0F, 0x03, 0x02, 0x04,
+  0x0A, 0x0F, 0x03, 0x02, 0x03, 0x04, 0x0C, 0x06, 0x02, 0x02, 0x04, 0x0D,
+  0x05, 0x02, 0x02, 0x03, 0x0D, 0x04, 0x02, 0x01, 0x03, 0x0E, 0x03, 0x02,
+  0x01, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x04, 0x0E, 0x03, 0x02, 0x00, 0x03,
+  0x0D, 0x04, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03,
+  0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x00,
+  0x04, 0x0B, 0x05, 0x02, 0x01, 0x04, 0x09, 0x06, 0x01, 0x01, 0x0E, 0x02,
+  0x02, 0x09, 0x0C, 0x03, 0x02, 0x03, 0x06, 0x0C, 0x03, 0x01, 0x07, 0x06,
+  0x01, 0x05, 0x0A, 0x01, 0x04, 0x0C, 0x02, 0x03, 0x04, 0x0C, 0x05, 0x02,
+  0x02, 0x04, 0x0D, 0x04, 0x02, 0x02, 0x03, 0x0E, 0x03, 0x02, 0x01, 0x03,
+  0x0E, 0x03, 0x01, 0x01, 0x10, 0x01, 0x01, 0x10, 0x01, 0x00, 0x11, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x03, 0x0C,
+  0x03, 0x02, 0x00, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x01,
+  0x01, 0x0C, 0x01, 0x02, 0x0A, 0x01, 0x04, 0x06, 0x01, 0x07, 0x04, 0x01,
+  0x06, 0x05, 0x01, 0x05, 0x06, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01,
+  0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x01,
+  0x01, 0x08, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
+  0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x02, 0x08, 0x06, 0x11, 0x02, 0x02, 0x06, 0x09, 0x11, 0x02,
+  0x01, 0x05, 0x0E, 0x02, 0x04, 0x05, 0x0D, 0x06, 0x02, 0x03, 0x04, 0x0E,
+  0x05, 0x02, 0x03, 0x03, 0x0F, 0x03, 0x02, 0x02, 0x03, 0x0F, 0x03, 0x02,
+  0x02, 0x03, 0x0F, 0x03, 0x02, 0x02, 0x03, 0x0F, 0x03, 0x02, 0x01, 0x03,
+  0x0E, 0x04, 0x02, 0x01, 0x03, 0x0E, 0x03, 0x02, 0x01, 0x03, 0x0E, 0x03,
+  0x02, 0x01, 0x03, 0x0D, 0x04, 0x02, 0x01, 0x03, 0x0D, 0x04, 0x02, 0x01,
+  0x04, 0x0C, 0x04, 0x02, 0x02, 0x04, 0x0A, 0x06, 0x01, 0x02, 0x0E, 0x02,
+  0x03, 0x09, 0x0D, 0x03, 0x02, 0x05, 0x05, 0x0D, 0x03, 0x01, 0x0D, 0x02,
+  0x01, 0x0C, 0x03, 0x01, 0x0C, 0x02, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02,
+  0x00, 0x04, 0x09, 0x04, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x0A, 0x01, 0x03,
+  0x06, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x02, 0x04,
+  0x03, 0x0A, 0x06, 0x02, 0x04, 0x03, 0x08, 0x09, 0x01, 0x03, 0x0F, 0x02,
+  0x03, 0x06, 0x0E, 0x04, 0x02, 0x03, 0x05, 0x0F, 0x03, 0x02, 0x03, 0x04,
+  0x0F, 0x03, 0x02, 0x03, 0x03, 0x0F, 0x03, 0x02, 0x02, 0x04, 0x0F, 0x03,
+  0x02, 0x02, 0x03, 0x0E, 0x04, 0x02, 0x02, 0x03, 0x0E, 0x03, 0x02, 0x02,
+  0x03, 0x0E, 0x03, 0x02, 0x02, 0x03, 0x0E, 0x03, 0x02, 0x01, 0x04, 0x0E,
+  0x03, 0x02, 0x01, 0x03, 0x0D, 0x04, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02,
+  0x01, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03,
+  0x0D, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x00, 0x00, 0x00, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0A, 0x04, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x00, 0x00, 0x00, 0x01, 0x09,
+  0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x04, 0x01, 0x07,
+  0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x01,
+  0x06, 0x01, 0x01, 0x05, 0x01, 0x00, 0x05, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x02, 0x04, 0x03, 0x0E, 0x04, 0x02, 0x04, 0x03,
+  0x0D, 0x04, 0x02, 0x03, 0x04, 0x0C, 0x04, 0x02, 0x03, 0x03, 0x0B, 0x03,
+  0x02, 0x03, 0x03, 0x0A, 0x03, 0x02, 0x03, 0x03, 0x08, 0x04, 0x02, 0x03,
+  0x03, 0x07, 0x04, 0x01, 0x02, 0x09, 0x01, 0x02, 0x0A, 0x02, 0x02, 0x05,
+  0x09, 0x03, 0x02, 0x02, 0x04, 0x09, 0x03, 0x02, 0x02, 0x03, 0x0A, 0x03,
+  0x02, 0x01, 0x03, 0x0A, 0x03, 0x02, 0x01, 0x03, 0x0A, 0x04, 0x02, 0x01,
+  0x03, 0x0B, 0x03, 0x02, 0x01, 0x03, 0x0B, 0x03, 0x02, 0x01, 0x03, 0x0B,
+  0x04, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x04, 0x01,
+  0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01,
+  0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
+  0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x03, 0x03, 0x04, 0x09, 0x05, 0x14, 0x05,
+  0x03, 0x03, 0x03, 0x07, 0x09, 0x12, 0x08, 0x02, 0x03, 0x0D, 0x11, 0x0A,
+  0x03, 0x03, 0x06, 0x0D, 0x06, 0x17, 0x04, 0x03, 0x03, 0x04, 0x0E, 0x04,
+  0x18, 0x03, 0x03, 0x03, 0x03, 0x0E, 0x03, 0x18, 0x03, 0x03, 0x02, 0x04,
+  0x0D, 0x04, 0x18, 0x03, 0x03, 0x02, 0x03, 0x0D, 0x03, 0x18, 0x03, 0x03,
+  0x02, 0x03, 0x0D, 0x03, 0x18, 0x03, 0x03, 0x02, 0x03, 0x0D, 0x03, 0x18,
+  0x03, 0x03, 0x02, 0x03, 0x0D, 0x03, 0x17, 0x03, 0x03, 0x01, 0x04, 0x0C,
+  0x03, 0x17, 0x03, 0x03, 0x01, 0x03, 0x0C, 0x03, 0x17, 0x03, 0x03, 0x01,
+  0x03, 0x0C, 0x03, 0x17, 0x03, 0x03, 0x01, 0x03, 0x0C, 0x03, 0x16, 0x04,
+  0x03, 0x01, 0x03, 0x0C, 0x03, 0x16, 0x03, 0x03, 0x01, 0x03, 0x0B, 0x03,
+  0x16, 0x03, 0x03, 0x00, 0x03, 0x0B, 0x03, 0x16, 0x03, 0x03, 0x00, 0x03,
+  0x0B, 0x03, 0x16, 0x03, 0x02, 0x03, 0x04, 0x0A, 0x05, 0x02, 0x03, 0x03,
+  0x07, 0x0A, 0x01, 0x03, 0x0E, 0x02, 0x03, 0x06, 0x0E, 0x04, 0x02, 0x03,
+  0x05, 0x0F, 0x03, 0x02, 0x03, 0x04, 0x0F, 0x03, 0x02, 0x02, 0x04, 0x0F,
+  0x03, 0x02, 0x02, 0x03, 0x0F, 0x03, 0x02, 0x02, 0x03, 0x0E, 0x04, 0x02,
+  0x02, 0x03, 0x0E, 0x03, 0x02, 0x02, 0x03, 0x0E, 0x03, 0x02, 0x01, 0x04,
+  0x0E, 0x03, 0x02, 0x01, 0x03, 0x0E, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03,
+  0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x01,
+  0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0C,
+  0x03, 0x01, 0x07, 0x06, 0x01, 0x05, 0x0A, 0x01, 0x04, 0x0C, 0x02, 0x03,
+  0x05, 0x0C, 0x04, 0x02, 0x02, 0x04, 0x0D, 0x04, 0x02, 0x02, 0x03, 0x0E,
+  0x03, 0x02, 0x01, 0x03, 0x0E, 0x03, 0x02, 0x01, 0x03, 0x0E, 0x03, 0x02,
+  0x01, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03,
+  0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03,
+  0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x04, 0x0B, 0x04, 0x02, 0x01,
+  0x04, 0x09, 0x05, 0x01, 0x01, 0x0C, 0x01, 0x02, 0x0A, 0x01, 0x04, 0x06,
+  0x02, 0x06, 0x03, 0x0C, 0x05, 0x02, 0x06, 0x03, 0x0A, 0x09, 0x01, 0x05,
+  0x0F, 0x02, 0x05, 0x06, 0x10, 0x04, 0x02, 0x05, 0x05, 0x11, 0x04, 0x02,
+  0x05, 0x04, 0x12, 0x03, 0x02, 0x05, 0x03, 0x12, 0x03, 0x02, 0x04, 0x04,
+  0x12, 0x03, 0x02, 0x04, 0x03, 0x12, 0x03, 0x02, 0x04, 0x03, 0x12, 0x03,
+  0x02, 0x04, 0x03, 0x11, 0x04, 0x02, 0x04, 0x03, 0x11, 0x03, 0x02, 0x03,
+  0x04, 0x11, 0x03, 0x02, 0x03, 0x04, 0x10, 0x03, 0x02, 0x03, 0x04, 0x0F,
+  0x04, 0x02, 0x03, 0x06, 0x0D, 0x05, 0x01, 0x02, 0x0F, 0x02, 0x02, 0x03,
+  0x06, 0x0A, 0x02, 0x02, 0x03, 0x08, 0x06, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x02, 0x08, 0x05, 0x10, 0x04, 0x02, 0x05, 0x0A,
+  0x10, 0x03, 0x01, 0x04, 0x0F, 0x02, 0x03, 0x05, 0x0C, 0x07, 0x02, 0x02,
+  0x04, 0x0D, 0x06, 0x02, 0x02, 0x03, 0x0E, 0x05, 0x02, 0x01, 0x03, 0x0E,
+  0x04, 0x02, 0x01, 0x03, 0x0E, 0x04, 0x02, 0x01, 0x03, 0x0E, 0x04, 0x02,
+  0x00, 0x03, 0x0E, 0x04, 0x02, 0x00, 0x03, 0x0D, 0x04, 0x02, 0x00, 0x03,
+  0x0D, 0x04, 0x02, 0x00, 0x03, 0x0D, 0x04, 0x02, 0x00, 0x03, 0x0C, 0x05,
+  0x02, 0x00, 0x04, 0x0B, 0x06, 0x02, 0x01, 0x04, 0x09, 0x07, 0x02, 0x01,
+  0x0B, 0x0D, 0x03, 0x02, 0x02, 0x09, 0x0D, 0x03, 0x02, 0x04, 0x05, 0x0C,
+  0x04, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0C,
+  0x03, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0D,
+  0x01, 0x02, 0x03, 0x04, 0x09, 0x04, 0x02, 0x03, 0x03, 0x08, 0x05, 0x02,
+  0x03, 0x03, 0x07, 0x05, 0x01, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x07, 0x06, 0x01, 0x05, 0x0A, 0x01, 0x04,
+  0x0C, 0x02, 0x03, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x04, 0x0D, 0x03, 0x02,
+  0x02, 0x03, 0x0D, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x07, 0x01, 0x03, 0x0A, 0x01, 0x05, 0x09, 0x01, 0x09, 0x06, 0x01, 0x0C,
+  0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x04, 0x02,
+  0x00, 0x04, 0x0A, 0x04, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x0B, 0x01, 0x03,
+  0x07, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x01, 0x09, 0x01, 0x01, 0x08, 0x01, 0x00, 0x09, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x04, 0x02, 0x03,
+  0x03, 0x0E, 0x04, 0x02, 0x03, 0x03, 0x0E, 0x03, 0x02, 0x03, 0x03, 0x0E,
+  0x03, 0x02, 0x02, 0x04, 0x0E, 0x03, 0x02, 0x02, 0x03, 0x0E, 0x03, 0x02,
+  0x02, 0x03, 0x0E, 0x03, 0x02, 0x02, 0x03, 0x0D, 0x03, 0x02, 0x02, 0x03,
+  0x0D, 0x03, 0x02, 0x01, 0x04, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03,
+  0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x0C, 0x04, 0x02, 0x01,
+  0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x04, 0x02, 0x00, 0x03, 0x0A,
+  0x05, 0x02, 0x00, 0x03, 0x09, 0x06, 0x01, 0x00, 0x0F, 0x01, 0x01, 0x0D,
+  0x02, 0x02, 0x06, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00,
+  0x03, 0x0C, 0x04, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0B,
+  0x03, 0x02, 0x01, 0x03, 0x0B, 0x03, 0x02, 0x01, 0x03, 0x0A, 0x03, 0x02,
+  0x01, 0x03, 0x0A, 0x03, 0x02, 0x01, 0x03, 0x09, 0x03, 0x02, 0x01, 0x03,
+  0x08, 0x04, 0x02, 0x01, 0x03, 0x08, 0x03, 0x02, 0x01, 0x03, 0x07, 0x03,
+  0x02, 0x01, 0x03, 0x07, 0x03, 0x02, 0x02, 0x02, 0x06, 0x03, 0x02, 0x02,
+  0x03, 0x06, 0x03, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x03, 0x00, 0x03, 0x0B, 0x03, 0x15,
+  0x03, 0x03, 0x00, 0x03, 0x0A, 0x04, 0x14, 0x03, 0x03, 0x00, 0x03, 0x0A,
+  0x04, 0x14, 0x03, 0x03, 0x00, 0x03, 0x09, 0x05, 0x13, 0x03, 0x03, 0x00,
+  0x03, 0x09, 0x05, 0x13, 0x03, 0x04, 0x00, 0x03, 0x08, 0x03, 0x0C, 0x02,
+  0x12, 0x03, 0x04, 0x00, 0x03, 0x08, 0x03, 0x0C, 0x02, 0x12, 0x03, 0x04,
+  0x01, 0x02, 0x07, 0x03, 0x0C, 0x02, 0x11, 0x03, 0x04, 0x01, 0x02, 0x07,
+  0x03, 0x0C, 0x02, 0x11, 0x03, 0x04, 0x01, 0x02, 0x06, 0x03, 0x0C, 0x02,
+  0x10, 0x03, 0x04, 0x01, 0x03, 0x06, 0x03, 0x0C, 0x02, 0x10, 0x03, 0x04,
+  0x01, 0x03, 0x05, 0x03, 0x0C, 0x02, 0x10, 0x02, 0x04, 0x01, 0x03, 0x05,
+  0x03, 0x0C, 0x02, 0x0F, 0x03, 0x03, 0x01, 0x06, 0x0C, 0x02, 0x0F, 0x02,
+  0x02, 0x01, 0x06, 0x0C, 0x05, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x01,
+  0x05, 0x0C, 0x04, 0x02, 0x01, 0x04, 0x0C, 0x04, 0x02, 0x01, 0x04, 0x0C,
+  0x03, 0x02, 0x04, 0x03, 0x10, 0x03, 0x02, 0x04, 0x04, 0x0F, 0x03, 0x02,
+  0x05, 0x03, 0x0E, 0x03, 0x02, 0x05, 0x04, 0x0D, 0x03, 0x02, 0x06, 0x03,
+  0x0C, 0x03, 0x02, 0x06, 0x04, 0x0B, 0x04, 0x02, 0x07, 0x03, 0x0B, 0x03,
+  0x01, 0x07, 0x06, 0x01, 0x08, 0x04, 0x01, 0x08, 0x03, 0x01, 0x07, 0x05,
+  0x01, 0x06, 0x06, 0x02, 0x05, 0x03, 0x09, 0x04, 0x02, 0x04, 0x04, 0x0A,
+  0x03, 0x02, 0x03, 0x04, 0x0A, 0x04, 0x02, 0x03, 0x03, 0x0B, 0x03, 0x02,
+  0x02, 0x03, 0x0B, 0x03, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03,
+  0x0C, 0x03, 0x02, 0x04, 0x03, 0x11, 0x03, 0x02, 0x04, 0x04, 0x10, 0x04,
+  0x02, 0x05, 0x03, 0x10, 0x03, 0x02, 0x05, 0x03, 0x0F, 0x03, 0x02, 0x05,
+  0x03, 0x0F, 0x03, 0x02, 0x05, 0x03, 0x0E, 0x03, 0x02, 0x05, 0x03, 0x0E,
+  0x03, 0x02, 0x05, 0x03, 0x0D, 0x03, 0x02, 0x05, 0x03, 0x0D, 0x03, 0x02,
+  0x05, 0x03, 0x0C, 0x03, 0x02, 0x06, 0x03, 0x0B, 0x04, 0x02, 0x06, 0x03,
+  0x0B, 0x03, 0x02, 0x06, 0x03, 0x0A, 0x03, 0x02, 0x06, 0x03, 0x0A, 0x03,
+  0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06, 0x05, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01, 0x00, 0x07, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x04, 0x01, 0x05, 0x0D, 0x01, 0x05, 0x0D, 0x01, 0x04, 0x0E,
+  0x01, 0x0E, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x0E, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F,
+  0x01, 0x09, 0x03, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x04, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x01, 0x04, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x06, 0x02,
+  0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02,
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02,
+  0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02,
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02,
+  0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x07, 0x04, 0x01, 0x07, 0x05,
+  0x01, 0x07, 0x05, 0x01, 0x09, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x04, 0x01, 0x08, 0x04, 0x01, 0x09, 0x03, 0x01, 0x07, 0x05,
+  0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x03, 0x01, 0x03, 0x03,
+  0x01, 0x02, 0x06, 0x02, 0x01, 0x08, 0x0E, 0x02, 0x03, 0x01, 0x02, 0x06,
+  0x04, 0x0D, 0x03, 0x02, 0x00, 0x02, 0x07, 0x08, 0x01, 0x08, 0x06, 0x01,
+  0x09, 0x04 };
+
+const GFXglyph FreeSansOblique18pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,  10,    0,    1 },   // 0x20 ' '
+  {     0,   9,  26,  10,    4,  -25 },   // 0x21 '!'
+  {    74,  10,   9,  12,    6,  -24 },   // 0x22 '"'
+  {   119,  21,  25,  19,    2,  -24 },   // 0x23 '#'
+  {   232,  20,  31,  19,    2,  -26 },   // 0x24 '$'
+  {   377,  26,  25,  31,    5,  -24 },   // 0x25 '%'
+  {   524,  20,  25,  23,    3,  -24 },   // 0x26 '&'
+  {   643,   4,   9,   7,    6,  -24 },   // 0x27 '''
+  {   670,  12,  33,  12,    4,  -25 },   // 0x28 '('
+  {   769,  12,  33,  12,   -1,  -24 },   // 0x29 ')'
+  {   868,  10,  10,  14,    6,  -25 },   // 0x2A '*'
+  {   910,  18,  16,  20,    3,  -15 },   // 0x2B '+'
+  {   958,   5,   8,  10,    2,   -2 },   // 0x2C ','
+  {   982,   9,   3,  12,    3,  -10 },   // 0x2D '-'
+  {   991,   4,   4,  10,    3,   -3 },   // 0x2E '.'
+  {  1003,  15,  26,  10,    0,  -25 },   // 0x2F '/'
+  {  1081,  18,  25,  19,    3,  -24 },   // 0x30 '0'
+  {  1194,  10,  25,  19,    7,  -24 },   // 0x31 '1'
+  {  1269,  20,  25,  19,    2,  -24 },   // 0x32 '2'
+  {  1354,  19,  25,  19,    2,  -24 },   // 0x33 '3'
+  {  1449,  18,  25,  19,    2,  -24 },   // 0x34 '4'
+  {  1542,  20,  25,  19,    2,  -24 },   // 0x35 '5'
+  {  1629,  19,  25,  19,    3,  -24 },   // 0x36 '6'
+  {  1736,  18,  25,  19,    5,  -24 },   // 0x37 '7'
+  {  1811,  19,  25,  19,    3,  -24 },   // 0x38 '8'
+  {  1918,  19,  25,  19,    2,  -24 },   // 0x39 '9'
+  {  2025,   7,  19,  10,    4,  -18 },   // 0x3A ':'
+  {  2060,   8,  24,  10,    3,  -18 },   // 0x3B ';'
+  {  2108,  19,  17,  20,    3,  -16 },   // 0x3C '<'
+  {  2159,  18,   9,  20,    3,  -12 },   // 0x3D '='
+  {  2180,  19,  17,  20,    2,  -15 },   // 0x3E '>'
+  {  2231,  16,  26,  19,    6,  -25 },   // 0x3F '?'
+  {  2313,  33,  31,  36,    3,  -25 },   // 0x40 '@'
+  {  2512,  23,  26,  23,    0,  -25 },   // 0x41 'A'
+  {  2626,  21,  26,  23,    3,  -25 },   // 0x42 'B'
+  {  2738,  22,  26,  25,    4,  -25 },   // 0x43 'C'
+  {  2840,  23,  26,  25,    3,  -25 },   // 0x44 'D'
+  {  2958,  23,  26,  23,    3,  -25 },   // 0x45 'E'
+  {  3036,  22,  26,  21,    3,  -25 },   // 0x46 'F'
+  {  3114,  24,  26,  27,    4,  -25 },   // 0x47 'G'
+  {  3232,  25,  26,  25,    3,  -25 },   // 0x48 'H'
+  {  3356,   8,  26,  10,    4,  -25 },   // 0x49 'I'
+  {  3434,  18,  26,  18,    2,  -25 },   // 0x4A 'J'
+  {  3524,  25,  26,  23,    3,  -25 },   // 0x4B 'K'
+  {  3654,  16,  26,  19,    3,  -25 },   // 0x4C 'L'
+  {  3732,  29,  26,  30,    3,  -25 },   // 0x4D 'M'
+  {  3934,  25,  26,  26,    3,  -25 },   // 0x4E 'N'
+  {  4094,  24,  26,  27,    4,  -25 },   // 0x4F 'O'
+  {  4212,  22,  26,  23,    3,  -25 },   // 0x50 'P'
+  {  4308,  25,  28,  27,    4,  -25 },   // 0x51 'Q'
+  {  4440,  23,  26,  25,    3,  -25 },   // 0x52 'R'
+  {  4558,  22,  26,  23,    3,  -25 },   // 0x53 'S'
+  {  4658,  20,  26,  21,    6,  -25 },   // 0x54 'T'
+  {  4736,  24,  26,  25,    4,  -25 },   // 0x55 'U'
+  {  4860,  21,  26,  23,    6,  -25 },   // 0x56 'V'
+  {  4982,  32,  26,  33,    6,  -25 },   // 0x57 'W'
+  {  5178,  27,  26,  23,    1,  -25 },   // 0x58 'X'
+  {  5296,  23,  26,  24,    6,  -25 },   // 0x59 'Y'
+  {  5398,  25,  26,  21,    1,  -25 },   // 0x5A 'Z'
+  {  5476,  13,  33,  10,    1,  -25 },   // 0x5B '['
+  {  5575,   4,  26,  10,    5,  -25 },   // 0x5C '\'
+  {  5653,  13,  33,  10,   -1,  -24 },   // 0x5D ']'
+  {  5752,  14,  14,  16,    3,  -24 },   // 0x5E '^'
+  {  5814,  21,   2,  19,   -2,    5 },   // 0x5F '_'
+  {  5820,   6,   5,  12,    6,  -25 },   // 0x60 '`'
+  {  5835,  18,  19,  19,    2,  -18 },   // 0x61 'a'
+  {  5914,  19,  26,  20,    2,  -25 },   // 0x62 'b'
+  {  6026,  16,  19,  18,    3,  -18 },   // 0x63 'c'
+  {  6099,  20,  26,  20,    3,  -25 },   // 0x64 'd'
+  {  6213,  17,  19,  19,    3,  -18 },   // 0x65 'e'
+  {  6284,  11,  26,   9,    2,  -25 },   // 0x66 'f'
+  {  6362,  19,  27,  19,    2,  -18 },   // 0x67 'g'
+  {  6481,  18,  26,  19,    2,  -25 },   // 0x68 'h'
+  {  6595,   8,  26,   8,    2,  -25 },   // 0x69 'i'
+  {  6667,  14,  34,   8,   -2,  -25 },   // 0x6A 'j'
+  {  6763,  19,  26,  18,    2,  -25 },   // 0x6B 'k'
+  {  6875,   8,  26,   8,    2,  -25 },   // 0x6C 'l'
+  {  6953,  27,  19,  29,    2,  -18 },   // 0x6D 'm'
+  {  7084,  18,  19,  19,    2,  -18 },   // 0x6E 'n'
+  {  7177,  17,  19,  19,    3,  -18 },   // 0x6F 'o'
+  {  7260,  21,  26,  20,    0,  -18 },   // 0x70 'p'
+  {  7372,  20,  27,  19,    2,  -18 },   // 0x71 'q'
+  {  7489,  13,  19,  11,    2,  -18 },   // 0x72 'r'
+  {  7552,  16,  19,  18,    2,  -18 },   // 0x73 's'
+  {  7621,  10,  23,   9,    3,  -22 },   // 0x74 't'
+  {  7690,  18,  19,  19,    3,  -18 },   // 0x75 'u'
+  {  7781,  16,  19,  17,    4,  -18 },   // 0x76 'v'
+  {  7866,  24,  19,  25,    4,  -18 },   // 0x77 'w'
+  {  8005,  19,  19,  17,    1,  -18 },   // 0x78 'x'
+  {  8090,  20,  27,  17,    0,  -18 },   // 0x79 'y'
+  {  8199,  19,  19,  17,    1,  -18 },   // 0x7A 'z'
+  {  8256,  12,  33,  12,    3,  -25 },   // 0x7B '{'
+  {  8355,   9,  33,   9,    2,  -25 },   // 0x7C '|'
+  {  8454,  12,  33,  12,    0,  -24 },   // 0x7D '}'
+  {  8553,  16,   7,  20,    5,  -15 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSansOblique18pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSansOblique18pt7bSpanData,
+    (GFXglyph *)FreeSansOblique18pt7bSpanGlyphs,
+    0x20, 0x7E, 42 } };
+
+// Approx. 9366 bytes
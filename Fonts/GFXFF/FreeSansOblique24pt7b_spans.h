@@ -0,0 +1,1071 @@
+// FreeSansOblique24pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSansOblique24pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSansOblique24pt7bSpanData[] PROGMEM = {
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03,
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x02, 0x01, 0x04, 0x09, 0x04, 0x02, 0x01, 0x04, 0x09, 0x04, 0x02, 0x01,
+  0x04, 0x09, 0x04, 0x02, 0x00, 0x04, 0x08, 0x04, 0x02, 0x00, 0x04, 0x08,
+  0x04, 0x02, 0x00, 0x04, 0x08, 0x04, 0x02, 0x00, 0x04, 0x08, 0x04, 0x02,
+  0x00, 0x03, 0x08, 0x03, 0x02, 0x00, 0x03, 0x08, 0x03, 0x02, 0x00, 0x03,
+  0x08, 0x03, 0x02, 0x00, 0x02, 0x08, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02,
+  0x02, 0x0D, 0x04, 0x17, 0x03, 0x02, 0x0D, 0x04, 0x16, 0x04, 0x02, 0x0D,
+  0x03, 0x16, 0x04, 0x02, 0x0C, 0x04, 0x16, 0x03, 0x02, 0x0C, 0x03, 0x15,
+  0x04, 0x02, 0x0B, 0x04, 0x15, 0x03, 0x02, 0x0B, 0x04, 0x14, 0x04, 0x02,
+  0x0B, 0x03, 0x14, 0x04, 0x02, 0x0A, 0x04, 0x14, 0x03, 0x01, 0x04, 0x17,
+  0x01, 0x04, 0x17, 0x01, 0x04, 0x17, 0x02, 0x09, 0x03, 0x12, 0x04, 0x02,
+  0x08, 0x04, 0x12, 0x03, 0x02, 0x08, 0x04, 0x11, 0x04, 0x02, 0x08, 0x03,
+  0x11, 0x04, 0x02, 0x07, 0x04, 0x11, 0x03, 0x02, 0x07, 0x03, 0x10, 0x04,
+  0x02, 0x06, 0x04, 0x10, 0x03, 0x02, 0x06, 0x04, 0x0F, 0x04, 0x02, 0x06,
+  0x03, 0x0F, 0x04, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17,
+  0x02, 0x04, 0x04, 0x0E, 0x03, 0x02, 0x04, 0x03, 0x0D, 0x04, 0x02, 0x03,
+  0x04, 0x0D, 0x03, 0x02, 0x03, 0x03, 0x0C, 0x04, 0x02, 0x03, 0x03, 0x0C,
+  0x04, 0x02, 0x02, 0x04, 0x0C, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x04, 0x02,
+  0x01, 0x04, 0x0B, 0x03, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x02, 0x01, 0x03,
+  0x0A, 0x04, 0x01, 0x10, 0x03, 0x01, 0x10, 0x02, 0x01, 0x0D, 0x08, 0x01,
+  0x0A, 0x0D, 0x01, 0x09, 0x0F, 0x01, 0x07, 0x12, 0x03, 0x07, 0x05, 0x0F,
+  0x02, 0x14, 0x05, 0x03, 0x06, 0x05, 0x0E, 0x03, 0x15, 0x05, 0x03, 0x05,
+  0x05, 0x0E, 0x03, 0x16, 0x04, 0x03, 0x05, 0x04, 0x0E, 0x03, 0x16, 0x04,
+  0x03, 0x05, 0x03, 0x0E, 0x03, 0x16, 0x04, 0x03, 0x04, 0x04, 0x0E, 0x02,
+  0x16, 0x04, 0x02, 0x04, 0x04, 0x0D, 0x03, 0x02, 0x04, 0x04, 0x0D, 0x03,
+  0x02, 0x04, 0x04, 0x0D, 0x03, 0x02, 0x04, 0x05, 0x0D, 0x03, 0x02, 0x04,
+  0x07, 0x0D, 0x02, 0x01, 0x05, 0x0B, 0x01, 0x06, 0x0D, 0x01, 0x08, 0x0D,
+  0x01, 0x0A, 0x0C, 0x01, 0x0C, 0x0B, 0x02, 0x0B, 0x03, 0x11, 0x07, 0x02,
+  0x0B, 0x03, 0x13, 0x05, 0x02, 0x0B, 0x03, 0x14, 0x04, 0x02, 0x0B, 0x02,
+  0x14, 0x04, 0x03, 0x00, 0x04, 0x0A, 0x03, 0x14, 0x04, 0x03, 0x00, 0x04,
+  0x0A, 0x03, 0x14, 0x04, 0x03, 0x00, 0x04, 0x0A, 0x03, 0x14, 0x03, 0x03,
+  0x00, 0x04, 0x0A, 0x03, 0x13, 0x04, 0x03, 0x00, 0x04, 0x0A, 0x02, 0x13,
+  0x04, 0x03, 0x00, 0x05, 0x09, 0x03, 0x12, 0x04, 0x03, 0x00, 0x05, 0x09,
+  0x03, 0x11, 0x04, 0x03, 0x01, 0x06, 0x09, 0x03, 0x0E, 0x06, 0x01, 0x02,
+  0x11, 0x01, 0x03, 0x0F, 0x01, 0x06, 0x09, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x08, 0x02, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x1D,
+  0x04, 0x02, 0x07, 0x05, 0x1D, 0x03, 0x02, 0x05, 0x09, 0x1C, 0x03, 0x02,
+  0x04, 0x0B, 0x1B, 0x03, 0x03, 0x03, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x03,
+  0x02, 0x03, 0x0C, 0x04, 0x1A, 0x03, 0x03, 0x01, 0x03, 0x0D, 0x03, 0x19,
+  0x03, 0x03, 0x01, 0x03, 0x0D, 0x03, 0x18, 0x03, 0x03, 0x00, 0x03, 0x0D,
+  0x03, 0x17, 0x03, 0x03, 0x00, 0x03, 0x0D, 0x03, 0x16, 0x04, 0x03, 0x00,
+  0x03, 0x0C, 0x03, 0x16, 0x03, 0x03, 0x00, 0x03, 0x0C, 0x03, 0x15, 0x03,
+  0x03, 0x00, 0x04, 0x0B, 0x03, 0x14, 0x03, 0x03, 0x01, 0x04, 0x09, 0x05,
+  0x13, 0x04, 0x02, 0x01, 0x0C, 0x13, 0x03, 0x02, 0x02, 0x09, 0x12, 0x03,
+  0x02, 0x04, 0x05, 0x11, 0x03, 0x01, 0x10, 0x03, 0x02, 0x0F, 0x04, 0x1B,
+  0x05, 0x02, 0x0F, 0x03, 0x19, 0x09, 0x02, 0x0E, 0x03, 0x18, 0x0B, 0x03,
+  0x0D, 0x03, 0x17, 0x04, 0x1F, 0x04, 0x03, 0x0C, 0x04, 0x16, 0x03, 0x20,
+  0x04, 0x03, 0x0C, 0x03, 0x15, 0x03, 0x21, 0x03, 0x03, 0x0B, 0x03, 0x15,
+  0x03, 0x21, 0x03, 0x03, 0x0A, 0x03, 0x14, 0x03, 0x21, 0x03, 0x03, 0x09,
+  0x03, 0x14, 0x03, 0x21, 0x03, 0x03, 0x08, 0x04, 0x14, 0x03, 0x20, 0x03,
+  0x03, 0x08, 0x03, 0x14, 0x03, 0x20, 0x03, 0x03, 0x07, 0x03, 0x14, 0x04,
+  0x1F, 0x03, 0x03, 0x06, 0x03, 0x15, 0x04, 0x1D, 0x05, 0x02, 0x05, 0x03,
+  0x15, 0x0C, 0x02, 0x05, 0x03, 0x16, 0x09, 0x02, 0x04, 0x03, 0x18, 0x05,
+  0x01, 0x0F, 0x06, 0x01, 0x0C, 0x0A, 0x01, 0x0B, 0x0C, 0x02, 0x0A, 0x05,
+  0x13, 0x05, 0x02, 0x09, 0x04, 0x14, 0x04, 0x02, 0x09, 0x04, 0x14, 0x04,
+  0x02, 0x08, 0x04, 0x14, 0x04, 0x02, 0x08, 0x04, 0x14, 0x04, 0x02, 0x08,
+  0x04, 0x13, 0x04, 0x02, 0x08, 0x04, 0x13, 0x04, 0x02, 0x08, 0x05, 0x11,
+  0x05, 0x02, 0x09, 0x04, 0x10, 0x05, 0x01, 0x09, 0x0B, 0x01, 0x0A, 0x09,
+  0x01, 0x0A, 0x07, 0x01, 0x08, 0x08, 0x01, 0x06, 0x0A, 0x03, 0x05, 0x06,
+  0x0C, 0x05, 0x17, 0x03, 0x03, 0x04, 0x05, 0x0D, 0x05, 0x17, 0x03, 0x03,
+  0x03, 0x05, 0x0D, 0x05, 0x16, 0x03, 0x03, 0x02, 0x04, 0x0E, 0x05, 0x16,
+  0x03, 0x03, 0x01, 0x04, 0x0F, 0x04, 0x15, 0x04, 0x02, 0x01, 0x04, 0x0F,
+  0x09, 0x02, 0x00, 0x04, 0x10, 0x07, 0x02, 0x00, 0x04, 0x10, 0x07, 0x02,
+  0x00, 0x04, 0x11, 0x05, 0x02, 0x00, 0x04, 0x11, 0x05, 0x02, 0x00, 0x05,
+  0x10, 0x07, 0x02, 0x00, 0x05, 0x0E, 0x09, 0x03, 0x00, 0x07, 0x0C, 0x06,
+  0x13, 0x05, 0x02, 0x01, 0x10, 0x14, 0x04, 0x02, 0x02, 0x0E, 0x14, 0x05,
+  0x02, 0x03, 0x0B, 0x15, 0x04, 0x01, 0x05, 0x07, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x0C, 0x03, 0x01,
+  0x0B, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01,
+  0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01,
+  0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01,
+  0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x0A, 0x02, 0x01,
+  0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0B, 0x02, 0x01, 0x0B, 0x03, 0x01,
+  0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0C, 0x03, 0x01,
+  0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01,
+  0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01,
+  0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x04, 0x01,
+  0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x04, 0x01,
+  0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x03, 0x01,
+  0x09, 0x03, 0x01, 0x08, 0x04, 0x01, 0x08, 0x03, 0x01, 0x07, 0x04, 0x01,
+  0x07, 0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x07, 0x03, 0x01,
+  0x07, 0x03, 0x01, 0x06, 0x03, 0x03, 0x01, 0x02, 0x06, 0x03, 0x0C, 0x02,
+  0x03, 0x01, 0x04, 0x06, 0x03, 0x0A, 0x04, 0x01, 0x00, 0x0E, 0x01, 0x02,
+  0x0A, 0x01, 0x05, 0x04, 0x01, 0x03, 0x07, 0x02, 0x02, 0x04, 0x07, 0x03,
+  0x02, 0x01, 0x04, 0x07, 0x04, 0x02, 0x01, 0x03, 0x08, 0x03, 0x02, 0x02,
+  0x01, 0x08, 0x02, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x04,
+  0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17,
+  0x01, 0x00, 0x16, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03,
+  0x01, 0x08, 0x04, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05,
+  0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02,
+  0x01, 0x02, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x0B,
+  0x01, 0x00, 0x0C, 0x01, 0x00, 0x0C, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x13, 0x02, 0x01, 0x12, 0x03, 0x01, 0x11, 0x03, 0x01, 0x11, 0x03,
+  0x01, 0x10, 0x03, 0x01, 0x10, 0x03, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x02,
+  0x01, 0x0E, 0x03, 0x01, 0x0E, 0x02, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x02,
+  0x01, 0x0C, 0x03, 0x01, 0x0C, 0x02, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x02,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x03, 0x01, 0x09, 0x02,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x02, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x0C, 0x06,
+  0x01, 0x09, 0x0B, 0x01, 0x08, 0x0D, 0x01, 0x07, 0x0F, 0x02, 0x06, 0x06,
+  0x10, 0x06, 0x02, 0x05, 0x05, 0x12, 0x04, 0x02, 0x05, 0x04, 0x12, 0x05,
+  0x02, 0x04, 0x04, 0x13, 0x04, 0x02, 0x03, 0x05, 0x13, 0x04, 0x02, 0x03,
+  0x04, 0x13, 0x04, 0x02, 0x03, 0x04, 0x13, 0x04, 0x02, 0x02, 0x04, 0x13,
+  0x04, 0x02, 0x02, 0x04, 0x13, 0x04, 0x02, 0x02, 0x04, 0x12, 0x05, 0x02,
+  0x01, 0x04, 0x12, 0x05, 0x02, 0x01, 0x04, 0x12, 0x04, 0x02, 0x01, 0x04,
+  0x12, 0x04, 0x02, 0x01, 0x04, 0x12, 0x04, 0x02, 0x01, 0x04, 0x12, 0x04,
+  0x02, 0x00, 0x04, 0x11, 0x05, 0x02, 0x00, 0x04, 0x11, 0x05, 0x02, 0x00,
+  0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x10,
+  0x05, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x05, 0x02,
+  0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x05,
+  0x0D, 0x05, 0x02, 0x01, 0x06, 0x0B, 0x06, 0x01, 0x01, 0x0F, 0x01, 0x02,
+  0x0D, 0x01, 0x03, 0x0B, 0x01, 0x05, 0x06, 0x01, 0x0B, 0x02, 0x01, 0x0A,
+  0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x04, 0x01, 0x07, 0x05, 0x01, 0x03,
+  0x09, 0x01, 0x00, 0x0C, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06,
+  0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04,
+  0x05, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x03, 0x05, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x01, 0x0E,
+  0x08, 0x01, 0x0B, 0x0D, 0x01, 0x0A, 0x0F, 0x01, 0x09, 0x11, 0x02, 0x08,
+  0x06, 0x14, 0x06, 0x02, 0x07, 0x05, 0x16, 0x05, 0x02, 0x06, 0x05, 0x16,
+  0x05, 0x02, 0x06, 0x05, 0x17, 0x04, 0x02, 0x06, 0x04, 0x17, 0x04, 0x02,
+  0x05, 0x05, 0x17, 0x04, 0x02, 0x05, 0x04, 0x17, 0x04, 0x01, 0x16, 0x04,
+  0x01, 0x16, 0x04, 0x01, 0x15, 0x05, 0x01, 0x14, 0x05, 0x01, 0x13, 0x05,
+  0x01, 0x11, 0x06, 0x01, 0x0F, 0x07, 0x01, 0x0D, 0x07, 0x01, 0x0B, 0x07,
+  0x01, 0x09, 0x07, 0x01, 0x07, 0x07, 0x01, 0x06, 0x06, 0x01, 0x05, 0x06,
+  0x01, 0x04, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16,
+  0x01, 0x00, 0x16, 0x01, 0x0D, 0x07, 0x01, 0x0A, 0x0C, 0x01, 0x08, 0x0F,
+  0x01, 0x07, 0x11, 0x02, 0x07, 0x06, 0x13, 0x06, 0x02, 0x06, 0x05, 0x14,
+  0x05, 0x02, 0x05, 0x05, 0x15, 0x04, 0x02, 0x05, 0x04, 0x15, 0x04, 0x02,
+  0x04, 0x05, 0x15, 0x04, 0x02, 0x04, 0x04, 0x15, 0x04, 0x01, 0x14, 0x04,
+  0x01, 0x14, 0x04, 0x01, 0x13, 0x04, 0x01, 0x10, 0x07, 0x01, 0x0B, 0x0A,
+  0x01, 0x0B, 0x09, 0x01, 0x0B, 0x0A, 0x01, 0x0A, 0x0C, 0x01, 0x10, 0x06,
+  0x01, 0x12, 0x05, 0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x01, 0x13, 0x04,
+  0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00,
+  0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x11,
+  0x04, 0x02, 0x00, 0x05, 0x0F, 0x06, 0x02, 0x01, 0x06, 0x0D, 0x07, 0x01,
+  0x01, 0x12, 0x01, 0x02, 0x10, 0x01, 0x03, 0x0D, 0x01, 0x05, 0x08, 0x01,
+  0x14, 0x03, 0x01, 0x13, 0x04, 0x01, 0x12, 0x05, 0x01, 0x11, 0x06, 0x01,
+  0x10, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0E, 0x08, 0x02, 0x0D, 0x04, 0x12,
+  0x04, 0x02, 0x0C, 0x05, 0x12, 0x04, 0x02, 0x0B, 0x05, 0x11, 0x05, 0x02,
+  0x0A, 0x05, 0x11, 0x04, 0x02, 0x09, 0x05, 0x11, 0x04, 0x02, 0x08, 0x05,
+  0x11, 0x04, 0x02, 0x08, 0x04, 0x11, 0x04, 0x02, 0x07, 0x04, 0x10, 0x04,
+  0x02, 0x06, 0x04, 0x10, 0x04, 0x02, 0x05, 0x04, 0x10, 0x04, 0x02, 0x04,
+  0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x0F, 0x05, 0x02, 0x02, 0x04, 0x0F,
+  0x04, 0x02, 0x01, 0x04, 0x0F, 0x04, 0x01, 0x01, 0x17, 0x01, 0x01, 0x17,
+  0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x0E, 0x04, 0x01, 0x0E, 0x04,
+  0x01, 0x0E, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04,
+  0x01, 0x0D, 0x04, 0x01, 0x0C, 0x05, 0x01, 0x09, 0x11, 0x01, 0x08, 0x12,
+  0x01, 0x08, 0x12, 0x01, 0x08, 0x12, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x05, 0x04, 0x02, 0x05, 0x04, 0x0C, 0x06, 0x02, 0x04, 0x04, 0x09,
+  0x0C, 0x01, 0x04, 0x12, 0x01, 0x04, 0x13, 0x02, 0x03, 0x07, 0x11, 0x06,
+  0x02, 0x03, 0x05, 0x12, 0x06, 0x02, 0x03, 0x04, 0x13, 0x05, 0x01, 0x14,
+  0x04, 0x01, 0x14, 0x04, 0x01, 0x14, 0x04, 0x01, 0x14, 0x04, 0x01, 0x14,
+  0x04, 0x01, 0x14, 0x03, 0x01, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04,
+  0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x05, 0x11, 0x04, 0x02, 0x00,
+  0x05, 0x10, 0x05, 0x02, 0x01, 0x06, 0x0E, 0x06, 0x01, 0x01, 0x12, 0x01,
+  0x02, 0x10, 0x01, 0x03, 0x0D, 0x01, 0x06, 0x07, 0x01, 0x0D, 0x06, 0x01,
+  0x0A, 0x0B, 0x01, 0x09, 0x0D, 0x01, 0x08, 0x0F, 0x02, 0x07, 0x06, 0x12,
+  0x05, 0x02, 0x06, 0x05, 0x13, 0x05, 0x02, 0x05, 0x05, 0x13, 0x05, 0x02,
+  0x04, 0x05, 0x14, 0x04, 0x02, 0x04, 0x04, 0x14, 0x04, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x02, 0x02, 0x04, 0x0B, 0x06, 0x02,
+  0x02, 0x04, 0x09, 0x0A, 0x02, 0x02, 0x04, 0x07, 0x0D, 0x02, 0x01, 0x04,
+  0x06, 0x0F, 0x02, 0x01, 0x09, 0x0F, 0x06, 0x02, 0x01, 0x07, 0x11, 0x05,
+  0x02, 0x01, 0x06, 0x11, 0x05, 0x02, 0x00, 0x06, 0x12, 0x04, 0x02, 0x00,
+  0x05, 0x12, 0x04, 0x02, 0x00, 0x05, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12,
+  0x04, 0x02, 0x00, 0x04, 0x12, 0x03, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02,
+  0x00, 0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x05,
+  0x0F, 0x05, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x02, 0x01, 0x06, 0x0C, 0x06,
+  0x01, 0x02, 0x10, 0x01, 0x02, 0x0F, 0x01, 0x04, 0x0B, 0x01, 0x06, 0x07,
+  0x01, 0x03, 0x16, 0x01, 0x03, 0x16, 0x01, 0x03, 0x16, 0x01, 0x02, 0x17,
+  0x01, 0x14, 0x04, 0x01, 0x13, 0x04, 0x01, 0x12, 0x04, 0x01, 0x11, 0x04,
+  0x01, 0x10, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0E, 0x04,
+  0x01, 0x0D, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04,
+  0x01, 0x0A, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x05, 0x05,
+  0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x04, 0x01, 0x0D, 0x07, 0x01, 0x0A, 0x0C, 0x01, 0x09, 0x0E,
+  0x01, 0x08, 0x10, 0x02, 0x07, 0x06, 0x13, 0x06, 0x02, 0x06, 0x05, 0x14,
+  0x05, 0x02, 0x06, 0x04, 0x15, 0x04, 0x02, 0x05, 0x04, 0x15, 0x04, 0x02,
+  0x05, 0x04, 0x15, 0x04, 0x02, 0x05, 0x04, 0x15, 0x04, 0x02, 0x05, 0x04,
+  0x14, 0x04, 0x02, 0x05, 0x05, 0x13, 0x04, 0x02, 0x05, 0x06, 0x11, 0x05,
+  0x01, 0x06, 0x0F, 0x01, 0x07, 0x0D, 0x01, 0x07, 0x0D, 0x01, 0x05, 0x10,
+  0x02, 0x04, 0x06, 0x10, 0x06, 0x02, 0x03, 0x05, 0x12, 0x04, 0x02, 0x02,
+  0x04, 0x12, 0x05, 0x02, 0x01, 0x05, 0x13, 0x04, 0x02, 0x01, 0x04, 0x13,
+  0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02,
+  0x00, 0x04, 0x13, 0x03, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04,
+  0x12, 0x04, 0x02, 0x00, 0x05, 0x11, 0x04, 0x02, 0x00, 0x06, 0x10, 0x05,
+  0x02, 0x01, 0x06, 0x0D, 0x07, 0x01, 0x01, 0x12, 0x01, 0x02, 0x10, 0x01,
+  0x04, 0x0C, 0x01, 0x06, 0x08, 0x01, 0x0B, 0x07, 0x01, 0x09, 0x0B, 0x01,
+  0x07, 0x0F, 0x01, 0x06, 0x10, 0x02, 0x05, 0x07, 0x11, 0x06, 0x02, 0x05,
+  0x05, 0x12, 0x05, 0x02, 0x04, 0x05, 0x13, 0x05, 0x02, 0x04, 0x04, 0x14,
+  0x04, 0x02, 0x03, 0x04, 0x14, 0x04, 0x02, 0x03, 0x04, 0x14, 0x04, 0x02,
+  0x02, 0x04, 0x14, 0x04, 0x02, 0x02, 0x04, 0x14, 0x04, 0x02, 0x02, 0x04,
+  0x13, 0x05, 0x02, 0x02, 0x04, 0x13, 0x05, 0x02, 0x02, 0x04, 0x12, 0x06,
+  0x02, 0x02, 0x05, 0x11, 0x06, 0x02, 0x02, 0x05, 0x10, 0x07, 0x02, 0x03,
+  0x06, 0x0E, 0x09, 0x01, 0x03, 0x14, 0x02, 0x04, 0x0D, 0x12, 0x04, 0x02,
+  0x05, 0x0A, 0x12, 0x04, 0x02, 0x07, 0x06, 0x11, 0x05, 0x01, 0x11, 0x05,
+  0x01, 0x11, 0x04, 0x01, 0x10, 0x05, 0x01, 0x10, 0x04, 0x02, 0x00, 0x04,
+  0x0F, 0x05, 0x02, 0x00, 0x04, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05,
+  0x02, 0x00, 0x06, 0x0B, 0x07, 0x01, 0x01, 0x10, 0x01, 0x02, 0x0D, 0x01,
+  0x03, 0x0B, 0x01, 0x05, 0x07, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01,
+  0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x19, 0x01, 0x01,
+  0x17, 0x03, 0x01, 0x14, 0x05, 0x01, 0x12, 0x07, 0x01, 0x0F, 0x09, 0x01,
+  0x0C, 0x09, 0x01, 0x0A, 0x09, 0x01, 0x07, 0x09, 0x01, 0x05, 0x09, 0x01,
+  0x02, 0x09, 0x01, 0x01, 0x07, 0x01, 0x00, 0x06, 0x01, 0x00, 0x07, 0x01,
+  0x01, 0x08, 0x01, 0x03, 0x08, 0x01, 0x05, 0x08, 0x01, 0x07, 0x09, 0x01,
+  0x09, 0x09, 0x01, 0x0B, 0x09, 0x01, 0x0D, 0x09, 0x01, 0x10, 0x06, 0x01,
+  0x12, 0x03, 0x01, 0x14, 0x01, 0x01, 0x03, 0x17, 0x01, 0x03, 0x16, 0x01,
+  0x02, 0x17, 0x01, 0x02, 0x17, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x17,
+  0x01, 0x01, 0x17, 0x01, 0x01, 0x16, 0x01, 0x01, 0x16, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x03, 0x01, 0x04, 0x06, 0x01, 0x04, 0x09, 0x01, 0x06, 0x09,
+  0x01, 0x08, 0x09, 0x01, 0x0A, 0x09, 0x01, 0x0D, 0x08, 0x01, 0x0F, 0x08,
+  0x01, 0x11, 0x08, 0x01, 0x13, 0x07, 0x01, 0x14, 0x06, 0x01, 0x12, 0x07,
+  0x01, 0x0F, 0x09, 0x01, 0x0C, 0x09, 0x01, 0x0A, 0x09, 0x01, 0x07, 0x09,
+  0x01, 0x05, 0x09, 0x01, 0x02, 0x09, 0x01, 0x01, 0x07, 0x01, 0x01, 0x05,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x01, 0x08, 0x07, 0x01, 0x06, 0x0B,
+  0x01, 0x04, 0x0E, 0x01, 0x03, 0x10, 0x02, 0x03, 0x05, 0x0E, 0x05, 0x02,
+  0x02, 0x05, 0x0F, 0x05, 0x02, 0x01, 0x05, 0x10, 0x04, 0x02, 0x01, 0x04,
+  0x10, 0x04, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04,
+  0x02, 0x00, 0x04, 0x0F, 0x05, 0x01, 0x0F, 0x04, 0x01, 0x0E, 0x05, 0x01,
+  0x0D, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x05, 0x01,
+  0x08, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x05, 0x01, 0x06, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x05, 0x01, 0x17, 0x0A,
+  0x01, 0x13, 0x11, 0x01, 0x11, 0x15, 0x01, 0x0F, 0x19, 0x02, 0x0D, 0x0A,
+  0x20, 0x09, 0x02, 0x0B, 0x08, 0x22, 0x08, 0x02, 0x0A, 0x07, 0x24, 0x07,
+  0x02, 0x09, 0x06, 0x25, 0x06, 0x02, 0x08, 0x06, 0x27, 0x05, 0x02, 0x07,
+  0x06, 0x27, 0x05, 0x03, 0x06, 0x05, 0x16, 0x06, 0x28, 0x05, 0x04, 0x05,
+  0x05, 0x14, 0x0A, 0x20, 0x04, 0x28, 0x05, 0x04, 0x05, 0x04, 0x12, 0x0C,
+  0x20, 0x04, 0x29, 0x04, 0x04, 0x04, 0x05, 0x11, 0x06, 0x1B, 0x08, 0x29,
+  0x04, 0x04, 0x03, 0x05, 0x10, 0x05, 0x1C, 0x06, 0x29, 0x04, 0x04, 0x03,
+  0x04, 0x0F, 0x05, 0x1C, 0x06, 0x29, 0x04, 0x04, 0x02, 0x05, 0x0E, 0x05,
+  0x1C, 0x05, 0x29, 0x04, 0x04, 0x02, 0x04, 0x0E, 0x04, 0x1C, 0x05, 0x29,
+  0x04, 0x04, 0x01, 0x05, 0x0D, 0x04, 0x1C, 0x04, 0x28, 0x05, 0x04, 0x01,
+  0x04, 0x0C, 0x05, 0x1B, 0x05, 0x28, 0x04, 0x04, 0x01, 0x04, 0x0C, 0x04,
+  0x1B, 0x04, 0x28, 0x04, 0x04, 0x01, 0x03, 0x0C, 0x04, 0x1B, 0x04, 0x27,
+  0x05, 0x04, 0x00, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x27, 0x04, 0x04, 0x00,
+  0x04, 0x0B, 0x04, 0x1A, 0x04, 0x26, 0x05, 0x04, 0x00, 0x04, 0x0B, 0x04,
+  0x19, 0x04, 0x25, 0x05, 0x04, 0x00, 0x04, 0x0B, 0x04, 0x18, 0x05, 0x24,
+  0x06, 0x04, 0x00, 0x04, 0x0B, 0x04, 0x17, 0x05, 0x23, 0x06, 0x04, 0x00,
+  0x04, 0x0B, 0x05, 0x16, 0x06, 0x22, 0x06, 0x04, 0x00, 0x04, 0x0C, 0x05,
+  0x15, 0x08, 0x20, 0x06, 0x03, 0x00, 0x05, 0x0C, 0x0B, 0x18, 0x0D, 0x03,
+  0x01, 0x04, 0x0D, 0x09, 0x19, 0x0A, 0x03, 0x01, 0x04, 0x0E, 0x06, 0x19,
+  0x08, 0x01, 0x01, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x06, 0x01, 0x03,
+  0x06, 0x01, 0x04, 0x07, 0x02, 0x05, 0x09, 0x17, 0x05, 0x01, 0x06, 0x16,
+  0x01, 0x08, 0x15, 0x01, 0x0A, 0x11, 0x01, 0x0D, 0x0A, 0x01, 0x13, 0x06,
+  0x01, 0x12, 0x07, 0x01, 0x12, 0x07, 0x01, 0x11, 0x08, 0x01, 0x10, 0x0A,
+  0x02, 0x10, 0x04, 0x15, 0x05, 0x02, 0x0F, 0x04, 0x15, 0x05, 0x02, 0x0F,
+  0x04, 0x15, 0x05, 0x02, 0x0E, 0x04, 0x15, 0x05, 0x02, 0x0E, 0x04, 0x15,
+  0x05, 0x02, 0x0D, 0x04, 0x16, 0x04, 0x02, 0x0C, 0x05, 0x16, 0x04, 0x02,
+  0x0C, 0x04, 0x16, 0x05, 0x02, 0x0B, 0x04, 0x16, 0x05, 0x02, 0x0B, 0x04,
+  0x16, 0x05, 0x02, 0x0A, 0x04, 0x16, 0x05, 0x02, 0x0A, 0x04, 0x16, 0x05,
+  0x02, 0x09, 0x04, 0x16, 0x05, 0x02, 0x08, 0x05, 0x17, 0x04, 0x02, 0x08,
+  0x04, 0x17, 0x05, 0x01, 0x07, 0x15, 0x01, 0x07, 0x15, 0x01, 0x06, 0x16,
+  0x01, 0x06, 0x16, 0x02, 0x05, 0x05, 0x17, 0x05, 0x02, 0x04, 0x05, 0x18,
+  0x04, 0x02, 0x04, 0x05, 0x18, 0x05, 0x02, 0x03, 0x05, 0x18, 0x05, 0x02,
+  0x03, 0x04, 0x18, 0x05, 0x02, 0x02, 0x05, 0x18, 0x05, 0x02, 0x02, 0x04,
+  0x18, 0x05, 0x02, 0x01, 0x05, 0x18, 0x05, 0x02, 0x00, 0x05, 0x19, 0x04,
+  0x02, 0x00, 0x05, 0x19, 0x05, 0x01, 0x07, 0x11, 0x01, 0x07, 0x13, 0x01,
+  0x07, 0x15, 0x01, 0x07, 0x15, 0x02, 0x06, 0x05, 0x17, 0x06, 0x02, 0x06,
+  0x04, 0x18, 0x05, 0x02, 0x06, 0x04, 0x19, 0x04, 0x02, 0x06, 0x04, 0x19,
+  0x04, 0x02, 0x06, 0x04, 0x19, 0x04, 0x02, 0x05, 0x04, 0x19, 0x04, 0x02,
+  0x05, 0x04, 0x18, 0x04, 0x02, 0x05, 0x04, 0x18, 0x04, 0x02, 0x05, 0x04,
+  0x17, 0x04, 0x02, 0x04, 0x05, 0x15, 0x05, 0x01, 0x04, 0x14, 0x01, 0x04,
+  0x13, 0x01, 0x04, 0x14, 0x01, 0x03, 0x17, 0x02, 0x03, 0x04, 0x15, 0x05,
+  0x02, 0x03, 0x04, 0x16, 0x05, 0x02, 0x03, 0x04, 0x17, 0x04, 0x02, 0x03,
+  0x04, 0x17, 0x04, 0x02, 0x02, 0x04, 0x17, 0x04, 0x02, 0x02, 0x04, 0x17,
+  0x04, 0x02, 0x02, 0x04, 0x17, 0x04, 0x02, 0x02, 0x04, 0x16, 0x04, 0x02,
+  0x01, 0x05, 0x16, 0x04, 0x02, 0x01, 0x04, 0x15, 0x05, 0x02, 0x01, 0x04,
+  0x14, 0x05, 0x02, 0x01, 0x04, 0x12, 0x06, 0x01, 0x01, 0x16, 0x01, 0x00,
+  0x16, 0x01, 0x00, 0x15, 0x01, 0x00, 0x13, 0x01, 0x0F, 0x08, 0x01, 0x0C,
+  0x0D, 0x01, 0x0A, 0x11, 0x01, 0x09, 0x13, 0x02, 0x08, 0x07, 0x16, 0x06,
+  0x02, 0x07, 0x06, 0x18, 0x05, 0x02, 0x06, 0x05, 0x19, 0x04, 0x02, 0x05,
+  0x05, 0x19, 0x04, 0x02, 0x05, 0x04, 0x1A, 0x04, 0x02, 0x04, 0x04, 0x1A,
+  0x04, 0x02, 0x03, 0x05, 0x1A, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x02, 0x00, 0x04, 0x18, 0x04, 0x02,
+  0x00, 0x04, 0x17, 0x05, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x00, 0x05,
+  0x16, 0x05, 0x02, 0x00, 0x05, 0x16, 0x04, 0x02, 0x01, 0x05, 0x15, 0x05,
+  0x02, 0x01, 0x05, 0x14, 0x05, 0x02, 0x02, 0x05, 0x12, 0x06, 0x02, 0x02,
+  0x07, 0x10, 0x07, 0x01, 0x03, 0x13, 0x01, 0x04, 0x11, 0x01, 0x05, 0x0E,
+  0x01, 0x08, 0x08, 0x01, 0x07, 0x11, 0x01, 0x07, 0x13, 0x01, 0x07, 0x14,
+  0x01, 0x06, 0x16, 0x02, 0x06, 0x05, 0x16, 0x07, 0x02, 0x06, 0x04, 0x18,
+  0x06, 0x02, 0x06, 0x04, 0x19, 0x05, 0x02, 0x05, 0x05, 0x1A, 0x04, 0x02,
+  0x05, 0x05, 0x1A, 0x05, 0x02, 0x05, 0x04, 0x1B, 0x04, 0x02, 0x05, 0x04,
+  0x1B, 0x04, 0x02, 0x05, 0x04, 0x1B, 0x04, 0x02, 0x04, 0x05, 0x1B, 0x04,
+  0x02, 0x04, 0x05, 0x1B, 0x04, 0x02, 0x04, 0x04, 0x1B, 0x04, 0x02, 0x04,
+  0x04, 0x1B, 0x04, 0x02, 0x04, 0x04, 0x1A, 0x04, 0x02, 0x03, 0x05, 0x1A,
+  0x04, 0x02, 0x03, 0x05, 0x1A, 0x04, 0x02, 0x03, 0x04, 0x1A, 0x04, 0x02,
+  0x03, 0x04, 0x19, 0x04, 0x02, 0x02, 0x05, 0x19, 0x04, 0x02, 0x02, 0x05,
+  0x18, 0x05, 0x02, 0x02, 0x04, 0x18, 0x04, 0x02, 0x02, 0x04, 0x17, 0x05,
+  0x02, 0x02, 0x04, 0x17, 0x04, 0x02, 0x01, 0x05, 0x16, 0x04, 0x02, 0x01,
+  0x05, 0x15, 0x05, 0x02, 0x01, 0x04, 0x13, 0x06, 0x02, 0x01, 0x04, 0x11,
+  0x07, 0x01, 0x01, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x14, 0x01, 0x00,
+  0x11, 0x01, 0x07, 0x18, 0x01, 0x07, 0x18, 0x01, 0x07, 0x17, 0x01, 0x06,
+  0x18, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05,
+  0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x17, 0x01, 0x04, 0x17, 0x01, 0x03, 0x17, 0x01, 0x03, 0x17, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x18, 0x01, 0x00,
+  0x19, 0x01, 0x00, 0x19, 0x01, 0x00, 0x18, 0x01, 0x07, 0x17, 0x01, 0x07,
+  0x17, 0x01, 0x07, 0x17, 0x01, 0x06, 0x17, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04,
+  0x05, 0x01, 0x04, 0x04, 0x01, 0x04, 0x14, 0x01, 0x04, 0x14, 0x01, 0x03,
+  0x15, 0x01, 0x03, 0x15, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02,
+  0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x11, 0x09, 0x01, 0x0E, 0x0E, 0x01, 0x0B, 0x13, 0x01, 0x0A,
+  0x15, 0x02, 0x09, 0x07, 0x18, 0x08, 0x02, 0x07, 0x06, 0x1B, 0x05, 0x02,
+  0x06, 0x06, 0x1C, 0x05, 0x02, 0x06, 0x04, 0x1C, 0x05, 0x02, 0x05, 0x04,
+  0x1D, 0x04, 0x02, 0x04, 0x05, 0x1D, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x04, 0x02, 0x01, 0x04, 0x12, 0x0E, 0x02, 0x00, 0x04,
+  0x12, 0x0E, 0x02, 0x00, 0x04, 0x11, 0x0F, 0x02, 0x00, 0x04, 0x11, 0x0F,
+  0x02, 0x00, 0x04, 0x1C, 0x03, 0x02, 0x00, 0x04, 0x1C, 0x03, 0x02, 0x00,
+  0x04, 0x1B, 0x04, 0x02, 0x00, 0x04, 0x1B, 0x04, 0x02, 0x00, 0x04, 0x1A,
+  0x05, 0x02, 0x00, 0x05, 0x1A, 0x05, 0x02, 0x01, 0x04, 0x19, 0x05, 0x02,
+  0x01, 0x05, 0x18, 0x06, 0x02, 0x01, 0x06, 0x17, 0x07, 0x02, 0x02, 0x06,
+  0x15, 0x09, 0x03, 0x02, 0x08, 0x12, 0x07, 0x1A, 0x04, 0x02, 0x03, 0x14,
+  0x1A, 0x03, 0x02, 0x05, 0x11, 0x1A, 0x03, 0x02, 0x06, 0x0E, 0x1A, 0x03,
+  0x01, 0x09, 0x08, 0x02, 0x07, 0x04, 0x1D, 0x04, 0x02, 0x07, 0x04, 0x1D,
+  0x04, 0x02, 0x07, 0x04, 0x1C, 0x05, 0x02, 0x06, 0x05, 0x1C, 0x05, 0x02,
+  0x06, 0x05, 0x1C, 0x04, 0x02, 0x06, 0x04, 0x1C, 0x04, 0x02, 0x06, 0x04,
+  0x1C, 0x04, 0x02, 0x05, 0x05, 0x1B, 0x05, 0x02, 0x05, 0x05, 0x1B, 0x05,
+  0x02, 0x05, 0x04, 0x1B, 0x04, 0x02, 0x05, 0x04, 0x1B, 0x04, 0x02, 0x05,
+  0x04, 0x1B, 0x04, 0x02, 0x04, 0x05, 0x1A, 0x05, 0x02, 0x04, 0x05, 0x1A,
+  0x05, 0x02, 0x04, 0x04, 0x1A, 0x04, 0x01, 0x04, 0x1A, 0x01, 0x04, 0x1A,
+  0x01, 0x03, 0x1B, 0x01, 0x03, 0x1A, 0x02, 0x03, 0x04, 0x19, 0x04, 0x02,
+  0x03, 0x04, 0x19, 0x04, 0x02, 0x02, 0x05, 0x18, 0x05, 0x02, 0x02, 0x05,
+  0x18, 0x05, 0x02, 0x02, 0x04, 0x18, 0x04, 0x02, 0x02, 0x04, 0x18, 0x04,
+  0x02, 0x02, 0x04, 0x18, 0x04, 0x02, 0x01, 0x05, 0x17, 0x05, 0x02, 0x01,
+  0x05, 0x17, 0x04, 0x02, 0x01, 0x04, 0x17, 0x04, 0x02, 0x01, 0x04, 0x17,
+  0x04, 0x02, 0x01, 0x04, 0x16, 0x05, 0x02, 0x00, 0x05, 0x16, 0x05, 0x02,
+  0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x01, 0x06, 0x05,
+  0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x05, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x04, 0x01, 0x15, 0x04, 0x01, 0x15, 0x04, 0x01, 0x14, 0x04,
+  0x01, 0x14, 0x04, 0x01, 0x14, 0x04, 0x01, 0x14, 0x04, 0x01, 0x13, 0x05,
+  0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x01, 0x13, 0x04,
+  0x01, 0x12, 0x05, 0x01, 0x12, 0x04, 0x01, 0x12, 0x04, 0x01, 0x12, 0x04,
+  0x01, 0x12, 0x04, 0x01, 0x11, 0x04, 0x01, 0x11, 0x04, 0x01, 0x11, 0x04,
+  0x01, 0x11, 0x04, 0x01, 0x10, 0x05, 0x01, 0x10, 0x04, 0x01, 0x10, 0x04,
+  0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x00,
+  0x04, 0x0F, 0x05, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F,
+  0x04, 0x02, 0x00, 0x04, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02,
+  0x00, 0x06, 0x0B, 0x06, 0x01, 0x01, 0x10, 0x01, 0x02, 0x0E, 0x01, 0x03,
+  0x0B, 0x01, 0x05, 0x07, 0x02, 0x07, 0x04, 0x1C, 0x06, 0x02, 0x07, 0x04,
+  0x1B, 0x05, 0x02, 0x07, 0x04, 0x1A, 0x05, 0x02, 0x06, 0x05, 0x18, 0x06,
+  0x02, 0x06, 0x05, 0x17, 0x06, 0x02, 0x06, 0x04, 0x16, 0x06, 0x02, 0x06,
+  0x04, 0x15, 0x05, 0x02, 0x05, 0x05, 0x14, 0x05, 0x02, 0x05, 0x05, 0x12,
+  0x06, 0x02, 0x05, 0x04, 0x11, 0x06, 0x02, 0x05, 0x04, 0x10, 0x05, 0x02,
+  0x05, 0x04, 0x0F, 0x05, 0x02, 0x04, 0x05, 0x0E, 0x05, 0x02, 0x04, 0x05,
+  0x0C, 0x06, 0x02, 0x04, 0x04, 0x0B, 0x07, 0x02, 0x04, 0x04, 0x0A, 0x08,
+  0x02, 0x04, 0x04, 0x09, 0x0A, 0x02, 0x03, 0x0A, 0x0E, 0x05, 0x02, 0x03,
+  0x08, 0x0F, 0x04, 0x02, 0x03, 0x07, 0x0F, 0x05, 0x02, 0x03, 0x06, 0x10,
+  0x04, 0x02, 0x02, 0x06, 0x10, 0x05, 0x02, 0x02, 0x05, 0x11, 0x04, 0x02,
+  0x02, 0x04, 0x11, 0x05, 0x02, 0x02, 0x04, 0x11, 0x05, 0x02, 0x02, 0x04,
+  0x12, 0x05, 0x02, 0x01, 0x05, 0x12, 0x05, 0x02, 0x01, 0x05, 0x13, 0x05,
+  0x02, 0x01, 0x04, 0x13, 0x05, 0x02, 0x01, 0x04, 0x14, 0x05, 0x02, 0x01,
+  0x04, 0x14, 0x05, 0x02, 0x00, 0x05, 0x15, 0x05, 0x02, 0x00, 0x04, 0x15,
+  0x05, 0x02, 0x00, 0x04, 0x16, 0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x15, 0x01, 0x00, 0x16, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15,
+  0x02, 0x07, 0x06, 0x21, 0x06, 0x02, 0x07, 0x07, 0x20, 0x07, 0x02, 0x06,
+  0x08, 0x20, 0x07, 0x02, 0x06, 0x08, 0x1F, 0x08, 0x02, 0x06, 0x08, 0x1F,
+  0x07, 0x02, 0x06, 0x08, 0x1E, 0x08, 0x03, 0x06, 0x08, 0x1E, 0x03, 0x22,
+  0x04, 0x02, 0x05, 0x09, 0x1D, 0x09, 0x04, 0x05, 0x04, 0x0A, 0x04, 0x1C,
+  0x04, 0x21, 0x04, 0x04, 0x05, 0x04, 0x0B, 0x04, 0x1C, 0x04, 0x21, 0x04,
+  0x04, 0x05, 0x04, 0x0B, 0x04, 0x1B, 0x04, 0x21, 0x04, 0x04, 0x05, 0x04,
+  0x0B, 0x04, 0x1B, 0x04, 0x21, 0x04, 0x04, 0x04, 0x05, 0x0B, 0x04, 0x1A,
+  0x04, 0x20, 0x05, 0x04, 0x04, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x20, 0x04,
+  0x04, 0x04, 0x04, 0x0B, 0x04, 0x19, 0x04, 0x20, 0x04, 0x04, 0x04, 0x04,
+  0x0B, 0x04, 0x19, 0x03, 0x20, 0x04, 0x04, 0x03, 0x05, 0x0B, 0x04, 0x18,
+  0x04, 0x20, 0x04, 0x04, 0x03, 0x04, 0x0C, 0x04, 0x17, 0x04, 0x1F, 0x05,
+  0x04, 0x03, 0x04, 0x0C, 0x04, 0x17, 0x04, 0x1F, 0x04, 0x04, 0x03, 0x04,
+  0x0C, 0x04, 0x16, 0x04, 0x1F, 0x04, 0x04, 0x03, 0x04, 0x0C, 0x04, 0x16,
+  0x04, 0x1F, 0x04, 0x04, 0x02, 0x05, 0x0C, 0x04, 0x15, 0x04, 0x1E, 0x05,
+  0x04, 0x02, 0x04, 0x0C, 0x04, 0x15, 0x04, 0x1E, 0x04, 0x04, 0x02, 0x04,
+  0x0C, 0x04, 0x14, 0x04, 0x1E, 0x04, 0x04, 0x02, 0x04, 0x0C, 0x04, 0x14,
+  0x03, 0x1E, 0x04, 0x04, 0x02, 0x04, 0x0D, 0x04, 0x13, 0x04, 0x1E, 0x04,
+  0x04, 0x01, 0x05, 0x0D, 0x04, 0x13, 0x03, 0x1D, 0x05, 0x04, 0x01, 0x04,
+  0x0D, 0x04, 0x12, 0x04, 0x1D, 0x04, 0x03, 0x01, 0x04, 0x0D, 0x08, 0x1D,
+  0x04, 0x03, 0x01, 0x04, 0x0D, 0x08, 0x1D, 0x04, 0x03, 0x00, 0x05, 0x0D,
+  0x07, 0x1D, 0x04, 0x03, 0x00, 0x04, 0x0D, 0x07, 0x1C, 0x05, 0x03, 0x00,
+  0x04, 0x0D, 0x06, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0E, 0x04, 0x1C, 0x04,
+  0x02, 0x07, 0x05, 0x1E, 0x04, 0x02, 0x07, 0x06, 0x1D, 0x05, 0x02, 0x06,
+  0x07, 0x1D, 0x04, 0x02, 0x06, 0x07, 0x1D, 0x04, 0x02, 0x06, 0x08, 0x1D,
+  0x04, 0x02, 0x06, 0x08, 0x1C, 0x05, 0x02, 0x06, 0x09, 0x1C, 0x04, 0x02,
+  0x05, 0x0A, 0x1C, 0x04, 0x03, 0x05, 0x04, 0x0B, 0x04, 0x1C, 0x04, 0x03,
+  0x05, 0x04, 0x0B, 0x05, 0x1C, 0x04, 0x03, 0x05, 0x04, 0x0C, 0x04, 0x1B,
+  0x05, 0x03, 0x05, 0x04, 0x0C, 0x05, 0x1B, 0x04, 0x03, 0x04, 0x05, 0x0D,
+  0x04, 0x1B, 0x04, 0x03, 0x04, 0x04, 0x0D, 0x05, 0x1B, 0x04, 0x03, 0x04,
+  0x04, 0x0D, 0x05, 0x1B, 0x04, 0x03, 0x04, 0x04, 0x0E, 0x04, 0x1A, 0x05,
+  0x03, 0x03, 0x05, 0x0E, 0x05, 0x1A, 0x04, 0x03, 0x03, 0x04, 0x0F, 0x04,
+  0x1A, 0x04, 0x03, 0x03, 0x04, 0x0F, 0x05, 0x1A, 0x04, 0x03, 0x03, 0x04,
+  0x0F, 0x05, 0x19, 0x05, 0x03, 0x03, 0x04, 0x10, 0x05, 0x19, 0x04, 0x03,
+  0x02, 0x05, 0x10, 0x05, 0x19, 0x04, 0x03, 0x02, 0x04, 0x11, 0x04, 0x19,
+  0x04, 0x03, 0x02, 0x04, 0x11, 0x05, 0x19, 0x04, 0x03, 0x02, 0x04, 0x12,
+  0x04, 0x18, 0x05, 0x03, 0x02, 0x04, 0x12, 0x05, 0x18, 0x04, 0x03, 0x01,
+  0x05, 0x12, 0x05, 0x18, 0x04, 0x02, 0x01, 0x04, 0x13, 0x09, 0x02, 0x01,
+  0x04, 0x13, 0x09, 0x02, 0x01, 0x04, 0x14, 0x08, 0x02, 0x00, 0x05, 0x14,
+  0x07, 0x02, 0x00, 0x04, 0x15, 0x06, 0x02, 0x00, 0x04, 0x15, 0x06, 0x02,
+  0x00, 0x04, 0x15, 0x06, 0x01, 0x10, 0x08, 0x01, 0x0D, 0x0E, 0x01, 0x0B,
+  0x11, 0x01, 0x09, 0x15, 0x02, 0x08, 0x08, 0x17, 0x07, 0x02, 0x07, 0x06,
+  0x19, 0x06, 0x02, 0x06, 0x05, 0x1A, 0x06, 0x02, 0x05, 0x05, 0x1B, 0x05,
+  0x02, 0x04, 0x05, 0x1C, 0x04, 0x02, 0x04, 0x04, 0x1C, 0x05, 0x02, 0x03,
+  0x05, 0x1D, 0x04, 0x02, 0x03, 0x04, 0x1D, 0x04, 0x02, 0x02, 0x04, 0x1D,
+  0x04, 0x02, 0x02, 0x04, 0x1D, 0x04, 0x02, 0x01, 0x04, 0x1D, 0x04, 0x02,
+  0x01, 0x04, 0x1D, 0x04, 0x02, 0x01, 0x04, 0x1D, 0x04, 0x02, 0x00, 0x04,
+  0x1C, 0x05, 0x02, 0x00, 0x04, 0x1C, 0x04, 0x02, 0x00, 0x04, 0x1C, 0x04,
+  0x02, 0x00, 0x04, 0x1C, 0x04, 0x02, 0x00, 0x04, 0x1B, 0x05, 0x02, 0x00,
+  0x04, 0x1B, 0x04, 0x02, 0x00, 0x04, 0x1B, 0x04, 0x02, 0x00, 0x04, 0x1A,
+  0x05, 0x02, 0x00, 0x04, 0x1A, 0x04, 0x02, 0x00, 0x05, 0x19, 0x05, 0x02,
+  0x01, 0x04, 0x18, 0x05, 0x02, 0x01, 0x05, 0x17, 0x05, 0x02, 0x01, 0x06,
+  0x16, 0x05, 0x02, 0x02, 0x06, 0x14, 0x07, 0x02, 0x03, 0x07, 0x12, 0x08,
+  0x01, 0x03, 0x15, 0x01, 0x05, 0x12, 0x01, 0x06, 0x0F, 0x01, 0x09, 0x09,
+  0x01, 0x07, 0x11, 0x01, 0x07, 0x13, 0x01, 0x07, 0x14, 0x01, 0x06, 0x16,
+  0x02, 0x06, 0x05, 0x16, 0x07, 0x02, 0x06, 0x04, 0x18, 0x05, 0x02, 0x06,
+  0x04, 0x19, 0x04, 0x02, 0x05, 0x05, 0x19, 0x04, 0x02, 0x05, 0x05, 0x19,
+  0x04, 0x02, 0x05, 0x04, 0x19, 0x04, 0x02, 0x05, 0x04, 0x19, 0x04, 0x02,
+  0x05, 0x04, 0x18, 0x04, 0x02, 0x04, 0x05, 0x18, 0x04, 0x02, 0x04, 0x05,
+  0x17, 0x05, 0x02, 0x04, 0x04, 0x16, 0x05, 0x02, 0x04, 0x04, 0x14, 0x06,
+  0x01, 0x04, 0x16, 0x01, 0x03, 0x16, 0x01, 0x03, 0x14, 0x01, 0x03, 0x12,
+  0x01, 0x03, 0x04, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x10, 0x08, 0x01, 0x0D, 0x0E,
+  0x01, 0x0B, 0x11, 0x01, 0x09, 0x15, 0x02, 0x08, 0x08, 0x17, 0x07, 0x02,
+  0x07, 0x06, 0x19, 0x06, 0x02, 0x06, 0x06, 0x1A, 0x06, 0x02, 0x05, 0x05,
+  0x1B, 0x05, 0x02, 0x04, 0x05, 0x1C, 0x04, 0x02, 0x04, 0x04, 0x1C, 0x05,
+  0x02, 0x03, 0x05, 0x1D, 0x04, 0x02, 0x03, 0x04, 0x1D, 0x04, 0x02, 0x02,
+  0x04, 0x1D, 0x04, 0x02, 0x02, 0x04, 0x1D, 0x04, 0x02, 0x01, 0x04, 0x1D,
+  0x04, 0x02, 0x01, 0x04, 0x1D, 0x04, 0x02, 0x01, 0x04, 0x1D, 0x04, 0x02,
+  0x01, 0x03, 0x1D, 0x04, 0x02, 0x00, 0x04, 0x1C, 0x04, 0x02, 0x00, 0x04,
+  0x1C, 0x04, 0x02, 0x00, 0x04, 0x1C, 0x04, 0x02, 0x00, 0x04, 0x1C, 0x04,
+  0x02, 0x00, 0x04, 0x1B, 0x04, 0x02, 0x00, 0x04, 0x1B, 0x04, 0x02, 0x00,
+  0x04, 0x1A, 0x04, 0x03, 0x00, 0x04, 0x13, 0x01, 0x19, 0x05, 0x03, 0x00,
+  0x05, 0x12, 0x03, 0x19, 0x04, 0x03, 0x01, 0x04, 0x11, 0x05, 0x18, 0x05,
+  0x02, 0x01, 0x05, 0x11, 0x0B, 0x02, 0x01, 0x06, 0x12, 0x09, 0x02, 0x02,
+  0x06, 0x13, 0x07, 0x02, 0x03, 0x07, 0x11, 0x09, 0x01, 0x03, 0x18, 0x01,
+  0x05, 0x17, 0x02, 0x06, 0x0E, 0x17, 0x06, 0x02, 0x09, 0x08, 0x18, 0x05,
+  0x01, 0x19, 0x03, 0x00, 0x01, 0x07, 0x13, 0x01, 0x07, 0x15, 0x01, 0x07,
+  0x16, 0x01, 0x06, 0x17, 0x02, 0x06, 0x05, 0x18, 0x06, 0x02, 0x06, 0x04,
+  0x19, 0x05, 0x02, 0x06, 0x04, 0x1A, 0x04, 0x02, 0x05, 0x05, 0x1A, 0x04,
+  0x02, 0x05, 0x05, 0x1A, 0x04, 0x02, 0x05, 0x04, 0x1A, 0x04, 0x02, 0x05,
+  0x04, 0x1A, 0x04, 0x02, 0x05, 0x04, 0x19, 0x04, 0x02, 0x04, 0x05, 0x19,
+  0x04, 0x02, 0x04, 0x05, 0x18, 0x05, 0x02, 0x04, 0x04, 0x17, 0x05, 0x02,
+  0x04, 0x04, 0x15, 0x06, 0x01, 0x04, 0x16, 0x01, 0x03, 0x16, 0x01, 0x03,
+  0x16, 0x01, 0x03, 0x17, 0x02, 0x03, 0x04, 0x15, 0x06, 0x02, 0x02, 0x05,
+  0x16, 0x05, 0x02, 0x02, 0x05, 0x17, 0x04, 0x02, 0x02, 0x04, 0x17, 0x04,
+  0x02, 0x02, 0x04, 0x17, 0x04, 0x02, 0x02, 0x04, 0x17, 0x04, 0x02, 0x01,
+  0x05, 0x17, 0x04, 0x02, 0x01, 0x05, 0x16, 0x04, 0x02, 0x01, 0x04, 0x16,
+  0x04, 0x02, 0x01, 0x04, 0x16, 0x04, 0x02, 0x01, 0x04, 0x16, 0x04, 0x02,
+  0x00, 0x05, 0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04,
+  0x16, 0x04, 0x01, 0x0E, 0x09, 0x01, 0x0B, 0x0E, 0x01, 0x09, 0x12, 0x01,
+  0x08, 0x13, 0x02, 0x07, 0x07, 0x15, 0x07, 0x02, 0x06, 0x05, 0x17, 0x06,
+  0x02, 0x06, 0x04, 0x18, 0x05, 0x02, 0x05, 0x04, 0x19, 0x04, 0x02, 0x05,
+  0x03, 0x19, 0x04, 0x02, 0x04, 0x04, 0x19, 0x04, 0x02, 0x04, 0x04, 0x19,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x06, 0x01, 0x05,
+  0x07, 0x01, 0x05, 0x0B, 0x01, 0x06, 0x0E, 0x01, 0x07, 0x10, 0x01, 0x0A,
+  0x0E, 0x01, 0x0E, 0x0B, 0x01, 0x11, 0x09, 0x01, 0x14, 0x07, 0x01, 0x16,
+  0x05, 0x01, 0x17, 0x04, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x00, 0x04,
+  0x17, 0x04, 0x02, 0x00, 0x04, 0x17, 0x03, 0x02, 0x00, 0x04, 0x16, 0x04,
+  0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x05, 0x15, 0x04, 0x02, 0x01,
+  0x05, 0x13, 0x05, 0x02, 0x01, 0x07, 0x10, 0x07, 0x01, 0x02, 0x14, 0x01,
+  0x03, 0x12, 0x01, 0x04, 0x0F, 0x01, 0x07, 0x09, 0x01, 0x01, 0x1B, 0x01,
+  0x01, 0x1B, 0x01, 0x01, 0x1B, 0x01, 0x01, 0x1A, 0x01, 0x0C, 0x04, 0x01,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01,
+  0x0B, 0x04, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x04, 0x01,
+  0x0A, 0x04, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01,
+  0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x05, 0x01,
+  0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01,
+  0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x05, 0x05, 0x02, 0x05, 0x04, 0x1B, 0x04, 0x02, 0x05, 0x04, 0x1B, 0x04,
+  0x02, 0x05, 0x04, 0x1A, 0x05, 0x02, 0x04, 0x05, 0x1A, 0x05, 0x02, 0x04,
+  0x05, 0x1A, 0x04, 0x02, 0x04, 0x04, 0x1A, 0x04, 0x02, 0x04, 0x04, 0x1A,
+  0x04, 0x02, 0x03, 0x05, 0x19, 0x05, 0x02, 0x03, 0x05, 0x19, 0x05, 0x02,
+  0x03, 0x04, 0x19, 0x04, 0x02, 0x03, 0x04, 0x19, 0x04, 0x02, 0x03, 0x04,
+  0x19, 0x04, 0x02, 0x02, 0x05, 0x18, 0x05, 0x02, 0x02, 0x05, 0x18, 0x05,
+  0x02, 0x02, 0x04, 0x18, 0x04, 0x02, 0x02, 0x04, 0x18, 0x04, 0x02, 0x02,
+  0x04, 0x17, 0x05, 0x02, 0x01, 0x05, 0x17, 0x05, 0x02, 0x01, 0x05, 0x17,
+  0x04, 0x02, 0x01, 0x04, 0x17, 0x04, 0x02, 0x01, 0x04, 0x17, 0x04, 0x02,
+  0x00, 0x05, 0x16, 0x05, 0x02, 0x00, 0x05, 0x16, 0x05, 0x02, 0x00, 0x04,
+  0x16, 0x04, 0x02, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x04, 0x15, 0x05,
+  0x02, 0x00, 0x04, 0x15, 0x04, 0x02, 0x00, 0x04, 0x14, 0x05, 0x02, 0x00,
+  0x05, 0x13, 0x05, 0x02, 0x01, 0x05, 0x12, 0x06, 0x02, 0x01, 0x07, 0x0F,
+  0x08, 0x01, 0x02, 0x14, 0x01, 0x03, 0x11, 0x01, 0x04, 0x0F, 0x01, 0x07,
+  0x09, 0x02, 0x00, 0x05, 0x18, 0x05, 0x02, 0x00, 0x05, 0x17, 0x05, 0x02,
+  0x00, 0x05, 0x17, 0x04, 0x02, 0x00, 0x05, 0x16, 0x05, 0x02, 0x01, 0x04,
+  0x16, 0x04, 0x02, 0x01, 0x04, 0x15, 0x05, 0x02, 0x01, 0x04, 0x15, 0x04,
+  0x02, 0x01, 0x05, 0x14, 0x05, 0x02, 0x01, 0x05, 0x14, 0x04, 0x02, 0x01,
+  0x05, 0x13, 0x05, 0x02, 0x01, 0x05, 0x12, 0x05, 0x02, 0x02, 0x04, 0x12,
+  0x04, 0x02, 0x02, 0x04, 0x11, 0x05, 0x02, 0x02, 0x04, 0x11, 0x04, 0x02,
+  0x02, 0x04, 0x10, 0x05, 0x02, 0x02, 0x05, 0x10, 0x04, 0x02, 0x02, 0x05,
+  0x0F, 0x05, 0x02, 0x02, 0x05, 0x0F, 0x04, 0x02, 0x03, 0x04, 0x0E, 0x04,
+  0x02, 0x03, 0x04, 0x0E, 0x04, 0x02, 0x03, 0x04, 0x0D, 0x04, 0x02, 0x03,
+  0x04, 0x0C, 0x05, 0x02, 0x03, 0x05, 0x0C, 0x04, 0x02, 0x03, 0x05, 0x0B,
+  0x05, 0x02, 0x03, 0x05, 0x0B, 0x04, 0x02, 0x03, 0x05, 0x0A, 0x05, 0x02,
+  0x04, 0x04, 0x0A, 0x04, 0x02, 0x04, 0x04, 0x09, 0x04, 0x02, 0x04, 0x04,
+  0x09, 0x04, 0x01, 0x04, 0x08, 0x01, 0x04, 0x08, 0x01, 0x04, 0x07, 0x01,
+  0x04, 0x07, 0x01, 0x05, 0x05, 0x03, 0x00, 0x04, 0x13, 0x05, 0x26, 0x04,
+  0x03, 0x00, 0x04, 0x12, 0x06, 0x25, 0x05, 0x03, 0x00, 0x04, 0x12, 0x06,
+  0x25, 0x04, 0x03, 0x00, 0x04, 0x11, 0x07, 0x24, 0x05, 0x03, 0x00, 0x04,
+  0x11, 0x07, 0x24, 0x05, 0x03, 0x00, 0x04, 0x10, 0x08, 0x23, 0x05, 0x03,
+  0x00, 0x04, 0x0F, 0x09, 0x23, 0x05, 0x04, 0x00, 0x04, 0x0F, 0x04, 0x14,
+  0x04, 0x22, 0x05, 0x04, 0x00, 0x04, 0x0E, 0x05, 0x14, 0x04, 0x22, 0x05,
+  0x04, 0x00, 0x04, 0x0E, 0x04, 0x14, 0x04, 0x21, 0x05, 0x04, 0x00, 0x04,
+  0x0D, 0x05, 0x14, 0x04, 0x21, 0x05, 0x04, 0x00, 0x04, 0x0D, 0x04, 0x14,
+  0x04, 0x21, 0x04, 0x04, 0x00, 0x04, 0x0C, 0x05, 0x14, 0x04, 0x20, 0x05,
+  0x04, 0x01, 0x03, 0x0C, 0x04, 0x14, 0x04, 0x20, 0x04, 0x04, 0x01, 0x03,
+  0x0B, 0x05, 0x15, 0x03, 0x1F, 0x05, 0x04, 0x01, 0x03, 0x0B, 0x04, 0x15,
+  0x04, 0x1F, 0x04, 0x04, 0x01, 0x03, 0x0A, 0x05, 0x15, 0x04, 0x1E, 0x05,
+  0x04, 0x01, 0x03, 0x0A, 0x04, 0x15, 0x04, 0x1E, 0x04, 0x04, 0x01, 0x03,
+  0x09, 0x05, 0x15, 0x04, 0x1D, 0x05, 0x04, 0x01, 0x04, 0x09, 0x04, 0x15,
+  0x04, 0x1D, 0x05, 0x04, 0x01, 0x04, 0x08, 0x05, 0x15, 0x04, 0x1D, 0x04,
+  0x04, 0x01, 0x04, 0x08, 0x04, 0x15, 0x04, 0x1C, 0x05, 0x04, 0x01, 0x04,
+  0x07, 0x05, 0x15, 0x04, 0x1C, 0x04, 0x04, 0x01, 0x04, 0x07, 0x04, 0x15,
+  0x04, 0x1B, 0x05, 0x04, 0x01, 0x04, 0x06, 0x05, 0x15, 0x04, 0x1B, 0x04,
+  0x04, 0x01, 0x04, 0x06, 0x04, 0x15, 0x04, 0x1A, 0x05, 0x03, 0x01, 0x09,
+  0x15, 0x04, 0x1A, 0x04, 0x02, 0x01, 0x08, 0x15, 0x09, 0x02, 0x01, 0x08,
+  0x15, 0x08, 0x02, 0x01, 0x07, 0x16, 0x07, 0x02, 0x01, 0x07, 0x16, 0x06,
+  0x02, 0x01, 0x06, 0x16, 0x06, 0x02, 0x01, 0x06, 0x16, 0x05, 0x02, 0x01,
+  0x05, 0x16, 0x05, 0x02, 0x08, 0x06, 0x1E, 0x06, 0x02, 0x09, 0x05, 0x1E,
+  0x05, 0x02, 0x09, 0x05, 0x1D, 0x05, 0x02, 0x0A, 0x05, 0x1C, 0x05, 0x02,
+  0x0A, 0x05, 0x1B, 0x05, 0x02, 0x0B, 0x05, 0x1A, 0x05, 0x02, 0x0B, 0x05,
+  0x19, 0x05, 0x02, 0x0C, 0x05, 0x18, 0x05, 0x02, 0x0C, 0x05, 0x17, 0x05,
+  0x02, 0x0D, 0x05, 0x17, 0x05, 0x02, 0x0D, 0x05, 0x16, 0x05, 0x02, 0x0D,
+  0x05, 0x15, 0x05, 0x02, 0x0E, 0x05, 0x14, 0x05, 0x01, 0x0E, 0x0A, 0x01,
+  0x0F, 0x08, 0x01, 0x0F, 0x07, 0x01, 0x10, 0x05, 0x01, 0x0F, 0x07, 0x01,
+  0x0E, 0x08, 0x01, 0x0D, 0x09, 0x02, 0x0C, 0x05, 0x12, 0x05, 0x02, 0x0B,
+  0x05, 0x12, 0x05, 0x02, 0x0A, 0x05, 0x13, 0x05, 0x02, 0x0A, 0x05, 0x13,
+  0x05, 0x02, 0x09, 0x05, 0x14, 0x05, 0x02, 0x08, 0x05, 0x14, 0x05, 0x02,
+  0x07, 0x05, 0x15, 0x05, 0x02, 0x06, 0x05, 0x15, 0x05, 0x02, 0x05, 0x05,
+  0x16, 0x05, 0x02, 0x04, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x16, 0x06,
+  0x02, 0x02, 0x06, 0x17, 0x05, 0x02, 0x01, 0x06, 0x17, 0x06, 0x02, 0x00,
+  0x06, 0x18, 0x05, 0x02, 0x00, 0x05, 0x19, 0x05, 0x02, 0x01, 0x05, 0x18,
+  0x05, 0x02, 0x01, 0x05, 0x17, 0x05, 0x02, 0x01, 0x06, 0x16, 0x05, 0x02,
+  0x02, 0x05, 0x16, 0x05, 0x02, 0x02, 0x05, 0x15, 0x05, 0x02, 0x03, 0x05,
+  0x14, 0x05, 0x02, 0x03, 0x05, 0x13, 0x05, 0x02, 0x04, 0x04, 0x12, 0x05,
+  0x02, 0x04, 0x05, 0x11, 0x05, 0x02, 0x04, 0x05, 0x11, 0x05, 0x02, 0x05,
+  0x05, 0x10, 0x05, 0x02, 0x05, 0x05, 0x0F, 0x05, 0x02, 0x06, 0x04, 0x0E,
+  0x05, 0x02, 0x06, 0x05, 0x0D, 0x05, 0x02, 0x07, 0x04, 0x0D, 0x04, 0x01,
+  0x07, 0x0A, 0x01, 0x07, 0x09, 0x01, 0x08, 0x07, 0x01, 0x08, 0x06, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01,
+  0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01,
+  0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x09, 0x19, 0x01, 0x09, 0x18, 0x01,
+  0x09, 0x18, 0x01, 0x08, 0x19, 0x01, 0x1B, 0x05, 0x01, 0x1A, 0x05, 0x01,
+  0x19, 0x05, 0x01, 0x18, 0x05, 0x01, 0x17, 0x05, 0x01, 0x16, 0x05, 0x01,
+  0x15, 0x05, 0x01, 0x14, 0x05, 0x01, 0x13, 0x05, 0x01, 0x12, 0x05, 0x01,
+  0x11, 0x05, 0x01, 0x10, 0x05, 0x01, 0x0F, 0x05, 0x01, 0x0E, 0x05, 0x01,
+  0x0D, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x05, 0x01,
+  0x09, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x05, 0x01, 0x06, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x05, 0x01,
+  0x01, 0x1A, 0x01, 0x01, 0x1A, 0x01, 0x01, 0x1A, 0x01, 0x01, 0x1A, 0x01,
+  0x09, 0x09, 0x01, 0x09, 0x09, 0x01, 0x09, 0x09, 0x01, 0x09, 0x08, 0x01,
+  0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01,
+  0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x05, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x09, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01,
+  0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
+  0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x09, 0x09, 0x01,
+  0x09, 0x09, 0x01, 0x09, 0x09, 0x01, 0x08, 0x09, 0x01, 0x0D, 0x04, 0x01,
+  0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x04, 0x01,
+  0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0B, 0x04, 0x01,
+  0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0A, 0x05, 0x01,
+  0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01,
+  0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01,
+  0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x01, 0x08, 0x01,
+  0x00, 0x09, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x01, 0x0A, 0x04, 0x01,
+  0x0A, 0x04, 0x01, 0x09, 0x05, 0x01, 0x08, 0x07, 0x02, 0x08, 0x03, 0x0C,
+  0x03, 0x02, 0x07, 0x03, 0x0C, 0x03, 0x02, 0x06, 0x04, 0x0C, 0x03, 0x02,
+  0x06, 0x03, 0x0C, 0x03, 0x02, 0x05, 0x03, 0x0C, 0x03, 0x02, 0x05, 0x03,
+  0x0D, 0x03, 0x02, 0x04, 0x03, 0x0D, 0x03, 0x02, 0x03, 0x04, 0x0D, 0x03,
+  0x02, 0x03, 0x03, 0x0D, 0x03, 0x02, 0x02, 0x03, 0x0D, 0x03, 0x02, 0x01,
+  0x04, 0x0E, 0x03, 0x02, 0x01, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x04, 0x0E,
+  0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x01, 0x01, 0x1C, 0x01, 0x00, 0x1D,
+  0x01, 0x00, 0x05, 0x01, 0x01, 0x04, 0x01, 0x02, 0x04, 0x01, 0x03, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x05, 0x03, 0x01, 0x0B, 0x08,
+  0x01, 0x08, 0x0D, 0x01, 0x07, 0x0F, 0x01, 0x06, 0x11, 0x02, 0x05, 0x06,
+  0x11, 0x06, 0x02, 0x04, 0x05, 0x12, 0x05, 0x02, 0x04, 0x04, 0x13, 0x04,
+  0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x01, 0x13, 0x03, 0x01, 0x12, 0x04,
+  0x01, 0x10, 0x06, 0x01, 0x08, 0x0E, 0x01, 0x05, 0x10, 0x02, 0x03, 0x0C,
+  0x11, 0x04, 0x02, 0x02, 0x07, 0x11, 0x04, 0x02, 0x01, 0x05, 0x11, 0x04,
+  0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00,
+  0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x05, 0x02, 0x00, 0x04, 0x0E,
+  0x06, 0x02, 0x00, 0x06, 0x0B, 0x09, 0x02, 0x01, 0x0E, 0x10, 0x06, 0x02,
+  0x01, 0x0D, 0x10, 0x06, 0x02, 0x02, 0x0B, 0x11, 0x05, 0x02, 0x04, 0x06,
+  0x12, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x05, 0x04, 0x02, 0x05, 0x04, 0x0E, 0x05, 0x02, 0x05, 0x04, 0x0C, 0x09,
+  0x02, 0x05, 0x04, 0x0A, 0x0C, 0x01, 0x05, 0x12, 0x03, 0x04, 0x04, 0x09,
+  0x04, 0x12, 0x06, 0x02, 0x04, 0x07, 0x13, 0x05, 0x02, 0x04, 0x06, 0x14,
+  0x05, 0x02, 0x04, 0x05, 0x15, 0x04, 0x02, 0x03, 0x06, 0x15, 0x04, 0x02,
+  0x03, 0x05, 0x15, 0x04, 0x02, 0x03, 0x04, 0x15, 0x04, 0x02, 0x03, 0x04,
+  0x15, 0x04, 0x02, 0x03, 0x04, 0x15, 0x04, 0x02, 0x02, 0x05, 0x15, 0x04,
+  0x02, 0x02, 0x04, 0x14, 0x04, 0x02, 0x02, 0x04, 0x14, 0x04, 0x02, 0x02,
+  0x04, 0x14, 0x04, 0x02, 0x02, 0x04, 0x13, 0x05, 0x02, 0x01, 0x05, 0x13,
+  0x04, 0x02, 0x01, 0x06, 0x12, 0x05, 0x02, 0x01, 0x06, 0x11, 0x05, 0x02,
+  0x01, 0x07, 0x10, 0x05, 0x02, 0x01, 0x08, 0x0E, 0x06, 0x02, 0x00, 0x04,
+  0x05, 0x0F, 0x02, 0x00, 0x04, 0x06, 0x0C, 0x02, 0x00, 0x04, 0x07, 0x0A,
+  0x01, 0x09, 0x06, 0x01, 0x0A, 0x07, 0x01, 0x08, 0x0B, 0x01, 0x06, 0x0E,
+  0x01, 0x05, 0x10, 0x02, 0x04, 0x07, 0x10, 0x05, 0x02, 0x03, 0x06, 0x11,
+  0x05, 0x02, 0x03, 0x05, 0x12, 0x04, 0x02, 0x02, 0x05, 0x12, 0x04, 0x02,
+  0x02, 0x04, 0x12, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04,
+  0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x05, 0x0F, 0x04, 0x02, 0x01,
+  0x05, 0x0E, 0x05, 0x02, 0x01, 0x06, 0x0C, 0x06, 0x01, 0x02, 0x0F, 0x01,
+  0x02, 0x0E, 0x01, 0x03, 0x0C, 0x01, 0x05, 0x07, 0x01, 0x16, 0x05, 0x01,
+  0x16, 0x04, 0x01, 0x16, 0x04, 0x01, 0x16, 0x04, 0x01, 0x16, 0x04, 0x01,
+  0x15, 0x05, 0x01, 0x15, 0x04, 0x01, 0x15, 0x04, 0x02, 0x0A, 0x06, 0x15,
+  0x04, 0x02, 0x08, 0x0A, 0x15, 0x04, 0x02, 0x06, 0x0C, 0x14, 0x05, 0x02,
+  0x05, 0x0E, 0x14, 0x04, 0x02, 0x04, 0x06, 0x0F, 0x09, 0x02, 0x03, 0x06,
+  0x11, 0x07, 0x02, 0x03, 0x05, 0x12, 0x06, 0x02, 0x02, 0x05, 0x12, 0x05,
+  0x02, 0x02, 0x04, 0x12, 0x05, 0x02, 0x01, 0x05, 0x12, 0x05, 0x02, 0x01,
+  0x04, 0x13, 0x04, 0x02, 0x01, 0x04, 0x12, 0x05, 0x02, 0x00, 0x05, 0x12,
+  0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02,
+  0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x11, 0x05, 0x02, 0x00, 0x04,
+  0x11, 0x04, 0x02, 0x00, 0x04, 0x10, 0x05, 0x02, 0x00, 0x04, 0x10, 0x05,
+  0x02, 0x00, 0x05, 0x0F, 0x06, 0x02, 0x01, 0x05, 0x0E, 0x07, 0x02, 0x01,
+  0x06, 0x0C, 0x08, 0x01, 0x01, 0x13, 0x02, 0x02, 0x0D, 0x10, 0x04, 0x02,
+  0x03, 0x0A, 0x10, 0x04, 0x01, 0x05, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x08,
+  0x0B, 0x01, 0x07, 0x0E, 0x01, 0x05, 0x10, 0x02, 0x04, 0x07, 0x10, 0x06,
+  0x02, 0x04, 0x05, 0x12, 0x05, 0x02, 0x03, 0x05, 0x12, 0x05, 0x02, 0x03,
+  0x04, 0x13, 0x04, 0x02, 0x02, 0x04, 0x13, 0x04, 0x02, 0x02, 0x04, 0x13,
+  0x04, 0x02, 0x01, 0x04, 0x13, 0x04, 0x01, 0x01, 0x16, 0x01, 0x01, 0x16,
+  0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02,
+  0x00, 0x05, 0x10, 0x04, 0x02, 0x01, 0x05, 0x0F, 0x05, 0x02, 0x01, 0x06,
+  0x0D, 0x06, 0x01, 0x02, 0x10, 0x01, 0x03, 0x0E, 0x01, 0x04, 0x0B, 0x01,
+  0x06, 0x07, 0x01, 0x0A, 0x05, 0x01, 0x08, 0x07, 0x01, 0x07, 0x08, 0x01,
+  0x07, 0x07, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0B, 0x01,
+  0x01, 0x0C, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x05, 0x01, 0x03, 0x04, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x0C, 0x06, 0x02,
+  0x0A, 0x0A, 0x17, 0x04, 0x02, 0x09, 0x0C, 0x17, 0x03, 0x02, 0x07, 0x0F,
+  0x17, 0x03, 0x02, 0x07, 0x06, 0x12, 0x08, 0x02, 0x06, 0x05, 0x13, 0x07,
+  0x02, 0x05, 0x05, 0x14, 0x06, 0x02, 0x05, 0x04, 0x14, 0x05, 0x02, 0x04,
+  0x04, 0x14, 0x05, 0x02, 0x04, 0x04, 0x14, 0x05, 0x02, 0x03, 0x04, 0x14,
+  0x05, 0x02, 0x03, 0x04, 0x14, 0x05, 0x02, 0x03, 0x04, 0x14, 0x04, 0x02,
+  0x03, 0x03, 0x14, 0x04, 0x02, 0x02, 0x04, 0x14, 0x04, 0x02, 0x02, 0x04,
+  0x13, 0x05, 0x02, 0x02, 0x04, 0x13, 0x05, 0x02, 0x02, 0x04, 0x13, 0x04,
+  0x02, 0x02, 0x04, 0x12, 0x05, 0x02, 0x02, 0x04, 0x11, 0x06, 0x02, 0x02,
+  0x05, 0x11, 0x06, 0x02, 0x03, 0x05, 0x10, 0x06, 0x02, 0x03, 0x06, 0x0E,
+  0x08, 0x02, 0x04, 0x0D, 0x12, 0x04, 0x02, 0x04, 0x0C, 0x12, 0x04, 0x02,
+  0x05, 0x0A, 0x11, 0x04, 0x02, 0x07, 0x06, 0x11, 0x04, 0x01, 0x11, 0x04,
+  0x01, 0x10, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x05, 0x02, 0x00, 0x04, 0x0E,
+  0x05, 0x02, 0x00, 0x06, 0x0C, 0x07, 0x01, 0x01, 0x11, 0x01, 0x01, 0x10,
+  0x01, 0x03, 0x0C, 0x01, 0x05, 0x08, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04,
+  0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x02, 0x05, 0x04, 0x0E, 0x06, 0x02,
+  0x05, 0x04, 0x0C, 0x09, 0x02, 0x05, 0x04, 0x0A, 0x0C, 0x01, 0x05, 0x11,
+  0x02, 0x04, 0x09, 0x11, 0x06, 0x02, 0x04, 0x07, 0x12, 0x05, 0x02, 0x04,
+  0x06, 0x13, 0x04, 0x02, 0x04, 0x05, 0x13, 0x04, 0x02, 0x03, 0x05, 0x13,
+  0x04, 0x02, 0x03, 0x05, 0x13, 0x04, 0x02, 0x03, 0x04, 0x13, 0x04, 0x02,
+  0x03, 0x04, 0x12, 0x04, 0x02, 0x03, 0x04, 0x12, 0x04, 0x02, 0x02, 0x05,
+  0x12, 0x04, 0x02, 0x02, 0x04, 0x12, 0x04, 0x02, 0x02, 0x04, 0x12, 0x04,
+  0x02, 0x02, 0x04, 0x11, 0x04, 0x02, 0x02, 0x04, 0x11, 0x04, 0x02, 0x01,
+  0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x10,
+  0x05, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02,
+  0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04,
+  0x0F, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04,
+  0x01, 0x0D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x05, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0A,
+  0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A,
+  0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09,
+  0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06,
+  0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x04, 0x01, 0x04, 0x05, 0x01, 0x01, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06,
+  0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x02, 0x05, 0x04, 0x13, 0x05,
+  0x02, 0x05, 0x04, 0x12, 0x05, 0x02, 0x05, 0x04, 0x11, 0x05, 0x02, 0x04,
+  0x04, 0x0F, 0x05, 0x02, 0x04, 0x04, 0x0E, 0x05, 0x02, 0x04, 0x04, 0x0D,
+  0x05, 0x02, 0x04, 0x04, 0x0C, 0x05, 0x02, 0x03, 0x05, 0x0B, 0x05, 0x02,
+  0x03, 0x04, 0x0A, 0x04, 0x02, 0x03, 0x04, 0x08, 0x07, 0x01, 0x03, 0x0C,
+  0x02, 0x03, 0x07, 0x0B, 0x04, 0x02, 0x02, 0x07, 0x0B, 0x05, 0x02, 0x02,
+  0x06, 0x0C, 0x04, 0x02, 0x02, 0x05, 0x0C, 0x05, 0x02, 0x02, 0x04, 0x0D,
+  0x04, 0x02, 0x02, 0x04, 0x0D, 0x04, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x02,
+  0x01, 0x04, 0x0E, 0x04, 0x02, 0x01, 0x04, 0x0E, 0x05, 0x02, 0x01, 0x04,
+  0x0F, 0x04, 0x02, 0x01, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x05,
+  0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x05, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06,
+  0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x02, 0x0D, 0x06, 0x1B, 0x06, 0x03, 0x04, 0x05,
+  0x0B, 0x09, 0x19, 0x09, 0x03, 0x04, 0x04, 0x0A, 0x0B, 0x18, 0x0B, 0x03,
+  0x04, 0x04, 0x09, 0x0C, 0x17, 0x0D, 0x03, 0x04, 0x08, 0x10, 0x0A, 0x1E,
+  0x06, 0x03, 0x04, 0x06, 0x11, 0x08, 0x1F, 0x05, 0x03, 0x03, 0x06, 0x12,
+  0x06, 0x20, 0x04, 0x03, 0x03, 0x05, 0x12, 0x05, 0x20, 0x04, 0x03, 0x03,
+  0x04, 0x12, 0x04, 0x20, 0x04, 0x03, 0x03, 0x04, 0x12, 0x04, 0x20, 0x04,
+  0x03, 0x03, 0x04, 0x12, 0x04, 0x20, 0x04, 0x03, 0x03, 0x04, 0x11, 0x04,
+  0x20, 0x04, 0x03, 0x02, 0x04, 0x11, 0x04, 0x1F, 0x05, 0x03, 0x02, 0x04,
+  0x11, 0x04, 0x1F, 0x04, 0x03, 0x02, 0x04, 0x11, 0x04, 0x1F, 0x04, 0x03,
+  0x02, 0x04, 0x10, 0x05, 0x1F, 0x04, 0x03, 0x02, 0x04, 0x10, 0x04, 0x1F,
+  0x04, 0x03, 0x01, 0x05, 0x10, 0x04, 0x1E, 0x04, 0x03, 0x01, 0x04, 0x10,
+  0x04, 0x1E, 0x04, 0x03, 0x01, 0x04, 0x10, 0x04, 0x1E, 0x04, 0x03, 0x01,
+  0x04, 0x0F, 0x04, 0x1E, 0x04, 0x03, 0x01, 0x04, 0x0F, 0x04, 0x1E, 0x04,
+  0x03, 0x00, 0x05, 0x0F, 0x04, 0x1D, 0x04, 0x03, 0x00, 0x04, 0x0F, 0x04,
+  0x1D, 0x04, 0x03, 0x00, 0x04, 0x0F, 0x04, 0x1D, 0x04, 0x03, 0x00, 0x04,
+  0x0E, 0x04, 0x1D, 0x04, 0x01, 0x0D, 0x06, 0x02, 0x04, 0x05, 0x0B, 0x0A,
+  0x02, 0x04, 0x04, 0x0A, 0x0C, 0x02, 0x04, 0x04, 0x09, 0x0D, 0x02, 0x04,
+  0x08, 0x11, 0x06, 0x02, 0x04, 0x06, 0x12, 0x05, 0x02, 0x03, 0x06, 0x13,
+  0x04, 0x02, 0x03, 0x05, 0x13, 0x04, 0x02, 0x03, 0x05, 0x13, 0x04, 0x02,
+  0x03, 0x04, 0x13, 0x04, 0x02, 0x03, 0x04, 0x13, 0x04, 0x02, 0x03, 0x04,
+  0x12, 0x04, 0x02, 0x02, 0x04, 0x12, 0x04, 0x02, 0x02, 0x04, 0x12, 0x04,
+  0x02, 0x02, 0x04, 0x12, 0x04, 0x02, 0x02, 0x04, 0x11, 0x05, 0x02, 0x02,
+  0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x11,
+  0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x10, 0x05, 0x02,
+  0x01, 0x04, 0x10, 0x04, 0x02, 0x00, 0x05, 0x10, 0x04, 0x02, 0x00, 0x04,
+  0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04,
+  0x01, 0x0B, 0x06, 0x01, 0x08, 0x0B, 0x01, 0x06, 0x0F, 0x01, 0x05, 0x10,
+  0x02, 0x04, 0x07, 0x10, 0x06, 0x02, 0x04, 0x05, 0x11, 0x05, 0x02, 0x03,
+  0x05, 0x12, 0x05, 0x02, 0x03, 0x04, 0x13, 0x04, 0x02, 0x02, 0x04, 0x13,
+  0x04, 0x02, 0x02, 0x04, 0x13, 0x04, 0x02, 0x01, 0x04, 0x13, 0x04, 0x02,
+  0x01, 0x04, 0x13, 0x04, 0x02, 0x01, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04,
+  0x13, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04,
+  0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x00,
+  0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x05, 0x0F,
+  0x05, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x02, 0x01, 0x06, 0x0C, 0x07, 0x01,
+  0x02, 0x10, 0x01, 0x02, 0x0E, 0x01, 0x04, 0x0B, 0x01, 0x06, 0x06, 0x01,
+  0x10, 0x06, 0x02, 0x07, 0x04, 0x0E, 0x0A, 0x02, 0x07, 0x04, 0x0C, 0x0D,
+  0x01, 0x06, 0x13, 0x03, 0x06, 0x04, 0x0B, 0x04, 0x14, 0x06, 0x02, 0x06,
+  0x07, 0x15, 0x05, 0x02, 0x06, 0x06, 0x16, 0x05, 0x02, 0x06, 0x05, 0x17,
+  0x04, 0x02, 0x05, 0x05, 0x17, 0x04, 0x02, 0x05, 0x05, 0x17, 0x04, 0x02,
+  0x05, 0x05, 0x17, 0x04, 0x02, 0x05, 0x04, 0x17, 0x04, 0x02, 0x05, 0x04,
+  0x17, 0x04, 0x02, 0x04, 0x05, 0x17, 0x04, 0x02, 0x04, 0x04, 0x16, 0x04,
+  0x02, 0x04, 0x04, 0x16, 0x04, 0x02, 0x04, 0x04, 0x16, 0x04, 0x02, 0x03,
+  0x05, 0x15, 0x05, 0x02, 0x03, 0x05, 0x15, 0x04, 0x02, 0x03, 0x05, 0x14,
+  0x05, 0x02, 0x03, 0x06, 0x13, 0x05, 0x02, 0x03, 0x07, 0x12, 0x05, 0x02,
+  0x02, 0x09, 0x10, 0x07, 0x02, 0x02, 0x04, 0x07, 0x0F, 0x02, 0x02, 0x04,
+  0x08, 0x0D, 0x02, 0x02, 0x04, 0x09, 0x0A, 0x02, 0x02, 0x04, 0x0A, 0x07,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x0B, 0x06, 0x02, 0x08, 0x0B, 0x16, 0x04, 0x02,
+  0x07, 0x0D, 0x16, 0x04, 0x02, 0x06, 0x0E, 0x15, 0x05, 0x02, 0x05, 0x06,
+  0x10, 0x09, 0x02, 0x04, 0x05, 0x11, 0x08, 0x02, 0x03, 0x05, 0x12, 0x07,
+  0x02, 0x03, 0x04, 0x12, 0x07, 0x02, 0x02, 0x04, 0x13, 0x06, 0x02, 0x02,
+  0x04, 0x13, 0x05, 0x02, 0x01, 0x04, 0x13, 0x05, 0x02, 0x01, 0x04, 0x13,
+  0x05, 0x02, 0x01, 0x04, 0x13, 0x05, 0x02, 0x00, 0x04, 0x12, 0x05, 0x02,
+  0x00, 0x04, 0x12, 0x05, 0x02, 0x00, 0x04, 0x12, 0x05, 0x02, 0x00, 0x04,
+  0x12, 0x05, 0x02, 0x00, 0x04, 0x11, 0x06, 0x02, 0x00, 0x04, 0x10, 0x06,
+  0x02, 0x00, 0x04, 0x10, 0x06, 0x02, 0x00, 0x05, 0x0F, 0x07, 0x02, 0x01,
+  0x05, 0x0E, 0x08, 0x02, 0x01, 0x06, 0x0C, 0x0A, 0x02, 0x02, 0x0E, 0x11,
+  0x04, 0x02, 0x03, 0x0C, 0x11, 0x04, 0x02, 0x04, 0x0A, 0x10, 0x05, 0x02,
+  0x06, 0x06, 0x10, 0x05, 0x01, 0x10, 0x04, 0x01, 0x10, 0x04, 0x01, 0x10,
+  0x04, 0x01, 0x0F, 0x05, 0x01, 0x0F, 0x05, 0x01, 0x0F, 0x04, 0x01, 0x0F,
+  0x04, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0D, 0x04, 0x02, 0x04,
+  0x05, 0x0B, 0x06, 0x02, 0x04, 0x04, 0x0A, 0x07, 0x02, 0x04, 0x04, 0x09,
+  0x07, 0x01, 0x04, 0x09, 0x01, 0x04, 0x07, 0x01, 0x03, 0x06, 0x01, 0x03,
+  0x06, 0x01, 0x03, 0x05, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x0A, 0x07, 0x01, 0x08,
+  0x0B, 0x01, 0x06, 0x0E, 0x01, 0x05, 0x0F, 0x02, 0x04, 0x06, 0x0F, 0x06,
+  0x02, 0x04, 0x04, 0x11, 0x04, 0x02, 0x03, 0x05, 0x11, 0x04, 0x02, 0x03,
+  0x04, 0x11, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x08, 0x01, 0x04, 0x0B, 0x01, 0x05, 0x0C, 0x01, 0x07, 0x0C,
+  0x01, 0x0A, 0x0A, 0x01, 0x0E, 0x06, 0x01, 0x10, 0x04, 0x02, 0x00, 0x04,
+  0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x05,
+  0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x06, 0x0D, 0x06, 0x01, 0x01,
+  0x11, 0x01, 0x01, 0x10, 0x01, 0x03, 0x0C, 0x01, 0x05, 0x08, 0x01, 0x06,
+  0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x04, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x0C, 0x01, 0x01,
+  0x0B, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x08, 0x01, 0x00, 0x08, 0x01, 0x01, 0x06, 0x01, 0x02, 0x05, 0x02, 0x04,
+  0x04, 0x14, 0x04, 0x02, 0x04, 0x04, 0x13, 0x04, 0x02, 0x04, 0x04, 0x13,
+  0x04, 0x02, 0x03, 0x05, 0x13, 0x04, 0x02, 0x03, 0x04, 0x13, 0x04, 0x02,
+  0x03, 0x04, 0x13, 0x04, 0x02, 0x03, 0x04, 0x12, 0x04, 0x02, 0x03, 0x04,
+  0x12, 0x04, 0x02, 0x02, 0x05, 0x12, 0x04, 0x02, 0x02, 0x04, 0x12, 0x04,
+  0x02, 0x02, 0x04, 0x12, 0x04, 0x02, 0x02, 0x04, 0x11, 0x05, 0x02, 0x02,
+  0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x11,
+  0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x10, 0x05, 0x02,
+  0x01, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x05, 0x02, 0x00, 0x04,
+  0x0E, 0x06, 0x02, 0x00, 0x04, 0x0D, 0x07, 0x02, 0x00, 0x05, 0x0B, 0x09,
+  0x01, 0x00, 0x13, 0x02, 0x01, 0x0D, 0x0F, 0x04, 0x02, 0x02, 0x0A, 0x0F,
+  0x04, 0x01, 0x03, 0x07, 0x02, 0x00, 0x04, 0x11, 0x05, 0x02, 0x00, 0x04,
+  0x11, 0x04, 0x02, 0x00, 0x04, 0x10, 0x05, 0x02, 0x00, 0x04, 0x10, 0x04,
+  0x02, 0x01, 0x04, 0x0F, 0x04, 0x02, 0x01, 0x04, 0x0F, 0x04, 0x02, 0x01,
+  0x04, 0x0E, 0x04, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x02, 0x01, 0x04, 0x0D,
+  0x04, 0x02, 0x01, 0x04, 0x0C, 0x05, 0x02, 0x01, 0x04, 0x0C, 0x04, 0x02,
+  0x01, 0x04, 0x0B, 0x04, 0x02, 0x02, 0x03, 0x0B, 0x04, 0x02, 0x02, 0x04,
+  0x0A, 0x04, 0x02, 0x02, 0x04, 0x09, 0x05, 0x02, 0x02, 0x04, 0x09, 0x04,
+  0x02, 0x02, 0x04, 0x08, 0x04, 0x02, 0x02, 0x04, 0x08, 0x04, 0x02, 0x02,
+  0x04, 0x07, 0x04, 0x02, 0x03, 0x03, 0x07, 0x04, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x03,
+  0x00, 0x04, 0x0D, 0x05, 0x1C, 0x04, 0x03, 0x00, 0x04, 0x0D, 0x05, 0x1B,
+  0x05, 0x03, 0x00, 0x04, 0x0C, 0x06, 0x1B, 0x04, 0x03, 0x00, 0x04, 0x0C,
+  0x06, 0x1B, 0x04, 0x03, 0x00, 0x04, 0x0C, 0x06, 0x1A, 0x04, 0x03, 0x00,
+  0x04, 0x0B, 0x07, 0x1A, 0x04, 0x04, 0x00, 0x04, 0x0B, 0x03, 0x0F, 0x03,
+  0x19, 0x04, 0x04, 0x01, 0x03, 0x0A, 0x04, 0x0F, 0x03, 0x19, 0x04, 0x04,
+  0x01, 0x03, 0x0A, 0x03, 0x0F, 0x03, 0x18, 0x04, 0x04, 0x01, 0x03, 0x09,
+  0x04, 0x0F, 0x03, 0x18, 0x04, 0x04, 0x01, 0x03, 0x09, 0x04, 0x0F, 0x04,
+  0x17, 0x04, 0x04, 0x01, 0x04, 0x08, 0x04, 0x0F, 0x04, 0x17, 0x04, 0x04,
+  0x01, 0x04, 0x08, 0x04, 0x0F, 0x04, 0x16, 0x04, 0x04, 0x01, 0x04, 0x08,
+  0x03, 0x0F, 0x04, 0x16, 0x04, 0x04, 0x01, 0x04, 0x07, 0x04, 0x0F, 0x04,
+  0x15, 0x04, 0x04, 0x01, 0x04, 0x07, 0x03, 0x10, 0x03, 0x15, 0x04, 0x04,
+  0x01, 0x04, 0x06, 0x04, 0x10, 0x03, 0x14, 0x04, 0x04, 0x01, 0x04, 0x06,
+  0x03, 0x10, 0x03, 0x14, 0x04, 0x02, 0x01, 0x08, 0x10, 0x07, 0x02, 0x01,
+  0x08, 0x10, 0x07, 0x02, 0x01, 0x07, 0x10, 0x06, 0x02, 0x02, 0x06, 0x10,
+  0x06, 0x02, 0x02, 0x05, 0x10, 0x05, 0x02, 0x02, 0x05, 0x10, 0x05, 0x02,
+  0x02, 0x04, 0x10, 0x04, 0x02, 0x06, 0x04, 0x15, 0x05, 0x02, 0x06, 0x05,
+  0x15, 0x04, 0x02, 0x07, 0x04, 0x14, 0x04, 0x02, 0x07, 0x04, 0x13, 0x04,
+  0x02, 0x08, 0x04, 0x12, 0x04, 0x02, 0x08, 0x04, 0x11, 0x05, 0x02, 0x08,
+  0x05, 0x10, 0x05, 0x02, 0x09, 0x04, 0x0F, 0x05, 0x02, 0x09, 0x05, 0x0F,
+  0x04, 0x01, 0x0A, 0x08, 0x01, 0x0A, 0x07, 0x01, 0x0B, 0x05, 0x01, 0x0B,
+  0x05, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x07, 0x01, 0x08, 0x09, 0x02, 0x07,
+  0x05, 0x0D, 0x04, 0x02, 0x06, 0x05, 0x0D, 0x05, 0x02, 0x06, 0x04, 0x0E,
+  0x04, 0x02, 0x05, 0x04, 0x0E, 0x05, 0x02, 0x04, 0x04, 0x0F, 0x04, 0x02,
+  0x03, 0x04, 0x0F, 0x05, 0x02, 0x02, 0x05, 0x10, 0x04, 0x02, 0x01, 0x05,
+  0x10, 0x05, 0x02, 0x00, 0x05, 0x11, 0x04, 0x02, 0x06, 0x04, 0x17, 0x04,
+  0x02, 0x06, 0x04, 0x16, 0x04, 0x02, 0x06, 0x04, 0x16, 0x04, 0x02, 0x06,
+  0x04, 0x15, 0x04, 0x02, 0x06, 0x04, 0x15, 0x04, 0x02, 0x06, 0x05, 0x14,
+  0x04, 0x02, 0x07, 0x04, 0x13, 0x05, 0x02, 0x07, 0x04, 0x13, 0x04, 0x02,
+  0x07, 0x04, 0x12, 0x04, 0x02, 0x07, 0x04, 0x12, 0x04, 0x02, 0x07, 0x04,
+  0x11, 0x04, 0x02, 0x07, 0x04, 0x11, 0x04, 0x02, 0x07, 0x04, 0x10, 0x04,
+  0x02, 0x07, 0x04, 0x10, 0x03, 0x02, 0x08, 0x04, 0x0F, 0x04, 0x02, 0x08,
+  0x04, 0x0E, 0x04, 0x02, 0x08, 0x04, 0x0E, 0x04, 0x02, 0x08, 0x04, 0x0D,
+  0x04, 0x02, 0x08, 0x04, 0x0D, 0x04, 0x01, 0x08, 0x08, 0x01, 0x08, 0x07,
+  0x01, 0x08, 0x07, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04,
+  0x01, 0x09, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04,
+  0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x01, 0x08, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x05, 0x01, 0x07, 0x12, 0x01, 0x06, 0x13,
+  0x01, 0x06, 0x13, 0x01, 0x06, 0x12, 0x01, 0x13, 0x05, 0x01, 0x12, 0x05,
+  0x01, 0x11, 0x05, 0x01, 0x10, 0x05, 0x01, 0x0F, 0x05, 0x01, 0x0E, 0x04,
+  0x01, 0x0D, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x09, 0x05,
+  0x01, 0x08, 0x05, 0x01, 0x07, 0x05, 0x01, 0x06, 0x05, 0x01, 0x05, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x04, 0x01, 0x01, 0x14,
+  0x01, 0x01, 0x14, 0x01, 0x01, 0x14, 0x01, 0x01, 0x14, 0x01, 0x0B, 0x05,
+  0x01, 0x09, 0x06, 0x01, 0x08, 0x07, 0x01, 0x08, 0x04, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x04, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x05, 0x01, 0x09, 0x03,
+  0x01, 0x09, 0x03, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x02, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x02,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x02,
+  0x01, 0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x01, 0x0A, 0x05,
+  0x01, 0x0A, 0x05, 0x01, 0x0A, 0x06, 0x01, 0x0C, 0x04, 0x01, 0x0D, 0x03,
+  0x01, 0x0D, 0x03, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04,
+  0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04,
+  0x01, 0x0A, 0x05, 0x01, 0x0A, 0x04, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03,
+  0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x04,
+  0x01, 0x0C, 0x04, 0x01, 0x0D, 0x03, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x04,
+  0x01, 0x09, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05,
+  0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x01, 0x00, 0x05, 0x01, 0x04, 0x04,
+  0x02, 0x02, 0x08, 0x13, 0x02, 0x02, 0x02, 0x0A, 0x12, 0x03, 0x03, 0x01,
+  0x03, 0x07, 0x06, 0x11, 0x03, 0x02, 0x01, 0x02, 0x09, 0x0B, 0x02, 0x00,
+  0x02, 0x0B, 0x08, 0x01, 0x0D, 0x04 };
+
+const GFXglyph FreeSansOblique24pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,  13,    0,    1 },   // 0x20 ' '
+  {     0,  11,  34,  13,    6,  -33 },   // 0x21 '!'
+  {    96,  13,  12,  17,    8,  -32 },   // 0x22 '"'
+  {   156,  28,  34,  26,    3,  -32 },   // 0x23 '#'
+  {   314,  26,  42,  26,    3,  -35 },   // 0x24 '$'
+  {   514,  36,  34,  42,    6,  -32 },   // 0x25 '%'
+  {   720,  26,  34,  31,    4,  -32 },   // 0x26 '&'
+  {   884,   5,  12,   9,    8,  -32 },   // 0x27 '''
+  {   920,  15,  44,  16,    5,  -33 },   // 0x28 '('
+  {  1052,  15,  44,  16,    1,  -33 },   // 0x29 ')'
+  {  1184,  14,  13,  18,    8,  -33 },   // 0x2A '*'
+  {  1239,  23,  22,  27,    5,  -20 },   // 0x2B '+'
+  {  1305,   7,  12,  13,    3,   -4 },   // 0x2C ','
+  {  1341,  12,   4,  16,    5,  -14 },   // 0x2D '-'
+  {  1353,   6,   5,  13,    4,   -4 },   // 0x2E '.'
+  {  1368,  21,  35,  13,   -1,  -33 },   // 0x2F '/'
+  {  1473,  23,  34,  26,    5,  -32 },   // 0x30 '0'
+  {  1627,  13,  33,  26,   10,  -32 },   // 0x31 '1'
+  {  1726,  27,  33,  26,    2,  -32 },   // 0x32 '2'
+  {  1839,  25,  34,  26,    3,  -32 },   // 0x33 '3'
+  {  1967,  24,  33,  26,    3,  -32 },   // 0x34 '4'
+  {  2094,  27,  34,  26,    3,  -32 },   // 0x35 '5'
+  {  2216,  24,  34,  26,    4,  -32 },   // 0x36 '6'
+  {  2364,  26,  33,  26,    6,  -32 },   // 0x37 '7'
+  {  2463,  25,  34,  26,    3,  -32 },   // 0x38 '8'
+  {  2609,  24,  34,  26,    4,  -32 },   // 0x39 '9'
+  {  2753,  10,  25,  13,    5,  -24 },   // 0x3A ':'
+  {  2798,  11,  32,  13,    4,  -24 },   // 0x3B ';'
+  {  2864,  26,  23,  27,    4,  -22 },   // 0x3C '<'
+  {  2933,  26,  12,  27,    3,  -16 },   // 0x3D '='
+  {  2961,  26,  23,  27,    2,  -21 },   // 0x3E '>'
+  {  3030,  20,  35,  26,    9,  -34 },   // 0x3F '?'
+  {  3141,  45,  42,  48,    4,  -34 },   // 0x40 '@'
+  {  3405,  30,  34,  31,    1,  -33 },   // 0x41 'A'
+  {  3557,  29,  34,  31,    4,  -33 },   // 0x42 'B'
+  {  3703,  30,  36,  33,    5,  -34 },   // 0x43 'C'
+  {  3843,  31,  34,  33,    4,  -33 },   // 0x44 'D'
+  {  3997,  31,  34,  31,    4,  -33 },   // 0x45 'E'
+  {  4099,  30,  34,  28,    4,  -33 },   // 0x46 'F'
+  {  4201,  33,  36,  37,    5,  -34 },   // 0x47 'G'
+  {  4359,  33,  34,  34,    4,  -33 },   // 0x48 'H'
+  {  4521,  11,  34,  13,    5,  -33 },   // 0x49 'I'
+  {  4623,  25,  35,  24,    2,  -33 },   // 0x4A 'J'
+  {  4744,  34,  34,  31,    4,  -33 },   // 0x4B 'K'
+  {  4914,  22,  34,  26,    4,  -33 },   // 0x4C 'L'
+  {  5016,  39,  34,  40,    4,  -33 },   // 0x4D 'M'
+  {  5280,  34,  34,  34,    4,  -33 },   // 0x4E 'N'
+  {  5488,  33,  36,  36,    5,  -34 },   // 0x4F 'O'
+  {  5652,  29,  34,  30,    4,  -33 },   // 0x50 'P'
+  {  5778,  33,  38,  36,    5,  -34 },   // 0x51 'Q'
+  {  5956,  30,  34,  33,    4,  -33 },   // 0x52 'R'
+  {  6110,  29,  36,  31,    4,  -34 },   // 0x53 'S'
+  {  6248,  28,  34,  29,    7,  -33 },   // 0x54 'T'
+  {  6350,  31,  35,  34,    6,  -33 },   // 0x55 'U'
+  {  6517,  29,  34,  30,    8,  -33 },   // 0x56 'V'
+  {  6677,  43,  34,  44,    8,  -33 },   // 0x57 'W'
+  {  6939,  36,  34,  31,    1,  -33 },   // 0x58 'X'
+  {  7095,  30,  34,  32,    8,  -33 },   // 0x59 'Y'
+  {  7229,  34,  34,  29,    1,  -33 },   // 0x5A 'Z'
+  {  7331,  18,  44,  13,    1,  -33 },   // 0x5B '['
+  {  7463,   6,  35,  13,    7,  -33 },   // 0x5C '\'
+  {  7568,  18,  44,  13,   -1,  -33 },   // 0x5D ']'
+  {  7700,  17,  18,  22,    6,  -32 },   // 0x5E '^'
+  {  7782,  29,   2,  26,   -3,    7 },   // 0x5F '_'
+  {  7788,   8,   7,  16,    8,  -34 },   // 0x60 '`'
+  {  7809,  23,  27,  26,    3,  -25 },   // 0x61 'a'
+  {  7922,  25,  35,  26,    3,  -33 },   // 0x62 'b'
+  {  8079,  22,  27,  24,    4,  -25 },   // 0x63 'c'
+  {  8180,  27,  35,  26,    4,  -33 },   // 0x64 'd'
+  {  8335,  23,  27,  26,    4,  -25 },   // 0x65 'e'
+  {  8438,  15,  34,  12,    3,  -33 },   // 0x66 'f'
+  {  8540,  27,  36,  26,    2,  -25 },   // 0x67 'g'
+  {  8706,  23,  34,  25,    3,  -33 },   // 0x68 'h'
+  {  8858,  11,  34,  10,    3,  -33 },   // 0x69 'i'
+  {  8952,  18,  44,  11,   -2,  -33 },   // 0x6A 'j'
+  {  9076,  25,  34,  24,    3,  -33 },   // 0x6B 'k'
+  {  9226,  11,  34,  10,    3,  -33 },   // 0x6C 'l'
+  {  9328,  36,  26,  38,    3,  -25 },   // 0x6D 'm'
+  {  9508,  23,  26,  25,    3,  -25 },   // 0x6E 'n'
+  {  9636,  23,  27,  26,    4,  -25 },   // 0x6F 'o'
+  {  9755,  27,  36,  26,    1,  -25 },   // 0x70 'p'
+  {  9915,  26,  36,  26,    3,  -25 },   // 0x71 'q'
+  { 10075,  17,  26,  15,    3,  -25 },   // 0x72 'r'
+  { 10159,  21,  27,  24,    3,  -25 },   // 0x73 's'
+  { 10258,  13,  32,  12,    4,  -30 },   // 0x74 't'
+  { 10354,  24,  26,  25,    4,  -24 },   // 0x75 'u'
+  { 10480,  22,  25,  23,    6,  -24 },   // 0x76 'v'
+  { 10595,  33,  25,  34,    6,  -24 },   // 0x77 'w'
+  { 10780,  26,  25,  23,    1,  -24 },   // 0x78 'x'
+  { 10891,  27,  35,  23,    0,  -24 },   // 0x79 'y'
+  { 11034,  25,  25,  23,    1,  -24 },   // 0x7A 'z'
+  { 11109,  16,  44,  16,    5,  -33 },   // 0x7B '{'
+  { 11241,  12,  44,  12,    3,  -33 },   // 0x7C '|'
+  { 11373,  16,  44,  16,   -1,  -33 },   // 0x7D '}'
+  { 11505,  21,   7,  27,    6,  -19 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSansOblique24pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSansOblique24pt7bSpanData,
+    (GFXglyph *)FreeSansOblique24pt7bSpanGlyphs,
+    0x20, 0x7E, 56 } };
+
+// Approx. 12322 bytes
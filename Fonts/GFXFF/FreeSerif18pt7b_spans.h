@@ -0,0 +1,768 @@
+// FreeSerif18pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSerif18pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSerif18pt7bSpanData[] PROGMEM = {
+  0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x05, 0x03, 0x02,
+  0x00, 0x03, 0x05, 0x03, 0x02, 0x00, 0x03, 0x05, 0x03, 0x02, 0x00, 0x03,
+  0x05, 0x03, 0x02, 0x00, 0x03, 0x05, 0x03, 0x02, 0x01, 0x01, 0x05, 0x02,
+  0x02, 0x01, 0x01, 0x06, 0x01, 0x02, 0x01, 0x01, 0x06, 0x01, 0x02, 0x01,
+  0x01, 0x06, 0x01, 0x02, 0x06, 0x02, 0x0D, 0x02, 0x02, 0x06, 0x02, 0x0D,
+  0x02, 0x02, 0x06, 0x02, 0x0D, 0x02, 0x02, 0x06, 0x02, 0x0C, 0x03, 0x02,
+  0x06, 0x02, 0x0C, 0x02, 0x02, 0x05, 0x03, 0x0C, 0x02, 0x02, 0x05, 0x02,
+  0x0C, 0x02, 0x01, 0x01, 0x10, 0x01, 0x01, 0x10, 0x02, 0x05, 0x02, 0x0C,
+  0x02, 0x02, 0x05, 0x02, 0x0B, 0x02, 0x02, 0x05, 0x02, 0x0B, 0x02, 0x02,
+  0x04, 0x02, 0x0B, 0x02, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x02, 0x04,
+  0x02, 0x0B, 0x02, 0x02, 0x04, 0x02, 0x0B, 0x02, 0x02, 0x04, 0x02, 0x0A,
+  0x02, 0x02, 0x03, 0x02, 0x0A, 0x02, 0x02, 0x03, 0x02, 0x0A, 0x02, 0x02,
+  0x03, 0x02, 0x0A, 0x02, 0x02, 0x03, 0x02, 0x0A, 0x02, 0x02, 0x03, 0x02,
+  0x0A, 0x02, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x04, 0x05, 0x03,
+  0x02, 0x02, 0x06, 0x01, 0x09, 0x03, 0x03, 0x01, 0x02, 0x06, 0x01, 0x0A,
+  0x02, 0x03, 0x00, 0x02, 0x06, 0x01, 0x0A, 0x02, 0x03, 0x00, 0x02, 0x06,
+  0x01, 0x0B, 0x01, 0x03, 0x00, 0x02, 0x06, 0x01, 0x0B, 0x01, 0x02, 0x00,
+  0x03, 0x06, 0x01, 0x02, 0x01, 0x03, 0x06, 0x01, 0x01, 0x01, 0x06, 0x01,
+  0x02, 0x06, 0x01, 0x04, 0x06, 0x01, 0x06, 0x05, 0x01, 0x06, 0x06, 0x02,
+  0x06, 0x01, 0x09, 0x03, 0x02, 0x06, 0x01, 0x0A, 0x03, 0x02, 0x06, 0x01,
+  0x0B, 0x02, 0x03, 0x00, 0x01, 0x06, 0x01, 0x0B, 0x02, 0x03, 0x00, 0x01,
+  0x06, 0x01, 0x0B, 0x02, 0x03, 0x00, 0x02, 0x06, 0x01, 0x0B, 0x02, 0x03,
+  0x00, 0x02, 0x06, 0x01, 0x0A, 0x02, 0x03, 0x00, 0x04, 0x06, 0x01, 0x09,
+  0x03, 0x01, 0x01, 0x0A, 0x01, 0x03, 0x06, 0x01, 0x06, 0x01, 0x01, 0x06,
+  0x01, 0x02, 0x05, 0x04, 0x12, 0x01, 0x02, 0x03, 0x08, 0x10, 0x03, 0x03,
+  0x02, 0x04, 0x0B, 0x05, 0x11, 0x01, 0x03, 0x01, 0x04, 0x0B, 0x01, 0x10,
+  0x02, 0x03, 0x01, 0x03, 0x0B, 0x01, 0x0F, 0x02, 0x03, 0x00, 0x03, 0x0B,
+  0x01, 0x0F, 0x02, 0x03, 0x00, 0x03, 0x0B, 0x01, 0x0E, 0x02, 0x03, 0x00,
+  0x02, 0x0A, 0x01, 0x0E, 0x01, 0x03, 0x00, 0x02, 0x0A, 0x01, 0x0D, 0x02,
+  0x04, 0x00, 0x02, 0x09, 0x01, 0x0D, 0x01, 0x13, 0x04, 0x04, 0x00, 0x02,
+  0x08, 0x02, 0x0C, 0x02, 0x11, 0x07, 0x05, 0x01, 0x02, 0x06, 0x03, 0x0B,
+  0x02, 0x10, 0x04, 0x17, 0x02, 0x04, 0x01, 0x07, 0x0B, 0x02, 0x10, 0x03,
+  0x17, 0x02, 0x04, 0x02, 0x04, 0x0A, 0x02, 0x0F, 0x03, 0x18, 0x01, 0x03,
+  0x0A, 0x01, 0x0F, 0x02, 0x18, 0x01, 0x03, 0x09, 0x02, 0x0E, 0x03, 0x18,
+  0x01, 0x03, 0x08, 0x02, 0x0E, 0x03, 0x18, 0x01, 0x03, 0x08, 0x02, 0x0E,
+  0x02, 0x17, 0x01, 0x03, 0x07, 0x02, 0x0E, 0x02, 0x17, 0x01, 0x03, 0x07,
+  0x02, 0x0E, 0x02, 0x16, 0x01, 0x03, 0x06, 0x02, 0x0E, 0x03, 0x14, 0x03,
+  0x02, 0x05, 0x02, 0x0F, 0x07, 0x02, 0x05, 0x02, 0x10, 0x04, 0x01, 0x09,
+  0x04, 0x01, 0x08, 0x06, 0x02, 0x07, 0x02, 0x0D, 0x02, 0x02, 0x06, 0x02,
+  0x0E, 0x02, 0x02, 0x06, 0x02, 0x0E, 0x02, 0x02, 0x06, 0x02, 0x0E, 0x02,
+  0x02, 0x06, 0x02, 0x0E, 0x02, 0x02, 0x06, 0x02, 0x0D, 0x02, 0x02, 0x06,
+  0x03, 0x0C, 0x03, 0x02, 0x06, 0x03, 0x0B, 0x03, 0x02, 0x07, 0x05, 0x10,
+  0x08, 0x02, 0x07, 0x03, 0x12, 0x04, 0x02, 0x06, 0x05, 0x12, 0x03, 0x03,
+  0x04, 0x03, 0x08, 0x03, 0x12, 0x02, 0x03, 0x03, 0x03, 0x08, 0x04, 0x12,
+  0x01, 0x03, 0x01, 0x04, 0x09, 0x04, 0x11, 0x02, 0x03, 0x01, 0x03, 0x09,
+  0x05, 0x10, 0x02, 0x03, 0x00, 0x04, 0x0A, 0x04, 0x10, 0x01, 0x02, 0x00,
+  0x04, 0x0B, 0x05, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x03, 0x00, 0x04, 0x0D,
+  0x04, 0x18, 0x01, 0x03, 0x00, 0x05, 0x0B, 0x08, 0x17, 0x02, 0x03, 0x01,
+  0x05, 0x0A, 0x02, 0x0F, 0x09, 0x02, 0x02, 0x09, 0x10, 0x07, 0x02, 0x03,
+  0x06, 0x12, 0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01, 0x07, 0x01,
+  0x01, 0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x02,
+  0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03,
+  0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02,
+  0x01, 0x04, 0x02, 0x01, 0x05, 0x02, 0x01, 0x06, 0x02, 0x01, 0x07, 0x02,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x02,
+  0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02,
+  0x01, 0x05, 0x03, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x02,
+  0x01, 0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02,
+  0x01, 0x04, 0x02, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02,
+  0x01, 0x04, 0x02, 0x03, 0x00, 0x02, 0x05, 0x01, 0x09, 0x02, 0x03, 0x00,
+  0x03, 0x05, 0x01, 0x08, 0x04, 0x03, 0x01, 0x03, 0x05, 0x01, 0x07, 0x04,
+  0x01, 0x03, 0x05, 0x01, 0x04, 0x02, 0x02, 0x03, 0x01, 0x05, 0x04, 0x03,
+  0x00, 0x03, 0x05, 0x01, 0x08, 0x03, 0x03, 0x00, 0x03, 0x05, 0x01, 0x08,
+  0x04, 0x03, 0x00, 0x02, 0x04, 0x02, 0x09, 0x02, 0x01, 0x04, 0x02, 0x01,
+  0x04, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01,
+  0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01,
+  0x07, 0x02, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x07, 0x02, 0x01,
+  0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01,
+  0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x01, 0x02, 0x01, 0x08, 0x02, 0x01, 0x07, 0x02, 0x01,
+  0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x06, 0x03, 0x01, 0x06, 0x02, 0x01,
+  0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01,
+  0x04, 0x03, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x02, 0x01, 0x06, 0x05, 0x02, 0x04, 0x03, 0x09,
+  0x03, 0x02, 0x03, 0x03, 0x0A, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02,
+  0x02, 0x03, 0x0B, 0x03, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x03,
+  0x0C, 0x03, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x04,
+  0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00,
+  0x04, 0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C,
+  0x04, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02,
+  0x01, 0x03, 0x0C, 0x03, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x02, 0x01, 0x04,
+  0x0B, 0x04, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03,
+  0x02, 0x03, 0x03, 0x0A, 0x03, 0x02, 0x04, 0x02, 0x0A, 0x02, 0x01, 0x06,
+  0x04, 0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x02, 0x05, 0x02, 0x00,
+  0x02, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04,
+  0x01, 0x01, 0x09, 0x01, 0x05, 0x05, 0x01, 0x03, 0x09, 0x01, 0x02, 0x0B,
+  0x02, 0x01, 0x03, 0x08, 0x05, 0x02, 0x01, 0x02, 0x0A, 0x04, 0x02, 0x00,
+  0x02, 0x0A, 0x04, 0x02, 0x00, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01,
+  0x0B, 0x03, 0x01, 0x0B, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x0A, 0x02, 0x01,
+  0x0A, 0x02, 0x01, 0x09, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x01, 0x01,
+  0x07, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x01, 0x02, 0x04, 0x01, 0x0F,
+  0x01, 0x02, 0x03, 0x01, 0x0E, 0x01, 0x01, 0x02, 0x0D, 0x01, 0x01, 0x0D,
+  0x01, 0x00, 0x0E, 0x01, 0x04, 0x06, 0x01, 0x03, 0x08, 0x02, 0x02, 0x02,
+  0x08, 0x04, 0x02, 0x01, 0x01, 0x09, 0x03, 0x02, 0x01, 0x01, 0x0A, 0x02,
+  0x01, 0x0A, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x0A, 0x01, 0x01, 0x09, 0x01,
+  0x01, 0x08, 0x01, 0x01, 0x06, 0x05, 0x01, 0x04, 0x08, 0x01, 0x08, 0x04,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0B, 0x02, 0x01, 0x0B, 0x02,
+  0x01, 0x0B, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x0A, 0x02,
+  0x02, 0x00, 0x04, 0x08, 0x03, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x06, 0x01,
+  0x0A, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x03, 0x01, 0x08, 0x04, 0x02,
+  0x08, 0x01, 0x0A, 0x02, 0x02, 0x07, 0x01, 0x0A, 0x02, 0x02, 0x06, 0x02,
+  0x0A, 0x02, 0x02, 0x05, 0x02, 0x0A, 0x02, 0x02, 0x05, 0x01, 0x0A, 0x02,
+  0x02, 0x04, 0x01, 0x0A, 0x02, 0x02, 0x03, 0x02, 0x0A, 0x02, 0x02, 0x03,
+  0x01, 0x0A, 0x02, 0x02, 0x02, 0x01, 0x0A, 0x02, 0x02, 0x01, 0x02, 0x0A,
+  0x02, 0x02, 0x00, 0x02, 0x0A, 0x02, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10,
+  0x01, 0x0A, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x0A, 0x02,
+  0x01, 0x0A, 0x02, 0x01, 0x0A, 0x02, 0x00, 0x01, 0x04, 0x09, 0x01, 0x04,
+  0x09, 0x01, 0x04, 0x08, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x02, 0x05, 0x01, 0x01, 0x08, 0x01, 0x02, 0x09, 0x01, 0x06,
+  0x06, 0x01, 0x08, 0x04, 0x01, 0x09, 0x04, 0x01, 0x0A, 0x03, 0x01, 0x0B,
+  0x02, 0x01, 0x0B, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x0B,
+  0x02, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x03, 0x02, 0x00, 0x04, 0x08, 0x03,
+  0x01, 0x00, 0x0A, 0x01, 0x01, 0x06, 0x01, 0x0C, 0x03, 0x01, 0x08, 0x05,
+  0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x02, 0x01, 0x04, 0x07, 0x05, 0x01,
+  0x01, 0x0D, 0x02, 0x00, 0x05, 0x0A, 0x04, 0x02, 0x00, 0x04, 0x0B, 0x04,
+  0x02, 0x00, 0x04, 0x0B, 0x05, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00,
+  0x04, 0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C,
+  0x04, 0x02, 0x01, 0x03, 0x0C, 0x04, 0x02, 0x01, 0x04, 0x0C, 0x04, 0x02,
+  0x01, 0x04, 0x0C, 0x03, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02, 0x03, 0x04,
+  0x0A, 0x04, 0x01, 0x04, 0x09, 0x01, 0x05, 0x06, 0x01, 0x02, 0x0C, 0x01,
+  0x01, 0x0D, 0x01, 0x01, 0x0D, 0x02, 0x00, 0x02, 0x0B, 0x02, 0x02, 0x00,
+  0x01, 0x0B, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x0A, 0x02,
+  0x01, 0x0A, 0x02, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x06, 0x03, 0x01, 0x06, 0x02,
+  0x01, 0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x04, 0x05,
+  0x01, 0x02, 0x08, 0x02, 0x01, 0x03, 0x08, 0x03, 0x02, 0x01, 0x02, 0x09,
+  0x03, 0x02, 0x00, 0x02, 0x0A, 0x02, 0x02, 0x00, 0x02, 0x0A, 0x02, 0x02,
+  0x00, 0x02, 0x0A, 0x02, 0x02, 0x00, 0x03, 0x0A, 0x02, 0x02, 0x01, 0x03,
+  0x09, 0x02, 0x02, 0x01, 0x04, 0x08, 0x02, 0x02, 0x02, 0x04, 0x07, 0x02,
+  0x01, 0x03, 0x05, 0x01, 0x04, 0x05, 0x02, 0x03, 0x01, 0x05, 0x05, 0x02,
+  0x02, 0x01, 0x07, 0x04, 0x02, 0x01, 0x02, 0x08, 0x03, 0x02, 0x00, 0x02,
+  0x09, 0x03, 0x02, 0x00, 0x02, 0x0A, 0x02, 0x02, 0x00, 0x02, 0x0A, 0x02,
+  0x02, 0x00, 0x02, 0x0A, 0x02, 0x02, 0x00, 0x02, 0x0A, 0x02, 0x02, 0x01,
+  0x02, 0x09, 0x02, 0x02, 0x01, 0x03, 0x08, 0x03, 0x01, 0x02, 0x08, 0x01,
+  0x04, 0x05, 0x01, 0x05, 0x05, 0x01, 0x03, 0x09, 0x02, 0x02, 0x04, 0x09,
+  0x04, 0x02, 0x02, 0x03, 0x0A, 0x04, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x02,
+  0x01, 0x03, 0x0B, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x03, 0x02, 0x00, 0x04,
+  0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x04,
+  0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00,
+  0x05, 0x0C, 0x04, 0x02, 0x01, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x04, 0x0A,
+  0x06, 0x02, 0x03, 0x08, 0x0C, 0x03, 0x02, 0x04, 0x05, 0x0B, 0x04, 0x01,
+  0x0B, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x07, 0x04, 0x01, 0x05, 0x04, 0x01, 0x03, 0x04, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x10, 0x02, 0x01, 0x0E, 0x04, 0x01, 0x0B, 0x06, 0x01, 0x09, 0x06, 0x01,
+  0x07, 0x06, 0x01, 0x05, 0x05, 0x01, 0x02, 0x06, 0x01, 0x00, 0x06, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x05, 0x01, 0x01, 0x06, 0x01, 0x03, 0x06, 0x01,
+  0x06, 0x05, 0x01, 0x08, 0x05, 0x01, 0x0A, 0x06, 0x01, 0x0C, 0x06, 0x01,
+  0x0E, 0x04, 0x01, 0x11, 0x01, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x06, 0x01, 0x02, 0x06, 0x01, 0x05,
+  0x05, 0x01, 0x07, 0x05, 0x01, 0x09, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x0D,
+  0x05, 0x01, 0x0E, 0x04, 0x01, 0x0C, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x08,
+  0x05, 0x01, 0x05, 0x06, 0x01, 0x03, 0x06, 0x01, 0x01, 0x06, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x02, 0x01, 0x03, 0x06, 0x01, 0x02, 0x09, 0x02, 0x01,
+  0x02, 0x07, 0x05, 0x02, 0x00, 0x02, 0x08, 0x04, 0x02, 0x00, 0x02, 0x09,
+  0x04, 0x02, 0x00, 0x03, 0x09, 0x04, 0x02, 0x00, 0x03, 0x09, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x03, 0x01,
+  0x08, 0x02, 0x01, 0x08, 0x01, 0x01, 0x07, 0x02, 0x01, 0x07, 0x01, 0x01,
+  0x07, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x00,
+  0x00, 0x01, 0x05, 0x02, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x05,
+  0x03, 0x01, 0x09, 0x07, 0x01, 0x07, 0x0B, 0x02, 0x05, 0x04, 0x10, 0x04,
+  0x02, 0x04, 0x04, 0x12, 0x03, 0x02, 0x03, 0x03, 0x13, 0x03, 0x02, 0x02,
+  0x03, 0x14, 0x02, 0x02, 0x02, 0x03, 0x15, 0x02, 0x03, 0x01, 0x03, 0x0B,
+  0x04, 0x16, 0x01, 0x03, 0x01, 0x03, 0x0A, 0x09, 0x16, 0x02, 0x04, 0x00,
+  0x04, 0x09, 0x03, 0x0F, 0x04, 0x17, 0x01, 0x04, 0x00, 0x03, 0x08, 0x03,
+  0x10, 0x02, 0x17, 0x01, 0x04, 0x00, 0x03, 0x08, 0x02, 0x10, 0x02, 0x17,
+  0x01, 0x04, 0x00, 0x03, 0x08, 0x02, 0x0F, 0x03, 0x17, 0x01, 0x04, 0x00,
+  0x03, 0x07, 0x02, 0x0F, 0x03, 0x17, 0x01, 0x04, 0x00, 0x03, 0x07, 0x02,
+  0x0F, 0x02, 0x16, 0x02, 0x04, 0x00, 0x03, 0x07, 0x02, 0x0E, 0x03, 0x16,
+  0x01, 0x04, 0x00, 0x03, 0x07, 0x02, 0x0E, 0x03, 0x15, 0x02, 0x04, 0x01,
+  0x03, 0x07, 0x03, 0x0D, 0x04, 0x14, 0x02, 0x03, 0x01, 0x03, 0x08, 0x05,
+  0x0F, 0x06, 0x03, 0x02, 0x03, 0x08, 0x04, 0x10, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x03, 0x04, 0x02, 0x05, 0x04, 0x11, 0x03, 0x01, 0x06, 0x0D, 0x01,
+  0x09, 0x07, 0x01, 0x0B, 0x01, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01,
+  0x0A, 0x03, 0x01, 0x09, 0x05, 0x02, 0x09, 0x01, 0x0B, 0x03, 0x02, 0x08,
+  0x02, 0x0B, 0x04, 0x02, 0x08, 0x01, 0x0C, 0x03, 0x02, 0x07, 0x02, 0x0C,
+  0x04, 0x02, 0x07, 0x02, 0x0D, 0x03, 0x02, 0x06, 0x02, 0x0D, 0x04, 0x02,
+  0x06, 0x02, 0x0E, 0x03, 0x02, 0x06, 0x01, 0x0E, 0x04, 0x02, 0x05, 0x02,
+  0x0E, 0x04, 0x01, 0x05, 0x0D, 0x01, 0x04, 0x0F, 0x02, 0x04, 0x02, 0x0F,
+  0x04, 0x02, 0x03, 0x02, 0x10, 0x04, 0x02, 0x03, 0x02, 0x10, 0x04, 0x02,
+  0x02, 0x02, 0x11, 0x04, 0x02, 0x02, 0x02, 0x11, 0x04, 0x02, 0x01, 0x03,
+  0x11, 0x05, 0x02, 0x00, 0x06, 0x0F, 0x09, 0x01, 0x00, 0x0E, 0x01, 0x02,
+  0x0F, 0x02, 0x03, 0x04, 0x0C, 0x06, 0x02, 0x03, 0x04, 0x0E, 0x04, 0x02,
+  0x03, 0x04, 0x0F, 0x04, 0x02, 0x03, 0x04, 0x0F, 0x04, 0x02, 0x03, 0x04,
+  0x0F, 0x04, 0x02, 0x03, 0x04, 0x0F, 0x04, 0x02, 0x03, 0x04, 0x0E, 0x04,
+  0x02, 0x03, 0x04, 0x0D, 0x04, 0x01, 0x03, 0x0C, 0x01, 0x03, 0x0D, 0x02,
+  0x03, 0x04, 0x0D, 0x05, 0x02, 0x03, 0x04, 0x0F, 0x04, 0x02, 0x03, 0x04,
+  0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04,
+  0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03,
+  0x04, 0x0F, 0x04, 0x02, 0x03, 0x04, 0x0D, 0x06, 0x01, 0x02, 0x0F, 0x01,
+  0x00, 0x0F, 0x02, 0x08, 0x07, 0x14, 0x01, 0x02, 0x06, 0x0C, 0x13, 0x02,
+  0x02, 0x04, 0x06, 0x0F, 0x06, 0x02, 0x03, 0x05, 0x11, 0x04, 0x02, 0x02,
+  0x04, 0x12, 0x03, 0x02, 0x02, 0x04, 0x13, 0x02, 0x02, 0x01, 0x04, 0x13,
+  0x02, 0x02, 0x01, 0x04, 0x14, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x02, 0x04, 0x02, 0x02, 0x04, 0x14, 0x01, 0x02, 0x03, 0x05, 0x12,
+  0x03, 0x02, 0x04, 0x06, 0x10, 0x03, 0x01, 0x05, 0x0D, 0x01, 0x08, 0x07,
+  0x01, 0x00, 0x0E, 0x01, 0x02, 0x0F, 0x02, 0x03, 0x04, 0x0C, 0x07, 0x02,
+  0x03, 0x04, 0x0F, 0x05, 0x02, 0x03, 0x04, 0x10, 0x05, 0x02, 0x03, 0x04,
+  0x11, 0x04, 0x02, 0x03, 0x04, 0x12, 0x04, 0x02, 0x03, 0x04, 0x12, 0x04,
+  0x02, 0x03, 0x04, 0x13, 0x04, 0x02, 0x03, 0x04, 0x13, 0x04, 0x02, 0x03,
+  0x04, 0x13, 0x04, 0x02, 0x03, 0x04, 0x13, 0x04, 0x02, 0x03, 0x04, 0x13,
+  0x04, 0x02, 0x03, 0x04, 0x13, 0x04, 0x02, 0x03, 0x04, 0x13, 0x04, 0x02,
+  0x03, 0x04, 0x12, 0x04, 0x02, 0x03, 0x04, 0x12, 0x04, 0x02, 0x03, 0x04,
+  0x11, 0x04, 0x02, 0x03, 0x04, 0x11, 0x04, 0x02, 0x03, 0x04, 0x0F, 0x05,
+  0x02, 0x03, 0x04, 0x0D, 0x06, 0x01, 0x02, 0x0F, 0x01, 0x00, 0x0E, 0x01,
+  0x00, 0x11, 0x01, 0x01, 0x10, 0x02, 0x02, 0x04, 0x0F, 0x02, 0x02, 0x02,
+  0x04, 0x10, 0x01, 0x02, 0x02, 0x04, 0x10, 0x01, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x04, 0x02, 0x02, 0x04, 0x0E, 0x01, 0x02, 0x02,
+  0x04, 0x0D, 0x02, 0x01, 0x02, 0x0D, 0x01, 0x02, 0x0D, 0x02, 0x02, 0x04,
+  0x0D, 0x02, 0x02, 0x02, 0x04, 0x0E, 0x01, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x04, 0x02, 0x02, 0x04, 0x13, 0x01, 0x02, 0x02, 0x04,
+  0x12, 0x01, 0x02, 0x02, 0x04, 0x11, 0x02, 0x02, 0x02, 0x04, 0x0F, 0x04,
+  0x01, 0x01, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00, 0x11, 0x01, 0x01, 0x10,
+  0x02, 0x02, 0x04, 0x0F, 0x02, 0x02, 0x02, 0x04, 0x10, 0x01, 0x02, 0x02,
+  0x04, 0x10, 0x01, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x02, 0x02, 0x04, 0x0E, 0x01, 0x02, 0x02, 0x04, 0x0D, 0x02, 0x01, 0x02,
+  0x0D, 0x01, 0x02, 0x0D, 0x02, 0x02, 0x04, 0x0D, 0x02, 0x02, 0x02, 0x04,
+  0x0E, 0x01, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x01, 0x06, 0x01, 0x00, 0x08, 0x02, 0x08, 0x07, 0x15, 0x01, 0x02, 0x06,
+  0x0C, 0x13, 0x03, 0x02, 0x05, 0x05, 0x10, 0x06, 0x02, 0x03, 0x05, 0x12,
+  0x04, 0x02, 0x02, 0x05, 0x13, 0x03, 0x02, 0x02, 0x04, 0x14, 0x02, 0x02,
+  0x01, 0x04, 0x15, 0x01, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x02, 0x00, 0x04, 0x10, 0x07, 0x02, 0x00, 0x04,
+  0x11, 0x05, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04,
+  0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x01, 0x04, 0x12, 0x04, 0x02, 0x01,
+  0x04, 0x12, 0x04, 0x02, 0x02, 0x04, 0x12, 0x04, 0x02, 0x02, 0x05, 0x12,
+  0x04, 0x02, 0x03, 0x05, 0x12, 0x04, 0x02, 0x04, 0x06, 0x10, 0x05, 0x01,
+  0x06, 0x0E, 0x01, 0x09, 0x07, 0x02, 0x00, 0x08, 0x0E, 0x08, 0x02, 0x01,
+  0x06, 0x0F, 0x06, 0x02, 0x02, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04, 0x10,
+  0x04, 0x02, 0x02, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04, 0x10, 0x04, 0x02,
+  0x02, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04,
+  0x10, 0x04, 0x02, 0x02, 0x04, 0x10, 0x04, 0x01, 0x02, 0x12, 0x01, 0x02,
+  0x12, 0x02, 0x02, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04, 0x10, 0x04, 0x02,
+  0x02, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04,
+  0x10, 0x04, 0x02, 0x02, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04, 0x10, 0x04,
+  0x02, 0x02, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04, 0x10, 0x04, 0x02, 0x01,
+  0x06, 0x0F, 0x06, 0x02, 0x00, 0x08, 0x0E, 0x08, 0x01, 0x00, 0x09, 0x01,
+  0x01, 0x06, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x01, 0x06, 0x01, 0x00, 0x09, 0x01, 0x04, 0x08, 0x01, 0x05, 0x06, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x02, 0x01, 0x02, 0x06, 0x03, 0x02, 0x00, 0x04, 0x06, 0x03,
+  0x01, 0x00, 0x08, 0x01, 0x01, 0x05, 0x02, 0x00, 0x08, 0x0D, 0x09, 0x02,
+  0x01, 0x06, 0x0F, 0x04, 0x02, 0x02, 0x04, 0x0F, 0x03, 0x02, 0x02, 0x04,
+  0x0E, 0x03, 0x02, 0x02, 0x04, 0x0D, 0x02, 0x02, 0x02, 0x04, 0x0C, 0x02,
+  0x02, 0x02, 0x04, 0x0B, 0x02, 0x02, 0x02, 0x04, 0x0A, 0x02, 0x02, 0x02,
+  0x04, 0x09, 0x02, 0x02, 0x02, 0x04, 0x08, 0x02, 0x01, 0x02, 0x08, 0x01,
+  0x02, 0x09, 0x02, 0x02, 0x04, 0x07, 0x05, 0x02, 0x02, 0x04, 0x09, 0x04,
+  0x02, 0x02, 0x04, 0x0A, 0x04, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02, 0x02,
+  0x04, 0x0C, 0x04, 0x02, 0x02, 0x04, 0x0D, 0x04, 0x02, 0x02, 0x04, 0x0D,
+  0x05, 0x02, 0x02, 0x04, 0x0E, 0x05, 0x02, 0x02, 0x04, 0x0F, 0x05, 0x02,
+  0x01, 0x06, 0x0F, 0x06, 0x02, 0x00, 0x08, 0x0D, 0x0A, 0x01, 0x00, 0x08,
+  0x01, 0x01, 0x06, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x02, 0x02, 0x04, 0x12, 0x01, 0x02, 0x02, 0x04, 0x11, 0x01, 0x02, 0x02,
+  0x04, 0x10, 0x02, 0x02, 0x02, 0x04, 0x0E, 0x04, 0x01, 0x01, 0x11, 0x01,
+  0x00, 0x11, 0x02, 0x00, 0x06, 0x16, 0x07, 0x02, 0x02, 0x05, 0x16, 0x06,
+  0x02, 0x03, 0x04, 0x15, 0x06, 0x02, 0x03, 0x05, 0x15, 0x06, 0x03, 0x03,
+  0x05, 0x15, 0x01, 0x17, 0x04, 0x04, 0x03, 0x01, 0x05, 0x04, 0x14, 0x02,
+  0x17, 0x04, 0x04, 0x03, 0x01, 0x05, 0x04, 0x14, 0x02, 0x17, 0x04, 0x04,
+  0x03, 0x01, 0x06, 0x04, 0x13, 0x02, 0x17, 0x04, 0x04, 0x03, 0x01, 0x06,
+  0x04, 0x13, 0x02, 0x17, 0x04, 0x04, 0x03, 0x01, 0x07, 0x04, 0x12, 0x02,
+  0x17, 0x04, 0x04, 0x03, 0x01, 0x07, 0x04, 0x12, 0x02, 0x17, 0x04, 0x04,
+  0x03, 0x01, 0x08, 0x04, 0x11, 0x02, 0x17, 0x04, 0x04, 0x03, 0x01, 0x08,
+  0x04, 0x11, 0x02, 0x17, 0x04, 0x04, 0x03, 0x01, 0x09, 0x04, 0x10, 0x02,
+  0x17, 0x04, 0x04, 0x03, 0x01, 0x09, 0x04, 0x10, 0x02, 0x17, 0x04, 0x04,
+  0x03, 0x01, 0x0A, 0x04, 0x0F, 0x02, 0x17, 0x04, 0x04, 0x03, 0x01, 0x0A,
+  0x04, 0x0F, 0x02, 0x17, 0x04, 0x03, 0x03, 0x01, 0x0A, 0x06, 0x17, 0x04,
+  0x03, 0x03, 0x01, 0x0B, 0x05, 0x17, 0x04, 0x03, 0x03, 0x01, 0x0B, 0x04,
+  0x17, 0x04, 0x03, 0x03, 0x01, 0x0C, 0x03, 0x17, 0x04, 0x03, 0x02, 0x03,
+  0x0C, 0x02, 0x16, 0x06, 0x03, 0x00, 0x07, 0x0D, 0x01, 0x15, 0x08, 0x02,
+  0x00, 0x06, 0x10, 0x07, 0x02, 0x02, 0x04, 0x12, 0x03, 0x02, 0x03, 0x04,
+  0x13, 0x01, 0x02, 0x03, 0x05, 0x13, 0x01, 0x02, 0x03, 0x06, 0x13, 0x01,
+  0x03, 0x03, 0x01, 0x05, 0x05, 0x13, 0x01, 0x03, 0x03, 0x01, 0x06, 0x05,
+  0x13, 0x01, 0x03, 0x03, 0x01, 0x07, 0x04, 0x13, 0x01, 0x03, 0x03, 0x01,
+  0x07, 0x05, 0x13, 0x01, 0x03, 0x03, 0x01, 0x08, 0x05, 0x13, 0x01, 0x03,
+  0x03, 0x01, 0x09, 0x05, 0x13, 0x01, 0x03, 0x03, 0x01, 0x0A, 0x05, 0x13,
+  0x01, 0x03, 0x03, 0x01, 0x0B, 0x05, 0x13, 0x01, 0x03, 0x03, 0x01, 0x0C,
+  0x04, 0x13, 0x01, 0x03, 0x03, 0x01, 0x0C, 0x05, 0x13, 0x01, 0x03, 0x03,
+  0x01, 0x0D, 0x05, 0x13, 0x01, 0x02, 0x03, 0x01, 0x0E, 0x06, 0x02, 0x03,
+  0x01, 0x0F, 0x05, 0x02, 0x03, 0x01, 0x10, 0x04, 0x02, 0x03, 0x01, 0x11,
+  0x03, 0x02, 0x03, 0x01, 0x11, 0x03, 0x02, 0x02, 0x03, 0x12, 0x02, 0x02,
+  0x00, 0x07, 0x13, 0x01, 0x01, 0x08, 0x07, 0x01, 0x06, 0x0B, 0x02, 0x04,
+  0x05, 0x0E, 0x05, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04, 0x11,
+  0x04, 0x02, 0x02, 0x04, 0x12, 0x03, 0x02, 0x01, 0x04, 0x12, 0x04, 0x02,
+  0x01, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04,
+  0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04,
+  0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00,
+  0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x01, 0x04, 0x12,
+  0x04, 0x02, 0x01, 0x04, 0x12, 0x04, 0x02, 0x02, 0x03, 0x11, 0x04, 0x02,
+  0x02, 0x04, 0x11, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x04, 0x05,
+  0x0E, 0x05, 0x01, 0x06, 0x0B, 0x01, 0x08, 0x07, 0x01, 0x00, 0x0D, 0x01,
+  0x01, 0x0E, 0x02, 0x02, 0x04, 0x0B, 0x05, 0x02, 0x02, 0x04, 0x0D, 0x04,
+  0x02, 0x02, 0x04, 0x0D, 0x05, 0x02, 0x02, 0x04, 0x0E, 0x04, 0x02, 0x02,
+  0x04, 0x0E, 0x04, 0x02, 0x02, 0x04, 0x0E, 0x04, 0x02, 0x02, 0x04, 0x0E,
+  0x04, 0x02, 0x02, 0x04, 0x0D, 0x05, 0x02, 0x02, 0x04, 0x0D, 0x04, 0x02,
+  0x02, 0x04, 0x0B, 0x05, 0x01, 0x02, 0x0D, 0x01, 0x02, 0x0B, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x00,
+  0x08, 0x01, 0x08, 0x07, 0x01, 0x06, 0x0B, 0x02, 0x04, 0x05, 0x0E, 0x05,
+  0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04, 0x11, 0x04, 0x02, 0x02,
+  0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x12, 0x04, 0x02, 0x01, 0x04, 0x12,
+  0x04, 0x02, 0x00, 0x04, 0x13, 0x03, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02,
+  0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04,
+  0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x00, 0x04, 0x13, 0x04,
+  0x02, 0x00, 0x04, 0x13, 0x04, 0x02, 0x01, 0x03, 0x13, 0x03, 0x02, 0x01,
+  0x04, 0x12, 0x04, 0x02, 0x01, 0x04, 0x12, 0x04, 0x02, 0x02, 0x04, 0x11,
+  0x04, 0x02, 0x03, 0x03, 0x11, 0x03, 0x02, 0x04, 0x03, 0x10, 0x03, 0x02,
+  0x05, 0x04, 0x0E, 0x04, 0x01, 0x08, 0x07, 0x01, 0x09, 0x05, 0x01, 0x0A,
+  0x05, 0x01, 0x0B, 0x05, 0x01, 0x0C, 0x06, 0x01, 0x0F, 0x05, 0x01, 0x11,
+  0x06, 0x01, 0x00, 0x0C, 0x01, 0x01, 0x0E, 0x02, 0x02, 0x04, 0x0B, 0x05,
+  0x02, 0x02, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x04, 0x0D, 0x04, 0x02, 0x02,
+  0x04, 0x0D, 0x04, 0x02, 0x02, 0x04, 0x0D, 0x04, 0x02, 0x02, 0x04, 0x0D,
+  0x04, 0x02, 0x02, 0x04, 0x0D, 0x04, 0x02, 0x02, 0x04, 0x0C, 0x04, 0x02,
+  0x02, 0x04, 0x0A, 0x05, 0x01, 0x02, 0x0C, 0x01, 0x02, 0x09, 0x02, 0x02,
+  0x04, 0x08, 0x04, 0x02, 0x02, 0x04, 0x09, 0x04, 0x02, 0x02, 0x04, 0x0A,
+  0x04, 0x02, 0x02, 0x04, 0x0A, 0x04, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02,
+  0x02, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x04, 0x0D, 0x04, 0x02, 0x02, 0x04,
+  0x0D, 0x05, 0x02, 0x01, 0x06, 0x0E, 0x05, 0x02, 0x00, 0x08, 0x0F, 0x06,
+  0x02, 0x05, 0x04, 0x0D, 0x01, 0x01, 0x03, 0x0B, 0x02, 0x02, 0x04, 0x0A,
+  0x05, 0x02, 0x02, 0x02, 0x0C, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x02, 0x02,
+  0x01, 0x03, 0x0D, 0x02, 0x02, 0x01, 0x03, 0x0E, 0x01, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x05, 0x01, 0x02, 0x06, 0x01, 0x03, 0x07, 0x01, 0x04, 0x07,
+  0x01, 0x06, 0x07, 0x01, 0x08, 0x06, 0x01, 0x0A, 0x05, 0x01, 0x0B, 0x05,
+  0x02, 0x00, 0x01, 0x0C, 0x04, 0x02, 0x00, 0x01, 0x0C, 0x04, 0x02, 0x00,
+  0x02, 0x0C, 0x04, 0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x01, 0x03, 0x0B,
+  0x04, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x02, 0x01, 0x01, 0x04, 0x09, 0x02,
+  0x01, 0x01, 0x06, 0x06, 0x01, 0x00, 0x14, 0x01, 0x00, 0x14, 0x03, 0x00,
+  0x03, 0x08, 0x04, 0x11, 0x03, 0x03, 0x00, 0x02, 0x08, 0x04, 0x12, 0x02,
+  0x03, 0x00, 0x01, 0x08, 0x04, 0x13, 0x01, 0x01, 0x08, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x06, 0x01, 0x06,
+  0x08, 0x02, 0x00, 0x08, 0x0F, 0x07, 0x02, 0x01, 0x06, 0x11, 0x03, 0x02,
+  0x02, 0x04, 0x12, 0x01, 0x02, 0x02, 0x04, 0x12, 0x01, 0x02, 0x02, 0x04,
+  0x12, 0x01, 0x02, 0x02, 0x04, 0x12, 0x01, 0x02, 0x02, 0x04, 0x12, 0x01,
+  0x02, 0x02, 0x04, 0x12, 0x01, 0x02, 0x02, 0x04, 0x12, 0x01, 0x02, 0x02,
+  0x04, 0x12, 0x01, 0x02, 0x02, 0x04, 0x12, 0x01, 0x02, 0x02, 0x04, 0x12,
+  0x01, 0x02, 0x02, 0x04, 0x12, 0x01, 0x02, 0x02, 0x04, 0x12, 0x01, 0x02,
+  0x02, 0x04, 0x12, 0x01, 0x02, 0x02, 0x04, 0x12, 0x01, 0x02, 0x02, 0x04,
+  0x12, 0x01, 0x02, 0x02, 0x04, 0x12, 0x01, 0x02, 0x03, 0x04, 0x11, 0x01,
+  0x02, 0x03, 0x04, 0x10, 0x02, 0x02, 0x04, 0x05, 0x0F, 0x02, 0x01, 0x05,
+  0x0B, 0x01, 0x07, 0x07, 0x02, 0x00, 0x0A, 0x11, 0x07, 0x02, 0x02, 0x05,
+  0x13, 0x04, 0x02, 0x03, 0x04, 0x14, 0x02, 0x02, 0x04, 0x03, 0x13, 0x02,
+  0x02, 0x04, 0x04, 0x13, 0x02, 0x02, 0x05, 0x03, 0x13, 0x01, 0x02, 0x05,
+  0x04, 0x12, 0x02, 0x02, 0x05, 0x04, 0x12, 0x02, 0x02, 0x06, 0x04, 0x11,
+  0x02, 0x02, 0x06, 0x04, 0x11, 0x02, 0x02, 0x07, 0x04, 0x11, 0x01, 0x02,
+  0x07, 0x04, 0x10, 0x02, 0x02, 0x08, 0x04, 0x10, 0x02, 0x02, 0x08, 0x04,
+  0x0F, 0x02, 0x02, 0x09, 0x03, 0x0F, 0x02, 0x02, 0x09, 0x04, 0x0E, 0x02,
+  0x02, 0x0A, 0x03, 0x0E, 0x02, 0x01, 0x0A, 0x05, 0x01, 0x0B, 0x04, 0x01,
+  0x0B, 0x04, 0x01, 0x0C, 0x02, 0x01, 0x0C, 0x02, 0x01, 0x0C, 0x01, 0x03,
+  0x00, 0x09, 0x0B, 0x09, 0x1A, 0x07, 0x03, 0x02, 0x05, 0x0D, 0x05, 0x1C,
+  0x03, 0x03, 0x03, 0x04, 0x0E, 0x04, 0x1C, 0x02, 0x03, 0x03, 0x04, 0x0E,
+  0x04, 0x1C, 0x02, 0x03, 0x04, 0x03, 0x0F, 0x04, 0x1C, 0x01, 0x03, 0x04,
+  0x04, 0x0F, 0x04, 0x1B, 0x02, 0x03, 0x05, 0x03, 0x10, 0x03, 0x1B, 0x02,
+  0x03, 0x05, 0x04, 0x10, 0x04, 0x1B, 0x01, 0x03, 0x05, 0x04, 0x0F, 0x05,
+  0x1A, 0x02, 0x04, 0x06, 0x03, 0x0F, 0x01, 0x11, 0x04, 0x1A, 0x02, 0x04,
+  0x06, 0x04, 0x0E, 0x02, 0x11, 0x04, 0x1A, 0x01, 0x04, 0x06, 0x04, 0x0E,
+  0x02, 0x12, 0x03, 0x19, 0x02, 0x04, 0x07, 0x04, 0x0E, 0x01, 0x12, 0x04,
+  0x19, 0x01, 0x04, 0x07, 0x04, 0x0D, 0x02, 0x12, 0x04, 0x18, 0x02, 0x04,
+  0x08, 0x03, 0x0D, 0x01, 0x13, 0x04, 0x18, 0x02, 0x03, 0x08, 0x06, 0x13,
+  0x04, 0x18, 0x01, 0x02, 0x08, 0x06, 0x14, 0x05, 0x02, 0x09, 0x04, 0x14,
+  0x05, 0x02, 0x09, 0x04, 0x14, 0x04, 0x02, 0x09, 0x04, 0x15, 0x03, 0x02,
+  0x0A, 0x02, 0x15, 0x03, 0x02, 0x0A, 0x02, 0x16, 0x01, 0x02, 0x0A, 0x01,
+  0x16, 0x01, 0x02, 0x01, 0x0A, 0x10, 0x08, 0x02, 0x03, 0x06, 0x12, 0x04,
+  0x02, 0x04, 0x05, 0x12, 0x03, 0x02, 0x05, 0x04, 0x12, 0x02, 0x02, 0x06,
+  0x04, 0x11, 0x02, 0x02, 0x07, 0x04, 0x10, 0x02, 0x02, 0x07, 0x04, 0x0F,
+  0x02, 0x02, 0x08, 0x04, 0x0E, 0x02, 0x02, 0x09, 0x04, 0x0E, 0x02, 0x01,
+  0x09, 0x06, 0x01, 0x0A, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0A, 0x06, 0x02,
+  0x09, 0x02, 0x0C, 0x04, 0x02, 0x09, 0x02, 0x0D, 0x04, 0x02, 0x08, 0x02,
+  0x0E, 0x04, 0x02, 0x07, 0x02, 0x0E, 0x05, 0x02, 0x06, 0x02, 0x0F, 0x04,
+  0x02, 0x05, 0x02, 0x10, 0x04, 0x02, 0x04, 0x02, 0x10, 0x05, 0x02, 0x03,
+  0x03, 0x11, 0x05, 0x02, 0x02, 0x04, 0x11, 0x06, 0x02, 0x00, 0x09, 0x0E,
+  0x0B, 0x02, 0x00, 0x0A, 0x10, 0x08, 0x02, 0x01, 0x06, 0x13, 0x03, 0x02,
+  0x03, 0x04, 0x13, 0x02, 0x02, 0x03, 0x05, 0x12, 0x02, 0x02, 0x04, 0x04,
+  0x11, 0x02, 0x02, 0x05, 0x04, 0x11, 0x02, 0x02, 0x06, 0x04, 0x10, 0x02,
+  0x02, 0x06, 0x05, 0x0F, 0x02, 0x02, 0x07, 0x04, 0x0F, 0x02, 0x02, 0x08,
+  0x04, 0x0E, 0x02, 0x01, 0x08, 0x07, 0x01, 0x09, 0x06, 0x01, 0x0A, 0x04,
+  0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04,
+  0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04,
+  0x01, 0x09, 0x06, 0x01, 0x07, 0x0A, 0x01, 0x02, 0x12, 0x01, 0x02, 0x12,
+  0x02, 0x01, 0x03, 0x0F, 0x04, 0x02, 0x01, 0x02, 0x0E, 0x04, 0x02, 0x01,
+  0x01, 0x0E, 0x03, 0x01, 0x0D, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0B, 0x04,
+  0x01, 0x0B, 0x03, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08, 0x04,
+  0x01, 0x08, 0x03, 0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x03, 0x02, 0x04, 0x04, 0x14, 0x01, 0x02, 0x03, 0x04, 0x13,
+  0x02, 0x02, 0x02, 0x04, 0x13, 0x02, 0x02, 0x02, 0x03, 0x11, 0x03, 0x01,
+  0x01, 0x13, 0x01, 0x00, 0x14, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x03, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x03, 0x01,
+  0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x03, 0x01, 0x06, 0x02, 0x01,
+  0x06, 0x02, 0x01, 0x06, 0x03, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01,
+  0x07, 0x03, 0x01, 0x08, 0x02, 0x01, 0x00, 0x07, 0x01, 0x05, 0x02, 0x01,
+  0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01,
+  0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01,
+  0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01,
+  0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01,
+  0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01,
+  0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01,
+  0x05, 0x02, 0x01, 0x00, 0x07, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x05, 0x02, 0x04, 0x03, 0x08, 0x02, 0x02, 0x04, 0x02, 0x08, 0x03,
+  0x02, 0x03, 0x03, 0x09, 0x02, 0x02, 0x03, 0x02, 0x09, 0x03, 0x02, 0x02,
+  0x03, 0x0A, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x01, 0x03, 0x0B,
+  0x02, 0x02, 0x01, 0x02, 0x0B, 0x02, 0x02, 0x00, 0x03, 0x0C, 0x02, 0x02,
+  0x00, 0x02, 0x0C, 0x02, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x03, 0x01, 0x01, 0x03, 0x01, 0x03, 0x02, 0x01, 0x04,
+  0x02, 0x01, 0x06, 0x02, 0x01, 0x03, 0x05, 0x02, 0x01, 0x03, 0x07, 0x02,
+  0x02, 0x00, 0x03, 0x08, 0x02, 0x02, 0x00, 0x03, 0x08, 0x02, 0x02, 0x00,
+  0x03, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x06, 0x04, 0x02, 0x04, 0x02,
+  0x08, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x01, 0x03, 0x08, 0x02,
+  0x02, 0x00, 0x03, 0x08, 0x02, 0x02, 0x00, 0x03, 0x08, 0x02, 0x02, 0x00,
+  0x03, 0x08, 0x02, 0x03, 0x00, 0x04, 0x07, 0x03, 0x0C, 0x01, 0x02, 0x01,
+  0x06, 0x08, 0x04, 0x02, 0x01, 0x04, 0x09, 0x02, 0x00, 0x01, 0x02, 0x03,
+  0x01, 0x00, 0x05, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x02, 0x02, 0x03,
+  0x07, 0x05, 0x02, 0x02, 0x03, 0x06, 0x08, 0x02, 0x02, 0x04, 0x0A, 0x05,
+  0x02, 0x02, 0x03, 0x0C, 0x03, 0x02, 0x02, 0x03, 0x0C, 0x04, 0x02, 0x02,
+  0x03, 0x0D, 0x03, 0x02, 0x02, 0x03, 0x0D, 0x03, 0x02, 0x02, 0x03, 0x0D,
+  0x03, 0x02, 0x02, 0x03, 0x0D, 0x03, 0x02, 0x02, 0x03, 0x0D, 0x03, 0x02,
+  0x02, 0x03, 0x0D, 0x02, 0x02, 0x02, 0x03, 0x0C, 0x03, 0x02, 0x02, 0x03,
+  0x0C, 0x02, 0x02, 0x02, 0x04, 0x0B, 0x03, 0x01, 0x03, 0x09, 0x01, 0x05,
+  0x06, 0x01, 0x05, 0x06, 0x01, 0x03, 0x0A, 0x02, 0x02, 0x03, 0x09, 0x05,
+  0x02, 0x01, 0x02, 0x0A, 0x04, 0x02, 0x01, 0x02, 0x0B, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x04, 0x0D, 0x01, 0x02, 0x01, 0x04,
+  0x0B, 0x02, 0x01, 0x01, 0x0B, 0x01, 0x02, 0x09, 0x01, 0x04, 0x05, 0x00,
+  0x01, 0x0B, 0x03, 0x01, 0x09, 0x05, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03,
+  0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03,
+  0x02, 0x05, 0x04, 0x0B, 0x03, 0x02, 0x03, 0x07, 0x0B, 0x03, 0x02, 0x02,
+  0x03, 0x09, 0x05, 0x02, 0x01, 0x03, 0x0A, 0x04, 0x02, 0x01, 0x03, 0x0B,
+  0x03, 0x02, 0x01, 0x02, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02,
+  0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x03,
+  0x0B, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x04, 0x0B, 0x03,
+  0x02, 0x01, 0x03, 0x0B, 0x03, 0x02, 0x01, 0x05, 0x0A, 0x05, 0x02, 0x02,
+  0x08, 0x0B, 0x05, 0x02, 0x04, 0x05, 0x0B, 0x01, 0x01, 0x04, 0x05, 0x01,
+  0x02, 0x09, 0x02, 0x02, 0x01, 0x08, 0x04, 0x02, 0x01, 0x01, 0x09, 0x03,
+  0x01, 0x01, 0x0B, 0x01, 0x00, 0x0D, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x01, 0x02,
+  0x00, 0x04, 0x0B, 0x02, 0x02, 0x01, 0x04, 0x0A, 0x02, 0x01, 0x01, 0x0A,
+  0x01, 0x02, 0x08, 0x01, 0x03, 0x06, 0x01, 0x07, 0x05, 0x01, 0x05, 0x08,
+  0x02, 0x04, 0x03, 0x0A, 0x03, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x01, 0x09, 0x01, 0x01, 0x09, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x05, 0x01, 0x00, 0x09, 0x01,
+  0x04, 0x06, 0x01, 0x03, 0x0D, 0x02, 0x02, 0x03, 0x08, 0x08, 0x02, 0x01,
+  0x03, 0x09, 0x03, 0x02, 0x01, 0x03, 0x09, 0x03, 0x02, 0x01, 0x03, 0x0A,
+  0x02, 0x02, 0x01, 0x03, 0x0A, 0x02, 0x02, 0x01, 0x03, 0x0A, 0x02, 0x02,
+  0x02, 0x03, 0x0A, 0x01, 0x02, 0x03, 0x03, 0x09, 0x02, 0x01, 0x04, 0x05,
+  0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x0A,
+  0x01, 0x02, 0x0C, 0x01, 0x03, 0x0C, 0x02, 0x02, 0x01, 0x0D, 0x02, 0x02,
+  0x01, 0x01, 0x0E, 0x01, 0x02, 0x00, 0x02, 0x0E, 0x01, 0x02, 0x00, 0x02,
+  0x0D, 0x01, 0x02, 0x00, 0x04, 0x0B, 0x02, 0x01, 0x01, 0x0B, 0x01, 0x03,
+  0x06, 0x00, 0x01, 0x02, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x03, 0x01,
+  0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x08, 0x04, 0x02, 0x02, 0x03, 0x06, 0x07,
+  0x02, 0x02, 0x05, 0x0A, 0x04, 0x02, 0x02, 0x04, 0x0B, 0x03, 0x02, 0x02,
+  0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B,
+  0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02,
+  0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03,
+  0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03,
+  0x02, 0x01, 0x05, 0x0A, 0x05, 0x02, 0x00, 0x07, 0x09, 0x07, 0x01, 0x03,
+  0x02, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x03, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01,
+  0x00, 0x08, 0x01, 0x06, 0x02, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01,
+  0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x01, 0x01, 0x05, 0x04,
+  0x01, 0x04, 0x05, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x02, 0x02, 0x00, 0x03,
+  0x05, 0x03, 0x01, 0x00, 0x07, 0x01, 0x01, 0x05, 0x00, 0x01, 0x02, 0x03,
+  0x01, 0x00, 0x05, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x02, 0x02, 0x03,
+  0x09, 0x07, 0x02, 0x02, 0x03, 0x0A, 0x04, 0x02, 0x02, 0x03, 0x0A, 0x02,
+  0x02, 0x02, 0x03, 0x09, 0x02, 0x02, 0x02, 0x03, 0x08, 0x01, 0x02, 0x02,
+  0x03, 0x07, 0x01, 0x01, 0x02, 0x06, 0x01, 0x02, 0x07, 0x02, 0x02, 0x03,
+  0x06, 0x03, 0x02, 0x02, 0x03, 0x07, 0x03, 0x02, 0x02, 0x03, 0x08, 0x03,
+  0x02, 0x02, 0x03, 0x08, 0x04, 0x02, 0x02, 0x03, 0x09, 0x04, 0x02, 0x02,
+  0x03, 0x0A, 0x04, 0x02, 0x01, 0x05, 0x0B, 0x04, 0x02, 0x00, 0x07, 0x09,
+  0x08, 0x00, 0x01, 0x03, 0x03, 0x01, 0x01, 0x05, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01,
+  0x00, 0x08, 0x03, 0x02, 0x03, 0x08, 0x04, 0x11, 0x05, 0x03, 0x00, 0x05,
+  0x06, 0x07, 0x0F, 0x08, 0x03, 0x02, 0x05, 0x0A, 0x06, 0x14, 0x03, 0x03,
+  0x02, 0x03, 0x0B, 0x03, 0x15, 0x03, 0x03, 0x02, 0x03, 0x0B, 0x03, 0x15,
+  0x03, 0x03, 0x02, 0x03, 0x0B, 0x03, 0x15, 0x03, 0x03, 0x02, 0x03, 0x0B,
+  0x03, 0x15, 0x03, 0x03, 0x02, 0x03, 0x0B, 0x03, 0x15, 0x03, 0x03, 0x02,
+  0x03, 0x0B, 0x03, 0x15, 0x03, 0x03, 0x02, 0x03, 0x0B, 0x03, 0x15, 0x03,
+  0x03, 0x02, 0x03, 0x0B, 0x03, 0x15, 0x03, 0x03, 0x02, 0x03, 0x0B, 0x03,
+  0x15, 0x03, 0x03, 0x02, 0x03, 0x0B, 0x03, 0x15, 0x03, 0x03, 0x02, 0x03,
+  0x0B, 0x03, 0x15, 0x03, 0x03, 0x02, 0x03, 0x0B, 0x04, 0x15, 0x03, 0x03,
+  0x00, 0x07, 0x09, 0x07, 0x13, 0x07, 0x02, 0x02, 0x03, 0x08, 0x04, 0x02,
+  0x00, 0x05, 0x06, 0x07, 0x02, 0x02, 0x05, 0x0A, 0x04, 0x02, 0x02, 0x03,
+  0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03,
+  0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02,
+  0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B,
+  0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02,
+  0x02, 0x03, 0x0B, 0x03, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x02, 0x00, 0x07,
+  0x09, 0x07, 0x01, 0x05, 0x06, 0x01, 0x03, 0x0A, 0x02, 0x02, 0x04, 0x09,
+  0x05, 0x02, 0x01, 0x04, 0x0A, 0x05, 0x02, 0x01, 0x03, 0x0B, 0x04, 0x02,
+  0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x04,
+  0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x04,
+  0x02, 0x00, 0x05, 0x0C, 0x04, 0x02, 0x01, 0x04, 0x0C, 0x03, 0x02, 0x01,
+  0x05, 0x0B, 0x03, 0x02, 0x02, 0x05, 0x0A, 0x04, 0x01, 0x04, 0x08, 0x01,
+  0x05, 0x05, 0x02, 0x03, 0x02, 0x08, 0x04, 0x02, 0x00, 0x05, 0x06, 0x08,
+  0x02, 0x02, 0x05, 0x0B, 0x04, 0x02, 0x02, 0x03, 0x0C, 0x03, 0x02, 0x02,
+  0x03, 0x0C, 0x04, 0x02, 0x02, 0x03, 0x0D, 0x03, 0x02, 0x02, 0x03, 0x0D,
+  0x03, 0x02, 0x02, 0x03, 0x0D, 0x03, 0x02, 0x02, 0x03, 0x0D, 0x03, 0x02,
+  0x02, 0x03, 0x0D, 0x03, 0x02, 0x02, 0x03, 0x0D, 0x02, 0x02, 0x02, 0x03,
+  0x0C, 0x03, 0x02, 0x02, 0x03, 0x0C, 0x02, 0x02, 0x02, 0x05, 0x0B, 0x03,
+  0x02, 0x02, 0x03, 0x06, 0x07, 0x02, 0x02, 0x03, 0x07, 0x04, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x05, 0x01, 0x00, 0x08, 0x02, 0x05,
+  0x05, 0x0D, 0x01, 0x02, 0x03, 0x08, 0x0C, 0x02, 0x02, 0x02, 0x04, 0x0A,
+  0x04, 0x02, 0x01, 0x03, 0x0B, 0x03, 0x02, 0x01, 0x03, 0x0B, 0x03, 0x02,
+  0x01, 0x02, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x03,
+  0x0B, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x03,
+  0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x04, 0x0B, 0x03, 0x02, 0x01,
+  0x03, 0x0B, 0x03, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x02, 0x02, 0x08, 0x0B,
+  0x03, 0x02, 0x03, 0x05, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03,
+  0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03,
+  0x01, 0x0A, 0x05, 0x01, 0x08, 0x08, 0x02, 0x03, 0x02, 0x07, 0x04, 0x02,
+  0x00, 0x05, 0x06, 0x05, 0x02, 0x02, 0x04, 0x08, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x05, 0x01, 0x00, 0x07,
+  0x02, 0x02, 0x05, 0x09, 0x01, 0x02, 0x01, 0x02, 0x07, 0x03, 0x02, 0x00,
+  0x02, 0x08, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02, 0x02, 0x00, 0x02, 0x09,
+  0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x04, 0x01, 0x02, 0x05, 0x01, 0x03,
+  0x06, 0x01, 0x05, 0x05, 0x02, 0x00, 0x01, 0x07, 0x03, 0x02, 0x00, 0x01,
+  0x08, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02,
+  0x02, 0x00, 0x03, 0x07, 0x02, 0x02, 0x00, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x07, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x02, 0x01,
+  0x04, 0x07, 0x01, 0x01, 0x01, 0x06, 0x01, 0x02, 0x04, 0x02, 0x00, 0x05,
+  0x09, 0x05, 0x02, 0x02, 0x03, 0x0A, 0x04, 0x02, 0x02, 0x03, 0x0B, 0x03,
+  0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02,
+  0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B,
+  0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02,
+  0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03,
+  0x0B, 0x03, 0x02, 0x02, 0x04, 0x09, 0x05, 0x02, 0x03, 0x07, 0x0B, 0x05,
+  0x02, 0x04, 0x04, 0x0B, 0x02, 0x02, 0x00, 0x07, 0x0B, 0x05, 0x02, 0x01,
+  0x05, 0x0D, 0x02, 0x02, 0x02, 0x03, 0x0D, 0x01, 0x02, 0x03, 0x03, 0x0D,
+  0x01, 0x02, 0x03, 0x03, 0x0C, 0x02, 0x02, 0x04, 0x03, 0x0C, 0x01, 0x02,
+  0x04, 0x03, 0x0B, 0x02, 0x02, 0x05, 0x03, 0x0B, 0x01, 0x02, 0x05, 0x03,
+  0x0B, 0x01, 0x02, 0x05, 0x03, 0x0A, 0x01, 0x02, 0x06, 0x03, 0x0A, 0x01,
+  0x01, 0x06, 0x05, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x08, 0x01,
+  0x01, 0x08, 0x01, 0x03, 0x00, 0x06, 0x09, 0x07, 0x13, 0x05, 0x03, 0x01,
+  0x04, 0x0A, 0x04, 0x15, 0x02, 0x03, 0x02, 0x03, 0x0B, 0x03, 0x15, 0x01,
+  0x03, 0x02, 0x03, 0x0B, 0x03, 0x15, 0x01, 0x03, 0x03, 0x03, 0x0B, 0x03,
+  0x14, 0x02, 0x03, 0x03, 0x03, 0x0C, 0x03, 0x14, 0x01, 0x03, 0x03, 0x03,
+  0x0B, 0x04, 0x13, 0x02, 0x04, 0x04, 0x03, 0x0B, 0x01, 0x0D, 0x03, 0x13,
+  0x01, 0x04, 0x04, 0x03, 0x0A, 0x02, 0x0D, 0x03, 0x13, 0x01, 0x04, 0x05,
+  0x03, 0x0A, 0x01, 0x0E, 0x02, 0x12, 0x02, 0x04, 0x05, 0x03, 0x09, 0x02,
+  0x0E, 0x03, 0x12, 0x01, 0x03, 0x05, 0x03, 0x09, 0x01, 0x0E, 0x05, 0x02,
+  0x06, 0x04, 0x0F, 0x03, 0x02, 0x06, 0x03, 0x0F, 0x03, 0x02, 0x07, 0x02,
+  0x10, 0x01, 0x02, 0x07, 0x01, 0x10, 0x01, 0x02, 0x01, 0x07, 0x09, 0x06,
+  0x02, 0x02, 0x04, 0x0B, 0x02, 0x02, 0x03, 0x04, 0x0A, 0x02, 0x02, 0x04,
+  0x03, 0x0A, 0x01, 0x02, 0x05, 0x03, 0x09, 0x02, 0x01, 0x05, 0x05, 0x01,
+  0x06, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x05, 0x02, 0x06, 0x01, 0x08,
+  0x03, 0x02, 0x05, 0x01, 0x09, 0x03, 0x02, 0x04, 0x02, 0x09, 0x04, 0x02,
+  0x03, 0x02, 0x0A, 0x03, 0x02, 0x03, 0x01, 0x0B, 0x03, 0x02, 0x02, 0x02,
+  0x0B, 0x04, 0x02, 0x00, 0x05, 0x09, 0x08, 0x02, 0x00, 0x07, 0x0C, 0x04,
+  0x02, 0x01, 0x05, 0x0D, 0x02, 0x02, 0x02, 0x03, 0x0D, 0x02, 0x02, 0x03,
+  0x03, 0x0D, 0x01, 0x02, 0x03, 0x03, 0x0C, 0x02, 0x02, 0x04, 0x03, 0x0C,
+  0x02, 0x02, 0x04, 0x03, 0x0C, 0x01, 0x02, 0x04, 0x04, 0x0B, 0x02, 0x02,
+  0x05, 0x03, 0x0B, 0x01, 0x02, 0x05, 0x04, 0x0B, 0x01, 0x02, 0x06, 0x03,
+  0x0A, 0x02, 0x02, 0x06, 0x03, 0x0A, 0x01, 0x01, 0x07, 0x04, 0x01, 0x07,
+  0x04, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x01, 0x01, 0x08,
+  0x01, 0x01, 0x07, 0x02, 0x01, 0x07, 0x01, 0x01, 0x06, 0x02, 0x01, 0x01,
+  0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x0C, 0x01, 0x01,
+  0x0C, 0x02, 0x01, 0x02, 0x09, 0x03, 0x02, 0x01, 0x01, 0x08, 0x03, 0x01,
+  0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x02, 0x03, 0x03, 0x0D,
+  0x01, 0x02, 0x02, 0x03, 0x0C, 0x02, 0x02, 0x01, 0x03, 0x0C, 0x02, 0x01,
+  0x00, 0x0D, 0x01, 0x00, 0x0D, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x03, 0x01, 0x04, 0x03, 0x01, 0x05, 0x03, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01,
+  0x04, 0x01, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x02, 0x05, 0x02, 0x01, 0x08, 0x0D,
+  0x03, 0x02, 0x00, 0x03, 0x06, 0x09, 0x01, 0x09, 0x05 };
+
+const GFXglyph FreeSerif18pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,   9,    0,    1 },   // 0x20 ' '
+  {     0,   4,  24,  12,    5,  -23 },   // 0x21 '!'
+  {    66,   8,   9,  14,    3,  -23 },   // 0x22 '"'
+  {   111,  17,  23,  17,    0,  -22 },   // 0x23 '#'
+  {   218,  13,  27,  17,    2,  -24 },   // 0x24 '$'
+  {   349,  25,  23,  29,    2,  -22 },   // 0x25 '%'
+  {   514,  25,  25,  27,    1,  -24 },   // 0x26 '&'
+  {   651,   3,   9,   7,    2,  -23 },   // 0x27 '''
+  {   678,   9,  30,  12,    2,  -23 },   // 0x28 '('
+  {   768,   9,  30,  12,    1,  -22 },   // 0x29 ')'
+  {   858,  12,  14,  18,    3,  -23 },   // 0x2A '*'
+  {   926,  16,  18,  20,    2,  -17 },   // 0x2B '+'
+  {   980,   4,   9,   9,    2,   -3 },   // 0x2C ','
+  {  1007,   8,   2,  12,    1,   -8 },   // 0x2D '-'
+  {  1013,   4,   4,   9,    2,   -3 },   // 0x2E '.'
+  {  1025,  10,  24,  10,    0,  -23 },   // 0x2F '/'
+  {  1097,  16,  24,  18,    1,  -23 },   // 0x30 '0'
+  {  1213,  10,  24,  18,    3,  -23 },   // 0x31 '1'
+  {  1287,  16,  24,  17,    1,  -23 },   // 0x32 '2'
+  {  1371,  13,  24,  17,    2,  -23 },   // 0x33 '3'
+  {  1451,  16,  23,  18,    0,  -22 },   // 0x34 '4'
+  {  1542,  13,  24,  17,    2,  -23 },   // 0x35 '5'
+  {  1614,  16,  24,  18,    1,  -23 },   // 0x36 '6'
+  {  1712,  14,  23,  18,    1,  -22 },   // 0x37 '7'
+  {  1785,  12,  25,  18,    2,  -24 },   // 0x38 '8'
+  {  1898,  16,  26,  17,    1,  -24 },   // 0x39 '9'
+  {  2006,   4,  17,   9,    2,  -16 },   // 0x3A ':'
+  {  2039,   5,  22,   9,    2,  -16 },   // 0x3B ';'
+  {  2087,  18,  18,  20,    1,  -17 },   // 0x3C '<'
+  {  2141,  18,   9,  20,    1,  -12 },   // 0x3D '='
+  {  2158,  18,  18,  20,    1,  -17 },   // 0x3E '>'
+  {  2212,  13,  25,  16,    2,  -24 },   // 0x3F '?'
+  {  2293,  24,  25,  30,    3,  -24 },   // 0x40 '@'
+  {  2450,  24,  23,  25,    1,  -22 },   // 0x41 'A'
+  {  2551,  20,  23,  22,    1,  -22 },   // 0x42 'B'
+  {  2654,  22,  24,  23,    1,  -23 },   // 0x43 'C'
+  {  2748,  23,  23,  25,    1,  -22 },   // 0x44 'D'
+  {  2855,  20,  23,  21,    2,  -22 },   // 0x45 'E'
+  {  2946,  17,  23,  20,    2,  -22 },   // 0x46 'F'
+  {  3029,  23,  24,  25,    1,  -23 },   // 0x47 'G'
+  {  3137,  22,  23,  25,    2,  -22 },   // 0x48 'H'
+  {  3248,   9,  23,  11,    2,  -22 },   // 0x49 'I'
+  {  3317,  12,  23,  13,    0,  -22 },   // 0x4A 'J'
+  {  3390,  23,  23,  25,    2,  -22 },   // 0x4B 'K'
+  {  3501,  19,  23,  21,    2,  -22 },   // 0x4C 'L'
+  {  3578,  29,  23,  31,    1,  -22 },   // 0x4D 'M'
+  {  3755,  23,  23,  25,    1,  -22 },   // 0x4E 'N'
+  {  3892,  23,  24,  25,    1,  -23 },   // 0x4F 'O'
+  {  4004,  18,  23,  20,    1,  -22 },   // 0x50 'P'
+  {  4093,  23,  30,  25,    1,  -23 },   // 0x51 'Q'
+  {  4225,  21,  23,  23,    2,  -22 },   // 0x52 'R'
+  {  4332,  16,  24,  19,    1,  -23 },   // 0x53 'S'
+  {  4432,  20,  23,  21,    1,  -22 },   // 0x54 'T'
+  {  4513,  22,  23,  25,    2,  -22 },   // 0x55 'U'
+  {  4624,  24,  23,  25,    0,  -22 },   // 0x56 'V'
+  {  4727,  33,  23,  33,    0,  -22 },   // 0x57 'W'
+  {  4886,  25,  23,  25,    0,  -22 },   // 0x58 'X'
+  {  4993,  24,  23,  25,    1,  -22 },   // 0x59 'Y'
+  {  5082,  21,  23,  21,    0,  -22 },   // 0x5A 'Z'
+  {  5165,   7,  28,  12,    3,  -22 },   // 0x5B '['
+  {  5249,  10,  24,  10,    0,  -23 },   // 0x5C '\'
+  {  5321,   7,  28,  12,    2,  -22 },   // 0x5D ']'
+  {  5405,  15,  13,  16,    1,  -22 },   // 0x5E '^'
+  {  5464,  18,   2,  17,    0,    3 },   // 0x5F '_'
+  {  5470,   8,   6,   9,    1,  -23 },   // 0x60 '`'
+  {  5488,  13,  16,  15,    2,  -15 },   // 0x61 'a'
+  {  5564,  16,  25,  17,    1,  -24 },   // 0x62 'b'
+  {  5665,  14,  16,  16,    1,  -15 },   // 0x63 'c'
+  {  5723,  16,  25,  17,    1,  -24 },   // 0x64 'd'
+  {  5828,  13,  16,  16,    1,  -15 },   // 0x65 'e'
+  {  5886,  13,  25,  13,    0,  -24 },   // 0x66 'f'
+  {  5963,  16,  24,  16,    1,  -15 },   // 0x67 'g'
+  {  6061,  16,  25,  17,    1,  -24 },   // 0x68 'h'
+  {  6166,   8,  24,  10,    0,  -23 },   // 0x69 'i'
+  {  6230,   9,  32,  12,    0,  -23 },   // 0x6A 'j'
+  {  6320,  17,  25,  18,    1,  -24 },   // 0x6B 'k'
+  {  6421,   8,  25,   9,    0,  -24 },   // 0x6C 'l'
+  {  6494,  26,  16,  27,    1,  -15 },   // 0x6D 'm'
+  {  6606,  16,  16,  17,    1,  -15 },   // 0x6E 'n'
+  {  6686,  16,  16,  17,    1,  -15 },   // 0x6F 'o'
+  {  6758,  16,  24,  17,    1,  -15 },   // 0x70 'p'
+  {  6862,  16,  24,  17,    1,  -15 },   // 0x71 'q'
+  {  6966,  11,  16,  12,    1,  -15 },   // 0x72 'r'
+  {  7020,  10,  16,  13,    1,  -15 },   // 0x73 's'
+  {  7090,   8,  19,  10,    2,  -18 },   // 0x74 't'
+  {  7149,  16,  16,  17,    1,  -15 },   // 0x75 'u'
+  {  7229,  16,  16,  16,    0,  -15 },   // 0x76 'v'
+  {  7299,  24,  16,  24,    0,  -15 },   // 0x77 'w'
+  {  7411,  17,  16,  17,    0,  -15 },   // 0x78 'x'
+  {  7483,  16,  24,  16,    0,  -15 },   // 0x79 'y'
+  {  7579,  14,  16,  15,    0,  -15 },   // 0x7A 'z'
+  {  7637,   8,  30,  17,    3,  -23 },   // 0x7B '{'
+  {  7727,   2,  24,   7,    2,  -23 },   // 0x7C '|'
+  {  7799,   8,  30,  17,    6,  -22 },   // 0x7D '}'
+  {  7889,  16,   4,  17,    1,  -10 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSerif18pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSerif18pt7bSpanData,
+    (GFXglyph *)FreeSerif18pt7bSpanGlyphs,
+    0x20, 0x7E, 42 } };
+
+// Approx. 8689 bytes
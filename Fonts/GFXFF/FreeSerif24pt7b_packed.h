@@ -0,0 +1,475 @@
+// FreeSerif24pt7b as run lengths, generated by Tools/GFX_pack from FreeSerif24pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeSerif24pt7bPackedRuns[] PROGMEM = {
+  0x13, 0x14, 0x1F, 0xF5, 0x13, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0xF3, 0x31, 0xF0, 0x13, 0x10,
+  0x12, 0x62, 0x14, 0x48, 0x48, 0x48, 0x48, 0x44, 0x12, 0x62, 0x22, 0x62,
+  0x22, 0x62, 0x22, 0x62, 0x22, 0x62, 0x22, 0x62, 0x10, 0x83, 0x63, 0xB3,
+  0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x62, 0xC2, 0x72, 0xC2, 0x63, 0xB3,
+  0x63, 0xB3, 0x63, 0xB3, 0x63, 0x5F, 0x71, 0xF7, 0x72, 0x72, 0xB3, 0x63,
+  0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB2, 0x72, 0x6F, 0x71,
+  0xF7, 0x63, 0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB2, 0x73, 0xB2, 0x72, 0xB3,
+  0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x63, 0xB3, 0x63, 0x70, 0x91, 0xF3,
+  0x1F, 0x31, 0xF0, 0x79, 0x42, 0x12, 0x54, 0x34, 0x14, 0x42, 0x35, 0x15,
+  0x31, 0x36, 0x16, 0x21, 0x36, 0x16, 0x21, 0x36, 0x17, 0x11, 0x36, 0x19,
+  0x45, 0x1A, 0x44, 0x1A, 0x62, 0x1B, 0x8C, 0x7E, 0x7D, 0x8D, 0x8C, 0x8B,
+  0x11, 0x7A, 0x13, 0x5A, 0x14, 0x59, 0x15, 0x49, 0x16, 0x48, 0x16, 0x48,
+  0x16, 0x57, 0x16, 0x57, 0x16, 0x66, 0x15, 0x31, 0x45, 0x14, 0x33, 0x53,
+  0x12, 0x45, 0xD9, 0x7F, 0x11, 0xF3, 0x1F, 0x31, 0x90, 0x75, 0xC2, 0xC8,
+  0x94, 0xB4, 0x34, 0x64, 0xB4, 0x77, 0x12, 0xB4, 0x81, 0x63, 0xB4, 0x81,
+  0x62, 0xB4, 0x91, 0x53, 0xB3, 0xA1, 0x52, 0xB4, 0xA1, 0x43, 0xB4, 0x91,
+  0x52, 0xC3, 0xA1, 0x43, 0xC3, 0x92, 0x42, 0xD3, 0x91, 0x42, 0xE3, 0x81,
+  0x43, 0x65, 0x42, 0x72, 0x42, 0x59, 0x23, 0x43, 0x43, 0x45, 0x32, 0x38,
+  0x52, 0x44, 0x62, 0x35, 0x63, 0x34, 0x81, 0xE2, 0x44, 0x81, 0xD3, 0x34,
+  0x91, 0xD2, 0x43, 0xA1, 0xC2, 0x44, 0xA1, 0xB3, 0x44, 0x92, 0xB2, 0x53,
+  0xA1, 0xB3, 0x53, 0x92, 0xB2, 0x63, 0x91, 0xB3, 0x63, 0x82, 0xB2, 0x73,
+  0x72, 0xB3, 0x83, 0x43, 0xC2, 0xA8, 0xC2, 0xC5, 0xD3, 0xF9, 0xB5, 0xFB,
+  0x8F, 0x83, 0x43, 0xF6, 0x36, 0x2F, 0x62, 0x82, 0xF4, 0x38, 0x2F, 0x43,
+  0x82, 0xF4, 0x38, 0x2F, 0x43, 0x73, 0xF4, 0x45, 0x3F, 0x54, 0x43, 0xF7,
+  0x42, 0x3F, 0x88, 0x4A, 0xA6, 0x86, 0xC5, 0xA4, 0xC7, 0x93, 0xB3, 0x15,
+  0x93, 0xA4, 0x25, 0x82, 0xA4, 0x35, 0x72, 0xA4, 0x55, 0x62, 0x95, 0x55,
+  0x52, 0xA4, 0x75, 0x42, 0xA4, 0x85, 0x22, 0xA5, 0x86, 0x11, 0xB5, 0x97,
+  0xB5, 0xA5, 0xC5, 0xA6, 0xB6, 0xA6, 0x97, 0x98, 0x81, 0x16, 0x73, 0x17,
+  0x42, 0x27, 0x44, 0x3C, 0x3C, 0x69, 0x77, 0xB6, 0x40, 0x12, 0x1F, 0x51,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0xB1, 0xA1, 0x92, 0x92, 0x92, 0x92,
+  0x93, 0x92, 0x93, 0x83, 0x93, 0x93, 0x84, 0x83, 0x93, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x93, 0x93, 0x94, 0x93, 0x93,
+  0x93, 0xA3, 0xA2, 0xA2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x02, 0xB2,
+  0xB2, 0xB2, 0xB2, 0xB2, 0xA3, 0xA2, 0xA3, 0xA3, 0x93, 0x93, 0x94, 0x93,
+  0x93, 0x94, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83,
+  0x93, 0x84, 0x83, 0x93, 0x93, 0x83, 0x92, 0x93, 0x83, 0x92, 0x92, 0x92,
+  0x91, 0xA1, 0xB0, 0x63, 0xD3, 0xD3, 0x81, 0x43, 0x42, 0x13, 0x41, 0x48,
+  0x31, 0x3A, 0x21, 0x25, 0x34, 0x11, 0x14, 0x85, 0xD1, 0xD5, 0x92, 0x21,
+  0x22, 0x45, 0x21, 0x34, 0x14, 0x31, 0x47, 0x41, 0x53, 0x63, 0xD3, 0xD3,
+  0xD3, 0x70, 0xA3, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53,
+  0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xAF, 0xFF, 0x1A, 0x3F, 0x53, 0xF5,
+  0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xA0,
+  0x13, 0x25, 0x1C, 0x15, 0x51, 0x51, 0x41, 0x51, 0x32, 0x32, 0x30, 0x0F,
+  0x70, 0x13, 0x1F, 0x01, 0x31, 0xB3, 0xA3, 0xB3, 0xB3, 0xA3, 0xB3, 0xB3,
+  0xA3, 0xB3, 0xB3, 0xA3, 0xB3, 0xB3, 0xA3, 0xB3, 0xA4, 0xA3, 0xB3, 0xA4,
+  0xA3, 0xB3, 0xA4, 0xA3, 0xB3, 0xA4, 0xA3, 0xB3, 0xA4, 0xA3, 0xB3, 0xA4,
+  0xA3, 0xB0, 0x86, 0xE3, 0x43, 0xB3, 0x63, 0x93, 0x83, 0x74, 0x84, 0x54,
+  0xA3, 0x54, 0xA4, 0x44, 0xA4, 0x35, 0xA5, 0x24, 0xC4, 0x24, 0xC4, 0x15,
+  0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xC5, 0x14,
+  0xC4, 0x24, 0xC4, 0x25, 0xA5, 0x34, 0xA4, 0x44, 0xA4, 0x53, 0xA3, 0x64,
+  0x84, 0x73, 0x83, 0x93, 0x63, 0xB3, 0x43, 0xE6, 0x80, 0x81, 0xA3, 0x85,
+  0x67, 0x42, 0x34, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x86, 0x4C, 0x76, 0xDA, 0x9E, 0x63, 0x67, 0x52,
+  0x95, 0x42, 0xB5, 0x31, 0xC5, 0x22, 0xD4, 0x21, 0xE4, 0xF2, 0x4F, 0x24,
+  0xF2, 0x3F, 0x33, 0xF2, 0x3F, 0x33, 0xF2, 0x3F, 0x33, 0xF2, 0x3F, 0x32,
+  0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2D, 0x14,
+  0x2E, 0x13, 0x2E, 0x13, 0xF3, 0x2F, 0x32, 0xF4, 0x20, 0x67, 0x9A, 0x72,
+  0x55, 0x51, 0x94, 0x31, 0xA4, 0x31, 0xB3, 0x21, 0xC3, 0xF0, 0x3F, 0x02,
+  0xF0, 0x2F, 0x11, 0xF0, 0x2F, 0x04, 0xC8, 0x8B, 0xB8, 0xD5, 0xE5, 0xE4,
+  0xE4, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x2F, 0x12, 0xF0, 0x2F,
+  0x12, 0x33, 0x92, 0x36, 0x53, 0x4C, 0x88, 0x80, 0xE2, 0xF3, 0x3F, 0x33,
+  0xF2, 0x4F, 0x15, 0xF1, 0x5F, 0x02, 0x13, 0xE2, 0x23, 0xE1, 0x33, 0xD2,
+  0x33, 0xC2, 0x43, 0xB2, 0x53, 0xB2, 0x53, 0xA2, 0x63, 0x92, 0x73, 0x92,
+  0x73, 0x82, 0x83, 0x72, 0x93, 0x71, 0xA3, 0x62, 0xA3, 0x52, 0xB3, 0x5F,
+  0xFC, 0xD3, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3,
+  0x35, 0xF2, 0x17, 0xC6, 0xC7, 0xC6, 0x2F, 0x22, 0xF1, 0x2F, 0x22, 0xF2,
+  0x3F, 0x08, 0xBA, 0x8D, 0x9B, 0xC8, 0xD7, 0xE5, 0xF0, 0x4F, 0x05, 0xF0,
+  0x4F, 0x04, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x12, 0xF1,
+  0x3F, 0x12, 0xF1, 0x33, 0x48, 0x34, 0x65, 0x35, 0xC9, 0x7A, 0xF1, 0x4E,
+  0x5D, 0x5E, 0x5F, 0x05, 0xF0, 0x5F, 0x05, 0xF0, 0x5F, 0x05, 0xF0, 0x6F,
+  0x05, 0xF0, 0x6F, 0x05, 0x36, 0x75, 0x1A, 0x47, 0x56, 0x36, 0x85, 0x25,
+  0x96, 0x15, 0xA5, 0x15, 0xAB, 0xBA, 0xBA, 0xBA, 0xBA, 0xB5, 0x14, 0xB5,
+  0x15, 0xA4, 0x25, 0xA4, 0x34, 0x95, 0x35, 0x84, 0x55, 0x64, 0x75, 0x44,
+  0x9B, 0xD6, 0x70, 0x2F, 0x32, 0xF3, 0x2F, 0x22, 0x3C, 0x32, 0x1E, 0x31,
+  0x2D, 0x32, 0x1E, 0x3F, 0x23, 0xF1, 0x3F, 0x23, 0xF2, 0x3F, 0x13, 0xF2,
+  0x3F, 0x23, 0xF1, 0x3F, 0x23, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x23, 0xF1,
+  0x3F, 0x23, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x23, 0xF1, 0x3F, 0x23, 0xF2,
+  0x3F, 0x14, 0xF1, 0x3A, 0x66, 0xAA, 0x64, 0x54, 0x52, 0x93, 0x33, 0x93,
+  0x32, 0xB3, 0x13, 0xB3, 0x13, 0xB3, 0x14, 0xA3, 0x14, 0xA3, 0x24, 0x83,
+  0x35, 0x63, 0x55, 0x43, 0x76, 0x13, 0x97, 0xC7, 0xC7, 0x9A, 0x73, 0x36,
+  0x53, 0x56, 0x33, 0x85, 0x22, 0xA4, 0x13, 0xB7, 0xB7, 0xC6, 0xC6, 0xC7,
+  0xB3, 0x13, 0xA3, 0x24, 0x93, 0x35, 0x54, 0x5B, 0x97, 0x60, 0x76, 0xDA,
+  0xA4, 0x45, 0x74, 0x65, 0x54, 0x84, 0x45, 0x94, 0x34, 0xA5, 0x24, 0xA5,
+  0x15, 0xB4, 0x15, 0xBA, 0xBA, 0xBA, 0xBA, 0xBB, 0xA5, 0x15, 0xA5, 0x15,
+  0xA5, 0x25, 0x86, 0x36, 0x47, 0x5A, 0x24, 0x76, 0x35, 0xF1, 0x4F, 0x15,
+  0xF1, 0x4F, 0x15, 0xF0, 0x5F, 0x14, 0xF1, 0x4F, 0x05, 0xF0, 0x5E, 0x5E,
+  0x4E, 0x4F, 0x10, 0x13, 0x1F, 0x01, 0x3F, 0xFF, 0xF2, 0x31, 0xF0, 0x13,
+  0x10, 0x23, 0x25, 0x15, 0x15, 0x23, 0xFF, 0xFF, 0x83, 0x25, 0x1C, 0x15,
+  0x51, 0x51, 0x41, 0x51, 0x32, 0x32, 0x30, 0xFF, 0xF0, 0x3F, 0x45, 0xF2,
+  0x7F, 0x07, 0xF0, 0x7E, 0x8E, 0x8E, 0x8E, 0x7F, 0x07, 0xF0, 0x7F, 0x25,
+  0xF4, 0x6F, 0x48, 0xF3, 0x8F, 0x38, 0xF4, 0x7F, 0x47, 0xF4, 0x8F, 0x38,
+  0xF3, 0x8F, 0x45, 0xF6, 0x3F, 0x81, 0x0F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x3F, 0xFF, 0x30, 0x01, 0xF8, 0x3F, 0x65, 0xF4, 0x8F, 0x38,
+  0xF3, 0x8F, 0x47, 0xF4, 0x7F, 0x48, 0xF3, 0x8F, 0x38, 0xF4, 0x6F, 0x45,
+  0xF2, 0x7F, 0x07, 0xF0, 0x7E, 0x8E, 0x8E, 0x8E, 0x7F, 0x07, 0xF0, 0x7F,
+  0x25, 0xF4, 0x3F, 0xFF, 0x00, 0x56, 0x9B, 0x52, 0x56, 0x31, 0x95, 0x12,
+  0x95, 0x13, 0x99, 0x89, 0x85, 0x13, 0x85, 0xC5, 0xC4, 0xD4, 0xC4, 0xD4,
+  0xD3, 0xD3, 0xE2, 0xF0, 0x1F, 0x02, 0xF0, 0x1F, 0x11, 0xF0, 0x2F, 0x01,
+  0xF1, 0x1F, 0xFF, 0xF6, 0x3D, 0x5C, 0x5C, 0x5D, 0x37, 0xD8, 0xF6, 0xEF,
+  0x16, 0x75, 0xD4, 0xD3, 0xA5, 0xF1, 0x28, 0x4F, 0x42, 0x64, 0xF6, 0x25,
+  0x4F, 0x71, 0x44, 0xA5, 0x82, 0x34, 0x97, 0x13, 0x41, 0x24, 0x94, 0x35,
+  0x42, 0x14, 0x83, 0x54, 0x65, 0x83, 0x73, 0x65, 0x83, 0x73, 0x65, 0x73,
+  0x74, 0x65, 0x73, 0x73, 0x75, 0x63, 0x83, 0x75, 0x63, 0x83, 0x66, 0x63,
+  0x74, 0x61, 0x14, 0x63, 0x73, 0x71, 0x14, 0x63, 0x64, 0x61, 0x34, 0x53,
+  0x64, 0x52, 0x34, 0x63, 0x32, 0x13, 0x42, 0x53, 0x67, 0x37, 0x64, 0x64,
+  0x65, 0x84, 0xFD, 0x4F, 0xE4, 0xFE, 0x5F, 0xD5, 0xE2, 0xD6, 0x85, 0xF0,
+  0xF0, 0xF5, 0x9A, 0xF0, 0x1F, 0xF1, 0x2F, 0xE3, 0xFE, 0x4F, 0xC5, 0xFC,
+  0x6F, 0xB6, 0xFA, 0x21, 0x5F, 0x92, 0x15, 0xF8, 0x23, 0x4F, 0x82, 0x35,
+  0xF6, 0x34, 0x4F, 0x62, 0x55, 0xF5, 0x25, 0x5F, 0x42, 0x75, 0xF3, 0x27,
+  0x5F, 0x23, 0x84, 0xF2, 0x29, 0x5F, 0x12, 0x95, 0xF0, 0x2B, 0x5E, 0xF3,
+  0xDF, 0x5C, 0x2D, 0x5B, 0x3D, 0x5B, 0x2F, 0x05, 0xA2, 0xF0, 0x59, 0x3F,
+  0x15, 0x82, 0xF2, 0x57, 0x3F, 0x26, 0x54, 0xF2, 0x64, 0x6F, 0x17, 0x29,
+  0xBC, 0x0F, 0x4B, 0xF4, 0xA5, 0x76, 0x95, 0x95, 0x85, 0xA5, 0x75, 0xA6,
+  0x65, 0xB5, 0x65, 0xB5, 0x65, 0xB5, 0x65, 0xB5, 0x65, 0xB5, 0x65, 0xA5,
+  0x75, 0x95, 0x85, 0x76, 0x9F, 0x1B, 0xF1, 0xB5, 0x77, 0x85, 0xA5, 0x75,
+  0xB5, 0x65, 0xB5, 0x65, 0xC5, 0x55, 0xC5, 0x55, 0xC5, 0x55, 0xC5, 0x55,
+  0xC5, 0x55, 0xB5, 0x65, 0xB5, 0x65, 0xA5, 0x75, 0x77, 0x7F, 0x44, 0xF5,
+  0x70, 0xB9, 0x61, 0xAE, 0x13, 0x86, 0x68, 0x75, 0xA6, 0x64, 0xE4, 0x54,
+  0xF0, 0x44, 0x5F, 0x13, 0x35, 0xF3, 0x23, 0x4F, 0x42, 0x25, 0xF5, 0x12,
+  0x5F, 0x51, 0x24, 0xF8, 0x5F, 0x85, 0xF8, 0x5F, 0x85, 0xF8, 0x5F, 0x85,
+  0xF8, 0x5F, 0x85, 0xF8, 0x5F, 0x85, 0xF9, 0x5F, 0x85, 0xF8, 0x5F, 0x95,
+  0xF8, 0x6F, 0x85, 0xF3, 0x15, 0x5F, 0x03, 0x66, 0xC3, 0x87, 0x74, 0xCE,
+  0xF2, 0x89, 0x0F, 0x3F, 0x0F, 0x5D, 0x57, 0x8B, 0x5A, 0x6A, 0x5C, 0x68,
+  0x5D, 0x67, 0x5E, 0x57, 0x5F, 0x05, 0x65, 0xF0, 0x56, 0x5F, 0x15, 0x55,
+  0xF1, 0x55, 0x5F, 0x16, 0x45, 0xF2, 0x54, 0x5F, 0x25, 0x45, 0xF2, 0x54,
+  0x5F, 0x25, 0x45, 0xF2, 0x54, 0x5F, 0x25, 0x45, 0xF2, 0x54, 0x5F, 0x25,
+  0x45, 0xF1, 0x55, 0x5F, 0x15, 0x55, 0xF1, 0x46, 0x5F, 0x05, 0x65, 0xE5,
+  0x75, 0xE5, 0x75, 0xC6, 0x85, 0xB5, 0xA5, 0x78, 0x9F, 0x59, 0xF3, 0xD0,
+  0x0F, 0x95, 0xF7, 0x65, 0xD3, 0x65, 0xE2, 0x65, 0xE2, 0x65, 0xF0, 0x16,
+  0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5C, 0x19, 0x5C, 0x19, 0x5B, 0x29,
+  0x5A, 0x39, 0xF3, 0x9F, 0x39, 0x5A, 0x39, 0x5B, 0x29, 0x5C, 0x19, 0x5C,
+  0x19, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF2, 0x23, 0x5F, 0x21, 0x45, 0xF1,
+  0x24, 0x5F, 0x03, 0x45, 0xE3, 0x55, 0xC5, 0x4F, 0x82, 0xFA, 0x20, 0x0F,
+  0x92, 0xF7, 0x35, 0xD3, 0x35, 0xE2, 0x35, 0xE2, 0x35, 0xF0, 0x13, 0x5F,
+  0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x5C, 0x16, 0x5C, 0x16, 0x5B, 0x26, 0x5A,
+  0x36, 0xF3, 0x6F, 0x36, 0x5A, 0x36, 0x5B, 0x26, 0x5C, 0x16, 0x5C, 0x16,
+  0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4,
+  0x5F, 0x37, 0xF0, 0xCC, 0xC8, 0x81, 0xBF, 0x02, 0x39, 0x68, 0x88, 0x5C,
+  0x67, 0x4F, 0x14, 0x64, 0xF3, 0x35, 0x5F, 0x33, 0x45, 0xF5, 0x24, 0x5F,
+  0x61, 0x35, 0xFB, 0x5F, 0xB5, 0xFA, 0x5F, 0xB5, 0xFB, 0x5F, 0xB5, 0xF1,
+  0xF0, 0xF3, 0x71, 0x5F, 0x45, 0x25, 0xF4, 0x52, 0x5F, 0x45, 0x25, 0xF4,
+  0x53, 0x5F, 0x35, 0x35, 0xF3, 0x53, 0x5F, 0x35, 0x45, 0xF2, 0x54, 0x5F,
+  0x25, 0x55, 0xF1, 0x55, 0x6F, 0x05, 0x66, 0xE5, 0x85, 0xC6, 0x97, 0x77,
+  0xCF, 0x1F, 0x39, 0xA0, 0x0B, 0x8B, 0x27, 0xC7, 0x55, 0xE5, 0x65, 0xE5,
+  0x65, 0xE5, 0x65, 0xE5, 0x65, 0xE5, 0x65, 0xE5, 0x65, 0xE5, 0x65, 0xE5,
+  0x65, 0xE5, 0x65, 0xE5, 0x65, 0xE5, 0x65, 0xE5, 0x6F, 0x96, 0xF9, 0x65,
+  0xE5, 0x65, 0xE5, 0x65, 0xE5, 0x65, 0xE5, 0x65, 0xE5, 0x65, 0xE5, 0x65,
+  0xE5, 0x65, 0xE5, 0x65, 0xE5, 0x65, 0xE5, 0x65, 0xE5, 0x65, 0xE5, 0x65,
+  0xE5, 0x57, 0xC7, 0x2B, 0x8B, 0x0D, 0x37, 0x75, 0x85, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x77, 0x3D,
+  0x4D, 0x77, 0xB5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+  0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+  0xC5, 0xC5, 0xC4, 0x63, 0x44, 0x55, 0x34, 0x55, 0x24, 0x79, 0x96, 0x90,
+  0x0D, 0x5C, 0x48, 0xB6, 0x95, 0xC4, 0xB5, 0xC3, 0xC5, 0xB3, 0xD5, 0xA3,
+  0xE5, 0x93, 0xF0, 0x58, 0x3F, 0x15, 0x73, 0xF2, 0x56, 0x3F, 0x35, 0x53,
+  0xF4, 0x54, 0x3F, 0x55, 0x24, 0xF6, 0x51, 0x4F, 0x7B, 0xF6, 0xCF, 0x56,
+  0x16, 0xF4, 0x53, 0x6F, 0x35, 0x46, 0xF2, 0x55, 0x6F, 0x15, 0x66, 0xF0,
+  0x57, 0x6E, 0x58, 0x6D, 0x59, 0x6C, 0x59, 0x7B, 0x5A, 0x6B, 0x5B, 0x6A,
+  0x5C, 0x69, 0x5C, 0x77, 0x7B, 0x92, 0xD5, 0xE0, 0x0C, 0xF1, 0x8F, 0x45,
+  0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x65,
+  0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x65,
+  0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x21, 0x35, 0xF1, 0x23,
+  0x5F, 0x11, 0x45, 0xF0, 0x24, 0x5E, 0x34, 0x5B, 0x63, 0xF7, 0x2F, 0x92,
+  0x09, 0xF6, 0x92, 0x8F, 0x57, 0x66, 0xF4, 0x77, 0x6F, 0x47, 0x77, 0xF2,
+  0x87, 0x7F, 0x22, 0x15, 0x72, 0x15, 0xF1, 0x21, 0x57, 0x21, 0x5F, 0x03,
+  0x15, 0x72, 0x16, 0xE2, 0x25, 0x72, 0x25, 0xD3, 0x25, 0x72, 0x26, 0xC2,
+  0x35, 0x72, 0x35, 0xB3, 0x35, 0x72, 0x36, 0xA2, 0x45, 0x72, 0x45, 0x93,
+  0x45, 0x72, 0x46, 0x82, 0x55, 0x72, 0x55, 0x82, 0x55, 0x72, 0x56, 0x62,
+  0x65, 0x72, 0x65, 0x62, 0x65, 0x72, 0x66, 0x42, 0x75, 0x72, 0x75, 0x42,
+  0x75, 0x72, 0x75, 0x33, 0x75, 0x72, 0x85, 0x22, 0x85, 0x72, 0x85, 0x13,
+  0x85, 0x72, 0x97, 0x95, 0x72, 0x97, 0x95, 0x72, 0x96, 0xA5, 0x72, 0xA5,
+  0xA5, 0x72, 0xA4, 0xB5, 0x64, 0xA3, 0xB5, 0x56, 0x92, 0xA8, 0x2A, 0x81,
+  0x8C, 0x08, 0xEA, 0x27, 0xF0, 0x65, 0x7F, 0x04, 0x76, 0xF1, 0x28, 0x7F,
+  0x02, 0x88, 0xE2, 0x82, 0x16, 0xD2, 0x82, 0x17, 0xC2, 0x82, 0x26, 0xC2,
+  0x82, 0x36, 0xB2, 0x82, 0x46, 0xA2, 0x82, 0x56, 0x92, 0x82, 0x57, 0x82,
+  0x82, 0x67, 0x72, 0x82, 0x76, 0x72, 0x82, 0x86, 0x62, 0x82, 0x96, 0x52,
+  0x82, 0x97, 0x42, 0x82, 0xA7, 0x32, 0x82, 0xB6, 0x32, 0x82, 0xC6, 0x22,
+  0x82, 0xD6, 0x12, 0x82, 0xE8, 0x82, 0xE8, 0x82, 0xF0, 0x78, 0x2F, 0x16,
+  0x82, 0xF2, 0x58, 0x2F, 0x34, 0x74, 0xF2, 0x46, 0x6F, 0x23, 0x4A, 0xF1,
+  0x2F, 0xF1, 0x14, 0xB8, 0xF4, 0xEF, 0x05, 0x65, 0xC5, 0xA5, 0x95, 0xC5,
+  0x75, 0xE4, 0x74, 0xF1, 0x45, 0x5F, 0x15, 0x44, 0xF3, 0x43, 0x5F, 0x35,
+  0x25, 0xF3, 0x52, 0x4F, 0x54, 0x15, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A,
+  0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0x51, 0x5F, 0x35, 0x25, 0xF3,
+  0x52, 0x5F, 0x35, 0x34, 0xF3, 0x44, 0x5F, 0x15, 0x54, 0xF1, 0x46, 0x5E,
+  0x57, 0x5C, 0x59, 0x5A, 0x5C, 0x56, 0x5F, 0x0E, 0xF4, 0x8B, 0x0F, 0x19,
+  0xF1, 0x85, 0x57, 0x65, 0x85, 0x55, 0x95, 0x45, 0x95, 0x45, 0xA5, 0x35,
+  0xA5, 0x35, 0xA5, 0x35, 0xA5, 0x35, 0xA5, 0x35, 0xA5, 0x35, 0x95, 0x45,
+  0x95, 0x45, 0x85, 0x55, 0x66, 0x6F, 0x08, 0xDA, 0x5F, 0x35, 0xF3, 0x5F,
+  0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F,
+  0x27, 0xEC, 0xB0, 0xB8, 0xF5, 0xEF, 0x15, 0x65, 0xD5, 0xA5, 0xA5, 0xC5,
+  0x85, 0xE5, 0x74, 0xF1, 0x46, 0x5F, 0x15, 0x54, 0xF3, 0x44, 0x5F, 0x35,
+  0x35, 0xF3, 0x53, 0x4F, 0x54, 0x25, 0xF5, 0x51, 0x5F, 0x55, 0x15, 0xF5,
+  0x51, 0x5F, 0x55, 0x15, 0xF5, 0x51, 0x5F, 0x55, 0x15, 0xF5, 0x51, 0x5F,
+  0x55, 0x15, 0xF5, 0x52, 0x4F, 0x45, 0x35, 0xF3, 0x53, 0x5F, 0x35, 0x44,
+  0xF2, 0x55, 0x5F, 0x15, 0x64, 0xF0, 0x58, 0x4E, 0x4A, 0x4C, 0x4C, 0x58,
+  0x5F, 0x06, 0x26, 0xF4, 0xAF, 0x77, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xB7,
+  0xFA, 0x7F, 0xC7, 0xFC, 0x80, 0x0F, 0x1E, 0xF2, 0xC5, 0x67, 0xA5, 0x85,
+  0xA5, 0x95, 0x95, 0xA5, 0x85, 0xA5, 0x85, 0xA5, 0x85, 0xA5, 0x85, 0xA5,
+  0x85, 0xA5, 0x85, 0x95, 0x95, 0x95, 0x95, 0x85, 0xA5, 0x57, 0xBF, 0x0D,
+  0xCF, 0x15, 0x35, 0xF0, 0x53, 0x6E, 0x54, 0x5E, 0x55, 0x5D, 0x56, 0x5C,
+  0x56, 0x6B, 0x57, 0x6A, 0x58, 0x69, 0x59, 0x59, 0x59, 0x68, 0x5A, 0x67,
+  0x5B, 0x65, 0x7B, 0x62, 0xC8, 0x80, 0x66, 0x61, 0x6B, 0x22, 0x55, 0x56,
+  0x44, 0x94, 0x43, 0xB3, 0x34, 0xC2, 0x34, 0xC3, 0x24, 0xD2, 0x25, 0xC2,
+  0x25, 0xC2, 0x26, 0xF1, 0x6F, 0x08, 0xE8, 0xE9, 0xDA, 0xD9, 0xDA, 0xD9,
+  0xE7, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xE7, 0xE8, 0xD8, 0xD4, 0x14,
+  0xB5, 0x24, 0x95, 0x36, 0x65, 0x42, 0x2C, 0x51, 0x67, 0x60, 0x0F, 0xFF,
+  0xD7, 0x57, 0x78, 0x59, 0x49, 0x59, 0x3A, 0x5A, 0x2A, 0x5A, 0x1B, 0x5F,
+  0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F,
+  0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F,
+  0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF6, 0x7F, 0x2D, 0x70, 0x0D,
+  0x9A, 0x29, 0xD6, 0x65, 0xF1, 0x47, 0x5F, 0x22, 0x85, 0xF2, 0x28, 0x5F,
+  0x22, 0x85, 0xF2, 0x28, 0x5F, 0x22, 0x85, 0xF2, 0x28, 0x5F, 0x22, 0x85,
+  0xF2, 0x28, 0x5F, 0x22, 0x85, 0xF2, 0x28, 0x5F, 0x22, 0x85, 0xF2, 0x28,
+  0x5F, 0x22, 0x85, 0xF2, 0x28, 0x5F, 0x22, 0x85, 0xF2, 0x28, 0x5F, 0x22,
+  0x85, 0xF2, 0x28, 0x5F, 0x22, 0x85, 0xF2, 0x28, 0x5F, 0x22, 0x85, 0xF2,
+  0x1A, 0x5F, 0x02, 0xA5, 0xF0, 0x2B, 0x5D, 0x2C, 0x6B, 0x3D, 0x77, 0x4F,
+  0x1E, 0xF6, 0x9B, 0x0D, 0xA9, 0x28, 0xF0, 0x65, 0x5F, 0x24, 0x66, 0xF1,
+  0x38, 0x5F, 0x13, 0x85, 0xF1, 0x2A, 0x5E, 0x3A, 0x5E, 0x2C, 0x5D, 0x2C,
+  0x5C, 0x3C, 0x6B, 0x2E, 0x5A, 0x3E, 0x5A, 0x2F, 0x15, 0x92, 0xF1, 0x58,
+  0x3F, 0x25, 0x72, 0xF3, 0x56, 0x3F, 0x45, 0x52, 0xF5, 0x55, 0x2F, 0x56,
+  0x33, 0xF6, 0x53, 0x2F, 0x75, 0x23, 0xF8, 0x51, 0x2F, 0x95, 0x12, 0xFA,
+  0x7F, 0xA6, 0xFC, 0x5F, 0xC5, 0xFC, 0x4F, 0xE3, 0xFE, 0x2F, 0xF1, 0x1E,
+  0x0C, 0x3D, 0x79, 0x27, 0x88, 0xC5, 0x56, 0x96, 0xE3, 0x75, 0xA5, 0xE2,
+  0x85, 0xA5, 0xE2, 0x95, 0xA5, 0xD2, 0x95, 0xA5, 0xC2, 0xB5, 0xA5, 0xB2,
+  0xB5, 0xA5, 0xB2, 0xB5, 0xA5, 0xA2, 0xD5, 0x96, 0x92, 0xD5, 0x87, 0x83,
+  0xD5, 0x82, 0x14, 0x82, 0xF0, 0x57, 0x21, 0x57, 0x2F, 0x05, 0x62, 0x25,
+  0x62, 0xF2, 0x55, 0x23, 0x55, 0x2F, 0x25, 0x43, 0x35, 0x52, 0xF2, 0x54,
+  0x24, 0x54, 0x2F, 0x45, 0x32, 0x55, 0x32, 0xF4, 0x52, 0x35, 0x52, 0x3F,
+  0x45, 0x22, 0x75, 0x12, 0xF6, 0x51, 0x27, 0x51, 0x2F, 0x68, 0x78, 0xF6,
+  0x79, 0x6F, 0x86, 0x96, 0xF8, 0x5A, 0x6F, 0x85, 0xB4, 0xFA, 0x4B, 0x4F,
+  0xA3, 0xD3, 0xFA, 0x3D, 0x2F, 0xC2, 0xD2, 0xFC, 0x1F, 0x01, 0xD0, 0x1E,
+  0x7B, 0x39, 0xC6, 0x87, 0xD3, 0xB6, 0xC3, 0xD5, 0xC2, 0xF0, 0x5A, 0x3F,
+  0x06, 0x83, 0xF2, 0x57, 0x3F, 0x45, 0x62, 0xF5, 0x64, 0x2F, 0x75, 0x33,
+  0xF8, 0x51, 0x3F, 0x98, 0xFB, 0x6F, 0xD5, 0xFD, 0x6F, 0xC7, 0xFA, 0x8F,
+  0x93, 0x25, 0xF8, 0x23, 0x6F, 0x62, 0x56, 0xF4, 0x36, 0x5F, 0x33, 0x76,
+  0xF1, 0x39, 0x6E, 0x3B, 0x5E, 0x2C, 0x6C, 0x3D, 0x6A, 0x3E, 0x78, 0x4F,
+  0x06, 0x76, 0xD9, 0x2B, 0x8E, 0x0D, 0x9A, 0x29, 0xE5, 0x57, 0xF0, 0x47,
+  0x6F, 0x03, 0x96, 0xE2, 0xB6, 0xC3, 0xC5, 0xB3, 0xD6, 0xA2, 0xF0, 0x68,
+  0x3F, 0x15, 0x73, 0xF2, 0x66, 0x2F, 0x46, 0x43, 0xF5, 0x53, 0x3F, 0x66,
+  0x22, 0xF8, 0x9F, 0x97, 0xFA, 0x6F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F,
+  0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F,
+  0xB7, 0xF7, 0xD9, 0x2F, 0x93, 0xF9, 0x34, 0xE5, 0x33, 0xF0, 0x54, 0x2F,
+  0x06, 0x42, 0xF0, 0x55, 0x1F, 0x05, 0x61, 0xE5, 0xF6, 0x6F, 0x65, 0xF6,
+  0x5F, 0x66, 0xF5, 0x6F, 0x65, 0xF6, 0x5F, 0x66, 0xF5, 0x6F, 0x65, 0xF6,
+  0x6F, 0x56, 0xF6, 0x5F, 0x65, 0xF6, 0x6F, 0x56, 0xF1, 0x14, 0x5F, 0x12,
+  0x36, 0xF1, 0x22, 0x6F, 0x13, 0x16, 0xF1, 0x32, 0x5F, 0x05, 0x1F, 0xB1,
+  0xFB, 0x10, 0x0C, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x64, 0x59, 0x03, 0xC3, 0xB3, 0xB3, 0xC3, 0xB3, 0xB3, 0xC3, 0xB3,
+  0xB3, 0xC3, 0xB3, 0xB3, 0xC3, 0xB3, 0xB3, 0xC3, 0xB3, 0xB3, 0xC3, 0xB3,
+  0xB3, 0xC3, 0xB3, 0xB3, 0xC3, 0xB3, 0xB4, 0xB3, 0xB3, 0xB4, 0xB3, 0x09,
+  0x54, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6C,
+  0x84, 0xF1, 0x4F, 0x06, 0xE6, 0xD4, 0x13, 0xC3, 0x23, 0xB4, 0x24, 0xA3,
+  0x43, 0x94, 0x44, 0x83, 0x63, 0x74, 0x64, 0x63, 0x83, 0x54, 0x84, 0x43,
+  0xA3, 0x34, 0xA4, 0x23, 0xC3, 0x14, 0xC4, 0x0F, 0xFF, 0x30, 0x03, 0x74,
+  0x65, 0x65, 0x74, 0x74, 0x83, 0x83, 0x66, 0x93, 0x43, 0x73, 0x63, 0x54,
+  0x72, 0x54, 0x73, 0x44, 0x73, 0x52, 0x83, 0xF0, 0x3D, 0x5A, 0x32, 0x38,
+  0x34, 0x36, 0x36, 0x35, 0x37, 0x34, 0x38, 0x33, 0x48, 0x33, 0x48, 0x33,
+  0x48, 0x33, 0x56, 0x43, 0x64, 0x54, 0x92, 0x63, 0x55, 0x41, 0x52, 0xF1,
+  0x5E, 0x7F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24,
+  0xF2, 0x4F, 0x24, 0x36, 0x84, 0x1A, 0x66, 0x46, 0x55, 0x74, 0x54, 0x85,
+  0x44, 0x94, 0x44, 0x95, 0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA4,
+  0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA3, 0x44, 0xA3, 0x44, 0x93, 0x54, 0x93,
+  0x54, 0x83, 0x66, 0x53, 0x9B, 0xC7, 0x70, 0x77, 0xAB, 0x73, 0x55, 0x53,
+  0x75, 0x33, 0x85, 0x23, 0xA3, 0x32, 0xF2, 0x2F, 0x13, 0xF1, 0x3F, 0x13,
+  0xF1, 0x3F, 0x13, 0xF1, 0x4F, 0x04, 0xD2, 0x14, 0xC1, 0x25, 0x92, 0x46,
+  0x62, 0x6C, 0x8A, 0xB6, 0x70, 0xF2, 0x2F, 0x25, 0xF0, 0x7F, 0x34, 0xF3,
+  0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4A, 0x53, 0x48,
+  0x91, 0x47, 0x44, 0x76, 0x38, 0x55, 0x39, 0x55, 0x3A, 0x44, 0x4A, 0x44,
+  0x3B, 0x43, 0x4B, 0x43, 0x4B, 0x43, 0x4B, 0x43, 0x4B, 0x43, 0x4B, 0x43,
+  0x4B, 0x43, 0x5A, 0x44, 0x4A, 0x44, 0x59, 0x45, 0x57, 0x55, 0x65, 0x94,
+  0xA1, 0x58, 0x63, 0x25, 0x67, 0x9A, 0x73, 0x54, 0x52, 0x84, 0x33, 0x85,
+  0x22, 0xA4, 0x2F, 0x11, 0xF2, 0x13, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x04,
+  0xE4, 0xD5, 0xD1, 0x14, 0xB1, 0x25, 0x92, 0x36, 0x53, 0x4D, 0x6B, 0x97,
+  0x60, 0x96, 0x9A, 0x63, 0x35, 0x62, 0x63, 0x53, 0xE3, 0xE3, 0xD4, 0xD4,
+  0xD4, 0xD4, 0xD4, 0xAC, 0x5C, 0x84, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+  0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xC6, 0x8C,
+  0x50, 0x76, 0xDA, 0xA4, 0x3A, 0x34, 0x59, 0x33, 0x73, 0x74, 0x74, 0x64,
+  0x83, 0x64, 0x83, 0x64, 0x83, 0x64, 0x83, 0x74, 0x72, 0x85, 0x53, 0xA4,
+  0x33, 0xC7, 0xD2, 0xF3, 0x2F, 0x32, 0xF3, 0x4F, 0x2E, 0x8F, 0x07, 0xF0,
+  0x52, 0xC3, 0x32, 0xF0, 0x12, 0x2F, 0x11, 0x22, 0xF1, 0x11, 0x3F, 0x01,
+  0x23, 0xF0, 0x12, 0x4D, 0x14, 0x58, 0x36, 0xDA, 0x89, 0x52, 0xF2, 0x5F,
+  0x07, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F,
+  0x34, 0xF3, 0x44, 0x68, 0x42, 0x97, 0x41, 0x24, 0x56, 0x66, 0x46, 0x49,
+  0x45, 0x49, 0x45, 0x49, 0x45, 0x49, 0x45, 0x49, 0x45, 0x49, 0x45, 0x49,
+  0x45, 0x49, 0x45, 0x49, 0x45, 0x49, 0x45, 0x49, 0x45, 0x49, 0x45, 0x49,
+  0x45, 0x49, 0x45, 0x49, 0x44, 0x67, 0x62, 0x93, 0x90, 0x43, 0x75, 0x65,
+  0x65, 0x73, 0xFF, 0xFF, 0xF2, 0x18, 0x35, 0x64, 0x77, 0x47, 0x47, 0x47,
+  0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x46,
+  0x62, 0xB0, 0x83, 0x85, 0x75, 0x75, 0x83, 0xFF, 0xFF, 0xF9, 0x19, 0x36,
+  0x65, 0x78, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x39,
+  0x31, 0x35, 0x31, 0x43, 0x32, 0x94, 0x65, 0x52, 0xF3, 0x5F, 0x17, 0xF4,
+  0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4,
+  0x45, 0xA4, 0x47, 0x57, 0x47, 0x39, 0x46, 0x2B, 0x45, 0x2C, 0x44, 0x2D,
+  0x43, 0x2E, 0x42, 0x2F, 0x08, 0xF0, 0x9E, 0x41, 0x4E, 0x42, 0x4D, 0x42,
+  0x5C, 0x43, 0x5B, 0x44, 0x5A, 0x45, 0x4A, 0x46, 0x49, 0x46, 0x58, 0x47,
+  0x56, 0x66, 0x72, 0xA3, 0xA0, 0x62, 0x65, 0x47, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x66,
+  0x2B, 0x34, 0x45, 0x76, 0x67, 0x28, 0x49, 0x78, 0x44, 0x13, 0x45, 0x75,
+  0x66, 0x74, 0x74, 0x84, 0x94, 0x64, 0x84, 0x94, 0x64, 0x84, 0x94, 0x64,
+  0x84, 0x94, 0x64, 0x84, 0x94, 0x64, 0x84, 0x94, 0x64, 0x84, 0x94, 0x64,
+  0x84, 0x94, 0x64, 0x84, 0x94, 0x64, 0x84, 0x94, 0x64, 0x84, 0x94, 0x64,
+  0x84, 0x94, 0x64, 0x84, 0x94, 0x64, 0x84, 0x94, 0x64, 0x84, 0x94, 0x56,
+  0x66, 0x76, 0x2A, 0x2A, 0x3A, 0x34, 0x46, 0x57, 0x29, 0x68, 0x45, 0x65,
+  0x75, 0x54, 0x94, 0x54, 0x94, 0x54, 0x94, 0x54, 0x94, 0x54, 0x94, 0x54,
+  0x94, 0x54, 0x94, 0x54, 0x94, 0x54, 0x94, 0x54, 0x94, 0x54, 0x94, 0x54,
+  0x94, 0x54, 0x94, 0x54, 0x94, 0x54, 0x94, 0x46, 0x76, 0x29, 0x48, 0x78,
+  0xCC, 0x94, 0x55, 0x65, 0x75, 0x54, 0x95, 0x34, 0xB5, 0x24, 0xB5, 0x15,
+  0xBB, 0xCA, 0xCA, 0xCA, 0xCA, 0xCB, 0xB4, 0x25, 0xB4, 0x26, 0x95, 0x35,
+  0x94, 0x55, 0x74, 0x75, 0x54, 0x9C, 0xD6, 0x80, 0x43, 0x36, 0x57, 0x1A,
+  0x66, 0x55, 0x55, 0x75, 0x44, 0x94, 0x44, 0x95, 0x34, 0x95, 0x34, 0xA4,
+  0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA4, 0x34, 0xA3,
+  0x44, 0x94, 0x44, 0x94, 0x44, 0x93, 0x55, 0x73, 0x66, 0x53, 0x74, 0x18,
+  0x84, 0x25, 0xA4, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24,
+  0xF2, 0x4F, 0x16, 0xDB, 0xA0, 0x76, 0x51, 0x7A, 0x22, 0x64, 0x56, 0x54,
+  0x75, 0x44, 0x94, 0x43, 0xA4, 0x34, 0xA4, 0x33, 0xB4, 0x24, 0xB4, 0x24,
+  0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x24, 0xB4, 0x25, 0xA4, 0x25,
+  0xA4, 0x35, 0x94, 0x35, 0x85, 0x46, 0x56, 0x5A, 0x24, 0x76, 0x44, 0xF2,
+  0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF0,
+  0x7C, 0xA0, 0x52, 0x34, 0x26, 0x27, 0x15, 0x11, 0x24, 0x35, 0x43, 0x34,
+  0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+  0xB4, 0xB4, 0xA6, 0x7A, 0x50, 0x36, 0x21, 0x32, 0x44, 0x22, 0x63, 0x13,
+  0x72, 0x13, 0x72, 0x13, 0x81, 0x14, 0x71, 0x16, 0x86, 0x87, 0x77, 0x87,
+  0x76, 0x96, 0x85, 0x95, 0x85, 0x86, 0x72, 0x14, 0x52, 0x21, 0x35, 0x40,
+  0x51, 0xA2, 0xA2, 0x93, 0x84, 0x79, 0x2A, 0x44, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85,
+  0x31, 0x47, 0x65, 0x30, 0x06, 0x67, 0x45, 0x85, 0x54, 0x94, 0x54, 0x94,
+  0x54, 0x94, 0x54, 0x94, 0x54, 0x94, 0x54, 0x94, 0x54, 0x94, 0x54, 0x94,
+  0x54, 0x94, 0x54, 0x94, 0x54, 0x94, 0x54, 0x94, 0x54, 0x94, 0x54, 0x94,
+  0x54, 0x94, 0x55, 0x75, 0x65, 0x48, 0x69, 0x27, 0x56, 0x43, 0x40, 0x09,
+  0x67, 0x26, 0x93, 0x54, 0xA3, 0x54, 0xA2, 0x74, 0x92, 0x74, 0x91, 0x94,
+  0x72, 0x94, 0x72, 0x94, 0x62, 0xB4, 0x52, 0xB4, 0x51, 0xD4, 0x32, 0xD4,
+  0x32, 0xE3, 0x22, 0xF0, 0x41, 0x2F, 0x04, 0x11, 0xF2, 0x5F, 0x25, 0xF3,
+  0x3F, 0x43, 0xF4, 0x2F, 0x61, 0xA0, 0x09, 0x39, 0x56, 0x16, 0x66, 0x93,
+  0x35, 0x74, 0xA2, 0x54, 0x75, 0x92, 0x54, 0x84, 0x92, 0x54, 0x84, 0x82,
+  0x74, 0x84, 0x72, 0x74, 0x75, 0x71, 0x94, 0x65, 0x62, 0x94, 0x61, 0x14,
+  0x52, 0x94, 0x52, 0x14, 0x42, 0xB4, 0x42, 0x23, 0x42, 0xB4, 0x32, 0x34,
+  0x31, 0xD3, 0x32, 0x34, 0x22, 0xD4, 0x12, 0x54, 0x12, 0xD4, 0x12, 0x56,
+  0xF0, 0x57, 0x5F, 0x05, 0x74, 0xF2, 0x38, 0x4F, 0x23, 0x93, 0xF2, 0x2A,
+  0x2F, 0x41, 0xB1, 0x90, 0x1A, 0x27, 0x56, 0x54, 0x85, 0x53, 0xA4, 0x52,
+  0xB5, 0x32, 0xD4, 0x22, 0xF0, 0x41, 0x2F, 0x06, 0xF2, 0x4F, 0x44, 0xF3,
+  0x5F, 0x16, 0xF1, 0x21, 0x4E, 0x22, 0x5C, 0x24, 0x4B, 0x35, 0x4A, 0x26,
+  0x58, 0x28, 0x47, 0x39, 0x45, 0x48, 0x62, 0x76, 0x90, 0x0A, 0x66, 0x26,
+  0x94, 0x44, 0xB2, 0x54, 0xA2, 0x74, 0x92, 0x74, 0x92, 0x84, 0x72, 0x94,
+  0x72, 0xA4, 0x62, 0xA4, 0x52, 0xB5, 0x42, 0xC4, 0x41, 0xD5, 0x22, 0xE4,
+  0x22, 0xE7, 0xF1, 0x6F, 0x15, 0xF3, 0x4F, 0x34, 0xF4, 0x2F, 0x52, 0xF5,
+  0x1F, 0x52, 0xF5, 0x2F, 0x42, 0xF5, 0x2F, 0x42, 0xE8, 0xD8, 0xE7, 0xF1,
+  0x5F, 0x00, 0x1F, 0x12, 0xF1, 0x22, 0x94, 0x31, 0x94, 0x41, 0x85, 0xD4,
+  0xD4, 0xD5, 0xD4, 0xD4, 0xD5, 0xD4, 0xD4, 0xD5, 0xC5, 0x91, 0x34, 0xA1,
+  0x25, 0x92, 0x15, 0xA2, 0x14, 0xAF, 0x51, 0xF2, 0x10, 0x74, 0x64, 0x63,
+  0x74, 0x73, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x73, 0x73, 0x63, 0xA3, 0x93, 0x93, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x93,
+  0x94, 0x93, 0x0F, 0xFF, 0xFF, 0xF6, 0x03, 0x94, 0x93, 0x84, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x93, 0x93, 0xA3, 0x63, 0x73, 0x73, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x74, 0x73, 0x64, 0x64, 0x70,
+  0x36, 0xF0, 0x97, 0x23, 0x34, 0x54, 0x41, 0x37, 0xAF, 0x05, 0x40 };
+
+const GFXglyph FreeSerif24pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,  12,    0,    1 },   // 0x20 ' '
+  {     0,   5,  32,  16,    6,  -31 },   // 0x21 '!'
+  {    24,  12,  12,  19,    4,  -31 },   // 0x22 '"'
+  {    45,  23,  31,  23,    0,  -30 },   // 0x23 '#'
+  {   106,  19,  37,  24,    2,  -33 },   // 0x24 '$'
+  {   177,  33,  32,  39,    3,  -30 },   // 0x25 '%'
+  {   274,  32,  33,  37,    2,  -31 },   // 0x26 '&'
+  {   357,   4,  12,   9,    3,  -31 },   // 0x27 '''
+  {   366,  12,  40,  16,    2,  -31 },   // 0x28 '('
+  {   406,  12,  40,  16,    2,  -30 },   // 0x29 ')'
+  {   447,  16,  19,  24,    4,  -30 },   // 0x2A '*'
+  {   482,  23,  23,  27,    2,  -22 },   // 0x2B '+'
+  {   516,   6,  11,  12,    2,   -4 },   // 0x2C ','
+  {   527,  11,   2,  16,    2,  -10 },   // 0x2D '-'
+  {   529,   5,   5,  12,    3,   -3 },   // 0x2E '.'
+  {   533,  14,  32,  14,    0,  -30 },   // 0x2F '/'
+  {   566,  22,  33,  23,    1,  -31 },   // 0x30 '0'
+  {   621,  13,  32,  24,    5,  -31 },   // 0x31 '1'
+  {   654,  21,  31,  23,    1,  -30 },   // 0x32 '2'
+  {   705,  18,  32,  23,    2,  -30 },   // 0x33 '3'
+  {   752,  21,  31,  24,    1,  -30 },   // 0x34 '4'
+  {   805,  19,  33,  24,    2,  -31 },   // 0x35 '5'
+  {   850,  21,  33,  23,    2,  -31 },   // 0x36 '6'
+  {   903,  20,  31,  24,    1,  -30 },   // 0x37 '7'
+  {   952,  18,  33,  23,    3,  -31 },   // 0x38 '8'
+  {  1006,  21,  33,  24,    1,  -31 },   // 0x39 '9'
+  {  1059,   5,  22,  12,    4,  -20 },   // 0x3A ':'
+  {  1069,   6,  27,  12,    3,  -20 },   // 0x3B ';'
+  {  1087,  24,  25,  27,    1,  -24 },   // 0x3C '<'
+  {  1122,  24,  11,  27,    1,  -16 },   // 0x3D '='
+  {  1133,  24,  25,  27,    2,  -23 },   // 0x3E '>'
+  {  1169,  17,  32,  21,    3,  -31 },   // 0x3F '?'
+  {  1209,  32,  33,  41,    4,  -31 },   // 0x40 '@'
+  {  1299,  32,  32,  34,    1,  -31 },   // 0x41 'A'
+  {  1369,  27,  31,  30,    0,  -30 },   // 0x42 'B'
+  {  1429,  28,  33,  31,    2,  -31 },   // 0x43 'C'
+  {  1490,  31,  31,  34,    1,  -30 },   // 0x44 'D'
+  {  1560,  27,  31,  29,    2,  -30 },   // 0x45 'E'
+  {  1619,  24,  31,  27,    2,  -30 },   // 0x46 'F'
+  {  1672,  31,  33,  35,    2,  -31 },   // 0x47 'G'
+  {  1744,  30,  31,  34,    2,  -30 },   // 0x48 'H'
+  {  1805,  13,  31,  15,    1,  -30 },   // 0x49 'I'
+  {  1836,  17,  32,  18,    0,  -30 },   // 0x4A 'J'
+  {  1872,  32,  31,  33,    1,  -30 },   // 0x4B 'K'
+  {  1940,  26,  31,  29,    2,  -30 },   // 0x4C 'L'
+  {  1992,  39,  31,  41,    1,  -30 },   // 0x4D 'M'
+  {  2101,  32,  32,  34,    1,  -30 },   // 0x4E 'N'
+  {  2187,  30,  33,  34,    2,  -31 },   // 0x4F 'O'
+  {  2254,  23,  31,  27,    2,  -30 },   // 0x50 'P'
+  {  2307,  31,  40,  34,    2,  -31 },   // 0x51 'Q'
+  {  2393,  28,  31,  31,    2,  -30 },   // 0x52 'R'
+  {  2454,  21,  33,  25,    2,  -31 },   // 0x53 'S'
+  {  2506,  27,  31,  28,    1,  -30 },   // 0x54 'T'
+  {  2555,  32,  32,  34,    1,  -30 },   // 0x55 'U'
+  {  2631,  32,  32,  33,    0,  -30 },   // 0x56 'V'
+  {  2700,  44,  32,  45,    0,  -30 },   // 0x57 'W'
+  {  2807,  33,  31,  34,    0,  -30 },   // 0x58 'X'
+  {  2873,  32,  31,  33,    0,  -30 },   // 0x59 'Y'
+  {  2931,  27,  31,  29,    1,  -30 },   // 0x5A 'Z'
+  {  2990,   9,  38,  16,    4,  -30 },   // 0x5B '['
+  {  3027,  14,  32,  14,    0,  -30 },   // 0x5C '\'
+  {  3059,   9,  38,  16,    3,  -30 },   // 0x5D ']'
+  {  3096,  20,  17,  22,    1,  -30 },   // 0x5E '^'
+  {  3127,  24,   2,  23,    0,    5 },   // 0x5F '_'
+  {  3130,  10,   8,  12,    1,  -31 },   // 0x60 '`'
+  {  3138,  18,  21,  20,    1,  -20 },   // 0x61 'a'
+  {  3178,  21,  32,  24,    1,  -31 },   // 0x62 'b'
+  {  3235,  19,  21,  21,    1,  -20 },   // 0x63 'c'
+  {  3269,  22,  32,  23,    1,  -31 },   // 0x64 'd'
+  {  3328,  18,  21,  21,    1,  -20 },   // 0x65 'e'
+  {  3361,  17,  33,  18,    0,  -32 },   // 0x66 'f'
+  {  3397,  21,  31,  22,    1,  -20 },   // 0x67 'g'
+  {  3453,  22,  32,  23,    0,  -31 },   // 0x68 'h'
+  {  3513,  11,  32,  13,    0,  -31 },   // 0x69 'i'
+  {  3542,  12,  42,  16,    0,  -31 },   // 0x6A 'j'
+  {  3583,  23,  32,  24,    1,  -31 },   // 0x6B 'k'
+  {  3641,  11,  32,  12,    0,  -31 },   // 0x6C 'l'
+  {  3673,  35,  21,  37,    1,  -20 },   // 0x6D 'm'
+  {  3737,  22,  21,  23,    0,  -20 },   // 0x6E 'n'
+  {  3779,  22,  21,  23,    1,  -20 },   // 0x6F 'o'
+  {  3812,  21,  31,  24,    1,  -20 },   // 0x70 'p'
+  {  3869,  21,  31,  23,    1,  -20 },   // 0x71 'q'
+  {  3926,  15,  21,  16,    1,  -20 },   // 0x72 'r'
+  {  3953,  13,  21,  17,    2,  -20 },   // 0x73 's'
+  {  3984,  12,  26,  13,    1,  -25 },   // 0x74 't'
+  {  4012,  22,  21,  23,    1,  -20 },   // 0x75 'u'
+  {  4055,  22,  22,  22,    0,  -20 },   // 0x76 'v'
+  {  4098,  32,  22,  32,    0,  -20 },   // 0x77 'w'
+  {  4168,  22,  21,  23,    0,  -20 },   // 0x78 'x'
+  {  4209,  22,  31,  22,    0,  -20 },   // 0x79 'y'
+  {  4262,  18,  21,  20,    1,  -20 },   // 0x7A 'z'
+  {  4293,  11,  41,  23,    5,  -31 },   // 0x7B '{'
+  {  4334,   3,  32,   9,    3,  -30 },   // 0x7C '|'
+  {  4338,  11,  41,  23,    7,  -31 },   // 0x7D '}'
+  {  4380,  22,   5,  23,    1,  -13 } }; // 0x7E '~'
+
+const GFXfontPacked FreeSerif24pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeSerif24pt7bPackedRuns,
+    (GFXglyph *)FreeSerif24pt7bPackedGlyphs,
+    0x20, 0x7E, 56 } };
+
+// Approx. 5063 bytes
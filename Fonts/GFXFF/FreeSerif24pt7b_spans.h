@@ -0,0 +1,1000 @@
+// FreeSerif24pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSerif24pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSerif24pt7bSpanData[] PROGMEM = {
+  0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x01, 0x03, 0x02, 0x01, 0x02, 0x09, 0x02, 0x02,
+  0x00, 0x04, 0x08, 0x04, 0x02, 0x00, 0x04, 0x08, 0x04, 0x02, 0x00, 0x04,
+  0x08, 0x04, 0x02, 0x00, 0x04, 0x08, 0x04, 0x02, 0x00, 0x04, 0x08, 0x04,
+  0x02, 0x01, 0x02, 0x09, 0x02, 0x02, 0x01, 0x02, 0x09, 0x02, 0x02, 0x01,
+  0x02, 0x09, 0x02, 0x02, 0x01, 0x02, 0x09, 0x02, 0x02, 0x01, 0x02, 0x09,
+  0x02, 0x02, 0x01, 0x02, 0x09, 0x02, 0x02, 0x08, 0x03, 0x11, 0x03, 0x02,
+  0x08, 0x03, 0x11, 0x03, 0x02, 0x08, 0x03, 0x11, 0x03, 0x02, 0x08, 0x03,
+  0x11, 0x03, 0x02, 0x08, 0x03, 0x11, 0x02, 0x02, 0x08, 0x02, 0x11, 0x02,
+  0x02, 0x08, 0x02, 0x10, 0x03, 0x02, 0x07, 0x03, 0x10, 0x03, 0x02, 0x07,
+  0x03, 0x10, 0x03, 0x02, 0x07, 0x03, 0x10, 0x03, 0x01, 0x01, 0x16, 0x01,
+  0x01, 0x16, 0x02, 0x07, 0x02, 0x10, 0x02, 0x02, 0x06, 0x03, 0x0F, 0x03,
+  0x02, 0x06, 0x03, 0x0F, 0x03, 0x02, 0x06, 0x03, 0x0F, 0x03, 0x02, 0x06,
+  0x03, 0x0F, 0x03, 0x02, 0x06, 0x03, 0x0F, 0x03, 0x02, 0x06, 0x02, 0x0F,
+  0x02, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x02, 0x05, 0x03, 0x0E, 0x03,
+  0x02, 0x05, 0x03, 0x0E, 0x03, 0x02, 0x05, 0x03, 0x0E, 0x03, 0x02, 0x05,
+  0x02, 0x0E, 0x03, 0x02, 0x05, 0x02, 0x0E, 0x02, 0x02, 0x04, 0x03, 0x0D,
+  0x03, 0x02, 0x04, 0x03, 0x0D, 0x03, 0x02, 0x04, 0x03, 0x0D, 0x03, 0x02,
+  0x04, 0x03, 0x0D, 0x03, 0x02, 0x04, 0x03, 0x0D, 0x03, 0x01, 0x09, 0x01,
+  0x01, 0x09, 0x01, 0x01, 0x09, 0x01, 0x01, 0x06, 0x07, 0x03, 0x03, 0x04,
+  0x09, 0x01, 0x0C, 0x05, 0x03, 0x02, 0x03, 0x09, 0x01, 0x0E, 0x04, 0x03,
+  0x01, 0x03, 0x09, 0x01, 0x0F, 0x03, 0x03, 0x00, 0x03, 0x09, 0x01, 0x10,
+  0x02, 0x03, 0x00, 0x03, 0x09, 0x01, 0x10, 0x02, 0x03, 0x00, 0x03, 0x09,
+  0x01, 0x11, 0x01, 0x02, 0x00, 0x03, 0x09, 0x01, 0x02, 0x00, 0x04, 0x09,
+  0x01, 0x02, 0x01, 0x04, 0x09, 0x01, 0x02, 0x01, 0x06, 0x09, 0x01, 0x01,
+  0x02, 0x08, 0x01, 0x03, 0x07, 0x01, 0x05, 0x07, 0x01, 0x06, 0x08, 0x01,
+  0x08, 0x08, 0x01, 0x09, 0x08, 0x02, 0x09, 0x01, 0x0B, 0x07, 0x02, 0x09,
+  0x01, 0x0D, 0x05, 0x02, 0x09, 0x01, 0x0E, 0x05, 0x02, 0x09, 0x01, 0x0F,
+  0x04, 0x02, 0x09, 0x01, 0x10, 0x03, 0x03, 0x00, 0x01, 0x09, 0x01, 0x10,
+  0x03, 0x03, 0x00, 0x01, 0x09, 0x01, 0x10, 0x03, 0x03, 0x00, 0x02, 0x09,
+  0x01, 0x10, 0x03, 0x03, 0x00, 0x02, 0x09, 0x01, 0x10, 0x03, 0x03, 0x00,
+  0x03, 0x09, 0x01, 0x0F, 0x03, 0x03, 0x00, 0x04, 0x09, 0x01, 0x0E, 0x03,
+  0x03, 0x01, 0x05, 0x09, 0x01, 0x0C, 0x04, 0x01, 0x02, 0x0D, 0x01, 0x05,
+  0x07, 0x01, 0x09, 0x01, 0x01, 0x09, 0x01, 0x01, 0x09, 0x01, 0x02, 0x07,
+  0x05, 0x18, 0x02, 0x02, 0x05, 0x08, 0x16, 0x04, 0x03, 0x04, 0x04, 0x0B,
+  0x04, 0x15, 0x04, 0x03, 0x03, 0x04, 0x0E, 0x07, 0x16, 0x02, 0x03, 0x02,
+  0x04, 0x0E, 0x01, 0x15, 0x03, 0x03, 0x02, 0x04, 0x0E, 0x01, 0x15, 0x02,
+  0x03, 0x01, 0x04, 0x0E, 0x01, 0x14, 0x03, 0x03, 0x01, 0x03, 0x0E, 0x01,
+  0x14, 0x02, 0x03, 0x00, 0x04, 0x0E, 0x01, 0x13, 0x03, 0x03, 0x00, 0x04,
+  0x0D, 0x01, 0x13, 0x02, 0x03, 0x00, 0x03, 0x0D, 0x01, 0x12, 0x03, 0x03,
+  0x00, 0x03, 0x0C, 0x02, 0x12, 0x02, 0x03, 0x00, 0x03, 0x0C, 0x01, 0x11,
+  0x02, 0x04, 0x00, 0x03, 0x0B, 0x01, 0x10, 0x03, 0x19, 0x05, 0x04, 0x01,
+  0x02, 0x0A, 0x02, 0x10, 0x02, 0x17, 0x09, 0x05, 0x01, 0x03, 0x08, 0x03,
+  0x0F, 0x03, 0x16, 0x05, 0x1E, 0x02, 0x04, 0x02, 0x08, 0x0F, 0x02, 0x15,
+  0x04, 0x1F, 0x02, 0x04, 0x03, 0x05, 0x0E, 0x03, 0x14, 0x04, 0x20, 0x01,
+  0x03, 0x0E, 0x02, 0x14, 0x04, 0x20, 0x01, 0x03, 0x0D, 0x03, 0x13, 0x04,
+  0x20, 0x01, 0x03, 0x0D, 0x02, 0x13, 0x03, 0x20, 0x01, 0x03, 0x0C, 0x02,
+  0x12, 0x04, 0x20, 0x01, 0x03, 0x0B, 0x03, 0x12, 0x04, 0x1F, 0x02, 0x03,
+  0x0B, 0x02, 0x12, 0x03, 0x1F, 0x01, 0x03, 0x0A, 0x03, 0x12, 0x03, 0x1E,
+  0x02, 0x03, 0x0A, 0x02, 0x12, 0x03, 0x1E, 0x01, 0x03, 0x09, 0x03, 0x12,
+  0x03, 0x1D, 0x02, 0x03, 0x09, 0x02, 0x12, 0x03, 0x1C, 0x02, 0x03, 0x08,
+  0x03, 0x13, 0x03, 0x1A, 0x03, 0x02, 0x08, 0x02, 0x14, 0x08, 0x02, 0x07,
+  0x02, 0x15, 0x05, 0x01, 0x06, 0x03, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x08,
+  0x02, 0x09, 0x03, 0x10, 0x03, 0x02, 0x08, 0x03, 0x11, 0x02, 0x02, 0x08,
+  0x02, 0x12, 0x02, 0x02, 0x07, 0x03, 0x12, 0x02, 0x02, 0x07, 0x03, 0x12,
+  0x02, 0x02, 0x07, 0x03, 0x12, 0x02, 0x02, 0x07, 0x03, 0x11, 0x03, 0x02,
+  0x07, 0x04, 0x10, 0x03, 0x02, 0x07, 0x04, 0x0F, 0x03, 0x02, 0x08, 0x04,
+  0x0E, 0x03, 0x02, 0x08, 0x08, 0x14, 0x0A, 0x02, 0x08, 0x06, 0x16, 0x06,
+  0x02, 0x08, 0x05, 0x17, 0x04, 0x02, 0x07, 0x07, 0x17, 0x03, 0x03, 0x05,
+  0x03, 0x09, 0x05, 0x17, 0x03, 0x03, 0x04, 0x04, 0x0A, 0x05, 0x17, 0x02,
+  0x03, 0x03, 0x04, 0x0A, 0x05, 0x16, 0x02, 0x03, 0x02, 0x04, 0x0B, 0x05,
+  0x16, 0x02, 0x03, 0x01, 0x05, 0x0B, 0x05, 0x15, 0x02, 0x03, 0x01, 0x04,
+  0x0C, 0x05, 0x15, 0x02, 0x03, 0x01, 0x04, 0x0D, 0x05, 0x14, 0x02, 0x03,
+  0x00, 0x05, 0x0D, 0x06, 0x14, 0x01, 0x02, 0x00, 0x05, 0x0E, 0x07, 0x02,
+  0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x06, 0x03, 0x00, 0x06,
+  0x10, 0x06, 0x1F, 0x01, 0x03, 0x00, 0x06, 0x0F, 0x08, 0x1F, 0x01, 0x04,
+  0x01, 0x06, 0x0E, 0x03, 0x12, 0x07, 0x1D, 0x02, 0x03, 0x01, 0x07, 0x0C,
+  0x04, 0x13, 0x0C, 0x02, 0x02, 0x0C, 0x14, 0x09, 0x02, 0x04, 0x07, 0x16,
+  0x06, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x01, 0x0B, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x08, 0x02, 0x01, 0x07,
+  0x02, 0x01, 0x06, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x02, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x05, 0x02, 0x01, 0x06,
+  0x02, 0x01, 0x07, 0x02, 0x01, 0x08, 0x02, 0x01, 0x09, 0x02, 0x01, 0x0A,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x03, 0x01, 0x06,
+  0x02, 0x01, 0x06, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07,
+  0x03, 0x01, 0x07, 0x04, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x03, 0x01,
+  0x01, 0x06, 0x03, 0x0D, 0x02, 0x03, 0x00, 0x03, 0x07, 0x01, 0x0C, 0x04,
+  0x03, 0x00, 0x04, 0x07, 0x01, 0x0B, 0x05, 0x03, 0x00, 0x05, 0x07, 0x01,
+  0x0A, 0x05, 0x03, 0x02, 0x04, 0x07, 0x01, 0x09, 0x04, 0x01, 0x05, 0x05,
+  0x01, 0x07, 0x01, 0x01, 0x05, 0x05, 0x03, 0x03, 0x02, 0x07, 0x01, 0x0A,
+  0x02, 0x03, 0x00, 0x05, 0x07, 0x01, 0x0B, 0x04, 0x03, 0x00, 0x04, 0x07,
+  0x01, 0x0C, 0x04, 0x03, 0x00, 0x03, 0x07, 0x01, 0x0D, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x00, 0x17, 0x01, 0x00,
+  0x17, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x05, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x01,
+  0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x01,
+  0x03, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A,
+  0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07,
+  0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x03, 0x01, 0x08, 0x06, 0x02, 0x06, 0x03, 0x0D, 0x03, 0x02, 0x05, 0x03,
+  0x0E, 0x03, 0x02, 0x04, 0x03, 0x0F, 0x03, 0x02, 0x03, 0x04, 0x0F, 0x04,
+  0x02, 0x02, 0x04, 0x10, 0x03, 0x02, 0x02, 0x04, 0x10, 0x04, 0x02, 0x02,
+  0x04, 0x10, 0x04, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x01, 0x04, 0x11,
+  0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x00, 0x05, 0x11, 0x05, 0x02,
+  0x00, 0x05, 0x11, 0x05, 0x02, 0x00, 0x05, 0x11, 0x05, 0x02, 0x00, 0x05,
+  0x11, 0x05, 0x02, 0x00, 0x05, 0x11, 0x05, 0x02, 0x00, 0x05, 0x11, 0x05,
+  0x02, 0x00, 0x05, 0x11, 0x05, 0x02, 0x00, 0x05, 0x11, 0x05, 0x02, 0x00,
+  0x05, 0x11, 0x05, 0x02, 0x00, 0x05, 0x11, 0x05, 0x02, 0x00, 0x05, 0x11,
+  0x05, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02,
+  0x01, 0x05, 0x10, 0x05, 0x02, 0x02, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04,
+  0x10, 0x04, 0x02, 0x03, 0x03, 0x10, 0x03, 0x02, 0x03, 0x04, 0x0F, 0x04,
+  0x02, 0x04, 0x03, 0x0F, 0x03, 0x02, 0x05, 0x03, 0x0E, 0x03, 0x02, 0x06,
+  0x03, 0x0D, 0x03, 0x01, 0x08, 0x06, 0x01, 0x08, 0x01, 0x01, 0x06, 0x03,
+  0x01, 0x04, 0x05, 0x01, 0x02, 0x07, 0x02, 0x00, 0x02, 0x05, 0x04, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x04, 0x01, 0x04, 0x06, 0x01, 0x01, 0x0C, 0x01, 0x07, 0x06, 0x01,
+  0x05, 0x0A, 0x01, 0x03, 0x0E, 0x02, 0x02, 0x03, 0x0B, 0x07, 0x02, 0x02,
+  0x02, 0x0D, 0x05, 0x02, 0x01, 0x02, 0x0E, 0x05, 0x02, 0x01, 0x01, 0x0E,
+  0x05, 0x02, 0x00, 0x02, 0x0F, 0x04, 0x02, 0x00, 0x01, 0x0F, 0x04, 0x01,
+  0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x03, 0x01,
+  0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01,
+  0x0C, 0x03, 0x01, 0x0C, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x0A, 0x02, 0x01,
+  0x09, 0x02, 0x01, 0x08, 0x02, 0x01, 0x07, 0x02, 0x01, 0x06, 0x02, 0x02,
+  0x05, 0x02, 0x14, 0x01, 0x02, 0x04, 0x02, 0x14, 0x01, 0x02, 0x03, 0x02,
+  0x13, 0x01, 0x01, 0x02, 0x12, 0x01, 0x01, 0x12, 0x01, 0x00, 0x13, 0x01,
+  0x06, 0x07, 0x01, 0x04, 0x0A, 0x02, 0x03, 0x02, 0x0A, 0x05, 0x02, 0x02,
+  0x01, 0x0C, 0x04, 0x02, 0x01, 0x01, 0x0C, 0x04, 0x02, 0x01, 0x01, 0x0D,
+  0x03, 0x02, 0x00, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x02,
+  0x01, 0x0C, 0x02, 0x01, 0x0C, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x04,
+  0x01, 0x07, 0x08, 0x01, 0x05, 0x0B, 0x01, 0x09, 0x08, 0x01, 0x0C, 0x05,
+  0x01, 0x0D, 0x05, 0x01, 0x0E, 0x04, 0x01, 0x0E, 0x04, 0x01, 0x0F, 0x03,
+  0x01, 0x0F, 0x03, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x02,
+  0x01, 0x0F, 0x02, 0x01, 0x0E, 0x02, 0x01, 0x0E, 0x02, 0x02, 0x01, 0x03,
+  0x0D, 0x02, 0x02, 0x00, 0x06, 0x0B, 0x03, 0x01, 0x00, 0x0C, 0x01, 0x02,
+  0x08, 0x01, 0x0E, 0x02, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0C,
+  0x04, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x02, 0x0A, 0x02, 0x0D, 0x03,
+  0x02, 0x09, 0x02, 0x0D, 0x03, 0x02, 0x09, 0x01, 0x0D, 0x03, 0x02, 0x08,
+  0x02, 0x0D, 0x03, 0x02, 0x07, 0x02, 0x0D, 0x03, 0x02, 0x06, 0x02, 0x0D,
+  0x03, 0x02, 0x06, 0x02, 0x0D, 0x03, 0x02, 0x05, 0x02, 0x0D, 0x03, 0x02,
+  0x04, 0x02, 0x0D, 0x03, 0x02, 0x04, 0x02, 0x0D, 0x03, 0x02, 0x03, 0x02,
+  0x0D, 0x03, 0x02, 0x02, 0x02, 0x0D, 0x03, 0x02, 0x02, 0x01, 0x0D, 0x03,
+  0x02, 0x01, 0x02, 0x0D, 0x03, 0x02, 0x00, 0x02, 0x0D, 0x03, 0x01, 0x00,
+  0x15, 0x01, 0x00, 0x15, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0D,
+  0x03, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0D,
+  0x03, 0x01, 0x0D, 0x03, 0x01, 0x11, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x05,
+  0x0C, 0x01, 0x05, 0x0C, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x03,
+  0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x03, 0x01, 0x02, 0x08, 0x01, 0x02,
+  0x0A, 0x01, 0x01, 0x0D, 0x01, 0x04, 0x0B, 0x01, 0x08, 0x08, 0x01, 0x0A,
+  0x07, 0x01, 0x0C, 0x05, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x05, 0x01, 0x0E,
+  0x04, 0x01, 0x0E, 0x04, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x03, 0x01, 0x0F,
+  0x03, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x02, 0x01, 0x0E,
+  0x03, 0x01, 0x0E, 0x02, 0x01, 0x0D, 0x03, 0x02, 0x00, 0x04, 0x0C, 0x03,
+  0x02, 0x00, 0x06, 0x0B, 0x03, 0x01, 0x00, 0x0C, 0x01, 0x02, 0x07, 0x01,
+  0x10, 0x04, 0x01, 0x0D, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x08, 0x05, 0x01,
+  0x07, 0x05, 0x01, 0x06, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x03, 0x05, 0x01, 0x02, 0x06, 0x01, 0x02, 0x05, 0x01, 0x01, 0x06, 0x02,
+  0x01, 0x05, 0x09, 0x06, 0x02, 0x01, 0x05, 0x07, 0x0A, 0x02, 0x00, 0x07,
+  0x0C, 0x06, 0x02, 0x00, 0x06, 0x0E, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x06,
+  0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x06, 0x02, 0x00,
+  0x05, 0x10, 0x05, 0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00, 0x05, 0x10,
+  0x05, 0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00, 0x05, 0x10, 0x05, 0x02,
+  0x01, 0x04, 0x10, 0x05, 0x02, 0x01, 0x05, 0x10, 0x04, 0x02, 0x01, 0x05,
+  0x10, 0x04, 0x02, 0x02, 0x04, 0x0F, 0x05, 0x02, 0x02, 0x05, 0x0F, 0x04,
+  0x02, 0x03, 0x05, 0x0E, 0x04, 0x02, 0x04, 0x05, 0x0D, 0x04, 0x01, 0x05,
+  0x0B, 0x01, 0x08, 0x06, 0x01, 0x02, 0x12, 0x01, 0x02, 0x12, 0x01, 0x02,
+  0x11, 0x02, 0x01, 0x03, 0x10, 0x03, 0x02, 0x01, 0x01, 0x10, 0x03, 0x02,
+  0x00, 0x02, 0x0F, 0x03, 0x02, 0x00, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x03,
+  0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0D, 0x03,
+  0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03,
+  0x01, 0x0C, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x03,
+  0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03, 0x01, 0x06, 0x06,
+  0x01, 0x04, 0x0A, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02, 0x02, 0x02, 0x0D,
+  0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x02, 0x0E, 0x03, 0x02,
+  0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x04,
+  0x0E, 0x03, 0x02, 0x00, 0x04, 0x0E, 0x03, 0x02, 0x01, 0x04, 0x0D, 0x03,
+  0x02, 0x01, 0x05, 0x0C, 0x03, 0x02, 0x02, 0x05, 0x0B, 0x03, 0x02, 0x03,
+  0x06, 0x0A, 0x03, 0x01, 0x04, 0x07, 0x01, 0x05, 0x07, 0x01, 0x06, 0x07,
+  0x01, 0x04, 0x0A, 0x02, 0x03, 0x03, 0x09, 0x06, 0x02, 0x02, 0x03, 0x0A,
+  0x06, 0x02, 0x01, 0x03, 0x0C, 0x05, 0x02, 0x01, 0x02, 0x0D, 0x04, 0x02,
+  0x00, 0x03, 0x0E, 0x04, 0x02, 0x00, 0x03, 0x0E, 0x04, 0x02, 0x00, 0x03,
+  0x0F, 0x03, 0x02, 0x00, 0x03, 0x0F, 0x03, 0x02, 0x00, 0x03, 0x0F, 0x03,
+  0x02, 0x00, 0x04, 0x0F, 0x03, 0x02, 0x01, 0x03, 0x0E, 0x03, 0x02, 0x01,
+  0x04, 0x0E, 0x03, 0x02, 0x02, 0x05, 0x0C, 0x04, 0x01, 0x03, 0x0B, 0x01,
+  0x05, 0x07, 0x01, 0x07, 0x06, 0x01, 0x05, 0x0A, 0x02, 0x04, 0x04, 0x0C,
+  0x05, 0x02, 0x03, 0x04, 0x0D, 0x05, 0x02, 0x02, 0x04, 0x0E, 0x04, 0x02,
+  0x01, 0x05, 0x0F, 0x04, 0x02, 0x01, 0x04, 0x0F, 0x05, 0x02, 0x01, 0x04,
+  0x0F, 0x05, 0x02, 0x00, 0x05, 0x10, 0x04, 0x02, 0x00, 0x05, 0x10, 0x05,
+  0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00,
+  0x05, 0x10, 0x05, 0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00, 0x06, 0x10,
+  0x05, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02, 0x01, 0x05, 0x10, 0x05, 0x02,
+  0x02, 0x05, 0x0F, 0x06, 0x02, 0x03, 0x06, 0x0D, 0x07, 0x02, 0x04, 0x0A,
+  0x10, 0x04, 0x02, 0x06, 0x06, 0x0F, 0x05, 0x01, 0x0F, 0x04, 0x01, 0x0E,
+  0x05, 0x01, 0x0E, 0x04, 0x01, 0x0D, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0C,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x09, 0x05, 0x01, 0x08, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x04, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x01, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x01,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x06, 0x01, 0x01, 0x05, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02,
+  0x00, 0x01, 0x15, 0x03, 0x01, 0x13, 0x05, 0x01, 0x11, 0x07, 0x01, 0x0F,
+  0x07, 0x01, 0x0D, 0x07, 0x01, 0x0A, 0x08, 0x01, 0x08, 0x08, 0x01, 0x06,
+  0x08, 0x01, 0x04, 0x07, 0x01, 0x02, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x06, 0x01, 0x01, 0x08, 0x01, 0x03, 0x08, 0x01, 0x05,
+  0x08, 0x01, 0x08, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0C, 0x08, 0x01, 0x0E,
+  0x08, 0x01, 0x10, 0x08, 0x01, 0x13, 0x05, 0x01, 0x15, 0x03, 0x01, 0x17,
+  0x01, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x08, 0x01, 0x02, 0x08, 0x01,
+  0x04, 0x08, 0x01, 0x07, 0x07, 0x01, 0x09, 0x07, 0x01, 0x0B, 0x08, 0x01,
+  0x0D, 0x08, 0x01, 0x0F, 0x08, 0x01, 0x12, 0x06, 0x01, 0x13, 0x05, 0x01,
+  0x11, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0D, 0x07, 0x01, 0x0A, 0x08, 0x01,
+  0x08, 0x08, 0x01, 0x06, 0x08, 0x01, 0x04, 0x07, 0x01, 0x02, 0x07, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x01, 0x05, 0x06,
+  0x01, 0x03, 0x0B, 0x02, 0x02, 0x02, 0x09, 0x06, 0x02, 0x01, 0x01, 0x0B,
+  0x05, 0x02, 0x00, 0x02, 0x0B, 0x05, 0x02, 0x00, 0x03, 0x0C, 0x05, 0x02,
+  0x00, 0x04, 0x0C, 0x05, 0x02, 0x00, 0x04, 0x0C, 0x05, 0x02, 0x01, 0x03,
+  0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01,
+  0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x03, 0x01,
+  0x0A, 0x02, 0x01, 0x0A, 0x01, 0x01, 0x09, 0x02, 0x01, 0x09, 0x01, 0x01,
+  0x09, 0x01, 0x01, 0x08, 0x02, 0x01, 0x08, 0x01, 0x01, 0x08, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x07, 0x03, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01,
+  0x06, 0x05, 0x01, 0x07, 0x03, 0x01, 0x0D, 0x08, 0x01, 0x0A, 0x0E, 0x02,
+  0x08, 0x06, 0x15, 0x05, 0x02, 0x07, 0x04, 0x18, 0x03, 0x02, 0x05, 0x05,
+  0x1A, 0x02, 0x02, 0x04, 0x04, 0x1B, 0x02, 0x02, 0x03, 0x04, 0x1C, 0x02,
+  0x02, 0x03, 0x04, 0x1D, 0x01, 0x03, 0x02, 0x04, 0x10, 0x05, 0x1D, 0x02,
+  0x04, 0x02, 0x04, 0x0F, 0x07, 0x17, 0x03, 0x1E, 0x01, 0x04, 0x01, 0x04,
+  0x0E, 0x04, 0x15, 0x05, 0x1E, 0x02, 0x04, 0x01, 0x04, 0x0D, 0x03, 0x15,
+  0x04, 0x1F, 0x01, 0x04, 0x00, 0x04, 0x0C, 0x03, 0x16, 0x03, 0x1F, 0x01,
+  0x04, 0x00, 0x04, 0x0C, 0x03, 0x16, 0x03, 0x1F, 0x01, 0x04, 0x00, 0x04,
+  0x0B, 0x03, 0x15, 0x04, 0x1F, 0x01, 0x04, 0x00, 0x04, 0x0B, 0x03, 0x15,
+  0x03, 0x1F, 0x01, 0x04, 0x00, 0x04, 0x0A, 0x03, 0x15, 0x03, 0x1F, 0x01,
+  0x04, 0x00, 0x04, 0x0A, 0x03, 0x15, 0x03, 0x1E, 0x02, 0x04, 0x00, 0x04,
+  0x0A, 0x03, 0x14, 0x04, 0x1E, 0x01, 0x04, 0x00, 0x04, 0x0A, 0x03, 0x14,
+  0x03, 0x1E, 0x01, 0x04, 0x00, 0x04, 0x0A, 0x03, 0x13, 0x04, 0x1D, 0x01,
+  0x04, 0x01, 0x04, 0x0A, 0x03, 0x13, 0x04, 0x1C, 0x02, 0x05, 0x01, 0x04,
+  0x0B, 0x03, 0x11, 0x02, 0x14, 0x03, 0x1B, 0x02, 0x03, 0x02, 0x03, 0x0B,
+  0x07, 0x15, 0x07, 0x03, 0x02, 0x04, 0x0C, 0x04, 0x16, 0x05, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x04, 0x04, 0x01, 0x05, 0x05, 0x02, 0x06,
+  0x05, 0x19, 0x02, 0x02, 0x08, 0x06, 0x16, 0x05, 0x01, 0x0A, 0x0F, 0x01,
+  0x0D, 0x09, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x02, 0x01, 0x0E, 0x03, 0x01,
+  0x0E, 0x04, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x06, 0x01, 0x0D, 0x06, 0x02,
+  0x0C, 0x02, 0x0F, 0x05, 0x02, 0x0C, 0x02, 0x0F, 0x05, 0x02, 0x0B, 0x02,
+  0x10, 0x04, 0x02, 0x0B, 0x02, 0x10, 0x05, 0x02, 0x0A, 0x03, 0x11, 0x04,
+  0x02, 0x0A, 0x02, 0x11, 0x05, 0x02, 0x0A, 0x02, 0x11, 0x05, 0x02, 0x09,
+  0x02, 0x12, 0x05, 0x02, 0x09, 0x02, 0x12, 0x05, 0x02, 0x08, 0x03, 0x13,
+  0x04, 0x02, 0x08, 0x02, 0x13, 0x05, 0x02, 0x08, 0x02, 0x13, 0x05, 0x02,
+  0x07, 0x02, 0x14, 0x05, 0x01, 0x07, 0x12, 0x01, 0x06, 0x14, 0x02, 0x06,
+  0x02, 0x15, 0x05, 0x02, 0x05, 0x03, 0x15, 0x05, 0x02, 0x05, 0x02, 0x16,
+  0x05, 0x02, 0x05, 0x02, 0x16, 0x05, 0x02, 0x04, 0x03, 0x17, 0x05, 0x02,
+  0x04, 0x02, 0x17, 0x05, 0x02, 0x03, 0x03, 0x17, 0x06, 0x02, 0x02, 0x04,
+  0x17, 0x06, 0x02, 0x01, 0x06, 0x17, 0x07, 0x02, 0x00, 0x09, 0x14, 0x0C,
+  0x01, 0x00, 0x13, 0x01, 0x03, 0x13, 0x02, 0x05, 0x05, 0x11, 0x06, 0x02,
+  0x05, 0x05, 0x13, 0x05, 0x02, 0x05, 0x05, 0x14, 0x05, 0x02, 0x05, 0x05,
+  0x14, 0x06, 0x02, 0x05, 0x05, 0x15, 0x05, 0x02, 0x05, 0x05, 0x15, 0x05,
+  0x02, 0x05, 0x05, 0x15, 0x05, 0x02, 0x05, 0x05, 0x15, 0x05, 0x02, 0x05,
+  0x05, 0x15, 0x05, 0x02, 0x05, 0x05, 0x14, 0x05, 0x02, 0x05, 0x05, 0x13,
+  0x05, 0x02, 0x05, 0x05, 0x11, 0x06, 0x01, 0x05, 0x10, 0x01, 0x05, 0x10,
+  0x02, 0x05, 0x05, 0x11, 0x07, 0x02, 0x05, 0x05, 0x14, 0x05, 0x02, 0x05,
+  0x05, 0x15, 0x05, 0x02, 0x05, 0x05, 0x15, 0x05, 0x02, 0x05, 0x05, 0x16,
+  0x05, 0x02, 0x05, 0x05, 0x16, 0x05, 0x02, 0x05, 0x05, 0x16, 0x05, 0x02,
+  0x05, 0x05, 0x16, 0x05, 0x02, 0x05, 0x05, 0x16, 0x05, 0x02, 0x05, 0x05,
+  0x15, 0x05, 0x02, 0x05, 0x05, 0x15, 0x05, 0x02, 0x05, 0x05, 0x14, 0x05,
+  0x02, 0x05, 0x05, 0x11, 0x07, 0x01, 0x04, 0x13, 0x01, 0x00, 0x14, 0x02,
+  0x0B, 0x09, 0x1A, 0x01, 0x02, 0x09, 0x0E, 0x18, 0x03, 0x02, 0x07, 0x06,
+  0x13, 0x08, 0x02, 0x06, 0x05, 0x15, 0x06, 0x02, 0x05, 0x04, 0x17, 0x04,
+  0x02, 0x04, 0x04, 0x17, 0x04, 0x02, 0x03, 0x05, 0x18, 0x03, 0x02, 0x02,
+  0x05, 0x19, 0x02, 0x02, 0x02, 0x04, 0x19, 0x02, 0x02, 0x01, 0x05, 0x1A,
+  0x01, 0x02, 0x01, 0x05, 0x1A, 0x01, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x06, 0x02, 0x03, 0x05, 0x1A, 0x01, 0x02,
+  0x04, 0x05, 0x18, 0x03, 0x02, 0x05, 0x06, 0x17, 0x03, 0x02, 0x06, 0x07,
+  0x14, 0x04, 0x01, 0x08, 0x0E, 0x01, 0x0B, 0x08, 0x01, 0x00, 0x12, 0x01,
+  0x02, 0x14, 0x02, 0x04, 0x05, 0x10, 0x08, 0x02, 0x04, 0x05, 0x13, 0x06,
+  0x02, 0x04, 0x05, 0x15, 0x06, 0x02, 0x04, 0x05, 0x16, 0x06, 0x02, 0x04,
+  0x05, 0x17, 0x05, 0x02, 0x04, 0x05, 0x18, 0x05, 0x02, 0x04, 0x05, 0x18,
+  0x05, 0x02, 0x04, 0x05, 0x19, 0x05, 0x02, 0x04, 0x05, 0x19, 0x05, 0x02,
+  0x04, 0x05, 0x19, 0x06, 0x02, 0x04, 0x05, 0x1A, 0x05, 0x02, 0x04, 0x05,
+  0x1A, 0x05, 0x02, 0x04, 0x05, 0x1A, 0x05, 0x02, 0x04, 0x05, 0x1A, 0x05,
+  0x02, 0x04, 0x05, 0x1A, 0x05, 0x02, 0x04, 0x05, 0x1A, 0x05, 0x02, 0x04,
+  0x05, 0x1A, 0x05, 0x02, 0x04, 0x05, 0x1A, 0x05, 0x02, 0x04, 0x05, 0x19,
+  0x05, 0x02, 0x04, 0x05, 0x19, 0x05, 0x02, 0x04, 0x05, 0x19, 0x04, 0x02,
+  0x04, 0x05, 0x18, 0x05, 0x02, 0x04, 0x05, 0x17, 0x05, 0x02, 0x04, 0x05,
+  0x17, 0x05, 0x02, 0x04, 0x05, 0x15, 0x06, 0x02, 0x04, 0x05, 0x14, 0x05,
+  0x02, 0x04, 0x05, 0x10, 0x08, 0x01, 0x02, 0x14, 0x01, 0x00, 0x12, 0x01,
+  0x00, 0x18, 0x01, 0x02, 0x16, 0x02, 0x03, 0x05, 0x15, 0x03, 0x02, 0x03,
+  0x05, 0x16, 0x02, 0x02, 0x03, 0x05, 0x16, 0x02, 0x02, 0x03, 0x05, 0x17,
+  0x01, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x02, 0x03, 0x05, 0x14, 0x01, 0x02, 0x03, 0x05, 0x14, 0x01, 0x02,
+  0x03, 0x05, 0x13, 0x02, 0x02, 0x03, 0x05, 0x12, 0x03, 0x01, 0x03, 0x12,
+  0x01, 0x03, 0x12, 0x02, 0x03, 0x05, 0x12, 0x03, 0x02, 0x03, 0x05, 0x13,
+  0x02, 0x02, 0x03, 0x05, 0x14, 0x01, 0x02, 0x03, 0x05, 0x14, 0x01, 0x01,
+  0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x02, 0x03, 0x05, 0x19,
+  0x02, 0x02, 0x03, 0x05, 0x19, 0x01, 0x02, 0x03, 0x05, 0x18, 0x02, 0x02,
+  0x03, 0x05, 0x17, 0x03, 0x02, 0x03, 0x05, 0x16, 0x03, 0x02, 0x03, 0x05,
+  0x14, 0x05, 0x01, 0x02, 0x17, 0x01, 0x00, 0x19, 0x01, 0x00, 0x18, 0x01,
+  0x02, 0x16, 0x02, 0x03, 0x05, 0x15, 0x03, 0x02, 0x03, 0x05, 0x16, 0x02,
+  0x02, 0x03, 0x05, 0x16, 0x02, 0x02, 0x03, 0x05, 0x17, 0x01, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x02, 0x03,
+  0x05, 0x14, 0x01, 0x02, 0x03, 0x05, 0x14, 0x01, 0x02, 0x03, 0x05, 0x13,
+  0x02, 0x02, 0x03, 0x05, 0x12, 0x03, 0x01, 0x03, 0x12, 0x01, 0x03, 0x12,
+  0x02, 0x03, 0x05, 0x12, 0x03, 0x02, 0x03, 0x05, 0x13, 0x02, 0x02, 0x03,
+  0x05, 0x14, 0x01, 0x02, 0x03, 0x05, 0x14, 0x01, 0x01, 0x03, 0x05, 0x01,
+  0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01,
+  0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01,
+  0x02, 0x07, 0x01, 0x00, 0x0C, 0x02, 0x0C, 0x08, 0x1C, 0x01, 0x02, 0x09,
+  0x0F, 0x1A, 0x03, 0x02, 0x07, 0x06, 0x15, 0x08, 0x02, 0x06, 0x05, 0x17,
+  0x06, 0x02, 0x05, 0x04, 0x19, 0x04, 0x02, 0x04, 0x04, 0x1A, 0x03, 0x02,
+  0x03, 0x05, 0x1A, 0x03, 0x02, 0x02, 0x05, 0x1B, 0x02, 0x02, 0x02, 0x05,
+  0x1C, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x02, 0x00, 0x05, 0x15,
+  0x0A, 0x02, 0x00, 0x05, 0x17, 0x07, 0x02, 0x00, 0x05, 0x18, 0x05, 0x02,
+  0x00, 0x05, 0x18, 0x05, 0x02, 0x00, 0x05, 0x18, 0x05, 0x02, 0x00, 0x05,
+  0x18, 0x05, 0x02, 0x01, 0x05, 0x18, 0x05, 0x02, 0x01, 0x05, 0x18, 0x05,
+  0x02, 0x01, 0x05, 0x18, 0x05, 0x02, 0x02, 0x05, 0x18, 0x05, 0x02, 0x02,
+  0x05, 0x18, 0x05, 0x02, 0x03, 0x05, 0x18, 0x05, 0x02, 0x03, 0x06, 0x18,
+  0x05, 0x02, 0x04, 0x06, 0x18, 0x05, 0x02, 0x06, 0x05, 0x17, 0x06, 0x02,
+  0x07, 0x07, 0x15, 0x07, 0x01, 0x09, 0x10, 0x01, 0x0C, 0x09, 0x02, 0x00,
+  0x0B, 0x13, 0x0B, 0x02, 0x02, 0x07, 0x15, 0x07, 0x02, 0x03, 0x05, 0x16,
+  0x05, 0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x16, 0x05, 0x02,
+  0x03, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05,
+  0x16, 0x05, 0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x16, 0x05,
+  0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x03,
+  0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x16, 0x05, 0x01, 0x03, 0x18, 0x01,
+  0x03, 0x18, 0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x16, 0x05,
+  0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x03,
+  0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x16,
+  0x05, 0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x16, 0x05, 0x02,
+  0x03, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x03, 0x05,
+  0x16, 0x05, 0x02, 0x03, 0x05, 0x16, 0x05, 0x02, 0x02, 0x07, 0x15, 0x07,
+  0x02, 0x00, 0x0B, 0x13, 0x0B, 0x01, 0x00, 0x0D, 0x01, 0x03, 0x07, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x07, 0x01,
+  0x00, 0x0D, 0x01, 0x04, 0x0D, 0x01, 0x07, 0x07, 0x01, 0x08, 0x05, 0x01,
+  0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01,
+  0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01,
+  0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01,
+  0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01,
+  0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01,
+  0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x02,
+  0x01, 0x03, 0x08, 0x04, 0x02, 0x00, 0x05, 0x08, 0x04, 0x02, 0x00, 0x05,
+  0x07, 0x04, 0x01, 0x01, 0x09, 0x01, 0x02, 0x06, 0x02, 0x00, 0x0D, 0x12,
+  0x0C, 0x02, 0x02, 0x08, 0x15, 0x06, 0x02, 0x04, 0x05, 0x15, 0x04, 0x02,
+  0x04, 0x05, 0x15, 0x03, 0x02, 0x04, 0x05, 0x14, 0x03, 0x02, 0x04, 0x05,
+  0x13, 0x03, 0x02, 0x04, 0x05, 0x12, 0x03, 0x02, 0x04, 0x05, 0x11, 0x03,
+  0x02, 0x04, 0x05, 0x10, 0x03, 0x02, 0x04, 0x05, 0x0F, 0x03, 0x02, 0x04,
+  0x05, 0x0E, 0x03, 0x02, 0x04, 0x05, 0x0D, 0x03, 0x02, 0x04, 0x05, 0x0B,
+  0x04, 0x02, 0x04, 0x05, 0x0A, 0x04, 0x01, 0x04, 0x0B, 0x01, 0x04, 0x0C,
+  0x02, 0x04, 0x06, 0x0B, 0x06, 0x02, 0x04, 0x05, 0x0C, 0x06, 0x02, 0x04,
+  0x05, 0x0D, 0x06, 0x02, 0x04, 0x05, 0x0E, 0x06, 0x02, 0x04, 0x05, 0x0F,
+  0x06, 0x02, 0x04, 0x05, 0x10, 0x06, 0x02, 0x04, 0x05, 0x11, 0x06, 0x02,
+  0x04, 0x05, 0x12, 0x06, 0x02, 0x04, 0x05, 0x12, 0x07, 0x02, 0x04, 0x05,
+  0x13, 0x06, 0x02, 0x04, 0x05, 0x14, 0x06, 0x02, 0x04, 0x05, 0x15, 0x06,
+  0x02, 0x04, 0x05, 0x15, 0x07, 0x02, 0x03, 0x07, 0x15, 0x09, 0x02, 0x00,
+  0x0D, 0x12, 0x0E, 0x01, 0x00, 0x0C, 0x01, 0x02, 0x08, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05,
+  0x02, 0x03, 0x05, 0x19, 0x01, 0x02, 0x03, 0x05, 0x18, 0x02, 0x02, 0x03,
+  0x05, 0x18, 0x01, 0x02, 0x03, 0x05, 0x17, 0x02, 0x02, 0x03, 0x05, 0x16,
+  0x03, 0x02, 0x03, 0x05, 0x13, 0x06, 0x01, 0x02, 0x16, 0x01, 0x00, 0x18,
+  0x02, 0x00, 0x09, 0x1E, 0x09, 0x02, 0x02, 0x08, 0x1E, 0x07, 0x02, 0x04,
+  0x06, 0x1D, 0x07, 0x02, 0x04, 0x06, 0x1D, 0x07, 0x02, 0x04, 0x07, 0x1C,
+  0x08, 0x03, 0x04, 0x07, 0x1C, 0x02, 0x1F, 0x05, 0x04, 0x04, 0x02, 0x07,
+  0x05, 0x1C, 0x02, 0x1F, 0x05, 0x04, 0x04, 0x02, 0x07, 0x05, 0x1B, 0x03,
+  0x1F, 0x05, 0x04, 0x04, 0x02, 0x07, 0x06, 0x1B, 0x02, 0x1F, 0x05, 0x04,
+  0x04, 0x02, 0x08, 0x05, 0x1A, 0x03, 0x1F, 0x05, 0x04, 0x04, 0x02, 0x08,
+  0x06, 0x1A, 0x02, 0x1F, 0x05, 0x04, 0x04, 0x02, 0x09, 0x05, 0x19, 0x03,
+  0x1F, 0x05, 0x04, 0x04, 0x02, 0x09, 0x06, 0x19, 0x02, 0x1F, 0x05, 0x04,
+  0x04, 0x02, 0x0A, 0x05, 0x18, 0x03, 0x1F, 0x05, 0x04, 0x04, 0x02, 0x0A,
+  0x06, 0x18, 0x02, 0x1F, 0x05, 0x04, 0x04, 0x02, 0x0B, 0x05, 0x18, 0x02,
+  0x1F, 0x05, 0x04, 0x04, 0x02, 0x0B, 0x06, 0x17, 0x02, 0x1F, 0x05, 0x04,
+  0x04, 0x02, 0x0C, 0x05, 0x17, 0x02, 0x1F, 0x05, 0x04, 0x04, 0x02, 0x0C,
+  0x06, 0x16, 0x02, 0x1F, 0x05, 0x04, 0x04, 0x02, 0x0D, 0x05, 0x16, 0x02,
+  0x1F, 0x05, 0x04, 0x04, 0x02, 0x0D, 0x05, 0x15, 0x03, 0x1F, 0x05, 0x04,
+  0x04, 0x02, 0x0E, 0x05, 0x15, 0x02, 0x1F, 0x05, 0x04, 0x04, 0x02, 0x0E,
+  0x05, 0x14, 0x03, 0x1F, 0x05, 0x03, 0x04, 0x02, 0x0F, 0x07, 0x1F, 0x05,
+  0x03, 0x04, 0x02, 0x0F, 0x07, 0x1F, 0x05, 0x03, 0x04, 0x02, 0x0F, 0x06,
+  0x1F, 0x05, 0x03, 0x04, 0x02, 0x10, 0x05, 0x1F, 0x05, 0x03, 0x04, 0x02,
+  0x10, 0x04, 0x1F, 0x05, 0x03, 0x03, 0x04, 0x11, 0x03, 0x1F, 0x05, 0x03,
+  0x02, 0x06, 0x11, 0x02, 0x1D, 0x08, 0x03, 0x00, 0x0A, 0x12, 0x01, 0x1B,
+  0x0C, 0x02, 0x00, 0x08, 0x16, 0x0A, 0x02, 0x02, 0x07, 0x18, 0x06, 0x02,
+  0x03, 0x07, 0x19, 0x04, 0x02, 0x04, 0x06, 0x1A, 0x02, 0x02, 0x04, 0x07,
+  0x1A, 0x02, 0x02, 0x04, 0x08, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x07, 0x06,
+  0x1A, 0x02, 0x03, 0x04, 0x02, 0x07, 0x07, 0x1A, 0x02, 0x03, 0x04, 0x02,
+  0x08, 0x06, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x09, 0x06, 0x1A, 0x02, 0x03,
+  0x04, 0x02, 0x0A, 0x06, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x0B, 0x06, 0x1A,
+  0x02, 0x03, 0x04, 0x02, 0x0B, 0x07, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x0C,
+  0x07, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x0D, 0x06, 0x1A, 0x02, 0x03, 0x04,
+  0x02, 0x0E, 0x06, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x0F, 0x06, 0x1A, 0x02,
+  0x03, 0x04, 0x02, 0x0F, 0x07, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x10, 0x07,
+  0x1A, 0x02, 0x03, 0x04, 0x02, 0x11, 0x06, 0x1A, 0x02, 0x03, 0x04, 0x02,
+  0x12, 0x06, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x13, 0x06, 0x1A, 0x02, 0x02,
+  0x04, 0x02, 0x14, 0x08, 0x02, 0x04, 0x02, 0x14, 0x08, 0x02, 0x04, 0x02,
+  0x15, 0x07, 0x02, 0x04, 0x02, 0x16, 0x06, 0x02, 0x04, 0x02, 0x17, 0x05,
+  0x02, 0x04, 0x02, 0x18, 0x04, 0x02, 0x03, 0x04, 0x18, 0x04, 0x02, 0x02,
+  0x06, 0x19, 0x03, 0x02, 0x00, 0x0A, 0x1A, 0x02, 0x01, 0x1B, 0x01, 0x01,
+  0x0B, 0x08, 0x01, 0x08, 0x0E, 0x02, 0x07, 0x05, 0x12, 0x05, 0x02, 0x05,
+  0x05, 0x14, 0x05, 0x02, 0x04, 0x05, 0x15, 0x05, 0x02, 0x03, 0x05, 0x16,
+  0x04, 0x02, 0x03, 0x04, 0x17, 0x04, 0x02, 0x02, 0x05, 0x17, 0x05, 0x02,
+  0x02, 0x04, 0x18, 0x04, 0x02, 0x01, 0x05, 0x18, 0x05, 0x02, 0x01, 0x05,
+  0x18, 0x05, 0x02, 0x01, 0x04, 0x19, 0x04, 0x02, 0x00, 0x05, 0x19, 0x05,
+  0x02, 0x00, 0x05, 0x19, 0x05, 0x02, 0x00, 0x05, 0x19, 0x05, 0x02, 0x00,
+  0x05, 0x19, 0x05, 0x02, 0x00, 0x05, 0x19, 0x05, 0x02, 0x00, 0x05, 0x19,
+  0x05, 0x02, 0x00, 0x05, 0x19, 0x05, 0x02, 0x00, 0x05, 0x19, 0x05, 0x02,
+  0x00, 0x05, 0x19, 0x05, 0x02, 0x01, 0x05, 0x18, 0x05, 0x02, 0x01, 0x05,
+  0x18, 0x05, 0x02, 0x01, 0x05, 0x18, 0x05, 0x02, 0x02, 0x04, 0x18, 0x04,
+  0x02, 0x02, 0x05, 0x17, 0x05, 0x02, 0x03, 0x04, 0x17, 0x04, 0x02, 0x03,
+  0x05, 0x16, 0x05, 0x02, 0x04, 0x05, 0x15, 0x05, 0x02, 0x05, 0x05, 0x14,
+  0x05, 0x02, 0x07, 0x05, 0x12, 0x05, 0x01, 0x08, 0x0E, 0x01, 0x0B, 0x08,
+  0x01, 0x00, 0x10, 0x01, 0x02, 0x10, 0x02, 0x03, 0x05, 0x0D, 0x07, 0x02,
+  0x03, 0x05, 0x10, 0x05, 0x02, 0x03, 0x05, 0x11, 0x05, 0x02, 0x03, 0x05,
+  0x11, 0x05, 0x02, 0x03, 0x05, 0x12, 0x05, 0x02, 0x03, 0x05, 0x12, 0x05,
+  0x02, 0x03, 0x05, 0x12, 0x05, 0x02, 0x03, 0x05, 0x12, 0x05, 0x02, 0x03,
+  0x05, 0x12, 0x05, 0x02, 0x03, 0x05, 0x12, 0x05, 0x02, 0x03, 0x05, 0x11,
+  0x05, 0x02, 0x03, 0x05, 0x11, 0x05, 0x02, 0x03, 0x05, 0x10, 0x05, 0x02,
+  0x03, 0x05, 0x0E, 0x06, 0x01, 0x03, 0x0F, 0x01, 0x03, 0x0D, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x07, 0x01, 0x00,
+  0x0C, 0x01, 0x0B, 0x08, 0x01, 0x08, 0x0E, 0x02, 0x07, 0x05, 0x12, 0x05,
+  0x02, 0x05, 0x05, 0x14, 0x05, 0x02, 0x04, 0x05, 0x15, 0x05, 0x02, 0x03,
+  0x05, 0x16, 0x05, 0x02, 0x03, 0x04, 0x17, 0x04, 0x02, 0x02, 0x05, 0x17,
+  0x05, 0x02, 0x02, 0x04, 0x18, 0x04, 0x02, 0x01, 0x05, 0x18, 0x05, 0x02,
+  0x01, 0x05, 0x18, 0x05, 0x02, 0x01, 0x04, 0x19, 0x04, 0x02, 0x00, 0x05,
+  0x19, 0x05, 0x02, 0x00, 0x05, 0x19, 0x05, 0x02, 0x00, 0x05, 0x19, 0x05,
+  0x02, 0x00, 0x05, 0x19, 0x05, 0x02, 0x00, 0x05, 0x19, 0x05, 0x02, 0x00,
+  0x05, 0x19, 0x05, 0x02, 0x00, 0x05, 0x19, 0x05, 0x02, 0x00, 0x05, 0x19,
+  0x05, 0x02, 0x00, 0x05, 0x19, 0x05, 0x02, 0x01, 0x04, 0x18, 0x05, 0x02,
+  0x01, 0x05, 0x18, 0x05, 0x02, 0x01, 0x05, 0x18, 0x05, 0x02, 0x02, 0x04,
+  0x17, 0x05, 0x02, 0x02, 0x05, 0x17, 0x05, 0x02, 0x03, 0x04, 0x16, 0x05,
+  0x02, 0x04, 0x04, 0x16, 0x04, 0x02, 0x05, 0x04, 0x15, 0x04, 0x02, 0x06,
+  0x05, 0x13, 0x05, 0x02, 0x08, 0x06, 0x10, 0x06, 0x01, 0x0A, 0x0A, 0x01,
+  0x0B, 0x07, 0x01, 0x0C, 0x07, 0x01, 0x0D, 0x07, 0x01, 0x0E, 0x07, 0x01,
+  0x10, 0x07, 0x01, 0x11, 0x07, 0x01, 0x14, 0x07, 0x01, 0x17, 0x08, 0x01,
+  0x00, 0x10, 0x01, 0x02, 0x11, 0x02, 0x03, 0x05, 0x0E, 0x07, 0x02, 0x03,
+  0x05, 0x10, 0x05, 0x02, 0x03, 0x05, 0x11, 0x05, 0x02, 0x03, 0x05, 0x12,
+  0x05, 0x02, 0x03, 0x05, 0x12, 0x05, 0x02, 0x03, 0x05, 0x12, 0x05, 0x02,
+  0x03, 0x05, 0x12, 0x05, 0x02, 0x03, 0x05, 0x12, 0x05, 0x02, 0x03, 0x05,
+  0x12, 0x05, 0x02, 0x03, 0x05, 0x11, 0x05, 0x02, 0x03, 0x05, 0x11, 0x05,
+  0x02, 0x03, 0x05, 0x10, 0x05, 0x02, 0x03, 0x05, 0x0D, 0x07, 0x01, 0x03,
+  0x0F, 0x01, 0x03, 0x0C, 0x02, 0x03, 0x05, 0x0B, 0x05, 0x02, 0x03, 0x05,
+  0x0B, 0x06, 0x02, 0x03, 0x05, 0x0C, 0x05, 0x02, 0x03, 0x05, 0x0D, 0x05,
+  0x02, 0x03, 0x05, 0x0E, 0x05, 0x02, 0x03, 0x05, 0x0E, 0x06, 0x02, 0x03,
+  0x05, 0x0F, 0x06, 0x02, 0x03, 0x05, 0x10, 0x06, 0x02, 0x03, 0x05, 0x11,
+  0x05, 0x02, 0x03, 0x05, 0x11, 0x06, 0x02, 0x03, 0x05, 0x12, 0x06, 0x02,
+  0x03, 0x05, 0x13, 0x06, 0x02, 0x02, 0x07, 0x14, 0x06, 0x02, 0x00, 0x0C,
+  0x14, 0x08, 0x02, 0x06, 0x06, 0x12, 0x01, 0x02, 0x04, 0x0B, 0x11, 0x02,
+  0x02, 0x03, 0x05, 0x0D, 0x06, 0x02, 0x02, 0x04, 0x0F, 0x04, 0x02, 0x02,
+  0x03, 0x10, 0x03, 0x02, 0x01, 0x04, 0x11, 0x02, 0x02, 0x01, 0x04, 0x11,
+  0x03, 0x02, 0x01, 0x04, 0x12, 0x02, 0x02, 0x01, 0x05, 0x12, 0x02, 0x02,
+  0x01, 0x05, 0x12, 0x02, 0x01, 0x01, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02,
+  0x08, 0x01, 0x03, 0x08, 0x01, 0x04, 0x09, 0x01, 0x05, 0x0A, 0x01, 0x07,
+  0x09, 0x01, 0x08, 0x0A, 0x01, 0x0A, 0x09, 0x01, 0x0C, 0x07, 0x01, 0x0D,
+  0x07, 0x01, 0x0E, 0x07, 0x01, 0x0F, 0x06, 0x02, 0x00, 0x01, 0x10, 0x05,
+  0x02, 0x00, 0x02, 0x10, 0x05, 0x02, 0x00, 0x02, 0x10, 0x05, 0x02, 0x00,
+  0x03, 0x10, 0x05, 0x02, 0x00, 0x03, 0x10, 0x04, 0x02, 0x00, 0x04, 0x0F,
+  0x05, 0x02, 0x01, 0x04, 0x0E, 0x05, 0x02, 0x01, 0x06, 0x0D, 0x05, 0x02,
+  0x01, 0x02, 0x05, 0x0C, 0x02, 0x01, 0x01, 0x08, 0x07, 0x01, 0x00, 0x1B,
+  0x01, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x0B, 0x05, 0x17, 0x04, 0x03, 0x00,
+  0x03, 0x0B, 0x05, 0x19, 0x02, 0x03, 0x00, 0x02, 0x0B, 0x05, 0x19, 0x02,
+  0x03, 0x00, 0x01, 0x0B, 0x05, 0x1A, 0x01, 0x03, 0x00, 0x01, 0x0B, 0x05,
+  0x1A, 0x01, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x07, 0x01,
+  0x07, 0x0D, 0x02, 0x00, 0x0D, 0x16, 0x0A, 0x02, 0x02, 0x09, 0x18, 0x06,
+  0x02, 0x04, 0x05, 0x19, 0x04, 0x02, 0x04, 0x05, 0x1A, 0x02, 0x02, 0x04,
+  0x05, 0x1A, 0x02, 0x02, 0x04, 0x05, 0x1A, 0x02, 0x02, 0x04, 0x05, 0x1A,
+  0x02, 0x02, 0x04, 0x05, 0x1A, 0x02, 0x02, 0x04, 0x05, 0x1A, 0x02, 0x02,
+  0x04, 0x05, 0x1A, 0x02, 0x02, 0x04, 0x05, 0x1A, 0x02, 0x02, 0x04, 0x05,
+  0x1A, 0x02, 0x02, 0x04, 0x05, 0x1A, 0x02, 0x02, 0x04, 0x05, 0x1A, 0x02,
+  0x02, 0x04, 0x05, 0x1A, 0x02, 0x02, 0x04, 0x05, 0x1A, 0x02, 0x02, 0x04,
+  0x05, 0x1A, 0x02, 0x02, 0x04, 0x05, 0x1A, 0x02, 0x02, 0x04, 0x05, 0x1A,
+  0x02, 0x02, 0x04, 0x05, 0x1A, 0x02, 0x02, 0x04, 0x05, 0x1A, 0x02, 0x02,
+  0x04, 0x05, 0x1A, 0x02, 0x02, 0x04, 0x05, 0x1A, 0x02, 0x02, 0x04, 0x05,
+  0x1A, 0x02, 0x02, 0x04, 0x05, 0x1A, 0x01, 0x02, 0x05, 0x05, 0x19, 0x02,
+  0x02, 0x05, 0x05, 0x19, 0x02, 0x02, 0x06, 0x05, 0x18, 0x02, 0x02, 0x06,
+  0x06, 0x17, 0x03, 0x02, 0x07, 0x07, 0x15, 0x04, 0x01, 0x09, 0x0E, 0x01,
+  0x0C, 0x09, 0x02, 0x00, 0x0D, 0x17, 0x09, 0x02, 0x02, 0x08, 0x19, 0x06,
+  0x02, 0x04, 0x05, 0x1A, 0x04, 0x02, 0x04, 0x06, 0x1A, 0x03, 0x02, 0x05,
+  0x05, 0x1A, 0x03, 0x02, 0x05, 0x05, 0x1A, 0x02, 0x02, 0x06, 0x05, 0x19,
+  0x03, 0x02, 0x06, 0x05, 0x19, 0x02, 0x02, 0x07, 0x05, 0x19, 0x02, 0x02,
+  0x07, 0x05, 0x18, 0x03, 0x02, 0x07, 0x06, 0x18, 0x02, 0x02, 0x08, 0x05,
+  0x17, 0x03, 0x02, 0x08, 0x05, 0x17, 0x02, 0x02, 0x09, 0x05, 0x17, 0x02,
+  0x02, 0x09, 0x05, 0x16, 0x03, 0x02, 0x0A, 0x05, 0x16, 0x02, 0x02, 0x0A,
+  0x05, 0x15, 0x03, 0x02, 0x0B, 0x05, 0x15, 0x02, 0x02, 0x0B, 0x05, 0x15,
+  0x02, 0x02, 0x0B, 0x06, 0x14, 0x03, 0x02, 0x0C, 0x05, 0x14, 0x02, 0x02,
+  0x0C, 0x05, 0x13, 0x03, 0x02, 0x0D, 0x05, 0x13, 0x02, 0x02, 0x0D, 0x05,
+  0x13, 0x02, 0x01, 0x0E, 0x07, 0x01, 0x0E, 0x06, 0x01, 0x0F, 0x05, 0x01,
+  0x0F, 0x05, 0x01, 0x0F, 0x04, 0x01, 0x10, 0x03, 0x01, 0x10, 0x02, 0x01,
+  0x11, 0x01, 0x03, 0x00, 0x0C, 0x0F, 0x0D, 0x23, 0x09, 0x03, 0x02, 0x07,
+  0x11, 0x08, 0x25, 0x05, 0x03, 0x03, 0x06, 0x12, 0x06, 0x26, 0x03, 0x03,
+  0x04, 0x05, 0x13, 0x05, 0x26, 0x02, 0x03, 0x04, 0x05, 0x13, 0x05, 0x26,
+  0x02, 0x03, 0x05, 0x05, 0x14, 0x05, 0x26, 0x02, 0x03, 0x05, 0x05, 0x14,
+  0x05, 0x25, 0x02, 0x03, 0x06, 0x05, 0x15, 0x05, 0x25, 0x02, 0x03, 0x06,
+  0x05, 0x15, 0x05, 0x25, 0x02, 0x03, 0x06, 0x05, 0x15, 0x05, 0x24, 0x02,
+  0x03, 0x07, 0x05, 0x15, 0x06, 0x24, 0x02, 0x03, 0x07, 0x05, 0x14, 0x07,
+  0x23, 0x03, 0x04, 0x07, 0x05, 0x14, 0x02, 0x17, 0x04, 0x23, 0x02, 0x04,
+  0x08, 0x05, 0x14, 0x02, 0x17, 0x05, 0x23, 0x02, 0x04, 0x08, 0x05, 0x13,
+  0x02, 0x17, 0x05, 0x22, 0x02, 0x04, 0x09, 0x05, 0x13, 0x02, 0x18, 0x05,
+  0x22, 0x02, 0x04, 0x09, 0x05, 0x12, 0x03, 0x18, 0x05, 0x22, 0x02, 0x04,
+  0x09, 0x05, 0x12, 0x02, 0x18, 0x05, 0x21, 0x02, 0x04, 0x0A, 0x05, 0x12,
+  0x02, 0x19, 0x05, 0x21, 0x02, 0x04, 0x0A, 0x05, 0x11, 0x03, 0x19, 0x05,
+  0x20, 0x03, 0x04, 0x0A, 0x05, 0x11, 0x02, 0x1A, 0x05, 0x20, 0x02, 0x04,
+  0x0B, 0x05, 0x11, 0x02, 0x1A, 0x05, 0x20, 0x02, 0x02, 0x0B, 0x08, 0x1A,
+  0x08, 0x02, 0x0B, 0x07, 0x1B, 0x06, 0x02, 0x0C, 0x06, 0x1B, 0x06, 0x02,
+  0x0C, 0x05, 0x1B, 0x06, 0x02, 0x0C, 0x05, 0x1C, 0x04, 0x02, 0x0D, 0x04,
+  0x1C, 0x04, 0x02, 0x0D, 0x03, 0x1D, 0x03, 0x02, 0x0D, 0x03, 0x1D, 0x02,
+  0x02, 0x0E, 0x02, 0x1D, 0x02, 0x02, 0x0E, 0x01, 0x1E, 0x01, 0x02, 0x01,
+  0x0E, 0x16, 0x0B, 0x02, 0x03, 0x09, 0x18, 0x06, 0x02, 0x05, 0x07, 0x19,
+  0x03, 0x02, 0x06, 0x06, 0x18, 0x03, 0x02, 0x07, 0x05, 0x18, 0x02, 0x02,
+  0x08, 0x05, 0x17, 0x03, 0x02, 0x08, 0x06, 0x16, 0x03, 0x02, 0x09, 0x05,
+  0x15, 0x03, 0x02, 0x0A, 0x05, 0x15, 0x02, 0x02, 0x0A, 0x06, 0x14, 0x02,
+  0x02, 0x0B, 0x05, 0x13, 0x03, 0x02, 0x0C, 0x05, 0x12, 0x03, 0x01, 0x0C,
+  0x08, 0x01, 0x0D, 0x06, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x06, 0x01, 0x0E,
+  0x07, 0x01, 0x0D, 0x08, 0x02, 0x0C, 0x03, 0x11, 0x05, 0x02, 0x0C, 0x02,
+  0x11, 0x06, 0x02, 0x0B, 0x02, 0x12, 0x06, 0x02, 0x0A, 0x03, 0x13, 0x05,
+  0x02, 0x09, 0x03, 0x13, 0x06, 0x02, 0x08, 0x03, 0x14, 0x06, 0x02, 0x07,
+  0x03, 0x15, 0x05, 0x02, 0x07, 0x02, 0x15, 0x06, 0x02, 0x06, 0x03, 0x16,
+  0x06, 0x02, 0x05, 0x03, 0x16, 0x07, 0x02, 0x04, 0x04, 0x17, 0x06, 0x02,
+  0x03, 0x06, 0x16, 0x09, 0x02, 0x00, 0x0B, 0x13, 0x0E, 0x02, 0x00, 0x0D,
+  0x16, 0x0A, 0x02, 0x02, 0x09, 0x19, 0x05, 0x02, 0x03, 0x07, 0x19, 0x04,
+  0x02, 0x04, 0x06, 0x19, 0x03, 0x02, 0x05, 0x06, 0x19, 0x02, 0x02, 0x06,
+  0x06, 0x18, 0x03, 0x02, 0x07, 0x05, 0x17, 0x03, 0x02, 0x07, 0x06, 0x17,
+  0x02, 0x02, 0x08, 0x06, 0x16, 0x03, 0x02, 0x09, 0x05, 0x15, 0x03, 0x02,
+  0x09, 0x06, 0x15, 0x02, 0x02, 0x0A, 0x06, 0x14, 0x03, 0x02, 0x0B, 0x05,
+  0x13, 0x03, 0x02, 0x0B, 0x06, 0x13, 0x02, 0x01, 0x0C, 0x09, 0x01, 0x0D,
+  0x07, 0x01, 0x0D, 0x06, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E,
+  0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E,
+  0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E,
+  0x05, 0x01, 0x0E, 0x05, 0x01, 0x0D, 0x07, 0x01, 0x0A, 0x0D, 0x01, 0x02,
+  0x18, 0x01, 0x02, 0x18, 0x02, 0x02, 0x04, 0x14, 0x05, 0x02, 0x01, 0x03,
+  0x13, 0x05, 0x02, 0x01, 0x02, 0x12, 0x06, 0x02, 0x01, 0x02, 0x12, 0x05,
+  0x02, 0x01, 0x01, 0x11, 0x05, 0x02, 0x01, 0x01, 0x10, 0x05, 0x01, 0x0F,
+  0x06, 0x01, 0x0F, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0D, 0x06, 0x01, 0x0C,
+  0x06, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x06, 0x01, 0x09,
+  0x06, 0x01, 0x09, 0x05, 0x01, 0x08, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x05, 0x06, 0x02, 0x04, 0x06, 0x1A, 0x01,
+  0x02, 0x04, 0x05, 0x19, 0x02, 0x02, 0x03, 0x06, 0x19, 0x02, 0x02, 0x02,
+  0x06, 0x18, 0x03, 0x02, 0x01, 0x06, 0x17, 0x03, 0x02, 0x01, 0x05, 0x15,
+  0x05, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x09, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x07,
+  0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x08, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09,
+  0x04, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x04, 0x01, 0x0B,
+  0x03, 0x01, 0x00, 0x09, 0x01, 0x05, 0x04, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x00, 0x09, 0x01, 0x08, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x02, 0x06, 0x04, 0x0B, 0x03,
+  0x02, 0x06, 0x03, 0x0B, 0x03, 0x02, 0x05, 0x04, 0x0B, 0x04, 0x02, 0x05,
+  0x03, 0x0C, 0x03, 0x02, 0x04, 0x04, 0x0C, 0x04, 0x02, 0x04, 0x03, 0x0D,
+  0x03, 0x02, 0x03, 0x04, 0x0D, 0x04, 0x02, 0x03, 0x03, 0x0E, 0x03, 0x02,
+  0x02, 0x04, 0x0E, 0x04, 0x02, 0x02, 0x03, 0x0F, 0x03, 0x02, 0x01, 0x04,
+  0x0F, 0x04, 0x02, 0x01, 0x03, 0x10, 0x03, 0x02, 0x00, 0x04, 0x10, 0x04,
+  0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x03, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x05, 0x01, 0x01, 0x05, 0x01, 0x03, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x06, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x06, 0x02, 0x03, 0x03,
+  0x0A, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x01, 0x04, 0x0C, 0x02,
+  0x02, 0x01, 0x04, 0x0C, 0x03, 0x02, 0x01, 0x04, 0x0C, 0x03, 0x02, 0x02,
+  0x02, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0A, 0x05, 0x02, 0x07, 0x03,
+  0x0C, 0x03, 0x02, 0x05, 0x03, 0x0C, 0x03, 0x02, 0x03, 0x03, 0x0C, 0x03,
+  0x02, 0x02, 0x03, 0x0C, 0x03, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x02, 0x00,
+  0x04, 0x0C, 0x03, 0x02, 0x00, 0x04, 0x0C, 0x03, 0x02, 0x00, 0x04, 0x0C,
+  0x03, 0x02, 0x00, 0x05, 0x0B, 0x04, 0x02, 0x00, 0x06, 0x0A, 0x05, 0x02,
+  0x01, 0x09, 0x0C, 0x06, 0x02, 0x03, 0x05, 0x0D, 0x04, 0x01, 0x05, 0x02,
+  0x01, 0x02, 0x05, 0x01, 0x00, 0x07, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x02, 0x03, 0x04, 0x0A, 0x06, 0x02,
+  0x03, 0x04, 0x08, 0x0A, 0x02, 0x03, 0x06, 0x0D, 0x06, 0x02, 0x03, 0x05,
+  0x0F, 0x04, 0x02, 0x03, 0x04, 0x0F, 0x05, 0x02, 0x03, 0x04, 0x10, 0x04,
+  0x02, 0x03, 0x04, 0x10, 0x05, 0x02, 0x03, 0x04, 0x11, 0x04, 0x02, 0x03,
+  0x04, 0x11, 0x04, 0x02, 0x03, 0x04, 0x11, 0x04, 0x02, 0x03, 0x04, 0x11,
+  0x04, 0x02, 0x03, 0x04, 0x11, 0x04, 0x02, 0x03, 0x04, 0x11, 0x04, 0x02,
+  0x03, 0x04, 0x11, 0x03, 0x02, 0x03, 0x04, 0x11, 0x03, 0x02, 0x03, 0x04,
+  0x10, 0x03, 0x02, 0x03, 0x04, 0x10, 0x03, 0x02, 0x03, 0x04, 0x0F, 0x03,
+  0x02, 0x03, 0x06, 0x0E, 0x03, 0x01, 0x05, 0x0B, 0x01, 0x07, 0x07, 0x01,
+  0x07, 0x07, 0x01, 0x05, 0x0B, 0x02, 0x04, 0x03, 0x0C, 0x05, 0x02, 0x03,
+  0x03, 0x0D, 0x05, 0x02, 0x02, 0x03, 0x0D, 0x05, 0x02, 0x01, 0x03, 0x0E,
+  0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x04, 0x02, 0x00, 0x04, 0x11, 0x02, 0x02, 0x01, 0x04, 0x11, 0x01, 0x02,
+  0x01, 0x05, 0x0F, 0x02, 0x02, 0x02, 0x06, 0x0E, 0x02, 0x01, 0x03, 0x0C,
+  0x01, 0x04, 0x0A, 0x01, 0x06, 0x06, 0x01, 0x11, 0x02, 0x01, 0x0E, 0x05,
+  0x01, 0x0C, 0x07, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04,
+  0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04,
+  0x01, 0x0F, 0x04, 0x02, 0x07, 0x05, 0x0F, 0x04, 0x02, 0x05, 0x09, 0x0F,
+  0x04, 0x02, 0x04, 0x04, 0x0C, 0x07, 0x02, 0x03, 0x03, 0x0E, 0x05, 0x02,
+  0x02, 0x03, 0x0E, 0x05, 0x02, 0x02, 0x03, 0x0F, 0x04, 0x02, 0x01, 0x04,
+  0x0F, 0x04, 0x02, 0x01, 0x03, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04,
+  0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00,
+  0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F,
+  0x04, 0x02, 0x00, 0x05, 0x0F, 0x04, 0x02, 0x01, 0x04, 0x0F, 0x04, 0x02,
+  0x01, 0x05, 0x0F, 0x04, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x06,
+  0x0D, 0x09, 0x02, 0x04, 0x0A, 0x0F, 0x05, 0x02, 0x06, 0x06, 0x0F, 0x02,
+  0x01, 0x06, 0x07, 0x01, 0x04, 0x0A, 0x02, 0x03, 0x03, 0x0B, 0x04, 0x02,
+  0x02, 0x02, 0x0C, 0x04, 0x02, 0x01, 0x03, 0x0C, 0x05, 0x02, 0x01, 0x02,
+  0x0D, 0x04, 0x01, 0x01, 0x10, 0x01, 0x00, 0x11, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x04, 0x02,
+  0x00, 0x04, 0x11, 0x01, 0x02, 0x00, 0x04, 0x11, 0x01, 0x02, 0x01, 0x04,
+  0x10, 0x01, 0x02, 0x01, 0x05, 0x0F, 0x02, 0x02, 0x02, 0x06, 0x0D, 0x03,
+  0x01, 0x02, 0x0D, 0x01, 0x03, 0x0B, 0x01, 0x05, 0x07, 0x01, 0x09, 0x06,
+  0x01, 0x07, 0x0A, 0x02, 0x06, 0x03, 0x0C, 0x05, 0x02, 0x06, 0x02, 0x0E,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x0C, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03,
+  0x06, 0x01, 0x00, 0x0C, 0x01, 0x07, 0x06, 0x01, 0x05, 0x0A, 0x02, 0x04,
+  0x04, 0x0B, 0x0A, 0x02, 0x03, 0x04, 0x0C, 0x09, 0x02, 0x03, 0x03, 0x0D,
+  0x03, 0x02, 0x02, 0x04, 0x0D, 0x04, 0x02, 0x02, 0x04, 0x0E, 0x03, 0x02,
+  0x02, 0x04, 0x0E, 0x03, 0x02, 0x02, 0x04, 0x0E, 0x03, 0x02, 0x02, 0x04,
+  0x0E, 0x03, 0x02, 0x03, 0x04, 0x0E, 0x02, 0x02, 0x03, 0x05, 0x0D, 0x03,
+  0x02, 0x05, 0x04, 0x0C, 0x03, 0x01, 0x06, 0x07, 0x01, 0x05, 0x02, 0x01,
+  0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02, 0x0E, 0x01,
+  0x03, 0x0F, 0x01, 0x04, 0x0F, 0x02, 0x03, 0x02, 0x11, 0x03, 0x02, 0x02,
+  0x02, 0x13, 0x01, 0x02, 0x01, 0x02, 0x13, 0x01, 0x02, 0x01, 0x02, 0x13,
+  0x01, 0x02, 0x00, 0x03, 0x12, 0x01, 0x02, 0x00, 0x03, 0x12, 0x01, 0x02,
+  0x00, 0x04, 0x11, 0x01, 0x02, 0x01, 0x05, 0x0E, 0x03, 0x01, 0x02, 0x0D,
+  0x01, 0x04, 0x08, 0x01, 0x05, 0x02, 0x01, 0x02, 0x05, 0x01, 0x00, 0x07,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x02, 0x03, 0x04, 0x0B, 0x06, 0x02, 0x03, 0x04, 0x09, 0x09, 0x03, 0x03,
+  0x04, 0x08, 0x02, 0x0E, 0x05, 0x02, 0x03, 0x06, 0x0F, 0x04, 0x02, 0x03,
+  0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10,
+  0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02,
+  0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04,
+  0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04,
+  0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03,
+  0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10,
+  0x04, 0x02, 0x02, 0x06, 0x0F, 0x06, 0x02, 0x01, 0x09, 0x0D, 0x09, 0x01,
+  0x04, 0x03, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01,
+  0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x01, 0x01,
+  0x05, 0x03, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x06, 0x01, 0x00, 0x0B, 0x01,
+  0x08, 0x03, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01,
+  0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x01, 0x01,
+  0x09, 0x03, 0x01, 0x06, 0x06, 0x01, 0x05, 0x07, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x03, 0x01, 0x08, 0x03, 0x02, 0x00, 0x03, 0x08, 0x03, 0x02, 0x00,
+  0x04, 0x07, 0x03, 0x01, 0x00, 0x09, 0x01, 0x01, 0x06, 0x01, 0x05, 0x02,
+  0x01, 0x02, 0x05, 0x01, 0x00, 0x07, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x02, 0x03, 0x04, 0x0C, 0x0A, 0x02,
+  0x03, 0x04, 0x0E, 0x05, 0x02, 0x03, 0x04, 0x0E, 0x03, 0x02, 0x03, 0x04,
+  0x0D, 0x02, 0x02, 0x03, 0x04, 0x0C, 0x02, 0x02, 0x03, 0x04, 0x0B, 0x02,
+  0x02, 0x03, 0x04, 0x0A, 0x02, 0x02, 0x03, 0x04, 0x09, 0x02, 0x01, 0x03,
+  0x08, 0x01, 0x03, 0x09, 0x02, 0x03, 0x04, 0x08, 0x04, 0x02, 0x03, 0x04,
+  0x09, 0x04, 0x02, 0x03, 0x04, 0x09, 0x05, 0x02, 0x03, 0x04, 0x0A, 0x05,
+  0x02, 0x03, 0x04, 0x0B, 0x05, 0x02, 0x03, 0x04, 0x0C, 0x04, 0x02, 0x03,
+  0x04, 0x0D, 0x04, 0x02, 0x03, 0x04, 0x0D, 0x05, 0x02, 0x03, 0x04, 0x0E,
+  0x05, 0x02, 0x02, 0x06, 0x0E, 0x07, 0x02, 0x00, 0x0A, 0x0D, 0x0A, 0x01,
+  0x06, 0x02, 0x01, 0x03, 0x05, 0x01, 0x01, 0x07, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x06, 0x01, 0x00, 0x0B, 0x03,
+  0x03, 0x04, 0x0B, 0x05, 0x17, 0x06, 0x03, 0x00, 0x07, 0x09, 0x08, 0x15,
+  0x09, 0x04, 0x02, 0x08, 0x0E, 0x04, 0x13, 0x03, 0x1A, 0x05, 0x03, 0x03,
+  0x05, 0x0E, 0x06, 0x1B, 0x04, 0x03, 0x03, 0x04, 0x0F, 0x04, 0x1C, 0x04,
+  0x03, 0x03, 0x04, 0x0F, 0x04, 0x1C, 0x04, 0x03, 0x03, 0x04, 0x0F, 0x04,
+  0x1C, 0x04, 0x03, 0x03, 0x04, 0x0F, 0x04, 0x1C, 0x04, 0x03, 0x03, 0x04,
+  0x0F, 0x04, 0x1C, 0x04, 0x03, 0x03, 0x04, 0x0F, 0x04, 0x1C, 0x04, 0x03,
+  0x03, 0x04, 0x0F, 0x04, 0x1C, 0x04, 0x03, 0x03, 0x04, 0x0F, 0x04, 0x1C,
+  0x04, 0x03, 0x03, 0x04, 0x0F, 0x04, 0x1C, 0x04, 0x03, 0x03, 0x04, 0x0F,
+  0x04, 0x1C, 0x04, 0x03, 0x03, 0x04, 0x0F, 0x04, 0x1C, 0x04, 0x03, 0x03,
+  0x04, 0x0F, 0x04, 0x1C, 0x04, 0x03, 0x03, 0x04, 0x0F, 0x04, 0x1C, 0x04,
+  0x03, 0x03, 0x04, 0x0F, 0x04, 0x1C, 0x04, 0x03, 0x03, 0x04, 0x0F, 0x04,
+  0x1C, 0x04, 0x03, 0x02, 0x06, 0x0E, 0x06, 0x1B, 0x06, 0x03, 0x00, 0x0A,
+  0x0C, 0x0A, 0x19, 0x0A, 0x02, 0x03, 0x04, 0x0B, 0x06, 0x02, 0x00, 0x07,
+  0x09, 0x09, 0x02, 0x02, 0x08, 0x0E, 0x05, 0x02, 0x03, 0x05, 0x0F, 0x05,
+  0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03,
+  0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10,
+  0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02,
+  0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04,
+  0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04,
+  0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03,
+  0x04, 0x10, 0x04, 0x02, 0x02, 0x06, 0x0F, 0x06, 0x02, 0x01, 0x09, 0x0E,
+  0x08, 0x01, 0x07, 0x08, 0x01, 0x05, 0x0C, 0x02, 0x04, 0x04, 0x0D, 0x05,
+  0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x04, 0x0F, 0x05, 0x02, 0x01,
+  0x04, 0x10, 0x05, 0x02, 0x01, 0x04, 0x10, 0x05, 0x02, 0x00, 0x05, 0x10,
+  0x06, 0x02, 0x00, 0x05, 0x11, 0x05, 0x02, 0x00, 0x05, 0x11, 0x05, 0x02,
+  0x00, 0x05, 0x11, 0x05, 0x02, 0x00, 0x05, 0x11, 0x05, 0x02, 0x00, 0x05,
+  0x11, 0x05, 0x02, 0x00, 0x06, 0x11, 0x04, 0x02, 0x01, 0x05, 0x11, 0x04,
+  0x02, 0x01, 0x06, 0x10, 0x05, 0x02, 0x02, 0x05, 0x10, 0x04, 0x02, 0x03,
+  0x05, 0x0F, 0x04, 0x02, 0x04, 0x05, 0x0E, 0x04, 0x01, 0x05, 0x0C, 0x01,
+  0x08, 0x06, 0x02, 0x04, 0x03, 0x0A, 0x06, 0x02, 0x00, 0x07, 0x08, 0x0A,
+  0x02, 0x03, 0x06, 0x0E, 0x05, 0x02, 0x03, 0x05, 0x0F, 0x05, 0x02, 0x03,
+  0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x05, 0x02, 0x03, 0x04, 0x10,
+  0x05, 0x02, 0x03, 0x04, 0x11, 0x04, 0x02, 0x03, 0x04, 0x11, 0x04, 0x02,
+  0x03, 0x04, 0x11, 0x04, 0x02, 0x03, 0x04, 0x11, 0x04, 0x02, 0x03, 0x04,
+  0x11, 0x04, 0x02, 0x03, 0x04, 0x11, 0x04, 0x02, 0x03, 0x04, 0x11, 0x03,
+  0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x03,
+  0x04, 0x10, 0x03, 0x02, 0x03, 0x05, 0x0F, 0x03, 0x02, 0x03, 0x06, 0x0E,
+  0x03, 0x02, 0x03, 0x04, 0x08, 0x08, 0x02, 0x03, 0x04, 0x09, 0x05, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01,
+  0x02, 0x06, 0x01, 0x00, 0x0B, 0x02, 0x07, 0x06, 0x12, 0x01, 0x02, 0x05,
+  0x0A, 0x11, 0x02, 0x02, 0x04, 0x04, 0x0D, 0x06, 0x02, 0x03, 0x04, 0x0E,
+  0x05, 0x02, 0x02, 0x04, 0x0F, 0x04, 0x02, 0x02, 0x03, 0x0F, 0x04, 0x02,
+  0x01, 0x04, 0x0F, 0x04, 0x02, 0x01, 0x03, 0x0F, 0x04, 0x02, 0x00, 0x04,
+  0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04,
+  0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00,
+  0x04, 0x0F, 0x04, 0x02, 0x00, 0x05, 0x0F, 0x04, 0x02, 0x00, 0x05, 0x0F,
+  0x04, 0x02, 0x01, 0x05, 0x0F, 0x04, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x02,
+  0x02, 0x06, 0x0D, 0x06, 0x02, 0x03, 0x0A, 0x0F, 0x04, 0x02, 0x05, 0x06,
+  0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01,
+  0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01,
+  0x0F, 0x04, 0x01, 0x0D, 0x07, 0x01, 0x0B, 0x0A, 0x02, 0x05, 0x02, 0x0A,
+  0x04, 0x02, 0x01, 0x06, 0x09, 0x06, 0x04, 0x00, 0x01, 0x02, 0x05, 0x08,
+  0x01, 0x0B, 0x04, 0x02, 0x03, 0x05, 0x0C, 0x03, 0x01, 0x03, 0x04, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x06, 0x01, 0x00, 0x0A, 0x02,
+  0x03, 0x06, 0x0B, 0x01, 0x02, 0x02, 0x02, 0x08, 0x04, 0x02, 0x01, 0x02,
+  0x09, 0x03, 0x02, 0x00, 0x03, 0x0A, 0x02, 0x02, 0x00, 0x03, 0x0A, 0x02,
+  0x02, 0x00, 0x03, 0x0B, 0x01, 0x02, 0x00, 0x04, 0x0B, 0x01, 0x01, 0x00,
+  0x06, 0x01, 0x01, 0x06, 0x01, 0x02, 0x07, 0x01, 0x03, 0x07, 0x01, 0x05,
+  0x07, 0x01, 0x06, 0x06, 0x01, 0x08, 0x05, 0x02, 0x00, 0x01, 0x09, 0x04,
+  0x02, 0x00, 0x01, 0x0A, 0x03, 0x02, 0x00, 0x02, 0x0A, 0x03, 0x02, 0x00,
+  0x02, 0x0A, 0x03, 0x02, 0x00, 0x03, 0x0A, 0x02, 0x02, 0x00, 0x04, 0x09,
+  0x02, 0x02, 0x00, 0x01, 0x04, 0x05, 0x01, 0x05, 0x01, 0x01, 0x04, 0x02,
+  0x01, 0x04, 0x02, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x01, 0x09,
+  0x01, 0x00, 0x0A, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x02, 0x02, 0x05, 0x0A, 0x01, 0x01, 0x03, 0x07, 0x01,
+  0x04, 0x05, 0x02, 0x00, 0x06, 0x0C, 0x07, 0x02, 0x01, 0x05, 0x0E, 0x05,
+  0x02, 0x02, 0x04, 0x0F, 0x04, 0x02, 0x02, 0x04, 0x0F, 0x04, 0x02, 0x02,
+  0x04, 0x0F, 0x04, 0x02, 0x02, 0x04, 0x0F, 0x04, 0x02, 0x02, 0x04, 0x0F,
+  0x04, 0x02, 0x02, 0x04, 0x0F, 0x04, 0x02, 0x02, 0x04, 0x0F, 0x04, 0x02,
+  0x02, 0x04, 0x0F, 0x04, 0x02, 0x02, 0x04, 0x0F, 0x04, 0x02, 0x02, 0x04,
+  0x0F, 0x04, 0x02, 0x02, 0x04, 0x0F, 0x04, 0x02, 0x02, 0x04, 0x0F, 0x04,
+  0x02, 0x02, 0x04, 0x0F, 0x04, 0x02, 0x02, 0x04, 0x0F, 0x04, 0x02, 0x02,
+  0x04, 0x0F, 0x04, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x03, 0x05, 0x0C,
+  0x08, 0x02, 0x04, 0x09, 0x0F, 0x07, 0x02, 0x05, 0x06, 0x0F, 0x03, 0x02,
+  0x00, 0x09, 0x0F, 0x07, 0x02, 0x02, 0x06, 0x11, 0x03, 0x02, 0x03, 0x04,
+  0x11, 0x03, 0x02, 0x03, 0x04, 0x11, 0x02, 0x02, 0x04, 0x04, 0x11, 0x02,
+  0x02, 0x04, 0x04, 0x11, 0x01, 0x02, 0x05, 0x04, 0x10, 0x02, 0x02, 0x05,
+  0x04, 0x10, 0x02, 0x02, 0x05, 0x04, 0x0F, 0x02, 0x02, 0x06, 0x04, 0x0F,
+  0x02, 0x02, 0x06, 0x04, 0x0F, 0x01, 0x02, 0x07, 0x04, 0x0E, 0x02, 0x02,
+  0x07, 0x04, 0x0E, 0x02, 0x02, 0x08, 0x03, 0x0D, 0x02, 0x02, 0x08, 0x04,
+  0x0D, 0x02, 0x02, 0x08, 0x04, 0x0D, 0x01, 0x01, 0x09, 0x05, 0x01, 0x09,
+  0x05, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x02, 0x01, 0x0B,
+  0x01, 0x03, 0x00, 0x09, 0x0C, 0x09, 0x1A, 0x06, 0x03, 0x01, 0x06, 0x0D,
+  0x06, 0x1C, 0x03, 0x03, 0x02, 0x05, 0x0E, 0x04, 0x1C, 0x02, 0x03, 0x03,
+  0x04, 0x0E, 0x05, 0x1C, 0x02, 0x03, 0x03, 0x04, 0x0F, 0x04, 0x1C, 0x02,
+  0x03, 0x03, 0x04, 0x0F, 0x04, 0x1B, 0x02, 0x03, 0x04, 0x04, 0x10, 0x04,
+  0x1B, 0x02, 0x03, 0x04, 0x04, 0x0F, 0x05, 0x1B, 0x01, 0x03, 0x05, 0x04,
+  0x0F, 0x05, 0x1A, 0x02, 0x04, 0x05, 0x04, 0x0F, 0x01, 0x11, 0x04, 0x1A,
+  0x02, 0x04, 0x05, 0x04, 0x0E, 0x02, 0x11, 0x04, 0x19, 0x02, 0x04, 0x06,
+  0x04, 0x0E, 0x02, 0x12, 0x03, 0x19, 0x02, 0x04, 0x06, 0x04, 0x0D, 0x02,
+  0x12, 0x04, 0x19, 0x01, 0x04, 0x07, 0x03, 0x0D, 0x02, 0x12, 0x04, 0x18,
+  0x02, 0x04, 0x07, 0x04, 0x0C, 0x02, 0x13, 0x04, 0x18, 0x02, 0x03, 0x07,
+  0x04, 0x0C, 0x02, 0x13, 0x06, 0x02, 0x08, 0x05, 0x14, 0x05, 0x02, 0x08,
+  0x05, 0x14, 0x04, 0x02, 0x09, 0x03, 0x14, 0x04, 0x02, 0x09, 0x03, 0x15,
+  0x03, 0x02, 0x09, 0x02, 0x15, 0x02, 0x02, 0x0A, 0x01, 0x16, 0x01, 0x02,
+  0x01, 0x0A, 0x0D, 0x07, 0x02, 0x03, 0x06, 0x0E, 0x04, 0x02, 0x04, 0x05,
+  0x0E, 0x03, 0x02, 0x05, 0x04, 0x0E, 0x02, 0x02, 0x05, 0x05, 0x0D, 0x02,
+  0x02, 0x06, 0x04, 0x0C, 0x02, 0x02, 0x07, 0x04, 0x0C, 0x02, 0x01, 0x07,
+  0x06, 0x01, 0x08, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x05, 0x01, 0x08,
+  0x06, 0x02, 0x08, 0x02, 0x0B, 0x04, 0x02, 0x07, 0x02, 0x0B, 0x05, 0x02,
+  0x06, 0x02, 0x0C, 0x04, 0x02, 0x05, 0x03, 0x0D, 0x04, 0x02, 0x05, 0x02,
+  0x0D, 0x05, 0x02, 0x04, 0x02, 0x0E, 0x04, 0x02, 0x03, 0x03, 0x0F, 0x04,
+  0x02, 0x02, 0x04, 0x0E, 0x06, 0x02, 0x00, 0x07, 0x0D, 0x09, 0x02, 0x00,
+  0x0A, 0x10, 0x06, 0x02, 0x02, 0x06, 0x11, 0x04, 0x02, 0x03, 0x04, 0x12,
+  0x02, 0x02, 0x03, 0x04, 0x11, 0x02, 0x02, 0x04, 0x04, 0x11, 0x02, 0x02,
+  0x04, 0x04, 0x11, 0x02, 0x02, 0x05, 0x04, 0x10, 0x02, 0x02, 0x05, 0x04,
+  0x10, 0x02, 0x02, 0x06, 0x04, 0x10, 0x02, 0x02, 0x06, 0x04, 0x0F, 0x02,
+  0x02, 0x06, 0x05, 0x0F, 0x02, 0x02, 0x07, 0x04, 0x0F, 0x01, 0x02, 0x07,
+  0x05, 0x0E, 0x02, 0x02, 0x08, 0x04, 0x0E, 0x02, 0x01, 0x08, 0x07, 0x01,
+  0x09, 0x06, 0x01, 0x09, 0x05, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01,
+  0x0B, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x0B, 0x01, 0x01, 0x0A, 0x02, 0x01,
+  0x0A, 0x02, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02, 0x01, 0x08, 0x02, 0x01,
+  0x02, 0x08, 0x01, 0x01, 0x08, 0x01, 0x01, 0x07, 0x01, 0x02, 0x05, 0x01,
+  0x01, 0x10, 0x01, 0x01, 0x10, 0x02, 0x01, 0x02, 0x0C, 0x04, 0x02, 0x01,
+  0x01, 0x0B, 0x04, 0x02, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x07, 0x04, 0x01,
+  0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x02,
+  0x03, 0x05, 0x11, 0x01, 0x02, 0x03, 0x04, 0x11, 0x01, 0x02, 0x02, 0x05,
+  0x10, 0x02, 0x02, 0x01, 0x05, 0x10, 0x02, 0x02, 0x01, 0x04, 0x0F, 0x03,
+  0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x07, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x00, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x03, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x05, 0x03, 0x01, 0x06, 0x04, 0x01, 0x08, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x01, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x04, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x05, 0x03, 0x01, 0x06, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x03, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x03, 0x06, 0x02, 0x02, 0x09, 0x12, 0x02, 0x03, 0x01, 0x03, 0x08,
+  0x05, 0x11, 0x04, 0x02, 0x00, 0x03, 0x0A, 0x0A, 0x01, 0x0D, 0x05 };
+
+const GFXglyph FreeSerif24pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,  12,    0,    1 },   // 0x20 ' '
+  {     0,   5,  32,  16,    6,  -31 },   // 0x21 '!'
+  {    90,  12,  12,  19,    4,  -31 },   // 0x22 '"'
+  {   150,  23,  31,  23,    0,  -30 },   // 0x23 '#'
+  {   297,  19,  37,  24,    2,  -33 },   // 0x24 '$'
+  {   478,  33,  32,  39,    3,  -30 },   // 0x25 '%'
+  {   702,  32,  33,  37,    2,  -31 },   // 0x26 '&'
+  {   889,   4,  12,   9,    3,  -31 },   // 0x27 '''
+  {   925,  12,  40,  16,    2,  -31 },   // 0x28 '('
+  {  1045,  12,  40,  16,    2,  -30 },   // 0x29 ')'
+  {  1165,  16,  19,  24,    4,  -30 },   // 0x2A '*'
+  {  1258,  23,  23,  27,    2,  -22 },   // 0x2B '+'
+  {  1327,   6,  11,  12,    2,   -4 },   // 0x2C ','
+  {  1360,  11,   2,  16,    2,  -10 },   // 0x2D '-'
+  {  1366,   5,   5,  12,    3,   -3 },   // 0x2E '.'
+  {  1381,  14,  32,  14,    0,  -30 },   // 0x2F '/'
+  {  1477,  22,  33,  23,    1,  -31 },   // 0x30 '0'
+  {  1638,  13,  32,  24,    5,  -31 },   // 0x31 '1'
+  {  1736,  21,  31,  23,    1,  -30 },   // 0x32 '2'
+  {  1847,  18,  32,  23,    2,  -30 },   // 0x33 '3'
+  {  1957,  21,  31,  24,    1,  -30 },   // 0x34 '4'
+  {  2080,  19,  33,  24,    2,  -31 },   // 0x35 '5'
+  {  2183,  21,  33,  23,    2,  -31 },   // 0x36 '6'
+  {  2320,  20,  31,  24,    1,  -30 },   // 0x37 '7'
+  {  2421,  18,  33,  23,    3,  -31 },   // 0x38 '8'
+  {  2570,  21,  33,  24,    1,  -31 },   // 0x39 '9'
+  {  2707,   5,  22,  12,    4,  -20 },   // 0x3A ':'
+  {  2749,   6,  27,  12,    3,  -20 },   // 0x3B ';'
+  {  2808,  24,  25,  27,    1,  -24 },   // 0x3C '<'
+  {  2881,  24,  11,  27,    1,  -16 },   // 0x3D '='
+  {  2900,  24,  25,  27,    2,  -23 },   // 0x3E '>'
+  {  2973,  17,  32,  21,    3,  -31 },   // 0x3F '?'
+  {  3077,  32,  33,  41,    4,  -31 },   // 0x40 '@'
+  {  3290,  32,  32,  34,    1,  -31 },   // 0x41 'A'
+  {  3432,  27,  31,  30,    0,  -30 },   // 0x42 'B'
+  {  3575,  28,  33,  31,    2,  -31 },   // 0x43 'C'
+  {  3704,  31,  31,  34,    1,  -30 },   // 0x44 'D'
+  {  3851,  27,  31,  29,    2,  -30 },   // 0x45 'E'
+  {  3980,  24,  31,  27,    2,  -30 },   // 0x46 'F'
+  {  4097,  31,  33,  35,    2,  -31 },   // 0x47 'G'
+  {  4246,  30,  31,  34,    2,  -30 },   // 0x48 'H'
+  {  4397,  13,  31,  15,    1,  -30 },   // 0x49 'I'
+  {  4490,  17,  32,  18,    0,  -30 },   // 0x4A 'J'
+  {  4592,  32,  31,  33,    1,  -30 },   // 0x4B 'K'
+  {  4743,  26,  31,  29,    2,  -30 },   // 0x4C 'L'
+  {  4848,  39,  31,  41,    1,  -30 },   // 0x4D 'M'
+  {  5089,  32,  32,  34,    1,  -30 },   // 0x4E 'N'
+  {  5279,  30,  33,  34,    2,  -31 },   // 0x4F 'O'
+  {  5436,  23,  31,  27,    2,  -30 },   // 0x50 'P'
+  {  5557,  31,  40,  34,    2,  -31 },   // 0x51 'Q'
+  {  5735,  28,  31,  31,    2,  -30 },   // 0x52 'R'
+  {  5882,  21,  33,  25,    2,  -31 },   // 0x53 'S'
+  {  6021,  27,  31,  28,    1,  -30 },   // 0x54 'T'
+  {  6134,  32,  32,  34,    1,  -30 },   // 0x55 'U'
+  {  6290,  32,  32,  33,    0,  -30 },   // 0x56 'V'
+  {  6434,  44,  32,  45,    0,  -30 },   // 0x57 'W'
+  {  6658,  33,  31,  34,    0,  -30 },   // 0x58 'X'
+  {  6801,  32,  31,  33,    0,  -30 },   // 0x59 'Y'
+  {  6922,  27,  31,  29,    1,  -30 },   // 0x5A 'Z'
+  {  7039,   9,  38,  16,    4,  -30 },   // 0x5B '['
+  {  7153,  14,  32,  14,    0,  -30 },   // 0x5C '\'
+  {  7249,   9,  38,  16,    3,  -30 },   // 0x5D ']'
+  {  7363,  20,  17,  22,    1,  -30 },   // 0x5E '^'
+  {  7440,  24,   2,  23,    0,    5 },   // 0x5F '_'
+  {  7446,  10,   8,  12,    1,  -31 },   // 0x60 '`'
+  {  7470,  18,  21,  20,    1,  -20 },   // 0x61 'a'
+  {  7569,  21,  32,  24,    1,  -31 },   // 0x62 'b'
+  {  7703,  19,  21,  21,    1,  -20 },   // 0x63 'c'
+  {  7782,  22,  32,  23,    1,  -31 },   // 0x64 'd'
+  {  7920,  18,  21,  21,    1,  -20 },   // 0x65 'e'
+  {  8001,  17,  33,  18,    0,  -32 },   // 0x66 'f'
+  {  8104,  21,  31,  22,    1,  -20 },   // 0x67 'g'
+  {  8235,  22,  32,  23,    0,  -31 },   // 0x68 'h'
+  {  8375,  11,  32,  13,    0,  -31 },   // 0x69 'i'
+  {  8459,  12,  42,  16,    0,  -31 },   // 0x6A 'j'
+  {  8577,  23,  32,  24,    1,  -31 },   // 0x6B 'k'
+  {  8711,  11,  32,  12,    0,  -31 },   // 0x6C 'l'
+  {  8807,  35,  21,  37,    1,  -20 },   // 0x6D 'm'
+  {  8956,  22,  21,  23,    0,  -20 },   // 0x6E 'n'
+  {  9061,  22,  21,  23,    1,  -20 },   // 0x6F 'o'
+  {  9158,  21,  31,  24,    1,  -20 },   // 0x70 'p'
+  {  9293,  21,  31,  23,    1,  -20 },   // 0x71 'q'
+  {  9428,  15,  21,  16,    1,  -20 },   // 0x72 'r'
+  {  9503,  13,  21,  17,    2,  -20 },   // 0x73 's'
+  {  9594,  12,  26,  13,    1,  -25 },   // 0x74 't'
+  {  9674,  22,  21,  23,    1,  -20 },   // 0x75 'u'
+  {  9779,  22,  22,  22,    0,  -20 },   // 0x76 'v'
+  {  9877,  32,  22,  32,    0,  -20 },   // 0x77 'w'
+  { 10031,  22,  21,  23,    0,  -20 },   // 0x78 'x'
+  { 10126,  22,  31,  22,    0,  -20 },   // 0x79 'y'
+  { 10247,  18,  21,  20,    1,  -20 },   // 0x7A 'z'
+  { 10326,  11,  41,  23,    5,  -31 },   // 0x7B '{'
+  { 10449,   3,  32,   9,    3,  -30 },   // 0x7C '|'
+  { 10545,  11,  41,  23,    7,  -31 },   // 0x7D '}'
+  { 10668,  22,   5,  23,    1,  -13 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSerif24pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSerif24pt7bSpanData,
+    (GFXglyph *)FreeSerif24pt7bSpanGlyphs,
+    0x20, 0x7E, 56 } };
+
+// Approx. 11475 bytes
@@ -0,0 +1,787 @@
+// FreeSerifBold18pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSerifBold18pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSerifBold18pt7bSpanData[] PROGMEM = {
+  0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02, 0x02,
+  0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x06, 0x01, 0x01, 0x03, 0x02, 0x01, 0x02, 0x0A, 0x02, 0x02,
+  0x00, 0x04, 0x09, 0x04, 0x02, 0x00, 0x04, 0x09, 0x04, 0x02, 0x00, 0x04,
+  0x09, 0x04, 0x02, 0x00, 0x04, 0x09, 0x04, 0x02, 0x01, 0x03, 0x09, 0x04,
+  0x02, 0x01, 0x03, 0x0A, 0x02, 0x02, 0x01, 0x02, 0x0A, 0x02, 0x02, 0x02,
+  0x01, 0x0A, 0x02, 0x02, 0x02, 0x01, 0x0A, 0x02, 0x02, 0x06, 0x03, 0x0C,
+  0x03, 0x02, 0x06, 0x02, 0x0C, 0x03, 0x02, 0x06, 0x02, 0x0C, 0x03, 0x02,
+  0x05, 0x03, 0x0C, 0x03, 0x02, 0x05, 0x03, 0x0C, 0x03, 0x02, 0x05, 0x03,
+  0x0C, 0x03, 0x01, 0x01, 0x11, 0x01, 0x01, 0x11, 0x01, 0x01, 0x11, 0x02,
+  0x05, 0x02, 0x0B, 0x03, 0x02, 0x04, 0x03, 0x0B, 0x03, 0x02, 0x04, 0x03,
+  0x0B, 0x03, 0x02, 0x04, 0x03, 0x0B, 0x03, 0x02, 0x04, 0x03, 0x0B, 0x02,
+  0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x02, 0x03, 0x03,
+  0x0A, 0x03, 0x02, 0x03, 0x03, 0x0A, 0x03, 0x02, 0x03, 0x03, 0x0A, 0x03,
+  0x02, 0x03, 0x03, 0x0A, 0x02, 0x02, 0x03, 0x03, 0x0A, 0x02, 0x02, 0x03,
+  0x02, 0x09, 0x03, 0x02, 0x03, 0x02, 0x09, 0x03, 0x01, 0x06, 0x01, 0x01,
+  0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x03, 0x08, 0x03, 0x02, 0x02, 0x06,
+  0x01, 0x09, 0x04, 0x03, 0x01, 0x02, 0x06, 0x01, 0x0A, 0x03, 0x03, 0x00,
+  0x03, 0x06, 0x01, 0x0B, 0x02, 0x03, 0x00, 0x03, 0x06, 0x01, 0x0B, 0x02,
+  0x03, 0x00, 0x04, 0x06, 0x01, 0x0C, 0x01, 0x02, 0x00, 0x05, 0x06, 0x01,
+  0x01, 0x00, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x09, 0x01, 0x03, 0x08,
+  0x01, 0x04, 0x09, 0x01, 0x06, 0x08, 0x01, 0x06, 0x08, 0x02, 0x06, 0x01,
+  0x09, 0x06, 0x02, 0x06, 0x01, 0x0A, 0x05, 0x03, 0x01, 0x01, 0x06, 0x01,
+  0x0B, 0x04, 0x03, 0x01, 0x01, 0x06, 0x01, 0x0B, 0x04, 0x03, 0x01, 0x02,
+  0x06, 0x01, 0x0B, 0x04, 0x03, 0x01, 0x02, 0x06, 0x01, 0x0A, 0x04, 0x03,
+  0x01, 0x04, 0x06, 0x01, 0x09, 0x04, 0x01, 0x02, 0x0A, 0x01, 0x04, 0x05,
+  0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x02, 0x06, 0x04, 0x13, 0x02, 0x02,
+  0x04, 0x08, 0x11, 0x04, 0x02, 0x03, 0x05, 0x0A, 0x0A, 0x03, 0x02, 0x05,
+  0x0B, 0x05, 0x12, 0x01, 0x03, 0x01, 0x05, 0x0B, 0x01, 0x11, 0x02, 0x03,
+  0x01, 0x04, 0x0B, 0x01, 0x10, 0x02, 0x03, 0x00, 0x05, 0x0B, 0x01, 0x10,
+  0x02, 0x03, 0x00, 0x04, 0x0A, 0x02, 0x0F, 0x02, 0x03, 0x00, 0x04, 0x0A,
+  0x01, 0x0F, 0x02, 0x03, 0x00, 0x04, 0x09, 0x02, 0x0E, 0x02, 0x04, 0x00,
+  0x04, 0x09, 0x01, 0x0D, 0x02, 0x15, 0x04, 0x04, 0x01, 0x04, 0x07, 0x03,
+  0x0D, 0x02, 0x13, 0x07, 0x04, 0x01, 0x08, 0x0C, 0x02, 0x12, 0x05, 0x19,
+  0x02, 0x04, 0x03, 0x04, 0x0C, 0x02, 0x11, 0x05, 0x1A, 0x01, 0x03, 0x0B,
+  0x02, 0x10, 0x05, 0x1A, 0x01, 0x03, 0x0A, 0x02, 0x10, 0x04, 0x1A, 0x01,
+  0x03, 0x0A, 0x02, 0x0F, 0x05, 0x1A, 0x01, 0x03, 0x09, 0x02, 0x0F, 0x05,
+  0x1A, 0x01, 0x03, 0x09, 0x02, 0x0F, 0x04, 0x19, 0x01, 0x03, 0x08, 0x02,
+  0x0F, 0x04, 0x18, 0x02, 0x03, 0x07, 0x02, 0x0F, 0x04, 0x18, 0x01, 0x03,
+  0x07, 0x02, 0x0F, 0x04, 0x16, 0x03, 0x02, 0x06, 0x02, 0x10, 0x08, 0x02,
+  0x06, 0x02, 0x11, 0x05, 0x01, 0x09, 0x06, 0x01, 0x07, 0x0A, 0x02, 0x06,
+  0x03, 0x0C, 0x05, 0x02, 0x05, 0x04, 0x0D, 0x05, 0x02, 0x05, 0x04, 0x0E,
+  0x04, 0x02, 0x05, 0x05, 0x0E, 0x04, 0x02, 0x05, 0x05, 0x0E, 0x03, 0x02,
+  0x05, 0x06, 0x0D, 0x03, 0x01, 0x06, 0x08, 0x02, 0x06, 0x07, 0x12, 0x08,
+  0x02, 0x06, 0x07, 0x14, 0x04, 0x02, 0x05, 0x09, 0x15, 0x02, 0x03, 0x03,
+  0x03, 0x08, 0x07, 0x14, 0x02, 0x03, 0x02, 0x03, 0x09, 0x07, 0x14, 0x02,
+  0x03, 0x01, 0x04, 0x09, 0x07, 0x13, 0x02, 0x03, 0x01, 0x04, 0x0A, 0x07,
+  0x13, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x09, 0x02, 0x00, 0x06, 0x0B, 0x08,
+  0x02, 0x00, 0x06, 0x0C, 0x07, 0x02, 0x00, 0x07, 0x0D, 0x07, 0x03, 0x00,
+  0x07, 0x0D, 0x08, 0x18, 0x01, 0x02, 0x01, 0x08, 0x0C, 0x0D, 0x02, 0x01,
+  0x0C, 0x0F, 0x09, 0x02, 0x02, 0x0A, 0x10, 0x07, 0x02, 0x04, 0x05, 0x12,
+  0x04, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x08, 0x01, 0x01, 0x06,
+  0x02, 0x01, 0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03,
+  0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x04,
+  0x02, 0x01, 0x05, 0x01, 0x01, 0x06, 0x01, 0x01, 0x07, 0x01, 0x01, 0x08,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x06, 0x02, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x04, 0x03, 0x01, 0x03, 0x05, 0x04, 0x0B, 0x02, 0x03,
+  0x00, 0x05, 0x06, 0x02, 0x0A, 0x04, 0x03, 0x01, 0x04, 0x06, 0x02, 0x09,
+  0x05, 0x01, 0x02, 0x0A, 0x01, 0x05, 0x03, 0x01, 0x01, 0x0B, 0x03, 0x00,
+  0x05, 0x06, 0x02, 0x09, 0x05, 0x03, 0x00, 0x04, 0x06, 0x02, 0x0A, 0x04,
+  0x03, 0x01, 0x02, 0x05, 0x04, 0x0B, 0x02, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x04, 0x01, 0x06, 0x02, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x08, 0x03, 0x01, 0x00, 0x13, 0x01, 0x00, 0x13, 0x01, 0x00,
+  0x13, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x06, 0x01, 0x00,
+  0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x05, 0x01, 0x04, 0x02, 0x01, 0x04,
+  0x01, 0x01, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00,
+  0x08, 0x01, 0x01, 0x04, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00,
+  0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x04, 0x01, 0x08, 0x03, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x06,
+  0x04, 0x02, 0x04, 0x03, 0x09, 0x03, 0x02, 0x03, 0x04, 0x09, 0x04, 0x02,
+  0x02, 0x04, 0x0A, 0x04, 0x02, 0x02, 0x04, 0x0A, 0x04, 0x02, 0x01, 0x05,
+  0x0A, 0x05, 0x02, 0x01, 0x05, 0x0A, 0x05, 0x02, 0x01, 0x05, 0x0A, 0x05,
+  0x02, 0x00, 0x06, 0x0A, 0x06, 0x02, 0x00, 0x06, 0x0A, 0x06, 0x02, 0x00,
+  0x06, 0x0A, 0x06, 0x02, 0x00, 0x06, 0x0A, 0x06, 0x02, 0x00, 0x06, 0x0A,
+  0x06, 0x02, 0x00, 0x06, 0x0A, 0x06, 0x02, 0x00, 0x06, 0x0A, 0x06, 0x02,
+  0x00, 0x06, 0x0A, 0x06, 0x02, 0x00, 0x06, 0x0A, 0x05, 0x02, 0x01, 0x05,
+  0x0A, 0x05, 0x02, 0x01, 0x05, 0x0A, 0x05, 0x02, 0x02, 0x04, 0x0A, 0x04,
+  0x02, 0x02, 0x04, 0x0A, 0x04, 0x02, 0x03, 0x04, 0x09, 0x04, 0x02, 0x04,
+  0x03, 0x09, 0x03, 0x01, 0x06, 0x04, 0x01, 0x08, 0x02, 0x01, 0x06, 0x04,
+  0x01, 0x04, 0x06, 0x01, 0x02, 0x08, 0x02, 0x01, 0x01, 0x04, 0x06, 0x01,
+  0x04, 0x06, 0x01, 0x04, 0x06, 0x01, 0x04, 0x06, 0x01, 0x04, 0x06, 0x01,
+  0x04, 0x06, 0x01, 0x04, 0x06, 0x01, 0x04, 0x06, 0x01, 0x04, 0x06, 0x01,
+  0x04, 0x06, 0x01, 0x04, 0x06, 0x01, 0x04, 0x06, 0x01, 0x04, 0x06, 0x01,
+  0x04, 0x06, 0x01, 0x04, 0x06, 0x01, 0x04, 0x06, 0x01, 0x04, 0x06, 0x01,
+  0x04, 0x06, 0x01, 0x03, 0x08, 0x01, 0x00, 0x0C, 0x01, 0x06, 0x05, 0x01,
+  0x04, 0x09, 0x01, 0x03, 0x0B, 0x01, 0x02, 0x0C, 0x02, 0x02, 0x02, 0x08,
+  0x07, 0x02, 0x01, 0x02, 0x09, 0x06, 0x02, 0x01, 0x01, 0x0A, 0x05, 0x01,
+  0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x02, 0x01,
+  0x07, 0x02, 0x01, 0x06, 0x02, 0x02, 0x05, 0x02, 0x0F, 0x01, 0x02, 0x04,
+  0x02, 0x0E, 0x02, 0x01, 0x03, 0x0D, 0x01, 0x03, 0x0D, 0x01, 0x02, 0x0D,
+  0x01, 0x01, 0x0E, 0x01, 0x00, 0x0F, 0x01, 0x06, 0x06, 0x01, 0x04, 0x09,
+  0x01, 0x02, 0x0C, 0x02, 0x02, 0x01, 0x07, 0x08, 0x02, 0x01, 0x01, 0x08,
+  0x07, 0x01, 0x09, 0x06, 0x01, 0x09, 0x06, 0x01, 0x09, 0x05, 0x01, 0x09,
+  0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x07, 0x01, 0x06, 0x09, 0x01, 0x09,
+  0x06, 0x01, 0x0A, 0x06, 0x01, 0x0B, 0x05, 0x01, 0x0C, 0x04, 0x01, 0x0C,
+  0x04, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x03, 0x02, 0x01, 0x03, 0x0C, 0x03,
+  0x02, 0x00, 0x06, 0x0B, 0x03, 0x02, 0x00, 0x07, 0x0A, 0x03, 0x01, 0x01,
+  0x0A, 0x01, 0x02, 0x07, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x04, 0x01, 0x08,
+  0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x06, 0x02, 0x06, 0x01, 0x08, 0x05,
+  0x02, 0x06, 0x01, 0x08, 0x05, 0x02, 0x05, 0x01, 0x08, 0x05, 0x02, 0x04,
+  0x01, 0x08, 0x05, 0x02, 0x03, 0x02, 0x08, 0x05, 0x02, 0x03, 0x01, 0x08,
+  0x05, 0x02, 0x02, 0x01, 0x08, 0x05, 0x02, 0x01, 0x01, 0x08, 0x05, 0x02,
+  0x01, 0x01, 0x08, 0x05, 0x02, 0x00, 0x01, 0x08, 0x05, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x08, 0x05,
+  0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05,
+  0x01, 0x04, 0x0B, 0x01, 0x04, 0x0A, 0x01, 0x03, 0x0B, 0x01, 0x03, 0x0B,
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02,
+  0x01, 0x02, 0x07, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x0C,
+  0x01, 0x02, 0x0B, 0x01, 0x07, 0x07, 0x01, 0x0A, 0x04, 0x01, 0x0B, 0x03,
+  0x01, 0x0B, 0x03, 0x01, 0x0C, 0x02, 0x01, 0x0C, 0x02, 0x02, 0x00, 0x04,
+  0x0C, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x02, 0x02, 0x00, 0x07, 0x0A, 0x02,
+  0x01, 0x00, 0x0B, 0x01, 0x02, 0x06, 0x01, 0x0D, 0x03, 0x01, 0x09, 0x05,
+  0x01, 0x07, 0x05, 0x01, 0x06, 0x04, 0x01, 0x04, 0x05, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x05, 0x01, 0x02, 0x05, 0x01, 0x01, 0x06, 0x01, 0x01, 0x0B,
+  0x01, 0x01, 0x0D, 0x02, 0x00, 0x06, 0x09, 0x06, 0x02, 0x00, 0x06, 0x09,
+  0x06, 0x02, 0x00, 0x06, 0x0A, 0x06, 0x02, 0x00, 0x06, 0x0A, 0x06, 0x02,
+  0x00, 0x06, 0x0A, 0x06, 0x02, 0x00, 0x06, 0x0A, 0x06, 0x02, 0x00, 0x06,
+  0x0A, 0x06, 0x02, 0x01, 0x05, 0x0A, 0x06, 0x02, 0x01, 0x05, 0x0A, 0x05,
+  0x02, 0x02, 0x04, 0x0A, 0x05, 0x02, 0x02, 0x05, 0x0A, 0x04, 0x02, 0x03,
+  0x04, 0x09, 0x04, 0x01, 0x05, 0x06, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0E,
+  0x01, 0x01, 0x0E, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x0E, 0x02, 0x00, 0x02,
+  0x0B, 0x03, 0x02, 0x00, 0x01, 0x0B, 0x02, 0x02, 0x00, 0x01, 0x0A, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x07, 0x02, 0x02, 0x03, 0x09, 0x04, 0x02, 0x01, 0x03, 0x0A,
+  0x04, 0x02, 0x00, 0x04, 0x0B, 0x04, 0x02, 0x00, 0x04, 0x0B, 0x04, 0x02,
+  0x00, 0x05, 0x0B, 0x04, 0x02, 0x00, 0x05, 0x0B, 0x04, 0x02, 0x00, 0x07,
+  0x0A, 0x04, 0x02, 0x01, 0x08, 0x0A, 0x02, 0x01, 0x01, 0x0A, 0x01, 0x02,
+  0x0A, 0x01, 0x04, 0x09, 0x01, 0x03, 0x0B, 0x02, 0x02, 0x03, 0x07, 0x08,
+  0x02, 0x01, 0x03, 0x08, 0x08, 0x02, 0x00, 0x04, 0x0A, 0x06, 0x02, 0x00,
+  0x04, 0x0A, 0x06, 0x02, 0x00, 0x04, 0x0B, 0x05, 0x02, 0x00, 0x04, 0x0B,
+  0x05, 0x02, 0x00, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x04, 0x0A, 0x05, 0x02,
+  0x01, 0x05, 0x09, 0x05, 0x01, 0x02, 0x0B, 0x01, 0x04, 0x07, 0x01, 0x05,
+  0x06, 0x02, 0x03, 0x04, 0x09, 0x04, 0x02, 0x02, 0x04, 0x09, 0x05, 0x02,
+  0x01, 0x05, 0x0A, 0x04, 0x02, 0x01, 0x05, 0x0A, 0x05, 0x02, 0x00, 0x06,
+  0x0A, 0x05, 0x02, 0x00, 0x06, 0x0A, 0x06, 0x02, 0x00, 0x06, 0x0A, 0x06,
+  0x02, 0x00, 0x06, 0x0A, 0x06, 0x02, 0x00, 0x06, 0x0A, 0x06, 0x02, 0x00,
+  0x06, 0x0A, 0x06, 0x02, 0x01, 0x06, 0x0A, 0x06, 0x02, 0x01, 0x06, 0x0A,
+  0x06, 0x01, 0x02, 0x0D, 0x01, 0x04, 0x0B, 0x01, 0x09, 0x06, 0x01, 0x09,
+  0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x05, 0x01, 0x06,
+  0x04, 0x01, 0x04, 0x05, 0x01, 0x02, 0x05, 0x01, 0x00, 0x03, 0x01, 0x01,
+  0x04, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00,
+  0x06, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01,
+  0x01, 0x04, 0x01, 0x02, 0x03, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x04, 0x01, 0x00, 0x06, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x01, 0x01, 0x06, 0x01, 0x05, 0x02, 0x01, 0x05, 0x01,
+  0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x02,
+  0x00, 0x01, 0x11, 0x02, 0x01, 0x0E, 0x05, 0x01, 0x0C, 0x07, 0x01, 0x0A,
+  0x08, 0x01, 0x08, 0x08, 0x01, 0x06, 0x07, 0x01, 0x04, 0x07, 0x01, 0x02,
+  0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x02, 0x07, 0x01, 0x04,
+  0x07, 0x01, 0x06, 0x07, 0x01, 0x08, 0x07, 0x01, 0x0A, 0x08, 0x01, 0x0C,
+  0x07, 0x01, 0x0E, 0x05, 0x01, 0x11, 0x02, 0x00, 0x01, 0x00, 0x13, 0x01,
+  0x00, 0x13, 0x01, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x13, 0x01, 0x00, 0x13, 0x01, 0x00, 0x13, 0x00, 0x01, 0x00, 0x02,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x07, 0x01, 0x01, 0x08, 0x01, 0x04, 0x07,
+  0x01, 0x06, 0x07, 0x01, 0x08, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0C, 0x07,
+  0x01, 0x0C, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x08, 0x07, 0x01, 0x06, 0x07,
+  0x01, 0x03, 0x08, 0x01, 0x01, 0x08, 0x01, 0x00, 0x07, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x02, 0x00, 0x01, 0x04, 0x06, 0x01, 0x02, 0x0A, 0x02, 0x01,
+  0x03, 0x07, 0x06, 0x02, 0x00, 0x03, 0x08, 0x05, 0x02, 0x00, 0x04, 0x08,
+  0x06, 0x02, 0x00, 0x04, 0x08, 0x06, 0x02, 0x00, 0x04, 0x08, 0x06, 0x02,
+  0x01, 0x02, 0x08, 0x06, 0x01, 0x08, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x01, 0x01, 0x06,
+  0x01, 0x01, 0x06, 0x01, 0x00, 0x00, 0x01, 0x05, 0x03, 0x01, 0x04, 0x05,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x05, 0x03,
+  0x01, 0x09, 0x07, 0x01, 0x07, 0x0C, 0x02, 0x05, 0x05, 0x10, 0x04, 0x02,
+  0x04, 0x04, 0x12, 0x03, 0x02, 0x03, 0x04, 0x14, 0x02, 0x03, 0x02, 0x04,
+  0x0D, 0x03, 0x15, 0x02, 0x04, 0x02, 0x03, 0x0B, 0x05, 0x11, 0x03, 0x16,
+  0x01, 0x04, 0x01, 0x04, 0x0A, 0x04, 0x10, 0x04, 0x16, 0x02, 0x04, 0x01,
+  0x04, 0x09, 0x04, 0x10, 0x03, 0x17, 0x01, 0x04, 0x00, 0x04, 0x09, 0x03,
+  0x10, 0x03, 0x17, 0x01, 0x04, 0x00, 0x04, 0x08, 0x04, 0x10, 0x03, 0x17,
+  0x01, 0x04, 0x00, 0x04, 0x08, 0x03, 0x10, 0x02, 0x17, 0x01, 0x04, 0x00,
+  0x04, 0x07, 0x04, 0x0F, 0x03, 0x17, 0x01, 0x04, 0x00, 0x04, 0x07, 0x03,
+  0x0F, 0x03, 0x17, 0x01, 0x04, 0x00, 0x04, 0x07, 0x03, 0x0E, 0x03, 0x16,
+  0x01, 0x04, 0x00, 0x04, 0x07, 0x03, 0x0E, 0x03, 0x15, 0x02, 0x04, 0x01,
+  0x03, 0x07, 0x03, 0x0D, 0x04, 0x14, 0x02, 0x03, 0x01, 0x04, 0x07, 0x06,
+  0x0E, 0x07, 0x03, 0x01, 0x04, 0x08, 0x04, 0x0F, 0x05, 0x01, 0x02, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x04, 0x04, 0x02, 0x05, 0x05, 0x11, 0x04, 0x01,
+  0x06, 0x0D, 0x01, 0x09, 0x08, 0x01, 0x0B, 0x01, 0x01, 0x0A, 0x03, 0x01,
+  0x0A, 0x03, 0x01, 0x09, 0x04, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01,
+  0x08, 0x07, 0x01, 0x08, 0x07, 0x02, 0x07, 0x02, 0x0A, 0x06, 0x02, 0x07,
+  0x02, 0x0A, 0x06, 0x02, 0x07, 0x01, 0x0B, 0x05, 0x02, 0x06, 0x02, 0x0B,
+  0x06, 0x02, 0x06, 0x01, 0x0B, 0x06, 0x02, 0x05, 0x02, 0x0C, 0x06, 0x02,
+  0x05, 0x02, 0x0C, 0x06, 0x02, 0x05, 0x01, 0x0D, 0x06, 0x01, 0x04, 0x0F,
+  0x01, 0x04, 0x0F, 0x02, 0x03, 0x02, 0x0E, 0x06, 0x02, 0x03, 0x02, 0x0E,
+  0x06, 0x02, 0x02, 0x02, 0x0F, 0x06, 0x02, 0x02, 0x02, 0x0F, 0x06, 0x02,
+  0x01, 0x03, 0x0F, 0x07, 0x02, 0x00, 0x07, 0x0C, 0x0C, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x12, 0x02, 0x02, 0x07, 0x0D, 0x06, 0x02, 0x03, 0x06, 0x0E,
+  0x05, 0x02, 0x03, 0x06, 0x0E, 0x06, 0x02, 0x03, 0x06, 0x0E, 0x06, 0x02,
+  0x03, 0x06, 0x0E, 0x06, 0x02, 0x03, 0x06, 0x0E, 0x06, 0x02, 0x03, 0x06,
+  0x0D, 0x06, 0x02, 0x03, 0x06, 0x0C, 0x05, 0x01, 0x03, 0x0B, 0x01, 0x03,
+  0x0E, 0x02, 0x03, 0x06, 0x0C, 0x07, 0x02, 0x03, 0x06, 0x0E, 0x06, 0x02,
+  0x03, 0x06, 0x0E, 0x06, 0x02, 0x03, 0x06, 0x0F, 0x06, 0x02, 0x03, 0x06,
+  0x0F, 0x06, 0x02, 0x03, 0x06, 0x0F, 0x06, 0x02, 0x03, 0x06, 0x0F, 0x06,
+  0x02, 0x03, 0x06, 0x0F, 0x06, 0x02, 0x03, 0x06, 0x0E, 0x06, 0x02, 0x03,
+  0x06, 0x0D, 0x06, 0x01, 0x02, 0x10, 0x01, 0x00, 0x0F, 0x02, 0x09, 0x06,
+  0x15, 0x01, 0x02, 0x06, 0x0B, 0x14, 0x02, 0x02, 0x05, 0x05, 0x0F, 0x07,
+  0x02, 0x04, 0x05, 0x11, 0x05, 0x02, 0x03, 0x05, 0x12, 0x04, 0x02, 0x02,
+  0x05, 0x13, 0x03, 0x02, 0x01, 0x06, 0x14, 0x02, 0x02, 0x01, 0x06, 0x14,
+  0x02, 0x02, 0x01, 0x05, 0x15, 0x01, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06,
+  0x02, 0x02, 0x05, 0x15, 0x01, 0x02, 0x02, 0x06, 0x14, 0x02, 0x02, 0x03,
+  0x06, 0x12, 0x03, 0x02, 0x04, 0x06, 0x10, 0x04, 0x01, 0x06, 0x0C, 0x01,
+  0x08, 0x08, 0x01, 0x00, 0x0F, 0x01, 0x02, 0x0F, 0x02, 0x03, 0x06, 0x0D,
+  0x06, 0x02, 0x03, 0x06, 0x0E, 0x06, 0x02, 0x03, 0x06, 0x0F, 0x06, 0x02,
+  0x03, 0x06, 0x10, 0x05, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06,
+  0x10, 0x06, 0x02, 0x03, 0x06, 0x11, 0x06, 0x02, 0x03, 0x06, 0x11, 0x06,
+  0x02, 0x03, 0x06, 0x11, 0x06, 0x02, 0x03, 0x06, 0x11, 0x06, 0x02, 0x03,
+  0x06, 0x11, 0x06, 0x02, 0x03, 0x06, 0x11, 0x06, 0x02, 0x03, 0x06, 0x11,
+  0x06, 0x02, 0x03, 0x06, 0x11, 0x06, 0x02, 0x03, 0x06, 0x11, 0x05, 0x02,
+  0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x05, 0x02, 0x03, 0x06,
+  0x0F, 0x05, 0x02, 0x03, 0x06, 0x0F, 0x05, 0x02, 0x03, 0x06, 0x0D, 0x06,
+  0x01, 0x02, 0x0F, 0x01, 0x00, 0x0F, 0x01, 0x00, 0x13, 0x01, 0x01, 0x12,
+  0x02, 0x02, 0x06, 0x0F, 0x04, 0x02, 0x02, 0x06, 0x10, 0x03, 0x02, 0x02,
+  0x06, 0x11, 0x02, 0x02, 0x02, 0x06, 0x12, 0x01, 0x03, 0x02, 0x06, 0x0D,
+  0x01, 0x12, 0x01, 0x02, 0x02, 0x06, 0x0D, 0x01, 0x02, 0x02, 0x06, 0x0C,
+  0x02, 0x02, 0x02, 0x06, 0x0B, 0x03, 0x01, 0x02, 0x0C, 0x01, 0x02, 0x0C,
+  0x02, 0x02, 0x06, 0x0B, 0x03, 0x02, 0x02, 0x06, 0x0C, 0x02, 0x02, 0x02,
+  0x06, 0x0D, 0x01, 0x02, 0x02, 0x06, 0x0D, 0x01, 0x02, 0x02, 0x06, 0x14,
+  0x01, 0x02, 0x02, 0x06, 0x13, 0x02, 0x02, 0x02, 0x06, 0x12, 0x02, 0x02,
+  0x02, 0x06, 0x12, 0x02, 0x02, 0x02, 0x06, 0x10, 0x04, 0x02, 0x02, 0x06,
+  0x0E, 0x06, 0x01, 0x00, 0x14, 0x01, 0x00, 0x13, 0x01, 0x00, 0x13, 0x01,
+  0x01, 0x12, 0x02, 0x02, 0x06, 0x0E, 0x05, 0x02, 0x02, 0x06, 0x10, 0x03,
+  0x02, 0x02, 0x06, 0x11, 0x02, 0x02, 0x02, 0x06, 0x12, 0x01, 0x03, 0x02,
+  0x06, 0x0D, 0x01, 0x12, 0x01, 0x02, 0x02, 0x06, 0x0D, 0x01, 0x02, 0x02,
+  0x06, 0x0C, 0x02, 0x02, 0x02, 0x06, 0x0B, 0x03, 0x01, 0x02, 0x0C, 0x01,
+  0x02, 0x0C, 0x02, 0x02, 0x06, 0x0B, 0x03, 0x02, 0x02, 0x06, 0x0C, 0x02,
+  0x02, 0x02, 0x06, 0x0D, 0x01, 0x02, 0x02, 0x06, 0x0D, 0x01, 0x01, 0x02,
+  0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02,
+  0x06, 0x01, 0x02, 0x06, 0x01, 0x01, 0x08, 0x01, 0x00, 0x0B, 0x02, 0x09,
+  0x06, 0x16, 0x01, 0x02, 0x06, 0x0C, 0x15, 0x02, 0x02, 0x05, 0x05, 0x10,
+  0x07, 0x02, 0x04, 0x05, 0x12, 0x05, 0x02, 0x03, 0x05, 0x13, 0x04, 0x02,
+  0x02, 0x05, 0x14, 0x03, 0x02, 0x01, 0x06, 0x15, 0x02, 0x02, 0x01, 0x06,
+  0x15, 0x02, 0x02, 0x01, 0x05, 0x16, 0x01, 0x01, 0x00, 0x06, 0x01, 0x00,
+  0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x02, 0x00,
+  0x06, 0x0E, 0x0B, 0x02, 0x00, 0x06, 0x10, 0x08, 0x02, 0x01, 0x05, 0x11,
+  0x06, 0x02, 0x01, 0x06, 0x11, 0x06, 0x02, 0x01, 0x06, 0x11, 0x06, 0x02,
+  0x02, 0x05, 0x11, 0x06, 0x02, 0x03, 0x05, 0x11, 0x06, 0x02, 0x03, 0x06,
+  0x11, 0x06, 0x02, 0x05, 0x06, 0x10, 0x06, 0x01, 0x06, 0x0E, 0x01, 0x09,
+  0x08, 0x02, 0x00, 0x0A, 0x0E, 0x0A, 0x02, 0x01, 0x08, 0x0F, 0x08, 0x02,
+  0x02, 0x06, 0x10, 0x06, 0x02, 0x02, 0x06, 0x10, 0x06, 0x02, 0x02, 0x06,
+  0x10, 0x06, 0x02, 0x02, 0x06, 0x10, 0x06, 0x02, 0x02, 0x06, 0x10, 0x06,
+  0x02, 0x02, 0x06, 0x10, 0x06, 0x02, 0x02, 0x06, 0x10, 0x06, 0x02, 0x02,
+  0x06, 0x10, 0x06, 0x01, 0x02, 0x14, 0x01, 0x02, 0x14, 0x02, 0x02, 0x06,
+  0x10, 0x06, 0x02, 0x02, 0x06, 0x10, 0x06, 0x02, 0x02, 0x06, 0x10, 0x06,
+  0x02, 0x02, 0x06, 0x10, 0x06, 0x02, 0x02, 0x06, 0x10, 0x06, 0x02, 0x02,
+  0x06, 0x10, 0x06, 0x02, 0x02, 0x06, 0x10, 0x06, 0x02, 0x02, 0x06, 0x10,
+  0x06, 0x02, 0x02, 0x06, 0x10, 0x06, 0x02, 0x02, 0x06, 0x10, 0x06, 0x02,
+  0x01, 0x08, 0x0F, 0x08, 0x02, 0x00, 0x0A, 0x0E, 0x0A, 0x01, 0x00, 0x0B,
+  0x01, 0x01, 0x08, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x02, 0x06, 0x01, 0x01, 0x08, 0x01, 0x00, 0x0B, 0x01, 0x05, 0x0B,
+  0x01, 0x07, 0x08, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06,
+  0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06,
+  0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06,
+  0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06,
+  0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x02, 0x01, 0x03,
+  0x08, 0x06, 0x02, 0x00, 0x05, 0x08, 0x06, 0x02, 0x00, 0x05, 0x08, 0x05,
+  0x02, 0x00, 0x04, 0x08, 0x05, 0x02, 0x01, 0x03, 0x07, 0x05, 0x01, 0x01,
+  0x0A, 0x01, 0x03, 0x06, 0x02, 0x00, 0x0A, 0x0E, 0x0A, 0x02, 0x01, 0x08,
+  0x11, 0x05, 0x02, 0x02, 0x06, 0x11, 0x03, 0x02, 0x02, 0x06, 0x10, 0x02,
+  0x02, 0x02, 0x06, 0x0F, 0x02, 0x02, 0x02, 0x06, 0x0E, 0x02, 0x02, 0x02,
+  0x06, 0x0D, 0x02, 0x02, 0x02, 0x06, 0x0C, 0x02, 0x02, 0x02, 0x06, 0x0B,
+  0x02, 0x02, 0x02, 0x06, 0x0A, 0x03, 0x02, 0x02, 0x06, 0x09, 0x05, 0x01,
+  0x02, 0x0D, 0x01, 0x02, 0x0E, 0x02, 0x02, 0x06, 0x0A, 0x06, 0x02, 0x02,
+  0x06, 0x0A, 0x07, 0x02, 0x02, 0x06, 0x0B, 0x07, 0x02, 0x02, 0x06, 0x0C,
+  0x07, 0x02, 0x02, 0x06, 0x0D, 0x07, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x02,
+  0x02, 0x06, 0x0E, 0x07, 0x02, 0x02, 0x06, 0x0F, 0x07, 0x02, 0x02, 0x06,
+  0x10, 0x07, 0x02, 0x01, 0x08, 0x10, 0x08, 0x02, 0x00, 0x0A, 0x0D, 0x0C,
+  0x01, 0x00, 0x0B, 0x01, 0x01, 0x08, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x02, 0x02, 0x06,
+  0x14, 0x01, 0x02, 0x02, 0x06, 0x13, 0x02, 0x02, 0x02, 0x06, 0x13, 0x02,
+  0x02, 0x02, 0x06, 0x12, 0x02, 0x02, 0x02, 0x06, 0x12, 0x02, 0x02, 0x02,
+  0x06, 0x10, 0x04, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x01, 0x00, 0x14, 0x01,
+  0x00, 0x14, 0x02, 0x00, 0x09, 0x16, 0x09, 0x02, 0x02, 0x07, 0x16, 0x08,
+  0x02, 0x03, 0x06, 0x16, 0x07, 0x02, 0x03, 0x07, 0x15, 0x08, 0x04, 0x03,
+  0x01, 0x05, 0x05, 0x15, 0x01, 0x17, 0x06, 0x04, 0x03, 0x01, 0x05, 0x06,
+  0x14, 0x02, 0x17, 0x06, 0x04, 0x03, 0x01, 0x05, 0x06, 0x14, 0x01, 0x17,
+  0x06, 0x04, 0x03, 0x01, 0x06, 0x06, 0x13, 0x02, 0x17, 0x06, 0x04, 0x03,
+  0x01, 0x06, 0x06, 0x13, 0x01, 0x17, 0x06, 0x04, 0x03, 0x01, 0x07, 0x05,
+  0x13, 0x01, 0x17, 0x06, 0x04, 0x03, 0x01, 0x07, 0x06, 0x12, 0x02, 0x17,
+  0x06, 0x04, 0x03, 0x01, 0x08, 0x05, 0x12, 0x01, 0x17, 0x06, 0x04, 0x03,
+  0x01, 0x08, 0x06, 0x11, 0x02, 0x17, 0x06, 0x04, 0x03, 0x01, 0x09, 0x05,
+  0x11, 0x01, 0x17, 0x06, 0x04, 0x03, 0x01, 0x09, 0x06, 0x10, 0x02, 0x17,
+  0x06, 0x04, 0x03, 0x01, 0x09, 0x06, 0x10, 0x02, 0x17, 0x06, 0x04, 0x03,
+  0x01, 0x0A, 0x05, 0x10, 0x01, 0x17, 0x06, 0x03, 0x03, 0x01, 0x0A, 0x07,
+  0x17, 0x06, 0x03, 0x03, 0x01, 0x0B, 0x05, 0x17, 0x06, 0x03, 0x03, 0x01,
+  0x0B, 0x05, 0x17, 0x06, 0x03, 0x03, 0x01, 0x0C, 0x03, 0x17, 0x06, 0x03,
+  0x03, 0x01, 0x0C, 0x03, 0x17, 0x06, 0x03, 0x02, 0x03, 0x0C, 0x03, 0x16,
+  0x08, 0x03, 0x00, 0x08, 0x0D, 0x01, 0x15, 0x0A, 0x02, 0x00, 0x07, 0x10,
+  0x07, 0x02, 0x01, 0x07, 0x12, 0x03, 0x02, 0x02, 0x07, 0x13, 0x01, 0x02,
+  0x03, 0x07, 0x13, 0x01, 0x02, 0x03, 0x07, 0x13, 0x01, 0x02, 0x03, 0x08,
+  0x13, 0x01, 0x03, 0x03, 0x01, 0x05, 0x07, 0x13, 0x01, 0x03, 0x03, 0x01,
+  0x06, 0x07, 0x13, 0x01, 0x03, 0x03, 0x01, 0x07, 0x07, 0x13, 0x01, 0x03,
+  0x03, 0x01, 0x07, 0x07, 0x13, 0x01, 0x03, 0x03, 0x01, 0x08, 0x07, 0x13,
+  0x01, 0x03, 0x03, 0x01, 0x09, 0x07, 0x13, 0x01, 0x03, 0x03, 0x01, 0x0A,
+  0x07, 0x13, 0x01, 0x03, 0x03, 0x01, 0x0B, 0x07, 0x13, 0x01, 0x03, 0x03,
+  0x01, 0x0C, 0x06, 0x13, 0x01, 0x02, 0x03, 0x01, 0x0C, 0x08, 0x02, 0x03,
+  0x01, 0x0D, 0x07, 0x02, 0x03, 0x01, 0x0E, 0x06, 0x02, 0x03, 0x01, 0x0F,
+  0x05, 0x02, 0x03, 0x01, 0x10, 0x04, 0x02, 0x03, 0x01, 0x10, 0x04, 0x02,
+  0x03, 0x01, 0x11, 0x03, 0x02, 0x02, 0x03, 0x12, 0x02, 0x02, 0x00, 0x07,
+  0x13, 0x01, 0x01, 0x09, 0x07, 0x01, 0x06, 0x0D, 0x02, 0x05, 0x05, 0x0F,
+  0x05, 0x02, 0x04, 0x05, 0x10, 0x05, 0x02, 0x03, 0x05, 0x11, 0x05, 0x02,
+  0x02, 0x05, 0x12, 0x05, 0x02, 0x01, 0x06, 0x12, 0x06, 0x02, 0x01, 0x06,
+  0x12, 0x06, 0x02, 0x01, 0x05, 0x13, 0x05, 0x02, 0x00, 0x06, 0x13, 0x06,
+  0x02, 0x00, 0x06, 0x13, 0x06, 0x02, 0x00, 0x06, 0x13, 0x06, 0x02, 0x00,
+  0x06, 0x13, 0x06, 0x02, 0x00, 0x06, 0x13, 0x06, 0x02, 0x00, 0x06, 0x13,
+  0x06, 0x02, 0x00, 0x06, 0x13, 0x06, 0x02, 0x01, 0x05, 0x13, 0x05, 0x02,
+  0x01, 0x05, 0x12, 0x06, 0x02, 0x01, 0x06, 0x12, 0x06, 0x02, 0x02, 0x05,
+  0x12, 0x05, 0x02, 0x03, 0x05, 0x11, 0x05, 0x02, 0x03, 0x06, 0x10, 0x06,
+  0x02, 0x04, 0x06, 0x0F, 0x05, 0x01, 0x06, 0x0D, 0x01, 0x09, 0x07, 0x01,
+  0x00, 0x0E, 0x01, 0x01, 0x0F, 0x02, 0x02, 0x06, 0x0B, 0x06, 0x02, 0x02,
+  0x06, 0x0C, 0x06, 0x02, 0x02, 0x06, 0x0D, 0x06, 0x02, 0x02, 0x06, 0x0D,
+  0x06, 0x02, 0x02, 0x06, 0x0D, 0x06, 0x02, 0x02, 0x06, 0x0D, 0x06, 0x02,
+  0x02, 0x06, 0x0D, 0x06, 0x02, 0x02, 0x06, 0x0D, 0x06, 0x02, 0x02, 0x06,
+  0x0C, 0x06, 0x02, 0x02, 0x06, 0x0B, 0x06, 0x01, 0x02, 0x0E, 0x01, 0x02,
+  0x0C, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02,
+  0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02,
+  0x06, 0x01, 0x01, 0x08, 0x01, 0x00, 0x0A, 0x01, 0x09, 0x07, 0x01, 0x06,
+  0x0D, 0x02, 0x05, 0x05, 0x0F, 0x05, 0x02, 0x04, 0x05, 0x10, 0x05, 0x02,
+  0x03, 0x05, 0x11, 0x05, 0x02, 0x02, 0x05, 0x12, 0x05, 0x02, 0x01, 0x06,
+  0x12, 0x06, 0x02, 0x01, 0x06, 0x12, 0x06, 0x02, 0x01, 0x05, 0x13, 0x05,
+  0x02, 0x00, 0x06, 0x13, 0x06, 0x02, 0x00, 0x06, 0x13, 0x06, 0x02, 0x00,
+  0x06, 0x13, 0x06, 0x02, 0x00, 0x06, 0x13, 0x06, 0x02, 0x00, 0x06, 0x13,
+  0x06, 0x02, 0x00, 0x06, 0x13, 0x06, 0x02, 0x00, 0x06, 0x13, 0x06, 0x02,
+  0x01, 0x05, 0x13, 0x05, 0x02, 0x01, 0x05, 0x13, 0x05, 0x02, 0x01, 0x06,
+  0x12, 0x06, 0x02, 0x02, 0x05, 0x12, 0x05, 0x02, 0x03, 0x05, 0x11, 0x05,
+  0x02, 0x04, 0x04, 0x11, 0x04, 0x02, 0x05, 0x04, 0x0F, 0x05, 0x01, 0x07,
+  0x0B, 0x01, 0x09, 0x07, 0x01, 0x09, 0x08, 0x01, 0x0A, 0x08, 0x01, 0x0B,
+  0x09, 0x01, 0x0C, 0x0D, 0x01, 0x0F, 0x07, 0x01, 0x00, 0x0F, 0x01, 0x01,
+  0x10, 0x02, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x02, 0x06, 0x0D, 0x06, 0x02,
+  0x02, 0x06, 0x0E, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x02, 0x02, 0x06,
+  0x0E, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x06,
+  0x02, 0x02, 0x06, 0x0E, 0x05, 0x02, 0x02, 0x06, 0x0D, 0x06, 0x02, 0x02,
+  0x06, 0x0C, 0x06, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x0D, 0x02, 0x02, 0x06,
+  0x09, 0x07, 0x02, 0x02, 0x06, 0x0A, 0x06, 0x02, 0x02, 0x06, 0x0B, 0x06,
+  0x02, 0x02, 0x06, 0x0B, 0x07, 0x02, 0x02, 0x06, 0x0C, 0x07, 0x02, 0x02,
+  0x06, 0x0D, 0x06, 0x02, 0x02, 0x06, 0x0D, 0x07, 0x02, 0x02, 0x06, 0x0E,
+  0x07, 0x02, 0x01, 0x08, 0x0F, 0x07, 0x02, 0x00, 0x0A, 0x0F, 0x08, 0x02,
+  0x05, 0x05, 0x0E, 0x01, 0x02, 0x03, 0x09, 0x0E, 0x01, 0x02, 0x02, 0x04,
+  0x0A, 0x05, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x04, 0x0D, 0x02,
+  0x02, 0x00, 0x04, 0x0D, 0x02, 0x02, 0x00, 0x04, 0x0E, 0x01, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x07, 0x01, 0x00, 0x09, 0x01, 0x01, 0x0A, 0x01, 0x02,
+  0x0B, 0x01, 0x03, 0x0B, 0x01, 0x04, 0x0B, 0x01, 0x06, 0x09, 0x01, 0x08,
+  0x08, 0x01, 0x0A, 0x06, 0x02, 0x00, 0x01, 0x0B, 0x05, 0x02, 0x00, 0x02,
+  0x0C, 0x04, 0x02, 0x00, 0x02, 0x0C, 0x04, 0x02, 0x00, 0x03, 0x0C, 0x03,
+  0x02, 0x00, 0x04, 0x0B, 0x04, 0x02, 0x00, 0x05, 0x0A, 0x04, 0x02, 0x00,
+  0x01, 0x03, 0x0A, 0x02, 0x00, 0x01, 0x05, 0x06, 0x01, 0x00, 0x15, 0x01,
+  0x00, 0x15, 0x03, 0x00, 0x04, 0x07, 0x06, 0x10, 0x05, 0x03, 0x00, 0x02,
+  0x07, 0x06, 0x12, 0x03, 0x03, 0x00, 0x02, 0x07, 0x06, 0x13, 0x02, 0x03,
+  0x00, 0x01, 0x07, 0x06, 0x14, 0x01, 0x03, 0x00, 0x01, 0x07, 0x06, 0x14,
+  0x01, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07,
+  0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07,
+  0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07,
+  0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x06,
+  0x08, 0x01, 0x04, 0x0C, 0x02, 0x00, 0x0A, 0x0F, 0x07, 0x02, 0x01, 0x08,
+  0x11, 0x03, 0x02, 0x02, 0x06, 0x12, 0x01, 0x02, 0x02, 0x06, 0x12, 0x01,
+  0x02, 0x02, 0x06, 0x12, 0x01, 0x02, 0x02, 0x06, 0x12, 0x01, 0x02, 0x02,
+  0x06, 0x12, 0x01, 0x02, 0x02, 0x06, 0x12, 0x01, 0x02, 0x02, 0x06, 0x12,
+  0x01, 0x02, 0x02, 0x06, 0x12, 0x01, 0x02, 0x02, 0x06, 0x12, 0x01, 0x02,
+  0x02, 0x06, 0x12, 0x01, 0x02, 0x02, 0x06, 0x12, 0x01, 0x02, 0x02, 0x06,
+  0x12, 0x01, 0x02, 0x02, 0x06, 0x12, 0x01, 0x02, 0x02, 0x06, 0x12, 0x01,
+  0x02, 0x02, 0x06, 0x12, 0x01, 0x02, 0x02, 0x06, 0x12, 0x01, 0x02, 0x02,
+  0x06, 0x12, 0x01, 0x02, 0x02, 0x06, 0x11, 0x02, 0x02, 0x03, 0x06, 0x11,
+  0x01, 0x02, 0x03, 0x06, 0x10, 0x02, 0x02, 0x04, 0x06, 0x0F, 0x02, 0x01,
+  0x05, 0x0B, 0x01, 0x08, 0x06, 0x02, 0x00, 0x0C, 0x11, 0x07, 0x02, 0x02,
+  0x08, 0x13, 0x04, 0x02, 0x03, 0x06, 0x14, 0x02, 0x02, 0x03, 0x06, 0x14,
+  0x01, 0x02, 0x04, 0x06, 0x13, 0x02, 0x02, 0x04, 0x06, 0x13, 0x02, 0x02,
+  0x05, 0x06, 0x13, 0x01, 0x02, 0x05, 0x06, 0x12, 0x02, 0x02, 0x05, 0x06,
+  0x12, 0x01, 0x02, 0x06, 0x06, 0x11, 0x02, 0x02, 0x06, 0x06, 0x11, 0x02,
+  0x02, 0x07, 0x06, 0x11, 0x01, 0x02, 0x07, 0x06, 0x10, 0x02, 0x02, 0x08,
+  0x05, 0x10, 0x01, 0x02, 0x08, 0x06, 0x10, 0x01, 0x02, 0x08, 0x06, 0x0F,
+  0x02, 0x01, 0x09, 0x07, 0x01, 0x09, 0x07, 0x01, 0x0A, 0x05, 0x01, 0x0A,
+  0x05, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0C,
+  0x02, 0x03, 0x00, 0x0B, 0x0D, 0x0B, 0x1C, 0x06, 0x03, 0x02, 0x07, 0x0F,
+  0x07, 0x1E, 0x03, 0x03, 0x03, 0x06, 0x10, 0x06, 0x1E, 0x02, 0x03, 0x03,
+  0x06, 0x10, 0x06, 0x1E, 0x02, 0x03, 0x03, 0x06, 0x11, 0x05, 0x1E, 0x01,
+  0x03, 0x04, 0x05, 0x11, 0x06, 0x1D, 0x02, 0x03, 0x04, 0x06, 0x11, 0x06,
+  0x1D, 0x02, 0x03, 0x04, 0x06, 0x10, 0x07, 0x1D, 0x01, 0x04, 0x05, 0x05,
+  0x10, 0x01, 0x12, 0x06, 0x1C, 0x02, 0x04, 0x05, 0x06, 0x10, 0x01, 0x12,
+  0x06, 0x1C, 0x02, 0x04, 0x05, 0x06, 0x0F, 0x02, 0x13, 0x05, 0x1C, 0x01,
+  0x04, 0x06, 0x05, 0x0F, 0x01, 0x13, 0x05, 0x1B, 0x02, 0x04, 0x06, 0x06,
+  0x0E, 0x02, 0x14, 0x05, 0x1B, 0x02, 0x04, 0x06, 0x06, 0x0E, 0x02, 0x14,
+  0x05, 0x1B, 0x01, 0x04, 0x07, 0x05, 0x0E, 0x01, 0x14, 0x05, 0x1A, 0x02,
+  0x02, 0x07, 0x08, 0x15, 0x07, 0x02, 0x08, 0x06, 0x15, 0x06, 0x02, 0x08,
+  0x06, 0x15, 0x06, 0x02, 0x08, 0x06, 0x16, 0x05, 0x02, 0x09, 0x04, 0x16,
+  0x04, 0x02, 0x09, 0x04, 0x16, 0x04, 0x02, 0x09, 0x03, 0x17, 0x03, 0x02,
+  0x0A, 0x02, 0x17, 0x02, 0x02, 0x0A, 0x02, 0x17, 0x02, 0x02, 0x0A, 0x01,
+  0x18, 0x01, 0x02, 0x00, 0x0C, 0x0E, 0x09, 0x02, 0x01, 0x08, 0x11, 0x04,
+  0x02, 0x02, 0x07, 0x11, 0x03, 0x02, 0x03, 0x07, 0x11, 0x02, 0x02, 0x04,
+  0x06, 0x10, 0x02, 0x02, 0x04, 0x07, 0x0F, 0x02, 0x02, 0x05, 0x07, 0x0F,
+  0x01, 0x02, 0x06, 0x06, 0x0E, 0x02, 0x01, 0x06, 0x09, 0x01, 0x07, 0x07,
+  0x01, 0x08, 0x06, 0x01, 0x08, 0x07, 0x01, 0x09, 0x06, 0x01, 0x09, 0x07,
+  0x01, 0x08, 0x09, 0x02, 0x08, 0x01, 0x0B, 0x06, 0x02, 0x07, 0x02, 0x0C,
+  0x06, 0x02, 0x06, 0x02, 0x0C, 0x07, 0x02, 0x05, 0x02, 0x0D, 0x06, 0x02,
+  0x05, 0x02, 0x0D, 0x07, 0x02, 0x04, 0x02, 0x0E, 0x07, 0x02, 0x03, 0x03,
+  0x0E, 0x07, 0x02, 0x02, 0x04, 0x0E, 0x08, 0x02, 0x00, 0x08, 0x0C, 0x0C,
+  0x02, 0x00, 0x0C, 0x10, 0x08, 0x02, 0x01, 0x08, 0x13, 0x04, 0x02, 0x02,
+  0x07, 0x13, 0x03, 0x02, 0x03, 0x06, 0x13, 0x02, 0x02, 0x03, 0x07, 0x13,
+  0x01, 0x02, 0x04, 0x06, 0x12, 0x02, 0x02, 0x05, 0x06, 0x12, 0x01, 0x02,
+  0x05, 0x06, 0x11, 0x02, 0x02, 0x06, 0x06, 0x10, 0x02, 0x02, 0x06, 0x06,
+  0x10, 0x01, 0x02, 0x07, 0x06, 0x0F, 0x02, 0x01, 0x07, 0x09, 0x01, 0x08,
+  0x08, 0x01, 0x08, 0x07, 0x01, 0x09, 0x06, 0x01, 0x09, 0x06, 0x01, 0x09,
+  0x06, 0x01, 0x09, 0x06, 0x01, 0x09, 0x06, 0x01, 0x09, 0x06, 0x01, 0x09,
+  0x06, 0x01, 0x09, 0x06, 0x01, 0x08, 0x08, 0x01, 0x07, 0x0A, 0x01, 0x01,
+  0x13, 0x01, 0x01, 0x13, 0x02, 0x01, 0x05, 0x0D, 0x06, 0x02, 0x01, 0x03,
+  0x0C, 0x06, 0x02, 0x01, 0x02, 0x0B, 0x07, 0x02, 0x01, 0x01, 0x0B, 0x06,
+  0x02, 0x01, 0x01, 0x0A, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x06, 0x01,
+  0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x07, 0x06, 0x01, 0x06, 0x07, 0x01,
+  0x06, 0x06, 0x01, 0x05, 0x06, 0x02, 0x04, 0x07, 0x14, 0x01, 0x02, 0x04,
+  0x06, 0x13, 0x02, 0x02, 0x03, 0x06, 0x13, 0x02, 0x02, 0x03, 0x06, 0x13,
+  0x02, 0x02, 0x02, 0x06, 0x12, 0x03, 0x02, 0x01, 0x07, 0x11, 0x03, 0x02,
+  0x01, 0x06, 0x0F, 0x05, 0x01, 0x00, 0x14, 0x01, 0x00, 0x14, 0x01, 0x00,
+  0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x08, 0x01, 0x00,
+  0x08, 0x01, 0x00, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07,
+  0x04, 0x01, 0x08, 0x03, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x06, 0x03, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x05, 0x01, 0x04, 0x06, 0x02, 0x04, 0x03, 0x08, 0x03,
+  0x02, 0x03, 0x03, 0x08, 0x03, 0x02, 0x03, 0x03, 0x09, 0x03, 0x02, 0x02,
+  0x03, 0x09, 0x03, 0x02, 0x02, 0x03, 0x0A, 0x03, 0x02, 0x01, 0x03, 0x0A,
+  0x03, 0x02, 0x01, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02,
+  0x00, 0x03, 0x0C, 0x03, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00,
+  0x12, 0x01, 0x00, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x04, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x07, 0x01, 0x02,
+  0x0A, 0x02, 0x01, 0x04, 0x08, 0x05, 0x02, 0x01, 0x04, 0x09, 0x05, 0x02,
+  0x01, 0x04, 0x09, 0x05, 0x02, 0x02, 0x03, 0x09, 0x05, 0x01, 0x09, 0x05,
+  0x01, 0x06, 0x08, 0x02, 0x03, 0x04, 0x09, 0x05, 0x02, 0x01, 0x05, 0x09,
+  0x05, 0x02, 0x00, 0x06, 0x09, 0x05, 0x02, 0x00, 0x06, 0x09, 0x05, 0x02,
+  0x00, 0x06, 0x08, 0x06, 0x02, 0x00, 0x0E, 0x0F, 0x01, 0x02, 0x01, 0x07,
+  0x09, 0x07, 0x02, 0x02, 0x04, 0x0A, 0x04, 0x01, 0x00, 0x06, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x02, 0x01, 0x05, 0x08, 0x05,
+  0x02, 0x01, 0x05, 0x07, 0x08, 0x02, 0x01, 0x06, 0x0A, 0x06, 0x02, 0x01,
+  0x05, 0x0B, 0x06, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x01, 0x05, 0x0C,
+  0x06, 0x02, 0x01, 0x05, 0x0C, 0x06, 0x02, 0x01, 0x05, 0x0C, 0x06, 0x02,
+  0x01, 0x05, 0x0C, 0x06, 0x02, 0x01, 0x05, 0x0C, 0x06, 0x02, 0x01, 0x05,
+  0x0C, 0x06, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05,
+  0x02, 0x01, 0x06, 0x0A, 0x06, 0x02, 0x01, 0x02, 0x05, 0x09, 0x02, 0x01,
+  0x01, 0x07, 0x05, 0x01, 0x05, 0x05, 0x01, 0x03, 0x09, 0x02, 0x02, 0x04,
+  0x09, 0x04, 0x02, 0x01, 0x05, 0x09, 0x04, 0x02, 0x01, 0x04, 0x09, 0x04,
+  0x02, 0x00, 0x05, 0x09, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x06, 0x01,
+  0x01, 0x05, 0x02, 0x02, 0x06, 0x0B, 0x02, 0x01, 0x03, 0x09, 0x01, 0x04,
+  0x06, 0x01, 0x09, 0x07, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B,
+  0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B,
+  0x05, 0x02, 0x05, 0x04, 0x0B, 0x05, 0x02, 0x03, 0x07, 0x0B, 0x05, 0x02,
+  0x02, 0x05, 0x0A, 0x06, 0x02, 0x01, 0x06, 0x0B, 0x05, 0x02, 0x01, 0x05,
+  0x0B, 0x05, 0x02, 0x00, 0x06, 0x0B, 0x05, 0x02, 0x00, 0x06, 0x0B, 0x05,
+  0x02, 0x00, 0x06, 0x0B, 0x05, 0x02, 0x00, 0x06, 0x0B, 0x05, 0x02, 0x00,
+  0x06, 0x0B, 0x05, 0x02, 0x00, 0x06, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B,
+  0x05, 0x02, 0x01, 0x06, 0x0B, 0x05, 0x02, 0x02, 0x05, 0x0A, 0x06, 0x02,
+  0x03, 0x07, 0x0B, 0x07, 0x02, 0x04, 0x05, 0x0B, 0x03, 0x01, 0x04, 0x06,
+  0x01, 0x03, 0x09, 0x02, 0x02, 0x04, 0x09, 0x03, 0x02, 0x01, 0x04, 0x09,
+  0x04, 0x02, 0x00, 0x05, 0x09, 0x04, 0x01, 0x00, 0x0E, 0x01, 0x00, 0x0E,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x06,
+  0x02, 0x01, 0x05, 0x0C, 0x02, 0x02, 0x01, 0x06, 0x0B, 0x02, 0x01, 0x02,
+  0x0A, 0x01, 0x03, 0x08, 0x01, 0x04, 0x06, 0x01, 0x04, 0x05, 0x01, 0x03,
+  0x07, 0x02, 0x02, 0x04, 0x08, 0x03, 0x02, 0x01, 0x05, 0x07, 0x04, 0x02,
+  0x01, 0x05, 0x07, 0x03, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x00,
+  0x08, 0x01, 0x04, 0x06, 0x01, 0x02, 0x0F, 0x02, 0x01, 0x05, 0x09, 0x08,
+  0x02, 0x00, 0x05, 0x0A, 0x04, 0x02, 0x00, 0x05, 0x0A, 0x05, 0x02, 0x00,
+  0x05, 0x0A, 0x05, 0x02, 0x00, 0x05, 0x0A, 0x05, 0x02, 0x00, 0x05, 0x0A,
+  0x05, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x02, 0x02, 0x04, 0x09, 0x05, 0x01,
+  0x04, 0x08, 0x01, 0x03, 0x02, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x0E, 0x01, 0x00, 0x10, 0x01, 0x01, 0x10, 0x01, 0x03, 0x0E, 0x02,
+  0x00, 0x03, 0x0D, 0x04, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x00, 0x04,
+  0x0D, 0x03, 0x01, 0x01, 0x0E, 0x01, 0x03, 0x09, 0x01, 0x00, 0x06, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x02, 0x01, 0x05, 0x09,
+  0x05, 0x02, 0x01, 0x05, 0x07, 0x08, 0x02, 0x01, 0x07, 0x0A, 0x06, 0x02,
+  0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05,
+  0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05,
+  0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01,
+  0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B,
+  0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02,
+  0x00, 0x07, 0x0A, 0x07, 0x01, 0x02, 0x03, 0x01, 0x00, 0x06, 0x01, 0x00,
+  0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x00, 0x07, 0x01, 0x06,
+  0x04, 0x01, 0x05, 0x06, 0x01, 0x05, 0x06, 0x01, 0x05, 0x06, 0x01, 0x06,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x02, 0x01,
+  0x03, 0x06, 0x05, 0x02, 0x00, 0x04, 0x06, 0x04, 0x02, 0x00, 0x03, 0x05,
+  0x05, 0x01, 0x01, 0x08, 0x01, 0x02, 0x05, 0x01, 0x00, 0x06, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x02, 0x01, 0x05, 0x09, 0x08,
+  0x02, 0x01, 0x05, 0x0B, 0x04, 0x02, 0x01, 0x05, 0x0B, 0x02, 0x02, 0x01,
+  0x05, 0x0A, 0x02, 0x02, 0x01, 0x05, 0x09, 0x02, 0x02, 0x01, 0x05, 0x08,
+  0x02, 0x02, 0x01, 0x05, 0x07, 0x04, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x0B,
+  0x02, 0x01, 0x05, 0x08, 0x05, 0x02, 0x01, 0x05, 0x08, 0x06, 0x02, 0x01,
+  0x05, 0x09, 0x06, 0x02, 0x01, 0x05, 0x0A, 0x05, 0x02, 0x01, 0x05, 0x0B,
+  0x05, 0x02, 0x01, 0x05, 0x0B, 0x06, 0x02, 0x00, 0x07, 0x09, 0x09, 0x01,
+  0x00, 0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x00, 0x07, 0x03,
+  0x00, 0x06, 0x09, 0x05, 0x13, 0x05, 0x03, 0x01, 0x05, 0x07, 0x08, 0x11,
+  0x08, 0x03, 0x01, 0x06, 0x0A, 0x08, 0x14, 0x06, 0x03, 0x01, 0x05, 0x0B,
+  0x05, 0x15, 0x05, 0x03, 0x01, 0x05, 0x0B, 0x05, 0x15, 0x05, 0x03, 0x01,
+  0x05, 0x0B, 0x05, 0x15, 0x05, 0x03, 0x01, 0x05, 0x0B, 0x05, 0x15, 0x05,
+  0x03, 0x01, 0x05, 0x0B, 0x05, 0x15, 0x05, 0x03, 0x01, 0x05, 0x0B, 0x05,
+  0x15, 0x05, 0x03, 0x01, 0x05, 0x0B, 0x05, 0x15, 0x05, 0x03, 0x01, 0x05,
+  0x0B, 0x05, 0x15, 0x05, 0x03, 0x01, 0x05, 0x0B, 0x05, 0x15, 0x05, 0x03,
+  0x01, 0x05, 0x0B, 0x05, 0x15, 0x05, 0x03, 0x01, 0x05, 0x0B, 0x05, 0x15,
+  0x05, 0x03, 0x01, 0x05, 0x0B, 0x05, 0x15, 0x05, 0x03, 0x00, 0x07, 0x0A,
+  0x07, 0x14, 0x07, 0x02, 0x00, 0x06, 0x09, 0x05, 0x02, 0x01, 0x05, 0x07,
+  0x08, 0x02, 0x01, 0x07, 0x0A, 0x06, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02,
+  0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05,
+  0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05,
+  0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01,
+  0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B,
+  0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x07, 0x0A, 0x07, 0x01,
+  0x05, 0x07, 0x01, 0x03, 0x0B, 0x02, 0x02, 0x05, 0x0A, 0x05, 0x02, 0x01,
+  0x05, 0x0A, 0x06, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x06, 0x0B,
+  0x06, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x02,
+  0x00, 0x06, 0x0B, 0x06, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x02, 0x00, 0x06,
+  0x0B, 0x06, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05,
+  0x02, 0x02, 0x05, 0x0A, 0x05, 0x01, 0x03, 0x0B, 0x01, 0x05, 0x07, 0x02,
+  0x00, 0x07, 0x09, 0x05, 0x02, 0x02, 0x05, 0x08, 0x08, 0x02, 0x02, 0x07,
+  0x0C, 0x05, 0x02, 0x02, 0x05, 0x0C, 0x06, 0x02, 0x02, 0x05, 0x0D, 0x05,
+  0x02, 0x02, 0x05, 0x0D, 0x06, 0x02, 0x02, 0x05, 0x0D, 0x06, 0x02, 0x02,
+  0x05, 0x0D, 0x06, 0x02, 0x02, 0x05, 0x0D, 0x06, 0x02, 0x02, 0x05, 0x0D,
+  0x06, 0x02, 0x02, 0x05, 0x0D, 0x06, 0x02, 0x02, 0x05, 0x0D, 0x05, 0x02,
+  0x02, 0x05, 0x0C, 0x06, 0x02, 0x02, 0x06, 0x0B, 0x06, 0x02, 0x02, 0x05,
+  0x08, 0x08, 0x02, 0x02, 0x05, 0x09, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02,
+  0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02,
+  0x06, 0x01, 0x01, 0x08, 0x02, 0x05, 0x05, 0x0F, 0x01, 0x02, 0x03, 0x09,
+  0x0E, 0x02, 0x03, 0x02, 0x06, 0x0A, 0x02, 0x0D, 0x03, 0x02, 0x01, 0x06,
+  0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x00, 0x06, 0x0B, 0x05,
+  0x02, 0x00, 0x06, 0x0B, 0x05, 0x02, 0x00, 0x06, 0x0B, 0x05, 0x02, 0x00,
+  0x06, 0x0B, 0x05, 0x02, 0x00, 0x06, 0x0B, 0x05, 0x02, 0x00, 0x06, 0x0B,
+  0x05, 0x02, 0x00, 0x06, 0x0B, 0x05, 0x02, 0x01, 0x06, 0x0B, 0x05, 0x02,
+  0x02, 0x05, 0x0A, 0x06, 0x02, 0x03, 0x07, 0x0B, 0x05, 0x02, 0x04, 0x05,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x08, 0x02,
+  0x00, 0x06, 0x09, 0x03, 0x02, 0x01, 0x05, 0x07, 0x06, 0x01, 0x01, 0x0C,
+  0x02, 0x01, 0x06, 0x09, 0x04, 0x02, 0x01, 0x05, 0x0A, 0x03, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x05, 0x01, 0x00, 0x08, 0x02, 0x03, 0x04, 0x0A, 0x01,
+  0x01, 0x02, 0x09, 0x02, 0x01, 0x03, 0x08, 0x03, 0x02, 0x00, 0x03, 0x09,
+  0x02, 0x02, 0x00, 0x03, 0x0A, 0x01, 0x01, 0x00, 0x05, 0x01, 0x00, 0x08,
+  0x01, 0x01, 0x09, 0x01, 0x02, 0x09, 0x01, 0x04, 0x08, 0x02, 0x00, 0x01,
+  0x07, 0x05, 0x02, 0x00, 0x01, 0x09, 0x03, 0x02, 0x00, 0x02, 0x09, 0x03,
+  0x02, 0x00, 0x03, 0x08, 0x03, 0x02, 0x00, 0x01, 0x02, 0x08, 0x02, 0x00,
+  0x01, 0x04, 0x05, 0x01, 0x05, 0x01, 0x01, 0x04, 0x02, 0x01, 0x03, 0x03,
+  0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x02, 0x01, 0x05, 0x09, 0x01, 0x02, 0x01, 0x05, 0x08,
+  0x02, 0x01, 0x01, 0x08, 0x01, 0x02, 0x07, 0x01, 0x03, 0x04, 0x02, 0x00,
+  0x06, 0x09, 0x07, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B,
+  0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02,
+  0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05,
+  0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05,
+  0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x01,
+  0x05, 0x0B, 0x05, 0x02, 0x01, 0x06, 0x0A, 0x06, 0x02, 0x02, 0x08, 0x0B,
+  0x07, 0x02, 0x03, 0x05, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x0B, 0x06, 0x02,
+  0x01, 0x07, 0x0D, 0x02, 0x02, 0x02, 0x05, 0x0D, 0x02, 0x02, 0x02, 0x06,
+  0x0D, 0x01, 0x02, 0x03, 0x05, 0x0D, 0x01, 0x02, 0x03, 0x05, 0x0C, 0x01,
+  0x02, 0x04, 0x05, 0x0C, 0x01, 0x02, 0x04, 0x05, 0x0B, 0x02, 0x02, 0x05,
+  0x05, 0x0B, 0x01, 0x01, 0x05, 0x07, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05,
+  0x01, 0x06, 0x04, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x08, 0x01,
+  0x03, 0x00, 0x08, 0x0A, 0x08, 0x14, 0x04, 0x03, 0x01, 0x06, 0x0B, 0x05,
+  0x15, 0x02, 0x03, 0x02, 0x05, 0x0C, 0x04, 0x15, 0x02, 0x03, 0x02, 0x05,
+  0x0C, 0x05, 0x15, 0x01, 0x03, 0x03, 0x05, 0x0C, 0x05, 0x14, 0x02, 0x03,
+  0x03, 0x05, 0x0B, 0x06, 0x14, 0x01, 0x04, 0x04, 0x04, 0x0B, 0x01, 0x0D,
+  0x05, 0x14, 0x01, 0x04, 0x04, 0x05, 0x0B, 0x01, 0x0D, 0x05, 0x13, 0x02,
+  0x04, 0x04, 0x05, 0x0A, 0x02, 0x0E, 0x04, 0x13, 0x01, 0x02, 0x05, 0x06,
+  0x0E, 0x06, 0x02, 0x05, 0x06, 0x0E, 0x05, 0x02, 0x06, 0x04, 0x0F, 0x04,
+  0x02, 0x06, 0x04, 0x0F, 0x04, 0x02, 0x06, 0x03, 0x0F, 0x03, 0x02, 0x07,
+  0x02, 0x10, 0x02, 0x02, 0x07, 0x02, 0x10, 0x01, 0x02, 0x00, 0x08, 0x0A,
+  0x06, 0x02, 0x01, 0x06, 0x0C, 0x02, 0x02, 0x02, 0x05, 0x0C, 0x01, 0x02,
+  0x02, 0x06, 0x0B, 0x02, 0x02, 0x03, 0x05, 0x0A, 0x02, 0x01, 0x04, 0x07,
+  0x01, 0x04, 0x06, 0x01, 0x05, 0x06, 0x01, 0x06, 0x05, 0x01, 0x06, 0x06,
+  0x02, 0x05, 0x01, 0x07, 0x06, 0x02, 0x04, 0x02, 0x08, 0x05, 0x02, 0x03,
+  0x02, 0x08, 0x06, 0x02, 0x02, 0x02, 0x09, 0x06, 0x02, 0x01, 0x03, 0x09,
+  0x06, 0x02, 0x00, 0x06, 0x08, 0x08, 0x02, 0x00, 0x08, 0x0A, 0x06, 0x02,
+  0x01, 0x06, 0x0C, 0x02, 0x02, 0x01, 0x05, 0x0C, 0x02, 0x02, 0x02, 0x05,
+  0x0C, 0x01, 0x02, 0x02, 0x05, 0x0C, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x02,
+  0x02, 0x03, 0x05, 0x0B, 0x01, 0x02, 0x04, 0x04, 0x0A, 0x02, 0x02, 0x04,
+  0x05, 0x0A, 0x01, 0x02, 0x04, 0x05, 0x0A, 0x01, 0x01, 0x05, 0x06, 0x01,
+  0x05, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01, 0x07, 0x02, 0x01,
+  0x07, 0x02, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x02, 0x01, 0x02, 0x07,
+  0x01, 0x02, 0x00, 0x04, 0x06, 0x01, 0x02, 0x00, 0x04, 0x05, 0x02, 0x01,
+  0x00, 0x06, 0x01, 0x01, 0x04, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x0D, 0x02,
+  0x01, 0x03, 0x08, 0x06, 0x02, 0x01, 0x01, 0x08, 0x05, 0x01, 0x07, 0x05,
+  0x01, 0x06, 0x06, 0x01, 0x06, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x06,
+  0x01, 0x04, 0x05, 0x01, 0x03, 0x06, 0x02, 0x02, 0x06, 0x0D, 0x01, 0x02,
+  0x02, 0x05, 0x0D, 0x01, 0x02, 0x01, 0x06, 0x0B, 0x03, 0x01, 0x00, 0x0E,
+  0x01, 0x00, 0x0E, 0x01, 0x07, 0x04, 0x01, 0x05, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x03, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x05, 0x01, 0x05, 0x05, 0x01, 0x07, 0x04,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x05, 0x01, 0x02, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x02, 0x05, 0x01, 0x01, 0x05, 0x01, 0x00, 0x04,
+  0x01, 0x02, 0x05, 0x02, 0x01, 0x09, 0x0D, 0x02, 0x01, 0x00, 0x10, 0x02,
+  0x01, 0x02, 0x07, 0x08, 0x01, 0x09, 0x05 };
+
+const GFXglyph FreeSerifBold18pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,   9,    0,    1 },   // 0x20 ' '
+  {     0,   6,  24,  12,    3,  -23 },   // 0x21 '!'
+  {    66,  13,  10,  19,    3,  -23 },   // 0x22 '"'
+  {   116,  18,  24,  17,    0,  -23 },   // 0x23 '#'
+  {   224,  15,  28,  17,    1,  -25 },   // 0x24 '$'
+  {   354,  27,  24,  35,    4,  -23 },   // 0x25 '%'
+  {   520,  26,  25,  29,    2,  -23 },   // 0x26 '&'
+  {   649,   4,  10,  10,    3,  -23 },   // 0x27 '''
+  {   679,   9,  30,  12,    2,  -23 },   // 0x28 '('
+  {   769,   9,  30,  12,    1,  -23 },   // 0x29 ')'
+  {   859,  14,  15,  18,    2,  -23 },   // 0x2A '*'
+  {   928,  19,  19,  24,    2,  -17 },   // 0x2B '+'
+  {   985,   6,  12,   9,    1,   -5 },   // 0x2C ','
+  {  1021,   8,   4,  12,    2,   -9 },   // 0x2D '-'
+  {  1033,   6,   6,   9,    1,   -5 },   // 0x2E '.'
+  {  1051,  11,  25,  10,   -1,  -23 },   // 0x2F '/'
+  {  1126,  16,  24,  18,    1,  -23 },   // 0x30 '0'
+  {  1242,  12,  24,  18,    3,  -23 },   // 0x31 '1'
+  {  1316,  16,  24,  17,    1,  -23 },   // 0x32 '2'
+  {  1398,  16,  24,  18,    0,  -23 },   // 0x33 '3'
+  {  1480,  15,  24,  18,    1,  -23 },   // 0x34 '4'
+  {  1572,  15,  24,  18,    1,  -23 },   // 0x35 '5'
+  {  1650,  16,  24,  18,    1,  -23 },   // 0x36 '6'
+  {  1746,  16,  24,  17,    1,  -23 },   // 0x37 '7'
+  {  1824,  16,  24,  17,    1,  -23 },   // 0x38 '8'
+  {  1930,  16,  24,  18,    1,  -23 },   // 0x39 '9'
+  {  2026,   6,  16,  12,    3,  -15 },   // 0x3A ':'
+  {  2066,   7,  22,  12,    2,  -15 },   // 0x3B ';'
+  {  2124,  19,  20,  24,    2,  -18 },   // 0x3C '<'
+  {  2180,  19,  12,  24,    2,  -14 },   // 0x3D '='
+  {  2204,  19,  20,  24,    3,  -18 },   // 0x3E '>'
+  {  2260,  14,  24,  18,    2,  -23 },   // 0x3F '?'
+  {  2340,  24,  25,  33,    4,  -23 },   // 0x40 '@'
+  {  2501,  24,  24,  25,    1,  -23 },   // 0x41 'A'
+  {  2601,  21,  24,  23,    1,  -23 },   // 0x42 'B'
+  {  2709,  23,  25,  25,    1,  -23 },   // 0x43 'C'
+  {  2810,  23,  24,  26,    1,  -23 },   // 0x44 'D'
+  {  2922,  21,  24,  23,    2,  -23 },   // 0x45 'E'
+  {  3032,  19,  24,  22,    2,  -23 },   // 0x46 'F'
+  {  3130,  25,  25,  27,    1,  -23 },   // 0x47 'G'
+  {  3241,  24,  24,  27,    2,  -23 },   // 0x48 'H'
+  {  3357,  11,  24,  14,    2,  -23 },   // 0x49 'I'
+  {  3429,  16,  27,  18,    0,  -23 },   // 0x4A 'J'
+  {  3520,  25,  24,  27,    2,  -23 },   // 0x4B 'K'
+  {  3636,  21,  24,  23,    2,  -23 },   // 0x4C 'L'
+  {  3722,  31,  24,  33,    1,  -23 },   // 0x4D 'M'
+  {  3908,  23,  24,  25,    1,  -23 },   // 0x4E 'N'
+  {  4046,  25,  25,  27,    1,  -23 },   // 0x4F 'O'
+  {  4163,  19,  24,  22,    2,  -23 },   // 0x50 'P'
+  {  4255,  25,  30,  27,    1,  -23 },   // 0x51 'Q'
+  {  4387,  23,  24,  25,    2,  -23 },   // 0x52 'R'
+  {  4499,  16,  25,  20,    2,  -23 },   // 0x53 'S'
+  {  4604,  21,  24,  23,    1,  -23 },   // 0x54 'T'
+  {  4696,  22,  25,  25,    2,  -23 },   // 0x55 'U'
+  {  4817,  24,  24,  25,    0,  -23 },   // 0x56 'V'
+  {  4921,  34,  25,  34,    0,  -23 },   // 0x57 'W'
+  {  5090,  24,  24,  25,    1,  -23 },   // 0x58 'X'
+  {  5196,  24,  24,  25,    1,  -23 },   // 0x59 'Y'
+  {  5290,  21,  24,  23,    1,  -23 },   // 0x5A 'Z'
+  {  5386,   8,  29,  12,    2,  -23 },   // 0x5B '['
+  {  5473,  11,  25,  10,   -1,  -23 },   // 0x5C '\'
+  {  5548,   8,  29,  12,    2,  -23 },   // 0x5D ']'
+  {  5635,  15,  13,  20,    3,  -23 },   // 0x5E '^'
+  {  5692,  18,   3,  17,    0,    3 },   // 0x5F '_'
+  {  5701,   8,   6,  12,    0,  -23 },   // 0x60 '`'
+  {  5719,  16,  16,  18,    1,  -15 },   // 0x61 'a'
+  {  5791,  18,  24,  19,    1,  -23 },   // 0x62 'b'
+  {  5895,  14,  16,  15,    1,  -15 },   // 0x63 'c'
+  {  5953,  18,  24,  19,    1,  -23 },   // 0x64 'd'
+  {  6057,  14,  16,  16,    1,  -15 },   // 0x65 'e'
+  {  6115,  11,  24,  14,    2,  -23 },   // 0x66 'f'
+  {  6193,  17,  23,  17,    1,  -15 },   // 0x67 'g'
+  {  6284,  17,  24,  19,    1,  -23 },   // 0x68 'h'
+  {  6388,   7,  24,  10,    2,  -23 },   // 0x69 'i'
+  {  6454,  11,  31,  14,    0,  -23 },   // 0x6A 'j'
+  {  6547,  18,  24,  19,    1,  -23 },   // 0x6B 'k'
+  {  6647,   7,  24,  10,    1,  -23 },   // 0x6C 'l'
+  {  6719,  27,  16,  29,    1,  -15 },   // 0x6D 'm'
+  {  6831,  17,  16,  19,    1,  -15 },   // 0x6E 'n'
+  {  6911,  17,  16,  18,    1,  -15 },   // 0x6F 'o'
+  {  6983,  19,  23,  19,    0,  -15 },   // 0x70 'p'
+  {  7084,  17,  23,  19,    1,  -15 },   // 0x71 'q'
+  {  7187,  13,  16,  15,    1,  -15 },   // 0x72 'r'
+  {  7243,  12,  16,  14,    1,  -15 },   // 0x73 's'
+  {  7311,  10,  21,  12,    1,  -20 },   // 0x74 't'
+  {  7378,  18,  16,  20,    1,  -15 },   // 0x75 'u'
+  {  7458,  17,  16,  17,    0,  -15 },   // 0x76 'v'
+  {  7524,  24,  16,  25,    0,  -15 },   // 0x77 'w'
+  {  7628,  16,  16,  18,    1,  -15 },   // 0x78 'x'
+  {  7698,  16,  23,  17,    0,  -15 },   // 0x79 'y'
+  {  7793,  14,  16,  16,    0,  -15 },   // 0x7A 'z'
+  {  7851,  11,  31,  14,    1,  -24 },   // 0x7B '{'
+  {  7944,   3,  25,   8,    2,  -23 },   // 0x7C '|'
+  {  8019,  11,  31,  14,    3,  -24 },   // 0x7D '}'
+  {  8112,  16,   5,  18,    1,  -11 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSerifBold18pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSerifBold18pt7bSpanData,
+    (GFXglyph *)FreeSerifBold18pt7bSpanGlyphs,
+    0x20, 0x7E, 42 } };
+
+// Approx. 8915 bytes
@@ -0,0 +1,1046 @@
+// FreeSerifBold24pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSerifBold24pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSerifBold24pt7bSpanData[] PROGMEM = {
+  0x01, 0x02, 0x04, 0x01, 0x01, 0x06, 0x01, 0x00, 0x07, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08,
+  0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+  0x04, 0x01, 0x01, 0x06, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00,
+  0x08, 0x01, 0x00, 0x08, 0x01, 0x01, 0x06, 0x01, 0x02, 0x04, 0x02, 0x01,
+  0x03, 0x0D, 0x03, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C,
+  0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02,
+  0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x04, 0x0C, 0x05, 0x02, 0x01, 0x03,
+  0x0D, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03,
+  0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x02, 0x01, 0x0D, 0x03, 0x02, 0x02,
+  0x01, 0x0E, 0x01, 0x02, 0x08, 0x04, 0x11, 0x03, 0x02, 0x08, 0x03, 0x11,
+  0x03, 0x02, 0x08, 0x03, 0x11, 0x03, 0x02, 0x07, 0x04, 0x10, 0x04, 0x02,
+  0x07, 0x04, 0x10, 0x04, 0x02, 0x07, 0x04, 0x10, 0x04, 0x02, 0x07, 0x04,
+  0x10, 0x04, 0x02, 0x07, 0x04, 0x10, 0x04, 0x02, 0x07, 0x03, 0x10, 0x03,
+  0x02, 0x07, 0x03, 0x10, 0x03, 0x01, 0x02, 0x15, 0x01, 0x02, 0x15, 0x01,
+  0x02, 0x15, 0x02, 0x06, 0x04, 0x0F, 0x04, 0x02, 0x06, 0x04, 0x0F, 0x04,
+  0x02, 0x06, 0x03, 0x0F, 0x03, 0x02, 0x06, 0x03, 0x0F, 0x03, 0x02, 0x05,
+  0x04, 0x0E, 0x04, 0x02, 0x05, 0x04, 0x0E, 0x04, 0x02, 0x05, 0x04, 0x0E,
+  0x04, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x02, 0x05,
+  0x03, 0x0E, 0x03, 0x02, 0x04, 0x04, 0x0D, 0x04, 0x02, 0x04, 0x04, 0x0D,
+  0x04, 0x02, 0x04, 0x04, 0x0D, 0x04, 0x02, 0x04, 0x04, 0x0D, 0x04, 0x02,
+  0x04, 0x04, 0x0D, 0x04, 0x02, 0x04, 0x04, 0x0D, 0x03, 0x02, 0x04, 0x03,
+  0x0D, 0x03, 0x02, 0x04, 0x03, 0x0C, 0x04, 0x02, 0x03, 0x04, 0x0C, 0x04,
+  0x01, 0x09, 0x02, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02,
+  0x01, 0x05, 0x0B, 0x03, 0x03, 0x04, 0x09, 0x02, 0x0C, 0x06, 0x03, 0x02,
+  0x03, 0x09, 0x02, 0x0E, 0x05, 0x03, 0x01, 0x03, 0x09, 0x02, 0x0F, 0x04,
+  0x03, 0x01, 0x03, 0x09, 0x02, 0x10, 0x03, 0x03, 0x00, 0x04, 0x09, 0x02,
+  0x11, 0x02, 0x03, 0x00, 0x04, 0x09, 0x02, 0x11, 0x02, 0x03, 0x00, 0x05,
+  0x09, 0x02, 0x12, 0x01, 0x03, 0x00, 0x06, 0x09, 0x02, 0x12, 0x01, 0x01,
+  0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x0B, 0x01, 0x02, 0x0C, 0x01,
+  0x03, 0x0C, 0x01, 0x04, 0x0D, 0x01, 0x05, 0x0D, 0x01, 0x07, 0x0C, 0x01,
+  0x09, 0x0B, 0x01, 0x09, 0x0B, 0x02, 0x09, 0x02, 0x0D, 0x08, 0x02, 0x09,
+  0x02, 0x0E, 0x07, 0x03, 0x01, 0x01, 0x09, 0x02, 0x0F, 0x06, 0x03, 0x01,
+  0x01, 0x09, 0x02, 0x10, 0x05, 0x03, 0x01, 0x01, 0x09, 0x02, 0x10, 0x05,
+  0x03, 0x01, 0x02, 0x09, 0x02, 0x10, 0x05, 0x03, 0x01, 0x03, 0x09, 0x02,
+  0x10, 0x04, 0x03, 0x01, 0x03, 0x09, 0x02, 0x0F, 0x05, 0x03, 0x01, 0x04,
+  0x09, 0x02, 0x0F, 0x04, 0x03, 0x01, 0x06, 0x09, 0x02, 0x0D, 0x05, 0x01,
+  0x03, 0x0D, 0x01, 0x06, 0x07, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02, 0x01,
+  0x09, 0x02, 0x01, 0x09, 0x02, 0x01, 0x1A, 0x02, 0x02, 0x07, 0x05, 0x19,
+  0x02, 0x02, 0x06, 0x08, 0x18, 0x03, 0x03, 0x04, 0x06, 0x0C, 0x03, 0x15,
+  0x05, 0x02, 0x03, 0x06, 0x0D, 0x0D, 0x03, 0x03, 0x05, 0x0E, 0x07, 0x16,
+  0x03, 0x03, 0x02, 0x06, 0x0E, 0x01, 0x16, 0x03, 0x03, 0x01, 0x06, 0x0E,
+  0x01, 0x15, 0x03, 0x03, 0x01, 0x06, 0x0E, 0x01, 0x15, 0x03, 0x03, 0x01,
+  0x05, 0x0E, 0x01, 0x14, 0x03, 0x03, 0x00, 0x06, 0x0D, 0x01, 0x14, 0x02,
+  0x03, 0x00, 0x06, 0x0D, 0x01, 0x13, 0x03, 0x03, 0x00, 0x05, 0x0C, 0x02,
+  0x13, 0x02, 0x03, 0x00, 0x05, 0x0C, 0x01, 0x12, 0x03, 0x03, 0x00, 0x05,
+  0x0B, 0x02, 0x11, 0x03, 0x03, 0x00, 0x05, 0x0A, 0x02, 0x11, 0x03, 0x04,
+  0x01, 0x05, 0x09, 0x02, 0x10, 0x03, 0x1B, 0x05, 0x03, 0x02, 0x08, 0x10,
+  0x02, 0x19, 0x09, 0x04, 0x03, 0x05, 0x0F, 0x03, 0x17, 0x07, 0x21, 0x01,
+  0x03, 0x0F, 0x02, 0x16, 0x06, 0x22, 0x01, 0x03, 0x0E, 0x03, 0x16, 0x06,
+  0x22, 0x01, 0x03, 0x0E, 0x02, 0x15, 0x06, 0x22, 0x01, 0x03, 0x0D, 0x03,
+  0x14, 0x06, 0x22, 0x01, 0x03, 0x0D, 0x02, 0x14, 0x06, 0x22, 0x01, 0x03,
+  0x0C, 0x03, 0x13, 0x06, 0x21, 0x01, 0x03, 0x0B, 0x03, 0x13, 0x06, 0x21,
+  0x01, 0x03, 0x0B, 0x02, 0x13, 0x06, 0x21, 0x01, 0x03, 0x0A, 0x03, 0x13,
+  0x05, 0x20, 0x01, 0x03, 0x0A, 0x02, 0x13, 0x05, 0x1F, 0x02, 0x03, 0x09,
+  0x03, 0x13, 0x05, 0x1F, 0x01, 0x03, 0x09, 0x02, 0x14, 0x04, 0x1E, 0x02,
+  0x03, 0x08, 0x03, 0x14, 0x05, 0x1C, 0x03, 0x02, 0x08, 0x02, 0x15, 0x09,
+  0x02, 0x07, 0x03, 0x16, 0x06, 0x01, 0x0C, 0x07, 0x01, 0x0A, 0x0B, 0x02,
+  0x09, 0x04, 0x10, 0x07, 0x02, 0x08, 0x04, 0x11, 0x06, 0x02, 0x08, 0x04,
+  0x12, 0x06, 0x02, 0x07, 0x05, 0x13, 0x05, 0x02, 0x07, 0x05, 0x13, 0x05,
+  0x02, 0x07, 0x06, 0x13, 0x05, 0x02, 0x07, 0x06, 0x13, 0x04, 0x02, 0x07,
+  0x07, 0x13, 0x04, 0x02, 0x07, 0x08, 0x12, 0x03, 0x01, 0x08, 0x0C, 0x01,
+  0x08, 0x09, 0x02, 0x09, 0x08, 0x18, 0x0A, 0x02, 0x09, 0x09, 0x1B, 0x05,
+  0x02, 0x07, 0x0B, 0x1B, 0x04, 0x03, 0x05, 0x04, 0x0A, 0x09, 0x1B, 0x03,
+  0x03, 0x04, 0x03, 0x0B, 0x09, 0x1B, 0x03, 0x03, 0x03, 0x04, 0x0C, 0x09,
+  0x1B, 0x02, 0x03, 0x02, 0x04, 0x0C, 0x09, 0x1A, 0x02, 0x03, 0x01, 0x05,
+  0x0D, 0x09, 0x1A, 0x02, 0x03, 0x01, 0x05, 0x0E, 0x09, 0x19, 0x02, 0x02,
+  0x00, 0x06, 0x0E, 0x0C, 0x02, 0x00, 0x06, 0x0F, 0x0B, 0x02, 0x00, 0x07,
+  0x10, 0x09, 0x02, 0x00, 0x07, 0x10, 0x0A, 0x02, 0x00, 0x08, 0x11, 0x0A,
+  0x03, 0x00, 0x08, 0x12, 0x09, 0x21, 0x01, 0x03, 0x01, 0x08, 0x12, 0x0B,
+  0x20, 0x02, 0x02, 0x01, 0x09, 0x11, 0x10, 0x03, 0x02, 0x0A, 0x10, 0x03,
+  0x14, 0x0D, 0x02, 0x02, 0x0F, 0x15, 0x0B, 0x02, 0x04, 0x0B, 0x16, 0x09,
+  0x02, 0x06, 0x07, 0x18, 0x05, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01, 0x00, 0x01, 0x0A, 0x02,
+  0x01, 0x09, 0x02, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x05, 0x03, 0x01, 0x06, 0x02, 0x01, 0x07, 0x02,
+  0x01, 0x08, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x0B, 0x01, 0x00, 0x01, 0x00,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x02, 0x01, 0x04,
+  0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x05, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x05, 0x01, 0x07,
+  0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07,
+  0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07,
+  0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06,
+  0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02, 0x01, 0x03,
+  0x02, 0x01, 0x02, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x07,
+  0x03, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x03, 0x00, 0x04, 0x07, 0x04, 0x0E, 0x03, 0x03, 0x00, 0x05, 0x07,
+  0x03, 0x0D, 0x04, 0x03, 0x00, 0x06, 0x07, 0x03, 0x0C, 0x06, 0x03, 0x00,
+  0x07, 0x08, 0x02, 0x0B, 0x06, 0x01, 0x02, 0x0E, 0x01, 0x05, 0x07, 0x01,
+  0x04, 0x08, 0x03, 0x01, 0x06, 0x08, 0x01, 0x0A, 0x06, 0x03, 0x00, 0x06,
+  0x07, 0x03, 0x0B, 0x06, 0x03, 0x00, 0x05, 0x07, 0x03, 0x0C, 0x06, 0x03,
+  0x00, 0x04, 0x07, 0x03, 0x0D, 0x04, 0x03, 0x01, 0x02, 0x06, 0x05, 0x0E,
+  0x03, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x07,
+  0x03, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x00, 0x1A, 0x01, 0x00,
+  0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x06, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x01,
+  0x07, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04,
+  0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00,
+  0x0B, 0x01, 0x00, 0x0B, 0x01, 0x02, 0x04, 0x01, 0x01, 0x06, 0x01, 0x00,
+  0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x01,
+  0x06, 0x01, 0x02, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0A, 0x05, 0x01, 0x0A,
+  0x04, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x09,
+  0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07,
+  0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x08, 0x06, 0x02, 0x06,
+  0x04, 0x0C, 0x04, 0x02, 0x05, 0x04, 0x0D, 0x04, 0x02, 0x04, 0x05, 0x0D,
+  0x05, 0x02, 0x03, 0x05, 0x0E, 0x05, 0x02, 0x03, 0x05, 0x0E, 0x05, 0x02,
+  0x02, 0x06, 0x0E, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x02, 0x01, 0x07,
+  0x0E, 0x07, 0x02, 0x01, 0x07, 0x0E, 0x07, 0x02, 0x01, 0x07, 0x0E, 0x07,
+  0x02, 0x00, 0x08, 0x0E, 0x07, 0x02, 0x00, 0x08, 0x0E, 0x08, 0x02, 0x00,
+  0x08, 0x0E, 0x08, 0x02, 0x00, 0x08, 0x0E, 0x08, 0x02, 0x00, 0x08, 0x0E,
+  0x08, 0x02, 0x00, 0x08, 0x0E, 0x08, 0x02, 0x00, 0x08, 0x0E, 0x08, 0x02,
+  0x00, 0x08, 0x0E, 0x08, 0x02, 0x00, 0x08, 0x0E, 0x08, 0x02, 0x00, 0x08,
+  0x0E, 0x08, 0x02, 0x00, 0x08, 0x0E, 0x08, 0x02, 0x00, 0x08, 0x0E, 0x07,
+  0x02, 0x01, 0x07, 0x0E, 0x07, 0x02, 0x01, 0x07, 0x0E, 0x07, 0x02, 0x01,
+  0x07, 0x0E, 0x07, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x02, 0x02, 0x06, 0x0E,
+  0x06, 0x02, 0x03, 0x05, 0x0E, 0x05, 0x02, 0x03, 0x05, 0x0E, 0x05, 0x02,
+  0x04, 0x05, 0x0D, 0x05, 0x02, 0x05, 0x04, 0x0D, 0x04, 0x02, 0x06, 0x04,
+  0x0C, 0x04, 0x01, 0x08, 0x06, 0x01, 0x0B, 0x02, 0x01, 0x09, 0x04, 0x01,
+  0x07, 0x06, 0x01, 0x05, 0x08, 0x01, 0x03, 0x0A, 0x02, 0x01, 0x03, 0x05,
+  0x08, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06,
+  0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06,
+  0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06,
+  0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06,
+  0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06,
+  0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06,
+  0x07, 0x01, 0x05, 0x08, 0x01, 0x04, 0x0B, 0x01, 0x00, 0x12, 0x01, 0x08,
+  0x06, 0x01, 0x06, 0x0A, 0x01, 0x04, 0x0D, 0x01, 0x03, 0x0F, 0x01, 0x03,
+  0x0F, 0x02, 0x02, 0x03, 0x0A, 0x09, 0x02, 0x01, 0x03, 0x0B, 0x08, 0x02,
+  0x01, 0x02, 0x0C, 0x07, 0x02, 0x01, 0x01, 0x0C, 0x07, 0x01, 0x0D, 0x06,
+  0x01, 0x0D, 0x06, 0x01, 0x0D, 0x06, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x05,
+  0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x04, 0x01, 0x0B, 0x04,
+  0x01, 0x0B, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x04, 0x01, 0x09, 0x03,
+  0x01, 0x08, 0x03, 0x02, 0x07, 0x03, 0x14, 0x01, 0x02, 0x06, 0x03, 0x13,
+  0x02, 0x02, 0x05, 0x03, 0x13, 0x01, 0x02, 0x05, 0x02, 0x11, 0x03, 0x01,
+  0x04, 0x10, 0x01, 0x03, 0x11, 0x01, 0x02, 0x12, 0x01, 0x01, 0x12, 0x01,
+  0x00, 0x13, 0x01, 0x00, 0x13, 0x01, 0x08, 0x07, 0x01, 0x05, 0x0C, 0x01,
+  0x04, 0x0E, 0x02, 0x03, 0x02, 0x09, 0x0A, 0x02, 0x02, 0x01, 0x0B, 0x08,
+  0x02, 0x01, 0x02, 0x0B, 0x08, 0x02, 0x01, 0x01, 0x0C, 0x07, 0x01, 0x0C,
+  0x07, 0x01, 0x0C, 0x07, 0x01, 0x0C, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x0B,
+  0x06, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x07, 0x01, 0x08, 0x0A, 0x01, 0x07,
+  0x0C, 0x01, 0x09, 0x0B, 0x01, 0x0B, 0x09, 0x01, 0x0C, 0x09, 0x01, 0x0D,
+  0x08, 0x01, 0x0E, 0x07, 0x01, 0x0F, 0x06, 0x01, 0x0F, 0x06, 0x01, 0x10,
+  0x05, 0x01, 0x10, 0x05, 0x01, 0x10, 0x04, 0x01, 0x10, 0x04, 0x01, 0x10,
+  0x03, 0x02, 0x01, 0x04, 0x10, 0x03, 0x02, 0x00, 0x07, 0x0F, 0x03, 0x02,
+  0x00, 0x08, 0x0F, 0x02, 0x02, 0x00, 0x0A, 0x0D, 0x03, 0x01, 0x01, 0x0D,
+  0x01, 0x03, 0x08, 0x01, 0x0E, 0x04, 0x01, 0x0E, 0x04, 0x01, 0x0D, 0x05,
+  0x01, 0x0C, 0x06, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07, 0x01, 0x0A, 0x08,
+  0x02, 0x09, 0x02, 0x0C, 0x06, 0x02, 0x08, 0x03, 0x0C, 0x06, 0x02, 0x08,
+  0x02, 0x0C, 0x06, 0x02, 0x07, 0x02, 0x0C, 0x06, 0x02, 0x06, 0x03, 0x0C,
+  0x06, 0x02, 0x06, 0x02, 0x0C, 0x06, 0x02, 0x05, 0x02, 0x0C, 0x06, 0x02,
+  0x04, 0x03, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x0C, 0x06, 0x02, 0x03, 0x02,
+  0x0C, 0x06, 0x02, 0x02, 0x03, 0x0C, 0x06, 0x02, 0x01, 0x03, 0x0C, 0x06,
+  0x02, 0x01, 0x02, 0x0C, 0x06, 0x02, 0x00, 0x03, 0x0C, 0x06, 0x01, 0x00,
+  0x15, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15, 0x01, 0x00, 0x15, 0x01, 0x00,
+  0x15, 0x01, 0x0C, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x0C,
+  0x06, 0x01, 0x0C, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x05,
+  0x0F, 0x01, 0x05, 0x0F, 0x01, 0x04, 0x0F, 0x01, 0x04, 0x0F, 0x01, 0x04,
+  0x0F, 0x01, 0x03, 0x0F, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03,
+  0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x07, 0x01, 0x02, 0x0B, 0x01, 0x01,
+  0x0E, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x10, 0x01, 0x01, 0x11, 0x01, 0x01,
+  0x11, 0x01, 0x09, 0x09, 0x01, 0x0B, 0x08, 0x01, 0x0D, 0x06, 0x01, 0x0E,
+  0x05, 0x01, 0x0F, 0x04, 0x01, 0x10, 0x03, 0x01, 0x10, 0x03, 0x01, 0x10,
+  0x02, 0x01, 0x10, 0x02, 0x02, 0x01, 0x04, 0x10, 0x01, 0x02, 0x00, 0x07,
+  0x0F, 0x02, 0x02, 0x00, 0x09, 0x0D, 0x03, 0x01, 0x00, 0x0F, 0x01, 0x01,
+  0x0C, 0x01, 0x03, 0x08, 0x01, 0x12, 0x03, 0x01, 0x0E, 0x05, 0x01, 0x0B,
+  0x06, 0x01, 0x0A, 0x05, 0x01, 0x08, 0x06, 0x01, 0x07, 0x06, 0x01, 0x06,
+  0x06, 0x01, 0x05, 0x06, 0x01, 0x04, 0x07, 0x01, 0x03, 0x07, 0x01, 0x02,
+  0x08, 0x01, 0x02, 0x07, 0x01, 0x01, 0x08, 0x01, 0x01, 0x0E, 0x01, 0x01,
+  0x10, 0x02, 0x00, 0x09, 0x0C, 0x07, 0x02, 0x00, 0x08, 0x0D, 0x06, 0x02,
+  0x00, 0x08, 0x0D, 0x07, 0x02, 0x00, 0x08, 0x0D, 0x07, 0x02, 0x00, 0x08,
+  0x0E, 0x07, 0x02, 0x00, 0x08, 0x0E, 0x07, 0x02, 0x00, 0x08, 0x0E, 0x07,
+  0x02, 0x00, 0x08, 0x0E, 0x07, 0x02, 0x00, 0x08, 0x0E, 0x07, 0x02, 0x00,
+  0x08, 0x0E, 0x07, 0x02, 0x01, 0x07, 0x0E, 0x07, 0x02, 0x01, 0x07, 0x0E,
+  0x07, 0x02, 0x01, 0x07, 0x0E, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x02,
+  0x02, 0x07, 0x0E, 0x05, 0x02, 0x03, 0x06, 0x0E, 0x04, 0x02, 0x04, 0x05,
+  0x0D, 0x05, 0x02, 0x06, 0x04, 0x0D, 0x03, 0x01, 0x08, 0x06, 0x01, 0x02,
+  0x13, 0x01, 0x02, 0x13, 0x01, 0x01, 0x14, 0x01, 0x01, 0x13, 0x01, 0x01,
+  0x13, 0x01, 0x01, 0x13, 0x02, 0x01, 0x02, 0x0F, 0x04, 0x02, 0x00, 0x02,
+  0x0F, 0x04, 0x02, 0x00, 0x02, 0x0E, 0x05, 0x02, 0x00, 0x01, 0x0E, 0x04,
+  0x01, 0x0E, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04,
+  0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0B, 0x04,
+  0x01, 0x0B, 0x04, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04,
+  0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08, 0x05,
+  0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04,
+  0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x07, 0x08, 0x02, 0x05, 0x03,
+  0x0C, 0x05, 0x02, 0x03, 0x04, 0x0E, 0x04, 0x02, 0x02, 0x04, 0x0E, 0x05,
+  0x02, 0x02, 0x04, 0x0F, 0x05, 0x02, 0x01, 0x05, 0x0F, 0x05, 0x02, 0x01,
+  0x05, 0x0F, 0x05, 0x02, 0x01, 0x06, 0x0F, 0x05, 0x02, 0x01, 0x06, 0x0F,
+  0x05, 0x02, 0x01, 0x07, 0x0F, 0x04, 0x02, 0x01, 0x08, 0x0E, 0x05, 0x02,
+  0x02, 0x09, 0x0E, 0x04, 0x01, 0x02, 0x0E, 0x01, 0x03, 0x0B, 0x01, 0x03,
+  0x0D, 0x01, 0x04, 0x0D, 0x01, 0x06, 0x0C, 0x01, 0x06, 0x0D, 0x02, 0x04,
+  0x03, 0x08, 0x0C, 0x02, 0x02, 0x05, 0x0A, 0x0A, 0x02, 0x01, 0x05, 0x0B,
+  0x09, 0x02, 0x01, 0x05, 0x0C, 0x09, 0x02, 0x00, 0x05, 0x0D, 0x08, 0x02,
+  0x00, 0x05, 0x0E, 0x07, 0x02, 0x00, 0x05, 0x0E, 0x07, 0x02, 0x00, 0x05,
+  0x0F, 0x06, 0x02, 0x00, 0x05, 0x0F, 0x06, 0x02, 0x00, 0x05, 0x0F, 0x05,
+  0x02, 0x01, 0x04, 0x0F, 0x05, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x02, 0x02,
+  0x05, 0x0E, 0x05, 0x02, 0x03, 0x05, 0x0C, 0x06, 0x01, 0x04, 0x0C, 0x01,
+  0x06, 0x08, 0x01, 0x07, 0x07, 0x02, 0x05, 0x03, 0x0C, 0x04, 0x02, 0x04,
+  0x04, 0x0D, 0x04, 0x02, 0x03, 0x04, 0x0D, 0x06, 0x02, 0x02, 0x05, 0x0D,
+  0x06, 0x02, 0x01, 0x06, 0x0E, 0x06, 0x02, 0x01, 0x06, 0x0E, 0x06, 0x02,
+  0x00, 0x07, 0x0E, 0x07, 0x02, 0x00, 0x07, 0x0E, 0x07, 0x02, 0x00, 0x07,
+  0x0E, 0x08, 0x02, 0x00, 0x07, 0x0E, 0x08, 0x02, 0x00, 0x07, 0x0E, 0x08,
+  0x02, 0x00, 0x07, 0x0E, 0x08, 0x02, 0x00, 0x07, 0x0E, 0x08, 0x02, 0x00,
+  0x07, 0x0E, 0x08, 0x02, 0x01, 0x07, 0x0E, 0x08, 0x02, 0x01, 0x07, 0x0E,
+  0x08, 0x02, 0x02, 0x06, 0x0E, 0x08, 0x02, 0x02, 0x08, 0x0D, 0x08, 0x01,
+  0x04, 0x11, 0x02, 0x05, 0x07, 0x0D, 0x08, 0x01, 0x0D, 0x07, 0x01, 0x0C,
+  0x08, 0x01, 0x0C, 0x07, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x07, 0x01, 0x0A,
+  0x07, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x06, 0x01, 0x08, 0x06, 0x01, 0x06,
+  0x06, 0x01, 0x05, 0x05, 0x01, 0x02, 0x06, 0x01, 0x00, 0x03, 0x01, 0x02,
+  0x04, 0x01, 0x01, 0x06, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00,
+  0x08, 0x01, 0x00, 0x08, 0x01, 0x01, 0x06, 0x01, 0x02, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x01, 0x01, 0x06,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08,
+  0x01, 0x01, 0x06, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x06,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08,
+  0x01, 0x01, 0x06, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x02, 0x04, 0x01, 0x01, 0x07, 0x01, 0x00, 0x08, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x01, 0x01, 0x08, 0x01, 0x02,
+  0x07, 0x01, 0x06, 0x03, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x05,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x01, 0x01, 0x18, 0x02, 0x01, 0x16, 0x04, 0x01, 0x14, 0x06, 0x01, 0x12,
+  0x08, 0x01, 0x10, 0x0A, 0x01, 0x0D, 0x0A, 0x01, 0x0B, 0x0A, 0x01, 0x09,
+  0x0A, 0x01, 0x07, 0x0A, 0x01, 0x05, 0x0A, 0x01, 0x03, 0x0A, 0x01, 0x01,
+  0x0A, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x01, 0x01, 0x0A, 0x01, 0x03,
+  0x0A, 0x01, 0x05, 0x0A, 0x01, 0x07, 0x0A, 0x01, 0x09, 0x0B, 0x01, 0x0C,
+  0x0A, 0x01, 0x0E, 0x0A, 0x01, 0x10, 0x0A, 0x01, 0x12, 0x08, 0x01, 0x14,
+  0x06, 0x01, 0x16, 0x04, 0x01, 0x18, 0x02, 0x01, 0x00, 0x1A, 0x01, 0x00,
+  0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01,
+  0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x1A, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x06, 0x01, 0x00, 0x08, 0x01, 0x00, 0x0A, 0x01,
+  0x02, 0x0A, 0x01, 0x04, 0x0A, 0x01, 0x06, 0x0B, 0x01, 0x09, 0x0A, 0x01,
+  0x0B, 0x0A, 0x01, 0x0D, 0x0A, 0x01, 0x0F, 0x0A, 0x01, 0x11, 0x09, 0x01,
+  0x11, 0x09, 0x01, 0x0F, 0x0A, 0x01, 0x0D, 0x0A, 0x01, 0x0B, 0x0A, 0x01,
+  0x09, 0x0A, 0x01, 0x07, 0x0A, 0x01, 0x05, 0x0A, 0x01, 0x03, 0x0A, 0x01,
+  0x00, 0x0A, 0x01, 0x00, 0x08, 0x01, 0x00, 0x06, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x02, 0x01, 0x05, 0x07, 0x01, 0x03, 0x0B, 0x02, 0x02, 0x03, 0x09,
+  0x06, 0x02, 0x01, 0x03, 0x0A, 0x06, 0x02, 0x00, 0x04, 0x0A, 0x07, 0x02,
+  0x00, 0x05, 0x0B, 0x06, 0x02, 0x00, 0x06, 0x0B, 0x07, 0x02, 0x00, 0x06,
+  0x0B, 0x07, 0x02, 0x00, 0x06, 0x0B, 0x07, 0x02, 0x01, 0x05, 0x0B, 0x07,
+  0x02, 0x01, 0x04, 0x0B, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01,
+  0x09, 0x07, 0x01, 0x09, 0x06, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01,
+  0x07, 0x03, 0x01, 0x07, 0x02, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01,
+  0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x04, 0x01, 0x05, 0x06,
+  0x01, 0x04, 0x08, 0x01, 0x04, 0x08, 0x01, 0x04, 0x08, 0x01, 0x04, 0x08,
+  0x01, 0x05, 0x06, 0x01, 0x06, 0x04, 0x01, 0x0E, 0x08, 0x01, 0x0A, 0x0F,
+  0x02, 0x09, 0x05, 0x16, 0x04, 0x02, 0x07, 0x05, 0x18, 0x04, 0x02, 0x06,
+  0x04, 0x1A, 0x03, 0x02, 0x05, 0x04, 0x1B, 0x03, 0x02, 0x04, 0x04, 0x1C,
+  0x02, 0x02, 0x03, 0x05, 0x1D, 0x02, 0x04, 0x02, 0x05, 0x12, 0x04, 0x1A,
+  0x02, 0x1D, 0x03, 0x04, 0x02, 0x05, 0x10, 0x06, 0x17, 0x04, 0x1E, 0x02,
+  0x04, 0x01, 0x05, 0x0F, 0x05, 0x16, 0x05, 0x1E, 0x02, 0x04, 0x01, 0x05,
+  0x0E, 0x04, 0x16, 0x05, 0x1F, 0x02, 0x04, 0x01, 0x05, 0x0D, 0x05, 0x16,
+  0x04, 0x1F, 0x02, 0x04, 0x00, 0x05, 0x0D, 0x04, 0x16, 0x04, 0x1F, 0x02,
+  0x04, 0x00, 0x05, 0x0C, 0x04, 0x16, 0x04, 0x1F, 0x02, 0x04, 0x00, 0x05,
+  0x0B, 0x05, 0x15, 0x04, 0x1F, 0x02, 0x04, 0x00, 0x05, 0x0B, 0x04, 0x15,
+  0x04, 0x1F, 0x02, 0x04, 0x00, 0x05, 0x0B, 0x04, 0x15, 0x04, 0x1F, 0x02,
+  0x04, 0x00, 0x05, 0x0A, 0x04, 0x14, 0x05, 0x1F, 0x02, 0x04, 0x00, 0x05,
+  0x0A, 0x04, 0x14, 0x04, 0x1E, 0x02, 0x04, 0x00, 0x05, 0x0A, 0x04, 0x13,
+  0x05, 0x1E, 0x02, 0x05, 0x00, 0x05, 0x0A, 0x04, 0x12, 0x01, 0x14, 0x04,
+  0x1D, 0x02, 0x05, 0x01, 0x05, 0x0A, 0x05, 0x11, 0x02, 0x14, 0x04, 0x1D,
+  0x02, 0x04, 0x01, 0x05, 0x0B, 0x07, 0x14, 0x04, 0x1B, 0x03, 0x03, 0x02,
+  0x04, 0x0C, 0x04, 0x14, 0x09, 0x02, 0x02, 0x05, 0x16, 0x05, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x05, 0x01, 0x04, 0x05, 0x01, 0x05, 0x05, 0x02, 0x07,
+  0x05, 0x1A, 0x02, 0x02, 0x08, 0x06, 0x17, 0x05, 0x01, 0x0A, 0x10, 0x01,
+  0x0D, 0x0A, 0x01, 0x0F, 0x02, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01,
+  0x0E, 0x04, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x06, 0x01, 0x0C, 0x07, 0x01,
+  0x0C, 0x07, 0x01, 0x0C, 0x08, 0x01, 0x0B, 0x09, 0x01, 0x0B, 0x0A, 0x02,
+  0x0A, 0x02, 0x0D, 0x08, 0x02, 0x0A, 0x02, 0x0E, 0x07, 0x02, 0x0A, 0x02,
+  0x0E, 0x08, 0x02, 0x09, 0x02, 0x0F, 0x07, 0x02, 0x09, 0x02, 0x0F, 0x08,
+  0x02, 0x08, 0x02, 0x0F, 0x08, 0x02, 0x08, 0x02, 0x10, 0x08, 0x02, 0x08,
+  0x02, 0x10, 0x08, 0x02, 0x07, 0x02, 0x11, 0x07, 0x02, 0x07, 0x02, 0x11,
+  0x08, 0x02, 0x06, 0x03, 0x11, 0x08, 0x01, 0x06, 0x14, 0x01, 0x06, 0x14,
+  0x02, 0x05, 0x03, 0x12, 0x08, 0x02, 0x05, 0x02, 0x13, 0x08, 0x02, 0x04,
+  0x03, 0x13, 0x08, 0x02, 0x04, 0x02, 0x14, 0x08, 0x02, 0x04, 0x02, 0x14,
+  0x08, 0x02, 0x03, 0x03, 0x14, 0x09, 0x02, 0x03, 0x03, 0x14, 0x09, 0x02,
+  0x01, 0x06, 0x14, 0x0A, 0x02, 0x00, 0x09, 0x11, 0x0F, 0x01, 0x00, 0x14,
+  0x01, 0x00, 0x17, 0x02, 0x03, 0x0A, 0x11, 0x07, 0x02, 0x04, 0x08, 0x12,
+  0x08, 0x02, 0x04, 0x08, 0x12, 0x08, 0x02, 0x04, 0x08, 0x13, 0x08, 0x02,
+  0x04, 0x08, 0x13, 0x08, 0x02, 0x04, 0x08, 0x13, 0x08, 0x02, 0x04, 0x08,
+  0x13, 0x08, 0x02, 0x04, 0x08, 0x13, 0x08, 0x02, 0x04, 0x08, 0x13, 0x07,
+  0x02, 0x04, 0x08, 0x12, 0x08, 0x02, 0x04, 0x08, 0x12, 0x06, 0x02, 0x04,
+  0x08, 0x10, 0x06, 0x01, 0x04, 0x0F, 0x01, 0x04, 0x12, 0x02, 0x04, 0x08,
+  0x10, 0x08, 0x02, 0x04, 0x08, 0x12, 0x08, 0x02, 0x04, 0x08, 0x13, 0x08,
+  0x02, 0x04, 0x08, 0x13, 0x08, 0x02, 0x04, 0x08, 0x14, 0x08, 0x02, 0x04,
+  0x08, 0x14, 0x08, 0x02, 0x04, 0x08, 0x14, 0x08, 0x02, 0x04, 0x08, 0x14,
+  0x08, 0x02, 0x04, 0x08, 0x14, 0x08, 0x02, 0x04, 0x08, 0x14, 0x08, 0x02,
+  0x04, 0x08, 0x14, 0x07, 0x02, 0x04, 0x08, 0x13, 0x08, 0x02, 0x04, 0x08,
+  0x13, 0x07, 0x02, 0x04, 0x09, 0x11, 0x07, 0x01, 0x02, 0x15, 0x01, 0x00,
+  0x14, 0x02, 0x0C, 0x08, 0x1C, 0x01, 0x02, 0x09, 0x0D, 0x1B, 0x02, 0x03,
+  0x08, 0x06, 0x13, 0x06, 0x1B, 0x02, 0x02, 0x06, 0x06, 0x15, 0x08, 0x02,
+  0x05, 0x06, 0x17, 0x06, 0x02, 0x04, 0x06, 0x18, 0x05, 0x02, 0x03, 0x07,
+  0x19, 0x04, 0x02, 0x03, 0x06, 0x19, 0x04, 0x02, 0x02, 0x07, 0x1A, 0x03,
+  0x02, 0x02, 0x07, 0x1B, 0x02, 0x02, 0x01, 0x08, 0x1B, 0x02, 0x02, 0x01,
+  0x07, 0x1C, 0x01, 0x01, 0x01, 0x07, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x01, 0x07,
+  0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x01, 0x02, 0x07, 0x02, 0x02, 0x07,
+  0x1C, 0x01, 0x02, 0x03, 0x07, 0x1B, 0x03, 0x02, 0x04, 0x07, 0x1A, 0x03,
+  0x02, 0x05, 0x06, 0x19, 0x03, 0x02, 0x06, 0x06, 0x17, 0x04, 0x02, 0x07,
+  0x07, 0x15, 0x04, 0x01, 0x09, 0x0F, 0x01, 0x0C, 0x09, 0x01, 0x00, 0x13,
+  0x01, 0x02, 0x15, 0x02, 0x04, 0x09, 0x11, 0x08, 0x02, 0x04, 0x08, 0x13,
+  0x07, 0x02, 0x04, 0x08, 0x14, 0x08, 0x02, 0x04, 0x08, 0x15, 0x07, 0x02,
+  0x04, 0x08, 0x16, 0x07, 0x02, 0x04, 0x08, 0x16, 0x08, 0x02, 0x04, 0x08,
+  0x17, 0x07, 0x02, 0x04, 0x08, 0x17, 0x08, 0x02, 0x04, 0x08, 0x17, 0x08,
+  0x02, 0x04, 0x08, 0x18, 0x08, 0x02, 0x04, 0x08, 0x18, 0x08, 0x02, 0x04,
+  0x08, 0x18, 0x08, 0x02, 0x04, 0x08, 0x18, 0x08, 0x02, 0x04, 0x08, 0x18,
+  0x08, 0x02, 0x04, 0x08, 0x18, 0x08, 0x02, 0x04, 0x08, 0x18, 0x08, 0x02,
+  0x04, 0x08, 0x18, 0x08, 0x02, 0x04, 0x08, 0x18, 0x08, 0x02, 0x04, 0x08,
+  0x18, 0x07, 0x02, 0x04, 0x08, 0x18, 0x07, 0x02, 0x04, 0x08, 0x17, 0x08,
+  0x02, 0x04, 0x08, 0x17, 0x07, 0x02, 0x04, 0x08, 0x17, 0x07, 0x02, 0x04,
+  0x08, 0x16, 0x07, 0x02, 0x04, 0x08, 0x16, 0x06, 0x02, 0x04, 0x08, 0x15,
+  0x06, 0x02, 0x04, 0x08, 0x14, 0x06, 0x02, 0x04, 0x09, 0x12, 0x07, 0x01,
+  0x03, 0x14, 0x01, 0x00, 0x14, 0x01, 0x00, 0x1A, 0x01, 0x02, 0x18, 0x02,
+  0x03, 0x08, 0x13, 0x07, 0x02, 0x03, 0x08, 0x16, 0x04, 0x02, 0x03, 0x08,
+  0x17, 0x03, 0x02, 0x03, 0x08, 0x18, 0x02, 0x02, 0x03, 0x08, 0x18, 0x02,
+  0x02, 0x03, 0x08, 0x19, 0x01, 0x03, 0x03, 0x08, 0x12, 0x01, 0x19, 0x01,
+  0x02, 0x03, 0x08, 0x12, 0x01, 0x02, 0x03, 0x08, 0x11, 0x02, 0x02, 0x03,
+  0x08, 0x11, 0x02, 0x02, 0x03, 0x08, 0x10, 0x03, 0x02, 0x03, 0x08, 0x0F,
+  0x04, 0x01, 0x03, 0x10, 0x01, 0x03, 0x10, 0x02, 0x03, 0x08, 0x0E, 0x05,
+  0x02, 0x03, 0x08, 0x10, 0x03, 0x02, 0x03, 0x08, 0x11, 0x02, 0x02, 0x03,
+  0x08, 0x11, 0x02, 0x02, 0x03, 0x08, 0x12, 0x01, 0x02, 0x03, 0x08, 0x12,
+  0x01, 0x02, 0x03, 0x08, 0x1B, 0x01, 0x02, 0x03, 0x08, 0x1A, 0x02, 0x02,
+  0x03, 0x08, 0x19, 0x03, 0x02, 0x03, 0x08, 0x19, 0x03, 0x02, 0x03, 0x08,
+  0x18, 0x03, 0x02, 0x03, 0x08, 0x17, 0x04, 0x02, 0x03, 0x08, 0x16, 0x05,
+  0x02, 0x02, 0x0A, 0x13, 0x08, 0x01, 0x00, 0x1B, 0x01, 0x00, 0x1B, 0x01,
+  0x00, 0x19, 0x01, 0x02, 0x17, 0x02, 0x03, 0x09, 0x13, 0x06, 0x02, 0x03,
+  0x08, 0x15, 0x04, 0x02, 0x03, 0x08, 0x16, 0x03, 0x02, 0x03, 0x08, 0x17,
+  0x02, 0x02, 0x03, 0x08, 0x17, 0x02, 0x02, 0x03, 0x08, 0x18, 0x01, 0x03,
+  0x03, 0x08, 0x12, 0x01, 0x18, 0x01, 0x02, 0x03, 0x08, 0x12, 0x01, 0x02,
+  0x03, 0x08, 0x11, 0x02, 0x02, 0x03, 0x08, 0x11, 0x02, 0x02, 0x03, 0x08,
+  0x10, 0x03, 0x02, 0x03, 0x08, 0x0E, 0x05, 0x01, 0x03, 0x10, 0x01, 0x03,
+  0x10, 0x02, 0x03, 0x08, 0x0E, 0x05, 0x02, 0x03, 0x08, 0x10, 0x03, 0x02,
+  0x03, 0x08, 0x11, 0x02, 0x02, 0x03, 0x08, 0x11, 0x02, 0x02, 0x03, 0x08,
+  0x12, 0x01, 0x02, 0x03, 0x08, 0x12, 0x01, 0x01, 0x03, 0x08, 0x01, 0x03,
+  0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03,
+  0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x02, 0x0A, 0x01, 0x00,
+  0x0F, 0x02, 0x0C, 0x08, 0x1C, 0x01, 0x02, 0x09, 0x0D, 0x1B, 0x02, 0x03,
+  0x08, 0x06, 0x13, 0x05, 0x1B, 0x02, 0x02, 0x06, 0x06, 0x15, 0x08, 0x02,
+  0x05, 0x06, 0x17, 0x06, 0x02, 0x04, 0x06, 0x18, 0x05, 0x02, 0x03, 0x07,
+  0x19, 0x04, 0x02, 0x03, 0x06, 0x1A, 0x03, 0x02, 0x02, 0x07, 0x1A, 0x03,
+  0x02, 0x02, 0x07, 0x1B, 0x02, 0x02, 0x01, 0x08, 0x1B, 0x02, 0x02, 0x01,
+  0x07, 0x1C, 0x01, 0x01, 0x01, 0x07, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x08, 0x02, 0x00, 0x08, 0x12, 0x0F, 0x02, 0x00, 0x08, 0x15,
+  0x0A, 0x02, 0x01, 0x07, 0x16, 0x08, 0x02, 0x01, 0x08, 0x16, 0x08, 0x02,
+  0x01, 0x08, 0x16, 0x08, 0x02, 0x02, 0x07, 0x16, 0x08, 0x02, 0x02, 0x07,
+  0x16, 0x08, 0x02, 0x03, 0x07, 0x16, 0x08, 0x02, 0x04, 0x06, 0x16, 0x08,
+  0x02, 0x05, 0x06, 0x16, 0x08, 0x02, 0x06, 0x06, 0x16, 0x08, 0x02, 0x07,
+  0x07, 0x14, 0x09, 0x01, 0x09, 0x11, 0x01, 0x0C, 0x0A, 0x02, 0x00, 0x0E,
+  0x13, 0x0E, 0x02, 0x02, 0x0A, 0x15, 0x0A, 0x02, 0x03, 0x08, 0x16, 0x08,
+  0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x03,
+  0x08, 0x16, 0x08, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x03, 0x08, 0x16,
+  0x08, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02,
+  0x03, 0x08, 0x16, 0x08, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x03, 0x08,
+  0x16, 0x08, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x03, 0x08, 0x16, 0x08,
+  0x01, 0x03, 0x1B, 0x01, 0x03, 0x1B, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02,
+  0x03, 0x08, 0x16, 0x08, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x03, 0x08,
+  0x16, 0x08, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x03, 0x08, 0x16, 0x08,
+  0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x03,
+  0x08, 0x16, 0x08, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x03, 0x08, 0x16,
+  0x08, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02, 0x03, 0x08, 0x16, 0x08, 0x02,
+  0x02, 0x0A, 0x15, 0x0A, 0x02, 0x00, 0x0E, 0x13, 0x0E, 0x01, 0x00, 0x0F,
+  0x01, 0x02, 0x0A, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08,
+  0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08,
+  0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08,
+  0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08,
+  0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08,
+  0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08,
+  0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08,
+  0x01, 0x03, 0x08, 0x01, 0x02, 0x0A, 0x01, 0x00, 0x0F, 0x01, 0x07, 0x0F,
+  0x01, 0x0A, 0x0A, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08,
+  0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08,
+  0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08,
+  0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08,
+  0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08,
+  0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08,
+  0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x08, 0x02, 0x01, 0x04,
+  0x0B, 0x08, 0x02, 0x00, 0x06, 0x0B, 0x08, 0x02, 0x00, 0x06, 0x0B, 0x07,
+  0x02, 0x00, 0x06, 0x0B, 0x07, 0x02, 0x00, 0x06, 0x0B, 0x07, 0x02, 0x01,
+  0x04, 0x0A, 0x07, 0x02, 0x01, 0x05, 0x0A, 0x06, 0x01, 0x02, 0x0D, 0x01,
+  0x05, 0x07, 0x02, 0x00, 0x0E, 0x13, 0x0D, 0x02, 0x02, 0x0A, 0x16, 0x08,
+  0x02, 0x03, 0x08, 0x17, 0x04, 0x02, 0x03, 0x08, 0x17, 0x03, 0x02, 0x03,
+  0x08, 0x16, 0x03, 0x02, 0x03, 0x08, 0x15, 0x03, 0x02, 0x03, 0x08, 0x14,
+  0x03, 0x02, 0x03, 0x08, 0x13, 0x03, 0x02, 0x03, 0x08, 0x12, 0x03, 0x02,
+  0x03, 0x08, 0x11, 0x03, 0x02, 0x03, 0x08, 0x10, 0x03, 0x02, 0x03, 0x08,
+  0x0F, 0x03, 0x02, 0x03, 0x08, 0x0E, 0x04, 0x02, 0x03, 0x08, 0x0D, 0x06,
+  0x02, 0x03, 0x08, 0x0C, 0x07, 0x01, 0x03, 0x11, 0x01, 0x03, 0x12, 0x02,
+  0x03, 0x09, 0x0D, 0x09, 0x02, 0x03, 0x08, 0x0D, 0x0A, 0x02, 0x03, 0x08,
+  0x0E, 0x09, 0x02, 0x03, 0x08, 0x0F, 0x09, 0x02, 0x03, 0x08, 0x10, 0x09,
+  0x02, 0x03, 0x08, 0x11, 0x09, 0x02, 0x03, 0x08, 0x11, 0x0A, 0x02, 0x03,
+  0x08, 0x12, 0x09, 0x02, 0x03, 0x08, 0x13, 0x09, 0x02, 0x03, 0x08, 0x14,
+  0x09, 0x02, 0x03, 0x08, 0x15, 0x09, 0x02, 0x03, 0x08, 0x15, 0x0A, 0x02,
+  0x03, 0x08, 0x16, 0x09, 0x02, 0x02, 0x0A, 0x16, 0x0A, 0x02, 0x00, 0x0E,
+  0x12, 0x10, 0x01, 0x00, 0x0F, 0x01, 0x02, 0x0A, 0x01, 0x03, 0x08, 0x01,
+  0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01,
+  0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01,
+  0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01,
+  0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01,
+  0x03, 0x08, 0x01, 0x03, 0x08, 0x02, 0x03, 0x08, 0x1B, 0x01, 0x02, 0x03,
+  0x08, 0x1A, 0x02, 0x02, 0x03, 0x08, 0x1A, 0x02, 0x02, 0x03, 0x08, 0x19,
+  0x03, 0x02, 0x03, 0x08, 0x19, 0x03, 0x02, 0x03, 0x08, 0x18, 0x03, 0x02,
+  0x03, 0x08, 0x17, 0x04, 0x02, 0x03, 0x08, 0x15, 0x06, 0x02, 0x02, 0x0A,
+  0x13, 0x08, 0x01, 0x00, 0x1B, 0x01, 0x00, 0x1B, 0x02, 0x01, 0x0B, 0x1F,
+  0x0C, 0x02, 0x04, 0x09, 0x1F, 0x0A, 0x02, 0x05, 0x08, 0x1E, 0x0A, 0x02,
+  0x05, 0x08, 0x1E, 0x0A, 0x03, 0x05, 0x09, 0x1E, 0x01, 0x20, 0x08, 0x04,
+  0x05, 0x01, 0x07, 0x07, 0x1D, 0x02, 0x20, 0x08, 0x04, 0x05, 0x01, 0x07,
+  0x08, 0x1D, 0x02, 0x20, 0x08, 0x04, 0x05, 0x01, 0x08, 0x07, 0x1C, 0x02,
+  0x20, 0x08, 0x04, 0x05, 0x01, 0x08, 0x08, 0x1C, 0x02, 0x20, 0x08, 0x04,
+  0x05, 0x01, 0x09, 0x07, 0x1B, 0x02, 0x20, 0x08, 0x04, 0x05, 0x01, 0x09,
+  0x08, 0x1B, 0x02, 0x20, 0x08, 0x04, 0x05, 0x01, 0x09, 0x08, 0x1B, 0x01,
+  0x20, 0x08, 0x04, 0x05, 0x01, 0x0A, 0x07, 0x1A, 0x02, 0x20, 0x08, 0x04,
+  0x05, 0x01, 0x0A, 0x08, 0x1A, 0x02, 0x20, 0x08, 0x04, 0x05, 0x01, 0x0B,
+  0x07, 0x19, 0x02, 0x20, 0x08, 0x04, 0x05, 0x01, 0x0B, 0x08, 0x19, 0x02,
+  0x20, 0x08, 0x04, 0x05, 0x01, 0x0C, 0x07, 0x18, 0x02, 0x20, 0x08, 0x04,
+  0x05, 0x01, 0x0C, 0x08, 0x18, 0x02, 0x20, 0x08, 0x04, 0x05, 0x01, 0x0C,
+  0x08, 0x17, 0x02, 0x20, 0x08, 0x04, 0x05, 0x01, 0x0D, 0x07, 0x17, 0x02,
+  0x20, 0x08, 0x04, 0x05, 0x01, 0x0D, 0x08, 0x17, 0x02, 0x20, 0x08, 0x04,
+  0x05, 0x01, 0x0E, 0x07, 0x16, 0x02, 0x20, 0x08, 0x03, 0x05, 0x01, 0x0E,
+  0x0A, 0x20, 0x08, 0x03, 0x05, 0x01, 0x0F, 0x08, 0x20, 0x08, 0x03, 0x05,
+  0x01, 0x0F, 0x08, 0x20, 0x08, 0x03, 0x05, 0x01, 0x10, 0x06, 0x20, 0x08,
+  0x03, 0x05, 0x01, 0x10, 0x06, 0x20, 0x08, 0x03, 0x05, 0x01, 0x10, 0x06,
+  0x20, 0x08, 0x03, 0x05, 0x01, 0x11, 0x04, 0x20, 0x08, 0x03, 0x05, 0x02,
+  0x11, 0x04, 0x20, 0x08, 0x03, 0x03, 0x05, 0x12, 0x02, 0x1F, 0x0A, 0x03,
+  0x00, 0x0B, 0x12, 0x02, 0x1D, 0x0E, 0x02, 0x00, 0x0A, 0x16, 0x09, 0x02,
+  0x01, 0x0A, 0x18, 0x05, 0x02, 0x02, 0x0A, 0x19, 0x03, 0x02, 0x03, 0x0A,
+  0x1A, 0x02, 0x02, 0x04, 0x09, 0x1A, 0x02, 0x02, 0x04, 0x0A, 0x1A, 0x02,
+  0x02, 0x04, 0x0B, 0x1A, 0x02, 0x02, 0x04, 0x0C, 0x1A, 0x02, 0x03, 0x04,
+  0x02, 0x07, 0x0A, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x08, 0x09, 0x1A, 0x02,
+  0x03, 0x04, 0x02, 0x09, 0x09, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x0A, 0x09,
+  0x1A, 0x02, 0x03, 0x04, 0x02, 0x0B, 0x09, 0x1A, 0x02, 0x03, 0x04, 0x02,
+  0x0B, 0x0A, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x0C, 0x09, 0x1A, 0x02, 0x03,
+  0x04, 0x02, 0x0D, 0x09, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x0E, 0x09, 0x1A,
+  0x02, 0x03, 0x04, 0x02, 0x0F, 0x09, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x10,
+  0x09, 0x1A, 0x02, 0x03, 0x04, 0x02, 0x10, 0x09, 0x1A, 0x02, 0x02, 0x04,
+  0x02, 0x11, 0x0B, 0x02, 0x04, 0x02, 0x12, 0x0A, 0x02, 0x04, 0x02, 0x13,
+  0x09, 0x02, 0x04, 0x02, 0x14, 0x08, 0x02, 0x04, 0x02, 0x15, 0x07, 0x02,
+  0x04, 0x02, 0x15, 0x07, 0x02, 0x04, 0x02, 0x16, 0x06, 0x02, 0x04, 0x02,
+  0x17, 0x05, 0x02, 0x04, 0x02, 0x18, 0x04, 0x02, 0x04, 0x03, 0x19, 0x03,
+  0x02, 0x02, 0x06, 0x19, 0x03, 0x02, 0x00, 0x0A, 0x1A, 0x02, 0x01, 0x0C,
+  0x09, 0x01, 0x09, 0x0F, 0x02, 0x08, 0x06, 0x13, 0x07, 0x02, 0x06, 0x06,
+  0x15, 0x06, 0x02, 0x05, 0x06, 0x16, 0x06, 0x02, 0x04, 0x06, 0x16, 0x07,
+  0x02, 0x03, 0x07, 0x17, 0x07, 0x02, 0x03, 0x06, 0x17, 0x07, 0x02, 0x02,
+  0x07, 0x18, 0x07, 0x02, 0x01, 0x08, 0x18, 0x07, 0x02, 0x01, 0x08, 0x18,
+  0x08, 0x02, 0x01, 0x07, 0x19, 0x07, 0x02, 0x00, 0x08, 0x19, 0x07, 0x02,
+  0x00, 0x08, 0x19, 0x08, 0x02, 0x00, 0x08, 0x19, 0x08, 0x02, 0x00, 0x08,
+  0x19, 0x08, 0x02, 0x00, 0x08, 0x19, 0x08, 0x02, 0x00, 0x08, 0x19, 0x08,
+  0x02, 0x00, 0x08, 0x19, 0x08, 0x02, 0x00, 0x08, 0x19, 0x08, 0x02, 0x00,
+  0x08, 0x19, 0x08, 0x02, 0x00, 0x08, 0x19, 0x08, 0x02, 0x01, 0x07, 0x19,
+  0x07, 0x02, 0x01, 0x07, 0x18, 0x08, 0x02, 0x01, 0x08, 0x18, 0x08, 0x02,
+  0x02, 0x07, 0x18, 0x07, 0x02, 0x02, 0x07, 0x18, 0x07, 0x02, 0x03, 0x07,
+  0x17, 0x07, 0x02, 0x04, 0x06, 0x17, 0x06, 0x02, 0x05, 0x06, 0x16, 0x06,
+  0x02, 0x06, 0x06, 0x15, 0x06, 0x02, 0x07, 0x07, 0x13, 0x07, 0x01, 0x09,
+  0x0F, 0x01, 0x0C, 0x09, 0x01, 0x00, 0x13, 0x01, 0x01, 0x15, 0x02, 0x03,
+  0x08, 0x0F, 0x08, 0x02, 0x03, 0x08, 0x11, 0x07, 0x02, 0x03, 0x08, 0x11,
+  0x08, 0x02, 0x03, 0x08, 0x12, 0x07, 0x02, 0x03, 0x08, 0x12, 0x08, 0x02,
+  0x03, 0x08, 0x12, 0x08, 0x02, 0x03, 0x08, 0x12, 0x08, 0x02, 0x03, 0x08,
+  0x12, 0x08, 0x02, 0x03, 0x08, 0x12, 0x08, 0x02, 0x03, 0x08, 0x12, 0x08,
+  0x02, 0x03, 0x08, 0x12, 0x07, 0x02, 0x03, 0x08, 0x11, 0x08, 0x02, 0x03,
+  0x08, 0x11, 0x07, 0x02, 0x03, 0x08, 0x0F, 0x08, 0x01, 0x03, 0x12, 0x01,
+  0x03, 0x10, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01,
+  0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01,
+  0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01,
+  0x03, 0x08, 0x01, 0x02, 0x0A, 0x01, 0x00, 0x0E, 0x01, 0x0C, 0x09, 0x01,
+  0x09, 0x0F, 0x02, 0x08, 0x06, 0x13, 0x06, 0x02, 0x06, 0x06, 0x15, 0x06,
+  0x02, 0x05, 0x06, 0x16, 0x06, 0x02, 0x04, 0x06, 0x16, 0x07, 0x02, 0x03,
+  0x07, 0x17, 0x07, 0x02, 0x03, 0x06, 0x17, 0x07, 0x02, 0x02, 0x07, 0x18,
+  0x07, 0x02, 0x02, 0x07, 0x18, 0x07, 0x02, 0x01, 0x08, 0x18, 0x08, 0x02,
+  0x01, 0x07, 0x19, 0x07, 0x02, 0x01, 0x07, 0x19, 0x07, 0x02, 0x00, 0x08,
+  0x19, 0x08, 0x02, 0x00, 0x08, 0x19, 0x08, 0x02, 0x00, 0x08, 0x19, 0x08,
+  0x02, 0x00, 0x08, 0x19, 0x08, 0x02, 0x00, 0x08, 0x19, 0x08, 0x02, 0x00,
+  0x08, 0x19, 0x08, 0x02, 0x00, 0x08, 0x19, 0x08, 0x02, 0x00, 0x08, 0x19,
+  0x08, 0x02, 0x00, 0x08, 0x19, 0x08, 0x02, 0x01, 0x07, 0x19, 0x07, 0x02,
+  0x01, 0x07, 0x18, 0x08, 0x02, 0x01, 0x08, 0x18, 0x08, 0x02, 0x02, 0x07,
+  0x18, 0x07, 0x02, 0x02, 0x07, 0x18, 0x07, 0x02, 0x03, 0x07, 0x17, 0x07,
+  0x02, 0x04, 0x06, 0x17, 0x06, 0x02, 0x05, 0x06, 0x16, 0x06, 0x02, 0x06,
+  0x06, 0x15, 0x06, 0x02, 0x07, 0x06, 0x14, 0x05, 0x01, 0x0A, 0x0D, 0x01,
+  0x0B, 0x0A, 0x01, 0x0C, 0x0A, 0x01, 0x0C, 0x0B, 0x01, 0x0D, 0x0B, 0x01,
+  0x0E, 0x0B, 0x01, 0x0F, 0x0C, 0x01, 0x11, 0x10, 0x01, 0x14, 0x09, 0x01,
+  0x00, 0x13, 0x01, 0x01, 0x15, 0x02, 0x03, 0x09, 0x10, 0x08, 0x02, 0x03,
+  0x08, 0x12, 0x07, 0x02, 0x03, 0x08, 0x12, 0x08, 0x02, 0x03, 0x08, 0x13,
+  0x07, 0x02, 0x03, 0x08, 0x13, 0x08, 0x02, 0x03, 0x08, 0x13, 0x08, 0x02,
+  0x03, 0x08, 0x13, 0x08, 0x02, 0x03, 0x08, 0x13, 0x08, 0x02, 0x03, 0x08,
+  0x13, 0x08, 0x02, 0x03, 0x08, 0x13, 0x08, 0x02, 0x03, 0x08, 0x13, 0x07,
+  0x02, 0x03, 0x08, 0x12, 0x08, 0x02, 0x03, 0x08, 0x11, 0x08, 0x02, 0x03,
+  0x08, 0x0F, 0x08, 0x01, 0x03, 0x12, 0x01, 0x03, 0x11, 0x02, 0x03, 0x08,
+  0x0D, 0x08, 0x02, 0x03, 0x08, 0x0D, 0x08, 0x02, 0x03, 0x08, 0x0E, 0x08,
+  0x02, 0x03, 0x08, 0x0E, 0x09, 0x02, 0x03, 0x08, 0x0F, 0x09, 0x02, 0x03,
+  0x08, 0x10, 0x08, 0x02, 0x03, 0x08, 0x10, 0x09, 0x02, 0x03, 0x08, 0x11,
+  0x09, 0x02, 0x03, 0x08, 0x12, 0x08, 0x02, 0x03, 0x08, 0x12, 0x09, 0x02,
+  0x03, 0x08, 0x13, 0x09, 0x02, 0x03, 0x08, 0x14, 0x09, 0x02, 0x02, 0x0A,
+  0x14, 0x09, 0x02, 0x00, 0x0E, 0x15, 0x0A, 0x02, 0x06, 0x07, 0x13, 0x01,
+  0x02, 0x04, 0x0C, 0x12, 0x02, 0x02, 0x03, 0x05, 0x0D, 0x07, 0x02, 0x02,
+  0x04, 0x0F, 0x05, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x01, 0x04, 0x11,
+  0x03, 0x02, 0x00, 0x05, 0x11, 0x03, 0x02, 0x00, 0x05, 0x12, 0x02, 0x02,
+  0x00, 0x05, 0x12, 0x02, 0x02, 0x00, 0x06, 0x13, 0x01, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x09, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x0E,
+  0x01, 0x02, 0x0F, 0x01, 0x03, 0x0F, 0x01, 0x04, 0x0F, 0x01, 0x06, 0x0E,
+  0x01, 0x08, 0x0C, 0x01, 0x0A, 0x0B, 0x01, 0x0C, 0x09, 0x01, 0x0D, 0x08,
+  0x02, 0x00, 0x01, 0x0F, 0x06, 0x02, 0x00, 0x01, 0x0F, 0x06, 0x02, 0x00,
+  0x02, 0x10, 0x05, 0x02, 0x00, 0x02, 0x10, 0x05, 0x02, 0x00, 0x03, 0x10,
+  0x04, 0x02, 0x00, 0x03, 0x10, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02,
+  0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x07, 0x0D, 0x05, 0x02, 0x00, 0x01,
+  0x04, 0x0C, 0x02, 0x00, 0x01, 0x07, 0x07, 0x01, 0x00, 0x1C, 0x01, 0x00,
+  0x1C, 0x03, 0x00, 0x06, 0x0A, 0x08, 0x16, 0x06, 0x03, 0x00, 0x04, 0x0A,
+  0x08, 0x18, 0x04, 0x03, 0x00, 0x03, 0x0A, 0x08, 0x19, 0x03, 0x03, 0x00,
+  0x02, 0x0A, 0x08, 0x1A, 0x02, 0x03, 0x00, 0x02, 0x0A, 0x08, 0x1A, 0x02,
+  0x03, 0x00, 0x01, 0x0A, 0x08, 0x1B, 0x01, 0x03, 0x00, 0x01, 0x0A, 0x08,
+  0x1B, 0x01, 0x01, 0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01,
+  0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01,
+  0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01,
+  0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01,
+  0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01,
+  0x0A, 0x08, 0x01, 0x0A, 0x08, 0x01, 0x09, 0x0A, 0x01, 0x06, 0x10, 0x02,
+  0x00, 0x0F, 0x15, 0x09, 0x02, 0x02, 0x0A, 0x17, 0x05, 0x02, 0x03, 0x08,
+  0x18, 0x03, 0x02, 0x03, 0x08, 0x19, 0x02, 0x02, 0x03, 0x08, 0x19, 0x02,
+  0x02, 0x03, 0x08, 0x19, 0x02, 0x02, 0x03, 0x08, 0x19, 0x02, 0x02, 0x03,
+  0x08, 0x19, 0x02, 0x02, 0x03, 0x08, 0x19, 0x02, 0x02, 0x03, 0x08, 0x19,
+  0x02, 0x02, 0x03, 0x08, 0x19, 0x02, 0x02, 0x03, 0x08, 0x19, 0x02, 0x02,
+  0x03, 0x08, 0x19, 0x02, 0x02, 0x03, 0x08, 0x19, 0x02, 0x02, 0x03, 0x08,
+  0x19, 0x02, 0x02, 0x03, 0x08, 0x19, 0x02, 0x02, 0x03, 0x08, 0x19, 0x02,
+  0x02, 0x03, 0x08, 0x19, 0x02, 0x02, 0x03, 0x08, 0x19, 0x02, 0x02, 0x03,
+  0x08, 0x19, 0x02, 0x02, 0x03, 0x08, 0x19, 0x02, 0x02, 0x03, 0x08, 0x19,
+  0x02, 0x02, 0x03, 0x08, 0x19, 0x02, 0x02, 0x03, 0x08, 0x19, 0x02, 0x02,
+  0x03, 0x08, 0x19, 0x02, 0x02, 0x03, 0x08, 0x18, 0x02, 0x02, 0x04, 0x08,
+  0x18, 0x02, 0x02, 0x04, 0x08, 0x18, 0x02, 0x02, 0x05, 0x07, 0x17, 0x02,
+  0x02, 0x06, 0x07, 0x16, 0x03, 0x02, 0x07, 0x08, 0x14, 0x04, 0x01, 0x09,
+  0x0D, 0x01, 0x0B, 0x09, 0x02, 0x00, 0x10, 0x17, 0x0A, 0x02, 0x02, 0x0B,
+  0x1A, 0x05, 0x02, 0x03, 0x09, 0x1B, 0x03, 0x02, 0x04, 0x08, 0x1B, 0x02,
+  0x02, 0x05, 0x08, 0x1A, 0x03, 0x02, 0x05, 0x08, 0x1A, 0x02, 0x02, 0x05,
+  0x08, 0x1A, 0x02, 0x02, 0x06, 0x08, 0x19, 0x02, 0x02, 0x06, 0x08, 0x19,
+  0x02, 0x02, 0x07, 0x08, 0x19, 0x02, 0x02, 0x07, 0x08, 0x18, 0x02, 0x02,
+  0x08, 0x08, 0x18, 0x02, 0x02, 0x08, 0x08, 0x17, 0x02, 0x02, 0x08, 0x08,
+  0x17, 0x02, 0x02, 0x09, 0x08, 0x17, 0x02, 0x02, 0x09, 0x08, 0x16, 0x02,
+  0x02, 0x0A, 0x08, 0x16, 0x02, 0x02, 0x0A, 0x08, 0x15, 0x03, 0x02, 0x0A,
+  0x08, 0x15, 0x02, 0x02, 0x0B, 0x08, 0x15, 0x02, 0x02, 0x0B, 0x08, 0x14,
+  0x02, 0x01, 0x0C, 0x0A, 0x01, 0x0C, 0x0A, 0x01, 0x0D, 0x08, 0x01, 0x0D,
+  0x08, 0x01, 0x0D, 0x07, 0x01, 0x0E, 0x06, 0x01, 0x0E, 0x06, 0x01, 0x0F,
+  0x04, 0x01, 0x0F, 0x04, 0x01, 0x10, 0x02, 0x01, 0x10, 0x02, 0x03, 0x00,
+  0x0D, 0x11, 0x0F, 0x24, 0x09, 0x03, 0x01, 0x0A, 0x13, 0x0A, 0x26, 0x05,
+  0x03, 0x02, 0x08, 0x14, 0x08, 0x27, 0x03, 0x03, 0x03, 0x07, 0x15, 0x07,
+  0x27, 0x03, 0x03, 0x03, 0x08, 0x15, 0x08, 0x27, 0x03, 0x03, 0x03, 0x08,
+  0x15, 0x08, 0x27, 0x02, 0x03, 0x04, 0x07, 0x16, 0x07, 0x27, 0x02, 0x03,
+  0x04, 0x08, 0x16, 0x07, 0x26, 0x03, 0x03, 0x04, 0x08, 0x15, 0x09, 0x26,
+  0x02, 0x03, 0x05, 0x07, 0x15, 0x09, 0x26, 0x02, 0x03, 0x05, 0x08, 0x15,
+  0x09, 0x25, 0x03, 0x04, 0x05, 0x08, 0x14, 0x02, 0x17, 0x08, 0x25, 0x02,
+  0x04, 0x06, 0x07, 0x14, 0x02, 0x18, 0x07, 0x25, 0x02, 0x04, 0x06, 0x08,
+  0x14, 0x02, 0x18, 0x07, 0x24, 0x03, 0x04, 0x06, 0x08, 0x13, 0x02, 0x18,
+  0x08, 0x24, 0x02, 0x04, 0x07, 0x07, 0x13, 0x02, 0x19, 0x07, 0x24, 0x02,
+  0x04, 0x07, 0x08, 0x12, 0x02, 0x19, 0x07, 0x23, 0x03, 0x04, 0x08, 0x07,
+  0x12, 0x02, 0x1A, 0x07, 0x23, 0x02, 0x04, 0x08, 0x07, 0x12, 0x02, 0x1A,
+  0x07, 0x23, 0x02, 0x04, 0x08, 0x08, 0x11, 0x02, 0x1A, 0x07, 0x22, 0x03,
+  0x04, 0x09, 0x07, 0x11, 0x02, 0x1B, 0x06, 0x22, 0x02, 0x02, 0x09, 0x09,
+  0x1B, 0x09, 0x02, 0x09, 0x09, 0x1B, 0x09, 0x02, 0x0A, 0x08, 0x1C, 0x07,
+  0x02, 0x0A, 0x07, 0x1C, 0x07, 0x02, 0x0A, 0x07, 0x1C, 0x07, 0x02, 0x0B,
+  0x06, 0x1D, 0x05, 0x02, 0x0B, 0x05, 0x1D, 0x05, 0x02, 0x0B, 0x05, 0x1D,
+  0x05, 0x02, 0x0C, 0x03, 0x1E, 0x03, 0x02, 0x0C, 0x03, 0x1E, 0x03, 0x02,
+  0x0C, 0x03, 0x1E, 0x03, 0x02, 0x0D, 0x01, 0x1F, 0x01, 0x02, 0x00, 0x10,
+  0x14, 0x0C, 0x02, 0x02, 0x0B, 0x17, 0x06, 0x02, 0x03, 0x0A, 0x17, 0x04,
+  0x02, 0x04, 0x09, 0x17, 0x03, 0x02, 0x04, 0x09, 0x17, 0x02, 0x02, 0x05,
+  0x09, 0x16, 0x03, 0x02, 0x06, 0x09, 0x15, 0x03, 0x02, 0x06, 0x09, 0x15,
+  0x02, 0x02, 0x07, 0x09, 0x14, 0x02, 0x02, 0x08, 0x09, 0x13, 0x03, 0x02,
+  0x08, 0x09, 0x13, 0x02, 0x01, 0x09, 0x0B, 0x01, 0x0A, 0x0A, 0x01, 0x0A,
+  0x09, 0x01, 0x0B, 0x09, 0x01, 0x0C, 0x08, 0x01, 0x0C, 0x09, 0x01, 0x0D,
+  0x09, 0x01, 0x0C, 0x0A, 0x01, 0x0C, 0x0B, 0x02, 0x0B, 0x02, 0x0F, 0x08,
+  0x02, 0x0A, 0x02, 0x0F, 0x09, 0x02, 0x09, 0x03, 0x10, 0x09, 0x02, 0x09,
+  0x02, 0x11, 0x08, 0x02, 0x08, 0x02, 0x11, 0x09, 0x02, 0x07, 0x03, 0x12,
+  0x09, 0x02, 0x06, 0x03, 0x13, 0x08, 0x02, 0x05, 0x03, 0x13, 0x09, 0x02,
+  0x05, 0x03, 0x14, 0x09, 0x02, 0x04, 0x04, 0x14, 0x09, 0x02, 0x02, 0x07,
+  0x13, 0x0B, 0x02, 0x00, 0x0C, 0x10, 0x10, 0x02, 0x00, 0x10, 0x16, 0x0A,
+  0x02, 0x01, 0x0B, 0x19, 0x06, 0x02, 0x03, 0x09, 0x1A, 0x03, 0x02, 0x03,
+  0x09, 0x1A, 0x03, 0x02, 0x04, 0x08, 0x19, 0x03, 0x02, 0x04, 0x09, 0x19,
+  0x02, 0x02, 0x05, 0x08, 0x19, 0x02, 0x02, 0x05, 0x09, 0x18, 0x02, 0x02,
+  0x06, 0x08, 0x17, 0x03, 0x02, 0x07, 0x08, 0x17, 0x02, 0x02, 0x07, 0x08,
+  0x16, 0x02, 0x02, 0x08, 0x08, 0x16, 0x02, 0x02, 0x08, 0x09, 0x15, 0x02,
+  0x02, 0x09, 0x08, 0x14, 0x03, 0x02, 0x09, 0x09, 0x14, 0x02, 0x02, 0x0A,
+  0x08, 0x13, 0x02, 0x01, 0x0A, 0x0B, 0x01, 0x0B, 0x09, 0x01, 0x0B, 0x09,
+  0x01, 0x0C, 0x08, 0x01, 0x0C, 0x08, 0x01, 0x0C, 0x08, 0x01, 0x0C, 0x08,
+  0x01, 0x0C, 0x08, 0x01, 0x0C, 0x08, 0x01, 0x0C, 0x08, 0x01, 0x0C, 0x08,
+  0x01, 0x0C, 0x08, 0x01, 0x0C, 0x08, 0x01, 0x0C, 0x08, 0x01, 0x0B, 0x0A,
+  0x01, 0x09, 0x0E, 0x01, 0x02, 0x19, 0x01, 0x02, 0x18, 0x02, 0x02, 0x07,
+  0x11, 0x09, 0x02, 0x02, 0x05, 0x11, 0x08, 0x02, 0x02, 0x03, 0x10, 0x09,
+  0x02, 0x02, 0x03, 0x10, 0x08, 0x02, 0x02, 0x02, 0x0F, 0x08, 0x02, 0x01,
+  0x03, 0x0E, 0x09, 0x02, 0x01, 0x02, 0x0E, 0x08, 0x02, 0x01, 0x02, 0x0D,
+  0x09, 0x01, 0x0C, 0x09, 0x01, 0x0C, 0x08, 0x01, 0x0B, 0x09, 0x01, 0x0B,
+  0x08, 0x01, 0x0A, 0x09, 0x01, 0x09, 0x09, 0x01, 0x09, 0x08, 0x01, 0x08,
+  0x09, 0x01, 0x07, 0x09, 0x01, 0x07, 0x08, 0x01, 0x06, 0x09, 0x02, 0x06,
+  0x08, 0x1B, 0x01, 0x02, 0x05, 0x09, 0x1A, 0x02, 0x02, 0x04, 0x09, 0x1A,
+  0x02, 0x02, 0x04, 0x08, 0x1A, 0x02, 0x02, 0x03, 0x09, 0x19, 0x03, 0x02,
+  0x03, 0x08, 0x18, 0x04, 0x02, 0x02, 0x09, 0x17, 0x04, 0x02, 0x01, 0x09,
+  0x16, 0x05, 0x02, 0x01, 0x08, 0x13, 0x08, 0x01, 0x00, 0x1B, 0x01, 0x00,
+  0x1B, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x06, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x05, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x05, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x05, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x05, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x08, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09,
+  0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x05, 0x06, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01, 0x09,
+  0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x06, 0x01, 0x07, 0x07, 0x01, 0x07,
+  0x08, 0x02, 0x06, 0x04, 0x0B, 0x04, 0x02, 0x06, 0x04, 0x0C, 0x04, 0x02,
+  0x05, 0x04, 0x0C, 0x04, 0x02, 0x05, 0x04, 0x0D, 0x04, 0x02, 0x04, 0x04,
+  0x0D, 0x04, 0x02, 0x04, 0x04, 0x0E, 0x04, 0x02, 0x03, 0x04, 0x0E, 0x04,
+  0x02, 0x03, 0x04, 0x0F, 0x04, 0x02, 0x02, 0x04, 0x0F, 0x04, 0x02, 0x02,
+  0x04, 0x0F, 0x05, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x01, 0x04, 0x10,
+  0x05, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x01,
+  0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x02,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x05, 0x04, 0x01, 0x06, 0x04, 0x01, 0x08,
+  0x03, 0x01, 0x06, 0x08, 0x01, 0x04, 0x0C, 0x02, 0x02, 0x05, 0x0B, 0x06,
+  0x02, 0x02, 0x04, 0x0C, 0x06, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x02, 0x01,
+  0x06, 0x0D, 0x06, 0x02, 0x01, 0x06, 0x0D, 0x06, 0x02, 0x01, 0x06, 0x0D,
+  0x06, 0x02, 0x02, 0x04, 0x0D, 0x06, 0x01, 0x0D, 0x06, 0x01, 0x0B, 0x08,
+  0x01, 0x08, 0x0B, 0x02, 0x06, 0x05, 0x0D, 0x06, 0x02, 0x04, 0x05, 0x0D,
+  0x06, 0x02, 0x02, 0x06, 0x0D, 0x06, 0x02, 0x01, 0x06, 0x0D, 0x06, 0x02,
+  0x01, 0x06, 0x0D, 0x06, 0x02, 0x00, 0x07, 0x0D, 0x06, 0x02, 0x00, 0x07,
+  0x0D, 0x06, 0x02, 0x00, 0x07, 0x0C, 0x07, 0x02, 0x00, 0x08, 0x0B, 0x08,
+  0x02, 0x01, 0x0B, 0x0D, 0x09, 0x02, 0x01, 0x0A, 0x0E, 0x06, 0x02, 0x03,
+  0x06, 0x0E, 0x05, 0x01, 0x00, 0x09, 0x01, 0x02, 0x07, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x02, 0x03, 0x06, 0x0C, 0x07, 0x02,
+  0x03, 0x06, 0x0A, 0x0B, 0x02, 0x03, 0x08, 0x0F, 0x07, 0x02, 0x03, 0x07,
+  0x10, 0x07, 0x02, 0x03, 0x06, 0x11, 0x06, 0x02, 0x03, 0x06, 0x11, 0x07,
+  0x02, 0x03, 0x06, 0x11, 0x07, 0x02, 0x03, 0x06, 0x12, 0x07, 0x02, 0x03,
+  0x06, 0x12, 0x07, 0x02, 0x03, 0x06, 0x12, 0x07, 0x02, 0x03, 0x06, 0x12,
+  0x07, 0x02, 0x03, 0x06, 0x12, 0x07, 0x02, 0x03, 0x06, 0x12, 0x07, 0x02,
+  0x03, 0x06, 0x12, 0x07, 0x02, 0x03, 0x06, 0x12, 0x07, 0x02, 0x03, 0x06,
+  0x12, 0x06, 0x02, 0x03, 0x06, 0x12, 0x06, 0x02, 0x03, 0x06, 0x11, 0x07,
+  0x02, 0x03, 0x06, 0x11, 0x06, 0x02, 0x03, 0x06, 0x11, 0x06, 0x02, 0x03,
+  0x07, 0x10, 0x06, 0x03, 0x03, 0x03, 0x08, 0x03, 0x0F, 0x06, 0x02, 0x03,
+  0x02, 0x09, 0x0A, 0x02, 0x03, 0x01, 0x0B, 0x06, 0x01, 0x08, 0x06, 0x01,
+  0x06, 0x0A, 0x02, 0x04, 0x05, 0x0C, 0x05, 0x02, 0x03, 0x05, 0x0D, 0x05,
+  0x02, 0x02, 0x05, 0x0D, 0x05, 0x02, 0x02, 0x05, 0x0D, 0x05, 0x02, 0x01,
+  0x05, 0x0D, 0x05, 0x02, 0x01, 0x05, 0x0E, 0x03, 0x01, 0x01, 0x05, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01,
+  0x01, 0x07, 0x01, 0x01, 0x07, 0x02, 0x02, 0x07, 0x11, 0x01, 0x02, 0x03,
+  0x08, 0x10, 0x02, 0x01, 0x03, 0x0E, 0x01, 0x05, 0x0A, 0x01, 0x07, 0x06,
+  0x01, 0x0B, 0x0A, 0x01, 0x0E, 0x07, 0x01, 0x0F, 0x06, 0x01, 0x0F, 0x06,
+  0x01, 0x0F, 0x06, 0x01, 0x0F, 0x06, 0x01, 0x0F, 0x06, 0x01, 0x0F, 0x06,
+  0x01, 0x0F, 0x06, 0x02, 0x06, 0x06, 0x0F, 0x06, 0x02, 0x05, 0x09, 0x0F,
+  0x06, 0x02, 0x03, 0x07, 0x0D, 0x08, 0x02, 0x03, 0x06, 0x0E, 0x07, 0x02,
+  0x02, 0x06, 0x0F, 0x06, 0x02, 0x01, 0x07, 0x0F, 0x06, 0x02, 0x01, 0x06,
+  0x0F, 0x06, 0x02, 0x01, 0x06, 0x0F, 0x06, 0x02, 0x00, 0x07, 0x0F, 0x06,
+  0x02, 0x00, 0x07, 0x0F, 0x06, 0x02, 0x00, 0x07, 0x0F, 0x06, 0x02, 0x00,
+  0x07, 0x0F, 0x06, 0x02, 0x00, 0x07, 0x0F, 0x06, 0x02, 0x00, 0x07, 0x0F,
+  0x06, 0x02, 0x00, 0x07, 0x0F, 0x06, 0x02, 0x00, 0x07, 0x0F, 0x06, 0x02,
+  0x00, 0x07, 0x0F, 0x06, 0x02, 0x01, 0x06, 0x0F, 0x06, 0x02, 0x01, 0x07,
+  0x0F, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x07, 0x02, 0x02, 0x06, 0x0E, 0x07,
+  0x02, 0x03, 0x06, 0x0D, 0x09, 0x02, 0x04, 0x0A, 0x0F, 0x09, 0x02, 0x06,
+  0x06, 0x0F, 0x03, 0x01, 0x06, 0x06, 0x01, 0x04, 0x0A, 0x02, 0x03, 0x04,
+  0x0B, 0x04, 0x02, 0x02, 0x05, 0x0B, 0x05, 0x02, 0x02, 0x04, 0x0C, 0x04,
+  0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x00,
+  0x06, 0x0C, 0x05, 0x02, 0x00, 0x06, 0x0C, 0x06, 0x01, 0x00, 0x12, 0x01,
+  0x00, 0x12, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x01, 0x06, 0x02,
+  0x01, 0x07, 0x10, 0x02, 0x02, 0x02, 0x06, 0x0F, 0x02, 0x02, 0x02, 0x08,
+  0x0E, 0x02, 0x01, 0x03, 0x0C, 0x01, 0x04, 0x0A, 0x01, 0x06, 0x06, 0x01,
+  0x08, 0x06, 0x01, 0x06, 0x0A, 0x02, 0x05, 0x05, 0x0D, 0x03, 0x02, 0x04,
+  0x05, 0x0D, 0x04, 0x02, 0x04, 0x05, 0x0C, 0x05, 0x02, 0x03, 0x06, 0x0C,
+  0x05, 0x02, 0x03, 0x06, 0x0D, 0x03, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x00, 0x0D, 0x01, 0x00, 0x0D,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x02, 0x08, 0x01, 0x00, 0x0D,
+  0x01, 0x05, 0x07, 0x01, 0x03, 0x10, 0x02, 0x02, 0x05, 0x0B, 0x08, 0x02,
+  0x01, 0x05, 0x0C, 0x04, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x06,
+  0x0C, 0x06, 0x02, 0x00, 0x06, 0x0C, 0x06, 0x02, 0x00, 0x06, 0x0C, 0x06,
+  0x02, 0x00, 0x06, 0x0C, 0x06, 0x02, 0x00, 0x06, 0x0C, 0x06, 0x02, 0x01,
+  0x05, 0x0C, 0x06, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x02, 0x05, 0x0B,
+  0x06, 0x02, 0x03, 0x04, 0x0A, 0x06, 0x01, 0x05, 0x09, 0x01, 0x04, 0x02,
+  0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x05, 0x01, 0x00, 0x0F,
+  0x01, 0x00, 0x11, 0x01, 0x00, 0x12, 0x01, 0x01, 0x12, 0x01, 0x02, 0x11,
+  0x01, 0x04, 0x0F, 0x02, 0x01, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x10,
+  0x03, 0x02, 0x00, 0x04, 0x10, 0x03, 0x02, 0x00, 0x04, 0x0F, 0x03, 0x02,
+  0x01, 0x05, 0x0E, 0x03, 0x01, 0x02, 0x0E, 0x01, 0x04, 0x09, 0x01, 0x00,
+  0x09, 0x01, 0x02, 0x07, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03,
+  0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03,
+  0x06, 0x02, 0x03, 0x06, 0x0D, 0x06, 0x02, 0x03, 0x06, 0x0B, 0x09, 0x02,
+  0x03, 0x06, 0x0A, 0x0B, 0x02, 0x03, 0x09, 0x0F, 0x06, 0x02, 0x03, 0x07,
+  0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06,
+  0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03,
+  0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10,
+  0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02,
+  0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06,
+  0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06,
+  0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x02,
+  0x08, 0x0F, 0x08, 0x02, 0x00, 0x0B, 0x0E, 0x0A, 0x01, 0x04, 0x04, 0x01,
+  0x02, 0x06, 0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x01,
+  0x02, 0x07, 0x01, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09,
+  0x01, 0x02, 0x07, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x02, 0x08,
+  0x01, 0x00, 0x0B, 0x01, 0x09, 0x03, 0x01, 0x07, 0x07, 0x01, 0x06, 0x08,
+  0x01, 0x06, 0x08, 0x01, 0x06, 0x08, 0x01, 0x07, 0x07, 0x01, 0x08, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x09, 0x01, 0x07, 0x07, 0x01, 0x08,
+  0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08,
+  0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08,
+  0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08,
+  0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08,
+  0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x08,
+  0x06, 0x01, 0x08, 0x06, 0x02, 0x01, 0x03, 0x08, 0x06, 0x02, 0x00, 0x05,
+  0x08, 0x05, 0x02, 0x00, 0x05, 0x08, 0x05, 0x02, 0x00, 0x04, 0x08, 0x05,
+  0x02, 0x00, 0x04, 0x07, 0x05, 0x01, 0x01, 0x0A, 0x01, 0x03, 0x06, 0x01,
+  0x00, 0x09, 0x01, 0x02, 0x07, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01,
+  0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01,
+  0x03, 0x06, 0x01, 0x03, 0x06, 0x02, 0x03, 0x06, 0x0D, 0x0A, 0x02, 0x03,
+  0x06, 0x0F, 0x06, 0x02, 0x03, 0x06, 0x10, 0x03, 0x02, 0x03, 0x06, 0x10,
+  0x02, 0x02, 0x03, 0x06, 0x0F, 0x02, 0x02, 0x03, 0x06, 0x0E, 0x02, 0x02,
+  0x03, 0x06, 0x0D, 0x02, 0x02, 0x03, 0x06, 0x0C, 0x03, 0x02, 0x03, 0x06,
+  0x0B, 0x04, 0x02, 0x03, 0x06, 0x0A, 0x06, 0x01, 0x03, 0x0E, 0x01, 0x03,
+  0x0E, 0x02, 0x03, 0x06, 0x0B, 0x07, 0x02, 0x03, 0x06, 0x0C, 0x07, 0x02,
+  0x03, 0x06, 0x0C, 0x07, 0x02, 0x03, 0x06, 0x0D, 0x07, 0x02, 0x03, 0x06,
+  0x0E, 0x07, 0x02, 0x03, 0x06, 0x0E, 0x08, 0x02, 0x03, 0x06, 0x0F, 0x07,
+  0x02, 0x03, 0x06, 0x0F, 0x08, 0x02, 0x02, 0x08, 0x0F, 0x09, 0x02, 0x00,
+  0x0B, 0x0E, 0x0B, 0x01, 0x00, 0x09, 0x01, 0x02, 0x07, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06,
+  0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x02, 0x08,
+  0x01, 0x00, 0x0B, 0x02, 0x0D, 0x06, 0x1A, 0x06, 0x03, 0x00, 0x09, 0x0B,
+  0x09, 0x18, 0x09, 0x03, 0x02, 0x07, 0x0A, 0x0B, 0x17, 0x0B, 0x03, 0x03,
+  0x08, 0x0F, 0x0A, 0x1C, 0x06, 0x03, 0x03, 0x07, 0x10, 0x07, 0x1D, 0x06,
+  0x03, 0x03, 0x06, 0x10, 0x06, 0x1D, 0x06, 0x03, 0x03, 0x06, 0x10, 0x06,
+  0x1D, 0x06, 0x03, 0x03, 0x06, 0x10, 0x06, 0x1D, 0x06, 0x03, 0x03, 0x06,
+  0x10, 0x06, 0x1D, 0x06, 0x03, 0x03, 0x06, 0x10, 0x06, 0x1D, 0x06, 0x03,
+  0x03, 0x06, 0x10, 0x06, 0x1D, 0x06, 0x03, 0x03, 0x06, 0x10, 0x06, 0x1D,
+  0x06, 0x03, 0x03, 0x06, 0x10, 0x06, 0x1D, 0x06, 0x03, 0x03, 0x06, 0x10,
+  0x06, 0x1D, 0x06, 0x03, 0x03, 0x06, 0x10, 0x06, 0x1D, 0x06, 0x03, 0x03,
+  0x06, 0x10, 0x06, 0x1D, 0x06, 0x03, 0x03, 0x06, 0x10, 0x06, 0x1D, 0x06,
+  0x03, 0x03, 0x06, 0x10, 0x06, 0x1D, 0x06, 0x03, 0x03, 0x06, 0x10, 0x06,
+  0x1D, 0x06, 0x03, 0x03, 0x06, 0x10, 0x06, 0x1D, 0x06, 0x03, 0x03, 0x06,
+  0x10, 0x06, 0x1D, 0x06, 0x03, 0x02, 0x08, 0x0F, 0x08, 0x1C, 0x08, 0x03,
+  0x00, 0x0B, 0x0E, 0x0A, 0x1B, 0x0A, 0x01, 0x0D, 0x06, 0x02, 0x00, 0x09,
+  0x0B, 0x09, 0x02, 0x02, 0x07, 0x0A, 0x0B, 0x02, 0x03, 0x09, 0x0F, 0x06,
+  0x02, 0x03, 0x07, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03,
+  0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10,
+  0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02,
+  0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06,
+  0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06,
+  0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03,
+  0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10,
+  0x06, 0x02, 0x02, 0x08, 0x0F, 0x08, 0x02, 0x00, 0x0B, 0x0E, 0x0A, 0x01,
+  0x07, 0x07, 0x01, 0x05, 0x0B, 0x02, 0x04, 0x05, 0x0C, 0x05, 0x02, 0x03,
+  0x05, 0x0D, 0x05, 0x02, 0x02, 0x06, 0x0D, 0x06, 0x02, 0x02, 0x05, 0x0E,
+  0x05, 0x02, 0x01, 0x06, 0x0E, 0x06, 0x02, 0x01, 0x06, 0x0E, 0x06, 0x02,
+  0x00, 0x07, 0x0E, 0x07, 0x02, 0x00, 0x07, 0x0E, 0x07, 0x02, 0x00, 0x07,
+  0x0E, 0x07, 0x02, 0x00, 0x07, 0x0E, 0x07, 0x02, 0x00, 0x07, 0x0E, 0x07,
+  0x02, 0x00, 0x07, 0x0E, 0x07, 0x02, 0x00, 0x07, 0x0E, 0x07, 0x02, 0x00,
+  0x07, 0x0E, 0x07, 0x02, 0x01, 0x06, 0x0E, 0x06, 0x02, 0x01, 0x06, 0x0E,
+  0x06, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x06, 0x0D, 0x06, 0x02,
+  0x03, 0x05, 0x0D, 0x05, 0x02, 0x04, 0x05, 0x0C, 0x05, 0x01, 0x05, 0x0B,
+  0x01, 0x07, 0x07, 0x01, 0x0C, 0x06, 0x02, 0x00, 0x09, 0x0A, 0x0A, 0x02,
+  0x02, 0x0A, 0x0F, 0x06, 0x02, 0x03, 0x07, 0x10, 0x06, 0x02, 0x03, 0x07,
+  0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x07, 0x02, 0x03, 0x06, 0x11, 0x06,
+  0x02, 0x03, 0x06, 0x11, 0x07, 0x02, 0x03, 0x06, 0x11, 0x07, 0x02, 0x03,
+  0x06, 0x11, 0x07, 0x02, 0x03, 0x06, 0x11, 0x07, 0x02, 0x03, 0x06, 0x11,
+  0x07, 0x02, 0x03, 0x06, 0x11, 0x07, 0x02, 0x03, 0x06, 0x11, 0x07, 0x02,
+  0x03, 0x06, 0x11, 0x07, 0x02, 0x03, 0x06, 0x11, 0x07, 0x02, 0x03, 0x06,
+  0x11, 0x06, 0x02, 0x03, 0x06, 0x11, 0x06, 0x02, 0x03, 0x06, 0x10, 0x07,
+  0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x07, 0x0F, 0x06, 0x02, 0x03,
+  0x08, 0x0E, 0x07, 0x02, 0x03, 0x06, 0x0A, 0x09, 0x02, 0x03, 0x06, 0x0C,
+  0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03,
+  0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x02, 0x08, 0x01, 0x00,
+  0x0D, 0x02, 0x08, 0x05, 0x14, 0x01, 0x02, 0x05, 0x0A, 0x13, 0x02, 0x03,
+  0x04, 0x06, 0x0D, 0x03, 0x12, 0x03, 0x02, 0x03, 0x06, 0x0E, 0x07, 0x02,
+  0x02, 0x06, 0x0F, 0x06, 0x02, 0x02, 0x06, 0x0F, 0x06, 0x02, 0x01, 0x07,
+  0x0F, 0x06, 0x02, 0x01, 0x06, 0x0F, 0x06, 0x02, 0x01, 0x06, 0x0F, 0x06,
+  0x02, 0x00, 0x07, 0x0F, 0x06, 0x02, 0x00, 0x07, 0x0F, 0x06, 0x02, 0x00,
+  0x07, 0x0F, 0x06, 0x02, 0x00, 0x07, 0x0F, 0x06, 0x02, 0x00, 0x07, 0x0F,
+  0x06, 0x02, 0x00, 0x07, 0x0F, 0x06, 0x02, 0x00, 0x07, 0x0F, 0x06, 0x02,
+  0x00, 0x07, 0x0F, 0x06, 0x02, 0x01, 0x06, 0x0F, 0x06, 0x02, 0x01, 0x07,
+  0x0F, 0x06, 0x02, 0x01, 0x07, 0x0F, 0x06, 0x02, 0x02, 0x07, 0x0E, 0x07,
+  0x02, 0x03, 0x07, 0x0D, 0x08, 0x02, 0x04, 0x0A, 0x0F, 0x06, 0x02, 0x06,
+  0x06, 0x0F, 0x06, 0x01, 0x0F, 0x06, 0x01, 0x0F, 0x06, 0x01, 0x0F, 0x06,
+  0x01, 0x0F, 0x06, 0x01, 0x0F, 0x06, 0x01, 0x0F, 0x06, 0x01, 0x0E, 0x08,
+  0x01, 0x0C, 0x0C, 0x01, 0x0D, 0x04, 0x02, 0x00, 0x09, 0x0B, 0x07, 0x02,
+  0x02, 0x07, 0x0A, 0x09, 0x01, 0x03, 0x10, 0x02, 0x03, 0x08, 0x0D, 0x06,
+  0x02, 0x03, 0x07, 0x0E, 0x04, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01,
+  0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01,
+  0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01,
+  0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01,
+  0x03, 0x06, 0x01, 0x02, 0x08, 0x01, 0x00, 0x0C, 0x02, 0x04, 0x05, 0x0D,
+  0x01, 0x01, 0x03, 0x0B, 0x02, 0x02, 0x03, 0x09, 0x05, 0x02, 0x01, 0x03,
+  0x0B, 0x03, 0x02, 0x00, 0x04, 0x0C, 0x02, 0x02, 0x00, 0x04, 0x0C, 0x02,
+  0x02, 0x00, 0x05, 0x0D, 0x01, 0x01, 0x00, 0x06, 0x01, 0x00, 0x08, 0x01,
+  0x00, 0x0A, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x0C, 0x01, 0x02, 0x0C, 0x01,
+  0x04, 0x0A, 0x01, 0x06, 0x09, 0x01, 0x08, 0x07, 0x02, 0x00, 0x01, 0x09,
+  0x06, 0x02, 0x00, 0x02, 0x0A, 0x05, 0x02, 0x00, 0x02, 0x0B, 0x04, 0x02,
+  0x00, 0x02, 0x0B, 0x04, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x05,
+  0x09, 0x04, 0x02, 0x00, 0x02, 0x03, 0x09, 0x02, 0x00, 0x01, 0x05, 0x06,
+  0x01, 0x07, 0x01, 0x01, 0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x04, 0x04, 0x01, 0x03, 0x05, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07,
+  0x01, 0x00, 0x0C, 0x01, 0x00, 0x0C, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06,
+  0x01, 0x02, 0x06, 0x02, 0x02, 0x06, 0x0C, 0x01, 0x02, 0x02, 0x06, 0x0C,
+  0x01, 0x02, 0x02, 0x07, 0x0B, 0x02, 0x01, 0x03, 0x09, 0x01, 0x03, 0x08,
+  0x01, 0x04, 0x05, 0x02, 0x00, 0x09, 0x0D, 0x09, 0x02, 0x02, 0x07, 0x0F,
+  0x07, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02,
+  0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06,
+  0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06,
+  0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03,
+  0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10,
+  0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02,
+  0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06,
+  0x0F, 0x07, 0x02, 0x03, 0x07, 0x0E, 0x09, 0x02, 0x04, 0x0B, 0x10, 0x09,
+  0x02, 0x05, 0x09, 0x10, 0x05, 0x02, 0x06, 0x06, 0x10, 0x01, 0x02, 0x00,
+  0x0C, 0x0F, 0x07, 0x02, 0x02, 0x08, 0x11, 0x04, 0x02, 0x02, 0x08, 0x12,
+  0x02, 0x02, 0x03, 0x07, 0x12, 0x02, 0x02, 0x03, 0x07, 0x11, 0x02, 0x02,
+  0x04, 0x07, 0x11, 0x02, 0x02, 0x04, 0x07, 0x11, 0x01, 0x02, 0x05, 0x06,
+  0x10, 0x02, 0x02, 0x05, 0x07, 0x10, 0x02, 0x02, 0x05, 0x07, 0x0F, 0x02,
+  0x02, 0x06, 0x07, 0x0F, 0x02, 0x02, 0x06, 0x07, 0x0F, 0x01, 0x02, 0x07,
+  0x06, 0x0E, 0x02, 0x01, 0x07, 0x09, 0x01, 0x07, 0x08, 0x01, 0x08, 0x07,
+  0x01, 0x08, 0x07, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0B, 0x01, 0x03, 0x00, 0x0B,
+  0x0D, 0x0B, 0x1A, 0x07, 0x03, 0x01, 0x09, 0x0F, 0x07, 0x1C, 0x03, 0x03,
+  0x02, 0x07, 0x0F, 0x07, 0x1C, 0x03, 0x03, 0x03, 0x06, 0x10, 0x06, 0x1C,
+  0x02, 0x03, 0x03, 0x07, 0x10, 0x06, 0x1C, 0x02, 0x03, 0x03, 0x07, 0x10,
+  0x07, 0x1C, 0x01, 0x03, 0x04, 0x06, 0x10, 0x07, 0x1B, 0x02, 0x03, 0x04,
+  0x07, 0x0F, 0x08, 0x1B, 0x02, 0x03, 0x05, 0x06, 0x0F, 0x08, 0x1B, 0x01,
+  0x04, 0x05, 0x06, 0x0F, 0x01, 0x12, 0x06, 0x1A, 0x02, 0x04, 0x05, 0x07,
+  0x0E, 0x02, 0x12, 0x06, 0x1A, 0x02, 0x04, 0x06, 0x06, 0x0E, 0x02, 0x12,
+  0x06, 0x19, 0x02, 0x02, 0x06, 0x09, 0x13, 0x08, 0x02, 0x06, 0x09, 0x13,
+  0x07, 0x02, 0x07, 0x07, 0x13, 0x07, 0x02, 0x07, 0x07, 0x13, 0x07, 0x02,
+  0x08, 0x06, 0x14, 0x05, 0x02, 0x08, 0x05, 0x14, 0x05, 0x02, 0x08, 0x05,
+  0x14, 0x05, 0x02, 0x09, 0x04, 0x15, 0x03, 0x02, 0x09, 0x03, 0x15, 0x03,
+  0x02, 0x09, 0x03, 0x15, 0x03, 0x02, 0x0A, 0x01, 0x16, 0x01, 0x02, 0x00,
+  0x0C, 0x0E, 0x08, 0x02, 0x01, 0x09, 0x10, 0x04, 0x02, 0x02, 0x08, 0x10,
+  0x03, 0x02, 0x03, 0x07, 0x10, 0x02, 0x02, 0x03, 0x08, 0x0F, 0x02, 0x02,
+  0x04, 0x07, 0x0E, 0x02, 0x02, 0x05, 0x07, 0x0D, 0x03, 0x01, 0x05, 0x0A,
+  0x01, 0x06, 0x08, 0x01, 0x06, 0x08, 0x01, 0x07, 0x08, 0x01, 0x08, 0x07,
+  0x01, 0x08, 0x08, 0x01, 0x07, 0x0A, 0x02, 0x07, 0x02, 0x0A, 0x07, 0x02,
+  0x06, 0x02, 0x0A, 0x08, 0x02, 0x05, 0x02, 0x0B, 0x07, 0x02, 0x04, 0x03,
+  0x0C, 0x07, 0x02, 0x04, 0x02, 0x0C, 0x08, 0x02, 0x03, 0x03, 0x0D, 0x07,
+  0x02, 0x02, 0x04, 0x0D, 0x08, 0x02, 0x00, 0x08, 0x0B, 0x0B, 0x02, 0x00,
+  0x0B, 0x0E, 0x07, 0x02, 0x01, 0x08, 0x10, 0x04, 0x02, 0x02, 0x07, 0x11,
+  0x02, 0x02, 0x02, 0x07, 0x10, 0x02, 0x02, 0x03, 0x06, 0x10, 0x02, 0x02,
+  0x03, 0x07, 0x10, 0x02, 0x02, 0x03, 0x07, 0x0F, 0x02, 0x02, 0x04, 0x06,
+  0x0F, 0x02, 0x02, 0x04, 0x07, 0x0F, 0x02, 0x02, 0x04, 0x07, 0x0E, 0x02,
+  0x02, 0x05, 0x06, 0x0E, 0x02, 0x02, 0x05, 0x07, 0x0E, 0x02, 0x02, 0x06,
+  0x06, 0x0D, 0x02, 0x01, 0x06, 0x09, 0x01, 0x06, 0x08, 0x01, 0x07, 0x07,
+  0x01, 0x07, 0x07, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05,
+  0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x0A, 0x01, 0x01, 0x09, 0x02,
+  0x01, 0x09, 0x02, 0x02, 0x01, 0x03, 0x09, 0x01, 0x02, 0x00, 0x05, 0x08,
+  0x02, 0x02, 0x00, 0x05, 0x08, 0x01, 0x02, 0x00, 0x05, 0x07, 0x02, 0x01,
+  0x01, 0x07, 0x01, 0x02, 0x04, 0x01, 0x01, 0x12, 0x01, 0x01, 0x12, 0x02,
+  0x01, 0x04, 0x0B, 0x07, 0x02, 0x01, 0x02, 0x0A, 0x07, 0x02, 0x01, 0x02,
+  0x09, 0x08, 0x02, 0x01, 0x01, 0x09, 0x07, 0x01, 0x08, 0x08, 0x01, 0x08,
+  0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x06, 0x07, 0x01, 0x05,
+  0x08, 0x01, 0x05, 0x07, 0x01, 0x04, 0x08, 0x01, 0x04, 0x07, 0x02, 0x03,
+  0x07, 0x11, 0x02, 0x02, 0x02, 0x08, 0x11, 0x02, 0x02, 0x02, 0x07, 0x10,
+  0x02, 0x02, 0x01, 0x08, 0x0F, 0x03, 0x02, 0x01, 0x07, 0x0D, 0x05, 0x01,
+  0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x09, 0x05, 0x01, 0x07, 0x06, 0x01,
+  0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x07, 0x06, 0x01, 0x09, 0x05, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x05, 0x01, 0x01, 0x06, 0x01, 0x03, 0x05, 0x01,
+  0x03, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x06, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x05, 0x01, 0x06, 0x04, 0x01,
+  0x05, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x05, 0x01,
+  0x03, 0x05, 0x01, 0x01, 0x06, 0x01, 0x00, 0x05, 0x01, 0x04, 0x05, 0x02,
+  0x02, 0x0A, 0x13, 0x01, 0x02, 0x01, 0x0D, 0x12, 0x03, 0x01, 0x01, 0x15,
+  0x02, 0x01, 0x03, 0x09, 0x0C, 0x02, 0x02, 0x01, 0x0B, 0x09, 0x01, 0x0E,
+  0x05 };
+
+const GFXglyph FreeSerifBold24pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,  12,    0,    1 },   // 0x20 ' '
+  {     0,   8,  34,  16,    4,  -32 },   // 0x21 '!'
+  {    94,  17,  13,  26,    4,  -32 },   // 0x22 '"'
+  {   159,  23,  33,  23,    0,  -32 },   // 0x23 '#'
+  {   312,  21,  39,  24,    1,  -34 },   // 0x24 '$'
+  {   497,  35,  34,  47,    6,  -32 },   // 0x25 '%'
+  {   725,  34,  34,  39,    3,  -32 },   // 0x26 '&'
+  {   905,   5,  13,  13,    4,  -32 },   // 0x27 '''
+  {   944,  12,  41,  16,    2,  -32 },   // 0x28 '('
+  {  1065,  12,  41,  16,    1,  -32 },   // 0x29 ')'
+  {  1186,  18,  21,  24,    3,  -32 },   // 0x2A '*'
+  {  1285,  26,  25,  32,    3,  -24 },   // 0x2B '+'
+  {  1360,   8,  15,  12,    2,   -6 },   // 0x2C ','
+  {  1405,  11,   5,  16,    2,  -12 },   // 0x2D '-'
+  {  1420,   8,   8,  12,    2,   -6 },   // 0x2E '.'
+  {  1444,  15,  33,  13,   -1,  -32 },   // 0x2F '/'
+  {  1543,  22,  34,  23,    1,  -32 },   // 0x30 '0'
+  {  1709,  18,  33,  23,    3,  -32 },   // 0x31 '1'
+  {  1810,  21,  33,  24,    1,  -32 },   // 0x32 '2'
+  {  1925,  21,  34,  24,    1,  -32 },   // 0x33 '3'
+  {  2043,  21,  33,  24,    1,  -32 },   // 0x34 '4'
+  {  2170,  20,  32,  23,    2,  -31 },   // 0x35 '5'
+  {  2272,  21,  34,  24,    1,  -32 },   // 0x36 '6'
+  {  2410,  21,  32,  23,    1,  -31 },   // 0x37 '7'
+  {  2514,  21,  34,  23,    1,  -32 },   // 0x38 '8'
+  {  2666,  22,  34,  23,    1,  -32 },   // 0x39 '9'
+  {  2806,   8,  24,  16,    4,  -22 },   // 0x3A ':'
+  {  2862,   9,  31,  16,    3,  -22 },   // 0x3B ';'
+  {  2941,  26,  26,  32,    3,  -24 },   // 0x3C '<'
+  {  3019,  26,  17,  32,    3,  -20 },   // 0x3D '='
+  {  3056,  26,  26,  32,    3,  -24 },   // 0x3E '>'
+  {  3134,  18,  34,  24,    3,  -32 },   // 0x3F '?'
+  {  3246,  33,  34,  44,    5,  -32 },   // 0x40 '@'
+  {  3470,  32,  33,  34,    1,  -32 },   // 0x41 'A'
+  {  3609,  28,  32,  31,    1,  -31 },   // 0x42 'B'
+  {  3757,  30,  34,  33,    2,  -32 },   // 0x43 'C'
+  {  3897,  32,  32,  34,    1,  -31 },   // 0x44 'D'
+  {  4049,  28,  32,  32,    2,  -31 },   // 0x45 'E'
+  {  4199,  25,  32,  29,    2,  -31 },   // 0x46 'F'
+  {  4333,  33,  34,  36,    2,  -32 },   // 0x47 'G'
+  {  4485,  33,  32,  37,    2,  -31 },   // 0x48 'H'
+  {  4641,  15,  32,  18,    2,  -31 },   // 0x49 'I'
+  {  4737,  22,  37,  24,    0,  -31 },   // 0x4A 'J'
+  {  4862,  34,  32,  36,    2,  -31 },   // 0x4B 'K'
+  {  5018,  28,  32,  31,    2,  -31 },   // 0x4C 'L'
+  {  5132,  43,  32,  45,    0,  -31 },   // 0x4D 'M'
+  {  5382,  31,  32,  34,    1,  -31 },   // 0x4E 'N'
+  {  5566,  33,  34,  37,    2,  -32 },   // 0x4F 'O'
+  {  5728,  26,  32,  30,    2,  -31 },   // 0x50 'P'
+  {  5852,  33,  41,  37,    2,  -32 },   // 0x51 'Q'
+  {  6035,  31,  32,  34,    2,  -31 },   // 0x52 'R'
+  {  6187,  21,  34,  27,    3,  -32 },   // 0x53 'S'
+  {  6331,  28,  32,  30,    1,  -31 },   // 0x54 'T'
+  {  6455,  30,  33,  34,    2,  -31 },   // 0x55 'U'
+  {  6616,  33,  32,  33,    0,  -31 },   // 0x56 'V'
+  {  6754,  45,  33,  46,    1,  -31 },   // 0x57 'W'
+  {  6981,  32,  32,  34,    1,  -31 },   // 0x58 'X'
+  {  7123,  32,  32,  33,    1,  -31 },   // 0x59 'Y'
+  {  7251,  28,  32,  30,    1,  -31 },   // 0x5A 'Z'
+  {  7381,  11,  39,  16,    3,  -31 },   // 0x5B '['
+  {  7498,  15,  33,  13,   -1,  -32 },   // 0x5C '\'
+  {  7597,  11,  39,  16,    2,  -31 },   // 0x5D ']'
+  {  7714,  21,  17,  27,    3,  -31 },   // 0x5E '^'
+  {  7789,  24,   3,  23,    0,    5 },   // 0x5F '_'
+  {  7798,  11,   9,  16,    0,  -33 },   // 0x60 '`'
+  {  7825,  22,  24,  23,    1,  -22 },   // 0x61 'a'
+  {  7935,  25,  33,  26,    0,  -31 },   // 0x62 'b'
+  {  8084,  19,  24,  20,    1,  -22 },   // 0x63 'c'
+  {  8172,  24,  33,  26,    1,  -31 },   // 0x64 'd'
+  {  8319,  18,  24,  21,    1,  -22 },   // 0x65 'e'
+  {  8411,  17,  33,  18,    1,  -32 },   // 0x66 'f'
+  {  8520,  19,  32,  24,    2,  -22 },   // 0x67 'g'
+  {  8650,  24,  32,  26,    0,  -31 },   // 0x68 'h'
+  {  8792,  11,  33,  14,    1,  -32 },   // 0x69 'i'
+  {  8883,  14,  42,  18,    0,  -32 },   // 0x6A 'j'
+  {  9011,  25,  32,  26,    0,  -31 },   // 0x6B 'k'
+  {  9147,  11,  32,  13,    0,  -31 },   // 0x6C 'l'
+  {  9243,  37,  23,  39,    0,  -22 },   // 0x6D 'm'
+  {  9402,  24,  23,  26,    0,  -22 },   // 0x6E 'n'
+  {  9515,  21,  24,  24,    1,  -22 },   // 0x6F 'o'
+  {  9627,  24,  32,  26,    0,  -22 },   // 0x70 'p'
+  {  9769,  24,  32,  26,    1,  -22 },   // 0x71 'q'
+  {  9915,  19,  23,  20,    0,  -22 },   // 0x72 'r'
+  {  9992,  15,  24,  19,    2,  -22 },   // 0x73 's'
+  { 10092,  14,  31,  16,    1,  -29 },   // 0x74 't'
+  { 10191,  25,  23,  27,    0,  -21 },   // 0x75 'u'
+  { 10306,  22,  23,  23,    0,  -21 },   // 0x76 'v'
+  { 10401,  33,  23,  33,    0,  -21 },   // 0x77 'w'
+  { 10546,  22,  22,  24,    1,  -21 },   // 0x78 'x'
+  { 10642,  21,  31,  23,    0,  -21 },   // 0x79 'y'
+  { 10769,  19,  22,  21,    1,  -21 },   // 0x7A 'z'
+  { 10853,  14,  42,  19,    1,  -33 },   // 0x7B '{'
+  { 10979,   4,  33,  10,    3,  -32 },   // 0x7C '|'
+  { 11078,  14,  42,  19,    4,  -33 },   // 0x7D '}'
+  { 11204,  22,   7,  24,    1,  -14 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSerifBold24pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSerifBold24pt7bSpanData,
+    (GFXglyph *)FreeSerifBold24pt7bSpanGlyphs,
+    0x20, 0x7E, 56 } };
+
+// Approx. 12017 bytes
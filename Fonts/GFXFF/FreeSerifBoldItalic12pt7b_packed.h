@@ -0,0 +1,295 @@
+// FreeSerifBoldItalic12pt7b as run lengths, generated by Tools/GFX_pack from FreeSerifBoldItalic12pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeSerifBoldItalic12pt7bPackedRuns[] PROGMEM = {
+  0x53, 0x53, 0x53, 0x44, 0x43, 0x53, 0x52, 0x62, 0x61, 0x62, 0x61, 0xF6,
+  0x25, 0x44, 0x45, 0x25, 0x12, 0x45, 0x36, 0x35, 0x42, 0x12, 0x42, 0x11,
+  0x51, 0x21, 0x51, 0x20, 0x72, 0x32, 0x72, 0x22, 0x72, 0x32, 0x72, 0x22,
+  0x72, 0x32, 0x4C, 0x42, 0x32, 0x72, 0x32, 0x72, 0x22, 0x72, 0x32, 0x4C,
+  0x42, 0x32, 0x72, 0x22, 0x72, 0x32, 0x72, 0x32, 0x72, 0x22, 0x70, 0x81,
+  0xB1, 0x85, 0x52, 0x21, 0x12, 0x32, 0x31, 0x22, 0x22, 0x31, 0x22, 0x23,
+  0x11, 0x31, 0x35, 0x84, 0x85, 0x94, 0x85, 0x71, 0x13, 0x31, 0x22, 0x22,
+  0x31, 0x21, 0x32, 0x22, 0x21, 0x32, 0x25, 0x31, 0x52, 0x22, 0x74, 0x81,
+  0x80, 0xE1, 0x64, 0x52, 0x63, 0x26, 0x63, 0x31, 0x41, 0x63, 0x31, 0x31,
+  0x64, 0x31, 0x31, 0x63, 0x31, 0x31, 0x73, 0x31, 0x31, 0x73, 0x21, 0x31,
+  0x94, 0x32, 0x34, 0x91, 0x33, 0x21, 0x72, 0x23, 0x31, 0x71, 0x24, 0x31,
+  0x61, 0x33, 0x41, 0x61, 0x33, 0x31, 0x61, 0x43, 0x31, 0x61, 0x43, 0x21,
+  0x61, 0x64, 0x30, 0x84, 0xB2, 0x22, 0x93, 0x22, 0x93, 0x22, 0x93, 0x12,
+  0xA5, 0xB3, 0xB5, 0x25, 0x32, 0x23, 0x23, 0x32, 0x33, 0x22, 0x32, 0x43,
+  0x21, 0x33, 0x43, 0x21, 0x33, 0x54, 0x43, 0x53, 0x54, 0x53, 0x54, 0x44,
+  0x21, 0x27, 0x15, 0x10, 0x1A, 0x12, 0x11, 0x21, 0x20, 0x61, 0x51, 0x51,
+  0x52, 0x42, 0x43, 0x42, 0x52, 0x43, 0x42, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x61, 0x61, 0x61, 0x71, 0x61, 0x71, 0x30, 0x31, 0x71, 0x61, 0x71, 0x61,
+  0x62, 0x52, 0x52, 0x52, 0x52, 0x52, 0x43, 0x43, 0x42, 0x52, 0x42, 0x52,
+  0x42, 0x42, 0x42, 0xC0, 0x42, 0x42, 0x22, 0x12, 0x12, 0x21, 0x22, 0x13,
+  0x11, 0x13, 0x43, 0x49, 0x12, 0x21, 0x22, 0x12, 0x22, 0x12, 0x52, 0x81,
+  0x50, 0x52, 0xA2, 0xA2, 0xA2, 0xA2, 0x5F, 0x95, 0x2A, 0x2A, 0x2A, 0x2A,
+  0x25, 0x22, 0x33, 0x23, 0x32, 0x31, 0x41, 0x31, 0x22, 0x30, 0x0F, 0x30,
+  0x12, 0x18, 0x12, 0x10, 0x72, 0x82, 0x72, 0x82, 0x73, 0x72, 0x73, 0x72,
+  0x73, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72, 0x80, 0x63, 0x63, 0x21,
+  0x43, 0x31, 0x33, 0x42, 0x23, 0x42, 0x13, 0x43, 0x13, 0x43, 0x13, 0x46,
+  0x56, 0x43, 0x13, 0x43, 0x13, 0x43, 0x12, 0x43, 0x22, 0x43, 0x22, 0x33,
+  0x41, 0x32, 0x64, 0x50, 0x73, 0x46, 0x63, 0x73, 0x73, 0x64, 0x63, 0x73,
+  0x64, 0x63, 0x73, 0x73, 0x64, 0x63, 0x73, 0x64, 0x49, 0x10, 0x54, 0x66,
+  0x41, 0x34, 0x21, 0x53, 0x83, 0x83, 0x82, 0x83, 0x82, 0x82, 0x82, 0x82,
+  0x82, 0x81, 0x61, 0x38, 0x28, 0x29, 0x20, 0x55, 0x42, 0x24, 0x83, 0x83,
+  0x82, 0x83, 0x63, 0x66, 0x75, 0x74, 0x83, 0x83, 0x83, 0x82, 0x22, 0x43,
+  0x23, 0x31, 0x55, 0x50, 0xB1, 0xB2, 0x94, 0x85, 0x71, 0x13, 0x71, 0x23,
+  0x61, 0x33, 0x51, 0x33, 0x51, 0x43, 0x41, 0x53, 0x4A, 0x2B, 0x83, 0xA3,
+  0x93, 0xA3, 0x50, 0x57, 0x56, 0x57, 0x51, 0xB1, 0xA4, 0x86, 0x57, 0x94,
+  0x93, 0xA2, 0xA2, 0xA2, 0xA1, 0x42, 0x42, 0x34, 0x22, 0x55, 0x60, 0x92,
+  0x64, 0x63, 0x64, 0x73, 0x73, 0x77, 0x43, 0x32, 0x23, 0x43, 0x13, 0x43,
+  0x13, 0x43, 0x12, 0x44, 0x12, 0x44, 0x12, 0x43, 0x22, 0x34, 0x31, 0x33,
+  0x54, 0x50, 0x29, 0x19, 0x29, 0x12, 0x52, 0x21, 0x62, 0x82, 0x91, 0x92,
+  0x82, 0x92, 0x82, 0x83, 0x82, 0x82, 0x92, 0x82, 0x90, 0x63, 0x62, 0x31,
+  0x42, 0x42, 0x32, 0x42, 0x32, 0x42, 0x33, 0x32, 0x34, 0x12, 0x54, 0x75,
+  0x42, 0x23, 0x32, 0x43, 0x12, 0x62, 0x12, 0x62, 0x12, 0x62, 0x12, 0x52,
+  0x32, 0x32, 0x55, 0x40, 0x54, 0x63, 0x21, 0x43, 0x32, 0x33, 0x32, 0x24,
+  0x32, 0x23, 0x42, 0x23, 0x33, 0x23, 0x33, 0x23, 0x33, 0x32, 0x23, 0x56,
+  0x73, 0x83, 0x73, 0x73, 0x63, 0x63, 0x80, 0x42, 0x44, 0x34, 0x42, 0xFF,
+  0x02, 0x44, 0x34, 0x42, 0x40, 0x43, 0x54, 0x44, 0x43, 0xFF, 0x53, 0x53,
+  0x53, 0x62, 0x61, 0x61, 0x61, 0x60, 0xB1, 0x93, 0x75, 0x55, 0x46, 0x45,
+  0x73, 0x95, 0x95, 0x95, 0x95, 0xA3, 0xB1, 0x0F, 0x9F, 0x9F, 0x90, 0x01,
+  0xC3, 0xA6, 0xA5, 0xA5, 0xA5, 0xA4, 0x85, 0x56, 0x55, 0x65, 0x74, 0x92,
+  0xB0, 0x34, 0x42, 0x22, 0x32, 0x23, 0x22, 0x23, 0x63, 0x53, 0x63, 0x52,
+  0x62, 0x71, 0x71, 0xFA, 0x26, 0x45, 0x46, 0x26, 0x66, 0x93, 0x52, 0x62,
+  0x91, 0x42, 0x53, 0x22, 0x22, 0x52, 0x13, 0x12, 0x12, 0x42, 0x23, 0x23,
+  0x52, 0x32, 0x23, 0x52, 0x22, 0x33, 0x42, 0x32, 0x33, 0x42, 0x32, 0x33,
+  0x42, 0x22, 0x31, 0x22, 0x32, 0x22, 0x21, 0x32, 0x47, 0x52, 0xF2, 0x27,
+  0x19, 0x74, 0xB1, 0xE2, 0xD3, 0xD3, 0xC4, 0xB5, 0xB1, 0x14, 0x92, 0x14,
+  0x91, 0x33, 0x81, 0x43, 0x72, 0x43, 0x79, 0x62, 0x54, 0x42, 0x64, 0x41,
+  0x74, 0x32, 0x74, 0x25, 0x47, 0x3B, 0x74, 0x24, 0x63, 0x44, 0x53, 0x44,
+  0x44, 0x44, 0x44, 0x34, 0x53, 0x34, 0x67, 0x84, 0x34, 0x54, 0x44, 0x43,
+  0x54, 0x34, 0x54, 0x34, 0x54, 0x34, 0x45, 0x33, 0x54, 0x35, 0x34, 0x3B,
+  0x50, 0x75, 0x21, 0x53, 0x43, 0x43, 0x62, 0x33, 0x72, 0x24, 0x71, 0x24,
+  0x81, 0x24, 0xA5, 0xA4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xC4, 0x61, 0x54,
+  0x32, 0x85, 0x60, 0x3B, 0x94, 0x34, 0x73, 0x54, 0x63, 0x63, 0x54, 0x64,
+  0x44, 0x64, 0x43, 0x74, 0x43, 0x74, 0x34, 0x74, 0x34, 0x65, 0x33, 0x74,
+  0x34, 0x74, 0x34, 0x64, 0x44, 0x64, 0x43, 0x63, 0x54, 0x44, 0x5B, 0x70,
+  0x3E, 0x54, 0x53, 0x53, 0x71, 0x63, 0x71, 0x54, 0xD4, 0x32, 0x83, 0x41,
+  0x98, 0x84, 0x23, 0x84, 0x32, 0x83, 0x41, 0x93, 0x41, 0x84, 0x72, 0x44,
+  0x71, 0x53, 0x72, 0x45, 0x44, 0x3E, 0x30, 0x3D, 0x54, 0x43, 0x53, 0x61,
+  0x63, 0x61, 0x54, 0xC4, 0x32, 0x73, 0x41, 0x88, 0x74, 0x23, 0x74, 0x32,
+  0x73, 0x41, 0x83, 0xC4, 0xC4, 0xC3, 0xC5, 0xA7, 0x90, 0x76, 0x21, 0x64,
+  0x43, 0x53, 0x63, 0x43, 0x81, 0x44, 0x81, 0x34, 0xD4, 0xC5, 0xC4, 0x6B,
+  0x74, 0x24, 0x74, 0x24, 0x74, 0x24, 0x73, 0x43, 0x73, 0x44, 0x54, 0x54,
+  0x43, 0x87, 0x60, 0x38, 0x27, 0x54, 0x54, 0x74, 0x54, 0x73, 0x64, 0x64,
+  0x63, 0x74, 0x54, 0x73, 0x64, 0x73, 0x63, 0x7D, 0x74, 0x54, 0x73, 0x64,
+  0x64, 0x63, 0x74, 0x54, 0x74, 0x54, 0x73, 0x64, 0x65, 0x45, 0x57, 0x27,
+  0x40, 0x37, 0x54, 0x63, 0x73, 0x64, 0x64, 0x63, 0x73, 0x64, 0x64, 0x63,
+  0x73, 0x64, 0x64, 0x63, 0x65, 0x47, 0x30, 0x77, 0x84, 0xA4, 0xA3, 0xB3,
+  0xA4, 0xA4, 0xA3, 0xB3, 0xA4, 0xA4, 0xA3, 0xA4, 0xA4, 0x53, 0x23, 0x63,
+  0x14, 0x62, 0x23, 0x85, 0x80, 0x38, 0x15, 0x54, 0x52, 0x63, 0x52, 0x73,
+  0x42, 0x74, 0x32, 0x84, 0x21, 0xA3, 0x21, 0xB6, 0xA8, 0x94, 0x13, 0x93,
+  0x24, 0x74, 0x33, 0x74, 0x33, 0x74, 0x34, 0x63, 0x53, 0x55, 0x44, 0x37,
+  0x17, 0x20, 0x38, 0x94, 0xB3, 0xC3, 0xB4, 0xB4, 0xB3, 0xC3, 0xB4, 0xB4,
+  0xB3, 0xC3, 0xB4, 0x81, 0x23, 0x82, 0x23, 0x72, 0x24, 0x54, 0x1E, 0x10,
+  0x45, 0x86, 0x54, 0x84, 0x74, 0x75, 0x74, 0x65, 0x71, 0x13, 0x61, 0x13,
+  0x71, 0x13, 0x51, 0x14, 0x71, 0x14, 0x32, 0x14, 0x71, 0x14, 0x31, 0x23,
+  0x71, 0x33, 0x21, 0x33, 0x71, 0x33, 0x12, 0x24, 0x71, 0x33, 0x11, 0x34,
+  0x61, 0x45, 0x33, 0x71, 0x44, 0x43, 0x71, 0x43, 0x44, 0x71, 0x43, 0x44,
+  0x62, 0x42, 0x45, 0x55, 0x22, 0x37, 0x40, 0x35, 0x65, 0x54, 0x63, 0x64,
+  0x71, 0x75, 0x52, 0x61, 0x14, 0x51, 0x71, 0x24, 0x41, 0x71, 0x24, 0x41,
+  0x71, 0x34, 0x21, 0x71, 0x44, 0x21, 0x71, 0x54, 0x11, 0x71, 0x54, 0x11,
+  0x62, 0x64, 0x71, 0x74, 0x71, 0x83, 0x71, 0x82, 0x72, 0x91, 0x91, 0x81,
+  0x60, 0x76, 0x83, 0x33, 0x63, 0x53, 0x44, 0x54, 0x24, 0x64, 0x24, 0x64,
+  0x14, 0x74, 0x14, 0x79, 0x69, 0x74, 0x14, 0x74, 0x14, 0x64, 0x24, 0x64,
+  0x24, 0x54, 0x43, 0x53, 0x63, 0x33, 0x86, 0x70, 0x3B, 0x74, 0x24, 0x63,
+  0x44, 0x53, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x44, 0x53, 0x34, 0x59,
+  0x74, 0xC3, 0xD3, 0xC4, 0xC3, 0xD3, 0xC5, 0xA7, 0x90, 0x76, 0x83, 0x33,
+  0x63, 0x53, 0x44, 0x54, 0x24, 0x64, 0x24, 0x64, 0x14, 0x74, 0x14, 0x6A,
+  0x69, 0x74, 0x14, 0x74, 0x14, 0x64, 0x24, 0x64, 0x24, 0x54, 0x43, 0x53,
+  0x63, 0x23, 0xA3, 0xD1, 0x91, 0x36, 0x51, 0x3C, 0x31, 0x56, 0x40, 0x3A,
+  0x84, 0x24, 0x64, 0x34, 0x53, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x34,
+  0x53, 0x34, 0x59, 0x74, 0x14, 0x73, 0x24, 0x64, 0x24, 0x64, 0x34, 0x54,
+  0x34, 0x54, 0x34, 0x45, 0x44, 0x27, 0x35, 0x10, 0x54, 0x21, 0x33, 0x33,
+  0x32, 0x43, 0x23, 0x51, 0x33, 0x51, 0x34, 0x85, 0x85, 0x85, 0x85, 0x94,
+  0x84, 0x21, 0x63, 0x21, 0x63, 0x22, 0x52, 0x23, 0x43, 0x21, 0x25, 0x40,
+  0x1E, 0x13, 0x24, 0x23, 0x11, 0x43, 0x41, 0x12, 0x34, 0x41, 0x64, 0x41,
+  0x63, 0xC3, 0xB4, 0xB4, 0xB3, 0xC3, 0xB4, 0xB4, 0xB3, 0xB4, 0xB4, 0x98,
+  0x70, 0x17, 0x35, 0x24, 0x63, 0x33, 0x81, 0x43, 0x72, 0x34, 0x71, 0x44,
+  0x71, 0x43, 0x81, 0x43, 0x71, 0x44, 0x71, 0x44, 0x71, 0x44, 0x71, 0x44,
+  0x61, 0x54, 0x61, 0x54, 0x61, 0x54, 0x51, 0x74, 0x32, 0x86, 0x80, 0x08,
+  0x35, 0x24, 0x72, 0x34, 0x71, 0x44, 0x61, 0x54, 0x61, 0x54, 0x51, 0x73,
+  0x41, 0x83, 0x41, 0x84, 0x21, 0x94, 0x11, 0xA4, 0x11, 0xA5, 0xC3, 0xD3,
+  0xD2, 0xE1, 0xB0, 0x07, 0x25, 0x34, 0x24, 0x43, 0x52, 0x34, 0x43, 0x51,
+  0x44, 0x43, 0x51, 0x44, 0x34, 0x41, 0x54, 0x35, 0x31, 0x63, 0x21, 0x14,
+  0x21, 0x73, 0x21, 0x14, 0x21, 0x73, 0x11, 0x33, 0x11, 0x83, 0x11, 0x33,
+  0x11, 0x84, 0x44, 0x94, 0x44, 0x93, 0x53, 0xA3, 0x53, 0xB1, 0x62, 0xC1,
+  0x61, 0x90, 0x37, 0x25, 0x54, 0x52, 0x64, 0x42, 0x83, 0x32, 0x93, 0x22,
+  0xA6, 0xC4, 0xD3, 0xE4, 0xC5, 0xC1, 0x13, 0xB1, 0x23, 0xA1, 0x34, 0x81,
+  0x53, 0x72, 0x53, 0x63, 0x54, 0x45, 0x28, 0x20, 0x07, 0x25, 0x23, 0x62,
+  0x33, 0x61, 0x44, 0x41, 0x63, 0x31, 0x73, 0x31, 0x74, 0x11, 0x94, 0xA3,
+  0xB3, 0xA4, 0xA4, 0xA3, 0xB3, 0xA4, 0xA4, 0x88, 0x60, 0x3C, 0x33, 0x44,
+  0x42, 0x54, 0x32, 0x54, 0x41, 0x54, 0xB4, 0xA4, 0xA4, 0xA5, 0xA4, 0xA4,
+  0xA5, 0xA4, 0x61, 0x34, 0x61, 0x35, 0x52, 0x34, 0x44, 0x2C, 0x30, 0x55,
+  0x52, 0x73, 0x72, 0x82, 0x82, 0x73, 0x72, 0x82, 0x82, 0x73, 0x72, 0x82,
+  0x82, 0x73, 0x73, 0x72, 0x82, 0x73, 0x75, 0x50, 0x02, 0x42, 0x52, 0x42,
+  0x42, 0x42, 0x52, 0x42, 0x42, 0x42, 0x52, 0x42, 0x42, 0x42, 0x52, 0x42,
+  0x45, 0x63, 0x63, 0x62, 0x72, 0x72, 0x63, 0x62, 0x72, 0x72, 0x63, 0x62,
+  0x72, 0x72, 0x63, 0x63, 0x62, 0x72, 0x63, 0x45, 0x40, 0x42, 0x74, 0x64,
+  0x52, 0x13, 0x42, 0x22, 0x32, 0x32, 0x32, 0x42, 0x12, 0x52, 0x12, 0x62,
+  0x0C, 0x02, 0x33, 0x42, 0x42, 0x53, 0x13, 0x42, 0x23, 0x43, 0x23, 0x33,
+  0x33, 0x23, 0x42, 0x33, 0x42, 0x33, 0x33, 0x23, 0x43, 0x23, 0x42, 0x33,
+  0x24, 0x24, 0x11, 0x22, 0x11, 0x23, 0x33, 0x20, 0x61, 0x65, 0x83, 0x82,
+  0x83, 0x83, 0x82, 0x23, 0x35, 0x13, 0x23, 0x33, 0x23, 0x33, 0x22, 0x43,
+  0x13, 0x43, 0x13, 0x33, 0x23, 0x33, 0x13, 0x33, 0x23, 0x32, 0x33, 0x22,
+  0x55, 0x50, 0x53, 0x42, 0x22, 0x23, 0x22, 0x22, 0x63, 0x63, 0x53, 0x63,
+  0x63, 0x63, 0x41, 0x14, 0x21, 0x44, 0x30, 0xC1, 0x95, 0xB3, 0xB3, 0xA3,
+  0xB3, 0x73, 0x13, 0x62, 0x24, 0x52, 0x33, 0x53, 0x33, 0x43, 0x43, 0x43,
+  0x33, 0x53, 0x33, 0x43, 0x43, 0x43, 0x34, 0x43, 0x33, 0x11, 0x33, 0x21,
+  0x12, 0x11, 0x44, 0x23, 0x40, 0x53, 0x42, 0x22, 0x23, 0x22, 0x22, 0x32,
+  0x13, 0x22, 0x23, 0x13, 0x13, 0x12, 0x34, 0x53, 0x63, 0x41, 0x13, 0x31,
+  0x44, 0x30, 0xA3, 0xA2, 0x12, 0x82, 0x22, 0x82, 0xB3, 0xB3, 0x96, 0x93,
+  0xB3, 0xB3, 0xB2, 0xB3, 0xB3, 0xB3, 0xB3, 0xA3, 0xB3, 0xB3, 0xB2, 0x82,
+  0x22, 0x82, 0x12, 0xA3, 0xA0, 0x63, 0x83, 0x24, 0x33, 0x33, 0x43, 0x33,
+  0x43, 0x24, 0x52, 0x23, 0x74, 0x81, 0xB3, 0xA5, 0x87, 0x42, 0x34, 0x32,
+  0x62, 0x32, 0x62, 0x33, 0x42, 0x66, 0x50, 0x71, 0x85, 0xA2, 0xA3, 0xA3,
+  0xA3, 0xA2, 0x33, 0x43, 0x15, 0x44, 0x23, 0x43, 0x33, 0x34, 0x23, 0x43,
+  0x33, 0x43, 0x33, 0x43, 0x23, 0x43, 0x33, 0x43, 0x33, 0x11, 0x23, 0x33,
+  0x11, 0x22, 0x44, 0x20, 0x33, 0x33, 0x33, 0xF0, 0x21, 0x53, 0x33, 0x23,
+  0x33, 0x33, 0x24, 0x23, 0x33, 0x31, 0x11, 0x42, 0x33, 0x83, 0x83, 0x83,
+  0xFC, 0x58, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38,
+  0x28, 0x34, 0x22, 0x34, 0x21, 0x36, 0x46, 0x71, 0x85, 0xA3, 0x93, 0xA3,
+  0xA3, 0xA2, 0x25, 0x33, 0x32, 0x53, 0x22, 0x63, 0x21, 0x72, 0x21, 0x76,
+  0x76, 0x73, 0x12, 0x63, 0x23, 0x53, 0x23, 0x21, 0x23, 0x32, 0x11, 0x33,
+  0x33, 0x30, 0x52, 0x25, 0x33, 0x43, 0x43, 0x42, 0x43, 0x43, 0x43, 0x42,
+  0x43, 0x43, 0x43, 0x42, 0x43, 0x43, 0x21, 0x13, 0x11, 0x24, 0x30, 0x24,
+  0x33, 0x24, 0x33, 0x15, 0x11, 0x13, 0x34, 0x24, 0x23, 0x24, 0x33, 0x23,
+  0x34, 0x24, 0x23, 0x33, 0x33, 0x23, 0x43, 0x33, 0x23, 0x33, 0x42, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x13, 0x33, 0x34, 0x13, 0x33,
+  0x43, 0x20, 0x24, 0x24, 0x33, 0x11, 0x13, 0x34, 0x23, 0x24, 0x23, 0x34,
+  0x23, 0x33, 0x33, 0x33, 0x23, 0x34, 0x23, 0x33, 0x33, 0x33, 0x33, 0x11,
+  0x13, 0x34, 0x13, 0x43, 0x20, 0x44, 0x52, 0x22, 0x33, 0x23, 0x13, 0x33,
+  0x13, 0x36, 0x46, 0x37, 0x33, 0x13, 0x33, 0x13, 0x23, 0x32, 0x22, 0x54,
+  0x40, 0x44, 0x23, 0x65, 0x13, 0x53, 0x33, 0x53, 0x33, 0x43, 0x43, 0x43,
+  0x34, 0x43, 0x33, 0x53, 0x33, 0x43, 0x33, 0x53, 0x33, 0x53, 0x23, 0x66,
+  0x73, 0xB3, 0xB3, 0x96, 0x80, 0x53, 0x13, 0x42, 0x23, 0x42, 0x33, 0x33,
+  0x33, 0x23, 0x43, 0x23, 0x33, 0x24, 0x33, 0x23, 0x43, 0x23, 0x33, 0x33,
+  0x33, 0x33, 0x24, 0x44, 0x12, 0x93, 0x93, 0x84, 0x67, 0x30, 0x42, 0x13,
+  0x15, 0x13, 0x32, 0x11, 0x12, 0x24, 0x63, 0x73, 0x73, 0x63, 0x73, 0x73,
+  0x63, 0x70, 0x33, 0x12, 0x22, 0x22, 0x32, 0x31, 0x32, 0x31, 0x33, 0x73,
+  0x63, 0x73, 0x72, 0x31, 0x32, 0x32, 0x21, 0x31, 0x13, 0x40, 0x42, 0x51,
+  0x43, 0x36, 0x23, 0x42, 0x43, 0x43, 0x43, 0x33, 0x43, 0x43, 0x43, 0x11,
+  0x24, 0x33, 0x40, 0x05, 0x33, 0x33, 0x33, 0x33, 0x32, 0x43, 0x23, 0x33,
+  0x33, 0x33, 0x32, 0x43, 0x32, 0x43, 0x23, 0x33, 0x33, 0x33, 0x15, 0x11,
+  0x14, 0x23, 0x11, 0x13, 0x34, 0x20, 0x04, 0x42, 0x13, 0x42, 0x22, 0x42,
+  0x22, 0x41, 0x32, 0x32, 0x32, 0x22, 0x42, 0x12, 0x54, 0x63, 0x72, 0x81,
+  0x70, 0x03, 0x51, 0x42, 0x13, 0x32, 0x42, 0x22, 0x32, 0x42, 0x22, 0x23,
+  0x41, 0x32, 0x14, 0x32, 0x38, 0x21, 0x43, 0x23, 0x11, 0x53, 0x24, 0x62,
+  0x33, 0x71, 0x42, 0x81, 0x41, 0x70, 0x43, 0x32, 0x35, 0x23, 0x53, 0x11,
+  0x93, 0xA3, 0xA3, 0xA3, 0xA3, 0x91, 0x12, 0x61, 0x21, 0x13, 0x11, 0x24,
+  0x24, 0x33, 0x42, 0x40, 0x51, 0x32, 0x24, 0x32, 0x34, 0x22, 0x43, 0x31,
+  0x43, 0x31, 0x43, 0x21, 0x62, 0x21, 0x63, 0x11, 0x64, 0x74, 0x73, 0x82,
+  0x91, 0xA1, 0x52, 0x21, 0x64, 0x70, 0x28, 0x27, 0x22, 0x32, 0x81, 0x81,
+  0x81, 0x81, 0x82, 0x82, 0x74, 0x55, 0x22, 0x43, 0x12, 0x63, 0x20, 0x74,
+  0x63, 0x73, 0x83, 0x82, 0x83, 0x83, 0x82, 0x92, 0x83, 0x74, 0x64, 0x73,
+  0x91, 0xA2, 0x92, 0x83, 0x83, 0x83, 0x82, 0xA3, 0x60, 0x0F, 0xF2, 0x53,
+  0x83, 0x82, 0x82, 0x82, 0x73, 0x73, 0x72, 0x82, 0x82, 0x91, 0x75, 0x53,
+  0x63, 0x73, 0x72, 0x82, 0x73, 0x72, 0x73, 0x53, 0x70, 0x23, 0x76, 0x22,
+  0x11, 0x36, 0x73, 0x10 };
+
+const GFXglyph FreeSerifBoldItalic12pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    1 },   // 0x20 ' '
+  {     0,   8,  17,   9,    2,  -15 },   // 0x21 '!'
+  {    16,   9,   7,  13,    4,  -15 },   // 0x22 '"'
+  {    28,  14,  16,  12,   -1,  -15 },   // 0x23 '#'
+  {    59,  12,  20,  12,    0,  -17 },   // 0x24 '$'
+  {    97,  18,  18,  20,    1,  -16 },   // 0x25 '%'
+  {   147,  16,  17,  19,    0,  -15 },   // 0x26 '&'
+  {   184,   3,   7,   7,    3,  -15 },   // 0x27 '''
+  {   189,   7,  21,   8,    1,  -15 },   // 0x28 '('
+  {   211,   7,  21,   8,   -1,  -15 },   // 0x29 ')'
+  {   232,  10,  10,  12,    1,  -15 },   // 0x2A '*'
+  {   253,  12,  12,  14,    1,  -11 },   // 0x2B '+'
+  {   265,   5,   8,   6,   -2,   -3 },   // 0x2C ','
+  {   274,   6,   3,   8,    0,   -6 },   // 0x2D '-'
+  {   276,   4,   4,   6,    0,   -2 },   // 0x2E '.'
+  {   280,  10,  16,   8,    0,  -15 },   // 0x2F '/'
+  {   297,  11,  17,  12,    0,  -15 },   // 0x30 '0'
+  {   328,  10,  17,  12,    0,  -15 },   // 0x31 '1'
+  {   346,  11,  17,  12,    0,  -15 },   // 0x32 '2'
+  {   367,  11,  17,  12,    0,  -15 },   // 0x33 '3'
+  {   388,  13,  16,  12,    0,  -15 },   // 0x34 '4'
+  {   411,  12,  17,  12,    0,  -15 },   // 0x35 '5'
+  {   431,  11,  17,  12,    1,  -15 },   // 0x36 '6'
+  {   458,  11,  16,  12,    2,  -15 },   // 0x37 '7'
+  {   477,  11,  17,  12,    0,  -15 },   // 0x38 '8'
+  {   508,  11,  17,  12,    0,  -15 },   // 0x39 '9'
+  {   535,   7,  12,   6,    0,  -10 },   // 0x3A ':'
+  {   545,   8,  15,   6,   -1,  -10 },   // 0x3B ';'
+  {   558,  12,  13,  14,    1,  -12 },   // 0x3C '<'
+  {   571,  12,   6,  14,    2,   -8 },   // 0x3D '='
+  {   575,  13,  13,  14,    1,  -12 },   // 0x3E '>'
+  {   589,   9,  17,  12,    2,  -15 },   // 0x3F '?'
+  {   608,  17,  16,  20,    1,  -15 },   // 0x40 '@'
+  {   650,  16,  17,  17,    0,  -15 },   // 0x41 'A'
+  {   677,  16,  17,  15,    0,  -15 },   // 0x42 'B'
+  {   709,  15,  17,  15,    1,  -15 },   // 0x43 'C'
+  {   735,  18,  17,  17,    0,  -15 },   // 0x44 'D'
+  {   768,  17,  17,  15,    0,  -15 },   // 0x45 'E'
+  {   799,  16,  17,  15,    0,  -15 },   // 0x46 'F'
+  {   825,  17,  17,  17,    1,  -15 },   // 0x47 'G'
+  {   855,  20,  17,  18,    0,  -15 },   // 0x48 'H'
+  {   889,  10,  17,   9,    0,  -15 },   // 0x49 'I'
+  {   907,  14,  18,  12,    0,  -15 },   // 0x4A 'J'
+  {   929,  17,  17,  16,    0,  -15 },   // 0x4B 'K'
+  {   962,  15,  17,  15,    0,  -15 },   // 0x4C 'L'
+  {   984,  23,  17,  21,    0,  -15 },   // 0x4D 'M'
+  {  1039,  19,  17,  17,    0,  -15 },   // 0x4E 'N'
+  {  1081,  16,  17,  16,    1,  -15 },   // 0x4F 'O'
+  {  1112,  16,  17,  14,    0,  -15 },   // 0x50 'P'
+  {  1137,  16,  21,  16,    1,  -15 },   // 0x51 'Q'
+  {  1175,  16,  17,  16,    0,  -15 },   // 0x52 'R'
+  {  1208,  12,  17,  12,    0,  -15 },   // 0x53 'S'
+  {  1236,  15,  17,  14,    2,  -15 },   // 0x54 'T'
+  {  1261,  16,  17,  17,    3,  -15 },   // 0x55 'U'
+  {  1295,  16,  16,  17,    3,  -15 },   // 0x56 'V'
+  {  1323,  21,  16,  22,    3,  -15 },   // 0x57 'W'
+  {  1370,  17,  17,  17,    0,  -15 },   // 0x58 'X'
+  {  1400,  14,  17,  15,    3,  -15 },   // 0x59 'Y'
+  {  1425,  15,  17,  13,    0,  -15 },   // 0x5A 'Z'
+  {  1451,  10,  20,   8,   -1,  -15 },   // 0x5B '['
+  {  1472,   6,  16,  10,    3,  -15 },   // 0x5C '\'
+  {  1488,   9,  20,   8,   -1,  -15 },   // 0x5D ']'
+  {  1509,  10,   9,  14,    2,  -15 },   // 0x5E '^'
+  {  1524,  12,   1,  12,    0,    4 },   // 0x5F '_'
+  {  1525,   5,   4,   8,    2,  -15 },   // 0x60 '`'
+  {  1529,  12,  12,  12,    0,  -10 },   // 0x61 'a'
+  {  1556,  11,  18,  12,    1,  -16 },   // 0x62 'b'
+  {  1586,   9,  12,  10,    1,  -10 },   // 0x63 'c'
+  {  1603,  14,  18,  12,    0,  -16 },   // 0x64 'd'
+  {  1637,   9,  12,  10,    1,  -10 },   // 0x65 'e'
+  {  1658,  14,  22,  12,   -2,  -16 },   // 0x66 'f'
+  {  1685,  13,  16,  12,   -1,  -10 },   // 0x67 'g'
+  {  1711,  13,  18,  13,    0,  -16 },   // 0x68 'h'
+  {  1744,   6,  17,   7,    1,  -15 },   // 0x69 'i'
+  {  1761,  11,  21,   8,   -2,  -15 },   // 0x6A 'j'
+  {  1783,  13,  18,  12,    0,  -16 },   // 0x6B 'k'
+  {  1814,   7,  18,   7,    1,  -16 },   // 0x6C 'l'
+  {  1835,  18,  12,  18,    0,  -10 },   // 0x6D 'm'
+  {  1874,  12,  12,  13,    0,  -10 },   // 0x6E 'n'
+  {  1901,  10,  12,  11,    1,  -10 },   // 0x6F 'o'
+  {  1921,  14,  16,  12,   -2,  -10 },   // 0x70 'p'
+  {  1949,  12,  16,  12,    0,  -10 },   // 0x71 'q'
+  {  1978,  10,  11,  10,    0,  -10 },   // 0x72 'r'
+  {  1994,   9,  12,   9,    0,  -10 },   // 0x73 's'
+  {  2014,   7,  15,   7,    1,  -13 },   // 0x74 't'
+  {  2031,  12,  12,  13,    1,  -10 },   // 0x75 'u'
+  {  2058,  10,  11,  11,    1,  -10 },   // 0x76 'v'
+  {  2077,  15,  11,  16,    1,  -10 },   // 0x77 'w'
+  {  2106,  13,  12,  11,   -1,  -10 },   // 0x78 'x'
+  {  2128,  11,  16,  10,   -1,  -10 },   // 0x79 'y'
+  {  2154,  10,  13,  10,    0,  -10 },   // 0x7A 'z'
+  {  2171,  11,  21,   8,    0,  -16 },   // 0x7B '{'
+  {  2193,   2,  16,   6,    3,  -15 },   // 0x7C '|'
+  {  2195,  10,  21,   8,   -3,  -16 },   // 0x7D '}'
+  {  2217,  11,   4,  14,    1,   -7 } }; // 0x7E '~'
+
+const GFXfontPacked FreeSerifBoldItalic12pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeSerifBoldItalic12pt7bPackedRuns,
+    (GFXglyph *)FreeSerifBoldItalic12pt7bPackedGlyphs,
+    0x20, 0x7E, 29 } };
+
+// Approx. 2896 bytes
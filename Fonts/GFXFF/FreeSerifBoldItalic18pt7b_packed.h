@@ -0,0 +1,389 @@
+// FreeSerifBoldItalic18pt7b as run lengths, generated by Tools/GFX_pack from FreeSerifBoldItalic18pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeSerifBoldItalic18pt7bPackedRuns[] PROGMEM = {
+  0x73, 0x75, 0x65, 0x65, 0x65, 0x64, 0x74, 0x64, 0x74, 0x73, 0x83, 0x82,
+  0x92, 0x92, 0x82, 0x92, 0x91, 0xFF, 0xA4, 0x66, 0x56, 0x56, 0x64, 0x60,
+  0x23, 0x63, 0x14, 0x54, 0x14, 0x54, 0x13, 0x63, 0x23, 0x63, 0x23, 0x63,
+  0x22, 0x72, 0x32, 0x72, 0x31, 0x81, 0x32, 0x72, 0x30, 0xA3, 0x42, 0xA3,
+  0x43, 0xA3, 0x42, 0xB2, 0x43, 0xA3, 0x43, 0xA3, 0x33, 0xA3, 0x43, 0x6F,
+  0x23, 0xF1, 0x4F, 0x17, 0x34, 0x2B, 0x24, 0x3A, 0x34, 0x3A, 0x33, 0x3A,
+  0x34, 0x36, 0xF2, 0x3F, 0x14, 0xF1, 0x73, 0x42, 0xB2, 0x43, 0xA3, 0x43,
+  0xA2, 0x43, 0xA3, 0x43, 0xA3, 0x42, 0xA3, 0x43, 0xA0, 0xC1, 0xF0, 0x2B,
+  0x69, 0xA6, 0x42, 0x21, 0x35, 0x33, 0x22, 0x33, 0x34, 0x23, 0x23, 0x34,
+  0x14, 0x23, 0x33, 0x24, 0x14, 0x42, 0x24, 0x14, 0x51, 0x29, 0x7B, 0x7B,
+  0x7B, 0x7B, 0x7A, 0x7A, 0x21, 0x53, 0x15, 0x13, 0x43, 0x14, 0x23, 0x42,
+  0x24, 0x23, 0x42, 0x24, 0x14, 0x42, 0x32, 0x24, 0x33, 0x32, 0x23, 0x44,
+  0x62, 0x48, 0x89, 0x6B, 0x2F, 0x02, 0xB0, 0x64, 0x92, 0xA8, 0x54, 0x95,
+  0x2A, 0x95, 0x45, 0x22, 0x85, 0x51, 0x52, 0x95, 0x51, 0x42, 0x95, 0x61,
+  0x42, 0x95, 0x52, 0x32, 0xA4, 0x61, 0x42, 0xA4, 0x52, 0x32, 0xB4, 0x51,
+  0x42, 0xB4, 0x32, 0x42, 0x64, 0x38, 0x42, 0x47, 0x35, 0x52, 0x45, 0x22,
+  0xB2, 0x45, 0x41, 0xB2, 0x35, 0x51, 0xA2, 0x44, 0x61, 0xA2, 0x35, 0x61,
+  0x92, 0x45, 0x51, 0xA2, 0x44, 0x61, 0x92, 0x54, 0x52, 0x82, 0x64, 0x51,
+  0x92, 0x74, 0x22, 0x92, 0x88, 0x92, 0x95, 0x50, 0xC5, 0xF3, 0x9F, 0x04,
+  0x33, 0xF0, 0x35, 0x3D, 0x45, 0x3D, 0x45, 0x3D, 0x44, 0x3E, 0x43, 0x3F,
+  0x04, 0x13, 0xF2, 0x6F, 0x45, 0xF3, 0x74, 0x84, 0x32, 0x46, 0x45, 0x33,
+  0x55, 0x35, 0x34, 0x55, 0x25, 0x36, 0x53, 0x25, 0x46, 0x53, 0x16, 0x46,
+  0x61, 0x26, 0x47, 0x77, 0x56, 0x68, 0x57, 0x68, 0x65, 0x83, 0x21, 0xC1,
+  0xA3, 0xA3, 0x86, 0x67, 0x44, 0x23, 0x14, 0x14, 0x13, 0x23, 0x23, 0x22,
+  0x32, 0x31, 0x32, 0x30, 0x92, 0x82, 0x82, 0x82, 0x82, 0x83, 0x73, 0x74,
+  0x73, 0x74, 0x73, 0x83, 0x74, 0x74, 0x73, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x92, 0x92, 0x92, 0x92, 0xA2, 0x92, 0xA1, 0xB1, 0xA1, 0x60, 0x52,
+  0xA1, 0xB1, 0xA1, 0xA2, 0xA1, 0xA2, 0x92, 0x92, 0x93, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x74, 0x74, 0x73, 0x83, 0x74, 0x73, 0x83, 0x73, 0x82,
+  0x83, 0x73, 0x72, 0x82, 0x82, 0x90, 0x53, 0xA3, 0xA3, 0x52, 0x33, 0x35,
+  0x31, 0x37, 0x21, 0x29, 0x11, 0x15, 0x53, 0x5C, 0x14, 0x21, 0x27, 0x31,
+  0x26, 0x33, 0x22, 0x63, 0xA3, 0xB1, 0x60, 0x73, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0x7F, 0xFF, 0x67, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x37,
+  0x33, 0x35, 0x25, 0x25, 0x34, 0x43, 0x42, 0x42, 0x42, 0x42, 0x41, 0x60,
+  0x1F, 0xF4, 0x10, 0x14, 0x1F, 0x31, 0x41, 0xB3, 0xA3, 0xB3, 0xA4, 0xA3,
+  0xB3, 0xA3, 0xB3, 0xA3, 0xB3, 0xA3, 0xB3, 0xA4, 0xA3, 0xB3, 0xA3, 0xB3,
+  0xA3, 0xB3, 0xA3, 0xB3, 0xA3, 0xB3, 0xB3, 0xA3, 0xB0, 0x84, 0x93, 0x22,
+  0x73, 0x42, 0x54, 0x42, 0x53, 0x53, 0x34, 0x53, 0x25, 0x53, 0x24, 0x54,
+  0x24, 0x54, 0x15, 0x54, 0x14, 0x64, 0x14, 0x5A, 0x5A, 0x54, 0x14, 0x64,
+  0x14, 0x55, 0x14, 0x55, 0x14, 0x54, 0x23, 0x64, 0x23, 0x54, 0x33, 0x54,
+  0x42, 0x44, 0x52, 0x43, 0x72, 0x23, 0x94, 0x80, 0xD2, 0x86, 0x69, 0xA5,
+  0xA4, 0xA5, 0xA5, 0xA5, 0xA4, 0xA5, 0xA5, 0xA5, 0xA4, 0xA5, 0xA5, 0xA4,
+  0xA5, 0xA5, 0xA5, 0xA4, 0xA5, 0xA5, 0xA5, 0x96, 0x6C, 0x30, 0x85, 0xA7,
+  0x89, 0x62, 0x36, 0x41, 0x65, 0x32, 0x74, 0xC4, 0xC4, 0xC4, 0xC3, 0xC4,
+  0xC3, 0xC3, 0xD2, 0xD3, 0xC2, 0xD2, 0xD2, 0xD2, 0x71, 0x52, 0x72, 0x51,
+  0x72, 0x5B, 0x4C, 0x3C, 0x3D, 0x30, 0x84, 0x98, 0x69, 0x52, 0x45, 0x41,
+  0x64, 0xB4, 0xB4, 0xB3, 0xB4, 0xA3, 0xA5, 0x88, 0x96, 0xB5, 0xA5, 0xB4,
+  0xB4, 0xB4, 0xB4, 0xB3, 0xB4, 0x23, 0x63, 0x34, 0x43, 0x4A, 0x66, 0x80,
+  0xF1, 0x2F, 0x03, 0xE4, 0xD4, 0xD5, 0xC6, 0xB1, 0x15, 0xA1, 0x24, 0xA1,
+  0x25, 0x91, 0x35, 0x82, 0x34, 0x82, 0x44, 0x72, 0x45, 0x62, 0x55, 0x52,
+  0x64, 0x52, 0x74, 0x5F, 0x03, 0xF0, 0x2F, 0x1A, 0x5D, 0x5D, 0x4E, 0x4D,
+  0x56, 0x79, 0x89, 0x7A, 0x7A, 0x62, 0xF0, 0x2F, 0x01, 0xF0, 0x5C, 0x79,
+  0x98, 0xAB, 0x6D, 0x5D, 0x4D, 0x4E, 0x3E, 0x3E, 0x3E, 0x2F, 0x02, 0xE3,
+  0x44, 0x53, 0x55, 0x33, 0x6A, 0x96, 0x90, 0xE3, 0xB5, 0xA5, 0xA5, 0xB5,
+  0xB5, 0xB5, 0xB5, 0xC5, 0xB9, 0x7C, 0x56, 0x24, 0x55, 0x44, 0x36, 0x44,
+  0x35, 0x54, 0x35, 0x54, 0x35, 0x54, 0x34, 0x55, 0x34, 0x55, 0x34, 0x54,
+  0x44, 0x45, 0x53, 0x44, 0x64, 0x24, 0x88, 0xB5, 0x80, 0x2E, 0x2D, 0x3D,
+  0x2D, 0x32, 0x83, 0x21, 0x93, 0x31, 0x92, 0xD3, 0xD2, 0xD3, 0xC3, 0xD3,
+  0xC3, 0xD3, 0xC3, 0xC3, 0xD3, 0xC3, 0xD3, 0xC3, 0xD3, 0xC3, 0xC4, 0xC3,
+  0xD0, 0x85, 0xB8, 0x83, 0x43, 0x63, 0x54, 0x44, 0x63, 0x44, 0x63, 0x44,
+  0x63, 0x45, 0x53, 0x45, 0x43, 0x56, 0x23, 0x79, 0x96, 0xC6, 0x99, 0x63,
+  0x26, 0x53, 0x46, 0x33, 0x65, 0x23, 0x84, 0x23, 0x84, 0x23, 0x84, 0x23,
+  0x84, 0x23, 0x83, 0x43, 0x63, 0x63, 0x43, 0x96, 0x70, 0x85, 0xA9, 0x75,
+  0x24, 0x55, 0x43, 0x45, 0x53, 0x44, 0x64, 0x25, 0x64, 0x25, 0x64, 0x24,
+  0x65, 0x24, 0x65, 0x24, 0x65, 0x24, 0x56, 0x24, 0x55, 0x44, 0x36, 0x5B,
+  0x7A, 0xB5, 0xB5, 0xB6, 0xB5, 0xB4, 0xB5, 0xB5, 0xA4, 0xC2, 0xF0, 0x54,
+  0x56, 0x46, 0x46, 0x54, 0xFF, 0xFF, 0xC4, 0x56, 0x46, 0x46, 0x54, 0x50,
+  0x64, 0x66, 0x56, 0x56, 0x64, 0xFF, 0xFF, 0xA2, 0x84, 0x75, 0x65, 0x74,
+  0x83, 0x82, 0x92, 0x82, 0x82, 0x72, 0x90, 0xFF, 0x33, 0xD5, 0xB7, 0x97,
+  0x88, 0x88, 0x87, 0x97, 0xB5, 0xD6, 0xD7, 0xD8, 0xC8, 0xD7, 0xD8, 0xC6,
+  0xE4, 0xF2, 0x10, 0x0F, 0xFF, 0x9F, 0xFF, 0xFC, 0xFF, 0xF9, 0xF3, 0x3F,
+  0x05, 0xD7, 0xD7, 0xD8, 0xC8, 0xD7, 0xD7, 0xD5, 0xC6, 0xA7, 0x88, 0x88,
+  0x87, 0x88, 0xA6, 0xC4, 0xE1, 0xF2, 0x55, 0x68, 0x43, 0x34, 0x33, 0x44,
+  0x24, 0x34, 0x32, 0x44, 0x94, 0x85, 0x84, 0x94, 0x84, 0x84, 0x92, 0xA2,
+  0xB1, 0xB2, 0xB1, 0xFF, 0xF3, 0x48, 0x67, 0x67, 0x68, 0x48, 0xA7, 0xF0,
+  0xDA, 0x57, 0x48, 0x4B, 0x36, 0x3E, 0x34, 0x39, 0x25, 0x33, 0x37, 0x82,
+  0x22, 0x37, 0x42, 0x32, 0x31, 0x36, 0x43, 0x33, 0x57, 0x34, 0x24, 0x56,
+  0x43, 0x34, 0x56, 0x34, 0x34, 0x55, 0x44, 0x34, 0x55, 0x34, 0x35, 0x55,
+  0x34, 0x34, 0x21, 0x35, 0x33, 0x44, 0x22, 0x34, 0x32, 0x11, 0x33, 0x23,
+  0x34, 0x52, 0x74, 0x35, 0x34, 0x56, 0x3F, 0x83, 0xF8, 0x4C, 0x19, 0x58,
+  0x3B, 0xDF, 0x07, 0x80, 0xF1, 0x1F, 0x62, 0xF5, 0x3F, 0x53, 0xF4, 0x5F,
+  0x35, 0xF2, 0x6F, 0x17, 0xF1, 0x11, 0x5F, 0x02, 0x24, 0xF0, 0x13, 0x4E,
+  0x23, 0x5C, 0x24, 0x5C, 0x15, 0x5B, 0x25, 0x5B, 0x16, 0x5A, 0xD9, 0xF0,
+  0x82, 0x85, 0x72, 0x95, 0x63, 0x95, 0x62, 0xA5, 0x53, 0xA5, 0x44, 0xA6,
+  0x27, 0x5B, 0x5E, 0xCF, 0x09, 0x64, 0x68, 0x65, 0x67, 0x56, 0x67, 0x56,
+  0x67, 0x56, 0x66, 0x57, 0x66, 0x56, 0x67, 0x55, 0x68, 0x53, 0x69, 0xCC,
+  0x54, 0x5A, 0x55, 0x67, 0x66, 0x57, 0x57, 0x66, 0x57, 0x66, 0x57, 0x65,
+  0x67, 0x65, 0x57, 0x75, 0x57, 0x66, 0x56, 0x66, 0x64, 0x76, 0xF2, 0x6F,
+  0x09, 0xB6, 0x51, 0x8C, 0x11, 0x86, 0x54, 0x67, 0x73, 0x57, 0x92, 0x56,
+  0xA2, 0x46, 0xB1, 0x46, 0xC1, 0x46, 0xF1, 0x6F, 0x26, 0xF1, 0x7F, 0x17,
+  0xF1, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF3, 0x5C, 0x15,
+  0x6A, 0x26, 0x68, 0x28, 0x65, 0x3A, 0xBF, 0x06, 0xA0, 0x5E, 0xCF, 0x1C,
+  0x64, 0x6A, 0x66, 0x59, 0x57, 0x68, 0x58, 0x58, 0x58, 0x57, 0x59, 0x66,
+  0x59, 0x66, 0x59, 0x66, 0x59, 0x65, 0x5A, 0x65, 0x5A, 0x65, 0x59, 0x74,
+  0x69, 0x65, 0x5A, 0x65, 0x59, 0x75, 0x59, 0x65, 0x68, 0x75, 0x59, 0x66,
+  0x58, 0x67, 0x57, 0x67, 0x65, 0x68, 0xF2, 0x8F, 0x0B, 0x5F, 0x37, 0xF1,
+  0x76, 0x64, 0x76, 0x72, 0x85, 0x91, 0x85, 0x91, 0x85, 0x91, 0x76, 0x61,
+  0xA5, 0x62, 0xA5, 0x43, 0xBC, 0xAD, 0xA5, 0x43, 0xB5, 0x52, 0xA6, 0x52,
+  0xA5, 0x61, 0xB5, 0x61, 0xB5, 0xB1, 0x56, 0xA2, 0x55, 0xA3, 0x55, 0x93,
+  0x65, 0x84, 0x56, 0x66, 0x4F, 0x43, 0xF4, 0x40, 0x5F, 0x37, 0xF1, 0x76,
+  0x64, 0x76, 0x72, 0x85, 0x91, 0x85, 0x91, 0x85, 0x91, 0x76, 0x51, 0xB5,
+  0x52, 0xB5, 0x43, 0xBB, 0xBC, 0xB5, 0x43, 0xB5, 0x52, 0xA6, 0x52, 0xA5,
+  0x61, 0xB5, 0x61, 0xB5, 0xF2, 0x6F, 0x25, 0xF3, 0x5F, 0x35, 0xF2, 0x6F,
+  0x17, 0xF0, 0xAD, 0xB7, 0x41, 0x9C, 0x12, 0x86, 0x54, 0x85, 0x83, 0x66,
+  0xA2, 0x66, 0xA1, 0x66, 0xB1, 0x56, 0xF3, 0x6F, 0x26, 0xF3, 0x6F, 0x36,
+  0xF2, 0x7F, 0x26, 0x8F, 0x1A, 0x62, 0x6A, 0x53, 0x6A, 0x53, 0x6A, 0x53,
+  0x6A, 0x45, 0x59, 0x55, 0x68, 0x56, 0x58, 0x57, 0x65, 0x59, 0xDE, 0x7A,
+  0x5B, 0x2B, 0x77, 0x67, 0x96, 0x86, 0x96, 0x85, 0xA5, 0x95, 0xA5, 0x86,
+  0xA5, 0x85, 0xA6, 0x85, 0xA5, 0x95, 0xA5, 0x85, 0xB5, 0x85, 0xAF, 0x4A,
+  0xF4, 0xA5, 0x85, 0xA6, 0x85, 0xA5, 0x95, 0xA5, 0x86, 0xA5, 0x85, 0xA6,
+  0x85, 0xA5, 0x95, 0xA5, 0x86, 0xA5, 0x85, 0xA6, 0x85, 0x97, 0x77, 0x7A,
+  0x3B, 0x50, 0x5A, 0x77, 0x86, 0x96, 0x95, 0xA5, 0xA5, 0x95, 0xA5, 0xA5,
+  0xA5, 0x95, 0xA5, 0xA5, 0x96, 0x95, 0xA5, 0xA5, 0x95, 0xA5, 0xA5, 0xA5,
+  0x96, 0x87, 0x7A, 0x50, 0xAA, 0xB8, 0xD6, 0xE5, 0xF0, 0x5F, 0x05, 0xE6,
+  0xE5, 0xF0, 0x5F, 0x05, 0xE5, 0xF0, 0x5F, 0x05, 0xE6, 0xE5, 0xF0, 0x5F,
+  0x05, 0xE6, 0xE5, 0xF0, 0x5F, 0x05, 0xE5, 0x92, 0x45, 0x84, 0x26, 0x83,
+  0x26, 0xA9, 0xC6, 0xC0, 0x5B, 0x27, 0x77, 0x64, 0x86, 0x72, 0xA6, 0x62,
+  0xB5, 0x62, 0xC5, 0x52, 0xD5, 0x42, 0xD6, 0x32, 0xE5, 0x32, 0xF0, 0x52,
+  0x2F, 0x15, 0x13, 0xF0, 0x51, 0x4F, 0x0A, 0xF0, 0x51, 0x5D, 0x61, 0x5D,
+  0x53, 0x5C, 0x53, 0x5C, 0x53, 0x6A, 0x64, 0x5A, 0x55, 0x69, 0x56, 0x59,
+  0x56, 0x58, 0x67, 0x56, 0x76, 0x74, 0xA2, 0xA3, 0x5B, 0xD7, 0xF0, 0x6F,
+  0x16, 0xF1, 0x5F, 0x25, 0xF2, 0x5F, 0x15, 0xF2, 0x5F, 0x25, 0xF2, 0x5F,
+  0x15, 0xF2, 0x5F, 0x25, 0xF1, 0x6F, 0x15, 0xF2, 0x5F, 0x25, 0xC1, 0x35,
+  0xC2, 0x35, 0xB2, 0x45, 0xA3, 0x45, 0x94, 0x36, 0x67, 0x2F, 0x42, 0xF5,
+  0x20, 0x58, 0xC8, 0x76, 0xC7, 0x95, 0xB7, 0xA5, 0xA7, 0xA6, 0xA7, 0xA7,
+  0x82, 0x15, 0xA7, 0x82, 0x15, 0xA1, 0x15, 0x72, 0x15, 0xA2, 0x15, 0x62,
+  0x25, 0xA2, 0x15, 0x62, 0x25, 0xA2, 0x15, 0x52, 0x25, 0xA2, 0x25, 0x52,
+  0x25, 0xA2, 0x25, 0x42, 0x35, 0xA2, 0x34, 0x32, 0x45, 0x93, 0x35, 0x22,
+  0x35, 0xA2, 0x45, 0x12, 0x45, 0xA2, 0x47, 0x55, 0xA2, 0x47, 0x55, 0x92,
+  0x56, 0x55, 0xA2, 0x55, 0x65, 0xA2, 0x55, 0x65, 0x93, 0x63, 0x66, 0x93,
+  0x63, 0x66, 0x85, 0x52, 0x67, 0x78, 0x31, 0x5B, 0x50, 0x57, 0x87, 0x75,
+  0xA4, 0x86, 0xA2, 0xA5, 0xA2, 0x97, 0x91, 0xA7, 0x82, 0xA2, 0x15, 0x72,
+  0x92, 0x25, 0x71, 0xA2, 0x26, 0x61, 0xA2, 0x35, 0x52, 0xA2, 0x35, 0x52,
+  0x92, 0x55, 0x41, 0xA2, 0x55, 0x41, 0xA2, 0x65, 0x22, 0x93, 0x65, 0x22,
+  0x92, 0x76, 0x11, 0xA2, 0x87, 0xA2, 0x87, 0x92, 0xA5, 0xA2, 0xA5, 0xA2,
+  0xB4, 0x93, 0xB4, 0x93, 0xC2, 0x95, 0xB2, 0xE1, 0xA2, 0x80, 0xB7, 0xEA,
+  0xB5, 0x45, 0x85, 0x64, 0x75, 0x84, 0x55, 0x94, 0x46, 0x95, 0x35, 0xA5,
+  0x26, 0xA5, 0x25, 0xB5, 0x16, 0xA6, 0x15, 0xB6, 0x15, 0xB5, 0x16, 0xA6,
+  0x16, 0xA6, 0x15, 0xB5, 0x25, 0xA6, 0x25, 0xA5, 0x35, 0x96, 0x35, 0x95,
+  0x54, 0x85, 0x65, 0x65, 0x85, 0x45, 0xAB, 0xE7, 0xB0, 0x5E, 0xBE, 0x96,
+  0x36, 0x85, 0x55, 0x85, 0x56, 0x75, 0x56, 0x75, 0x56, 0x65, 0x66, 0x65,
+  0x57, 0x65, 0x56, 0x75, 0x47, 0x65, 0x47, 0x7E, 0x9C, 0xA5, 0xF3, 0x5F,
+  0x35, 0xF3, 0x5F, 0x25, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x26, 0xF1, 0x7F,
+  0x0A, 0xD0, 0xB7, 0xEA, 0xB5, 0x45, 0x85, 0x64, 0x75, 0x84, 0x55, 0x94,
+  0x46, 0x95, 0x35, 0xA5, 0x26, 0xA5, 0x25, 0xB5, 0x16, 0xA6, 0x16, 0xA6,
+  0x15, 0xB5, 0x16, 0xB5, 0x16, 0xA6, 0x15, 0xB5, 0x25, 0xA6, 0x25, 0xA5,
+  0x35, 0xA5, 0x35, 0x95, 0x54, 0x85, 0x64, 0x75, 0x84, 0x54, 0xCA, 0xF0,
+  0x3F, 0x42, 0xF5, 0x4C, 0x15, 0xA5, 0x24, 0xF3, 0x44, 0x1D, 0xE7, 0x70,
+  0x5E, 0xCF, 0x09, 0x64, 0x68, 0x65, 0x67, 0x65, 0x67, 0x56, 0x67, 0x56,
+  0x66, 0x66, 0x66, 0x56, 0x67, 0x55, 0x77, 0x54, 0x68, 0xF0, 0x9C, 0xC5,
+  0x17, 0xA6, 0x26, 0xA6, 0x26, 0xA5, 0x37, 0x95, 0x46, 0x86, 0x46, 0x85,
+  0x66, 0x75, 0x66, 0x75, 0x66, 0x66, 0x76, 0x47, 0x76, 0x3B, 0x48, 0x10,
+  0x85, 0x41, 0x69, 0x12, 0x63, 0x54, 0x53, 0x73, 0x44, 0x73, 0x44, 0x81,
+  0x54, 0x81, 0x55, 0x71, 0x56, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC6, 0xD6,
+  0xD5, 0xE4, 0x31, 0xA4, 0x31, 0xA4, 0x32, 0x94, 0x23, 0x84, 0x35, 0x54,
+  0x41, 0x39, 0x51, 0x56, 0x60, 0x2F, 0x42, 0xF4, 0x24, 0x35, 0x34, 0x23,
+  0x45, 0x43, 0x13, 0x45, 0x52, 0x22, 0x55, 0x61, 0x21, 0x65, 0x61, 0x86,
+  0x61, 0x85, 0xF1, 0x5F, 0x15, 0xF0, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF0,
+  0x5F, 0x15, 0xF1, 0x5F, 0x06, 0xF0, 0x5F, 0x15, 0xF1, 0x5F, 0x06, 0xE7,
+  0xCC, 0x90, 0x1B, 0x48, 0x37, 0x85, 0x46, 0xA3, 0x56, 0xA2, 0x65, 0xB2,
+  0x65, 0xB2, 0x65, 0xA2, 0x66, 0xA2, 0x65, 0xB2, 0x65, 0xB2, 0x56, 0xA2,
+  0x65, 0xB2, 0x65, 0xB2, 0x65, 0xA2, 0x75, 0xA2, 0x65, 0xB2, 0x65, 0xB2,
+  0x65, 0xA2, 0x75, 0xA2, 0x75, 0x93, 0x75, 0x92, 0x95, 0x72, 0xA6, 0x44,
+  0xBB, 0xF0, 0x7D, 0x0B, 0x67, 0x27, 0xA3, 0x56, 0xA2, 0x66, 0xA2, 0x66,
+  0x92, 0x76, 0x92, 0x85, 0x82, 0x95, 0x81, 0xA5, 0x72, 0xA5, 0x62, 0xB5,
+  0x61, 0xC6, 0x42, 0xC6, 0x32, 0xE5, 0x32, 0xE5, 0x22, 0xF0, 0x52, 0x1F,
+  0x15, 0x12, 0xF1, 0x7F, 0x27, 0xF2, 0x6F, 0x44, 0xF5, 0x4F, 0x53, 0xF6,
+  0x2F, 0x72, 0xF1, 0x0A, 0x29, 0x46, 0x27, 0x56, 0x73, 0x45, 0x74, 0x82,
+  0x55, 0x74, 0x81, 0x65, 0x74, 0x72, 0x65, 0x75, 0x61, 0x76, 0x56, 0x52,
+  0x85, 0x56, 0x51, 0x95, 0x47, 0x42, 0x95, 0x41, 0x15, 0x41, 0xA5, 0x32,
+  0x15, 0x32, 0xA5, 0x31, 0x34, 0x31, 0xB5, 0x22, 0x34, 0x22, 0xB5, 0x21,
+  0x45, 0x11, 0xC5, 0x12, 0x45, 0x11, 0xD6, 0x57, 0xD6, 0x56, 0xE5, 0x66,
+  0xE5, 0x65, 0xF0, 0x47, 0x5F, 0x04, 0x83, 0xF1, 0x48, 0x3F, 0x22, 0x92,
+  0xF3, 0x29, 0x2F, 0x31, 0xA1, 0xD0, 0x4B, 0x37, 0x67, 0x74, 0x85, 0x82,
+  0xA6, 0x62, 0xC5, 0x53, 0xC5, 0x52, 0xD5, 0x42, 0xF0, 0x52, 0x2F, 0x15,
+  0x12, 0xF2, 0x7F, 0x45, 0xF5, 0x5F, 0x55, 0xF5, 0x6F, 0x37, 0xF3, 0x11,
+  0x5F, 0x22, 0x24, 0xF1, 0x23, 0x5E, 0x24, 0x5D, 0x25, 0x5C, 0x27, 0x5A,
+  0x37, 0x59, 0x38, 0x58, 0x56, 0x85, 0x83, 0xA4, 0x0A, 0x47, 0x26, 0x84,
+  0x45, 0x83, 0x55, 0x82, 0x65, 0x72, 0x85, 0x61, 0x95, 0x52, 0x95, 0x42,
+  0xB5, 0x31, 0xC5, 0x22, 0xC5, 0x12, 0xE4, 0x11, 0xF0, 0x6F, 0x05, 0xF1,
+  0x5F, 0x06, 0xF0, 0x5F, 0x15, 0xF1, 0x5F, 0x05, 0xF1, 0x5F, 0x15, 0xF0,
+  0x6E, 0x7C, 0xC9, 0x5F, 0x15, 0xF1, 0x45, 0x66, 0x43, 0x76, 0x52, 0x85,
+  0x52, 0x86, 0x51, 0x86, 0xE6, 0xF0, 0x6E, 0x6E, 0x6F, 0x05, 0xF0, 0x6E,
+  0x6E, 0x6F, 0x06, 0xE6, 0xE6, 0x91, 0x55, 0x92, 0x46, 0x82, 0x46, 0x83,
+  0x45, 0x84, 0x36, 0x66, 0x2F, 0x33, 0xF3, 0x30, 0x77, 0x67, 0x74, 0xA3,
+  0xB3, 0xA4, 0xA4, 0xA3, 0xB3, 0xA4, 0xA4, 0xA3, 0xB3, 0xB3, 0xA4, 0xA3,
+  0xB3, 0xB3, 0xA4, 0xA4, 0xA3, 0xB3, 0xA4, 0xA4, 0xA3, 0xB3, 0xA4, 0xA4,
+  0xA8, 0x67, 0x70, 0x03, 0x73, 0x83, 0x73, 0x73, 0x82, 0x83, 0x73, 0x73,
+  0x83, 0x73, 0x73, 0x82, 0x83, 0x73, 0x73, 0x83, 0x73, 0x73, 0x82, 0x83,
+  0x73, 0x73, 0x83, 0x73, 0x68, 0x68, 0xA3, 0xB3, 0xB3, 0xA4, 0xA4, 0xA3,
+  0xB3, 0xA4, 0xA4, 0xA3, 0xB3, 0xA4, 0xA4, 0xA3, 0xB3, 0xA4, 0xA4, 0xA3,
+  0xB3, 0xB3, 0xA4, 0xA4, 0xA3, 0xB3, 0xA4, 0xA4, 0x67, 0x77, 0x70, 0x64,
+  0xC4, 0xB6, 0xA6, 0x93, 0x23, 0x83, 0x23, 0x73, 0x34, 0x63, 0x43, 0x54,
+  0x44, 0x43, 0x63, 0x34, 0x64, 0x23, 0x83, 0x14, 0x83, 0x10, 0x0F, 0xFF,
+  0x90, 0x03, 0x44, 0x34, 0x53, 0x53, 0x62, 0x84, 0x14, 0x76, 0x14, 0x65,
+  0x24, 0x64, 0x44, 0x54, 0x54, 0x45, 0x53, 0x54, 0x54, 0x44, 0x64, 0x44,
+  0x63, 0x45, 0x54, 0x44, 0x64, 0x44, 0x55, 0x44, 0x46, 0x27, 0x22, 0x14,
+  0x12, 0x18, 0x26, 0x36, 0x35, 0x54, 0x53, 0x40, 0x74, 0x87, 0xB5, 0xB5,
+  0xB4, 0xC4, 0xB5, 0xB4, 0xC4, 0xC4, 0x24, 0x54, 0x17, 0x46, 0x25, 0x35,
+  0x44, 0x34, 0x54, 0x25, 0x54, 0x24, 0x64, 0x24, 0x55, 0x14, 0x64, 0x24,
+  0x64, 0x24, 0x54, 0x34, 0x54, 0x24, 0x54, 0x34, 0x44, 0x44, 0x34, 0x69,
+  0x86, 0x80, 0x75, 0x68, 0x44, 0x23, 0x34, 0x24, 0x24, 0x33, 0x34, 0x84,
+  0x94, 0x85, 0x84, 0x94, 0x94, 0x94, 0x62, 0x14, 0x52, 0x34, 0x32, 0x48,
+  0x74, 0x60, 0xB7, 0xE5, 0xE5, 0xE5, 0xE4, 0xF0, 0x4E, 0x5E, 0x59, 0x41,
+  0x49, 0xA7, 0x52, 0x57, 0x43, 0x47, 0x44, 0x46, 0x45, 0x46, 0x44, 0x55,
+  0x45, 0x46, 0x45, 0x45, 0x45, 0x55, 0x45, 0x55, 0x44, 0x56, 0x44, 0x52,
+  0x13, 0x43, 0x61, 0x23, 0x81, 0x65, 0x62, 0x57, 0x44, 0x36, 0x74, 0x77,
+  0x54, 0x23, 0x34, 0x33, 0x24, 0x43, 0x24, 0x43, 0x14, 0x43, 0x24, 0x33,
+  0x25, 0x14, 0x38, 0x54, 0x94, 0x94, 0x61, 0x24, 0x52, 0x34, 0x32, 0x48,
+  0x74, 0x60, 0xF0, 0x5F, 0x03, 0x13, 0xD3, 0x23, 0xC3, 0x33, 0xB4, 0xF2,
+  0x4F, 0x24, 0xF1, 0x4F, 0x24, 0xEA, 0xBA, 0xD4, 0xF2, 0x4F, 0x24, 0xF1,
+  0x5F, 0x14, 0xF2, 0x4F, 0x24, 0xF1, 0x5F, 0x14, 0xF2, 0x4F, 0x24, 0xF2,
+  0x4F, 0x14, 0xF2, 0x4F, 0x24, 0xF2, 0x3F, 0x24, 0xC3, 0x23, 0xD3, 0x14,
+  0xD7, 0xF0, 0x5F, 0x00, 0x87, 0xAD, 0x55, 0x36, 0x45, 0x44, 0x55, 0x54,
+  0x54, 0x55, 0x54, 0x55, 0x54, 0x45, 0x73, 0x35, 0x8A, 0x98, 0xA2, 0xF1,
+  0x4F, 0x08, 0xBB, 0xAB, 0x53, 0x48, 0x33, 0x85, 0x33, 0x94, 0x33, 0x93,
+  0x44, 0x65, 0x5C, 0x97, 0x90, 0x37, 0xC5, 0xD4, 0xC5, 0xC4, 0xD4, 0xD4,
+  0xC5, 0xC4, 0x43, 0x64, 0x26, 0x54, 0x17, 0x45, 0x11, 0x24, 0x44, 0x11,
+  0x34, 0x45, 0x35, 0x45, 0x34, 0x45, 0x44, 0x45, 0x35, 0x44, 0x44, 0x45,
+  0x44, 0x44, 0x45, 0x44, 0x45, 0x21, 0x14, 0x44, 0x21, 0x15, 0x44, 0x11,
+  0x24, 0x56, 0x24, 0x63, 0x40, 0x62, 0x64, 0x54, 0x54, 0x62, 0xFF, 0x33,
+  0x27, 0x44, 0x54, 0x54, 0x54, 0x44, 0x54, 0x54, 0x54, 0x44, 0x54, 0x21,
+  0x23, 0x31, 0x14, 0x21, 0x26, 0x36, 0x43, 0x50, 0xD2, 0xD4, 0xC4, 0xC4,
+  0xD2, 0xFF, 0xFF, 0x22, 0x97, 0xB5, 0xB4, 0xC4, 0xC4, 0xB5, 0xB4, 0xC4,
+  0xC4, 0xB5, 0xB4, 0xC4, 0xC4, 0xB5, 0xB4, 0xC4, 0xC4, 0xB4, 0x63, 0x34,
+  0x63, 0x24, 0x78, 0x95, 0xA0, 0x37, 0xC5, 0xD4, 0xD4, 0xC4, 0xD4, 0xD4,
+  0xC5, 0xC4, 0x27, 0x44, 0x44, 0x54, 0x42, 0x65, 0x32, 0x74, 0x32, 0x84,
+  0x22, 0x94, 0x13, 0x84, 0x14, 0x89, 0x84, 0x14, 0x75, 0x14, 0x74, 0x34,
+  0x64, 0x34, 0x31, 0x24, 0x34, 0x21, 0x25, 0x46, 0x24, 0x55, 0x34, 0x63,
+  0x40, 0x37, 0x65, 0x65, 0x64, 0x74, 0x65, 0x65, 0x64, 0x74, 0x74, 0x64,
+  0x74, 0x74, 0x74, 0x64, 0x74, 0x74, 0x65, 0x64, 0x74, 0x21, 0x34, 0x22,
+  0x34, 0x12, 0x46, 0x55, 0x73, 0x70, 0x72, 0x43, 0x53, 0x47, 0x26, 0x26,
+  0x54, 0x27, 0x26, 0x54, 0x12, 0x24, 0x11, 0x24, 0x54, 0x11, 0x35, 0x34,
+  0x55, 0x43, 0x11, 0x34, 0x46, 0x35, 0x34, 0x55, 0x44, 0x44, 0x55, 0x44,
+  0x35, 0x45, 0x45, 0x34, 0x55, 0x44, 0x44, 0x54, 0x54, 0x44, 0x54, 0x54,
+  0x34, 0x55, 0x44, 0x44, 0x21, 0x24, 0x54, 0x44, 0x11, 0x34, 0x54, 0x46,
+  0x25, 0x44, 0x63, 0x40, 0x72, 0x34, 0x47, 0x26, 0x54, 0x27, 0x54, 0x21,
+  0x24, 0x54, 0x11, 0x34, 0x44, 0x11, 0x34, 0x54, 0x11, 0x34, 0x55, 0x44,
+  0x54, 0x44, 0x55, 0x44, 0x55, 0x44, 0x54, 0x45, 0x54, 0x44, 0x55, 0x44,
+  0x21, 0x24, 0x54, 0x11, 0x34, 0x56, 0x34, 0x63, 0x40, 0x75, 0x83, 0x32,
+  0x63, 0x43, 0x44, 0x44, 0x24, 0x54, 0x24, 0x54, 0x14, 0x64, 0x14, 0x5A,
+  0x59, 0x64, 0x14, 0x64, 0x14, 0x54, 0x24, 0x54, 0x24, 0x44, 0x43, 0x43,
+  0x63, 0x23, 0x85, 0x70, 0x83, 0x33, 0x76, 0x16, 0x7D, 0x64, 0x11, 0x34,
+  0x65, 0x44, 0x64, 0x54, 0x64, 0x54, 0x55, 0x45, 0x54, 0x54, 0x64, 0x54,
+  0x64, 0x45, 0x54, 0x54, 0x64, 0x45, 0x64, 0x44, 0x74, 0x34, 0x7B, 0x84,
+  0x14, 0xA4, 0xE4, 0xF0, 0x4F, 0x04, 0xE5, 0xD8, 0xB0, 0x74, 0x14, 0x5B,
+  0x44, 0x34, 0x44, 0x44, 0x44, 0x44, 0x34, 0x54, 0x25, 0x44, 0x34, 0x54,
+  0x34, 0x54, 0x24, 0x55, 0x24, 0x54, 0x34, 0x45, 0x34, 0x45, 0x34, 0x35,
+  0x47, 0x14, 0x56, 0x14, 0x63, 0x24, 0xC4, 0xC4, 0xC4, 0xB4, 0xC4, 0x9A,
+  0x30, 0x63, 0x23, 0x37, 0x15, 0x44, 0x16, 0x44, 0x11, 0x13, 0x55, 0x95,
+  0xA5, 0xA4, 0xA5, 0xA5, 0xA4, 0xB4, 0xA5, 0xA4, 0xB4, 0xA5, 0xA0, 0x53,
+  0x32, 0x3A, 0x33, 0x33, 0x33, 0x52, 0x33, 0x61, 0x34, 0x51, 0x35, 0x86,
+  0x85, 0x95, 0x95, 0x94, 0x41, 0x44, 0x41, 0x53, 0x42, 0x43, 0x33, 0x33,
+  0x41, 0x24, 0x60, 0x81, 0x82, 0x72, 0x73, 0x55, 0x39, 0x19, 0x34, 0x64,
+  0x64, 0x54, 0x64, 0x64, 0x55, 0x54, 0x64, 0x64, 0x21, 0x24, 0x31, 0x24,
+  0x21, 0x36, 0x46, 0x53, 0x60, 0x44, 0x44, 0x27, 0x44, 0x35, 0x54, 0x35,
+  0x54, 0x35, 0x44, 0x44, 0x54, 0x44, 0x54, 0x35, 0x44, 0x44, 0x54, 0x44,
+  0x45, 0x44, 0x45, 0x34, 0x45, 0x44, 0x31, 0x14, 0x21, 0x14, 0x22, 0x14,
+  0x21, 0x17, 0x26, 0x26, 0x35, 0x44, 0x53, 0x40, 0x32, 0x52, 0x15, 0x44,
+  0x14, 0x44, 0x24, 0x43, 0x24, 0x52, 0x24, 0x51, 0x34, 0x42, 0x34, 0x41,
+  0x44, 0x31, 0x54, 0x21, 0x64, 0x11, 0x75, 0x84, 0x93, 0xA2, 0xB1, 0xA0,
+  0x23, 0x61, 0x42, 0x15, 0x52, 0x34, 0x14, 0x52, 0x34, 0x14, 0x43, 0x43,
+  0x24, 0x33, 0x52, 0x24, 0x25, 0x41, 0x34, 0x25, 0x41, 0x34, 0x11, 0x14,
+  0x31, 0x46, 0x14, 0x21, 0x55, 0x24, 0x12, 0x55, 0x24, 0x11, 0x64, 0x35,
+  0x73, 0x44, 0x83, 0x44, 0x82, 0x62, 0x91, 0x71, 0x80, 0x63, 0x53, 0x47,
+  0x35, 0x64, 0x25, 0x74, 0x12, 0xB4, 0x11, 0xC5, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE5, 0xC6, 0xC1, 0x14, 0x31, 0x23, 0x21, 0x24, 0x22, 0x26, 0x27, 0x35,
+  0x45, 0x53, 0x63, 0x50, 0x72, 0x52, 0x56, 0x34, 0x55, 0x34, 0x64, 0x34,
+  0x65, 0x42, 0x65, 0x41, 0x84, 0x41, 0x84, 0x32, 0x84, 0x31, 0x95, 0x12,
+  0xA4, 0x11, 0xB6, 0xB5, 0xC5, 0xC4, 0xD4, 0xD3, 0xE2, 0xE2, 0x93, 0x22,
+  0x97, 0xA6, 0xC3, 0xD0, 0x3B, 0x4B, 0x4A, 0x42, 0x62, 0x51, 0x62, 0xD1,
+  0xD1, 0xD2, 0xC2, 0xC2, 0xD1, 0xD1, 0xD2, 0xC5, 0x96, 0x42, 0x37, 0x33,
+  0x12, 0x25, 0x23, 0x73, 0x22, 0xA4, 0x30, 0xB4, 0x95, 0x94, 0xA4, 0xB4,
+  0xB3, 0xB4, 0xB4, 0xB4, 0xB3, 0xB4, 0xB4, 0xB4, 0xA4, 0xB4, 0x95, 0x96,
+  0xB2, 0xD2, 0xD3, 0xC3, 0xB4, 0xB4, 0xB4, 0xB3, 0xB4, 0xB4, 0xB4, 0xB3,
+  0xC3, 0xD2, 0xE4, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x84, 0xD3, 0xD3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xB4, 0xB4, 0xB4, 0xB3, 0xB4, 0xB4, 0xB4, 0xB3, 0xD2,
+  0xE1, 0xC4, 0xA6, 0x84, 0xB4, 0xB3, 0xB4, 0xB4, 0xB4, 0xB3, 0xB4, 0xB4,
+  0xB3, 0xB4, 0x95, 0x85, 0xA0, 0x25, 0xA9, 0x32, 0x1F, 0x11, 0x24, 0x8A,
+  0x52 };
+
+const GFXglyph FreeSerifBoldItalic18pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,   9,    0,    1 },   // 0x20 ' '
+  {     0,  11,  25,  14,    2,  -23 },   // 0x21 '!'
+  {    24,  14,  10,  19,    4,  -23 },   // 0x22 '"'
+  {    45,  20,  25,  17,   -1,  -24 },   // 0x23 '#'
+  {    93,  17,  29,  18,    0,  -25 },   // 0x24 '$'
+  {   151,  27,  25,  29,    1,  -23 },   // 0x25 '%'
+  {   224,  25,  25,  27,    0,  -23 },   // 0x26 '&'
+  {   281,   5,  10,  10,    4,  -23 },   // 0x27 '''
+  {   292,  11,  30,  12,    1,  -23 },   // 0x28 '('
+  {   323,  11,  30,  12,   -2,  -23 },   // 0x29 ')'
+  {   354,  13,  15,  18,    2,  -23 },   // 0x2A '*'
+  {   379,  17,  17,  20,    1,  -16 },   // 0x2B '+'
+  {   396,   7,  11,   9,   -2,   -4 },   // 0x2C ','
+  {   408,   9,   4,  12,    0,   -9 },   // 0x2D '-'
+  {   411,   6,   5,   9,    0,   -3 },   // 0x2E '.'
+  {   415,  14,  25,  12,    0,  -23 },   // 0x2F '/'
+  {   441,  15,  25,  18,    1,  -23 },   // 0x30 '0'
+  {   488,  15,  25,  17,    0,  -23 },   // 0x31 '1'
+  {   514,  16,  25,  18,    0,  -23 },   // 0x32 '2'
+  {   546,  15,  25,  17,    1,  -23 },   // 0x33 '3'
+  {   576,  18,  24,  17,    0,  -23 },   // 0x34 '4'
+  {   613,  17,  25,  18,    0,  -23 },   // 0x35 '5'
+  {   643,  17,  25,  18,    1,  -23 },   // 0x36 '6'
+  {   681,  16,  24,  17,    3,  -23 },   // 0x37 '7'
+  {   709,  17,  25,  18,    0,  -23 },   // 0x38 '8'
+  {   753,  17,  25,  18,    0,  -23 },   // 0x39 '9'
+  {   791,  10,  17,   9,    0,  -15 },   // 0x3A ':'
+  {   804,  11,  22,   9,   -1,  -15 },   // 0x3B ';'
+  {   823,  18,  19,  20,    1,  -18 },   // 0x3C '<'
+  {   843,  18,  10,  20,    2,  -13 },   // 0x3D '='
+  {   850,  18,  19,  20,    2,  -18 },   // 0x3E '>'
+  {   870,  13,  25,  17,    3,  -23 },   // 0x3F '?'
+  {   898,  25,  25,  29,    2,  -23 },   // 0x40 '@'
+  {   964,  23,  25,  24,    0,  -23 },   // 0x41 'A'
+  {  1010,  24,  25,  22,    0,  -23 },   // 0x42 'B'
+  {  1057,  23,  25,  22,    1,  -23 },   // 0x43 'C'
+  {  1101,  26,  25,  25,    0,  -23 },   // 0x44 'D'
+  {  1149,  23,  25,  22,    0,  -23 },   // 0x45 'E'
+  {  1196,  23,  25,  21,    0,  -23 },   // 0x46 'F'
+  {  1239,  24,  25,  25,    2,  -23 },   // 0x47 'G'
+  {  1284,  29,  25,  26,    0,  -23 },   // 0x48 'H'
+  {  1334,  15,  25,  13,    0,  -23 },   // 0x49 'I'
+  {  1360,  20,  27,  17,    0,  -23 },   // 0x4A 'J'
+  {  1396,  25,  25,  23,    0,  -23 },   // 0x4B 'K'
+  {  1448,  22,  25,  21,    0,  -23 },   // 0x4C 'L'
+  {  1489,  33,  25,  31,    0,  -23 },   // 0x4D 'M'
+  {  1569,  27,  25,  25,    0,  -23 },   // 0x4E 'N'
+  {  1630,  23,  25,  24,    1,  -23 },   // 0x4F 'O'
+  {  1677,  23,  25,  21,    0,  -23 },   // 0x50 'P'
+  {  1718,  23,  31,  24,    1,  -23 },   // 0x51 'Q'
+  {  1776,  24,  25,  23,    0,  -23 },   // 0x52 'R'
+  {  1824,  18,  25,  18,    0,  -23 },   // 0x53 'S'
+  {  1865,  21,  25,  21,    3,  -23 },   // 0x54 'T'
+  {  1910,  24,  25,  25,    4,  -23 },   // 0x55 'U'
+  {  1959,  24,  25,  25,    4,  -23 },   // 0x56 'V'
+  {  2007,  31,  25,  32,    4,  -23 },   // 0x57 'W'
+  {  2082,  25,  25,  24,    0,  -23 },   // 0x58 'X'
+  {  2132,  21,  25,  22,    4,  -23 },   // 0x59 'Y'
+  {  2175,  21,  25,  20,    0,  -23 },   // 0x5A 'Z'
+  {  2216,  14,  30,  12,   -1,  -23 },   // 0x5B '['
+  {  2247,  10,  25,  14,    4,  -23 },   // 0x5C '\'
+  {  2272,  14,  30,  12,   -2,  -23 },   // 0x5D ']'
+  {  2303,  16,  13,  20,    2,  -23 },   // 0x5E '^'
+  {  2326,  18,   3,  17,    0,    3 },   // 0x5F '_'
+  {  2329,   7,   6,  12,    3,  -23 },   // 0x60 '`'
+  {  2335,  18,  17,  18,    0,  -15 },   // 0x61 'a'
+  {  2372,  16,  26,  17,    1,  -24 },   // 0x62 'b'
+  {  2414,  13,  17,  15,    1,  -15 },   // 0x63 'c'
+  {  2438,  19,  25,  18,    1,  -23 },   // 0x64 'd'
+  {  2482,  13,  17,  15,    1,  -15 },   // 0x65 'e'
+  {  2510,  21,  32,  17,   -3,  -24 },   // 0x66 'f'
+  {  2560,  19,  23,  17,   -1,  -15 },   // 0x67 'g'
+  {  2597,  17,  25,  19,    1,  -23 },   // 0x68 'h'
+  {  2645,   9,  25,  10,    1,  -23 },   // 0x69 'i'
+  {  2672,  16,  31,  12,   -3,  -23 },   // 0x6A 'j'
+  {  2705,  17,  25,  18,    1,  -23 },   // 0x6B 'k'
+  {  2749,  11,  25,  10,    1,  -23 },   // 0x6C 'l'
+  {  2778,  26,  17,  27,    0,  -15 },   // 0x6D 'm'
+  {  2836,  18,  17,  18,    0,  -15 },   // 0x6E 'n'
+  {  2877,  15,  17,  17,    1,  -15 },   // 0x6F 'o'
+  {  2908,  19,  23,  17,   -2,  -15 },   // 0x70 'p'
+  {  2949,  16,  23,  17,    1,  -15 },   // 0x71 'q'
+  {  2989,  15,  16,  14,    0,  -15 },   // 0x72 'r'
+  {  3011,  13,  17,  12,    0,  -15 },   // 0x73 's'
+  {  3039,  10,  22,  10,    1,  -20 },   // 0x74 't'
+  {  3065,  17,  17,  19,    1,  -15 },   // 0x75 'u'
+  {  3104,  13,  16,  15,    2,  -15 },   // 0x76 'v'
+  {  3132,  19,  16,  23,    3,  -15 },   // 0x77 'w'
+  {  3177,  18,  17,  17,   -1,  -15 },   // 0x78 'x'
+  {  3208,  17,  23,  15,   -2,  -15 },   // 0x79 'y'
+  {  3244,  15,  19,  14,    0,  -15 },   // 0x7A 'z'
+  {  3271,  15,  32,  12,    0,  -24 },   // 0x7B '{'
+  {  3304,   3,  25,   9,    4,  -23 },   // 0x7C '|'
+  {  3308,  15,  32,  12,   -5,  -24 },   // 0x7D '}'
+  {  3341,  16,   5,  20,    2,  -11 } }; // 0x7E '~'
+
+const GFXfontPacked FreeSerifBoldItalic18pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeSerifBoldItalic18pt7bPackedRuns,
+    (GFXglyph *)FreeSerifBoldItalic18pt7bPackedGlyphs,
+    0x20, 0x7E, 42 } };
+
+// Approx. 4021 bytes
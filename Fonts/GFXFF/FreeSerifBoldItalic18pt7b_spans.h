@@ -0,0 +1,814 @@
+// FreeSerifBoldItalic18pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSerifBoldItalic18pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSerifBoldItalic18pt7bSpanData[] PROGMEM = {
+  0x01, 0x07, 0x03, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05,
+  0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02,
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02,
+  0x01, 0x04, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x04, 0x02, 0x02, 0x03,
+  0x0B, 0x03, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x02, 0x01, 0x04, 0x0A, 0x04,
+  0x02, 0x01, 0x03, 0x0A, 0x03, 0x02, 0x01, 0x03, 0x0A, 0x03, 0x02, 0x01,
+  0x03, 0x0A, 0x03, 0x02, 0x01, 0x02, 0x0A, 0x02, 0x02, 0x01, 0x02, 0x0A,
+  0x02, 0x02, 0x01, 0x01, 0x0A, 0x01, 0x02, 0x00, 0x02, 0x09, 0x02, 0x02,
+  0x0A, 0x03, 0x11, 0x02, 0x02, 0x09, 0x03, 0x10, 0x03, 0x02, 0x09, 0x03,
+  0x10, 0x02, 0x02, 0x09, 0x02, 0x0F, 0x03, 0x02, 0x08, 0x03, 0x0F, 0x03,
+  0x02, 0x08, 0x03, 0x0E, 0x03, 0x02, 0x07, 0x03, 0x0E, 0x03, 0x01, 0x03,
+  0x11, 0x01, 0x03, 0x10, 0x01, 0x03, 0x10, 0x02, 0x06, 0x03, 0x0D, 0x02,
+  0x02, 0x06, 0x02, 0x0C, 0x03, 0x02, 0x05, 0x03, 0x0C, 0x03, 0x02, 0x05,
+  0x03, 0x0B, 0x03, 0x02, 0x04, 0x03, 0x0B, 0x03, 0x01, 0x00, 0x11, 0x01,
+  0x00, 0x10, 0x01, 0x00, 0x10, 0x02, 0x03, 0x03, 0x0A, 0x02, 0x02, 0x03,
+  0x02, 0x09, 0x03, 0x02, 0x02, 0x03, 0x09, 0x03, 0x02, 0x02, 0x02, 0x08,
+  0x03, 0x02, 0x01, 0x03, 0x08, 0x03, 0x02, 0x01, 0x03, 0x08, 0x02, 0x02,
+  0x00, 0x03, 0x07, 0x03, 0x01, 0x0C, 0x01, 0x01, 0x0B, 0x02, 0x01, 0x07,
+  0x06, 0x01, 0x05, 0x0A, 0x03, 0x04, 0x04, 0x0A, 0x02, 0x0D, 0x03, 0x03,
+  0x04, 0x03, 0x0A, 0x02, 0x0E, 0x03, 0x03, 0x03, 0x03, 0x0A, 0x02, 0x0F,
+  0x02, 0x03, 0x03, 0x03, 0x0A, 0x01, 0x0F, 0x02, 0x03, 0x03, 0x03, 0x09,
+  0x02, 0x0F, 0x01, 0x03, 0x03, 0x04, 0x09, 0x02, 0x0F, 0x01, 0x02, 0x03,
+  0x05, 0x09, 0x02, 0x01, 0x03, 0x07, 0x01, 0x04, 0x07, 0x01, 0x05, 0x07,
+  0x01, 0x06, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x02, 0x07, 0x02,
+  0x0A, 0x05, 0x03, 0x01, 0x01, 0x07, 0x01, 0x0B, 0x04, 0x03, 0x01, 0x01,
+  0x06, 0x02, 0x0B, 0x04, 0x03, 0x00, 0x02, 0x06, 0x02, 0x0B, 0x04, 0x03,
+  0x00, 0x02, 0x06, 0x01, 0x0B, 0x04, 0x03, 0x00, 0x03, 0x05, 0x02, 0x0B,
+  0x03, 0x03, 0x00, 0x03, 0x05, 0x02, 0x0A, 0x04, 0x02, 0x01, 0x06, 0x09,
+  0x04, 0x01, 0x04, 0x08, 0x01, 0x04, 0x06, 0x01, 0x04, 0x02, 0x01, 0x04,
+  0x02, 0x02, 0x06, 0x04, 0x13, 0x02, 0x02, 0x04, 0x08, 0x11, 0x04, 0x02,
+  0x03, 0x05, 0x0A, 0x0A, 0x03, 0x02, 0x05, 0x0B, 0x05, 0x12, 0x02, 0x03,
+  0x01, 0x05, 0x0B, 0x01, 0x11, 0x02, 0x03, 0x01, 0x05, 0x0B, 0x01, 0x10,
+  0x02, 0x03, 0x00, 0x05, 0x0B, 0x01, 0x10, 0x02, 0x03, 0x00, 0x05, 0x0A,
+  0x02, 0x0F, 0x02, 0x03, 0x00, 0x04, 0x0A, 0x01, 0x0F, 0x02, 0x03, 0x00,
+  0x04, 0x09, 0x02, 0x0E, 0x02, 0x03, 0x00, 0x04, 0x09, 0x01, 0x0E, 0x02,
+  0x04, 0x00, 0x04, 0x07, 0x02, 0x0D, 0x02, 0x15, 0x04, 0x03, 0x01, 0x08,
+  0x0D, 0x02, 0x13, 0x07, 0x04, 0x02, 0x05, 0x0C, 0x02, 0x12, 0x05, 0x19,
+  0x02, 0x03, 0x0B, 0x02, 0x11, 0x05, 0x1A, 0x01, 0x03, 0x0B, 0x02, 0x10,
+  0x05, 0x1A, 0x01, 0x03, 0x0A, 0x02, 0x10, 0x04, 0x1A, 0x01, 0x03, 0x0A,
+  0x02, 0x0F, 0x05, 0x1A, 0x01, 0x03, 0x09, 0x02, 0x0F, 0x05, 0x19, 0x01,
+  0x03, 0x09, 0x02, 0x0F, 0x04, 0x19, 0x01, 0x03, 0x08, 0x02, 0x0F, 0x04,
+  0x18, 0x02, 0x03, 0x07, 0x02, 0x0F, 0x04, 0x18, 0x01, 0x03, 0x07, 0x02,
+  0x10, 0x04, 0x16, 0x02, 0x02, 0x06, 0x02, 0x10, 0x08, 0x02, 0x06, 0x02,
+  0x11, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0A, 0x09, 0x02, 0x09, 0x04, 0x10,
+  0x03, 0x02, 0x09, 0x03, 0x11, 0x03, 0x02, 0x08, 0x04, 0x11, 0x03, 0x02,
+  0x08, 0x04, 0x11, 0x03, 0x02, 0x08, 0x04, 0x10, 0x03, 0x02, 0x08, 0x04,
+  0x0F, 0x03, 0x02, 0x08, 0x04, 0x0D, 0x03, 0x01, 0x08, 0x06, 0x01, 0x08,
+  0x05, 0x02, 0x06, 0x07, 0x11, 0x08, 0x03, 0x04, 0x03, 0x09, 0x04, 0x13,
+  0x04, 0x03, 0x03, 0x03, 0x09, 0x05, 0x13, 0x03, 0x03, 0x02, 0x03, 0x09,
+  0x05, 0x13, 0x02, 0x03, 0x01, 0x03, 0x0A, 0x05, 0x12, 0x02, 0x03, 0x00,
+  0x04, 0x0A, 0x05, 0x12, 0x01, 0x03, 0x00, 0x04, 0x0A, 0x06, 0x11, 0x02,
+  0x02, 0x00, 0x04, 0x0B, 0x07, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x02, 0x00,
+  0x05, 0x0C, 0x06, 0x03, 0x01, 0x06, 0x0C, 0x08, 0x17, 0x02, 0x02, 0x01,
+  0x0C, 0x0E, 0x0A, 0x02, 0x02, 0x0A, 0x0F, 0x08, 0x02, 0x04, 0x06, 0x11,
+  0x04, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x09, 0x02, 0x01, 0x08,
+  0x02, 0x01, 0x07, 0x02, 0x01, 0x06, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x05, 0x02, 0x01, 0x06, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07,
+  0x01, 0x01, 0x07, 0x02, 0x01, 0x08, 0x01, 0x01, 0x08, 0x02, 0x01, 0x08,
+  0x02, 0x01, 0x08, 0x02, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03, 0x01, 0x07,
+  0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x03, 0x00, 0x02, 0x05, 0x03, 0x0B, 0x02, 0x03,
+  0x00, 0x03, 0x06, 0x01, 0x0A, 0x03, 0x03, 0x00, 0x04, 0x06, 0x01, 0x09,
+  0x04, 0x03, 0x00, 0x05, 0x06, 0x01, 0x08, 0x05, 0x01, 0x05, 0x03, 0x01,
+  0x00, 0x0C, 0x03, 0x00, 0x04, 0x06, 0x01, 0x09, 0x04, 0x03, 0x00, 0x03,
+  0x06, 0x01, 0x09, 0x04, 0x03, 0x00, 0x02, 0x05, 0x03, 0x0A, 0x02, 0x01,
+  0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x06, 0x01, 0x01, 0x07, 0x03, 0x01,
+  0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01,
+  0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01,
+  0x00, 0x11, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01,
+  0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01,
+  0x03, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x08, 0x01,
+  0x00, 0x09, 0x01, 0x00, 0x09, 0x01, 0x00, 0x08, 0x01, 0x01, 0x04, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x04, 0x01,
+  0x0B, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x04, 0x01,
+  0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01,
+  0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01,
+  0x04, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01,
+  0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x08, 0x04, 0x02, 0x06, 0x03, 0x0B, 0x02, 0x02, 0x05,
+  0x03, 0x0C, 0x02, 0x02, 0x04, 0x04, 0x0C, 0x02, 0x02, 0x04, 0x03, 0x0C,
+  0x03, 0x02, 0x03, 0x04, 0x0C, 0x03, 0x02, 0x02, 0x05, 0x0C, 0x03, 0x02,
+  0x02, 0x04, 0x0B, 0x04, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x05,
+  0x0B, 0x04, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x04, 0x0A, 0x05,
+  0x02, 0x00, 0x05, 0x0A, 0x05, 0x02, 0x00, 0x05, 0x0A, 0x04, 0x02, 0x00,
+  0x04, 0x0A, 0x04, 0x02, 0x00, 0x04, 0x09, 0x05, 0x02, 0x00, 0x04, 0x09,
+  0x05, 0x02, 0x00, 0x04, 0x09, 0x04, 0x02, 0x00, 0x03, 0x09, 0x04, 0x02,
+  0x00, 0x03, 0x08, 0x04, 0x02, 0x00, 0x03, 0x08, 0x04, 0x02, 0x01, 0x02,
+  0x07, 0x04, 0x02, 0x01, 0x02, 0x07, 0x03, 0x02, 0x02, 0x02, 0x06, 0x03,
+  0x01, 0x03, 0x04, 0x01, 0x0D, 0x02, 0x01, 0x08, 0x06, 0x01, 0x05, 0x09,
+  0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05,
+  0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05,
+  0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05,
+  0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05,
+  0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x03, 0x06, 0x01, 0x00, 0x0C, 0x01, 0x08, 0x05, 0x01, 0x07, 0x07,
+  0x01, 0x06, 0x09, 0x02, 0x05, 0x02, 0x0A, 0x06, 0x02, 0x04, 0x01, 0x0B,
+  0x05, 0x02, 0x03, 0x02, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04,
+  0x01, 0x0C, 0x04, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x03, 0x01, 0x08, 0x02,
+  0x01, 0x07, 0x02, 0x01, 0x06, 0x02, 0x02, 0x05, 0x02, 0x0E, 0x01, 0x02,
+  0x04, 0x02, 0x0D, 0x02, 0x02, 0x04, 0x01, 0x0C, 0x02, 0x01, 0x03, 0x0B,
+  0x01, 0x02, 0x0C, 0x01, 0x01, 0x0C, 0x01, 0x00, 0x0D, 0x01, 0x08, 0x04,
+  0x01, 0x06, 0x08, 0x01, 0x05, 0x09, 0x02, 0x04, 0x02, 0x0A, 0x05, 0x02,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x03, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x03, 0x01, 0x07, 0x05, 0x01, 0x05,
+  0x08, 0x01, 0x07, 0x06, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x0A,
+  0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A,
+  0x03, 0x01, 0x09, 0x04, 0x02, 0x00, 0x03, 0x09, 0x03, 0x02, 0x00, 0x04,
+  0x08, 0x03, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x06, 0x01, 0x10, 0x02, 0x01,
+  0x0F, 0x03, 0x01, 0x0E, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0C, 0x05, 0x01,
+  0x0B, 0x06, 0x02, 0x0A, 0x01, 0x0C, 0x05, 0x02, 0x09, 0x01, 0x0C, 0x04,
+  0x02, 0x08, 0x01, 0x0B, 0x05, 0x02, 0x07, 0x01, 0x0B, 0x05, 0x02, 0x06,
+  0x02, 0x0B, 0x04, 0x02, 0x05, 0x02, 0x0B, 0x04, 0x02, 0x04, 0x02, 0x0A,
+  0x05, 0x02, 0x03, 0x02, 0x0A, 0x05, 0x02, 0x02, 0x02, 0x0A, 0x04, 0x02,
+  0x01, 0x02, 0x0A, 0x04, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x00,
+  0x10, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x07, 0x05, 0x01, 0x07, 0x09, 0x01, 0x07, 0x09, 0x01, 0x06,
+  0x0A, 0x01, 0x06, 0x0A, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05,
+  0x01, 0x01, 0x04, 0x05, 0x01, 0x04, 0x07, 0x01, 0x03, 0x09, 0x01, 0x03,
+  0x0A, 0x01, 0x07, 0x06, 0x01, 0x09, 0x05, 0x01, 0x0A, 0x04, 0x01, 0x0A,
+  0x04, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B,
+  0x02, 0x01, 0x0B, 0x02, 0x01, 0x0A, 0x03, 0x02, 0x00, 0x04, 0x09, 0x03,
+  0x02, 0x00, 0x05, 0x08, 0x03, 0x01, 0x00, 0x0A, 0x01, 0x02, 0x06, 0x01,
+  0x0E, 0x03, 0x01, 0x0B, 0x05, 0x01, 0x09, 0x05, 0x01, 0x07, 0x05, 0x01,
+  0x06, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x05, 0x01,
+  0x03, 0x05, 0x01, 0x02, 0x09, 0x01, 0x01, 0x0C, 0x02, 0x01, 0x06, 0x09,
+  0x04, 0x02, 0x01, 0x05, 0x0A, 0x04, 0x02, 0x00, 0x06, 0x0A, 0x04, 0x02,
+  0x00, 0x05, 0x0A, 0x04, 0x02, 0x00, 0x05, 0x0A, 0x04, 0x02, 0x00, 0x05,
+  0x0A, 0x04, 0x02, 0x00, 0x04, 0x09, 0x05, 0x02, 0x00, 0x04, 0x09, 0x05,
+  0x02, 0x00, 0x04, 0x09, 0x04, 0x02, 0x00, 0x04, 0x08, 0x05, 0x02, 0x01,
+  0x03, 0x08, 0x04, 0x02, 0x01, 0x04, 0x07, 0x04, 0x01, 0x02, 0x08, 0x01,
+  0x04, 0x05, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x0D, 0x01, 0x02, 0x0D, 0x01,
+  0x01, 0x0D, 0x02, 0x01, 0x02, 0x0B, 0x03, 0x02, 0x00, 0x01, 0x0A, 0x03,
+  0x02, 0x00, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x03, 0x01, 0x09, 0x02, 0x01,
+  0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01,
+  0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x08, 0x05, 0x01,
+  0x07, 0x08, 0x02, 0x06, 0x03, 0x0D, 0x03, 0x02, 0x05, 0x03, 0x0D, 0x04,
+  0x02, 0x04, 0x04, 0x0E, 0x03, 0x02, 0x04, 0x04, 0x0E, 0x03, 0x02, 0x04,
+  0x04, 0x0E, 0x03, 0x02, 0x04, 0x05, 0x0E, 0x03, 0x02, 0x04, 0x05, 0x0D,
+  0x03, 0x02, 0x04, 0x06, 0x0C, 0x03, 0x01, 0x05, 0x09, 0x01, 0x06, 0x06,
+  0x01, 0x07, 0x06, 0x01, 0x05, 0x09, 0x02, 0x03, 0x03, 0x08, 0x06, 0x02,
+  0x02, 0x03, 0x09, 0x06, 0x02, 0x01, 0x03, 0x0A, 0x05, 0x02, 0x00, 0x03,
+  0x0B, 0x04, 0x02, 0x00, 0x03, 0x0B, 0x04, 0x02, 0x00, 0x03, 0x0B, 0x04,
+  0x02, 0x00, 0x03, 0x0B, 0x04, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x01,
+  0x03, 0x0A, 0x03, 0x02, 0x02, 0x03, 0x09, 0x03, 0x01, 0x04, 0x06, 0x01,
+  0x08, 0x05, 0x01, 0x06, 0x09, 0x02, 0x05, 0x05, 0x0C, 0x04, 0x02, 0x04,
+  0x05, 0x0D, 0x03, 0x02, 0x03, 0x05, 0x0D, 0x03, 0x02, 0x03, 0x04, 0x0D,
+  0x04, 0x02, 0x02, 0x05, 0x0D, 0x04, 0x02, 0x02, 0x05, 0x0D, 0x04, 0x02,
+  0x02, 0x04, 0x0C, 0x05, 0x02, 0x02, 0x04, 0x0C, 0x05, 0x02, 0x02, 0x04,
+  0x0C, 0x05, 0x02, 0x02, 0x04, 0x0B, 0x06, 0x02, 0x02, 0x04, 0x0B, 0x05,
+  0x02, 0x03, 0x04, 0x0A, 0x06, 0x01, 0x04, 0x0B, 0x01, 0x05, 0x0A, 0x01,
+  0x09, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x06, 0x01, 0x07, 0x05, 0x01,
+  0x06, 0x04, 0x01, 0x04, 0x05, 0x01, 0x03, 0x05, 0x01, 0x01, 0x04, 0x01,
+  0x00, 0x02, 0x01, 0x05, 0x04, 0x01, 0x04, 0x06, 0x01, 0x04, 0x06, 0x01,
+  0x04, 0x06, 0x01, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x04, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06,
+  0x01, 0x01, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x06, 0x01, 0x05, 0x06,
+  0x01, 0x05, 0x06, 0x01, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x03, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05,
+  0x01, 0x03, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02,
+  0x01, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x00, 0x02, 0x00, 0x01, 0x0F,
+  0x03, 0x01, 0x0D, 0x05, 0x01, 0x0B, 0x07, 0x01, 0x09, 0x07, 0x01, 0x06,
+  0x08, 0x01, 0x04, 0x08, 0x01, 0x02, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x06, 0x01, 0x01, 0x07, 0x01, 0x03, 0x08, 0x01, 0x05,
+  0x08, 0x01, 0x08, 0x07, 0x01, 0x0A, 0x08, 0x01, 0x0C, 0x06, 0x01, 0x0E,
+  0x04, 0x01, 0x11, 0x01, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x01,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x07,
+  0x01, 0x02, 0x07, 0x01, 0x04, 0x08, 0x01, 0x06, 0x08, 0x01, 0x09, 0x07,
+  0x01, 0x0B, 0x07, 0x01, 0x0D, 0x05, 0x01, 0x0C, 0x06, 0x01, 0x0A, 0x07,
+  0x01, 0x07, 0x08, 0x01, 0x05, 0x08, 0x01, 0x03, 0x07, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01, 0x05, 0x05,
+  0x01, 0x03, 0x08, 0x02, 0x02, 0x03, 0x08, 0x04, 0x02, 0x02, 0x03, 0x09,
+  0x04, 0x02, 0x02, 0x04, 0x09, 0x04, 0x02, 0x03, 0x02, 0x09, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x07, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x02, 0x01, 0x05, 0x02, 0x01,
+  0x05, 0x01, 0x01, 0x04, 0x02, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x04, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01,
+  0x01, 0x04, 0x01, 0x0A, 0x07, 0x01, 0x07, 0x0D, 0x02, 0x05, 0x05, 0x11,
+  0x04, 0x02, 0x04, 0x04, 0x13, 0x03, 0x02, 0x03, 0x03, 0x14, 0x03, 0x03,
+  0x02, 0x03, 0x0E, 0x02, 0x15, 0x03, 0x03, 0x02, 0x03, 0x0C, 0x08, 0x16,
+  0x02, 0x04, 0x01, 0x03, 0x0B, 0x04, 0x11, 0x03, 0x16, 0x03, 0x04, 0x01,
+  0x03, 0x0A, 0x04, 0x11, 0x03, 0x17, 0x02, 0x04, 0x00, 0x03, 0x0A, 0x03,
+  0x11, 0x02, 0x17, 0x02, 0x04, 0x00, 0x03, 0x09, 0x04, 0x10, 0x03, 0x17,
+  0x02, 0x04, 0x00, 0x03, 0x09, 0x03, 0x10, 0x03, 0x17, 0x02, 0x04, 0x00,
+  0x03, 0x08, 0x04, 0x10, 0x03, 0x17, 0x02, 0x04, 0x00, 0x03, 0x08, 0x03,
+  0x0F, 0x03, 0x17, 0x02, 0x04, 0x00, 0x03, 0x08, 0x03, 0x0F, 0x03, 0x16,
+  0x02, 0x04, 0x00, 0x03, 0x08, 0x03, 0x0E, 0x04, 0x16, 0x02, 0x05, 0x01,
+  0x03, 0x08, 0x03, 0x0D, 0x01, 0x0F, 0x03, 0x15, 0x02, 0x03, 0x01, 0x03,
+  0x08, 0x05, 0x0F, 0x07, 0x03, 0x01, 0x03, 0x09, 0x03, 0x10, 0x05, 0x01,
+  0x02, 0x03, 0x01, 0x03, 0x03, 0x02, 0x04, 0x04, 0x14, 0x01, 0x02, 0x05,
+  0x05, 0x12, 0x03, 0x01, 0x07, 0x0D, 0x01, 0x0A, 0x07, 0x01, 0x10, 0x01,
+  0x01, 0x0F, 0x02, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0D, 0x05,
+  0x01, 0x0D, 0x05, 0x01, 0x0C, 0x06, 0x01, 0x0B, 0x07, 0x02, 0x0B, 0x01,
+  0x0D, 0x05, 0x02, 0x0A, 0x02, 0x0E, 0x04, 0x02, 0x0A, 0x01, 0x0E, 0x04,
+  0x02, 0x09, 0x02, 0x0E, 0x05, 0x02, 0x08, 0x02, 0x0E, 0x05, 0x02, 0x08,
+  0x01, 0x0E, 0x05, 0x02, 0x07, 0x02, 0x0E, 0x05, 0x02, 0x07, 0x01, 0x0E,
+  0x05, 0x01, 0x06, 0x0D, 0x01, 0x05, 0x0F, 0x02, 0x05, 0x02, 0x0F, 0x05,
+  0x02, 0x04, 0x02, 0x0F, 0x05, 0x02, 0x03, 0x03, 0x0F, 0x05, 0x02, 0x03,
+  0x02, 0x0F, 0x05, 0x02, 0x02, 0x03, 0x0F, 0x05, 0x02, 0x01, 0x04, 0x0F,
+  0x06, 0x02, 0x00, 0x07, 0x0C, 0x0B, 0x01, 0x05, 0x0E, 0x01, 0x07, 0x0F,
+  0x02, 0x07, 0x06, 0x11, 0x06, 0x02, 0x07, 0x06, 0x12, 0x06, 0x02, 0x07,
+  0x05, 0x12, 0x06, 0x02, 0x07, 0x05, 0x12, 0x06, 0x02, 0x07, 0x05, 0x12,
+  0x06, 0x02, 0x06, 0x05, 0x12, 0x06, 0x02, 0x06, 0x05, 0x11, 0x06, 0x02,
+  0x06, 0x05, 0x10, 0x06, 0x02, 0x06, 0x05, 0x0E, 0x06, 0x01, 0x05, 0x0C,
+  0x02, 0x05, 0x05, 0x0E, 0x05, 0x02, 0x05, 0x05, 0x0F, 0x06, 0x02, 0x04,
+  0x06, 0x10, 0x05, 0x02, 0x04, 0x05, 0x10, 0x06, 0x02, 0x04, 0x05, 0x10,
+  0x06, 0x02, 0x04, 0x05, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02,
+  0x03, 0x05, 0x0F, 0x07, 0x02, 0x03, 0x05, 0x0F, 0x06, 0x02, 0x03, 0x05,
+  0x0E, 0x06, 0x02, 0x02, 0x06, 0x0C, 0x07, 0x01, 0x01, 0x11, 0x01, 0x00,
+  0x0F, 0x02, 0x0B, 0x06, 0x16, 0x01, 0x02, 0x08, 0x0C, 0x15, 0x01, 0x02,
+  0x07, 0x06, 0x12, 0x04, 0x02, 0x05, 0x07, 0x13, 0x03, 0x02, 0x04, 0x07,
+  0x14, 0x02, 0x02, 0x04, 0x06, 0x14, 0x02, 0x02, 0x03, 0x06, 0x14, 0x01,
+  0x02, 0x02, 0x06, 0x14, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x06, 0x01,
+  0x01, 0x06, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x06, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01,
+  0x00, 0x06, 0x02, 0x01, 0x05, 0x12, 0x01, 0x02, 0x01, 0x06, 0x11, 0x02,
+  0x02, 0x02, 0x06, 0x10, 0x02, 0x02, 0x03, 0x06, 0x0E, 0x03, 0x01, 0x04,
+  0x0B, 0x01, 0x07, 0x06, 0x01, 0x05, 0x0E, 0x01, 0x05, 0x10, 0x02, 0x07,
+  0x06, 0x11, 0x06, 0x02, 0x07, 0x06, 0x13, 0x05, 0x02, 0x07, 0x05, 0x13,
+  0x06, 0x02, 0x07, 0x05, 0x14, 0x05, 0x02, 0x07, 0x05, 0x14, 0x05, 0x02,
+  0x06, 0x05, 0x14, 0x06, 0x02, 0x06, 0x05, 0x14, 0x06, 0x02, 0x06, 0x05,
+  0x14, 0x06, 0x02, 0x06, 0x05, 0x14, 0x06, 0x02, 0x05, 0x05, 0x14, 0x06,
+  0x02, 0x05, 0x05, 0x14, 0x06, 0x02, 0x05, 0x05, 0x13, 0x07, 0x02, 0x04,
+  0x06, 0x13, 0x06, 0x02, 0x04, 0x05, 0x13, 0x06, 0x02, 0x04, 0x05, 0x12,
+  0x07, 0x02, 0x04, 0x05, 0x12, 0x06, 0x02, 0x03, 0x06, 0x11, 0x07, 0x02,
+  0x03, 0x05, 0x11, 0x06, 0x02, 0x03, 0x05, 0x10, 0x06, 0x02, 0x03, 0x05,
+  0x0F, 0x06, 0x02, 0x02, 0x06, 0x0D, 0x06, 0x01, 0x01, 0x11, 0x01, 0x00,
+  0x0F, 0x01, 0x05, 0x12, 0x01, 0x07, 0x10, 0x02, 0x07, 0x06, 0x13, 0x04,
+  0x02, 0x07, 0x06, 0x14, 0x02, 0x02, 0x07, 0x05, 0x15, 0x01, 0x02, 0x07,
+  0x05, 0x15, 0x01, 0x02, 0x07, 0x05, 0x15, 0x01, 0x02, 0x06, 0x06, 0x12,
+  0x01, 0x02, 0x06, 0x05, 0x11, 0x02, 0x02, 0x06, 0x05, 0x0F, 0x03, 0x01,
+  0x06, 0x0C, 0x01, 0x05, 0x0D, 0x02, 0x05, 0x05, 0x0E, 0x03, 0x02, 0x05,
+  0x05, 0x0F, 0x02, 0x02, 0x04, 0x06, 0x0F, 0x02, 0x02, 0x04, 0x05, 0x0F,
+  0x01, 0x02, 0x04, 0x05, 0x0F, 0x01, 0x02, 0x04, 0x05, 0x14, 0x01, 0x02,
+  0x03, 0x06, 0x13, 0x02, 0x02, 0x03, 0x05, 0x12, 0x03, 0x02, 0x03, 0x05,
+  0x11, 0x03, 0x02, 0x03, 0x05, 0x10, 0x04, 0x02, 0x02, 0x06, 0x0E, 0x06,
+  0x01, 0x01, 0x13, 0x01, 0x00, 0x13, 0x01, 0x05, 0x12, 0x01, 0x07, 0x10,
+  0x02, 0x07, 0x06, 0x13, 0x04, 0x02, 0x07, 0x06, 0x14, 0x02, 0x02, 0x07,
+  0x05, 0x15, 0x01, 0x02, 0x07, 0x05, 0x15, 0x01, 0x02, 0x07, 0x05, 0x15,
+  0x01, 0x02, 0x06, 0x06, 0x11, 0x01, 0x02, 0x06, 0x05, 0x10, 0x02, 0x02,
+  0x06, 0x05, 0x0F, 0x03, 0x01, 0x06, 0x0B, 0x01, 0x05, 0x0C, 0x02, 0x05,
+  0x05, 0x0E, 0x03, 0x02, 0x05, 0x05, 0x0F, 0x02, 0x02, 0x04, 0x06, 0x0F,
+  0x02, 0x02, 0x04, 0x05, 0x0F, 0x01, 0x02, 0x04, 0x05, 0x0F, 0x01, 0x01,
+  0x04, 0x05, 0x01, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01,
+  0x03, 0x05, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x01, 0x00, 0x0A, 0x02,
+  0x0B, 0x07, 0x16, 0x01, 0x02, 0x08, 0x0C, 0x15, 0x02, 0x02, 0x07, 0x06,
+  0x12, 0x04, 0x02, 0x06, 0x05, 0x13, 0x03, 0x02, 0x04, 0x06, 0x14, 0x02,
+  0x02, 0x04, 0x06, 0x14, 0x01, 0x02, 0x03, 0x06, 0x14, 0x01, 0x01, 0x02,
+  0x06, 0x01, 0x02, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01,
+  0x06, 0x01, 0x00, 0x07, 0x02, 0x00, 0x06, 0x0E, 0x0A, 0x02, 0x00, 0x06,
+  0x10, 0x06, 0x02, 0x00, 0x06, 0x10, 0x05, 0x02, 0x00, 0x06, 0x10, 0x05,
+  0x02, 0x00, 0x06, 0x10, 0x05, 0x02, 0x00, 0x06, 0x10, 0x04, 0x02, 0x01,
+  0x05, 0x0F, 0x05, 0x02, 0x01, 0x06, 0x0F, 0x05, 0x02, 0x02, 0x05, 0x0F,
+  0x05, 0x02, 0x03, 0x06, 0x0E, 0x05, 0x01, 0x04, 0x0D, 0x01, 0x07, 0x07,
+  0x02, 0x05, 0x0B, 0x12, 0x0B, 0x02, 0x07, 0x07, 0x14, 0x07, 0x02, 0x07,
+  0x06, 0x15, 0x06, 0x02, 0x07, 0x06, 0x15, 0x05, 0x02, 0x07, 0x05, 0x15,
+  0x05, 0x02, 0x07, 0x05, 0x14, 0x06, 0x02, 0x07, 0x05, 0x14, 0x05, 0x02,
+  0x06, 0x06, 0x14, 0x05, 0x02, 0x06, 0x05, 0x14, 0x05, 0x02, 0x06, 0x05,
+  0x13, 0x05, 0x02, 0x06, 0x05, 0x13, 0x05, 0x01, 0x05, 0x13, 0x01, 0x05,
+  0x13, 0x02, 0x05, 0x05, 0x12, 0x05, 0x02, 0x04, 0x06, 0x12, 0x05, 0x02,
+  0x04, 0x05, 0x12, 0x05, 0x02, 0x04, 0x05, 0x11, 0x06, 0x02, 0x04, 0x05,
+  0x11, 0x05, 0x02, 0x03, 0x06, 0x11, 0x05, 0x02, 0x03, 0x05, 0x11, 0x05,
+  0x02, 0x03, 0x05, 0x10, 0x06, 0x02, 0x03, 0x05, 0x10, 0x05, 0x02, 0x02,
+  0x06, 0x10, 0x05, 0x02, 0x01, 0x07, 0x0F, 0x07, 0x02, 0x00, 0x0A, 0x0D,
+  0x0B, 0x01, 0x05, 0x0A, 0x01, 0x07, 0x07, 0x01, 0x07, 0x06, 0x01, 0x07,
+  0x06, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x05,
+  0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x06, 0x01, 0x04,
+  0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x06, 0x01, 0x01,
+  0x07, 0x01, 0x00, 0x0A, 0x01, 0x0A, 0x0A, 0x01, 0x0B, 0x08, 0x01, 0x0C,
+  0x06, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0B,
+  0x06, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0A,
+  0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x09, 0x06, 0x01, 0x09,
+  0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x08, 0x06, 0x01, 0x08,
+  0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x05, 0x02, 0x01,
+  0x02, 0x07, 0x05, 0x02, 0x00, 0x04, 0x06, 0x06, 0x02, 0x00, 0x03, 0x05,
+  0x06, 0x01, 0x01, 0x09, 0x01, 0x02, 0x06, 0x02, 0x05, 0x0B, 0x12, 0x07,
+  0x02, 0x07, 0x07, 0x14, 0x04, 0x02, 0x07, 0x06, 0x14, 0x02, 0x02, 0x07,
+  0x06, 0x13, 0x02, 0x02, 0x07, 0x05, 0x12, 0x02, 0x02, 0x07, 0x05, 0x11,
+  0x02, 0x02, 0x07, 0x05, 0x10, 0x02, 0x02, 0x06, 0x06, 0x0F, 0x02, 0x02,
+  0x06, 0x05, 0x0E, 0x02, 0x02, 0x06, 0x05, 0x0D, 0x02, 0x02, 0x06, 0x05,
+  0x0C, 0x03, 0x02, 0x05, 0x05, 0x0B, 0x04, 0x01, 0x05, 0x0A, 0x02, 0x05,
+  0x05, 0x0B, 0x05, 0x02, 0x04, 0x06, 0x0B, 0x05, 0x02, 0x04, 0x05, 0x0C,
+  0x05, 0x02, 0x04, 0x05, 0x0C, 0x05, 0x02, 0x04, 0x05, 0x0C, 0x06, 0x02,
+  0x03, 0x06, 0x0D, 0x05, 0x02, 0x03, 0x05, 0x0D, 0x06, 0x02, 0x03, 0x05,
+  0x0E, 0x05, 0x02, 0x03, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x06, 0x0F, 0x05,
+  0x02, 0x01, 0x07, 0x0E, 0x07, 0x02, 0x00, 0x0A, 0x0C, 0x0A, 0x01, 0x05,
+  0x0B, 0x01, 0x07, 0x07, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07,
+  0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x06, 0x01, 0x04, 0x05, 0x01, 0x04,
+  0x05, 0x02, 0x04, 0x05, 0x15, 0x01, 0x02, 0x03, 0x05, 0x14, 0x02, 0x02,
+  0x03, 0x05, 0x13, 0x02, 0x02, 0x03, 0x05, 0x12, 0x03, 0x02, 0x03, 0x05,
+  0x11, 0x04, 0x02, 0x02, 0x06, 0x0E, 0x07, 0x01, 0x01, 0x13, 0x01, 0x00,
+  0x14, 0x02, 0x05, 0x08, 0x19, 0x08, 0x02, 0x07, 0x06, 0x19, 0x07, 0x02,
+  0x08, 0x05, 0x18, 0x07, 0x02, 0x08, 0x05, 0x17, 0x07, 0x02, 0x07, 0x06,
+  0x17, 0x07, 0x03, 0x07, 0x07, 0x16, 0x02, 0x19, 0x05, 0x03, 0x07, 0x07,
+  0x16, 0x02, 0x19, 0x05, 0x04, 0x07, 0x01, 0x09, 0x05, 0x15, 0x02, 0x18,
+  0x05, 0x04, 0x06, 0x02, 0x09, 0x05, 0x14, 0x02, 0x18, 0x05, 0x04, 0x06,
+  0x02, 0x09, 0x05, 0x14, 0x02, 0x18, 0x05, 0x04, 0x06, 0x02, 0x09, 0x05,
+  0x13, 0x02, 0x17, 0x05, 0x04, 0x05, 0x02, 0x09, 0x05, 0x13, 0x02, 0x17,
+  0x05, 0x04, 0x05, 0x02, 0x09, 0x05, 0x12, 0x02, 0x17, 0x05, 0x04, 0x05,
+  0x02, 0x0A, 0x04, 0x11, 0x02, 0x17, 0x05, 0x04, 0x04, 0x03, 0x0A, 0x05,
+  0x11, 0x02, 0x16, 0x05, 0x04, 0x04, 0x02, 0x0A, 0x05, 0x10, 0x02, 0x16,
+  0x05, 0x03, 0x04, 0x02, 0x0A, 0x07, 0x16, 0x05, 0x03, 0x04, 0x02, 0x0A,
+  0x07, 0x16, 0x05, 0x03, 0x03, 0x02, 0x0A, 0x06, 0x15, 0x05, 0x03, 0x03,
+  0x02, 0x0A, 0x05, 0x15, 0x05, 0x03, 0x03, 0x02, 0x0A, 0x05, 0x15, 0x05,
+  0x03, 0x02, 0x03, 0x0B, 0x03, 0x14, 0x06, 0x03, 0x02, 0x03, 0x0B, 0x03,
+  0x14, 0x06, 0x03, 0x01, 0x05, 0x0B, 0x02, 0x13, 0x07, 0x03, 0x00, 0x08,
+  0x0B, 0x01, 0x11, 0x0B, 0x02, 0x05, 0x07, 0x14, 0x07, 0x02, 0x07, 0x05,
+  0x16, 0x04, 0x02, 0x07, 0x06, 0x17, 0x02, 0x02, 0x08, 0x05, 0x17, 0x02,
+  0x02, 0x07, 0x07, 0x17, 0x01, 0x02, 0x07, 0x07, 0x16, 0x02, 0x03, 0x07,
+  0x02, 0x0A, 0x05, 0x16, 0x02, 0x03, 0x06, 0x02, 0x0A, 0x05, 0x16, 0x01,
+  0x03, 0x06, 0x02, 0x0A, 0x06, 0x16, 0x01, 0x03, 0x06, 0x02, 0x0B, 0x05,
+  0x15, 0x02, 0x03, 0x06, 0x02, 0x0B, 0x05, 0x15, 0x02, 0x03, 0x05, 0x02,
+  0x0C, 0x05, 0x15, 0x01, 0x03, 0x05, 0x02, 0x0C, 0x05, 0x15, 0x01, 0x03,
+  0x05, 0x02, 0x0D, 0x05, 0x14, 0x02, 0x03, 0x04, 0x03, 0x0D, 0x05, 0x14,
+  0x02, 0x03, 0x04, 0x02, 0x0D, 0x06, 0x14, 0x01, 0x02, 0x04, 0x02, 0x0E,
+  0x07, 0x02, 0x04, 0x02, 0x0E, 0x07, 0x02, 0x03, 0x02, 0x0F, 0x05, 0x02,
+  0x03, 0x02, 0x0F, 0x05, 0x02, 0x03, 0x02, 0x10, 0x04, 0x02, 0x02, 0x03,
+  0x10, 0x04, 0x02, 0x02, 0x03, 0x11, 0x02, 0x02, 0x01, 0x05, 0x11, 0x02,
+  0x02, 0x06, 0x01, 0x11, 0x02, 0x01, 0x0B, 0x07, 0x01, 0x09, 0x0A, 0x02,
+  0x07, 0x05, 0x10, 0x05, 0x02, 0x06, 0x05, 0x11, 0x04, 0x02, 0x05, 0x05,
+  0x12, 0x04, 0x02, 0x04, 0x05, 0x12, 0x04, 0x02, 0x03, 0x06, 0x12, 0x05,
+  0x02, 0x03, 0x05, 0x12, 0x05, 0x02, 0x02, 0x06, 0x12, 0x05, 0x02, 0x02,
+  0x05, 0x12, 0x05, 0x02, 0x01, 0x06, 0x11, 0x06, 0x02, 0x01, 0x05, 0x11,
+  0x06, 0x02, 0x01, 0x05, 0x11, 0x05, 0x02, 0x00, 0x06, 0x10, 0x06, 0x02,
+  0x00, 0x06, 0x10, 0x06, 0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00, 0x05,
+  0x0F, 0x06, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0E, 0x06,
+  0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x02, 0x01,
+  0x05, 0x0C, 0x05, 0x02, 0x02, 0x05, 0x0B, 0x05, 0x01, 0x03, 0x0B, 0x01,
+  0x05, 0x07, 0x01, 0x05, 0x0E, 0x01, 0x07, 0x0E, 0x02, 0x07, 0x06, 0x10,
+  0x06, 0x02, 0x07, 0x05, 0x11, 0x05, 0x02, 0x07, 0x05, 0x11, 0x06, 0x02,
+  0x07, 0x05, 0x11, 0x06, 0x02, 0x07, 0x05, 0x11, 0x06, 0x02, 0x06, 0x05,
+  0x11, 0x06, 0x02, 0x06, 0x05, 0x10, 0x07, 0x02, 0x06, 0x05, 0x10, 0x06,
+  0x02, 0x06, 0x05, 0x0F, 0x07, 0x02, 0x05, 0x05, 0x0E, 0x07, 0x01, 0x05,
+  0x0E, 0x01, 0x05, 0x0C, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04,
+  0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x01, 0x00,
+  0x0A, 0x01, 0x0B, 0x07, 0x01, 0x09, 0x0A, 0x02, 0x07, 0x05, 0x10, 0x05,
+  0x02, 0x06, 0x05, 0x11, 0x04, 0x02, 0x05, 0x05, 0x12, 0x04, 0x02, 0x04,
+  0x05, 0x12, 0x04, 0x02, 0x03, 0x06, 0x12, 0x05, 0x02, 0x03, 0x05, 0x12,
+  0x05, 0x02, 0x02, 0x06, 0x12, 0x05, 0x02, 0x02, 0x05, 0x12, 0x05, 0x02,
+  0x01, 0x06, 0x11, 0x06, 0x02, 0x01, 0x06, 0x11, 0x06, 0x02, 0x01, 0x05,
+  0x11, 0x05, 0x02, 0x00, 0x06, 0x11, 0x05, 0x02, 0x00, 0x06, 0x10, 0x06,
+  0x02, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x06, 0x02, 0x00,
+  0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x05, 0x0E,
+  0x05, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x02, 0x01, 0x04, 0x0C, 0x05, 0x02,
+  0x02, 0x04, 0x0B, 0x04, 0x01, 0x04, 0x0A, 0x01, 0x06, 0x03, 0x01, 0x05,
+  0x02, 0x02, 0x04, 0x04, 0x14, 0x01, 0x02, 0x03, 0x0A, 0x12, 0x02, 0x01,
+  0x01, 0x12, 0x02, 0x00, 0x04, 0x05, 0x0D, 0x01, 0x09, 0x07, 0x01, 0x05,
+  0x0E, 0x01, 0x07, 0x0F, 0x02, 0x07, 0x06, 0x11, 0x06, 0x02, 0x07, 0x06,
+  0x12, 0x06, 0x02, 0x07, 0x06, 0x12, 0x06, 0x02, 0x07, 0x05, 0x12, 0x06,
+  0x02, 0x07, 0x05, 0x12, 0x06, 0x02, 0x06, 0x06, 0x12, 0x06, 0x02, 0x06,
+  0x05, 0x11, 0x06, 0x02, 0x06, 0x05, 0x10, 0x07, 0x02, 0x06, 0x05, 0x0F,
+  0x06, 0x01, 0x05, 0x0F, 0x01, 0x05, 0x0C, 0x02, 0x05, 0x05, 0x0B, 0x07,
+  0x02, 0x04, 0x06, 0x0C, 0x06, 0x02, 0x04, 0x06, 0x0C, 0x06, 0x02, 0x04,
+  0x05, 0x0C, 0x07, 0x02, 0x04, 0x05, 0x0D, 0x06, 0x02, 0x03, 0x06, 0x0D,
+  0x06, 0x02, 0x03, 0x05, 0x0E, 0x06, 0x02, 0x03, 0x05, 0x0E, 0x06, 0x02,
+  0x03, 0x05, 0x0E, 0x06, 0x02, 0x02, 0x06, 0x0F, 0x06, 0x02, 0x01, 0x07,
+  0x0F, 0x06, 0x02, 0x00, 0x0B, 0x0F, 0x08, 0x02, 0x08, 0x05, 0x11, 0x01,
+  0x02, 0x06, 0x09, 0x10, 0x02, 0x02, 0x06, 0x03, 0x0E, 0x04, 0x02, 0x05,
+  0x03, 0x0F, 0x03, 0x02, 0x04, 0x04, 0x0F, 0x03, 0x02, 0x04, 0x04, 0x10,
+  0x01, 0x02, 0x04, 0x04, 0x10, 0x01, 0x02, 0x04, 0x05, 0x10, 0x01, 0x01,
+  0x04, 0x06, 0x01, 0x04, 0x07, 0x01, 0x05, 0x07, 0x01, 0x06, 0x07, 0x01,
+  0x07, 0x07, 0x01, 0x08, 0x07, 0x01, 0x09, 0x06, 0x01, 0x0A, 0x06, 0x01,
+  0x0B, 0x05, 0x01, 0x0C, 0x04, 0x02, 0x01, 0x01, 0x0C, 0x04, 0x02, 0x01,
+  0x01, 0x0C, 0x04, 0x02, 0x01, 0x02, 0x0C, 0x04, 0x02, 0x00, 0x03, 0x0B,
+  0x04, 0x02, 0x00, 0x05, 0x0A, 0x04, 0x02, 0x00, 0x01, 0x04, 0x09, 0x02,
+  0x00, 0x01, 0x06, 0x06, 0x01, 0x02, 0x13, 0x01, 0x02, 0x13, 0x03, 0x02,
+  0x04, 0x09, 0x05, 0x11, 0x04, 0x03, 0x02, 0x03, 0x09, 0x05, 0x12, 0x03,
+  0x03, 0x01, 0x03, 0x08, 0x05, 0x12, 0x02, 0x03, 0x01, 0x02, 0x08, 0x05,
+  0x13, 0x01, 0x03, 0x01, 0x01, 0x08, 0x05, 0x13, 0x01, 0x02, 0x07, 0x06,
+  0x13, 0x01, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01,
+  0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x06, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x06, 0x01,
+  0x02, 0x07, 0x01, 0x00, 0x0C, 0x02, 0x01, 0x0B, 0x10, 0x08, 0x02, 0x03,
+  0x07, 0x12, 0x05, 0x02, 0x03, 0x06, 0x13, 0x03, 0x02, 0x03, 0x06, 0x13,
+  0x02, 0x02, 0x03, 0x05, 0x13, 0x02, 0x02, 0x03, 0x05, 0x13, 0x02, 0x02,
+  0x03, 0x05, 0x12, 0x02, 0x02, 0x02, 0x06, 0x12, 0x02, 0x02, 0x02, 0x05,
+  0x12, 0x02, 0x02, 0x02, 0x05, 0x12, 0x02, 0x02, 0x01, 0x06, 0x11, 0x02,
+  0x02, 0x01, 0x05, 0x11, 0x02, 0x02, 0x01, 0x05, 0x11, 0x02, 0x02, 0x01,
+  0x05, 0x10, 0x02, 0x02, 0x01, 0x05, 0x10, 0x02, 0x02, 0x00, 0x05, 0x10,
+  0x02, 0x02, 0x00, 0x05, 0x10, 0x02, 0x02, 0x00, 0x05, 0x0F, 0x02, 0x02,
+  0x00, 0x05, 0x0F, 0x02, 0x02, 0x00, 0x05, 0x0E, 0x03, 0x02, 0x00, 0x05,
+  0x0E, 0x02, 0x02, 0x01, 0x05, 0x0D, 0x02, 0x02, 0x01, 0x06, 0x0B, 0x04,
+  0x01, 0x02, 0x0B, 0x01, 0x04, 0x07, 0x02, 0x00, 0x0B, 0x11, 0x07, 0x02,
+  0x02, 0x07, 0x13, 0x03, 0x02, 0x03, 0x06, 0x13, 0x02, 0x02, 0x03, 0x06,
+  0x13, 0x02, 0x02, 0x03, 0x06, 0x12, 0x02, 0x02, 0x03, 0x06, 0x12, 0x02,
+  0x02, 0x04, 0x05, 0x11, 0x02, 0x02, 0x04, 0x05, 0x11, 0x01, 0x02, 0x04,
+  0x05, 0x10, 0x02, 0x02, 0x04, 0x05, 0x0F, 0x02, 0x02, 0x04, 0x05, 0x0F,
+  0x01, 0x02, 0x04, 0x06, 0x0E, 0x02, 0x02, 0x04, 0x06, 0x0D, 0x02, 0x02,
+  0x05, 0x05, 0x0D, 0x02, 0x02, 0x05, 0x05, 0x0C, 0x02, 0x02, 0x05, 0x05,
+  0x0C, 0x01, 0x02, 0x05, 0x05, 0x0B, 0x02, 0x01, 0x05, 0x07, 0x01, 0x05,
+  0x07, 0x01, 0x05, 0x06, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x03, 0x00, 0x0A, 0x0C, 0x09,
+  0x19, 0x06, 0x03, 0x02, 0x07, 0x0E, 0x06, 0x1B, 0x03, 0x03, 0x03, 0x05,
+  0x0F, 0x04, 0x1B, 0x02, 0x03, 0x03, 0x05, 0x0F, 0x04, 0x1B, 0x01, 0x03,
+  0x03, 0x05, 0x0F, 0x04, 0x1A, 0x02, 0x03, 0x03, 0x05, 0x0F, 0x05, 0x1A,
+  0x01, 0x03, 0x03, 0x06, 0x0E, 0x06, 0x19, 0x02, 0x03, 0x04, 0x05, 0x0E,
+  0x06, 0x19, 0x01, 0x03, 0x04, 0x05, 0x0D, 0x07, 0x18, 0x02, 0x04, 0x04,
+  0x05, 0x0D, 0x01, 0x0F, 0x05, 0x18, 0x01, 0x04, 0x04, 0x05, 0x0C, 0x02,
+  0x0F, 0x05, 0x17, 0x02, 0x04, 0x04, 0x05, 0x0C, 0x01, 0x10, 0x04, 0x17,
+  0x01, 0x04, 0x04, 0x05, 0x0B, 0x02, 0x10, 0x04, 0x16, 0x02, 0x04, 0x04,
+  0x05, 0x0B, 0x01, 0x10, 0x05, 0x16, 0x01, 0x04, 0x04, 0x05, 0x0A, 0x02,
+  0x10, 0x05, 0x16, 0x01, 0x02, 0x05, 0x06, 0x10, 0x07, 0x02, 0x05, 0x06,
+  0x10, 0x06, 0x02, 0x05, 0x05, 0x10, 0x06, 0x02, 0x05, 0x05, 0x10, 0x05,
+  0x02, 0x05, 0x04, 0x10, 0x05, 0x02, 0x05, 0x04, 0x11, 0x03, 0x02, 0x05,
+  0x04, 0x11, 0x03, 0x02, 0x06, 0x02, 0x11, 0x02, 0x02, 0x06, 0x02, 0x11,
+  0x02, 0x02, 0x06, 0x01, 0x11, 0x01, 0x02, 0x04, 0x0B, 0x12, 0x07, 0x02,
+  0x06, 0x07, 0x14, 0x04, 0x02, 0x07, 0x05, 0x14, 0x02, 0x02, 0x07, 0x06,
+  0x13, 0x02, 0x02, 0x08, 0x05, 0x12, 0x03, 0x02, 0x08, 0x05, 0x12, 0x02,
+  0x02, 0x08, 0x05, 0x11, 0x02, 0x02, 0x09, 0x05, 0x10, 0x02, 0x02, 0x09,
+  0x05, 0x0F, 0x02, 0x01, 0x09, 0x07, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05,
+  0x01, 0x0A, 0x05, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x07, 0x02, 0x09, 0x01,
+  0x0B, 0x05, 0x02, 0x08, 0x02, 0x0C, 0x04, 0x02, 0x07, 0x02, 0x0C, 0x05,
+  0x02, 0x06, 0x02, 0x0C, 0x05, 0x02, 0x05, 0x02, 0x0C, 0x05, 0x02, 0x04,
+  0x02, 0x0D, 0x05, 0x02, 0x03, 0x03, 0x0D, 0x05, 0x02, 0x02, 0x03, 0x0D,
+  0x05, 0x02, 0x01, 0x05, 0x0C, 0x08, 0x02, 0x00, 0x08, 0x0B, 0x0A, 0x02,
+  0x00, 0x0A, 0x0E, 0x07, 0x02, 0x02, 0x06, 0x10, 0x04, 0x02, 0x03, 0x05,
+  0x10, 0x03, 0x02, 0x03, 0x05, 0x10, 0x02, 0x02, 0x03, 0x05, 0x0F, 0x02,
+  0x02, 0x04, 0x05, 0x0F, 0x01, 0x02, 0x04, 0x05, 0x0E, 0x02, 0x02, 0x04,
+  0x05, 0x0D, 0x02, 0x02, 0x05, 0x05, 0x0D, 0x01, 0x02, 0x05, 0x05, 0x0C,
+  0x02, 0x02, 0x05, 0x05, 0x0B, 0x02, 0x02, 0x06, 0x04, 0x0B, 0x01, 0x01,
+  0x06, 0x06, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x05, 0x06, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x03, 0x06, 0x01, 0x02, 0x07, 0x01,
+  0x00, 0x0C, 0x01, 0x05, 0x10, 0x01, 0x05, 0x10, 0x02, 0x04, 0x05, 0x0F,
+  0x06, 0x02, 0x04, 0x03, 0x0E, 0x06, 0x02, 0x04, 0x02, 0x0E, 0x05, 0x02,
+  0x03, 0x02, 0x0D, 0x06, 0x02, 0x03, 0x01, 0x0C, 0x06, 0x01, 0x0B, 0x06,
+  0x01, 0x0B, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x06, 0x01, 0x09, 0x05,
+  0x01, 0x08, 0x06, 0x01, 0x07, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06,
+  0x01, 0x05, 0x06, 0x02, 0x04, 0x06, 0x13, 0x01, 0x02, 0x04, 0x05, 0x12,
+  0x02, 0x02, 0x03, 0x06, 0x11, 0x02, 0x02, 0x02, 0x06, 0x10, 0x03, 0x02,
+  0x02, 0x05, 0x0F, 0x04, 0x02, 0x01, 0x06, 0x0D, 0x06, 0x01, 0x00, 0x12,
+  0x01, 0x00, 0x12, 0x01, 0x07, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x08, 0x01, 0x00, 0x07, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x02, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x04, 0x02,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x06, 0x02, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x06, 0x08, 0x01, 0x06, 0x08, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x03,
+  0x01, 0x09, 0x03, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x05, 0x06, 0x01, 0x05, 0x06, 0x02, 0x04, 0x03, 0x09, 0x03, 0x02,
+  0x04, 0x03, 0x09, 0x03, 0x02, 0x03, 0x03, 0x09, 0x04, 0x02, 0x03, 0x03,
+  0x0A, 0x03, 0x02, 0x02, 0x04, 0x0A, 0x04, 0x02, 0x02, 0x03, 0x0B, 0x03,
+  0x02, 0x01, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x02, 0x00,
+  0x04, 0x0C, 0x03, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00, 0x12,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x02, 0x03,
+  0x01, 0x03, 0x03, 0x01, 0x05, 0x02, 0x02, 0x08, 0x04, 0x0D, 0x04, 0x02,
+  0x06, 0x06, 0x0D, 0x04, 0x02, 0x05, 0x05, 0x0C, 0x04, 0x02, 0x04, 0x04,
+  0x0C, 0x04, 0x02, 0x03, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x05, 0x0C, 0x03,
+  0x02, 0x02, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x02, 0x01,
+  0x04, 0x0B, 0x03, 0x02, 0x00, 0x05, 0x0A, 0x04, 0x02, 0x00, 0x04, 0x0A,
+  0x04, 0x02, 0x00, 0x04, 0x09, 0x05, 0x03, 0x00, 0x04, 0x08, 0x06, 0x10,
+  0x02, 0x04, 0x00, 0x05, 0x07, 0x02, 0x0A, 0x04, 0x0F, 0x02, 0x02, 0x00,
+  0x08, 0x0A, 0x06, 0x02, 0x01, 0x06, 0x0A, 0x05, 0x02, 0x02, 0x04, 0x0B,
+  0x03, 0x01, 0x07, 0x04, 0x01, 0x03, 0x07, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x05, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x02, 0x04, 0x04, 0x0A, 0x04, 0x02, 0x03, 0x04,
+  0x08, 0x07, 0x02, 0x03, 0x06, 0x0B, 0x05, 0x02, 0x03, 0x05, 0x0C, 0x04,
+  0x02, 0x03, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x05, 0x0C, 0x04, 0x02, 0x02,
+  0x04, 0x0C, 0x04, 0x02, 0x02, 0x04, 0x0B, 0x05, 0x02, 0x01, 0x04, 0x0B,
+  0x04, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x02,
+  0x01, 0x04, 0x0A, 0x04, 0x02, 0x00, 0x04, 0x09, 0x04, 0x02, 0x00, 0x04,
+  0x08, 0x04, 0x02, 0x00, 0x04, 0x07, 0x04, 0x01, 0x01, 0x09, 0x01, 0x02,
+  0x06, 0x01, 0x07, 0x05, 0x01, 0x05, 0x08, 0x02, 0x04, 0x04, 0x0A, 0x03,
+  0x02, 0x03, 0x04, 0x09, 0x04, 0x02, 0x02, 0x04, 0x09, 0x03, 0x01, 0x02,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x02, 0x00, 0x04, 0x0A, 0x02,
+  0x02, 0x00, 0x04, 0x09, 0x02, 0x02, 0x01, 0x04, 0x08, 0x02, 0x01, 0x01,
+  0x08, 0x01, 0x03, 0x04, 0x01, 0x0B, 0x07, 0x01, 0x0D, 0x05, 0x01, 0x0D,
+  0x05, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0C,
+  0x05, 0x01, 0x0C, 0x05, 0x02, 0x07, 0x04, 0x0C, 0x04, 0x01, 0x06, 0x0A,
+  0x02, 0x04, 0x05, 0x0B, 0x05, 0x02, 0x04, 0x04, 0x0B, 0x04, 0x02, 0x03,
+  0x04, 0x0B, 0x04, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02, 0x02, 0x04, 0x0A,
+  0x05, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x02,
+  0x00, 0x04, 0x09, 0x05, 0x02, 0x00, 0x04, 0x09, 0x05, 0x02, 0x00, 0x04,
+  0x08, 0x05, 0x03, 0x00, 0x04, 0x08, 0x05, 0x0F, 0x01, 0x03, 0x00, 0x04,
+  0x07, 0x06, 0x0E, 0x02, 0x02, 0x00, 0x08, 0x09, 0x06, 0x02, 0x01, 0x06,
+  0x09, 0x05, 0x02, 0x02, 0x04, 0x0A, 0x03, 0x01, 0x07, 0x04, 0x01, 0x05,
+  0x07, 0x02, 0x04, 0x04, 0x0A, 0x03, 0x02, 0x03, 0x04, 0x0A, 0x03, 0x02,
+  0x02, 0x04, 0x0A, 0x03, 0x02, 0x02, 0x04, 0x0A, 0x03, 0x02, 0x01, 0x04,
+  0x09, 0x03, 0x02, 0x01, 0x04, 0x08, 0x03, 0x02, 0x00, 0x05, 0x06, 0x04,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x02, 0x00, 0x04,
+  0x0A, 0x01, 0x02, 0x00, 0x04, 0x09, 0x02, 0x02, 0x01, 0x04, 0x08, 0x02,
+  0x01, 0x01, 0x08, 0x01, 0x03, 0x04, 0x01, 0x0F, 0x05, 0x02, 0x0E, 0x03,
+  0x12, 0x03, 0x02, 0x0D, 0x03, 0x12, 0x03, 0x02, 0x0C, 0x03, 0x12, 0x03,
+  0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0A, 0x04,
+  0x01, 0x0A, 0x04, 0x01, 0x07, 0x0A, 0x01, 0x07, 0x0A, 0x01, 0x09, 0x04,
+  0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04,
+  0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04,
+  0x02, 0x00, 0x03, 0x05, 0x03, 0x02, 0x00, 0x03, 0x04, 0x04, 0x01, 0x00,
+  0x07, 0x01, 0x01, 0x05, 0x01, 0x08, 0x07, 0x01, 0x06, 0x0D, 0x02, 0x05,
+  0x05, 0x0D, 0x06, 0x02, 0x04, 0x05, 0x0D, 0x04, 0x02, 0x03, 0x05, 0x0D,
+  0x04, 0x02, 0x03, 0x04, 0x0C, 0x05, 0x02, 0x03, 0x04, 0x0C, 0x05, 0x02,
+  0x03, 0x04, 0x0B, 0x05, 0x02, 0x04, 0x03, 0x0A, 0x05, 0x01, 0x04, 0x0A,
+  0x01, 0x04, 0x08, 0x01, 0x03, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02, 0x08,
+  0x01, 0x02, 0x0B, 0x01, 0x04, 0x0B, 0x02, 0x01, 0x03, 0x08, 0x08, 0x02,
+  0x00, 0x03, 0x0B, 0x05, 0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x00, 0x03,
+  0x0C, 0x03, 0x02, 0x00, 0x04, 0x0A, 0x05, 0x01, 0x01, 0x0C, 0x01, 0x03,
+  0x07, 0x01, 0x03, 0x07, 0x01, 0x05, 0x05, 0x01, 0x06, 0x04, 0x01, 0x05,
+  0x05, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04,
+  0x05, 0x02, 0x04, 0x04, 0x0C, 0x03, 0x02, 0x04, 0x04, 0x0A, 0x06, 0x02,
+  0x04, 0x04, 0x09, 0x07, 0x03, 0x03, 0x05, 0x09, 0x01, 0x0C, 0x04, 0x03,
+  0x03, 0x04, 0x08, 0x01, 0x0C, 0x04, 0x02, 0x03, 0x05, 0x0B, 0x05, 0x02,
+  0x03, 0x05, 0x0B, 0x04, 0x02, 0x02, 0x05, 0x0B, 0x04, 0x02, 0x02, 0x05,
+  0x0A, 0x05, 0x02, 0x02, 0x04, 0x0A, 0x04, 0x02, 0x01, 0x05, 0x0A, 0x04,
+  0x02, 0x01, 0x04, 0x09, 0x05, 0x03, 0x01, 0x04, 0x09, 0x05, 0x10, 0x01,
+  0x03, 0x01, 0x04, 0x09, 0x04, 0x0F, 0x01, 0x03, 0x00, 0x05, 0x09, 0x04,
+  0x0E, 0x01, 0x02, 0x00, 0x04, 0x09, 0x06, 0x02, 0x00, 0x04, 0x0A, 0x03,
+  0x01, 0x06, 0x02, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x06, 0x02, 0x00, 0x00, 0x00, 0x01, 0x05, 0x03, 0x01, 0x01, 0x07,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x01, 0x04, 0x02, 0x01, 0x04, 0x07, 0x01, 0x02, 0x01, 0x03, 0x07,
+  0x01, 0x02, 0x00, 0x04, 0x06, 0x01, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06,
+  0x01, 0x01, 0x03, 0x01, 0x0D, 0x02, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04,
+  0x01, 0x0C, 0x04, 0x01, 0x0D, 0x02, 0x00, 0x00, 0x00, 0x01, 0x0D, 0x02,
+  0x01, 0x08, 0x07, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04,
+  0x01, 0x0A, 0x04, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04,
+  0x01, 0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04,
+  0x01, 0x08, 0x04, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x02, 0x00, 0x03, 0x06, 0x04, 0x02,
+  0x00, 0x03, 0x05, 0x04, 0x01, 0x00, 0x08, 0x01, 0x01, 0x05, 0x01, 0x03,
+  0x07, 0x01, 0x05, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x02, 0x04,
+  0x04, 0x0A, 0x07, 0x02, 0x04, 0x04, 0x0C, 0x04, 0x02, 0x04, 0x04, 0x0C,
+  0x02, 0x02, 0x03, 0x05, 0x0B, 0x02, 0x02, 0x03, 0x04, 0x0A, 0x02, 0x02,
+  0x03, 0x04, 0x09, 0x02, 0x02, 0x03, 0x04, 0x08, 0x03, 0x02, 0x02, 0x04,
+  0x07, 0x04, 0x01, 0x02, 0x09, 0x02, 0x02, 0x04, 0x07, 0x04, 0x02, 0x01,
+  0x05, 0x07, 0x04, 0x02, 0x01, 0x04, 0x08, 0x04, 0x03, 0x01, 0x04, 0x08,
+  0x04, 0x0F, 0x01, 0x03, 0x01, 0x04, 0x08, 0x04, 0x0E, 0x01, 0x02, 0x00,
+  0x05, 0x09, 0x06, 0x02, 0x00, 0x04, 0x09, 0x05, 0x02, 0x00, 0x04, 0x0A,
+  0x03, 0x01, 0x03, 0x07, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x02, 0x01,
+  0x04, 0x07, 0x01, 0x02, 0x00, 0x04, 0x06, 0x02, 0x02, 0x00, 0x04, 0x05,
+  0x02, 0x01, 0x00, 0x06, 0x01, 0x00, 0x05, 0x01, 0x01, 0x03, 0x03, 0x07,
+  0x02, 0x0D, 0x03, 0x15, 0x03, 0x03, 0x02, 0x07, 0x0B, 0x06, 0x13, 0x06,
+  0x03, 0x04, 0x04, 0x0A, 0x07, 0x13, 0x06, 0x05, 0x04, 0x04, 0x09, 0x02,
+  0x0D, 0x04, 0x12, 0x01, 0x15, 0x04, 0x04, 0x04, 0x04, 0x09, 0x01, 0x0D,
+  0x05, 0x15, 0x04, 0x04, 0x04, 0x05, 0x0D, 0x03, 0x11, 0x01, 0x15, 0x04,
+  0x03, 0x03, 0x06, 0x0C, 0x05, 0x14, 0x04, 0x03, 0x03, 0x05, 0x0C, 0x04,
+  0x14, 0x04, 0x03, 0x03, 0x05, 0x0C, 0x04, 0x13, 0x05, 0x03, 0x02, 0x05,
+  0x0B, 0x05, 0x13, 0x04, 0x03, 0x02, 0x05, 0x0B, 0x04, 0x13, 0x04, 0x03,
+  0x02, 0x04, 0x0B, 0x04, 0x13, 0x04, 0x03, 0x02, 0x04, 0x0B, 0x04, 0x12,
+  0x04, 0x04, 0x01, 0x05, 0x0A, 0x04, 0x12, 0x04, 0x18, 0x01, 0x04, 0x01,
+  0x04, 0x0A, 0x04, 0x12, 0x04, 0x17, 0x01, 0x03, 0x01, 0x04, 0x0A, 0x04,
+  0x12, 0x06, 0x03, 0x00, 0x05, 0x09, 0x04, 0x13, 0x03, 0x02, 0x07, 0x02,
+  0x0C, 0x04, 0x02, 0x02, 0x07, 0x0B, 0x06, 0x02, 0x04, 0x04, 0x0A, 0x07,
+  0x03, 0x04, 0x04, 0x0A, 0x01, 0x0D, 0x04, 0x03, 0x04, 0x04, 0x09, 0x01,
+  0x0D, 0x04, 0x03, 0x03, 0x04, 0x08, 0x01, 0x0C, 0x04, 0x03, 0x03, 0x04,
+  0x08, 0x01, 0x0C, 0x04, 0x02, 0x03, 0x05, 0x0C, 0x04, 0x02, 0x03, 0x04,
+  0x0B, 0x04, 0x02, 0x02, 0x05, 0x0B, 0x04, 0x02, 0x02, 0x05, 0x0B, 0x04,
+  0x02, 0x02, 0x04, 0x0A, 0x05, 0x02, 0x02, 0x04, 0x0A, 0x04, 0x03, 0x01,
+  0x05, 0x0A, 0x04, 0x10, 0x01, 0x03, 0x01, 0x04, 0x0A, 0x04, 0x0F, 0x01,
+  0x02, 0x01, 0x04, 0x0A, 0x06, 0x02, 0x01, 0x04, 0x0B, 0x03, 0x01, 0x07,
+  0x05, 0x02, 0x05, 0x03, 0x0B, 0x02, 0x02, 0x04, 0x03, 0x0B, 0x03, 0x02,
+  0x03, 0x04, 0x0B, 0x04, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02, 0x02, 0x04,
+  0x0B, 0x04, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x04, 0x0A, 0x05,
+  0x02, 0x00, 0x05, 0x0A, 0x05, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x02, 0x00,
+  0x04, 0x0A, 0x04, 0x02, 0x00, 0x04, 0x09, 0x04, 0x02, 0x00, 0x04, 0x09,
+  0x04, 0x02, 0x00, 0x04, 0x08, 0x04, 0x02, 0x01, 0x03, 0x08, 0x03, 0x02,
+  0x02, 0x03, 0x07, 0x03, 0x01, 0x03, 0x05, 0x02, 0x08, 0x03, 0x0E, 0x03,
+  0x02, 0x05, 0x06, 0x0C, 0x06, 0x01, 0x06, 0x0D, 0x03, 0x06, 0x04, 0x0B,
+  0x01, 0x0F, 0x04, 0x02, 0x06, 0x05, 0x0F, 0x04, 0x02, 0x06, 0x04, 0x0F,
+  0x04, 0x02, 0x06, 0x04, 0x0F, 0x04, 0x02, 0x05, 0x05, 0x0E, 0x05, 0x02,
+  0x05, 0x04, 0x0E, 0x04, 0x02, 0x05, 0x04, 0x0E, 0x04, 0x02, 0x05, 0x04,
+  0x0D, 0x05, 0x02, 0x04, 0x04, 0x0D, 0x04, 0x02, 0x04, 0x04, 0x0C, 0x05,
+  0x02, 0x04, 0x04, 0x0C, 0x04, 0x02, 0x04, 0x04, 0x0B, 0x04, 0x01, 0x03,
+  0x0B, 0x02, 0x03, 0x04, 0x08, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x00, 0x08,
+  0x02, 0x07, 0x04, 0x0C, 0x04, 0x01, 0x05, 0x0B, 0x02, 0x04, 0x04, 0x0B,
+  0x04, 0x02, 0x03, 0x04, 0x0B, 0x04, 0x02, 0x03, 0x04, 0x0B, 0x04, 0x02,
+  0x02, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x05, 0x0A, 0x04, 0x02, 0x01, 0x04,
+  0x0A, 0x04, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x02, 0x00, 0x04, 0x09, 0x05,
+  0x02, 0x00, 0x04, 0x09, 0x04, 0x02, 0x00, 0x04, 0x08, 0x05, 0x02, 0x00,
+  0x04, 0x08, 0x05, 0x02, 0x00, 0x04, 0x07, 0x05, 0x02, 0x00, 0x07, 0x08,
+  0x04, 0x02, 0x01, 0x06, 0x08, 0x04, 0x02, 0x02, 0x03, 0x07, 0x04, 0x01,
+  0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x03, 0x0A, 0x02, 0x06, 0x03, 0x0B, 0x03, 0x02, 0x02,
+  0x07, 0x0A, 0x05, 0x02, 0x04, 0x04, 0x09, 0x06, 0x03, 0x04, 0x04, 0x09,
+  0x01, 0x0B, 0x03, 0x01, 0x04, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05,
+  0x01, 0x03, 0x04, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x00, 0x05, 0x02, 0x05, 0x03, 0x0B, 0x02, 0x01, 0x03, 0x0A, 0x02,
+  0x03, 0x03, 0x09, 0x03, 0x02, 0x02, 0x03, 0x0A, 0x02, 0x02, 0x02, 0x03,
+  0x0B, 0x01, 0x02, 0x02, 0x04, 0x0B, 0x01, 0x01, 0x02, 0x05, 0x01, 0x02,
+  0x06, 0x01, 0x03, 0x05, 0x01, 0x04, 0x05, 0x01, 0x05, 0x05, 0x01, 0x06,
+  0x04, 0x02, 0x01, 0x01, 0x06, 0x04, 0x02, 0x01, 0x01, 0x07, 0x03, 0x02,
+  0x01, 0x02, 0x07, 0x03, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x00, 0x01,
+  0x03, 0x04, 0x01, 0x08, 0x01, 0x01, 0x07, 0x02, 0x01, 0x06, 0x02, 0x01,
+  0x05, 0x03, 0x01, 0x03, 0x05, 0x01, 0x01, 0x09, 0x01, 0x01, 0x09, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x02, 0x01, 0x04, 0x07, 0x01, 0x02, 0x00, 0x04, 0x07, 0x01,
+  0x02, 0x00, 0x04, 0x06, 0x01, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01,
+  0x01, 0x03, 0x02, 0x04, 0x04, 0x0C, 0x04, 0x02, 0x01, 0x07, 0x0C, 0x04,
+  0x02, 0x02, 0x05, 0x0C, 0x04, 0x02, 0x02, 0x05, 0x0C, 0x04, 0x02, 0x02,
+  0x05, 0x0B, 0x04, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02, 0x02, 0x04, 0x0B,
+  0x04, 0x02, 0x01, 0x05, 0x0A, 0x04, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x02,
+  0x01, 0x04, 0x09, 0x05, 0x02, 0x01, 0x04, 0x09, 0x05, 0x02, 0x00, 0x04,
+  0x08, 0x05, 0x04, 0x00, 0x04, 0x07, 0x01, 0x09, 0x04, 0x0F, 0x01, 0x04,
+  0x00, 0x04, 0x06, 0x02, 0x09, 0x04, 0x0F, 0x01, 0x02, 0x00, 0x07, 0x09,
+  0x06, 0x02, 0x00, 0x06, 0x09, 0x05, 0x02, 0x01, 0x04, 0x0A, 0x03, 0x02,
+  0x03, 0x02, 0x0A, 0x02, 0x02, 0x00, 0x05, 0x09, 0x04, 0x02, 0x01, 0x04,
+  0x09, 0x04, 0x02, 0x02, 0x04, 0x0A, 0x03, 0x02, 0x02, 0x04, 0x0B, 0x02,
+  0x02, 0x02, 0x04, 0x0B, 0x01, 0x02, 0x02, 0x04, 0x0A, 0x02, 0x02, 0x02,
+  0x04, 0x0A, 0x01, 0x02, 0x02, 0x04, 0x09, 0x01, 0x02, 0x02, 0x04, 0x08,
+  0x01, 0x02, 0x02, 0x04, 0x07, 0x01, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x03, 0x02, 0x03,
+  0x0B, 0x01, 0x10, 0x02, 0x03, 0x00, 0x05, 0x0A, 0x02, 0x0F, 0x04, 0x03,
+  0x01, 0x04, 0x0A, 0x02, 0x0F, 0x04, 0x03, 0x01, 0x04, 0x09, 0x03, 0x10,
+  0x03, 0x03, 0x02, 0x04, 0x09, 0x03, 0x11, 0x02, 0x03, 0x02, 0x04, 0x08,
+  0x05, 0x11, 0x01, 0x03, 0x02, 0x04, 0x08, 0x05, 0x11, 0x01, 0x04, 0x02,
+  0x04, 0x07, 0x01, 0x09, 0x04, 0x10, 0x01, 0x03, 0x02, 0x06, 0x09, 0x04,
+  0x0F, 0x01, 0x03, 0x02, 0x05, 0x09, 0x04, 0x0E, 0x02, 0x03, 0x02, 0x05,
+  0x09, 0x04, 0x0E, 0x01, 0x02, 0x02, 0x04, 0x09, 0x05, 0x02, 0x02, 0x03,
+  0x09, 0x04, 0x02, 0x02, 0x03, 0x09, 0x04, 0x02, 0x02, 0x02, 0x0A, 0x02,
+  0x02, 0x02, 0x01, 0x0A, 0x01, 0x02, 0x06, 0x03, 0x0E, 0x03, 0x02, 0x03,
+  0x07, 0x0D, 0x05, 0x02, 0x06, 0x04, 0x0C, 0x05, 0x02, 0x06, 0x04, 0x0B,
+  0x02, 0x02, 0x06, 0x04, 0x0B, 0x01, 0x01, 0x06, 0x05, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x05,
+  0x01, 0x06, 0x06, 0x03, 0x06, 0x01, 0x08, 0x04, 0x0F, 0x01, 0x04, 0x00,
+  0x03, 0x05, 0x01, 0x08, 0x04, 0x0E, 0x02, 0x02, 0x00, 0x06, 0x08, 0x07,
+  0x02, 0x00, 0x05, 0x09, 0x05, 0x02, 0x01, 0x03, 0x0A, 0x03, 0x02, 0x07,
+  0x02, 0x0E, 0x02, 0x02, 0x04, 0x06, 0x0D, 0x04, 0x02, 0x05, 0x05, 0x0D,
+  0x04, 0x02, 0x06, 0x04, 0x0D, 0x04, 0x02, 0x06, 0x05, 0x0F, 0x02, 0x02,
+  0x06, 0x05, 0x0F, 0x01, 0x02, 0x07, 0x04, 0x0F, 0x01, 0x02, 0x07, 0x04,
+  0x0E, 0x02, 0x02, 0x07, 0x04, 0x0E, 0x01, 0x02, 0x07, 0x05, 0x0D, 0x02,
+  0x02, 0x08, 0x04, 0x0D, 0x01, 0x01, 0x08, 0x06, 0x01, 0x08, 0x05, 0x01,
+  0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x03, 0x01,
+  0x08, 0x02, 0x01, 0x07, 0x02, 0x02, 0x01, 0x03, 0x06, 0x02, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x06, 0x01, 0x01, 0x03, 0x01, 0x03, 0x0B, 0x01, 0x03,
+  0x0B, 0x01, 0x03, 0x0A, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x02, 0x01,
+  0x09, 0x02, 0x01, 0x09, 0x01, 0x01, 0x08, 0x01, 0x01, 0x07, 0x02, 0x01,
+  0x06, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x03, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x06, 0x0B, 0x02, 0x02, 0x01,
+  0x07, 0x0B, 0x03, 0x03, 0x00, 0x02, 0x04, 0x05, 0x0B, 0x03, 0x02, 0x06,
+  0x03, 0x0B, 0x02, 0x01, 0x08, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x09, 0x05,
+  0x01, 0x08, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03,
+  0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x04, 0x01, 0x02, 0x05, 0x01, 0x01, 0x06, 0x01, 0x03, 0x02,
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x02, 0x02, 0x01, 0x03, 0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x08, 0x04,
+  0x01, 0x0A, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03,
+  0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04,
+  0x01, 0x0A, 0x04, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04,
+  0x01, 0x09, 0x04, 0x01, 0x09, 0x03, 0x01, 0x0A, 0x02, 0x01, 0x0B, 0x01,
+  0x01, 0x09, 0x04, 0x01, 0x08, 0x06, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03,
+  0x01, 0x04, 0x04, 0x01, 0x02, 0x05, 0x01, 0x00, 0x05, 0x01, 0x02, 0x05,
+  0x02, 0x01, 0x09, 0x0D, 0x02, 0x01, 0x00, 0x10, 0x02, 0x01, 0x02, 0x07,
+  0x08, 0x01, 0x09, 0x05 };
+
+const GFXglyph FreeSerifBoldItalic18pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,   9,    0,    1 },   // 0x20 ' '
+  {     0,  11,  25,  14,    2,  -23 },   // 0x21 '!'
+  {    69,  14,  10,  19,    4,  -23 },   // 0x22 '"'
+  {   119,  20,  25,  17,   -1,  -24 },   // 0x23 '#'
+  {   232,  17,  29,  18,    0,  -25 },   // 0x24 '$'
+  {   373,  27,  25,  29,    1,  -23 },   // 0x25 '%'
+  {   542,  25,  25,  27,    0,  -23 },   // 0x26 '&'
+  {   673,   5,  10,  10,    4,  -23 },   // 0x27 '''
+  {   703,  11,  30,  12,    1,  -23 },   // 0x28 '('
+  {   793,  11,  30,  12,   -2,  -23 },   // 0x29 ')'
+  {   883,  13,  15,  18,    2,  -23 },   // 0x2A '*'
+  {   956,  17,  17,  20,    1,  -16 },   // 0x2B '+'
+  {  1007,   7,  11,   9,   -2,   -4 },   // 0x2C ','
+  {  1040,   9,   4,  12,    0,   -9 },   // 0x2D '-'
+  {  1052,   6,   5,   9,    0,   -3 },   // 0x2E '.'
+  {  1067,  14,  25,  12,    0,  -23 },   // 0x2F '/'
+  {  1142,  15,  25,  18,    1,  -23 },   // 0x30 '0'
+  {  1263,  15,  25,  17,    0,  -23 },   // 0x31 '1'
+  {  1338,  16,  25,  18,    0,  -23 },   // 0x32 '2'
+  {  1425,  15,  25,  17,    1,  -23 },   // 0x33 '3'
+  {  1508,  18,  24,  17,    0,  -23 },   // 0x34 '4'
+  {  1600,  17,  25,  18,    0,  -23 },   // 0x35 '5'
+  {  1679,  17,  25,  18,    1,  -23 },   // 0x36 '6'
+  {  1778,  16,  24,  17,    3,  -23 },   // 0x37 '7'
+  {  1856,  17,  25,  18,    0,  -23 },   // 0x38 '8'
+  {  1967,  17,  25,  18,    0,  -23 },   // 0x39 '9'
+  {  2066,  10,  17,   9,    0,  -15 },   // 0x3A ':'
+  {  2103,  11,  22,   9,   -1,  -15 },   // 0x3B ';'
+  {  2157,  18,  19,  20,    1,  -18 },   // 0x3C '<'
+  {  2212,  18,  10,  20,    2,  -13 },   // 0x3D '='
+  {  2234,  18,  19,  20,    2,  -18 },   // 0x3E '>'
+  {  2289,  13,  25,  17,    3,  -23 },   // 0x3F '?'
+  {  2366,  25,  25,  29,    2,  -23 },   // 0x40 '@'
+  {  2529,  23,  25,  24,    0,  -23 },   // 0x41 'A'
+  {  2634,  24,  25,  22,    0,  -23 },   // 0x42 'B'
+  {  2749,  23,  25,  22,    1,  -23 },   // 0x43 'C'
+  {  2848,  26,  25,  25,    0,  -23 },   // 0x44 'D'
+  {  2965,  23,  25,  22,    0,  -23 },   // 0x45 'E'
+  {  3078,  23,  25,  21,    0,  -23 },   // 0x46 'F'
+  {  3179,  24,  25,  25,    2,  -23 },   // 0x47 'G'
+  {  3288,  29,  25,  26,    0,  -23 },   // 0x48 'H'
+  {  3409,  15,  25,  13,    0,  -23 },   // 0x49 'I'
+  {  3484,  20,  27,  17,    0,  -23 },   // 0x4A 'J'
+  {  3571,  25,  25,  23,    0,  -23 },   // 0x4B 'K'
+  {  3694,  22,  25,  21,    0,  -23 },   // 0x4C 'L'
+  {  3781,  33,  25,  31,    0,  -23 },   // 0x4D 'M'
+  {  3964,  27,  25,  25,    0,  -23 },   // 0x4E 'N'
+  {  4109,  23,  25,  24,    1,  -23 },   // 0x4F 'O'
+  {  4226,  23,  25,  21,    0,  -23 },   // 0x50 'P'
+  {  4321,  23,  31,  24,    1,  -23 },   // 0x51 'Q'
+  {  4462,  24,  25,  23,    0,  -23 },   // 0x52 'R'
+  {  4579,  18,  25,  18,    0,  -23 },   // 0x53 'S'
+  {  4684,  21,  25,  21,    3,  -23 },   // 0x54 'T'
+  {  4781,  24,  25,  25,    4,  -23 },   // 0x55 'U'
+  {  4902,  24,  25,  25,    4,  -23 },   // 0x56 'V'
+  {  5011,  31,  25,  32,    4,  -23 },   // 0x57 'W'
+  {  5178,  25,  25,  24,    0,  -23 },   // 0x58 'X'
+  {  5291,  21,  25,  22,    4,  -23 },   // 0x59 'Y'
+  {  5390,  21,  25,  20,    0,  -23 },   // 0x5A 'Z'
+  {  5487,  14,  30,  12,   -1,  -23 },   // 0x5B '['
+  {  5577,  10,  25,  14,    4,  -23 },   // 0x5C '\'
+  {  5652,  14,  30,  12,   -2,  -23 },   // 0x5D ']'
+  {  5742,  16,  13,  20,    2,  -23 },   // 0x5E '^'
+  {  5799,  18,   3,  17,    0,    3 },   // 0x5F '_'
+  {  5808,   7,   6,  12,    3,  -23 },   // 0x60 '`'
+  {  5826,  18,  17,  18,    0,  -15 },   // 0x61 'a'
+  {  5917,  16,  26,  17,    1,  -24 },   // 0x62 'b'
+  {  6025,  13,  17,  15,    1,  -15 },   // 0x63 'c'
+  {  6088,  19,  25,  18,    1,  -23 },   // 0x64 'd'
+  {  6199,  13,  17,  15,    1,  -15 },   // 0x65 'e'
+  {  6270,  21,  32,  17,   -3,  -24 },   // 0x66 'f'
+  {  6376,  19,  23,  17,   -1,  -15 },   // 0x67 'g'
+  {  6469,  17,  25,  19,    1,  -23 },   // 0x68 'h'
+  {  6588,   9,  25,  10,    1,  -23 },   // 0x69 'i'
+  {  6663,  16,  31,  12,   -3,  -23 },   // 0x6A 'j'
+  {  6754,  17,  25,  18,    1,  -23 },   // 0x6B 'k'
+  {  6865,  11,  25,  10,    1,  -23 },   // 0x6C 'l'
+  {  6946,  26,  17,  27,    0,  -15 },   // 0x6D 'm'
+  {  7077,  18,  17,  18,    0,  -15 },   // 0x6E 'n'
+  {  7174,  15,  17,  17,    1,  -15 },   // 0x6F 'o'
+  {  7255,  19,  23,  17,   -2,  -15 },   // 0x70 'p'
+  {  7356,  16,  23,  17,    1,  -15 },   // 0x71 'q'
+  {  7457,  15,  16,  14,    0,  -15 },   // 0x72 'r'
+  {  7515,  13,  17,  12,    0,  -15 },   // 0x73 's'
+  {  7586,  10,  22,  10,    1,  -20 },   // 0x74 't'
+  {  7658,  17,  17,  19,    1,  -15 },   // 0x75 'u'
+  {  7751,  13,  16,  15,    2,  -15 },   // 0x76 'v'
+  {  7821,  19,  16,  23,    3,  -15 },   // 0x77 'w'
+  {  7925,  18,  17,  17,   -1,  -15 },   // 0x78 'x'
+  {  8002,  17,  23,  15,   -2,  -15 },   // 0x79 'y'
+  {  8095,  15,  19,  14,    0,  -15 },   // 0x7A 'z'
+  {  8166,  15,  32,  12,    0,  -24 },   // 0x7B '{'
+  {  8262,   3,  25,   9,    4,  -23 },   // 0x7C '|'
+  {  8337,  15,  32,  12,   -5,  -24 },   // 0x7D '}'
+  {  8433,  16,   5,  20,    2,  -11 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSerifBoldItalic18pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSerifBoldItalic18pt7bSpanData,
+    (GFXglyph *)FreeSerifBoldItalic18pt7bSpanGlyphs,
+    0x20, 0x7E, 42 } };
+
+// Approx. 9236 bytes
@@ -0,0 +1,504 @@
+// FreeSerifBoldItalic24pt7b as run lengths, generated by Tools/GFX_pack from FreeSerifBoldItalic24pt7b.h
+//
+// Alternating background and foreground runs, one nibble each, 15 adds to the next
+
+const uint8_t FreeSerifBoldItalic24pt7bPackedRuns[] PROGMEM = {
+  0xA4, 0xA6, 0x96, 0x87, 0x87, 0x87, 0x86, 0x96, 0x95, 0xA5, 0x95, 0xA5,
+  0xA4, 0xB4, 0xB3, 0xC3, 0xC3, 0xC2, 0xC3, 0xC2, 0xD2, 0xD1, 0xFF, 0xFF,
+  0xA4, 0xA6, 0x88, 0x78, 0x78, 0x86, 0xA4, 0x90, 0x33, 0x93, 0x35, 0x75,
+  0x16, 0x66, 0x16, 0x66, 0x15, 0x75, 0x25, 0x75, 0x24, 0x84, 0x34, 0x84,
+  0x33, 0x93, 0x34, 0x93, 0x33, 0x93, 0x43, 0x93, 0x42, 0xA2, 0x50, 0xE4,
+  0x54, 0xE3, 0x63, 0xE4, 0x54, 0xE4, 0x54, 0xE3, 0x63, 0xE4, 0x54, 0xE3,
+  0x63, 0xE4, 0x54, 0xE4, 0x54, 0xD4, 0x54, 0x9F, 0x75, 0xF7, 0x5F, 0x6A,
+  0x36, 0x3E, 0x45, 0x4E, 0x45, 0x4E, 0x36, 0x3E, 0x45, 0x4E, 0x45, 0x4E,
+  0x36, 0x39, 0xF7, 0x5F, 0x75, 0xF6, 0xA3, 0x63, 0xE4, 0x54, 0xE4, 0x54,
+  0xE3, 0x63, 0xE4, 0x54, 0xE3, 0x63, 0xE4, 0x54, 0xE4, 0x54, 0xE3, 0x63,
+  0xE4, 0x54, 0xD0, 0xF1, 0x3F, 0x62, 0xF7, 0x2F, 0x28, 0xEC, 0xA5, 0x32,
+  0x24, 0x83, 0x52, 0x34, 0x63, 0x53, 0x34, 0x63, 0x52, 0x52, 0x64, 0x52,
+  0x52, 0x64, 0x43, 0x52, 0x65, 0x33, 0x51, 0x76, 0x22, 0x61, 0x7A, 0xF0,
+  0x9F, 0x0A, 0xF0, 0xAF, 0x0A, 0xF0, 0xAF, 0x18, 0xF1, 0x9E, 0xAE, 0x31,
+  0x75, 0x17, 0x23, 0x65, 0x17, 0x24, 0x54, 0x26, 0x34, 0x54, 0x26, 0x25,
+  0x54, 0x26, 0x25, 0x53, 0x44, 0x35, 0x44, 0x44, 0x34, 0x46, 0x43, 0x24,
+  0x57, 0x42, 0x23, 0x5A, 0xCE, 0x8F, 0x22, 0xF6, 0x3F, 0x63, 0xF6, 0x2F,
+  0x72, 0xF1, 0x75, 0xD3, 0xC9, 0xA3, 0xC6, 0x23, 0x65, 0xC6, 0x3E, 0xB6,
+  0x67, 0x13, 0xC6, 0x61, 0x73, 0xB6, 0x71, 0x63, 0xC6, 0x71, 0x63, 0xB6,
+  0x81, 0x53, 0xC6, 0x71, 0x62, 0xD6, 0x71, 0x53, 0xD5, 0x72, 0x43, 0xE5,
+  0x71, 0x53, 0xE5, 0x62, 0x43, 0xF1, 0x45, 0x25, 0x37, 0x54, 0x53, 0x25,
+  0x36, 0x84, 0x86, 0x26, 0x63, 0x14, 0x57, 0x35, 0x55, 0x2E, 0x35, 0x66,
+  0x1E, 0x34, 0x67, 0x1D, 0x34, 0x68, 0x1D, 0x25, 0x68, 0x1C, 0x35, 0x59,
+  0x1C, 0x25, 0x68, 0x1C, 0x35, 0x68, 0x1B, 0x36, 0x58, 0x1C, 0x36, 0x58,
+  0x1B, 0x37, 0x57, 0x2B, 0x28, 0x56, 0x2B, 0x39, 0x54, 0x2C, 0x2B, 0x9C,
+  0x3C, 0x67, 0xF1, 0x6F, 0xB9, 0xF7, 0x53, 0x4F, 0x64, 0x54, 0xF4, 0x46,
+  0x4F, 0x44, 0x64, 0xF3, 0x56, 0x4F, 0x35, 0x55, 0xF3, 0x55, 0x4F, 0x45,
+  0x44, 0xF5, 0x53, 0x4F, 0x6A, 0xF8, 0x8F, 0xA6, 0xFB, 0x7F, 0x99, 0x5A,
+  0x74, 0x26, 0x67, 0x74, 0x36, 0x74, 0x75, 0x46, 0x73, 0x75, 0x66, 0x62,
+  0x84, 0x76, 0x53, 0x75, 0x76, 0x43, 0x85, 0x77, 0x32, 0x86, 0x87, 0x12,
+  0x96, 0x8A, 0x96, 0x98, 0xA7, 0x88, 0xA7, 0x97, 0xB7, 0x88, 0x71, 0x29,
+  0x5B, 0x42, 0x3F, 0x01, 0xD5, 0xD3, 0xB8, 0x89, 0x65, 0x33, 0x35, 0x16,
+  0x16, 0x15, 0x25, 0x24, 0x34, 0x33, 0x34, 0x33, 0x43, 0x42, 0x50, 0xD1,
+  0xB3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4, 0x94, 0x94, 0xA4, 0x94, 0x95, 0x94,
+  0xA4, 0x95, 0x94, 0xA4, 0x95, 0x95, 0x95, 0x94, 0xA4, 0xA4, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xA4, 0xB3, 0xB3, 0xB3, 0xB3, 0xC2, 0xC3, 0xC2, 0xC2, 0xD2,
+  0xC2, 0xD2, 0xC2, 0xF6, 0x71, 0xD2, 0xD1, 0xD2, 0xD1, 0xD2, 0xC2, 0xC3,
+  0xC2, 0xC3, 0xB3, 0xB3, 0xB3, 0xB4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+  0x95, 0x95, 0x95, 0x94, 0xA4, 0x95, 0x95, 0x94, 0x95, 0x94, 0xA4, 0x94,
+  0xA3, 0xA4, 0x94, 0xA3, 0xA3, 0xA3, 0xA2, 0xB2, 0xC1, 0xD0, 0x83, 0xF0,
+  0x5E, 0x5E, 0x58, 0x34, 0x34, 0x31, 0x53, 0x33, 0xB3, 0x13, 0xC3, 0x13,
+  0x61, 0x62, 0x12, 0x68, 0x5E, 0x58, 0x62, 0x12, 0x61, 0x63, 0x13, 0xC3,
+  0x13, 0xB3, 0x33, 0x51, 0x34, 0x34, 0x38, 0x5E, 0x5E, 0x5F, 0x03, 0x80,
+  0x94, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F,
+  0x34, 0x9F, 0xFF, 0xFF, 0xD9, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F,
+  0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0x90, 0x44, 0x56, 0x47, 0x37,
+  0x37, 0x46, 0x55, 0x63, 0x73, 0x72, 0x72, 0x72, 0x72, 0x63, 0x71, 0x80,
+  0x1B, 0x1B, 0x1A, 0x1B, 0x1B, 0x10, 0x24, 0x36, 0x1F, 0x91, 0x63, 0x42,
+  0xF0, 0x4E, 0x4F, 0x04, 0xE4, 0xF0, 0x4E, 0x4F, 0x04, 0xE4, 0xF0, 0x4E,
+  0x5E, 0x4F, 0x04, 0xE4, 0xF0, 0x4E, 0x4F, 0x04, 0xE4, 0xF0, 0x4E, 0x4F,
+  0x04, 0xE5, 0xE4, 0xF0, 0x4E, 0x4F, 0x04, 0xE4, 0xF0, 0x4E, 0x4F, 0x04,
+  0xE5, 0xE4, 0xE5, 0xE4, 0xF0, 0xC5, 0xF0, 0x33, 0x3B, 0x45, 0x39, 0x55,
+  0x38, 0x56, 0x47, 0x56, 0x46, 0x57, 0x45, 0x67, 0x54, 0x66, 0x63, 0x67,
+  0x63, 0x67, 0x62, 0x77, 0x62, 0x68, 0x61, 0x77, 0x71, 0x77, 0x71, 0x77,
+  0x71, 0x68, 0x61, 0x77, 0x71, 0x77, 0x71, 0x77, 0x71, 0x68, 0x62, 0x67,
+  0x72, 0x67, 0x72, 0x67, 0x63, 0x67, 0x63, 0x57, 0x64, 0x57, 0x65, 0x46,
+  0x66, 0x46, 0x58, 0x36, 0x49, 0x35, 0x4B, 0x33, 0x4E, 0x6B, 0xF2, 0x3B,
+  0x88, 0xCD, 0x7D, 0x6E, 0x6E, 0x6D, 0x7D, 0x6E, 0x6D, 0x7D, 0x7D, 0x6E,
+  0x6D, 0x7D, 0x6E, 0x6E, 0x6D, 0x7D, 0x6E, 0x6D, 0x7D, 0x7D, 0x6E, 0x6D,
+  0x7D, 0x6E, 0x6D, 0x7D, 0x7B, 0xA7, 0xF1, 0x40, 0xC5, 0xEA, 0xBC, 0x9E,
+  0x73, 0x57, 0x72, 0x77, 0x52, 0x87, 0x42, 0xA6, 0xF1, 0x6F, 0x16, 0xF1,
+  0x6F, 0x15, 0xF1, 0x6F, 0x15, 0xF1, 0x6F, 0x15, 0xF1, 0x5F, 0x24, 0xF2,
+  0x4F, 0x24, 0xF2, 0x4F, 0x24, 0xF2, 0x3F, 0x33, 0x92, 0x73, 0xA1, 0x73,
+  0xA2, 0x63, 0xA2, 0x6F, 0x15, 0xF2, 0x4F, 0x24, 0xF3, 0x4F, 0x25, 0xC6,
+  0xEA, 0xAD, 0x82, 0x57, 0x72, 0x77, 0x61, 0x96, 0xF1, 0x6F, 0x16, 0xF1,
+  0x6F, 0x15, 0xF1, 0x6F, 0x06, 0xF0, 0x5F, 0x15, 0xE8, 0xCB, 0xDA, 0xF0,
+  0x8F, 0x07, 0xF0, 0x7F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x15, 0xF2,
+  0x5F, 0x24, 0x53, 0x95, 0x45, 0x84, 0x56, 0x64, 0x67, 0x44, 0x8C, 0xC7,
+  0xC0, 0xF6, 0x3F, 0x64, 0xF5, 0x5F, 0x46, 0xF3, 0x6F, 0x37, 0xF2, 0x8F,
+  0x19, 0xF0, 0x21, 0x6F, 0x02, 0x26, 0xE2, 0x36, 0xD2, 0x36, 0xD2, 0x46,
+  0xC2, 0x56, 0xB2, 0x66, 0xB2, 0x56, 0xB2, 0x66, 0xA2, 0x76, 0x92, 0x77,
+  0x82, 0x86, 0x82, 0x96, 0x7F, 0x64, 0xF6, 0x4F, 0x54, 0xF6, 0xF1, 0x6F,
+  0x36, 0xF4, 0x6F, 0x46, 0xF3, 0x7F, 0x36, 0xF4, 0x69, 0xAD, 0xAE, 0xAE,
+  0xAD, 0xAE, 0xA2, 0xF6, 0x2F, 0x72, 0xF6, 0x2F, 0x76, 0xF2, 0xAE, 0xBD,
+  0xCB, 0xEE, 0xBF, 0x18, 0xF2, 0x8F, 0x27, 0xF3, 0x6F, 0x36, 0xF4, 0x5F,
+  0x45, 0xF4, 0x5F, 0x44, 0xF5, 0x4F, 0x44, 0x74, 0x94, 0x66, 0x74, 0x76,
+  0x64, 0x87, 0x44, 0xAC, 0xE7, 0xE0, 0xF5, 0x3F, 0x16, 0xF0, 0x5F, 0x16,
+  0xF0, 0x6F, 0x16, 0xF1, 0x6F, 0x07, 0xF1, 0x6F, 0x17, 0xF0, 0x7F, 0x07,
+  0xF1, 0xD9, 0xF0, 0x87, 0x45, 0x67, 0x65, 0x57, 0x66, 0x46, 0x76, 0x37,
+  0x76, 0x37, 0x76, 0x36, 0x77, 0x36, 0x77, 0x36, 0x77, 0x35, 0x86, 0x45,
+  0x77, 0x45, 0x77, 0x54, 0x76, 0x64, 0x66, 0x74, 0x65, 0x94, 0x45, 0xBB,
+  0xE7, 0xB0, 0x4F, 0x35, 0xF3, 0x5F, 0x25, 0xF3, 0x5F, 0x25, 0x3B, 0x36,
+  0x1C, 0x45, 0x2B, 0x46, 0x1C, 0x4F, 0x34, 0xF4, 0x4F, 0x34, 0xF3, 0x4F,
+  0x44, 0xF3, 0x4F, 0x44, 0xF3, 0x4F, 0x35, 0xF3, 0x4F, 0x34, 0xF4, 0x4F,
+  0x34, 0xF3, 0x5F, 0x34, 0xF3, 0x4F, 0x44, 0xF3, 0x4F, 0x35, 0xF3, 0x4F,
+  0x35, 0xF3, 0x4F, 0x30, 0xB5, 0xE9, 0xB4, 0x34, 0x94, 0x54, 0x74, 0x74,
+  0x64, 0x74, 0x55, 0x74, 0x55, 0x74, 0x55, 0x74, 0x56, 0x64, 0x56, 0x54,
+  0x67, 0x44, 0x77, 0x24, 0x8B, 0xB9, 0xC8, 0xE8, 0xBB, 0x84, 0x28, 0x64,
+  0x47, 0x54, 0x66, 0x44, 0x86, 0x34, 0x86, 0x24, 0xA5, 0x24, 0xA5, 0x24,
+  0xA5, 0x24, 0xA5, 0x24, 0xA4, 0x43, 0xA4, 0x44, 0x84, 0x64, 0x64, 0x84,
+  0x44, 0xB7, 0x90, 0xC6, 0xEB, 0xB6, 0x34, 0x96, 0x53, 0x86, 0x64, 0x67,
+  0x64, 0x66, 0x75, 0x47, 0x75, 0x46, 0x85, 0x37, 0x76, 0x37, 0x76, 0x36,
+  0x86, 0x36, 0x86, 0x36, 0x77, 0x36, 0x77, 0x36, 0x76, 0x55, 0x67, 0x55,
+  0x67, 0x65, 0x47, 0x8F, 0x09, 0xDF, 0x17, 0xF0, 0x7F, 0x07, 0xF1, 0x6F,
+  0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x3F,
+  0x50, 0x74, 0x86, 0x68, 0x58, 0x58, 0x66, 0x84, 0xFF, 0xFF, 0xFF, 0xF3,
+  0x48, 0x66, 0x85, 0x85, 0x86, 0x68, 0x47, 0x94, 0xA6, 0x88, 0x78, 0x78,
+  0x86, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0x64, 0xA6, 0x97, 0x87, 0x87, 0x96,
+  0xA5, 0xB3, 0xC3, 0xB3, 0xC2, 0xC2, 0xB3, 0xA3, 0xFC, 0xF8, 0x1F, 0x63,
+  0xF4, 0x5F, 0x27, 0xEA, 0xCA, 0xCA, 0xBB, 0xBA, 0xCA, 0xCA, 0xD9, 0xF0,
+  0x6F, 0x38, 0xF1, 0xBF, 0x1A, 0xF1, 0xAF, 0x1B, 0xF1, 0xAF, 0x1A, 0xF1,
+  0xAF, 0x18, 0xF4, 0x5F, 0x63, 0xF8, 0x10, 0x0F, 0xFF, 0xFF, 0xF6, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x60, 0x01, 0xF8, 0x3F, 0x65,
+  0xF4, 0x8F, 0x1A, 0xF1, 0xAF, 0x1A, 0xF1, 0xBF, 0x1A, 0xF1, 0xAF, 0x1B,
+  0xF1, 0x8F, 0x36, 0xF1, 0x8E, 0xAB, 0xBB, 0xAC, 0xAB, 0xBB, 0xAC, 0xAE,
+  0x8F, 0x16, 0xF3, 0x3F, 0x61, 0xF8, 0x76, 0xAA, 0x74, 0x35, 0x63, 0x55,
+  0x44, 0x56, 0x35, 0x46, 0x35, 0x46, 0x35, 0x46, 0x43, 0x56, 0xB7, 0xB6,
+  0xB6, 0xC6, 0xB5, 0xD4, 0xD4, 0xD4, 0xE2, 0xF0, 0x2F, 0x12, 0xF0, 0x2F,
+  0x12, 0xFF, 0xFF, 0xFA, 0x4D, 0x6B, 0x8A, 0x8A, 0x8B, 0x6D, 0x4C, 0xD9,
+  0xF6, 0xF0, 0xF1, 0x67, 0x5E, 0x4D, 0x4A, 0x5F, 0x13, 0x85, 0xF3, 0x36,
+  0x5F, 0x53, 0x54, 0xA4, 0x51, 0x22, 0x45, 0x96, 0x14, 0x23, 0x34, 0x94,
+  0x26, 0x32, 0x25, 0x84, 0x35, 0x43, 0x15, 0x74, 0x54, 0x57, 0x74, 0x64,
+  0x57, 0x74, 0x64, 0x57, 0x64, 0x64, 0x67, 0x64, 0x64, 0x67, 0x55, 0x64,
+  0x67, 0x54, 0x64, 0x68, 0x54, 0x64, 0x62, 0x15, 0x54, 0x54, 0x72, 0x15,
+  0x54, 0x45, 0x62, 0x35, 0x45, 0x26, 0x53, 0x35, 0x56, 0x24, 0x43, 0x45,
+  0x64, 0x3A, 0x65, 0xE6, 0x94, 0xFE, 0x5F, 0xE5, 0xFE, 0x5F, 0xE5, 0xE3,
+  0xD6, 0x95, 0xF0, 0xF1, 0xF5, 0x9B, 0xF6, 0x2F, 0xD3, 0xFD, 0x3F, 0xC4,
+  0xFC, 0x4F, 0xB5, 0xFA, 0x7F, 0x97, 0xF8, 0x8F, 0x72, 0x16, 0xF7, 0x21,
+  0x6F, 0x62, 0x26, 0xF5, 0x23, 0x7F, 0x42, 0x37, 0xF3, 0x25, 0x6F, 0x32,
+  0x56, 0xF2, 0x26, 0x6F, 0x12, 0x76, 0xF1, 0x27, 0x7E, 0x28, 0x7D, 0xF3,
+  0xDF, 0x3C, 0x2B, 0x6C, 0x2B, 0x6B, 0x2C, 0x79, 0x3C, 0x79, 0x2D, 0x78,
+  0x3D, 0x77, 0x3E, 0x77, 0x3E, 0x84, 0x6C, 0xA2, 0x98, 0xE0, 0x7F, 0x3F,
+  0x0F, 0x4D, 0x74, 0x8C, 0x75, 0x8B, 0x76, 0x89, 0x77, 0x89, 0x77, 0x89,
+  0x77, 0x89, 0x77, 0x88, 0x78, 0x79, 0x77, 0x89, 0x77, 0x7A, 0x67, 0x7A,
+  0x74, 0x7D, 0xF0, 0xF1, 0x74, 0x7C, 0x77, 0x7A, 0x78, 0x79, 0x78, 0x79,
+  0x78, 0x87, 0x79, 0x87, 0x79, 0x87, 0x79, 0x87, 0x69, 0x96, 0x79, 0x87,
+  0x78, 0x97, 0x78, 0x87, 0x78, 0x88, 0x85, 0x98, 0xF6, 0x8F, 0x5B, 0xF0,
+  0x85, 0x1C, 0xE1, 0x2A, 0x85, 0x69, 0x78, 0x57, 0x8A, 0x37, 0x8B, 0x36,
+  0x8D, 0x26, 0x7E, 0x25, 0x8E, 0x24, 0x8F, 0x01, 0x58, 0xF0, 0x14, 0x8F,
+  0x68, 0xF5, 0x9F, 0x58, 0xF6, 0x8F, 0x59, 0xF5, 0x9F, 0x58, 0xF6, 0x8F,
+  0x68, 0xF6, 0x8F, 0x68, 0xF6, 0x8F, 0x68, 0xF7, 0x7F, 0x78, 0xE2, 0x67,
+  0xD2, 0x78, 0xB3, 0x87, 0xA3, 0xB7, 0x63, 0xEE, 0xF3, 0x8C, 0x7F, 0x3F,
+  0x2F, 0x6F, 0x27, 0x67, 0xF0, 0x78, 0x6E, 0x78, 0x7C, 0x7A, 0x7B, 0x7B,
+  0x7A, 0x7B, 0x7A, 0x7B, 0x79, 0x7C, 0x88, 0x7C, 0x88, 0x7C, 0x88, 0x6D,
+  0x87, 0x7D, 0x87, 0x7D, 0x87, 0x7C, 0x96, 0x7D, 0x96, 0x7D, 0x87, 0x7D,
+  0x87, 0x7C, 0x96, 0x7D, 0x87, 0x7C, 0x97, 0x7C, 0x88, 0x6C, 0x88, 0x7C,
+  0x79, 0x7B, 0x7A, 0x7A, 0x7A, 0x79, 0x8B, 0x86, 0x8C, 0xF6, 0xCF, 0x4F,
+  0x10, 0x7F, 0xA9, 0xF8, 0xA8, 0x76, 0xB7, 0xA4, 0xB7, 0xB3, 0xA7, 0xD2,
+  0xA7, 0xD1, 0xB7, 0xD1, 0xB7, 0xF9, 0x78, 0x2F, 0x07, 0x81, 0xF1, 0x77,
+  0x2F, 0x16, 0x64, 0xF0, 0xF2, 0xF0, 0xF1, 0xF1, 0x74, 0x5F, 0x07, 0x64,
+  0xF0, 0x77, 0x2F, 0x17, 0x72, 0xF1, 0x77, 0x2F, 0x07, 0x81, 0xF1, 0x7F,
+  0x11, 0x87, 0xF0, 0x28, 0x6F, 0x02, 0x87, 0xF0, 0x28, 0x7E, 0x38, 0x7C,
+  0x48, 0x7B, 0x68, 0x87, 0x97, 0xFA, 0x5F, 0xB6, 0x7F, 0x99, 0xF7, 0xA8,
+  0x66, 0xB7, 0x94, 0xB7, 0xA3, 0xA7, 0xC2, 0xA7, 0xC1, 0xB7, 0xC1, 0xB7,
+  0xF8, 0x78, 0x2E, 0x78, 0x1F, 0x07, 0x72, 0xF0, 0x66, 0x4E, 0xF2, 0xEF,
+  0x1F, 0x07, 0x45, 0xE7, 0x64, 0xE7, 0x72, 0xF0, 0x77, 0x2F, 0x07, 0x72,
+  0xE7, 0x81, 0xF0, 0x78, 0x1F, 0x07, 0xF9, 0x6F, 0x97, 0xF9, 0x7F, 0x97,
+  0xF8, 0x8F, 0x88, 0xF7, 0x9F, 0x5E, 0xF2, 0xF1, 0x86, 0x1D, 0xF0, 0x13,
+  0xB8, 0x66, 0xB7, 0x95, 0x98, 0xB4, 0x88, 0xC3, 0x88, 0xE2, 0x87, 0xF0,
+  0x27, 0x8F, 0x01, 0x78, 0xF1, 0x17, 0x8F, 0x88, 0xF9, 0x8F, 0x89, 0xF8,
+  0x8F, 0x98, 0xF8, 0x9F, 0x89, 0xAF, 0x6D, 0x92, 0x8E, 0x73, 0x8E, 0x73,
+  0x8E, 0x64, 0x8E, 0x64, 0x8D, 0x75, 0x7D, 0x75, 0x7D, 0x66, 0x8C, 0x67,
+  0x7B, 0x78, 0x7A, 0x6A, 0x79, 0x6B, 0x76, 0x7E, 0xF1, 0xF4, 0x9D, 0x7F,
+  0x03, 0xE9, 0xA8, 0xAC, 0x7B, 0x8D, 0x7B, 0x7E, 0x7B, 0x7D, 0x7C, 0x7D,
+  0x7B, 0x7E, 0x7B, 0x7E, 0x7B, 0x7D, 0x7B, 0x7E, 0x7B, 0x7E, 0x7B, 0x7E,
+  0x6C, 0x7D, 0x7B, 0x7E, 0xFA, 0xEF, 0xAD, 0x7C, 0x7D, 0x7B, 0x7E, 0x7B,
+  0x7E, 0x7B, 0x7D, 0x7B, 0x7E, 0x7B, 0x7E, 0x7B, 0x7E, 0x6C, 0x7D, 0x7B,
+  0x7E, 0x7B, 0x7E, 0x7B, 0x7D, 0x8A, 0x8D, 0x8A, 0x8C, 0x99, 0x9A, 0xE3,
+  0xF0, 0x70, 0x7E, 0x99, 0xD7, 0xE7, 0xE7, 0xD7, 0xE7, 0xE7, 0xE6, 0xE7,
+  0xE7, 0xE7, 0xE6, 0xE7, 0xE7, 0xE7, 0xD7, 0xE7, 0xE7, 0xE6, 0xE7, 0xE7,
+  0xE7, 0xE6, 0xE7, 0xE7, 0xE7, 0xD8, 0xD7, 0xD9, 0xAE, 0x70, 0xDE, 0xF0,
+  0xAF, 0x38, 0xF4, 0x7F, 0x57, 0xF5, 0x7F, 0x47, 0xF5, 0x7F, 0x57, 0xF5,
+  0x7F, 0x47, 0xF5, 0x7F, 0x57, 0xF5, 0x7F, 0x47, 0xF5, 0x7F, 0x57, 0xF5,
+  0x6F, 0x57, 0xF5, 0x7F, 0x57, 0xF4, 0x7F, 0x57, 0xF5, 0x7F, 0x57, 0xF4,
+  0x7F, 0x57, 0xF5, 0x7B, 0x36, 0x6B, 0x54, 0x7B, 0x54, 0x7B, 0x54, 0x6C,
+  0x53, 0x6E, 0x42, 0x7F, 0x0A, 0xF4, 0x6F, 0x20, 0x7E, 0x3A, 0x9A, 0x76,
+  0xC7, 0xA3, 0xE7, 0x93, 0xF0, 0x78, 0x3F, 0x07, 0x83, 0xF1, 0x77, 0x3F,
+  0x27, 0x63, 0xF3, 0x75, 0x3F, 0x37, 0x53, 0xF4, 0x74, 0x3F, 0x57, 0x33,
+  0xF6, 0x63, 0x2F, 0x77, 0x15, 0xF6, 0xDF, 0x6E, 0xF4, 0x71, 0x7F, 0x47,
+  0x27, 0xF3, 0x72, 0x7F, 0x37, 0x37, 0xF1, 0x74, 0x7F, 0x17, 0x57, 0xF0,
+  0x75, 0x7F, 0x06, 0x77, 0xD7, 0x77, 0xD7, 0x77, 0xD7, 0x87, 0xB7, 0x97,
+  0xB8, 0x97, 0x99, 0x89, 0x6E, 0x3D, 0x40, 0x7E, 0xF2, 0xAF, 0x57, 0xF7,
+  0x7F, 0x77, 0xF6, 0x7F, 0x77, 0xF7, 0x7F, 0x76, 0xF7, 0x7F, 0x77, 0xF7,
+  0x7F, 0x76, 0xF7, 0x7F, 0x77, 0xF7, 0x7F, 0x67, 0xF7, 0x7F, 0x77, 0xF7,
+  0x6F, 0x77, 0xF7, 0x7F, 0x11, 0x57, 0xF0, 0x25, 0x6F, 0x02, 0x57, 0xF0,
+  0x25, 0x7E, 0x35, 0x7C, 0x54, 0x7B, 0x65, 0x87, 0x94, 0xFA, 0x2F, 0xB3,
+  0x7B, 0xF1, 0xAA, 0x8F, 0x18, 0xC8, 0xF0, 0x8D, 0x8E, 0x9D, 0x8E, 0x9D,
+  0x8D, 0x9D, 0x21, 0x6C, 0xAD, 0x21, 0x6C, 0x21, 0x7D, 0x21, 0x7A, 0x22,
+  0x6E, 0x12, 0x79, 0x31, 0x7D, 0x22, 0x79, 0x22, 0x7D, 0x22, 0x78, 0x23,
+  0x7D, 0x22, 0x77, 0x33, 0x6D, 0x24, 0x67, 0x23, 0x7D, 0x24, 0x66, 0x24,
+  0x7D, 0x24, 0x65, 0x34, 0x7D, 0x24, 0x65, 0x24, 0x7D, 0x25, 0x73, 0x25,
+  0x7D, 0x25, 0x72, 0x35, 0x7D, 0x25, 0x72, 0x26, 0x6D, 0x26, 0x71, 0x35,
+  0x7D, 0x27, 0x96, 0x7D, 0x27, 0x87, 0x7C, 0x37, 0x87, 0x6D, 0x28, 0x77,
+  0x7D, 0x28, 0x68, 0x7D, 0x28, 0x68, 0x7C, 0x38, 0x58, 0x7D, 0x38, 0x49,
+  0x7B, 0x67, 0x48, 0x99, 0xA5, 0x26, 0xF0, 0xF6, 0x1F, 0xD0, 0x6A, 0xBA,
+  0x97, 0xD6, 0xC7, 0xD4, 0xD7, 0xD3, 0xE8, 0xC3, 0xE8, 0xC2, 0xE2, 0x17,
+  0xB2, 0xE2, 0x17, 0xB2, 0xE2, 0x27, 0x93, 0xE1, 0x37, 0x92, 0xE2, 0x47,
+  0x82, 0xE2, 0x47, 0x82, 0xE2, 0x57, 0x62, 0xE2, 0x67, 0x62, 0xE2, 0x68,
+  0x52, 0xE2, 0x77, 0x52, 0xE2, 0x78, 0x32, 0xE2, 0x97, 0x32, 0xE2, 0x97,
+  0x32, 0xE2, 0xA7, 0x12, 0xE2, 0xB7, 0x12, 0xE2, 0xC9, 0xE2, 0xC9, 0xD3,
+  0xD7, 0xE2, 0xE7, 0xE2, 0xF0, 0x6E, 0x2F, 0x05, 0xE3, 0xF1, 0x4E, 0x3F,
+  0x14, 0xC6, 0xF0, 0x4B, 0xAD, 0x2F, 0xF5, 0x2C, 0xF1, 0x7F, 0x6D, 0xF1,
+  0x64, 0x6E, 0x58, 0x5B, 0x69, 0x69, 0x6B, 0x67, 0x7B, 0x66, 0x7C, 0x66,
+  0x7C, 0x74, 0x7D, 0x73, 0x8D, 0x73, 0x7E, 0x72, 0x8D, 0x82, 0x7E, 0x81,
+  0x8E, 0x81, 0x8E, 0x72, 0x8D, 0x82, 0x7E, 0x81, 0x8E, 0x81, 0x8D, 0x82,
+  0x8D, 0x82, 0x7E, 0x73, 0x7D, 0x83, 0x7D, 0x74, 0x7C, 0x76, 0x6C, 0x76,
+  0x6B, 0x77, 0x6A, 0x79, 0x69, 0x6B, 0x58, 0x5E, 0x55, 0x6F, 0x1D, 0xF5,
+  0x8F, 0x10, 0x7F, 0x3F, 0x0F, 0x4D, 0x74, 0x8C, 0x75, 0x8B, 0x67, 0x7A,
+  0x77, 0x89, 0x77, 0x89, 0x77, 0x89, 0x68, 0x88, 0x78, 0x88, 0x77, 0x98,
+  0x77, 0x89, 0x67, 0x89, 0x76, 0x8A, 0x75, 0x8B, 0xF3, 0xCF, 0x1F, 0x07,
+  0xF9, 0x7F, 0x96, 0xF9, 0x7F, 0x97, 0xF9, 0x7F, 0x96, 0xF9, 0x7F, 0x97,
+  0xF9, 0x7F, 0x87, 0xF9, 0x7F, 0x89, 0xF5, 0xEF, 0x20, 0xF1, 0x7F, 0x6C,
+  0xF2, 0x64, 0x6E, 0x58, 0x5B, 0x69, 0x69, 0x7A, 0x67, 0x7B, 0x66, 0x7C,
+  0x66, 0x7C, 0x74, 0x7D, 0x73, 0x8D, 0x73, 0x7E, 0x72, 0x8D, 0x82, 0x8D,
+  0x81, 0x8E, 0x81, 0x8E, 0x81, 0x8E, 0x72, 0x7E, 0x81, 0x8E, 0x81, 0x8E,
+  0x72, 0x8D, 0x82, 0x7E, 0x73, 0x7E, 0x73, 0x7D, 0x74, 0x7D, 0x74, 0x7C,
+  0x76, 0x6C, 0x67, 0x6B, 0x69, 0x5A, 0x6A, 0x68, 0x6D, 0x56, 0x6F, 0x06,
+  0x26, 0xF4, 0x9F, 0x82, 0xFD, 0x2F, 0xD3, 0xF3, 0x27, 0xAB, 0x26, 0xF0,
+  0x63, 0x6F, 0x96, 0xF9, 0x63, 0x7E, 0xF5, 0x8A, 0x7F, 0x4F, 0x0F, 0x5D,
+  0x84, 0x8C, 0x76, 0x8B, 0x77, 0x89, 0x87, 0x89, 0x78, 0x89, 0x78, 0x89,
+  0x78, 0x88, 0x87, 0x89, 0x78, 0x89, 0x77, 0x8A, 0x76, 0x8A, 0x75, 0x9B,
+  0xF4, 0xDF, 0x1F, 0x08, 0x18, 0xF0, 0x73, 0x8E, 0x73, 0x8E, 0x73, 0x8D,
+  0x84, 0x8C, 0x75, 0x8C, 0x76, 0x7C, 0x76, 0x8A, 0x77, 0x8A, 0x78, 0x7A,
+  0x78, 0x88, 0x88, 0x88, 0x89, 0x86, 0xA8, 0x93, 0xE6, 0xB1, 0xB6, 0x52,
+  0x9B, 0x13, 0x85, 0x46, 0x84, 0x84, 0x74, 0xA3, 0x74, 0xA3, 0x65, 0xA3,
+  0x65, 0xB1, 0x75, 0xB1, 0x76, 0xA1, 0x77, 0xF2, 0x8F, 0x28, 0xF1, 0xAF,
+  0x0A, 0xF0, 0xAF, 0x0A, 0xF0, 0x9F, 0x19, 0xF1, 0x8F, 0x28, 0xF2, 0x7F,
+  0x36, 0x51, 0xD5, 0x51, 0xD5, 0x51, 0xD5, 0x43, 0xC5, 0x43, 0xC4, 0x54,
+  0xA5, 0x54, 0x95, 0x66, 0x65, 0x71, 0x3C, 0x72, 0x66, 0xA0, 0x2F, 0xA2,
+  0xFA, 0x27, 0x37, 0x35, 0x24, 0x67, 0x44, 0x23, 0x67, 0x63, 0x22, 0x77,
+  0x62, 0x22, 0x87, 0x71, 0x22, 0x86, 0x81, 0xB7, 0x81, 0xB7, 0xF5, 0x7F,
+  0x47, 0xF5, 0x7F, 0x57, 0xF5, 0x6F, 0x57, 0xF5, 0x7F, 0x57, 0xF5, 0x6F,
+  0x57, 0xF5, 0x7F, 0x57, 0xF4, 0x7F, 0x57, 0xF5, 0x7F, 0x56, 0xF5, 0x7F,
+  0x57, 0xF4, 0x8F, 0x3A, 0xEF, 0x1B, 0x1F, 0x06, 0xA4, 0xAA, 0x67, 0x7E,
+  0x38, 0x7E, 0x38, 0x7E, 0x28, 0x7F, 0x02, 0x87, 0xE3, 0x87, 0xE2, 0x97,
+  0xE2, 0x87, 0xE3, 0x87, 0xE2, 0x97, 0xE2, 0x87, 0xF0, 0x28, 0x7E, 0x29,
+  0x7E, 0x29, 0x7E, 0x28, 0x7F, 0x02, 0x87, 0xE2, 0x97, 0xE2, 0x96, 0xF0,
+  0x28, 0x7E, 0x29, 0x7E, 0x29, 0x6F, 0x02, 0x96, 0xE3, 0x96, 0xE2, 0xA6,
+  0xD3, 0xA6, 0xD2, 0xC6, 0xB3, 0xC6, 0xA3, 0xE7, 0x64, 0xF2, 0xDF, 0x69,
+  0xF2, 0x0E, 0x89, 0x2A, 0xC6, 0x48, 0xE3, 0x68, 0xE3, 0x77, 0xD3, 0x87,
+  0xD2, 0x97, 0xC3, 0x97, 0xC2, 0xA8, 0xA3, 0xA8, 0x93, 0xC7, 0x92, 0xD7,
+  0x83, 0xD7, 0x82, 0xE7, 0x72, 0xF0, 0x76, 0x3F, 0x07, 0x62, 0xF1, 0x84,
+  0x2F, 0x37, 0x33, 0xF3, 0x73, 0x2F, 0x47, 0x22, 0xF5, 0x71, 0x3F, 0x57,
+  0x12, 0xF6, 0xAF, 0x78, 0xF8, 0x7F, 0x97, 0xF9, 0x6F, 0xA5, 0xFB, 0x5F,
+  0xB4, 0xFD, 0x2F, 0xE2, 0xF6, 0x0D, 0x3C, 0x49, 0x2A, 0x68, 0x95, 0x48,
+  0x86, 0xA3, 0x67, 0x96, 0xA3, 0x77, 0x86, 0xA2, 0x87, 0x86, 0xA2, 0x87,
+  0x87, 0x82, 0x97, 0x78, 0x82, 0x97, 0x78, 0x72, 0xA7, 0x62, 0x16, 0x72,
+  0xA7, 0x62, 0x16, 0x62, 0xC6, 0x52, 0x26, 0x62, 0xC6, 0x52, 0x27, 0x42,
+  0xD7, 0x41, 0x37, 0x42, 0xD7, 0x32, 0x37, 0x32, 0xE7, 0x31, 0x47, 0x32,
+  0xE7, 0x22, 0x56, 0x22, 0xF0, 0x72, 0x25, 0x62, 0x2F, 0x07, 0x12, 0x66,
+  0x12, 0xF2, 0x61, 0x26, 0x61, 0x2F, 0x28, 0x78, 0xF3, 0x87, 0x8F, 0x37,
+  0x87, 0xF4, 0x78, 0x7F, 0x46, 0x96, 0xF5, 0x6A, 0x5F, 0x64, 0xB4, 0xF7,
+  0x4B, 0x4F, 0x73, 0xC3, 0xF8, 0x3C, 0x3F, 0x82, 0xD2, 0xF9, 0x2D, 0x2F,
+  0x20, 0x6E, 0x4A, 0x89, 0x96, 0xC7, 0xA4, 0xD7, 0x93, 0xF0, 0x78, 0x3F,
+  0x26, 0x82, 0xF3, 0x76, 0x2F, 0x47, 0x52, 0xF6, 0x64, 0x2F, 0x77, 0x22,
+  0xF8, 0x71, 0x2F, 0xA8, 0xFB, 0x8F, 0xB7, 0xFC, 0x7F, 0xD6, 0xFD, 0x7F,
+  0xB8, 0xFA, 0x9F, 0x93, 0x17, 0xF7, 0x32, 0x7F, 0x63, 0x46, 0xF6, 0x25,
+  0x7F, 0x42, 0x67, 0xF3, 0x28, 0x6F, 0x23, 0x87, 0xF0, 0x39, 0x7E, 0x3A,
+  0x7D, 0x4A, 0x8A, 0x79, 0x98, 0xA4, 0xF0, 0x50, 0x0D, 0x5A, 0x28, 0xA6,
+  0x57, 0xB4, 0x67, 0xB3, 0x86, 0xA3, 0x97, 0x92, 0xA7, 0x83, 0xB6, 0x73,
+  0xC7, 0x62, 0xD7, 0x52, 0xF0, 0x64, 0x3F, 0x07, 0x32, 0xF1, 0x72, 0x2F,
+  0x36, 0x12, 0xF4, 0x9F, 0x48, 0xF6, 0x6F, 0x67, 0xF6, 0x7F, 0x66, 0xF6,
+  0x7F, 0x67, 0xF6, 0x7F, 0x66, 0xF6, 0x7F, 0x67, 0xF6, 0x7F, 0x57, 0xF6,
+  0x8F, 0x49, 0xF1, 0xF0, 0xD0, 0x6F, 0x76, 0xF7, 0x67, 0x78, 0x55, 0x98,
+  0x64, 0x98, 0x73, 0xA7, 0x82, 0xA8, 0x72, 0xA8, 0x81, 0xA8, 0xF5, 0x7F,
+  0x58, 0xF4, 0x8F, 0x48, 0xF5, 0x7F, 0x58, 0xF4, 0x8F, 0x48, 0xF5, 0x8F,
+  0x48, 0xF4, 0x8F, 0x48, 0xF5, 0x8F, 0x48, 0xB2, 0x68, 0xC2, 0x58, 0xC2,
+  0x68, 0xB3, 0x58, 0xB4, 0x48, 0xA5, 0x48, 0x88, 0x4F, 0x94, 0xF9, 0x40,
+  0x9A, 0x9A, 0x95, 0xE4, 0xE5, 0xE5, 0xE5, 0xE4, 0xF0, 0x4E, 0x5E, 0x5E,
+  0x4F, 0x04, 0xE5, 0xE5, 0xE4, 0xF0, 0x4E, 0x5E, 0x5E, 0x4F, 0x04, 0xE5,
+  0xE5, 0xE4, 0xF0, 0x4E, 0x5E, 0x5E, 0x4F, 0x04, 0xE5, 0xE5, 0xE4, 0xF0,
+  0x4E, 0x5E, 0x5E, 0x5E, 0xA8, 0xB8, 0x04, 0x94, 0xA4, 0x94, 0x94, 0xA3,
+  0xA4, 0x94, 0x94, 0xA4, 0x94, 0x94, 0x94, 0xA4, 0x94, 0x94, 0xA3, 0xA4,
+  0x94, 0x94, 0xA4, 0x94, 0x94, 0x94, 0xA4, 0x94, 0x94, 0xA3, 0xA4, 0x94,
+  0x94, 0xA4, 0x94, 0x9A, 0x9A, 0xE5, 0xE4, 0xE5, 0xE5, 0xE5, 0xE4, 0xE5,
+  0xE5, 0xE5, 0xE4, 0xE5, 0xE5, 0xE5, 0xE4, 0xE5, 0xE5, 0xE5, 0xE4, 0xE5,
+  0xE5, 0xE5, 0xE4, 0xE5, 0xE5, 0xE5, 0xE4, 0xE5, 0xE5, 0xE5, 0xE4, 0xF0,
+  0x4E, 0x5E, 0x5E, 0x4A, 0x99, 0xA9, 0x85, 0xF1, 0x5F, 0x07, 0xE7, 0xD8,
+  0xD4, 0x14, 0xB4, 0x24, 0xB4, 0x34, 0x94, 0x44, 0x94, 0x54, 0x75, 0x54,
+  0x74, 0x74, 0x55, 0x74, 0x54, 0x94, 0x35, 0x94, 0x34, 0xB4, 0x15, 0xB4,
+  0x10, 0x0F, 0xFF, 0xFC, 0x13, 0x65, 0x55, 0x56, 0x65, 0x64, 0x74, 0x83,
+  0x83, 0xA4, 0x62, 0x87, 0x25, 0x75, 0x27, 0x75, 0x46, 0x65, 0x56, 0x56,
+  0x55, 0x65, 0x65, 0x56, 0x65, 0x46, 0x75, 0x46, 0x65, 0x46, 0x75, 0x46,
+  0x75, 0x46, 0x74, 0x47, 0x65, 0x46, 0x75, 0x46, 0x66, 0x46, 0x65, 0x56,
+  0x56, 0x38, 0x41, 0x15, 0x31, 0x17, 0x22, 0x15, 0x21, 0x39, 0x27, 0x57,
+  0x36, 0x74, 0x64, 0x50, 0x95, 0xCA, 0xF0, 0x6F, 0x16, 0xF1, 0x6F, 0x16,
+  0xF1, 0x5F, 0x25, 0xF1, 0x6F, 0x15, 0xF2, 0x53, 0x58, 0x62, 0x77, 0x61,
+  0x96, 0x51, 0x13, 0x75, 0x65, 0x64, 0x75, 0x64, 0x66, 0x64, 0x66, 0x63,
+  0x67, 0x63, 0x67, 0x63, 0x57, 0x64, 0x57, 0x63, 0x67, 0x63, 0x66, 0x64,
+  0x57, 0x63, 0x67, 0x54, 0x66, 0x55, 0x56, 0x55, 0x66, 0x46, 0x65, 0x47,
+  0x63, 0x59, 0xCD, 0x6C, 0xA6, 0xA9, 0x84, 0x34, 0x64, 0x44, 0x54, 0x45,
+  0x45, 0x45, 0x35, 0x63, 0x36, 0xC5, 0xC6, 0xC6, 0xC6, 0xB6, 0xC6, 0xC6,
+  0xC6, 0xC6, 0x82, 0x26, 0x82, 0x27, 0x62, 0x47, 0x33, 0x6B, 0x89, 0xA6,
+  0x80, 0xF9, 0x1F, 0x46, 0xF0, 0xAF, 0x37, 0xF3, 0x6F, 0x46, 0xF4, 0x6F,
+  0x45, 0xF4, 0x6F, 0x46, 0xF4, 0x6C, 0x42, 0x6B, 0xEA, 0x52, 0x89, 0x54,
+  0x78, 0x55, 0x68, 0x65, 0x68, 0x56, 0x67, 0x66, 0x57, 0x66, 0x67, 0x66,
+  0x66, 0x67, 0x66, 0x67, 0x57, 0x66, 0x66, 0x76, 0x66, 0x66, 0x67, 0x66,
+  0x67, 0x65, 0x77, 0x65, 0x63, 0x23, 0x64, 0x72, 0x24, 0x72, 0x21, 0x51,
+  0x26, 0x92, 0x77, 0x83, 0x6A, 0x55, 0x48, 0xA6, 0xA9, 0x84, 0x34, 0x64,
+  0x44, 0x54, 0x54, 0x45, 0x54, 0x35, 0x64, 0x26, 0x54, 0x36, 0x45, 0x26,
+  0x54, 0x36, 0x35, 0x46, 0x15, 0x5B, 0x78, 0xA6, 0xC6, 0xC6, 0x82, 0x26,
+  0x72, 0x36, 0x62, 0x56, 0x43, 0x5C, 0x89, 0xA6, 0x80, 0xF5, 0x6F, 0x54,
+  0x23, 0xF3, 0x43, 0x4F, 0x15, 0x34, 0xF1, 0x44, 0x4F, 0x05, 0x52, 0xF1,
+  0x5F, 0x75, 0xF8, 0x5F, 0x85, 0xF7, 0x6F, 0x4C, 0xF1, 0xCF, 0x36, 0xF7,
+  0x6F, 0x75, 0xF8, 0x5F, 0x76, 0xF7, 0x6F, 0x76, 0xF7, 0x5F, 0x76, 0xF7,
+  0x6F, 0x76, 0xF7, 0x5F, 0x85, 0xF7, 0x6F, 0x76, 0xF7, 0x5F, 0x85, 0xF7,
+  0x6F, 0x75, 0xF8, 0x5F, 0x85, 0xF7, 0x5F, 0x22, 0x45, 0xF1, 0x43, 0x4F,
+  0x24, 0x25, 0xF2, 0x42, 0x4F, 0x48, 0xF6, 0x5F, 0x60, 0xB6, 0xF1, 0xBD,
+  0x63, 0x96, 0x56, 0x85, 0x66, 0x57, 0x67, 0x57, 0x67, 0x57, 0x57, 0x67,
+  0x57, 0x67, 0x56, 0x69, 0x45, 0x6B, 0x43, 0x6D, 0xBE, 0x8F, 0x03, 0xF6,
+  0x4F, 0x56, 0xF4, 0x9F, 0x1C, 0xEE, 0xCE, 0xA3, 0x1C, 0x74, 0x59, 0x64,
+  0x96, 0x54, 0xB5, 0x54, 0xB5, 0x54, 0xB4, 0x65, 0x95, 0x75, 0x74, 0xAE,
+  0xE8, 0xC0, 0xD1, 0xF2, 0x6E, 0x9F, 0x26, 0xF2, 0x5F, 0x35, 0xF2, 0x6F,
+  0x26, 0xF2, 0x5F, 0x35, 0xF2, 0x6F, 0x26, 0x45, 0x85, 0x47, 0x66, 0x38,
+  0x66, 0x22, 0x25, 0x65, 0x22, 0x35, 0x65, 0x12, 0x45, 0x56, 0x11, 0x55,
+  0x57, 0x56, 0x57, 0x56, 0x56, 0x66, 0x47, 0x56, 0x56, 0x66, 0x56, 0x66,
+  0x46, 0x66, 0x56, 0x66, 0x56, 0x66, 0x55, 0x66, 0x31, 0x16, 0x66, 0x22,
+  0x16, 0x65, 0x22, 0x25, 0x75, 0x12, 0x35, 0x77, 0x36, 0x77, 0x33, 0xB4,
+  0x50, 0x74, 0x76, 0x66, 0x66, 0x66, 0x74, 0xFF, 0xFB, 0x33, 0x95, 0x76,
+  0x57, 0x56, 0x66, 0x66, 0x57, 0x56, 0x66, 0x57, 0x57, 0x56, 0x66, 0x57,
+  0x56, 0x64, 0x11, 0x54, 0x12, 0x53, 0x22, 0x52, 0x23, 0x84, 0x76, 0x47,
+  0xF2, 0x4F, 0x26, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x24, 0xFF, 0xFF, 0xFF,
+  0xF3, 0x1F, 0x16, 0xD9, 0xF0, 0x7F, 0x15, 0xF1, 0x6F, 0x16, 0xF1, 0x6F,
+  0x15, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x15, 0xF1, 0x6F, 0x16, 0xF1, 0x6F,
+  0x15, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x15, 0xF1, 0x6F, 0x16, 0xF1, 0x5F,
+  0x25, 0xF1, 0x69, 0x25, 0x59, 0x44, 0x4A, 0x43, 0x5A, 0x42, 0x5C, 0x9E,
+  0x6E, 0xD2, 0xF2, 0x6F, 0x09, 0xF3, 0x6F, 0x35, 0xF4, 0x5F, 0x36, 0xF3,
+  0x6F, 0x35, 0xF4, 0x5F, 0x36, 0xF3, 0x6F, 0x35, 0x3A, 0x65, 0x56, 0x76,
+  0x54, 0x96, 0x53, 0xA5, 0x53, 0xA6, 0x43, 0xB6, 0x33, 0xC5, 0x33, 0xD5,
+  0x15, 0xCC, 0xCC, 0xCC, 0xC5, 0x25, 0xB6, 0x26, 0xA6, 0x35, 0xA5, 0x45,
+  0x96, 0x45, 0x51, 0x36, 0x46, 0x32, 0x36, 0x55, 0x22, 0x45, 0x68, 0x46,
+  0x76, 0x53, 0xB4, 0x60, 0xC1, 0x76, 0x3A, 0x67, 0x66, 0x76, 0x76, 0x75,
+  0x76, 0x76, 0x76, 0x75, 0x85, 0x76, 0x75, 0x85, 0x76, 0x76, 0x75, 0x85,
+  0x76, 0x76, 0x75, 0x76, 0x76, 0x75, 0x85, 0x85, 0x31, 0x35, 0x32, 0x35,
+  0x31, 0x45, 0x21, 0x58, 0x57, 0x74, 0x80, 0x93, 0x54, 0x75, 0x59, 0x37,
+  0x48, 0x67, 0x28, 0x39, 0x66, 0x31, 0x25, 0x23, 0x25, 0x66, 0x21, 0x35,
+  0x12, 0x45, 0x66, 0x11, 0x45, 0x12, 0x36, 0x65, 0x11, 0x45, 0x12, 0x46,
+  0x65, 0x11, 0x47, 0x55, 0x67, 0x57, 0x46, 0x65, 0x11, 0x56, 0x56, 0x66,
+  0x56, 0x65, 0x76, 0x56, 0x56, 0x66, 0x66, 0x56, 0x66, 0x56, 0x65, 0x76,
+  0x56, 0x65, 0x75, 0x65, 0x66, 0x66, 0x56, 0x66, 0x66, 0x56, 0x65, 0x31,
+  0x35, 0x66, 0x65, 0x22, 0x26, 0x65, 0x75, 0x21, 0x36, 0x56, 0x77, 0x46,
+  0x56, 0x77, 0x42, 0xF8, 0x45, 0x93, 0x45, 0x49, 0x47, 0x66, 0x38, 0x66,
+  0x22, 0x25, 0x65, 0x21, 0x45, 0x56, 0x21, 0x45, 0x56, 0x11, 0x55, 0x55,
+  0x11, 0x65, 0x57, 0x56, 0x47, 0x66, 0x47, 0x65, 0x56, 0x66, 0x56, 0x66,
+  0x46, 0x75, 0x56, 0x66, 0x56, 0x65, 0x65, 0x75, 0x56, 0x66, 0x21, 0x26,
+  0x65, 0x22, 0x25, 0x75, 0x21, 0x35, 0x77, 0x36, 0x77, 0x33, 0xB4, 0x50,
+  0xA6, 0xC3, 0x33, 0x94, 0x53, 0x74, 0x64, 0x55, 0x65, 0x44, 0x75, 0x35,
+  0x75, 0x25, 0x85, 0x25, 0x76, 0x15, 0x86, 0x15, 0x86, 0x15, 0x85, 0x16,
+  0x85, 0x16, 0x76, 0x15, 0x85, 0x25, 0x85, 0x25, 0x75, 0x35, 0x75, 0x35,
+  0x65, 0x54, 0x64, 0x64, 0x54, 0x84, 0x33, 0xC6, 0xA0, 0xC4, 0x35, 0xA9,
+  0x28, 0xA6, 0x29, 0xB5, 0x11, 0x37, 0x97, 0x56, 0x97, 0x56, 0x96, 0x66,
+  0x96, 0x66, 0x86, 0x76, 0x86, 0x67, 0x85, 0x76, 0x95, 0x76, 0x86, 0x67,
+  0x86, 0x66, 0x95, 0x76, 0x95, 0x66, 0x96, 0x65, 0xA6, 0x56, 0xA5, 0x65,
+  0xB5, 0x55, 0xB7, 0x35, 0xCE, 0xD5, 0x25, 0xF0, 0x5F, 0x66, 0xF6, 0x6F,
+  0x65, 0xF6, 0x6F, 0x66, 0xF5, 0x7F, 0x3C, 0xF0, 0xA5, 0xF0, 0x72, 0x57,
+  0x53, 0x76, 0x54, 0x66, 0x55, 0x65, 0x65, 0x65, 0x56, 0x64, 0x66, 0x54,
+  0x67, 0x54, 0x66, 0x63, 0x67, 0x54, 0x67, 0x54, 0x66, 0x63, 0x67, 0x63,
+  0x67, 0x54, 0x66, 0x64, 0x66, 0x64, 0x65, 0x65, 0x64, 0x75, 0x72, 0x21,
+  0x56, 0x91, 0x57, 0x82, 0x59, 0x53, 0x5F, 0x16, 0xF1, 0x5F, 0x25, 0xF1,
+  0x6F, 0x16, 0xF1, 0x5F, 0x17, 0xCC, 0x50, 0x93, 0x34, 0x49, 0x25, 0x66,
+  0x27, 0x56, 0x18, 0x56, 0x11, 0x24, 0x65, 0x11, 0x43, 0x65, 0x11, 0xC7,
+  0xD7, 0xD6, 0xE6, 0xD7, 0xD6, 0xE6, 0xE5, 0xE6, 0xE6, 0xE6, 0xD6, 0xE6,
+  0xE6, 0xE5, 0xE0, 0x75, 0x31, 0x5B, 0x44, 0x44, 0x43, 0x63, 0x34, 0x62,
+  0x44, 0x62, 0x45, 0x61, 0x45, 0x61, 0x46, 0xB6, 0xA7, 0x98, 0x98, 0x97,
+  0xA7, 0xA6, 0x31, 0x75, 0x31, 0x75, 0x32, 0x74, 0x23, 0x73, 0x34, 0x63,
+  0x35, 0x34, 0x42, 0x17, 0x60, 0xA1, 0xB2, 0xA3, 0x93, 0x94, 0x85, 0x67,
+  0x5B, 0x2B, 0x45, 0x76, 0x76, 0x75, 0x85, 0x76, 0x75, 0x85, 0x76, 0x76,
+  0x75, 0x85, 0x76, 0x76, 0x31, 0x35, 0x41, 0x35, 0x31, 0x45, 0x21, 0x58,
+  0x57, 0x74, 0x80, 0x91, 0xF2, 0x56, 0x61, 0x87, 0x54, 0x67, 0x54, 0x66,
+  0x64, 0x66, 0x55, 0x57, 0x55, 0x56, 0x64, 0x66, 0x55, 0x57, 0x55, 0x56,
+  0x65, 0x56, 0x64, 0x65, 0x65, 0x56, 0x65, 0x55, 0x75, 0x55, 0x65, 0x55,
+  0x11, 0x55, 0x54, 0x12, 0x43, 0x21, 0x53, 0x21, 0x53, 0x12, 0x52, 0x22,
+  0x52, 0x13, 0x83, 0x83, 0x74, 0x75, 0x56, 0x46, 0x52, 0x63, 0x35, 0x54,
+  0x17, 0x55, 0x25, 0x55, 0x25, 0x55, 0x26, 0x54, 0x35, 0x62, 0x45, 0x62,
+  0x45, 0x62, 0x45, 0x52, 0x55, 0x52, 0x55, 0x42, 0x65, 0x32, 0x75, 0x22,
+  0x85, 0x22, 0x85, 0x12, 0x97, 0xA6, 0xB5, 0xC4, 0xD3, 0xE2, 0xF0, 0x1D,
+  0x52, 0x82, 0x63, 0x35, 0x82, 0x5C, 0x73, 0x55, 0x25, 0x73, 0x55, 0x25,
+  0x64, 0x55, 0x25, 0x55, 0x64, 0x26, 0x45, 0x72, 0x45, 0x36, 0x72, 0x45,
+  0x37, 0x61, 0x55, 0x28, 0x52, 0x55, 0x28, 0x51, 0x65, 0x12, 0x16, 0x42,
+  0x65, 0x12, 0x16, 0x32, 0x77, 0x35, 0x22, 0x86, 0x45, 0x22, 0x86, 0x45,
+  0x12, 0x95, 0x57, 0xA5, 0x56, 0xB4, 0x66, 0xB4, 0x65, 0xC3, 0x74, 0xD2,
+  0x83, 0xE2, 0x82, 0xC0, 0x84, 0x74, 0x58, 0x65, 0x86, 0x47, 0x76, 0x38,
+  0x85, 0x22, 0x33, 0x95, 0x12, 0xF1, 0x8F, 0x17, 0xF3, 0x5F, 0x45, 0xF4,
+  0x5F, 0x46, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x27, 0xF1, 0x21, 0x6F, 0x02,
+  0x16, 0x41, 0x43, 0x22, 0x35, 0x32, 0x38, 0x35, 0x22, 0x47, 0x48, 0x56,
+  0x66, 0x74, 0x84, 0x70, 0xA2, 0x73, 0x68, 0x55, 0x76, 0x55, 0x76, 0x55,
+  0x86, 0x54, 0x86, 0x63, 0x86, 0x62, 0xA5, 0x62, 0xA6, 0x51, 0xB6, 0x42,
+  0xB6, 0x42, 0xC5, 0x32, 0xD5, 0x32, 0xD5, 0x22, 0xE6, 0x12, 0xE8, 0xF1,
+  0x7F, 0x16, 0xF2, 0x6F, 0x25, 0xF3, 0x4F, 0x44, 0xF4, 0x3F, 0x52, 0xF6,
+  0x2F, 0x52, 0xC3, 0x52, 0xC6, 0x22, 0xD9, 0xE7, 0xF2, 0x4F, 0x30, 0x5E,
+  0x4E, 0x5E, 0x5D, 0x61, 0x83, 0x62, 0x73, 0x71, 0x73, 0xF1, 0x2F, 0x13,
+  0xF0, 0x3F, 0x03, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x13, 0xF1, 0x2F, 0x12,
+  0xF1, 0x5D, 0x7C, 0x85, 0x23, 0x94, 0x41, 0x32, 0x63, 0x42, 0x14, 0x53,
+  0x49, 0x42, 0x3C, 0x54, 0xF0, 0x5C, 0x6D, 0x5E, 0x5E, 0x5F, 0x05, 0xF0,
+  0x4F, 0x05, 0xF0, 0x5F, 0x05, 0xE5, 0xF0, 0x5F, 0x05, 0xF0, 0x5E, 0x5F,
+  0x05, 0xF0, 0x4F, 0x04, 0xE4, 0xD6, 0xF2, 0x5F, 0x15, 0xF0, 0x5F, 0x05,
+  0xF0, 0x5E, 0x5F, 0x05, 0xF0, 0x5F, 0x05, 0xE5, 0xF0, 0x5F, 0x05, 0xF0,
+  0x5E, 0x5F, 0x05, 0xF0, 0x5F, 0x05, 0xF0, 0x5F, 0x06, 0xF0, 0x6F, 0x25,
+  0xA0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0xA5, 0xF2, 0x6F, 0x15, 0xF0, 0x5F,
+  0x05, 0xF0, 0x5F, 0x05, 0xE5, 0xF0, 0x5F, 0x05, 0xF0, 0x5E, 0x5F, 0x05,
+  0xF0, 0x5F, 0x05, 0xE5, 0xF0, 0x5F, 0x05, 0xF0, 0x5F, 0x15, 0xF2, 0x5E,
+  0x4E, 0x4F, 0x05, 0xE5, 0xF0, 0x5E, 0x5F, 0x05, 0xF0, 0x5F, 0x05, 0xE5,
+  0xF0, 0x5F, 0x05, 0xF0, 0x5E, 0x5F, 0x05, 0xE5, 0xF0, 0x5E, 0x5D, 0x6C,
+  0x5F, 0x00, 0x35, 0xEA, 0x71, 0x2D, 0x43, 0x1F, 0x95, 0xCB, 0x9F, 0x05,
+  0x30 };
+
+const GFXglyph FreeSerifBoldItalic24pt7bPackedGlyphs[] PROGMEM = {
+  {     0,   0,   0,  12,    0,    1 },   // 0x20 ' '
+  {     0,  15,  33,  18,    3,  -31 },   // 0x21 '!'
+  {    32,  19,  13,  26,    6,  -31 },   // 0x22 '"'
+  {    59,  27,  33,  23,   -2,  -32 },   // 0x23 '#'
+  {   123,  24,  39,  24,   -1,  -33 },   // 0x24 '$'
+  {   206,  35,  32,  39,    2,  -30 },   // 0x25 '%'
+  {   302,  33,  33,  37,    0,  -31 },   // 0x26 '&'
+  {   381,   7,  13,  13,    6,  -31 },   // 0x27 '''
+  {   395,  14,  41,  16,    1,  -31 },   // 0x28 '('
+  {   436,  14,  41,  16,   -2,  -31 },   // 0x29 ')'
+  {   478,  19,  20,  23,    3,  -31 },   // 0x2A '*'
+  {   516,  22,  23,  27,    2,  -22 },   // 0x2B '+'
+  {   548,  10,  15,  12,   -3,   -5 },   // 0x2C ','
+  {   564,  12,   5,  16,    0,  -12 },   // 0x2D '-'
+  {   570,   8,   7,  12,    0,   -5 },   // 0x2E '.'
+  {   576,  19,  33,  16,    0,  -31 },   // 0x2F '/'
+  {   617,  22,  33,  23,    1,  -31 },   // 0x30 '0'
+  {   682,  20,  32,  23,    0,  -31 },   // 0x31 '1'
+  {   716,  22,  32,  23,    1,  -31 },   // 0x32 '2'
+  {   767,  22,  33,  24,    0,  -31 },   // 0x33 '3'
+  {   817,  25,  32,  23,    0,  -31 },   // 0x34 '4'
+  {   873,  24,  32,  24,    0,  -30 },   // 0x35 '5'
+  {   918,  23,  32,  24,    1,  -30 },   // 0x36 '6'
+  {   974,  23,  31,  23,    3,  -30 },   // 0x37 '7'
+  {  1024,  21,  33,  23,    1,  -31 },   // 0x38 '8'
+  {  1083,  23,  33,  23,    0,  -31 },   // 0x39 '9'
+  {  1141,  13,  22,  12,    0,  -20 },   // 0x3A ':'
+  {  1159,  15,  30,  12,   -2,  -20 },   // 0x3B ';'
+  {  1185,  24,  25,  27,    1,  -23 },   // 0x3C '<'
+  {  1219,  24,  14,  27,    3,  -18 },   // 0x3D '='
+  {  1232,  24,  25,  27,    3,  -23 },   // 0x3E '>'
+  {  1266,  18,  33,  24,    4,  -31 },   // 0x3F '?'
+  {  1307,  33,  33,  39,    3,  -31 },   // 0x40 '@'
+  {  1398,  31,  32,  33,    0,  -31 },   // 0x41 'A'
+  {  1462,  31,  31,  30,    0,  -30 },   // 0x42 'B'
+  {  1523,  29,  33,  29,    2,  -31 },   // 0x43 'C'
+  {  1582,  35,  31,  34,    0,  -30 },   // 0x44 'D'
+  {  1645,  32,  31,  30,    0,  -30 },   // 0x45 'E'
+  {  1712,  31,  31,  29,    0,  -30 },   // 0x46 'F'
+  {  1771,  32,  33,  33,    2,  -31 },   // 0x47 'G'
+  {  1835,  39,  31,  35,    0,  -30 },   // 0x48 'H'
+  {  1898,  21,  31,  18,    0,  -30 },   // 0x49 'I'
+  {  1930,  27,  36,  23,    0,  -30 },   // 0x4A 'J'
+  {  1988,  34,  31,  31,    0,  -30 },   // 0x4B 'K'
+  {  2059,  29,  31,  29,    0,  -30 },   // 0x4C 'L'
+  {  2112,  44,  32,  41,    0,  -30 },   // 0x4D 'M'
+  {  2218,  37,  32,  33,    0,  -30 },   // 0x4E 'N'
+  {  2300,  31,  33,  32,    2,  -31 },   // 0x4F 'O'
+  {  2366,  31,  31,  28,    0,  -30 },   // 0x50 'P'
+  {  2421,  31,  42,  32,    2,  -31 },   // 0x51 'Q'
+  {  2504,  32,  31,  31,    0,  -30 },   // 0x52 'R'
+  {  2566,  24,  33,  24,    0,  -31 },   // 0x53 'S'
+  {  2626,  27,  31,  28,    4,  -30 },   // 0x54 'T'
+  {  2682,  32,  32,  34,    5,  -30 },   // 0x55 'U'
+  {  2749,  31,  32,  33,    6,  -30 },   // 0x56 'V'
+  {  2813,  41,  32,  44,    6,  -30 },   // 0x57 'W'
+  {  2917,  34,  31,  33,    0,  -30 },   // 0x58 'X'
+  {  2984,  28,  31,  30,    6,  -30 },   // 0x59 'Y'
+  {  3041,  28,  31,  26,    0,  -30 },   // 0x5A 'Z'
+  {  3096,  19,  38,  16,   -2,  -30 },   // 0x5B '['
+  {  3138,  13,  33,  19,    6,  -31 },   // 0x5C '\'
+  {  3171,  19,  38,  16,   -3,  -30 },   // 0x5D ']'
+  {  3210,  21,  17,  27,    3,  -30 },   // 0x5E '^'
+  {  3241,  24,   3,  23,    0,    5 },   // 0x5F '_'
+  {  3244,  10,   9,  16,    4,  -32 },   // 0x60 '`'
+  {  3253,  22,  23,  24,    1,  -21 },   // 0x61 'a'
+  {  3304,  22,  33,  23,    1,  -31 },   // 0x62 'b'
+  {  3364,  18,  23,  20,    1,  -21 },   // 0x63 'c'
+  {  3397,  25,  34,  24,    1,  -32 },   // 0x64 'd'
+  {  3463,  18,  23,  20,    1,  -21 },   // 0x65 'e'
+  {  3501,  28,  41,  23,   -4,  -31 },   // 0x66 'f'
+  {  3573,  25,  31,  23,   -1,  -21 },   // 0x67 'g'
+  {  3626,  23,  34,  26,    1,  -32 },   // 0x68 'h'
+  {  3697,  12,  33,  14,    2,  -31 },   // 0x69 'i'
+  {  3732,  22,  42,  16,   -4,  -31 },   // 0x6A 'j'
+  {  3793,  24,  34,  24,    1,  -32 },   // 0x6B 'k'
+  {  3856,  13,  34,  14,    2,  -32 },   // 0x6C 'l'
+  {  3895,  35,  23,  36,    0,  -21 },   // 0x6D 'm'
+  {  3977,  23,  23,  25,    0,  -21 },   // 0x6E 'n'
+  {  4032,  20,  23,  22,    1,  -21 },   // 0x6F 'o'
+  {  4077,  27,  31,  23,   -4,  -21 },   // 0x70 'p'
+  {  4136,  22,  31,  23,    1,  -21 },   // 0x71 'q'
+  {  4195,  20,  22,  19,    0,  -21 },   // 0x72 'r'
+  {  4227,  16,  23,  17,    0,  -21 },   // 0x73 's'
+  {  4265,  13,  29,  13,    2,  -27 },   // 0x74 't'
+  {  4299,  22,  23,  25,    2,  -21 },   // 0x75 'u'
+  {  4352,  17,  23,  21,    3,  -21 },   // 0x76 'v'
+  {  4392,  27,  23,  31,    3,  -21 },   // 0x77 'w'
+  {  4456,  24,  23,  22,   -1,  -21 },   // 0x78 'x'
+  {  4504,  23,  31,  20,   -3,  -21 },   // 0x79 'y'
+  {  4559,  19,  25,  19,    0,  -20 },   // 0x7A 'z'
+  {  4600,  20,  41,  16,    0,  -31 },   // 0x7B '{'
+  {  4657,   4,  33,  13,    5,  -31 },   // 0x7C '|'
+  {  4662,  20,  41,  16,   -6,  -31 },   // 0x7D '}'
+  {  4718,  21,   7,  27,    3,  -14 } }; // 0x7E '~'
+
+const GFXfontPacked FreeSerifBoldItalic24pt7bPacked PROGMEM = {
+  { (uint8_t  *)FreeSerifBoldItalic24pt7bPackedRuns,
+    (GFXglyph *)FreeSerifBoldItalic24pt7bPackedGlyphs,
+    0x20, 0x7E, 56 } };
+
+// Approx. 5401 bytes
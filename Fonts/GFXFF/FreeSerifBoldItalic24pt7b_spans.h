@@ -0,0 +1,1041 @@
+// FreeSerifBoldItalic24pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSerifBoldItalic24pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSerifBoldItalic24pt7bSpanData[] PROGMEM = {
+  0x01, 0x0A, 0x04, 0x01, 0x09, 0x06, 0x01, 0x09, 0x06, 0x01, 0x08, 0x07,
+  0x01, 0x08, 0x07, 0x01, 0x08, 0x07, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06,
+  0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05,
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x07, 0x02, 0x01, 0x06, 0x03, 0x01, 0x06, 0x02,
+  0x01, 0x06, 0x02, 0x01, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+  0x04, 0x01, 0x01, 0x06, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00,
+  0x08, 0x01, 0x01, 0x06, 0x01, 0x02, 0x04, 0x02, 0x03, 0x03, 0x0F, 0x03,
+  0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x01, 0x06, 0x0D, 0x06, 0x02, 0x01,
+  0x06, 0x0D, 0x06, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x02, 0x01, 0x05, 0x0D,
+  0x05, 0x02, 0x01, 0x04, 0x0D, 0x04, 0x02, 0x01, 0x04, 0x0D, 0x04, 0x02,
+  0x01, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x04, 0x0D, 0x03, 0x02, 0x00, 0x03,
+  0x0C, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x02, 0x0C, 0x02,
+  0x02, 0x0E, 0x04, 0x17, 0x04, 0x02, 0x0E, 0x03, 0x17, 0x03, 0x02, 0x0D,
+  0x04, 0x16, 0x04, 0x02, 0x0D, 0x04, 0x16, 0x04, 0x02, 0x0D, 0x03, 0x16,
+  0x03, 0x02, 0x0C, 0x04, 0x15, 0x04, 0x02, 0x0C, 0x03, 0x15, 0x03, 0x02,
+  0x0B, 0x04, 0x14, 0x04, 0x02, 0x0B, 0x04, 0x14, 0x04, 0x02, 0x0A, 0x04,
+  0x13, 0x04, 0x01, 0x05, 0x16, 0x01, 0x05, 0x16, 0x01, 0x05, 0x15, 0x02,
+  0x09, 0x03, 0x12, 0x03, 0x02, 0x08, 0x04, 0x11, 0x04, 0x02, 0x08, 0x04,
+  0x11, 0x04, 0x02, 0x08, 0x03, 0x11, 0x03, 0x02, 0x07, 0x04, 0x10, 0x04,
+  0x02, 0x07, 0x04, 0x10, 0x04, 0x02, 0x07, 0x03, 0x10, 0x03, 0x01, 0x01,
+  0x16, 0x01, 0x01, 0x16, 0x01, 0x01, 0x15, 0x02, 0x05, 0x03, 0x0E, 0x03,
+  0x02, 0x04, 0x04, 0x0D, 0x04, 0x02, 0x04, 0x04, 0x0D, 0x04, 0x02, 0x04,
+  0x03, 0x0D, 0x03, 0x02, 0x03, 0x04, 0x0C, 0x04, 0x02, 0x03, 0x03, 0x0C,
+  0x03, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x02,
+  0x02, 0x03, 0x0B, 0x03, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x01, 0x10, 0x03,
+  0x01, 0x10, 0x02, 0x01, 0x10, 0x02, 0x01, 0x0B, 0x08, 0x01, 0x09, 0x0C,
+  0x03, 0x07, 0x05, 0x0F, 0x02, 0x13, 0x04, 0x03, 0x07, 0x03, 0x0F, 0x02,
+  0x14, 0x04, 0x03, 0x06, 0x03, 0x0E, 0x03, 0x14, 0x04, 0x03, 0x06, 0x03,
+  0x0E, 0x02, 0x15, 0x02, 0x03, 0x05, 0x04, 0x0E, 0x02, 0x15, 0x02, 0x03,
+  0x05, 0x04, 0x0D, 0x03, 0x15, 0x02, 0x03, 0x05, 0x05, 0x0D, 0x03, 0x15,
+  0x01, 0x03, 0x05, 0x06, 0x0D, 0x02, 0x15, 0x01, 0x01, 0x05, 0x0A, 0x01,
+  0x06, 0x09, 0x01, 0x06, 0x0A, 0x01, 0x07, 0x0A, 0x01, 0x08, 0x0A, 0x01,
+  0x09, 0x0A, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x09, 0x01, 0x0A, 0x0A, 0x02,
+  0x0A, 0x03, 0x0E, 0x07, 0x03, 0x02, 0x01, 0x0A, 0x02, 0x0F, 0x06, 0x03,
+  0x02, 0x01, 0x0A, 0x02, 0x10, 0x05, 0x03, 0x01, 0x02, 0x09, 0x03, 0x10,
+  0x05, 0x03, 0x01, 0x02, 0x09, 0x02, 0x10, 0x05, 0x03, 0x01, 0x02, 0x09,
+  0x02, 0x10, 0x05, 0x03, 0x00, 0x04, 0x08, 0x03, 0x10, 0x04, 0x03, 0x00,
+  0x04, 0x08, 0x03, 0x0F, 0x04, 0x03, 0x01, 0x04, 0x08, 0x02, 0x0E, 0x05,
+  0x03, 0x02, 0x04, 0x08, 0x02, 0x0D, 0x05, 0x01, 0x04, 0x0C, 0x01, 0x06,
+  0x08, 0x01, 0x07, 0x02, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x02, 0x01, 0x06, 0x02, 0x02, 0x07, 0x05, 0x19, 0x03, 0x02, 0x05, 0x09,
+  0x18, 0x03, 0x03, 0x04, 0x06, 0x0C, 0x03, 0x15, 0x05, 0x02, 0x03, 0x06,
+  0x0C, 0x0E, 0x03, 0x02, 0x06, 0x0E, 0x07, 0x16, 0x03, 0x03, 0x02, 0x06,
+  0x0E, 0x01, 0x16, 0x03, 0x03, 0x01, 0x06, 0x0E, 0x01, 0x15, 0x03, 0x03,
+  0x01, 0x06, 0x0E, 0x01, 0x15, 0x03, 0x03, 0x00, 0x06, 0x0E, 0x01, 0x14,
+  0x03, 0x03, 0x00, 0x06, 0x0D, 0x01, 0x14, 0x02, 0x03, 0x00, 0x06, 0x0D,
+  0x01, 0x13, 0x03, 0x03, 0x00, 0x05, 0x0C, 0x02, 0x12, 0x03, 0x03, 0x00,
+  0x05, 0x0C, 0x01, 0x12, 0x03, 0x03, 0x00, 0x05, 0x0B, 0x02, 0x11, 0x03,
+  0x04, 0x01, 0x04, 0x0A, 0x02, 0x11, 0x03, 0x1B, 0x05, 0x04, 0x01, 0x05,
+  0x09, 0x02, 0x10, 0x03, 0x19, 0x08, 0x04, 0x02, 0x08, 0x10, 0x02, 0x18,
+  0x06, 0x21, 0x01, 0x04, 0x03, 0x05, 0x0F, 0x03, 0x17, 0x05, 0x21, 0x02,
+  0x03, 0x0E, 0x03, 0x16, 0x06, 0x22, 0x01, 0x03, 0x0E, 0x03, 0x15, 0x06,
+  0x22, 0x01, 0x03, 0x0D, 0x03, 0x14, 0x06, 0x22, 0x01, 0x03, 0x0D, 0x02,
+  0x14, 0x06, 0x22, 0x01, 0x03, 0x0C, 0x03, 0x14, 0x05, 0x22, 0x01, 0x03,
+  0x0C, 0x02, 0x13, 0x06, 0x21, 0x01, 0x03, 0x0B, 0x03, 0x13, 0x06, 0x21,
+  0x01, 0x03, 0x0A, 0x03, 0x13, 0x05, 0x20, 0x01, 0x03, 0x0A, 0x03, 0x13,
+  0x05, 0x20, 0x01, 0x03, 0x09, 0x03, 0x13, 0x05, 0x1F, 0x02, 0x03, 0x09,
+  0x02, 0x13, 0x05, 0x1E, 0x02, 0x03, 0x08, 0x03, 0x14, 0x05, 0x1D, 0x02,
+  0x02, 0x08, 0x02, 0x15, 0x09, 0x02, 0x07, 0x03, 0x16, 0x06, 0x01, 0x10,
+  0x06, 0x01, 0x0F, 0x09, 0x02, 0x0D, 0x05, 0x15, 0x04, 0x02, 0x0D, 0x04,
+  0x16, 0x04, 0x02, 0x0C, 0x04, 0x16, 0x04, 0x02, 0x0C, 0x04, 0x16, 0x04,
+  0x02, 0x0B, 0x05, 0x16, 0x04, 0x02, 0x0B, 0x05, 0x15, 0x05, 0x02, 0x0B,
+  0x05, 0x15, 0x04, 0x02, 0x0B, 0x05, 0x14, 0x04, 0x02, 0x0B, 0x05, 0x13,
+  0x04, 0x01, 0x0B, 0x0A, 0x01, 0x0B, 0x08, 0x01, 0x0B, 0x06, 0x01, 0x0A,
+  0x07, 0x02, 0x08, 0x09, 0x16, 0x0A, 0x03, 0x06, 0x04, 0x0C, 0x06, 0x18,
+  0x07, 0x03, 0x05, 0x04, 0x0C, 0x06, 0x19, 0x04, 0x03, 0x03, 0x05, 0x0C,
+  0x06, 0x19, 0x03, 0x03, 0x02, 0x05, 0x0D, 0x06, 0x19, 0x02, 0x03, 0x02,
+  0x04, 0x0D, 0x06, 0x18, 0x03, 0x03, 0x01, 0x05, 0x0D, 0x06, 0x17, 0x03,
+  0x03, 0x01, 0x05, 0x0D, 0x07, 0x17, 0x02, 0x03, 0x00, 0x06, 0x0E, 0x07,
+  0x16, 0x02, 0x02, 0x00, 0x06, 0x0E, 0x0A, 0x02, 0x00, 0x06, 0x0F, 0x08,
+  0x02, 0x00, 0x07, 0x0F, 0x08, 0x02, 0x00, 0x07, 0x10, 0x07, 0x03, 0x01,
+  0x07, 0x10, 0x08, 0x1F, 0x01, 0x03, 0x01, 0x09, 0x0F, 0x0B, 0x1E, 0x02,
+  0x02, 0x02, 0x0F, 0x12, 0x0D, 0x02, 0x03, 0x0D, 0x13, 0x0B, 0x02, 0x05,
+  0x08, 0x16, 0x06, 0x01, 0x03, 0x03, 0x01, 0x02, 0x05, 0x01, 0x01, 0x06,
+  0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x02, 0x01, 0x0D, 0x01, 0x01, 0x0B, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x02, 0x03,
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02,
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x07,
+  0x02, 0x01, 0x08, 0x01, 0x01, 0x08, 0x02, 0x01, 0x09, 0x01, 0x01, 0x09,
+  0x02, 0x01, 0x09, 0x02, 0x01, 0x09, 0x03, 0x01, 0x0A, 0x02, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A,
+  0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A,
+  0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x05, 0x01, 0x09,
+  0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08,
+  0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x07, 0x05, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01, 0x05,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x08,
+  0x03, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x03, 0x01,
+  0x03, 0x08, 0x03, 0x0F, 0x03, 0x03, 0x00, 0x05, 0x08, 0x03, 0x0E, 0x05,
+  0x03, 0x00, 0x06, 0x09, 0x01, 0x0D, 0x06, 0x03, 0x00, 0x06, 0x09, 0x01,
+  0x0D, 0x06, 0x03, 0x01, 0x06, 0x09, 0x01, 0x0C, 0x06, 0x01, 0x07, 0x05,
+  0x01, 0x07, 0x05, 0x03, 0x01, 0x06, 0x09, 0x01, 0x0C, 0x06, 0x03, 0x00,
+  0x06, 0x09, 0x01, 0x0D, 0x06, 0x03, 0x00, 0x06, 0x09, 0x01, 0x0D, 0x06,
+  0x03, 0x00, 0x05, 0x08, 0x03, 0x0E, 0x05, 0x03, 0x01, 0x03, 0x08, 0x03,
+  0x0F, 0x03, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01,
+  0x08, 0x03, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x00, 0x16, 0x01, 0x00, 0x16, 0x01,
+  0x00, 0x16, 0x01, 0x00, 0x16, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x03, 0x06, 0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x07, 0x01, 0x04, 0x06, 0x01, 0x05, 0x05, 0x01, 0x06, 0x03, 0x01,
+  0x06, 0x03, 0x01, 0x06, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01,
+  0x01, 0x0B, 0x01, 0x01, 0x0A, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x01,
+  0x02, 0x04, 0x01, 0x01, 0x06, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01,
+  0x00, 0x08, 0x01, 0x01, 0x06, 0x01, 0x02, 0x04, 0x01, 0x0F, 0x04, 0x01,
+  0x0E, 0x04, 0x01, 0x0E, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01,
+  0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01,
+  0x0A, 0x05, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x04, 0x01,
+  0x07, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01,
+  0x0C, 0x05, 0x02, 0x0A, 0x03, 0x10, 0x03, 0x02, 0x08, 0x04, 0x11, 0x03,
+  0x02, 0x07, 0x05, 0x11, 0x03, 0x02, 0x06, 0x05, 0x11, 0x04, 0x02, 0x06,
+  0x05, 0x11, 0x04, 0x02, 0x05, 0x05, 0x11, 0x04, 0x02, 0x04, 0x06, 0x11,
+  0x05, 0x02, 0x04, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02,
+  0x03, 0x06, 0x10, 0x06, 0x02, 0x02, 0x07, 0x10, 0x06, 0x02, 0x02, 0x06,
+  0x10, 0x06, 0x02, 0x01, 0x07, 0x0F, 0x07, 0x02, 0x01, 0x07, 0x0F, 0x07,
+  0x02, 0x01, 0x07, 0x0F, 0x07, 0x02, 0x01, 0x06, 0x0F, 0x06, 0x02, 0x00,
+  0x07, 0x0E, 0x07, 0x02, 0x00, 0x07, 0x0E, 0x07, 0x02, 0x00, 0x07, 0x0E,
+  0x07, 0x02, 0x00, 0x06, 0x0E, 0x06, 0x02, 0x00, 0x06, 0x0D, 0x07, 0x02,
+  0x00, 0x06, 0x0D, 0x07, 0x02, 0x00, 0x06, 0x0D, 0x06, 0x02, 0x00, 0x06,
+  0x0D, 0x06, 0x02, 0x00, 0x05, 0x0C, 0x06, 0x02, 0x00, 0x05, 0x0C, 0x06,
+  0x02, 0x01, 0x04, 0x0B, 0x06, 0x02, 0x01, 0x04, 0x0B, 0x05, 0x02, 0x02,
+  0x03, 0x0B, 0x04, 0x02, 0x02, 0x03, 0x0A, 0x04, 0x02, 0x03, 0x03, 0x09,
+  0x04, 0x01, 0x05, 0x06, 0x01, 0x11, 0x03, 0x01, 0x0B, 0x08, 0x01, 0x07,
+  0x0C, 0x01, 0x0C, 0x07, 0x01, 0x0C, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x0C,
+  0x06, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x0A,
+  0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x09,
+  0x07, 0x01, 0x09, 0x06, 0x01, 0x09, 0x06, 0x01, 0x09, 0x06, 0x01, 0x08,
+  0x07, 0x01, 0x08, 0x06, 0x01, 0x08, 0x06, 0x01, 0x07, 0x07, 0x01, 0x07,
+  0x07, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x06, 0x07, 0x01, 0x06,
+  0x06, 0x01, 0x06, 0x06, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x03,
+  0x0A, 0x01, 0x00, 0x10, 0x01, 0x0C, 0x05, 0x01, 0x09, 0x0A, 0x01, 0x08,
+  0x0C, 0x01, 0x07, 0x0E, 0x02, 0x06, 0x03, 0x0E, 0x07, 0x02, 0x06, 0x02,
+  0x0F, 0x07, 0x02, 0x05, 0x02, 0x0F, 0x07, 0x02, 0x04, 0x02, 0x10, 0x06,
+  0x01, 0x10, 0x06, 0x01, 0x10, 0x06, 0x01, 0x10, 0x06, 0x01, 0x10, 0x05,
+  0x01, 0x0F, 0x06, 0x01, 0x0F, 0x05, 0x01, 0x0E, 0x06, 0x01, 0x0E, 0x05,
+  0x01, 0x0D, 0x05, 0x01, 0x0D, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0B, 0x04,
+  0x01, 0x0A, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08, 0x03, 0x02, 0x07, 0x03,
+  0x13, 0x02, 0x02, 0x06, 0x03, 0x13, 0x01, 0x02, 0x05, 0x03, 0x12, 0x02,
+  0x02, 0x04, 0x03, 0x11, 0x02, 0x01, 0x03, 0x10, 0x01, 0x02, 0x11, 0x01,
+  0x01, 0x11, 0x01, 0x00, 0x12, 0x01, 0x00, 0x11, 0x01, 0x0C, 0x06, 0x01,
+  0x0A, 0x0A, 0x01, 0x08, 0x0D, 0x02, 0x07, 0x02, 0x0E, 0x07, 0x02, 0x06,
+  0x02, 0x0F, 0x07, 0x02, 0x06, 0x01, 0x10, 0x06, 0x01, 0x10, 0x06, 0x01,
+  0x10, 0x06, 0x01, 0x10, 0x06, 0x01, 0x10, 0x05, 0x01, 0x0F, 0x06, 0x01,
+  0x0E, 0x06, 0x01, 0x0D, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x09, 0x08, 0x01,
+  0x07, 0x0B, 0x01, 0x09, 0x0A, 0x01, 0x0C, 0x08, 0x01, 0x0D, 0x07, 0x01,
+  0x0D, 0x07, 0x01, 0x0E, 0x06, 0x01, 0x0E, 0x06, 0x01, 0x0E, 0x06, 0x01,
+  0x0E, 0x06, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x04, 0x02,
+  0x01, 0x03, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x04, 0x02, 0x00, 0x06,
+  0x0C, 0x04, 0x02, 0x00, 0x07, 0x0B, 0x04, 0x01, 0x01, 0x0C, 0x01, 0x03,
+  0x07, 0x01, 0x15, 0x03, 0x01, 0x14, 0x04, 0x01, 0x13, 0x05, 0x01, 0x12,
+  0x06, 0x01, 0x11, 0x06, 0x01, 0x10, 0x07, 0x01, 0x0F, 0x08, 0x01, 0x0E,
+  0x09, 0x02, 0x0D, 0x02, 0x10, 0x06, 0x02, 0x0C, 0x02, 0x10, 0x06, 0x02,
+  0x0B, 0x02, 0x10, 0x06, 0x02, 0x0A, 0x02, 0x0F, 0x06, 0x02, 0x09, 0x02,
+  0x0F, 0x06, 0x02, 0x08, 0x02, 0x0F, 0x06, 0x02, 0x07, 0x02, 0x0F, 0x06,
+  0x02, 0x07, 0x02, 0x0E, 0x06, 0x02, 0x06, 0x02, 0x0E, 0x06, 0x02, 0x05,
+  0x02, 0x0E, 0x06, 0x02, 0x04, 0x02, 0x0D, 0x07, 0x02, 0x03, 0x02, 0x0D,
+  0x06, 0x02, 0x02, 0x02, 0x0D, 0x06, 0x01, 0x01, 0x15, 0x01, 0x01, 0x15,
+  0x01, 0x01, 0x14, 0x01, 0x00, 0x15, 0x01, 0x0C, 0x06, 0x01, 0x0B, 0x06,
+  0x01, 0x0B, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x06,
+  0x01, 0x0A, 0x06, 0x01, 0x0A, 0x0D, 0x01, 0x09, 0x0E, 0x01, 0x09, 0x0E,
+  0x01, 0x09, 0x0D, 0x01, 0x08, 0x0E, 0x01, 0x08, 0x02, 0x01, 0x07, 0x02,
+  0x01, 0x07, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x06, 0x01, 0x05, 0x0A,
+  0x01, 0x05, 0x0B, 0x01, 0x05, 0x0C, 0x01, 0x04, 0x0E, 0x01, 0x08, 0x0B,
+  0x01, 0x0B, 0x08, 0x01, 0x0C, 0x08, 0x01, 0x0D, 0x07, 0x01, 0x0E, 0x06,
+  0x01, 0x0E, 0x06, 0x01, 0x0F, 0x05, 0x01, 0x0F, 0x05, 0x01, 0x0F, 0x05,
+  0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0E, 0x04, 0x02, 0x01, 0x04,
+  0x0E, 0x04, 0x02, 0x00, 0x06, 0x0D, 0x04, 0x02, 0x00, 0x06, 0x0C, 0x04,
+  0x02, 0x00, 0x07, 0x0B, 0x04, 0x01, 0x01, 0x0C, 0x01, 0x03, 0x07, 0x01,
+  0x14, 0x03, 0x01, 0x10, 0x06, 0x01, 0x0E, 0x05, 0x01, 0x0C, 0x06, 0x01,
+  0x0A, 0x06, 0x01, 0x09, 0x06, 0x01, 0x08, 0x06, 0x01, 0x06, 0x07, 0x01,
+  0x06, 0x06, 0x01, 0x05, 0x07, 0x01, 0x04, 0x07, 0x01, 0x03, 0x07, 0x01,
+  0x03, 0x0D, 0x01, 0x02, 0x0F, 0x02, 0x02, 0x07, 0x0D, 0x05, 0x02, 0x01,
+  0x07, 0x0E, 0x05, 0x02, 0x01, 0x07, 0x0E, 0x06, 0x02, 0x01, 0x06, 0x0E,
+  0x06, 0x02, 0x00, 0x07, 0x0E, 0x06, 0x02, 0x00, 0x07, 0x0E, 0x06, 0x02,
+  0x00, 0x06, 0x0D, 0x07, 0x02, 0x00, 0x06, 0x0D, 0x07, 0x02, 0x00, 0x06,
+  0x0D, 0x07, 0x02, 0x00, 0x05, 0x0D, 0x06, 0x02, 0x00, 0x05, 0x0C, 0x07,
+  0x02, 0x00, 0x05, 0x0C, 0x07, 0x02, 0x01, 0x04, 0x0C, 0x06, 0x02, 0x01,
+  0x04, 0x0B, 0x06, 0x02, 0x01, 0x04, 0x0B, 0x05, 0x02, 0x02, 0x04, 0x0A,
+  0x05, 0x01, 0x03, 0x0B, 0x01, 0x05, 0x07, 0x01, 0x04, 0x12, 0x01, 0x04,
+  0x12, 0x01, 0x04, 0x11, 0x01, 0x03, 0x12, 0x01, 0x03, 0x11, 0x02, 0x02,
+  0x03, 0x10, 0x03, 0x02, 0x02, 0x01, 0x0F, 0x04, 0x02, 0x01, 0x02, 0x0E,
+  0x04, 0x02, 0x01, 0x01, 0x0E, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04,
+  0x01, 0x0C, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0A, 0x04,
+  0x01, 0x0A, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x05,
+  0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04,
+  0x01, 0x0B, 0x05, 0x01, 0x09, 0x09, 0x02, 0x08, 0x04, 0x0F, 0x04, 0x02,
+  0x07, 0x04, 0x10, 0x04, 0x02, 0x06, 0x04, 0x11, 0x04, 0x02, 0x06, 0x04,
+  0x11, 0x04, 0x02, 0x05, 0x05, 0x11, 0x04, 0x02, 0x05, 0x05, 0x11, 0x04,
+  0x02, 0x05, 0x05, 0x11, 0x04, 0x02, 0x05, 0x06, 0x11, 0x04, 0x02, 0x05,
+  0x06, 0x10, 0x04, 0x02, 0x05, 0x07, 0x10, 0x04, 0x02, 0x06, 0x07, 0x0F,
+  0x04, 0x01, 0x06, 0x0B, 0x01, 0x07, 0x09, 0x01, 0x07, 0x08, 0x01, 0x08,
+  0x08, 0x01, 0x06, 0x0B, 0x02, 0x04, 0x04, 0x0A, 0x08, 0x02, 0x03, 0x04,
+  0x0B, 0x07, 0x02, 0x02, 0x04, 0x0C, 0x06, 0x02, 0x01, 0x04, 0x0D, 0x06,
+  0x02, 0x01, 0x04, 0x0D, 0x06, 0x02, 0x00, 0x04, 0x0E, 0x05, 0x02, 0x00,
+  0x04, 0x0E, 0x05, 0x02, 0x00, 0x04, 0x0E, 0x05, 0x02, 0x00, 0x04, 0x0E,
+  0x05, 0x02, 0x00, 0x04, 0x0E, 0x04, 0x02, 0x01, 0x03, 0x0E, 0x04, 0x02,
+  0x01, 0x04, 0x0D, 0x04, 0x02, 0x02, 0x04, 0x0C, 0x04, 0x02, 0x03, 0x04,
+  0x0B, 0x04, 0x01, 0x05, 0x07, 0x01, 0x0C, 0x06, 0x01, 0x09, 0x0B, 0x02,
+  0x08, 0x06, 0x11, 0x04, 0x02, 0x07, 0x06, 0x12, 0x03, 0x02, 0x06, 0x06,
+  0x12, 0x04, 0x02, 0x05, 0x07, 0x12, 0x04, 0x02, 0x05, 0x06, 0x12, 0x05,
+  0x02, 0x04, 0x07, 0x12, 0x05, 0x02, 0x04, 0x06, 0x12, 0x05, 0x02, 0x03,
+  0x07, 0x11, 0x06, 0x02, 0x03, 0x07, 0x11, 0x06, 0x02, 0x03, 0x06, 0x11,
+  0x06, 0x02, 0x03, 0x06, 0x11, 0x06, 0x02, 0x03, 0x06, 0x10, 0x07, 0x02,
+  0x03, 0x06, 0x10, 0x07, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x04, 0x05,
+  0x0F, 0x07, 0x02, 0x04, 0x05, 0x0F, 0x07, 0x02, 0x05, 0x05, 0x0E, 0x07,
+  0x01, 0x06, 0x0F, 0x01, 0x07, 0x0D, 0x01, 0x0D, 0x07, 0x01, 0x0C, 0x07,
+  0x01, 0x0B, 0x07, 0x01, 0x0B, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x09, 0x06,
+  0x01, 0x08, 0x06, 0x01, 0x07, 0x06, 0x01, 0x06, 0x05, 0x01, 0x04, 0x05,
+  0x01, 0x02, 0x05, 0x01, 0x00, 0x03, 0x01, 0x07, 0x04, 0x01, 0x06, 0x06,
+  0x01, 0x05, 0x08, 0x01, 0x05, 0x08, 0x01, 0x05, 0x08, 0x01, 0x06, 0x06,
+  0x01, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x02, 0x04, 0x01, 0x01, 0x06, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01,
+  0x00, 0x08, 0x01, 0x01, 0x06, 0x01, 0x02, 0x04, 0x01, 0x09, 0x04, 0x01,
+  0x08, 0x06, 0x01, 0x07, 0x08, 0x01, 0x07, 0x08, 0x01, 0x07, 0x08, 0x01,
+  0x08, 0x06, 0x01, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x04, 0x04, 0x01, 0x03, 0x06, 0x01, 0x03, 0x07, 0x01, 0x03,
+  0x07, 0x01, 0x03, 0x07, 0x01, 0x04, 0x06, 0x01, 0x05, 0x05, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x04,
+  0x02, 0x01, 0x02, 0x03, 0x01, 0x00, 0x03, 0x00, 0x01, 0x17, 0x01, 0x01,
+  0x15, 0x03, 0x01, 0x13, 0x05, 0x01, 0x11, 0x07, 0x01, 0x0E, 0x0A, 0x01,
+  0x0C, 0x0A, 0x01, 0x0A, 0x0A, 0x01, 0x07, 0x0B, 0x01, 0x05, 0x0A, 0x01,
+  0x03, 0x0A, 0x01, 0x01, 0x0A, 0x01, 0x00, 0x09, 0x01, 0x00, 0x06, 0x01,
+  0x00, 0x08, 0x01, 0x00, 0x0B, 0x01, 0x03, 0x0A, 0x01, 0x05, 0x0A, 0x01,
+  0x07, 0x0B, 0x01, 0x0A, 0x0A, 0x01, 0x0C, 0x0A, 0x01, 0x0E, 0x0A, 0x01,
+  0x10, 0x08, 0x01, 0x13, 0x05, 0x01, 0x15, 0x03, 0x01, 0x17, 0x01, 0x01,
+  0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01,
+  0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x01, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x08, 0x01, 0x00, 0x0A, 0x01, 0x02, 0x0A, 0x01,
+  0x04, 0x0A, 0x01, 0x06, 0x0B, 0x01, 0x09, 0x0A, 0x01, 0x0B, 0x0A, 0x01,
+  0x0D, 0x0B, 0x01, 0x10, 0x08, 0x01, 0x12, 0x06, 0x01, 0x10, 0x08, 0x01,
+  0x0E, 0x0A, 0x01, 0x0B, 0x0B, 0x01, 0x09, 0x0A, 0x01, 0x07, 0x0A, 0x01,
+  0x04, 0x0B, 0x01, 0x02, 0x0A, 0x01, 0x00, 0x0A, 0x01, 0x00, 0x08, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x01, 0x07, 0x06, 0x01,
+  0x05, 0x0A, 0x02, 0x04, 0x04, 0x0B, 0x05, 0x02, 0x04, 0x03, 0x0C, 0x05,
+  0x02, 0x03, 0x04, 0x0C, 0x06, 0x02, 0x03, 0x05, 0x0C, 0x06, 0x02, 0x03,
+  0x05, 0x0C, 0x06, 0x02, 0x03, 0x05, 0x0C, 0x06, 0x02, 0x04, 0x03, 0x0C,
+  0x06, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x0A,
+  0x06, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x05,
+  0x02, 0x01, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x01,
+  0x01, 0x06, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01,
+  0x01, 0x06, 0x01, 0x02, 0x04, 0x01, 0x0D, 0x09, 0x01, 0x0A, 0x0F, 0x02,
+  0x08, 0x06, 0x15, 0x05, 0x02, 0x07, 0x04, 0x18, 0x04, 0x02, 0x05, 0x05,
+  0x1A, 0x03, 0x02, 0x04, 0x05, 0x1B, 0x03, 0x02, 0x03, 0x05, 0x1C, 0x03,
+  0x04, 0x03, 0x04, 0x11, 0x04, 0x1A, 0x01, 0x1D, 0x02, 0x04, 0x02, 0x05,
+  0x10, 0x06, 0x17, 0x04, 0x1D, 0x03, 0x04, 0x02, 0x04, 0x0F, 0x04, 0x15,
+  0x06, 0x1E, 0x02, 0x04, 0x01, 0x05, 0x0E, 0x04, 0x15, 0x05, 0x1E, 0x03,
+  0x04, 0x01, 0x05, 0x0D, 0x04, 0x16, 0x04, 0x1F, 0x02, 0x04, 0x00, 0x05,
+  0x0C, 0x04, 0x16, 0x04, 0x1F, 0x02, 0x04, 0x00, 0x05, 0x0C, 0x04, 0x16,
+  0x04, 0x1F, 0x02, 0x04, 0x00, 0x05, 0x0B, 0x04, 0x15, 0x04, 0x1F, 0x02,
+  0x04, 0x00, 0x05, 0x0B, 0x04, 0x15, 0x04, 0x1F, 0x02, 0x04, 0x00, 0x05,
+  0x0A, 0x05, 0x15, 0x04, 0x1F, 0x02, 0x04, 0x00, 0x05, 0x0A, 0x04, 0x14,
+  0x04, 0x1E, 0x03, 0x04, 0x00, 0x05, 0x0A, 0x04, 0x14, 0x04, 0x1E, 0x02,
+  0x04, 0x00, 0x05, 0x0A, 0x04, 0x13, 0x04, 0x1E, 0x02, 0x04, 0x00, 0x05,
+  0x0A, 0x04, 0x12, 0x05, 0x1D, 0x02, 0x04, 0x01, 0x05, 0x0A, 0x05, 0x11,
+  0x06, 0x1C, 0x03, 0x04, 0x01, 0x05, 0x0B, 0x06, 0x13, 0x04, 0x1B, 0x03,
+  0x03, 0x01, 0x05, 0x0C, 0x04, 0x13, 0x0A, 0x02, 0x02, 0x05, 0x15, 0x06,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x05, 0x01, 0x04, 0x05, 0x01, 0x05, 0x05,
+  0x02, 0x06, 0x05, 0x19, 0x03, 0x02, 0x08, 0x06, 0x17, 0x05, 0x01, 0x0A,
+  0x10, 0x01, 0x0D, 0x09, 0x01, 0x15, 0x02, 0x01, 0x14, 0x03, 0x01, 0x14,
+  0x03, 0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x01, 0x12, 0x05, 0x01, 0x11,
+  0x07, 0x01, 0x11, 0x07, 0x01, 0x10, 0x08, 0x02, 0x0F, 0x02, 0x12, 0x06,
+  0x02, 0x0F, 0x02, 0x12, 0x06, 0x02, 0x0E, 0x02, 0x12, 0x06, 0x02, 0x0D,
+  0x02, 0x12, 0x07, 0x02, 0x0D, 0x02, 0x12, 0x07, 0x02, 0x0C, 0x02, 0x13,
+  0x06, 0x02, 0x0C, 0x02, 0x13, 0x06, 0x02, 0x0B, 0x02, 0x13, 0x06, 0x02,
+  0x0A, 0x02, 0x13, 0x06, 0x02, 0x0A, 0x02, 0x13, 0x07, 0x02, 0x09, 0x02,
+  0x13, 0x07, 0x01, 0x08, 0x12, 0x01, 0x08, 0x12, 0x02, 0x07, 0x02, 0x14,
+  0x06, 0x02, 0x07, 0x02, 0x14, 0x06, 0x02, 0x06, 0x02, 0x14, 0x07, 0x02,
+  0x05, 0x03, 0x14, 0x07, 0x02, 0x05, 0x02, 0x14, 0x07, 0x02, 0x04, 0x03,
+  0x14, 0x07, 0x02, 0x03, 0x03, 0x14, 0x07, 0x02, 0x03, 0x03, 0x14, 0x08,
+  0x02, 0x01, 0x06, 0x13, 0x0A, 0x02, 0x00, 0x09, 0x11, 0x0E, 0x01, 0x07,
+  0x12, 0x01, 0x09, 0x13, 0x02, 0x0A, 0x07, 0x15, 0x08, 0x02, 0x0A, 0x07,
+  0x16, 0x08, 0x02, 0x0A, 0x07, 0x17, 0x08, 0x02, 0x09, 0x07, 0x17, 0x08,
+  0x02, 0x09, 0x07, 0x17, 0x08, 0x02, 0x09, 0x07, 0x17, 0x08, 0x02, 0x09,
+  0x07, 0x17, 0x08, 0x02, 0x08, 0x07, 0x17, 0x07, 0x02, 0x08, 0x07, 0x16,
+  0x08, 0x02, 0x08, 0x07, 0x16, 0x07, 0x02, 0x08, 0x06, 0x15, 0x07, 0x02,
+  0x07, 0x07, 0x12, 0x07, 0x01, 0x07, 0x0F, 0x02, 0x07, 0x07, 0x12, 0x07,
+  0x02, 0x06, 0x07, 0x14, 0x07, 0x02, 0x06, 0x07, 0x15, 0x07, 0x02, 0x06,
+  0x07, 0x15, 0x07, 0x02, 0x06, 0x07, 0x15, 0x08, 0x02, 0x05, 0x07, 0x15,
+  0x08, 0x02, 0x05, 0x07, 0x15, 0x08, 0x02, 0x05, 0x07, 0x15, 0x08, 0x02,
+  0x05, 0x06, 0x14, 0x09, 0x02, 0x04, 0x07, 0x14, 0x08, 0x02, 0x04, 0x07,
+  0x13, 0x09, 0x02, 0x04, 0x07, 0x13, 0x08, 0x02, 0x03, 0x07, 0x12, 0x08,
+  0x02, 0x03, 0x08, 0x10, 0x09, 0x01, 0x02, 0x15, 0x01, 0x00, 0x14, 0x02,
+  0x0F, 0x08, 0x1C, 0x01, 0x02, 0x0C, 0x0E, 0x1B, 0x02, 0x02, 0x0A, 0x08,
+  0x17, 0x06, 0x02, 0x09, 0x07, 0x18, 0x05, 0x02, 0x07, 0x08, 0x19, 0x03,
+  0x02, 0x06, 0x08, 0x19, 0x03, 0x02, 0x05, 0x08, 0x1A, 0x02, 0x02, 0x05,
+  0x07, 0x1A, 0x02, 0x02, 0x04, 0x08, 0x1A, 0x02, 0x02, 0x03, 0x08, 0x1A,
+  0x01, 0x02, 0x03, 0x08, 0x1A, 0x01, 0x01, 0x02, 0x08, 0x01, 0x02, 0x08,
+  0x01, 0x01, 0x09, 0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x01, 0x00, 0x09,
+  0x01, 0x00, 0x09, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08,
+  0x01, 0x01, 0x07, 0x02, 0x01, 0x08, 0x17, 0x02, 0x02, 0x02, 0x07, 0x16,
+  0x02, 0x02, 0x02, 0x08, 0x15, 0x03, 0x02, 0x03, 0x07, 0x14, 0x03, 0x02,
+  0x05, 0x07, 0x12, 0x03, 0x01, 0x06, 0x0E, 0x01, 0x09, 0x08, 0x01, 0x07,
+  0x12, 0x01, 0x07, 0x15, 0x02, 0x0A, 0x07, 0x17, 0x07, 0x02, 0x0A, 0x07,
+  0x19, 0x06, 0x02, 0x0A, 0x07, 0x19, 0x07, 0x02, 0x09, 0x07, 0x1A, 0x07,
+  0x02, 0x09, 0x07, 0x1B, 0x07, 0x02, 0x09, 0x07, 0x1B, 0x07, 0x02, 0x09,
+  0x07, 0x1B, 0x07, 0x02, 0x08, 0x07, 0x1B, 0x08, 0x02, 0x08, 0x07, 0x1B,
+  0x08, 0x02, 0x08, 0x07, 0x1B, 0x08, 0x02, 0x08, 0x06, 0x1B, 0x08, 0x02,
+  0x07, 0x07, 0x1B, 0x08, 0x02, 0x07, 0x07, 0x1B, 0x08, 0x02, 0x07, 0x07,
+  0x1A, 0x09, 0x02, 0x06, 0x07, 0x1A, 0x09, 0x02, 0x06, 0x07, 0x1A, 0x08,
+  0x02, 0x06, 0x07, 0x1A, 0x08, 0x02, 0x06, 0x07, 0x19, 0x09, 0x02, 0x05,
+  0x07, 0x19, 0x08, 0x02, 0x05, 0x07, 0x18, 0x09, 0x02, 0x05, 0x07, 0x18,
+  0x08, 0x02, 0x05, 0x06, 0x17, 0x08, 0x02, 0x04, 0x07, 0x17, 0x07, 0x02,
+  0x04, 0x07, 0x16, 0x07, 0x02, 0x04, 0x07, 0x15, 0x07, 0x02, 0x03, 0x07,
+  0x13, 0x08, 0x02, 0x03, 0x08, 0x11, 0x08, 0x01, 0x02, 0x15, 0x01, 0x00,
+  0x13, 0x01, 0x07, 0x19, 0x01, 0x09, 0x17, 0x02, 0x0A, 0x08, 0x19, 0x06,
+  0x02, 0x0A, 0x07, 0x1B, 0x04, 0x02, 0x0A, 0x07, 0x1C, 0x03, 0x02, 0x09,
+  0x07, 0x1D, 0x02, 0x02, 0x09, 0x07, 0x1D, 0x01, 0x02, 0x09, 0x07, 0x1D,
+  0x01, 0x01, 0x09, 0x07, 0x02, 0x08, 0x07, 0x17, 0x02, 0x02, 0x08, 0x07,
+  0x17, 0x01, 0x02, 0x08, 0x07, 0x16, 0x02, 0x02, 0x08, 0x06, 0x14, 0x04,
+  0x01, 0x07, 0x11, 0x01, 0x07, 0x10, 0x02, 0x07, 0x07, 0x12, 0x05, 0x02,
+  0x06, 0x07, 0x13, 0x04, 0x02, 0x06, 0x07, 0x14, 0x02, 0x02, 0x06, 0x07,
+  0x14, 0x02, 0x02, 0x06, 0x07, 0x14, 0x02, 0x02, 0x05, 0x07, 0x14, 0x01,
+  0x02, 0x05, 0x07, 0x1C, 0x01, 0x02, 0x05, 0x07, 0x1B, 0x02, 0x02, 0x05,
+  0x06, 0x1A, 0x02, 0x02, 0x04, 0x07, 0x1A, 0x02, 0x02, 0x04, 0x07, 0x19,
+  0x03, 0x02, 0x04, 0x07, 0x17, 0x04, 0x02, 0x03, 0x07, 0x15, 0x06, 0x02,
+  0x03, 0x08, 0x12, 0x09, 0x01, 0x02, 0x19, 0x01, 0x00, 0x1A, 0x01, 0x07,
+  0x18, 0x01, 0x09, 0x16, 0x02, 0x0A, 0x08, 0x18, 0x06, 0x02, 0x0A, 0x07,
+  0x1A, 0x04, 0x02, 0x0A, 0x07, 0x1B, 0x03, 0x02, 0x09, 0x07, 0x1C, 0x02,
+  0x02, 0x09, 0x07, 0x1C, 0x01, 0x02, 0x09, 0x07, 0x1C, 0x01, 0x01, 0x09,
+  0x07, 0x02, 0x08, 0x07, 0x17, 0x02, 0x02, 0x08, 0x07, 0x17, 0x01, 0x02,
+  0x08, 0x07, 0x16, 0x02, 0x02, 0x08, 0x06, 0x14, 0x04, 0x01, 0x07, 0x11,
+  0x01, 0x07, 0x10, 0x02, 0x07, 0x07, 0x12, 0x05, 0x02, 0x06, 0x07, 0x13,
+  0x04, 0x02, 0x06, 0x07, 0x14, 0x02, 0x02, 0x06, 0x07, 0x14, 0x02, 0x02,
+  0x06, 0x07, 0x14, 0x02, 0x02, 0x05, 0x07, 0x14, 0x01, 0x02, 0x05, 0x07,
+  0x14, 0x01, 0x01, 0x05, 0x07, 0x01, 0x05, 0x06, 0x01, 0x04, 0x07, 0x01,
+  0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x03, 0x08, 0x01, 0x03, 0x08, 0x01,
+  0x02, 0x09, 0x01, 0x00, 0x0E, 0x02, 0x10, 0x08, 0x1E, 0x01, 0x02, 0x0C,
+  0x0F, 0x1C, 0x03, 0x02, 0x0A, 0x08, 0x18, 0x06, 0x02, 0x09, 0x07, 0x19,
+  0x05, 0x02, 0x07, 0x08, 0x1A, 0x04, 0x02, 0x06, 0x08, 0x1A, 0x03, 0x02,
+  0x05, 0x08, 0x1B, 0x02, 0x02, 0x05, 0x07, 0x1B, 0x02, 0x02, 0x04, 0x08,
+  0x1B, 0x01, 0x02, 0x03, 0x08, 0x1B, 0x01, 0x01, 0x03, 0x08, 0x01, 0x02,
+  0x08, 0x01, 0x02, 0x08, 0x01, 0x01, 0x09, 0x01, 0x01, 0x08, 0x01, 0x01,
+  0x08, 0x01, 0x00, 0x09, 0x02, 0x00, 0x09, 0x13, 0x0D, 0x02, 0x00, 0x08,
+  0x15, 0x09, 0x02, 0x00, 0x08, 0x16, 0x07, 0x02, 0x00, 0x08, 0x16, 0x07,
+  0x02, 0x00, 0x08, 0x16, 0x06, 0x02, 0x00, 0x08, 0x16, 0x06, 0x02, 0x00,
+  0x08, 0x15, 0x07, 0x02, 0x01, 0x07, 0x15, 0x07, 0x02, 0x01, 0x07, 0x15,
+  0x06, 0x02, 0x01, 0x08, 0x15, 0x06, 0x02, 0x02, 0x07, 0x14, 0x07, 0x02,
+  0x03, 0x07, 0x14, 0x06, 0x02, 0x04, 0x07, 0x14, 0x06, 0x02, 0x05, 0x07,
+  0x12, 0x07, 0x01, 0x07, 0x10, 0x01, 0x0A, 0x09, 0x02, 0x07, 0x0F, 0x19,
+  0x0E, 0x02, 0x09, 0x0A, 0x1B, 0x0A, 0x02, 0x0A, 0x07, 0x1C, 0x08, 0x02,
+  0x0A, 0x07, 0x1C, 0x07, 0x02, 0x0A, 0x07, 0x1C, 0x07, 0x02, 0x09, 0x07,
+  0x1C, 0x07, 0x02, 0x09, 0x07, 0x1B, 0x07, 0x02, 0x09, 0x07, 0x1B, 0x07,
+  0x02, 0x09, 0x07, 0x1B, 0x07, 0x02, 0x08, 0x07, 0x1A, 0x07, 0x02, 0x08,
+  0x07, 0x1A, 0x07, 0x02, 0x08, 0x07, 0x1A, 0x07, 0x02, 0x08, 0x06, 0x1A,
+  0x07, 0x02, 0x07, 0x07, 0x19, 0x07, 0x01, 0x07, 0x19, 0x01, 0x07, 0x19,
+  0x02, 0x06, 0x07, 0x19, 0x07, 0x02, 0x06, 0x07, 0x18, 0x07, 0x02, 0x06,
+  0x07, 0x18, 0x07, 0x02, 0x06, 0x07, 0x18, 0x07, 0x02, 0x05, 0x07, 0x17,
+  0x07, 0x02, 0x05, 0x07, 0x17, 0x07, 0x02, 0x05, 0x07, 0x17, 0x07, 0x02,
+  0x05, 0x06, 0x17, 0x07, 0x02, 0x04, 0x07, 0x16, 0x07, 0x02, 0x04, 0x07,
+  0x16, 0x07, 0x02, 0x04, 0x07, 0x16, 0x07, 0x02, 0x03, 0x08, 0x15, 0x08,
+  0x02, 0x03, 0x08, 0x15, 0x08, 0x02, 0x02, 0x09, 0x14, 0x09, 0x02, 0x00,
+  0x0E, 0x11, 0x0F, 0x01, 0x07, 0x0E, 0x01, 0x09, 0x09, 0x01, 0x0A, 0x07,
+  0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x09, 0x07, 0x01, 0x09, 0x07,
+  0x01, 0x09, 0x07, 0x01, 0x09, 0x06, 0x01, 0x08, 0x07, 0x01, 0x08, 0x07,
+  0x01, 0x08, 0x07, 0x01, 0x08, 0x06, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07,
+  0x01, 0x07, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07,
+  0x01, 0x06, 0x06, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07,
+  0x01, 0x05, 0x06, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07,
+  0x01, 0x03, 0x08, 0x01, 0x03, 0x07, 0x01, 0x02, 0x09, 0x01, 0x00, 0x0E,
+  0x01, 0x0D, 0x0E, 0x01, 0x0F, 0x0A, 0x01, 0x10, 0x08, 0x01, 0x10, 0x07,
+  0x01, 0x10, 0x07, 0x01, 0x10, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07,
+  0x01, 0x0F, 0x07, 0x01, 0x0F, 0x07, 0x01, 0x0E, 0x07, 0x01, 0x0E, 0x07,
+  0x01, 0x0E, 0x07, 0x01, 0x0E, 0x07, 0x01, 0x0D, 0x07, 0x01, 0x0D, 0x07,
+  0x01, 0x0D, 0x07, 0x01, 0x0D, 0x06, 0x01, 0x0C, 0x07, 0x01, 0x0C, 0x07,
+  0x01, 0x0C, 0x07, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x07,
+  0x01, 0x0B, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07,
+  0x02, 0x01, 0x03, 0x0A, 0x06, 0x02, 0x00, 0x05, 0x09, 0x07, 0x02, 0x00,
+  0x05, 0x09, 0x07, 0x02, 0x00, 0x05, 0x09, 0x06, 0x02, 0x00, 0x05, 0x08,
+  0x06, 0x02, 0x01, 0x04, 0x07, 0x07, 0x01, 0x02, 0x0A, 0x01, 0x04, 0x06,
+  0x02, 0x07, 0x0E, 0x18, 0x0A, 0x02, 0x09, 0x0A, 0x1A, 0x06, 0x02, 0x0A,
+  0x07, 0x1B, 0x03, 0x02, 0x0A, 0x07, 0x1A, 0x03, 0x02, 0x0A, 0x07, 0x19,
+  0x03, 0x02, 0x09, 0x07, 0x18, 0x03, 0x02, 0x09, 0x07, 0x17, 0x03, 0x02,
+  0x09, 0x07, 0x16, 0x03, 0x02, 0x09, 0x07, 0x15, 0x03, 0x02, 0x08, 0x07,
+  0x14, 0x03, 0x02, 0x08, 0x07, 0x13, 0x03, 0x02, 0x08, 0x07, 0x12, 0x03,
+  0x02, 0x08, 0x06, 0x11, 0x02, 0x02, 0x07, 0x07, 0x0F, 0x05, 0x01, 0x07,
+  0x0D, 0x01, 0x07, 0x0E, 0x02, 0x06, 0x07, 0x0E, 0x07, 0x02, 0x06, 0x07,
+  0x0F, 0x07, 0x02, 0x06, 0x07, 0x0F, 0x07, 0x02, 0x06, 0x07, 0x10, 0x07,
+  0x02, 0x05, 0x07, 0x10, 0x07, 0x02, 0x05, 0x07, 0x11, 0x07, 0x02, 0x05,
+  0x07, 0x11, 0x07, 0x02, 0x05, 0x06, 0x12, 0x07, 0x02, 0x04, 0x07, 0x12,
+  0x07, 0x02, 0x04, 0x07, 0x12, 0x07, 0x02, 0x04, 0x07, 0x13, 0x07, 0x02,
+  0x03, 0x07, 0x13, 0x07, 0x02, 0x03, 0x08, 0x14, 0x07, 0x02, 0x02, 0x09,
+  0x13, 0x09, 0x02, 0x00, 0x0E, 0x11, 0x0D, 0x01, 0x07, 0x0E, 0x01, 0x09,
+  0x0A, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x09,
+  0x07, 0x01, 0x09, 0x07, 0x01, 0x09, 0x07, 0x01, 0x09, 0x06, 0x01, 0x08,
+  0x07, 0x01, 0x08, 0x07, 0x01, 0x08, 0x07, 0x01, 0x08, 0x06, 0x01, 0x07,
+  0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06,
+  0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x06, 0x01, 0x05, 0x07, 0x02, 0x05,
+  0x07, 0x1C, 0x01, 0x02, 0x05, 0x07, 0x1B, 0x02, 0x02, 0x05, 0x06, 0x1A,
+  0x02, 0x02, 0x04, 0x07, 0x1A, 0x02, 0x02, 0x04, 0x07, 0x19, 0x03, 0x02,
+  0x04, 0x07, 0x17, 0x05, 0x02, 0x03, 0x07, 0x15, 0x06, 0x02, 0x03, 0x08,
+  0x12, 0x09, 0x01, 0x02, 0x19, 0x01, 0x00, 0x1A, 0x02, 0x07, 0x0B, 0x22,
+  0x0A, 0x02, 0x0A, 0x08, 0x22, 0x08, 0x02, 0x0A, 0x08, 0x21, 0x08, 0x02,
+  0x0A, 0x08, 0x20, 0x09, 0x02, 0x0A, 0x08, 0x20, 0x09, 0x02, 0x0A, 0x08,
+  0x1F, 0x09, 0x03, 0x09, 0x02, 0x0C, 0x06, 0x1E, 0x0A, 0x04, 0x09, 0x02,
+  0x0C, 0x06, 0x1E, 0x02, 0x21, 0x07, 0x04, 0x09, 0x02, 0x0C, 0x07, 0x1D,
+  0x02, 0x21, 0x06, 0x04, 0x09, 0x01, 0x0C, 0x07, 0x1C, 0x03, 0x20, 0x07,
+  0x04, 0x08, 0x02, 0x0C, 0x07, 0x1C, 0x02, 0x20, 0x07, 0x04, 0x08, 0x02,
+  0x0C, 0x07, 0x1B, 0x02, 0x20, 0x07, 0x04, 0x08, 0x02, 0x0C, 0x07, 0x1A,
+  0x03, 0x20, 0x06, 0x04, 0x07, 0x02, 0x0D, 0x06, 0x1A, 0x02, 0x1F, 0x07,
+  0x04, 0x07, 0x02, 0x0D, 0x06, 0x19, 0x02, 0x1F, 0x07, 0x04, 0x07, 0x02,
+  0x0D, 0x06, 0x18, 0x03, 0x1F, 0x07, 0x04, 0x07, 0x02, 0x0D, 0x06, 0x18,
+  0x02, 0x1E, 0x07, 0x04, 0x06, 0x02, 0x0D, 0x07, 0x17, 0x02, 0x1E, 0x07,
+  0x04, 0x06, 0x02, 0x0D, 0x07, 0x16, 0x03, 0x1E, 0x07, 0x04, 0x06, 0x02,
+  0x0D, 0x07, 0x16, 0x02, 0x1E, 0x06, 0x04, 0x05, 0x02, 0x0D, 0x07, 0x15,
+  0x03, 0x1D, 0x07, 0x03, 0x05, 0x02, 0x0E, 0x09, 0x1D, 0x07, 0x03, 0x05,
+  0x02, 0x0E, 0x08, 0x1D, 0x07, 0x03, 0x04, 0x03, 0x0E, 0x08, 0x1D, 0x06,
+  0x03, 0x04, 0x02, 0x0E, 0x07, 0x1C, 0x07, 0x03, 0x04, 0x02, 0x0E, 0x06,
+  0x1C, 0x07, 0x03, 0x04, 0x02, 0x0E, 0x06, 0x1C, 0x07, 0x03, 0x03, 0x03,
+  0x0E, 0x05, 0x1B, 0x07, 0x03, 0x03, 0x03, 0x0E, 0x04, 0x1B, 0x07, 0x03,
+  0x01, 0x06, 0x0E, 0x04, 0x1A, 0x09, 0x03, 0x00, 0x0A, 0x0F, 0x02, 0x17,
+  0x0F, 0x01, 0x0F, 0x01, 0x02, 0x06, 0x0A, 0x1B, 0x0A, 0x02, 0x09, 0x07,
+  0x1D, 0x06, 0x02, 0x0A, 0x07, 0x1E, 0x04, 0x02, 0x0A, 0x07, 0x1E, 0x03,
+  0x02, 0x0A, 0x08, 0x1E, 0x03, 0x02, 0x0A, 0x08, 0x1E, 0x02, 0x03, 0x09,
+  0x02, 0x0C, 0x07, 0x1E, 0x02, 0x03, 0x09, 0x02, 0x0C, 0x07, 0x1E, 0x02,
+  0x03, 0x09, 0x02, 0x0D, 0x07, 0x1D, 0x03, 0x03, 0x09, 0x01, 0x0D, 0x07,
+  0x1D, 0x02, 0x03, 0x08, 0x02, 0x0E, 0x07, 0x1D, 0x02, 0x03, 0x08, 0x02,
+  0x0E, 0x07, 0x1D, 0x02, 0x03, 0x08, 0x02, 0x0F, 0x07, 0x1C, 0x02, 0x03,
+  0x07, 0x02, 0x0F, 0x07, 0x1C, 0x02, 0x03, 0x07, 0x02, 0x0F, 0x08, 0x1C,
+  0x02, 0x03, 0x07, 0x02, 0x10, 0x07, 0x1C, 0x02, 0x03, 0x07, 0x02, 0x10,
+  0x08, 0x1B, 0x02, 0x03, 0x06, 0x02, 0x11, 0x07, 0x1B, 0x02, 0x03, 0x06,
+  0x02, 0x11, 0x07, 0x1B, 0x02, 0x03, 0x06, 0x02, 0x12, 0x07, 0x1A, 0x02,
+  0x03, 0x05, 0x02, 0x12, 0x07, 0x1A, 0x02, 0x02, 0x05, 0x02, 0x13, 0x09,
+  0x02, 0x05, 0x02, 0x13, 0x09, 0x02, 0x04, 0x03, 0x14, 0x07, 0x02, 0x04,
+  0x02, 0x14, 0x07, 0x02, 0x04, 0x02, 0x15, 0x06, 0x02, 0x04, 0x02, 0x15,
+  0x05, 0x02, 0x03, 0x03, 0x16, 0x04, 0x02, 0x03, 0x03, 0x16, 0x04, 0x02,
+  0x01, 0x06, 0x16, 0x04, 0x02, 0x00, 0x0A, 0x17, 0x02, 0x01, 0x17, 0x02,
+  0x01, 0x10, 0x07, 0x01, 0x0D, 0x0D, 0x02, 0x0B, 0x06, 0x15, 0x06, 0x02,
+  0x0A, 0x05, 0x17, 0x05, 0x02, 0x08, 0x06, 0x17, 0x06, 0x02, 0x07, 0x06,
+  0x18, 0x06, 0x02, 0x06, 0x07, 0x18, 0x06, 0x02, 0x05, 0x07, 0x18, 0x06,
+  0x02, 0x05, 0x07, 0x18, 0x07, 0x02, 0x04, 0x07, 0x18, 0x07, 0x02, 0x03,
+  0x08, 0x18, 0x07, 0x02, 0x03, 0x07, 0x18, 0x07, 0x02, 0x02, 0x08, 0x17,
+  0x08, 0x02, 0x02, 0x07, 0x17, 0x08, 0x02, 0x01, 0x08, 0x17, 0x08, 0x02,
+  0x01, 0x08, 0x17, 0x07, 0x02, 0x01, 0x08, 0x16, 0x08, 0x02, 0x01, 0x07,
+  0x16, 0x08, 0x02, 0x00, 0x08, 0x16, 0x08, 0x02, 0x00, 0x08, 0x15, 0x08,
+  0x02, 0x00, 0x08, 0x15, 0x08, 0x02, 0x00, 0x07, 0x15, 0x07, 0x02, 0x00,
+  0x07, 0x14, 0x08, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x13,
+  0x07, 0x02, 0x01, 0x06, 0x13, 0x07, 0x02, 0x01, 0x06, 0x12, 0x07, 0x02,
+  0x01, 0x06, 0x11, 0x07, 0x02, 0x02, 0x06, 0x11, 0x06, 0x02, 0x03, 0x05,
+  0x10, 0x05, 0x02, 0x04, 0x05, 0x0E, 0x06, 0x01, 0x05, 0x0D, 0x01, 0x07,
+  0x08, 0x01, 0x07, 0x12, 0x01, 0x09, 0x13, 0x02, 0x0A, 0x07, 0x15, 0x08,
+  0x02, 0x0A, 0x07, 0x16, 0x08, 0x02, 0x0A, 0x06, 0x17, 0x07, 0x02, 0x09,
+  0x07, 0x17, 0x08, 0x02, 0x09, 0x07, 0x17, 0x08, 0x02, 0x09, 0x07, 0x17,
+  0x08, 0x02, 0x09, 0x06, 0x17, 0x08, 0x02, 0x08, 0x07, 0x17, 0x08, 0x02,
+  0x08, 0x07, 0x16, 0x09, 0x02, 0x08, 0x07, 0x16, 0x08, 0x02, 0x08, 0x06,
+  0x15, 0x08, 0x02, 0x07, 0x07, 0x14, 0x08, 0x02, 0x07, 0x07, 0x13, 0x08,
+  0x01, 0x07, 0x12, 0x01, 0x06, 0x10, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07,
+  0x01, 0x06, 0x06, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07,
+  0x01, 0x05, 0x06, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07,
+  0x01, 0x03, 0x07, 0x01, 0x03, 0x07, 0x01, 0x02, 0x09, 0x01, 0x00, 0x0E,
+  0x01, 0x10, 0x07, 0x01, 0x0D, 0x0C, 0x02, 0x0B, 0x06, 0x15, 0x06, 0x02,
+  0x0A, 0x05, 0x17, 0x05, 0x02, 0x08, 0x06, 0x17, 0x06, 0x02, 0x07, 0x07,
+  0x18, 0x06, 0x02, 0x06, 0x07, 0x18, 0x06, 0x02, 0x05, 0x07, 0x18, 0x06,
+  0x02, 0x05, 0x07, 0x18, 0x07, 0x02, 0x04, 0x07, 0x18, 0x07, 0x02, 0x03,
+  0x08, 0x18, 0x07, 0x02, 0x03, 0x07, 0x18, 0x07, 0x02, 0x02, 0x08, 0x17,
+  0x08, 0x02, 0x02, 0x08, 0x17, 0x08, 0x02, 0x01, 0x08, 0x17, 0x08, 0x02,
+  0x01, 0x08, 0x17, 0x08, 0x02, 0x01, 0x08, 0x17, 0x07, 0x02, 0x01, 0x07,
+  0x16, 0x08, 0x02, 0x00, 0x08, 0x16, 0x08, 0x02, 0x00, 0x08, 0x16, 0x07,
+  0x02, 0x00, 0x08, 0x15, 0x08, 0x02, 0x00, 0x07, 0x15, 0x07, 0x02, 0x00,
+  0x07, 0x15, 0x07, 0x02, 0x00, 0x07, 0x14, 0x07, 0x02, 0x00, 0x07, 0x14,
+  0x07, 0x02, 0x00, 0x07, 0x13, 0x07, 0x02, 0x01, 0x06, 0x13, 0x06, 0x02,
+  0x01, 0x06, 0x12, 0x06, 0x02, 0x02, 0x05, 0x11, 0x06, 0x02, 0x02, 0x06,
+  0x10, 0x06, 0x02, 0x04, 0x05, 0x0F, 0x06, 0x02, 0x05, 0x06, 0x0D, 0x06,
+  0x01, 0x07, 0x09, 0x01, 0x08, 0x02, 0x01, 0x07, 0x02, 0x02, 0x06, 0x03,
+  0x1B, 0x02, 0x02, 0x05, 0x0A, 0x1A, 0x02, 0x02, 0x03, 0x0F, 0x18, 0x03,
+  0x01, 0x02, 0x18, 0x01, 0x01, 0x18, 0x02, 0x00, 0x03, 0x0A, 0x0E, 0x01,
+  0x0D, 0x08, 0x01, 0x07, 0x13, 0x01, 0x09, 0x14, 0x02, 0x0A, 0x08, 0x16,
+  0x08, 0x02, 0x0A, 0x07, 0x17, 0x08, 0x02, 0x0A, 0x07, 0x18, 0x08, 0x02,
+  0x09, 0x08, 0x18, 0x08, 0x02, 0x09, 0x07, 0x18, 0x08, 0x02, 0x09, 0x07,
+  0x18, 0x08, 0x02, 0x09, 0x07, 0x18, 0x08, 0x02, 0x08, 0x08, 0x17, 0x08,
+  0x02, 0x08, 0x07, 0x17, 0x08, 0x02, 0x08, 0x07, 0x16, 0x08, 0x02, 0x08,
+  0x07, 0x15, 0x08, 0x02, 0x07, 0x07, 0x13, 0x09, 0x01, 0x07, 0x13, 0x01,
+  0x07, 0x10, 0x02, 0x06, 0x08, 0x0F, 0x08, 0x02, 0x06, 0x07, 0x10, 0x08,
+  0x02, 0x06, 0x07, 0x10, 0x08, 0x02, 0x06, 0x07, 0x10, 0x08, 0x02, 0x05,
+  0x08, 0x11, 0x08, 0x02, 0x05, 0x07, 0x11, 0x08, 0x02, 0x05, 0x07, 0x12,
+  0x07, 0x02, 0x05, 0x07, 0x12, 0x08, 0x02, 0x04, 0x07, 0x12, 0x08, 0x02,
+  0x04, 0x07, 0x13, 0x07, 0x02, 0x04, 0x07, 0x13, 0x08, 0x02, 0x03, 0x08,
+  0x13, 0x08, 0x02, 0x03, 0x08, 0x14, 0x08, 0x02, 0x02, 0x0A, 0x14, 0x09,
+  0x02, 0x00, 0x0E, 0x14, 0x0B, 0x02, 0x0B, 0x06, 0x16, 0x02, 0x02, 0x09,
+  0x0B, 0x15, 0x03, 0x02, 0x08, 0x05, 0x11, 0x06, 0x02, 0x07, 0x04, 0x13,
+  0x04, 0x02, 0x06, 0x04, 0x14, 0x03, 0x02, 0x06, 0x04, 0x14, 0x03, 0x02,
+  0x05, 0x05, 0x14, 0x03, 0x02, 0x05, 0x05, 0x15, 0x01, 0x02, 0x05, 0x05,
+  0x15, 0x01, 0x02, 0x05, 0x06, 0x15, 0x01, 0x01, 0x05, 0x07, 0x01, 0x05,
+  0x08, 0x01, 0x06, 0x08, 0x01, 0x06, 0x0A, 0x01, 0x07, 0x0A, 0x01, 0x08,
+  0x0A, 0x01, 0x09, 0x0A, 0x01, 0x0A, 0x09, 0x01, 0x0B, 0x09, 0x01, 0x0C,
+  0x08, 0x01, 0x0D, 0x08, 0x01, 0x0E, 0x07, 0x01, 0x0F, 0x06, 0x02, 0x02,
+  0x01, 0x10, 0x05, 0x02, 0x02, 0x01, 0x10, 0x05, 0x02, 0x02, 0x01, 0x10,
+  0x05, 0x02, 0x01, 0x03, 0x10, 0x05, 0x02, 0x01, 0x03, 0x10, 0x04, 0x02,
+  0x01, 0x04, 0x0F, 0x05, 0x02, 0x01, 0x04, 0x0E, 0x05, 0x02, 0x01, 0x06,
+  0x0D, 0x05, 0x02, 0x01, 0x01, 0x05, 0x0C, 0x02, 0x00, 0x02, 0x08, 0x06,
+  0x01, 0x02, 0x19, 0x01, 0x02, 0x19, 0x03, 0x02, 0x07, 0x0C, 0x07, 0x16,
+  0x05, 0x03, 0x02, 0x04, 0x0C, 0x07, 0x17, 0x04, 0x03, 0x02, 0x03, 0x0B,
+  0x07, 0x18, 0x03, 0x03, 0x02, 0x02, 0x0B, 0x07, 0x18, 0x02, 0x03, 0x01,
+  0x02, 0x0B, 0x07, 0x19, 0x01, 0x03, 0x01, 0x02, 0x0B, 0x06, 0x19, 0x01,
+  0x02, 0x0A, 0x07, 0x19, 0x01, 0x01, 0x0A, 0x07, 0x01, 0x0A, 0x07, 0x01,
+  0x09, 0x07, 0x01, 0x09, 0x07, 0x01, 0x09, 0x07, 0x01, 0x09, 0x06, 0x01,
+  0x08, 0x07, 0x01, 0x08, 0x07, 0x01, 0x08, 0x07, 0x01, 0x08, 0x06, 0x01,
+  0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x06, 0x07, 0x01,
+  0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x06, 0x01, 0x05, 0x07, 0x01,
+  0x05, 0x07, 0x01, 0x04, 0x08, 0x01, 0x03, 0x0A, 0x01, 0x00, 0x10, 0x02,
+  0x01, 0x0F, 0x16, 0x0A, 0x02, 0x04, 0x0A, 0x18, 0x06, 0x02, 0x05, 0x07,
+  0x1A, 0x03, 0x02, 0x05, 0x07, 0x1A, 0x03, 0x02, 0x05, 0x07, 0x1A, 0x02,
+  0x02, 0x04, 0x07, 0x1A, 0x02, 0x02, 0x04, 0x07, 0x19, 0x03, 0x02, 0x04,
+  0x07, 0x19, 0x02, 0x02, 0x04, 0x07, 0x19, 0x02, 0x02, 0x03, 0x07, 0x18,
+  0x03, 0x02, 0x03, 0x07, 0x18, 0x02, 0x02, 0x03, 0x07, 0x18, 0x02, 0x02,
+  0x02, 0x07, 0x18, 0x02, 0x02, 0x02, 0x07, 0x17, 0x02, 0x02, 0x02, 0x07,
+  0x17, 0x02, 0x02, 0x02, 0x07, 0x17, 0x02, 0x02, 0x01, 0x07, 0x17, 0x02,
+  0x02, 0x01, 0x07, 0x16, 0x02, 0x02, 0x01, 0x07, 0x16, 0x02, 0x02, 0x01,
+  0x06, 0x16, 0x02, 0x02, 0x00, 0x07, 0x15, 0x02, 0x02, 0x00, 0x07, 0x15,
+  0x02, 0x02, 0x00, 0x06, 0x15, 0x02, 0x02, 0x00, 0x06, 0x14, 0x03, 0x02,
+  0x00, 0x06, 0x14, 0x02, 0x02, 0x00, 0x06, 0x13, 0x03, 0x02, 0x00, 0x06,
+  0x13, 0x02, 0x02, 0x01, 0x06, 0x12, 0x03, 0x02, 0x01, 0x06, 0x11, 0x03,
+  0x02, 0x02, 0x07, 0x0F, 0x04, 0x01, 0x04, 0x0D, 0x01, 0x06, 0x09, 0x02,
+  0x00, 0x0E, 0x16, 0x09, 0x02, 0x02, 0x0A, 0x18, 0x06, 0x02, 0x03, 0x08,
+  0x19, 0x03, 0x02, 0x03, 0x08, 0x19, 0x03, 0x02, 0x04, 0x07, 0x18, 0x03,
+  0x02, 0x04, 0x07, 0x18, 0x02, 0x02, 0x04, 0x07, 0x17, 0x03, 0x02, 0x04,
+  0x07, 0x17, 0x02, 0x02, 0x04, 0x08, 0x16, 0x03, 0x02, 0x04, 0x08, 0x15,
+  0x03, 0x02, 0x05, 0x07, 0x15, 0x02, 0x02, 0x05, 0x07, 0x14, 0x03, 0x02,
+  0x05, 0x07, 0x14, 0x02, 0x02, 0x05, 0x07, 0x13, 0x02, 0x02, 0x05, 0x07,
+  0x12, 0x03, 0x02, 0x05, 0x07, 0x12, 0x02, 0x02, 0x05, 0x08, 0x11, 0x02,
+  0x02, 0x06, 0x07, 0x10, 0x03, 0x02, 0x06, 0x07, 0x10, 0x02, 0x02, 0x06,
+  0x07, 0x0F, 0x02, 0x02, 0x06, 0x07, 0x0E, 0x03, 0x02, 0x06, 0x07, 0x0E,
+  0x02, 0x01, 0x06, 0x0A, 0x01, 0x07, 0x08, 0x01, 0x07, 0x07, 0x01, 0x07,
+  0x07, 0x01, 0x07, 0x06, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07,
+  0x04, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x03, 0x00, 0x0D, 0x10, 0x0C,
+  0x20, 0x09, 0x03, 0x02, 0x0A, 0x12, 0x08, 0x23, 0x05, 0x03, 0x03, 0x08,
+  0x13, 0x06, 0x23, 0x03, 0x03, 0x03, 0x07, 0x13, 0x06, 0x23, 0x03, 0x03,
+  0x04, 0x07, 0x13, 0x06, 0x23, 0x02, 0x03, 0x04, 0x07, 0x13, 0x06, 0x23,
+  0x02, 0x03, 0x04, 0x07, 0x13, 0x07, 0x22, 0x02, 0x03, 0x04, 0x07, 0x12,
+  0x08, 0x22, 0x02, 0x03, 0x04, 0x07, 0x12, 0x08, 0x21, 0x02, 0x04, 0x04,
+  0x07, 0x11, 0x02, 0x14, 0x06, 0x21, 0x02, 0x04, 0x04, 0x07, 0x11, 0x02,
+  0x14, 0x06, 0x20, 0x02, 0x04, 0x05, 0x06, 0x10, 0x02, 0x14, 0x06, 0x20,
+  0x02, 0x04, 0x05, 0x06, 0x10, 0x02, 0x14, 0x07, 0x1F, 0x02, 0x04, 0x05,
+  0x07, 0x10, 0x01, 0x14, 0x07, 0x1F, 0x02, 0x04, 0x05, 0x07, 0x0F, 0x02,
+  0x14, 0x07, 0x1E, 0x02, 0x04, 0x05, 0x07, 0x0F, 0x01, 0x14, 0x07, 0x1E,
+  0x02, 0x04, 0x05, 0x07, 0x0E, 0x02, 0x15, 0x06, 0x1D, 0x02, 0x04, 0x05,
+  0x07, 0x0E, 0x02, 0x15, 0x06, 0x1D, 0x02, 0x04, 0x05, 0x07, 0x0D, 0x02,
+  0x15, 0x06, 0x1C, 0x02, 0x04, 0x06, 0x06, 0x0D, 0x02, 0x15, 0x06, 0x1C,
+  0x02, 0x02, 0x06, 0x08, 0x15, 0x08, 0x02, 0x06, 0x08, 0x15, 0x08, 0x02,
+  0x06, 0x07, 0x15, 0x07, 0x02, 0x06, 0x07, 0x15, 0x07, 0x02, 0x06, 0x06,
+  0x15, 0x06, 0x02, 0x06, 0x06, 0x16, 0x05, 0x02, 0x07, 0x04, 0x16, 0x04,
+  0x02, 0x07, 0x04, 0x16, 0x04, 0x02, 0x07, 0x03, 0x16, 0x03, 0x02, 0x07,
+  0x03, 0x16, 0x03, 0x02, 0x07, 0x02, 0x16, 0x02, 0x02, 0x07, 0x02, 0x16,
+  0x02, 0x02, 0x06, 0x0E, 0x18, 0x0A, 0x02, 0x08, 0x09, 0x1A, 0x06, 0x02,
+  0x0A, 0x07, 0x1B, 0x04, 0x02, 0x0A, 0x07, 0x1A, 0x03, 0x02, 0x0A, 0x07,
+  0x19, 0x03, 0x02, 0x0B, 0x06, 0x19, 0x02, 0x02, 0x0B, 0x07, 0x18, 0x02,
+  0x02, 0x0B, 0x07, 0x17, 0x02, 0x02, 0x0C, 0x06, 0x16, 0x02, 0x02, 0x0C,
+  0x07, 0x15, 0x02, 0x02, 0x0C, 0x07, 0x14, 0x02, 0x01, 0x0D, 0x08, 0x01,
+  0x0D, 0x08, 0x01, 0x0D, 0x07, 0x01, 0x0D, 0x07, 0x01, 0x0E, 0x06, 0x01,
+  0x0E, 0x07, 0x01, 0x0D, 0x08, 0x01, 0x0C, 0x09, 0x02, 0x0B, 0x03, 0x0F,
+  0x07, 0x02, 0x0A, 0x03, 0x0F, 0x07, 0x02, 0x09, 0x03, 0x10, 0x06, 0x02,
+  0x09, 0x02, 0x10, 0x07, 0x02, 0x08, 0x02, 0x10, 0x07, 0x02, 0x07, 0x02,
+  0x11, 0x06, 0x02, 0x06, 0x03, 0x11, 0x07, 0x02, 0x05, 0x03, 0x11, 0x07,
+  0x02, 0x04, 0x03, 0x11, 0x07, 0x02, 0x03, 0x04, 0x11, 0x08, 0x02, 0x01,
+  0x07, 0x11, 0x09, 0x02, 0x00, 0x0A, 0x0E, 0x0F, 0x02, 0x00, 0x0D, 0x12,
+  0x0A, 0x02, 0x02, 0x08, 0x14, 0x06, 0x02, 0x03, 0x07, 0x15, 0x04, 0x02,
+  0x03, 0x07, 0x15, 0x03, 0x02, 0x04, 0x06, 0x14, 0x03, 0x02, 0x04, 0x07,
+  0x14, 0x02, 0x02, 0x04, 0x07, 0x13, 0x03, 0x02, 0x05, 0x06, 0x12, 0x03,
+  0x02, 0x05, 0x07, 0x12, 0x02, 0x02, 0x05, 0x07, 0x11, 0x02, 0x02, 0x06,
+  0x06, 0x10, 0x03, 0x02, 0x06, 0x07, 0x10, 0x02, 0x02, 0x06, 0x07, 0x0F,
+  0x02, 0x02, 0x07, 0x06, 0x0E, 0x02, 0x01, 0x07, 0x09, 0x01, 0x07, 0x08,
+  0x01, 0x08, 0x06, 0x01, 0x07, 0x07, 0x01, 0x07, 0x07, 0x01, 0x07, 0x06,
+  0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x07, 0x01, 0x06, 0x06,
+  0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x05, 0x07, 0x01, 0x04, 0x07,
+  0x01, 0x04, 0x08, 0x01, 0x03, 0x09, 0x01, 0x00, 0x0F, 0x01, 0x06, 0x16,
+  0x01, 0x06, 0x16, 0x02, 0x06, 0x07, 0x14, 0x08, 0x02, 0x05, 0x05, 0x13,
+  0x08, 0x02, 0x05, 0x04, 0x12, 0x08, 0x02, 0x05, 0x03, 0x12, 0x07, 0x02,
+  0x05, 0x02, 0x11, 0x08, 0x02, 0x04, 0x02, 0x10, 0x08, 0x02, 0x04, 0x01,
+  0x0F, 0x08, 0x01, 0x0F, 0x07, 0x01, 0x0E, 0x08, 0x01, 0x0D, 0x08, 0x01,
+  0x0C, 0x08, 0x01, 0x0C, 0x07, 0x01, 0x0B, 0x08, 0x01, 0x0A, 0x08, 0x01,
+  0x09, 0x08, 0x01, 0x09, 0x08, 0x01, 0x08, 0x08, 0x01, 0x07, 0x08, 0x01,
+  0x06, 0x08, 0x01, 0x06, 0x08, 0x02, 0x05, 0x08, 0x18, 0x02, 0x02, 0x04,
+  0x08, 0x18, 0x02, 0x02, 0x03, 0x08, 0x17, 0x02, 0x02, 0x03, 0x08, 0x16,
+  0x03, 0x02, 0x02, 0x08, 0x15, 0x04, 0x02, 0x01, 0x08, 0x13, 0x05, 0x02,
+  0x00, 0x08, 0x10, 0x08, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x09,
+  0x0A, 0x01, 0x09, 0x0A, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x08,
+  0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x07,
+  0x04, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06,
+  0x04, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01,
+  0x0A, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06,
+  0x04, 0x01, 0x06, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07,
+  0x04, 0x01, 0x08, 0x03, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x0A, 0x01, 0x09,
+  0x0A, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x04, 0x01, 0x0D, 0x05, 0x01, 0x0D,
+  0x05, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x04, 0x01, 0x0C, 0x05, 0x01, 0x0C,
+  0x05, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x04, 0x01, 0x0B, 0x05, 0x01, 0x0B,
+  0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x04, 0x01, 0x0A, 0x05, 0x01, 0x0A,
+  0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x05, 0x01, 0x09,
+  0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08,
+  0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x07, 0x05, 0x01, 0x07,
+  0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x01, 0x09, 0x01, 0x00,
+  0x0A, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x07, 0x01, 0x07,
+  0x07, 0x01, 0x06, 0x08, 0x02, 0x06, 0x04, 0x0B, 0x04, 0x02, 0x05, 0x04,
+  0x0B, 0x04, 0x02, 0x05, 0x04, 0x0C, 0x04, 0x02, 0x04, 0x04, 0x0C, 0x04,
+  0x02, 0x04, 0x04, 0x0D, 0x04, 0x02, 0x03, 0x05, 0x0D, 0x04, 0x02, 0x03,
+  0x04, 0x0E, 0x04, 0x02, 0x02, 0x05, 0x0E, 0x04, 0x02, 0x02, 0x04, 0x0F,
+  0x04, 0x02, 0x01, 0x05, 0x0F, 0x04, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02,
+  0x00, 0x05, 0x10, 0x04, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00,
+  0x18, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x06, 0x01, 0x02, 0x05, 0x01, 0x03, 0x04, 0x01, 0x04, 0x04, 0x01, 0x06,
+  0x03, 0x01, 0x07, 0x03, 0x02, 0x0A, 0x04, 0x14, 0x02, 0x02, 0x08, 0x07,
+  0x11, 0x05, 0x02, 0x07, 0x05, 0x0E, 0x07, 0x02, 0x06, 0x05, 0x0F, 0x06,
+  0x02, 0x05, 0x05, 0x0F, 0x06, 0x02, 0x04, 0x06, 0x0F, 0x05, 0x02, 0x04,
+  0x05, 0x0F, 0x05, 0x02, 0x03, 0x06, 0x0F, 0x05, 0x02, 0x02, 0x06, 0x0F,
+  0x05, 0x02, 0x02, 0x06, 0x0E, 0x05, 0x02, 0x01, 0x06, 0x0E, 0x05, 0x02,
+  0x01, 0x06, 0x0E, 0x05, 0x02, 0x01, 0x06, 0x0E, 0x04, 0x02, 0x00, 0x07,
+  0x0D, 0x05, 0x02, 0x00, 0x06, 0x0D, 0x05, 0x02, 0x00, 0x06, 0x0C, 0x06,
+  0x02, 0x00, 0x06, 0x0C, 0x05, 0x03, 0x00, 0x06, 0x0B, 0x06, 0x14, 0x02,
+  0x04, 0x00, 0x06, 0x0A, 0x01, 0x0C, 0x05, 0x14, 0x01, 0x04, 0x00, 0x07,
+  0x09, 0x02, 0x0C, 0x05, 0x13, 0x01, 0x02, 0x01, 0x09, 0x0C, 0x07, 0x02,
+  0x02, 0x07, 0x0C, 0x06, 0x02, 0x03, 0x04, 0x0D, 0x04, 0x01, 0x09, 0x05,
+  0x01, 0x04, 0x0A, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06,
+  0x01, 0x07, 0x06, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x06, 0x06,
+  0x01, 0x06, 0x05, 0x02, 0x06, 0x05, 0x0E, 0x05, 0x02, 0x05, 0x06, 0x0D,
+  0x07, 0x02, 0x05, 0x06, 0x0C, 0x09, 0x03, 0x05, 0x05, 0x0B, 0x01, 0x0F,
+  0x07, 0x02, 0x05, 0x06, 0x10, 0x06, 0x02, 0x04, 0x07, 0x10, 0x06, 0x02,
+  0x04, 0x06, 0x10, 0x06, 0x02, 0x04, 0x06, 0x10, 0x06, 0x02, 0x03, 0x06,
+  0x10, 0x06, 0x02, 0x03, 0x06, 0x10, 0x06, 0x02, 0x03, 0x05, 0x0F, 0x06,
+  0x02, 0x03, 0x05, 0x0F, 0x06, 0x02, 0x02, 0x06, 0x0F, 0x06, 0x02, 0x02,
+  0x06, 0x0E, 0x06, 0x02, 0x02, 0x05, 0x0E, 0x06, 0x02, 0x01, 0x06, 0x0E,
+  0x05, 0x02, 0x01, 0x06, 0x0D, 0x05, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x02,
+  0x00, 0x06, 0x0C, 0x04, 0x02, 0x00, 0x06, 0x0B, 0x04, 0x02, 0x00, 0x06,
+  0x09, 0x05, 0x01, 0x01, 0x0C, 0x01, 0x04, 0x06, 0x01, 0x0A, 0x06, 0x01,
+  0x08, 0x09, 0x02, 0x07, 0x04, 0x0E, 0x04, 0x02, 0x06, 0x04, 0x0E, 0x04,
+  0x02, 0x05, 0x04, 0x0D, 0x05, 0x02, 0x04, 0x05, 0x0D, 0x05, 0x02, 0x03,
+  0x05, 0x0E, 0x03, 0x01, 0x02, 0x06, 0x01, 0x02, 0x05, 0x01, 0x01, 0x06,
+  0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x06,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x06, 0x02, 0x00, 0x06, 0x0E, 0x02, 0x02,
+  0x00, 0x06, 0x0E, 0x02, 0x02, 0x00, 0x07, 0x0D, 0x02, 0x02, 0x01, 0x07,
+  0x0B, 0x03, 0x01, 0x02, 0x0B, 0x01, 0x03, 0x09, 0x01, 0x04, 0x06, 0x01,
+  0x18, 0x01, 0x01, 0x13, 0x06, 0x01, 0x0F, 0x0A, 0x01, 0x12, 0x07, 0x01,
+  0x12, 0x06, 0x01, 0x12, 0x06, 0x01, 0x12, 0x06, 0x01, 0x12, 0x05, 0x01,
+  0x11, 0x06, 0x01, 0x11, 0x06, 0x01, 0x11, 0x06, 0x02, 0x0A, 0x04, 0x10,
+  0x06, 0x01, 0x08, 0x0E, 0x02, 0x07, 0x05, 0x0E, 0x08, 0x02, 0x06, 0x05,
+  0x0F, 0x07, 0x02, 0x05, 0x05, 0x0F, 0x06, 0x02, 0x04, 0x06, 0x0F, 0x06,
+  0x02, 0x04, 0x05, 0x0F, 0x06, 0x02, 0x03, 0x06, 0x0F, 0x05, 0x02, 0x02,
+  0x06, 0x0E, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x02, 0x01, 0x06, 0x0E,
+  0x06, 0x02, 0x01, 0x06, 0x0E, 0x05, 0x02, 0x01, 0x06, 0x0D, 0x06, 0x02,
+  0x00, 0x07, 0x0D, 0x06, 0x02, 0x00, 0x06, 0x0C, 0x06, 0x02, 0x00, 0x06,
+  0x0C, 0x06, 0x02, 0x00, 0x06, 0x0B, 0x07, 0x03, 0x00, 0x06, 0x0B, 0x06,
+  0x14, 0x02, 0x03, 0x00, 0x06, 0x0A, 0x07, 0x13, 0x02, 0x04, 0x00, 0x07,
+  0x09, 0x02, 0x0C, 0x05, 0x12, 0x02, 0x02, 0x01, 0x09, 0x0C, 0x07, 0x02,
+  0x01, 0x08, 0x0C, 0x06, 0x02, 0x03, 0x05, 0x0D, 0x04, 0x01, 0x0A, 0x06,
+  0x01, 0x08, 0x09, 0x02, 0x07, 0x04, 0x0E, 0x04, 0x02, 0x06, 0x04, 0x0E,
+  0x04, 0x02, 0x05, 0x04, 0x0E, 0x04, 0x02, 0x04, 0x05, 0x0E, 0x04, 0x02,
+  0x03, 0x05, 0x0E, 0x04, 0x02, 0x02, 0x06, 0x0D, 0x04, 0x02, 0x02, 0x06,
+  0x0C, 0x05, 0x02, 0x01, 0x06, 0x0C, 0x04, 0x02, 0x01, 0x06, 0x0A, 0x05,
+  0x02, 0x01, 0x06, 0x08, 0x05, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x08, 0x01,
+  0x00, 0x06, 0x01, 0x00, 0x06, 0x02, 0x00, 0x06, 0x0E, 0x02, 0x02, 0x00,
+  0x06, 0x0D, 0x02, 0x02, 0x00, 0x06, 0x0C, 0x02, 0x02, 0x01, 0x06, 0x0B,
+  0x03, 0x01, 0x01, 0x0C, 0x01, 0x03, 0x09, 0x01, 0x04, 0x06, 0x01, 0x14,
+  0x06, 0x02, 0x12, 0x04, 0x18, 0x03, 0x02, 0x11, 0x04, 0x18, 0x04, 0x02,
+  0x10, 0x05, 0x18, 0x04, 0x02, 0x10, 0x04, 0x18, 0x04, 0x02, 0x0F, 0x05,
+  0x19, 0x02, 0x01, 0x0F, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01,
+  0x0E, 0x05, 0x01, 0x0D, 0x06, 0x01, 0x0A, 0x0C, 0x01, 0x0A, 0x0C, 0x01,
+  0x0C, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01,
+  0x0B, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x0B, 0x05, 0x01,
+  0x0A, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x0A, 0x05, 0x01,
+  0x0A, 0x05, 0x01, 0x09, 0x06, 0x01, 0x09, 0x06, 0x01, 0x09, 0x05, 0x01,
+  0x09, 0x05, 0x01, 0x08, 0x06, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01,
+  0x08, 0x05, 0x01, 0x07, 0x05, 0x02, 0x01, 0x02, 0x07, 0x05, 0x02, 0x00,
+  0x04, 0x07, 0x04, 0x02, 0x00, 0x04, 0x06, 0x05, 0x02, 0x00, 0x04, 0x06,
+  0x04, 0x01, 0x01, 0x08, 0x01, 0x02, 0x05, 0x01, 0x0B, 0x06, 0x01, 0x08,
+  0x0B, 0x02, 0x07, 0x06, 0x10, 0x09, 0x02, 0x06, 0x05, 0x11, 0x08, 0x02,
+  0x05, 0x06, 0x11, 0x05, 0x02, 0x04, 0x06, 0x11, 0x05, 0x02, 0x04, 0x06,
+  0x11, 0x05, 0x02, 0x04, 0x05, 0x10, 0x06, 0x02, 0x04, 0x05, 0x10, 0x06,
+  0x02, 0x04, 0x05, 0x0F, 0x06, 0x02, 0x05, 0x04, 0x0E, 0x06, 0x02, 0x06,
+  0x04, 0x0D, 0x06, 0x01, 0x07, 0x0B, 0x01, 0x07, 0x08, 0x01, 0x05, 0x03,
+  0x01, 0x04, 0x04, 0x01, 0x03, 0x06, 0x01, 0x03, 0x09, 0x01, 0x03, 0x0C,
+  0x01, 0x04, 0x0E, 0x01, 0x05, 0x0E, 0x02, 0x04, 0x03, 0x08, 0x0C, 0x02,
+  0x02, 0x04, 0x0B, 0x09, 0x02, 0x01, 0x04, 0x0E, 0x06, 0x02, 0x00, 0x04,
+  0x0F, 0x05, 0x02, 0x00, 0x04, 0x0F, 0x05, 0x02, 0x00, 0x04, 0x0F, 0x04,
+  0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x01, 0x05, 0x0D, 0x04, 0x01, 0x02,
+  0x0E, 0x01, 0x05, 0x08, 0x01, 0x0D, 0x01, 0x01, 0x08, 0x06, 0x01, 0x05,
+  0x09, 0x01, 0x08, 0x06, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07,
+  0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x06,
+  0x06, 0x02, 0x06, 0x06, 0x10, 0x05, 0x02, 0x06, 0x05, 0x0F, 0x07, 0x02,
+  0x05, 0x06, 0x0E, 0x08, 0x03, 0x05, 0x06, 0x0D, 0x02, 0x11, 0x05, 0x03,
+  0x05, 0x05, 0x0C, 0x02, 0x11, 0x05, 0x03, 0x05, 0x05, 0x0B, 0x02, 0x11,
+  0x05, 0x03, 0x04, 0x06, 0x0B, 0x01, 0x11, 0x05, 0x02, 0x04, 0x07, 0x10,
+  0x06, 0x02, 0x04, 0x07, 0x10, 0x06, 0x02, 0x04, 0x06, 0x10, 0x06, 0x02,
+  0x03, 0x07, 0x0F, 0x06, 0x02, 0x03, 0x06, 0x0F, 0x06, 0x02, 0x03, 0x06,
+  0x0F, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x06,
+  0x02, 0x02, 0x06, 0x0E, 0x06, 0x03, 0x02, 0x05, 0x0D, 0x06, 0x16, 0x01,
+  0x03, 0x01, 0x06, 0x0D, 0x06, 0x15, 0x02, 0x03, 0x01, 0x06, 0x0D, 0x05,
+  0x14, 0x02, 0x03, 0x01, 0x05, 0x0D, 0x05, 0x13, 0x02, 0x02, 0x01, 0x05,
+  0x0D, 0x07, 0x02, 0x00, 0x06, 0x0D, 0x07, 0x02, 0x00, 0x03, 0x0E, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06,
+  0x01, 0x06, 0x06, 0x01, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07,
+  0x03, 0x01, 0x01, 0x09, 0x01, 0x03, 0x07, 0x01, 0x04, 0x05, 0x01, 0x04,
+  0x05, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x05, 0x01, 0x02, 0x06, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02,
+  0x05, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x02, 0x00,
+  0x06, 0x0A, 0x01, 0x02, 0x00, 0x05, 0x09, 0x01, 0x02, 0x00, 0x05, 0x08,
+  0x02, 0x02, 0x00, 0x05, 0x07, 0x02, 0x01, 0x00, 0x08, 0x01, 0x00, 0x07,
+  0x01, 0x01, 0x04, 0x01, 0x11, 0x04, 0x01, 0x10, 0x06, 0x01, 0x10, 0x06,
+  0x01, 0x10, 0x06, 0x01, 0x10, 0x06, 0x01, 0x11, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x13, 0x01, 0x01, 0x0E, 0x06, 0x01, 0x0B, 0x09, 0x01, 0x0D,
+  0x07, 0x01, 0x0E, 0x05, 0x01, 0x0D, 0x06, 0x01, 0x0D, 0x06, 0x01, 0x0D,
+  0x06, 0x01, 0x0D, 0x05, 0x01, 0x0C, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x0C,
+  0x06, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x0B,
+  0x06, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x0A,
+  0x06, 0x01, 0x0A, 0x05, 0x01, 0x09, 0x06, 0x01, 0x09, 0x06, 0x01, 0x09,
+  0x05, 0x01, 0x09, 0x05, 0x01, 0x08, 0x06, 0x02, 0x01, 0x02, 0x08, 0x05,
+  0x02, 0x00, 0x04, 0x08, 0x04, 0x02, 0x00, 0x04, 0x07, 0x05, 0x02, 0x00,
+  0x04, 0x06, 0x05, 0x01, 0x01, 0x09, 0x01, 0x02, 0x06, 0x01, 0x0D, 0x02,
+  0x01, 0x08, 0x06, 0x01, 0x05, 0x09, 0x01, 0x08, 0x06, 0x01, 0x08, 0x05,
+  0x01, 0x08, 0x05, 0x01, 0x07, 0x06, 0x01, 0x07, 0x06, 0x01, 0x07, 0x05,
+  0x01, 0x07, 0x05, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x02, 0x06, 0x05,
+  0x0E, 0x0A, 0x02, 0x06, 0x05, 0x10, 0x06, 0x02, 0x05, 0x06, 0x10, 0x04,
+  0x02, 0x05, 0x06, 0x10, 0x03, 0x02, 0x05, 0x05, 0x0F, 0x03, 0x02, 0x04,
+  0x06, 0x0E, 0x03, 0x02, 0x04, 0x06, 0x0D, 0x03, 0x02, 0x04, 0x05, 0x0C,
+  0x03, 0x02, 0x04, 0x05, 0x0A, 0x05, 0x01, 0x03, 0x0C, 0x01, 0x03, 0x0C,
+  0x01, 0x03, 0x0C, 0x02, 0x03, 0x05, 0x0A, 0x05, 0x02, 0x02, 0x06, 0x0A,
+  0x06, 0x02, 0x02, 0x06, 0x0B, 0x05, 0x02, 0x02, 0x05, 0x0B, 0x05, 0x03,
+  0x01, 0x06, 0x0B, 0x05, 0x15, 0x01, 0x03, 0x01, 0x06, 0x0B, 0x06, 0x14,
+  0x02, 0x03, 0x01, 0x06, 0x0C, 0x05, 0x13, 0x02, 0x02, 0x01, 0x05, 0x0C,
+  0x08, 0x02, 0x00, 0x06, 0x0D, 0x06, 0x02, 0x00, 0x03, 0x0E, 0x04, 0x01,
+  0x0C, 0x01, 0x01, 0x07, 0x06, 0x01, 0x03, 0x0A, 0x01, 0x06, 0x07, 0x01,
+  0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06, 0x06, 0x01, 0x06, 0x05, 0x01,
+  0x05, 0x06, 0x01, 0x05, 0x06, 0x01, 0x05, 0x06, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x04, 0x06, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01,
+  0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x05, 0x01, 0x01, 0x06, 0x01,
+  0x01, 0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x02, 0x01, 0x05, 0x09,
+  0x01, 0x02, 0x00, 0x05, 0x08, 0x02, 0x02, 0x00, 0x05, 0x08, 0x01, 0x02,
+  0x00, 0x05, 0x07, 0x01, 0x01, 0x00, 0x08, 0x01, 0x00, 0x07, 0x01, 0x01,
+  0x04, 0x03, 0x09, 0x03, 0x11, 0x04, 0x1C, 0x05, 0x03, 0x03, 0x09, 0x0F,
+  0x07, 0x1A, 0x08, 0x03, 0x05, 0x07, 0x0E, 0x08, 0x19, 0x09, 0x05, 0x05,
+  0x06, 0x0E, 0x01, 0x11, 0x05, 0x18, 0x03, 0x1D, 0x05, 0x05, 0x05, 0x06,
+  0x0D, 0x01, 0x11, 0x05, 0x17, 0x02, 0x1D, 0x05, 0x05, 0x05, 0x06, 0x0C,
+  0x01, 0x11, 0x05, 0x17, 0x02, 0x1C, 0x06, 0x05, 0x05, 0x05, 0x0B, 0x01,
+  0x10, 0x05, 0x16, 0x02, 0x1C, 0x06, 0x04, 0x05, 0x05, 0x0B, 0x01, 0x10,
+  0x07, 0x1C, 0x05, 0x03, 0x04, 0x07, 0x10, 0x07, 0x1B, 0x06, 0x04, 0x04,
+  0x05, 0x0A, 0x01, 0x10, 0x06, 0x1B, 0x06, 0x03, 0x04, 0x06, 0x0F, 0x06,
+  0x1B, 0x05, 0x03, 0x04, 0x06, 0x0F, 0x06, 0x1A, 0x06, 0x03, 0x03, 0x06,
+  0x0F, 0x06, 0x1A, 0x06, 0x03, 0x03, 0x06, 0x0E, 0x06, 0x1A, 0x05, 0x03,
+  0x03, 0x06, 0x0E, 0x06, 0x1A, 0x05, 0x03, 0x03, 0x05, 0x0E, 0x05, 0x19,
+  0x06, 0x03, 0x02, 0x06, 0x0D, 0x06, 0x19, 0x06, 0x04, 0x02, 0x06, 0x0D,
+  0x06, 0x19, 0x05, 0x21, 0x01, 0x04, 0x02, 0x05, 0x0D, 0x06, 0x19, 0x05,
+  0x20, 0x02, 0x04, 0x01, 0x06, 0x0D, 0x05, 0x19, 0x05, 0x20, 0x01, 0x03,
+  0x01, 0x06, 0x0C, 0x06, 0x19, 0x07, 0x03, 0x01, 0x06, 0x0C, 0x06, 0x19,
+  0x07, 0x02, 0x01, 0x02, 0x1A, 0x04, 0x02, 0x09, 0x03, 0x10, 0x05, 0x02,
+  0x02, 0x09, 0x0F, 0x07, 0x02, 0x05, 0x06, 0x0E, 0x08, 0x03, 0x05, 0x06,
+  0x0D, 0x02, 0x11, 0x05, 0x03, 0x05, 0x05, 0x0C, 0x01, 0x11, 0x05, 0x03,
+  0x04, 0x06, 0x0C, 0x01, 0x11, 0x05, 0x03, 0x04, 0x06, 0x0B, 0x01, 0x11,
+  0x05, 0x03, 0x04, 0x05, 0x0A, 0x01, 0x11, 0x05, 0x02, 0x04, 0x07, 0x10,
+  0x06, 0x02, 0x03, 0x07, 0x10, 0x06, 0x02, 0x03, 0x07, 0x10, 0x05, 0x02,
+  0x03, 0x06, 0x0F, 0x06, 0x02, 0x03, 0x06, 0x0F, 0x06, 0x02, 0x02, 0x06,
+  0x0F, 0x05, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x05,
+  0x02, 0x02, 0x05, 0x0E, 0x05, 0x03, 0x01, 0x06, 0x0D, 0x06, 0x15, 0x01,
+  0x03, 0x01, 0x06, 0x0D, 0x05, 0x14, 0x02, 0x03, 0x01, 0x05, 0x0D, 0x05,
+  0x14, 0x01, 0x02, 0x01, 0x05, 0x0D, 0x07, 0x02, 0x00, 0x06, 0x0D, 0x07,
+  0x02, 0x00, 0x03, 0x0E, 0x04, 0x01, 0x0A, 0x06, 0x02, 0x08, 0x03, 0x0E,
+  0x03, 0x02, 0x06, 0x04, 0x0F, 0x03, 0x02, 0x05, 0x04, 0x0F, 0x04, 0x02,
+  0x04, 0x05, 0x0F, 0x05, 0x02, 0x04, 0x04, 0x0F, 0x05, 0x02, 0x03, 0x05,
+  0x0F, 0x05, 0x02, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x02, 0x05, 0x0E, 0x06,
+  0x02, 0x01, 0x05, 0x0E, 0x06, 0x02, 0x01, 0x05, 0x0E, 0x06, 0x02, 0x01,
+  0x05, 0x0E, 0x05, 0x02, 0x00, 0x06, 0x0E, 0x05, 0x02, 0x00, 0x06, 0x0D,
+  0x06, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02,
+  0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x00, 0x05,
+  0x0B, 0x05, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x02, 0x01, 0x04, 0x0A, 0x04,
+  0x02, 0x02, 0x04, 0x09, 0x03, 0x01, 0x04, 0x06, 0x02, 0x0C, 0x04, 0x13,
+  0x05, 0x02, 0x07, 0x09, 0x12, 0x08, 0x02, 0x09, 0x06, 0x11, 0x09, 0x03,
+  0x0A, 0x05, 0x10, 0x01, 0x14, 0x07, 0x02, 0x09, 0x07, 0x15, 0x06, 0x02,
+  0x09, 0x07, 0x15, 0x06, 0x02, 0x09, 0x06, 0x15, 0x06, 0x02, 0x09, 0x06,
+  0x15, 0x06, 0x02, 0x08, 0x06, 0x15, 0x06, 0x02, 0x08, 0x06, 0x14, 0x07,
+  0x02, 0x08, 0x05, 0x14, 0x06, 0x02, 0x08, 0x05, 0x14, 0x06, 0x02, 0x07,
+  0x06, 0x13, 0x07, 0x02, 0x07, 0x06, 0x13, 0x06, 0x02, 0x07, 0x05, 0x13,
+  0x06, 0x02, 0x07, 0x05, 0x12, 0x06, 0x02, 0x06, 0x06, 0x12, 0x05, 0x02,
+  0x06, 0x06, 0x11, 0x06, 0x02, 0x06, 0x05, 0x11, 0x05, 0x02, 0x06, 0x05,
+  0x10, 0x05, 0x02, 0x05, 0x07, 0x0F, 0x05, 0x01, 0x05, 0x0E, 0x02, 0x05,
+  0x05, 0x0C, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x06, 0x01, 0x04, 0x06,
+  0x01, 0x04, 0x05, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x02, 0x07,
+  0x01, 0x00, 0x0C, 0x01, 0x0A, 0x05, 0x02, 0x08, 0x07, 0x11, 0x05, 0x02,
+  0x07, 0x05, 0x0F, 0x07, 0x02, 0x06, 0x05, 0x0F, 0x06, 0x02, 0x05, 0x05,
+  0x0F, 0x06, 0x02, 0x04, 0x06, 0x0F, 0x06, 0x02, 0x04, 0x05, 0x0F, 0x06,
+  0x02, 0x03, 0x06, 0x0F, 0x05, 0x02, 0x02, 0x06, 0x0F, 0x05, 0x02, 0x02,
+  0x06, 0x0E, 0x06, 0x02, 0x01, 0x06, 0x0E, 0x05, 0x02, 0x01, 0x06, 0x0E,
+  0x05, 0x02, 0x01, 0x06, 0x0D, 0x06, 0x02, 0x00, 0x06, 0x0D, 0x06, 0x02,
+  0x00, 0x06, 0x0D, 0x05, 0x02, 0x00, 0x06, 0x0C, 0x06, 0x02, 0x00, 0x06,
+  0x0C, 0x06, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x02, 0x00, 0x06, 0x0A, 0x07,
+  0x03, 0x00, 0x07, 0x09, 0x02, 0x0C, 0x05, 0x02, 0x01, 0x09, 0x0B, 0x05,
+  0x02, 0x01, 0x08, 0x0B, 0x05, 0x02, 0x03, 0x05, 0x0B, 0x05, 0x01, 0x0A,
+  0x06, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x09, 0x06, 0x01, 0x09,
+  0x06, 0x01, 0x09, 0x05, 0x01, 0x08, 0x07, 0x01, 0x05, 0x0C, 0x02, 0x09,
+  0x03, 0x0F, 0x04, 0x02, 0x03, 0x09, 0x0E, 0x05, 0x02, 0x05, 0x06, 0x0D,
+  0x07, 0x02, 0x05, 0x06, 0x0C, 0x08, 0x03, 0x05, 0x06, 0x0C, 0x01, 0x0F,
+  0x04, 0x03, 0x05, 0x05, 0x0B, 0x01, 0x10, 0x03, 0x02, 0x05, 0x05, 0x0B,
+  0x01, 0x01, 0x04, 0x07, 0x01, 0x04, 0x07, 0x01, 0x04, 0x06, 0x01, 0x04,
+  0x06, 0x01, 0x03, 0x07, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01, 0x03,
+  0x05, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x02, 0x06, 0x01, 0x01,
+  0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x02, 0x07,
+  0x05, 0x0F, 0x01, 0x01, 0x05, 0x0B, 0x02, 0x04, 0x04, 0x0C, 0x04, 0x02,
+  0x04, 0x03, 0x0D, 0x03, 0x02, 0x03, 0x04, 0x0D, 0x02, 0x02, 0x03, 0x04,
+  0x0D, 0x02, 0x02, 0x03, 0x05, 0x0E, 0x01, 0x02, 0x03, 0x05, 0x0E, 0x01,
+  0x01, 0x03, 0x06, 0x01, 0x04, 0x06, 0x01, 0x04, 0x07, 0x01, 0x04, 0x08,
+  0x01, 0x05, 0x08, 0x01, 0x06, 0x07, 0x01, 0x07, 0x07, 0x01, 0x08, 0x06,
+  0x02, 0x01, 0x01, 0x09, 0x05, 0x02, 0x01, 0x01, 0x09, 0x05, 0x02, 0x01,
+  0x02, 0x0A, 0x04, 0x02, 0x00, 0x03, 0x0A, 0x03, 0x02, 0x00, 0x04, 0x0A,
+  0x03, 0x02, 0x00, 0x05, 0x08, 0x04, 0x02, 0x00, 0x02, 0x03, 0x07, 0x01,
+  0x0A, 0x01, 0x01, 0x09, 0x02, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03, 0x01,
+  0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x03, 0x07, 0x01, 0x02, 0x0B, 0x01,
+  0x02, 0x0B, 0x01, 0x04, 0x05, 0x01, 0x03, 0x06, 0x01, 0x03, 0x06, 0x01,
+  0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x02, 0x06, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x00, 0x06, 0x02, 0x00, 0x06, 0x09, 0x01, 0x02, 0x00,
+  0x05, 0x09, 0x01, 0x02, 0x00, 0x05, 0x08, 0x01, 0x02, 0x00, 0x05, 0x07,
+  0x01, 0x01, 0x00, 0x08, 0x01, 0x00, 0x07, 0x01, 0x01, 0x04, 0x01, 0x09,
+  0x01, 0x02, 0x05, 0x05, 0x10, 0x06, 0x02, 0x01, 0x08, 0x10, 0x05, 0x02,
+  0x03, 0x06, 0x10, 0x05, 0x02, 0x03, 0x06, 0x0F, 0x06, 0x02, 0x03, 0x06,
+  0x0F, 0x05, 0x02, 0x03, 0x05, 0x0F, 0x05, 0x02, 0x03, 0x05, 0x0E, 0x06,
+  0x02, 0x02, 0x06, 0x0E, 0x05, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x02,
+  0x05, 0x0D, 0x06, 0x02, 0x02, 0x05, 0x0D, 0x06, 0x02, 0x01, 0x06, 0x0C,
+  0x06, 0x02, 0x01, 0x05, 0x0C, 0x06, 0x02, 0x01, 0x05, 0x0B, 0x07, 0x02,
+  0x01, 0x05, 0x0B, 0x06, 0x03, 0x00, 0x05, 0x0A, 0x01, 0x0C, 0x05, 0x04,
+  0x00, 0x05, 0x09, 0x01, 0x0C, 0x04, 0x13, 0x02, 0x04, 0x00, 0x05, 0x08,
+  0x02, 0x0B, 0x05, 0x13, 0x01, 0x04, 0x00, 0x05, 0x07, 0x02, 0x0B, 0x05,
+  0x12, 0x01, 0x02, 0x00, 0x08, 0x0B, 0x08, 0x02, 0x00, 0x07, 0x0B, 0x07,
+  0x02, 0x01, 0x05, 0x0C, 0x04, 0x02, 0x05, 0x02, 0x0D, 0x03, 0x02, 0x02,
+  0x05, 0x0C, 0x04, 0x02, 0x00, 0x07, 0x0C, 0x05, 0x02, 0x02, 0x05, 0x0C,
+  0x05, 0x02, 0x02, 0x05, 0x0C, 0x05, 0x02, 0x02, 0x06, 0x0D, 0x04, 0x02,
+  0x03, 0x05, 0x0E, 0x02, 0x02, 0x03, 0x05, 0x0E, 0x02, 0x02, 0x03, 0x05,
+  0x0E, 0x02, 0x02, 0x03, 0x05, 0x0D, 0x02, 0x02, 0x03, 0x05, 0x0D, 0x02,
+  0x02, 0x03, 0x05, 0x0C, 0x02, 0x02, 0x03, 0x05, 0x0B, 0x02, 0x02, 0x03,
+  0x05, 0x0A, 0x02, 0x02, 0x03, 0x05, 0x0A, 0x02, 0x02, 0x03, 0x05, 0x09,
+  0x02, 0x01, 0x03, 0x07, 0x01, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x03, 0x05,
+  0x02, 0x0F, 0x02, 0x17, 0x03, 0x03, 0x02, 0x05, 0x0F, 0x02, 0x16, 0x05,
+  0x03, 0x00, 0x07, 0x0E, 0x03, 0x16, 0x05, 0x03, 0x02, 0x05, 0x0E, 0x03,
+  0x16, 0x05, 0x03, 0x02, 0x05, 0x0D, 0x04, 0x16, 0x05, 0x03, 0x02, 0x05,
+  0x0C, 0x05, 0x17, 0x04, 0x03, 0x02, 0x06, 0x0C, 0x05, 0x18, 0x02, 0x03,
+  0x03, 0x05, 0x0B, 0x06, 0x18, 0x02, 0x03, 0x03, 0x05, 0x0B, 0x07, 0x18,
+  0x01, 0x03, 0x03, 0x05, 0x0A, 0x08, 0x17, 0x02, 0x03, 0x03, 0x05, 0x0A,
+  0x08, 0x17, 0x01, 0x04, 0x03, 0x05, 0x09, 0x02, 0x0C, 0x06, 0x16, 0x02,
+  0x04, 0x03, 0x05, 0x09, 0x02, 0x0C, 0x06, 0x15, 0x02, 0x03, 0x03, 0x07,
+  0x0D, 0x05, 0x14, 0x02, 0x03, 0x03, 0x06, 0x0D, 0x05, 0x14, 0x02, 0x03,
+  0x03, 0x06, 0x0D, 0x05, 0x13, 0x02, 0x02, 0x03, 0x05, 0x0D, 0x07, 0x02,
+  0x03, 0x05, 0x0D, 0x06, 0x02, 0x03, 0x04, 0x0D, 0x06, 0x02, 0x03, 0x04,
+  0x0D, 0x05, 0x02, 0x03, 0x03, 0x0D, 0x04, 0x02, 0x03, 0x02, 0x0D, 0x03,
+  0x02, 0x03, 0x02, 0x0D, 0x02, 0x02, 0x08, 0x04, 0x13, 0x04, 0x02, 0x04,
+  0x08, 0x12, 0x05, 0x02, 0x07, 0x06, 0x11, 0x07, 0x02, 0x07, 0x06, 0x10,
+  0x08, 0x03, 0x08, 0x05, 0x0F, 0x02, 0x14, 0x03, 0x02, 0x08, 0x05, 0x0E,
+  0x02, 0x01, 0x08, 0x08, 0x01, 0x08, 0x07, 0x01, 0x09, 0x05, 0x01, 0x09,
+  0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x06, 0x01, 0x09, 0x06, 0x01, 0x09,
+  0x06, 0x01, 0x09, 0x06, 0x01, 0x08, 0x07, 0x02, 0x07, 0x02, 0x0A, 0x06,
+  0x03, 0x07, 0x02, 0x0A, 0x06, 0x14, 0x01, 0x04, 0x01, 0x03, 0x06, 0x02,
+  0x0B, 0x05, 0x13, 0x02, 0x03, 0x00, 0x08, 0x0B, 0x05, 0x12, 0x02, 0x02,
+  0x00, 0x07, 0x0B, 0x08, 0x02, 0x00, 0x06, 0x0C, 0x06, 0x02, 0x01, 0x04,
+  0x0D, 0x04, 0x02, 0x0A, 0x02, 0x13, 0x03, 0x02, 0x05, 0x08, 0x12, 0x05,
+  0x02, 0x07, 0x06, 0x12, 0x05, 0x02, 0x07, 0x06, 0x12, 0x05, 0x02, 0x08,
+  0x06, 0x13, 0x04, 0x02, 0x08, 0x06, 0x14, 0x03, 0x02, 0x08, 0x06, 0x14,
+  0x02, 0x02, 0x09, 0x05, 0x14, 0x02, 0x02, 0x09, 0x06, 0x14, 0x01, 0x02,
+  0x09, 0x06, 0x13, 0x02, 0x02, 0x09, 0x06, 0x13, 0x02, 0x02, 0x0A, 0x05,
+  0x12, 0x02, 0x02, 0x0A, 0x05, 0x12, 0x02, 0x02, 0x0A, 0x05, 0x11, 0x02,
+  0x02, 0x0A, 0x06, 0x11, 0x02, 0x01, 0x0A, 0x08, 0x01, 0x0B, 0x07, 0x01,
+  0x0B, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x04, 0x01,
+  0x0B, 0x04, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x02, 0x01, 0x0B, 0x02, 0x01,
+  0x0A, 0x02, 0x02, 0x01, 0x03, 0x09, 0x02, 0x02, 0x00, 0x06, 0x08, 0x02,
+  0x01, 0x00, 0x09, 0x01, 0x00, 0x07, 0x01, 0x01, 0x04, 0x01, 0x05, 0x0E,
+  0x01, 0x04, 0x0E, 0x01, 0x04, 0x0E, 0x01, 0x04, 0x0D, 0x02, 0x04, 0x01,
+  0x0D, 0x03, 0x02, 0x03, 0x02, 0x0C, 0x03, 0x02, 0x03, 0x01, 0x0B, 0x03,
+  0x01, 0x0B, 0x02, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x02, 0x01, 0x07, 0x02, 0x01, 0x06, 0x02, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x03, 0x05, 0x01, 0x02, 0x07,
+  0x02, 0x02, 0x08, 0x0F, 0x02, 0x02, 0x01, 0x09, 0x0E, 0x04, 0x03, 0x00,
+  0x03, 0x05, 0x06, 0x0E, 0x04, 0x03, 0x01, 0x01, 0x06, 0x05, 0x0E, 0x04,
+  0x02, 0x08, 0x04, 0x0E, 0x03, 0x01, 0x0A, 0x05, 0x01, 0x0F, 0x05, 0x01,
+  0x0C, 0x06, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x09, 0x05, 0x01,
+  0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01,
+  0x08, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01,
+  0x07, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01,
+  0x05, 0x04, 0x01, 0x03, 0x04, 0x01, 0x00, 0x06, 0x01, 0x03, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01, 0x03, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x06, 0x01, 0x02, 0x06, 0x01, 0x05, 0x05, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x0A, 0x05, 0x01, 0x0C, 0x06, 0x01, 0x0E, 0x05, 0x01,
+  0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x05, 0x01,
+  0x0D, 0x05, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x05, 0x01,
+  0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0C, 0x05, 0x01,
+  0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01,
+  0x0C, 0x05, 0x01, 0x0E, 0x05, 0x01, 0x0D, 0x04, 0x01, 0x0B, 0x04, 0x01,
+  0x0A, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x08, 0x05, 0x01,
+  0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x07, 0x05, 0x01,
+  0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x06, 0x05, 0x01,
+  0x06, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x04, 0x05, 0x01,
+  0x02, 0x06, 0x01, 0x00, 0x05, 0x01, 0x03, 0x05, 0x02, 0x01, 0x0A, 0x12,
+  0x01, 0x02, 0x00, 0x0D, 0x11, 0x03, 0x01, 0x00, 0x15, 0x02, 0x00, 0x03,
+  0x08, 0x0C, 0x01, 0x0A, 0x09, 0x01, 0x0D, 0x05 };
+
+const GFXglyph FreeSerifBoldItalic24pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,  12,    0,    1 },   // 0x20 ' '
+  {     0,  15,  33,  18,    3,  -31 },   // 0x21 '!'
+  {    91,  19,  13,  26,    6,  -31 },   // 0x22 '"'
+  {   156,  27,  33,  23,   -2,  -32 },   // 0x23 '#'
+  {   309,  24,  39,  24,   -1,  -33 },   // 0x24 '$'
+  {   496,  35,  32,  39,    2,  -30 },   // 0x25 '%'
+  {   718,  33,  33,  37,    0,  -31 },   // 0x26 '&'
+  {   891,   7,  13,  13,    6,  -31 },   // 0x27 '''
+  {   930,  14,  41,  16,    1,  -31 },   // 0x28 '('
+  {  1051,  14,  41,  16,   -2,  -31 },   // 0x29 ')'
+  {  1174,  19,  20,  23,    3,  -31 },   // 0x2A '*'
+  {  1274,  22,  23,  27,    2,  -22 },   // 0x2B '+'
+  {  1343,  10,  15,  12,   -3,   -5 },   // 0x2C ','
+  {  1388,  12,   5,  16,    0,  -12 },   // 0x2D '-'
+  {  1403,   8,   7,  12,    0,   -5 },   // 0x2E '.'
+  {  1424,  19,  33,  16,    0,  -31 },   // 0x2F '/'
+  {  1523,  22,  33,  23,    1,  -31 },   // 0x30 '0'
+  {  1684,  20,  32,  23,    0,  -31 },   // 0x31 '1'
+  {  1780,  22,  32,  23,    1,  -31 },   // 0x32 '2'
+  {  1892,  22,  33,  24,    0,  -31 },   // 0x33 '3'
+  {  2005,  25,  32,  23,    0,  -31 },   // 0x34 '4'
+  {  2127,  24,  32,  24,    0,  -30 },   // 0x35 '5'
+  {  2231,  23,  32,  24,    1,  -30 },   // 0x36 '6'
+  {  2359,  23,  31,  23,    3,  -30 },   // 0x37 '7'
+  {  2460,  21,  33,  23,    1,  -31 },   // 0x38 '8'
+  {  2609,  23,  33,  23,    0,  -31 },   // 0x39 '9'
+  {  2742,  13,  22,  12,    0,  -20 },   // 0x3A ':'
+  {  2792,  15,  30,  12,   -2,  -20 },   // 0x3B ';'
+  {  2864,  24,  25,  27,    1,  -23 },   // 0x3C '<'
+  {  2939,  24,  14,  27,    3,  -18 },   // 0x3D '='
+  {  2969,  24,  25,  27,    3,  -23 },   // 0x3E '>'
+  {  3044,  18,  33,  24,    4,  -31 },   // 0x3F '?'
+  {  3149,  33,  33,  39,    3,  -31 },   // 0x40 '@'
+  {  3364,  31,  32,  33,    0,  -31 },   // 0x41 'A'
+  {  3502,  31,  31,  30,    0,  -30 },   // 0x42 'B'
+  {  3647,  29,  33,  29,    2,  -31 },   // 0x43 'C'
+  {  3778,  35,  31,  34,    0,  -30 },   // 0x44 'D'
+  {  3925,  32,  31,  30,    0,  -30 },   // 0x45 'E'
+  {  4066,  31,  31,  29,    0,  -30 },   // 0x46 'F'
+  {  4193,  32,  33,  33,    2,  -31 },   // 0x47 'G'
+  {  4340,  39,  31,  35,    0,  -30 },   // 0x48 'H'
+  {  4491,  21,  31,  18,    0,  -30 },   // 0x49 'I'
+  {  4584,  27,  36,  23,    0,  -30 },   // 0x4A 'J'
+  {  4704,  34,  31,  31,    0,  -30 },   // 0x4B 'K'
+  {  4855,  29,  31,  29,    0,  -30 },   // 0x4C 'L'
+  {  4964,  44,  32,  41,    0,  -30 },   // 0x4D 'M'
+  {  5200,  37,  32,  33,    0,  -30 },   // 0x4E 'N'
+  {  5388,  31,  33,  32,    2,  -31 },   // 0x4F 'O'
+  {  5545,  31,  31,  28,    0,  -30 },   // 0x50 'P'
+  {  5664,  31,  42,  32,    2,  -31 },   // 0x51 'Q'
+  {  5858,  32,  31,  31,    0,  -30 },   // 0x52 'R'
+  {  6005,  24,  33,  24,    0,  -31 },   // 0x53 'S'
+  {  6144,  27,  31,  28,    4,  -30 },   // 0x54 'T'
+  {  6263,  32,  32,  34,    5,  -30 },   // 0x55 'U'
+  {  6419,  31,  32,  33,    6,  -30 },   // 0x56 'V'
+  {  6559,  41,  32,  44,    6,  -30 },   // 0x57 'W'
+  {  6781,  34,  31,  33,    0,  -30 },   // 0x58 'X'
+  {  6920,  28,  31,  30,    6,  -30 },   // 0x59 'Y'
+  {  7041,  28,  31,  26,    0,  -30 },   // 0x5A 'Z'
+  {  7162,  19,  38,  16,   -2,  -30 },   // 0x5B '['
+  {  7276,  13,  33,  19,    6,  -31 },   // 0x5C '\'
+  {  7375,  19,  38,  16,   -3,  -30 },   // 0x5D ']'
+  {  7489,  21,  17,  27,    3,  -30 },   // 0x5E '^'
+  {  7564,  24,   3,  23,    0,    5 },   // 0x5F '_'
+  {  7573,  10,   9,  16,    4,  -32 },   // 0x60 '`'
+  {  7600,  22,  23,  24,    1,  -21 },   // 0x61 'a'
+  {  7725,  22,  33,  23,    1,  -31 },   // 0x62 'b'
+  {  7868,  18,  23,  20,    1,  -21 },   // 0x63 'c'
+  {  7955,  25,  34,  24,    1,  -32 },   // 0x64 'd'
+  {  8109,  18,  23,  20,    1,  -21 },   // 0x65 'e'
+  {  8206,  28,  41,  23,   -4,  -31 },   // 0x66 'f'
+  {  8347,  25,  31,  23,   -1,  -21 },   // 0x67 'g'
+  {  8476,  23,  34,  26,    1,  -32 },   // 0x68 'h'
+  {  8640,  12,  33,  14,    2,  -31 },   // 0x69 'i'
+  {  8739,  22,  42,  16,   -4,  -31 },   // 0x6A 'j'
+  {  8865,  24,  34,  24,    1,  -32 },   // 0x6B 'k'
+  {  9011,  13,  34,  14,    2,  -32 },   // 0x6C 'l'
+  {  9121,  35,  23,  36,    0,  -21 },   // 0x6D 'm'
+  {  9306,  23,  23,  25,    0,  -21 },   // 0x6E 'n'
+  {  9437,  20,  23,  22,    1,  -21 },   // 0x6F 'o'
+  {  9548,  27,  31,  23,   -4,  -21 },   // 0x70 'p'
+  {  9687,  22,  31,  23,    1,  -21 },   // 0x71 'q'
+  {  9826,  20,  22,  19,    0,  -21 },   // 0x72 'r'
+  {  9910,  16,  23,  17,    0,  -21 },   // 0x73 's'
+  { 10007,  13,  29,  13,    2,  -27 },   // 0x74 't'
+  { 10102,  22,  23,  25,    2,  -21 },   // 0x75 'u'
+  { 10229,  17,  23,  21,    3,  -21 },   // 0x76 'v'
+  { 10330,  27,  23,  31,    3,  -21 },   // 0x77 'w'
+  { 10481,  24,  23,  22,   -1,  -21 },   // 0x78 'x'
+  { 10586,  23,  31,  20,   -3,  -21 },   // 0x79 'y'
+  { 10713,  19,  25,  19,    0,  -20 },   // 0x7A 'z'
+  { 10808,  20,  41,  16,    0,  -31 },   // 0x7B '{'
+  { 10931,   4,  33,  13,    5,  -31 },   // 0x7C '|'
+  { 11030,  20,  41,  16,   -6,  -31 },   // 0x7D '}'
+  { 11153,  21,   7,  27,    3,  -14 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSerifBoldItalic24pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSerifBoldItalic24pt7bSpanData,
+    (GFXglyph *)FreeSerifBoldItalic24pt7bSpanGlyphs,
+    0x20, 0x7E, 56 } };
+
+// Approx. 11964 bytes
@@ -0,0 +1,768 @@
+// FreeSerifItalic18pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSerifItalic18pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSerifItalic18pt7bSpanData[] PROGMEM = {
+  0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02,
+  0x01, 0x04, 0x02, 0x01, 0x04, 0x01, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x09, 0x03, 0x02, 0x01,
+  0x04, 0x08, 0x04, 0x02, 0x01, 0x04, 0x08, 0x04, 0x02, 0x01, 0x03, 0x08,
+  0x03, 0x02, 0x01, 0x02, 0x08, 0x03, 0x02, 0x01, 0x02, 0x08, 0x02, 0x02,
+  0x00, 0x02, 0x07, 0x02, 0x02, 0x00, 0x02, 0x07, 0x02, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x09, 0x02, 0x10, 0x02, 0x02, 0x09, 0x02, 0x0F, 0x03,
+  0x02, 0x08, 0x03, 0x0F, 0x02, 0x02, 0x08, 0x02, 0x0F, 0x02, 0x02, 0x08,
+  0x02, 0x0E, 0x03, 0x02, 0x07, 0x02, 0x0E, 0x02, 0x02, 0x07, 0x02, 0x0E,
+  0x02, 0x01, 0x03, 0x10, 0x01, 0x03, 0x10, 0x02, 0x06, 0x02, 0x0C, 0x03,
+  0x02, 0x05, 0x03, 0x0C, 0x02, 0x02, 0x05, 0x02, 0x0C, 0x02, 0x02, 0x05,
+  0x02, 0x0B, 0x03, 0x02, 0x04, 0x02, 0x0B, 0x02, 0x01, 0x00, 0x10, 0x01,
+  0x00, 0x10, 0x02, 0x03, 0x02, 0x0A, 0x02, 0x02, 0x03, 0x02, 0x09, 0x03,
+  0x02, 0x02, 0x03, 0x09, 0x02, 0x02, 0x02, 0x02, 0x09, 0x02, 0x02, 0x02,
+  0x02, 0x08, 0x02, 0x02, 0x01, 0x02, 0x08, 0x02, 0x02, 0x01, 0x02, 0x07,
+  0x03, 0x01, 0x0C, 0x01, 0x01, 0x0B, 0x02, 0x01, 0x0B, 0x01, 0x01, 0x07,
+  0x06, 0x02, 0x05, 0x02, 0x0B, 0x04, 0x03, 0x04, 0x02, 0x0A, 0x02, 0x0D,
+  0x02, 0x03, 0x03, 0x02, 0x0A, 0x02, 0x0D, 0x02, 0x03, 0x03, 0x02, 0x0A,
+  0x02, 0x0D, 0x01, 0x03, 0x03, 0x02, 0x0A, 0x01, 0x0D, 0x01, 0x02, 0x03,
+  0x03, 0x09, 0x02, 0x02, 0x04, 0x03, 0x09, 0x02, 0x01, 0x04, 0x07, 0x01,
+  0x05, 0x06, 0x01, 0x07, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x02,
+  0x08, 0x02, 0x0B, 0x03, 0x02, 0x07, 0x02, 0x0B, 0x03, 0x02, 0x07, 0x02,
+  0x0C, 0x02, 0x03, 0x01, 0x01, 0x07, 0x02, 0x0C, 0x02, 0x03, 0x01, 0x01,
+  0x07, 0x02, 0x0C, 0x02, 0x03, 0x00, 0x03, 0x06, 0x03, 0x0C, 0x02, 0x03,
+  0x00, 0x03, 0x06, 0x02, 0x0B, 0x02, 0x03, 0x01, 0x03, 0x06, 0x02, 0x0B,
+  0x02, 0x02, 0x02, 0x06, 0x0A, 0x02, 0x01, 0x04, 0x06, 0x01, 0x05, 0x02,
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x02, 0x05, 0x04, 0x11, 0x02, 0x02,
+  0x03, 0x07, 0x0F, 0x03, 0x03, 0x02, 0x04, 0x0A, 0x05, 0x10, 0x02, 0x03,
+  0x01, 0x03, 0x0A, 0x01, 0x0F, 0x02, 0x03, 0x01, 0x03, 0x0A, 0x01, 0x0F,
+  0x02, 0x03, 0x00, 0x03, 0x0A, 0x01, 0x0E, 0x02, 0x03, 0x00, 0x02, 0x0A,
+  0x01, 0x0E, 0x02, 0x03, 0x00, 0x02, 0x09, 0x01, 0x0D, 0x02, 0x03, 0x00,
+  0x02, 0x09, 0x01, 0x0C, 0x02, 0x04, 0x00, 0x02, 0x08, 0x02, 0x0C, 0x02,
+  0x12, 0x05, 0x04, 0x00, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x11, 0x07, 0x05,
+  0x01, 0x02, 0x06, 0x02, 0x0B, 0x02, 0x10, 0x03, 0x16, 0x02, 0x04, 0x01,
+  0x06, 0x0A, 0x02, 0x0F, 0x03, 0x17, 0x02, 0x04, 0x02, 0x04, 0x0A, 0x01,
+  0x0E, 0x03, 0x18, 0x01, 0x03, 0x09, 0x02, 0x0E, 0x02, 0x18, 0x01, 0x03,
+  0x09, 0x01, 0x0D, 0x03, 0x18, 0x01, 0x03, 0x08, 0x02, 0x0D, 0x03, 0x18,
+  0x01, 0x03, 0x07, 0x02, 0x0D, 0x02, 0x17, 0x01, 0x03, 0x07, 0x02, 0x0D,
+  0x02, 0x16, 0x02, 0x03, 0x06, 0x02, 0x0D, 0x02, 0x15, 0x02, 0x03, 0x06,
+  0x01, 0x0D, 0x03, 0x14, 0x03, 0x02, 0x05, 0x02, 0x0E, 0x07, 0x02, 0x05,
+  0x01, 0x0F, 0x05, 0x01, 0x0B, 0x04, 0x01, 0x0A, 0x06, 0x02, 0x09, 0x03,
+  0x0F, 0x02, 0x02, 0x09, 0x02, 0x0F, 0x02, 0x02, 0x08, 0x03, 0x0F, 0x02,
+  0x02, 0x08, 0x03, 0x0E, 0x02, 0x02, 0x08, 0x03, 0x0D, 0x02, 0x02, 0x08,
+  0x03, 0x0C, 0x02, 0x01, 0x08, 0x04, 0x01, 0x07, 0x04, 0x02, 0x05, 0x07,
+  0x0F, 0x07, 0x03, 0x04, 0x02, 0x08, 0x04, 0x11, 0x03, 0x03, 0x02, 0x03,
+  0x09, 0x03, 0x11, 0x02, 0x03, 0x01, 0x04, 0x09, 0x04, 0x10, 0x03, 0x03,
+  0x01, 0x03, 0x09, 0x04, 0x10, 0x02, 0x03, 0x00, 0x04, 0x0A, 0x04, 0x0F,
+  0x02, 0x03, 0x00, 0x04, 0x0A, 0x04, 0x0F, 0x01, 0x02, 0x00, 0x04, 0x0B,
+  0x04, 0x02, 0x00, 0x04, 0x0B, 0x04, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x04,
+  0x01, 0x05, 0x09, 0x03, 0x0D, 0x04, 0x15, 0x01, 0x02, 0x02, 0x09, 0x0E,
+  0x07, 0x02, 0x03, 0x06, 0x10, 0x04, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x08, 0x01,
+  0x01, 0x07, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x02,
+  0x01, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x02,
+  0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x02,
+  0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02,
+  0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02,
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02,
+  0x03, 0x00, 0x02, 0x05, 0x01, 0x0A, 0x02, 0x03, 0x00, 0x03, 0x05, 0x01,
+  0x08, 0x04, 0x03, 0x03, 0x01, 0x05, 0x01, 0x07, 0x02, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x04, 0x03, 0x01, 0x03, 0x05, 0x01, 0x08, 0x03, 0x03, 0x00,
+  0x03, 0x05, 0x01, 0x09, 0x03, 0x03, 0x00, 0x02, 0x05, 0x01, 0x0A, 0x02,
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x07, 0x02,
+  0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02,
+  0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x00, 0x10,
+  0x01, 0x00, 0x10, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02,
+  0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02,
+  0x01, 0x07, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x00, 0x02, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x01, 0x02,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x02, 0x01, 0x0D, 0x02,
+  0x01, 0x0C, 0x03, 0x01, 0x0C, 0x02, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x03,
+  0x01, 0x0A, 0x02, 0x01, 0x09, 0x03, 0x01, 0x09, 0x02, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x02, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x02,
+  0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02,
+  0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x09, 0x04, 0x02, 0x07, 0x02,
+  0x0D, 0x02, 0x02, 0x06, 0x02, 0x0D, 0x03, 0x02, 0x05, 0x02, 0x0E, 0x02,
+  0x02, 0x04, 0x03, 0x0E, 0x02, 0x02, 0x03, 0x03, 0x0E, 0x03, 0x02, 0x03,
+  0x03, 0x0E, 0x03, 0x02, 0x02, 0x03, 0x0E, 0x03, 0x02, 0x02, 0x03, 0x0E,
+  0x03, 0x02, 0x01, 0x04, 0x0E, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x04, 0x02,
+  0x01, 0x03, 0x0D, 0x04, 0x02, 0x00, 0x04, 0x0D, 0x04, 0x02, 0x00, 0x04,
+  0x0D, 0x03, 0x02, 0x00, 0x03, 0x0D, 0x03, 0x02, 0x00, 0x03, 0x0C, 0x04,
+  0x02, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x04, 0x02, 0x00,
+  0x03, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0A, 0x03, 0x02, 0x01, 0x02, 0x0A,
+  0x03, 0x02, 0x01, 0x03, 0x09, 0x03, 0x02, 0x02, 0x02, 0x08, 0x02, 0x01,
+  0x04, 0x05, 0x01, 0x08, 0x04, 0x01, 0x05, 0x07, 0x01, 0x09, 0x03, 0x01,
+  0x09, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01,
+  0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01,
+  0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01,
+  0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01,
+  0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01,
+  0x00, 0x09, 0x01, 0x07, 0x05, 0x01, 0x05, 0x09, 0x02, 0x04, 0x02, 0x0A,
+  0x05, 0x02, 0x03, 0x01, 0x0B, 0x05, 0x02, 0x02, 0x01, 0x0C, 0x04, 0x01,
+  0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0B, 0x04, 0x01,
+  0x0B, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x03, 0x01,
+  0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01,
+  0x04, 0x03, 0x01, 0x03, 0x03, 0x02, 0x02, 0x03, 0x0D, 0x01, 0x02, 0x02,
+  0x02, 0x0C, 0x02, 0x01, 0x01, 0x0C, 0x01, 0x00, 0x0C, 0x01, 0x09, 0x05,
+  0x01, 0x07, 0x08, 0x02, 0x06, 0x02, 0x0C, 0x04, 0x02, 0x05, 0x01, 0x0D,
+  0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x03, 0x01, 0x0C,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x07, 0x04, 0x01, 0x04, 0x08, 0x01, 0x08,
+  0x05, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0B, 0x03, 0x01, 0x0B,
+  0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x02, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x02, 0x02, 0x00, 0x04, 0x08, 0x03, 0x01, 0x00, 0x0A,
+  0x01, 0x01, 0x06, 0x01, 0x0F, 0x02, 0x01, 0x0E, 0x02, 0x01, 0x0D, 0x03,
+  0x01, 0x0C, 0x04, 0x01, 0x0B, 0x05, 0x02, 0x0A, 0x02, 0x0D, 0x02, 0x02,
+  0x09, 0x02, 0x0C, 0x03, 0x02, 0x08, 0x02, 0x0C, 0x03, 0x02, 0x07, 0x02,
+  0x0C, 0x02, 0x02, 0x07, 0x01, 0x0C, 0x02, 0x02, 0x06, 0x01, 0x0B, 0x03,
+  0x02, 0x05, 0x01, 0x0B, 0x03, 0x02, 0x04, 0x01, 0x0B, 0x02, 0x02, 0x03,
+  0x01, 0x0A, 0x03, 0x02, 0x02, 0x02, 0x0A, 0x03, 0x02, 0x01, 0x02, 0x0A,
+  0x03, 0x01, 0x00, 0x10, 0x01, 0x00, 0x0F, 0x01, 0x09, 0x03, 0x01, 0x09,
+  0x02, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08,
+  0x02, 0x01, 0x07, 0x09, 0x01, 0x07, 0x09, 0x01, 0x06, 0x01, 0x01, 0x06,
+  0x01, 0x01, 0x05, 0x02, 0x01, 0x05, 0x03, 0x01, 0x04, 0x06, 0x01, 0x04,
+  0x08, 0x01, 0x08, 0x05, 0x01, 0x0A, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B,
+  0x03, 0x01, 0x0C, 0x02, 0x01, 0x0C, 0x02, 0x01, 0x0C, 0x02, 0x01, 0x0C,
+  0x02, 0x01, 0x0C, 0x01, 0x01, 0x0B, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x0A,
+  0x02, 0x02, 0x01, 0x03, 0x08, 0x03, 0x01, 0x00, 0x09, 0x01, 0x01, 0x06,
+  0x01, 0x0E, 0x03, 0x01, 0x0A, 0x05, 0x01, 0x08, 0x04, 0x01, 0x07, 0x04,
+  0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04,
+  0x02, 0x02, 0x04, 0x07, 0x05, 0x01, 0x02, 0x0C, 0x02, 0x01, 0x05, 0x0A,
+  0x05, 0x02, 0x01, 0x03, 0x0B, 0x04, 0x02, 0x01, 0x03, 0x0C, 0x04, 0x02,
+  0x00, 0x03, 0x0C, 0x04, 0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x00, 0x02,
+  0x0C, 0x04, 0x02, 0x00, 0x02, 0x0C, 0x04, 0x02, 0x00, 0x02, 0x0B, 0x05,
+  0x02, 0x00, 0x02, 0x0B, 0x04, 0x02, 0x00, 0x02, 0x0B, 0x04, 0x02, 0x01,
+  0x01, 0x0A, 0x04, 0x02, 0x01, 0x02, 0x09, 0x04, 0x02, 0x02, 0x02, 0x08,
+  0x03, 0x01, 0x04, 0x05, 0x01, 0x02, 0x0E, 0x01, 0x01, 0x0E, 0x02, 0x01,
+  0x01, 0x0C, 0x03, 0x02, 0x00, 0x01, 0x0C, 0x02, 0x01, 0x0B, 0x02, 0x01,
+  0x0B, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x03, 0x01, 0x09, 0x02, 0x01,
+  0x08, 0x02, 0x01, 0x07, 0x03, 0x01, 0x07, 0x02, 0x01, 0x06, 0x03, 0x01,
+  0x06, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x08, 0x05, 0x02, 0x06, 0x02, 0x0C,
+  0x03, 0x02, 0x05, 0x02, 0x0D, 0x02, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x02,
+  0x04, 0x02, 0x0E, 0x02, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x02, 0x04, 0x02,
+  0x0E, 0x02, 0x02, 0x04, 0x03, 0x0D, 0x02, 0x02, 0x05, 0x04, 0x0C, 0x03,
+  0x02, 0x05, 0x05, 0x0B, 0x02, 0x01, 0x06, 0x05, 0x01, 0x05, 0x07, 0x02,
+  0x03, 0x03, 0x08, 0x05, 0x02, 0x02, 0x02, 0x0A, 0x04, 0x02, 0x01, 0x02,
+  0x0B, 0x03, 0x02, 0x01, 0x02, 0x0C, 0x03, 0x02, 0x00, 0x02, 0x0D, 0x02,
+  0x02, 0x00, 0x02, 0x0D, 0x02, 0x02, 0x00, 0x02, 0x0D, 0x02, 0x02, 0x00,
+  0x02, 0x0D, 0x02, 0x02, 0x00, 0x03, 0x0C, 0x02, 0x02, 0x01, 0x02, 0x0B,
+  0x02, 0x02, 0x02, 0x03, 0x0A, 0x02, 0x01, 0x04, 0x06, 0x01, 0x07, 0x06,
+  0x02, 0x05, 0x04, 0x0C, 0x02, 0x02, 0x04, 0x03, 0x0D, 0x02, 0x02, 0x03,
+  0x04, 0x0E, 0x01, 0x02, 0x02, 0x04, 0x0E, 0x02, 0x02, 0x02, 0x04, 0x0E,
+  0x02, 0x02, 0x01, 0x04, 0x0E, 0x02, 0x02, 0x01, 0x04, 0x0E, 0x02, 0x02,
+  0x01, 0x04, 0x0E, 0x02, 0x02, 0x01, 0x04, 0x0D, 0x03, 0x02, 0x01, 0x04,
+  0x0D, 0x03, 0x02, 0x01, 0x04, 0x0D, 0x03, 0x02, 0x02, 0x04, 0x0C, 0x03,
+  0x02, 0x02, 0x05, 0x0B, 0x04, 0x02, 0x03, 0x08, 0x0C, 0x03, 0x02, 0x05,
+  0x04, 0x0B, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x04, 0x01, 0x09, 0x03,
+  0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x01, 0x04, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x00, 0x03, 0x01, 0x04, 0x02, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04,
+  0x01, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x02, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01,
+  0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x10, 0x02, 0x01, 0x0D, 0x05,
+  0x01, 0x0B, 0x06, 0x01, 0x09, 0x06, 0x01, 0x07, 0x05, 0x01, 0x05, 0x05,
+  0x01, 0x02, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x04, 0x01, 0x00, 0x05,
+  0x01, 0x01, 0x06, 0x01, 0x03, 0x06, 0x01, 0x06, 0x05, 0x01, 0x08, 0x05,
+  0x01, 0x0A, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x0E, 0x04, 0x01, 0x11, 0x01,
+  0x01, 0x00, 0x12, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00, 0x02, 0x01, 0x00, 0x04, 0x01,
+  0x01, 0x06, 0x01, 0x03, 0x06, 0x01, 0x05, 0x06, 0x01, 0x08, 0x05, 0x01,
+  0x0A, 0x05, 0x01, 0x0C, 0x06, 0x01, 0x0E, 0x04, 0x01, 0x0D, 0x05, 0x01,
+  0x0B, 0x06, 0x01, 0x09, 0x06, 0x01, 0x07, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x02, 0x06, 0x01, 0x00, 0x06, 0x01, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01,
+  0x04, 0x05, 0x02, 0x03, 0x02, 0x09, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x02,
+  0x02, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x01, 0x0A,
+  0x02, 0x01, 0x09, 0x02, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x02, 0x01, 0x09,
+  0x07, 0x01, 0x06, 0x0D, 0x02, 0x05, 0x04, 0x10, 0x04, 0x02, 0x04, 0x03,
+  0x12, 0x03, 0x02, 0x03, 0x03, 0x14, 0x02, 0x03, 0x02, 0x03, 0x0C, 0x03,
+  0x15, 0x02, 0x03, 0x01, 0x03, 0x0A, 0x09, 0x16, 0x01, 0x04, 0x01, 0x03,
+  0x09, 0x03, 0x0F, 0x04, 0x16, 0x02, 0x04, 0x00, 0x04, 0x09, 0x02, 0x10,
+  0x03, 0x17, 0x01, 0x04, 0x00, 0x03, 0x08, 0x02, 0x10, 0x02, 0x17, 0x01,
+  0x04, 0x00, 0x03, 0x08, 0x02, 0x10, 0x02, 0x17, 0x01, 0x04, 0x00, 0x03,
+  0x07, 0x02, 0x0F, 0x03, 0x17, 0x01, 0x04, 0x00, 0x03, 0x07, 0x02, 0x0F,
+  0x03, 0x17, 0x01, 0x04, 0x00, 0x03, 0x07, 0x02, 0x0F, 0x02, 0x16, 0x01,
+  0x04, 0x00, 0x03, 0x07, 0x02, 0x0E, 0x03, 0x16, 0x01, 0x04, 0x01, 0x03,
+  0x07, 0x02, 0x0E, 0x03, 0x15, 0x02, 0x04, 0x01, 0x03, 0x07, 0x03, 0x0D,
+  0x04, 0x14, 0x02, 0x03, 0x02, 0x03, 0x08, 0x05, 0x0F, 0x06, 0x03, 0x02,
+  0x04, 0x08, 0x04, 0x10, 0x04, 0x01, 0x03, 0x04, 0x02, 0x04, 0x05, 0x12,
+  0x02, 0x01, 0x06, 0x0D, 0x01, 0x09, 0x07, 0x01, 0x0E, 0x02, 0x01, 0x0E,
+  0x02, 0x01, 0x0D, 0x03, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0B,
+  0x05, 0x02, 0x0B, 0x01, 0x0D, 0x04, 0x02, 0x0A, 0x01, 0x0D, 0x04, 0x02,
+  0x09, 0x02, 0x0E, 0x03, 0x02, 0x09, 0x01, 0x0E, 0x03, 0x02, 0x08, 0x01,
+  0x0E, 0x03, 0x02, 0x08, 0x01, 0x0E, 0x03, 0x02, 0x07, 0x01, 0x0E, 0x04,
+  0x01, 0x06, 0x0C, 0x01, 0x06, 0x0C, 0x02, 0x05, 0x02, 0x0F, 0x03, 0x02,
+  0x05, 0x01, 0x0F, 0x03, 0x02, 0x04, 0x02, 0x0F, 0x03, 0x02, 0x03, 0x02,
+  0x0F, 0x04, 0x02, 0x03, 0x02, 0x0F, 0x04, 0x02, 0x02, 0x02, 0x0F, 0x04,
+  0x02, 0x01, 0x03, 0x0F, 0x05, 0x02, 0x00, 0x06, 0x0D, 0x08, 0x01, 0x05,
+  0x0C, 0x01, 0x07, 0x0C, 0x02, 0x07, 0x04, 0x10, 0x04, 0x02, 0x07, 0x04,
+  0x11, 0x04, 0x02, 0x07, 0x04, 0x11, 0x04, 0x02, 0x07, 0x03, 0x11, 0x04,
+  0x02, 0x07, 0x03, 0x11, 0x04, 0x02, 0x06, 0x04, 0x10, 0x04, 0x02, 0x06,
+  0x03, 0x0E, 0x05, 0x01, 0x06, 0x0A, 0x01, 0x05, 0x0B, 0x02, 0x05, 0x04,
+  0x0D, 0x04, 0x02, 0x05, 0x03, 0x0E, 0x04, 0x02, 0x05, 0x03, 0x0F, 0x04,
+  0x02, 0x04, 0x04, 0x0F, 0x04, 0x02, 0x04, 0x03, 0x0F, 0x04, 0x02, 0x04,
+  0x03, 0x0F, 0x04, 0x02, 0x03, 0x04, 0x0F, 0x04, 0x02, 0x03, 0x04, 0x0E,
+  0x04, 0x02, 0x03, 0x03, 0x0D, 0x05, 0x02, 0x03, 0x03, 0x0B, 0x06, 0x01,
+  0x02, 0x0E, 0x01, 0x00, 0x0D, 0x02, 0x0A, 0x06, 0x14, 0x01, 0x01, 0x08,
+  0x0D, 0x02, 0x06, 0x05, 0x10, 0x05, 0x02, 0x05, 0x04, 0x12, 0x03, 0x02,
+  0x04, 0x04, 0x12, 0x03, 0x02, 0x03, 0x04, 0x13, 0x01, 0x02, 0x02, 0x04,
+  0x13, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x02, 0x01, 0x03, 0x11,
+  0x01, 0x02, 0x01, 0x04, 0x10, 0x01, 0x02, 0x02, 0x04, 0x0F, 0x01, 0x02,
+  0x02, 0x05, 0x0D, 0x02, 0x01, 0x04, 0x0A, 0x01, 0x06, 0x06, 0x01, 0x05,
+  0x0D, 0x01, 0x07, 0x0E, 0x02, 0x07, 0x04, 0x11, 0x05, 0x02, 0x07, 0x04,
+  0x13, 0x04, 0x02, 0x07, 0x04, 0x14, 0x04, 0x02, 0x07, 0x03, 0x14, 0x04,
+  0x02, 0x07, 0x03, 0x15, 0x04, 0x02, 0x06, 0x04, 0x15, 0x04, 0x02, 0x06,
+  0x03, 0x15, 0x04, 0x02, 0x06, 0x03, 0x15, 0x04, 0x02, 0x05, 0x04, 0x15,
+  0x04, 0x02, 0x05, 0x04, 0x15, 0x04, 0x02, 0x05, 0x03, 0x15, 0x04, 0x02,
+  0x05, 0x03, 0x14, 0x04, 0x02, 0x04, 0x04, 0x14, 0x04, 0x02, 0x04, 0x04,
+  0x13, 0x05, 0x02, 0x04, 0x03, 0x13, 0x04, 0x02, 0x03, 0x04, 0x12, 0x04,
+  0x02, 0x03, 0x04, 0x11, 0x04, 0x02, 0x03, 0x03, 0x0F, 0x05, 0x02, 0x03,
+  0x03, 0x0D, 0x06, 0x01, 0x02, 0x0F, 0x01, 0x00, 0x0E, 0x01, 0x05, 0x11,
+  0x01, 0x07, 0x0F, 0x02, 0x07, 0x04, 0x13, 0x03, 0x02, 0x07, 0x04, 0x14,
+  0x01, 0x02, 0x07, 0x04, 0x14, 0x01, 0x01, 0x07, 0x03, 0x02, 0x07, 0x03,
+  0x10, 0x01, 0x02, 0x06, 0x04, 0x0F, 0x02, 0x02, 0x06, 0x03, 0x0E, 0x03,
+  0x01, 0x06, 0x0A, 0x01, 0x05, 0x0B, 0x02, 0x05, 0x04, 0x0E, 0x02, 0x02,
+  0x05, 0x03, 0x0E, 0x02, 0x02, 0x05, 0x03, 0x0E, 0x01, 0x02, 0x04, 0x04,
+  0x0E, 0x01, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x02, 0x03, 0x04, 0x12,
+  0x01, 0x02, 0x03, 0x04, 0x11, 0x02, 0x02, 0x03, 0x03, 0x10, 0x03, 0x02,
+  0x03, 0x03, 0x0E, 0x04, 0x01, 0x02, 0x10, 0x01, 0x00, 0x12, 0x01, 0x05,
+  0x11, 0x01, 0x07, 0x0F, 0x02, 0x07, 0x04, 0x13, 0x03, 0x02, 0x07, 0x04,
+  0x14, 0x01, 0x02, 0x07, 0x04, 0x14, 0x01, 0x02, 0x07, 0x03, 0x14, 0x01,
+  0x01, 0x07, 0x03, 0x02, 0x06, 0x04, 0x10, 0x01, 0x02, 0x06, 0x03, 0x0F,
+  0x02, 0x02, 0x06, 0x03, 0x0E, 0x02, 0x01, 0x05, 0x0B, 0x01, 0x05, 0x0B,
+  0x02, 0x05, 0x03, 0x0E, 0x02, 0x02, 0x05, 0x03, 0x0E, 0x02, 0x02, 0x04,
+  0x04, 0x0E, 0x01, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x05,
+  0x01, 0x00, 0x09, 0x02, 0x0A, 0x06, 0x16, 0x01, 0x02, 0x08, 0x0A, 0x15,
+  0x01, 0x02, 0x06, 0x05, 0x11, 0x05, 0x02, 0x05, 0x04, 0x12, 0x04, 0x02,
+  0x04, 0x04, 0x13, 0x03, 0x02, 0x03, 0x04, 0x14, 0x01, 0x02, 0x02, 0x05,
+  0x14, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x00, 0x05, 0x02, 0x00, 0x04, 0x0E, 0x09, 0x02, 0x00,
+  0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x10, 0x03, 0x02, 0x00, 0x04, 0x10,
+  0x03, 0x02, 0x00, 0x04, 0x10, 0x03, 0x02, 0x01, 0x03, 0x10, 0x03, 0x02,
+  0x01, 0x04, 0x0F, 0x03, 0x02, 0x02, 0x04, 0x0F, 0x03, 0x02, 0x03, 0x05,
+  0x0E, 0x04, 0x01, 0x04, 0x0D, 0x01, 0x06, 0x08, 0x02, 0x05, 0x09, 0x12,
+  0x09, 0x02, 0x07, 0x05, 0x15, 0x04, 0x02, 0x07, 0x04, 0x15, 0x03, 0x02,
+  0x07, 0x04, 0x15, 0x03, 0x02, 0x07, 0x03, 0x14, 0x04, 0x02, 0x07, 0x03,
+  0x14, 0x04, 0x02, 0x07, 0x03, 0x14, 0x03, 0x02, 0x06, 0x04, 0x14, 0x03,
+  0x02, 0x06, 0x03, 0x13, 0x04, 0x02, 0x06, 0x03, 0x13, 0x03, 0x01, 0x05,
+  0x11, 0x01, 0x05, 0x11, 0x02, 0x05, 0x03, 0x12, 0x04, 0x02, 0x05, 0x03,
+  0x12, 0x03, 0x02, 0x04, 0x04, 0x12, 0x03, 0x02, 0x04, 0x03, 0x11, 0x04,
+  0x02, 0x04, 0x03, 0x11, 0x04, 0x02, 0x03, 0x04, 0x11, 0x03, 0x02, 0x03,
+  0x04, 0x11, 0x03, 0x02, 0x03, 0x03, 0x10, 0x04, 0x02, 0x03, 0x03, 0x10,
+  0x03, 0x02, 0x02, 0x04, 0x0F, 0x05, 0x02, 0x00, 0x09, 0x0D, 0x09, 0x01,
+  0x05, 0x09, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01,
+  0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01,
+  0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x00, 0x09, 0x01, 0x08, 0x09, 0x01,
+  0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01,
+  0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x04, 0x01,
+  0x07, 0x03, 0x01, 0x07, 0x03, 0x02, 0x00, 0x04, 0x06, 0x04, 0x02, 0x00,
+  0x04, 0x06, 0x03, 0x01, 0x00, 0x08, 0x01, 0x01, 0x05, 0x02, 0x05, 0x09,
+  0x11, 0x08, 0x02, 0x07, 0x05, 0x13, 0x04, 0x02, 0x08, 0x03, 0x13, 0x03,
+  0x02, 0x07, 0x04, 0x12, 0x03, 0x02, 0x07, 0x03, 0x11, 0x02, 0x02, 0x07,
+  0x03, 0x10, 0x02, 0x02, 0x07, 0x03, 0x0E, 0x02, 0x02, 0x06, 0x04, 0x0D,
+  0x02, 0x02, 0x06, 0x03, 0x0B, 0x03, 0x02, 0x06, 0x03, 0x0A, 0x02, 0x01,
+  0x05, 0x07, 0x01, 0x05, 0x08, 0x02, 0x05, 0x03, 0x0A, 0x03, 0x02, 0x05,
+  0x03, 0x0A, 0x04, 0x02, 0x04, 0x04, 0x0B, 0x04, 0x02, 0x04, 0x03, 0x0C,
+  0x03, 0x02, 0x04, 0x03, 0x0C, 0x04, 0x02, 0x04, 0x03, 0x0D, 0x03, 0x02,
+  0x03, 0x04, 0x0D, 0x04, 0x02, 0x03, 0x03, 0x0E, 0x03, 0x02, 0x03, 0x03,
+  0x0E, 0x04, 0x02, 0x02, 0x04, 0x0E, 0x05, 0x02, 0x00, 0x09, 0x0C, 0x09,
+  0x01, 0x05, 0x09, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04,
+  0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03,
+  0x02, 0x04, 0x03, 0x13, 0x01, 0x02, 0x03, 0x04, 0x12, 0x02, 0x02, 0x03,
+  0x04, 0x11, 0x02, 0x02, 0x03, 0x03, 0x11, 0x02, 0x02, 0x03, 0x03, 0x0F,
+  0x04, 0x01, 0x02, 0x10, 0x01, 0x00, 0x12, 0x02, 0x05, 0x07, 0x19, 0x06,
+  0x02, 0x07, 0x05, 0x18, 0x05, 0x02, 0x08, 0x04, 0x18, 0x05, 0x02, 0x08,
+  0x04, 0x17, 0x05, 0x03, 0x07, 0x05, 0x16, 0x02, 0x19, 0x03, 0x04, 0x07,
+  0x01, 0x09, 0x03, 0x16, 0x01, 0x18, 0x04, 0x04, 0x07, 0x01, 0x09, 0x03,
+  0x15, 0x02, 0x18, 0x03, 0x04, 0x06, 0x02, 0x09, 0x03, 0x14, 0x02, 0x18,
+  0x03, 0x04, 0x06, 0x01, 0x09, 0x04, 0x14, 0x01, 0x17, 0x04, 0x04, 0x06,
+  0x01, 0x0A, 0x03, 0x13, 0x02, 0x17, 0x04, 0x04, 0x06, 0x01, 0x0A, 0x03,
+  0x12, 0x02, 0x17, 0x03, 0x04, 0x05, 0x02, 0x0A, 0x03, 0x12, 0x01, 0x17,
+  0x03, 0x04, 0x05, 0x01, 0x0A, 0x03, 0x11, 0x02, 0x16, 0x04, 0x04, 0x05,
+  0x01, 0x0A, 0x03, 0x10, 0x02, 0x16, 0x03, 0x04, 0x04, 0x02, 0x0A, 0x03,
+  0x10, 0x01, 0x16, 0x03, 0x04, 0x04, 0x02, 0x0A, 0x03, 0x0F, 0x02, 0x15,
+  0x04, 0x04, 0x04, 0x01, 0x0A, 0x03, 0x0E, 0x02, 0x15, 0x04, 0x03, 0x04,
+  0x01, 0x0A, 0x05, 0x15, 0x03, 0x03, 0x03, 0x02, 0x0B, 0x04, 0x15, 0x03,
+  0x03, 0x03, 0x01, 0x0B, 0x03, 0x14, 0x04, 0x03, 0x02, 0x02, 0x0B, 0x02,
+  0x14, 0x04, 0x03, 0x02, 0x03, 0x0B, 0x02, 0x13, 0x05, 0x03, 0x00, 0x07,
+  0x0B, 0x01, 0x11, 0x09, 0x02, 0x05, 0x05, 0x12, 0x08, 0x02, 0x07, 0x04,
+  0x14, 0x05, 0x02, 0x08, 0x03, 0x15, 0x03, 0x02, 0x08, 0x04, 0x15, 0x02,
+  0x02, 0x07, 0x05, 0x14, 0x03, 0x03, 0x07, 0x02, 0x0A, 0x02, 0x14, 0x02,
+  0x03, 0x07, 0x02, 0x0A, 0x03, 0x14, 0x02, 0x03, 0x06, 0x02, 0x0A, 0x03,
+  0x14, 0x02, 0x03, 0x06, 0x02, 0x0B, 0x02, 0x13, 0x03, 0x03, 0x06, 0x02,
+  0x0B, 0x03, 0x13, 0x02, 0x03, 0x06, 0x02, 0x0C, 0x02, 0x13, 0x02, 0x03,
+  0x05, 0x02, 0x0C, 0x03, 0x12, 0x03, 0x03, 0x05, 0x02, 0x0D, 0x02, 0x12,
+  0x02, 0x03, 0x05, 0x02, 0x0D, 0x02, 0x12, 0x02, 0x03, 0x04, 0x02, 0x0D,
+  0x03, 0x12, 0x02, 0x03, 0x04, 0x02, 0x0E, 0x02, 0x11, 0x03, 0x02, 0x04,
+  0x02, 0x0E, 0x05, 0x02, 0x04, 0x02, 0x0F, 0x04, 0x02, 0x03, 0x02, 0x0F,
+  0x04, 0x02, 0x03, 0x02, 0x0F, 0x03, 0x02, 0x02, 0x03, 0x10, 0x02, 0x02,
+  0x02, 0x03, 0x10, 0x02, 0x02, 0x00, 0x07, 0x11, 0x01, 0x01, 0x0C, 0x06,
+  0x01, 0x09, 0x0B, 0x02, 0x07, 0x05, 0x11, 0x04, 0x02, 0x06, 0x04, 0x12,
+  0x04, 0x02, 0x05, 0x04, 0x13, 0x03, 0x02, 0x04, 0x04, 0x13, 0x04, 0x02,
+  0x03, 0x04, 0x13, 0x04, 0x02, 0x02, 0x05, 0x13, 0x04, 0x02, 0x02, 0x04,
+  0x13, 0x04, 0x02, 0x01, 0x05, 0x13, 0x04, 0x02, 0x01, 0x04, 0x12, 0x05,
+  0x02, 0x00, 0x05, 0x12, 0x04, 0x02, 0x00, 0x05, 0x12, 0x04, 0x02, 0x00,
+  0x04, 0x11, 0x05, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x10,
+  0x05, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02,
+  0x01, 0x03, 0x0E, 0x04, 0x02, 0x01, 0x04, 0x0D, 0x04, 0x02, 0x02, 0x04,
+  0x0B, 0x05, 0x01, 0x03, 0x0B, 0x01, 0x05, 0x07, 0x01, 0x05, 0x0D, 0x01,
+  0x07, 0x0D, 0x02, 0x08, 0x03, 0x10, 0x05, 0x02, 0x07, 0x04, 0x11, 0x05,
+  0x02, 0x07, 0x03, 0x12, 0x04, 0x02, 0x07, 0x03, 0x12, 0x04, 0x02, 0x07,
+  0x03, 0x12, 0x04, 0x02, 0x06, 0x04, 0x12, 0x04, 0x02, 0x06, 0x03, 0x11,
+  0x04, 0x02, 0x06, 0x03, 0x11, 0x04, 0x02, 0x05, 0x04, 0x0F, 0x05, 0x01,
+  0x05, 0x0E, 0x02, 0x05, 0x03, 0x09, 0x07, 0x01, 0x05, 0x03, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x00,
+  0x08, 0x01, 0x0C, 0x06, 0x01, 0x09, 0x0B, 0x02, 0x08, 0x04, 0x11, 0x04,
+  0x02, 0x06, 0x04, 0x12, 0x03, 0x02, 0x05, 0x04, 0x12, 0x04, 0x02, 0x04,
+  0x04, 0x13, 0x03, 0x02, 0x03, 0x04, 0x13, 0x04, 0x02, 0x03, 0x04, 0x13,
+  0x04, 0x02, 0x02, 0x04, 0x13, 0x04, 0x02, 0x02, 0x04, 0x13, 0x04, 0x02,
+  0x01, 0x04, 0x13, 0x04, 0x02, 0x01, 0x04, 0x12, 0x05, 0x02, 0x00, 0x05,
+  0x12, 0x04, 0x02, 0x00, 0x04, 0x12, 0x04, 0x02, 0x00, 0x04, 0x11, 0x05,
+  0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02, 0x00,
+  0x04, 0x10, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x01, 0x03, 0x0E,
+  0x04, 0x02, 0x01, 0x04, 0x0D, 0x04, 0x02, 0x02, 0x03, 0x0C, 0x03, 0x02,
+  0x04, 0x04, 0x09, 0x04, 0x01, 0x06, 0x03, 0x01, 0x05, 0x02, 0x02, 0x04,
+  0x02, 0x14, 0x01, 0x02, 0x03, 0x09, 0x12, 0x02, 0x01, 0x01, 0x12, 0x02,
+  0x00, 0x01, 0x09, 0x07, 0x01, 0x05, 0x0C, 0x01, 0x07, 0x0C, 0x02, 0x07,
+  0x04, 0x10, 0x04, 0x02, 0x07, 0x04, 0x11, 0x04, 0x02, 0x07, 0x04, 0x11,
+  0x04, 0x02, 0x07, 0x03, 0x11, 0x04, 0x02, 0x07, 0x03, 0x11, 0x04, 0x02,
+  0x06, 0x04, 0x10, 0x04, 0x02, 0x06, 0x03, 0x0E, 0x06, 0x01, 0x06, 0x0C,
+  0x01, 0x05, 0x0B, 0x02, 0x05, 0x04, 0x0B, 0x03, 0x02, 0x05, 0x03, 0x0B,
+  0x04, 0x02, 0x05, 0x03, 0x0C, 0x03, 0x02, 0x04, 0x04, 0x0C, 0x03, 0x02,
+  0x04, 0x03, 0x0C, 0x04, 0x02, 0x04, 0x03, 0x0D, 0x03, 0x02, 0x03, 0x04,
+  0x0D, 0x04, 0x02, 0x03, 0x04, 0x0D, 0x04, 0x02, 0x03, 0x03, 0x0E, 0x03,
+  0x02, 0x03, 0x03, 0x0E, 0x04, 0x02, 0x02, 0x04, 0x0F, 0x04, 0x02, 0x00,
+  0x08, 0x0F, 0x05, 0x02, 0x08, 0x05, 0x10, 0x01, 0x01, 0x06, 0x0B, 0x02,
+  0x05, 0x04, 0x0D, 0x04, 0x02, 0x04, 0x04, 0x0E, 0x03, 0x02, 0x04, 0x04,
+  0x0F, 0x01, 0x02, 0x04, 0x04, 0x0F, 0x01, 0x01, 0x04, 0x04, 0x01, 0x04,
+  0x05, 0x01, 0x05, 0x04, 0x01, 0x06, 0x04, 0x01, 0x07, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x09, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x05, 0x02, 0x01,
+  0x01, 0x0B, 0x04, 0x02, 0x01, 0x01, 0x0B, 0x04, 0x02, 0x01, 0x01, 0x0B,
+  0x04, 0x02, 0x00, 0x03, 0x0B, 0x04, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x02,
+  0x00, 0x05, 0x09, 0x04, 0x02, 0x00, 0x01, 0x04, 0x09, 0x02, 0x00, 0x01,
+  0x06, 0x05, 0x01, 0x02, 0x12, 0x01, 0x01, 0x13, 0x03, 0x01, 0x03, 0x09,
+  0x04, 0x11, 0x03, 0x03, 0x01, 0x02, 0x09, 0x03, 0x12, 0x01, 0x03, 0x00,
+  0x02, 0x09, 0x03, 0x12, 0x01, 0x03, 0x00, 0x01, 0x08, 0x04, 0x12, 0x01,
+  0x01, 0x08, 0x04, 0x01, 0x08, 0x03, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x05,
+  0x01, 0x00, 0x0B, 0x02, 0x01, 0x0A, 0x10, 0x07, 0x02, 0x03, 0x06, 0x12,
+  0x04, 0x02, 0x04, 0x04, 0x13, 0x02, 0x02, 0x03, 0x04, 0x12, 0x02, 0x02,
+  0x03, 0x04, 0x12, 0x02, 0x02, 0x03, 0x04, 0x12, 0x02, 0x02, 0x03, 0x03,
+  0x12, 0x01, 0x02, 0x02, 0x04, 0x11, 0x02, 0x02, 0x02, 0x04, 0x11, 0x02,
+  0x02, 0x02, 0x03, 0x11, 0x01, 0x02, 0x01, 0x04, 0x11, 0x01, 0x02, 0x01,
+  0x04, 0x10, 0x02, 0x02, 0x01, 0x04, 0x10, 0x02, 0x02, 0x01, 0x03, 0x10,
+  0x01, 0x02, 0x00, 0x04, 0x0F, 0x02, 0x02, 0x00, 0x04, 0x0F, 0x02, 0x02,
+  0x00, 0x04, 0x0F, 0x01, 0x02, 0x00, 0x04, 0x0E, 0x02, 0x02, 0x00, 0x04,
+  0x0E, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x02, 0x02, 0x01, 0x05, 0x0B, 0x03,
+  0x01, 0x02, 0x0B, 0x01, 0x04, 0x07, 0x02, 0x00, 0x08, 0x0F, 0x06, 0x02,
+  0x01, 0x05, 0x10, 0x04, 0x02, 0x02, 0x03, 0x11, 0x02, 0x02, 0x02, 0x04,
+  0x10, 0x02, 0x02, 0x02, 0x04, 0x10, 0x02, 0x02, 0x02, 0x04, 0x0F, 0x02,
+  0x02, 0x02, 0x04, 0x0F, 0x02, 0x02, 0x03, 0x03, 0x0E, 0x02, 0x02, 0x03,
+  0x03, 0x0E, 0x01, 0x02, 0x03, 0x03, 0x0D, 0x02, 0x02, 0x03, 0x04, 0x0C,
+  0x02, 0x02, 0x03, 0x04, 0x0C, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x02, 0x02,
+  0x04, 0x03, 0x0B, 0x01, 0x02, 0x04, 0x03, 0x0A, 0x01, 0x02, 0x04, 0x03,
+  0x0A, 0x01, 0x02, 0x04, 0x03, 0x09, 0x01, 0x01, 0x04, 0x05, 0x01, 0x04,
+  0x05, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x05,
+  0x01, 0x03, 0x00, 0x08, 0x0A, 0x08, 0x16, 0x07, 0x03, 0x01, 0x05, 0x0C,
+  0x04, 0x18, 0x04, 0x03, 0x02, 0x03, 0x0C, 0x04, 0x19, 0x02, 0x03, 0x02,
+  0x04, 0x0D, 0x03, 0x18, 0x02, 0x03, 0x02, 0x04, 0x0D, 0x03, 0x18, 0x02,
+  0x03, 0x02, 0x04, 0x0D, 0x03, 0x18, 0x01, 0x03, 0x02, 0x04, 0x0C, 0x04,
+  0x17, 0x02, 0x03, 0x03, 0x03, 0x0C, 0x04, 0x16, 0x02, 0x04, 0x03, 0x03,
+  0x0B, 0x01, 0x0D, 0x04, 0x16, 0x02, 0x04, 0x03, 0x03, 0x0B, 0x01, 0x0D,
+  0x04, 0x15, 0x02, 0x04, 0x03, 0x03, 0x0A, 0x01, 0x0D, 0x04, 0x15, 0x01,
+  0x04, 0x03, 0x03, 0x0A, 0x01, 0x0E, 0x03, 0x14, 0x02, 0x04, 0x03, 0x04,
+  0x09, 0x01, 0x0E, 0x03, 0x14, 0x01, 0x04, 0x03, 0x04, 0x09, 0x01, 0x0E,
+  0x03, 0x13, 0x02, 0x04, 0x03, 0x04, 0x08, 0x01, 0x0E, 0x03, 0x13, 0x01,
+  0x04, 0x04, 0x03, 0x08, 0x01, 0x0E, 0x03, 0x12, 0x02, 0x03, 0x04, 0x04,
+  0x0E, 0x03, 0x12, 0x01, 0x02, 0x04, 0x04, 0x0E, 0x05, 0x02, 0x04, 0x03,
+  0x0E, 0x04, 0x02, 0x04, 0x03, 0x0E, 0x03, 0x02, 0x04, 0x02, 0x0E, 0x03,
+  0x02, 0x04, 0x02, 0x0F, 0x01, 0x02, 0x04, 0x01, 0x0F, 0x01, 0x02, 0x04,
+  0x09, 0x11, 0x07, 0x02, 0x06, 0x05, 0x12, 0x05, 0x02, 0x07, 0x03, 0x13,
+  0x02, 0x02, 0x07, 0x04, 0x12, 0x02, 0x02, 0x07, 0x04, 0x11, 0x02, 0x02,
+  0x08, 0x03, 0x10, 0x02, 0x02, 0x08, 0x04, 0x0F, 0x03, 0x02, 0x09, 0x03,
+  0x0F, 0x02, 0x02, 0x09, 0x04, 0x0E, 0x02, 0x01, 0x0A, 0x05, 0x01, 0x0A,
+  0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x06, 0x02, 0x08,
+  0x02, 0x0C, 0x03, 0x02, 0x07, 0x02, 0x0C, 0x04, 0x02, 0x07, 0x01, 0x0D,
+  0x03, 0x02, 0x06, 0x02, 0x0D, 0x03, 0x02, 0x05, 0x02, 0x0D, 0x04, 0x02,
+  0x04, 0x02, 0x0E, 0x03, 0x02, 0x03, 0x02, 0x0E, 0x04, 0x02, 0x01, 0x04,
+  0x0E, 0x05, 0x02, 0x00, 0x07, 0x0B, 0x0A, 0x02, 0x00, 0x09, 0x0D, 0x06,
+  0x02, 0x02, 0x05, 0x0F, 0x03, 0x02, 0x03, 0x03, 0x0F, 0x02, 0x02, 0x03,
+  0x03, 0x0E, 0x02, 0x02, 0x03, 0x04, 0x0E, 0x02, 0x02, 0x04, 0x03, 0x0D,
+  0x02, 0x02, 0x04, 0x03, 0x0C, 0x02, 0x02, 0x04, 0x04, 0x0B, 0x02, 0x02,
+  0x05, 0x03, 0x0A, 0x02, 0x02, 0x05, 0x03, 0x0A, 0x01, 0x02, 0x05, 0x03,
+  0x09, 0x02, 0x01, 0x05, 0x05, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01,
+  0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x02, 0x05, 0x01,
+  0x00, 0x0A, 0x01, 0x05, 0x11, 0x01, 0x04, 0x11, 0x02, 0x04, 0x03, 0x10,
+  0x05, 0x02, 0x04, 0x01, 0x10, 0x04, 0x02, 0x03, 0x02, 0x0F, 0x04, 0x02,
+  0x03, 0x01, 0x0E, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0C,
+  0x03, 0x01, 0x0B, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08,
+  0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x01, 0x05,
+  0x04, 0x02, 0x04, 0x04, 0x12, 0x02, 0x02, 0x03, 0x04, 0x12, 0x01, 0x02,
+  0x02, 0x04, 0x11, 0x02, 0x02, 0x02, 0x03, 0x0F, 0x04, 0x01, 0x01, 0x11,
+  0x01, 0x00, 0x12, 0x01, 0x07, 0x06, 0x01, 0x07, 0x02, 0x01, 0x06, 0x02,
+  0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x05, 0x02,
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04, 0x02,
+  0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02,
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02,
+  0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x02, 0x03, 0x01, 0x03, 0x02,
+  0x01, 0x03, 0x03, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x03,
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x03, 0x01, 0x06, 0x02, 0x01, 0x06, 0x03,
+  0x01, 0x07, 0x02, 0x01, 0x07, 0x03, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02,
+  0x01, 0x08, 0x03, 0x01, 0x09, 0x02, 0x01, 0x09, 0x03, 0x01, 0x0A, 0x02,
+  0x01, 0x06, 0x06, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02,
+  0x01, 0x09, 0x02, 0x01, 0x08, 0x03, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02,
+  0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02,
+  0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02,
+  0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x05, 0x02,
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x04, 0x02,
+  0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x00, 0x06,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x05, 0x02, 0x05, 0x02,
+  0x08, 0x02, 0x02, 0x04, 0x02, 0x08, 0x03, 0x02, 0x04, 0x02, 0x09, 0x02,
+  0x02, 0x03, 0x02, 0x09, 0x03, 0x02, 0x03, 0x02, 0x0A, 0x02, 0x02, 0x02,
+  0x03, 0x0A, 0x03, 0x02, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x01, 0x03, 0x0B,
+  0x03, 0x02, 0x01, 0x02, 0x0C, 0x02, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x01,
+  0x00, 0x12, 0x01, 0x00, 0x12, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x04, 0x01, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x04, 0x02, 0x02,
+  0x07, 0x04, 0x0C, 0x02, 0x03, 0x05, 0x03, 0x0A, 0x01, 0x0C, 0x02, 0x02,
+  0x04, 0x02, 0x0B, 0x03, 0x02, 0x03, 0x03, 0x0B, 0x02, 0x02, 0x02, 0x03,
+  0x0B, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x03, 0x02, 0x01, 0x03, 0x0A, 0x02,
+  0x02, 0x01, 0x03, 0x0A, 0x02, 0x02, 0x00, 0x03, 0x09, 0x03, 0x02, 0x00,
+  0x03, 0x09, 0x03, 0x02, 0x00, 0x03, 0x08, 0x03, 0x04, 0x00, 0x03, 0x07,
+  0x01, 0x09, 0x02, 0x0D, 0x01, 0x04, 0x00, 0x04, 0x06, 0x02, 0x09, 0x02,
+  0x0C, 0x02, 0x02, 0x01, 0x06, 0x09, 0x04, 0x02, 0x01, 0x05, 0x09, 0x03,
+  0x01, 0x06, 0x02, 0x01, 0x03, 0x05, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x02, 0x02, 0x03, 0x03, 0x09, 0x05, 0x02, 0x03, 0x03, 0x08,
+  0x07, 0x03, 0x03, 0x02, 0x07, 0x02, 0x0C, 0x04, 0x03, 0x03, 0x02, 0x06,
+  0x01, 0x0D, 0x03, 0x02, 0x02, 0x04, 0x0D, 0x03, 0x02, 0x02, 0x03, 0x0D,
+  0x03, 0x02, 0x02, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x02,
+  0x01, 0x03, 0x0C, 0x03, 0x02, 0x01, 0x03, 0x0B, 0x03, 0x02, 0x01, 0x02,
+  0x0B, 0x02, 0x02, 0x00, 0x03, 0x0A, 0x02, 0x02, 0x00, 0x03, 0x09, 0x02,
+  0x02, 0x00, 0x03, 0x07, 0x03, 0x01, 0x02, 0x06, 0x01, 0x07, 0x05, 0x02,
+  0x05, 0x03, 0x0B, 0x02, 0x02, 0x04, 0x03, 0x0A, 0x03, 0x02, 0x02, 0x04,
+  0x0A, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x02,
+  0x00, 0x04, 0x0A, 0x01, 0x02, 0x01, 0x04, 0x09, 0x01, 0x01, 0x01, 0x08,
+  0x01, 0x03, 0x05, 0x01, 0x0F, 0x02, 0x01, 0x0C, 0x05, 0x01, 0x0E, 0x03,
+  0x01, 0x0E, 0x02, 0x01, 0x0E, 0x02, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03,
+  0x01, 0x0D, 0x02, 0x01, 0x0D, 0x02, 0x02, 0x07, 0x04, 0x0C, 0x03, 0x02,
+  0x05, 0x03, 0x0B, 0x04, 0x02, 0x04, 0x03, 0x0B, 0x03, 0x02, 0x03, 0x03,
+  0x0B, 0x03, 0x02, 0x02, 0x04, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x02,
+  0x02, 0x01, 0x04, 0x0B, 0x02, 0x02, 0x01, 0x04, 0x0A, 0x03, 0x02, 0x00,
+  0x04, 0x0A, 0x02, 0x02, 0x00, 0x04, 0x0A, 0x02, 0x02, 0x00, 0x04, 0x09,
+  0x02, 0x03, 0x00, 0x04, 0x08, 0x03, 0x0E, 0x01, 0x04, 0x00, 0x05, 0x07,
+  0x01, 0x09, 0x02, 0x0D, 0x01, 0x02, 0x01, 0x06, 0x09, 0x04, 0x02, 0x02,
+  0x04, 0x09, 0x03, 0x01, 0x08, 0x04, 0x02, 0x06, 0x03, 0x0B, 0x02, 0x02,
+  0x04, 0x03, 0x0B, 0x02, 0x02, 0x03, 0x03, 0x0B, 0x02, 0x02, 0x02, 0x04,
+  0x0A, 0x02, 0x02, 0x02, 0x03, 0x09, 0x02, 0x02, 0x01, 0x04, 0x08, 0x02,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04,
+  0x02, 0x00, 0x04, 0x0A, 0x01, 0x02, 0x01, 0x04, 0x09, 0x01, 0x01, 0x01,
+  0x08, 0x01, 0x03, 0x05, 0x01, 0x0F, 0x04, 0x02, 0x0E, 0x02, 0x12, 0x02,
+  0x02, 0x0D, 0x02, 0x12, 0x02, 0x01, 0x0C, 0x02, 0x01, 0x0C, 0x02, 0x01,
+  0x0B, 0x03, 0x01, 0x0B, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x0A, 0x03, 0x01,
+  0x06, 0x0B, 0x01, 0x06, 0x0B, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x03, 0x01,
+  0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02, 0x01,
+  0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01,
+  0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01,
+  0x07, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x02, 0x00, 0x02, 0x05,
+  0x02, 0x02, 0x00, 0x02, 0x04, 0x02, 0x01, 0x01, 0x04, 0x01, 0x07, 0x06,
+  0x02, 0x05, 0x03, 0x0B, 0x05, 0x02, 0x04, 0x03, 0x0C, 0x04, 0x02, 0x04,
+  0x02, 0x0C, 0x03, 0x02, 0x03, 0x02, 0x0C, 0x03, 0x02, 0x03, 0x02, 0x0C,
+  0x03, 0x02, 0x03, 0x02, 0x0B, 0x04, 0x02, 0x03, 0x02, 0x0A, 0x04, 0x02,
+  0x04, 0x02, 0x09, 0x04, 0x01, 0x05, 0x06, 0x01, 0x04, 0x01, 0x01, 0x03,
+  0x02, 0x01, 0x03, 0x04, 0x01, 0x04, 0x07, 0x02, 0x03, 0x01, 0x06, 0x06,
+  0x02, 0x01, 0x02, 0x09, 0x04, 0x02, 0x00, 0x02, 0x0A, 0x03, 0x02, 0x00,
+  0x02, 0x0B, 0x02, 0x02, 0x00, 0x02, 0x0B, 0x02, 0x02, 0x00, 0x02, 0x0A,
+  0x02, 0x02, 0x01, 0x02, 0x09, 0x02, 0x01, 0x02, 0x07, 0x01, 0x06, 0x02,
+  0x01, 0x03, 0x05, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02,
+  0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02,
+  0x02, 0x03, 0x03, 0x0A, 0x03, 0x02, 0x03, 0x03, 0x09, 0x05, 0x03, 0x03,
+  0x03, 0x08, 0x02, 0x0C, 0x02, 0x03, 0x03, 0x02, 0x07, 0x01, 0x0C, 0x02,
+  0x03, 0x02, 0x03, 0x06, 0x01, 0x0C, 0x02, 0x02, 0x02, 0x04, 0x0B, 0x03,
+  0x02, 0x02, 0x04, 0x0B, 0x02, 0x02, 0x02, 0x03, 0x0B, 0x02, 0x02, 0x01,
+  0x03, 0x0A, 0x03, 0x02, 0x01, 0x03, 0x0A, 0x03, 0x02, 0x01, 0x03, 0x0A,
+  0x02, 0x03, 0x01, 0x02, 0x09, 0x03, 0x0E, 0x01, 0x03, 0x00, 0x03, 0x09,
+  0x03, 0x0D, 0x02, 0x02, 0x00, 0x03, 0x09, 0x05, 0x02, 0x00, 0x02, 0x09,
+  0x03, 0x01, 0x06, 0x02, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x06,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x02, 0x01, 0x00, 0x06, 0x01,
+  0x02, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01,
+  0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x02, 0x00, 0x03, 0x06, 0x01, 0x02, 0x00, 0x02, 0x05, 0x01,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0x0C, 0x02, 0x01, 0x0B, 0x04,
+  0x01, 0x0B, 0x04, 0x01, 0x0C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B,
+  0x02, 0x01, 0x07, 0x06, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x02, 0x01, 0x0A,
+  0x02, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x02, 0x01, 0x09,
+  0x02, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x02, 0x01, 0x08,
+  0x02, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x02, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02,
+  0x02, 0x00, 0x02, 0x04, 0x02, 0x01, 0x01, 0x04, 0x01, 0x06, 0x02, 0x01,
+  0x03, 0x05, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01,
+  0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02, 0x02,
+  0x03, 0x03, 0x09, 0x06, 0x02, 0x03, 0x03, 0x0B, 0x02, 0x02, 0x03, 0x03,
+  0x0A, 0x02, 0x02, 0x03, 0x02, 0x09, 0x02, 0x02, 0x02, 0x03, 0x08, 0x01,
+  0x02, 0x02, 0x03, 0x07, 0x01, 0x02, 0x02, 0x02, 0x05, 0x03, 0x01, 0x02,
+  0x06, 0x02, 0x01, 0x03, 0x06, 0x03, 0x02, 0x01, 0x03, 0x06, 0x03, 0x02,
+  0x01, 0x02, 0x07, 0x02, 0x03, 0x01, 0x02, 0x07, 0x03, 0x0D, 0x01, 0x03,
+  0x00, 0x03, 0x08, 0x03, 0x0C, 0x01, 0x02, 0x00, 0x03, 0x08, 0x05, 0x02,
+  0x00, 0x02, 0x09, 0x03, 0x01, 0x06, 0x02, 0x01, 0x03, 0x05, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x02, 0x01, 0x02, 0x05, 0x01, 0x02, 0x00, 0x03, 0x05, 0x01, 0x02,
+  0x00, 0x03, 0x04, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x00, 0x03,
+  0x05, 0x02, 0x0B, 0x02, 0x13, 0x04, 0x03, 0x02, 0x05, 0x0A, 0x04, 0x12,
+  0x06, 0x05, 0x04, 0x03, 0x09, 0x01, 0x0C, 0x02, 0x11, 0x01, 0x15, 0x03,
+  0x05, 0x04, 0x02, 0x08, 0x01, 0x0C, 0x02, 0x10, 0x01, 0x14, 0x03, 0x05,
+  0x03, 0x03, 0x07, 0x01, 0x0C, 0x02, 0x0F, 0x01, 0x14, 0x03, 0x04, 0x03,
+  0x04, 0x0B, 0x02, 0x0E, 0x01, 0x14, 0x03, 0x03, 0x03, 0x03, 0x0B, 0x04,
+  0x14, 0x02, 0x03, 0x02, 0x04, 0x0B, 0x03, 0x13, 0x03, 0x03, 0x02, 0x03,
+  0x0A, 0x03, 0x13, 0x03, 0x03, 0x02, 0x03, 0x0A, 0x03, 0x13, 0x03, 0x03,
+  0x02, 0x02, 0x0A, 0x03, 0x13, 0x02, 0x04, 0x01, 0x03, 0x0A, 0x02, 0x12,
+  0x03, 0x17, 0x01, 0x04, 0x01, 0x03, 0x09, 0x03, 0x12, 0x02, 0x16, 0x01,
+  0x03, 0x01, 0x02, 0x09, 0x03, 0x12, 0x04, 0x03, 0x01, 0x02, 0x09, 0x02,
+  0x12, 0x03, 0x02, 0x05, 0x02, 0x0C, 0x03, 0x02, 0x02, 0x05, 0x0A, 0x06,
+  0x03, 0x04, 0x03, 0x09, 0x02, 0x0D, 0x03, 0x03, 0x04, 0x02, 0x08, 0x02,
+  0x0D, 0x02, 0x03, 0x03, 0x03, 0x07, 0x02, 0x0C, 0x03, 0x03, 0x03, 0x03,
+  0x07, 0x01, 0x0C, 0x03, 0x02, 0x03, 0x04, 0x0C, 0x02, 0x02, 0x03, 0x03,
+  0x0B, 0x03, 0x02, 0x02, 0x04, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03,
+  0x02, 0x02, 0x03, 0x0B, 0x02, 0x03, 0x01, 0x03, 0x0B, 0x02, 0x10, 0x01,
+  0x03, 0x01, 0x03, 0x0B, 0x02, 0x0E, 0x02, 0x02, 0x01, 0x03, 0x0B, 0x04,
+  0x02, 0x01, 0x02, 0x0B, 0x03, 0x01, 0x07, 0x05, 0x02, 0x05, 0x03, 0x0B,
+  0x03, 0x02, 0x04, 0x03, 0x0C, 0x02, 0x02, 0x03, 0x03, 0x0C, 0x03, 0x02,
+  0x02, 0x03, 0x0C, 0x03, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x02, 0x01, 0x03,
+  0x0C, 0x03, 0x02, 0x00, 0x04, 0x0B, 0x04, 0x02, 0x00, 0x03, 0x0B, 0x03,
+  0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x00, 0x03, 0x0A, 0x03, 0x02, 0x00,
+  0x03, 0x09, 0x03, 0x02, 0x00, 0x03, 0x09, 0x02, 0x02, 0x01, 0x03, 0x07,
+  0x03, 0x01, 0x03, 0x05, 0x02, 0x08, 0x03, 0x0D, 0x05, 0x02, 0x05, 0x05,
+  0x0C, 0x07, 0x03, 0x07, 0x03, 0x0B, 0x01, 0x0F, 0x05, 0x02, 0x07, 0x04,
+  0x10, 0x04, 0x02, 0x07, 0x03, 0x10, 0x04, 0x02, 0x06, 0x03, 0x10, 0x04,
+  0x02, 0x06, 0x03, 0x10, 0x04, 0x02, 0x06, 0x03, 0x10, 0x03, 0x02, 0x06,
+  0x02, 0x0F, 0x04, 0x02, 0x05, 0x03, 0x0F, 0x03, 0x02, 0x05, 0x03, 0x0E,
+  0x04, 0x02, 0x05, 0x02, 0x0D, 0x04, 0x02, 0x05, 0x02, 0x0C, 0x04, 0x02,
+  0x04, 0x03, 0x0B, 0x03, 0x01, 0x04, 0x08, 0x01, 0x04, 0x02, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x02,
+  0x03, 0x01, 0x00, 0x08, 0x02, 0x08, 0x04, 0x0D, 0x03, 0x02, 0x06, 0x04,
+  0x0C, 0x03, 0x02, 0x04, 0x04, 0x0D, 0x02, 0x02, 0x03, 0x04, 0x0D, 0x02,
+  0x02, 0x03, 0x03, 0x0D, 0x01, 0x02, 0x02, 0x04, 0x0D, 0x01, 0x02, 0x01,
+  0x04, 0x0D, 0x01, 0x02, 0x01, 0x04, 0x0C, 0x02, 0x02, 0x00, 0x04, 0x0C,
+  0x01, 0x02, 0x00, 0x04, 0x0B, 0x02, 0x02, 0x00, 0x04, 0x0A, 0x03, 0x02,
+  0x00, 0x04, 0x08, 0x04, 0x03, 0x00, 0x05, 0x07, 0x01, 0x09, 0x03, 0x02,
+  0x01, 0x06, 0x09, 0x03, 0x02, 0x02, 0x04, 0x09, 0x03, 0x01, 0x09, 0x02,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x02, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x04, 0x08, 0x02, 0x01, 0x05, 0x09, 0x03, 0x02,
+  0x03, 0x03, 0x08, 0x05, 0x03, 0x03, 0x03, 0x07, 0x01, 0x0A, 0x02, 0x02,
+  0x03, 0x02, 0x06, 0x01, 0x02, 0x03, 0x02, 0x06, 0x01, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x03, 0x02, 0x05, 0x04, 0x0C, 0x01, 0x02, 0x04, 0x02, 0x09,
+  0x03, 0x02, 0x03, 0x02, 0x0A, 0x02, 0x02, 0x03, 0x02, 0x0B, 0x01, 0x02,
+  0x03, 0x03, 0x0B, 0x01, 0x01, 0x03, 0x03, 0x01, 0x04, 0x03, 0x01, 0x05,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x02, 0x01, 0x01, 0x07, 0x02,
+  0x02, 0x01, 0x01, 0x07, 0x02, 0x02, 0x01, 0x02, 0x07, 0x02, 0x02, 0x00,
+  0x03, 0x06, 0x02, 0x02, 0x00, 0x01, 0x03, 0x04, 0x01, 0x06, 0x01, 0x01,
+  0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x02, 0x07, 0x01, 0x01, 0x08, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
+  0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x02, 0x05, 0x01, 0x02, 0x00, 0x03, 0x05, 0x01,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x04, 0x02, 0x03, 0x03, 0x0C, 0x02, 0x02,
+  0x00, 0x06, 0x0B, 0x03, 0x02, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x03, 0x02,
+  0x0A, 0x03, 0x02, 0x02, 0x03, 0x0A, 0x03, 0x02, 0x02, 0x03, 0x0A, 0x03,
+  0x02, 0x02, 0x02, 0x09, 0x04, 0x02, 0x01, 0x03, 0x08, 0x04, 0x03, 0x01,
+  0x03, 0x08, 0x01, 0x0A, 0x02, 0x03, 0x01, 0x03, 0x07, 0x01, 0x0A, 0x02,
+  0x03, 0x01, 0x02, 0x06, 0x02, 0x09, 0x03, 0x04, 0x00, 0x03, 0x05, 0x02,
+  0x09, 0x02, 0x0D, 0x01, 0x04, 0x00, 0x02, 0x04, 0x02, 0x09, 0x02, 0x0D,
+  0x01, 0x02, 0x00, 0x05, 0x09, 0x04, 0x02, 0x00, 0x03, 0x09, 0x03, 0x02,
+  0x03, 0x02, 0x0B, 0x02, 0x02, 0x00, 0x05, 0x0B, 0x03, 0x02, 0x02, 0x03,
+  0x0B, 0x03, 0x02, 0x03, 0x02, 0x0C, 0x02, 0x02, 0x03, 0x02, 0x0C, 0x02,
+  0x02, 0x03, 0x03, 0x0C, 0x01, 0x02, 0x03, 0x03, 0x0B, 0x02, 0x02, 0x04,
+  0x02, 0x0A, 0x02, 0x02, 0x04, 0x02, 0x0A, 0x01, 0x02, 0x04, 0x02, 0x09,
+  0x01, 0x02, 0x04, 0x02, 0x08, 0x01, 0x02, 0x04, 0x02, 0x07, 0x01, 0x01,
+  0x04, 0x03, 0x01, 0x04, 0x02, 0x01, 0x04, 0x01, 0x03, 0x03, 0x02, 0x0D,
+  0x01, 0x13, 0x02, 0x03, 0x00, 0x05, 0x0C, 0x02, 0x13, 0x03, 0x03, 0x03,
+  0x02, 0x0C, 0x02, 0x13, 0x03, 0x03, 0x03, 0x02, 0x0B, 0x03, 0x15, 0x01,
+  0x04, 0x03, 0x03, 0x0A, 0x01, 0x0C, 0x02, 0x14, 0x01, 0x04, 0x03, 0x03,
+  0x0A, 0x01, 0x0C, 0x02, 0x14, 0x01, 0x04, 0x04, 0x02, 0x09, 0x01, 0x0C,
+  0x02, 0x13, 0x01, 0x04, 0x04, 0x02, 0x08, 0x01, 0x0D, 0x02, 0x13, 0x01,
+  0x04, 0x04, 0x02, 0x07, 0x02, 0x0D, 0x02, 0x12, 0x01, 0x04, 0x04, 0x02,
+  0x07, 0x01, 0x0D, 0x02, 0x11, 0x01, 0x03, 0x04, 0x03, 0x0D, 0x02, 0x10,
+  0x01, 0x03, 0x04, 0x03, 0x0D, 0x02, 0x10, 0x01, 0x02, 0x04, 0x02, 0x0D,
+  0x03, 0x02, 0x04, 0x02, 0x0D, 0x02, 0x02, 0x04, 0x01, 0x0D, 0x01, 0x02,
+  0x06, 0x02, 0x0D, 0x03, 0x02, 0x04, 0x05, 0x0C, 0x04, 0x04, 0x03, 0x01,
+  0x06, 0x03, 0x0B, 0x01, 0x0E, 0x02, 0x02, 0x07, 0x02, 0x0A, 0x02, 0x01,
+  0x07, 0x04, 0x01, 0x07, 0x03, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01,
+  0x07, 0x03, 0x01, 0x06, 0x05, 0x02, 0x06, 0x01, 0x09, 0x02, 0x03, 0x05,
+  0x01, 0x09, 0x02, 0x0E, 0x01, 0x03, 0x04, 0x01, 0x09, 0x02, 0x0D, 0x01,
+  0x02, 0x00, 0x04, 0x09, 0x05, 0x02, 0x00, 0x03, 0x0A, 0x02, 0x02, 0x05,
+  0x02, 0x0D, 0x02, 0x02, 0x02, 0x06, 0x0D, 0x03, 0x02, 0x05, 0x03, 0x0D,
+  0x03, 0x02, 0x05, 0x03, 0x0E, 0x02, 0x02, 0x06, 0x03, 0x0F, 0x01, 0x02,
+  0x06, 0x03, 0x0E, 0x01, 0x02, 0x07, 0x02, 0x0E, 0x01, 0x02, 0x07, 0x03,
+  0x0D, 0x01, 0x02, 0x07, 0x03, 0x0D, 0x01, 0x02, 0x07, 0x03, 0x0C, 0x01,
+  0x02, 0x08, 0x02, 0x0C, 0x01, 0x02, 0x08, 0x02, 0x0B, 0x01, 0x01, 0x08,
+  0x04, 0x01, 0x08, 0x03, 0x01, 0x08, 0x02, 0x01, 0x08, 0x02, 0x01, 0x08,
+  0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x03, 0x01, 0x03, 0x0B, 0x01, 0x03, 0x0A, 0x02, 0x03,
+  0x01, 0x0B, 0x01, 0x02, 0x02, 0x01, 0x0A, 0x01, 0x01, 0x09, 0x01, 0x01,
+  0x08, 0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05, 0x02, 0x01,
+  0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01,
+  0x01, 0x05, 0x02, 0x00, 0x01, 0x02, 0x05, 0x02, 0x05, 0x03, 0x0B, 0x02,
+  0x02, 0x06, 0x03, 0x0B, 0x02, 0x01, 0x08, 0x03, 0x01, 0x09, 0x03, 0x01,
+  0x08, 0x02, 0x01, 0x07, 0x02, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01,
+  0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01,
+  0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x01, 0x04, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x01, 0x03, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x08, 0x02, 0x01, 0x09, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x0A, 0x02, 0x01,
+  0x0A, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01,
+  0x09, 0x03, 0x01, 0x09, 0x02, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01,
+  0x08, 0x03, 0x01, 0x08, 0x02, 0x01, 0x09, 0x01, 0x01, 0x09, 0x01, 0x01,
+  0x08, 0x02, 0x01, 0x07, 0x04, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01,
+  0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01,
+  0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02, 0x01,
+  0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x01, 0x03, 0x01, 0x03, 0x04, 0x02,
+  0x01, 0x09, 0x0E, 0x03, 0x02, 0x00, 0x03, 0x07, 0x09, 0x01, 0x0A, 0x04 };
+
+const GFXglyph FreeSerifItalic18pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,   9,    0,    1 },   // 0x20 ' '
+  {     0,  10,  23,  12,    1,  -22 },   // 0x21 '!'
+  {    65,  12,   9,  12,    4,  -22 },   // 0x22 '"'
+  {   110,  19,  23,  17,    0,  -22 },   // 0x23 '#'
+  {   217,  15,  29,  17,    1,  -25 },   // 0x24 '$'
+  {   354,  25,  23,  29,    3,  -22 },   // 0x25 '%'
+  {   519,  22,  23,  27,    3,  -22 },   // 0x26 '&'
+  {   642,   5,   9,   7,    4,  -22 },   // 0x27 '''
+  {   669,   9,  29,  12,    1,  -22 },   // 0x28 '('
+  {   756,   9,  29,  12,    1,  -22 },   // 0x29 ')'
+  {   843,  12,  14,  18,    5,  -22 },   // 0x2A '*'
+  {   909,  16,  18,  24,    4,  -17 },   // 0x2B '+'
+  {   963,   5,   8,   9,   -1,   -2 },   // 0x2C ','
+  {   987,   8,   2,  12,    2,   -8 },   // 0x2D '-'
+  {   993,   4,   4,   9,    1,   -3 },   // 0x2E '.'
+  {  1005,  16,  23,  10,    0,  -22 },   // 0x2F '/'
+  {  1074,  17,  24,  17,    1,  -23 },   // 0x30 '0'
+  {  1190,  12,  24,  17,    2,  -23 },   // 0x31 '1'
+  {  1262,  16,  23,  17,    1,  -22 },   // 0x32 '2'
+  {  1341,  17,  24,  18,    0,  -23 },   // 0x33 '3'
+  {  1419,  17,  24,  17,    0,  -23 },   // 0x34 '4'
+  {  1513,  16,  23,  18,    0,  -22 },   // 0x35 '5'
+  {  1584,  17,  24,  18,    1,  -23 },   // 0x36 '6'
+  {  1684,  16,  23,  17,    3,  -22 },   // 0x37 '7'
+  {  1757,  16,  24,  18,    1,  -23 },   // 0x38 '8'
+  {  1869,  16,  24,  17,    1,  -23 },   // 0x39 '9'
+  {  1971,   7,  15,   9,    2,  -14 },   // 0x3A ':'
+  {  2002,   9,  20,   9,    1,  -14 },   // 0x3B ';'
+  {  2046,  18,  18,  20,    2,  -17 },   // 0x3C '<'
+  {  2100,  18,   9,  23,    3,  -12 },   // 0x3D '='
+  {  2117,  18,  18,  20,    2,  -17 },   // 0x3E '>'
+  {  2171,  12,  23,  16,    4,  -22 },   // 0x3F '?'
+  {  2242,  24,  23,  27,    2,  -22 },   // 0x40 '@'
+  {  2395,  21,  23,  23,    0,  -22 },   // 0x41 'A'
+  {  2494,  21,  23,  21,    0,  -22 },   // 0x42 'B'
+  {  2597,  21,  23,  21,    2,  -22 },   // 0x43 'C'
+  {  2686,  25,  23,  25,    0,  -22 },   // 0x44 'D'
+  {  2793,  22,  23,  20,    0,  -22 },   // 0x45 'E'
+  {  2890,  22,  23,  20,    0,  -22 },   // 0x46 'F'
+  {  2979,  23,  23,  24,    2,  -22 },   // 0x47 'G'
+  {  3080,  27,  23,  25,    0,  -22 },   // 0x48 'H'
+  {  3191,  14,  23,  11,    0,  -22 },   // 0x49 'I'
+  {  3260,  17,  23,  15,    0,  -22 },   // 0x4A 'J'
+  {  3333,  25,  23,  22,    0,  -22 },   // 0x4B 'K'
+  {  3444,  20,  23,  20,    0,  -22 },   // 0x4C 'L'
+  {  3523,  31,  23,  29,    0,  -22 },   // 0x4D 'M'
+  {  3700,  26,  23,  24,    0,  -22 },   // 0x4E 'N'
+  {  3837,  23,  23,  23,    1,  -22 },   // 0x4F 'O'
+  {  3944,  22,  23,  20,    0,  -22 },   // 0x50 'P'
+  {  4033,  23,  29,  23,    1,  -22 },   // 0x51 'Q'
+  {  4168,  21,  23,  22,    0,  -22 },   // 0x52 'R'
+  {  4275,  17,  23,  16,    0,  -22 },   // 0x53 'S'
+  {  4370,  20,  23,  21,    3,  -22 },   // 0x54 'T'
+  {  4455,  23,  23,  25,    4,  -22 },   // 0x55 'U'
+  {  4566,  21,  23,  23,    5,  -22 },   // 0x56 'V'
+  {  4669,  29,  23,  31,    5,  -22 },   // 0x57 'W'
+  {  4834,  24,  23,  23,    0,  -22 },   // 0x58 'X'
+  {  4939,  19,  23,  21,    4,  -22 },   // 0x59 'Y'
+  {  5030,  22,  23,  20,    0,  -22 },   // 0x5A 'Z'
+  {  5115,  13,  28,  14,    1,  -22 },   // 0x5B '['
+  {  5199,  12,  23,  17,    4,  -22 },   // 0x5C '\'
+  {  5268,  12,  28,  14,    1,  -22 },   // 0x5D ']'
+  {  5352,  15,  13,  15,    0,  -22 },   // 0x5E '^'
+  {  5411,  18,   2,  17,    0,    3 },   // 0x5F '_'
+  {  5417,   6,   6,   9,    5,  -22 },   // 0x60 '`'
+  {  5435,  15,  15,  17,    1,  -14 },   // 0x61 'a'
+  {  5520,  16,  24,  17,    1,  -23 },   // 0x62 'b'
+  {  5624,  13,  15,  14,    1,  -14 },   // 0x63 'c'
+  {  5679,  17,  24,  18,    1,  -23 },   // 0x64 'd'
+  {  5787,  13,  15,  14,    1,  -14 },   // 0x65 'e'
+  {  5848,  20,  31,  15,   -3,  -23 },   // 0x66 'f'
+  {  5949,  16,  22,  15,   -1,  -14 },   // 0x67 'g'
+  {  6045,  16,  24,  17,    1,  -23 },   // 0x68 'h'
+  {  6157,   9,  23,   9,    1,  -22 },   // 0x69 'i'
+  {  6222,  15,  30,  10,   -3,  -22 },   // 0x6A 'j'
+  {  6308,  15,  24,  16,    1,  -23 },   // 0x6B 'k'
+  {  6412,   8,  25,   9,    1,  -23 },   // 0x6C 'l'
+  {  6491,  24,  15,  25,    0,  -14 },   // 0x6D 'm'
+  {  6614,  17,  15,  17,    0,  -14 },   // 0x6E 'n'
+  {  6701,  15,  15,  17,    1,  -14 },   // 0x6F 'o'
+  {  6772,  20,  22,  16,   -3,  -14 },   // 0x70 'p'
+  {  6868,  16,  22,  17,    1,  -14 },   // 0x71 'q'
+  {  6966,  13,  15,  13,    1,  -14 },   // 0x72 'r'
+  {  7023,  13,  15,  12,    0,  -14 },   // 0x73 's'
+  {  7088,   9,  18,   8,    1,  -17 },   // 0x74 't'
+  {  7146,  15,  15,  17,    1,  -14 },   // 0x75 'u'
+  {  7235,  14,  15,  16,    2,  -14 },   // 0x76 'v'
+  {  7304,  22,  15,  24,    1,  -14 },   // 0x77 'w'
+  {  7415,  16,  15,  15,   -1,  -14 },   // 0x78 'x'
+  {  7486,  16,  22,  16,    0,  -14 },   // 0x79 'y'
+  {  7576,  14,  18,  14,    0,  -14 },   // 0x7A 'z'
+  {  7640,  12,  30,  14,    2,  -23 },   // 0x7B '{'
+  {  7730,   2,  23,  10,    4,  -22 },   // 0x7C '|'
+  {  7799,  12,  31,  14,    0,  -24 },   // 0x7D '}'
+  {  7892,  17,   4,  19,    1,  -10 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSerifItalic18pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSerifItalic18pt7bSpanData,
+    (GFXglyph *)FreeSerifItalic18pt7bSpanGlyphs,
+    0x20, 0x7E, 42 } };
+
+// Approx. 8692 bytes
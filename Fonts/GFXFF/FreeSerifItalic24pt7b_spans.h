@@ -0,0 +1,1030 @@
+// FreeSerifItalic24pt7b as glyph row spans, generated by Tools/GFX_spans from FreeSerifItalic24pt7b.h
+//
+// Per glyph row the number of runs, then the left column and length of each run
+
+const uint8_t FreeSerifItalic24pt7bSpanData[] PROGMEM = {
+  0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04,
+  0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02,
+  0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x04, 0x02, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x01, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x01, 0x04,
+  0x0B, 0x03, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x02, 0x01, 0x03, 0x0A, 0x03,
+  0x02, 0x01, 0x03, 0x0A, 0x03, 0x02, 0x01, 0x03, 0x09, 0x04, 0x02, 0x00,
+  0x03, 0x09, 0x03, 0x02, 0x00, 0x03, 0x09, 0x03, 0x02, 0x00, 0x02, 0x09,
+  0x02, 0x02, 0x00, 0x02, 0x09, 0x02, 0x02, 0x00, 0x02, 0x09, 0x02, 0x02,
+  0x00, 0x01, 0x09, 0x01, 0x02, 0x0D, 0x02, 0x16, 0x02, 0x02, 0x0C, 0x03,
+  0x15, 0x03, 0x02, 0x0C, 0x03, 0x15, 0x03, 0x02, 0x0B, 0x03, 0x14, 0x03,
+  0x02, 0x0B, 0x03, 0x14, 0x03, 0x02, 0x0B, 0x03, 0x14, 0x03, 0x02, 0x0A,
+  0x03, 0x13, 0x03, 0x02, 0x0A, 0x03, 0x13, 0x03, 0x02, 0x0A, 0x02, 0x13,
+  0x02, 0x02, 0x09, 0x03, 0x12, 0x03, 0x01, 0x04, 0x15, 0x01, 0x04, 0x15,
+  0x02, 0x08, 0x03, 0x11, 0x03, 0x02, 0x08, 0x02, 0x11, 0x02, 0x02, 0x07,
+  0x03, 0x10, 0x03, 0x02, 0x07, 0x03, 0x10, 0x03, 0x02, 0x06, 0x03, 0x0F,
+  0x03, 0x02, 0x06, 0x03, 0x0F, 0x03, 0x02, 0x06, 0x03, 0x0F, 0x03, 0x01,
+  0x00, 0x16, 0x01, 0x00, 0x15, 0x02, 0x04, 0x03, 0x0D, 0x03, 0x02, 0x04,
+  0x03, 0x0D, 0x03, 0x02, 0x04, 0x03, 0x0D, 0x02, 0x02, 0x03, 0x03, 0x0C,
+  0x03, 0x02, 0x03, 0x03, 0x0C, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02,
+  0x02, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x03, 0x02, 0x01, 0x03,
+  0x0A, 0x03, 0x02, 0x01, 0x03, 0x0A, 0x03, 0x01, 0x0F, 0x01, 0x01, 0x0E,
+  0x02, 0x01, 0x0E, 0x02, 0x01, 0x09, 0x09, 0x03, 0x07, 0x03, 0x0E, 0x01,
+  0x10, 0x04, 0x03, 0x06, 0x02, 0x0D, 0x02, 0x11, 0x04, 0x03, 0x05, 0x03,
+  0x0D, 0x02, 0x12, 0x03, 0x03, 0x04, 0x03, 0x0D, 0x02, 0x13, 0x02, 0x03,
+  0x04, 0x03, 0x0D, 0x02, 0x13, 0x02, 0x03, 0x04, 0x03, 0x0C, 0x02, 0x13,
+  0x01, 0x03, 0x04, 0x03, 0x0C, 0x02, 0x13, 0x01, 0x02, 0x04, 0x04, 0x0C,
+  0x02, 0x02, 0x04, 0x05, 0x0C, 0x02, 0x02, 0x05, 0x05, 0x0B, 0x02, 0x01,
+  0x06, 0x07, 0x01, 0x07, 0x06, 0x01, 0x08, 0x06, 0x01, 0x09, 0x06, 0x01,
+  0x0A, 0x06, 0x01, 0x0A, 0x07, 0x02, 0x0A, 0x02, 0x0D, 0x05, 0x02, 0x0A,
+  0x02, 0x0E, 0x04, 0x02, 0x09, 0x02, 0x0F, 0x04, 0x02, 0x09, 0x02, 0x0F,
+  0x04, 0x02, 0x09, 0x02, 0x10, 0x03, 0x03, 0x01, 0x01, 0x09, 0x02, 0x10,
+  0x03, 0x03, 0x01, 0x01, 0x08, 0x02, 0x10, 0x03, 0x03, 0x00, 0x02, 0x08,
+  0x02, 0x10, 0x03, 0x03, 0x00, 0x03, 0x08, 0x02, 0x10, 0x02, 0x03, 0x00,
+  0x03, 0x08, 0x02, 0x0F, 0x03, 0x03, 0x00, 0x04, 0x07, 0x02, 0x0F, 0x02,
+  0x03, 0x01, 0x04, 0x07, 0x02, 0x0E, 0x02, 0x02, 0x03, 0x06, 0x0B, 0x04,
+  0x01, 0x05, 0x07, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02,
+  0x01, 0x06, 0x02, 0x02, 0x07, 0x05, 0x18, 0x02, 0x02, 0x05, 0x09, 0x16,
+  0x04, 0x03, 0x04, 0x04, 0x0B, 0x04, 0x14, 0x05, 0x03, 0x03, 0x04, 0x0E,
+  0x07, 0x16, 0x02, 0x03, 0x02, 0x04, 0x0E, 0x01, 0x15, 0x03, 0x03, 0x02,
+  0x03, 0x0E, 0x01, 0x15, 0x02, 0x03, 0x01, 0x04, 0x0E, 0x01, 0x14, 0x03,
+  0x03, 0x01, 0x03, 0x0E, 0x01, 0x14, 0x02, 0x03, 0x00, 0x04, 0x0E, 0x01,
+  0x13, 0x03, 0x03, 0x00, 0x03, 0x0D, 0x01, 0x13, 0x02, 0x03, 0x00, 0x03,
+  0x0D, 0x01, 0x12, 0x03, 0x03, 0x00, 0x03, 0x0C, 0x02, 0x11, 0x03, 0x03,
+  0x00, 0x03, 0x0C, 0x01, 0x11, 0x02, 0x04, 0x00, 0x03, 0x0B, 0x01, 0x10,
+  0x03, 0x19, 0x05, 0x04, 0x01, 0x02, 0x0A, 0x02, 0x10, 0x02, 0x17, 0x09,
+  0x05, 0x01, 0x03, 0x08, 0x03, 0x0F, 0x03, 0x16, 0x05, 0x1E, 0x02, 0x04,
+  0x02, 0x07, 0x0F, 0x02, 0x15, 0x04, 0x1F, 0x02, 0x04, 0x03, 0x05, 0x0E,
+  0x03, 0x14, 0x04, 0x20, 0x01, 0x03, 0x0E, 0x02, 0x14, 0x04, 0x20, 0x01,
+  0x03, 0x0D, 0x03, 0x13, 0x04, 0x20, 0x01, 0x03, 0x0D, 0x02, 0x13, 0x03,
+  0x20, 0x01, 0x03, 0x0C, 0x02, 0x12, 0x04, 0x20, 0x01, 0x03, 0x0B, 0x03,
+  0x12, 0x04, 0x1F, 0x02, 0x03, 0x0B, 0x02, 0x12, 0x03, 0x1F, 0x01, 0x03,
+  0x0A, 0x03, 0x12, 0x03, 0x1E, 0x02, 0x03, 0x0A, 0x02, 0x12, 0x03, 0x1E,
+  0x01, 0x03, 0x09, 0x03, 0x12, 0x03, 0x1D, 0x02, 0x03, 0x09, 0x02, 0x12,
+  0x03, 0x1C, 0x02, 0x03, 0x08, 0x03, 0x13, 0x03, 0x1A, 0x03, 0x02, 0x08,
+  0x02, 0x14, 0x08, 0x02, 0x07, 0x02, 0x15, 0x05, 0x01, 0x06, 0x03, 0x01,
+  0x10, 0x04, 0x01, 0x0E, 0x08, 0x02, 0x0D, 0x03, 0x13, 0x03, 0x02, 0x0D,
+  0x03, 0x14, 0x03, 0x02, 0x0C, 0x03, 0x14, 0x03, 0x02, 0x0C, 0x03, 0x14,
+  0x03, 0x02, 0x0B, 0x04, 0x14, 0x03, 0x02, 0x0B, 0x04, 0x13, 0x03, 0x02,
+  0x0B, 0x04, 0x13, 0x02, 0x02, 0x0B, 0x04, 0x12, 0x02, 0x02, 0x0B, 0x04,
+  0x11, 0x02, 0x01, 0x0B, 0x07, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x04, 0x01,
+  0x09, 0x06, 0x02, 0x07, 0x09, 0x15, 0x08, 0x03, 0x06, 0x03, 0x0B, 0x05,
+  0x16, 0x05, 0x03, 0x04, 0x04, 0x0C, 0x04, 0x17, 0x03, 0x03, 0x03, 0x04,
+  0x0C, 0x05, 0x17, 0x03, 0x03, 0x02, 0x04, 0x0C, 0x05, 0x16, 0x03, 0x03,
+  0x01, 0x05, 0x0D, 0x04, 0x16, 0x02, 0x03, 0x01, 0x04, 0x0D, 0x05, 0x15,
+  0x03, 0x03, 0x01, 0x04, 0x0D, 0x05, 0x15, 0x02, 0x03, 0x00, 0x05, 0x0E,
+  0x05, 0x14, 0x02, 0x02, 0x00, 0x05, 0x0E, 0x08, 0x02, 0x00, 0x05, 0x0F,
+  0x06, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x06, 0x10, 0x05, 0x02,
+  0x01, 0x05, 0x10, 0x06, 0x02, 0x01, 0x06, 0x0E, 0x08, 0x04, 0x02, 0x06,
+  0x0C, 0x04, 0x12, 0x06, 0x1C, 0x01, 0x02, 0x03, 0x0B, 0x13, 0x09, 0x02,
+  0x05, 0x07, 0x15, 0x05, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x09,
+  0x02, 0x01, 0x08, 0x02, 0x01, 0x07, 0x02, 0x01, 0x06, 0x02, 0x01, 0x05,
+  0x03, 0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x03, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+  0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x02, 0x01, 0x04,
+  0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x02, 0x01, 0x09, 0x01, 0x01, 0x09,
+  0x01, 0x01, 0x09, 0x02, 0x01, 0x09, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x0A,
+  0x02, 0x01, 0x0A, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x04, 0x01, 0x09,
+  0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x03, 0x01, 0x08,
+  0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x03, 0x01, 0x07,
+  0x04, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x02, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x03,
+  0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07,
+  0x01, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06,
+  0x03, 0x03, 0x00, 0x03, 0x07, 0x01, 0x0D, 0x03, 0x03, 0x00, 0x03, 0x07,
+  0x01, 0x0C, 0x04, 0x03, 0x00, 0x04, 0x07, 0x01, 0x0B, 0x05, 0x03, 0x03,
+  0x02, 0x07, 0x01, 0x0A, 0x02, 0x01, 0x05, 0x05, 0x01, 0x06, 0x03, 0x03,
+  0x04, 0x02, 0x07, 0x01, 0x09, 0x02, 0x03, 0x01, 0x04, 0x07, 0x01, 0x0A,
+  0x04, 0x03, 0x00, 0x04, 0x07, 0x01, 0x0B, 0x05, 0x03, 0x00, 0x03, 0x07,
+  0x01, 0x0C, 0x04, 0x03, 0x00, 0x03, 0x07, 0x01, 0x0D, 0x03, 0x01, 0x06,
+  0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x02, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x00, 0x17, 0x01, 0x00, 0x17, 0x01, 0x00,
+  0x17, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A,
+  0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02,
+  0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x03, 0x04, 0x01, 0x04,
+  0x03, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x00, 0x0B, 0x01, 0x00,
+  0x0A, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x05, 0x01, 0x01, 0x03, 0x01, 0x11, 0x04, 0x01, 0x11, 0x03, 0x01, 0x10,
+  0x04, 0x01, 0x10, 0x03, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x03, 0x01, 0x0E,
+  0x03, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x03, 0x01, 0x0C, 0x04, 0x01, 0x0C,
+  0x03, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x04, 0x01, 0x0A,
+  0x03, 0x01, 0x09, 0x04, 0x01, 0x09, 0x03, 0x01, 0x08, 0x04, 0x01, 0x08,
+  0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x03,
+  0x04, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0B, 0x06, 0x02, 0x09,
+  0x03, 0x10, 0x02, 0x02, 0x08, 0x02, 0x11, 0x02, 0x02, 0x07, 0x02, 0x11,
+  0x02, 0x02, 0x06, 0x03, 0x12, 0x02, 0x02, 0x05, 0x03, 0x12, 0x02, 0x02,
+  0x04, 0x03, 0x12, 0x02, 0x02, 0x04, 0x03, 0x12, 0x03, 0x02, 0x03, 0x03,
+  0x12, 0x03, 0x02, 0x03, 0x03, 0x12, 0x03, 0x02, 0x02, 0x04, 0x12, 0x03,
+  0x02, 0x02, 0x03, 0x12, 0x03, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01,
+  0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x03, 0x11,
+  0x04, 0x02, 0x00, 0x04, 0x11, 0x03, 0x02, 0x00, 0x04, 0x10, 0x04, 0x02,
+  0x00, 0x04, 0x10, 0x04, 0x02, 0x00, 0x03, 0x10, 0x03, 0x02, 0x00, 0x03,
+  0x0F, 0x04, 0x02, 0x00, 0x03, 0x0F, 0x04, 0x02, 0x00, 0x03, 0x0F, 0x03,
+  0x02, 0x00, 0x03, 0x0E, 0x04, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x01,
+  0x02, 0x0D, 0x03, 0x02, 0x01, 0x02, 0x0C, 0x03, 0x02, 0x01, 0x03, 0x0C,
+  0x02, 0x02, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x03, 0x02, 0x09, 0x03, 0x01,
+  0x05, 0x05, 0x01, 0x10, 0x01, 0x01, 0x0A, 0x07, 0x01, 0x08, 0x09, 0x01,
+  0x0C, 0x05, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01,
+  0x0C, 0x03, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01,
+  0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x09, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x04, 0x01,
+  0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01,
+  0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x06, 0x01,
+  0x00, 0x0D, 0x01, 0x0A, 0x06, 0x01, 0x08, 0x0A, 0x01, 0x07, 0x0C, 0x02,
+  0x06, 0x03, 0x0E, 0x06, 0x02, 0x05, 0x02, 0x0F, 0x05, 0x02, 0x04, 0x02,
+  0x10, 0x05, 0x02, 0x04, 0x01, 0x11, 0x04, 0x01, 0x11, 0x04, 0x01, 0x11,
+  0x04, 0x01, 0x11, 0x04, 0x01, 0x11, 0x03, 0x01, 0x10, 0x04, 0x01, 0x10,
+  0x03, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0D,
+  0x03, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x0A,
+  0x02, 0x01, 0x09, 0x02, 0x01, 0x08, 0x02, 0x01, 0x07, 0x02, 0x01, 0x06,
+  0x02, 0x02, 0x05, 0x02, 0x12, 0x01, 0x02, 0x04, 0x02, 0x12, 0x01, 0x02,
+  0x03, 0x02, 0x11, 0x02, 0x01, 0x02, 0x10, 0x01, 0x01, 0x11, 0x01, 0x00,
+  0x11, 0x01, 0x0C, 0x06, 0x01, 0x0A, 0x0A, 0x02, 0x09, 0x02, 0x10, 0x05,
+  0x02, 0x08, 0x02, 0x11, 0x04, 0x02, 0x07, 0x02, 0x12, 0x04, 0x01, 0x12,
+  0x04, 0x01, 0x12, 0x04, 0x01, 0x12, 0x04, 0x01, 0x11, 0x04, 0x01, 0x11,
+  0x04, 0x01, 0x10, 0x03, 0x01, 0x0E, 0x04, 0x01, 0x0C, 0x03, 0x01, 0x09,
+  0x06, 0x01, 0x06, 0x0B, 0x01, 0x0A, 0x08, 0x01, 0x0D, 0x05, 0x01, 0x0E,
+  0x05, 0x01, 0x0E, 0x05, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F,
+  0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x03, 0x01, 0x0F,
+  0x03, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x02, 0x02, 0x01, 0x03, 0x0D, 0x02,
+  0x02, 0x00, 0x07, 0x0B, 0x03, 0x01, 0x01, 0x0B, 0x01, 0x02, 0x08, 0x01,
+  0x14, 0x02, 0x01, 0x13, 0x03, 0x01, 0x12, 0x04, 0x01, 0x11, 0x05, 0x01,
+  0x10, 0x05, 0x01, 0x0F, 0x06, 0x02, 0x0E, 0x02, 0x11, 0x04, 0x02, 0x0E,
+  0x02, 0x11, 0x03, 0x02, 0x0D, 0x02, 0x11, 0x03, 0x02, 0x0C, 0x02, 0x10,
+  0x04, 0x02, 0x0B, 0x02, 0x10, 0x04, 0x02, 0x0A, 0x02, 0x10, 0x03, 0x02,
+  0x09, 0x02, 0x10, 0x03, 0x02, 0x08, 0x02, 0x0F, 0x04, 0x02, 0x07, 0x02,
+  0x0F, 0x04, 0x02, 0x06, 0x02, 0x0F, 0x03, 0x02, 0x05, 0x02, 0x0E, 0x04,
+  0x02, 0x04, 0x02, 0x0E, 0x04, 0x02, 0x03, 0x02, 0x0E, 0x03, 0x02, 0x02,
+  0x02, 0x0E, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x04, 0x01, 0x01, 0x14, 0x01,
+  0x00, 0x15, 0x01, 0x00, 0x15, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x03, 0x01,
+  0x0C, 0x03, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x03, 0x01,
+  0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x0C, 0x01, 0x0A, 0x0C, 0x01,
+  0x09, 0x0C, 0x01, 0x09, 0x01, 0x01, 0x09, 0x01, 0x01, 0x08, 0x01, 0x01,
+  0x08, 0x01, 0x01, 0x07, 0x03, 0x01, 0x07, 0x06, 0x01, 0x06, 0x08, 0x01,
+  0x06, 0x0A, 0x01, 0x09, 0x08, 0x01, 0x0B, 0x06, 0x01, 0x0D, 0x05, 0x01,
+  0x0E, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x10, 0x03, 0x01,
+  0x10, 0x03, 0x01, 0x10, 0x03, 0x01, 0x10, 0x03, 0x01, 0x10, 0x03, 0x01,
+  0x10, 0x02, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x03, 0x01, 0x0F, 0x02, 0x01,
+  0x0E, 0x02, 0x01, 0x0D, 0x02, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x02, 0x00,
+  0x06, 0x0A, 0x03, 0x01, 0x01, 0x0B, 0x01, 0x02, 0x07, 0x01, 0x14, 0x03,
+  0x01, 0x10, 0x05, 0x01, 0x0D, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x05,
+  0x01, 0x09, 0x04, 0x01, 0x07, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04,
+  0x01, 0x05, 0x05, 0x01, 0x04, 0x05, 0x02, 0x03, 0x05, 0x0A, 0x06, 0x01,
+  0x03, 0x0F, 0x02, 0x02, 0x06, 0x0E, 0x05, 0x02, 0x02, 0x05, 0x0F, 0x05,
+  0x02, 0x01, 0x05, 0x10, 0x04, 0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01,
+  0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x00, 0x04, 0x11,
+  0x04, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x00, 0x03, 0x11, 0x04, 0x02,
+  0x00, 0x03, 0x10, 0x05, 0x02, 0x00, 0x03, 0x10, 0x04, 0x02, 0x00, 0x03,
+  0x10, 0x04, 0x02, 0x00, 0x03, 0x0F, 0x04, 0x02, 0x01, 0x02, 0x0F, 0x04,
+  0x02, 0x01, 0x02, 0x0E, 0x04, 0x02, 0x02, 0x02, 0x0E, 0x03, 0x02, 0x02,
+  0x02, 0x0C, 0x04, 0x02, 0x04, 0x02, 0x0B, 0x03, 0x01, 0x06, 0x06, 0x01,
+  0x03, 0x12, 0x01, 0x02, 0x13, 0x01, 0x02, 0x12, 0x02, 0x01, 0x03, 0x11,
+  0x02, 0x02, 0x00, 0x02, 0x10, 0x03, 0x02, 0x00, 0x01, 0x10, 0x02, 0x01,
+  0x0F, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0E, 0x03, 0x01, 0x0D, 0x03, 0x01,
+  0x0D, 0x02, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01,
+  0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x03, 0x01,
+  0x08, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+  0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0A, 0x07, 0x02, 0x08, 0x03, 0x10,
+  0x03, 0x02, 0x07, 0x03, 0x12, 0x02, 0x02, 0x06, 0x03, 0x12, 0x03, 0x02,
+  0x05, 0x03, 0x13, 0x03, 0x02, 0x05, 0x03, 0x13, 0x03, 0x02, 0x05, 0x03,
+  0x13, 0x03, 0x02, 0x05, 0x03, 0x13, 0x03, 0x02, 0x05, 0x04, 0x13, 0x03,
+  0x02, 0x05, 0x04, 0x12, 0x03, 0x02, 0x06, 0x04, 0x11, 0x04, 0x02, 0x06,
+  0x06, 0x10, 0x03, 0x02, 0x07, 0x06, 0x0E, 0x04, 0x01, 0x08, 0x07, 0x01,
+  0x08, 0x07, 0x01, 0x07, 0x09, 0x02, 0x05, 0x03, 0x0B, 0x06, 0x02, 0x03,
+  0x04, 0x0C, 0x06, 0x02, 0x02, 0x03, 0x0D, 0x05, 0x02, 0x01, 0x04, 0x0E,
+  0x05, 0x02, 0x01, 0x03, 0x0F, 0x04, 0x02, 0x00, 0x03, 0x10, 0x04, 0x02,
+  0x00, 0x03, 0x11, 0x03, 0x02, 0x00, 0x03, 0x11, 0x03, 0x02, 0x00, 0x03,
+  0x11, 0x03, 0x02, 0x00, 0x03, 0x11, 0x03, 0x02, 0x00, 0x03, 0x11, 0x02,
+  0x02, 0x01, 0x03, 0x10, 0x03, 0x02, 0x01, 0x03, 0x0F, 0x03, 0x02, 0x02,
+  0x03, 0x0E, 0x03, 0x02, 0x03, 0x04, 0x0C, 0x03, 0x01, 0x05, 0x08, 0x01,
+  0x0B, 0x06, 0x02, 0x08, 0x04, 0x10, 0x02, 0x02, 0x07, 0x03, 0x12, 0x01,
+  0x02, 0x06, 0x03, 0x12, 0x02, 0x02, 0x05, 0x03, 0x13, 0x02, 0x02, 0x04,
+  0x04, 0x13, 0x02, 0x02, 0x04, 0x03, 0x13, 0x03, 0x02, 0x03, 0x04, 0x13,
+  0x03, 0x02, 0x03, 0x04, 0x13, 0x03, 0x02, 0x02, 0x04, 0x13, 0x03, 0x02,
+  0x02, 0x04, 0x13, 0x03, 0x02, 0x02, 0x04, 0x13, 0x03, 0x02, 0x02, 0x04,
+  0x12, 0x04, 0x02, 0x02, 0x04, 0x12, 0x04, 0x02, 0x02, 0x04, 0x12, 0x04,
+  0x02, 0x02, 0x04, 0x11, 0x04, 0x02, 0x03, 0x04, 0x11, 0x04, 0x02, 0x03,
+  0x05, 0x10, 0x05, 0x02, 0x04, 0x05, 0x0E, 0x06, 0x02, 0x05, 0x0A, 0x10,
+  0x04, 0x02, 0x06, 0x06, 0x0F, 0x04, 0x01, 0x0E, 0x05, 0x01, 0x0E, 0x04,
+  0x01, 0x0D, 0x05, 0x01, 0x0C, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0A, 0x05,
+  0x01, 0x09, 0x05, 0x01, 0x08, 0x04, 0x01, 0x06, 0x05, 0x01, 0x05, 0x04,
+  0x01, 0x02, 0x05, 0x01, 0x00, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x05,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x05, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x01, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05,
+  0x01, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x03, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x03, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x15, 0x02, 0x01, 0x12, 0x05, 0x01, 0x10, 0x07, 0x01, 0x0E, 0x08,
+  0x01, 0x0C, 0x07, 0x01, 0x0A, 0x07, 0x01, 0x07, 0x08, 0x01, 0x05, 0x08,
+  0x01, 0x03, 0x08, 0x01, 0x01, 0x07, 0x01, 0x00, 0x06, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x06, 0x01, 0x00, 0x08, 0x01, 0x02, 0x08, 0x01, 0x05, 0x07,
+  0x01, 0x07, 0x07, 0x01, 0x09, 0x08, 0x01, 0x0B, 0x08, 0x01, 0x0D, 0x08,
+  0x01, 0x10, 0x07, 0x01, 0x12, 0x05, 0x01, 0x14, 0x03, 0x01, 0x16, 0x01,
+  0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x00, 0x18,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x07,
+  0x01, 0x02, 0x07, 0x01, 0x04, 0x08, 0x01, 0x06, 0x08, 0x01, 0x08, 0x08,
+  0x01, 0x0B, 0x07, 0x01, 0x0D, 0x07, 0x01, 0x0F, 0x08, 0x01, 0x11, 0x07,
+  0x01, 0x13, 0x05, 0x01, 0x12, 0x06, 0x01, 0x10, 0x07, 0x01, 0x0D, 0x08,
+  0x01, 0x0B, 0x08, 0x01, 0x09, 0x08, 0x01, 0x07, 0x07, 0x01, 0x05, 0x07,
+  0x01, 0x02, 0x08, 0x01, 0x00, 0x08, 0x01, 0x00, 0x06, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x01, 0x01, 0x06, 0x06, 0x02, 0x05, 0x02, 0x0B, 0x03, 0x02,
+  0x04, 0x02, 0x0C, 0x03, 0x02, 0x03, 0x03, 0x0D, 0x02, 0x02, 0x03, 0x03,
+  0x0D, 0x03, 0x02, 0x03, 0x03, 0x0D, 0x03, 0x02, 0x03, 0x03, 0x0D, 0x03,
+  0x01, 0x0D, 0x03, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x04,
+  0x01, 0x0A, 0x04, 0x01, 0x0A, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x02, 0x01, 0x05, 0x02,
+  0x01, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+  0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x01, 0x03, 0x01, 0x0D,
+  0x09, 0x01, 0x0A, 0x0E, 0x02, 0x08, 0x06, 0x15, 0x05, 0x02, 0x07, 0x04,
+  0x18, 0x04, 0x02, 0x05, 0x05, 0x19, 0x04, 0x02, 0x04, 0x05, 0x1B, 0x03,
+  0x02, 0x04, 0x04, 0x1C, 0x03, 0x02, 0x03, 0x04, 0x1D, 0x02, 0x03, 0x02,
+  0x04, 0x11, 0x04, 0x1D, 0x03, 0x04, 0x02, 0x04, 0x0F, 0x07, 0x17, 0x03,
+  0x1E, 0x02, 0x04, 0x01, 0x04, 0x0E, 0x04, 0x15, 0x05, 0x1E, 0x03, 0x04,
+  0x01, 0x04, 0x0D, 0x03, 0x15, 0x04, 0x1F, 0x02, 0x04, 0x01, 0x04, 0x0C,
+  0x03, 0x16, 0x03, 0x1F, 0x02, 0x04, 0x00, 0x04, 0x0C, 0x03, 0x16, 0x03,
+  0x1F, 0x02, 0x04, 0x00, 0x04, 0x0B, 0x03, 0x15, 0x04, 0x1F, 0x02, 0x04,
+  0x00, 0x04, 0x0B, 0x03, 0x15, 0x04, 0x1F, 0x02, 0x04, 0x00, 0x04, 0x0B,
+  0x02, 0x15, 0x03, 0x1F, 0x02, 0x04, 0x00, 0x04, 0x0A, 0x03, 0x15, 0x03,
+  0x1F, 0x02, 0x04, 0x00, 0x04, 0x0A, 0x03, 0x15, 0x03, 0x1E, 0x02, 0x04,
+  0x00, 0x04, 0x0A, 0x03, 0x14, 0x04, 0x1E, 0x02, 0x04, 0x00, 0x04, 0x0A,
+  0x03, 0x14, 0x03, 0x1D, 0x03, 0x04, 0x01, 0x04, 0x0A, 0x03, 0x13, 0x04,
+  0x1D, 0x02, 0x04, 0x01, 0x04, 0x0A, 0x04, 0x12, 0x05, 0x1C, 0x02, 0x05,
+  0x01, 0x04, 0x0B, 0x03, 0x11, 0x02, 0x14, 0x03, 0x1B, 0x02, 0x03, 0x02,
+  0x04, 0x0B, 0x07, 0x15, 0x07, 0x03, 0x03, 0x03, 0x0C, 0x04, 0x16, 0x05,
+  0x01, 0x03, 0x04, 0x01, 0x04, 0x04, 0x01, 0x05, 0x04, 0x02, 0x06, 0x05,
+  0x1A, 0x01, 0x02, 0x08, 0x06, 0x16, 0x05, 0x01, 0x0A, 0x0F, 0x01, 0x0D,
+  0x09, 0x01, 0x13, 0x02, 0x01, 0x12, 0x03, 0x01, 0x12, 0x03, 0x01, 0x11,
+  0x04, 0x01, 0x11, 0x05, 0x01, 0x10, 0x06, 0x01, 0x10, 0x06, 0x02, 0x0F,
+  0x02, 0x12, 0x04, 0x02, 0x0E, 0x02, 0x12, 0x04, 0x02, 0x0E, 0x02, 0x12,
+  0x04, 0x02, 0x0D, 0x02, 0x12, 0x05, 0x02, 0x0D, 0x01, 0x12, 0x05, 0x02,
+  0x0C, 0x02, 0x12, 0x05, 0x02, 0x0B, 0x02, 0x13, 0x04, 0x02, 0x0B, 0x02,
+  0x13, 0x04, 0x02, 0x0A, 0x02, 0x13, 0x04, 0x02, 0x0A, 0x01, 0x13, 0x05,
+  0x02, 0x09, 0x02, 0x13, 0x05, 0x01, 0x08, 0x10, 0x01, 0x08, 0x10, 0x02,
+  0x07, 0x02, 0x14, 0x04, 0x02, 0x07, 0x02, 0x14, 0x04, 0x02, 0x06, 0x02,
+  0x14, 0x05, 0x02, 0x05, 0x03, 0x14, 0x05, 0x02, 0x05, 0x02, 0x14, 0x05,
+  0x02, 0x04, 0x03, 0x15, 0x04, 0x02, 0x04, 0x02, 0x15, 0x04, 0x02, 0x03,
+  0x03, 0x15, 0x05, 0x02, 0x02, 0x04, 0x15, 0x05, 0x02, 0x01, 0x05, 0x14,
+  0x07, 0x02, 0x00, 0x08, 0x11, 0x0C, 0x01, 0x06, 0x11, 0x01, 0x09, 0x10,
+  0x02, 0x0A, 0x05, 0x15, 0x05, 0x02, 0x0A, 0x05, 0x16, 0x05, 0x02, 0x0A,
+  0x05, 0x17, 0x05, 0x02, 0x0A, 0x04, 0x17, 0x05, 0x02, 0x09, 0x05, 0x17,
+  0x05, 0x02, 0x09, 0x05, 0x17, 0x05, 0x02, 0x09, 0x04, 0x17, 0x05, 0x02,
+  0x09, 0x04, 0x16, 0x05, 0x02, 0x08, 0x05, 0x16, 0x05, 0x02, 0x08, 0x05,
+  0x15, 0x05, 0x02, 0x08, 0x04, 0x12, 0x06, 0x01, 0x07, 0x0E, 0x01, 0x07,
+  0x0F, 0x02, 0x07, 0x05, 0x11, 0x06, 0x02, 0x07, 0x04, 0x13, 0x05, 0x02,
+  0x06, 0x05, 0x14, 0x05, 0x02, 0x06, 0x05, 0x15, 0x05, 0x02, 0x06, 0x04,
+  0x15, 0x05, 0x02, 0x06, 0x04, 0x15, 0x05, 0x02, 0x05, 0x05, 0x15, 0x05,
+  0x02, 0x05, 0x05, 0x15, 0x05, 0x02, 0x05, 0x04, 0x15, 0x05, 0x02, 0x04,
+  0x05, 0x14, 0x05, 0x02, 0x04, 0x05, 0x14, 0x05, 0x02, 0x04, 0x04, 0x13,
+  0x05, 0x02, 0x04, 0x04, 0x12, 0x05, 0x02, 0x03, 0x06, 0x0F, 0x07, 0x01,
+  0x02, 0x13, 0x01, 0x00, 0x12, 0x02, 0x0F, 0x08, 0x1D, 0x01, 0x01, 0x0C,
+  0x11, 0x02, 0x0A, 0x06, 0x17, 0x06, 0x02, 0x09, 0x05, 0x18, 0x05, 0x02,
+  0x08, 0x04, 0x19, 0x04, 0x02, 0x06, 0x05, 0x1A, 0x03, 0x02, 0x06, 0x04,
+  0x1A, 0x03, 0x02, 0x05, 0x05, 0x1B, 0x01, 0x02, 0x04, 0x05, 0x1B, 0x01,
+  0x02, 0x03, 0x05, 0x1B, 0x01, 0x01, 0x03, 0x05, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x05, 0x02, 0x01, 0x05, 0x18, 0x01, 0x02, 0x01, 0x05, 0x17, 0x02,
+  0x02, 0x02, 0x05, 0x16, 0x02, 0x02, 0x02, 0x05, 0x15, 0x02, 0x02, 0x03,
+  0x05, 0x13, 0x03, 0x02, 0x04, 0x06, 0x11, 0x03, 0x01, 0x06, 0x0D, 0x01,
+  0x08, 0x08, 0x01, 0x06, 0x12, 0x01, 0x09, 0x11, 0x02, 0x0A, 0x06, 0x16,
+  0x06, 0x02, 0x0A, 0x05, 0x18, 0x05, 0x02, 0x0A, 0x05, 0x19, 0x05, 0x02,
+  0x0A, 0x04, 0x1A, 0x05, 0x02, 0x09, 0x05, 0x1B, 0x05, 0x02, 0x09, 0x05,
+  0x1B, 0x05, 0x02, 0x09, 0x05, 0x1C, 0x04, 0x02, 0x09, 0x04, 0x1C, 0x05,
+  0x02, 0x08, 0x05, 0x1C, 0x05, 0x02, 0x08, 0x05, 0x1C, 0x05, 0x02, 0x08,
+  0x04, 0x1C, 0x05, 0x02, 0x07, 0x05, 0x1C, 0x05, 0x02, 0x07, 0x05, 0x1C,
+  0x05, 0x02, 0x07, 0x05, 0x1C, 0x05, 0x02, 0x07, 0x04, 0x1B, 0x06, 0x02,
+  0x06, 0x05, 0x1B, 0x05, 0x02, 0x06, 0x05, 0x1B, 0x05, 0x02, 0x06, 0x04,
+  0x1B, 0x05, 0x02, 0x06, 0x04, 0x1A, 0x05, 0x02, 0x05, 0x05, 0x1A, 0x05,
+  0x02, 0x05, 0x05, 0x19, 0x05, 0x02, 0x05, 0x04, 0x18, 0x05, 0x02, 0x04,
+  0x05, 0x17, 0x06, 0x02, 0x04, 0x05, 0x16, 0x05, 0x02, 0x04, 0x05, 0x15,
+  0x05, 0x02, 0x04, 0x04, 0x13, 0x06, 0x02, 0x03, 0x06, 0x10, 0x07, 0x01,
+  0x02, 0x13, 0x01, 0x00, 0x11, 0x01, 0x06, 0x17, 0x01, 0x09, 0x14, 0x02,
+  0x0A, 0x05, 0x19, 0x04, 0x02, 0x0A, 0x05, 0x1B, 0x02, 0x02, 0x0A, 0x05,
+  0x1B, 0x01, 0x02, 0x0A, 0x04, 0x1B, 0x01, 0x02, 0x09, 0x05, 0x1B, 0x01,
+  0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x02, 0x09, 0x04, 0x16, 0x01, 0x02,
+  0x08, 0x05, 0x15, 0x02, 0x02, 0x08, 0x05, 0x15, 0x01, 0x02, 0x08, 0x04,
+  0x13, 0x03, 0x01, 0x07, 0x0F, 0x01, 0x07, 0x0F, 0x02, 0x07, 0x05, 0x12,
+  0x03, 0x02, 0x07, 0x04, 0x13, 0x02, 0x02, 0x06, 0x05, 0x13, 0x02, 0x02,
+  0x06, 0x05, 0x13, 0x01, 0x02, 0x06, 0x04, 0x13, 0x01, 0x01, 0x06, 0x04,
+  0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x02, 0x05, 0x04, 0x19, 0x01, 0x02,
+  0x04, 0x05, 0x18, 0x02, 0x02, 0x04, 0x05, 0x17, 0x03, 0x02, 0x04, 0x04,
+  0x16, 0x03, 0x02, 0x04, 0x04, 0x15, 0x04, 0x02, 0x03, 0x06, 0x12, 0x07,
+  0x01, 0x02, 0x16, 0x01, 0x00, 0x18, 0x01, 0x06, 0x17, 0x01, 0x09, 0x14,
+  0x02, 0x0A, 0x05, 0x19, 0x04, 0x02, 0x0A, 0x05, 0x1B, 0x02, 0x02, 0x0A,
+  0x05, 0x1B, 0x01, 0x02, 0x0A, 0x04, 0x1B, 0x01, 0x02, 0x09, 0x05, 0x1B,
+  0x01, 0x02, 0x09, 0x05, 0x1B, 0x01, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04,
+  0x02, 0x08, 0x05, 0x16, 0x01, 0x02, 0x08, 0x05, 0x15, 0x02, 0x02, 0x08,
+  0x04, 0x14, 0x02, 0x02, 0x07, 0x05, 0x13, 0x03, 0x01, 0x07, 0x0F, 0x01,
+  0x07, 0x0E, 0x02, 0x07, 0x04, 0x13, 0x02, 0x02, 0x06, 0x05, 0x13, 0x02,
+  0x02, 0x06, 0x05, 0x13, 0x02, 0x02, 0x06, 0x05, 0x13, 0x01, 0x02, 0x06,
+  0x04, 0x13, 0x01, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x04,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x04,
+  0x01, 0x03, 0x05, 0x01, 0x02, 0x07, 0x01, 0x00, 0x0C, 0x02, 0x0F, 0x08,
+  0x1E, 0x01, 0x02, 0x0C, 0x0E, 0x1D, 0x02, 0x02, 0x0A, 0x06, 0x17, 0x08,
+  0x02, 0x09, 0x05, 0x19, 0x06, 0x02, 0x08, 0x04, 0x1A, 0x04, 0x02, 0x07,
+  0x04, 0x1B, 0x03, 0x02, 0x06, 0x04, 0x1B, 0x03, 0x02, 0x05, 0x04, 0x1B,
+  0x03, 0x02, 0x04, 0x05, 0x1C, 0x01, 0x02, 0x03, 0x05, 0x1C, 0x01, 0x01,
+  0x03, 0x05, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x00, 0x06, 0x02, 0x00, 0x05, 0x13,
+  0x0C, 0x02, 0x00, 0x05, 0x16, 0x07, 0x02, 0x00, 0x05, 0x17, 0x04, 0x02,
+  0x00, 0x05, 0x17, 0x04, 0x02, 0x00, 0x05, 0x16, 0x05, 0x02, 0x00, 0x05,
+  0x16, 0x04, 0x02, 0x00, 0x05, 0x16, 0x04, 0x02, 0x01, 0x04, 0x16, 0x04,
+  0x02, 0x01, 0x05, 0x15, 0x04, 0x02, 0x01, 0x05, 0x15, 0x04, 0x02, 0x02,
+  0x05, 0x15, 0x04, 0x02, 0x03, 0x04, 0x14, 0x05, 0x02, 0x04, 0x05, 0x13,
+  0x05, 0x02, 0x05, 0x06, 0x12, 0x05, 0x01, 0x07, 0x0E, 0x01, 0x09, 0x09,
+  0x02, 0x06, 0x0D, 0x19, 0x0B, 0x02, 0x09, 0x08, 0x1B, 0x07, 0x02, 0x0A,
+  0x05, 0x1C, 0x05, 0x02, 0x0A, 0x05, 0x1C, 0x05, 0x02, 0x0A, 0x04, 0x1C,
+  0x04, 0x02, 0x0A, 0x04, 0x1C, 0x04, 0x02, 0x09, 0x05, 0x1B, 0x05, 0x02,
+  0x09, 0x05, 0x1B, 0x05, 0x02, 0x09, 0x04, 0x1B, 0x04, 0x02, 0x09, 0x04,
+  0x1B, 0x04, 0x02, 0x08, 0x05, 0x1A, 0x05, 0x02, 0x08, 0x05, 0x1A, 0x05,
+  0x02, 0x08, 0x04, 0x1A, 0x04, 0x02, 0x07, 0x05, 0x1A, 0x04, 0x01, 0x07,
+  0x17, 0x01, 0x07, 0x16, 0x02, 0x07, 0x04, 0x19, 0x04, 0x02, 0x06, 0x05,
+  0x18, 0x05, 0x02, 0x06, 0x05, 0x18, 0x05, 0x02, 0x06, 0x04, 0x18, 0x04,
+  0x02, 0x06, 0x04, 0x18, 0x04, 0x02, 0x05, 0x05, 0x17, 0x05, 0x02, 0x05,
+  0x05, 0x17, 0x05, 0x02, 0x05, 0x04, 0x17, 0x04, 0x02, 0x04, 0x05, 0x16,
+  0x05, 0x02, 0x04, 0x05, 0x16, 0x05, 0x02, 0x04, 0x04, 0x16, 0x04, 0x02,
+  0x04, 0x04, 0x16, 0x04, 0x02, 0x03, 0x05, 0x15, 0x05, 0x02, 0x02, 0x07,
+  0x14, 0x07, 0x02, 0x00, 0x0B, 0x11, 0x0D, 0x01, 0x07, 0x0B, 0x01, 0x09,
+  0x08, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A,
+  0x04, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x09,
+  0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x07,
+  0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05,
+  0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04,
+  0x05, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x03, 0x05, 0x01, 0x02,
+  0x07, 0x01, 0x00, 0x0B, 0x01, 0x0B, 0x0C, 0x01, 0x0E, 0x07, 0x01, 0x0F,
+  0x05, 0x01, 0x0F, 0x05, 0x01, 0x0F, 0x04, 0x01, 0x0F, 0x04, 0x01, 0x0E,
+  0x05, 0x01, 0x0E, 0x04, 0x01, 0x0E, 0x04, 0x01, 0x0D, 0x05, 0x01, 0x0D,
+  0x05, 0x01, 0x0D, 0x04, 0x01, 0x0D, 0x04, 0x01, 0x0C, 0x05, 0x01, 0x0C,
+  0x05, 0x01, 0x0C, 0x04, 0x01, 0x0B, 0x05, 0x01, 0x0B, 0x05, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x04, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A,
+  0x04, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x02, 0x01,
+  0x03, 0x09, 0x04, 0x02, 0x00, 0x05, 0x08, 0x04, 0x02, 0x00, 0x05, 0x08,
+  0x04, 0x02, 0x00, 0x05, 0x07, 0x04, 0x01, 0x01, 0x09, 0x01, 0x03, 0x05,
+  0x02, 0x07, 0x0C, 0x17, 0x0A, 0x02, 0x09, 0x08, 0x1A, 0x06, 0x02, 0x0A,
+  0x05, 0x1A, 0x04, 0x02, 0x0A, 0x05, 0x19, 0x04, 0x02, 0x0A, 0x04, 0x18,
+  0x04, 0x02, 0x0A, 0x04, 0x17, 0x03, 0x02, 0x09, 0x05, 0x16, 0x03, 0x02,
+  0x09, 0x05, 0x15, 0x03, 0x02, 0x09, 0x04, 0x13, 0x03, 0x02, 0x09, 0x04,
+  0x12, 0x03, 0x02, 0x08, 0x05, 0x10, 0x04, 0x02, 0x08, 0x05, 0x0F, 0x03,
+  0x02, 0x08, 0x04, 0x0E, 0x03, 0x01, 0x08, 0x08, 0x01, 0x07, 0x0A, 0x02,
+  0x07, 0x04, 0x0C, 0x05, 0x02, 0x07, 0x04, 0x0D, 0x05, 0x02, 0x06, 0x05,
+  0x0D, 0x05, 0x02, 0x06, 0x05, 0x0E, 0x05, 0x02, 0x06, 0x04, 0x0F, 0x04,
+  0x02, 0x06, 0x04, 0x0F, 0x05, 0x02, 0x05, 0x05, 0x10, 0x05, 0x02, 0x05,
+  0x05, 0x10, 0x05, 0x02, 0x05, 0x04, 0x11, 0x05, 0x02, 0x04, 0x05, 0x12,
+  0x04, 0x02, 0x04, 0x05, 0x12, 0x05, 0x02, 0x04, 0x04, 0x13, 0x04, 0x02,
+  0x04, 0x04, 0x13, 0x05, 0x02, 0x03, 0x05, 0x13, 0x06, 0x02, 0x02, 0x07,
+  0x12, 0x08, 0x02, 0x00, 0x0C, 0x10, 0x0D, 0x01, 0x06, 0x0D, 0x01, 0x09,
+  0x08, 0x01, 0x0A, 0x06, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A,
+  0x04, 0x01, 0x09, 0x05, 0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x09,
+  0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x07,
+  0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x06,
+  0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05,
+  0x05, 0x02, 0x05, 0x05, 0x1A, 0x01, 0x02, 0x05, 0x04, 0x19, 0x02, 0x02,
+  0x04, 0x05, 0x19, 0x01, 0x02, 0x04, 0x05, 0x18, 0x02, 0x02, 0x04, 0x04,
+  0x17, 0x03, 0x02, 0x04, 0x04, 0x16, 0x03, 0x02, 0x03, 0x06, 0x13, 0x06,
+  0x01, 0x02, 0x17, 0x01, 0x00, 0x18, 0x02, 0x07, 0x09, 0x22, 0x08, 0x02,
+  0x0A, 0x06, 0x21, 0x07, 0x02, 0x0B, 0x05, 0x20, 0x07, 0x02, 0x0A, 0x06,
+  0x20, 0x06, 0x02, 0x0A, 0x06, 0x1F, 0x07, 0x02, 0x0A, 0x06, 0x1E, 0x08,
+  0x04, 0x0A, 0x01, 0x0C, 0x04, 0x1E, 0x02, 0x21, 0x04, 0x04, 0x09, 0x02,
+  0x0C, 0x04, 0x1D, 0x02, 0x21, 0x04, 0x04, 0x09, 0x02, 0x0C, 0x05, 0x1C,
+  0x03, 0x20, 0x05, 0x04, 0x09, 0x02, 0x0C, 0x05, 0x1C, 0x02, 0x20, 0x05,
+  0x04, 0x09, 0x01, 0x0D, 0x04, 0x1B, 0x02, 0x20, 0x04, 0x04, 0x08, 0x02,
+  0x0D, 0x04, 0x1A, 0x03, 0x1F, 0x05, 0x04, 0x08, 0x02, 0x0D, 0x04, 0x1A,
+  0x02, 0x1F, 0x05, 0x04, 0x08, 0x01, 0x0D, 0x04, 0x19, 0x02, 0x1F, 0x04,
+  0x04, 0x07, 0x02, 0x0D, 0x04, 0x18, 0x03, 0x1F, 0x04, 0x04, 0x07, 0x02,
+  0x0D, 0x04, 0x18, 0x02, 0x1E, 0x05, 0x04, 0x07, 0x02, 0x0D, 0x04, 0x17,
+  0x02, 0x1E, 0x05, 0x04, 0x07, 0x01, 0x0D, 0x05, 0x16, 0x03, 0x1E, 0x04,
+  0x04, 0x06, 0x02, 0x0D, 0x05, 0x16, 0x02, 0x1E, 0x04, 0x04, 0x06, 0x02,
+  0x0E, 0x04, 0x15, 0x02, 0x1D, 0x05, 0x04, 0x06, 0x02, 0x0E, 0x04, 0x14,
+  0x03, 0x1D, 0x05, 0x04, 0x05, 0x02, 0x0E, 0x04, 0x14, 0x02, 0x1D, 0x04,
+  0x04, 0x05, 0x02, 0x0E, 0x04, 0x13, 0x02, 0x1C, 0x05, 0x03, 0x05, 0x02,
+  0x0E, 0x07, 0x1C, 0x05, 0x03, 0x04, 0x02, 0x0E, 0x06, 0x1C, 0x04, 0x03,
+  0x04, 0x02, 0x0E, 0x05, 0x1C, 0x04, 0x03, 0x04, 0x02, 0x0E, 0x05, 0x1B,
+  0x05, 0x03, 0x03, 0x03, 0x0E, 0x04, 0x1B, 0x05, 0x03, 0x03, 0x03, 0x0F,
+  0x02, 0x1A, 0x06, 0x03, 0x02, 0x05, 0x0F, 0x02, 0x19, 0x07, 0x03, 0x00,
+  0x09, 0x0F, 0x01, 0x17, 0x0C, 0x02, 0x06, 0x08, 0x1A, 0x09, 0x02, 0x08,
+  0x07, 0x1C, 0x06, 0x02, 0x0A, 0x05, 0x1D, 0x03, 0x02, 0x0A, 0x05, 0x1D,
+  0x03, 0x02, 0x0A, 0x06, 0x1D, 0x02, 0x02, 0x0A, 0x06, 0x1D, 0x02, 0x03,
+  0x0A, 0x01, 0x0C, 0x05, 0x1C, 0x03, 0x03, 0x09, 0x02, 0x0C, 0x05, 0x1C,
+  0x02, 0x03, 0x09, 0x02, 0x0D, 0x04, 0x1C, 0x02, 0x03, 0x09, 0x02, 0x0D,
+  0x05, 0x1B, 0x03, 0x03, 0x08, 0x02, 0x0E, 0x04, 0x1B, 0x03, 0x03, 0x08,
+  0x02, 0x0E, 0x05, 0x1B, 0x02, 0x03, 0x08, 0x02, 0x0E, 0x05, 0x1B, 0x02,
+  0x03, 0x08, 0x02, 0x0F, 0x04, 0x1A, 0x03, 0x03, 0x07, 0x02, 0x0F, 0x05,
+  0x1A, 0x02, 0x03, 0x07, 0x02, 0x10, 0x04, 0x1A, 0x02, 0x03, 0x07, 0x02,
+  0x10, 0x05, 0x1A, 0x02, 0x03, 0x06, 0x02, 0x11, 0x04, 0x19, 0x03, 0x03,
+  0x06, 0x02, 0x11, 0x04, 0x19, 0x02, 0x03, 0x06, 0x02, 0x11, 0x05, 0x19,
+  0x02, 0x03, 0x06, 0x02, 0x12, 0x04, 0x18, 0x03, 0x03, 0x05, 0x02, 0x12,
+  0x05, 0x18, 0x02, 0x03, 0x05, 0x02, 0x13, 0x04, 0x18, 0x02, 0x03, 0x05,
+  0x02, 0x13, 0x04, 0x18, 0x02, 0x02, 0x04, 0x03, 0x13, 0x07, 0x02, 0x04,
+  0x02, 0x14, 0x05, 0x02, 0x04, 0x02, 0x14, 0x05, 0x02, 0x03, 0x03, 0x15,
+  0x04, 0x02, 0x03, 0x03, 0x15, 0x03, 0x02, 0x02, 0x05, 0x16, 0x02, 0x02,
+  0x00, 0x09, 0x16, 0x02, 0x01, 0x16, 0x02, 0x01, 0x10, 0x07, 0x01, 0x0D,
+  0x0C, 0x02, 0x0B, 0x05, 0x15, 0x05, 0x02, 0x0A, 0x04, 0x17, 0x04, 0x02,
+  0x09, 0x04, 0x18, 0x04, 0x02, 0x07, 0x05, 0x18, 0x05, 0x02, 0x06, 0x05,
+  0x19, 0x04, 0x02, 0x05, 0x05, 0x19, 0x04, 0x02, 0x05, 0x05, 0x19, 0x05,
+  0x02, 0x04, 0x05, 0x19, 0x05, 0x02, 0x03, 0x05, 0x19, 0x05, 0x02, 0x03,
+  0x05, 0x19, 0x05, 0x02, 0x02, 0x06, 0x19, 0x05, 0x02, 0x02, 0x05, 0x19,
+  0x05, 0x02, 0x01, 0x06, 0x18, 0x06, 0x02, 0x01, 0x05, 0x18, 0x06, 0x02,
+  0x01, 0x05, 0x18, 0x05, 0x02, 0x00, 0x06, 0x17, 0x06, 0x02, 0x00, 0x06,
+  0x17, 0x06, 0x02, 0x00, 0x05, 0x17, 0x05, 0x02, 0x00, 0x05, 0x16, 0x06,
+  0x02, 0x00, 0x05, 0x16, 0x05, 0x02, 0x00, 0x05, 0x16, 0x05, 0x02, 0x00,
+  0x05, 0x15, 0x05, 0x02, 0x00, 0x05, 0x14, 0x05, 0x02, 0x01, 0x04, 0x14,
+  0x05, 0x02, 0x01, 0x04, 0x13, 0x05, 0x02, 0x01, 0x05, 0x12, 0x05, 0x02,
+  0x02, 0x04, 0x11, 0x05, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x04, 0x05,
+  0x0E, 0x05, 0x01, 0x05, 0x0C, 0x01, 0x07, 0x07, 0x01, 0x06, 0x11, 0x01,
+  0x09, 0x11, 0x02, 0x0A, 0x05, 0x15, 0x06, 0x02, 0x0A, 0x05, 0x17, 0x05,
+  0x02, 0x0A, 0x05, 0x17, 0x05, 0x02, 0x0A, 0x04, 0x18, 0x05, 0x02, 0x09,
+  0x05, 0x18, 0x05, 0x02, 0x09, 0x05, 0x18, 0x05, 0x02, 0x09, 0x04, 0x18,
+  0x05, 0x02, 0x09, 0x04, 0x18, 0x05, 0x02, 0x08, 0x05, 0x18, 0x04, 0x02,
+  0x08, 0x05, 0x17, 0x05, 0x02, 0x08, 0x04, 0x16, 0x05, 0x02, 0x07, 0x05,
+  0x15, 0x06, 0x02, 0x07, 0x05, 0x13, 0x06, 0x01, 0x07, 0x11, 0x02, 0x07,
+  0x04, 0x0C, 0x09, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x04,
+  0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x04,
+  0x01, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x03, 0x05, 0x01, 0x02, 0x07, 0x01, 0x00, 0x0B, 0x01, 0x10, 0x07,
+  0x01, 0x0D, 0x0C, 0x02, 0x0C, 0x04, 0x15, 0x05, 0x02, 0x0A, 0x04, 0x17,
+  0x04, 0x02, 0x09, 0x04, 0x18, 0x04, 0x02, 0x08, 0x04, 0x18, 0x05, 0x02,
+  0x07, 0x04, 0x19, 0x04, 0x02, 0x06, 0x04, 0x19, 0x04, 0x02, 0x05, 0x05,
+  0x19, 0x05, 0x02, 0x04, 0x05, 0x19, 0x05, 0x02, 0x03, 0x06, 0x19, 0x05,
+  0x02, 0x03, 0x05, 0x19, 0x05, 0x02, 0x02, 0x06, 0x19, 0x05, 0x02, 0x02,
+  0x05, 0x19, 0x05, 0x02, 0x01, 0x06, 0x18, 0x06, 0x02, 0x01, 0x06, 0x18,
+  0x06, 0x02, 0x01, 0x05, 0x18, 0x05, 0x02, 0x00, 0x06, 0x18, 0x05, 0x02,
+  0x00, 0x06, 0x17, 0x06, 0x02, 0x00, 0x05, 0x17, 0x05, 0x02, 0x00, 0x05,
+  0x17, 0x05, 0x02, 0x00, 0x05, 0x16, 0x05, 0x02, 0x00, 0x05, 0x16, 0x05,
+  0x02, 0x00, 0x05, 0x15, 0x05, 0x02, 0x00, 0x05, 0x15, 0x05, 0x02, 0x00,
+  0x05, 0x14, 0x05, 0x02, 0x01, 0x04, 0x13, 0x05, 0x02, 0x01, 0x05, 0x13,
+  0x04, 0x02, 0x02, 0x04, 0x12, 0x04, 0x02, 0x02, 0x05, 0x11, 0x04, 0x02,
+  0x03, 0x04, 0x0F, 0x04, 0x02, 0x05, 0x05, 0x0C, 0x05, 0x01, 0x07, 0x08,
+  0x01, 0x08, 0x02, 0x01, 0x07, 0x02, 0x02, 0x05, 0x03, 0x1B, 0x01, 0x02,
+  0x04, 0x08, 0x19, 0x02, 0x02, 0x03, 0x0D, 0x17, 0x03, 0x01, 0x02, 0x17,
+  0x02, 0x00, 0x03, 0x09, 0x0E, 0x01, 0x0D, 0x08, 0x01, 0x06, 0x11, 0x01,
+  0x09, 0x10, 0x02, 0x0A, 0x05, 0x14, 0x06, 0x02, 0x0A, 0x05, 0x16, 0x05,
+  0x02, 0x0A, 0x05, 0x17, 0x05, 0x02, 0x0A, 0x04, 0x17, 0x05, 0x02, 0x09,
+  0x05, 0x17, 0x05, 0x02, 0x09, 0x05, 0x17, 0x05, 0x02, 0x09, 0x04, 0x17,
+  0x05, 0x02, 0x09, 0x04, 0x16, 0x05, 0x02, 0x08, 0x05, 0x16, 0x05, 0x02,
+  0x08, 0x05, 0x15, 0x05, 0x02, 0x08, 0x04, 0x13, 0x06, 0x01, 0x07, 0x10,
+  0x01, 0x07, 0x0D, 0x02, 0x07, 0x04, 0x0F, 0x04, 0x02, 0x07, 0x04, 0x0F,
+  0x04, 0x02, 0x06, 0x05, 0x0F, 0x05, 0x02, 0x06, 0x05, 0x10, 0x04, 0x02,
+  0x06, 0x04, 0x10, 0x04, 0x02, 0x06, 0x04, 0x10, 0x05, 0x02, 0x05, 0x05,
+  0x11, 0x04, 0x02, 0x05, 0x05, 0x11, 0x05, 0x02, 0x05, 0x04, 0x12, 0x04,
+  0x02, 0x04, 0x05, 0x12, 0x04, 0x02, 0x04, 0x05, 0x12, 0x05, 0x02, 0x04,
+  0x04, 0x13, 0x04, 0x02, 0x04, 0x04, 0x13, 0x04, 0x02, 0x03, 0x05, 0x13,
+  0x05, 0x02, 0x02, 0x07, 0x14, 0x05, 0x02, 0x00, 0x0B, 0x14, 0x07, 0x02,
+  0x0A, 0x06, 0x15, 0x02, 0x02, 0x08, 0x0B, 0x14, 0x03, 0x02, 0x07, 0x05,
+  0x11, 0x05, 0x02, 0x06, 0x04, 0x12, 0x04, 0x02, 0x06, 0x04, 0x13, 0x03,
+  0x02, 0x05, 0x04, 0x13, 0x03, 0x02, 0x05, 0x04, 0x14, 0x02, 0x02, 0x05,
+  0x04, 0x14, 0x01, 0x02, 0x05, 0x04, 0x14, 0x01, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x06, 0x05, 0x01, 0x06, 0x06, 0x01, 0x07, 0x06, 0x01,
+  0x08, 0x06, 0x01, 0x09, 0x06, 0x01, 0x0A, 0x06, 0x01, 0x0B, 0x06, 0x01,
+  0x0C, 0x06, 0x01, 0x0D, 0x05, 0x01, 0x0D, 0x06, 0x01, 0x0E, 0x05, 0x02,
+  0x02, 0x01, 0x0F, 0x04, 0x02, 0x02, 0x01, 0x0F, 0x04, 0x02, 0x02, 0x01,
+  0x0F, 0x04, 0x02, 0x01, 0x02, 0x0F, 0x04, 0x02, 0x01, 0x02, 0x0F, 0x04,
+  0x02, 0x01, 0x03, 0x0E, 0x04, 0x02, 0x01, 0x03, 0x0E, 0x04, 0x02, 0x01,
+  0x04, 0x0D, 0x04, 0x02, 0x01, 0x06, 0x0B, 0x05, 0x02, 0x01, 0x01, 0x05,
+  0x0A, 0x02, 0x00, 0x01, 0x07, 0x06, 0x01, 0x02, 0x19, 0x01, 0x02, 0x19,
+  0x03, 0x01, 0x05, 0x0C, 0x05, 0x17, 0x04, 0x03, 0x01, 0x03, 0x0C, 0x05,
+  0x18, 0x03, 0x03, 0x01, 0x02, 0x0C, 0x05, 0x19, 0x01, 0x03, 0x01, 0x01,
+  0x0B, 0x05, 0x19, 0x01, 0x03, 0x00, 0x02, 0x0B, 0x05, 0x19, 0x01, 0x03,
+  0x00, 0x01, 0x0B, 0x05, 0x19, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x0A, 0x05,
+  0x01, 0x0A, 0x05, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x05,
+  0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x05,
+  0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x07, 0x05, 0x01, 0x07, 0x05,
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01, 0x06, 0x05,
+  0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x03, 0x08,
+  0x01, 0x00, 0x0E, 0x02, 0x01, 0x0E, 0x16, 0x09, 0x02, 0x04, 0x08, 0x18,
+  0x06, 0x02, 0x05, 0x06, 0x19, 0x03, 0x02, 0x05, 0x05, 0x19, 0x03, 0x02,
+  0x05, 0x05, 0x19, 0x03, 0x02, 0x05, 0x05, 0x19, 0x02, 0x02, 0x04, 0x05,
+  0x19, 0x02, 0x02, 0x04, 0x05, 0x18, 0x03, 0x02, 0x04, 0x05, 0x18, 0x02,
+  0x02, 0x04, 0x05, 0x18, 0x02, 0x02, 0x03, 0x05, 0x18, 0x02, 0x02, 0x03,
+  0x05, 0x17, 0x03, 0x02, 0x03, 0x05, 0x17, 0x02, 0x02, 0x02, 0x05, 0x17,
+  0x02, 0x02, 0x02, 0x05, 0x17, 0x02, 0x02, 0x02, 0x05, 0x16, 0x02, 0x02,
+  0x02, 0x05, 0x16, 0x02, 0x02, 0x01, 0x05, 0x16, 0x02, 0x02, 0x01, 0x05,
+  0x15, 0x02, 0x02, 0x01, 0x05, 0x15, 0x02, 0x02, 0x01, 0x05, 0x15, 0x02,
+  0x02, 0x00, 0x05, 0x15, 0x02, 0x02, 0x00, 0x05, 0x14, 0x02, 0x02, 0x00,
+  0x05, 0x14, 0x02, 0x02, 0x00, 0x05, 0x13, 0x02, 0x02, 0x00, 0x05, 0x13,
+  0x02, 0x02, 0x00, 0x05, 0x12, 0x02, 0x02, 0x01, 0x05, 0x11, 0x03, 0x02,
+  0x02, 0x05, 0x10, 0x03, 0x02, 0x03, 0x06, 0x0E, 0x04, 0x01, 0x04, 0x0C,
+  0x01, 0x06, 0x08, 0x02, 0x00, 0x0B, 0x14, 0x09, 0x02, 0x02, 0x07, 0x16,
+  0x05, 0x02, 0x03, 0x05, 0x17, 0x04, 0x02, 0x03, 0x05, 0x17, 0x03, 0x02,
+  0x03, 0x05, 0x17, 0x02, 0x02, 0x03, 0x05, 0x16, 0x03, 0x02, 0x03, 0x05,
+  0x16, 0x02, 0x02, 0x04, 0x04, 0x15, 0x02, 0x02, 0x04, 0x05, 0x15, 0x02,
+  0x02, 0x04, 0x05, 0x14, 0x02, 0x02, 0x04, 0x05, 0x13, 0x03, 0x02, 0x04,
+  0x05, 0x13, 0x02, 0x02, 0x04, 0x05, 0x12, 0x02, 0x02, 0x05, 0x04, 0x12,
+  0x02, 0x02, 0x05, 0x04, 0x11, 0x02, 0x02, 0x05, 0x05, 0x10, 0x03, 0x02,
+  0x05, 0x05, 0x10, 0x02, 0x02, 0x05, 0x05, 0x0F, 0x02, 0x02, 0x05, 0x05,
+  0x0F, 0x02, 0x02, 0x06, 0x04, 0x0E, 0x02, 0x02, 0x06, 0x04, 0x0E, 0x02,
+  0x02, 0x06, 0x04, 0x0D, 0x02, 0x02, 0x06, 0x05, 0x0C, 0x02, 0x02, 0x06,
+  0x05, 0x0C, 0x02, 0x01, 0x06, 0x07, 0x01, 0x07, 0x06, 0x01, 0x07, 0x05,
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x08, 0x01, 0x03, 0x00, 0x0B, 0x0E, 0x0B, 0x1F, 0x08, 0x03, 0x02,
+  0x07, 0x10, 0x07, 0x21, 0x05, 0x03, 0x03, 0x05, 0x11, 0x05, 0x22, 0x03,
+  0x03, 0x03, 0x05, 0x11, 0x05, 0x22, 0x02, 0x03, 0x03, 0x05, 0x12, 0x04,
+  0x21, 0x03, 0x03, 0x03, 0x05, 0x12, 0x04, 0x21, 0x02, 0x03, 0x04, 0x04,
+  0x12, 0x04, 0x21, 0x02, 0x03, 0x04, 0x04, 0x12, 0x04, 0x20, 0x02, 0x03,
+  0x04, 0x04, 0x11, 0x06, 0x20, 0x02, 0x03, 0x04, 0x05, 0x11, 0x06, 0x1F,
+  0x02, 0x03, 0x04, 0x05, 0x10, 0x07, 0x1F, 0x02, 0x04, 0x04, 0x05, 0x10,
+  0x01, 0x12, 0x05, 0x1E, 0x02, 0x04, 0x04, 0x05, 0x0F, 0x02, 0x12, 0x05,
+  0x1E, 0x02, 0x04, 0x04, 0x05, 0x0F, 0x02, 0x13, 0x04, 0x1D, 0x02, 0x04,
+  0x05, 0x04, 0x0E, 0x02, 0x13, 0x04, 0x1C, 0x03, 0x04, 0x05, 0x04, 0x0E,
+  0x02, 0x13, 0x04, 0x1C, 0x02, 0x04, 0x05, 0x04, 0x0D, 0x02, 0x13, 0x04,
+  0x1B, 0x03, 0x04, 0x05, 0x04, 0x0D, 0x02, 0x13, 0x04, 0x1B, 0x02, 0x04,
+  0x05, 0x05, 0x0C, 0x02, 0x13, 0x05, 0x1A, 0x03, 0x04, 0x05, 0x05, 0x0C,
+  0x02, 0x13, 0x05, 0x1A, 0x02, 0x04, 0x05, 0x05, 0x0B, 0x02, 0x13, 0x05,
+  0x19, 0x03, 0x04, 0x05, 0x05, 0x0B, 0x02, 0x13, 0x05, 0x19, 0x02, 0x02,
+  0x05, 0x07, 0x14, 0x07, 0x02, 0x06, 0x06, 0x14, 0x06, 0x02, 0x06, 0x05,
+  0x14, 0x05, 0x02, 0x06, 0x05, 0x14, 0x05, 0x02, 0x06, 0x04, 0x14, 0x04,
+  0x02, 0x06, 0x04, 0x14, 0x04, 0x02, 0x06, 0x03, 0x14, 0x03, 0x02, 0x06,
+  0x03, 0x14, 0x03, 0x02, 0x06, 0x02, 0x14, 0x02, 0x02, 0x07, 0x01, 0x14,
+  0x02, 0x02, 0x05, 0x0C, 0x16, 0x0A, 0x02, 0x07, 0x08, 0x18, 0x07, 0x02,
+  0x09, 0x05, 0x19, 0x04, 0x02, 0x09, 0x05, 0x19, 0x03, 0x02, 0x0A, 0x04,
+  0x18, 0x03, 0x02, 0x0A, 0x05, 0x17, 0x03, 0x02, 0x0A, 0x05, 0x17, 0x02,
+  0x02, 0x0B, 0x05, 0x16, 0x02, 0x02, 0x0B, 0x05, 0x15, 0x03, 0x02, 0x0C,
+  0x04, 0x14, 0x03, 0x02, 0x0C, 0x05, 0x13, 0x03, 0x02, 0x0C, 0x05, 0x12,
+  0x03, 0x01, 0x0D, 0x07, 0x01, 0x0D, 0x06, 0x01, 0x0E, 0x04, 0x01, 0x0E,
+  0x05, 0x01, 0x0E, 0x05, 0x01, 0x0D, 0x07, 0x01, 0x0C, 0x08, 0x02, 0x0B,
+  0x03, 0x10, 0x04, 0x02, 0x0A, 0x03, 0x10, 0x05, 0x02, 0x0A, 0x02, 0x10,
+  0x05, 0x02, 0x09, 0x02, 0x11, 0x05, 0x02, 0x08, 0x02, 0x11, 0x05, 0x02,
+  0x07, 0x03, 0x12, 0x04, 0x02, 0x06, 0x03, 0x12, 0x05, 0x02, 0x05, 0x03,
+  0x12, 0x05, 0x02, 0x04, 0x03, 0x13, 0x05, 0x02, 0x03, 0x04, 0x13, 0x05,
+  0x02, 0x01, 0x07, 0x12, 0x08, 0x02, 0x00, 0x0A, 0x0F, 0x0D, 0x02, 0x01,
+  0x0B, 0x11, 0x09, 0x02, 0x03, 0x07, 0x14, 0x05, 0x02, 0x04, 0x05, 0x15,
+  0x03, 0x02, 0x04, 0x05, 0x14, 0x03, 0x02, 0x05, 0x04, 0x14, 0x02, 0x02,
+  0x05, 0x04, 0x13, 0x03, 0x02, 0x05, 0x05, 0x12, 0x03, 0x02, 0x05, 0x05,
+  0x12, 0x02, 0x02, 0x06, 0x04, 0x11, 0x02, 0x02, 0x06, 0x04, 0x10, 0x02,
+  0x02, 0x06, 0x05, 0x0F, 0x03, 0x02, 0x07, 0x04, 0x0E, 0x03, 0x02, 0x07,
+  0x04, 0x0E, 0x02, 0x02, 0x07, 0x05, 0x0D, 0x02, 0x01, 0x07, 0x07, 0x01,
+  0x08, 0x06, 0x01, 0x08, 0x05, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x07, 0x05, 0x01, 0x07, 0x05, 0x01, 0x07, 0x04, 0x01, 0x06, 0x05, 0x01,
+  0x06, 0x05, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x04, 0x06, 0x01, 0x03, 0x07, 0x01, 0x00, 0x0E, 0x01,
+  0x06, 0x17, 0x01, 0x06, 0x16, 0x02, 0x05, 0x05, 0x16, 0x06, 0x02, 0x05,
+  0x03, 0x15, 0x06, 0x02, 0x05, 0x02, 0x14, 0x06, 0x02, 0x04, 0x02, 0x13,
+  0x06, 0x02, 0x04, 0x01, 0x13, 0x05, 0x01, 0x12, 0x06, 0x01, 0x11, 0x06,
+  0x01, 0x10, 0x06, 0x01, 0x0F, 0x06, 0x01, 0x0F, 0x05, 0x01, 0x0E, 0x06,
+  0x01, 0x0D, 0x06, 0x01, 0x0C, 0x06, 0x01, 0x0B, 0x06, 0x01, 0x0B, 0x05,
+  0x01, 0x0A, 0x06, 0x01, 0x09, 0x06, 0x01, 0x08, 0x06, 0x01, 0x07, 0x06,
+  0x01, 0x07, 0x05, 0x01, 0x06, 0x06, 0x02, 0x05, 0x06, 0x19, 0x01, 0x02,
+  0x04, 0x06, 0x18, 0x01, 0x02, 0x03, 0x06, 0x17, 0x02, 0x02, 0x03, 0x05,
+  0x17, 0x02, 0x02, 0x02, 0x06, 0x16, 0x03, 0x02, 0x01, 0x06, 0x13, 0x05,
+  0x01, 0x00, 0x18, 0x01, 0x00, 0x18, 0x01, 0x0A, 0x07, 0x01, 0x09, 0x04,
+  0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x03, 0x03,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04,
+  0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x02, 0x04, 0x01, 0x03, 0x03,
+  0x01, 0x03, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x04,
+  0x01, 0x05, 0x03, 0x01, 0x05, 0x04, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x04, 0x01, 0x08, 0x03,
+  0x01, 0x08, 0x04, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x04,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x04, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03,
+  0x01, 0x0B, 0x04, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x04, 0x01, 0x0D, 0x03,
+  0x01, 0x0D, 0x03, 0x01, 0x0D, 0x04, 0x01, 0x08, 0x09, 0x01, 0x0C, 0x04,
+  0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x03,
+  0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x03,
+  0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x04,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03,
+  0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03,
+  0x01, 0x00, 0x08, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01, 0x07, 0x06,
+  0x01, 0x07, 0x06, 0x02, 0x06, 0x03, 0x0A, 0x04, 0x02, 0x06, 0x03, 0x0B,
+  0x03, 0x02, 0x05, 0x03, 0x0B, 0x04, 0x02, 0x05, 0x03, 0x0C, 0x03, 0x02,
+  0x04, 0x03, 0x0C, 0x04, 0x02, 0x04, 0x03, 0x0D, 0x03, 0x02, 0x03, 0x04,
+  0x0D, 0x04, 0x02, 0x03, 0x03, 0x0E, 0x03, 0x02, 0x02, 0x04, 0x0E, 0x04,
+  0x02, 0x02, 0x03, 0x0F, 0x03, 0x02, 0x01, 0x04, 0x0F, 0x04, 0x02, 0x01,
+  0x03, 0x10, 0x03, 0x02, 0x00, 0x04, 0x10, 0x04, 0x01, 0x00, 0x18, 0x01,
+  0x00, 0x18, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x05, 0x01,
+  0x01, 0x04, 0x01, 0x02, 0x04, 0x01, 0x03, 0x04, 0x01, 0x04, 0x03, 0x01,
+  0x05, 0x03, 0x02, 0x0B, 0x04, 0x11, 0x03, 0x03, 0x09, 0x02, 0x0F, 0x01,
+  0x11, 0x03, 0x02, 0x07, 0x03, 0x10, 0x04, 0x02, 0x06, 0x03, 0x10, 0x04,
+  0x02, 0x05, 0x03, 0x10, 0x03, 0x02, 0x04, 0x03, 0x10, 0x03, 0x02, 0x03,
+  0x04, 0x10, 0x03, 0x02, 0x03, 0x03, 0x0F, 0x03, 0x02, 0x02, 0x04, 0x0F,
+  0x03, 0x02, 0x02, 0x03, 0x0F, 0x03, 0x02, 0x01, 0x04, 0x0E, 0x04, 0x02,
+  0x01, 0x04, 0x0E, 0x03, 0x02, 0x00, 0x04, 0x0D, 0x04, 0x02, 0x00, 0x04,
+  0x0D, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x05, 0x03, 0x00, 0x04, 0x0C, 0x01,
+  0x0E, 0x03, 0x04, 0x00, 0x04, 0x0B, 0x01, 0x0D, 0x03, 0x14, 0x01, 0x04,
+  0x00, 0x04, 0x0A, 0x01, 0x0D, 0x03, 0x13, 0x01, 0x04, 0x00, 0x05, 0x09,
+  0x01, 0x0D, 0x03, 0x12, 0x01, 0x02, 0x01, 0x08, 0x0D, 0x05, 0x02, 0x02,
+  0x06, 0x0D, 0x03, 0x01, 0x08, 0x04, 0x01, 0x04, 0x07, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01, 0x05, 0x04,
+  0x02, 0x05, 0x04, 0x0D, 0x05, 0x02, 0x05, 0x03, 0x0B, 0x08, 0x03, 0x05,
+  0x03, 0x0A, 0x02, 0x0F, 0x05, 0x03, 0x04, 0x04, 0x09, 0x01, 0x10, 0x05,
+  0x03, 0x04, 0x04, 0x09, 0x01, 0x11, 0x04, 0x03, 0x04, 0x03, 0x08, 0x01,
+  0x11, 0x04, 0x02, 0x04, 0x04, 0x11, 0x04, 0x02, 0x03, 0x05, 0x11, 0x04,
+  0x02, 0x03, 0x04, 0x11, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x02,
+  0x04, 0x10, 0x04, 0x02, 0x02, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04, 0x0F,
+  0x04, 0x02, 0x02, 0x03, 0x0F, 0x04, 0x02, 0x01, 0x04, 0x0E, 0x04, 0x02,
+  0x01, 0x04, 0x0E, 0x03, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x01, 0x03,
+  0x0C, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x03, 0x02, 0x00, 0x04, 0x0A, 0x03,
+  0x02, 0x01, 0x04, 0x09, 0x03, 0x01, 0x03, 0x06, 0x01, 0x0A, 0x06, 0x02,
+  0x08, 0x03, 0x0F, 0x02, 0x02, 0x06, 0x03, 0x0F, 0x03, 0x02, 0x05, 0x03,
+  0x0E, 0x04, 0x02, 0x04, 0x03, 0x0E, 0x03, 0x01, 0x03, 0x04, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+  0x04, 0x01, 0x00, 0x04, 0x02, 0x00, 0x04, 0x0E, 0x01, 0x02, 0x00, 0x05,
+  0x0D, 0x02, 0x02, 0x01, 0x04, 0x0C, 0x02, 0x02, 0x01, 0x05, 0x0B, 0x02,
+  0x01, 0x02, 0x0A, 0x01, 0x04, 0x06, 0x01, 0x14, 0x03, 0x01, 0x10, 0x07,
+  0x01, 0x13, 0x04, 0x01, 0x13, 0x04, 0x01, 0x13, 0x03, 0x01, 0x13, 0x03,
+  0x01, 0x13, 0x03, 0x01, 0x12, 0x04, 0x01, 0x12, 0x03, 0x01, 0x12, 0x03,
+  0x01, 0x11, 0x04, 0x02, 0x0B, 0x04, 0x11, 0x04, 0x03, 0x09, 0x03, 0x0F,
+  0x01, 0x11, 0x03, 0x03, 0x08, 0x02, 0x0F, 0x01, 0x11, 0x03, 0x02, 0x06,
+  0x03, 0x10, 0x04, 0x02, 0x05, 0x04, 0x10, 0x03, 0x02, 0x05, 0x03, 0x0F,
+  0x04, 0x02, 0x04, 0x03, 0x0F, 0x04, 0x02, 0x03, 0x04, 0x0F, 0x04, 0x02,
+  0x02, 0x04, 0x0F, 0x03, 0x02, 0x02, 0x04, 0x0F, 0x03, 0x02, 0x01, 0x04,
+  0x0E, 0x04, 0x02, 0x01, 0x04, 0x0E, 0x04, 0x02, 0x01, 0x04, 0x0E, 0x03,
+  0x02, 0x00, 0x04, 0x0D, 0x04, 0x02, 0x00, 0x04, 0x0D, 0x04, 0x02, 0x00,
+  0x04, 0x0C, 0x05, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x04, 0x00, 0x04, 0x0B,
+  0x01, 0x0D, 0x03, 0x14, 0x01, 0x04, 0x00, 0x04, 0x0A, 0x01, 0x0D, 0x03,
+  0x13, 0x01, 0x04, 0x01, 0x04, 0x09, 0x01, 0x0D, 0x03, 0x12, 0x01, 0x02,
+  0x01, 0x08, 0x0D, 0x05, 0x02, 0x03, 0x04, 0x0D, 0x03, 0x01, 0x0B, 0x05,
+  0x02, 0x09, 0x03, 0x0E, 0x04, 0x02, 0x07, 0x03, 0x0F, 0x03, 0x02, 0x06,
+  0x03, 0x0F, 0x03, 0x02, 0x05, 0x03, 0x0F, 0x03, 0x02, 0x04, 0x04, 0x0E,
+  0x04, 0x02, 0x03, 0x04, 0x0E, 0x03, 0x02, 0x03, 0x03, 0x0D, 0x03, 0x02,
+  0x02, 0x04, 0x0C, 0x03, 0x02, 0x01, 0x05, 0x0A, 0x04, 0x02, 0x01, 0x04,
+  0x08, 0x04, 0x01, 0x01, 0x08, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x02, 0x00, 0x04, 0x0F, 0x01, 0x02, 0x00,
+  0x04, 0x0E, 0x02, 0x02, 0x01, 0x04, 0x0D, 0x02, 0x02, 0x01, 0x05, 0x0B,
+  0x02, 0x01, 0x02, 0x0A, 0x01, 0x04, 0x05, 0x01, 0x15, 0x05, 0x02, 0x13,
+  0x02, 0x18, 0x03, 0x02, 0x12, 0x02, 0x18, 0x03, 0x02, 0x11, 0x03, 0x18,
+  0x03, 0x01, 0x11, 0x02, 0x01, 0x10, 0x03, 0x01, 0x10, 0x02, 0x01, 0x0F,
+  0x03, 0x01, 0x0F, 0x03, 0x01, 0x0E, 0x04, 0x01, 0x0E, 0x03, 0x01, 0x0E,
+  0x03, 0x01, 0x09, 0x0D, 0x01, 0x09, 0x0D, 0x01, 0x0D, 0x04, 0x01, 0x0D,
+  0x03, 0x01, 0x0D, 0x03, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0C,
+  0x04, 0x01, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x04, 0x01, 0x0A,
+  0x04, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x09,
+  0x04, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x08,
+  0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x02, 0x02, 0x00, 0x03, 0x07, 0x02,
+  0x02, 0x00, 0x03, 0x07, 0x02, 0x02, 0x00, 0x03, 0x06, 0x02, 0x01, 0x01,
+  0x05, 0x01, 0x0A, 0x06, 0x02, 0x08, 0x03, 0x0F, 0x03, 0x02, 0x07, 0x03,
+  0x10, 0x05, 0x02, 0x06, 0x03, 0x10, 0x05, 0x02, 0x05, 0x03, 0x10, 0x03,
+  0x02, 0x04, 0x04, 0x10, 0x03, 0x02, 0x04, 0x04, 0x10, 0x03, 0x02, 0x04,
+  0x03, 0x10, 0x03, 0x02, 0x04, 0x03, 0x0F, 0x04, 0x02, 0x04, 0x03, 0x0F,
+  0x03, 0x02, 0x04, 0x03, 0x0E, 0x04, 0x02, 0x05, 0x03, 0x0D, 0x04, 0x02,
+  0x06, 0x02, 0x0C, 0x03, 0x01, 0x07, 0x07, 0x01, 0x06, 0x02, 0x01, 0x05,
+  0x02, 0x01, 0x04, 0x03, 0x01, 0x04, 0x06, 0x01, 0x04, 0x09, 0x01, 0x05,
+  0x0A, 0x02, 0x04, 0x01, 0x08, 0x08, 0x02, 0x02, 0x02, 0x0B, 0x06, 0x02,
+  0x01, 0x02, 0x0D, 0x05, 0x02, 0x00, 0x02, 0x0E, 0x04, 0x02, 0x00, 0x02,
+  0x0F, 0x03, 0x02, 0x00, 0x02, 0x0F, 0x03, 0x02, 0x00, 0x02, 0x0F, 0x02,
+  0x02, 0x00, 0x03, 0x0E, 0x03, 0x02, 0x01, 0x02, 0x0D, 0x03, 0x02, 0x02,
+  0x03, 0x0B, 0x03, 0x01, 0x04, 0x08, 0x01, 0x08, 0x04, 0x01, 0x04, 0x07,
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03,
+  0x01, 0x06, 0x03, 0x02, 0x05, 0x04, 0x0F, 0x03, 0x02, 0x05, 0x04, 0x0D,
+  0x06, 0x03, 0x05, 0x03, 0x0C, 0x02, 0x10, 0x03, 0x03, 0x04, 0x04, 0x0B,
+  0x01, 0x10, 0x03, 0x03, 0x04, 0x04, 0x0A, 0x01, 0x10, 0x03, 0x03, 0x04,
+  0x03, 0x09, 0x01, 0x10, 0x03, 0x03, 0x04, 0x03, 0x08, 0x01, 0x0F, 0x03,
+  0x03, 0x03, 0x04, 0x08, 0x01, 0x0F, 0x03, 0x02, 0x03, 0x05, 0x0F, 0x03,
+  0x02, 0x03, 0x04, 0x0F, 0x03, 0x02, 0x03, 0x04, 0x0F, 0x03, 0x02, 0x02,
+  0x04, 0x0E, 0x03, 0x02, 0x02, 0x04, 0x0E, 0x03, 0x02, 0x02, 0x03, 0x0E,
+  0x03, 0x02, 0x02, 0x03, 0x0E, 0x03, 0x03, 0x01, 0x04, 0x0E, 0x02, 0x14,
+  0x01, 0x03, 0x01, 0x04, 0x0D, 0x03, 0x13, 0x01, 0x03, 0x01, 0x03, 0x0D,
+  0x03, 0x12, 0x02, 0x03, 0x01, 0x03, 0x0D, 0x03, 0x12, 0x01, 0x02, 0x00,
+  0x04, 0x0D, 0x05, 0x02, 0x00, 0x04, 0x0D, 0x03, 0x01, 0x06, 0x03, 0x01,
+  0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x06, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x03, 0x01, 0x01, 0x07, 0x01, 0x03,
+  0x05, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x03, 0x07, 0x01,
+  0x02, 0x00, 0x03, 0x06, 0x01, 0x02, 0x00, 0x03, 0x05, 0x01, 0x01, 0x00,
+  0x05, 0x01, 0x01, 0x03, 0x01, 0x0F, 0x03, 0x01, 0x0E, 0x05, 0x01, 0x0E,
+  0x05, 0x01, 0x0E, 0x05, 0x01, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x0E, 0x03, 0x01, 0x09, 0x08, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04,
+  0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x04,
+  0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x03, 0x01, 0x0B, 0x03,
+  0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03,
+  0x01, 0x09, 0x04, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03, 0x01, 0x09, 0x03,
+  0x01, 0x08, 0x04, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x08, 0x03,
+  0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03, 0x02, 0x00, 0x03,
+  0x06, 0x03, 0x02, 0x00, 0x03, 0x06, 0x02, 0x02, 0x00, 0x03, 0x05, 0x02,
+  0x01, 0x01, 0x05, 0x01, 0x08, 0x04, 0x01, 0x04, 0x07, 0x01, 0x07, 0x04,
+  0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03, 0x01, 0x07, 0x03,
+  0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03,
+  0x01, 0x05, 0x04, 0x02, 0x05, 0x03, 0x0C, 0x09, 0x02, 0x05, 0x03, 0x0F,
+  0x04, 0x02, 0x04, 0x04, 0x0F, 0x02, 0x02, 0x04, 0x04, 0x0E, 0x02, 0x02,
+  0x04, 0x03, 0x0D, 0x02, 0x02, 0x04, 0x03, 0x0B, 0x03, 0x02, 0x03, 0x04,
+  0x0A, 0x02, 0x02, 0x03, 0x04, 0x09, 0x02, 0x02, 0x03, 0x03, 0x08, 0x02,
+  0x01, 0x03, 0x08, 0x01, 0x02, 0x09, 0x02, 0x02, 0x04, 0x08, 0x04, 0x02,
+  0x02, 0x03, 0x08, 0x04, 0x02, 0x02, 0x03, 0x09, 0x03, 0x02, 0x01, 0x04,
+  0x09, 0x04, 0x02, 0x01, 0x04, 0x0A, 0x03, 0x03, 0x01, 0x03, 0x0A, 0x04,
+  0x12, 0x01, 0x03, 0x00, 0x04, 0x0B, 0x03, 0x12, 0x01, 0x03, 0x00, 0x04,
+  0x0B, 0x04, 0x11, 0x01, 0x02, 0x00, 0x04, 0x0C, 0x05, 0x01, 0x0D, 0x03,
+  0x01, 0x08, 0x03, 0x01, 0x04, 0x07, 0x01, 0x06, 0x05, 0x01, 0x07, 0x03,
+  0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03,
+  0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x03,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x02, 0x01, 0x03,
+  0x08, 0x01, 0x02, 0x00, 0x04, 0x07, 0x01, 0x02, 0x00, 0x04, 0x06, 0x01,
+  0x02, 0x00, 0x03, 0x05, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x03, 0x03,
+  0x05, 0x04, 0x0F, 0x03, 0x19, 0x04, 0x03, 0x01, 0x07, 0x0D, 0x06, 0x18,
+  0x06, 0x05, 0x04, 0x04, 0x0C, 0x02, 0x10, 0x03, 0x17, 0x01, 0x1B, 0x03,
+  0x05, 0x04, 0x04, 0x0B, 0x01, 0x10, 0x03, 0x16, 0x01, 0x1B, 0x03, 0x05,
+  0x04, 0x04, 0x0A, 0x01, 0x10, 0x03, 0x15, 0x01, 0x1B, 0x03, 0x05, 0x04,
+  0x03, 0x09, 0x01, 0x0F, 0x03, 0x14, 0x01, 0x1A, 0x04, 0x05, 0x03, 0x04,
+  0x08, 0x01, 0x0F, 0x03, 0x13, 0x01, 0x1A, 0x04, 0x05, 0x03, 0x04, 0x08,
+  0x01, 0x0F, 0x03, 0x13, 0x01, 0x1A, 0x04, 0x03, 0x03, 0x05, 0x0F, 0x04,
+  0x1A, 0x03, 0x03, 0x03, 0x04, 0x0E, 0x05, 0x19, 0x04, 0x03, 0x02, 0x05,
+  0x0E, 0x04, 0x19, 0x04, 0x03, 0x02, 0x04, 0x0E, 0x04, 0x19, 0x04, 0x03,
+  0x02, 0x04, 0x0E, 0x03, 0x19, 0x03, 0x03, 0x02, 0x03, 0x0D, 0x04, 0x18,
+  0x04, 0x03, 0x01, 0x04, 0x0D, 0x04, 0x18, 0x04, 0x04, 0x01, 0x04, 0x0D,
+  0x03, 0x18, 0x04, 0x1E, 0x01, 0x04, 0x01, 0x03, 0x0D, 0x03, 0x18, 0x03,
+  0x1E, 0x01, 0x04, 0x01, 0x03, 0x0C, 0x04, 0x17, 0x03, 0x1D, 0x01, 0x04,
+  0x00, 0x04, 0x0C, 0x04, 0x17, 0x03, 0x1C, 0x01, 0x03, 0x00, 0x04, 0x0C,
+  0x03, 0x17, 0x05, 0x03, 0x00, 0x03, 0x0C, 0x03, 0x17, 0x04, 0x02, 0x05,
+  0x04, 0x0F, 0x04, 0x02, 0x01, 0x08, 0x0D, 0x07, 0x03, 0x04, 0x04, 0x0C,
+  0x01, 0x10, 0x04, 0x03, 0x04, 0x04, 0x0B, 0x01, 0x10, 0x04, 0x03, 0x04,
+  0x04, 0x0A, 0x01, 0x10, 0x04, 0x03, 0x04, 0x03, 0x09, 0x01, 0x10, 0x03,
+  0x03, 0x04, 0x03, 0x09, 0x01, 0x0F, 0x04, 0x03, 0x03, 0x04, 0x08, 0x01,
+  0x0F, 0x04, 0x02, 0x03, 0x05, 0x0F, 0x04, 0x03, 0x03, 0x03, 0x07, 0x01,
+  0x0F, 0x03, 0x02, 0x02, 0x05, 0x0E, 0x04, 0x02, 0x02, 0x04, 0x0E, 0x04,
+  0x02, 0x02, 0x04, 0x0E, 0x03, 0x02, 0x02, 0x03, 0x0E, 0x03, 0x02, 0x01,
+  0x04, 0x0D, 0x04, 0x03, 0x01, 0x04, 0x0D, 0x04, 0x14, 0x01, 0x03, 0x01,
+  0x03, 0x0D, 0x03, 0x14, 0x01, 0x03, 0x01, 0x03, 0x0D, 0x03, 0x13, 0x01,
+  0x03, 0x00, 0x04, 0x0D, 0x03, 0x12, 0x01, 0x02, 0x00, 0x04, 0x0D, 0x05,
+  0x02, 0x00, 0x03, 0x0E, 0x03, 0x01, 0x0B, 0x06, 0x02, 0x08, 0x04, 0x0F,
+  0x04, 0x02, 0x07, 0x03, 0x10, 0x04, 0x02, 0x06, 0x03, 0x11, 0x03, 0x02,
+  0x05, 0x03, 0x11, 0x04, 0x02, 0x04, 0x04, 0x11, 0x04, 0x02, 0x03, 0x04,
+  0x11, 0x04, 0x02, 0x02, 0x04, 0x11, 0x04, 0x02, 0x02, 0x04, 0x11, 0x04,
+  0x02, 0x01, 0x04, 0x11, 0x04, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x00,
+  0x05, 0x10, 0x04, 0x02, 0x00, 0x05, 0x10, 0x04, 0x02, 0x00, 0x04, 0x0F,
+  0x04, 0x02, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x04, 0x0E, 0x04, 0x02,
+  0x00, 0x04, 0x0E, 0x03, 0x02, 0x00, 0x04, 0x0D, 0x03, 0x02, 0x01, 0x03,
+  0x0C, 0x03, 0x02, 0x01, 0x04, 0x0B, 0x03, 0x02, 0x02, 0x04, 0x0A, 0x02,
+  0x01, 0x04, 0x06, 0x02, 0x0A, 0x04, 0x12, 0x06, 0x02, 0x06, 0x08, 0x11,
+  0x08, 0x03, 0x09, 0x05, 0x0F, 0x03, 0x14, 0x06, 0x03, 0x0A, 0x03, 0x0E,
+  0x02, 0x15, 0x06, 0x03, 0x09, 0x04, 0x0E, 0x01, 0x16, 0x05, 0x02, 0x09,
+  0x05, 0x16, 0x05, 0x02, 0x09, 0x04, 0x16, 0x05, 0x02, 0x09, 0x04, 0x16,
+  0x05, 0x02, 0x08, 0x04, 0x16, 0x05, 0x02, 0x08, 0x04, 0x16, 0x05, 0x02,
+  0x08, 0x04, 0x15, 0x05, 0x02, 0x08, 0x03, 0x15, 0x05, 0x02, 0x07, 0x04,
+  0x15, 0x04, 0x02, 0x07, 0x04, 0x14, 0x05, 0x02, 0x07, 0x03, 0x14, 0x04,
+  0x02, 0x07, 0x03, 0x13, 0x05, 0x02, 0x06, 0x04, 0x13, 0x04, 0x02, 0x06,
+  0x04, 0x12, 0x04, 0x02, 0x06, 0x04, 0x11, 0x04, 0x02, 0x06, 0x04, 0x10,
+  0x03, 0x02, 0x05, 0x05, 0x0E, 0x04, 0x02, 0x05, 0x04, 0x0A, 0x05, 0x01,
+  0x05, 0x03, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x06, 0x01,
+  0x00, 0x0A, 0x01, 0x0B, 0x05, 0x03, 0x09, 0x03, 0x0F, 0x02, 0x12, 0x03,
+  0x03, 0x08, 0x03, 0x10, 0x01, 0x12, 0x03, 0x02, 0x06, 0x04, 0x11, 0x04,
+  0x02, 0x05, 0x04, 0x11, 0x03, 0x02, 0x05, 0x03, 0x11, 0x03, 0x02, 0x04,
+  0x03, 0x10, 0x04, 0x02, 0x03, 0x04, 0x10, 0x04, 0x02, 0x02, 0x04, 0x10,
+  0x03, 0x02, 0x02, 0x04, 0x10, 0x03, 0x02, 0x01, 0x04, 0x0F, 0x04, 0x02,
+  0x01, 0x04, 0x0F, 0x03, 0x02, 0x01, 0x04, 0x0E, 0x04, 0x02, 0x00, 0x04,
+  0x0E, 0x04, 0x02, 0x00, 0x04, 0x0D, 0x05, 0x03, 0x00, 0x04, 0x0C, 0x01,
+  0x0E, 0x03, 0x03, 0x00, 0x04, 0x0B, 0x01, 0x0D, 0x04, 0x03, 0x00, 0x04,
+  0x0B, 0x01, 0x0D, 0x04, 0x03, 0x00, 0x04, 0x0A, 0x01, 0x0D, 0x03, 0x03,
+  0x01, 0x04, 0x08, 0x02, 0x0D, 0x03, 0x02, 0x01, 0x08, 0x0C, 0x04, 0x02,
+  0x02, 0x05, 0x0C, 0x04, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x04, 0x01, 0x0B,
+  0x04, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01, 0x0A,
+  0x04, 0x01, 0x09, 0x05, 0x01, 0x06, 0x0B, 0x02, 0x05, 0x04, 0x0D, 0x03,
+  0x02, 0x01, 0x07, 0x0C, 0x05, 0x02, 0x04, 0x04, 0x0B, 0x06, 0x03, 0x04,
+  0x04, 0x0A, 0x02, 0x0D, 0x04, 0x02, 0x04, 0x04, 0x09, 0x02, 0x02, 0x04,
+  0x03, 0x09, 0x01, 0x02, 0x04, 0x03, 0x08, 0x01, 0x02, 0x04, 0x03, 0x08,
+  0x01, 0x01, 0x03, 0x05, 0x02, 0x03, 0x03, 0x07, 0x01, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03,
+  0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x02, 0x07, 0x06, 0x10, 0x01, 0x02,
+  0x06, 0x02, 0x0C, 0x05, 0x02, 0x05, 0x02, 0x0E, 0x03, 0x02, 0x04, 0x03,
+  0x0E, 0x02, 0x02, 0x04, 0x03, 0x0F, 0x01, 0x02, 0x04, 0x03, 0x0F, 0x01,
+  0x02, 0x04, 0x04, 0x0F, 0x01, 0x01, 0x04, 0x05, 0x01, 0x05, 0x05, 0x01,
+  0x05, 0x05, 0x01, 0x06, 0x05, 0x01, 0x07, 0x05, 0x01, 0x08, 0x04, 0x01,
+  0x09, 0x04, 0x02, 0x01, 0x01, 0x09, 0x04, 0x02, 0x01, 0x01, 0x0A, 0x03,
+  0x02, 0x01, 0x01, 0x0A, 0x03, 0x02, 0x01, 0x02, 0x0A, 0x03, 0x02, 0x00,
+  0x03, 0x0A, 0x02, 0x02, 0x00, 0x03, 0x09, 0x03, 0x02, 0x00, 0x04, 0x08,
+  0x03, 0x02, 0x00, 0x01, 0x04, 0x05, 0x01, 0x08, 0x02, 0x01, 0x07, 0x02,
+  0x01, 0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x03, 0x05, 0x01, 0x02, 0x0A,
+  0x01, 0x01, 0x0B, 0x01, 0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+  0x01, 0x03, 0x04, 0x01, 0x03, 0x04, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x02, 0x01, 0x03, 0x08, 0x01, 0x02,
+  0x00, 0x04, 0x07, 0x01, 0x02, 0x00, 0x04, 0x07, 0x01, 0x02, 0x00, 0x04,
+  0x06, 0x01, 0x01, 0x00, 0x06, 0x01, 0x01, 0x04, 0x00, 0x02, 0x04, 0x04,
+  0x10, 0x03, 0x02, 0x01, 0x07, 0x10, 0x03, 0x02, 0x04, 0x04, 0x0F, 0x04,
+  0x02, 0x04, 0x03, 0x0F, 0x04, 0x02, 0x03, 0x04, 0x0E, 0x04, 0x02, 0x03,
+  0x04, 0x0E, 0x04, 0x02, 0x03, 0x04, 0x0E, 0x04, 0x02, 0x03, 0x03, 0x0D,
+  0x05, 0x02, 0x02, 0x04, 0x0D, 0x04, 0x02, 0x02, 0x04, 0x0C, 0x05, 0x03,
+  0x02, 0x04, 0x0C, 0x01, 0x0E, 0x03, 0x02, 0x02, 0x03, 0x0B, 0x06, 0x03,
+  0x01, 0x04, 0x0A, 0x02, 0x0D, 0x03, 0x03, 0x01, 0x04, 0x0A, 0x01, 0x0D,
+  0x03, 0x03, 0x01, 0x04, 0x09, 0x02, 0x0D, 0x03, 0x04, 0x01, 0x03, 0x08,
+  0x02, 0x0D, 0x03, 0x13, 0x01, 0x04, 0x00, 0x04, 0x08, 0x01, 0x0C, 0x03,
+  0x13, 0x01, 0x04, 0x00, 0x03, 0x07, 0x01, 0x0C, 0x03, 0x12, 0x01, 0x04,
+  0x00, 0x03, 0x05, 0x02, 0x0C, 0x03, 0x11, 0x01, 0x02, 0x00, 0x06, 0x0C,
+  0x05, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x02, 0x03, 0x03, 0x0E, 0x03, 0x02,
+  0x00, 0x06, 0x0E, 0x04, 0x02, 0x03, 0x04, 0x0E, 0x04, 0x02, 0x03, 0x04,
+  0x0F, 0x03, 0x02, 0x03, 0x04, 0x10, 0x02, 0x02, 0x04, 0x03, 0x10, 0x02,
+  0x02, 0x04, 0x03, 0x10, 0x01, 0x02, 0x04, 0x03, 0x0F, 0x02, 0x02, 0x04,
+  0x03, 0x0F, 0x01, 0x02, 0x04, 0x03, 0x0E, 0x02, 0x02, 0x04, 0x04, 0x0E,
+  0x01, 0x02, 0x04, 0x04, 0x0D, 0x01, 0x02, 0x05, 0x03, 0x0D, 0x01, 0x02,
+  0x05, 0x03, 0x0C, 0x01, 0x02, 0x05, 0x03, 0x0B, 0x01, 0x02, 0x05, 0x03,
+  0x0A, 0x02, 0x02, 0x05, 0x03, 0x09, 0x02, 0x01, 0x05, 0x05, 0x01, 0x05,
+  0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x02, 0x01, 0x05, 0x01, 0x03, 0x04,
+  0x02, 0x11, 0x01, 0x1A, 0x03, 0x03, 0x00, 0x07, 0x11, 0x01, 0x1A, 0x04,
+  0x03, 0x03, 0x04, 0x10, 0x02, 0x1A, 0x04, 0x03, 0x04, 0x03, 0x0F, 0x04,
+  0x1B, 0x03, 0x03, 0x04, 0x03, 0x0F, 0x04, 0x1C, 0x02, 0x03, 0x04, 0x03,
+  0x0E, 0x05, 0x1C, 0x01, 0x04, 0x04, 0x03, 0x0D, 0x02, 0x10, 0x03, 0x1C,
+  0x01, 0x04, 0x04, 0x03, 0x0D, 0x01, 0x10, 0x03, 0x1B, 0x01, 0x04, 0x04,
+  0x04, 0x0C, 0x02, 0x10, 0x03, 0x1B, 0x01, 0x04, 0x05, 0x03, 0x0C, 0x01,
+  0x10, 0x03, 0x1A, 0x01, 0x04, 0x05, 0x03, 0x0B, 0x02, 0x10, 0x03, 0x19,
+  0x02, 0x04, 0x05, 0x03, 0x0A, 0x02, 0x10, 0x03, 0x19, 0x01, 0x04, 0x05,
+  0x03, 0x0A, 0x01, 0x10, 0x03, 0x18, 0x01, 0x04, 0x05, 0x03, 0x09, 0x02,
+  0x10, 0x03, 0x17, 0x02, 0x03, 0x05, 0x05, 0x11, 0x03, 0x16, 0x02, 0x03,
+  0x05, 0x05, 0x11, 0x03, 0x16, 0x01, 0x03, 0x05, 0x04, 0x11, 0x03, 0x15,
+  0x01, 0x02, 0x05, 0x04, 0x11, 0x05, 0x02, 0x05, 0x03, 0x11, 0x04, 0x02,
+  0x05, 0x03, 0x11, 0x03, 0x02, 0x05, 0x02, 0x11, 0x02, 0x02, 0x05, 0x01,
+  0x11, 0x01, 0x02, 0x08, 0x03, 0x12, 0x03, 0x02, 0x05, 0x06, 0x11, 0x05,
+  0x04, 0x04, 0x01, 0x08, 0x04, 0x10, 0x01, 0x13, 0x02, 0x02, 0x08, 0x04,
+  0x0F, 0x01, 0x02, 0x09, 0x03, 0x0E, 0x01, 0x02, 0x09, 0x03, 0x0D, 0x01,
+  0x01, 0x09, 0x05, 0x01, 0x09, 0x04, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x03,
+  0x01, 0x0A, 0x03, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x05, 0x02, 0x09, 0x01,
+  0x0B, 0x03, 0x02, 0x08, 0x01, 0x0B, 0x03, 0x02, 0x07, 0x02, 0x0B, 0x03,
+  0x03, 0x07, 0x01, 0x0B, 0x04, 0x13, 0x01, 0x03, 0x06, 0x01, 0x0C, 0x03,
+  0x13, 0x01, 0x03, 0x05, 0x01, 0x0C, 0x03, 0x12, 0x01, 0x04, 0x00, 0x03,
+  0x05, 0x01, 0x0C, 0x04, 0x11, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02,
+  0x00, 0x04, 0x0D, 0x03, 0x02, 0x05, 0x04, 0x12, 0x02, 0x02, 0x01, 0x08,
+  0x11, 0x04, 0x02, 0x05, 0x04, 0x11, 0x04, 0x02, 0x06, 0x04, 0x12, 0x03,
+  0x02, 0x06, 0x04, 0x13, 0x02, 0x02, 0x07, 0x03, 0x13, 0x02, 0x02, 0x07,
+  0x04, 0x13, 0x01, 0x02, 0x07, 0x04, 0x13, 0x01, 0x02, 0x08, 0x03, 0x12,
+  0x01, 0x02, 0x08, 0x04, 0x12, 0x01, 0x02, 0x08, 0x04, 0x11, 0x02, 0x02,
+  0x08, 0x04, 0x11, 0x01, 0x02, 0x09, 0x03, 0x10, 0x02, 0x02, 0x09, 0x03,
+  0x10, 0x01, 0x02, 0x09, 0x04, 0x0F, 0x01, 0x02, 0x09, 0x04, 0x0E, 0x02,
+  0x02, 0x0A, 0x03, 0x0E, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x0A, 0x04, 0x01,
+  0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0A, 0x02, 0x01, 0x0A, 0x01, 0x01,
+  0x09, 0x02, 0x01, 0x09, 0x01, 0x01, 0x08, 0x01, 0x01, 0x07, 0x01, 0x01,
+  0x06, 0x01, 0x02, 0x00, 0x03, 0x05, 0x01, 0x01, 0x00, 0x05, 0x01, 0x00,
+  0x04, 0x01, 0x04, 0x0D, 0x01, 0x04, 0x0C, 0x02, 0x04, 0x01, 0x0E, 0x01,
+  0x02, 0x03, 0x02, 0x0D, 0x02, 0x02, 0x03, 0x01, 0x0C, 0x02, 0x01, 0x0B,
+  0x02, 0x01, 0x0A, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x09, 0x02, 0x01, 0x08,
+  0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x01, 0x01, 0x06, 0x02, 0x01, 0x05,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02,
+  0x04, 0x01, 0x01, 0x07, 0x02, 0x00, 0x09, 0x0D, 0x03, 0x03, 0x00, 0x01,
+  0x04, 0x06, 0x0D, 0x03, 0x02, 0x06, 0x04, 0x0D, 0x03, 0x02, 0x08, 0x03,
+  0x0E, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x0C, 0x04, 0x01, 0x0A, 0x04, 0x01,
+  0x09, 0x04, 0x01, 0x09, 0x03, 0x01, 0x08, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x03, 0x01, 0x08, 0x03, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01,
+  0x07, 0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01,
+  0x06, 0x03, 0x01, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01,
+  0x04, 0x04, 0x01, 0x02, 0x05, 0x01, 0x01, 0x05, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x01, 0x02, 0x01, 0x02, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0B, 0x02, 0x01,
+  0x0C, 0x03, 0x01, 0x0D, 0x02, 0x01, 0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01,
+  0x0D, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x0C, 0x04, 0x01, 0x0C, 0x04, 0x01,
+  0x0C, 0x03, 0x01, 0x0C, 0x03, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x04, 0x01,
+  0x0B, 0x03, 0x01, 0x0B, 0x03, 0x01, 0x0A, 0x04, 0x01, 0x0A, 0x04, 0x01,
+  0x0A, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x0B, 0x02, 0x01, 0x0C, 0x01, 0x01,
+  0x0B, 0x03, 0x01, 0x09, 0x06, 0x01, 0x09, 0x04, 0x01, 0x08, 0x04, 0x01,
+  0x08, 0x03, 0x01, 0x07, 0x04, 0x01, 0x07, 0x04, 0x01, 0x07, 0x03, 0x01,
+  0x07, 0x03, 0x01, 0x06, 0x04, 0x01, 0x06, 0x03, 0x01, 0x06, 0x03, 0x01,
+  0x05, 0x04, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x01, 0x05, 0x03, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x03, 0x01, 0x03, 0x03, 0x01, 0x00, 0x05, 0x01,
+  0x03, 0x06, 0x02, 0x02, 0x09, 0x12, 0x02, 0x02, 0x01, 0x0C, 0x11, 0x04,
+  0x02, 0x00, 0x04, 0x08, 0x0D, 0x02, 0x01, 0x02, 0x0A, 0x0A, 0x01, 0x0D,
+  0x05 };
+
+const GFXglyph FreeSerifItalic24pt7bSpanGlyphs[] PROGMEM = {
+  {     0,   0,   0,  12,    0,    1 },   // 0x20 ' '
+  {     0,  12,  32,  16,    2,  -30 },   // 0x21 '!'
+  {    88,  14,  12,  16,    6,  -31 },   // 0x22 '"'
+  {   148,  25,  31,  23,    0,  -30 },   // 0x23 '#'
+  {   295,  21,  38,  24,    2,  -33 },   // 0x24 '$'
+  {   483,  33,  32,  39,    4,  -30 },   // 0x25 '%'
+  {   707,  30,  33,  37,    4,  -31 },   // 0x26 '&'
+  {   880,   5,  12,   9,    6,  -31 },   // 0x27 '''
+  {   916,  13,  39,  16,    2,  -30 },   // 0x28 '('
+  {  1033,  13,  39,  16,    0,  -30 },   // 0x29 ')'
+  {  1150,  16,  20,  23,    7,  -31 },   // 0x2A '*'
+  {  1246,  23,  23,  32,    4,  -22 },   // 0x2B '+'
+  {  1315,   7,  11,  12,   -1,   -4 },   // 0x2C ','
+  {  1348,  11,   3,  16,    2,  -11 },   // 0x2D '-'
+  {  1357,   5,   5,  12,    1,   -3 },   // 0x2E '.'
+  {  1372,  21,  33,  14,    0,  -31 },   // 0x2F '/'
+  {  1471,  21,  31,  23,    2,  -30 },   // 0x30 '0'
+  {  1622,  17,  32,  23,    2,  -31 },   // 0x31 '1'
+  {  1718,  21,  31,  24,    0,  -30 },   // 0x32 '2'
+  {  1825,  22,  32,  23,    0,  -31 },   // 0x33 '3'
+  {  1931,  22,  32,  23,    0,  -31 },   // 0x34 '4'
+  {  2057,  22,  32,  24,    0,  -31 },   // 0x35 '5'
+  {  2157,  23,  32,  23,    1,  -31 },   // 0x36 '6'
+  {  2291,  21,  32,  23,    4,  -31 },   // 0x37 '7'
+  {  2393,  22,  32,  23,    1,  -31 },   // 0x38 '8'
+  {  2543,  22,  33,  23,    1,  -31 },   // 0x39 '9'
+  {  2682,   9,  22,  12,    2,  -20 },   // 0x3A ':'
+  {  2724,  11,  27,  12,    1,  -20 },   // 0x3B ';'
+  {  2783,  23,  25,  27,    3,  -24 },   // 0x3C '<'
+  {  2856,  24,  12,  31,    4,  -17 },   // 0x3D '='
+  {  2880,  24,  25,  27,    3,  -24 },   // 0x3E '>'
+  {  2955,  16,  33,  21,    6,  -31 },   // 0x3F '?'
+  {  3058,  33,  33,  37,    3,  -31 },   // 0x40 '@'
+  {  3277,  29,  31,  31,    0,  -30 },   // 0x41 'A'
+  {  3414,  28,  31,  28,    0,  -30 },   // 0x42 'B'
+  {  3557,  30,  33,  29,    2,  -31 },   // 0x43 'C'
+  {  3686,  33,  31,  33,    0,  -30 },   // 0x44 'D'
+  {  3833,  29,  31,  27,    0,  -30 },   // 0x45 'E'
+  {  3966,  29,  31,  27,    0,  -30 },   // 0x46 'F'
+  {  4089,  31,  33,  32,    2,  -31 },   // 0x47 'G'
+  {  4236,  36,  31,  33,    0,  -30 },   // 0x48 'H'
+  {  4387,  18,  31,  15,    0,  -30 },   // 0x49 'I'
+  {  4480,  23,  32,  20,    0,  -30 },   // 0x4A 'J'
+  {  4584,  33,  31,  30,    0,  -30 },   // 0x4B 'K'
+  {  4735,  27,  31,  27,    0,  -30 },   // 0x4C 'L'
+  {  4842,  42,  31,  39,    0,  -30 },   // 0x4D 'M'
+  {  5081,  35,  32,  32,    0,  -30 },   // 0x4E 'N'
+  {  5275,  30,  33,  31,    2,  -31 },   // 0x4F 'O'
+  {  5432,  29,  31,  27,    0,  -30 },   // 0x50 'P'
+  {  5553,  30,  41,  31,    2,  -31 },   // 0x51 'Q'
+  {  5744,  28,  31,  29,    0,  -30 },   // 0x52 'R'
+  {  5891,  23,  33,  21,    0,  -31 },   // 0x53 'S'
+  {  6030,  27,  31,  28,    4,  -30 },   // 0x54 'T'
+  {  6147,  31,  32,  33,    5,  -30 },   // 0x55 'U'
+  {  6303,  29,  32,  31,    6,  -30 },   // 0x56 'V'
+  {  6447,  39,  32,  42,    6,  -30 },   // 0x57 'W'
+  {  6673,  32,  31,  31,    0,  -30 },   // 0x58 'X'
+  {  6814,  26,  31,  28,    5,  -30 },   // 0x59 'Y'
+  {  6935,  29,  31,  26,    0,  -30 },   // 0x5A 'Z'
+  {  7050,  17,  39,  18,    1,  -31 },   // 0x5B '['
+  {  7167,  17,  33,  23,    5,  -31 },   // 0x5C '\'
+  {  7266,  17,  39,  18,    1,  -31 },   // 0x5D ']'
+  {  7383,  20,  17,  20,    0,  -31 },   // 0x5E '^'
+  {  7460,  24,   2,  23,    0,    5 },   // 0x5F '_'
+  {  7466,   8,   8,  12,    6,  -31 },   // 0x60 '`'
+  {  7490,  21,  21,  23,    1,  -20 },   // 0x61 'a'
+  {  7611,  21,  33,  22,    1,  -31 },   // 0x62 'b'
+  {  7760,  18,  22,  19,    1,  -20 },   // 0x63 'c'
+  {  7842,  24,  33,  23,    1,  -31 },   // 0x64 'd'
+  {  8001,  18,  22,  19,    1,  -20 },   // 0x65 'e'
+  {  8095,  27,  42,  20,   -4,  -31 },   // 0x66 'f'
+  {  8233,  21,  31,  21,   -1,  -20 },   // 0x67 'g'
+  {  8370,  21,  32,  23,    1,  -31 },   // 0x68 'h'
+  {  8528,  10,  32,  12,    2,  -30 },   // 0x69 'i'
+  {  8620,  19,  41,  13,   -3,  -30 },   // 0x6A 'j'
+  {  8739,  21,  33,  21,    1,  -31 },   // 0x6B 'k'
+  {  8880,  11,  33,  12,    2,  -31 },   // 0x6C 'l'
+  {  8987,  31,  21,  34,    1,  -20 },   // 0x6D 'm'
+  {  9166,  21,  21,  23,    1,  -20 },   // 0x6E 'n'
+  {  9293,  21,  22,  22,    1,  -20 },   // 0x6F 'o'
+  {  9399,  27,  31,  22,   -4,  -20 },   // 0x70 'p'
+  {  9542,  21,  31,  23,    1,  -20 },   // 0x71 'q'
+  {  9691,  17,  21,  17,    1,  -20 },   // 0x72 'r'
+  {  9774,  17,  22,  16,    0,  -20 },   // 0x73 's'
+  {  9870,  12,  26,  11,    1,  -24 },   // 0x74 't'
+  {  9956,  20,  22,  23,    1,  -20 },   // 0x75 'u'
+  { 10086,  18,  22,  21,    3,  -20 },   // 0x76 'v'
+  { 10186,  30,  22,  32,    2,  -20 },   // 0x77 'w'
+  { 10346,  22,  22,  20,   -1,  -20 },   // 0x78 'x'
+  { 10456,  21,  31,  22,    1,  -20 },   // 0x79 'y'
+  { 10585,  17,  24,  18,    0,  -19 },   // 0x7A 'z'
+  { 10673,  17,  40,  19,    2,  -31 },   // 0x7B '{'
+  { 10793,   3,  33,  13,    5,  -31 },   // 0x7C '|'
+  { 10892,  16,  41,  19,    0,  -32 },   // 0x7D '}'
+  { 11015,  22,   6,  25,    2,  -14 } }; // 0x7E '~'
+
+const GFXfontSpans FreeSerifItalic24pt7bSpans PROGMEM = {
+  { (uint8_t  *)FreeSerifItalic24pt7bSpanData,
+    (GFXglyph *)FreeSerifItalic24pt7bSpanGlyphs,
+    0x20, 0x7E, 56 } };
+
+// Approx. 11825 bytes
@@ -25,6 +25,31 @@ typedef struct { // Data stored for FONT AS A WHOLE:
 	uint8_t   yAdvance;    // Newline distance (y axis)
 } GFXfont;
 
+typedef struct { // Run of consecutive code points in a GFXfontEx
+	uint16_t first, last;  // Code point extents, inclusive
+	uint16_t glyph;        // Index of the glyph of first in the glyph array
+} GFXrange;
+
+typedef struct { // Font with sparse 16 bit code points, text is decoded as UTF-8
+	GFXfont   font;        // first and last are 0xFF and 0x00, the ranges below hold the codes
+	GFXrange *range;       // Sorted by first, ranges must not overlap
+	uint16_t  ranges;      // Number of ranges
+} GFXfontEx;
+
+// Initialiser of a GFXfontEx, e.g.
+//   const GFXfontEx myFont PROGMEM = GFXFONT_EX(myBitmaps, myGlyphs, 24, myRanges);
+#define GFXFONT_EX(bitmap, glyph, yAdvance, range) \
+	{ { (uint8_t *)(bitmap), (GFXglyph *)(glyph), 0xFF, 0x00, (yAdvance) }, \
+	  (GFXrange *)(range), (uint16_t)(sizeof(range) / sizeof(GFXrange)) }
+
+typedef struct { // Font with glyph rows stored as runs, made by Tools/GFX_spans
+	GFXfont   font;        // bitmap holds per row the run count, then left column and length of each run
+} GFXfontSpans;
+
+typedef struct { // Font with glyph bitmaps packed as run lengths, made by Tools/GFX_pack
+	GFXfont   font;        // bitmap holds alternating background and foreground runs, a nibble each
+} GFXfontPacked;
+
 #endif // LOAD_GFXFF
 
 #endif // _GFXFONT_H_
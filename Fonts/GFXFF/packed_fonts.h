@@ -0,0 +1,37 @@
+// Free fonts packed as run lengths, generated by Tools/GFX_pack
+// Select one with setFreeFontPacked(&<font>Packed), e.g. &FreeSans24pt7bPacked
+
+#include <Fonts/GFXFF/FreeMono18pt7b_packed.h>
+#include <Fonts/GFXFF/FreeMono24pt7b_packed.h>
+#include <Fonts/GFXFF/FreeMonoOblique18pt7b_packed.h>
+#include <Fonts/GFXFF/FreeMonoOblique24pt7b_packed.h>
+#include <Fonts/GFXFF/FreeMonoBold12pt7b_packed.h>
+#include <Fonts/GFXFF/FreeMonoBold18pt7b_packed.h>
+#include <Fonts/GFXFF/FreeMonoBold24pt7b_packed.h>
+#include <Fonts/GFXFF/FreeMonoBoldOblique12pt7b_packed.h>
+#include <Fonts/GFXFF/FreeMonoBoldOblique18pt7b_packed.h>
+#include <Fonts/GFXFF/FreeMonoBoldOblique24pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSans12pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSans18pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSans24pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSansOblique12pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSansOblique18pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSansOblique24pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSansBold12pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSansBold18pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSansBold24pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSansBoldOblique12pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSansBoldOblique18pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSansBoldOblique24pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSerif18pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSerif24pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSerifItalic18pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSerifItalic24pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSerifBold18pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSerifBold24pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSerifBoldItalic12pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSerifBoldItalic18pt7b_packed.h>
+#include <Fonts/GFXFF/FreeSerifBoldItalic24pt7b_packed.h>
+#include <Fonts/Custom/Orbitron_Light_24_packed.h>
+#include <Fonts/Custom/Orbitron_Light_32_packed.h>
+#include <Fonts/Custom/Yellowtail_32_packed.h>
@@ -0,0 +1,269 @@
+// GLCD font as rows, generated by Tools/GLCD_rows from glcdfont.c
+//
+// 8 bytes per character, one per row from the top, the MSB is the left pixel
+
+#ifndef FONT5X7_ROWS_H
+#define FONT5X7_ROWS_H
+
+#include <pgmspace.h>
+
+static const unsigned char font_rows[] PROGMEM = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // char 0
+	0x70, 0xF8, 0xA8, 0xF8, 0xD8, 0x88, 0x70, 0x00,    // char 1
+	0x70, 0xF8, 0xA8, 0xF8, 0x88, 0xD8, 0x70, 0x00,    // char 2
+	0x00, 0x50, 0xF8, 0xF8, 0xF8, 0x70, 0x20, 0x00,    // char 3
+	0x00, 0x20, 0x70, 0xF8, 0xF8, 0x70, 0x20, 0x00,    // char 4
+	0x70, 0x50, 0xF8, 0xA8, 0xF8, 0x20, 0x70, 0x00,    // char 5
+	0x20, 0x70, 0xF8, 0xF8, 0xF8, 0x20, 0x70, 0x00,    // char 6
+	0x00, 0x00, 0x20, 0x70, 0x70, 0x20, 0x00, 0x00,    // char 7
+	0xF8, 0xF8, 0xD8, 0x88, 0x88, 0xD8, 0xF8, 0xF8,    // char 8
+	0x00, 0x00, 0x20, 0x50, 0x50, 0x20, 0x00, 0x00,    // char 9
+	0xF8, 0xF8, 0xD8, 0xA8, 0xA8, 0xD8, 0xF8, 0xF8,    // char 10
+	0x00, 0x38, 0x18, 0x68, 0xA0, 0xA0, 0x40, 0x00,    // char 11
+	0x70, 0x88, 0x88, 0x70, 0x20, 0xF8, 0x20, 0x00,    // char 12
+	0x78, 0x48, 0x78, 0x40, 0x40, 0x40, 0xC0, 0x00,    // char 13
+	0x78, 0x48, 0x78, 0x48, 0x48, 0x58, 0xC0, 0x00,    // char 14
+	0x20, 0xA8, 0x70, 0xD8, 0xD8, 0x70, 0xA8, 0x20,    // char 15
+	0x80, 0xC0, 0xF0, 0xF8, 0xF0, 0xC0, 0x80, 0x00,    // char 16
+	0x08, 0x18, 0x78, 0xF8, 0x78, 0x18, 0x08, 0x00,    // char 17
+	0x20, 0x70, 0xA8, 0x20, 0xA8, 0x70, 0x20, 0x00,    // char 18
+	0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0x00, 0xD8, 0x00,    // char 19
+	0x78, 0xA8, 0xA8, 0x68, 0x28, 0x28, 0x28, 0x00,    // char 20
+	0x30, 0x48, 0x50, 0x28, 0x10, 0x48, 0x48, 0x30,    // char 21
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00,    // char 22
+	0x20, 0x70, 0xA8, 0x20, 0xA8, 0x70, 0x20, 0xF8,    // char 23
+	0x00, 0x20, 0x70, 0xA8, 0x20, 0x20, 0x20, 0x00,    // char 24
+	0x00, 0x20, 0x20, 0x20, 0xA8, 0x70, 0x20, 0x00,    // char 25
+	0x00, 0x20, 0x10, 0xF8, 0x10, 0x20, 0x00, 0x00,    // char 26
+	0x00, 0x20, 0x40, 0xF8, 0x40, 0x20, 0x00, 0x00,    // char 27
+	0x00, 0x80, 0x80, 0x80, 0xF8, 0x00, 0x00, 0x00,    // char 28
+	0x00, 0x50, 0xF8, 0xF8, 0x50, 0x00, 0x00, 0x00,    // char 29
+	0x00, 0x20, 0x20, 0x70, 0xF8, 0xF8, 0x00, 0x00,    // char 30
+	0x00, 0xF8, 0xF8, 0x70, 0x20, 0x20, 0x00, 0x00,    // char 31
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // char 32
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00,    // char 33
+	0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,    // char 34
+	0x50, 0x50, 0xF8, 0x50, 0xF8, 0x50, 0x50, 0x00,    // char 35
+	0x20, 0x78, 0xA0, 0x70, 0x28, 0xF0, 0x20, 0x00,    // char 36
+	0xC0, 0xC8, 0x10, 0x20, 0x40, 0x98, 0x18, 0x00,    // char 37
+	0x40, 0xA0, 0xA0, 0x40, 0xA8, 0x90, 0x68, 0x00,    // char 38
+	0x30, 0x30, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00,    // char 39
+	0x10, 0x20, 0x40, 0x40, 0x40, 0x20, 0x10, 0x00,    // char 40
+	0x40, 0x20, 0x10, 0x10, 0x10, 0x20, 0x40, 0x00,    // char 41
+	0x20, 0xA8, 0x70, 0xF8, 0x70, 0xA8, 0x20, 0x00,    // char 42
+	0x00, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x00, 0x00,    // char 43
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x20, 0x40,    // char 44
+	0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,    // char 45
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00,    // char 46
+	0x00, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00,    // char 47
+	0x70, 0x88, 0x98, 0xA8, 0xC8, 0x88, 0x70, 0x00,    // char 48
+	0x20, 0x60, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00,    // char 49
+	0x70, 0x88, 0x08, 0x70, 0x80, 0x80, 0xF8, 0x00,    // char 50
+	0xF8, 0x08, 0x10, 0x30, 0x08, 0x88, 0x70, 0x00,    // char 51
+	0x10, 0x30, 0x50, 0x90, 0xF8, 0x10, 0x10, 0x00,    // char 52
+	0xF8, 0x80, 0xF0, 0x08, 0x08, 0x88, 0x70, 0x00,    // char 53
+	0x38, 0x40, 0x80, 0xF0, 0x88, 0x88, 0x70, 0x00,    // char 54
+	0xF8, 0x08, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00,    // char 55
+	0x70, 0x88, 0x88, 0x70, 0x88, 0x88, 0x70, 0x00,    // char 56
+	0x70, 0x88, 0x88, 0x78, 0x08, 0x10, 0xE0, 0x00,    // char 57
+	0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,    // char 58
+	0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x40, 0x00,    // char 59
+	0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x00,    // char 60
+	0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00,    // char 61
+	0x40, 0x20, 0x10, 0x08, 0x10, 0x20, 0x40, 0x00,    // char 62
+	0x70, 0x88, 0x08, 0x30, 0x20, 0x00, 0x20, 0x00,    // char 63
+	0x70, 0x88, 0xA8, 0xB8, 0xB0, 0x80, 0x78, 0x00,    // char 64
+	0x20, 0x50, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x00,    // char 65
+	0xF0, 0x88, 0x88, 0xF0, 0x88, 0x88, 0xF0, 0x00,    // char 66
+	0x70, 0x88, 0x80, 0x80, 0x80, 0x88, 0x70, 0x00,    // char 67
+	0xF0, 0x88, 0x88, 0x88, 0x88, 0x88, 0xF0, 0x00,    // char 68
+	0xF8, 0x80, 0x80, 0xF0, 0x80, 0x80, 0xF8, 0x00,    // char 69
+	0xF8, 0x80, 0x80, 0xF0, 0x80, 0x80, 0x80, 0x00,    // char 70
+	0x78, 0x88, 0x80, 0x80, 0x98, 0x88, 0x78, 0x00,    // char 71
+	0x88, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x88, 0x00,    // char 72
+	0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00,    // char 73
+	0x38, 0x10, 0x10, 0x10, 0x10, 0x90, 0x60, 0x00,    // char 74
+	0x88, 0x90, 0xA0, 0xC0, 0xA0, 0x90, 0x88, 0x00,    // char 75
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0x00,    // char 76
+	0x88, 0xD8, 0xA8, 0xA8, 0xA8, 0x88, 0x88, 0x00,    // char 77
+	0x88, 0x88, 0xC8, 0xA8, 0x98, 0x88, 0x88, 0x00,    // char 78
+	0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00,    // char 79
+	0xF0, 0x88, 0x88, 0xF0, 0x80, 0x80, 0x80, 0x00,    // char 80
+	0x70, 0x88, 0x88, 0x88, 0xA8, 0x90, 0x68, 0x00,    // char 81
+	0xF0, 0x88, 0x88, 0xF0, 0xA0, 0x90, 0x88, 0x00,    // char 82
+	0x70, 0x88, 0x80, 0x70, 0x08, 0x88, 0x70, 0x00,    // char 83
+	0xF8, 0xA8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,    // char 84
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00,    // char 85
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00,    // char 86
+	0x88, 0x88, 0x88, 0xA8, 0xA8, 0xA8, 0x50, 0x00,    // char 87
+	0x88, 0x88, 0x50, 0x20, 0x50, 0x88, 0x88, 0x00,    // char 88
+	0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x20, 0x00,    // char 89
+	0xF8, 0x08, 0x10, 0x70, 0x40, 0x80, 0xF8, 0x00,    // char 90
+	0x78, 0x40, 0x40, 0x40, 0x40, 0x40, 0x78, 0x00,    // char 91
+	0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00,    // char 92
+	0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x00,    // char 93
+	0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,    // char 94
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,    // char 95
+	0x60, 0x60, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00,    // char 96
+	0x00, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,    // char 97
+	0x80, 0x80, 0xB0, 0xC8, 0x88, 0xC8, 0xB0, 0x00,    // char 98
+	0x00, 0x00, 0x70, 0x88, 0x80, 0x88, 0x70, 0x00,    // char 99
+	0x08, 0x08, 0x68, 0x98, 0x88, 0x98, 0x68, 0x00,    // char 100
+	0x00, 0x00, 0x70, 0x88, 0xF8, 0x80, 0x70, 0x00,    // char 101
+	0x10, 0x28, 0x20, 0x70, 0x20, 0x20, 0x20, 0x00,    // char 102
+	0x00, 0x00, 0x70, 0x98, 0x98, 0x68, 0x08, 0x70,    // char 103
+	0x80, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x00,    // char 104
+	0x20, 0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00,    // char 105
+	0x10, 0x00, 0x10, 0x10, 0x10, 0x90, 0x60, 0x00,    // char 106
+	0x80, 0x80, 0x90, 0xA0, 0xC0, 0xA0, 0x90, 0x00,    // char 107
+	0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00,    // char 108
+	0x00, 0x00, 0xD0, 0xA8, 0xA8, 0xA8, 0xA8, 0x00,    // char 109
+	0x00, 0x00, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x00,    // char 110
+	0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00,    // char 111
+	0x00, 0x00, 0xB0, 0xC8, 0xC8, 0xB0, 0x80, 0x80,    // char 112
+	0x00, 0x00, 0x68, 0x98, 0x98, 0x68, 0x08, 0x08,    // char 113
+	0x00, 0x00, 0xB0, 0xC8, 0x80, 0x80, 0x80, 0x00,    // char 114
+	0x00, 0x00, 0x78, 0x80, 0x70, 0x08, 0xF0, 0x00,    // char 115
+	0x20, 0x20, 0xF8, 0x20, 0x20, 0x28, 0x10, 0x00,    // char 116
+	0x00, 0x00, 0x88, 0x88, 0x88, 0x98, 0x68, 0x00,    // char 117
+	0x00, 0x00, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00,    // char 118
+	0x00, 0x00, 0x88, 0x88, 0xA8, 0xA8, 0x50, 0x00,    // char 119
+	0x00, 0x00, 0x88, 0x50, 0x20, 0x50, 0x88, 0x00,    // char 120
+	0x00, 0x00, 0x88, 0x88, 0x78, 0x08, 0x88, 0x70,    // char 121
+	0x00, 0x00, 0xF8, 0x10, 0x20, 0x40, 0xF8, 0x00,    // char 122
+	0x10, 0x20, 0x20, 0x40, 0x20, 0x20, 0x10, 0x00,    // char 123
+	0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x00,    // char 124
+	0x40, 0x20, 0x20, 0x10, 0x20, 0x20, 0x40, 0x00,    // char 125
+	0x40, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,    // char 126
+	0x20, 0x70, 0xD8, 0x88, 0x88, 0xF8, 0x00, 0x00,    // char 127
+	0x70, 0x88, 0x80, 0x80, 0x88, 0x70, 0x10, 0x60,    // char 128
+	0x00, 0x88, 0x00, 0x88, 0x88, 0x98, 0x68, 0x00,    // char 129
+	0x18, 0x00, 0x70, 0x88, 0xF8, 0x80, 0x78, 0x00,    // char 130
+	0xF8, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,    // char 131
+	0x88, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,    // char 132
+	0xC0, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,    // char 133
+	0x30, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,    // char 134
+	0x00, 0x78, 0xC0, 0xC0, 0x78, 0x10, 0x30, 0x00,    // char 135
+	0xF8, 0x00, 0x70, 0x88, 0xF8, 0x80, 0x78, 0x00,    // char 136
+	0x88, 0x00, 0x70, 0x88, 0xF8, 0x80, 0x78, 0x00,    // char 137
+	0xC0, 0x00, 0x70, 0x88, 0xF8, 0x80, 0x78, 0x00,    // char 138
+	0x28, 0x00, 0x30, 0x10, 0x10, 0x10, 0x38, 0x00,    // char 139
+	0x30, 0x48, 0x30, 0x10, 0x10, 0x10, 0x38, 0x00,    // char 140
+	0x60, 0x00, 0x30, 0x10, 0x10, 0x10, 0x38, 0x00,    // char 141
+	0x50, 0x00, 0x20, 0x50, 0x88, 0xF8, 0x88, 0x88,    // char 142
+	0x20, 0x00, 0x20, 0x50, 0x88, 0xF8, 0x88, 0x88,    // char 143
+	0x30, 0x00, 0xF0, 0x80, 0xE0, 0x80, 0xF0, 0x00,    // char 144
+	0x00, 0x00, 0x78, 0x10, 0x78, 0x90, 0x78, 0x00,    // char 145
+	0x38, 0x50, 0x90, 0xF8, 0x90, 0x90, 0x98, 0x00,    // char 146
+	0x70, 0x88, 0x00, 0x70, 0x88, 0x88, 0x70, 0x00,    // char 147
+	0x00, 0x88, 0x00, 0x70, 0x88, 0x88, 0x70, 0x00,    // char 148
+	0x00, 0xC0, 0x00, 0x70, 0x88, 0x88, 0x70, 0x00,    // char 149
+	0x70, 0x88, 0x00, 0x88, 0x88, 0x98, 0x68, 0x00,    // char 150
+	0x00, 0xC0, 0x00, 0x88, 0x88, 0x98, 0x68, 0x00,    // char 151
+	0x48, 0x00, 0x48, 0x48, 0x48, 0x38, 0x08, 0x70,    // char 152
+	0x88, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00,    // char 153
+	0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00,    // char 154
+	0x20, 0x20, 0xF8, 0xA0, 0xA0, 0xF8, 0x20, 0x20,    // char 155
+	0x30, 0x58, 0x48, 0xE0, 0x40, 0x48, 0xF8, 0x00,    // char 156
+	0xD8, 0xD8, 0x70, 0xF8, 0x20, 0xF8, 0x20, 0x20,    // char 157
+	0xE0, 0x90, 0x90, 0xE0, 0x90, 0xB8, 0x90, 0x90,    // char 158
+	0x18, 0x28, 0x20, 0x70, 0x20, 0x20, 0xA0, 0xC0,    // char 159
+	0x18, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,    // char 160
+	0x18, 0x00, 0x30, 0x10, 0x10, 0x10, 0x38, 0x00,    // char 161
+	0x00, 0x18, 0x00, 0x70, 0x88, 0x88, 0x70, 0x00,    // char 162
+	0x00, 0x18, 0x00, 0x88, 0x88, 0x98, 0x68, 0x00,    // char 163
+	0x00, 0x78, 0x00, 0x70, 0x48, 0x48, 0x48, 0x00,    // char 164
+	0xF8, 0x00, 0xC8, 0xE8, 0xB8, 0x98, 0x88, 0x00,    // char 165
+	0x70, 0x90, 0x90, 0x78, 0x00, 0xF8, 0x00, 0x00,    // char 166
+	0x70, 0x88, 0x88, 0x70, 0x00, 0xF8, 0x00, 0x00,    // char 167
+	0x20, 0x00, 0x20, 0x60, 0x80, 0x88, 0x70, 0x00,    // char 168
+	0x00, 0x00, 0x00, 0xF8, 0x80, 0x80, 0x00, 0x00,    // char 169
+	0x00, 0x00, 0x00, 0xF8, 0x08, 0x08, 0x00, 0x00,    // char 170
+	0x80, 0x88, 0x90, 0xB8, 0x48, 0x98, 0x20, 0x38,    // char 171
+	0x80, 0x88, 0x90, 0xA8, 0x58, 0xB8, 0x08, 0x08,    // char 172
+	0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00,    // char 173
+	0x00, 0x28, 0x50, 0xA0, 0x50, 0x28, 0x00, 0x00,    // char 174
+	0x00, 0xA0, 0x50, 0x28, 0x50, 0xA0, 0x00, 0x00,    // char 175
+	0x20, 0x88, 0x20, 0x88, 0x20, 0x88, 0x20, 0x88,    // char 176
+	0x50, 0xA8, 0x50, 0xA8, 0x50, 0xA8, 0x50, 0xA8,    // char 177
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,    // char 178
+	0x10, 0x10, 0x10, 0x10, 0xF0, 0x10, 0x10, 0x10,    // char 179
+	0x10, 0x10, 0xF0, 0x10, 0xF0, 0x10, 0x10, 0x10,    // char 180
+	0x28, 0x28, 0x28, 0x28, 0xE8, 0x28, 0x28, 0x28,    // char 181
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0x28, 0x28, 0x28,    // char 182
+	0x00, 0x00, 0xF0, 0x10, 0xF0, 0x10, 0x10, 0x10,    // char 183
+	0x28, 0x28, 0xE8, 0x08, 0xE8, 0x28, 0x28, 0x28,    // char 184
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,    // char 185
+	0x00, 0x00, 0xF8, 0x08, 0xE8, 0x28, 0x28, 0x28,    // char 186
+	0x28, 0x28, 0xE8, 0x08, 0xF8, 0x00, 0x00, 0x00,    // char 187
+	0x28, 0x28, 0x28, 0x28, 0xF8, 0x00, 0x00, 0x00,    // char 188
+	0x10, 0x10, 0xF0, 0x10, 0xF0, 0x00, 0x00, 0x00,    // char 189
+	0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x10, 0x10,    // char 190
+	0x10, 0x10, 0x10, 0x10, 0x18, 0x00, 0x00, 0x00,    // char 191
+	0x10, 0x10, 0x10, 0x10, 0xF8, 0x00, 0x00, 0x00,    // char 192
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0x10, 0x10, 0x10,    // char 193
+	0x10, 0x10, 0x10, 0x10, 0x18, 0x10, 0x10, 0x10,    // char 194
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,    // char 195
+	0x10, 0x10, 0x10, 0x10, 0xF8, 0x10, 0x10, 0x10,    // char 196
+	0x10, 0x10, 0x18, 0x10, 0x18, 0x10, 0x10, 0x10,    // char 197
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,    // char 198
+	0x28, 0x28, 0x28, 0x20, 0x38, 0x00, 0x00, 0x00,    // char 199
+	0x00, 0x00, 0x38, 0x20, 0x28, 0x28, 0x28, 0x28,    // char 200
+	0x28, 0x28, 0xE8, 0x00, 0xF8, 0x00, 0x00, 0x00,    // char 201
+	0x00, 0x00, 0xF8, 0x00, 0xE8, 0x28, 0x28, 0x28,    // char 202
+	0x28, 0x28, 0x28, 0x20, 0x28, 0x28, 0x28, 0x28,    // char 203
+	0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00,    // char 204
+	0x28, 0x28, 0xE8, 0x00, 0xE8, 0x28, 0x28, 0x28,    // char 205
+	0x10, 0x10, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00,    // char 206
+	0x28, 0x28, 0x28, 0x28, 0xF8, 0x00, 0x00, 0x00,    // char 207
+	0x00, 0x00, 0xF8, 0x00, 0xF8, 0x10, 0x10, 0x10,    // char 208
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0x28, 0x28, 0x28,    // char 209
+	0x28, 0x28, 0x28, 0x28, 0x38, 0x00, 0x00, 0x00,    // char 210
+	0x10, 0x10, 0x18, 0x10, 0x18, 0x00, 0x00, 0x00,    // char 211
+	0x00, 0x00, 0x18, 0x10, 0x18, 0x10, 0x10, 0x10,    // char 212
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x28, 0x28, 0x28,    // char 213
+	0x28, 0x28, 0x28, 0x28, 0xF8, 0x28, 0x28, 0x28,    // char 214
+	0x10, 0x10, 0xF8, 0x10, 0xF8, 0x10, 0x10, 0x10,    // char 215
+	0x10, 0x10, 0x10, 0x10, 0xF0, 0x00, 0x00, 0x00,    // char 216
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x10, 0x10, 0x10,    // char 217
+	0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,    // char 218
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8,    // char 219
+	0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,    // char 220
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,    // char 221
+	0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00,    // char 222
+	0x00, 0x00, 0x68, 0x90, 0x90, 0x90, 0x68, 0x00,    // char 223
+	0x00, 0x70, 0x98, 0xF0, 0x98, 0xF0, 0x80, 0x00,    // char 224
+	0x00, 0xF8, 0x98, 0x80, 0x80, 0x80, 0x80, 0x00,    // char 225
+	0x00, 0xF8, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00,    // char 226
+	0xF8, 0x88, 0x40, 0x20, 0x40, 0x88, 0xF8, 0x00,    // char 227
+	0x00, 0x00, 0x78, 0x90, 0x90, 0x90, 0x60, 0x00,    // char 228
+	0x00, 0x50, 0x50, 0x50, 0x50, 0x68, 0xC0, 0x00,    // char 229
+	0x00, 0xF8, 0xA0, 0x20, 0x20, 0x20, 0x20, 0x00,    // char 230
+	0xF8, 0x20, 0x70, 0x88, 0x88, 0x70, 0x20, 0xF8,    // char 231
+	0x20, 0x50, 0x88, 0xF8, 0x88, 0x50, 0x20, 0x00,    // char 232
+	0x20, 0x50, 0x88, 0x88, 0x50, 0x50, 0xD8, 0x00,    // char 233
+	0x30, 0x40, 0x30, 0x70, 0x88, 0x88, 0x70, 0x00,    // char 234
+	0x00, 0x00, 0x00, 0x70, 0xA8, 0xA8, 0x70, 0x00,    // char 235
+	0x08, 0x70, 0x98, 0xA8, 0xA8, 0xC8, 0x70, 0x80,    // char 236
+	0x70, 0x80, 0x80, 0xF0, 0x80, 0x80, 0x70, 0x00,    // char 237
+	0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00,    // char 238
+	0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00,    // char 239
+	0x20, 0x20, 0xF8, 0x20, 0x20, 0x00, 0xF8, 0x00,    // char 240
+	0x40, 0x20, 0x10, 0x20, 0x40, 0x00, 0xF8, 0x00,    // char 241
+	0x10, 0x20, 0x40, 0x20, 0x10, 0x00, 0xF8, 0x00,    // char 242
+	0x38, 0x28, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,    // char 243
+	0x20, 0x20, 0x20, 0x20, 0x20, 0xA0, 0xA0, 0xE0,    // char 244
+	0x30, 0x30, 0x00, 0xF8, 0x00, 0x30, 0x30, 0x00,    // char 245
+	0x00, 0xE8, 0xB8, 0x00, 0xE8, 0xB8, 0x00, 0x00,    // char 246
+	0x70, 0xD8, 0xD8, 0x70, 0x00, 0x00, 0x00, 0x00,    // char 247
+	0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00,    // char 248
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,    // char 249
+	0x38, 0x20, 0x20, 0x20, 0xA0, 0xA0, 0x60, 0x20,    // char 250
+	0x70, 0x48, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00,    // char 251
+	0x70, 0x18, 0x30, 0x60, 0x78, 0x00, 0x00, 0x00,    // char 252
+	0x00, 0x00, 0x78, 0x78, 0x78, 0x78, 0x00, 0x00,    // char 253
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // char 254
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // char 255
+};
+
+#endif // FONT5X7_ROWS_H
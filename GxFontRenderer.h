@@ -0,0 +1,1278 @@
+// GxFont_GFX_TFT_eSPI : font rendering graphics library
+// extracted and adapted by Jean-Marc Zingg for use with GxEPD and GxEPD2
+// code based on https://github.com/Bodmer/TFT_eSPI
+
+// The glyph renderers, written against a Sink so the same code serves the virtual
+// GxFont_GFX_TFT_eSPI class and the GxFontRenderer<Derived> template. A Sink provides:
+//   void pixel(int32_t x, int32_t y, uint32_t color);
+//   void rect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+//   void span(uint8_t buf, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+//   void flush(void);
+//   bool bitmap(int32_t x, int32_t y, int32_t w, int32_t h, int32_t rowBytes,
+//               const uint8_t* data, uint32_t fg, uint32_t bg, bool opaque);
+// with the meaning of sinkPixel(), sinkRect(), addSpan(), flushSpans() and sinkBitmap().
+
+#ifndef _GxFontRenderer_H_
+#define _GxFontRenderer_H_
+
+//#define DIAG(x) x
+
+#ifndef DIAG
+#define DIAG(x)
+#endif
+
+#ifdef RENDER_STATS
+#define STATS(x) x
+#else
+#define STATS(x)
+#endif
+
+// Leading zero bits of a non zero 32 bit value. __builtin_clz() counts in an unsigned int,
+// which is 16 bits on AVR, so count in an unsigned long, which is at least 32 bits everywhere.
+static inline int leadingZeros32(uint32_t v)
+{
+  return __builtin_clzl(v) - (8 * sizeof(unsigned long) - 32);
+}
+
+
+/***************************************************************************************
+** Class name:              GxFontRenderer
+** Description:             GxFont_GFX_TFT_eSPI with the drawing calls of drawChar() inlined
+***************************************************************************************/
+// Derive the display class as  class MyDisplay : public GxFontRenderer<MyDisplay>  and
+// implement the public drawPixel(), drawFastHLine() and fillRect() as for the base class.
+// drawChar(), and with it drawString() and print(), then calls these directly instead of
+// through the virtual table, so the compiler can inline them into the glyph loops.
+// Runs are drawn as they are decoded, drawSpans() is not used by these paths.
+template <class Derived>
+class GxFontRenderer : public GxFont_GFX_TFT_eSPI
+{
+  public:
+    GxFontRenderer(int16_t _W, int16_t _H) : GxFont_GFX_TFT_eSPI(_W, _H) {}
+
+    using GxFont_GFX_TFT_eSPI::drawChar;
+
+    void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size)
+    {
+      InlineSink sink = { static_cast<Derived*>(this) };
+      renderChar(sink, x, y, c, color, bg, size);
+    }
+
+    int16_t drawChar(unsigned int uniCode, int x, int y, int font)
+    {
+      InlineSink sink = { static_cast<Derived*>(this) };
+      return renderChar(sink, uniCode, x, y, font);
+    }
+
+  protected:
+
+    // Qualified calls to the Derived functions are resolved at compile time
+    struct InlineSink {
+      Derived *gfx;
+
+      void pixel(int32_t x, int32_t y, uint32_t color)
+      {
+        if ((x < gfx->clipX0) || (x >= gfx->clipX1) || (y < gfx->clipY0) || (y >= gfx->clipY1)) return;
+        STATS(gfx->countCall(&gfx->renderStats.drawPixel, 1, color);)
+        gfx->Derived::drawPixel(x, y, color);
+      }
+
+      void rect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+      {
+        if (!gfx->clipBox(x, y, w, h)) return;
+        STATS(gfx->countCall(&gfx->renderStats.fillRect, w * h, color);)
+        gfx->Derived::fillRect(x, y, w, h, color);
+      }
+
+      void span(uint8_t /*buf*/, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+      {
+        if (!gfx->clipBox(x, y, w, h)) return;
+        STATS(gfx->renderStats.spans++; gfx->countCall(h == 1 ? &gfx->renderStats.drawFastHLine : &gfx->renderStats.fillRect, w * h, color);)
+        if (h == 1) gfx->Derived::drawFastHLine(x, y, w, color);
+        else gfx->Derived::fillRect(x, y, w, h, color);
+      }
+
+      void flush(void) {}
+
+      bool bitmap(int32_t x, int32_t y, int32_t w, int32_t h, int32_t rowBytes,
+                  const uint8_t* data, uint32_t fg, uint32_t bg, bool opaque)
+      {
+        return gfx->sinkBitmap(x, y, w, h, rowBytes, data, fg, bg, opaque);
+      }
+    };
+};
+
+
+/***************************************************************************************
+** Class name:              RowMerger
+** Description:             Sink stage of the scaled renderers that merges identical rows
+***************************************************************************************/
+// The runs of a glyph row are held back until the next row starts. If the next row has
+// the same runs at the same columns the held rows grow by its height instead, so e.g. a
+// vertical stem is passed on as one tall span instead of one span per source row.
+// Rows with more than SPAN_BUFFER_SIZE runs per colour are passed on unmerged.
+template <class Sink>
+struct GxFont_GFX_TFT_eSPI::RowMerger
+{
+  GxFont_GFX_TFT_eSPI *gfx;
+  Sink    &sink;
+  int32_t  y[2], h[2];                      // Rows held [0] and row being collected [1]
+  uint8_t  n[2][2];                         // Runs per row and span buffer
+  uint32_t color[2][2];
+  int16_t  run[2][2][SPAN_BUFFER_SIZE][2];  // Column and width of each run
+
+  RowMerger(GxFont_GFX_TFT_eSPI *g, Sink& s) : gfx(g), sink(s)
+  {
+    memset(n, 0, sizeof(n));
+  }
+
+  void pixel(int32_t x, int32_t y, uint32_t color)
+  {
+    release();
+    sink.pixel(x, y, color);
+  }
+
+  void rect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+  {
+    release();
+    sink.rect(x, y, w, h, color);
+  }
+
+  void span(uint8_t buf, int32_t x, int32_t sy, int32_t w, int32_t sh, uint32_t c)
+  {
+    if ((n[1][0] || n[1][1]) &&
+        ((sy != y[1]) || (sh != h[1]) || (n[1][buf] && (c != color[1][buf])) || (n[1][buf] == SPAN_BUFFER_SIZE)))
+      endRow();
+    if (!n[1][0] && !n[1][1])
+    {
+      y[1] = sy;
+      h[1] = sh;
+    }
+    uint8_t i = n[1][buf]++;
+    run[1][buf][i][0] = x;
+    run[1][buf][i][1] = w;
+    color[1][buf] = c;
+  }
+
+  void flush(void)
+  {
+    release();
+    sink.flush();
+  }
+
+  bool bitmap(int32_t x, int32_t y, int32_t w, int32_t h, int32_t rowBytes,
+              const uint8_t* data, uint32_t fg, uint32_t bg, bool opaque)
+  {
+    release();
+    return sink.bitmap(x, y, w, h, rowBytes, data, fg, bg, opaque);
+  }
+
+  // The row collected is complete, add it to the rows held if it matches them
+  void endRow(void)
+  {
+    bool same = (n[0][0] || n[0][1]) && (y[1] == y[0] + h[0]);
+    for (uint8_t buf = 0; same && (buf < 2); buf++)
+    {
+      same = (n[0][buf] == n[1][buf]) && (!n[0][buf] || (color[0][buf] == color[1][buf])) &&
+             !memcmp(run[0][buf], run[1][buf], n[0][buf] * sizeof(run[0][buf][0]));
+    }
+    if (same)
+    {
+      h[0] += h[1];
+      STATS(gfx->renderStats.coalesced += n[1][0] + n[1][1];)
+    }
+    else
+    {
+      emit();
+      y[0] = y[1];
+      h[0] = h[1];
+      memcpy(n[0], n[1], sizeof(n[0]));
+      memcpy(color[0], color[1], sizeof(color[0]));
+      for (uint8_t buf = 0; buf < 2; buf++)
+        memcpy(run[0][buf], run[1][buf], n[1][buf] * sizeof(run[0][buf][0]));
+    }
+    n[1][0] = n[1][1] = 0;
+  }
+
+  // Pass the rows held on, background first
+  void emit(void)
+  {
+    for (int8_t buf = 1; buf >= 0; buf--)
+    {
+      for (uint8_t i = 0; i < n[0][buf]; i++)
+        sink.span(buf, run[0][buf][i][0], y[0], run[0][buf][i][1], h[0], color[0][buf]);
+      n[0][buf] = 0;
+    }
+  }
+
+  // Pass everything on, before a call that is not merged or at the glyph end
+  void release(void)
+  {
+    if (n[1][0] || n[1][1]) endRow();
+    emit();
+  }
+};
+
+
+#ifdef LOAD_GLCD
+/***************************************************************************************
+** Function name:           glcdRows
+** Description:             get the 8 rows of a GLCD character, MSB is the left pixel
+***************************************************************************************/
+inline void GxFont_GFX_TFT_eSPI::glcdRows(unsigned char c, uint8_t* rows)
+{
+#ifdef GLCD_ROWS
+  for (int8_t j = 0; j < 8; j++) rows[j] = pgm_read_byte(font_rows + (c * 8) + j);
+#else
+  // Transpose the 5 column bytes into 8 rows of 6 pixels
+  for (int8_t j = 0; j < 8; j++) rows[j] = 0;
+  for (int8_t i = 0; i < 5; i++ )
+  {
+    uint8_t line = pgm_read_byte(font + (c * 5) + i);
+    for (int8_t j = 0; j < 8; j++)
+    {
+      if (line & 0x1) rows[j] |= 0x80 >> i;
+      line >>= 1;
+    }
+  }
+#endif
+}
+
+
+/***************************************************************************************
+** Function name:           glcdKernel
+** Description:             draw a GLCD character as foreground and background spans per row,
+**                          Scaled and Opaque are fixed per instance
+***************************************************************************************/
+template <class Sink, bool Scaled, bool Opaque>
+void GxFont_GFX_TFT_eSPI::glcdKernel(Sink& sink, int32_t x, int32_t y, unsigned char c, uint32_t color, uint32_t bg, uint8_t size)
+{
+  DIAG (Serial.print("GxFont_GFX_TFT_eSPI::drawChar("); Serial.print(c); Serial.println(") GLCD 1");)
+  int ts = Scaled ? size : 1;
+  uint8_t rows[8];
+  glcdRows(c, rows);
+
+  for (int8_t j = 0; j < 8; j++)
+  {
+    int32_t pY = y + j * ts;
+    uint8_t line = rows[j];
+    int col = 0; // Column of the MSB of line
+    while (line)
+    {
+      int gap = leadingZeros32((uint32_t)line << 24); // Clear pixels before the next run
+      if (Opaque && gap) sink.span(1, x + col * ts, pY, gap * ts, ts, bg);
+      col += gap;
+      line <<= gap;
+      int run = leadingZeros32(~((uint32_t)line << 24)); // Set pixels in the run
+      sink.span(0, x + col * ts, pY, run * ts, ts, color);
+      col += run;
+      line = (uint32_t)line << run;
+    }
+    if (Opaque && (col < 6)) sink.span(1, x + col * ts, pY, (6 - col) * ts, ts, bg);
+  }
+  sink.flush();
+}
+#endif // LOAD_GLCD
+
+
+/***************************************************************************************
+** Function name:           gfxKernel
+** Description:             draw the bitmap of a free font glyph, Scaled is fixed per instance
+***************************************************************************************/
+template <class Sink, bool Scaled>
+void GxFont_GFX_TFT_eSPI::gfxKernel(Sink& sink, int32_t x, int32_t y, const uint8_t *bitmap, uint16_t bo,
+                                    uint8_t w, uint8_t h, int8_t xo, int8_t yo, uint8_t size, uint32_t color)
+{
+  uint8_t  xx, yy, bits, bit = 0;
+
+  // Rows from the bottom of the clip rectangle on are not decoded
+#ifndef FIXED_SIZE
+  int32_t  rows = Scaled ? (clipY1 - y - yo * size + size - 1) / size : clipY1 - y - yo;
+#else
+  int32_t  rows = clipY1 - y;
+  xo = yo = 0; // Already added to x and y
+#endif
+  if (rows < h) h = rows;
+
+  // Here we have 3 versions of the same function just for evaluation purposes
+  // Comment out the next two #defines to revert to the slower Adafruit implementation
+
+  // If FAST_LINE is defined then the free fonts are rendered using horizontal lines
+  // this makes rendering fonts 2-5 times faster. Particularly good for large fonts.
+  // This is an elegant solution since it still uses generic functions present in the
+  // stock library.
+
+  // If FAST_SHIFT is defined then a slightly faster (at least for AVR processors)
+  // shifting bit mask is used
+
+  // Free fonts don't look good when the size multiplier is >1 so we could remove
+  // code if this is not wanted and speed things up
+
+#define FAST_HLINE
+#define FAST_SHIFT
+  //FIXED_SIZE is an option in User_Setup.h that only works with FAST_LINE enabled
+
+#ifdef FAST_HLINE
+
+#ifdef FAST_SHIFT
+  uint16_t hpc = 0; // Horizontal foreground pixel count
+  for (yy = 0; yy < h; yy++) {
+    for (xx = 0; xx < w; xx++) {
+      if (bit == 0) {
+        bits = pgm_read_byte(&bitmap[bo++]);
+        bit  = 0x80;
+      }
+      if (bits & bit) hpc++;
+      else {
+        if (hpc) {
+          if (!Scaled) sink.span(0, x + xo + xx - hpc, y + yo + yy, hpc, 1, color);
+          else sink.span(0, x + (xo + xx - hpc)*size, y + (yo + yy)*size, size * hpc, size, color);
+          hpc = 0;
+        }
+      }
+      bit >>= 1;
+    }
+    // Draw pixels for this line as we are about to increment yy
+    if (hpc) {
+      if (!Scaled) sink.span(0, x + xo + xx - hpc, y + yo + yy, hpc, 1, color);
+      else sink.span(0, x + (xo + xx - hpc)*size, y + (yo + yy)*size, size * hpc, size, color);
+      hpc = 0;
+    }
+  }
+#else
+  uint16_t hpc = 0; // Horizontal foreground pixel count
+  for (yy = 0; yy < h; yy++) {
+    for (xx = 0; xx < w; xx++) {
+      if (!(bit++ & 7)) {
+        bits = pgm_read_byte(&bitmap[bo++]);
+      }
+      if (bits & 0x80) hpc++;
+      else {
+        if (hpc) {
+          if (!Scaled) sink.span(0, x + xo + xx - hpc, y + yo + yy, hpc, 1, color);
+          else sink.span(0, x + (xo + xx - hpc)*size, y + (yo + yy)*size, size * hpc, size, color);
+          hpc = 0;
+        }
+      }
+      bits <<= 1;
+    }
+    // Draw pixels for this line as we are about to increment yy
+    if (hpc) {
+      if (!Scaled) sink.span(0, x + xo + xx - hpc, y + yo + yy, hpc, 1, color);
+      else sink.span(0, x + (xo + xx - hpc)*size, y + (yo + yy)*size, size * hpc, size, color);
+      hpc = 0;
+    }
+  }
+#endif
+
+#else
+  for (yy = 0; yy < h; yy++) {
+    for (xx = 0; xx < w; xx++) {
+      if (!(bit++ & 7)) {
+        bits = pgm_read_byte(&bitmap[bo++]);
+      }
+      if (bits & 0x80) {
+        if (!Scaled) {
+          sink.pixel(x + xo + xx, y + yo + yy, color);
+        } else {
+          sink.rect(x + (xo + xx)*size, y + (yo + yy)*size, size, size, color);
+        }
+      }
+      bits <<= 1;
+    }
+  }
+#endif
+}
+
+
+#if defined (LOAD_GFXFF) && defined (GFX_SPANS)
+/***************************************************************************************
+** Function name:           spanKernel
+** Description:             draw a free font glyph from its stored row spans
+***************************************************************************************/
+// The glyph rows start at byte offset so in the span data. Each row is a run count followed
+// by the left column and length of each run, so no bits are tested while drawing.
+template <class Sink, bool Scaled>
+void GxFont_GFX_TFT_eSPI::spanKernel(Sink& sink, int32_t x, int32_t y, const uint8_t *spans, uint16_t so,
+                                     uint8_t h, int8_t xo, int8_t yo, uint8_t size, uint32_t color)
+{
+  const uint8_t *p = spans + so;
+
+  // Rows from the bottom of the clip rectangle on are not decoded
+#ifndef FIXED_SIZE
+  int32_t  rows = Scaled ? (clipY1 - y - yo * size + size - 1) / size : clipY1 - y - yo;
+#else
+  int32_t  rows = clipY1 - y;
+  xo = yo = 0; // Already added to x and y
+#endif
+  if (rows < h) h = rows;
+
+  for (uint8_t yy = 0; yy < h; yy++) {
+    uint8_t n = pgm_read_byte(p++);
+    while (n--) {
+      uint8_t xx  = pgm_read_byte(p++);
+      uint8_t len = pgm_read_byte(p++);
+      if (!Scaled) sink.span(0, x + xo + xx, y + yo + yy, len, 1, color);
+      else sink.span(0, x + (xo + xx) * size, y + (yo + yy) * size, len * size, size, color);
+    }
+  }
+}
+#endif
+
+
+#if defined (LOAD_GFXFF) && defined (GFX_PACKED)
+/***************************************************************************************
+** Function name:           packedKernel
+** Description:             draw a free font glyph from its run length packed bitmap
+***************************************************************************************/
+// ro is the offset of the glyph runs, background and foreground run lengths alternate in
+// the pixel order of the bitmap, one nibble each, a nibble of 15 adds 15 to the next one.
+// Foreground runs are split at the row ends and passed on as they are read.
+template <class Sink, bool Scaled>
+void GxFont_GFX_TFT_eSPI::packedKernel(Sink& sink, int32_t x, int32_t y, const uint8_t *runs, uint16_t ro,
+                                       uint8_t w, uint8_t h, int8_t xo, int8_t yo, uint8_t size, uint32_t color)
+{
+  const uint8_t *p = runs + ro;
+  uint8_t  bits = 0;    // Byte holding the next nibble
+  bool     low = false; // The next nibble is the low one of bits
+  bool     fg = false;  // The next run is foreground
+
+  // Rows from the bottom of the clip rectangle on are not decoded
+#ifndef FIXED_SIZE
+  int32_t  rows = Scaled ? (clipY1 - y - yo * size + size - 1) / size : clipY1 - y - yo;
+#else
+  int32_t  rows = clipY1 - y;
+  xo = yo = 0; // Already added to x and y
+#endif
+  if (rows < h) h = rows;
+  if (!w) return;
+
+  int32_t  xx = 0, yy = 0;
+  while (yy < h) {
+    uint16_t len = 0;
+    uint8_t  n;
+    do {
+      if (!low) bits = pgm_read_byte(p++);
+      n = low ? (bits & 0x0F) : (bits >> 4);
+      low = !low;
+      len += n;
+    } while (n == 15);
+
+    if (!fg) {
+      xx += len;
+      while (xx >= w) { xx -= w; yy++; }
+    }
+    else {
+      while (len && (yy < h)) {
+        uint8_t hpc = (len < w - xx) ? len : w - xx;
+        if (!Scaled) sink.span(0, x + xo + xx, y + yo + yy, hpc, 1, color);
+        else sink.span(0, x + (xo + xx) * size, y + (yo + yy) * size, hpc * size, size, color);
+        len -= hpc;
+        xx  += hpc;
+        if (xx == w) { xx = 0; yy++; }
+      }
+    }
+    fg = !fg;
+  }
+}
+#endif
+
+
+#if defined (LOAD_GFXFF) && defined (GFX_SINGLE_PASS) && !defined (FIXED_SIZE)
+/***************************************************************************************
+** Function name:           gfxStringKernel
+** Description:             draw an opaque free font string row by row across the glyphs
+***************************************************************************************/
+// Used by drawLayout() instead of a background fill with the glyphs drawn on top. Each
+// row of the text box is assembled from the glyph rows that cross it and passed on as
+// foreground runs and the background gaps between them, so every pixel is written once.
+// boxX and boxW are the scaled left offset from poX and width of the background box,
+// ink of glyphs reaching outside it is drawn without background as before.
+// The columns are assembled in windows of 8 * SPAN_BUFFER_SIZE, each holding at most
+// SPAN_BUFFER_SIZE glyphs, so the stack used does not grow with the string. Glyphs that
+// do not fit in a window of one column are drawn over the rows afterwards.
+template <class Sink>
+void GxFont_GFX_TFT_eSPI::gfxStringKernel(Sink& sink, const TextLayout& layout, int32_t poX, int32_t poY,
+                                          int32_t boxX, int32_t boxW)
+{
+  typedef struct {
+    uint16_t bo;     // Bitmap offset of the glyph
+    uint8_t  w, h;
+    int8_t   yo;     // Top row relative to the baseline
+    int16_t  col;    // Left column relative to poX, unscaled
+  } GlyphRows;
+
+  int ts = textsize;
+  GFXglyph *glyphs = (GFXglyph *)pgm_read_dword(&gfxFont->glyph);
+  uint8_t  *bitmap = (uint8_t *)pgm_read_dword(&gfxFont->bitmap);
+  GlyphRows g[SPAN_BUFFER_SIZE];    // Glyphs crossing the window
+  uint8_t   row[SPAN_BUFFER_SIZE];  // One bit per column of the window
+  LayoutCursor first = { 0, layout.tail, (uint16_t)strlen(layout.string), 0, layout.tailX }, cur;
+  uint16_t  code;
+  int32_t   index;
+  bool      over = false;           // Glyphs are left to draw over the rows
+
+  // Columns covered by the box and by the ink of all glyphs
+  int16_t boxL = boxX / ts, boxR = (boxX + boxW) / ts;
+  int16_t left = boxL, right = boxR;
+  cur = first;
+  while (nextLayoutGlyph(layout, cur, code, index))
+  {
+    if (index < 0) continue;
+    GFXglyph *glyph = &glyphs[index];
+    uint8_t w = pgm_read_byte(&glyph->width);
+    if (!w || !pgm_read_byte(&glyph->height)) continue;
+    int16_t col = cur.x / ts + (int8_t)pgm_read_byte(&glyph->xOffset);
+    if (col < left) left = col;
+    if (col + w > right) right = col + w;
+    STATS(renderStats.glyphs++;)
+  }
+
+  int32_t top = poY - glyph_ab * ts;
+  STATS(statsOverdraw = false;)
+
+  for (int16_t wl = left, wr; wl < right; wl = wr)
+  {
+    wr = (right - wl > 8 * SPAN_BUFFER_SIZE) ? wl + 8 * SPAN_BUFFER_SIZE : right;
+
+    // Collect the glyphs crossing the window, a full table ends the window early
+    uint8_t n = 0;
+    cur = first;
+    while (nextLayoutGlyph(layout, cur, code, index))
+    {
+      if (index < 0) continue;
+      GFXglyph *glyph = &glyphs[index];
+      GlyphRows t;
+      t.w = pgm_read_byte(&glyph->width);
+      t.h = pgm_read_byte(&glyph->height);
+      if (!t.w || !t.h) continue;
+      t.col = cur.x / ts + (int8_t)pgm_read_byte(&glyph->xOffset);
+      if ((t.col >= wr) || (t.col + t.w <= wl)) continue;
+      if (n == SPAN_BUFFER_SIZE)
+      {
+        if (t.col > wl)
+        {
+          wr = t.col;
+          uint8_t k = 0;
+          for (uint8_t i = 0; i < n; i++) if (g[i].col < wr) g[k++] = g[i];
+          n = k;
+        }
+        else over = true;
+        continue;
+      }
+      t.bo = pgm_read_word(&glyph->bitmapOffset);
+      t.yo = pgm_read_byte(&glyph->yOffset);
+      g[n++] = t;
+    }
+
+    int rowBytes = (wr - wl + 7) >> 3;
+    int gl = (boxL > wl) ? boxL : wl; // Box columns inside the window
+    int gr = (boxR < wr) ? boxR : wr;
+
+    for (int r = -glyph_ab; r < glyph_bb; r++)
+    {
+      int32_t y = top + (r + glyph_ab) * ts;
+      if ((y + ts <= clipY0) || (y >= clipY1)) continue;
+
+      // OR the glyph rows crossing this row into one bit row, inside the window only
+      memset(row, 0, rowBytes);
+      for (uint8_t i = 0; i < n; i++)
+      {
+        int gy = r - g[i].yo;
+        if ((gy < 0) || (gy >= g[i].h)) continue;
+        int      k0  = (wl > g[i].col) ? wl - g[i].col : 0;
+        int      k1  = (wr < g[i].col + g[i].w) ? wr - g[i].col : g[i].w;
+        uint32_t bit = (uint32_t)gy * g[i].w + k0; // Bit position in the glyph bitmap
+        int      c   = g[i].col + k0 - wl;
+        for (int k = k0; k < k1; k++, bit++, c++)
+        {
+          if (pgm_read_byte(&bitmap[g[i].bo + (bit >> 3)]) & (0x80 >> (bit & 7))) row[c >> 3] |= 0x80 >> (c & 7);
+        }
+      }
+
+      // Pass the runs on, background only inside the box
+      bool open = false; // A foreground run is open, columns may be negative
+      int start = 0;
+      int gx = gl;       // First box column without background yet
+      for (int c = wl; c <= wr; c++)
+      {
+        bool set = (c < wr) && (row[(c - wl) >> 3] & (0x80 >> ((c - wl) & 7)));
+        if (set && !open)
+        {
+          open = true;
+          start = c;
+          int end = (start < gr) ? start : gr;
+          if (end > gx) sink.span(1, poX + gx * ts, y, (end - gx) * ts, ts, textbgcolor);
+        }
+        else if (!set && open)
+        {
+          sink.span(0, poX + start * ts, y, (c - start) * ts, ts, textcolor);
+          if (c > gx) gx = c;
+          open = false;
+        }
+      }
+      if (gr > gx) sink.span(1, poX + gx * ts, y, (gr - gx) * ts, ts, textbgcolor);
+    }
+  }
+  sink.flush();
+
+  // More glyphs overlap than a window holds, draw them all on top as without GFX_SINGLE_PASS
+  if (over)
+  {
+    cur = first;
+    while (nextLayoutGlyph(layout, cur, code, index)) if (index >= 0) drawChar(code, poX + cur.x, poY, 1);
+  }
+}
+#endif
+
+
+/***************************************************************************************
+** Function name:           font2Kernel
+** Description:             draw a Font 2 character as foreground and background spans
+**                          per row, Scaled and Opaque are fixed per instance
+***************************************************************************************/
+template <class Sink, bool Scaled, bool Opaque>
+void GxFont_GFX_TFT_eSPI::font2Kernel(Sink& sink, int x, int y, int width, int height, int w, uintptr_t flash_address)
+{
+  int ts = Scaled ? textsize : 1;
+  int pY = y;
+
+  // Rows are stored separately, so only decode those inside the clip rectangle
+  int first = 0;
+  if (y < clipY0)
+  {
+    first = (clipY0 - y) / ts;
+    pY += first * ts;
+  }
+  int rows = (clipY1 - y + ts - 1) / ts;
+  if (rows < height) height = rows;
+
+  // Only w * 8 columns are stored, anything to the right of them is background
+  int cols = (width < w * 8) ? width : w * 8;
+
+  for (int i = first; i < height; i++)
+  {
+    const uint8_t* p = (const uint8_t *)flash_address + w * i;
+    int start = -1; // Column of the open foreground run
+    int gx = 0;     // First column not drawn yet
+    for (int k = 0; k < cols; k += 8)
+    {
+      uint8_t line = pgm_read_byte(p++);
+      if ((start < 0) && !line) continue; // Nothing starts in this byte
+      if ((start >= 0) && (line == 0xFF)) continue; // Run carries on through this byte
+      for (int b = 0; (b < 8) && (k + b < cols); b++)
+      {
+        bool set = line & (0x80 >> b);
+        if (set && (start < 0)) start = k + b;
+        else if (!set && (start >= 0))
+        {
+          if (Opaque && (start > gx)) sink.span(1, x + gx * ts, pY, (start - gx) * ts, ts, textbgcolor);
+          sink.span(0, x + start * ts, pY, (k + b - start) * ts, ts, textcolor);
+          gx = k + b;
+          start = -1;
+        }
+      }
+    }
+    if (start >= 0) // Run up to the last stored column
+    {
+      if (Opaque && (start > gx)) sink.span(1, x + gx * ts, pY, (start - gx) * ts, ts, textbgcolor);
+      sink.span(0, x + start * ts, pY, (cols - start) * ts, ts, textcolor);
+      gx = cols;
+    }
+    if (Opaque && (gx < width)) sink.span(1, x + gx * ts, pY, (width - gx) * ts, ts, textbgcolor);
+    pY += ts;
+  }
+  sink.flush();
+}
+
+
+/***************************************************************************************
+** Function name:           rleKernel
+** Description:             draw an RLE font character, Scaled and Opaque are fixed per instance
+***************************************************************************************/
+// Decoding starts at pixel start of the glyph, flash_address points to the run holding it
+template <class Sink, bool Scaled, bool Opaque>
+void GxFont_GFX_TFT_eSPI::rleKernel(Sink& sink, int x, int y, int width, int height, uintptr_t flash_address, int start)
+{
+  int w = width * height; // Total number of pixels in the character
+  int pY      = y;
+  uint8_t line = 0;
+
+  // Runs from the bottom of the clip rectangle on are not decoded
+  int rows = (clipY1 - y + textsize - 1) / textsize;
+  if (rows < height) w = width * rows;
+
+  if (Scaled || !Opaque)
+  {
+    if (Opaque) sink.rect(x, pY, width * textsize, textsize * height, textbgcolor);
+    STATS(statsOverdraw = Opaque;)
+    int ts = Scaled ? textsize : 1;
+    int pc = start; // Pixel count
+    int dx = pc % width, dy = pc / width; // Glyph column and row of the current run start
+    // Each foreground run is drawn as one span per glyph row it covers
+    while (pc < w)
+    {
+      line = pgm_read_byte((uint8_t *)flash_address);
+      flash_address++;
+      int run = (line & 0x7F) + 1;
+      if (line & 0x80)
+      {
+        int left = run;
+        if (pc + left > w) left = w - pc; // Stop at the clip bottom
+        while (left > 0)
+        {
+          int seg = width - dx; // Pixels up to the end of this glyph row
+          if (seg > left) seg = left;
+          sink.span(0, x + dx * ts, y + dy * ts, seg * ts, ts, textcolor);
+          left -= seg;
+          dx += seg;
+          if (dx >= width)
+          {
+            dx = 0;
+            dy++;
+          }
+        }
+      }
+      else
+      {
+        dx += run;
+        dy += dx / width;
+        dx %= width;
+      }
+      pc += run;
+    }
+    sink.flush();
+    STATS(statsOverdraw = false;)
+  }
+  else // Text colour != background && textsize = 1
+  {
+    // Runs are split at the glyph row ends, consecutive runs of one colour in a row are
+    // merged and whole rows of one colour are passed as a single block
+    int dx = start % width; // Glyph column and row of the next decoded pixel
+    int dy = start / width;
+    w -= start;
+    int rx = 0;   // Start column and length of the pending span in row dy
+    int rlen = 0;
+    uint8_t rbuf = 0; // Span buffer of the pending span, 0 foreground, 1 background
+
+    // Maximum font size is equivalent to 180x180 pixels in area
+    while (w > 0)
+    {
+      line = pgm_read_byte((uint8_t *)flash_address++); // 8 bytes smaller when incrementing here
+      uint8_t buf = (line & 0x80) ? 0 : 1;
+      int n = (line & 0x7F) + 1;
+      if (n > w) n = w; // Stop at the clip bottom
+      w -= n;
+
+      if (rlen && (buf != rbuf))
+      {
+        sink.span(rbuf, x + rx, y + dy, rlen, 1, rbuf ? textbgcolor : textcolor);
+        rlen = 0;
+      }
+      if (!rlen)
+      {
+        rx = dx;
+        rbuf = buf;
+      }
+
+      int seg = width - dx; // Pixels up to the end of this row
+      if (seg > n) seg = n;
+      rlen += seg;
+      dx += seg;
+      n -= seg;
+      if (dx < width) continue;
+
+      // The row is complete, whole rows that follow are added to it when it starts at column 0
+      int rows = n / width;
+      n -= rows * width;
+      if (rx == 0)
+      {
+        sink.span(rbuf, x, y + dy, width, rows + 1, rbuf ? textbgcolor : textcolor);
+      }
+      else
+      {
+        sink.span(rbuf, x + rx, y + dy, rlen, 1, rbuf ? textbgcolor : textcolor);
+        if (rows) sink.span(rbuf, x, y + dy + 1, width, rows, rbuf ? textbgcolor : textcolor);
+      }
+      dy += rows + 1;
+      dx = n;
+      rx = 0;
+      rlen = n;
+    }
+    if (rlen) sink.span(rbuf, x + rx, y + dy, rlen, 1, rbuf ? textbgcolor : textcolor);
+    sink.flush(); // Pass the runs of this glyph to the sink in one batch
+  }
+}
+
+
+#if defined (LOAD_FONT7) && defined (FONT7_SEGMENTS)
+/***************************************************************************************
+** Function name:           segmentKernel
+** Description:             draw a Font 7 character as seven segment rectangles
+***************************************************************************************/
+// code is the character - 32, the segments are scaled so any text size costs the same
+template <class Sink, bool Opaque>
+void GxFont_GFX_TFT_eSPI::segmentKernel(Sink& sink, int x, int y, uint16_t code, int width, int height)
+{
+  if (Opaque) sink.span(1, x, y, width * textsize, height * textsize, textbgcolor);
+  STATS(statsOverdraw = Opaque;)
+
+  uint16_t segments = (code < 32) ? pgm_read_word(&segtbl_f7s[code]) : 0;
+  for (uint8_t i = 0; segments; i++, segments >>= 1)
+  {
+    if (!(segments & 1)) continue;
+    const uint8_t* r = segrect_f7s[i];
+    sink.span(0, x + pgm_read_byte(r) * textsize, y + pgm_read_byte(r + 1) * textsize,
+              pgm_read_byte(r + 2) * textsize, pgm_read_byte(r + 3) * textsize, textcolor);
+  }
+  sink.flush();
+  STATS(statsOverdraw = false;)
+}
+#endif
+
+
+#ifdef FONT_MIRROR
+/***************************************************************************************
+** Function name:           mirrorKernel
+** Description:             draw a glyph from the RAM copy of an RLE font, see preloadFont()
+***************************************************************************************/
+// The rows are scanned 32 pixels at a time, runs of set or clear bits are found by
+// counting leading zeros instead of testing every bit
+template <class Sink, bool Scaled, bool Opaque>
+void GxFont_GFX_TFT_eSPI::mirrorKernel(Sink& sink, int32_t x, int32_t y, const uint8_t* rows, int width, int height)
+{
+  int rowBytes = ((width + 31) / 32) * 4;
+
+  // Whole glyphs at size 1 are passed on as a packed bitmap if the sink takes them
+  if (!Scaled && bitmap1bpp)
+  {
+    if (sink.bitmap(x, y, width, height, rowBytes, rows, textcolor, textbgcolor, Opaque)) return;
+  }
+
+  int ts = Scaled ? textsize : 1;
+  int first = 0;
+  if (clipY0 > y) first = (clipY0 - y) / ts;
+  int last = (clipY1 - y + ts - 1) / ts;
+  if (last > height) last = height;
+
+  for (int row = first; row < last; row++)
+  {
+    const uint8_t* p = rows + row * rowBytes;
+    int32_t py = y + row * ts;
+    int start = -1; // Column of the open foreground run
+    int gx = 0;     // First column not drawn yet
+    for (int base = 0; base < width; base += 32, p += 4)
+    {
+      uint32_t bits = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+      int pos = 0;
+      while (pos < 32)
+      {
+        if (start < 0)
+        {
+          uint32_t v = bits << pos; // Look for the next set bit
+          if (!v) break;
+          pos += leadingZeros32(v);
+          start = base + pos;
+        }
+        else
+        {
+          uint32_t v = ~bits << pos; // Look for the next clear bit
+          if (!v) break;
+          pos += leadingZeros32(v);
+          if (Opaque && (start > gx)) sink.span(1, x + gx * ts, py, (start - gx) * ts, ts, textbgcolor);
+          sink.span(0, x + start * ts, py, (base + pos - start) * ts, ts, textcolor);
+          gx = base + pos;
+          start = -1;
+        }
+      }
+    }
+    if (start >= 0) // Run up to the right edge
+    {
+      if (Opaque && (start > gx)) sink.span(1, x + gx * ts, py, (start - gx) * ts, ts, textbgcolor);
+      sink.span(0, x + start * ts, py, (width - start) * ts, ts, textcolor);
+      gx = width;
+    }
+    if (Opaque && (gx < width)) sink.span(1, x + gx * ts, py, (width - gx) * ts, ts, textbgcolor);
+  }
+  sink.flush();
+}
+#endif
+
+
+/***************************************************************************************
+** Function name:           renderChar
+** Description:             draw a single character in the Adafruit GLCD font or a free font
+***************************************************************************************/
+template <class Sink>
+void GxFont_GFX_TFT_eSPI::renderChar(Sink& sink, int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size)
+{
+  DIAG (Serial.print("GxFont_GFX_TFT_eSPI::drawChar("); Serial.print(c); Serial.println(") GLCD");)
+  if ((x >= (int16_t)_width)            || // Clip right
+      (y >= (int16_t)_height)           || // Clip bottom
+      ((x + 6 * size - 1) < 0) || // Clip left
+      ((y + 8 * size - 1) < 0))   // Clip top
+    return;
+
+  if (c < 32) return;
+#ifdef LOAD_GLCD
+  //>>>>>>>>>>>>>>>>>>
+#ifdef LOAD_GFXFF
+  if (!gfxFont) { // 'Classic' built-in font
+#endif
+    //>>>>>>>>>>>>>>>>>>
+
+    DIAG (Serial.print("GxFont_GFX_TFT_eSPI::drawChar("); Serial.print(c); Serial.println(") GLCD .");)
+    if (c > 255) return; // The GLCD font is 8 bit
+    boolean fillbg = (bg != color);
+#ifdef DISPLAY_LIST
+    if (recordCommand(1, c, x, y, color, bg, size, x, y, 6 * size, 8 * size)) return;
+#endif
+    if (!clipVisible(x, y, 6 * size, 8 * size)) return;
+    STATS(renderStats.glyphs++;)
+
+    if ((size == 1) && bitmap1bpp)
+    {
+      uint8_t rows[8];
+      glcdRows(c, rows);
+      if (sink.bitmap(x, y, 6, 8, 1, rows, color, bg, fillbg)) return;
+    }
+
+#ifdef GLYPH_CACHE
+    if (drawCachedGlyph(1, c, x, y, size, color, bg, fillbg)) return;
+#endif
+
+    if (size == 1)
+    {
+      if (fillbg) glcdKernel<Sink, false, true>(sink, x, y, c, color, bg, size);
+      else glcdKernel<Sink, false, false>(sink, x, y, c, color, bg, size);
+    }
+    else
+    {
+      RowMerger<Sink> merge(this, sink);
+      if (fillbg) glcdKernel<RowMerger<Sink>, true, true>(merge, x, y, c, color, bg, size);
+      else glcdKernel<RowMerger<Sink>, true, false>(merge, x, y, c, color, bg, size);
+    }
+
+    //>>>>>>>>>>>>>>>>>>>>>>>>>>>
+#ifdef LOAD_GFXFF
+  } else { // Custom font
+#endif
+    //>>>>>>>>>>>>>>>>>>>>>>>>>>>
+#endif // LOAD_GLCD
+
+#ifdef LOAD_GFXFF
+    DIAG (Serial.print("GxFont_GFX_TFT_eSPI::drawChar("); Serial.print(c); Serial.println(") GLCD 3");)
+    // Filter out bad characters not present in font
+    int32_t index = gfxGlyphIndex(c);
+    if (index >= 0)
+    {
+      //>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+      GFXglyph *glyph  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[index]);
+      uint8_t  *bitmap = (uint8_t *)pgm_read_dword(&gfxFont->bitmap);
+
+      uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
+      uint8_t  w  = pgm_read_byte(&glyph->width),
+               h  = pgm_read_byte(&glyph->height),
+               xa = pgm_read_byte(&glyph->xAdvance);
+      int8_t   xo = pgm_read_byte(&glyph->xOffset),
+               yo = pgm_read_byte(&glyph->yOffset);
+      uint8_t  xx, yy;
+
+#ifndef FIXED_SIZE
+#ifdef DISPLAY_LIST
+      if (recordCommand(1, c, x, y, color, bg, size, x + xo * size, y + yo * size, w * size, h * size)) return;
+#endif
+      if (!clipVisible(x + xo * size, y + yo * size, w * size, h * size)) return;
+#else
+#ifdef DISPLAY_LIST
+      if (recordCommand(1, c, x, y, color, bg, size, x + xo, y + yo, w, h)) return;
+#endif
+      if (!clipVisible(x + xo, y + yo, w, h)) return;
+#endif
+      STATS(renderStats.glyphs++;)
+
+#ifdef FIXED_SIZE
+      x += xo; // Save 88 bytes of FLASH
+      y += yo;
+#endif
+
+#ifdef GFX_SPANS
+      if (gfxSpans)
+      {
+#ifndef FIXED_SIZE
+        if (size == 1) spanKernel<Sink, false>(sink, x, y, bitmap, bo, h, xo, yo, size, color);
+        else
+        {
+          RowMerger<Sink> merge(this, sink);
+          spanKernel<RowMerger<Sink>, true>(merge, x, y, bitmap, bo, h, xo, yo, size, color);
+          merge.release();
+        }
+#else
+        spanKernel<Sink, false>(sink, x, y, bitmap, bo, h, xo, yo, size, color);
+#endif
+        sink.flush();
+        return;
+      }
+#endif
+
+#ifdef GFX_PACKED
+      if (gfxPacked)
+      {
+#ifndef FIXED_SIZE
+        if (size == 1) packedKernel<Sink, false>(sink, x, y, bitmap, bo, w, h, xo, yo, size, color);
+        else
+        {
+          RowMerger<Sink> merge(this, sink);
+          packedKernel<RowMerger<Sink>, true>(merge, x, y, bitmap, bo, w, h, xo, yo, size, color);
+          merge.release();
+        }
+#else
+        packedKernel<Sink, false>(sink, x, y, bitmap, bo, w, h, xo, yo, size, color);
+#endif
+        sink.flush();
+        return;
+      }
+#endif
+
+      if ((size == 1) && bitmap1bpp && w && h && (((w + 7) >> 3) * h <= BITMAP_BUFFER_SIZE))
+      {
+        // Repack the continuous glyph bit stream into byte aligned rows
+        uint8_t  rowBytes = (w + 7) >> 3;
+        uint8_t  rows[BITMAP_BUFFER_SIZE];
+        uint16_t bp = 0; // Bit position of the row start relative to bo
+        for (yy = 0; yy < h; yy++) {
+          for (xx = 0; xx < rowBytes; xx++) {
+            uint16_t p = bp + (xx << 3);
+            uint8_t  n = w - (xx << 3); // Bits left in this row
+            uint8_t  s = p & 7;
+            uint8_t  v = pgm_read_byte(&bitmap[bo + (p >> 3)]) << s;
+            if (s + n > 8) v |= pgm_read_byte(&bitmap[bo + (p >> 3) + 1]) >> (8 - s);
+            if (n < 8) v &= 0xFF << (8 - n);
+            rows[yy * rowBytes + xx] = v;
+          }
+          bp += w;
+        }
+#ifndef FIXED_SIZE
+        if (sink.bitmap(x + xo, y + yo, w, h, rowBytes, rows, color, bg, false)) return;
+#else
+        if (sink.bitmap(x, y, w, h, rowBytes, rows, color, bg, false)) return;
+#endif
+      }
+
+#ifdef GLYPH_CACHE
+#ifndef FIXED_SIZE
+      if (drawCachedGlyph(1, index, x + xo * size, y + yo * size, size, color, bg, false)) return;
+#else
+      if (drawCachedGlyph(1, index, x, y, size, color, bg, false)) return;
+#endif
+#endif
+
+#ifndef FIXED_SIZE
+      if (size == 1) gfxKernel<Sink, false>(sink, x, y, bitmap, bo, w, h, xo, yo, size, color);
+      else
+      {
+        RowMerger<Sink> merge(this, sink);
+        gfxKernel<RowMerger<Sink>, true>(merge, x, y, bitmap, bo, w, h, xo, yo, size, color);
+        merge.release();
+      }
+#else
+      gfxKernel<Sink, false>(sink, x, y, bitmap, bo, w, h, xo, yo, size, color);
+#endif
+      sink.flush(); // Pass the runs of this glyph to the sink in one batch
+    }
+#endif
+
+
+#ifdef LOAD_GLCD
+#ifdef LOAD_GFXFF
+  } // End classic vs custom font
+#endif
+#endif
+
+}
+
+
+/***************************************************************************************
+** Function name:           renderChar
+** Description:             draw a Unicode in the font selected by number
+***************************************************************************************/
+template <class Sink>
+int16_t GxFont_GFX_TFT_eSPI::renderChar(Sink& sink, unsigned int uniCode, int x, int y, int font)
+{
+  DIAG (Serial.print("GxFont_GFX_TFT_eSPI::drawChar("); Serial.print(uniCode); Serial.println(") uniCode");)
+  if (font == 1)
+  {
+#ifdef LOAD_GLCD
+#ifndef LOAD_GFXFF
+    renderChar(sink, x, y, uniCode, textcolor, textbgcolor, textsize);
+    return 6 * textsize;
+#endif
+#else
+#ifndef LOAD_GFXFF
+    return 0;
+#endif
+#endif
+
+#ifdef LOAD_GFXFF
+    renderChar(sink, x, y, uniCode, textcolor, textbgcolor, textsize);
+    if (!gfxFont) { // 'Classic' built-in font
+#ifdef LOAD_GLCD
+      return 6 * textsize;
+#else
+      return 0;
+#endif
+    }
+    else
+    {
+      int32_t c2 = gfxGlyphIndex(uniCode);
+      if (c2 >= 0)
+      {
+        GFXglyph *glyph = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[c2]);
+        return pgm_read_byte(&glyph->xAdvance) * textsize;
+      }
+      else
+      {
+        return 0;
+      }
+    }
+#endif
+  }
+
+  if ((font > 1) && (font < 9) && ((uniCode < 32) || (uniCode > 127))) return 0;
+
+  int width  = 0;
+  int height = 0;
+  uintptr_t flash_address = 0;
+  uniCode -= 32;
+
+#ifdef LOAD_FONT2
+  if (font == 2)
+  {
+    // This is faster than using the fontdata structure
+    flash_address = pgm_read_dword(&chrtbl_f16[uniCode]);
+    width = pgm_read_byte(widtbl_f16 + uniCode);
+    height = chr_hgt_f16;
+  }
+#ifdef LOAD_RLE
+  else
+#endif
+#endif
+
+#ifdef LOAD_RLE
+  {
+    if ((font > 2) && (font < 9))
+    {
+      // This is slower than above but is more convenient for the RLE fonts
+      flash_address = pgm_read_dword( pgm_read_dword( &(fontdata[font].chartbl ) ) + uniCode * sizeof(void *) );
+      width = pgm_read_byte( (uint8_t *)pgm_read_dword( &(fontdata[font].widthtbl ) ) + uniCode );
+      height = pgm_read_byte( &fontdata[font].height );
+    }
+  }
+#endif
+
+#ifdef DISPLAY_LIST
+  if (recordCommand(font, uniCode + 32, x, y, textcolor, textbgcolor, textsize, x, y, width * textsize, height * textsize)) return width * textsize;
+#endif
+  if (!clipVisible(x, y, width * textsize, height * textsize)) return width * textsize;
+
+  STATS(if ((font > 1) && (font < 9)) renderStats.glyphs++;)
+
+  int w = width;
+
+#ifdef LOAD_FONT2 // chop out code if we do not need it
+  if (font == 2)
+  {
+    w = w + 6; // Should be + 7 but we need to compensate for width increment
+    w = w / 8;
+    if (x + width * textsize >= (int16_t)_width) return width * textsize ;
+
+    if ((textsize == 1) && bitmap1bpp && (w * height <= BITMAP_BUFFER_SIZE))
+    {
+      // Font 2 is already stored as byte aligned rows, copy them out of FLASH
+      uint8_t rows[BITMAP_BUFFER_SIZE];
+      for (int i = 0; i < w * height; i++) rows[i] = pgm_read_byte((uint8_t *)flash_address + i);
+      if (sink.bitmap(x, y, width, height, w, rows, textcolor, textbgcolor, textcolor != textbgcolor)) return width;
+    }
+
+#ifdef GLYPH_CACHE
+    if (drawCachedGlyph(2, uniCode, x, y, textsize, textcolor, textbgcolor, textcolor != textbgcolor)) return width * textsize;
+#endif
+
+    if (textsize == 1)
+    {
+      if (textcolor != textbgcolor) font2Kernel<Sink, false, true>(sink, x, y, width, height, w, flash_address);
+      else font2Kernel<Sink, false, false>(sink, x, y, width, height, w, flash_address);
+    }
+    else
+    {
+      RowMerger<Sink> merge(this, sink);
+      if (textcolor != textbgcolor) font2Kernel<RowMerger<Sink>, true, true>(merge, x, y, width, height, w, flash_address);
+      else font2Kernel<RowMerger<Sink>, true, false>(merge, x, y, width, height, w, flash_address);
+    }
+  }
+
+#ifdef LOAD_RLE
+  else
+#endif
+#endif  //FONT2
+
+#ifdef LOAD_RLE  //674 bytes of code
+    // Font is not 2 and hence is RLE encoded
+  {
+#if defined (LOAD_FONT7) && defined (FONT7_SEGMENTS)
+    if (font == 7)
+    {
+      if (textcolor != textbgcolor) segmentKernel<Sink, true>(sink, x, y, uniCode, width, height);
+      else segmentKernel<Sink, false>(sink, x, y, uniCode, width, height);
+      return width * textsize;
+    }
+#endif
+
+#ifdef FONT_MIRROR
+    if (fontMirror[font])
+    {
+      const uint8_t* rows = fontMirror[font] + ((uint16_t*)fontMirror[font])[uniCode];
+      if (textsize == 1)
+      {
+        if (textcolor != textbgcolor) mirrorKernel<Sink, false, true>(sink, x, y, rows, width, height);
+        else mirrorKernel<Sink, false, false>(sink, x, y, rows, width, height);
+      }
+      else
+      {
+        RowMerger<Sink> merge(this, sink);
+        if (textcolor != textbgcolor) mirrorKernel<RowMerger<Sink>, true, true>(merge, x, y, rows, width, height);
+        else mirrorKernel<RowMerger<Sink>, true, false>(merge, x, y, rows, width, height);
+      }
+      return width * textsize;
+    }
+#endif
+
+#ifdef GLYPH_CACHE
+    if (drawCachedGlyph(font, uniCode, x, y, textsize, textcolor, textbgcolor, textcolor != textbgcolor)) return width * textsize;
+#endif
+
+    int start = 0; // First pixel decoded, rows above the clip rectangle are skipped with the index
+#ifdef RLE_ROW_INDEX
+    start = rleRowSeek(font, uniCode, y, width, height, flash_address);
+#endif
+
+    if (textsize == 1)
+    {
+      if (textcolor != textbgcolor) rleKernel<Sink, false, true>(sink, x, y, width, height, flash_address, start);
+      else rleKernel<Sink, false, false>(sink, x, y, width, height, flash_address, start);
+    }
+    else
+    {
+      RowMerger<Sink> merge(this, sink);
+      if (textcolor != textbgcolor) rleKernel<RowMerger<Sink>, true, true>(merge, x, y, width, height, flash_address, start);
+      else rleKernel<RowMerger<Sink>, true, false>(merge, x, y, width, height, flash_address, start);
+    }
+  }
+  // End of RLE font rendering
+#endif
+  return width * textsize;    // x +
+}
+
+
+#endif
@@ -19,12 +19,6 @@
 
 #include "GxFont_GFX_TFT_eSPI.h"
 
-//#define DIAG(x) x
-
-#ifndef DIAG
-#define DIAG(x)
-#endif
-
 #if defined(ESP8266) || defined(ESP32)
 #include <pgmspace.h>
 #else
@@ -54,6 +48,43 @@ GxFont_GFX_TFT_eSPI::GxFont_GFX_TFT_eSPI(int16_t w, int16_t h)
   textwrapY  = false;   // Wrap text at bottom of screen when using print stream
   textdatum = TL_DATUM; // Top Left text alignment is default
   fontsloaded = 0;
+#ifdef LOAD_GFXFF
+  gfxFont = NULL;       // GLCD until setFreeFont() is called
+#ifdef GFX_SPANS
+  gfxSpans = false;
+#endif
+#ifdef GFX_PACKED
+  gfxPacked = false;
+#endif
+  memset(gfxMetrics, 0, sizeof(gfxMetrics));
+  gfxMetricsNext = 0;
+#endif
+  decoderState = 0;     // No UTF-8 sequence started
+  spanCount[0] = spanCount[1] = 0;
+  bitmap1bpp = true;    // Try drawBitmap1bpp() until the base class version is reached
+  resetClipRect();
+  STATS(resetRenderStats();)
+
+#ifdef GLYPH_CACHE
+  memset(glyphCache, 0, sizeof(glyphCache));
+  memset(&glyphCacheStats, 0, sizeof(glyphCacheStats));
+  glyphCacheTick  = 0;
+  glyphCacheAlloc = malloc;
+  glyphCacheFree  = free;
+#endif
+
+#ifdef FONT_MIRROR
+  memset(fontMirror, 0, sizeof(fontMirror));
+  memset(fontMirrorSize, 0, sizeof(fontMirrorSize));
+#endif
+
+#ifdef DISPLAY_LIST
+  displayList          = NULL;
+  displayListCapacity  = 0;
+  displayListSize      = 0;
+  displayListRecording = false;
+  displayListOverflow  = false;
+#endif
 
 #ifdef LOAD_GLCD
   fontsloaded  = 0x0002; // Bit 1 set
@@ -81,6 +112,63 @@ GxFont_GFX_TFT_eSPI::GxFont_GFX_TFT_eSPI(int16_t w, int16_t h)
 
 }
 
+#if defined (GLYPH_CACHE) || defined (FONT_MIRROR)
+/***************************************************************************************
+** Function name:           ~GxFont_GFX_TFT_eSPI
+** Description:             Destructor, frees the glyph cache and the RAM font copies
+***************************************************************************************/
+GxFont_GFX_TFT_eSPI::~GxFont_GFX_TFT_eSPI()
+{
+#ifdef GLYPH_CACHE
+  clearGlyphCache();
+#endif
+#ifdef FONT_MIRROR
+  for (uint8_t font = 0; font < 9; font++) releaseFont(font);
+#endif
+}
+#endif
+
+/***************************************************************************************
+** Function name:           setClipRect
+** Description:             Limit text drawing to a rectangle
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::setClipRect(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  flushSpans(); // Runs queued so far belong to the old clip rectangle
+  if (w < 0) w = 0;
+  if (h < 0) h = 0;
+  clipX0 = constrain(x, -32768, 32767);
+  clipY0 = constrain(y, -32768, 32767);
+  clipX1 = constrain(x + w, -32768, 32767);
+  clipY1 = constrain(y + h, -32768, 32767);
+}
+
+
+/***************************************************************************************
+** Function name:           resetClipRect
+** Description:             Remove the clip rectangle, the display class clips as before
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::resetClipRect(void)
+{
+  flushSpans();
+  clipX0 = clipY0 = -32768;
+  clipX1 = clipY1 = 32767;
+}
+
+
+/***************************************************************************************
+** Function name:           getClipRect
+** Description:             Return the clip rectangle
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::getClipRect(int32_t *x, int32_t *y, int32_t *w, int32_t *h) const
+{
+  *x = clipX0;
+  *y = clipY0;
+  *w = clipX1 - clipX0;
+  *h = clipY1 - clipY0;
+}
+
+
 /***************************************************************************************
 ** Function name:           setCursor
 ** Description:             Set the text cursor x,y position
@@ -207,6 +295,16 @@ uint8_t GxFont_GFX_TFT_eSPI::getTextDatum(void)
 }
 
 
+/***************************************************************************************
+** Function name:           getTextSize
+** Description:             Return the text size multiplier (as used by setTextSize())
+***************************************************************************************/
+uint8_t GxFont_GFX_TFT_eSPI::getTextSize(void)
+{
+  return textsize;
+}
+
+
 /***************************************************************************************
 ** Function name:           width
 ** Description:             Return the pixel width of display (per current rotation)
@@ -254,12 +352,38 @@ int16_t GxFont_GFX_TFT_eSPI::textWidth(const char *string)
 }
 
 int16_t GxFont_GFX_TFT_eSPI::textWidth(const char *string, int font)
+{
+  TextLayout layout = {}; // No run storage, only measure
+  layoutString(string, layout, font);
+  return layout.width;
+}
+
+
+/***************************************************************************************
+** Function name:           layoutString
+** Description:             Resolve the glyph placement of a string once for measure and draw
+***************************************************************************************/
+// Stores up to layout.capacity runs in layout.runs and returns the number stored, the
+// width and advance always cover the whole string. The layout keeps a pointer to the
+// string and stays valid for drawLayout() while the string, font and text size do not change.
+uint16_t GxFont_GFX_TFT_eSPI::layoutString(const char *string, TextLayout& layout, int font)
 {
   int str_width  = 0;
+  const char *begin = string; // For the run offsets
+
+  layout.string  = string;
+  layout.count   = 0;
+  layout.tail    = strlen(string);
+  layout.tailX   = 0;
+  layout.font    = font;
+  layout.size    = textsize;
+  layout.advance = 0;
+  layout.xo      = 0;
 
 #ifdef SMOOTH_FONT
   if (fontLoaded)
   {
+    // Smooth fonts are drawn from the string, only the width is resolved
     while (*string)
     {
       uint16_t unicode = decodeUTF8(*string++);
@@ -280,23 +404,32 @@ int16_t GxFont_GFX_TFT_eSPI::textWidth(const char *string, int font)
         }
       }
     }
-    return str_width;
+    layout.width = layout.advance = str_width;
+    return 0;
   }
 #endif
 
   unsigned char uniCode;
-  char *widthtable;
+  int16_t advance; // Cursor advance as returned by drawChar()
 
   if (font > 1 && font < 9)
   {
-    widthtable = (char *)pgm_read_dword( &(fontdata[font].widthtbl ) ) - 32; //subtract the 32 outside the loop
+    char *widthtable = (char *)pgm_read_dword( &(fontdata[font].widthtbl ) ) - 32; //subtract the 32 outside the loop
 
     while (*string)
     {
       uniCode = *(string++);
       if (uniCode > 31 && uniCode < 128)
-        str_width += pgm_read_byte( widthtable + uniCode); // Normally we need to subract 32 from uniCode
-      else str_width += pgm_read_byte( widthtable + 32); // Set illegal character = space width
+      {
+        advance = pgm_read_byte( widthtable + uniCode); // Normally we need to subract 32 from uniCode
+        str_width += advance;
+      }
+      else
+      {
+        advance = 0; // drawChar() skips illegal characters
+        str_width += pgm_read_byte( widthtable + 32); // Set illegal character = space width
+      }
+      addTextRun(layout, uniCode, advance * textsize, string - begin - 1);
     }
   }
   else
@@ -305,32 +438,107 @@ int16_t GxFont_GFX_TFT_eSPI::textWidth(const char *string, int font)
 #ifdef LOAD_GFXFF
     if (gfxFont) // New font
     {
-      while (*string)
+      GFXglyph *glyphs = (GFXglyph *)pgm_read_dword(&gfxFont->glyph);
+      bool start = true;
+      bool utf8 = gfxFontEx(); // Sparse fonts take UTF-8, the others one byte per character
+      uint16_t len = strlen(string), n = 0;
+
+      while (n < len)
       {
-        uniCode = *(string++);
-        if ((uniCode >= (uint8_t)pgm_read_byte(&gfxFont->first)) && (uniCode <= (uint8_t)pgm_read_byte(&gfxFont->last )))
+        uint16_t offset = n;
+        uint16_t code = utf8 ? decodeUTF8((uint8_t *)string, &n, len - n) : (uint8_t)string[n++];
+        int32_t index = gfxGlyphIndex(code);
+        advance = 0;
+        if (index >= 0)
         {
-          uniCode -= pgm_read_byte(&gfxFont->first);
-          GFXglyph *glyph  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[uniCode]);
+          GFXglyph *glyph  = &glyphs[index];
+          advance = pgm_read_byte(&glyph->xAdvance);
+          // Keep the offset of the first character to allow for negative offsets
+          if (start) layout.xo = pgm_read_byte(&glyph->xOffset) * textsize;
           // If this is not the  last character then use xAdvance
-          if (*string) str_width += pgm_read_byte(&glyph->xAdvance);
+          if (n < len) str_width += advance;
           // Else use the offset plus width since this can be bigger than xAdvance
           else str_width += ((int8_t)pgm_read_byte(&glyph->xOffset) + pgm_read_byte(&glyph->width));
         }
+        start = false;
+        addTextRun(layout, code, advance * textsize, offset);
       }
     }
     else
 #endif
     {
+      while (*string)
+      {
+        uniCode = *(string++);
 #ifdef LOAD_GLCD
-      while (*string++) str_width += 6;
+        str_width += 6;
+        addTextRun(layout, uniCode, 6 * textsize, string - begin - 1);
+#else
+        addTextRun(layout, uniCode, 0, string - begin - 1);
 #endif
+      }
     }
   }
-  return str_width * textsize;
+  layout.width = str_width * textsize;
+  return layout.count;
 }
 
 
+/***************************************************************************************
+** Function name:           addTextRun
+** Description:             Append a character to a layout if there is room for it
+***************************************************************************************/
+// offset is the position of the character in the string, the first character that does
+// not fit is where drawLayout() carries on from the string.
+void GxFont_GFX_TFT_eSPI::addTextRun(TextLayout& layout, uint16_t code, int16_t advance, uint16_t offset)
+{
+  if (layout.count < layout.capacity)
+  {
+    TextRun *run = &layout.runs[layout.count++];
+    run->code    = code;
+    run->x       = layout.advance;
+  }
+  else if (offset < layout.tail)
+  {
+    layout.tail  = offset;
+    layout.tailX = layout.advance;
+  }
+  layout.advance += advance;
+}
+
+
+#if defined (LOAD_GFXFF) && defined (GFX_SINGLE_PASS) && !defined (FIXED_SIZE)
+/***************************************************************************************
+** Function name:           nextLayoutGlyph
+** Description:             Step to the next character of a free font layout
+***************************************************************************************/
+// Takes the runs first and then decodes the string past them, returns false after the
+// last character. index is the glyph of code or -1 if the font has none.
+bool GxFont_GFX_TFT_eSPI::nextLayoutGlyph(const TextLayout& layout, LayoutCursor& cur, uint16_t& code, int32_t& index)
+{
+  if (cur.run < layout.count)
+  {
+    code  = layout.runs[cur.run].code;
+    cur.x = layout.runs[cur.run++].x;
+    index = gfxGlyphIndex(code);
+    return true;
+  }
+  if (cur.pos >= cur.len) return false;
+
+  const char *string = layout.string;
+  code  = gfxFontEx() ? decodeUTF8((uint8_t *)string, &cur.pos, cur.len - cur.pos) : (uint8_t)string[cur.pos++];
+  index = gfxGlyphIndex(code);
+  cur.x = cur.next;
+  if (index >= 0)
+  {
+    GFXglyph *glyph = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[index]);
+    cur.next += pgm_read_byte(&glyph->xAdvance) * textsize;
+  }
+  return true;
+}
+#endif
+
+
 /***************************************************************************************
 ** Function name:           fontsLoaded
 ** Description:             return an encoded 16 bit value showing the fonts loaded
@@ -366,229 +574,189 @@ int16_t GxFont_GFX_TFT_eSPI::fontHeight(int16_t font)
 }
 
 
+#ifdef RLE_ROW_INDEX
 /***************************************************************************************
-** Function name:           drawChar
-** Description:             draw a single character in the Adafruit GLCD font
+** Function name:           rleRowSeek
+** Description:             skip the RLE glyph rows above the clip rectangle with the row index
 ***************************************************************************************/
-void GxFont_GFX_TFT_eSPI::drawChar(int32_t x, int32_t y, unsigned char c, uint32_t color, uint32_t bg, uint8_t size)
+// Returns the pixel the decoding starts at and moves flash_address to the run holding it
+int GxFont_GFX_TFT_eSPI::rleRowSeek(uint8_t font, uint16_t code, int32_t y, int width, int height, uintptr_t& flash_address)
 {
-  DIAG (Serial.print("GxFont_GFX_TFT_eSPI::drawChar("); Serial.print(c); Serial.println(") GLCD");)
-  if ((x >= (int16_t)_width)            || // Clip right
-      (y >= (int16_t)_height)           || // Clip bottom
-      ((x + 6 * size - 1) < 0) || // Clip left
-      ((y + 8 * size - 1) < 0))   // Clip top
-    return;
-
-  if (c < 32) return;
-#ifdef LOAD_GLCD
-  //>>>>>>>>>>>>>>>>>>
-#ifdef LOAD_GFXFF
-  if (!gfxFont) { // 'Classic' built-in font
+  uint8_t step = pgm_read_byte(&fontdata[font].rowstep);
+  if (!step || !width || (clipY0 <= y)) return 0;
+
+  int entries = (height - 1) / step;
+  int k = (clipY0 - y) / textsize / step; // Index entries above the first visible row
+  if (k > entries) k = entries;
+  if (!k) return 0;
+
+  const uint8_t* rowtbl = (const uint8_t*)pgm_read_dword(&fontdata[font].rowtbl);
+  const uint8_t* entry = rowtbl + 96 + (pgm_read_byte(rowtbl + code) * entries + k - 1) * 3;
+  flash_address += pgm_read_byte(entry) | (pgm_read_byte(entry + 1) << 8);
+  return k * step * width - pgm_read_byte(entry + 2);
+}
 #endif
-    //>>>>>>>>>>>>>>>>>>
-
-    DIAG (Serial.print("GxFont_GFX_TFT_eSPI::drawChar("); Serial.print(c); Serial.println(") GLCD .");)
-    boolean fillbg = (bg != color);
 
-    if ((size == 1) && fillbg)
-    {
-      DIAG (Serial.print("GxFont_GFX_TFT_eSPI::drawChar("); Serial.print(c); Serial.println(") GLCD 1");)
-      uint8_t column[6];
-      uint8_t mask = 0x1;
-      //setAddrWindow(x, y, x + 5, y + 8);
-      for (int8_t i = 0; i < 5; i++ ) column[i] = pgm_read_byte(font + (c * 5) + i);
-      column[5] = 0;
-
-      for (int8_t j = 0; j < 8; j++)
-      {
-        for (int8_t k = 0; k < 5; k++ )
-        {
-          if (column[k] & mask)
-          {
-            //tft_Write_16(color);
-            drawPixel(x + k, y + j, color);
-          }
-          else
-          {
-            //tft_Write_16(bg);
-            drawPixel(x + k, y + j, bg);
-          }
-        }
-        mask <<= 1;
-        //tft_Write_16(bg);
-        drawPixel(x + 5, y + j, bg);
-      }
-    }
-    else
-    {
-      DIAG (Serial.print("GxFont_GFX_TFT_eSPI::drawChar("); Serial.print(c); Serial.println(") GLCD 2");)
-      for (int8_t i = 0; i < 6; i++ ) {
-        uint8_t line;
-        if (i == 5)
-          line = 0x0;
-        else
-          line = pgm_read_byte(font + (c * 5) + i);
 
-        if (size == 1) // default size
-        {
-          for (int8_t j = 0; j < 8; j++) {
-            if (line & 0x1) drawPixel(x + i, y + j, color);
-            line >>= 1;
-          }
-        }
-        else {  // big size
-          for (int8_t j = 0; j < 8; j++) {
-            if (line & 0x1) fillRect(x + (i * size), y + (j * size), size, size, color);
-            else if (fillbg) fillRect(x + i * size, y + j * size, size, size, bg);
-            line >>= 1;
-          }
-        }
-      }
-    }
+/***************************************************************************************
+** Function name:           sinkPixel, sinkRect, sinkBitmap
+** Description:             renderer access to drawPixel(), fillRect() and drawBitmap1bpp()
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::sinkPixel(int32_t x, int32_t y, uint32_t color)
+{
+  if ((x < clipX0) || (x >= clipX1) || (y < clipY0) || (y >= clipY1)) return;
+  STATS(countCall(&renderStats.drawPixel, 1, color);)
+  drawPixel(x, y, color);
+}
 
-    //>>>>>>>>>>>>>>>>>>>>>>>>>>>
-#ifdef LOAD_GFXFF
-  } else { // Custom font
+void GxFont_GFX_TFT_eSPI::sinkRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+#ifdef DISPLAY_LIST
+  if (recordCommand(DL_FILL, 0, x, y, color, color, 1, x, y, w, h)) return;
 #endif
-    //>>>>>>>>>>>>>>>>>>>>>>>>>>>
-#endif // LOAD_GLCD
+  if (!clipBox(x, y, w, h)) return;
+  STATS(countCall(&renderStats.fillRect, w * h, color);)
+  fillRect(x, y, w, h, color);
+}
 
-#ifdef LOAD_GFXFF
-    DIAG (Serial.print("GxFont_GFX_TFT_eSPI::drawChar("); Serial.print(c); Serial.println(") GLCD 3");)
-    // Filter out bad characters not present in font
-    if ((c >= (uint8_t)pgm_read_byte(&gfxFont->first)) && (c <= (uint8_t)pgm_read_byte(&gfxFont->last )))
-    {
-      //>>>>>>>>>>>>>>>>>>>>>>>>>>>
-
-      c -= pgm_read_byte(&gfxFont->first);
-      GFXglyph *glyph  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[c]);
-      uint8_t  *bitmap = (uint8_t *)pgm_read_dword(&gfxFont->bitmap);
-
-      uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
-      uint8_t  w  = pgm_read_byte(&glyph->width),
-               h  = pgm_read_byte(&glyph->height),
-               xa = pgm_read_byte(&glyph->xAdvance);
-      int8_t   xo = pgm_read_byte(&glyph->xOffset),
-               yo = pgm_read_byte(&glyph->yOffset);
-      uint8_t  xx, yy, bits, bit = 0;
-      int16_t  xo16 = 0, yo16 = 0;
-
-      if (size > 1) {
-        xo16 = xo;
-        yo16 = yo;
-      }
+bool GxFont_GFX_TFT_eSPI::sinkBitmap(int32_t x, int32_t y, int32_t w, int32_t h, int32_t rowBytes,
+                                     const uint8_t* data, uint32_t fg, uint32_t bg, bool opaque)
+{
+  // Glyphs crossing the clip edge are drawn as runs, which are trimmed
+  if ((x < clipX0) || (x + w > clipX1) || (y < clipY0) || (y + h > clipY1)) return false;
+  if (!drawBitmap1bpp(x, y, w, h, rowBytes, data, fg, bg, opaque)) return false;
+#ifdef RENDER_STATS
+  uint32_t set = 0; // Count the foreground pixels
+  for (int32_t i = 0; i < rowBytes * h; i++)
+    for (uint8_t b = data[i]; b; b &= b - 1) set++;
+  countCall(&renderStats.drawBitmap1bpp, set, fg);
+  if (opaque) countCall(NULL, w * h - set, bg);
+#endif
+  return true;
+}
 
-      // Here we have 3 versions of the same function just for evaluation purposes
-      // Comment out the next two #defines to revert to the slower Adafruit implementation
 
-      // If FAST_LINE is defined then the free fonts are rendered using horizontal lines
-      // this makes rendering fonts 2-5 times faster. Particularly good for large fonts.
-      // This is an elegant solution since it still uses generic functions present in the
-      // stock library.
+#ifdef RENDER_STATS
+/***************************************************************************************
+** Function name:           getRenderStats
+** Description:             return the counters of calls made into the subclass
+***************************************************************************************/
+const GxFont_GFX_TFT_eSPI::RenderStats& GxFont_GFX_TFT_eSPI::getRenderStats(void) const
+{
+  return renderStats;
+}
 
-      // If FAST_SHIFT is defined then a slightly faster (at least for AVR processors)
-      // shifting bit mask is used
 
-      // Free fonts don't look good when the size multiplier is >1 so we could remove
-      // code if this is not wanted and speed things up
+/***************************************************************************************
+** Function name:           resetRenderStats
+** Description:             clear the render counters
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::resetRenderStats(void)
+{
+  memset(&renderStats, 0, sizeof(renderStats));
+  statsOverdraw = false;
+}
 
-#define FAST_HLINE
-#define FAST_SHIFT
-      //FIXED_SIZE is an option in User_Setup.h that only works with FAST_LINE enabled
 
-#ifdef FIXED_SIZE
-      x += xo; // Save 88 bytes of FLASH
-      y += yo;
+/***************************************************************************************
+** Function name:           countCall
+** Description:             count a call and the pixels it covers
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::countCall(uint32_t *counter, uint32_t pixels, uint32_t color)
+{
+  if (counter) (*counter)++;
+  renderStats.pixels += pixels;
+  if (statsOverdraw && (color != textbgcolor)) renderStats.overdraw += pixels;
+}
 #endif
 
-#ifdef FAST_HLINE
 
-#ifdef FAST_SHIFT
-      uint16_t hpc = 0; // Horizontal foreground pixel count
-      for (yy = 0; yy < h; yy++) {
-        for (xx = 0; xx < w; xx++) {
-          if (bit == 0) {
-            bits = pgm_read_byte(&bitmap[bo++]);
-            bit  = 0x80;
-          }
-          if (bits & bit) hpc++;
-          else {
-            if (hpc) {
-#ifndef FIXED_SIZE
-              if (size == 1) drawFastHLine(x + xo + xx - hpc, y + yo + yy, hpc, color);
-              else fillRect(x + (xo16 + xx - hpc)*size, y + (yo16 + yy)*size, size * hpc, size, color);
-#else
-              drawFastHLine(x + xx - hpc, y + yy, hpc, color);
-#endif
-              hpc = 0;
-            }
-          }
-          bit >>= 1;
-        }
-        // Draw pixels for this line as we are about to increment yy
-        if (hpc) {
-#ifndef FIXED_SIZE
-          if (size == 1) drawFastHLine(x + xo + xx - hpc, y + yo + yy, hpc, color);
-          else fillRect(x + (xo16 + xx - hpc)*size, y + (yo16 + yy)*size, size * hpc, size, color);
-#else
-          drawFastHLine(x + xx - hpc, y + yy, hpc, color);
-#endif
-          hpc = 0;
-        }
-      }
-#else
-      uint16_t hpc = 0; // Horizontal foreground pixel count
-      for (yy = 0; yy < h; yy++) {
-        for (xx = 0; xx < w; xx++) {
-          if (!(bit++ & 7)) {
-            bits = pgm_read_byte(&bitmap[bo++]);
-          }
-          if (bits & 0x80) hpc++;
-          else {
-            if (hpc) {
-              if (size == 1) drawFastHLine(x + xo + xx - hpc, y + yo + yy, hpc, color);
-              else fillRect(x + (xo16 + xx - hpc)*size, y + (yo16 + yy)*size, size * hpc, size, color);
-              hpc = 0;
-            }
-          }
-          bits <<= 1;
-        }
-        // Draw pixels for this line as we are about to increment yy
-        if (hpc) {
-          if (size == 1) drawFastHLine(x + xo + xx - hpc, y + yo + yy, hpc, color);
-          else fillRect(x + (xo16 + xx - hpc)*size, y + (yo16 + yy)*size, size * hpc, size, color);
-          hpc = 0;
-        }
-      }
-#endif
+/***************************************************************************************
+** Function name:           drawSpans
+** Description:             draw a batch of same colour runs, subclasses may override
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::drawSpans(const Span* spans, size_t n, uint32_t color)
+{
+  while (n--)
+  {
+    if (spans->h == 1)
+    {
+      STATS(renderStats.drawFastHLine++;)
+      drawFastHLine(spans->x, spans->y, spans->w, color);
+    }
+    else
+    {
+      STATS(renderStats.fillRect++;)
+      fillRect(spans->x, spans->y, spans->w, spans->h, color);
+    }
+    spans++;
+  }
+}
 
-#else
-      for (yy = 0; yy < h; yy++) {
-        for (xx = 0; xx < w; xx++) {
-          if (!(bit++ & 7)) {
-            bits = pgm_read_byte(&bitmap[bo++]);
-          }
-          if (bits & 0x80) {
-            if (size == 1) {
-              drawPixel(x + xo + xx, y + yo + yy, color);
-            } else {
-              fillRect(x + (xo16 + xx)*size, y + (yo16 + yy)*size, size, size, color);
-            }
-          }
-          bits <<= 1;
-        }
-      }
-#endif
+
+/***************************************************************************************
+** Function name:           addSpan
+** Description:             queue a run for drawSpans(), buffer 0 = foreground, 1 = background
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::addSpan(uint8_t buf, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  if (!clipBox(x, y, w, h)) return;
+  uint16_t n = spanCount[buf];
+  if (n && ((n == SPAN_BUFFER_SIZE) || (spanColor[buf] != color)))
+  {
+    STATS(renderStats.drawSpans++;)
+    drawSpans(spanBuffer[buf], n, spanColor[buf]);
+    n = 0;
+  }
+  STATS(renderStats.spans++; countCall(NULL, w * h, color);)
+  Span* s = &spanBuffer[buf][n];
+  s->x = x;
+  s->y = y;
+  s->w = w;
+  s->h = h;
+  spanColor[buf] = color;
+  spanCount[buf] = n + 1;
+}
+
+
+/***************************************************************************************
+** Function name:           flushSpans
+** Description:             pass all queued runs to drawSpans(), background first
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::flushSpans(void)
+{
+  for (int8_t buf = 1; buf >= 0; buf--)
+  {
+    if (spanCount[buf])
+    {
+      STATS(renderStats.drawSpans++;)
+      drawSpans(spanBuffer[buf], spanCount[buf], spanColor[buf]);
+      spanCount[buf] = 0;
     }
-#endif
+  }
+}
 
 
-#ifdef LOAD_GLCD
-#ifdef LOAD_GFXFF
-  } // End classic vs custom font
-#endif
-#endif
+/***************************************************************************************
+** Function name:           drawBitmap1bpp
+** Description:             packed glyph blit, not supported unless overridden by subclass
+***************************************************************************************/
+bool GxFont_GFX_TFT_eSPI::drawBitmap1bpp(int32_t, int32_t, int32_t, int32_t, int32_t,
+                                         const uint8_t*, uint32_t, uint32_t, bool)
+{
+  bitmap1bpp = false; // Stop packing glyphs for this sink
+  return false;
+}
+
 
+/***************************************************************************************
+** Function name:           drawChar
+** Description:             draw a single character in the Adafruit GLCD font
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size)
+{
+  VirtualSink sink = { this };
+  renderChar(sink, x, y, c, color, bg, size);
 }
 
 
@@ -630,6 +798,92 @@ uint16_t GxFont_GFX_TFT_eSPI::color8to16(uint8_t color)
   return color16;
 }
 
+/***************************************************************************************
+** Function name:           decodeUTF8
+** Description:             Line buffer UTF-8 decoder with fall-back to extended ASCII
+*************************************************************************************x*/
+#define DECODE_UTF8
+uint16_t GxFont_GFX_TFT_eSPI::decodeUTF8(uint8_t *buf, uint16_t *index, uint16_t remaining)
+{
+  byte c = buf[(*index)++];
+  //Serial.print("Byte from string = 0x"); Serial.println(c, HEX);
+
+#ifdef DECODE_UTF8
+  // 7 bit Unicode
+  if ((c & 0x80) == 0x00) return c;
+
+  // 11 bit Unicode
+  if (((c & 0xE0) == 0xC0) && (remaining > 1))
+    return ((c & 0x1F)<<6) | (buf[(*index)++]&0x3F);
+
+  // 16 bit Unicode
+  if (((c & 0xF0) == 0xE0) && (remaining > 2))
+  {
+    // Separate statements, the order of two (*index)++ in one expression is unspecified
+    uint16_t unicode = (c & 0x0F)<<12;
+    unicode |= (buf[(*index)++]&0x3F)<<6;
+    return unicode | (buf[(*index)++]&0x3F);
+  }
+
+  // 21 bit Unicode not supported so fall-back to extended ASCII
+  // if ((c & 0xF8) == 0xF0) return c;
+#endif
+
+  return c; // fall-back to extended ASCII
+}
+
+/***************************************************************************************
+** Function name:           decodeUTF8
+** Description:             Serial UTF-8 decoder with fall-back to extended ASCII
+*************************************************************************************x*/
+uint16_t GxFont_GFX_TFT_eSPI::decodeUTF8(uint8_t c)
+{
+
+#ifdef DECODE_UTF8
+  if (decoderState == 0)
+  {
+    // 7 bit Unicode
+    if ((c & 0x80) == 0x00) return (uint16_t)c;
+
+    // 11 bit Unicode
+    if ((c & 0xE0) == 0xC0)
+    {
+      decoderBuffer = ((c & 0x1F)<<6);
+      decoderState = 1;
+      return 0;
+    }
+
+    // 16 bit Unicode
+    if ((c & 0xF0) == 0xE0)
+    {
+      decoderBuffer = ((c & 0x0F)<<12);
+      decoderState = 2;
+      return 0;
+    }
+    // 21 bit Unicode not supported so fall-back to extended ASCII
+    if ((c & 0xF8) == 0xF0) return (uint16_t)c;
+  }
+  else
+  {
+    if (decoderState == 2)
+    {
+      decoderBuffer |= ((c & 0x3F)<<6);
+      decoderState--;
+      return 0;
+    }
+    else
+    {
+      decoderBuffer |= (c & 0x3F);
+      decoderState = 0;
+      return decoderBuffer;
+    }
+  }
+#endif
+
+  return (uint16_t)c; // fall-back to extended ASCII
+}
+
+
 /***************************************************************************************
 ** Function name:           write
 ** Description:             draw characters piped through serial stream
@@ -747,10 +1001,15 @@ size_t GxFont_GFX_TFT_eSPI::write(uint8_t utf8)
       cursor_y += (int16_t)textsize *
                   (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
     } else {
-      if (uniCode > (uint8_t)pgm_read_byte(&gfxFont->last )) return 0;
-      if (uniCode < (uint8_t)pgm_read_byte(&gfxFont->first)) return 0;
+      uint16_t code = uniCode;
+      if (gfxFontEx())
+      {
+        code = decodeUTF8(utf8);
+        if (!code) return 1; // More bytes of the UTF-8 sequence to come
+      }
+      int32_t c2 = gfxGlyphIndex(code);
+      if (c2 < 0) return 0;
 
-      uint8_t   c2    = uniCode - pgm_read_byte(&gfxFont->first);
       GFXglyph *glyph = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[c2]);
       uint8_t   w     = pgm_read_byte(&glyph->width),
                 h     = pgm_read_byte(&glyph->height);
@@ -763,7 +1022,7 @@ size_t GxFont_GFX_TFT_eSPI::write(uint8_t utf8)
                       (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
         }
         if (textwrapY && (cursor_y >= _height)) cursor_y = 0;
-        drawChar(cursor_x, cursor_y, uniCode, textcolor, textbgcolor, textsize);
+        drawChar(cursor_x, cursor_y, code, textcolor, textbgcolor, textsize);
       }
       cursor_x += pgm_read_byte(&glyph->xAdvance) * (int16_t)textsize;
     }
@@ -786,280 +1045,8 @@ int16_t GxFont_GFX_TFT_eSPI::drawChar(unsigned int uniCode, int x, int y)
 
 int16_t GxFont_GFX_TFT_eSPI::drawChar(unsigned int uniCode, int x, int y, int font)
 {
-  DIAG (Serial.print("GxFont_GFX_TFT_eSPI::drawChar("); Serial.print(uniCode); Serial.println(") uniCode");)
-  if (font == 1)
-  {
-#ifdef LOAD_GLCD
-#ifndef LOAD_GFXFF
-    drawChar(x, y, uniCode, textcolor, textbgcolor, textsize);
-    return 6 * textsize;
-#endif
-#else
-#ifndef LOAD_GFXFF
-    return 0;
-#endif
-#endif
-
-#ifdef LOAD_GFXFF
-    drawChar(x, y, uniCode, textcolor, textbgcolor, textsize);
-    if (!gfxFont) { // 'Classic' built-in font
-#ifdef LOAD_GLCD
-      return 6 * textsize;
-#else
-      return 0;
-#endif
-    }
-    else
-    {
-      if ((uniCode >= pgm_read_byte(&gfxFont->first)) && (uniCode <= pgm_read_byte(&gfxFont->last) ))
-      {
-        uint8_t   c2    = uniCode - pgm_read_byte(&gfxFont->first);
-        GFXglyph *glyph = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[c2]);
-        return pgm_read_byte(&glyph->xAdvance) * textsize;
-      }
-      else
-      {
-        return 0;
-      }
-    }
-#endif
-  }
-
-  if ((font > 1) && (font < 9) && ((uniCode < 32) || (uniCode > 127))) return 0;
-
-  int width  = 0;
-  int height = 0;
-  uint32_t flash_address = 0;
-  uniCode -= 32;
-
-#ifdef LOAD_FONT2
-  if (font == 2)
-  {
-    // This is faster than using the fontdata structure
-    flash_address = pgm_read_dword(&chrtbl_f16[uniCode]);
-    width = pgm_read_byte(widtbl_f16 + uniCode);
-    height = chr_hgt_f16;
-  }
-#ifdef LOAD_RLE
-  else
-#endif
-#endif
-
-#ifdef LOAD_RLE
-  {
-    if ((font > 2) && (font < 9))
-    {
-      // This is slower than above but is more convenient for the RLE fonts
-      flash_address = pgm_read_dword( pgm_read_dword( &(fontdata[font].chartbl ) ) + uniCode * sizeof(void *) );
-      width = pgm_read_byte( (uint8_t *)pgm_read_dword( &(fontdata[font].widthtbl ) ) + uniCode );
-      height = pgm_read_byte( &fontdata[font].height );
-    }
-  }
-#endif
-
-  int w = width;
-  int pX      = 0;
-  int pY      = y;
-  uint8_t line = 0;
-
-#ifdef LOAD_FONT2 // chop out code if we do not need it
-  if (font == 2)
-  {
-    w = w + 6; // Should be + 7 but we need to compensate for width increment
-    w = w / 8;
-    if (x + width * textsize >= (int16_t)_width) return width * textsize ;
-
-    if (textcolor == textbgcolor || textsize != 1)
-    {
-      for (int i = 0; i < height; i++)
-      {
-        if (textcolor != textbgcolor) fillRect(x, pY, width * textsize, textsize, textbgcolor);
-
-        for (int k = 0; k < w; k++)
-        {
-          line = pgm_read_byte((uint8_t *)flash_address + w * i + k);
-          if (line)
-          {
-            if (textsize == 1)
-            {
-              pX = x + k * 8;
-              if (line & 0x80) drawPixel(pX, pY, textcolor);
-              if (line & 0x40) drawPixel(pX + 1, pY, textcolor);
-              if (line & 0x20) drawPixel(pX + 2, pY, textcolor);
-              if (line & 0x10) drawPixel(pX + 3, pY, textcolor);
-              if (line & 0x08) drawPixel(pX + 4, pY, textcolor);
-              if (line & 0x04) drawPixel(pX + 5, pY, textcolor);
-              if (line & 0x02) drawPixel(pX + 6, pY, textcolor);
-              if (line & 0x01) drawPixel(pX + 7, pY, textcolor);
-            }
-            else
-            {
-              pX = x + k * 8 * textsize;
-              if (line & 0x80) fillRect(pX, pY, textsize, textsize, textcolor);
-              if (line & 0x40) fillRect(pX + textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x20) fillRect(pX + 2 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x10) fillRect(pX + 3 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x08) fillRect(pX + 4 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x04) fillRect(pX + 5 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x02) fillRect(pX + 6 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x01) fillRect(pX + 7 * textsize, pY, textsize, textsize, textcolor);
-            }
-          }
-        }
-        pY += textsize;
-      }
-    }
-    else
-    {
-      // Faster drawing of characters and background using block write
-      //setAddrWindow(x, y, (x + w * 8) - 1, y + height - 1);
-
-      uint8_t mask;
-      for (int i = 0; i < height; i++)
-      {
-        for (int k = 0; k < w; k++)
-        {
-          line = pgm_read_byte((uint8_t *)flash_address + w * i + k);
-          pX = x + k * 8;
-          mask = 0x80;
-          while (mask)
-          {
-            if (line & mask)
-            {
-              //tft_Write_16(textcolor);
-              drawPixel(x + k, y + i, textcolor);
-            }
-            else
-            {
-              //tft_Write_16(textbgcolor);
-              drawPixel(x + k, y + i, textbgcolor);
-            }
-            mask = mask >> 1;
-          }
-        }
-        pY += textsize;
-      }
-    }
-  }
-
-#ifdef LOAD_RLE
-  else
-#endif
-#endif  //FONT2
-
-#ifdef LOAD_RLE  //674 bytes of code
-    // Font is not 2 and hence is RLE encoded
-  {
-    w *= height; // Now w is total number of pixels in the character
-    if ((textsize != 1) || (textcolor == textbgcolor))
-    {
-      if (textcolor != textbgcolor) fillRect(x, pY, width * textsize, textsize * height, textbgcolor);
-      int px = 0, py = pY; // To hold character block start and end column and row values
-      int pc = 0; // Pixel count
-      uint8_t np = textsize * textsize; // Number of pixels in a drawn pixel
-
-      uint8_t tnp = 0; // Temporary copy of np for while loop
-      uint8_t ts = textsize - 1; // Temporary copy of textsize
-      // 16 bit pixel count so maximum font size is equivalent to 180x180 pixels in area
-      // w is total number of pixels to plot to fill character block
-      while (pc < w)
-      {
-        line = pgm_read_byte((uint8_t *)flash_address);
-        flash_address++;
-        if (line & 0x80)
-        {
-          line &= 0x7F;
-          line++;
-          if (ts)
-          {
-            px = x + textsize * (pc % width); // Keep these px and py calculations outside the loop as they are slow
-            py = y + textsize * (pc / width);
-          }
-          else
-          {
-            px = x + pc % width; // Keep these px and py calculations outside the loop as they are slow
-            py = y + pc / width;
-          }
-          while (line--)
-          { // In this case the while(line--) is faster
-            pc++; // This is faster than putting pc+=line before while()?
-            //setAddrWindow(px, py, px + ts, py + ts);
-
-            if (ts)
-            {
-              tnp = np;
-              while (tnp--)
-              {
-                //tft_Write_16(textcolor);
-                fillRect(px, py, ts, ts, textcolor);
-              }
-            }
-            else
-            {
-              //tft_Write_16(textcolor);
-              drawPixel(px, py, textcolor);
-            }
-            px += textsize;
-
-            if (px >= (x + width * textsize))
-            {
-              px = x;
-              py += textsize;
-            }
-          }
-        }
-        else
-        {
-          line++;
-          pc += line;
-        }
-      }
-    }
-    else // Text colour != background && textsize = 1
-    {
-      // so use faster drawing of characters and background using block write
-      //setAddrWindow(x, y, x + width - 1, y + height - 1);
-      int dx = 0;
-      int dy = 0;
-
-      uint8_t textcolorBin[] = { (uint8_t) (textcolor >> 8), (uint8_t) textcolor };
-      uint8_t textbgcolorBin[] = { (uint8_t) (textbgcolor >> 8), (uint8_t) textbgcolor };
-
-      // Maximum font size is equivalent to 180x180 pixels in area
-      while (w > 0)
-      {
-        line = pgm_read_byte((uint8_t *)flash_address++); // 8 bytes smaller when incrementing here
-        if (line & 0x80)
-        {
-          line &= 0x7F;
-          line++;
-          w -= line;
-          drawFastHLine(x + dx, y + dy, line, textcolor);
-          dx += line;
-          if (dx >= width)
-          {
-            dy += dx / width;
-            dx %= dx;
-          }
-        }
-        else
-        {
-          line++;
-          w -= line;
-          drawFastHLine(x + dx, y + dy, line, textbgcolor);
-          dx += line;
-          if (dx >= width)
-          {
-            dy += dx / width;
-            dx %= dx;
-          }
-        }
-      }
-    }
-  }
-  // End of RLE font rendering
-#endif
-  return width * textsize;    // x +
+  VirtualSink sink = { this };
+  return renderChar(sink, uniCode, x, y, font);
 }
 
 
@@ -1092,9 +1079,26 @@ int16_t GxFont_GFX_TFT_eSPI::drawString(const char *string, int poX, int poY)
 // With font number
 int16_t GxFont_GFX_TFT_eSPI::drawString(const char *string, int poX, int poY, int font)
 {
+  TextRun runs[16]; // drawLayout() takes the characters of longer strings from the string
+  TextLayout layout = {};
+  layout.runs     = runs;
+  layout.capacity = sizeof(runs) / sizeof(runs[0]);
+  layoutString(string, layout, font);
+  return drawLayout(layout, poX, poY);
+}
+
+
+/***************************************************************************************
+** Function name:           drawLayout
+** Description :            draw a string resolved by layoutString() with padding if defined
+***************************************************************************************/
+int16_t GxFont_GFX_TFT_eSPI::drawLayout(const TextLayout& layout, int poX, int poY)
+{
+  const char *string = layout.string;
+  int font = layout.font;
   int16_t sumX = 0;
   uint8_t padding = 1, baseline = 0;
-  uint16_t cwidth = textWidth(string, font); // Find the pixel width of the string in the font
+  uint16_t cwidth = layout.width; // The pixel width of the string in the font
   uint16_t cheight = 8 * textsize;
 
 #ifdef LOAD_GFXFF
@@ -1191,24 +1195,41 @@ int16_t GxFont_GFX_TFT_eSPI::drawString(const char *string, int poX, int poY, in
 
 
   int8_t xo = 0;
+#if defined (LOAD_GFXFF) && defined (GFX_SINGLE_PASS) && !defined (FIXED_SIZE)
+  bool singlePass = false;
+#endif
 #ifdef LOAD_GFXFF
   if ((font == 1) && (gfxFont) && (textcolor != textbgcolor))
   {
     cheight = (glyph_ab + glyph_bb) * textsize;
-    // Get the offset for the first character only to allow for negative offsets
-    uint8_t   c2    = *string;
-    if ((c2 >= pgm_read_byte(&gfxFont->first)) && (c2 <= pgm_read_byte(&gfxFont->last) ))
+    // Use the offset for the first character only to allow for negative offsets
+    uint16_t  c2    = layout.count ? layout.runs[0].code : (uint8_t)*string;
+    if (gfxGlyphIndex(c2) >= 0)
     {
-      c2 -= pgm_read_byte(&gfxFont->first);
-      GFXglyph *glyph = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[c2]);
-      xo = pgm_read_byte(&glyph->xOffset) * textsize;
+      xo = layout.xo;
       // Adjust for negative xOffset
       if (xo > 0) xo = 0;
       else cwidth -= xo;
       // Add 1 pixel of padding all round
       //cheight +=2;
       //fillRect(poX+xo-1, poY - 1 - glyph_ab * textsize, cwidth+2, cheight, textbgcolor);
-      fillRect(poX + xo, poY - glyph_ab * textsize, cwidth, cheight, textbgcolor);
+#if defined (GFX_SINGLE_PASS) && !defined (FIXED_SIZE)
+      singlePass = true; // Background and glyphs are drawn together below
+#ifdef DISPLAY_LIST
+      singlePass = !displayListRecording; // Record the box and the glyphs as separate commands
+#endif
+#ifdef GFX_SPANS
+      if (gfxSpans) singlePass = false; // The row assembly reads bitmaps, not spans
+#endif
+#ifdef GFX_PACKED
+      if (gfxPacked) singlePass = false;
+#endif
+      if (!singlePass)
+#endif
+      {
+        sinkRect(poX + xo, poY - glyph_ab * textsize, cwidth, cheight, textbgcolor);
+        STATS(statsOverdraw = true;)
+      }
     }
     padding -= 100;
   }
@@ -1217,7 +1238,8 @@ int16_t GxFont_GFX_TFT_eSPI::drawString(const char *string, int poX, int poY, in
 #ifdef SMOOTH_FONT
   if (fontLoaded)
   {
-    if (textcolor != textbgcolor) fillRect(poX, poY, cwidth, cheight, textbgcolor);
+    if (textcolor != textbgcolor) sinkRect(poX, poY, cwidth, cheight, textbgcolor);
+    STATS(statsOverdraw = (textcolor != textbgcolor);)
     //drawLine(poX - 5, poY, poX + 5, poY, TFT_GREEN);
     //drawLine(poX, poY - 5, poX, poY + 5, TFT_GREEN);
     //fontFile = SPIFFS.open( _gFontFilename, "r");
@@ -1235,7 +1257,35 @@ int16_t GxFont_GFX_TFT_eSPI::drawString(const char *string, int poX, int poY, in
   }
   else
 #endif
-    while (*string) sumX += drawChar(*(string++), poX + sumX, poY, font);
+#if defined (LOAD_GFXFF) && defined (GFX_SINGLE_PASS) && !defined (FIXED_SIZE)
+  if (singlePass)
+  {
+    VirtualSink sink = { this };
+    RowMerger<VirtualSink> merge(this, sink);
+    gfxStringKernel(merge, layout, poX, poY, xo, cwidth);
+    sumX = layout.advance;
+  }
+  else
+#endif
+  {
+    for (uint16_t i = 0; i < layout.count; i++) drawChar(layout.runs[i].code, poX + layout.runs[i].x, poY, font);
+
+    // Decode the characters that did not fit in the runs, drawChar() returns the same advance
+    uint16_t len = strlen(string), n = layout.tail;
+    int16_t  x = layout.tailX;
+    bool     utf8 = false;
+#ifdef LOAD_GFXFF
+    utf8 = (font == 1) && gfxFont && gfxFontEx();
+#endif
+    while (n < len)
+    {
+      uint16_t code = utf8 ? decodeUTF8((uint8_t *)string, &n, len - n) : (uint8_t)string[n++];
+      x += drawChar(code, poX + x, poY, font);
+    }
+    sumX = layout.advance;
+  }
+
+  STATS(statsOverdraw = false;)
 
   //vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv DEBUG vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv
   // Switch on debugging for the padding areas
@@ -1256,17 +1306,17 @@ int16_t GxFont_GFX_TFT_eSPI::drawString(const char *string, int poX, int poY, in
 #endif
     switch (padding) {
       case 1:
-        fillRect(padXc, poY, padX - cwidth, cheight, textbgcolor);
+        sinkRect(padXc, poY, padX - cwidth, cheight, textbgcolor);
         break;
       case 2:
-        fillRect(padXc, poY, (padX - cwidth) >> 1, cheight, textbgcolor);
+        sinkRect(padXc, poY, (padX - cwidth) >> 1, cheight, textbgcolor);
         padXc = (padX - cwidth) >> 1;
         if (padXc > poX) padXc = poX;
-        fillRect(poX - padXc, poY, (padX - cwidth) >> 1, cheight, textbgcolor);
+        sinkRect(poX - padXc, poY, (padX - cwidth) >> 1, cheight, textbgcolor);
         break;
       case 3:
         if (padXc > padX) padXc = padX;
-        fillRect(poX + cwidth - padXc, poY, padXc - cwidth, cheight, textbgcolor);
+        sinkRect(poX + cwidth - padXc, poY, padXc - cwidth, cheight, textbgcolor);
         break;
     }
   }
@@ -1341,6 +1391,19 @@ int16_t GxFont_GFX_TFT_eSPI::drawFloat(float floatNumber, int dp, int poX, int p
 int16_t GxFont_GFX_TFT_eSPI::drawFloat(float floatNumber, int dp, int poX, int poY, int font)
 {
   char str[14];               // Array to contain decimal string
+  formatFloat(floatNumber, dp, str);
+
+  // Finally we can plot the string and return pixel length
+  return drawString(str, poX, poY, font);
+}
+
+
+/***************************************************************************************
+** Function name:           formatFloat
+** Descriptions:            write the string drawFloat() draws, str must hold 14 characters
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::formatFloat(float floatNumber, int dp, char *str)
+{
   uint8_t ptr = 0;            // Initialise pointer for array
   int8_t  digits = 1;         // Count the digits to avoid array overflow
   float rounding = 0.5;       // Round up down delta
@@ -1363,7 +1426,7 @@ int16_t GxFont_GFX_TFT_eSPI::drawFloat(float floatNumber, int dp, int poX, int p
   // For error put ... in string and return (all GxFont_GFX_TFT_eSPI library fonts contain . character)
   if (floatNumber >= 2147483647) {
     strcpy(str, "...");
-    return drawString(str, poX, poY, font);
+    return;
   }
   // No chance of overflow from here on
 
@@ -1396,9 +1459,6 @@ int16_t GxFont_GFX_TFT_eSPI::drawFloat(float floatNumber, int dp, int poX, int p
     ptr++; digits++;         // Increment pointer and digits count
     floatNumber -= temp;     // Remove that digit
   }
-
-  // Finally we can plot the string and return pixel length
-  return drawString(str, poX, poY, font);
 }
 
 
@@ -1411,22 +1471,164 @@ int16_t GxFont_GFX_TFT_eSPI::drawFloat(float floatNumber, int dp, int poX, int p
 
 void GxFont_GFX_TFT_eSPI::setFreeFont(const GFXfont *f)
 {
+  if (!f) // Back to the GLCD font
+  {
+    setTextFont(1);
+    return;
+  }
+
   textfont = 1;
   gfxFont = (GFXfont *)f;
+#ifdef GFX_SPANS
+  gfxSpans = false;
+#endif
+#ifdef GFX_PACKED
+  gfxPacked = false;
+#endif
 
-  glyph_ab = 0;
-  glyph_bb = 0;
-  uint8_t numChars = pgm_read_byte(&gfxFont->last) - pgm_read_byte(&gfxFont->first);
+  // Fonts met before are not scanned again
+  const GFXmetrics *m = gfxFontMetrics(gfxFont);
+  glyph_ab = m->ascent;
+  glyph_bb = m->descent;
+}
 
-  // Find the biggest above and below baseline offsets
-  for (uint8_t c = 0; c < numChars; c++)
+
+/***************************************************************************************
+** Function name:           getFreeFontMetrics
+** Description:             metrics of the current free font, NULL for the numbered fonts
+***************************************************************************************/
+const GxFont_GFX_TFT_eSPI::GFXmetrics* GxFont_GFX_TFT_eSPI::getFreeFontMetrics(void)
+{
+  if (!gfxFont) return NULL;
+  return gfxFontMetrics(gfxFont);
+}
+
+
+/***************************************************************************************
+** Function name:           gfxFontMetrics
+** Description:             look up the metrics of a free font, scan its glyphs on a miss
+***************************************************************************************/
+// The last GFX_METRICS_CACHE fonts are kept, the oldest entry is replaced on a miss.
+// font must be the current gfxFont, gfxFontEx() is used to count the glyphs.
+const GxFont_GFX_TFT_eSPI::GFXmetrics* GxFont_GFX_TFT_eSPI::gfxFontMetrics(const GFXfont *font)
+{
+  for (uint8_t i = 0; i < GFX_METRICS_CACHE; i++)
+  {
+    if (gfxMetrics[i].font == font) return &gfxMetrics[i];
+  }
+
+  GFXmetrics *m = &gfxMetrics[gfxMetricsNext];
+  gfxMetricsNext = (gfxMetricsNext + 1) % GFX_METRICS_CACHE;
+
+  uint16_t numChars = pgm_read_byte(&font->last) - pgm_read_byte(&font->first) + 1;
+  if (gfxFontEx())
+  {
+    // The glyphs of a sparse font are those referenced by its ranges
+    const GFXfontEx *ex = (const GFXfontEx *)font;
+    const GFXrange *range = (const GFXrange *)pgm_read_dword(&ex->range);
+    uint16_t ranges = pgm_read_word(&ex->ranges);
+    numChars = 0;
+    for (uint16_t i = 0; i < ranges; i++)
+    {
+      uint16_t end = pgm_read_word(&range[i].glyph) + pgm_read_word(&range[i].last) - pgm_read_word(&range[i].first) + 1;
+      if (end > numChars) numChars = end;
+    }
+  }
+
+  // Find the biggest above and below baseline offsets, the advances and the ink box
+  GFXglyph *glyphs = (GFXglyph *)pgm_read_dword(&font->glyph);
+  uint32_t sum = 0;
+  m->font       = font;
+  m->ascent     = 0;
+  m->descent    = 0;
+  m->maxAdvance = 0;
+  m->inkLeft    = 0;
+  m->inkRight   = 0;
+  for (uint16_t c = 0; c < numChars; c++)
+  {
+    GFXglyph *glyph1 = &glyphs[c];
+    int8_t  yo = pgm_read_byte(&glyph1->yOffset);
+    int8_t  xo = pgm_read_byte(&glyph1->xOffset);
+    uint8_t xa = pgm_read_byte(&glyph1->xAdvance);
+    int16_t ab = -yo;
+    if (ab > m->ascent) m->ascent = ab;
+    int16_t bb = pgm_read_byte(&glyph1->height) - ab;
+    if (bb > m->descent) m->descent = bb;
+    if (xa > m->maxAdvance) m->maxAdvance = xa;
+    sum += xa;
+    uint8_t w = pgm_read_byte(&glyph1->width);
+    if (w)
+    {
+      if (xo < m->inkLeft) m->inkLeft = xo;
+      if (xo + w > m->inkRight) m->inkRight = xo + w;
+    }
+  }
+  m->avgAdvance = numChars ? (sum + numChars / 2) / numChars : 0;
+  return m;
+}
+
+
+/***************************************************************************************
+** Function name:           setFreeFontEx
+** Descriptions:            Sets a GFX free font with sparse 16 bit code points
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::setFreeFontEx(const GFXfontEx *f)
+{
+  decoderState = 0; // Start the UTF-8 decoding of print() afresh
+  setFreeFont(&f->font);
+}
+
+
+#ifdef GFX_SPANS
+/***************************************************************************************
+** Function name:           setFreeFontSpans
+** Descriptions:            Sets a GFX free font converted to glyph row spans
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::setFreeFontSpans(const GFXfontSpans *f)
+{
+  setFreeFont(&f->font);
+  gfxSpans = true;
+}
+#endif
+
+
+#ifdef GFX_PACKED
+/***************************************************************************************
+** Function name:           setFreeFontPacked
+** Descriptions:            Sets a GFX free font with run length packed glyphs
+***************************************************************************************/
+void GxFont_GFX_TFT_eSPI::setFreeFontPacked(const GFXfontPacked *f)
+{
+  setFreeFont(&f->font);
+  gfxPacked = true;
+}
+#endif
+
+
+/***************************************************************************************
+** Function name:           gfxGlyphIndex
+** Description:             find the glyph of a code point in the current free font
+***************************************************************************************/
+// Returns the index in the glyph array or -1 if the font has no glyph for code. The code
+// ranges of a GFXfontEx are binary searched, so the cost grows with log2 of their number.
+int32_t GxFont_GFX_TFT_eSPI::gfxGlyphIndex(uint16_t code)
+{
+  uint8_t first = pgm_read_byte(&gfxFont->first);
+  uint8_t last  = pgm_read_byte(&gfxFont->last);
+  if (first <= last) return ((code >= first) && (code <= last)) ? code - first : -1;
+
+  const GFXfontEx *ex = (const GFXfontEx *)gfxFont;
+  const GFXrange *range = (const GFXrange *)pgm_read_dword(&ex->range);
+  int32_t lo = 0, hi = (int32_t)pgm_read_word(&ex->ranges) - 1;
+  while (lo <= hi)
   {
-    GFXglyph *glyph1  = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[c]);
-    int8_t ab = -pgm_read_byte(&glyph1->yOffset);
-    if (ab > glyph_ab) glyph_ab = ab;
-    int8_t bb = pgm_read_byte(&glyph1->height) - ab;
-    if (bb > glyph_bb) glyph_bb = bb;
+    int32_t mid = (lo + hi) >> 1;
+    uint16_t start = pgm_read_word(&range[mid].first);
+    if (code < start) hi = mid - 1;
+    else if (code > pgm_read_word(&range[mid].last)) lo = mid + 1;
+    else return pgm_read_word(&range[mid].glyph) + code - start;
   }
+  return -1;
 }
 
 
@@ -1438,6 +1640,12 @@ void GxFont_GFX_TFT_eSPI::setTextFont(uint8_t f)
 {
   textfont = (f > 0) ? f : 1; // Don't allow font 0
   gfxFont = NULL;
+#ifdef GFX_SPANS
+  gfxSpans = false;
+#endif
+#ifdef GFX_PACKED
+  gfxPacked = false;
+#endif
 }
 
 #else
@@ -1467,6 +1675,22 @@ void GxFont_GFX_TFT_eSPI::setTextFont(uint8_t f)
 #endif
 
 
+#ifdef GLYPH_CACHE
+#include "Extensions/Glyph_cache.cpp"
+#endif
+
+#ifdef FONT_MIRROR
+#include "Extensions/Font_mirror.cpp"
+#endif
+
+#ifdef DISPLAY_LIST
+#include "Extensions/Display_list.cpp"
+#endif
+
+#ifdef NUMERIC_FIELD
+#include "Extensions/Numeric_field.cpp"
+#endif
+
 #ifdef SMOOTH_FONT
 #include "Extensions/Smooth_font.cpp"
 #endif
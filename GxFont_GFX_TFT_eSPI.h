@@ -27,6 +27,9 @@
 // Set flag so RLE rendering code is optionally compiled
 #ifdef LOAD_GLCD
 #include <Fonts/glcdfont.c>
+#ifdef GLCD_ROWS
+#include <Fonts/glcdfont_rows.c>
+#endif
 #endif
 
 #ifdef LOAD_FONT2
@@ -47,6 +50,9 @@
 
 #ifdef LOAD_FONT7
 #include <Fonts/Font7srle.h>
+#ifdef FONT7_SEGMENTS
+#include <Fonts/Font7seg.c>
+#endif
 #ifndef LOAD_RLE
 #define LOAD_RLE
 #endif
@@ -159,6 +165,31 @@
 #include <Fonts/GFXFF/FreeSerifBoldItalic18pt7b.h> // FF47 or FSBI18
 #include <Fonts/GFXFF/FreeSerifBoldItalic24pt7b.h> // FF48 or FSBI24
 
+#ifdef GFX_SPANS
+// The 18 and 24 point sans serif and serif fonts as glyph row spans, for setFreeFontSpans()
+#include <Fonts/GFXFF/FreeSans18pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSans24pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSansOblique18pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSansOblique24pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSansBold18pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSansBold24pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSansBoldOblique18pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSansBoldOblique24pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSerif18pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSerif24pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSerifItalic18pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSerifItalic24pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSerifBold18pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSerifBold24pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSerifBoldItalic18pt7b_spans.h>
+#include <Fonts/GFXFF/FreeSerifBoldItalic24pt7b_spans.h>
+#endif
+
+#ifdef GFX_PACKED
+// The free and custom fonts that get smaller as run lengths, for setFreeFontPacked()
+#include <Fonts/GFXFF/packed_fonts.h>
+#endif
+
 #endif // #ifdef LOAD_GFXFF
 
 //These enumerate the text plotting alignment (reference datum point)
@@ -205,6 +236,45 @@
 // Convenient for 8 bit and 16 bit transparent sprites.
 #define TFT_TRANSPARENT 0x0120
 
+// Number of horizontal runs collected per colour before they are passed to drawSpans()
+// A glyph with more runs than this is flushed in several batches
+#ifndef SPAN_BUFFER_SIZE
+#if defined(__AVR__)
+#define SPAN_BUFFER_SIZE 8
+#else
+#define SPAN_BUFFER_SIZE 32
+#endif
+#endif
+
+// Largest glyph in bytes that is packed on the stack for drawBitmap1bpp()
+// Bigger glyphs are drawn as runs instead
+#ifndef BITMAP_BUFFER_SIZE
+#if defined(__AVR__)
+#define BITMAP_BUFFER_SIZE 32
+#else
+#define BITMAP_BUFFER_SIZE 256
+#endif
+#endif
+
+// Number of free fonts whose metrics are kept, setFreeFont() does not scan these again
+#ifndef GFX_METRICS_CACHE
+#if defined(__AVR__)
+#define GFX_METRICS_CACHE 2
+#else
+#define GFX_METRICS_CACHE 8
+#endif
+#endif
+
+// Glyph cache limits, see GLYPH_CACHE in User_Setup.h
+#ifdef GLYPH_CACHE
+#ifndef GLYPH_CACHE_BYTES
+#define GLYPH_CACHE_BYTES 4096
+#endif
+#ifndef GLYPH_CACHE_ENTRIES
+#define GLYPH_CACHE_ENTRIES 64
+#endif
+#endif
+
 // This is a structure to conveniently hold information on the default fonts
 // Stores pointer to font character image address table, width table and height
 
@@ -218,6 +288,10 @@ typedef struct {
   const uint8_t *widthtbl;
   uint8_t height;
   uint8_t baseline;
+#ifdef RLE_ROW_INDEX
+  const uint8_t *rowtbl;  // Row index of an RLE font, see Tools/RLE_row_index
+  uint8_t rowstep;        // Rows between index entries, 0 if the font has no index
+#endif
 } fontinfo;
 
 // Now fill the structure
@@ -240,7 +314,11 @@ const PROGMEM fontinfo fontdata [] = {
   { (const uint8_t *)chrtbl_null, widtbl_null, 0, 0 },
 
 #ifdef LOAD_FONT4
-  { (const uint8_t *)chrtbl_f32, widtbl_f32, chr_hgt_f32, baseline_f32},
+  { (const uint8_t *)chrtbl_f32, widtbl_f32, chr_hgt_f32, baseline_f32
+#ifdef RLE_ROW_INDEX
+    , rowtbl_f32, rowstep_f32
+#endif
+  },
 #else
   { (const uint8_t *)chrtbl_null, widtbl_null, 0, 0 },
 #endif
@@ -249,19 +327,31 @@ const PROGMEM fontinfo fontdata [] = {
   { (const uint8_t *)chrtbl_null, widtbl_null, 0, 0 },
 
 #ifdef LOAD_FONT6
-  { (const uint8_t *)chrtbl_f64, widtbl_f64, chr_hgt_f64, baseline_f64},
+  { (const uint8_t *)chrtbl_f64, widtbl_f64, chr_hgt_f64, baseline_f64
+#ifdef RLE_ROW_INDEX
+    , rowtbl_f64, rowstep_f64
+#endif
+  },
 #else
   { (const uint8_t *)chrtbl_null, widtbl_null, 0, 0 },
 #endif
 
 #ifdef LOAD_FONT7
-  { (const uint8_t *)chrtbl_f7s, widtbl_f7s, chr_hgt_f7s, baseline_f7s},
+  { (const uint8_t *)chrtbl_f7s, widtbl_f7s, chr_hgt_f7s, baseline_f7s
+#ifdef RLE_ROW_INDEX
+    , rowtbl_f7s, rowstep_f7s
+#endif
+  },
 #else
   { (const uint8_t *)chrtbl_null, widtbl_null, 0, 0 },
 #endif
 
 #ifdef LOAD_FONT8
-  { (const uint8_t *)chrtbl_f72, widtbl_f72, chr_hgt_f72, baseline_f72}
+  { (const uint8_t *)chrtbl_f72, widtbl_f72, chr_hgt_f72, baseline_f72
+#ifdef RLE_ROW_INDEX
+    , rowtbl_f72, rowstep_f72
+#endif
+  }
 #else
   { (const uint8_t *)chrtbl_null, widtbl_null, 0, 0 }
 #endif
@@ -273,16 +363,43 @@ class GxFont_GFX_TFT_eSPI : public Print
 {
   public:
     GxFont_GFX_TFT_eSPI(int16_t _W, int16_t _H);
+#if defined (GLYPH_CACHE) || defined (FONT_MIRROR)
+    ~GxFont_GFX_TFT_eSPI();
+#endif
 
     virtual void drawPixel(uint32_t x, uint32_t y, uint32_t color) = 0;
     virtual void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) = 0;
     virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) = 0;
 
-    void drawChar(int32_t x, int32_t y, unsigned char c, uint32_t color, uint32_t bg, uint8_t size);
+    // A run of pixels in one colour, h is 1 for unscaled text or textsize for scaled text
+    typedef struct {
+      int16_t x, y;
+      int16_t w, h;
+    } Span;
+
+    // Optional batch entry point, the glyph renderers pass all runs of a glyph in one call
+    // The default falls back to drawFastHLine() (h == 1) or fillRect() (h > 1) per span
+    virtual void drawSpans(const Span* spans, size_t n, uint32_t color);
+
+    // Optional packed glyph blit for monochrome framebuffers, used by the GLCD, Font 2 and
+    // GFX renderers at size 1. data is h rows of rowBytes bytes in RAM, MSB is the left pixel.
+    // Set bits are drawn in fg, clear bits in bg only if opaque is true. Font 2 and GFX glyphs
+    // of more than BITMAP_BUFFER_SIZE bytes are not offered.
+    // Return false to have the glyph drawn with runs instead, the default does so for good.
+    virtual bool drawBitmap1bpp(int32_t x, int32_t y, int32_t w, int32_t h, int32_t rowBytes,
+                                const uint8_t* data, uint32_t fg, uint32_t bg, bool opaque);
 
-    int16_t drawChar(unsigned int uniCode, int x, int y, int font);
+    virtual void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size);
+
+    virtual int16_t drawChar(unsigned int uniCode, int x, int y, int font);
     int16_t drawChar(unsigned int uniCode, int x, int y);
 
+    // Limit text drawing to an area, e.g. the current page of a paged display. Glyphs
+    // outside it are not decoded, runs and fills crossing its edge are trimmed.
+    void setClipRect(int32_t x, int32_t y, int32_t w, int32_t h);
+    void resetClipRect(void);
+    void getClipRect(int32_t *x, int32_t *y, int32_t *w, int32_t *h) const;
+
     void setCursor(int16_t x, int16_t y);
     void setCursor(int16_t x, int16_t y, uint8_t font);
     void setTextColor(uint16_t color);
@@ -295,7 +412,27 @@ class GxFont_GFX_TFT_eSPI : public Print
 
 #ifdef LOAD_GFXFF
     void setFreeFont(const GFXfont *f = NULL);
+    void setFreeFontEx(const GFXfontEx *f); // Sparse 16 bit font, strings and print() are decoded as UTF-8
+#ifdef GFX_SPANS
+    void setFreeFontSpans(const GFXfontSpans *f); // Font converted by Tools/GFX_spans
+#endif
+#ifdef GFX_PACKED
+    void setFreeFontPacked(const GFXfontPacked *f); // Font packed by Tools/GFX_pack
+#endif
     void setTextFont(uint8_t font);
+
+    // Metrics of a free font, found by one scan of its glyphs when the font is first selected
+    typedef struct {
+      const GFXfont *font;
+      uint8_t  ascent;      // Largest glyph extent above the baseline
+      uint8_t  descent;     // Largest glyph extent below the baseline
+      uint8_t  maxAdvance;  // Largest xAdvance
+      uint8_t  avgAdvance;  // Mean xAdvance of all glyphs, rounded
+      int16_t  inkLeft;     // Ink box of all glyphs relative to the cursor, top and bottom are
+      int16_t  inkRight;    // -ascent and descent, unscaled
+    } GFXmetrics;
+
+    const GFXmetrics* getFreeFontMetrics(void); // NULL if no free font is selected
 #else
     void setFreeFont(uint8_t font);
     void setTextFont(uint8_t font);
@@ -303,6 +440,7 @@ class GxFont_GFX_TFT_eSPI : public Print
 
     uint8_t getRotation(void);
     uint8_t getTextDatum(void);
+    uint8_t getTextSize(void);
     uint8_t color16to8(uint16_t color565); // Convert 16 bit colour to 8 bits
 
     int16_t getCursorX(void) const;
@@ -316,6 +454,7 @@ class GxFont_GFX_TFT_eSPI : public Print
     int16_t drawNumber(long long_num, int poX, int poY);
     int16_t drawFloat(float floatNumber, int decimal, int poX, int poY, int font);
     int16_t drawFloat(float floatNumber, int decimal, int poX, int poY);
+    void    formatFloat(float floatNumber, int decimal, char *str); // String of drawFloat(), 14 chars
 
     // Handle char arrays
     int16_t drawString(const char *string, int poX, int poY, int font);
@@ -325,6 +464,35 @@ class GxFont_GFX_TFT_eSPI : public Print
     int16_t drawString(const String& string, int poX, int poY, int font);
     int16_t drawString(const String& string, int poX, int poY);
 
+    // UTF-8 decoders with fall-back to extended ASCII, for smooth fonts and GFXfontEx fonts
+    uint16_t decodeUTF8(uint8_t *buf, uint16_t *index, uint16_t remaining); // Line buffer
+    uint16_t decodeUTF8(uint8_t c); // Serial, returns 0 until a code point is complete
+
+    // Placement of one character of a string, resolved once by layoutString()
+    typedef struct {
+      uint16_t code; // Character code passed to drawChar()
+      int16_t  x;    // Cursor position relative to the start of the string, scaled
+    } TextRun;
+
+    // A string resolved for measuring and drawing, runs is caller provided storage for
+    // capacity runs. Initialise as TextLayout layout = {}; then set runs and capacity.
+    // drawLayout() decodes the characters past the last run again from the string.
+    typedef struct {
+      TextRun    *runs;
+      uint16_t    capacity, count;
+      const char *string;   // The string that was laid out, must stay valid for drawLayout()
+      uint16_t    tail;     // Offset in string of the first character without a run
+      int16_t     tailX;    // Cursor position of that character, scaled
+      uint8_t     font;     // Font and text size the layout was made for
+      uint8_t     size;
+      int16_t     width;    // Pixel width, same as textWidth()
+      int16_t     advance;  // Cursor advance over the whole string
+      int8_t      xo;       // Scaled xOffset of the first free font glyph
+    } TextLayout;
+
+    uint16_t layoutString(const char *string, TextLayout& layout, int font);
+    int16_t  drawLayout(const TextLayout& layout, int poX, int poY);
+
     int16_t height(void);
     int16_t width(void);
     int16_t textWidth(const char *string, int font);
@@ -335,6 +503,25 @@ class GxFont_GFX_TFT_eSPI : public Print
 
     size_t write(uint8_t);
 
+#ifdef RENDER_STATS
+    // Counters for the calls the renderers make into the subclass
+    typedef struct {
+      uint32_t drawPixel;      // drawPixel() calls
+      uint32_t drawFastHLine;  // drawFastHLine() calls, including those made by the default drawSpans()
+      uint32_t fillRect;       // fillRect() calls, including those made by the default drawSpans()
+      uint32_t drawSpans;      // drawSpans() batches
+      uint32_t spans;          // Runs passed in those batches
+      uint32_t drawBitmap1bpp; // Glyphs accepted by drawBitmap1bpp()
+      uint32_t pixels;         // Pixels covered by all of the above
+      uint32_t glyphs;         // Glyphs decoded
+      uint32_t overdraw;       // Foreground pixels drawn over a background fill of the same text
+      uint32_t coalesced;      // Scaled runs merged into the identical run of the row above
+    } RenderStats;
+
+    const RenderStats& getRenderStats(void) const;
+    void  resetRenderStats(void);
+#endif
+
     int32_t  cursor_x, cursor_y;
     uint32_t textcolor, textbgcolor;
 
@@ -355,8 +542,155 @@ class GxFont_GFX_TFT_eSPI : public Print
 
     bool     textwrapX, textwrapY;   // If set, 'wrap' text at right and optionally bottom edge of display
 
+    Span     spanBuffer[2][SPAN_BUFFER_SIZE]; // Pending runs, [0] foreground, [1] background
+    uint16_t spanCount[2];                    // Number of pending runs in each buffer
+    uint32_t spanColor[2];                    // Colour of the pending runs in each buffer
+
+    bool     bitmap1bpp; // Cleared once drawBitmap1bpp() turns out not to be overridden
+
+    int16_t  clipX0, clipY0, clipX1, clipY1; // Clip rectangle, x1 and y1 are exclusive
+
+    // True if any part of the box is inside the clip rectangle
+    bool     clipVisible(int32_t x, int32_t y, int32_t w, int32_t h) const
+    {
+      return (x < clipX1) && (x + w > clipX0) && (y < clipY1) && (y + h > clipY0);
+    }
+
+    // Trim a box to the clip rectangle, returns false if nothing is left
+    bool     clipBox(int32_t& x, int32_t& y, int32_t& w, int32_t& h) const
+    {
+      if (x < clipX0) { w += x - clipX0; x = clipX0; }
+      if (y < clipY0) { h += y - clipY0; y = clipY0; }
+      if (x + w > clipX1) w = clipX1 - x;
+      if (y + h > clipY1) h = clipY1 - y;
+      return (w > 0) && (h > 0);
+    }
+
+    void     addSpan(uint8_t buf, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void     flushSpans(void);
+
+    void     addTextRun(TextLayout& layout, uint16_t code, int16_t advance, uint16_t offset);
+
+#if defined (LOAD_GFXFF) && defined (GFX_SINGLE_PASS) && !defined (FIXED_SIZE)
+    // Position while the free font glyphs of a layout are stepped through by nextLayoutGlyph()
+    typedef struct {
+      uint16_t run;         // Next run
+      uint16_t pos, len;    // Offset of the next character in the string once the runs are used up
+      int16_t  x;           // Cursor position of the glyph returned, scaled
+      int16_t  next;        // Cursor position of the next character past the runs, scaled
+    } LayoutCursor;
+
+    bool     nextLayoutGlyph(const TextLayout& layout, LayoutCursor& cur, uint16_t& code, int32_t& index);
+#endif
+
+#ifdef RLE_ROW_INDEX
+    int      rleRowSeek(uint8_t font, uint16_t code, int32_t y, int width, int height, uintptr_t& flash_address);
+#endif
+
+    // The renderers draw through these so the calls can be counted
+    void     sinkPixel(int32_t x, int32_t y, uint32_t color);
+    void     sinkRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    bool     sinkBitmap(int32_t x, int32_t y, int32_t w, int32_t h, int32_t rowBytes,
+                        const uint8_t* data, uint32_t fg, uint32_t bg, bool opaque);
+
+    // Glyph renderers shared with GxFontRenderer, defined in GxFontRenderer.h
+    template <class Sink> void    renderChar(Sink& sink, int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size);
+    template <class Sink> int16_t renderChar(Sink& sink, unsigned int uniCode, int x, int y, int font);
+
+#ifdef LOAD_GLCD
+    // GLCD character as 8 rows of 6 pixels, from font_rows[] if GLCD_ROWS is defined
+    void     glcdRows(unsigned char c, uint8_t* rows);
+#endif
+
+    // Sink stage of the scaled renderers, merges identical consecutive rows into taller spans
+    template <class Sink> struct RowMerger;
+
+    // Inner loops of renderChar(), one instance per combination of scaled and opaque
+#ifdef LOAD_GLCD
+    template <class Sink, bool Scaled, bool Opaque>
+    void     glcdKernel(Sink& sink, int32_t x, int32_t y, unsigned char c, uint32_t color, uint32_t bg, uint8_t size);
+#endif
+    template <class Sink, bool Scaled>
+    void     gfxKernel(Sink& sink, int32_t x, int32_t y, const uint8_t *bitmap, uint16_t bo,
+                       uint8_t w, uint8_t h, int8_t xo, int8_t yo, uint8_t size, uint32_t color);
+#if defined (LOAD_GFXFF) && defined (GFX_SPANS)
+    template <class Sink, bool Scaled>
+    void     spanKernel(Sink& sink, int32_t x, int32_t y, const uint8_t *spans, uint16_t so,
+                        uint8_t h, int8_t xo, int8_t yo, uint8_t size, uint32_t color);
+#endif
+#if defined (LOAD_GFXFF) && defined (GFX_PACKED)
+    template <class Sink, bool Scaled>
+    void     packedKernel(Sink& sink, int32_t x, int32_t y, const uint8_t *runs, uint16_t ro,
+                          uint8_t w, uint8_t h, int8_t xo, int8_t yo, uint8_t size, uint32_t color);
+#endif
+#if defined (LOAD_GFXFF) && defined (GFX_SINGLE_PASS) && !defined (FIXED_SIZE)
+    template <class Sink>
+    void     gfxStringKernel(Sink& sink, const TextLayout& layout, int32_t poX, int32_t poY, int32_t boxX, int32_t boxW);
+#endif
+    template <class Sink, bool Scaled, bool Opaque>
+    void     font2Kernel(Sink& sink, int x, int y, int width, int height, int w, uintptr_t flash_address);
+    template <class Sink, bool Scaled, bool Opaque>
+    void     rleKernel(Sink& sink, int x, int y, int width, int height, uintptr_t flash_address, int start);
+#if defined (LOAD_FONT7) && defined (FONT7_SEGMENTS)
+    template <class Sink, bool Opaque>
+    void     segmentKernel(Sink& sink, int x, int y, uint16_t code, int width, int height);
+#endif
+
+    // Sink of drawChar(), draws through the virtual functions
+    struct VirtualSink {
+      GxFont_GFX_TFT_eSPI *gfx;
+
+      void pixel(int32_t x, int32_t y, uint32_t color) { gfx->sinkPixel(x, y, color); }
+      void rect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) { gfx->sinkRect(x, y, w, h, color); }
+      void span(uint8_t buf, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) { gfx->addSpan(buf, x, y, w, h, color); }
+      void flush(void) { gfx->flushSpans(); }
+      bool bitmap(int32_t x, int32_t y, int32_t w, int32_t h, int32_t rowBytes,
+                  const uint8_t* data, uint32_t fg, uint32_t bg, bool opaque)
+      {
+        return gfx->sinkBitmap(x, y, w, h, rowBytes, data, fg, bg, opaque);
+      }
+    };
+
+#ifdef RENDER_STATS
+    RenderStats renderStats;
+    bool     statsOverdraw; // Set while foreground is drawn over a background fill
+
+    void     countCall(uint32_t *counter, uint32_t pixels, uint32_t color);
+#endif
+
 #ifdef LOAD_GFXFF
-    GFXfont  *gfxFont;
+    GFXfont  *gfxFont;  // Also the font member of a GFXfontEx, then first > last
+#ifdef GFX_SPANS
+    bool     gfxSpans;  // gfxFont is the font member of a GFXfontSpans
+#endif
+#ifdef GFX_PACKED
+    bool     gfxPacked; // gfxFont is the font member of a GFXfontPacked
+#endif
+
+    bool     gfxFontEx(void) const { return pgm_read_byte(&gfxFont->first) > pgm_read_byte(&gfxFont->last); }
+    int32_t  gfxGlyphIndex(uint16_t code);
+
+    GFXmetrics gfxMetrics[GFX_METRICS_CACHE]; // Metrics of the free fonts selected last
+    uint8_t  gfxMetricsNext;                  // Entry replaced on the next miss
+    const GFXmetrics* gfxFontMetrics(const GFXfont *font);
+#endif
+
+    uint8_t  decoderState;   // UTF-8 decoder state, continuation bytes still expected
+    uint16_t decoderBuffer;  // Code point being decoded
+
+    // Load the decoded glyph cache extension
+#ifdef GLYPH_CACHE
+#include "Extensions/Glyph_cache.h"
+#endif
+
+    // Load the RAM font copy extension
+#ifdef FONT_MIRROR
+#include "Extensions/Font_mirror.h"
+#endif
+
+    // Load the display list extension
+#ifdef DISPLAY_LIST
+#include "Extensions/Display_list.h"
 #endif
 
     // Load the Anti-aliased font extension
@@ -366,4 +700,12 @@ class GxFont_GFX_TFT_eSPI : public Print
 
 }; // End of class GxFont_GFX_TFT_eSPI
 
+// The glyph renderers and the GxFontRenderer<Derived> template
+#include "GxFontRenderer.h"
+
+// Load the numeric field extension
+#ifdef NUMERIC_FIELD
+#include "Extensions/Numeric_field.h"
+#endif
+
 #endif
@@ -0,0 +1,257 @@
+// Run length packer for the free fonts of GxFont_GFX_TFT_eSPI
+// Writes <font>_packed.h next to each font that gets smaller and Fonts/GFXFF/packed_fonts.h that
+// includes them, selected with setFreeFontPacked() when GFX_PACKED is defined in User_Setup.h.
+//
+// Layout of <font>PackedRuns[]:
+//   per glyph the pixels of the bitmap in the same order, coded as alternating background and
+//   foreground run lengths starting with background, one nibble per run, high nibble first.
+//   A nibble of 15 adds 15 to the next nibble, a glyph ends with a padding nibble of 0 if its
+//   runs fill an odd number. The bitmapOffset of a glyph in <font>PackedGlyphs[] is the byte
+//   offset of its first run, all other glyph fields are copied.
+
+#include <pgmspace.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#define LOAD_GFXFF
+#include <Fonts/GFXFF/gfxfont.h>
+
+#include <User_Setups/User_Custom_Fonts.h>
+
+#include <Fonts/GFXFF/TomThumb.h>
+#include <Fonts/GFXFF/FreeMono9pt7b.h>
+#include <Fonts/GFXFF/FreeMono12pt7b.h>
+#include <Fonts/GFXFF/FreeMono18pt7b.h>
+#include <Fonts/GFXFF/FreeMono24pt7b.h>
+#include <Fonts/GFXFF/FreeMonoOblique9pt7b.h>
+#include <Fonts/GFXFF/FreeMonoOblique12pt7b.h>
+#include <Fonts/GFXFF/FreeMonoOblique18pt7b.h>
+#include <Fonts/GFXFF/FreeMonoOblique24pt7b.h>
+#include <Fonts/GFXFF/FreeMonoBold9pt7b.h>
+#include <Fonts/GFXFF/FreeMonoBold12pt7b.h>
+#include <Fonts/GFXFF/FreeMonoBold18pt7b.h>
+#include <Fonts/GFXFF/FreeMonoBold24pt7b.h>
+#include <Fonts/GFXFF/FreeMonoBoldOblique9pt7b.h>
+#include <Fonts/GFXFF/FreeMonoBoldOblique12pt7b.h>
+#include <Fonts/GFXFF/FreeMonoBoldOblique18pt7b.h>
+#include <Fonts/GFXFF/FreeMonoBoldOblique24pt7b.h>
+#include <Fonts/GFXFF/FreeSans9pt7b.h>
+#include <Fonts/GFXFF/FreeSans12pt7b.h>
+#include <Fonts/GFXFF/FreeSans18pt7b.h>
+#include <Fonts/GFXFF/FreeSans24pt7b.h>
+#include <Fonts/GFXFF/FreeSansOblique9pt7b.h>
+#include <Fonts/GFXFF/FreeSansOblique12pt7b.h>
+#include <Fonts/GFXFF/FreeSansOblique18pt7b.h>
+#include <Fonts/GFXFF/FreeSansOblique24pt7b.h>
+#include <Fonts/GFXFF/FreeSansBold9pt7b.h>
+#include <Fonts/GFXFF/FreeSansBold12pt7b.h>
+#include <Fonts/GFXFF/FreeSansBold18pt7b.h>
+#include <Fonts/GFXFF/FreeSansBold24pt7b.h>
+#include <Fonts/GFXFF/FreeSansBoldOblique9pt7b.h>
+#include <Fonts/GFXFF/FreeSansBoldOblique12pt7b.h>
+#include <Fonts/GFXFF/FreeSansBoldOblique18pt7b.h>
+#include <Fonts/GFXFF/FreeSansBoldOblique24pt7b.h>
+#include <Fonts/GFXFF/FreeSerif9pt7b.h>
+#include <Fonts/GFXFF/FreeSerif12pt7b.h>
+#include <Fonts/GFXFF/FreeSerif18pt7b.h>
+#include <Fonts/GFXFF/FreeSerif24pt7b.h>
+#include <Fonts/GFXFF/FreeSerifItalic9pt7b.h>
+#include <Fonts/GFXFF/FreeSerifItalic12pt7b.h>
+#include <Fonts/GFXFF/FreeSerifItalic18pt7b.h>
+#include <Fonts/GFXFF/FreeSerifItalic24pt7b.h>
+#include <Fonts/GFXFF/FreeSerifBold9pt7b.h>
+#include <Fonts/GFXFF/FreeSerifBold12pt7b.h>
+#include <Fonts/GFXFF/FreeSerifBold18pt7b.h>
+#include <Fonts/GFXFF/FreeSerifBold24pt7b.h>
+#include <Fonts/GFXFF/FreeSerifBoldItalic9pt7b.h>
+#include <Fonts/GFXFF/FreeSerifBoldItalic12pt7b.h>
+#include <Fonts/GFXFF/FreeSerifBoldItalic18pt7b.h>
+#include <Fonts/GFXFF/FreeSerifBoldItalic24pt7b.h>
+
+typedef struct {
+  const char    *name;    // Font name, also the file name without .h
+  const char    *dir;     // Folder of the font below Fonts/
+  const GFXfont *font;
+} PackFont;
+
+#define FREE_FONT(f)   { #f, "GFXFF", &f }
+#define CUSTOM_FONT(f) { #f, "Custom", &f }
+
+static const PackFont packFonts[] = {
+  FREE_FONT(TomThumb),
+  FREE_FONT(FreeMono9pt7b),              FREE_FONT(FreeMono12pt7b),
+  FREE_FONT(FreeMono18pt7b),             FREE_FONT(FreeMono24pt7b),
+  FREE_FONT(FreeMonoOblique9pt7b),       FREE_FONT(FreeMonoOblique12pt7b),
+  FREE_FONT(FreeMonoOblique18pt7b),      FREE_FONT(FreeMonoOblique24pt7b),
+  FREE_FONT(FreeMonoBold9pt7b),          FREE_FONT(FreeMonoBold12pt7b),
+  FREE_FONT(FreeMonoBold18pt7b),         FREE_FONT(FreeMonoBold24pt7b),
+  FREE_FONT(FreeMonoBoldOblique9pt7b),   FREE_FONT(FreeMonoBoldOblique12pt7b),
+  FREE_FONT(FreeMonoBoldOblique18pt7b),  FREE_FONT(FreeMonoBoldOblique24pt7b),
+  FREE_FONT(FreeSans9pt7b),              FREE_FONT(FreeSans12pt7b),
+  FREE_FONT(FreeSans18pt7b),             FREE_FONT(FreeSans24pt7b),
+  FREE_FONT(FreeSansOblique9pt7b),       FREE_FONT(FreeSansOblique12pt7b),
+  FREE_FONT(FreeSansOblique18pt7b),      FREE_FONT(FreeSansOblique24pt7b),
+  FREE_FONT(FreeSansBold9pt7b),          FREE_FONT(FreeSansBold12pt7b),
+  FREE_FONT(FreeSansBold18pt7b),         FREE_FONT(FreeSansBold24pt7b),
+  FREE_FONT(FreeSansBoldOblique9pt7b),   FREE_FONT(FreeSansBoldOblique12pt7b),
+  FREE_FONT(FreeSansBoldOblique18pt7b),  FREE_FONT(FreeSansBoldOblique24pt7b),
+  FREE_FONT(FreeSerif9pt7b),             FREE_FONT(FreeSerif12pt7b),
+  FREE_FONT(FreeSerif18pt7b),            FREE_FONT(FreeSerif24pt7b),
+  FREE_FONT(FreeSerifItalic9pt7b),       FREE_FONT(FreeSerifItalic12pt7b),
+  FREE_FONT(FreeSerifItalic18pt7b),      FREE_FONT(FreeSerifItalic24pt7b),
+  FREE_FONT(FreeSerifBold9pt7b),         FREE_FONT(FreeSerifBold12pt7b),
+  FREE_FONT(FreeSerifBold18pt7b),        FREE_FONT(FreeSerifBold24pt7b),
+  FREE_FONT(FreeSerifBoldItalic9pt7b),   FREE_FONT(FreeSerifBoldItalic12pt7b),
+  FREE_FONT(FreeSerifBoldItalic18pt7b),  FREE_FONT(FreeSerifBoldItalic24pt7b),
+  CUSTOM_FONT(Orbitron_Light_24),        CUSTOM_FONT(Orbitron_Light_32),
+  CUSTOM_FONT(Roboto_Thin_24),           CUSTOM_FONT(Satisfy_24),
+  CUSTOM_FONT(Yellowtail_32),
+};
+
+// Append the runs of one glyph to out, the bits of the rows follow each other without padding
+static void packGlyph(std::vector<int>& out, const uint8_t *bitmap, int bo, int pixels)
+{
+  std::vector<int> nibbles;
+  int value = 0, run = 0;
+  for (int i = 0; i <= pixels; i++)
+  {
+    int bit = bo * 8 + i;
+    int set = (i < pixels) ? ((bitmap[bit >> 3] >> (7 - (bit & 7))) & 1) : !value;
+    if (set == value)
+    {
+      run++;
+      continue;
+    }
+    while (run >= 15)
+    {
+      nibbles.push_back(15);
+      run -= 15;
+    }
+    nibbles.push_back(run);
+    value = set;
+    run = 1;
+  }
+  if (!pixels) nibbles.clear(); // Nothing to draw, e.g. a space
+  if (nibbles.size() & 1) nibbles.push_back(0);
+  for (size_t i = 0; i < nibbles.size(); i += 2) out.push_back((nibbles[i] << 4) | nibbles[i + 1]);
+}
+
+// Prints the sizes, the font is only written if it is smaller than the bitmap or all is set
+static bool writePacked(const PackFont& f, const std::string& root, bool all, FILE *index)
+{
+  const GFXfont *font = f.font;
+  int first = font->first, last = font->last;
+
+  std::vector<int> data;
+  std::vector<int> offset;
+  int bitmapBytes = 0;
+  for (int c = first; c <= last; c++)
+  {
+    const GFXglyph *glyph = &font->glyph[c - first];
+    offset.push_back(data.size());
+    packGlyph(data, font->bitmap, glyph->bitmapOffset, glyph->width * glyph->height);
+    int end = glyph->bitmapOffset + (glyph->width * glyph->height + 7) / 8;
+    if (end > bitmapBytes) bitmapBytes = end;
+  }
+  if (data.size() > 0xFFFF)
+  {
+    fprintf(stderr, "%s has more than 65535 bytes of runs\n", f.name);
+    return false;
+  }
+
+  bool write = all || ((int)data.size() < bitmapBytes);
+  printf("%-28s %6d %6u %5d%%%s\n", f.name, bitmapBytes, (unsigned)data.size(),
+         (int)(100 * ((int)data.size() - bitmapBytes) / bitmapBytes), write ? "" : "  not written");
+  if (!write) return true;
+
+  std::string file = std::string(f.dir) + "/" + f.name + "_packed.h";
+  std::string path = root + "/" + file;
+  FILE *out = fopen(path.c_str(), "w");
+  if (!out)
+  {
+    fprintf(stderr, "Cannot write %s\n", path.c_str());
+    return false;
+  }
+
+  fprintf(out, "// %s as run lengths, generated by Tools/GFX_pack from %s.h\n", f.name, f.name);
+  fprintf(out, "//\n");
+  fprintf(out, "// Alternating background and foreground runs, one nibble each, 15 adds to the next\n\n");
+  fprintf(out, "const uint8_t %sPackedRuns[] PROGMEM = {\n", f.name);
+  for (size_t i = 0; i < data.size(); i++)
+  {
+    if (i % 12 == 0) fprintf(out, "  ");
+    fprintf(out, "0x%02X", data[i]);
+    if (i + 1 < data.size()) fprintf(out, (i % 12 == 11) ? ",\n" : ", ");
+  }
+  fprintf(out, " };\n\n");
+
+  fprintf(out, "const GFXglyph %sPackedGlyphs[] PROGMEM = {\n", f.name);
+  for (int c = first; c <= last; c++)
+  {
+    const GFXglyph *glyph = &font->glyph[c - first];
+    fprintf(out, "  { %5d, %3d, %3d, %3d, %4d, %4d }%s // 0x%02X '%c'\n", offset[c - first],
+            glyph->width, glyph->height, glyph->xAdvance, glyph->xOffset, glyph->yOffset,
+            (c < last) ? ",  " : " };", c, c);
+  }
+  fprintf(out, "\n");
+
+  fprintf(out, "const GFXfontPacked %sPacked PROGMEM = {\n", f.name);
+  fprintf(out, "  { (uint8_t  *)%sPackedRuns,\n", f.name);
+  fprintf(out, "    (GFXglyph *)%sPackedGlyphs,\n", f.name);
+  fprintf(out, "    0x%02X, 0x%02X, %d } };\n\n", first, last, font->yAdvance);
+
+  int bytes = data.size() + (last - first + 1) * 7 + 7;
+  fprintf(out, "// Approx. %d bytes\n", bytes);
+  fclose(out);
+
+  fprintf(index, "#include <Fonts/%s>\n", file.c_str());
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  std::string root = "../../Fonts";
+  bool all = false;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "ao:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'a': all = true; break;
+      case 'o': root = optarg; break;
+      default:
+        fprintf(stderr, "Usage: %s [-a] [-o dir]\n", argv[0]);
+        fprintf(stderr, "  -a  also write the fonts that do not get smaller\n");
+        fprintf(stderr, "  -o  Fonts directory, the files go into its GFXFF and Custom folders (default ../../Fonts)\n");
+        return 1;
+    }
+  }
+
+  std::string path = root + "/GFXFF/packed_fonts.h";
+  FILE *index = fopen(path.c_str(), "w");
+  if (!index)
+  {
+    fprintf(stderr, "Cannot write %s\n", path.c_str());
+    return 1;
+  }
+  fprintf(index, "// Free fonts packed as run lengths, generated by Tools/GFX_pack\n");
+  fprintf(index, "// Select one with setFreeFontPacked(&<font>Packed), e.g. &FreeSans24pt7bPacked\n\n");
+
+  printf("%-28s %6s %6s %6s\n", "font", "bitmap", "packed", "change");
+  for (size_t i = 0; i < sizeof(packFonts) / sizeof(packFonts[0]); i++)
+  {
+    if (!writePacked(packFonts[i], root, all, index))
+    {
+      fclose(index);
+      return 1;
+    }
+  }
+  fclose(index);
+  return 0;
+}
@@ -0,0 +1,172 @@
+// Span encoder for the free fonts of GxFont_GFX_TFT_eSPI
+// Writes Fonts/GFXFF/<font>_spans.h, selected with setFreeFontSpans() when GFX_SPANS is defined
+// in User_Setup.h, so glyph rows are drawn from stored runs instead of scanning the bitmap bits.
+//
+// Layout of <font>SpanData[]:
+//   per glyph and pixel row from the top: the number of runs in the row, then the left
+//   column and the length of each run, one byte each. The bitmapOffset of a glyph in
+//   <font>SpanGlyphs[] is the offset of its first row, all other glyph fields are copied.
+
+#include <pgmspace.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#define LOAD_GFXFF
+#include <Fonts/GFXFF/gfxfont.h>
+
+#include <Fonts/GFXFF/FreeSans18pt7b.h>
+#include <Fonts/GFXFF/FreeSans24pt7b.h>
+#include <Fonts/GFXFF/FreeSansOblique18pt7b.h>
+#include <Fonts/GFXFF/FreeSansOblique24pt7b.h>
+#include <Fonts/GFXFF/FreeSansBold18pt7b.h>
+#include <Fonts/GFXFF/FreeSansBold24pt7b.h>
+#include <Fonts/GFXFF/FreeSansBoldOblique18pt7b.h>
+#include <Fonts/GFXFF/FreeSansBoldOblique24pt7b.h>
+#include <Fonts/GFXFF/FreeSerif18pt7b.h>
+#include <Fonts/GFXFF/FreeSerif24pt7b.h>
+#include <Fonts/GFXFF/FreeSerifItalic18pt7b.h>
+#include <Fonts/GFXFF/FreeSerifItalic24pt7b.h>
+#include <Fonts/GFXFF/FreeSerifBold18pt7b.h>
+#include <Fonts/GFXFF/FreeSerifBold24pt7b.h>
+#include <Fonts/GFXFF/FreeSerifBoldItalic18pt7b.h>
+#include <Fonts/GFXFF/FreeSerifBoldItalic24pt7b.h>
+
+typedef struct {
+  const char    *name;    // Font name, also the file name without .h
+  const GFXfont *font;
+} SpanFont;
+
+static const SpanFont spanFonts[] = {
+  { "FreeSans18pt7b",              &FreeSans18pt7b },
+  { "FreeSans24pt7b",              &FreeSans24pt7b },
+  { "FreeSansOblique18pt7b",       &FreeSansOblique18pt7b },
+  { "FreeSansOblique24pt7b",       &FreeSansOblique24pt7b },
+  { "FreeSansBold18pt7b",          &FreeSansBold18pt7b },
+  { "FreeSansBold24pt7b",          &FreeSansBold24pt7b },
+  { "FreeSansBoldOblique18pt7b",   &FreeSansBoldOblique18pt7b },
+  { "FreeSansBoldOblique24pt7b",   &FreeSansBoldOblique24pt7b },
+  { "FreeSerif18pt7b",             &FreeSerif18pt7b },
+  { "FreeSerif24pt7b",             &FreeSerif24pt7b },
+  { "FreeSerifItalic18pt7b",       &FreeSerifItalic18pt7b },
+  { "FreeSerifItalic24pt7b",       &FreeSerifItalic24pt7b },
+  { "FreeSerifBold18pt7b",         &FreeSerifBold18pt7b },
+  { "FreeSerifBold24pt7b",         &FreeSerifBold24pt7b },
+  { "FreeSerifBoldItalic18pt7b",   &FreeSerifBoldItalic18pt7b },
+  { "FreeSerifBoldItalic24pt7b",   &FreeSerifBoldItalic24pt7b },
+};
+
+// Append the rows of one glyph to out, the bits of the rows follow each other without padding
+static void encodeGlyph(std::vector<int>& out, const uint8_t *bitmap, int bo, int w, int h)
+{
+  int bit = bo * 8;
+  for (int y = 0; y < h; y++)
+  {
+    size_t count = out.size();
+    out.push_back(0);
+    int start = -1;
+    for (int x = 0; x <= w; x++, bit++)
+    {
+      bool set = (x < w) && (bitmap[bit >> 3] & (0x80 >> (bit & 7)));
+      if (set && (start < 0)) start = x;
+      else if (!set && (start >= 0))
+      {
+        out.push_back(start);
+        out.push_back(x - start);
+        out[count]++;
+        start = -1;
+      }
+    }
+    bit--; // The loop stepped once past the row
+  }
+}
+
+static bool writeSpans(const SpanFont& f, const std::string& dir)
+{
+  const GFXfont *font = f.font;
+  int first = font->first, last = font->last;
+
+  std::vector<int> data;
+  std::vector<int> offset;
+  int bitmapBytes = 0;
+  for (int c = first; c <= last; c++)
+  {
+    const GFXglyph *glyph = &font->glyph[c - first];
+    offset.push_back(data.size());
+    encodeGlyph(data, font->bitmap, glyph->bitmapOffset, glyph->width, glyph->height);
+    int end = glyph->bitmapOffset + (glyph->width * glyph->height + 7) / 8;
+    if (end > bitmapBytes) bitmapBytes = end;
+  }
+  if (data.size() > 0xFFFF)
+  {
+    fprintf(stderr, "%s has more than 65535 bytes of spans\n", f.name);
+    return false;
+  }
+
+  std::string path = dir + "/" + f.name + "_spans.h";
+  FILE *out = fopen(path.c_str(), "w");
+  if (!out)
+  {
+    fprintf(stderr, "Cannot write %s\n", path.c_str());
+    return false;
+  }
+
+  fprintf(out, "// %s as glyph row spans, generated by Tools/GFX_spans from %s.h\n", f.name, f.name);
+  fprintf(out, "//\n");
+  fprintf(out, "// Per glyph row the number of runs, then the left column and length of each run\n\n");
+  fprintf(out, "const uint8_t %sSpanData[] PROGMEM = {\n", f.name);
+  for (size_t i = 0; i < data.size(); i++)
+  {
+    if (i % 12 == 0) fprintf(out, "  ");
+    fprintf(out, "0x%02X", data[i]);
+    if (i + 1 < data.size()) fprintf(out, (i % 12 == 11) ? ",\n" : ", ");
+  }
+  fprintf(out, " };\n\n");
+
+  fprintf(out, "const GFXglyph %sSpanGlyphs[] PROGMEM = {\n", f.name);
+  for (int c = first; c <= last; c++)
+  {
+    const GFXglyph *glyph = &font->glyph[c - first];
+    fprintf(out, "  { %5d, %3d, %3d, %3d, %4d, %4d }%s // 0x%02X '%c'\n", offset[c - first],
+            glyph->width, glyph->height, glyph->xAdvance, glyph->xOffset, glyph->yOffset,
+            (c < last) ? ",  " : " };", c, c);
+  }
+  fprintf(out, "\n");
+
+  fprintf(out, "const GFXfontSpans %sSpans PROGMEM = {\n", f.name);
+  fprintf(out, "  { (uint8_t  *)%sSpanData,\n", f.name);
+  fprintf(out, "    (GFXglyph *)%sSpanGlyphs,\n", f.name);
+  fprintf(out, "    0x%02X, 0x%02X, %d } };\n\n", first, last, font->yAdvance);
+
+  int bytes = data.size() + (last - first + 1) * sizeof(GFXglyph) + sizeof(GFXfont);
+  fprintf(out, "// Approx. %d bytes\n", bytes);
+  fclose(out);
+  printf("%s: %u bytes of spans, %d bytes of bitmap\n", path.c_str(), (unsigned)data.size(), bitmapBytes);
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  std::string dir = "../../Fonts/GFXFF";
+
+  int opt;
+  while ((opt = getopt(argc, argv, "o:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'o': dir = optarg; break;
+      default:
+        fprintf(stderr, "Usage: %s [-o dir]\n", argv[0]);
+        fprintf(stderr, "  -o  directory the _spans.h files are written to (default ../../Fonts/GFXFF)\n");
+        return 1;
+    }
+  }
+
+  for (size_t i = 0; i < sizeof(spanFonts) / sizeof(spanFonts[0]); i++)
+    if (!writeSpans(spanFonts[i], dir)) return 1;
+  return 0;
+}
@@ -0,0 +1,74 @@
+// Row-major table generator for the GLCD font of GxFont_GFX_TFT_eSPI
+// Writes Fonts/glcdfont_rows.c, used by the GLCD renderer when GLCD_ROWS is defined in
+// User_Setup.h, so characters are drawn row by row without transposing the 5 column bytes.
+//
+// Layout of font_rows[]:
+//   8 bytes per character code, one per pixel row from the top, the MSB is the left pixel
+//   and the 6th pixel (the gap column) is always clear, all 256 codes are present
+
+#include <pgmspace.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+
+#include <Fonts/glcdfont.c>
+
+#define NR_CHRS 256
+
+int main(int argc, char **argv)
+{
+  std::string dir = "../../Fonts";
+
+  int opt;
+  while ((opt = getopt(argc, argv, "o:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'o': dir = optarg; break;
+      default:
+        fprintf(stderr, "Usage: %s [-o dir]\n", argv[0]);
+        fprintf(stderr, "  -o  directory glcdfont_rows.c is written to (default ../../Fonts)\n");
+        return 1;
+    }
+  }
+  // glcdfont.c stops at character 254, missing characters get blank rows
+  int chars = sizeof(font) / 5;
+
+  std::string path = dir + "/glcdfont_rows.c";
+  FILE *out = fopen(path.c_str(), "w");
+  if (!out)
+  {
+    fprintf(stderr, "Cannot write %s\n", path.c_str());
+    return 1;
+  }
+
+  fprintf(out, "// GLCD font as rows, generated by Tools/GLCD_rows from glcdfont.c\n");
+  fprintf(out, "//\n");
+  fprintf(out, "// 8 bytes per character, one per row from the top, the MSB is the left pixel\n\n");
+  fprintf(out, "#ifndef FONT5X7_ROWS_H\n#define FONT5X7_ROWS_H\n\n");
+  fprintf(out, "#include <pgmspace.h>\n\n");
+  fprintf(out, "static const unsigned char font_rows[] PROGMEM = {\n");
+  for (int c = 0; c < NR_CHRS; c++)
+  {
+    unsigned char rows[8] = {0};
+    for (int i = 0; (c < chars) && (i < 5); i++)
+    {
+      unsigned char line = font[c * 5 + i];
+      for (int j = 0; j < 8; j++)
+      {
+        if (line & 0x1) rows[j] |= 0x80 >> i;
+        line >>= 1;
+      }
+    }
+    fprintf(out, "\t");
+    for (int j = 0; j < 8; j++) fprintf(out, "0x%02X,%s", rows[j], (j < 7) ? " " : "");
+    fprintf(out, "    // char %d\n", c);
+  }
+  fprintf(out, "};\n\n#endif // FONT5X7_ROWS_H\n");
+  fclose(out);
+  printf("%s: %d characters, %d bytes\n", path.c_str(), NR_CHRS, NR_CHRS * 8);
+  return 0;
+}
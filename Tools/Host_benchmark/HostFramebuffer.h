@@ -0,0 +1,178 @@
+// In-memory RGB565 framebuffer for running GxFont_GFX_TFT_eSPI on a host computer
+// Counts every call the renderers make into the sink so rendering cost can be compared
+// HostFramebuffer draws through the virtual functions, InlineFramebuffer is the same sink
+// built on GxFontRenderer so the renderers call it directly
+
+#ifndef _HostFramebuffer_H_
+#define _HostFramebuffer_H_
+
+#include <GxFont_GFX_TFT_eSPI.h>
+
+template <class Base>
+class HostFramebufferT : public Base
+{
+  public:
+
+    // Calls into the sink, pixels is the number of framebuffer pixels written
+    typedef struct {
+      uint32_t drawPixel, drawFastHLine, fillRect, drawSpans, drawBitmap1bpp;
+      uint32_t pixels;
+    } SinkCalls;
+
+    HostFramebufferT(int16_t w, int16_t h) : Base(w, h)
+    {
+      buffer = new uint16_t[w * h];
+      batchSpans = false;
+      packedGlyphs = false;
+      fillScreen(0);
+      resetCalls();
+    }
+
+    ~HostFramebufferT()
+    {
+      delete[] buffer;
+    }
+
+    // Take over the optional drawSpans() and drawBitmap1bpp() entry points
+    // instead of letting the base class fall back to the primitives
+    void setBatchSpans(bool enable) { batchSpans = enable; }
+    void setPackedGlyphs(bool enable) { packedGlyphs = enable; }
+
+    void drawPixel(uint32_t x, uint32_t y, uint32_t color)
+    {
+      calls.drawPixel++;
+      writePixel(x, y, color);
+    }
+
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+    {
+      calls.drawFastHLine++;
+      writeRect(x, y, w, 1, color);
+    }
+
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+    {
+      calls.fillRect++;
+      writeRect(x, y, w, h, color);
+    }
+
+    void drawSpans(const GxFont_GFX_TFT_eSPI::Span* spans, size_t n, uint32_t color)
+    {
+      if (!batchSpans)
+      {
+        GxFont_GFX_TFT_eSPI::drawSpans(spans, n, color);
+        return;
+      }
+      calls.drawSpans++;
+      while (n--)
+      {
+        writeRect(spans->x, spans->y, spans->w, spans->h, color);
+        spans++;
+      }
+    }
+
+    bool drawBitmap1bpp(int32_t x, int32_t y, int32_t w, int32_t h, int32_t rowBytes,
+                        const uint8_t* data, uint32_t fg, uint32_t bg, bool opaque)
+    {
+      if (!packedGlyphs) return GxFont_GFX_TFT_eSPI::drawBitmap1bpp(x, y, w, h, rowBytes, data, fg, bg, opaque);
+      calls.drawBitmap1bpp++;
+      for (int32_t j = 0; j < h; j++)
+      {
+        for (int32_t i = 0; i < w; i++)
+        {
+          if (data[j * rowBytes + (i >> 3)] & (0x80 >> (i & 7))) writePixel(x + i, y + j, fg);
+          else if (opaque) writePixel(x + i, y + j, bg);
+        }
+      }
+      return true;
+    }
+
+    void fillScreen(uint16_t color)
+    {
+      for (uint32_t i = 0; i < _width * _height; i++) buffer[i] = color;
+    }
+
+    // FNV-1a hash of the framebuffer, changes if any rendered pixel changes
+    uint32_t checksum(void) const
+    {
+      uint32_t h = 2166136261u;
+      for (uint32_t i = 0; i < _width * _height; i++)
+      {
+        h = (h ^ (buffer[i] & 0xFF)) * 16777619u;
+        h = (h ^ (buffer[i] >> 8)) * 16777619u;
+      }
+      return h;
+    }
+
+    uint16_t readPixel(int32_t x, int32_t y) const
+    {
+      if ((x < 0) || (y < 0) || (x >= (int32_t)_width) || (y >= (int32_t)_height)) return 0;
+      return buffer[y * _width + x];
+    }
+
+    // Write the framebuffer as a binary PPM image for visual inspection
+    bool savePPM(const char *path) const
+    {
+      FILE *f = fopen(path, "wb");
+      if (!f) return false;
+      fprintf(f, "P6\n%u %u\n255\n", _width, _height);
+      for (uint32_t i = 0; i < _width * _height; i++)
+      {
+        uint16_t c = buffer[i];
+        uint8_t rgb[3] = { (uint8_t)((c >> 8) & 0xF8), (uint8_t)((c >> 3) & 0xFC), (uint8_t)((c << 3) & 0xF8) };
+        fwrite(rgb, 1, 3, f);
+      }
+      fclose(f);
+      return true;
+    }
+
+    const SinkCalls& getCalls(void) const { return calls; }
+    void resetCalls(void) { memset(&calls, 0, sizeof(calls)); }
+
+  protected:
+
+    using Base::_width;
+    using Base::_height;
+
+  private:
+
+    void writePixel(int32_t x, int32_t y, uint32_t color)
+    {
+      if ((x < 0) || (y < 0) || (x >= (int32_t)_width) || (y >= (int32_t)_height)) return;
+      buffer[y * _width + x] = color;
+      calls.pixels++;
+    }
+
+    void writeRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+    {
+      if (x < 0) { w += x; x = 0; }
+      if (y < 0) { h += y; y = 0; }
+      if (x + w > (int32_t)_width)  w = _width - x;
+      if (y + h > (int32_t)_height) h = _height - y;
+      if ((w <= 0) || (h <= 0)) return;
+      for (int32_t j = y; j < y + h; j++)
+      {
+        uint16_t *p = &buffer[j * _width + x];
+        for (int32_t i = 0; i < w; i++) p[i] = color;
+      }
+      calls.pixels += w * h;
+    }
+
+    uint16_t *buffer;
+    bool      batchSpans, packedGlyphs;
+    SinkCalls calls;
+};
+
+class HostFramebuffer : public HostFramebufferT<GxFont_GFX_TFT_eSPI>
+{
+  public:
+    HostFramebuffer(int16_t w, int16_t h) : HostFramebufferT<GxFont_GFX_TFT_eSPI>(w, h) {}
+};
+
+class InlineFramebuffer : public HostFramebufferT<GxFontRenderer<InlineFramebuffer> >
+{
+  public:
+    InlineFramebuffer(int16_t w, int16_t h) : HostFramebufferT<GxFontRenderer<InlineFramebuffer> >(w, h) {}
+};
+
+#endif
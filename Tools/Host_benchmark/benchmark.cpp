@@ -0,0 +1,412 @@
+// Host benchmark for GxFont_GFX_TFT_eSPI
+// Renders a test string in every font and reports glyphs/s, pixels/s, sink calls per glyph
+// and a framebuffer checksum that changes whenever the rendered image changes.
+
+#include "HostFramebuffer.h"
+
+#include <chrono>
+#include <string>
+#include <unistd.h>
+
+#define BENCH_WIDTH  800
+#define BENCH_HEIGHT 480
+
+typedef struct {
+  const char    *name;
+  uint8_t        font;    // Built-in font number, 0 for a free font or the VLW font
+  const GFXfont *gfxfont;
+  const char    *text;
+} BenchFont;
+
+static const char textAll[]    = "The quick brown fox jumps over 0123456789!";
+static const char textDigits[] = "0123456789:-.";
+static const char textFont6[]  = "0123456789:-.apm";
+static const char textClock[]  = "12:34";
+
+#define FREE_FONT(n, f) { n, 0, &f, textAll }
+
+static const BenchFont benchFonts[] = {
+  { "GLCD",  1, NULL, textAll },
+  { "Font2", 2, NULL, textAll },
+  { "Font4", 4, NULL, textAll },
+  { "Font6", 6, NULL, textFont6 },
+  { "Font7", 7, NULL, textDigits },
+  { "Font8", 8, NULL, textDigits },
+  FREE_FONT("TT1", TomThumb),
+  FREE_FONT("FF1", FreeMono9pt7b),
+  FREE_FONT("FF2", FreeMono12pt7b),
+  FREE_FONT("FF3", FreeMono18pt7b),
+  FREE_FONT("FF4", FreeMono24pt7b),
+  FREE_FONT("FF5", FreeMonoBold9pt7b),
+  FREE_FONT("FF6", FreeMonoBold12pt7b),
+  FREE_FONT("FF7", FreeMonoBold18pt7b),
+  FREE_FONT("FF8", FreeMonoBold24pt7b),
+  FREE_FONT("FF9", FreeMonoBoldOblique9pt7b),
+  FREE_FONT("FF10", FreeMonoBoldOblique12pt7b),
+  FREE_FONT("FF11", FreeMonoBoldOblique18pt7b),
+  FREE_FONT("FF12", FreeMonoBoldOblique24pt7b),
+  FREE_FONT("FF13", FreeMonoOblique9pt7b),
+  FREE_FONT("FF14", FreeMonoOblique12pt7b),
+  FREE_FONT("FF15", FreeMonoOblique18pt7b),
+  FREE_FONT("FF16", FreeMonoOblique24pt7b),
+  FREE_FONT("FF17", FreeSans9pt7b),
+  FREE_FONT("FF18", FreeSans12pt7b),
+  FREE_FONT("FF19", FreeSans18pt7b),
+  FREE_FONT("FF20", FreeSans24pt7b),
+  FREE_FONT("FF21", FreeSansBold9pt7b),
+  FREE_FONT("FF22", FreeSansBold12pt7b),
+  FREE_FONT("FF23", FreeSansBold18pt7b),
+  FREE_FONT("FF24", FreeSansBold24pt7b),
+  FREE_FONT("FF25", FreeSansBoldOblique9pt7b),
+  FREE_FONT("FF26", FreeSansBoldOblique12pt7b),
+  FREE_FONT("FF27", FreeSansBoldOblique18pt7b),
+  FREE_FONT("FF28", FreeSansBoldOblique24pt7b),
+  FREE_FONT("FF29", FreeSansOblique9pt7b),
+  FREE_FONT("FF30", FreeSansOblique12pt7b),
+  FREE_FONT("FF31", FreeSansOblique18pt7b),
+  FREE_FONT("FF32", FreeSansOblique24pt7b),
+  FREE_FONT("FF33", FreeSerif9pt7b),
+  FREE_FONT("FF34", FreeSerif12pt7b),
+  FREE_FONT("FF35", FreeSerif18pt7b),
+  FREE_FONT("FF36", FreeSerif24pt7b),
+  FREE_FONT("FF37", FreeSerifBold9pt7b),
+  FREE_FONT("FF38", FreeSerifBold12pt7b),
+  FREE_FONT("FF39", FreeSerifBold18pt7b),
+  FREE_FONT("FF40", FreeSerifBold24pt7b),
+  FREE_FONT("FF41", FreeSerifBoldItalic9pt7b),
+  FREE_FONT("FF42", FreeSerifBoldItalic12pt7b),
+  FREE_FONT("FF43", FreeSerifBoldItalic18pt7b),
+  FREE_FONT("FF44", FreeSerifBoldItalic24pt7b),
+  FREE_FONT("FF45", FreeSerifItalic9pt7b),
+  FREE_FONT("FF46", FreeSerifItalic12pt7b),
+  FREE_FONT("FF47", FreeSerifItalic18pt7b),
+  FREE_FONT("FF48", FreeSerifItalic24pt7b),
+  FREE_FONT("CF_OL24", Orbitron_Light_24),
+  FREE_FONT("CF_OL32", Orbitron_Light_32),
+  FREE_FONT("CF_RT24", Roboto_Thin_24),
+  FREE_FONT("CF_S24", Satisfy_24),
+  FREE_FONT("CF_Y32", Yellowtail_32),
+};
+
+#ifdef GFX_SPANS
+// Free fonts converted by Tools/GFX_spans, drawn from their spans instead of the bitmaps
+static const struct {
+  const GFXfont      *font;
+  const GFXfontSpans *spans;
+} spanFonts[] = {
+  { &FreeSans18pt7b,            &FreeSans18pt7bSpans },
+  { &FreeSans24pt7b,            &FreeSans24pt7bSpans },
+  { &FreeSansOblique18pt7b,     &FreeSansOblique18pt7bSpans },
+  { &FreeSansOblique24pt7b,     &FreeSansOblique24pt7bSpans },
+  { &FreeSansBold18pt7b,        &FreeSansBold18pt7bSpans },
+  { &FreeSansBold24pt7b,        &FreeSansBold24pt7bSpans },
+  { &FreeSansBoldOblique18pt7b, &FreeSansBoldOblique18pt7bSpans },
+  { &FreeSansBoldOblique24pt7b, &FreeSansBoldOblique24pt7bSpans },
+  { &FreeSerif18pt7b,           &FreeSerif18pt7bSpans },
+  { &FreeSerif24pt7b,           &FreeSerif24pt7bSpans },
+  { &FreeSerifItalic18pt7b,     &FreeSerifItalic18pt7bSpans },
+  { &FreeSerifItalic24pt7b,     &FreeSerifItalic24pt7bSpans },
+  { &FreeSerifBold18pt7b,       &FreeSerifBold18pt7bSpans },
+  { &FreeSerifBold24pt7b,       &FreeSerifBold24pt7bSpans },
+  { &FreeSerifBoldItalic18pt7b, &FreeSerifBoldItalic18pt7bSpans },
+  { &FreeSerifBoldItalic24pt7b, &FreeSerifBoldItalic24pt7bSpans },
+};
+#endif
+
+#ifdef GFX_PACKED
+// Free fonts packed by Tools/GFX_pack, drawn from their run lengths instead of the bitmaps
+#define PACKED_FONT(f) { &f, &f##Packed }
+
+static const struct {
+  const GFXfont       *font;
+  const GFXfontPacked *packed;
+} packedFonts[] = {
+  PACKED_FONT(FreeMono18pt7b),          PACKED_FONT(FreeMono24pt7b),
+  PACKED_FONT(FreeMonoOblique18pt7b),   PACKED_FONT(FreeMonoOblique24pt7b),
+  PACKED_FONT(FreeMonoBold12pt7b),      PACKED_FONT(FreeMonoBold18pt7b),
+  PACKED_FONT(FreeMonoBold24pt7b),      PACKED_FONT(FreeMonoBoldOblique12pt7b),
+  PACKED_FONT(FreeMonoBoldOblique18pt7b),PACKED_FONT(FreeMonoBoldOblique24pt7b),
+  PACKED_FONT(FreeSans12pt7b),          PACKED_FONT(FreeSans18pt7b),
+  PACKED_FONT(FreeSans24pt7b),          PACKED_FONT(FreeSansOblique12pt7b),
+  PACKED_FONT(FreeSansOblique18pt7b),   PACKED_FONT(FreeSansOblique24pt7b),
+  PACKED_FONT(FreeSansBold12pt7b),      PACKED_FONT(FreeSansBold18pt7b),
+  PACKED_FONT(FreeSansBold24pt7b),      PACKED_FONT(FreeSansBoldOblique12pt7b),
+  PACKED_FONT(FreeSansBoldOblique18pt7b),PACKED_FONT(FreeSansBoldOblique24pt7b),
+  PACKED_FONT(FreeSerif18pt7b),         PACKED_FONT(FreeSerif24pt7b),
+  PACKED_FONT(FreeSerifItalic18pt7b),   PACKED_FONT(FreeSerifItalic24pt7b),
+  PACKED_FONT(FreeSerifBold18pt7b),     PACKED_FONT(FreeSerifBold24pt7b),
+  PACKED_FONT(FreeSerifBoldItalic12pt7b),PACKED_FONT(FreeSerifBoldItalic18pt7b),
+  PACKED_FONT(FreeSerifBoldItalic24pt7b),PACKED_FONT(Orbitron_Light_24),
+  PACKED_FONT(Orbitron_Light_32),       PACKED_FONT(Yellowtail_32),
+};
+#endif
+
+// Large multiplied clock digits, drawn with -c at sizes 2 to 4
+static const BenchFont clockFonts[] = {
+  { "Font4", 4, NULL, textClock },
+  { "Font6", 6, NULL, textClock },
+  { "Font7", 7, NULL, textClock },
+  { "Font8", 8, NULL, textClock },
+};
+
+static void writeInt32(FILE *f, int32_t v)
+{
+  uint8_t b[4] = { (uint8_t)(v >> 24), (uint8_t)(v >> 16), (uint8_t)(v >> 8), (uint8_t)v };
+  fwrite(b, 1, 4, f);
+}
+
+// Convert a free font to the Processing .vlw format used by loadFont()
+// Pixels beside the glyph edges get a part alpha value so the blending path is exercised
+static bool writeVLW(const char *path, const GFXfont *gfx)
+{
+  FILE *f = fopen(path, "wb");
+  if (!f) return false;
+
+  uint8_t first = gfx->first, last = gfx->last;
+  int32_t count = last - first + 1;
+  const GFXglyph *d = &gfx->glyph['d' - first];
+  const GFXglyph *p = &gfx->glyph['p' - first];
+
+  writeInt32(f, count);
+  writeInt32(f, 11);
+  writeInt32(f, gfx->yAdvance);
+  writeInt32(f, 0);
+  writeInt32(f, -d->yOffset);
+  writeInt32(f, p->height + p->yOffset);
+
+  for (int32_t c = 0; c < count; c++)
+  {
+    const GFXglyph *g = &gfx->glyph[c];
+    writeInt32(f, first + c);
+    writeInt32(f, g->height);
+    writeInt32(f, g->width);
+    writeInt32(f, g->xAdvance);
+    writeInt32(f, -g->yOffset);
+    writeInt32(f, g->xOffset);
+    writeInt32(f, 0);
+  }
+
+  for (int32_t c = 0; c < count; c++)
+  {
+    const GFXglyph *g = &gfx->glyph[c];
+    uint32_t bit = g->bitmapOffset * 8;
+    for (int y = 0; y < g->height; y++)
+    {
+      bool last = false;
+      for (int x = 0; x < g->width; x++, bit++)
+      {
+        bool set = gfx->bitmap[bit >> 3] & (0x80 >> (bit & 7));
+        fputc(set ? 0xFF : (last ? 0x60 : 0x00), f);
+        last = set;
+      }
+    }
+  }
+
+  fputc(0, f); fputc(0, f); // Empty font and Postscript names
+  fputc(1, f);              // Smoothed
+  fclose(f);
+  return true;
+}
+
+typedef struct {
+  uint32_t    iterations;
+  uint8_t     size;
+  bool        opaque, batchSpans, packedGlyphs;
+  bool        vlw;             // Also benchmark the VLW font after the fonts in the table
+  bool        mirror;          // Draw the RLE fonts from a RAM copy made with preloadFont()
+  const char *imageDir;
+  std::string vlwDir, vlwName; // loadFont() name of the VLW font and the directory it is in
+} BenchOptions;
+
+static uint32_t glyphCount(const char *text)
+{
+  uint32_t n = 0;
+  while (*text) if ((*text++ & 0xC0) != 0x80) n++; // Count UTF-8 lead bytes only
+  return n;
+}
+
+// Draw the test string in every font and print one line of results per font
+template <class Framebuffer>
+static bool runBenchmark(const BenchOptions& o, const BenchFont *fonts, size_t fontCount)
+{
+  for (size_t i = 0; i < fontCount + o.vlw; i++)
+  {
+    Framebuffer tft(BENCH_WIDTH, BENCH_HEIGHT);
+    tft.setBatchSpans(o.batchSpans);
+    tft.setPackedGlyphs(o.packedGlyphs);
+    tft.setTextSize(o.size);
+    if (o.opaque) tft.setTextColor(TFT_WHITE, TFT_BLUE);
+    else tft.setTextColor(TFT_WHITE);
+
+    const char *name, *text;
+    if (i < fontCount)
+    {
+      name = fonts[i].name;
+      text = fonts[i].text;
+      if (fonts[i].gfxfont) tft.setFreeFont(fonts[i].gfxfont);
+      else tft.setTextFont(fonts[i].font);
+#ifdef GFX_SPANS
+      for (size_t k = 0; k < sizeof(spanFonts) / sizeof(spanFonts[0]); k++)
+        if (spanFonts[k].font == fonts[i].gfxfont) tft.setFreeFontSpans(spanFonts[k].spans);
+#endif
+#ifdef GFX_PACKED
+      for (size_t k = 0; k < sizeof(packedFonts) / sizeof(packedFonts[0]); k++)
+        if (packedFonts[k].font == fonts[i].gfxfont) tft.setFreeFontPacked(packedFonts[k].packed);
+#endif
+#ifdef FONT_MIRROR
+      if (o.mirror && !fonts[i].gfxfont) tft.preloadFont(fonts[i].font);
+#endif
+    }
+    else
+    {
+      name = "VLW";
+      text = textAll;
+      tft.loadFont(o.vlwName.c_str());
+      if (!tft.fontLoaded)
+      {
+        fprintf(stderr, "Cannot load %s/%s.vlw\n", o.vlwDir.c_str(), o.vlwName.c_str());
+        return false;
+      }
+    }
+
+    // A single render on a clean framebuffer gives the regression checksum
+    tft.drawString(text, 10, 10);
+    uint32_t sum = tft.checksum();
+    if (o.imageDir) tft.savePPM((std::string(o.imageDir) + "/" + name + ".ppm").c_str());
+
+    tft.resetCalls();
+#ifdef RENDER_STATS
+    tft.resetRenderStats();
+#endif
+#ifdef GLYPH_CACHE
+    tft.resetGlyphCacheStats();
+#endif
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < o.iterations; n++) tft.drawString(text, 10, 10);
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (secs <= 0) secs = 1e-9;
+
+    const typename Framebuffer::SinkCalls& c = tft.getCalls();
+    double glyphs = (double)glyphCount(text) * o.iterations;
+    double calls = (double)c.drawPixel + c.drawFastHLine + c.fillRect + c.drawSpans + c.drawBitmap1bpp;
+    printf("%-8s %10.0f %10.2f %12.1f %8.1f %8.1f %8.1f %8.1f %8.1f %08x\n", name, glyphs / secs,
+           c.pixels / secs / 1e6, calls / glyphs, c.drawPixel / glyphs, c.drawFastHLine / glyphs,
+           c.fillRect / glyphs, c.drawSpans / glyphs, c.drawBitmap1bpp / glyphs, sum);
+#ifdef RENDER_STATS
+    const GxFont_GFX_TFT_eSPI::RenderStats& r = tft.getRenderStats();
+    printf("%-8s stats: %u glyphs, %.1f pixels/glyph, %.1f overdraw/glyph, %.1f spans/batch, %.1f coalesced/glyph\n", "",
+           r.glyphs, (double)r.pixels / r.glyphs, (double)r.overdraw / r.glyphs,
+           r.drawSpans ? (double)r.spans / r.drawSpans : 0.0, (double)r.coalesced / r.glyphs);
+#endif
+#ifdef GLYPH_CACHE
+    const GxFont_GFX_TFT_eSPI::GlyphCacheStats& g = tft.getGlyphCacheStats();
+    printf("%-8s cache: %u hits, %u misses, %u evictions, %u glyphs in %u bytes\n", "", g.hits, g.misses,
+           g.evictions, g.entries, g.bytes);
+#endif
+
+#ifdef FONT_MIRROR
+    if (o.mirror && (i < fontCount) && tft.fontMirrorBytes(fonts[i].font))
+      printf("%-8s mirror: %u bytes of RAM\n", "", tft.fontMirrorBytes(fonts[i].font));
+#endif
+
+    if (i == fontCount) tft.unloadFont();
+  }
+  return true;
+}
+
+// Run the font table, or the clock digits once per size with -c
+template <class Framebuffer>
+static bool runAll(BenchOptions o, bool clock)
+{
+  if (!clock) return runBenchmark<Framebuffer>(o, benchFonts, sizeof(benchFonts) / sizeof(benchFonts[0]));
+
+  o.vlw = false;
+  for (o.size = 2; o.size <= 4; o.size++)
+  {
+    printf("size %u\n", o.size);
+    if (!runBenchmark<Framebuffer>(o, clockFonts, sizeof(clockFonts) / sizeof(clockFonts[0]))) return false;
+  }
+  return true;
+}
+
+static void usage(const char *name)
+{
+  fprintf(stderr, "Usage: %s [-i iterations] [-s size] [-o] [-b] [-p] [-t] [-c] [-m] [-v font.vlw] [-w dir]\n", name);
+  fprintf(stderr, "  -i  number of times each string is drawn (default 200)\n");
+  fprintf(stderr, "  -s  text size multiplier (default 1)\n");
+  fprintf(stderr, "  -o  opaque text, background colour differs from text colour\n");
+  fprintf(stderr, "  -b  sink takes over drawSpans() batches\n");
+  fprintf(stderr, "  -p  sink takes over drawBitmap1bpp() packed glyphs\n");
+  fprintf(stderr, "  -t  sink is a GxFontRenderer template, drawing calls are inlined\n");
+  fprintf(stderr, "  -c  clock digits in Font 4/6/7/8 at sizes 2 to 4 instead of all fonts\n");
+  fprintf(stderr, "  -m  draw fonts 4, 6, 7 and 8 from RAM copies, needs make MIRROR=1\n");
+  fprintf(stderr, "  -v  benchmark this .vlw file instead of one converted from FreeSans12pt7b\n");
+  fprintf(stderr, "  -w  write a PPM image of every font into this directory\n");
+}
+
+int main(int argc, char **argv)
+{
+  BenchOptions o;
+  o.iterations   = 200;
+  o.size         = 1;
+  o.opaque       = false;
+  o.batchSpans   = false;
+  o.packedGlyphs = false;
+  o.imageDir     = NULL;
+  o.vlw          = true;
+  o.mirror       = false;
+  bool inlineSink = false;
+  bool clock      = false;
+  const char *vlwFile = NULL;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "i:s:obptcmv:w:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'i': o.iterations = atoi(optarg); break;
+      case 's': o.size = atoi(optarg); break;
+      case 'o': o.opaque = true; break;
+      case 'b': o.batchSpans = true; break;
+      case 'p': o.packedGlyphs = true; break;
+      case 't': inlineSink = true; break;
+      case 'c': clock = true; break;
+      case 'm': o.mirror = true; break;
+      case 'v': vlwFile = optarg; break;
+      case 'w': o.imageDir = optarg; break;
+      default: usage(argv[0]); return 1;
+    }
+  }
+  if (o.iterations < 1) o.iterations = 1;
+
+  // loadFont() opens "/<name>.vlw" in SPIFFS, so point SPIFFS at the directory of the file
+  if (vlwFile)
+  {
+    std::string path(vlwFile);
+    size_t slash = path.rfind('/');
+    o.vlwDir  = (slash == std::string::npos) ? "." : path.substr(0, slash);
+    o.vlwName = path.substr(slash + 1);
+  }
+  else
+  {
+    const char *tmp = getenv("TMPDIR");
+    o.vlwDir  = tmp ? tmp : "/tmp";
+    o.vlwName = "GxFont_bench.vlw";
+    if (!writeVLW((o.vlwDir + "/" + o.vlwName).c_str(), &FreeSans12pt7b))
+    {
+      fprintf(stderr, "Cannot write %s/%s\n", o.vlwDir.c_str(), o.vlwName.c_str());
+      return 1;
+    }
+  }
+  if (o.vlwName.size() > 4 && o.vlwName.compare(o.vlwName.size() - 4, 4, ".vlw") == 0) o.vlwName.resize(o.vlwName.size() - 4);
+  SPIFFS.begin(o.vlwDir.c_str());
+
+  printf("%u iterations, size %s, %s%s%s%s%s\n\n", o.iterations, clock ? "2 to 4" : std::to_string(o.size).c_str(), o.opaque ? "opaque" : "transparent",
+         o.batchSpans ? ", drawSpans" : "", o.packedGlyphs ? ", drawBitmap1bpp" : "", inlineSink ? ", GxFontRenderer" : "",
+         o.mirror ? ", RAM fonts" : "");
+  printf("%-8s %10s %10s %12s %8s %8s %8s %8s %8s %8s\n", "font", "glyphs/s", "Mpixels/s", "calls/glyph",
+         "pixel", "hline", "rect", "spans", "1bpp", "checksum");
+
+  if (inlineSink) return runAll<InlineFramebuffer>(o, clock) ? 0 : 1;
+  return runAll<HostFramebuffer>(o, clock) ? 0 : 1;
+}
@@ -0,0 +1,61 @@
+// Host shim for the subset of the Arduino core used by GxFont_GFX_TFT_eSPI
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+
+#include "pgmspace.h"
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline void yield(void) {}
+inline void delay(unsigned long) {}
+
+inline char *ltoa(long value, char *str, int radix)
+{
+  char tmp[34];
+  char *p = tmp;
+  bool neg = (value < 0) && (radix == 10);
+  unsigned long v = neg ? -(unsigned long)value : (unsigned long)value;
+  do {
+    int d = v % radix;
+    *p++ = d < 10 ? '0' + d : 'a' + d - 10;
+    v /= radix;
+  } while (v);
+  char *s = str;
+  if (neg) *s++ = '-';
+  while (p > tmp) *s++ = *--p;
+  *s = 0;
+  return str;
+}
+
+class String
+{
+  public:
+    String(const char *s = "") : _s(s ? s : "") {}
+    String(const std::string &s) : _s(s) {}
+    unsigned int length(void) const { return _s.length(); }
+    const char *c_str(void) const { return _s.c_str(); }
+    void toCharArray(char *buf, unsigned int bufsize) const
+    {
+      if (!bufsize) return;
+      size_t n = _s.copy(buf, bufsize - 1);
+      buf[n] = 0;
+    }
+    String operator+(const String &rhs) const { return String(_s + rhs._s); }
+    friend String operator+(const char *lhs, const String &rhs) { return String(std::string(lhs) + rhs._s); }
+    bool operator==(const String &rhs) const { return _s == rhs._s; }
+  private:
+    std::string _s;
+};
+
+#endif
@@ -0,0 +1,54 @@
+// Host shim for the ESP8266/ESP32 FS API, SPIFFS is mapped onto a directory of the host
+#ifndef _HOST_FS_H_
+#define _HOST_FS_H_
+
+#include "Arduino.h"
+
+namespace fs
+{
+  enum SeekMode { SeekSet = SEEK_SET, SeekCur = SEEK_CUR, SeekEnd = SEEK_END };
+
+  class File
+  {
+    public:
+      File(FILE *f = NULL) : _f(f) {}
+      operator bool() const { return _f != NULL; }
+      int read(void) { return _f ? fgetc(_f) : -1; }
+      size_t read(uint8_t *buf, size_t size) { return _f ? fread(buf, 1, size, _f) : 0; }
+      bool seek(uint32_t pos, SeekMode mode) { return _f && !fseek(_f, pos, mode); }
+      void close(void)
+      {
+        if (_f) fclose(_f);
+        _f = NULL;
+      }
+    private:
+      FILE *_f;
+  };
+
+  class FS
+  {
+    public:
+      FS() : _root(".") {}
+      bool begin(const char *root = ".")
+      {
+        _root = root;
+        return true;
+      }
+      File open(const String &path, const char *mode)
+      {
+        return File(fopen((_root + path.c_str()).c_str(), mode));
+      }
+    private:
+      std::string _root;
+  };
+
+  inline FS &spiffs(void)
+  {
+    static FS instance; // One instance shared by all translation units
+    return instance;
+  }
+}
+
+#define SPIFFS (fs::spiffs())
+
+#endif
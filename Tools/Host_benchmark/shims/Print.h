@@ -0,0 +1,30 @@
+// Host shim for the Arduino Print class, only what the library and benchmark need
+#ifndef _HOST_PRINT_H_
+#define _HOST_PRINT_H_
+
+#include "Arduino.h"
+
+class Print
+{
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t) = 0;
+
+    size_t write(const char *str)
+    {
+      size_t n = 0;
+      while (*str) n += write((uint8_t)*str++);
+      return n;
+    }
+    size_t print(const char *str) { return write(str); }
+    size_t print(const String &s) { return write(s.c_str()); }
+    size_t print(long n)
+    {
+      char buf[12];
+      return write(ltoa(n, buf, 10));
+    }
+    size_t println(void) { return write('\n'); }
+    size_t println(const char *str) { return print(str) + println(); }
+};
+
+#endif
@@ -0,0 +1,6 @@
+// Host build setup: the library User_Setup.h plus the smooth font extension
+#include "../../../User_Setup.h"
+
+#ifndef SMOOTH_FONT
+#define SMOOTH_FONT
+#endif
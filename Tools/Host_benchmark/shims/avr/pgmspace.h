@@ -0,0 +1 @@
+#include "../pgmspace.h"
@@ -0,0 +1,21 @@
+// Host shim for the Arduino PROGMEM API: flash is ordinary memory on the host
+#ifndef _HOST_PGMSPACE_H_
+#define _HOST_PGMSPACE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+
+#define pgm_read_byte(addr)  (*(const uint8_t  *)(const void *)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t *)(const void *)(addr))
+// The library only uses pgm_read_dword() to fetch pointers, so read a host pointer
+inline uintptr_t pgm_read_pointer(const void *addr)
+{
+  uintptr_t v;
+  memcpy(&v, addr, sizeof(v));
+  return v;
+}
+#define pgm_read_dword(addr) pgm_read_pointer((const void *)(addr))
+
+#endif
@@ -0,0 +1,179 @@
+// Row index generator for the RLE fonts of GxFont_GFX_TFT_eSPI
+// Writes Fonts/Font*rle_rows.c, used by the RLE renderer when RLE_ROW_INDEX is defined in
+// User_Setup.h, so glyphs clipped at the top are decoded from the first visible row on.
+//
+// Layout of rowtbl_<suffix>[]:
+//   one byte per character code: the glyph slot, characters sharing glyph data share a slot
+//   then per slot and every rowstep_<suffix> rows: the byte offset of the run that holds the
+//   first pixel of that row (low byte, high byte) and the number of run pixels before it
+
+#include <pgmspace.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+namespace f32    {
+#include <Fonts/Font32rle.c>
+}
+namespace f64    {
+#include <Fonts/Font64rle.c>
+}
+namespace f7s    {
+#include <Fonts/Font7srle.c>
+}
+namespace f72    {
+#include <Fonts/Font72rle.c>
+}
+namespace f72x53 {
+#include <Fonts/Font72x53rle.c>
+}
+
+typedef struct {
+  const char                 *file;    // Font file name without .c
+  const char                 *suffix;  // Suffix of the table names in the font file
+  const char                 *title;
+  const unsigned char* const *chrtbl;
+  const unsigned char        *widtbl;
+  int                         height;
+} RleFont;
+
+static const RleFont rleFonts[] = {
+  { "Font32rle",    "f32", "Font 4",              f32::chrtbl_f32,    f32::widtbl_f32,    26 },
+  { "Font64rle",    "f64", "Font 6",              f64::chrtbl_f64,    f64::widtbl_f64,    48 },
+  { "Font7srle",    "f7s", "Font 7",              f7s::chrtbl_f7s,    f7s::widtbl_f7s,    48 },
+  { "Font72rle",    "f72", "Font 8",              f72::chrtbl_f72,    f72::widtbl_f72,    75 },
+  { "Font72x53rle", "f72", "Font 8, narrow digits", f72x53::chrtbl_f72, f72x53::widtbl_f72, 75 },
+};
+
+#define NR_CHRS 96
+
+// Append the index entries of one glyph, entry k is for row (k + 1) * step
+// Returns false if the runs end before the last indexed row
+static bool indexGlyph(std::vector<int>& out, const unsigned char *data, int width, int height, int step)
+{
+  int entries = (height - 1) / step;
+  int total = width * height;
+  if (!width) // Nothing is decoded, the renderer does not seek
+  {
+    out.insert(out.end(), entries * 2, 0);
+    return true;
+  }
+  int pc = 0, offset = 0;
+  for (int k = 1; k <= entries; k++)
+  {
+    int target = k * step * width; // First pixel of the indexed row
+    // Find the run holding the target pixel
+    while (pc < total)
+    {
+      int run = (data[offset] & 0x7F) + 1;
+      if (pc + run > target) break;
+      pc += run;
+      offset++;
+    }
+    if (pc >= total) return false;
+    out.push_back(offset);
+    out.push_back(target - pc);
+  }
+  return true;
+}
+
+static bool writeIndex(const RleFont& f, const std::string& dir, int step)
+{
+  std::string path = dir + "/" + f.file + "_rows.c";
+  FILE *out = fopen(path.c_str(), "w");
+  if (!out)
+  {
+    fprintf(stderr, "Cannot write %s\n", path.c_str());
+    return false;
+  }
+
+  int entries = (f.height - 1) / step;
+  std::vector<const unsigned char *> glyphs;
+  std::vector<int> slot(NR_CHRS);
+  std::vector<int> index;
+  for (int c = 0; c < NR_CHRS; c++)
+  {
+    size_t s = 0;
+    while ((s < glyphs.size()) && (glyphs[s] != f.chrtbl[c])) s++;
+    if (s == glyphs.size())
+    {
+      glyphs.push_back(f.chrtbl[c]);
+      if (!indexGlyph(index, f.chrtbl[c], f.widtbl[c], f.height, step))
+      {
+        fprintf(stderr, "%s character %d has fewer pixels than its size\n", f.file, c + 32);
+        fclose(out);
+        return false;
+      }
+    }
+    slot[c] = s;
+  }
+  for (size_t i = 0; i < index.size(); i += 2)
+  {
+    if ((index[i] > 0xFFFF) || (index[i + 1] > 0xFF) || (glyphs.size() > 0xFF))
+    {
+      fprintf(stderr, "%s does not fit the row index format\n", f.file);
+      fclose(out);
+      return false;
+    }
+  }
+
+  fprintf(out, "// %s row index, generated by Tools/RLE_row_index from %s.c\n", f.title, f.file);
+  fprintf(out, "//\n");
+  fprintf(out, "// One glyph slot per character, then for every slot and every %d rows the offset\n", step);
+  fprintf(out, "// of the run holding the first pixel of the row and the run pixels before it\n\n");
+  fprintf(out, "#include <pgmspace.h>\n\n");
+  fprintf(out, "#define rowstep_%s %d\n\n", f.suffix, step);
+  fprintf(out, "PROGMEM const unsigned char rowtbl_%s[] =\n{\n", f.suffix);
+  for (int c = 0; c < NR_CHRS; c += 8)
+  {
+    fprintf(out, "        ");
+    for (int i = c; i < c + 8; i++) fprintf(out, "%d, ", slot[i]);
+    fprintf(out, "    // char %d - %d\n", c + 32, c + 39);
+  }
+  for (size_t s = 0; s < glyphs.size(); s++)
+  {
+    fprintf(out, "        ");
+    for (int k = 0; k < entries; k++)
+    {
+      int offset = index[(s * entries + k) * 2], skip = index[(s * entries + k) * 2 + 1];
+      fprintf(out, "0x%02X, 0x%02X, 0x%02X, ", offset & 0xFF, offset >> 8, skip);
+    }
+    fprintf(out, "    // slot %u\n", (unsigned)s);
+  }
+  fprintf(out, "        0\n};\n");
+  fclose(out);
+  printf("%s: %u glyphs, %d entries each, %u bytes\n", path.c_str(), (unsigned)glyphs.size(), entries,
+         (unsigned)(NR_CHRS + glyphs.size() * entries * 3 + 1));
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  std::string dir = "../../Fonts";
+  int step = 8;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "r:o:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'r': step = atoi(optarg); break;
+      case 'o': dir = optarg; break;
+      default:
+        fprintf(stderr, "Usage: %s [-r rows] [-o dir]\n", argv[0]);
+        fprintf(stderr, "  -r  rows between index entries (default 8)\n");
+        fprintf(stderr, "  -o  directory the _rows.c files are written to (default ../../Fonts)\n");
+        return 1;
+    }
+  }
+  if (step < 1) step = 1;
+
+  for (size_t i = 0; i < sizeof(rleFonts) / sizeof(rleFonts[0]); i++)
+    if (!writeIndex(rleFonts[i], dir, step)) return 1;
+  return 0;
+}
@@ -28,8 +28,60 @@
 //#define LOAD_FONT8N // Font 8. Alternative to Font 8 above, slightly narrower, so 3 digits fit a 160 pixel TFT
 #define LOAD_GFXFF  // FreeFonts. Include access to the 48 Adafruit_GFX free fonts FF1 to FF48 and custom fonts
 
+// Uncomment to draw the GLCD font from a row-major copy of its table, 8 bytes per character
+// generated by Tools/GLCD_rows, instead of transposing the 5 column bytes. Needs 2 kbytes more FLASH.
+//#define GLCD_ROWS
+
+// Uncomment to draw free font strings with a background colour row by row, background and glyph
+// pixels are then written once each instead of filling the text box first. Uses more but smaller
+// drawFastHLine() or fillRect() calls, so it pays where pixel writes cost more than calls.
+// Takes about 25 * SPAN_BUFFER_SIZE bytes of stack whatever the string length, that is 900 bytes
+// with the default SPAN_BUFFER_SIZE of 32 and 300 bytes on AVR where it is 8.
+//#define GFX_SINGLE_PASS
+
+// Uncomment to allow free fonts converted by Tools/GFX_spans to be selected with setFreeFontSpans(), e.g.
+// &FreeSans18pt7bSpans. Glyph rows are stored as runs and drawn without testing bits, the 18 and 24 point
+// sans serif and serif fonts are provided. A converted font needs 1.3 to 2 times the FLASH of its bitmaps.
+//#define GFX_SPANS
+
+// Uncomment to allow free fonts packed by Tools/GFX_pack to be selected with setFreeFontPacked(), e.g.
+// &FreeSans24pt7bPacked. The glyphs are stored as run lengths, 12 to 48% smaller for the 18 and 24 point
+// fonts, and decoded straight into runs. Only the fonts that get smaller are provided.
+//#define GFX_PACKED
+
+// Uncomment to use the row index of the RLE fonts 4, 6, 7 and 8, glyphs clipped at the top are then
+// decoded from the first visible row on. Needs 300 to 1000 bytes more FLASH per font.
+//#define RLE_ROW_INDEX
+
 // Comment out the #define below to stop the SPIFFS filing system and smooth font code being loaded
 // this will save ~20kbytes of FLASH
 //#define SMOOTH_FONT
 
+// Uncomment to count the calls and pixels the font renderers send to the display class,
+// read with getRenderStats() and clear with resetRenderStats()
+//#define RENDER_STATS
+
+// Uncomment to keep recently drawn glyphs in RAM as decoded runs, repeated characters are
+// then drawn without decoding the font data again. The limits below are the defaults.
+//#define GLYPH_CACHE
+//#define GLYPH_CACHE_BYTES   4096 // RAM for the runs, 3 bytes per run
+//#define GLYPH_CACHE_ENTRIES 64   // Maximum number of glyphs kept
+
+// Uncomment to draw Font 7 digits as seven segment rectangles instead of decoding the RLE glyphs,
+// at most seven fillRect() calls per character at any text size. The segment ends are square.
+//#define FONT7_SEGMENTS
+
+// Uncomment to allow RLE fonts 4, 6, 7 and 8 to be copied into RAM with preloadFont(font), they are
+// then drawn from 1 bit per pixel rows instead of decoding FLASH. RAM needed: font 4 10176 bytes,
+// font 6 3648 bytes, font 7 2880 bytes, font 8 7392 bytes, see fontMirrorBytes().
+//#define FONT_MIRROR
+
+// Uncomment to add GxNumericField, a number display for clocks and counters that only redraws the
+// characters that changed and returns the changed area for partial refresh
+//#define NUMERIC_FIELD
+
+// Uncomment to allow text to be recorded once with startRecording()/stopRecording() and
+// drawn per page with replay(), only the glyphs that touch the page are then decoded
+//#define DISPLAY_LIST
+
 